@@ -0,0 +1,1328 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	68 00 02 00 00       	push   $0x200
+  10:	68 a0 0b 00 00       	push   $0xba0
+  15:	56                   	push   %esi
+  16:	e8 53 03 00 00       	call   36e <read>
+  1b:	89 c3                	mov    %eax,%ebx
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	85 c0                	test   %eax,%eax
+  22:	7e 2b                	jle    4f <cat+0x4f>
+    if (write(1, buf, n) != n) {
+  24:	83 ec 04             	sub    $0x4,%esp
+  27:	53                   	push   %ebx
+  28:	68 a0 0b 00 00       	push   $0xba0
+  2d:	6a 01                	push   $0x1
+  2f:	e8 42 03 00 00       	call   376 <write>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	39 d8                	cmp    %ebx,%eax
+  39:	74 cd                	je     8 <cat+0x8>
+      printf(1, "cat: write error\n");
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	68 24 08 00 00       	push   $0x824
+  43:	6a 01                	push   $0x1
+  45:	e8 e4 04 00 00       	call   52e <printf>
+      exit();
+  4a:	e8 07 03 00 00       	call   356 <exit>
+    }
+  }
+  if(n < 0){
+  4f:	78 07                	js     58 <cat+0x58>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  54:	5b                   	pop    %ebx
+  55:	5e                   	pop    %esi
+  56:	5d                   	pop    %ebp
+  57:	c3                   	ret
+    printf(1, "cat: read error\n");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 36 08 00 00       	push   $0x836
+  60:	6a 01                	push   $0x1
+  62:	e8 c7 04 00 00       	call   52e <printf>
+    exit();
+  67:	e8 ea 02 00 00       	call   356 <exit>
+
+0000006c <main>:
+
+int
+main(int argc, char *argv[])
+{
+  6c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  70:	83 e4 f0             	and    $0xfffffff0,%esp
+  73:	ff 71 fc             	push   -0x4(%ecx)
+  76:	55                   	push   %ebp
+  77:	89 e5                	mov    %esp,%ebp
+  79:	57                   	push   %edi
+  7a:	56                   	push   %esi
+  7b:	53                   	push   %ebx
+  7c:	51                   	push   %ecx
+  7d:	83 ec 18             	sub    $0x18,%esp
+  80:	8b 01                	mov    (%ecx),%eax
+  82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  85:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i;
+
+  if(argc <= 1){
+  88:	83 c6 04             	add    $0x4,%esi
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  if(argc <= 1){
+  90:	83 f8 01             	cmp    $0x1,%eax
+  93:	7e 39                	jle    ce <main+0x62>
+    if((fd = open(argv[i], 0)) < 0){
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	6a 00                	push   $0x0
+  9a:	ff 36                	push   (%esi)
+  9c:	e8 f5 02 00 00       	call   396 <open>
+  a1:	89 c3                	mov    %eax,%ebx
+  a3:	83 c4 10             	add    $0x10,%esp
+  a6:	85 c0                	test   %eax,%eax
+  a8:	78 33                	js     dd <main+0x71>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  aa:	83 ec 0c             	sub    $0xc,%esp
+  ad:	50                   	push   %eax
+  ae:	e8 4d ff ff ff       	call   0 <cat>
+    close(fd);
+  b3:	89 1c 24             	mov    %ebx,(%esp)
+  b6:	e8 c3 02 00 00       	call   37e <close>
+  for(i = 1; i < argc; i++){
+  bb:	83 c7 01             	add    $0x1,%edi
+  be:	83 c6 04             	add    $0x4,%esi
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  c7:	75 cc                	jne    95 <main+0x29>
+  }
+  exit();
+  c9:	e8 88 02 00 00       	call   356 <exit>
+    cat(0);
+  ce:	83 ec 0c             	sub    $0xc,%esp
+  d1:	6a 00                	push   $0x0
+  d3:	e8 28 ff ff ff       	call   0 <cat>
+    exit();
+  d8:	e8 79 02 00 00       	call   356 <exit>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  dd:	83 ec 04             	sub    $0x4,%esp
+  e0:	ff 36                	push   (%esi)
+  e2:	68 47 08 00 00       	push   $0x847
+  e7:	6a 01                	push   $0x1
+  e9:	e8 40 04 00 00       	call   52e <printf>
+      exit();
+  ee:	e8 63 02 00 00       	call   356 <exit>
+
+000000f3 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  f3:	55                   	push   %ebp
+  f4:	89 e5                	mov    %esp,%ebp
+  f6:	53                   	push   %ebx
+  f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  fd:	b8 00 00 00 00       	mov    $0x0,%eax
+ 102:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 106:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 109:	83 c0 01             	add    $0x1,%eax
+ 10c:	84 d2                	test   %dl,%dl
+ 10e:	75 f2                	jne    102 <strcpy+0xf>
+    ;
+  return os;
+}
+ 110:	89 c8                	mov    %ecx,%eax
+ 112:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 115:	c9                   	leave
+ 116:	c3                   	ret
+
+00000117 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 117:	55                   	push   %ebp
+ 118:	89 e5                	mov    %esp,%ebp
+ 11a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 11d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 120:	0f b6 01             	movzbl (%ecx),%eax
+ 123:	84 c0                	test   %al,%al
+ 125:	74 11                	je     138 <strcmp+0x21>
+ 127:	38 02                	cmp    %al,(%edx)
+ 129:	75 0d                	jne    138 <strcmp+0x21>
+    p++, q++;
+ 12b:	83 c1 01             	add    $0x1,%ecx
+ 12e:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 131:	0f b6 01             	movzbl (%ecx),%eax
+ 134:	84 c0                	test   %al,%al
+ 136:	75 ef                	jne    127 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 138:	0f b6 c0             	movzbl %al,%eax
+ 13b:	0f b6 12             	movzbl (%edx),%edx
+ 13e:	29 d0                	sub    %edx,%eax
+}
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+
+00000142 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 142:	55                   	push   %ebp
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 148:	80 3a 00             	cmpb   $0x0,(%edx)
+ 14b:	74 14                	je     161 <strlen+0x1f>
+ 14d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 152:	83 c0 01             	add    $0x1,%eax
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 15b:	75 f5                	jne    152 <strlen+0x10>
+    ;
+  return n;
+}
+ 15d:	89 c8                	mov    %ecx,%eax
+ 15f:	5d                   	pop    %ebp
+ 160:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 161:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 166:	eb f5                	jmp    15d <strlen+0x1b>
+
+00000168 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 168:	55                   	push   %ebp
+ 169:	89 e5                	mov    %esp,%ebp
+ 16b:	57                   	push   %edi
+ 16c:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 16f:	89 d7                	mov    %edx,%edi
+ 171:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 174:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 177:	fc                   	cld
+ 178:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 17a:	89 d0                	mov    %edx,%eax
+ 17c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 17f:	c9                   	leave
+ 180:	c3                   	ret
+
+00000181 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 181:	55                   	push   %ebp
+ 182:	89 e5                	mov    %esp,%ebp
+ 184:	8b 45 08             	mov    0x8(%ebp),%eax
+ 187:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 18b:	0f b6 10             	movzbl (%eax),%edx
+ 18e:	84 d2                	test   %dl,%dl
+ 190:	74 15                	je     1a7 <strchr+0x26>
+    if(*s == c)
+ 192:	38 d1                	cmp    %dl,%cl
+ 194:	74 0f                	je     1a5 <strchr+0x24>
+  for(; *s; s++)
+ 196:	83 c0 01             	add    $0x1,%eax
+ 199:	0f b6 10             	movzbl (%eax),%edx
+ 19c:	84 d2                	test   %dl,%dl
+ 19e:	75 f2                	jne    192 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1a5:	5d                   	pop    %ebp
+ 1a6:	c3                   	ret
+  return 0;
+ 1a7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1ac:	eb f7                	jmp    1a5 <strchr+0x24>
+
+000001ae <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	57                   	push   %edi
+ 1b2:	56                   	push   %esi
+ 1b3:	53                   	push   %ebx
+ 1b4:	83 ec 2c             	sub    $0x2c,%esp
+ 1b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1bf:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1c2:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1c5:	83 c3 01             	add    $0x1,%ebx
+ 1c8:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cb:	7d 27                	jge    1f4 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1cd:	83 ec 04             	sub    $0x4,%esp
+ 1d0:	6a 01                	push   $0x1
+ 1d2:	57                   	push   %edi
+ 1d3:	6a 00                	push   $0x0
+ 1d5:	e8 94 01 00 00       	call   36e <read>
+    if(cc < 1)
+ 1da:	83 c4 10             	add    $0x10,%esp
+ 1dd:	85 c0                	test   %eax,%eax
+ 1df:	7e 13                	jle    1f4 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1e1:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e5:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1e9:	3c 0a                	cmp    $0xa,%al
+ 1eb:	74 04                	je     1f1 <gets+0x43>
+ 1ed:	3c 0d                	cmp    $0xd,%al
+ 1ef:	75 d1                	jne    1c2 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1f1:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1f4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1f7:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1fb:	89 f0                	mov    %esi,%eax
+ 1fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 200:	5b                   	pop    %ebx
+ 201:	5e                   	pop    %esi
+ 202:	5f                   	pop    %edi
+ 203:	5d                   	pop    %ebp
+ 204:	c3                   	ret
+
+00000205 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 205:	55                   	push   %ebp
+ 206:	89 e5                	mov    %esp,%ebp
+ 208:	56                   	push   %esi
+ 209:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20a:	83 ec 08             	sub    $0x8,%esp
+ 20d:	6a 00                	push   $0x0
+ 20f:	ff 75 08             	push   0x8(%ebp)
+ 212:	e8 7f 01 00 00       	call   396 <open>
+  if(fd < 0)
+ 217:	83 c4 10             	add    $0x10,%esp
+ 21a:	85 c0                	test   %eax,%eax
+ 21c:	78 24                	js     242 <stat+0x3d>
+ 21e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 220:	83 ec 08             	sub    $0x8,%esp
+ 223:	ff 75 0c             	push   0xc(%ebp)
+ 226:	50                   	push   %eax
+ 227:	e8 82 01 00 00       	call   3ae <fstat>
+ 22c:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22e:	89 1c 24             	mov    %ebx,(%esp)
+ 231:	e8 48 01 00 00       	call   37e <close>
+  return r;
+ 236:	83 c4 10             	add    $0x10,%esp
+}
+ 239:	89 f0                	mov    %esi,%eax
+ 23b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 23e:	5b                   	pop    %ebx
+ 23f:	5e                   	pop    %esi
+ 240:	5d                   	pop    %ebp
+ 241:	c3                   	ret
+    return -1;
+ 242:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 247:	eb f0                	jmp    239 <stat+0x34>
+
+00000249 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 249:	55                   	push   %ebp
+ 24a:	89 e5                	mov    %esp,%ebp
+ 24c:	56                   	push   %esi
+ 24d:	53                   	push   %ebx
+ 24e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 251:	0f b6 0a             	movzbl (%edx),%ecx
+ 254:	80 f9 20             	cmp    $0x20,%cl
+ 257:	75 0b                	jne    264 <atoi+0x1b>
+ 259:	83 c2 01             	add    $0x1,%edx
+ 25c:	0f b6 0a             	movzbl (%edx),%ecx
+ 25f:	80 f9 20             	cmp    $0x20,%cl
+ 262:	74 f5                	je     259 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 264:	80 f9 2d             	cmp    $0x2d,%cl
+ 267:	74 3c                	je     2a5 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 269:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 26c:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 271:	f6 c1 fd             	test   $0xfd,%cl
+ 274:	74 34                	je     2aa <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 276:	0f b6 0a             	movzbl (%edx),%ecx
+ 279:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 27c:	3c 09                	cmp    $0x9,%al
+ 27e:	77 2f                	ja     2af <atoi+0x66>
+ 280:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 285:	83 c2 01             	add    $0x1,%edx
+ 288:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 28b:	0f be c9             	movsbl %cl,%ecx
+ 28e:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 292:	0f b6 0a             	movzbl (%edx),%ecx
+ 295:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 298:	3c 09                	cmp    $0x9,%al
+ 29a:	76 e9                	jbe    285 <atoi+0x3c>
+  return sign*n;
+ 29c:	89 f0                	mov    %esi,%eax
+ 29e:	0f af c3             	imul   %ebx,%eax
+}
+ 2a1:	5b                   	pop    %ebx
+ 2a2:	5e                   	pop    %esi
+ 2a3:	5d                   	pop    %ebp
+ 2a4:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 2a5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2aa:	83 c2 01             	add    $0x1,%edx
+ 2ad:	eb c7                	jmp    276 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 2af:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2b4:	eb e6                	jmp    29c <atoi+0x53>
+
+000002b6 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2b6:	55                   	push   %ebp
+ 2b7:	89 e5                	mov    %esp,%ebp
+ 2b9:	56                   	push   %esi
+ 2ba:	53                   	push   %ebx
+ 2bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2be:	0f b6 0a             	movzbl (%edx),%ecx
+ 2c1:	80 f9 20             	cmp    $0x20,%cl
+ 2c4:	75 0b                	jne    2d1 <atoo+0x1b>
+ 2c6:	83 c2 01             	add    $0x1,%edx
+ 2c9:	0f b6 0a             	movzbl (%edx),%ecx
+ 2cc:	80 f9 20             	cmp    $0x20,%cl
+ 2cf:	74 f5                	je     2c6 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2d1:	80 f9 2d             	cmp    $0x2d,%cl
+ 2d4:	74 3a                	je     310 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 2d6:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2d9:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2de:	f6 c1 fd             	test   $0xfd,%cl
+ 2e1:	74 32                	je     315 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2e3:	0f b6 0a             	movzbl (%edx),%ecx
+ 2e6:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2e9:	80 fb 07             	cmp    $0x7,%bl
+ 2ec:	77 2c                	ja     31a <atoo+0x64>
+ 2ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 2f3:	83 c2 01             	add    $0x1,%edx
+ 2f6:	0f be c9             	movsbl %cl,%ecx
+ 2f9:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 2fd:	0f b6 0a             	movzbl (%edx),%ecx
+ 300:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 303:	3c 07                	cmp    $0x7,%al
+ 305:	76 ec                	jbe    2f3 <atoo+0x3d>
+  return sign*n;
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	0f af c3             	imul   %ebx,%eax
+}
+ 30c:	5b                   	pop    %ebx
+ 30d:	5e                   	pop    %esi
+ 30e:	5d                   	pop    %ebp
+ 30f:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 315:	83 c2 01             	add    $0x1,%edx
+ 318:	eb c9                	jmp    2e3 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 31a:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 31f:	eb e6                	jmp    307 <atoo+0x51>
+
+00000321 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 321:	55                   	push   %ebp
+ 322:	89 e5                	mov    %esp,%ebp
+ 324:	56                   	push   %esi
+ 325:	53                   	push   %ebx
+ 326:	8b 75 08             	mov    0x8(%ebp),%esi
+ 329:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 32c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32f:	85 db                	test   %ebx,%ebx
+ 331:	7e 15                	jle    348 <memmove+0x27>
+ 333:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 335:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 337:	83 c2 01             	add    $0x1,%edx
+ 33a:	83 c0 01             	add    $0x1,%eax
+ 33d:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 341:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 344:	39 c3                	cmp    %eax,%ebx
+ 346:	75 ef                	jne    337 <memmove+0x16>
+  return vdst;
+}
+ 348:	89 f0                	mov    %esi,%eax
+ 34a:	5b                   	pop    %ebx
+ 34b:	5e                   	pop    %esi
+ 34c:	5d                   	pop    %ebp
+ 34d:	c3                   	ret
+
+0000034e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 34e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <exit>:
+SYSCALL(exit)
+ 356:	b8 02 00 00 00       	mov    $0x2,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <wait>:
+SYSCALL(wait)
+ 35e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <pipe>:
+SYSCALL(pipe)
+ 366:	b8 04 00 00 00       	mov    $0x4,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <read>:
+SYSCALL(read)
+ 36e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <write>:
+SYSCALL(write)
+ 376:	b8 10 00 00 00       	mov    $0x10,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <close>:
+SYSCALL(close)
+ 37e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <kill>:
+SYSCALL(kill)
+ 386:	b8 06 00 00 00       	mov    $0x6,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <exec>:
+SYSCALL(exec)
+ 38e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <open>:
+SYSCALL(open)
+ 396:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <mknod>:
+SYSCALL(mknod)
+ 39e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <unlink>:
+SYSCALL(unlink)
+ 3a6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <fstat>:
+SYSCALL(fstat)
+ 3ae:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <link>:
+SYSCALL(link)
+ 3b6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <mkdir>:
+SYSCALL(mkdir)
+ 3be:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <chdir>:
+SYSCALL(chdir)
+ 3c6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <dup>:
+SYSCALL(dup)
+ 3ce:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <getpid>:
+SYSCALL(getpid)
+ 3d6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <sbrk>:
+SYSCALL(sbrk)
+ 3de:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <sleep>:
+SYSCALL(sleep)
+ 3e6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <uptime>:
+SYSCALL(uptime)
+ 3ee:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <halt>:
+SYSCALL(halt)
+ 3f6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <date>:
+SYSCALL(date)
+ 3fe:	b8 17 00 00 00       	mov    $0x17,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <getuid>:
+SYSCALL(getuid)
+ 406:	b8 18 00 00 00       	mov    $0x18,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <getgid>:
+SYSCALL(getgid)
+ 40e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <getppid>:
+SYSCALL(getppid)
+ 416:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <setuid>:
+SYSCALL(setuid)
+ 41e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <setgid>:
+SYSCALL(setgid)
+ 426:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <getprocs>:
+SYSCALL(getprocs)
+ 42e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <setpriority>:
+SYSCALL(setpriority)
+ 436:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <getpriority>:
+SYSCALL(getpriority)
+ 43e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <waitpid>:
+SYSCALL(waitpid)
+ 446:	b8 20 00 00 00       	mov    $0x20,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <setaffinity>:
+SYSCALL(setaffinity)
+ 44e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <getaffinity>:
+SYSCALL(getaffinity)
+ 456:	b8 22 00 00 00       	mov    $0x22,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <setdeadline>:
+SYSCALL(setdeadline)
+ 45e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <schedctl>:
+SYSCALL(schedctl)
+ 466:	b8 24 00 00 00       	mov    $0x24,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <spawn>:
+SYSCALL(spawn)
+ 46e:	b8 25 00 00 00       	mov    $0x25,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <vmstats>:
+SYSCALL(vmstats)
+ 476:	b8 26 00 00 00       	mov    $0x26,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <hugesbrk>:
+SYSCALL(hugesbrk)
+ 47e:	b8 27 00 00 00       	mov    $0x27,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <setshares>:
+SYSCALL(setshares)
+ 486:	b8 28 00 00 00       	mov    $0x28,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <getshares>:
+SYSCALL(getshares)
+ 48e:	b8 29 00 00 00       	mov    $0x29,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 496:	55                   	push   %ebp
+ 497:	89 e5                	mov    %esp,%ebp
+ 499:	57                   	push   %edi
+ 49a:	56                   	push   %esi
+ 49b:	53                   	push   %ebx
+ 49c:	83 ec 3c             	sub    $0x3c,%esp
+ 49f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4a2:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4a4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4a8:	74 79                	je     523 <printint+0x8d>
+ 4aa:	85 d2                	test   %edx,%edx
+ 4ac:	79 75                	jns    523 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 4ae:	89 d1                	mov    %edx,%ecx
+ 4b0:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4b2:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4be:	89 df                	mov    %ebx,%edi
+ 4c0:	83 c3 01             	add    $0x1,%ebx
+ 4c3:	89 c8                	mov    %ecx,%eax
+ 4c5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4ca:	f7 f6                	div    %esi
+ 4cc:	0f b6 92 bc 08 00 00 	movzbl 0x8bc(%edx),%edx
+ 4d3:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4d7:	89 ca                	mov    %ecx,%edx
+ 4d9:	89 c1                	mov    %eax,%ecx
+ 4db:	39 f2                	cmp    %esi,%edx
+ 4dd:	73 df                	jae    4be <printint+0x28>
+  if(neg)
+ 4df:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 4e3:	74 08                	je     4ed <printint+0x57>
+    buf[i++] = '-';
+ 4e5:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4ea:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 4ed:	85 db                	test   %ebx,%ebx
+ 4ef:	7e 2a                	jle    51b <printint+0x85>
+ 4f1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 4f4:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 4f8:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 4fb:	0f b6 03             	movzbl (%ebx),%eax
+ 4fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 501:	83 ec 04             	sub    $0x4,%esp
+ 504:	6a 01                	push   $0x1
+ 506:	57                   	push   %edi
+ 507:	ff 75 c4             	push   -0x3c(%ebp)
+ 50a:	e8 67 fe ff ff       	call   376 <write>
+  while(--i >= 0)
+ 50f:	89 d8                	mov    %ebx,%eax
+ 511:	83 eb 01             	sub    $0x1,%ebx
+ 514:	83 c4 10             	add    $0x10,%esp
+ 517:	39 f0                	cmp    %esi,%eax
+ 519:	75 e0                	jne    4fb <printint+0x65>
+}
+ 51b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51e:	5b                   	pop    %ebx
+ 51f:	5e                   	pop    %esi
+ 520:	5f                   	pop    %edi
+ 521:	5d                   	pop    %ebp
+ 522:	c3                   	ret
+    x = xx;
+ 523:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 525:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 52c:	eb 8b                	jmp    4b9 <printint+0x23>
+
+0000052e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 52e:	55                   	push   %ebp
+ 52f:	89 e5                	mov    %esp,%ebp
+ 531:	57                   	push   %edi
+ 532:	56                   	push   %esi
+ 533:	53                   	push   %ebx
+ 534:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 537:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 53a:	0f b6 1e             	movzbl (%esi),%ebx
+ 53d:	84 db                	test   %bl,%bl
+ 53f:	0f 84 9e 01 00 00    	je     6e3 <printf+0x1b5>
+ 545:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 548:	8d 45 10             	lea    0x10(%ebp),%eax
+ 54b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 54e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 553:	eb 2d                	jmp    582 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 555:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 558:	83 ec 04             	sub    $0x4,%esp
+ 55b:	6a 01                	push   $0x1
+ 55d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 560:	50                   	push   %eax
+ 561:	ff 75 08             	push   0x8(%ebp)
+ 564:	e8 0d fe ff ff       	call   376 <write>
+        putc(fd, c);
+ 569:	83 c4 10             	add    $0x10,%esp
+ 56c:	eb 05                	jmp    573 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 56e:	83 ff 25             	cmp    $0x25,%edi
+ 571:	74 1f                	je     592 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 573:	83 c6 01             	add    $0x1,%esi
+ 576:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 57a:	84 db                	test   %bl,%bl
+ 57c:	0f 84 61 01 00 00    	je     6e3 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 582:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 585:	85 ff                	test   %edi,%edi
+ 587:	75 e5                	jne    56e <printf+0x40>
+      if(c == '%'){
+ 589:	83 f8 25             	cmp    $0x25,%eax
+ 58c:	75 c7                	jne    555 <printf+0x27>
+        state = '%';
+ 58e:	89 c7                	mov    %eax,%edi
+ 590:	eb e1                	jmp    573 <printf+0x45>
+      if(c == 'd'){
+ 592:	83 f8 25             	cmp    $0x25,%eax
+ 595:	0f 84 f4 00 00 00    	je     68f <printf+0x161>
+ 59b:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 59e:	83 fa 15             	cmp    $0x15,%edx
+ 5a1:	0f 87 09 01 00 00    	ja     6b0 <printf+0x182>
+ 5a7:	0f 87 03 01 00 00    	ja     6b0 <printf+0x182>
+ 5ad:	ff 24 95 64 08 00 00 	jmp    *0x864(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 5b4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5b7:	8b 17                	mov    (%edi),%edx
+ 5b9:	83 ec 0c             	sub    $0xc,%esp
+ 5bc:	6a 01                	push   $0x1
+ 5be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	e8 cb fe ff ff       	call   496 <printint>
+        ap++;
+ 5cb:	83 c7 04             	add    $0x4,%edi
+ 5ce:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5d1:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5d4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5d9:	eb 98                	jmp    573 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5db:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5de:	8b 17                	mov    (%edi),%edx
+ 5e0:	83 ec 0c             	sub    $0xc,%esp
+ 5e3:	6a 00                	push   $0x0
+ 5e5:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ed:	e8 a4 fe ff ff       	call   496 <printint>
+        ap++;
+ 5f2:	83 c7 04             	add    $0x4,%edi
+ 5f5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5fb:	bf 00 00 00 00       	mov    $0x0,%edi
+ 600:	e9 6e ff ff ff       	jmp    573 <printf+0x45>
+        s = (char*)*ap;
+ 605:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 608:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 60a:	83 c1 04             	add    $0x4,%ecx
+ 60d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 610:	85 c0                	test   %eax,%eax
+ 612:	74 13                	je     627 <printf+0xf9>
+        s = (char*)*ap;
+ 614:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 616:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 619:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 61e:	84 c0                	test   %al,%al
+ 620:	75 0f                	jne    631 <printf+0x103>
+ 622:	e9 4c ff ff ff       	jmp    573 <printf+0x45>
+          s = "(null)";
+ 627:	bb 5c 08 00 00       	mov    $0x85c,%ebx
+        while(*s != 0){
+ 62c:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 631:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 634:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 637:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 63a:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 63d:	83 ec 04             	sub    $0x4,%esp
+ 640:	6a 01                	push   $0x1
+ 642:	57                   	push   %edi
+ 643:	56                   	push   %esi
+ 644:	e8 2d fd ff ff       	call   376 <write>
+          s++;
+ 649:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 64c:	0f b6 03             	movzbl (%ebx),%eax
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	84 c0                	test   %al,%al
+ 654:	75 e4                	jne    63a <printf+0x10c>
+      state = 0;
+ 656:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 659:	bf 00 00 00 00       	mov    $0x0,%edi
+ 65e:	e9 10 ff ff ff       	jmp    573 <printf+0x45>
+        putc(fd, *ap);
+ 663:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 666:	8b 07                	mov    (%edi),%eax
+ 668:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	6a 01                	push   $0x1
+ 670:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 673:	50                   	push   %eax
+ 674:	ff 75 08             	push   0x8(%ebp)
+ 677:	e8 fa fc ff ff       	call   376 <write>
+        ap++;
+ 67c:	83 c7 04             	add    $0x4,%edi
+ 67f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 682:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 685:	bf 00 00 00 00       	mov    $0x0,%edi
+ 68a:	e9 e4 fe ff ff       	jmp    573 <printf+0x45>
+        putc(fd, c);
+ 68f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 692:	83 ec 04             	sub    $0x4,%esp
+ 695:	6a 01                	push   $0x1
+ 697:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69a:	50                   	push   %eax
+ 69b:	ff 75 08             	push   0x8(%ebp)
+ 69e:	e8 d3 fc ff ff       	call   376 <write>
+ 6a3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6a6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6ab:	e9 c3 fe ff ff       	jmp    573 <printf+0x45>
+        putc(fd, '%');
+ 6b0:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b4:	83 ec 04             	sub    $0x4,%esp
+ 6b7:	6a 01                	push   $0x1
+ 6b9:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6bc:	57                   	push   %edi
+ 6bd:	ff 75 08             	push   0x8(%ebp)
+ 6c0:	e8 b1 fc ff ff       	call   376 <write>
+        putc(fd, c);
+ 6c5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c8:	83 c4 0c             	add    $0xc,%esp
+ 6cb:	6a 01                	push   $0x1
+ 6cd:	57                   	push   %edi
+ 6ce:	ff 75 08             	push   0x8(%ebp)
+ 6d1:	e8 a0 fc ff ff       	call   376 <write>
+        putc(fd, c);
+ 6d6:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6d9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6de:	e9 90 fe ff ff       	jmp    573 <printf+0x45>
+    }
+  }
+}
+ 6e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e6:	5b                   	pop    %ebx
+ 6e7:	5e                   	pop    %esi
+ 6e8:	5f                   	pop    %edi
+ 6e9:	5d                   	pop    %ebp
+ 6ea:	c3                   	ret
+
+000006eb <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6eb:	55                   	push   %ebp
+ 6ec:	89 e5                	mov    %esp,%ebp
+ 6ee:	57                   	push   %edi
+ 6ef:	56                   	push   %esi
+ 6f0:	53                   	push   %ebx
+ 6f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6f4:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f7:	a1 a0 0d 00 00       	mov    0xda0,%eax
+ 6fc:	eb 0c                	jmp    70a <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fe:	8b 10                	mov    (%eax),%edx
+ 700:	39 d0                	cmp    %edx,%eax
+ 702:	72 04                	jb     708 <free+0x1d>
+ 704:	39 d1                	cmp    %edx,%ecx
+ 706:	72 10                	jb     718 <free+0x2d>
+{
+ 708:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 70a:	39 c8                	cmp    %ecx,%eax
+ 70c:	73 f0                	jae    6fe <free+0x13>
+ 70e:	8b 10                	mov    (%eax),%edx
+ 710:	39 d1                	cmp    %edx,%ecx
+ 712:	72 04                	jb     718 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 714:	39 d0                	cmp    %edx,%eax
+ 716:	72 f0                	jb     708 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 718:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 71b:	8b 10                	mov    (%eax),%edx
+ 71d:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 720:	39 fa                	cmp    %edi,%edx
+ 722:	74 19                	je     73d <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 724:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 727:	8b 50 04             	mov    0x4(%eax),%edx
+ 72a:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 72d:	39 f1                	cmp    %esi,%ecx
+ 72f:	74 18                	je     749 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 731:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 733:	a3 a0 0d 00 00       	mov    %eax,0xda0
+}
+ 738:	5b                   	pop    %ebx
+ 739:	5e                   	pop    %esi
+ 73a:	5f                   	pop    %edi
+ 73b:	5d                   	pop    %ebp
+ 73c:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 73d:	03 72 04             	add    0x4(%edx),%esi
+ 740:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 743:	8b 10                	mov    (%eax),%edx
+ 745:	8b 12                	mov    (%edx),%edx
+ 747:	eb db                	jmp    724 <free+0x39>
+    p->s.size += bp->s.size;
+ 749:	03 53 fc             	add    -0x4(%ebx),%edx
+ 74c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 74f:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 752:	eb dd                	jmp    731 <free+0x46>
+
+00000754 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 754:	55                   	push   %ebp
+ 755:	89 e5                	mov    %esp,%ebp
+ 757:	57                   	push   %edi
+ 758:	56                   	push   %esi
+ 759:	53                   	push   %ebx
+ 75a:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 75d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 760:	8d 58 07             	lea    0x7(%eax),%ebx
+ 763:	c1 eb 03             	shr    $0x3,%ebx
+ 766:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 769:	8b 15 a0 0d 00 00    	mov    0xda0,%edx
+ 76f:	85 d2                	test   %edx,%edx
+ 771:	74 1c                	je     78f <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 773:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 775:	8b 48 04             	mov    0x4(%eax),%ecx
+ 778:	39 d9                	cmp    %ebx,%ecx
+ 77a:	73 38                	jae    7b4 <malloc+0x60>
+  if(nu < 4096)
+ 77c:	be 00 10 00 00       	mov    $0x1000,%esi
+ 781:	39 f3                	cmp    %esi,%ebx
+ 783:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 786:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 78d:	eb 72                	jmp    801 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 78f:	c7 05 a0 0d 00 00 a4 	movl   $0xda4,0xda0
+ 796:	0d 00 00 
+ 799:	c7 05 a4 0d 00 00 a4 	movl   $0xda4,0xda4
+ 7a0:	0d 00 00 
+    base.s.size = 0;
+ 7a3:	c7 05 a8 0d 00 00 00 	movl   $0x0,0xda8
+ 7aa:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7ad:	b8 a4 0d 00 00       	mov    $0xda4,%eax
+    if(p->s.size >= nunits){
+ 7b2:	eb c8                	jmp    77c <malloc+0x28>
+      if(p->s.size == nunits)
+ 7b4:	39 cb                	cmp    %ecx,%ebx
+ 7b6:	74 1e                	je     7d6 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7b8:	29 d9                	sub    %ebx,%ecx
+ 7ba:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7bd:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7c0:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7c3:	89 15 a0 0d 00 00    	mov    %edx,0xda0
+      return (void*)(p + 1);
+ 7c9:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7cc:	89 d0                	mov    %edx,%eax
+ 7ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d1:	5b                   	pop    %ebx
+ 7d2:	5e                   	pop    %esi
+ 7d3:	5f                   	pop    %edi
+ 7d4:	5d                   	pop    %ebp
+ 7d5:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7d6:	8b 08                	mov    (%eax),%ecx
+ 7d8:	89 0a                	mov    %ecx,(%edx)
+ 7da:	eb e7                	jmp    7c3 <malloc+0x6f>
+  hp->s.size = nu;
+ 7dc:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7df:	83 ec 0c             	sub    $0xc,%esp
+ 7e2:	83 c0 08             	add    $0x8,%eax
+ 7e5:	50                   	push   %eax
+ 7e6:	e8 00 ff ff ff       	call   6eb <free>
+  return freep;
+ 7eb:	8b 15 a0 0d 00 00    	mov    0xda0,%edx
+      if((p = morecore(nunits)) == 0)
+ 7f1:	83 c4 10             	add    $0x10,%esp
+ 7f4:	85 d2                	test   %edx,%edx
+ 7f6:	74 d4                	je     7cc <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f8:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7fa:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7fd:	39 d9                	cmp    %ebx,%ecx
+ 7ff:	73 b3                	jae    7b4 <malloc+0x60>
+    if(p == freep)
+ 801:	89 c2                	mov    %eax,%edx
+ 803:	39 05 a0 0d 00 00    	cmp    %eax,0xda0
+ 809:	75 ed                	jne    7f8 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 80b:	83 ec 0c             	sub    $0xc,%esp
+ 80e:	57                   	push   %edi
+ 80f:	e8 ca fb ff ff       	call   3de <sbrk>
+  if(p == (char*)-1)
+ 814:	83 c4 10             	add    $0x10,%esp
+ 817:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 81a:	75 c0                	jne    7dc <malloc+0x88>
+        return 0;
+ 81c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 821:	eb a9                	jmp    7cc <malloc+0x78>
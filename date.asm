@@ -0,0 +1,1336 @@
+
+_date:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 34             	sub    $0x34,%esp
+  int day;
+  struct rtcdate r;
+
+  if (date(&r)) {
+  14:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  17:	50                   	push   %eax
+  18:	e8 3c 04 00 00       	call   459 <date>
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	85 c0                	test   %eax,%eax
+  22:	74 18                	je     3c <main+0x3c>
+    printf(2,"Error: date call failed. %s at line %d\n",
+  24:	6a 1c                	push   $0x1c
+  26:	68 80 08 00 00       	push   $0x880
+  2b:	68 f4 08 00 00       	push   $0x8f4
+  30:	6a 02                	push   $0x2
+  32:	e8 52 05 00 00       	call   589 <printf>
+        __FILE__, __LINE__);
+    exit();
+  37:	e8 75 03 00 00       	call   3b1 <exit>
+  }
+
+  day = dayofweek(r.year, r.month, r.day);
+  3c:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  42:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  45:	8d 71 fe             	lea    -0x2(%ecx),%esi
+  48:	83 f8 02             	cmp    $0x2,%eax
+  4b:	7f 05                	jg     52 <main+0x52>
+  4d:	89 ce                	mov    %ecx,%esi
+  4f:	8d 49 ff             	lea    -0x1(%ecx),%ecx
+
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  52:	83 ec 0c             	sub    $0xc,%esp
+  55:	53                   	push   %ebx
+  56:	ff 34 85 40 09 00 00 	push   0x940(,%eax,4)
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  5d:	6b c0 17             	imul   $0x17,%eax,%eax
+  60:	bf 09 00 00 00       	mov    $0x9,%edi
+  65:	99                   	cltd
+  66:	f7 ff                	idiv   %edi
+  68:	01 f3                	add    %esi,%ebx
+  6a:	8d 5c 18 04          	lea    0x4(%eax,%ebx,1),%ebx
+  6e:	be 04 00 00 00       	mov    $0x4,%esi
+  73:	89 c8                	mov    %ecx,%eax
+  75:	99                   	cltd
+  76:	f7 fe                	idiv   %esi
+  78:	01 c3                	add    %eax,%ebx
+  7a:	be 9c ff ff ff       	mov    $0xffffff9c,%esi
+  7f:	89 c8                	mov    %ecx,%eax
+  81:	99                   	cltd
+  82:	f7 fe                	idiv   %esi
+  84:	01 c3                	add    %eax,%ebx
+  86:	be 90 01 00 00       	mov    $0x190,%esi
+  8b:	89 c8                	mov    %ecx,%eax
+  8d:	99                   	cltd
+  8e:	f7 fe                	idiv   %esi
+  90:	01 d8                	add    %ebx,%eax
+  92:	b9 07 00 00 00       	mov    $0x7,%ecx
+  97:	99                   	cltd
+  98:	f7 f9                	idiv   %ecx
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  9a:	ff 34 95 20 09 00 00 	push   0x920(,%edx,4)
+  a1:	68 87 08 00 00       	push   $0x887
+  a6:	6a 01                	push   $0x1
+  a8:	e8 dc 04 00 00       	call   589 <printf>
+  printf(1, " ");
+  ad:	83 c4 18             	add    $0x18,%esp
+  b0:	68 90 08 00 00       	push   $0x890
+  b5:	6a 01                	push   $0x1
+  b7:	e8 cd 04 00 00       	call   589 <printf>
+  if (r.hour < 10) printf(1, "0");
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	83 7d d8 09          	cmpl   $0x9,-0x28(%ebp)
+  c3:	76 4d                	jbe    112 <main+0x112>
+  printf(1, "%d:", r.hour);
+  c5:	83 ec 04             	sub    $0x4,%esp
+  c8:	ff 75 d8             	push   -0x28(%ebp)
+  cb:	68 94 08 00 00       	push   $0x894
+  d0:	6a 01                	push   $0x1
+  d2:	e8 b2 04 00 00       	call   589 <printf>
+  if (r.minute < 10) printf(1, "0");
+  d7:	83 c4 10             	add    $0x10,%esp
+  da:	83 7d d4 09          	cmpl   $0x9,-0x2c(%ebp)
+  de:	76 46                	jbe    126 <main+0x126>
+  printf(1, "%d:", r.minute);
+  e0:	83 ec 04             	sub    $0x4,%esp
+  e3:	ff 75 d4             	push   -0x2c(%ebp)
+  e6:	68 94 08 00 00       	push   $0x894
+  eb:	6a 01                	push   $0x1
+  ed:	e8 97 04 00 00       	call   589 <printf>
+  if (r.second < 10) printf(1, "0");
+  f2:	83 c4 10             	add    $0x10,%esp
+  f5:	83 7d d0 09          	cmpl   $0x9,-0x30(%ebp)
+  f9:	76 3f                	jbe    13a <main+0x13a>
+  printf(1, "%d UTC %d\n", r.second, r.year);
+  fb:	ff 75 e4             	push   -0x1c(%ebp)
+  fe:	ff 75 d0             	push   -0x30(%ebp)
+ 101:	68 98 08 00 00       	push   $0x898
+ 106:	6a 01                	push   $0x1
+ 108:	e8 7c 04 00 00       	call   589 <printf>
+
+  exit();
+ 10d:	e8 9f 02 00 00       	call   3b1 <exit>
+  if (r.hour < 10) printf(1, "0");
+ 112:	83 ec 08             	sub    $0x8,%esp
+ 115:	68 92 08 00 00       	push   $0x892
+ 11a:	6a 01                	push   $0x1
+ 11c:	e8 68 04 00 00       	call   589 <printf>
+ 121:	83 c4 10             	add    $0x10,%esp
+ 124:	eb 9f                	jmp    c5 <main+0xc5>
+  if (r.minute < 10) printf(1, "0");
+ 126:	83 ec 08             	sub    $0x8,%esp
+ 129:	68 92 08 00 00       	push   $0x892
+ 12e:	6a 01                	push   $0x1
+ 130:	e8 54 04 00 00       	call   589 <printf>
+ 135:	83 c4 10             	add    $0x10,%esp
+ 138:	eb a6                	jmp    e0 <main+0xe0>
+  if (r.second < 10) printf(1, "0");
+ 13a:	83 ec 08             	sub    $0x8,%esp
+ 13d:	68 92 08 00 00       	push   $0x892
+ 142:	6a 01                	push   $0x1
+ 144:	e8 40 04 00 00       	call   589 <printf>
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	eb ad                	jmp    fb <main+0xfb>
+
+0000014e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 14e:	55                   	push   %ebp
+ 14f:	89 e5                	mov    %esp,%ebp
+ 151:	53                   	push   %ebx
+ 152:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 155:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 158:	b8 00 00 00 00       	mov    $0x0,%eax
+ 15d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 161:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 164:	83 c0 01             	add    $0x1,%eax
+ 167:	84 d2                	test   %dl,%dl
+ 169:	75 f2                	jne    15d <strcpy+0xf>
+    ;
+  return os;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 170:	c9                   	leave
+ 171:	c3                   	ret
+
+00000172 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 172:	55                   	push   %ebp
+ 173:	89 e5                	mov    %esp,%ebp
+ 175:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 178:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 17b:	0f b6 01             	movzbl (%ecx),%eax
+ 17e:	84 c0                	test   %al,%al
+ 180:	74 11                	je     193 <strcmp+0x21>
+ 182:	38 02                	cmp    %al,(%edx)
+ 184:	75 0d                	jne    193 <strcmp+0x21>
+    p++, q++;
+ 186:	83 c1 01             	add    $0x1,%ecx
+ 189:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 18c:	0f b6 01             	movzbl (%ecx),%eax
+ 18f:	84 c0                	test   %al,%al
+ 191:	75 ef                	jne    182 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 193:	0f b6 c0             	movzbl %al,%eax
+ 196:	0f b6 12             	movzbl (%edx),%edx
+ 199:	29 d0                	sub    %edx,%eax
+}
+ 19b:	5d                   	pop    %ebp
+ 19c:	c3                   	ret
+
+0000019d <strlen>:
+
+uint
+strlen(char *s)
+{
+ 19d:	55                   	push   %ebp
+ 19e:	89 e5                	mov    %esp,%ebp
+ 1a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a3:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a6:	74 14                	je     1bc <strlen+0x1f>
+ 1a8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1ad:	83 c0 01             	add    $0x1,%eax
+ 1b0:	89 c1                	mov    %eax,%ecx
+ 1b2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b6:	75 f5                	jne    1ad <strlen+0x10>
+    ;
+  return n;
+}
+ 1b8:	89 c8                	mov    %ecx,%eax
+ 1ba:	5d                   	pop    %ebp
+ 1bb:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 1bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1c1:	eb f5                	jmp    1b8 <strlen+0x1b>
+
+000001c3 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1c3:	55                   	push   %ebp
+ 1c4:	89 e5                	mov    %esp,%ebp
+ 1c6:	57                   	push   %edi
+ 1c7:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1ca:	89 d7                	mov    %edx,%edi
+ 1cc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d2:	fc                   	cld
+ 1d3:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1d5:	89 d0                	mov    %edx,%eax
+ 1d7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1da:	c9                   	leave
+ 1db:	c3                   	ret
+
+000001dc <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1dc:	55                   	push   %ebp
+ 1dd:	89 e5                	mov    %esp,%ebp
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1e6:	0f b6 10             	movzbl (%eax),%edx
+ 1e9:	84 d2                	test   %dl,%dl
+ 1eb:	74 15                	je     202 <strchr+0x26>
+    if(*s == c)
+ 1ed:	38 d1                	cmp    %dl,%cl
+ 1ef:	74 0f                	je     200 <strchr+0x24>
+  for(; *s; s++)
+ 1f1:	83 c0 01             	add    $0x1,%eax
+ 1f4:	0f b6 10             	movzbl (%eax),%edx
+ 1f7:	84 d2                	test   %dl,%dl
+ 1f9:	75 f2                	jne    1ed <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 200:	5d                   	pop    %ebp
+ 201:	c3                   	ret
+  return 0;
+ 202:	b8 00 00 00 00       	mov    $0x0,%eax
+ 207:	eb f7                	jmp    200 <strchr+0x24>
+
+00000209 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 209:	55                   	push   %ebp
+ 20a:	89 e5                	mov    %esp,%ebp
+ 20c:	57                   	push   %edi
+ 20d:	56                   	push   %esi
+ 20e:	53                   	push   %ebx
+ 20f:	83 ec 2c             	sub    $0x2c,%esp
+ 212:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 215:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 21a:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 21d:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 220:	83 c3 01             	add    $0x1,%ebx
+ 223:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 226:	7d 27                	jge    24f <gets+0x46>
+    cc = read(0, &c, 1);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	6a 01                	push   $0x1
+ 22d:	57                   	push   %edi
+ 22e:	6a 00                	push   $0x0
+ 230:	e8 94 01 00 00       	call   3c9 <read>
+    if(cc < 1)
+ 235:	83 c4 10             	add    $0x10,%esp
+ 238:	85 c0                	test   %eax,%eax
+ 23a:	7e 13                	jle    24f <gets+0x46>
+      break;
+    buf[i++] = c;
+ 23c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 240:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 244:	3c 0a                	cmp    $0xa,%al
+ 246:	74 04                	je     24c <gets+0x43>
+ 248:	3c 0d                	cmp    $0xd,%al
+ 24a:	75 d1                	jne    21d <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 24c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 24f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 252:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 256:	89 f0                	mov    %esi,%eax
+ 258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25b:	5b                   	pop    %ebx
+ 25c:	5e                   	pop    %esi
+ 25d:	5f                   	pop    %edi
+ 25e:	5d                   	pop    %ebp
+ 25f:	c3                   	ret
+
+00000260 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+ 264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	6a 00                	push   $0x0
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 7f 01 00 00       	call   3f1 <open>
+  if(fd < 0)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	78 24                	js     29d <stat+0x3d>
+ 279:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 27b:	83 ec 08             	sub    $0x8,%esp
+ 27e:	ff 75 0c             	push   0xc(%ebp)
+ 281:	50                   	push   %eax
+ 282:	e8 82 01 00 00       	call   409 <fstat>
+ 287:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 289:	89 1c 24             	mov    %ebx,(%esp)
+ 28c:	e8 48 01 00 00       	call   3d9 <close>
+  return r;
+ 291:	83 c4 10             	add    $0x10,%esp
+}
+ 294:	89 f0                	mov    %esi,%eax
+ 296:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 299:	5b                   	pop    %ebx
+ 29a:	5e                   	pop    %esi
+ 29b:	5d                   	pop    %ebp
+ 29c:	c3                   	ret
+    return -1;
+ 29d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a2:	eb f0                	jmp    294 <stat+0x34>
+
+000002a4 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2a4:	55                   	push   %ebp
+ 2a5:	89 e5                	mov    %esp,%ebp
+ 2a7:	56                   	push   %esi
+ 2a8:	53                   	push   %ebx
+ 2a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2ac:	0f b6 0a             	movzbl (%edx),%ecx
+ 2af:	80 f9 20             	cmp    $0x20,%cl
+ 2b2:	75 0b                	jne    2bf <atoi+0x1b>
+ 2b4:	83 c2 01             	add    $0x1,%edx
+ 2b7:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ba:	80 f9 20             	cmp    $0x20,%cl
+ 2bd:	74 f5                	je     2b4 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2bf:	80 f9 2d             	cmp    $0x2d,%cl
+ 2c2:	74 3c                	je     300 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 2c4:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2c7:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2cc:	f6 c1 fd             	test   $0xfd,%cl
+ 2cf:	74 34                	je     305 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 2d1:	0f b6 0a             	movzbl (%edx),%ecx
+ 2d4:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2d7:	3c 09                	cmp    $0x9,%al
+ 2d9:	77 2f                	ja     30a <atoi+0x66>
+ 2db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 2e6:	0f be c9             	movsbl %cl,%ecx
+ 2e9:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 2ed:	0f b6 0a             	movzbl (%edx),%ecx
+ 2f0:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2f3:	3c 09                	cmp    $0x9,%al
+ 2f5:	76 e9                	jbe    2e0 <atoi+0x3c>
+  return sign*n;
+ 2f7:	89 f0                	mov    %esi,%eax
+ 2f9:	0f af c3             	imul   %ebx,%eax
+}
+ 2fc:	5b                   	pop    %ebx
+ 2fd:	5e                   	pop    %esi
+ 2fe:	5d                   	pop    %ebp
+ 2ff:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 305:	83 c2 01             	add    $0x1,%edx
+ 308:	eb c7                	jmp    2d1 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 30a:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 30f:	eb e6                	jmp    2f7 <atoi+0x53>
+
+00000311 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 311:	55                   	push   %ebp
+ 312:	89 e5                	mov    %esp,%ebp
+ 314:	56                   	push   %esi
+ 315:	53                   	push   %ebx
+ 316:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 319:	0f b6 0a             	movzbl (%edx),%ecx
+ 31c:	80 f9 20             	cmp    $0x20,%cl
+ 31f:	75 0b                	jne    32c <atoo+0x1b>
+ 321:	83 c2 01             	add    $0x1,%edx
+ 324:	0f b6 0a             	movzbl (%edx),%ecx
+ 327:	80 f9 20             	cmp    $0x20,%cl
+ 32a:	74 f5                	je     321 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 32c:	80 f9 2d             	cmp    $0x2d,%cl
+ 32f:	74 3a                	je     36b <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 331:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 334:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 339:	f6 c1 fd             	test   $0xfd,%cl
+ 33c:	74 32                	je     370 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 33e:	0f b6 0a             	movzbl (%edx),%ecx
+ 341:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 344:	80 fb 07             	cmp    $0x7,%bl
+ 347:	77 2c                	ja     375 <atoo+0x64>
+ 349:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 34e:	83 c2 01             	add    $0x1,%edx
+ 351:	0f be c9             	movsbl %cl,%ecx
+ 354:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 358:	0f b6 0a             	movzbl (%edx),%ecx
+ 35b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 35e:	3c 07                	cmp    $0x7,%al
+ 360:	76 ec                	jbe    34e <atoo+0x3d>
+  return sign*n;
+ 362:	89 f0                	mov    %esi,%eax
+ 364:	0f af c3             	imul   %ebx,%eax
+}
+ 367:	5b                   	pop    %ebx
+ 368:	5e                   	pop    %esi
+ 369:	5d                   	pop    %ebp
+ 36a:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 36b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	eb c9                	jmp    33e <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 375:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 37a:	eb e6                	jmp    362 <atoo+0x51>
+
+0000037c <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 37c:	55                   	push   %ebp
+ 37d:	89 e5                	mov    %esp,%ebp
+ 37f:	56                   	push   %esi
+ 380:	53                   	push   %ebx
+ 381:	8b 75 08             	mov    0x8(%ebp),%esi
+ 384:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 387:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 38a:	85 db                	test   %ebx,%ebx
+ 38c:	7e 15                	jle    3a3 <memmove+0x27>
+ 38e:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 390:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 392:	83 c2 01             	add    $0x1,%edx
+ 395:	83 c0 01             	add    $0x1,%eax
+ 398:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 39c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 39f:	39 c3                	cmp    %eax,%ebx
+ 3a1:	75 ef                	jne    392 <memmove+0x16>
+  return vdst;
+}
+ 3a3:	89 f0                	mov    %esi,%eax
+ 3a5:	5b                   	pop    %ebx
+ 3a6:	5e                   	pop    %esi
+ 3a7:	5d                   	pop    %ebp
+ 3a8:	c3                   	ret
+
+000003a9 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <exit>:
+SYSCALL(exit)
+ 3b1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <wait>:
+SYSCALL(wait)
+ 3b9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <pipe>:
+SYSCALL(pipe)
+ 3c1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <read>:
+SYSCALL(read)
+ 3c9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <write>:
+SYSCALL(write)
+ 3d1:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <close>:
+SYSCALL(close)
+ 3d9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <kill>:
+SYSCALL(kill)
+ 3e1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <exec>:
+SYSCALL(exec)
+ 3e9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <open>:
+SYSCALL(open)
+ 3f1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <mknod>:
+SYSCALL(mknod)
+ 3f9:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <unlink>:
+SYSCALL(unlink)
+ 401:	b8 12 00 00 00       	mov    $0x12,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <fstat>:
+SYSCALL(fstat)
+ 409:	b8 08 00 00 00       	mov    $0x8,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <link>:
+SYSCALL(link)
+ 411:	b8 13 00 00 00       	mov    $0x13,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <mkdir>:
+SYSCALL(mkdir)
+ 419:	b8 14 00 00 00       	mov    $0x14,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <chdir>:
+SYSCALL(chdir)
+ 421:	b8 09 00 00 00       	mov    $0x9,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <dup>:
+SYSCALL(dup)
+ 429:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <getpid>:
+SYSCALL(getpid)
+ 431:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <sbrk>:
+SYSCALL(sbrk)
+ 439:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <sleep>:
+SYSCALL(sleep)
+ 441:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <uptime>:
+SYSCALL(uptime)
+ 449:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <halt>:
+SYSCALL(halt)
+ 451:	b8 16 00 00 00       	mov    $0x16,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <date>:
+SYSCALL(date)
+ 459:	b8 17 00 00 00       	mov    $0x17,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <getuid>:
+SYSCALL(getuid)
+ 461:	b8 18 00 00 00       	mov    $0x18,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <getgid>:
+SYSCALL(getgid)
+ 469:	b8 19 00 00 00       	mov    $0x19,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <getppid>:
+SYSCALL(getppid)
+ 471:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <setuid>:
+SYSCALL(setuid)
+ 479:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <setgid>:
+SYSCALL(setgid)
+ 481:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <getprocs>:
+SYSCALL(getprocs)
+ 489:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <setpriority>:
+SYSCALL(setpriority)
+ 491:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <getpriority>:
+SYSCALL(getpriority)
+ 499:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <waitpid>:
+SYSCALL(waitpid)
+ 4a1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <setaffinity>:
+SYSCALL(setaffinity)
+ 4a9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <getaffinity>:
+SYSCALL(getaffinity)
+ 4b1:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <setdeadline>:
+SYSCALL(setdeadline)
+ 4b9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <schedctl>:
+SYSCALL(schedctl)
+ 4c1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <spawn>:
+SYSCALL(spawn)
+ 4c9:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <vmstats>:
+SYSCALL(vmstats)
+ 4d1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 4d9:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <setshares>:
+SYSCALL(setshares)
+ 4e1:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <getshares>:
+SYSCALL(getshares)
+ 4e9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f1:	55                   	push   %ebp
+ 4f2:	89 e5                	mov    %esp,%ebp
+ 4f4:	57                   	push   %edi
+ 4f5:	56                   	push   %esi
+ 4f6:	53                   	push   %ebx
+ 4f7:	83 ec 3c             	sub    $0x3c,%esp
+ 4fa:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4fd:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4ff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 503:	74 79                	je     57e <printint+0x8d>
+ 505:	85 d2                	test   %edx,%edx
+ 507:	79 75                	jns    57e <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 509:	89 d1                	mov    %edx,%ecx
+ 50b:	f7 d9                	neg    %ecx
+    neg = 1;
+ 50d:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 514:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 519:	89 df                	mov    %ebx,%edi
+ 51b:	83 c3 01             	add    $0x1,%ebx
+ 51e:	89 c8                	mov    %ecx,%eax
+ 520:	ba 00 00 00 00       	mov    $0x0,%edx
+ 525:	f7 f6                	div    %esi
+ 527:	0f b6 92 d4 09 00 00 	movzbl 0x9d4(%edx),%edx
+ 52e:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 532:	89 ca                	mov    %ecx,%edx
+ 534:	89 c1                	mov    %eax,%ecx
+ 536:	39 f2                	cmp    %esi,%edx
+ 538:	73 df                	jae    519 <printint+0x28>
+  if(neg)
+ 53a:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 53e:	74 08                	je     548 <printint+0x57>
+    buf[i++] = '-';
+ 540:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 545:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 548:	85 db                	test   %ebx,%ebx
+ 54a:	7e 2a                	jle    576 <printint+0x85>
+ 54c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 54f:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 553:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 556:	0f b6 03             	movzbl (%ebx),%eax
+ 559:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 55c:	83 ec 04             	sub    $0x4,%esp
+ 55f:	6a 01                	push   $0x1
+ 561:	57                   	push   %edi
+ 562:	ff 75 c4             	push   -0x3c(%ebp)
+ 565:	e8 67 fe ff ff       	call   3d1 <write>
+  while(--i >= 0)
+ 56a:	89 d8                	mov    %ebx,%eax
+ 56c:	83 eb 01             	sub    $0x1,%ebx
+ 56f:	83 c4 10             	add    $0x10,%esp
+ 572:	39 f0                	cmp    %esi,%eax
+ 574:	75 e0                	jne    556 <printint+0x65>
+}
+ 576:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 579:	5b                   	pop    %ebx
+ 57a:	5e                   	pop    %esi
+ 57b:	5f                   	pop    %edi
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+    x = xx;
+ 57e:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 580:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 587:	eb 8b                	jmp    514 <printint+0x23>
+
+00000589 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 589:	55                   	push   %ebp
+ 58a:	89 e5                	mov    %esp,%ebp
+ 58c:	57                   	push   %edi
+ 58d:	56                   	push   %esi
+ 58e:	53                   	push   %ebx
+ 58f:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 592:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 595:	0f b6 1e             	movzbl (%esi),%ebx
+ 598:	84 db                	test   %bl,%bl
+ 59a:	0f 84 9e 01 00 00    	je     73e <printf+0x1b5>
+ 5a0:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 5a3:	8d 45 10             	lea    0x10(%ebp),%eax
+ 5a6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 5a9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ae:	eb 2d                	jmp    5dd <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5b0:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5b3:	83 ec 04             	sub    $0x4,%esp
+ 5b6:	6a 01                	push   $0x1
+ 5b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5bb:	50                   	push   %eax
+ 5bc:	ff 75 08             	push   0x8(%ebp)
+ 5bf:	e8 0d fe ff ff       	call   3d1 <write>
+        putc(fd, c);
+ 5c4:	83 c4 10             	add    $0x10,%esp
+ 5c7:	eb 05                	jmp    5ce <printf+0x45>
+      }
+    } else if(state == '%'){
+ 5c9:	83 ff 25             	cmp    $0x25,%edi
+ 5cc:	74 1f                	je     5ed <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 5ce:	83 c6 01             	add    $0x1,%esi
+ 5d1:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 5d5:	84 db                	test   %bl,%bl
+ 5d7:	0f 84 61 01 00 00    	je     73e <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 5dd:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5e0:	85 ff                	test   %edi,%edi
+ 5e2:	75 e5                	jne    5c9 <printf+0x40>
+      if(c == '%'){
+ 5e4:	83 f8 25             	cmp    $0x25,%eax
+ 5e7:	75 c7                	jne    5b0 <printf+0x27>
+        state = '%';
+ 5e9:	89 c7                	mov    %eax,%edi
+ 5eb:	eb e1                	jmp    5ce <printf+0x45>
+      if(c == 'd'){
+ 5ed:	83 f8 25             	cmp    $0x25,%eax
+ 5f0:	0f 84 f4 00 00 00    	je     6ea <printf+0x161>
+ 5f6:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 5f9:	83 fa 15             	cmp    $0x15,%edx
+ 5fc:	0f 87 09 01 00 00    	ja     70b <printf+0x182>
+ 602:	0f 87 03 01 00 00    	ja     70b <printf+0x182>
+ 608:	ff 24 95 7c 09 00 00 	jmp    *0x97c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 60f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 612:	8b 17                	mov    (%edi),%edx
+ 614:	83 ec 0c             	sub    $0xc,%esp
+ 617:	6a 01                	push   $0x1
+ 619:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 61e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 621:	e8 cb fe ff ff       	call   4f1 <printint>
+        ap++;
+ 626:	83 c7 04             	add    $0x4,%edi
+ 629:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 62c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 62f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 634:	eb 98                	jmp    5ce <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 636:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 639:	8b 17                	mov    (%edi),%edx
+ 63b:	83 ec 0c             	sub    $0xc,%esp
+ 63e:	6a 00                	push   $0x0
+ 640:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 645:	8b 45 08             	mov    0x8(%ebp),%eax
+ 648:	e8 a4 fe ff ff       	call   4f1 <printint>
+        ap++;
+ 64d:	83 c7 04             	add    $0x4,%edi
+ 650:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 653:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 656:	bf 00 00 00 00       	mov    $0x0,%edi
+ 65b:	e9 6e ff ff ff       	jmp    5ce <printf+0x45>
+        s = (char*)*ap;
+ 660:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 663:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 665:	83 c1 04             	add    $0x4,%ecx
+ 668:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 66b:	85 c0                	test   %eax,%eax
+ 66d:	74 13                	je     682 <printf+0xf9>
+        s = (char*)*ap;
+ 66f:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 671:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 674:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 679:	84 c0                	test   %al,%al
+ 67b:	75 0f                	jne    68c <printf+0x103>
+ 67d:	e9 4c ff ff ff       	jmp    5ce <printf+0x45>
+          s = "(null)";
+ 682:	bb 74 09 00 00       	mov    $0x974,%ebx
+        while(*s != 0){
+ 687:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 68c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 68f:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 692:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 695:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 698:	83 ec 04             	sub    $0x4,%esp
+ 69b:	6a 01                	push   $0x1
+ 69d:	57                   	push   %edi
+ 69e:	56                   	push   %esi
+ 69f:	e8 2d fd ff ff       	call   3d1 <write>
+          s++;
+ 6a4:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 6a7:	0f b6 03             	movzbl (%ebx),%eax
+ 6aa:	83 c4 10             	add    $0x10,%esp
+ 6ad:	84 c0                	test   %al,%al
+ 6af:	75 e4                	jne    695 <printf+0x10c>
+      state = 0;
+ 6b1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6b4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6b9:	e9 10 ff ff ff       	jmp    5ce <printf+0x45>
+        putc(fd, *ap);
+ 6be:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 6c1:	8b 07                	mov    (%edi),%eax
+ 6c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c6:	83 ec 04             	sub    $0x4,%esp
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6ce:	50                   	push   %eax
+ 6cf:	ff 75 08             	push   0x8(%ebp)
+ 6d2:	e8 fa fc ff ff       	call   3d1 <write>
+        ap++;
+ 6d7:	83 c7 04             	add    $0x4,%edi
+ 6da:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 6dd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e0:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6e5:	e9 e4 fe ff ff       	jmp    5ce <printf+0x45>
+        putc(fd, c);
+ 6ea:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6ed:	83 ec 04             	sub    $0x4,%esp
+ 6f0:	6a 01                	push   $0x1
+ 6f2:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6f5:	50                   	push   %eax
+ 6f6:	ff 75 08             	push   0x8(%ebp)
+ 6f9:	e8 d3 fc ff ff       	call   3d1 <write>
+ 6fe:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 701:	bf 00 00 00 00       	mov    $0x0,%edi
+ 706:	e9 c3 fe ff ff       	jmp    5ce <printf+0x45>
+        putc(fd, '%');
+ 70b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 70f:	83 ec 04             	sub    $0x4,%esp
+ 712:	6a 01                	push   $0x1
+ 714:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 717:	57                   	push   %edi
+ 718:	ff 75 08             	push   0x8(%ebp)
+ 71b:	e8 b1 fc ff ff       	call   3d1 <write>
+        putc(fd, c);
+ 720:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 723:	83 c4 0c             	add    $0xc,%esp
+ 726:	6a 01                	push   $0x1
+ 728:	57                   	push   %edi
+ 729:	ff 75 08             	push   0x8(%ebp)
+ 72c:	e8 a0 fc ff ff       	call   3d1 <write>
+        putc(fd, c);
+ 731:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 734:	bf 00 00 00 00       	mov    $0x0,%edi
+ 739:	e9 90 fe ff ff       	jmp    5ce <printf+0x45>
+    }
+  }
+}
+ 73e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 741:	5b                   	pop    %ebx
+ 742:	5e                   	pop    %esi
+ 743:	5f                   	pop    %edi
+ 744:	5d                   	pop    %ebp
+ 745:	c3                   	ret
+
+00000746 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 746:	55                   	push   %ebp
+ 747:	89 e5                	mov    %esp,%ebp
+ 749:	57                   	push   %edi
+ 74a:	56                   	push   %esi
+ 74b:	53                   	push   %ebx
+ 74c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 74f:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 752:	a1 78 0c 00 00       	mov    0xc78,%eax
+ 757:	eb 0c                	jmp    765 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 759:	8b 10                	mov    (%eax),%edx
+ 75b:	39 d0                	cmp    %edx,%eax
+ 75d:	72 04                	jb     763 <free+0x1d>
+ 75f:	39 d1                	cmp    %edx,%ecx
+ 761:	72 10                	jb     773 <free+0x2d>
+{
+ 763:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 765:	39 c8                	cmp    %ecx,%eax
+ 767:	73 f0                	jae    759 <free+0x13>
+ 769:	8b 10                	mov    (%eax),%edx
+ 76b:	39 d1                	cmp    %edx,%ecx
+ 76d:	72 04                	jb     773 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 76f:	39 d0                	cmp    %edx,%eax
+ 771:	72 f0                	jb     763 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 773:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 776:	8b 10                	mov    (%eax),%edx
+ 778:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 77b:	39 fa                	cmp    %edi,%edx
+ 77d:	74 19                	je     798 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 77f:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 782:	8b 50 04             	mov    0x4(%eax),%edx
+ 785:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 788:	39 f1                	cmp    %esi,%ecx
+ 78a:	74 18                	je     7a4 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 78c:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 78e:	a3 78 0c 00 00       	mov    %eax,0xc78
+}
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 798:	03 72 04             	add    0x4(%edx),%esi
+ 79b:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 79e:	8b 10                	mov    (%eax),%edx
+ 7a0:	8b 12                	mov    (%edx),%edx
+ 7a2:	eb db                	jmp    77f <free+0x39>
+    p->s.size += bp->s.size;
+ 7a4:	03 53 fc             	add    -0x4(%ebx),%edx
+ 7a7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7aa:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7ad:	eb dd                	jmp    78c <free+0x46>
+
+000007af <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7af:	55                   	push   %ebp
+ 7b0:	89 e5                	mov    %esp,%ebp
+ 7b2:	57                   	push   %edi
+ 7b3:	56                   	push   %esi
+ 7b4:	53                   	push   %ebx
+ 7b5:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bb:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7be:	c1 eb 03             	shr    $0x3,%ebx
+ 7c1:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7c4:	8b 15 78 0c 00 00    	mov    0xc78,%edx
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 1c                	je     7ea <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7ce:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7d0:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7d3:	39 d9                	cmp    %ebx,%ecx
+ 7d5:	73 38                	jae    80f <malloc+0x60>
+  if(nu < 4096)
+ 7d7:	be 00 10 00 00       	mov    $0x1000,%esi
+ 7dc:	39 f3                	cmp    %esi,%ebx
+ 7de:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 7e1:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 7e8:	eb 72                	jmp    85c <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 7ea:	c7 05 78 0c 00 00 7c 	movl   $0xc7c,0xc78
+ 7f1:	0c 00 00 
+ 7f4:	c7 05 7c 0c 00 00 7c 	movl   $0xc7c,0xc7c
+ 7fb:	0c 00 00 
+    base.s.size = 0;
+ 7fe:	c7 05 80 0c 00 00 00 	movl   $0x0,0xc80
+ 805:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 808:	b8 7c 0c 00 00       	mov    $0xc7c,%eax
+    if(p->s.size >= nunits){
+ 80d:	eb c8                	jmp    7d7 <malloc+0x28>
+      if(p->s.size == nunits)
+ 80f:	39 cb                	cmp    %ecx,%ebx
+ 811:	74 1e                	je     831 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 813:	29 d9                	sub    %ebx,%ecx
+ 815:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 818:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 81b:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 81e:	89 15 78 0c 00 00    	mov    %edx,0xc78
+      return (void*)(p + 1);
+ 824:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 827:	89 d0                	mov    %edx,%eax
+ 829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 831:	8b 08                	mov    (%eax),%ecx
+ 833:	89 0a                	mov    %ecx,(%edx)
+ 835:	eb e7                	jmp    81e <malloc+0x6f>
+  hp->s.size = nu;
+ 837:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 83a:	83 ec 0c             	sub    $0xc,%esp
+ 83d:	83 c0 08             	add    $0x8,%eax
+ 840:	50                   	push   %eax
+ 841:	e8 00 ff ff ff       	call   746 <free>
+  return freep;
+ 846:	8b 15 78 0c 00 00    	mov    0xc78,%edx
+      if((p = morecore(nunits)) == 0)
+ 84c:	83 c4 10             	add    $0x10,%esp
+ 84f:	85 d2                	test   %edx,%edx
+ 851:	74 d4                	je     827 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 853:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 855:	8b 48 04             	mov    0x4(%eax),%ecx
+ 858:	39 d9                	cmp    %ebx,%ecx
+ 85a:	73 b3                	jae    80f <malloc+0x60>
+    if(p == freep)
+ 85c:	89 c2                	mov    %eax,%edx
+ 85e:	39 05 78 0c 00 00    	cmp    %eax,0xc78
+ 864:	75 ed                	jne    853 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 866:	83 ec 0c             	sub    $0xc,%esp
+ 869:	57                   	push   %edi
+ 86a:	e8 ca fb ff ff       	call   439 <sbrk>
+  if(p == (char*)-1)
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 875:	75 c0                	jne    837 <malloc+0x88>
+        return 0;
+ 877:	ba 00 00 00 00       	mov    $0x0,%edx
+ 87c:	eb a9                	jmp    827 <malloc+0x78>
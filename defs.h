@@ -4,11 +4,18 @@ struct file;
 struct inode;
 struct pipe;
 struct proc;
+#ifdef CS333_P4
+struct schedparams;
+struct spawnfd;
+#endif // CS333_P4
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct trapframe;
+struct vmregion;
+struct vmstats;
 #ifdef CS333_P2
 struct uproc;
 #endif // CS333_P2
@@ -27,6 +34,10 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execload(char*, char**, pde_t**, uint*, struct vmregion*,
+                         struct trapframe*);
+char*           execname(char*);
+void            freeregions(struct vmregion*);
 
 // file.c
 struct file*    filealloc(void);
@@ -43,9 +54,11 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+struct inode*   idupregion(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
+void            iputregion(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
@@ -69,9 +82,16 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+int             kallocn(char**, int);
 void            kfree(char*);
+void            kfreen(char**, int);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kref(char*);
+int             krefs(char*);
+char*           kallocorder(int);
+void            kfreeorder(char*, int);
+void            kmemstats(struct vmstats*);
 
 // kbd.c
 void            kbdintr(void);
@@ -83,6 +103,11 @@ extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
+void            lapicipi(int, int);
+#ifdef PDX_TICKLESS
+void            lapicsettimer(uint, int);
+uint            lapicelapsed(uint*);
+#endif // PDX_TICKLESS
 void            microdelay(int);
 
 // log.c
@@ -99,6 +124,12 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pcache.c
+void            pcinit(void);
+char*           pcget(struct inode*, uint);
+void            pcinval(struct inode*);
+int             pcheld(uint, uint);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -111,6 +142,9 @@ int             cpuid(void);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+#ifdef CS333_P4
+int             growhuge(int);
+#endif // CS333_P4
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
@@ -123,9 +157,11 @@ void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+void            wakeupone(void*);
 void            yield(void);
 #ifdef CS333_P2
 int             getprocs(uint max, struct uproc*);
+void            setuid(uint);
 #endif  //CS333_P2
 #ifdef CS333_P3
 void            infodump(char input);
@@ -133,6 +169,21 @@ void            infodump(char input);
 #ifdef CS333_P4
 int             setpriority(int,int);
 int             getpriority(int);
+int             waitpid(int);
+int             setaffinity(int, uint);
+int             getaffinity(int);
+int             setdeadline(int, uint, uint);
+void            edftick(struct proc*);
+int             schedctl(int, struct schedparams*);
+void            metabegin(struct proc*);
+void            metaend(struct proc*);
+int             spawn(char*, char**, struct spawnfd*);
+#ifdef PDX_STRIDE
+int             setshares(uint, uint);
+int             getshares(uint);
+#endif // PDX_STRIDE
+int             sleepticks(int);
+void            timertick(void);
 #endif // CS333_P4
 
 // swtch.S
@@ -165,6 +216,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -189,6 +241,7 @@ void            kvmalloc(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
+int             allochuge(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
@@ -198,6 +251,11 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             cowcopy(pde_t*, uint);
+int             fillpage(struct proc*, uint);
+int             uvmtouch(struct proc*, uint, uint, int);
+int             pagefault(struct proc*, uint, uint);
+extern struct vmstats vmstat;
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
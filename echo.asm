@@ -0,0 +1,1241 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 3f                	jle    5d <main+0x5d>
+  1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  23:	eb 1a                	jmp    3f <main+0x3f>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  25:	68 94 07 00 00       	push   $0x794
+  2a:	ff 74 9f fc          	push   -0x4(%edi,%ebx,4)
+  2e:	68 96 07 00 00       	push   $0x796
+  33:	6a 01                	push   $0x1
+  35:	e8 63 04 00 00       	call   49d <printf>
+  3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  3d:	89 d8                	mov    %ebx,%eax
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  3f:	8d 58 01             	lea    0x1(%eax),%ebx
+  42:	39 f3                	cmp    %esi,%ebx
+  44:	75 df                	jne    25 <main+0x25>
+  46:	68 9b 07 00 00       	push   $0x79b
+  4b:	ff 34 87             	push   (%edi,%eax,4)
+  4e:	68 96 07 00 00       	push   $0x796
+  53:	6a 01                	push   $0x1
+  55:	e8 43 04 00 00       	call   49d <printf>
+  5a:	83 c4 10             	add    $0x10,%esp
+  exit();
+  5d:	e8 63 02 00 00       	call   2c5 <exit>
+
+00000062 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  62:	55                   	push   %ebp
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  71:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  75:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  78:	83 c0 01             	add    $0x1,%eax
+  7b:	84 d2                	test   %dl,%dl
+  7d:	75 f2                	jne    71 <strcpy+0xf>
+    ;
+  return os;
+}
+  7f:	89 c8                	mov    %ecx,%eax
+  81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  84:	c9                   	leave
+  85:	c3                   	ret
+
+00000086 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  86:	55                   	push   %ebp
+  87:	89 e5                	mov    %esp,%ebp
+  89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  8f:	0f b6 01             	movzbl (%ecx),%eax
+  92:	84 c0                	test   %al,%al
+  94:	74 11                	je     a7 <strcmp+0x21>
+  96:	38 02                	cmp    %al,(%edx)
+  98:	75 0d                	jne    a7 <strcmp+0x21>
+    p++, q++;
+  9a:	83 c1 01             	add    $0x1,%ecx
+  9d:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  a0:	0f b6 01             	movzbl (%ecx),%eax
+  a3:	84 c0                	test   %al,%al
+  a5:	75 ef                	jne    96 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  a7:	0f b6 c0             	movzbl %al,%eax
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	29 d0                	sub    %edx,%eax
+}
+  af:	5d                   	pop    %ebp
+  b0:	c3                   	ret
+
+000000b1 <strlen>:
+
+uint
+strlen(char *s)
+{
+  b1:	55                   	push   %ebp
+  b2:	89 e5                	mov    %esp,%ebp
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  b7:	80 3a 00             	cmpb   $0x0,(%edx)
+  ba:	74 14                	je     d0 <strlen+0x1f>
+  bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  c1:	83 c0 01             	add    $0x1,%eax
+  c4:	89 c1                	mov    %eax,%ecx
+  c6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  ca:	75 f5                	jne    c1 <strlen+0x10>
+    ;
+  return n;
+}
+  cc:	89 c8                	mov    %ecx,%eax
+  ce:	5d                   	pop    %ebp
+  cf:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  d5:	eb f5                	jmp    cc <strlen+0x1b>
+
+000000d7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d7:	55                   	push   %ebp
+  d8:	89 e5                	mov    %esp,%ebp
+  da:	57                   	push   %edi
+  db:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  de:	89 d7                	mov    %edx,%edi
+  e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e6:	fc                   	cld
+  e7:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e9:	89 d0                	mov    %edx,%eax
+  eb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  ee:	c9                   	leave
+  ef:	c3                   	ret
+
+000000f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  fa:	0f b6 10             	movzbl (%eax),%edx
+  fd:	84 d2                	test   %dl,%dl
+  ff:	74 15                	je     116 <strchr+0x26>
+    if(*s == c)
+ 101:	38 d1                	cmp    %dl,%cl
+ 103:	74 0f                	je     114 <strchr+0x24>
+  for(; *s; s++)
+ 105:	83 c0 01             	add    $0x1,%eax
+ 108:	0f b6 10             	movzbl (%eax),%edx
+ 10b:	84 d2                	test   %dl,%dl
+ 10d:	75 f2                	jne    101 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 10f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 114:	5d                   	pop    %ebp
+ 115:	c3                   	ret
+  return 0;
+ 116:	b8 00 00 00 00       	mov    $0x0,%eax
+ 11b:	eb f7                	jmp    114 <strchr+0x24>
+
+0000011d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 11d:	55                   	push   %ebp
+ 11e:	89 e5                	mov    %esp,%ebp
+ 120:	57                   	push   %edi
+ 121:	56                   	push   %esi
+ 122:	53                   	push   %ebx
+ 123:	83 ec 2c             	sub    $0x2c,%esp
+ 126:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 129:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 12e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 131:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 134:	83 c3 01             	add    $0x1,%ebx
+ 137:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 13a:	7d 27                	jge    163 <gets+0x46>
+    cc = read(0, &c, 1);
+ 13c:	83 ec 04             	sub    $0x4,%esp
+ 13f:	6a 01                	push   $0x1
+ 141:	57                   	push   %edi
+ 142:	6a 00                	push   $0x0
+ 144:	e8 94 01 00 00       	call   2dd <read>
+    if(cc < 1)
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	85 c0                	test   %eax,%eax
+ 14e:	7e 13                	jle    163 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 150:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 154:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 158:	3c 0a                	cmp    $0xa,%al
+ 15a:	74 04                	je     160 <gets+0x43>
+ 15c:	3c 0d                	cmp    $0xd,%al
+ 15e:	75 d1                	jne    131 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 160:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 163:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 166:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 16a:	89 f0                	mov    %esi,%eax
+ 16c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 16f:	5b                   	pop    %ebx
+ 170:	5e                   	pop    %esi
+ 171:	5f                   	pop    %edi
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+
+00000174 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	56                   	push   %esi
+ 178:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 179:	83 ec 08             	sub    $0x8,%esp
+ 17c:	6a 00                	push   $0x0
+ 17e:	ff 75 08             	push   0x8(%ebp)
+ 181:	e8 7f 01 00 00       	call   305 <open>
+  if(fd < 0)
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	85 c0                	test   %eax,%eax
+ 18b:	78 24                	js     1b1 <stat+0x3d>
+ 18d:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 18f:	83 ec 08             	sub    $0x8,%esp
+ 192:	ff 75 0c             	push   0xc(%ebp)
+ 195:	50                   	push   %eax
+ 196:	e8 82 01 00 00       	call   31d <fstat>
+ 19b:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 19d:	89 1c 24             	mov    %ebx,(%esp)
+ 1a0:	e8 48 01 00 00       	call   2ed <close>
+  return r;
+ 1a5:	83 c4 10             	add    $0x10,%esp
+}
+ 1a8:	89 f0                	mov    %esi,%eax
+ 1aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5d                   	pop    %ebp
+ 1b0:	c3                   	ret
+    return -1;
+ 1b1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1b6:	eb f0                	jmp    1a8 <stat+0x34>
+
+000001b8 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1b8:	55                   	push   %ebp
+ 1b9:	89 e5                	mov    %esp,%ebp
+ 1bb:	56                   	push   %esi
+ 1bc:	53                   	push   %ebx
+ 1bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1c0:	0f b6 0a             	movzbl (%edx),%ecx
+ 1c3:	80 f9 20             	cmp    $0x20,%cl
+ 1c6:	75 0b                	jne    1d3 <atoi+0x1b>
+ 1c8:	83 c2 01             	add    $0x1,%edx
+ 1cb:	0f b6 0a             	movzbl (%edx),%ecx
+ 1ce:	80 f9 20             	cmp    $0x20,%cl
+ 1d1:	74 f5                	je     1c8 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1d3:	80 f9 2d             	cmp    $0x2d,%cl
+ 1d6:	74 3c                	je     214 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 1d8:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1db:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1e0:	f6 c1 fd             	test   $0xfd,%cl
+ 1e3:	74 34                	je     219 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1e5:	0f b6 0a             	movzbl (%edx),%ecx
+ 1e8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1eb:	3c 09                	cmp    $0x9,%al
+ 1ed:	77 2f                	ja     21e <atoi+0x66>
+ 1ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 1f4:	83 c2 01             	add    $0x1,%edx
+ 1f7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1fa:	0f be c9             	movsbl %cl,%ecx
+ 1fd:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 201:	0f b6 0a             	movzbl (%edx),%ecx
+ 204:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 207:	3c 09                	cmp    $0x9,%al
+ 209:	76 e9                	jbe    1f4 <atoi+0x3c>
+  return sign*n;
+ 20b:	89 f0                	mov    %esi,%eax
+ 20d:	0f af c3             	imul   %ebx,%eax
+}
+ 210:	5b                   	pop    %ebx
+ 211:	5e                   	pop    %esi
+ 212:	5d                   	pop    %ebp
+ 213:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 214:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 219:	83 c2 01             	add    $0x1,%edx
+ 21c:	eb c7                	jmp    1e5 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 21e:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 223:	eb e6                	jmp    20b <atoi+0x53>
+
+00000225 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 225:	55                   	push   %ebp
+ 226:	89 e5                	mov    %esp,%ebp
+ 228:	56                   	push   %esi
+ 229:	53                   	push   %ebx
+ 22a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 22d:	0f b6 0a             	movzbl (%edx),%ecx
+ 230:	80 f9 20             	cmp    $0x20,%cl
+ 233:	75 0b                	jne    240 <atoo+0x1b>
+ 235:	83 c2 01             	add    $0x1,%edx
+ 238:	0f b6 0a             	movzbl (%edx),%ecx
+ 23b:	80 f9 20             	cmp    $0x20,%cl
+ 23e:	74 f5                	je     235 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 240:	80 f9 2d             	cmp    $0x2d,%cl
+ 243:	74 3a                	je     27f <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 245:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 248:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 24d:	f6 c1 fd             	test   $0xfd,%cl
+ 250:	74 32                	je     284 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 252:	0f b6 0a             	movzbl (%edx),%ecx
+ 255:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 258:	80 fb 07             	cmp    $0x7,%bl
+ 25b:	77 2c                	ja     289 <atoo+0x64>
+ 25d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 262:	83 c2 01             	add    $0x1,%edx
+ 265:	0f be c9             	movsbl %cl,%ecx
+ 268:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 26c:	0f b6 0a             	movzbl (%edx),%ecx
+ 26f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 272:	3c 07                	cmp    $0x7,%al
+ 274:	76 ec                	jbe    262 <atoo+0x3d>
+  return sign*n;
+ 276:	89 f0                	mov    %esi,%eax
+ 278:	0f af c3             	imul   %ebx,%eax
+}
+ 27b:	5b                   	pop    %ebx
+ 27c:	5e                   	pop    %esi
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 27f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 284:	83 c2 01             	add    $0x1,%edx
+ 287:	eb c9                	jmp    252 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 289:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 28e:	eb e6                	jmp    276 <atoo+0x51>
+
+00000290 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+ 295:	8b 75 08             	mov    0x8(%ebp),%esi
+ 298:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 29b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 db                	test   %ebx,%ebx
+ 2a0:	7e 15                	jle    2b7 <memmove+0x27>
+ 2a2:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2a4:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2a6:	83 c2 01             	add    $0x1,%edx
+ 2a9:	83 c0 01             	add    $0x1,%eax
+ 2ac:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2b0:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2b3:	39 c3                	cmp    %eax,%ebx
+ 2b5:	75 ef                	jne    2a6 <memmove+0x16>
+  return vdst;
+}
+ 2b7:	89 f0                	mov    %esi,%eax
+ 2b9:	5b                   	pop    %ebx
+ 2ba:	5e                   	pop    %esi
+ 2bb:	5d                   	pop    %ebp
+ 2bc:	c3                   	ret
+
+000002bd <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bd:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c2:	cd 40                	int    $0x40
+ 2c4:	c3                   	ret
+
+000002c5 <exit>:
+SYSCALL(exit)
+ 2c5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ca:	cd 40                	int    $0x40
+ 2cc:	c3                   	ret
+
+000002cd <wait>:
+SYSCALL(wait)
+ 2cd:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d2:	cd 40                	int    $0x40
+ 2d4:	c3                   	ret
+
+000002d5 <pipe>:
+SYSCALL(pipe)
+ 2d5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2da:	cd 40                	int    $0x40
+ 2dc:	c3                   	ret
+
+000002dd <read>:
+SYSCALL(read)
+ 2dd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e2:	cd 40                	int    $0x40
+ 2e4:	c3                   	ret
+
+000002e5 <write>:
+SYSCALL(write)
+ 2e5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2ea:	cd 40                	int    $0x40
+ 2ec:	c3                   	ret
+
+000002ed <close>:
+SYSCALL(close)
+ 2ed:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f2:	cd 40                	int    $0x40
+ 2f4:	c3                   	ret
+
+000002f5 <kill>:
+SYSCALL(kill)
+ 2f5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2fa:	cd 40                	int    $0x40
+ 2fc:	c3                   	ret
+
+000002fd <exec>:
+SYSCALL(exec)
+ 2fd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 302:	cd 40                	int    $0x40
+ 304:	c3                   	ret
+
+00000305 <open>:
+SYSCALL(open)
+ 305:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 30a:	cd 40                	int    $0x40
+ 30c:	c3                   	ret
+
+0000030d <mknod>:
+SYSCALL(mknod)
+ 30d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 312:	cd 40                	int    $0x40
+ 314:	c3                   	ret
+
+00000315 <unlink>:
+SYSCALL(unlink)
+ 315:	b8 12 00 00 00       	mov    $0x12,%eax
+ 31a:	cd 40                	int    $0x40
+ 31c:	c3                   	ret
+
+0000031d <fstat>:
+SYSCALL(fstat)
+ 31d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 322:	cd 40                	int    $0x40
+ 324:	c3                   	ret
+
+00000325 <link>:
+SYSCALL(link)
+ 325:	b8 13 00 00 00       	mov    $0x13,%eax
+ 32a:	cd 40                	int    $0x40
+ 32c:	c3                   	ret
+
+0000032d <mkdir>:
+SYSCALL(mkdir)
+ 32d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 332:	cd 40                	int    $0x40
+ 334:	c3                   	ret
+
+00000335 <chdir>:
+SYSCALL(chdir)
+ 335:	b8 09 00 00 00       	mov    $0x9,%eax
+ 33a:	cd 40                	int    $0x40
+ 33c:	c3                   	ret
+
+0000033d <dup>:
+SYSCALL(dup)
+ 33d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 342:	cd 40                	int    $0x40
+ 344:	c3                   	ret
+
+00000345 <getpid>:
+SYSCALL(getpid)
+ 345:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 34a:	cd 40                	int    $0x40
+ 34c:	c3                   	ret
+
+0000034d <sbrk>:
+SYSCALL(sbrk)
+ 34d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 352:	cd 40                	int    $0x40
+ 354:	c3                   	ret
+
+00000355 <sleep>:
+SYSCALL(sleep)
+ 355:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 35a:	cd 40                	int    $0x40
+ 35c:	c3                   	ret
+
+0000035d <uptime>:
+SYSCALL(uptime)
+ 35d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 362:	cd 40                	int    $0x40
+ 364:	c3                   	ret
+
+00000365 <halt>:
+SYSCALL(halt)
+ 365:	b8 16 00 00 00       	mov    $0x16,%eax
+ 36a:	cd 40                	int    $0x40
+ 36c:	c3                   	ret
+
+0000036d <date>:
+SYSCALL(date)
+ 36d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 372:	cd 40                	int    $0x40
+ 374:	c3                   	ret
+
+00000375 <getuid>:
+SYSCALL(getuid)
+ 375:	b8 18 00 00 00       	mov    $0x18,%eax
+ 37a:	cd 40                	int    $0x40
+ 37c:	c3                   	ret
+
+0000037d <getgid>:
+SYSCALL(getgid)
+ 37d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 382:	cd 40                	int    $0x40
+ 384:	c3                   	ret
+
+00000385 <getppid>:
+SYSCALL(getppid)
+ 385:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 38a:	cd 40                	int    $0x40
+ 38c:	c3                   	ret
+
+0000038d <setuid>:
+SYSCALL(setuid)
+ 38d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 392:	cd 40                	int    $0x40
+ 394:	c3                   	ret
+
+00000395 <setgid>:
+SYSCALL(setgid)
+ 395:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 39a:	cd 40                	int    $0x40
+ 39c:	c3                   	ret
+
+0000039d <getprocs>:
+SYSCALL(getprocs)
+ 39d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <setpriority>:
+SYSCALL(setpriority)
+ 3a5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <getpriority>:
+SYSCALL(getpriority)
+ 3ad:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <waitpid>:
+SYSCALL(waitpid)
+ 3b5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <setaffinity>:
+SYSCALL(setaffinity)
+ 3bd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <getaffinity>:
+SYSCALL(getaffinity)
+ 3c5:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <setdeadline>:
+SYSCALL(setdeadline)
+ 3cd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <schedctl>:
+SYSCALL(schedctl)
+ 3d5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <spawn>:
+SYSCALL(spawn)
+ 3dd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <vmstats>:
+SYSCALL(vmstats)
+ 3e5:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <hugesbrk>:
+SYSCALL(hugesbrk)
+ 3ed:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <setshares>:
+SYSCALL(setshares)
+ 3f5:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <getshares>:
+SYSCALL(getshares)
+ 3fd:	b8 29 00 00 00       	mov    $0x29,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 405:	55                   	push   %ebp
+ 406:	89 e5                	mov    %esp,%ebp
+ 408:	57                   	push   %edi
+ 409:	56                   	push   %esi
+ 40a:	53                   	push   %ebx
+ 40b:	83 ec 3c             	sub    $0x3c,%esp
+ 40e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 411:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 413:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 417:	74 79                	je     492 <printint+0x8d>
+ 419:	85 d2                	test   %edx,%edx
+ 41b:	79 75                	jns    492 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 41d:	89 d1                	mov    %edx,%ecx
+ 41f:	f7 d9                	neg    %ecx
+    neg = 1;
+ 421:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 42d:	89 df                	mov    %ebx,%edi
+ 42f:	83 c3 01             	add    $0x1,%ebx
+ 432:	89 c8                	mov    %ecx,%eax
+ 434:	ba 00 00 00 00       	mov    $0x0,%edx
+ 439:	f7 f6                	div    %esi
+ 43b:	0f b6 92 fc 07 00 00 	movzbl 0x7fc(%edx),%edx
+ 442:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 446:	89 ca                	mov    %ecx,%edx
+ 448:	89 c1                	mov    %eax,%ecx
+ 44a:	39 f2                	cmp    %esi,%edx
+ 44c:	73 df                	jae    42d <printint+0x28>
+  if(neg)
+ 44e:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 452:	74 08                	je     45c <printint+0x57>
+    buf[i++] = '-';
+ 454:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 459:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 45c:	85 db                	test   %ebx,%ebx
+ 45e:	7e 2a                	jle    48a <printint+0x85>
+ 460:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 463:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 467:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 46a:	0f b6 03             	movzbl (%ebx),%eax
+ 46d:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	57                   	push   %edi
+ 476:	ff 75 c4             	push   -0x3c(%ebp)
+ 479:	e8 67 fe ff ff       	call   2e5 <write>
+  while(--i >= 0)
+ 47e:	89 d8                	mov    %ebx,%eax
+ 480:	83 eb 01             	sub    $0x1,%ebx
+ 483:	83 c4 10             	add    $0x10,%esp
+ 486:	39 f0                	cmp    %esi,%eax
+ 488:	75 e0                	jne    46a <printint+0x65>
+}
+ 48a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48d:	5b                   	pop    %ebx
+ 48e:	5e                   	pop    %esi
+ 48f:	5f                   	pop    %edi
+ 490:	5d                   	pop    %ebp
+ 491:	c3                   	ret
+    x = xx;
+ 492:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 494:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 49b:	eb 8b                	jmp    428 <printint+0x23>
+
+0000049d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 49d:	55                   	push   %ebp
+ 49e:	89 e5                	mov    %esp,%ebp
+ 4a0:	57                   	push   %edi
+ 4a1:	56                   	push   %esi
+ 4a2:	53                   	push   %ebx
+ 4a3:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4a9:	0f b6 1e             	movzbl (%esi),%ebx
+ 4ac:	84 db                	test   %bl,%bl
+ 4ae:	0f 84 9e 01 00 00    	je     652 <printf+0x1b5>
+ 4b4:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4b7:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4bd:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4c2:	eb 2d                	jmp    4f1 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4c4:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4c7:	83 ec 04             	sub    $0x4,%esp
+ 4ca:	6a 01                	push   $0x1
+ 4cc:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4cf:	50                   	push   %eax
+ 4d0:	ff 75 08             	push   0x8(%ebp)
+ 4d3:	e8 0d fe ff ff       	call   2e5 <write>
+        putc(fd, c);
+ 4d8:	83 c4 10             	add    $0x10,%esp
+ 4db:	eb 05                	jmp    4e2 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4dd:	83 ff 25             	cmp    $0x25,%edi
+ 4e0:	74 1f                	je     501 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4e2:	83 c6 01             	add    $0x1,%esi
+ 4e5:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4e9:	84 db                	test   %bl,%bl
+ 4eb:	0f 84 61 01 00 00    	je     652 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4f1:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4f4:	85 ff                	test   %edi,%edi
+ 4f6:	75 e5                	jne    4dd <printf+0x40>
+      if(c == '%'){
+ 4f8:	83 f8 25             	cmp    $0x25,%eax
+ 4fb:	75 c7                	jne    4c4 <printf+0x27>
+        state = '%';
+ 4fd:	89 c7                	mov    %eax,%edi
+ 4ff:	eb e1                	jmp    4e2 <printf+0x45>
+      if(c == 'd'){
+ 501:	83 f8 25             	cmp    $0x25,%eax
+ 504:	0f 84 f4 00 00 00    	je     5fe <printf+0x161>
+ 50a:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 50d:	83 fa 15             	cmp    $0x15,%edx
+ 510:	0f 87 09 01 00 00    	ja     61f <printf+0x182>
+ 516:	0f 87 03 01 00 00    	ja     61f <printf+0x182>
+ 51c:	ff 24 95 a4 07 00 00 	jmp    *0x7a4(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 523:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 526:	8b 17                	mov    (%edi),%edx
+ 528:	83 ec 0c             	sub    $0xc,%esp
+ 52b:	6a 01                	push   $0x1
+ 52d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 532:	8b 45 08             	mov    0x8(%ebp),%eax
+ 535:	e8 cb fe ff ff       	call   405 <printint>
+        ap++;
+ 53a:	83 c7 04             	add    $0x4,%edi
+ 53d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 540:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 543:	bf 00 00 00 00       	mov    $0x0,%edi
+ 548:	eb 98                	jmp    4e2 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 54a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 54d:	8b 17                	mov    (%edi),%edx
+ 54f:	83 ec 0c             	sub    $0xc,%esp
+ 552:	6a 00                	push   $0x0
+ 554:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 559:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55c:	e8 a4 fe ff ff       	call   405 <printint>
+        ap++;
+ 561:	83 c7 04             	add    $0x4,%edi
+ 564:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 567:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 56f:	e9 6e ff ff ff       	jmp    4e2 <printf+0x45>
+        s = (char*)*ap;
+ 574:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 577:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 579:	83 c1 04             	add    $0x4,%ecx
+ 57c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 57f:	85 c0                	test   %eax,%eax
+ 581:	74 13                	je     596 <printf+0xf9>
+        s = (char*)*ap;
+ 583:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 585:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 588:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 58d:	84 c0                	test   %al,%al
+ 58f:	75 0f                	jne    5a0 <printf+0x103>
+ 591:	e9 4c ff ff ff       	jmp    4e2 <printf+0x45>
+          s = "(null)";
+ 596:	bb 9d 07 00 00       	mov    $0x79d,%ebx
+        while(*s != 0){
+ 59b:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 5a0:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5a3:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5a6:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5a9:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ac:	83 ec 04             	sub    $0x4,%esp
+ 5af:	6a 01                	push   $0x1
+ 5b1:	57                   	push   %edi
+ 5b2:	56                   	push   %esi
+ 5b3:	e8 2d fd ff ff       	call   2e5 <write>
+          s++;
+ 5b8:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5bb:	0f b6 03             	movzbl (%ebx),%eax
+ 5be:	83 c4 10             	add    $0x10,%esp
+ 5c1:	84 c0                	test   %al,%al
+ 5c3:	75 e4                	jne    5a9 <printf+0x10c>
+      state = 0;
+ 5c5:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5c8:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5cd:	e9 10 ff ff ff       	jmp    4e2 <printf+0x45>
+        putc(fd, *ap);
+ 5d2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5d5:	8b 07                	mov    (%edi),%eax
+ 5d7:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5da:	83 ec 04             	sub    $0x4,%esp
+ 5dd:	6a 01                	push   $0x1
+ 5df:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5e2:	50                   	push   %eax
+ 5e3:	ff 75 08             	push   0x8(%ebp)
+ 5e6:	e8 fa fc ff ff       	call   2e5 <write>
+        ap++;
+ 5eb:	83 c7 04             	add    $0x4,%edi
+ 5ee:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5f1:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5f9:	e9 e4 fe ff ff       	jmp    4e2 <printf+0x45>
+        putc(fd, c);
+ 5fe:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 601:	83 ec 04             	sub    $0x4,%esp
+ 604:	6a 01                	push   $0x1
+ 606:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 609:	50                   	push   %eax
+ 60a:	ff 75 08             	push   0x8(%ebp)
+ 60d:	e8 d3 fc ff ff       	call   2e5 <write>
+ 612:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 615:	bf 00 00 00 00       	mov    $0x0,%edi
+ 61a:	e9 c3 fe ff ff       	jmp    4e2 <printf+0x45>
+        putc(fd, '%');
+ 61f:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 623:	83 ec 04             	sub    $0x4,%esp
+ 626:	6a 01                	push   $0x1
+ 628:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 62b:	57                   	push   %edi
+ 62c:	ff 75 08             	push   0x8(%ebp)
+ 62f:	e8 b1 fc ff ff       	call   2e5 <write>
+        putc(fd, c);
+ 634:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 637:	83 c4 0c             	add    $0xc,%esp
+ 63a:	6a 01                	push   $0x1
+ 63c:	57                   	push   %edi
+ 63d:	ff 75 08             	push   0x8(%ebp)
+ 640:	e8 a0 fc ff ff       	call   2e5 <write>
+        putc(fd, c);
+ 645:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 648:	bf 00 00 00 00       	mov    $0x0,%edi
+ 64d:	e9 90 fe ff ff       	jmp    4e2 <printf+0x45>
+    }
+  }
+}
+ 652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 655:	5b                   	pop    %ebx
+ 656:	5e                   	pop    %esi
+ 657:	5f                   	pop    %edi
+ 658:	5d                   	pop    %ebp
+ 659:	c3                   	ret
+
+0000065a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 65a:	55                   	push   %ebp
+ 65b:	89 e5                	mov    %esp,%ebp
+ 65d:	57                   	push   %edi
+ 65e:	56                   	push   %esi
+ 65f:	53                   	push   %ebx
+ 660:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 663:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 666:	a1 a0 0a 00 00       	mov    0xaa0,%eax
+ 66b:	eb 0c                	jmp    679 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66d:	8b 10                	mov    (%eax),%edx
+ 66f:	39 d0                	cmp    %edx,%eax
+ 671:	72 04                	jb     677 <free+0x1d>
+ 673:	39 d1                	cmp    %edx,%ecx
+ 675:	72 10                	jb     687 <free+0x2d>
+{
+ 677:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 679:	39 c8                	cmp    %ecx,%eax
+ 67b:	73 f0                	jae    66d <free+0x13>
+ 67d:	8b 10                	mov    (%eax),%edx
+ 67f:	39 d1                	cmp    %edx,%ecx
+ 681:	72 04                	jb     687 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 683:	39 d0                	cmp    %edx,%eax
+ 685:	72 f0                	jb     677 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 687:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 68a:	8b 10                	mov    (%eax),%edx
+ 68c:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 68f:	39 fa                	cmp    %edi,%edx
+ 691:	74 19                	je     6ac <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 693:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 696:	8b 50 04             	mov    0x4(%eax),%edx
+ 699:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 69c:	39 f1                	cmp    %esi,%ecx
+ 69e:	74 18                	je     6b8 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6a0:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6a2:	a3 a0 0a 00 00       	mov    %eax,0xaa0
+}
+ 6a7:	5b                   	pop    %ebx
+ 6a8:	5e                   	pop    %esi
+ 6a9:	5f                   	pop    %edi
+ 6aa:	5d                   	pop    %ebp
+ 6ab:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6ac:	03 72 04             	add    0x4(%edx),%esi
+ 6af:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b2:	8b 10                	mov    (%eax),%edx
+ 6b4:	8b 12                	mov    (%edx),%edx
+ 6b6:	eb db                	jmp    693 <free+0x39>
+    p->s.size += bp->s.size;
+ 6b8:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6bb:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6be:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6c1:	eb dd                	jmp    6a0 <free+0x46>
+
+000006c3 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6c3:	55                   	push   %ebp
+ 6c4:	89 e5                	mov    %esp,%ebp
+ 6c6:	57                   	push   %edi
+ 6c7:	56                   	push   %esi
+ 6c8:	53                   	push   %ebx
+ 6c9:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cf:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6d2:	c1 eb 03             	shr    $0x3,%ebx
+ 6d5:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6d8:	8b 15 a0 0a 00 00    	mov    0xaa0,%edx
+ 6de:	85 d2                	test   %edx,%edx
+ 6e0:	74 1c                	je     6fe <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e2:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6e4:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6e7:	39 d9                	cmp    %ebx,%ecx
+ 6e9:	73 38                	jae    723 <malloc+0x60>
+  if(nu < 4096)
+ 6eb:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6f0:	39 f3                	cmp    %esi,%ebx
+ 6f2:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6f5:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6fc:	eb 72                	jmp    770 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6fe:	c7 05 a0 0a 00 00 a4 	movl   $0xaa4,0xaa0
+ 705:	0a 00 00 
+ 708:	c7 05 a4 0a 00 00 a4 	movl   $0xaa4,0xaa4
+ 70f:	0a 00 00 
+    base.s.size = 0;
+ 712:	c7 05 a8 0a 00 00 00 	movl   $0x0,0xaa8
+ 719:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 71c:	b8 a4 0a 00 00       	mov    $0xaa4,%eax
+    if(p->s.size >= nunits){
+ 721:	eb c8                	jmp    6eb <malloc+0x28>
+      if(p->s.size == nunits)
+ 723:	39 cb                	cmp    %ecx,%ebx
+ 725:	74 1e                	je     745 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 727:	29 d9                	sub    %ebx,%ecx
+ 729:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 72c:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 72f:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 732:	89 15 a0 0a 00 00    	mov    %edx,0xaa0
+      return (void*)(p + 1);
+ 738:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 73b:	89 d0                	mov    %edx,%eax
+ 73d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 740:	5b                   	pop    %ebx
+ 741:	5e                   	pop    %esi
+ 742:	5f                   	pop    %edi
+ 743:	5d                   	pop    %ebp
+ 744:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 745:	8b 08                	mov    (%eax),%ecx
+ 747:	89 0a                	mov    %ecx,(%edx)
+ 749:	eb e7                	jmp    732 <malloc+0x6f>
+  hp->s.size = nu;
+ 74b:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 74e:	83 ec 0c             	sub    $0xc,%esp
+ 751:	83 c0 08             	add    $0x8,%eax
+ 754:	50                   	push   %eax
+ 755:	e8 00 ff ff ff       	call   65a <free>
+  return freep;
+ 75a:	8b 15 a0 0a 00 00    	mov    0xaa0,%edx
+      if((p = morecore(nunits)) == 0)
+ 760:	83 c4 10             	add    $0x10,%esp
+ 763:	85 d2                	test   %edx,%edx
+ 765:	74 d4                	je     73b <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 767:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 769:	8b 48 04             	mov    0x4(%eax),%ecx
+ 76c:	39 d9                	cmp    %ebx,%ecx
+ 76e:	73 b3                	jae    723 <malloc+0x60>
+    if(p == freep)
+ 770:	89 c2                	mov    %eax,%edx
+ 772:	39 05 a0 0a 00 00    	cmp    %eax,0xaa0
+ 778:	75 ed                	jne    767 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 77a:	83 ec 0c             	sub    $0xc,%esp
+ 77d:	57                   	push   %edi
+ 77e:	e8 ca fb ff ff       	call   34d <sbrk>
+  if(p == (char*)-1)
+ 783:	83 c4 10             	add    $0x10,%esp
+ 786:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 789:	75 c0                	jne    74b <malloc+0x88>
+        return 0;
+ 78b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 790:	eb a9                	jmp    73b <malloc+0x78>
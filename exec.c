@@ -7,19 +7,24 @@
 #include "x86.h"
 #include "elf.h"
 
-
+// Build a user image for path with argv on its stack, without
+// touching the current process.  Fills in the new page directory,
+// its size, its program segments, and the entry point and stack
+// pointer in tf.  The segments are only recorded in region[]; their
+// pages are read from the file as they are first touched.
 int
-exec(char *path, char **argv)
+execload(char *path, char **argv, pde_t **pgdirp, uint *szp,
+         struct vmregion *region, struct trapframe *tf)
 {
-  char *s, *last;
   int i, off;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  pde_t *pgdir;
+  struct vmregion *r;
 
+  memset(region, 0, NREGION*sizeof(region[0]));
   begin_op();
 
   if((ip = namei(path)) == 0){
@@ -41,8 +46,9 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Map the program's segments, to be paged in on demand.
   sz = 0;
+  r = region;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -52,12 +58,19 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr < sz || ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(r == &region[NREGION])
       goto bad;
+    r->ip = idupregion(ip);
+    r->va = ph.vaddr;
+    r->filesz = ph.filesz;
+    r->memsz = ph.memsz;
+    r->off = ph.off;
+    r++;
+    sz = ph.vaddr + ph.memsz;
   }
   iunlockput(ip);
   end_op();
@@ -90,28 +103,79 @@ exec(char *path, char **argv)
   if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
-  // Save program name for debugging.
+  *pgdirp = pgdir;
+  *szp = sz;
+  tf->eip = elf.entry;  // main
+  tf->esp = sp;
+  return 0;
+
+bad:
+  if(pgdir)
+    freevm(pgdir);
+  if(ip){
+    iunlockput(ip);
+    end_op();
+  }
+  freeregions(region);
+  return -1;
+}
+
+// Drop the program segments in region[].  Starts its own file
+// system operation, for iput().
+void
+freeregions(struct vmregion *region)
+{
+  struct vmregion *r;
+
+  begin_op();
+  for(r = region; r < &region[NREGION]; r++){
+    if(r->ip)
+      iputregion(r->ip);
+    r->ip = 0;
+  }
+  end_op();
+}
+
+// Last component of path, the name a program runs under.
+char*
+execname(char *path)
+{
+  char *s, *last;
+
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  return last;
+}
+
+int
+exec(char *path, char **argv)
+{
+  uint sz;
+  pde_t *pgdir, *oldpgdir;
+  struct vmregion region[NREGION], oldregion[NREGION];
+  struct proc *curproc = myproc();
+
+  if(execload(path, argv, &pgdir, &sz, region, curproc->tf) < 0)
+    return -1;
+
+  // Save program name for debugging.
+#ifdef CS333_P4
+  metabegin(curproc);
+  safestrcpy(curproc->name, execname(path), sizeof(curproc->name));
+  metaend(curproc);
+#else
+  safestrcpy(curproc->name, execname(path), sizeof(curproc->name));
+#endif // CS333_P4
 
   // Commit to the user image.
   oldpgdir = curproc->pgdir;
+  memmove(oldregion, curproc->region, sizeof(oldregion));
   curproc->pgdir = pgdir;
   curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
+  memmove(curproc->region, region, sizeof(region));
   switchuvm(curproc);
   freevm(oldpgdir);
+  freeregions(oldregion);
   return 0;
-
-bad:
-  if(pgdir)
-    freevm(pgdir);
-  if(ip){
-    iunlockput(ip);
-    end_op();
-  }
-  return -1;
 }
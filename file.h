@@ -14,8 +14,10 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int nregion;        // Program regions mapping it; writei() refuses if > 0
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  int pcached;        // pcache may hold pages of this inode?
 
   short type;         // copy of disk inode
   short major;
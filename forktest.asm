@@ -0,0 +1,816 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 10             	sub    $0x10,%esp
+   7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+   a:	53                   	push   %ebx
+   b:	e8 26 01 00 00       	call   136 <strlen>
+  10:	83 c4 0c             	add    $0xc,%esp
+  13:	50                   	push   %eax
+  14:	53                   	push   %ebx
+  15:	ff 75 08             	push   0x8(%ebp)
+  18:	e8 4d 03 00 00       	call   36a <write>
+}
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  23:	c9                   	leave
+  24:	c3                   	ret
+
+00000025 <forktest>:
+
+void
+forktest(void)
+{
+  25:	55                   	push   %ebp
+  26:	89 e5                	mov    %esp,%ebp
+  28:	53                   	push   %ebx
+  29:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2c:	68 8c 04 00 00       	push   $0x48c
+  31:	6a 01                	push   $0x1
+  33:	e8 c8 ff ff ff       	call   0 <printf>
+  38:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<N; n++){
+  3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    pid = fork();
+  40:	e8 fd 02 00 00       	call   342 <fork>
+    if(pid < 0)
+  45:	85 c0                	test   %eax,%eax
+  47:	78 2b                	js     74 <forktest+0x4f>
+      break;
+    if(pid == 0)
+  49:	74 24                	je     6f <forktest+0x4a>
+  for(n=0; n<N; n++){
+  4b:	83 c3 01             	add    $0x1,%ebx
+  4e:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  54:	75 ea                	jne    40 <forktest+0x1b>
+      exit();
+  }
+
+  if(n == N){
+    printf(1, "fork claimed to work N times!\n", N);
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	68 e8 03 00 00       	push   $0x3e8
+  5e:	68 cc 04 00 00       	push   $0x4cc
+  63:	6a 01                	push   $0x1
+  65:	e8 96 ff ff ff       	call   0 <printf>
+    exit();
+  6a:	e8 db 02 00 00       	call   34a <exit>
+      exit();
+  6f:	e8 d6 02 00 00       	call   34a <exit>
+  if(n == N){
+  74:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7a:	74 da                	je     56 <forktest+0x31>
+  }
+
+  for(; n > 0; n--){
+  7c:	85 db                	test   %ebx,%ebx
+  7e:	7e 0e                	jle    8e <forktest+0x69>
+    if(wait() < 0){
+  80:	e8 cd 02 00 00       	call   352 <wait>
+  85:	85 c0                	test   %eax,%eax
+  87:	78 26                	js     af <forktest+0x8a>
+  for(; n > 0; n--){
+  89:	83 eb 01             	sub    $0x1,%ebx
+  8c:	75 f2                	jne    80 <forktest+0x5b>
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait() != -1){
+  8e:	e8 bf 02 00 00       	call   352 <wait>
+  93:	83 f8 ff             	cmp    $0xffffffff,%eax
+  96:	75 2b                	jne    c3 <forktest+0x9e>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+  98:	83 ec 08             	sub    $0x8,%esp
+  9b:	68 be 04 00 00       	push   $0x4be
+  a0:	6a 01                	push   $0x1
+  a2:	e8 59 ff ff ff       	call   0 <printf>
+}
+  a7:	83 c4 10             	add    $0x10,%esp
+  aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ad:	c9                   	leave
+  ae:	c3                   	ret
+      printf(1, "wait stopped early\n");
+  af:	83 ec 08             	sub    $0x8,%esp
+  b2:	68 97 04 00 00       	push   $0x497
+  b7:	6a 01                	push   $0x1
+  b9:	e8 42 ff ff ff       	call   0 <printf>
+      exit();
+  be:	e8 87 02 00 00       	call   34a <exit>
+    printf(1, "wait got too many\n");
+  c3:	83 ec 08             	sub    $0x8,%esp
+  c6:	68 ab 04 00 00       	push   $0x4ab
+  cb:	6a 01                	push   $0x1
+  cd:	e8 2e ff ff ff       	call   0 <printf>
+    exit();
+  d2:	e8 73 02 00 00       	call   34a <exit>
+
+000000d7 <main>:
+
+int
+main(void)
+{
+  d7:	55                   	push   %ebp
+  d8:	89 e5                	mov    %esp,%ebp
+  da:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  dd:	e8 43 ff ff ff       	call   25 <forktest>
+  exit();
+  e2:	e8 63 02 00 00       	call   34a <exit>
+
+000000e7 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  e7:	55                   	push   %ebp
+  e8:	89 e5                	mov    %esp,%ebp
+  ea:	53                   	push   %ebx
+  eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  f6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  fa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  fd:	83 c0 01             	add    $0x1,%eax
+ 100:	84 d2                	test   %dl,%dl
+ 102:	75 f2                	jne    f6 <strcpy+0xf>
+    ;
+  return os;
+}
+ 104:	89 c8                	mov    %ecx,%eax
+ 106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 109:	c9                   	leave
+ 10a:	c3                   	ret
+
+0000010b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 10b:	55                   	push   %ebp
+ 10c:	89 e5                	mov    %esp,%ebp
+ 10e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 111:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 114:	0f b6 01             	movzbl (%ecx),%eax
+ 117:	84 c0                	test   %al,%al
+ 119:	74 11                	je     12c <strcmp+0x21>
+ 11b:	38 02                	cmp    %al,(%edx)
+ 11d:	75 0d                	jne    12c <strcmp+0x21>
+    p++, q++;
+ 11f:	83 c1 01             	add    $0x1,%ecx
+ 122:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 125:	0f b6 01             	movzbl (%ecx),%eax
+ 128:	84 c0                	test   %al,%al
+ 12a:	75 ef                	jne    11b <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 12c:	0f b6 c0             	movzbl %al,%eax
+ 12f:	0f b6 12             	movzbl (%edx),%edx
+ 132:	29 d0                	sub    %edx,%eax
+}
+ 134:	5d                   	pop    %ebp
+ 135:	c3                   	ret
+
+00000136 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 136:	55                   	push   %ebp
+ 137:	89 e5                	mov    %esp,%ebp
+ 139:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 13c:	80 3a 00             	cmpb   $0x0,(%edx)
+ 13f:	74 14                	je     155 <strlen+0x1f>
+ 141:	b8 00 00 00 00       	mov    $0x0,%eax
+ 146:	83 c0 01             	add    $0x1,%eax
+ 149:	89 c1                	mov    %eax,%ecx
+ 14b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 14f:	75 f5                	jne    146 <strlen+0x10>
+    ;
+  return n;
+}
+ 151:	89 c8                	mov    %ecx,%eax
+ 153:	5d                   	pop    %ebp
+ 154:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 155:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 15a:	eb f5                	jmp    151 <strlen+0x1b>
+
+0000015c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 15c:	55                   	push   %ebp
+ 15d:	89 e5                	mov    %esp,%ebp
+ 15f:	57                   	push   %edi
+ 160:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 163:	89 d7                	mov    %edx,%edi
+ 165:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 168:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16b:	fc                   	cld
+ 16c:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 16e:	89 d0                	mov    %edx,%eax
+ 170:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+
+00000175 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 175:	55                   	push   %ebp
+ 176:	89 e5                	mov    %esp,%ebp
+ 178:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 17f:	0f b6 10             	movzbl (%eax),%edx
+ 182:	84 d2                	test   %dl,%dl
+ 184:	74 15                	je     19b <strchr+0x26>
+    if(*s == c)
+ 186:	38 d1                	cmp    %dl,%cl
+ 188:	74 0f                	je     199 <strchr+0x24>
+  for(; *s; s++)
+ 18a:	83 c0 01             	add    $0x1,%eax
+ 18d:	0f b6 10             	movzbl (%eax),%edx
+ 190:	84 d2                	test   %dl,%dl
+ 192:	75 f2                	jne    186 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 194:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 199:	5d                   	pop    %ebp
+ 19a:	c3                   	ret
+  return 0;
+ 19b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1a0:	eb f7                	jmp    199 <strchr+0x24>
+
+000001a2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a2:	55                   	push   %ebp
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	57                   	push   %edi
+ 1a6:	56                   	push   %esi
+ 1a7:	53                   	push   %ebx
+ 1a8:	83 ec 2c             	sub    $0x2c,%esp
+ 1ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1b3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1b6:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7d 27                	jge    1e8 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	6a 01                	push   $0x1
+ 1c6:	57                   	push   %edi
+ 1c7:	6a 00                	push   $0x0
+ 1c9:	e8 94 01 00 00       	call   362 <read>
+    if(cc < 1)
+ 1ce:	83 c4 10             	add    $0x10,%esp
+ 1d1:	85 c0                	test   %eax,%eax
+ 1d3:	7e 13                	jle    1e8 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1d5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d9:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1dd:	3c 0a                	cmp    $0xa,%al
+ 1df:	74 04                	je     1e5 <gets+0x43>
+ 1e1:	3c 0d                	cmp    $0xd,%al
+ 1e3:	75 d1                	jne    1b6 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1e5:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1e8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1eb:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1ef:	89 f0                	mov    %esi,%eax
+ 1f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f4:	5b                   	pop    %ebx
+ 1f5:	5e                   	pop    %esi
+ 1f6:	5f                   	pop    %edi
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+
+000001f9 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1f9:	55                   	push   %ebp
+ 1fa:	89 e5                	mov    %esp,%ebp
+ 1fc:	56                   	push   %esi
+ 1fd:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1fe:	83 ec 08             	sub    $0x8,%esp
+ 201:	6a 00                	push   $0x0
+ 203:	ff 75 08             	push   0x8(%ebp)
+ 206:	e8 7f 01 00 00       	call   38a <open>
+  if(fd < 0)
+ 20b:	83 c4 10             	add    $0x10,%esp
+ 20e:	85 c0                	test   %eax,%eax
+ 210:	78 24                	js     236 <stat+0x3d>
+ 212:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 214:	83 ec 08             	sub    $0x8,%esp
+ 217:	ff 75 0c             	push   0xc(%ebp)
+ 21a:	50                   	push   %eax
+ 21b:	e8 82 01 00 00       	call   3a2 <fstat>
+ 220:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 222:	89 1c 24             	mov    %ebx,(%esp)
+ 225:	e8 48 01 00 00       	call   372 <close>
+  return r;
+ 22a:	83 c4 10             	add    $0x10,%esp
+}
+ 22d:	89 f0                	mov    %esi,%eax
+ 22f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 232:	5b                   	pop    %ebx
+ 233:	5e                   	pop    %esi
+ 234:	5d                   	pop    %ebp
+ 235:	c3                   	ret
+    return -1;
+ 236:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 23b:	eb f0                	jmp    22d <stat+0x34>
+
+0000023d <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 23d:	55                   	push   %ebp
+ 23e:	89 e5                	mov    %esp,%ebp
+ 240:	56                   	push   %esi
+ 241:	53                   	push   %ebx
+ 242:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 245:	0f b6 0a             	movzbl (%edx),%ecx
+ 248:	80 f9 20             	cmp    $0x20,%cl
+ 24b:	75 0b                	jne    258 <atoi+0x1b>
+ 24d:	83 c2 01             	add    $0x1,%edx
+ 250:	0f b6 0a             	movzbl (%edx),%ecx
+ 253:	80 f9 20             	cmp    $0x20,%cl
+ 256:	74 f5                	je     24d <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 258:	80 f9 2d             	cmp    $0x2d,%cl
+ 25b:	74 3c                	je     299 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 25d:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 260:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 265:	f6 c1 fd             	test   $0xfd,%cl
+ 268:	74 34                	je     29e <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 26a:	0f b6 0a             	movzbl (%edx),%ecx
+ 26d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 270:	3c 09                	cmp    $0x9,%al
+ 272:	77 2f                	ja     2a3 <atoi+0x66>
+ 274:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 279:	83 c2 01             	add    $0x1,%edx
+ 27c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 27f:	0f be c9             	movsbl %cl,%ecx
+ 282:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 286:	0f b6 0a             	movzbl (%edx),%ecx
+ 289:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 28c:	3c 09                	cmp    $0x9,%al
+ 28e:	76 e9                	jbe    279 <atoi+0x3c>
+  return sign*n;
+ 290:	89 f0                	mov    %esi,%eax
+ 292:	0f af c3             	imul   %ebx,%eax
+}
+ 295:	5b                   	pop    %ebx
+ 296:	5e                   	pop    %esi
+ 297:	5d                   	pop    %ebp
+ 298:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 299:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 29e:	83 c2 01             	add    $0x1,%edx
+ 2a1:	eb c7                	jmp    26a <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 2a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2a8:	eb e6                	jmp    290 <atoi+0x53>
+
+000002aa <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2aa:	55                   	push   %ebp
+ 2ab:	89 e5                	mov    %esp,%ebp
+ 2ad:	56                   	push   %esi
+ 2ae:	53                   	push   %ebx
+ 2af:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2b2:	0f b6 0a             	movzbl (%edx),%ecx
+ 2b5:	80 f9 20             	cmp    $0x20,%cl
+ 2b8:	75 0b                	jne    2c5 <atoo+0x1b>
+ 2ba:	83 c2 01             	add    $0x1,%edx
+ 2bd:	0f b6 0a             	movzbl (%edx),%ecx
+ 2c0:	80 f9 20             	cmp    $0x20,%cl
+ 2c3:	74 f5                	je     2ba <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2c5:	80 f9 2d             	cmp    $0x2d,%cl
+ 2c8:	74 3a                	je     304 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 2ca:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2cd:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2d2:	f6 c1 fd             	test   $0xfd,%cl
+ 2d5:	74 32                	je     309 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2d7:	0f b6 0a             	movzbl (%edx),%ecx
+ 2da:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2dd:	80 fb 07             	cmp    $0x7,%bl
+ 2e0:	77 2c                	ja     30e <atoo+0x64>
+ 2e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 2e7:	83 c2 01             	add    $0x1,%edx
+ 2ea:	0f be c9             	movsbl %cl,%ecx
+ 2ed:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 2f1:	0f b6 0a             	movzbl (%edx),%ecx
+ 2f4:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2f7:	3c 07                	cmp    $0x7,%al
+ 2f9:	76 ec                	jbe    2e7 <atoo+0x3d>
+  return sign*n;
+ 2fb:	89 f0                	mov    %esi,%eax
+ 2fd:	0f af c3             	imul   %ebx,%eax
+}
+ 300:	5b                   	pop    %ebx
+ 301:	5e                   	pop    %esi
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 304:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 309:	83 c2 01             	add    $0x1,%edx
+ 30c:	eb c9                	jmp    2d7 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 30e:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 313:	eb e6                	jmp    2fb <atoo+0x51>
+
+00000315 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 315:	55                   	push   %ebp
+ 316:	89 e5                	mov    %esp,%ebp
+ 318:	56                   	push   %esi
+ 319:	53                   	push   %ebx
+ 31a:	8b 75 08             	mov    0x8(%ebp),%esi
+ 31d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 320:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 323:	85 db                	test   %ebx,%ebx
+ 325:	7e 15                	jle    33c <memmove+0x27>
+ 327:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 329:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 32b:	83 c2 01             	add    $0x1,%edx
+ 32e:	83 c0 01             	add    $0x1,%eax
+ 331:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 335:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 338:	39 c3                	cmp    %eax,%ebx
+ 33a:	75 ef                	jne    32b <memmove+0x16>
+  return vdst;
+}
+ 33c:	89 f0                	mov    %esi,%eax
+ 33e:	5b                   	pop    %ebx
+ 33f:	5e                   	pop    %esi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+
+00000342 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 342:	b8 01 00 00 00       	mov    $0x1,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <exit>:
+SYSCALL(exit)
+ 34a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <wait>:
+SYSCALL(wait)
+ 352:	b8 03 00 00 00       	mov    $0x3,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <pipe>:
+SYSCALL(pipe)
+ 35a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <read>:
+SYSCALL(read)
+ 362:	b8 05 00 00 00       	mov    $0x5,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <write>:
+SYSCALL(write)
+ 36a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <close>:
+SYSCALL(close)
+ 372:	b8 15 00 00 00       	mov    $0x15,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <kill>:
+SYSCALL(kill)
+ 37a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <exec>:
+SYSCALL(exec)
+ 382:	b8 07 00 00 00       	mov    $0x7,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <open>:
+SYSCALL(open)
+ 38a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <mknod>:
+SYSCALL(mknod)
+ 392:	b8 11 00 00 00       	mov    $0x11,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <unlink>:
+SYSCALL(unlink)
+ 39a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <fstat>:
+SYSCALL(fstat)
+ 3a2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <link>:
+SYSCALL(link)
+ 3aa:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <mkdir>:
+SYSCALL(mkdir)
+ 3b2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <chdir>:
+SYSCALL(chdir)
+ 3ba:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <dup>:
+SYSCALL(dup)
+ 3c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <getpid>:
+SYSCALL(getpid)
+ 3ca:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <sbrk>:
+SYSCALL(sbrk)
+ 3d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <sleep>:
+SYSCALL(sleep)
+ 3da:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <uptime>:
+SYSCALL(uptime)
+ 3e2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <halt>:
+SYSCALL(halt)
+ 3ea:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <date>:
+SYSCALL(date)
+ 3f2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <getuid>:
+SYSCALL(getuid)
+ 3fa:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <getgid>:
+SYSCALL(getgid)
+ 402:	b8 19 00 00 00       	mov    $0x19,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <getppid>:
+SYSCALL(getppid)
+ 40a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <setuid>:
+SYSCALL(setuid)
+ 412:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <setgid>:
+SYSCALL(setgid)
+ 41a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <getprocs>:
+SYSCALL(getprocs)
+ 422:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <setpriority>:
+SYSCALL(setpriority)
+ 42a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <getpriority>:
+SYSCALL(getpriority)
+ 432:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <waitpid>:
+SYSCALL(waitpid)
+ 43a:	b8 20 00 00 00       	mov    $0x20,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <setaffinity>:
+SYSCALL(setaffinity)
+ 442:	b8 21 00 00 00       	mov    $0x21,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <getaffinity>:
+SYSCALL(getaffinity)
+ 44a:	b8 22 00 00 00       	mov    $0x22,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <setdeadline>:
+SYSCALL(setdeadline)
+ 452:	b8 23 00 00 00       	mov    $0x23,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <schedctl>:
+SYSCALL(schedctl)
+ 45a:	b8 24 00 00 00       	mov    $0x24,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <spawn>:
+SYSCALL(spawn)
+ 462:	b8 25 00 00 00       	mov    $0x25,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <vmstats>:
+SYSCALL(vmstats)
+ 46a:	b8 26 00 00 00       	mov    $0x26,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 472:	b8 27 00 00 00       	mov    $0x27,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <setshares>:
+SYSCALL(setshares)
+ 47a:	b8 28 00 00 00       	mov    $0x28,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <getshares>:
+SYSCALL(getshares)
+ 482:	b8 29 00 00 00       	mov    $0x29,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
@@ -267,6 +267,7 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->pcached = pcheld(dev, inum);  // pages from its last time here
   release(&icache.lock);
 
   return ip;
@@ -360,6 +361,28 @@ iunlockput(struct inode *ip)
   iput(ip);
 }
 
+// idup() for a program region (see exec.c), whose pages are read
+// from ip as they are touched: ip can't be written until the last
+// such reference is dropped with iputregion().
+struct inode*
+idupregion(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->ref++;
+  ip->nregion++;
+  release(&icache.lock);
+  return ip;
+}
+
+void
+iputregion(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->nregion--;
+  release(&icache.lock);
+  iput(ip);
+}
+
 //PAGEBREAK!
 // Inode content
 //
@@ -412,6 +435,7 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  pcinval(ip);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -495,7 +519,11 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  // A running program's text and data come from here.
+  if(ip->nregion > 0)
+    return -1;
 
+  pcinval(ip);
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
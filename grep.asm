@@ -0,0 +1,1521 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <matchstar>:
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8b 75 08             	mov    0x8(%ebp),%esi
+   c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+   f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+  12:	83 ec 08             	sub    $0x8,%esp
+  15:	53                   	push   %ebx
+  16:	57                   	push   %edi
+  17:	e8 2c 00 00 00       	call   48 <matchhere>
+  1c:	83 c4 10             	add    $0x10,%esp
+  1f:	85 c0                	test   %eax,%eax
+  21:	75 18                	jne    3b <matchstar+0x3b>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+  23:	0f b6 13             	movzbl (%ebx),%edx
+  26:	84 d2                	test   %dl,%dl
+  28:	74 16                	je     40 <matchstar+0x40>
+  2a:	83 c3 01             	add    $0x1,%ebx
+  2d:	83 fe 2e             	cmp    $0x2e,%esi
+  30:	74 e0                	je     12 <matchstar+0x12>
+  32:	0f be d2             	movsbl %dl,%edx
+  35:	39 f2                	cmp    %esi,%edx
+  37:	74 d9                	je     12 <matchstar+0x12>
+  39:	eb 05                	jmp    40 <matchstar+0x40>
+      return 1;
+  3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+  40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  43:	5b                   	pop    %ebx
+  44:	5e                   	pop    %esi
+  45:	5f                   	pop    %edi
+  46:	5d                   	pop    %ebp
+  47:	c3                   	ret
+
+00000048 <matchhere>:
+{
+  48:	55                   	push   %ebp
+  49:	89 e5                	mov    %esp,%ebp
+  4b:	53                   	push   %ebx
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(re[0] == '\0')
+  52:	0f b6 0a             	movzbl (%edx),%ecx
+    return 1;
+  55:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(re[0] == '\0')
+  5a:	84 c9                	test   %cl,%cl
+  5c:	74 29                	je     87 <matchhere+0x3f>
+  if(re[1] == '*')
+  5e:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  62:	3c 2a                	cmp    $0x2a,%al
+  64:	74 26                	je     8c <matchhere+0x44>
+  if(re[0] == '$' && re[1] == '\0')
+  66:	84 c0                	test   %al,%al
+  68:	75 05                	jne    6f <matchhere+0x27>
+  6a:	80 f9 24             	cmp    $0x24,%cl
+  6d:	74 35                	je     a4 <matchhere+0x5c>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  72:	0f b6 18             	movzbl (%eax),%ebx
+  return 0;
+  75:	b8 00 00 00 00       	mov    $0x0,%eax
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  7a:	84 db                	test   %bl,%bl
+  7c:	74 09                	je     87 <matchhere+0x3f>
+  7e:	38 d9                	cmp    %bl,%cl
+  80:	74 30                	je     b2 <matchhere+0x6a>
+  82:	80 f9 2e             	cmp    $0x2e,%cl
+  85:	74 2b                	je     b2 <matchhere+0x6a>
+}
+  87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8a:	c9                   	leave
+  8b:	c3                   	ret
+    return matchstar(re[0], re+2, text);
+  8c:	83 ec 04             	sub    $0x4,%esp
+  8f:	ff 75 0c             	push   0xc(%ebp)
+  92:	83 c2 02             	add    $0x2,%edx
+  95:	52                   	push   %edx
+  96:	0f be c9             	movsbl %cl,%ecx
+  99:	51                   	push   %ecx
+  9a:	e8 61 ff ff ff       	call   0 <matchstar>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	eb e3                	jmp    87 <matchhere+0x3f>
+    return *text == '\0';
+  a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a7:	80 38 00             	cmpb   $0x0,(%eax)
+  aa:	0f 94 c0             	sete   %al
+  ad:	0f b6 c0             	movzbl %al,%eax
+  b0:	eb d5                	jmp    87 <matchhere+0x3f>
+    return matchhere(re+1, text+1);
+  b2:	83 ec 08             	sub    $0x8,%esp
+  b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b8:	83 c0 01             	add    $0x1,%eax
+  bb:	50                   	push   %eax
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	52                   	push   %edx
+  c0:	e8 83 ff ff ff       	call   48 <matchhere>
+  c5:	83 c4 10             	add    $0x10,%esp
+  c8:	eb bd                	jmp    87 <matchhere+0x3f>
+
+000000ca <match>:
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  cd:	56                   	push   %esi
+  ce:	53                   	push   %ebx
+  cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '^')
+  d5:	80 3e 5e             	cmpb   $0x5e,(%esi)
+  d8:	74 1c                	je     f6 <match+0x2c>
+    if(matchhere(re, text))
+  da:	83 ec 08             	sub    $0x8,%esp
+  dd:	53                   	push   %ebx
+  de:	56                   	push   %esi
+  df:	e8 64 ff ff ff       	call   48 <matchhere>
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	85 c0                	test   %eax,%eax
+  e9:	75 1d                	jne    108 <match+0x3e>
+  }while(*text++ != '\0');
+  eb:	83 c3 01             	add    $0x1,%ebx
+  ee:	80 7b ff 00          	cmpb   $0x0,-0x1(%ebx)
+  f2:	75 e6                	jne    da <match+0x10>
+  f4:	eb 17                	jmp    10d <match+0x43>
+    return matchhere(re+1, text);
+  f6:	83 ec 08             	sub    $0x8,%esp
+  f9:	53                   	push   %ebx
+  fa:	83 c6 01             	add    $0x1,%esi
+  fd:	56                   	push   %esi
+  fe:	e8 45 ff ff ff       	call   48 <matchhere>
+ 103:	83 c4 10             	add    $0x10,%esp
+ 106:	eb 05                	jmp    10d <match+0x43>
+      return 1;
+ 108:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 10d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 110:	5b                   	pop    %ebx
+ 111:	5e                   	pop    %esi
+ 112:	5d                   	pop    %ebp
+ 113:	c3                   	ret
+
+00000114 <grep>:
+{
+ 114:	55                   	push   %ebp
+ 115:	89 e5                	mov    %esp,%ebp
+ 117:	57                   	push   %edi
+ 118:	56                   	push   %esi
+ 119:	53                   	push   %ebx
+ 11a:	83 ec 1c             	sub    $0x1c,%esp
+ 11d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  m = 0;
+ 120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 125:	eb 53                	jmp    17a <grep+0x66>
+      p = q+1;
+ 127:	8d 73 01             	lea    0x1(%ebx),%esi
+    while((q = strchr(p, '\n')) != 0){
+ 12a:	83 ec 08             	sub    $0x8,%esp
+ 12d:	6a 0a                	push   $0xa
+ 12f:	56                   	push   %esi
+ 130:	e8 e1 01 00 00       	call   316 <strchr>
+ 135:	89 c3                	mov    %eax,%ebx
+ 137:	83 c4 10             	add    $0x10,%esp
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	74 2d                	je     16b <grep+0x57>
+      *q = 0;
+ 13e:	c6 03 00             	movb   $0x0,(%ebx)
+      if(match(pattern, p)){
+ 141:	83 ec 08             	sub    $0x8,%esp
+ 144:	56                   	push   %esi
+ 145:	57                   	push   %edi
+ 146:	e8 7f ff ff ff       	call   ca <match>
+ 14b:	83 c4 10             	add    $0x10,%esp
+ 14e:	85 c0                	test   %eax,%eax
+ 150:	74 d5                	je     127 <grep+0x13>
+        *q = '\n';
+ 152:	c6 03 0a             	movb   $0xa,(%ebx)
+        write(1, p, q+1 - p);
+ 155:	83 ec 04             	sub    $0x4,%esp
+ 158:	8d 43 01             	lea    0x1(%ebx),%eax
+ 15b:	29 f0                	sub    %esi,%eax
+ 15d:	50                   	push   %eax
+ 15e:	56                   	push   %esi
+ 15f:	6a 01                	push   $0x1
+ 161:	e8 a5 03 00 00       	call   50b <write>
+ 166:	83 c4 10             	add    $0x10,%esp
+ 169:	eb bc                	jmp    127 <grep+0x13>
+    if(p == buf)
+ 16b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 16e:	81 fe a0 0d 00 00    	cmp    $0xda0,%esi
+ 174:	74 3b                	je     1b1 <grep+0x9d>
+    if(m > 0){
+ 176:	85 db                	test   %ebx,%ebx
+ 178:	7f 3e                	jg     1b8 <grep+0xa4>
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 17a:	83 ec 04             	sub    $0x4,%esp
+ 17d:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 182:	29 d8                	sub    %ebx,%eax
+ 184:	50                   	push   %eax
+ 185:	8d 83 a0 0d 00 00    	lea    0xda0(%ebx),%eax
+ 18b:	50                   	push   %eax
+ 18c:	ff 75 0c             	push   0xc(%ebp)
+ 18f:	e8 6f 03 00 00       	call   503 <read>
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 c0                	test   %eax,%eax
+ 199:	7e 3a                	jle    1d5 <grep+0xc1>
+    m += n;
+ 19b:	01 c3                	add    %eax,%ebx
+    buf[m] = '\0';
+ 19d:	c6 83 a0 0d 00 00 00 	movb   $0x0,0xda0(%ebx)
+    p = buf;
+ 1a4:	be a0 0d 00 00       	mov    $0xda0,%esi
+ 1a9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+ 1ac:	e9 79 ff ff ff       	jmp    12a <grep+0x16>
+      m = 0;
+ 1b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1b6:	eb c2                	jmp    17a <grep+0x66>
+      m -= p - buf;
+ 1b8:	89 f0                	mov    %esi,%eax
+ 1ba:	2d a0 0d 00 00       	sub    $0xda0,%eax
+ 1bf:	29 c3                	sub    %eax,%ebx
+      memmove(buf, p, m);
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	53                   	push   %ebx
+ 1c5:	56                   	push   %esi
+ 1c6:	68 a0 0d 00 00       	push   $0xda0
+ 1cb:	e8 e6 02 00 00       	call   4b6 <memmove>
+ 1d0:	83 c4 10             	add    $0x10,%esp
+ 1d3:	eb a5                	jmp    17a <grep+0x66>
+}
+ 1d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1d8:	5b                   	pop    %ebx
+ 1d9:	5e                   	pop    %esi
+ 1da:	5f                   	pop    %edi
+ 1db:	5d                   	pop    %ebp
+ 1dc:	c3                   	ret
+
+000001dd <main>:
+{
+ 1dd:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1e1:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1e4:	ff 71 fc             	push   -0x4(%ecx)
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	57                   	push   %edi
+ 1eb:	56                   	push   %esi
+ 1ec:	53                   	push   %ebx
+ 1ed:	51                   	push   %ecx
+ 1ee:	83 ec 18             	sub    $0x18,%esp
+ 1f1:	8b 01                	mov    (%ecx),%eax
+ 1f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 1f6:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc <= 1){
+ 1f9:	83 f8 01             	cmp    $0x1,%eax
+ 1fc:	7e 50                	jle    24e <main+0x71>
+  pattern = argv[1];
+ 1fe:	8b 46 04             	mov    0x4(%esi),%eax
+ 201:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+ 204:	83 c6 08             	add    $0x8,%esi
+  for(i = 2; i < argc; i++){
+ 207:	bf 02 00 00 00       	mov    $0x2,%edi
+  if(argc <= 2){
+ 20c:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+ 210:	7e 50                	jle    262 <main+0x85>
+    if((fd = open(argv[i], 0)) < 0){
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	6a 00                	push   $0x0
+ 217:	ff 36                	push   (%esi)
+ 219:	e8 0d 03 00 00       	call   52b <open>
+ 21e:	89 c3                	mov    %eax,%ebx
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	85 c0                	test   %eax,%eax
+ 225:	78 4b                	js     272 <main+0x95>
+    grep(pattern, fd);
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	50                   	push   %eax
+ 22b:	ff 75 e0             	push   -0x20(%ebp)
+ 22e:	e8 e1 fe ff ff       	call   114 <grep>
+    close(fd);
+ 233:	89 1c 24             	mov    %ebx,(%esp)
+ 236:	e8 d8 02 00 00       	call   513 <close>
+  for(i = 2; i < argc; i++){
+ 23b:	83 c7 01             	add    $0x1,%edi
+ 23e:	83 c6 04             	add    $0x4,%esi
+ 241:	83 c4 10             	add    $0x10,%esp
+ 244:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 247:	75 c9                	jne    212 <main+0x35>
+  exit();
+ 249:	e8 9d 02 00 00       	call   4eb <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 24e:	83 ec 08             	sub    $0x8,%esp
+ 251:	68 b8 09 00 00       	push   $0x9b8
+ 256:	6a 02                	push   $0x2
+ 258:	e8 66 04 00 00       	call   6c3 <printf>
+    exit();
+ 25d:	e8 89 02 00 00       	call   4eb <exit>
+    grep(pattern, 0);
+ 262:	83 ec 08             	sub    $0x8,%esp
+ 265:	6a 00                	push   $0x0
+ 267:	50                   	push   %eax
+ 268:	e8 a7 fe ff ff       	call   114 <grep>
+    exit();
+ 26d:	e8 79 02 00 00       	call   4eb <exit>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 272:	83 ec 04             	sub    $0x4,%esp
+ 275:	ff 36                	push   (%esi)
+ 277:	68 d8 09 00 00       	push   $0x9d8
+ 27c:	6a 01                	push   $0x1
+ 27e:	e8 40 04 00 00       	call   6c3 <printf>
+      exit();
+ 283:	e8 63 02 00 00       	call   4eb <exit>
+
+00000288 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 288:	55                   	push   %ebp
+ 289:	89 e5                	mov    %esp,%ebp
+ 28b:	53                   	push   %ebx
+ 28c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 28f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 292:	b8 00 00 00 00       	mov    $0x0,%eax
+ 297:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 29b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 29e:	83 c0 01             	add    $0x1,%eax
+ 2a1:	84 d2                	test   %dl,%dl
+ 2a3:	75 f2                	jne    297 <strcpy+0xf>
+    ;
+  return os;
+}
+ 2a5:	89 c8                	mov    %ecx,%eax
+ 2a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+
+000002ac <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2ac:	55                   	push   %ebp
+ 2ad:	89 e5                	mov    %esp,%ebp
+ 2af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 2b5:	0f b6 01             	movzbl (%ecx),%eax
+ 2b8:	84 c0                	test   %al,%al
+ 2ba:	74 11                	je     2cd <strcmp+0x21>
+ 2bc:	38 02                	cmp    %al,(%edx)
+ 2be:	75 0d                	jne    2cd <strcmp+0x21>
+    p++, q++;
+ 2c0:	83 c1 01             	add    $0x1,%ecx
+ 2c3:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 2c6:	0f b6 01             	movzbl (%ecx),%eax
+ 2c9:	84 c0                	test   %al,%al
+ 2cb:	75 ef                	jne    2bc <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 c0             	movzbl %al,%eax
+ 2d0:	0f b6 12             	movzbl (%edx),%edx
+ 2d3:	29 d0                	sub    %edx,%eax
+}
+ 2d5:	5d                   	pop    %ebp
+ 2d6:	c3                   	ret
+
+000002d7 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2d7:	55                   	push   %ebp
+ 2d8:	89 e5                	mov    %esp,%ebp
+ 2da:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2dd:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e0:	74 14                	je     2f6 <strlen+0x1f>
+ 2e2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	89 c1                	mov    %eax,%ecx
+ 2ec:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f0:	75 f5                	jne    2e7 <strlen+0x10>
+    ;
+  return n;
+}
+ 2f2:	89 c8                	mov    %ecx,%eax
+ 2f4:	5d                   	pop    %ebp
+ 2f5:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 2f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2fb:	eb f5                	jmp    2f2 <strlen+0x1b>
+
+000002fd <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	57                   	push   %edi
+ 301:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 309:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30c:	fc                   	cld
+ 30d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 30f:	89 d0                	mov    %edx,%eax
+ 311:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+
+00000316 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 316:	55                   	push   %ebp
+ 317:	89 e5                	mov    %esp,%ebp
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 320:	0f b6 10             	movzbl (%eax),%edx
+ 323:	84 d2                	test   %dl,%dl
+ 325:	74 15                	je     33c <strchr+0x26>
+    if(*s == c)
+ 327:	38 d1                	cmp    %dl,%cl
+ 329:	74 0f                	je     33a <strchr+0x24>
+  for(; *s; s++)
+ 32b:	83 c0 01             	add    $0x1,%eax
+ 32e:	0f b6 10             	movzbl (%eax),%edx
+ 331:	84 d2                	test   %dl,%dl
+ 333:	75 f2                	jne    327 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 33a:	5d                   	pop    %ebp
+ 33b:	c3                   	ret
+  return 0;
+ 33c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 341:	eb f7                	jmp    33a <strchr+0x24>
+
+00000343 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 343:	55                   	push   %ebp
+ 344:	89 e5                	mov    %esp,%ebp
+ 346:	57                   	push   %edi
+ 347:	56                   	push   %esi
+ 348:	53                   	push   %ebx
+ 349:	83 ec 2c             	sub    $0x2c,%esp
+ 34c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 34f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 354:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 357:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 35a:	83 c3 01             	add    $0x1,%ebx
+ 35d:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 360:	7d 27                	jge    389 <gets+0x46>
+    cc = read(0, &c, 1);
+ 362:	83 ec 04             	sub    $0x4,%esp
+ 365:	6a 01                	push   $0x1
+ 367:	57                   	push   %edi
+ 368:	6a 00                	push   $0x0
+ 36a:	e8 94 01 00 00       	call   503 <read>
+    if(cc < 1)
+ 36f:	83 c4 10             	add    $0x10,%esp
+ 372:	85 c0                	test   %eax,%eax
+ 374:	7e 13                	jle    389 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 376:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 37a:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37e:	3c 0a                	cmp    $0xa,%al
+ 380:	74 04                	je     386 <gets+0x43>
+ 382:	3c 0d                	cmp    $0xd,%al
+ 384:	75 d1                	jne    357 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 386:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 389:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 38c:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 390:	89 f0                	mov    %esi,%eax
+ 392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 395:	5b                   	pop    %ebx
+ 396:	5e                   	pop    %esi
+ 397:	5f                   	pop    %edi
+ 398:	5d                   	pop    %ebp
+ 399:	c3                   	ret
+
+0000039a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+ 39d:	56                   	push   %esi
+ 39e:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 39f:	83 ec 08             	sub    $0x8,%esp
+ 3a2:	6a 00                	push   $0x0
+ 3a4:	ff 75 08             	push   0x8(%ebp)
+ 3a7:	e8 7f 01 00 00       	call   52b <open>
+  if(fd < 0)
+ 3ac:	83 c4 10             	add    $0x10,%esp
+ 3af:	85 c0                	test   %eax,%eax
+ 3b1:	78 24                	js     3d7 <stat+0x3d>
+ 3b3:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	ff 75 0c             	push   0xc(%ebp)
+ 3bb:	50                   	push   %eax
+ 3bc:	e8 82 01 00 00       	call   543 <fstat>
+ 3c1:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3c3:	89 1c 24             	mov    %ebx,(%esp)
+ 3c6:	e8 48 01 00 00       	call   513 <close>
+  return r;
+ 3cb:	83 c4 10             	add    $0x10,%esp
+}
+ 3ce:	89 f0                	mov    %esi,%eax
+ 3d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d3:	5b                   	pop    %ebx
+ 3d4:	5e                   	pop    %esi
+ 3d5:	5d                   	pop    %ebp
+ 3d6:	c3                   	ret
+    return -1;
+ 3d7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3dc:	eb f0                	jmp    3ce <stat+0x34>
+
+000003de <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 3de:	55                   	push   %ebp
+ 3df:	89 e5                	mov    %esp,%ebp
+ 3e1:	56                   	push   %esi
+ 3e2:	53                   	push   %ebx
+ 3e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3e6:	0f b6 0a             	movzbl (%edx),%ecx
+ 3e9:	80 f9 20             	cmp    $0x20,%cl
+ 3ec:	75 0b                	jne    3f9 <atoi+0x1b>
+ 3ee:	83 c2 01             	add    $0x1,%edx
+ 3f1:	0f b6 0a             	movzbl (%edx),%ecx
+ 3f4:	80 f9 20             	cmp    $0x20,%cl
+ 3f7:	74 f5                	je     3ee <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3f9:	80 f9 2d             	cmp    $0x2d,%cl
+ 3fc:	74 3c                	je     43a <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 3fe:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 401:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 406:	f6 c1 fd             	test   $0xfd,%cl
+ 409:	74 34                	je     43f <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 40b:	0f b6 0a             	movzbl (%edx),%ecx
+ 40e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 411:	3c 09                	cmp    $0x9,%al
+ 413:	77 2f                	ja     444 <atoi+0x66>
+ 415:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 41a:	83 c2 01             	add    $0x1,%edx
+ 41d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 420:	0f be c9             	movsbl %cl,%ecx
+ 423:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 427:	0f b6 0a             	movzbl (%edx),%ecx
+ 42a:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 42d:	3c 09                	cmp    $0x9,%al
+ 42f:	76 e9                	jbe    41a <atoi+0x3c>
+  return sign*n;
+ 431:	89 f0                	mov    %esi,%eax
+ 433:	0f af c3             	imul   %ebx,%eax
+}
+ 436:	5b                   	pop    %ebx
+ 437:	5e                   	pop    %esi
+ 438:	5d                   	pop    %ebp
+ 439:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 43a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 43f:	83 c2 01             	add    $0x1,%edx
+ 442:	eb c7                	jmp    40b <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 444:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 449:	eb e6                	jmp    431 <atoi+0x53>
+
+0000044b <atoo>:
+
+int
+atoo(const char *s)
+{
+ 44b:	55                   	push   %ebp
+ 44c:	89 e5                	mov    %esp,%ebp
+ 44e:	56                   	push   %esi
+ 44f:	53                   	push   %ebx
+ 450:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 453:	0f b6 0a             	movzbl (%edx),%ecx
+ 456:	80 f9 20             	cmp    $0x20,%cl
+ 459:	75 0b                	jne    466 <atoo+0x1b>
+ 45b:	83 c2 01             	add    $0x1,%edx
+ 45e:	0f b6 0a             	movzbl (%edx),%ecx
+ 461:	80 f9 20             	cmp    $0x20,%cl
+ 464:	74 f5                	je     45b <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 466:	80 f9 2d             	cmp    $0x2d,%cl
+ 469:	74 3a                	je     4a5 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 46b:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 46e:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 473:	f6 c1 fd             	test   $0xfd,%cl
+ 476:	74 32                	je     4aa <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 478:	0f b6 0a             	movzbl (%edx),%ecx
+ 47b:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 47e:	80 fb 07             	cmp    $0x7,%bl
+ 481:	77 2c                	ja     4af <atoo+0x64>
+ 483:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 488:	83 c2 01             	add    $0x1,%edx
+ 48b:	0f be c9             	movsbl %cl,%ecx
+ 48e:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 492:	0f b6 0a             	movzbl (%edx),%ecx
+ 495:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 498:	3c 07                	cmp    $0x7,%al
+ 49a:	76 ec                	jbe    488 <atoo+0x3d>
+  return sign*n;
+ 49c:	89 f0                	mov    %esi,%eax
+ 49e:	0f af c3             	imul   %ebx,%eax
+}
+ 4a1:	5b                   	pop    %ebx
+ 4a2:	5e                   	pop    %esi
+ 4a3:	5d                   	pop    %ebp
+ 4a4:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 4a5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 4aa:	83 c2 01             	add    $0x1,%edx
+ 4ad:	eb c9                	jmp    478 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 4af:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4b4:	eb e6                	jmp    49c <atoo+0x51>
+
+000004b6 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b6:	55                   	push   %ebp
+ 4b7:	89 e5                	mov    %esp,%ebp
+ 4b9:	56                   	push   %esi
+ 4ba:	53                   	push   %ebx
+ 4bb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4be:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4c4:	85 db                	test   %ebx,%ebx
+ 4c6:	7e 15                	jle    4dd <memmove+0x27>
+ 4c8:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 4ca:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 4cc:	83 c2 01             	add    $0x1,%edx
+ 4cf:	83 c0 01             	add    $0x1,%eax
+ 4d2:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 4d6:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 4d9:	39 c3                	cmp    %eax,%ebx
+ 4db:	75 ef                	jne    4cc <memmove+0x16>
+  return vdst;
+}
+ 4dd:	89 f0                	mov    %esi,%eax
+ 4df:	5b                   	pop    %ebx
+ 4e0:	5e                   	pop    %esi
+ 4e1:	5d                   	pop    %ebp
+ 4e2:	c3                   	ret
+
+000004e3 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4e3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <exit>:
+SYSCALL(exit)
+ 4eb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <wait>:
+SYSCALL(wait)
+ 4f3:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <pipe>:
+SYSCALL(pipe)
+ 4fb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <read>:
+SYSCALL(read)
+ 503:	b8 05 00 00 00       	mov    $0x5,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <write>:
+SYSCALL(write)
+ 50b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <close>:
+SYSCALL(close)
+ 513:	b8 15 00 00 00       	mov    $0x15,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <kill>:
+SYSCALL(kill)
+ 51b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <exec>:
+SYSCALL(exec)
+ 523:	b8 07 00 00 00       	mov    $0x7,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <open>:
+SYSCALL(open)
+ 52b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <mknod>:
+SYSCALL(mknod)
+ 533:	b8 11 00 00 00       	mov    $0x11,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <unlink>:
+SYSCALL(unlink)
+ 53b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <fstat>:
+SYSCALL(fstat)
+ 543:	b8 08 00 00 00       	mov    $0x8,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <link>:
+SYSCALL(link)
+ 54b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <mkdir>:
+SYSCALL(mkdir)
+ 553:	b8 14 00 00 00       	mov    $0x14,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <chdir>:
+SYSCALL(chdir)
+ 55b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <dup>:
+SYSCALL(dup)
+ 563:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <getpid>:
+SYSCALL(getpid)
+ 56b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <sbrk>:
+SYSCALL(sbrk)
+ 573:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <sleep>:
+SYSCALL(sleep)
+ 57b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <uptime>:
+SYSCALL(uptime)
+ 583:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <halt>:
+SYSCALL(halt)
+ 58b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <date>:
+SYSCALL(date)
+ 593:	b8 17 00 00 00       	mov    $0x17,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <getuid>:
+SYSCALL(getuid)
+ 59b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <getgid>:
+SYSCALL(getgid)
+ 5a3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <getppid>:
+SYSCALL(getppid)
+ 5ab:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <setuid>:
+SYSCALL(setuid)
+ 5b3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <setgid>:
+SYSCALL(setgid)
+ 5bb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <getprocs>:
+SYSCALL(getprocs)
+ 5c3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <setpriority>:
+SYSCALL(setpriority)
+ 5cb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getpriority>:
+SYSCALL(getpriority)
+ 5d3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <waitpid>:
+SYSCALL(waitpid)
+ 5db:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <setaffinity>:
+SYSCALL(setaffinity)
+ 5e3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <getaffinity>:
+SYSCALL(getaffinity)
+ 5eb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <setdeadline>:
+SYSCALL(setdeadline)
+ 5f3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <schedctl>:
+SYSCALL(schedctl)
+ 5fb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <spawn>:
+SYSCALL(spawn)
+ 603:	b8 25 00 00 00       	mov    $0x25,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <vmstats>:
+SYSCALL(vmstats)
+ 60b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 613:	b8 27 00 00 00       	mov    $0x27,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <setshares>:
+SYSCALL(setshares)
+ 61b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <getshares>:
+SYSCALL(getshares)
+ 623:	b8 29 00 00 00       	mov    $0x29,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 62b:	55                   	push   %ebp
+ 62c:	89 e5                	mov    %esp,%ebp
+ 62e:	57                   	push   %edi
+ 62f:	56                   	push   %esi
+ 630:	53                   	push   %ebx
+ 631:	83 ec 3c             	sub    $0x3c,%esp
+ 634:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 637:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 639:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 63d:	74 79                	je     6b8 <printint+0x8d>
+ 63f:	85 d2                	test   %edx,%edx
+ 641:	79 75                	jns    6b8 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 643:	89 d1                	mov    %edx,%ecx
+ 645:	f7 d9                	neg    %ecx
+    neg = 1;
+ 647:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 64e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 653:	89 df                	mov    %ebx,%edi
+ 655:	83 c3 01             	add    $0x1,%ebx
+ 658:	89 c8                	mov    %ecx,%eax
+ 65a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 65f:	f7 f6                	div    %esi
+ 661:	0f b6 92 50 0a 00 00 	movzbl 0xa50(%edx),%edx
+ 668:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 66c:	89 ca                	mov    %ecx,%edx
+ 66e:	89 c1                	mov    %eax,%ecx
+ 670:	39 f2                	cmp    %esi,%edx
+ 672:	73 df                	jae    653 <printint+0x28>
+  if(neg)
+ 674:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 678:	74 08                	je     682 <printint+0x57>
+    buf[i++] = '-';
+ 67a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 67f:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 682:	85 db                	test   %ebx,%ebx
+ 684:	7e 2a                	jle    6b0 <printint+0x85>
+ 686:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 689:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 68d:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 690:	0f b6 03             	movzbl (%ebx),%eax
+ 693:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 696:	83 ec 04             	sub    $0x4,%esp
+ 699:	6a 01                	push   $0x1
+ 69b:	57                   	push   %edi
+ 69c:	ff 75 c4             	push   -0x3c(%ebp)
+ 69f:	e8 67 fe ff ff       	call   50b <write>
+  while(--i >= 0)
+ 6a4:	89 d8                	mov    %ebx,%eax
+ 6a6:	83 eb 01             	sub    $0x1,%ebx
+ 6a9:	83 c4 10             	add    $0x10,%esp
+ 6ac:	39 f0                	cmp    %esi,%eax
+ 6ae:	75 e0                	jne    690 <printint+0x65>
+}
+ 6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+    x = xx;
+ 6b8:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 6ba:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 6c1:	eb 8b                	jmp    64e <printint+0x23>
+
+000006c3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6c3:	55                   	push   %ebp
+ 6c4:	89 e5                	mov    %esp,%ebp
+ 6c6:	57                   	push   %edi
+ 6c7:	56                   	push   %esi
+ 6c8:	53                   	push   %ebx
+ 6c9:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 6cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d2:	84 db                	test   %bl,%bl
+ 6d4:	0f 84 9e 01 00 00    	je     878 <printf+0x1b5>
+ 6da:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 6dd:	8d 45 10             	lea    0x10(%ebp),%eax
+ 6e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 6e3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6e8:	eb 2d                	jmp    717 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 6ea:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6ed:	83 ec 04             	sub    $0x4,%esp
+ 6f0:	6a 01                	push   $0x1
+ 6f2:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6f5:	50                   	push   %eax
+ 6f6:	ff 75 08             	push   0x8(%ebp)
+ 6f9:	e8 0d fe ff ff       	call   50b <write>
+        putc(fd, c);
+ 6fe:	83 c4 10             	add    $0x10,%esp
+ 701:	eb 05                	jmp    708 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 703:	83 ff 25             	cmp    $0x25,%edi
+ 706:	74 1f                	je     727 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 708:	83 c6 01             	add    $0x1,%esi
+ 70b:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 70f:	84 db                	test   %bl,%bl
+ 711:	0f 84 61 01 00 00    	je     878 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 717:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 71a:	85 ff                	test   %edi,%edi
+ 71c:	75 e5                	jne    703 <printf+0x40>
+      if(c == '%'){
+ 71e:	83 f8 25             	cmp    $0x25,%eax
+ 721:	75 c7                	jne    6ea <printf+0x27>
+        state = '%';
+ 723:	89 c7                	mov    %eax,%edi
+ 725:	eb e1                	jmp    708 <printf+0x45>
+      if(c == 'd'){
+ 727:	83 f8 25             	cmp    $0x25,%eax
+ 72a:	0f 84 f4 00 00 00    	je     824 <printf+0x161>
+ 730:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 733:	83 fa 15             	cmp    $0x15,%edx
+ 736:	0f 87 09 01 00 00    	ja     845 <printf+0x182>
+ 73c:	0f 87 03 01 00 00    	ja     845 <printf+0x182>
+ 742:	ff 24 95 f8 09 00 00 	jmp    *0x9f8(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 749:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 74c:	8b 17                	mov    (%edi),%edx
+ 74e:	83 ec 0c             	sub    $0xc,%esp
+ 751:	6a 01                	push   $0x1
+ 753:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 758:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75b:	e8 cb fe ff ff       	call   62b <printint>
+        ap++;
+ 760:	83 c7 04             	add    $0x4,%edi
+ 763:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 766:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 769:	bf 00 00 00 00       	mov    $0x0,%edi
+ 76e:	eb 98                	jmp    708 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 770:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 773:	8b 17                	mov    (%edi),%edx
+ 775:	83 ec 0c             	sub    $0xc,%esp
+ 778:	6a 00                	push   $0x0
+ 77a:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 77f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 782:	e8 a4 fe ff ff       	call   62b <printint>
+        ap++;
+ 787:	83 c7 04             	add    $0x4,%edi
+ 78a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 78d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 790:	bf 00 00 00 00       	mov    $0x0,%edi
+ 795:	e9 6e ff ff ff       	jmp    708 <printf+0x45>
+        s = (char*)*ap;
+ 79a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 79d:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 79f:	83 c1 04             	add    $0x4,%ecx
+ 7a2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 7a5:	85 c0                	test   %eax,%eax
+ 7a7:	74 13                	je     7bc <printf+0xf9>
+        s = (char*)*ap;
+ 7a9:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 7ab:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 7ae:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 7b3:	84 c0                	test   %al,%al
+ 7b5:	75 0f                	jne    7c6 <printf+0x103>
+ 7b7:	e9 4c ff ff ff       	jmp    708 <printf+0x45>
+          s = "(null)";
+ 7bc:	bb ee 09 00 00       	mov    $0x9ee,%ebx
+        while(*s != 0){
+ 7c1:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 7c6:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 7c9:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 7cc:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 7cf:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d2:	83 ec 04             	sub    $0x4,%esp
+ 7d5:	6a 01                	push   $0x1
+ 7d7:	57                   	push   %edi
+ 7d8:	56                   	push   %esi
+ 7d9:	e8 2d fd ff ff       	call   50b <write>
+          s++;
+ 7de:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 7e1:	0f b6 03             	movzbl (%ebx),%eax
+ 7e4:	83 c4 10             	add    $0x10,%esp
+ 7e7:	84 c0                	test   %al,%al
+ 7e9:	75 e4                	jne    7cf <printf+0x10c>
+      state = 0;
+ 7eb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 7ee:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7f3:	e9 10 ff ff ff       	jmp    708 <printf+0x45>
+        putc(fd, *ap);
+ 7f8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7fb:	8b 07                	mov    (%edi),%eax
+ 7fd:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	6a 01                	push   $0x1
+ 805:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 808:	50                   	push   %eax
+ 809:	ff 75 08             	push   0x8(%ebp)
+ 80c:	e8 fa fc ff ff       	call   50b <write>
+        ap++;
+ 811:	83 c7 04             	add    $0x4,%edi
+ 814:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 817:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 81f:	e9 e4 fe ff ff       	jmp    708 <printf+0x45>
+        putc(fd, c);
+ 824:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 827:	83 ec 04             	sub    $0x4,%esp
+ 82a:	6a 01                	push   $0x1
+ 82c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 82f:	50                   	push   %eax
+ 830:	ff 75 08             	push   0x8(%ebp)
+ 833:	e8 d3 fc ff ff       	call   50b <write>
+ 838:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 83b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 840:	e9 c3 fe ff ff       	jmp    708 <printf+0x45>
+        putc(fd, '%');
+ 845:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 849:	83 ec 04             	sub    $0x4,%esp
+ 84c:	6a 01                	push   $0x1
+ 84e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 851:	57                   	push   %edi
+ 852:	ff 75 08             	push   0x8(%ebp)
+ 855:	e8 b1 fc ff ff       	call   50b <write>
+        putc(fd, c);
+ 85a:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 85d:	83 c4 0c             	add    $0xc,%esp
+ 860:	6a 01                	push   $0x1
+ 862:	57                   	push   %edi
+ 863:	ff 75 08             	push   0x8(%ebp)
+ 866:	e8 a0 fc ff ff       	call   50b <write>
+        putc(fd, c);
+ 86b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 873:	e9 90 fe ff ff       	jmp    708 <printf+0x45>
+    }
+  }
+}
+ 878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 87b:	5b                   	pop    %ebx
+ 87c:	5e                   	pop    %esi
+ 87d:	5f                   	pop    %edi
+ 87e:	5d                   	pop    %ebp
+ 87f:	c3                   	ret
+
+00000880 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 889:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88c:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ 891:	eb 0c                	jmp    89f <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 893:	8b 10                	mov    (%eax),%edx
+ 895:	39 d0                	cmp    %edx,%eax
+ 897:	72 04                	jb     89d <free+0x1d>
+ 899:	39 d1                	cmp    %edx,%ecx
+ 89b:	72 10                	jb     8ad <free+0x2d>
+{
+ 89d:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 89f:	39 c8                	cmp    %ecx,%eax
+ 8a1:	73 f0                	jae    893 <free+0x13>
+ 8a3:	8b 10                	mov    (%eax),%edx
+ 8a5:	39 d1                	cmp    %edx,%ecx
+ 8a7:	72 04                	jb     8ad <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a9:	39 d0                	cmp    %edx,%eax
+ 8ab:	72 f0                	jb     89d <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8ad:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8b0:	8b 10                	mov    (%eax),%edx
+ 8b2:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8b5:	39 fa                	cmp    %edi,%edx
+ 8b7:	74 19                	je     8d2 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b9:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8bc:	8b 50 04             	mov    0x4(%eax),%edx
+ 8bf:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 8c2:	39 f1                	cmp    %esi,%ecx
+ 8c4:	74 18                	je     8de <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8c6:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 8c8:	a3 a0 11 00 00       	mov    %eax,0x11a0
+}
+ 8cd:	5b                   	pop    %ebx
+ 8ce:	5e                   	pop    %esi
+ 8cf:	5f                   	pop    %edi
+ 8d0:	5d                   	pop    %ebp
+ 8d1:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 8d2:	03 72 04             	add    0x4(%edx),%esi
+ 8d5:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d8:	8b 10                	mov    (%eax),%edx
+ 8da:	8b 12                	mov    (%edx),%edx
+ 8dc:	eb db                	jmp    8b9 <free+0x39>
+    p->s.size += bp->s.size;
+ 8de:	03 53 fc             	add    -0x4(%ebx),%edx
+ 8e1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8e4:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8e7:	eb dd                	jmp    8c6 <free+0x46>
+
+000008e9 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8e9:	55                   	push   %ebp
+ 8ea:	89 e5                	mov    %esp,%ebp
+ 8ec:	57                   	push   %edi
+ 8ed:	56                   	push   %esi
+ 8ee:	53                   	push   %ebx
+ 8ef:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f5:	8d 58 07             	lea    0x7(%eax),%ebx
+ 8f8:	c1 eb 03             	shr    $0x3,%ebx
+ 8fb:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 8fe:	8b 15 a0 11 00 00    	mov    0x11a0,%edx
+ 904:	85 d2                	test   %edx,%edx
+ 906:	74 1c                	je     924 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 908:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 90a:	8b 48 04             	mov    0x4(%eax),%ecx
+ 90d:	39 d9                	cmp    %ebx,%ecx
+ 90f:	73 38                	jae    949 <malloc+0x60>
+  if(nu < 4096)
+ 911:	be 00 10 00 00       	mov    $0x1000,%esi
+ 916:	39 f3                	cmp    %esi,%ebx
+ 918:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 91b:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 922:	eb 72                	jmp    996 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 924:	c7 05 a0 11 00 00 a4 	movl   $0x11a4,0x11a0
+ 92b:	11 00 00 
+ 92e:	c7 05 a4 11 00 00 a4 	movl   $0x11a4,0x11a4
+ 935:	11 00 00 
+    base.s.size = 0;
+ 938:	c7 05 a8 11 00 00 00 	movl   $0x0,0x11a8
+ 93f:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 942:	b8 a4 11 00 00       	mov    $0x11a4,%eax
+    if(p->s.size >= nunits){
+ 947:	eb c8                	jmp    911 <malloc+0x28>
+      if(p->s.size == nunits)
+ 949:	39 cb                	cmp    %ecx,%ebx
+ 94b:	74 1e                	je     96b <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 94d:	29 d9                	sub    %ebx,%ecx
+ 94f:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 952:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 955:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 958:	89 15 a0 11 00 00    	mov    %edx,0x11a0
+      return (void*)(p + 1);
+ 95e:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 961:	89 d0                	mov    %edx,%eax
+ 963:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 966:	5b                   	pop    %ebx
+ 967:	5e                   	pop    %esi
+ 968:	5f                   	pop    %edi
+ 969:	5d                   	pop    %ebp
+ 96a:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 96b:	8b 08                	mov    (%eax),%ecx
+ 96d:	89 0a                	mov    %ecx,(%edx)
+ 96f:	eb e7                	jmp    958 <malloc+0x6f>
+  hp->s.size = nu;
+ 971:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 974:	83 ec 0c             	sub    $0xc,%esp
+ 977:	83 c0 08             	add    $0x8,%eax
+ 97a:	50                   	push   %eax
+ 97b:	e8 00 ff ff ff       	call   880 <free>
+  return freep;
+ 980:	8b 15 a0 11 00 00    	mov    0x11a0,%edx
+      if((p = morecore(nunits)) == 0)
+ 986:	83 c4 10             	add    $0x10,%esp
+ 989:	85 d2                	test   %edx,%edx
+ 98b:	74 d4                	je     961 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 98d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 98f:	8b 48 04             	mov    0x4(%eax),%ecx
+ 992:	39 d9                	cmp    %ebx,%ecx
+ 994:	73 b3                	jae    949 <malloc+0x60>
+    if(p == freep)
+ 996:	89 c2                	mov    %eax,%edx
+ 998:	39 05 a0 11 00 00    	cmp    %eax,0x11a0
+ 99e:	75 ed                	jne    98d <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 9a0:	83 ec 0c             	sub    $0xc,%esp
+ 9a3:	57                   	push   %edi
+ 9a4:	e8 ca fb ff ff       	call   573 <sbrk>
+  if(p == (char*)-1)
+ 9a9:	83 c4 10             	add    $0x10,%esp
+ 9ac:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9af:	75 c0                	jne    971 <malloc+0x88>
+        return 0;
+ 9b1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 9b6:	eb a9                	jmp    961 <malloc+0x78>
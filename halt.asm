@@ -0,0 +1,1208 @@
+
+_halt:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// halt the system.
+#include "types.h"
+#include "user.h"
+
+int
+main(void) {
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  halt();
+   6:	e8 08 03 00 00       	call   313 <halt>
+  exit();
+   b:	e8 63 02 00 00       	call   273 <exit>
+
+00000010 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  1f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  23:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  26:	83 c0 01             	add    $0x1,%eax
+  29:	84 d2                	test   %dl,%dl
+  2b:	75 f2                	jne    1f <strcpy+0xf>
+    ;
+  return os;
+}
+  2d:	89 c8                	mov    %ecx,%eax
+  2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  32:	c9                   	leave
+  33:	c3                   	ret
+
+00000034 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  34:	55                   	push   %ebp
+  35:	89 e5                	mov    %esp,%ebp
+  37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  3d:	0f b6 01             	movzbl (%ecx),%eax
+  40:	84 c0                	test   %al,%al
+  42:	74 11                	je     55 <strcmp+0x21>
+  44:	38 02                	cmp    %al,(%edx)
+  46:	75 0d                	jne    55 <strcmp+0x21>
+    p++, q++;
+  48:	83 c1 01             	add    $0x1,%ecx
+  4b:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  4e:	0f b6 01             	movzbl (%ecx),%eax
+  51:	84 c0                	test   %al,%al
+  53:	75 ef                	jne    44 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  55:	0f b6 c0             	movzbl %al,%eax
+  58:	0f b6 12             	movzbl (%edx),%edx
+  5b:	29 d0                	sub    %edx,%eax
+}
+  5d:	5d                   	pop    %ebp
+  5e:	c3                   	ret
+
+0000005f <strlen>:
+
+uint
+strlen(char *s)
+{
+  5f:	55                   	push   %ebp
+  60:	89 e5                	mov    %esp,%ebp
+  62:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  65:	80 3a 00             	cmpb   $0x0,(%edx)
+  68:	74 14                	je     7e <strlen+0x1f>
+  6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  6f:	83 c0 01             	add    $0x1,%eax
+  72:	89 c1                	mov    %eax,%ecx
+  74:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  78:	75 f5                	jne    6f <strlen+0x10>
+    ;
+  return n;
+}
+  7a:	89 c8                	mov    %ecx,%eax
+  7c:	5d                   	pop    %ebp
+  7d:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  83:	eb f5                	jmp    7a <strlen+0x1b>
+
+00000085 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  85:	55                   	push   %ebp
+  86:	89 e5                	mov    %esp,%ebp
+  88:	57                   	push   %edi
+  89:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  8c:	89 d7                	mov    %edx,%edi
+  8e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  94:	fc                   	cld
+  95:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  97:	89 d0                	mov    %edx,%eax
+  99:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  9c:	c9                   	leave
+  9d:	c3                   	ret
+
+0000009e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  9e:	55                   	push   %ebp
+  9f:	89 e5                	mov    %esp,%ebp
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  a8:	0f b6 10             	movzbl (%eax),%edx
+  ab:	84 d2                	test   %dl,%dl
+  ad:	74 15                	je     c4 <strchr+0x26>
+    if(*s == c)
+  af:	38 d1                	cmp    %dl,%cl
+  b1:	74 0f                	je     c2 <strchr+0x24>
+  for(; *s; s++)
+  b3:	83 c0 01             	add    $0x1,%eax
+  b6:	0f b6 10             	movzbl (%eax),%edx
+  b9:	84 d2                	test   %dl,%dl
+  bb:	75 f2                	jne    af <strchr+0x11>
+      return (char*)s;
+  return 0;
+  bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  c2:	5d                   	pop    %ebp
+  c3:	c3                   	ret
+  return 0;
+  c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  c9:	eb f7                	jmp    c2 <strchr+0x24>
+
+000000cb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  cb:	55                   	push   %ebp
+  cc:	89 e5                	mov    %esp,%ebp
+  ce:	57                   	push   %edi
+  cf:	56                   	push   %esi
+  d0:	53                   	push   %ebx
+  d1:	83 ec 2c             	sub    $0x2c,%esp
+  d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+  dc:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+  df:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  e2:	83 c3 01             	add    $0x1,%ebx
+  e5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  e8:	7d 27                	jge    111 <gets+0x46>
+    cc = read(0, &c, 1);
+  ea:	83 ec 04             	sub    $0x4,%esp
+  ed:	6a 01                	push   $0x1
+  ef:	57                   	push   %edi
+  f0:	6a 00                	push   $0x0
+  f2:	e8 94 01 00 00       	call   28b <read>
+    if(cc < 1)
+  f7:	83 c4 10             	add    $0x10,%esp
+  fa:	85 c0                	test   %eax,%eax
+  fc:	7e 13                	jle    111 <gets+0x46>
+      break;
+    buf[i++] = c;
+  fe:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 102:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 106:	3c 0a                	cmp    $0xa,%al
+ 108:	74 04                	je     10e <gets+0x43>
+ 10a:	3c 0d                	cmp    $0xd,%al
+ 10c:	75 d1                	jne    df <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 10e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 111:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 114:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 118:	89 f0                	mov    %esi,%eax
+ 11a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 11d:	5b                   	pop    %ebx
+ 11e:	5e                   	pop    %esi
+ 11f:	5f                   	pop    %edi
+ 120:	5d                   	pop    %ebp
+ 121:	c3                   	ret
+
+00000122 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 122:	55                   	push   %ebp
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	56                   	push   %esi
+ 126:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 127:	83 ec 08             	sub    $0x8,%esp
+ 12a:	6a 00                	push   $0x0
+ 12c:	ff 75 08             	push   0x8(%ebp)
+ 12f:	e8 7f 01 00 00       	call   2b3 <open>
+  if(fd < 0)
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	78 24                	js     15f <stat+0x3d>
+ 13b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 13d:	83 ec 08             	sub    $0x8,%esp
+ 140:	ff 75 0c             	push   0xc(%ebp)
+ 143:	50                   	push   %eax
+ 144:	e8 82 01 00 00       	call   2cb <fstat>
+ 149:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 14b:	89 1c 24             	mov    %ebx,(%esp)
+ 14e:	e8 48 01 00 00       	call   29b <close>
+  return r;
+ 153:	83 c4 10             	add    $0x10,%esp
+}
+ 156:	89 f0                	mov    %esi,%eax
+ 158:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 15b:	5b                   	pop    %ebx
+ 15c:	5e                   	pop    %esi
+ 15d:	5d                   	pop    %ebp
+ 15e:	c3                   	ret
+    return -1;
+ 15f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 164:	eb f0                	jmp    156 <stat+0x34>
+
+00000166 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	56                   	push   %esi
+ 16a:	53                   	push   %ebx
+ 16b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 16e:	0f b6 0a             	movzbl (%edx),%ecx
+ 171:	80 f9 20             	cmp    $0x20,%cl
+ 174:	75 0b                	jne    181 <atoi+0x1b>
+ 176:	83 c2 01             	add    $0x1,%edx
+ 179:	0f b6 0a             	movzbl (%edx),%ecx
+ 17c:	80 f9 20             	cmp    $0x20,%cl
+ 17f:	74 f5                	je     176 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 181:	80 f9 2d             	cmp    $0x2d,%cl
+ 184:	74 3c                	je     1c2 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 186:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 189:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 18e:	f6 c1 fd             	test   $0xfd,%cl
+ 191:	74 34                	je     1c7 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 193:	0f b6 0a             	movzbl (%edx),%ecx
+ 196:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 199:	3c 09                	cmp    $0x9,%al
+ 19b:	77 2f                	ja     1cc <atoi+0x66>
+ 19d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 1a2:	83 c2 01             	add    $0x1,%edx
+ 1a5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1a8:	0f be c9             	movsbl %cl,%ecx
+ 1ab:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 1af:	0f b6 0a             	movzbl (%edx),%ecx
+ 1b2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1b5:	3c 09                	cmp    $0x9,%al
+ 1b7:	76 e9                	jbe    1a2 <atoi+0x3c>
+  return sign*n;
+ 1b9:	89 f0                	mov    %esi,%eax
+ 1bb:	0f af c3             	imul   %ebx,%eax
+}
+ 1be:	5b                   	pop    %ebx
+ 1bf:	5e                   	pop    %esi
+ 1c0:	5d                   	pop    %ebp
+ 1c1:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 1c2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 1c7:	83 c2 01             	add    $0x1,%edx
+ 1ca:	eb c7                	jmp    193 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 1cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1d1:	eb e6                	jmp    1b9 <atoi+0x53>
+
+000001d3 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1d3:	55                   	push   %ebp
+ 1d4:	89 e5                	mov    %esp,%ebp
+ 1d6:	56                   	push   %esi
+ 1d7:	53                   	push   %ebx
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1db:	0f b6 0a             	movzbl (%edx),%ecx
+ 1de:	80 f9 20             	cmp    $0x20,%cl
+ 1e1:	75 0b                	jne    1ee <atoo+0x1b>
+ 1e3:	83 c2 01             	add    $0x1,%edx
+ 1e6:	0f b6 0a             	movzbl (%edx),%ecx
+ 1e9:	80 f9 20             	cmp    $0x20,%cl
+ 1ec:	74 f5                	je     1e3 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1ee:	80 f9 2d             	cmp    $0x2d,%cl
+ 1f1:	74 3a                	je     22d <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 1f3:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1f6:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1fb:	f6 c1 fd             	test   $0xfd,%cl
+ 1fe:	74 32                	je     232 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 200:	0f b6 0a             	movzbl (%edx),%ecx
+ 203:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 206:	80 fb 07             	cmp    $0x7,%bl
+ 209:	77 2c                	ja     237 <atoo+0x64>
+ 20b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 210:	83 c2 01             	add    $0x1,%edx
+ 213:	0f be c9             	movsbl %cl,%ecx
+ 216:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 21a:	0f b6 0a             	movzbl (%edx),%ecx
+ 21d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 220:	3c 07                	cmp    $0x7,%al
+ 222:	76 ec                	jbe    210 <atoo+0x3d>
+  return sign*n;
+ 224:	89 f0                	mov    %esi,%eax
+ 226:	0f af c3             	imul   %ebx,%eax
+}
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 22d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 232:	83 c2 01             	add    $0x1,%edx
+ 235:	eb c9                	jmp    200 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 237:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 23c:	eb e6                	jmp    224 <atoo+0x51>
+
+0000023e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	56                   	push   %esi
+ 242:	53                   	push   %ebx
+ 243:	8b 75 08             	mov    0x8(%ebp),%esi
+ 246:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 249:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24c:	85 db                	test   %ebx,%ebx
+ 24e:	7e 15                	jle    265 <memmove+0x27>
+ 250:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 252:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 254:	83 c2 01             	add    $0x1,%edx
+ 257:	83 c0 01             	add    $0x1,%eax
+ 25a:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 25e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 261:	39 c3                	cmp    %eax,%ebx
+ 263:	75 ef                	jne    254 <memmove+0x16>
+  return vdst;
+}
+ 265:	89 f0                	mov    %esi,%eax
+ 267:	5b                   	pop    %ebx
+ 268:	5e                   	pop    %esi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+
+0000026b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <exit>:
+SYSCALL(exit)
+ 273:	b8 02 00 00 00       	mov    $0x2,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <wait>:
+SYSCALL(wait)
+ 27b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <pipe>:
+SYSCALL(pipe)
+ 283:	b8 04 00 00 00       	mov    $0x4,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <read>:
+SYSCALL(read)
+ 28b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <write>:
+SYSCALL(write)
+ 293:	b8 10 00 00 00       	mov    $0x10,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <close>:
+SYSCALL(close)
+ 29b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <kill>:
+SYSCALL(kill)
+ 2a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <exec>:
+SYSCALL(exec)
+ 2ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <open>:
+SYSCALL(open)
+ 2b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <mknod>:
+SYSCALL(mknod)
+ 2bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <unlink>:
+SYSCALL(unlink)
+ 2c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <fstat>:
+SYSCALL(fstat)
+ 2cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <link>:
+SYSCALL(link)
+ 2d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <mkdir>:
+SYSCALL(mkdir)
+ 2db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <chdir>:
+SYSCALL(chdir)
+ 2e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <dup>:
+SYSCALL(dup)
+ 2eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <getpid>:
+SYSCALL(getpid)
+ 2f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <sbrk>:
+SYSCALL(sbrk)
+ 2fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <sleep>:
+SYSCALL(sleep)
+ 303:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <uptime>:
+SYSCALL(uptime)
+ 30b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <halt>:
+SYSCALL(halt)
+ 313:	b8 16 00 00 00       	mov    $0x16,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <date>:
+SYSCALL(date)
+ 31b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <getuid>:
+SYSCALL(getuid)
+ 323:	b8 18 00 00 00       	mov    $0x18,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <getgid>:
+SYSCALL(getgid)
+ 32b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getppid>:
+SYSCALL(getppid)
+ 333:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <setuid>:
+SYSCALL(setuid)
+ 33b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <setgid>:
+SYSCALL(setgid)
+ 343:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <getprocs>:
+SYSCALL(getprocs)
+ 34b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <setpriority>:
+SYSCALL(setpriority)
+ 353:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <getpriority>:
+SYSCALL(getpriority)
+ 35b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <waitpid>:
+SYSCALL(waitpid)
+ 363:	b8 20 00 00 00       	mov    $0x20,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <setaffinity>:
+SYSCALL(setaffinity)
+ 36b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getaffinity>:
+SYSCALL(getaffinity)
+ 373:	b8 22 00 00 00       	mov    $0x22,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <setdeadline>:
+SYSCALL(setdeadline)
+ 37b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <schedctl>:
+SYSCALL(schedctl)
+ 383:	b8 24 00 00 00       	mov    $0x24,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <spawn>:
+SYSCALL(spawn)
+ 38b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <vmstats>:
+SYSCALL(vmstats)
+ 393:	b8 26 00 00 00       	mov    $0x26,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <hugesbrk>:
+SYSCALL(hugesbrk)
+ 39b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <setshares>:
+SYSCALL(setshares)
+ 3a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getshares>:
+SYSCALL(getshares)
+ 3ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3b3:	55                   	push   %ebp
+ 3b4:	89 e5                	mov    %esp,%ebp
+ 3b6:	57                   	push   %edi
+ 3b7:	56                   	push   %esi
+ 3b8:	53                   	push   %ebx
+ 3b9:	83 ec 3c             	sub    $0x3c,%esp
+ 3bc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3bf:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3c1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3c5:	74 79                	je     440 <printint+0x8d>
+ 3c7:	85 d2                	test   %edx,%edx
+ 3c9:	79 75                	jns    440 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 3cb:	89 d1                	mov    %edx,%ecx
+ 3cd:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3cf:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3db:	89 df                	mov    %ebx,%edi
+ 3dd:	83 c3 01             	add    $0x1,%ebx
+ 3e0:	89 c8                	mov    %ecx,%eax
+ 3e2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e7:	f7 f6                	div    %esi
+ 3e9:	0f b6 92 a0 07 00 00 	movzbl 0x7a0(%edx),%edx
+ 3f0:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 3f4:	89 ca                	mov    %ecx,%edx
+ 3f6:	89 c1                	mov    %eax,%ecx
+ 3f8:	39 f2                	cmp    %esi,%edx
+ 3fa:	73 df                	jae    3db <printint+0x28>
+  if(neg)
+ 3fc:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 400:	74 08                	je     40a <printint+0x57>
+    buf[i++] = '-';
+ 402:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 407:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 40a:	85 db                	test   %ebx,%ebx
+ 40c:	7e 2a                	jle    438 <printint+0x85>
+ 40e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 411:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 415:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 418:	0f b6 03             	movzbl (%ebx),%eax
+ 41b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 41e:	83 ec 04             	sub    $0x4,%esp
+ 421:	6a 01                	push   $0x1
+ 423:	57                   	push   %edi
+ 424:	ff 75 c4             	push   -0x3c(%ebp)
+ 427:	e8 67 fe ff ff       	call   293 <write>
+  while(--i >= 0)
+ 42c:	89 d8                	mov    %ebx,%eax
+ 42e:	83 eb 01             	sub    $0x1,%ebx
+ 431:	83 c4 10             	add    $0x10,%esp
+ 434:	39 f0                	cmp    %esi,%eax
+ 436:	75 e0                	jne    418 <printint+0x65>
+}
+ 438:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43b:	5b                   	pop    %ebx
+ 43c:	5e                   	pop    %esi
+ 43d:	5f                   	pop    %edi
+ 43e:	5d                   	pop    %ebp
+ 43f:	c3                   	ret
+    x = xx;
+ 440:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 442:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 449:	eb 8b                	jmp    3d6 <printint+0x23>
+
+0000044b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 44b:	55                   	push   %ebp
+ 44c:	89 e5                	mov    %esp,%ebp
+ 44e:	57                   	push   %edi
+ 44f:	56                   	push   %esi
+ 450:	53                   	push   %ebx
+ 451:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 454:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 457:	0f b6 1e             	movzbl (%esi),%ebx
+ 45a:	84 db                	test   %bl,%bl
+ 45c:	0f 84 9e 01 00 00    	je     600 <printf+0x1b5>
+ 462:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 465:	8d 45 10             	lea    0x10(%ebp),%eax
+ 468:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 46b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 470:	eb 2d                	jmp    49f <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 472:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 475:	83 ec 04             	sub    $0x4,%esp
+ 478:	6a 01                	push   $0x1
+ 47a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 47d:	50                   	push   %eax
+ 47e:	ff 75 08             	push   0x8(%ebp)
+ 481:	e8 0d fe ff ff       	call   293 <write>
+        putc(fd, c);
+ 486:	83 c4 10             	add    $0x10,%esp
+ 489:	eb 05                	jmp    490 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 48b:	83 ff 25             	cmp    $0x25,%edi
+ 48e:	74 1f                	je     4af <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 490:	83 c6 01             	add    $0x1,%esi
+ 493:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 497:	84 db                	test   %bl,%bl
+ 499:	0f 84 61 01 00 00    	je     600 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 49f:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4a2:	85 ff                	test   %edi,%edi
+ 4a4:	75 e5                	jne    48b <printf+0x40>
+      if(c == '%'){
+ 4a6:	83 f8 25             	cmp    $0x25,%eax
+ 4a9:	75 c7                	jne    472 <printf+0x27>
+        state = '%';
+ 4ab:	89 c7                	mov    %eax,%edi
+ 4ad:	eb e1                	jmp    490 <printf+0x45>
+      if(c == 'd'){
+ 4af:	83 f8 25             	cmp    $0x25,%eax
+ 4b2:	0f 84 f4 00 00 00    	je     5ac <printf+0x161>
+ 4b8:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4bb:	83 fa 15             	cmp    $0x15,%edx
+ 4be:	0f 87 09 01 00 00    	ja     5cd <printf+0x182>
+ 4c4:	0f 87 03 01 00 00    	ja     5cd <printf+0x182>
+ 4ca:	ff 24 95 48 07 00 00 	jmp    *0x748(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 4d1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4d4:	8b 17                	mov    (%edi),%edx
+ 4d6:	83 ec 0c             	sub    $0xc,%esp
+ 4d9:	6a 01                	push   $0x1
+ 4db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e3:	e8 cb fe ff ff       	call   3b3 <printint>
+        ap++;
+ 4e8:	83 c7 04             	add    $0x4,%edi
+ 4eb:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4ee:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4f1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4f6:	eb 98                	jmp    490 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 4f8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4fb:	8b 17                	mov    (%edi),%edx
+ 4fd:	83 ec 0c             	sub    $0xc,%esp
+ 500:	6a 00                	push   $0x0
+ 502:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 507:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50a:	e8 a4 fe ff ff       	call   3b3 <printint>
+        ap++;
+ 50f:	83 c7 04             	add    $0x4,%edi
+ 512:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 515:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 518:	bf 00 00 00 00       	mov    $0x0,%edi
+ 51d:	e9 6e ff ff ff       	jmp    490 <printf+0x45>
+        s = (char*)*ap;
+ 522:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 525:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 527:	83 c1 04             	add    $0x4,%ecx
+ 52a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 52d:	85 c0                	test   %eax,%eax
+ 52f:	74 13                	je     544 <printf+0xf9>
+        s = (char*)*ap;
+ 531:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 533:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 536:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 53b:	84 c0                	test   %al,%al
+ 53d:	75 0f                	jne    54e <printf+0x103>
+ 53f:	e9 4c ff ff ff       	jmp    490 <printf+0x45>
+          s = "(null)";
+ 544:	bb 40 07 00 00       	mov    $0x740,%ebx
+        while(*s != 0){
+ 549:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 54e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 551:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 554:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 557:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 55a:	83 ec 04             	sub    $0x4,%esp
+ 55d:	6a 01                	push   $0x1
+ 55f:	57                   	push   %edi
+ 560:	56                   	push   %esi
+ 561:	e8 2d fd ff ff       	call   293 <write>
+          s++;
+ 566:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 569:	0f b6 03             	movzbl (%ebx),%eax
+ 56c:	83 c4 10             	add    $0x10,%esp
+ 56f:	84 c0                	test   %al,%al
+ 571:	75 e4                	jne    557 <printf+0x10c>
+      state = 0;
+ 573:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 576:	bf 00 00 00 00       	mov    $0x0,%edi
+ 57b:	e9 10 ff ff ff       	jmp    490 <printf+0x45>
+        putc(fd, *ap);
+ 580:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 583:	8b 07                	mov    (%edi),%eax
+ 585:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 588:	83 ec 04             	sub    $0x4,%esp
+ 58b:	6a 01                	push   $0x1
+ 58d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 590:	50                   	push   %eax
+ 591:	ff 75 08             	push   0x8(%ebp)
+ 594:	e8 fa fc ff ff       	call   293 <write>
+        ap++;
+ 599:	83 c7 04             	add    $0x4,%edi
+ 59c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 59f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5a2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5a7:	e9 e4 fe ff ff       	jmp    490 <printf+0x45>
+        putc(fd, c);
+ 5ac:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5af:	83 ec 04             	sub    $0x4,%esp
+ 5b2:	6a 01                	push   $0x1
+ 5b4:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5b7:	50                   	push   %eax
+ 5b8:	ff 75 08             	push   0x8(%ebp)
+ 5bb:	e8 d3 fc ff ff       	call   293 <write>
+ 5c0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5c3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c8:	e9 c3 fe ff ff       	jmp    490 <printf+0x45>
+        putc(fd, '%');
+ 5cd:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d1:	83 ec 04             	sub    $0x4,%esp
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5d9:	57                   	push   %edi
+ 5da:	ff 75 08             	push   0x8(%ebp)
+ 5dd:	e8 b1 fc ff ff       	call   293 <write>
+        putc(fd, c);
+ 5e2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e5:	83 c4 0c             	add    $0xc,%esp
+ 5e8:	6a 01                	push   $0x1
+ 5ea:	57                   	push   %edi
+ 5eb:	ff 75 08             	push   0x8(%ebp)
+ 5ee:	e8 a0 fc ff ff       	call   293 <write>
+        putc(fd, c);
+ 5f3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5fb:	e9 90 fe ff ff       	jmp    490 <printf+0x45>
+    }
+  }
+}
+ 600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+
+00000608 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 608:	55                   	push   %ebp
+ 609:	89 e5                	mov    %esp,%ebp
+ 60b:	57                   	push   %edi
+ 60c:	56                   	push   %esi
+ 60d:	53                   	push   %ebx
+ 60e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 611:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 614:	a1 30 0a 00 00       	mov    0xa30,%eax
+ 619:	eb 0c                	jmp    627 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 61b:	8b 10                	mov    (%eax),%edx
+ 61d:	39 d0                	cmp    %edx,%eax
+ 61f:	72 04                	jb     625 <free+0x1d>
+ 621:	39 d1                	cmp    %edx,%ecx
+ 623:	72 10                	jb     635 <free+0x2d>
+{
+ 625:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 627:	39 c8                	cmp    %ecx,%eax
+ 629:	73 f0                	jae    61b <free+0x13>
+ 62b:	8b 10                	mov    (%eax),%edx
+ 62d:	39 d1                	cmp    %edx,%ecx
+ 62f:	72 04                	jb     635 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 631:	39 d0                	cmp    %edx,%eax
+ 633:	72 f0                	jb     625 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 635:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 638:	8b 10                	mov    (%eax),%edx
+ 63a:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 63d:	39 fa                	cmp    %edi,%edx
+ 63f:	74 19                	je     65a <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 641:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 644:	8b 50 04             	mov    0x4(%eax),%edx
+ 647:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 64a:	39 f1                	cmp    %esi,%ecx
+ 64c:	74 18                	je     666 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 64e:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 650:	a3 30 0a 00 00       	mov    %eax,0xa30
+}
+ 655:	5b                   	pop    %ebx
+ 656:	5e                   	pop    %esi
+ 657:	5f                   	pop    %edi
+ 658:	5d                   	pop    %ebp
+ 659:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 65a:	03 72 04             	add    0x4(%edx),%esi
+ 65d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 660:	8b 10                	mov    (%eax),%edx
+ 662:	8b 12                	mov    (%edx),%edx
+ 664:	eb db                	jmp    641 <free+0x39>
+    p->s.size += bp->s.size;
+ 666:	03 53 fc             	add    -0x4(%ebx),%edx
+ 669:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 66c:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 66f:	eb dd                	jmp    64e <free+0x46>
+
+00000671 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 671:	55                   	push   %ebp
+ 672:	89 e5                	mov    %esp,%ebp
+ 674:	57                   	push   %edi
+ 675:	56                   	push   %esi
+ 676:	53                   	push   %ebx
+ 677:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67d:	8d 58 07             	lea    0x7(%eax),%ebx
+ 680:	c1 eb 03             	shr    $0x3,%ebx
+ 683:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 686:	8b 15 30 0a 00 00    	mov    0xa30,%edx
+ 68c:	85 d2                	test   %edx,%edx
+ 68e:	74 1c                	je     6ac <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 690:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 692:	8b 48 04             	mov    0x4(%eax),%ecx
+ 695:	39 d9                	cmp    %ebx,%ecx
+ 697:	73 38                	jae    6d1 <malloc+0x60>
+  if(nu < 4096)
+ 699:	be 00 10 00 00       	mov    $0x1000,%esi
+ 69e:	39 f3                	cmp    %esi,%ebx
+ 6a0:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6a3:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6aa:	eb 72                	jmp    71e <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6ac:	c7 05 30 0a 00 00 34 	movl   $0xa34,0xa30
+ 6b3:	0a 00 00 
+ 6b6:	c7 05 34 0a 00 00 34 	movl   $0xa34,0xa34
+ 6bd:	0a 00 00 
+    base.s.size = 0;
+ 6c0:	c7 05 38 0a 00 00 00 	movl   $0x0,0xa38
+ 6c7:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6ca:	b8 34 0a 00 00       	mov    $0xa34,%eax
+    if(p->s.size >= nunits){
+ 6cf:	eb c8                	jmp    699 <malloc+0x28>
+      if(p->s.size == nunits)
+ 6d1:	39 cb                	cmp    %ecx,%ebx
+ 6d3:	74 1e                	je     6f3 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6d5:	29 d9                	sub    %ebx,%ecx
+ 6d7:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6da:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 6dd:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6e0:	89 15 30 0a 00 00    	mov    %edx,0xa30
+      return (void*)(p + 1);
+ 6e6:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6e9:	89 d0                	mov    %edx,%eax
+ 6eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ee:	5b                   	pop    %ebx
+ 6ef:	5e                   	pop    %esi
+ 6f0:	5f                   	pop    %edi
+ 6f1:	5d                   	pop    %ebp
+ 6f2:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6f3:	8b 08                	mov    (%eax),%ecx
+ 6f5:	89 0a                	mov    %ecx,(%edx)
+ 6f7:	eb e7                	jmp    6e0 <malloc+0x6f>
+  hp->s.size = nu;
+ 6f9:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 6fc:	83 ec 0c             	sub    $0xc,%esp
+ 6ff:	83 c0 08             	add    $0x8,%eax
+ 702:	50                   	push   %eax
+ 703:	e8 00 ff ff ff       	call   608 <free>
+  return freep;
+ 708:	8b 15 30 0a 00 00    	mov    0xa30,%edx
+      if((p = morecore(nunits)) == 0)
+ 70e:	83 c4 10             	add    $0x10,%esp
+ 711:	85 d2                	test   %edx,%edx
+ 713:	74 d4                	je     6e9 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 715:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 717:	8b 48 04             	mov    0x4(%eax),%ecx
+ 71a:	39 d9                	cmp    %ebx,%ecx
+ 71c:	73 b3                	jae    6d1 <malloc+0x60>
+    if(p == freep)
+ 71e:	89 c2                	mov    %eax,%edx
+ 720:	39 05 30 0a 00 00    	cmp    %eax,0xa30
+ 726:	75 ed                	jne    715 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 728:	83 ec 0c             	sub    $0xc,%esp
+ 72b:	57                   	push   %edi
+ 72c:	e8 ca fb ff ff       	call   2fb <sbrk>
+  if(p == (char*)-1)
+ 731:	83 c4 10             	add    $0x10,%esp
+ 734:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 737:	75 c0                	jne    6f9 <malloc+0x88>
+        return 0;
+ 739:	ba 00 00 00 00       	mov    $0x0,%edx
+ 73e:	eb a9                	jmp    6e9 <malloc+0x78>
@@ -0,0 +1,31 @@
+#!/bin/sh
+# Boot xv6 with nothing to do and report how much host CPU QEMU uses.
+# Usage: idlebench.sh qemu-binary [seconds] -- qemu-options...
+# Run from the Makefile: make idlebench [TICKLESS=1] [CPUS=n]
+# (make clean first when switching TICKLESS, so everything is rebuilt.)
+
+QEMU=$1; shift
+SECS=10
+if [ "$1" != "--" ]; then SECS=$1; shift; fi
+shift
+
+$QEMU -display none -serial null -monitor none "$@" &
+pid=$!
+trap 'kill $pid 2>/dev/null' EXIT
+
+# Let the kernel boot and the shell settle into its read().
+sleep 5
+
+cputime() {
+  # utime + stime, in clock ticks (fields 14 and 15 of /proc/pid/stat).
+  awk '{ print $14 + $15 }' /proc/$pid/stat
+}
+
+hz=$(getconf CLK_TCK)
+t0=$(cputime)
+sleep $SECS
+t1=$(cputime)
+
+awk -v t=$((t1 - t0)) -v hz=$hz -v s=$SECS 'BEGIN {
+  printf "idle guest used %.1f%% of a host cpu over %d seconds\n", 100 * t / hz / s, s
+}'
@@ -0,0 +1,1297 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 10 08 00 00       	push   $0x810
+  19:	e8 62 03 00 00       	call   380 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	78 59                	js     7e <main+0x7e>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	6a 00                	push   $0x0
+  2a:	e8 89 03 00 00       	call   3b8 <dup>
+  dup(0);  // stderr
+  2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  36:	e8 7d 03 00 00       	call   3b8 <dup>
+  3b:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  3e:	83 ec 08             	sub    $0x8,%esp
+  41:	68 18 08 00 00       	push   $0x818
+  46:	6a 01                	push   $0x1
+  48:	e8 cb 04 00 00       	call   518 <printf>
+    pid = fork();
+  4d:	e8 e6 02 00 00       	call   338 <fork>
+  52:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  54:	83 c4 10             	add    $0x10,%esp
+  57:	85 c0                	test   %eax,%eax
+  59:	78 48                	js     a3 <main+0xa3>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  5b:	74 5a                	je     b7 <main+0xb7>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  5d:	e8 e6 02 00 00       	call   348 <wait>
+  62:	39 c3                	cmp    %eax,%ebx
+  64:	74 d8                	je     3e <main+0x3e>
+  66:	85 c0                	test   %eax,%eax
+  68:	78 d4                	js     3e <main+0x3e>
+      printf(1, "zombie!\n");
+  6a:	83 ec 08             	sub    $0x8,%esp
+  6d:	68 57 08 00 00       	push   $0x857
+  72:	6a 01                	push   $0x1
+  74:	e8 9f 04 00 00       	call   518 <printf>
+  79:	83 c4 10             	add    $0x10,%esp
+  7c:	eb df                	jmp    5d <main+0x5d>
+    mknod("console", 1, 1);
+  7e:	83 ec 04             	sub    $0x4,%esp
+  81:	6a 01                	push   $0x1
+  83:	6a 01                	push   $0x1
+  85:	68 10 08 00 00       	push   $0x810
+  8a:	e8 f9 02 00 00       	call   388 <mknod>
+    open("console", O_RDWR);
+  8f:	83 c4 08             	add    $0x8,%esp
+  92:	6a 02                	push   $0x2
+  94:	68 10 08 00 00       	push   $0x810
+  99:	e8 e2 02 00 00       	call   380 <open>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	eb 82                	jmp    25 <main+0x25>
+      printf(1, "init: fork failed\n");
+  a3:	83 ec 08             	sub    $0x8,%esp
+  a6:	68 2b 08 00 00       	push   $0x82b
+  ab:	6a 01                	push   $0x1
+  ad:	e8 66 04 00 00       	call   518 <printf>
+      exit();
+  b2:	e8 89 02 00 00       	call   340 <exit>
+      exec("sh", argv);
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	68 5c 0b 00 00       	push   $0xb5c
+  bf:	68 3e 08 00 00       	push   $0x83e
+  c4:	e8 af 02 00 00       	call   378 <exec>
+      printf(1, "init: exec sh failed\n");
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	68 41 08 00 00       	push   $0x841
+  d1:	6a 01                	push   $0x1
+  d3:	e8 40 04 00 00       	call   518 <printf>
+      exit();
+  d8:	e8 63 02 00 00       	call   340 <exit>
+
+000000dd <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  dd:	55                   	push   %ebp
+  de:	89 e5                	mov    %esp,%ebp
+  e0:	53                   	push   %ebx
+  e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  ec:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f3:	83 c0 01             	add    $0x1,%eax
+  f6:	84 d2                	test   %dl,%dl
+  f8:	75 f2                	jne    ec <strcpy+0xf>
+    ;
+  return os;
+}
+  fa:	89 c8                	mov    %ecx,%eax
+  fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ff:	c9                   	leave
+ 100:	c3                   	ret
+
+00000101 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 107:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 10a:	0f b6 01             	movzbl (%ecx),%eax
+ 10d:	84 c0                	test   %al,%al
+ 10f:	74 11                	je     122 <strcmp+0x21>
+ 111:	38 02                	cmp    %al,(%edx)
+ 113:	75 0d                	jne    122 <strcmp+0x21>
+    p++, q++;
+ 115:	83 c1 01             	add    $0x1,%ecx
+ 118:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 11b:	0f b6 01             	movzbl (%ecx),%eax
+ 11e:	84 c0                	test   %al,%al
+ 120:	75 ef                	jne    111 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 122:	0f b6 c0             	movzbl %al,%eax
+ 125:	0f b6 12             	movzbl (%edx),%edx
+ 128:	29 d0                	sub    %edx,%eax
+}
+ 12a:	5d                   	pop    %ebp
+ 12b:	c3                   	ret
+
+0000012c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 12c:	55                   	push   %ebp
+ 12d:	89 e5                	mov    %esp,%ebp
+ 12f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 132:	80 3a 00             	cmpb   $0x0,(%edx)
+ 135:	74 14                	je     14b <strlen+0x1f>
+ 137:	b8 00 00 00 00       	mov    $0x0,%eax
+ 13c:	83 c0 01             	add    $0x1,%eax
+ 13f:	89 c1                	mov    %eax,%ecx
+ 141:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 145:	75 f5                	jne    13c <strlen+0x10>
+    ;
+  return n;
+}
+ 147:	89 c8                	mov    %ecx,%eax
+ 149:	5d                   	pop    %ebp
+ 14a:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 14b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 150:	eb f5                	jmp    147 <strlen+0x1b>
+
+00000152 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 159:	89 d7                	mov    %edx,%edi
+ 15b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 15e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 161:	fc                   	cld
+ 162:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 164:	89 d0                	mov    %edx,%eax
+ 166:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 169:	c9                   	leave
+ 16a:	c3                   	ret
+
+0000016b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 16b:	55                   	push   %ebp
+ 16c:	89 e5                	mov    %esp,%ebp
+ 16e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 171:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 175:	0f b6 10             	movzbl (%eax),%edx
+ 178:	84 d2                	test   %dl,%dl
+ 17a:	74 15                	je     191 <strchr+0x26>
+    if(*s == c)
+ 17c:	38 d1                	cmp    %dl,%cl
+ 17e:	74 0f                	je     18f <strchr+0x24>
+  for(; *s; s++)
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	0f b6 10             	movzbl (%eax),%edx
+ 186:	84 d2                	test   %dl,%dl
+ 188:	75 f2                	jne    17c <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 18a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 18f:	5d                   	pop    %ebp
+ 190:	c3                   	ret
+  return 0;
+ 191:	b8 00 00 00 00       	mov    $0x0,%eax
+ 196:	eb f7                	jmp    18f <strchr+0x24>
+
+00000198 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 198:	55                   	push   %ebp
+ 199:	89 e5                	mov    %esp,%ebp
+ 19b:	57                   	push   %edi
+ 19c:	56                   	push   %esi
+ 19d:	53                   	push   %ebx
+ 19e:	83 ec 2c             	sub    $0x2c,%esp
+ 1a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1a9:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1ac:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1af:	83 c3 01             	add    $0x1,%ebx
+ 1b2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1b5:	7d 27                	jge    1de <gets+0x46>
+    cc = read(0, &c, 1);
+ 1b7:	83 ec 04             	sub    $0x4,%esp
+ 1ba:	6a 01                	push   $0x1
+ 1bc:	57                   	push   %edi
+ 1bd:	6a 00                	push   $0x0
+ 1bf:	e8 94 01 00 00       	call   358 <read>
+    if(cc < 1)
+ 1c4:	83 c4 10             	add    $0x10,%esp
+ 1c7:	85 c0                	test   %eax,%eax
+ 1c9:	7e 13                	jle    1de <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1cb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1cf:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1d3:	3c 0a                	cmp    $0xa,%al
+ 1d5:	74 04                	je     1db <gets+0x43>
+ 1d7:	3c 0d                	cmp    $0xd,%al
+ 1d9:	75 d1                	jne    1ac <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1db:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1e1:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1e5:	89 f0                	mov    %esi,%eax
+ 1e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ea:	5b                   	pop    %ebx
+ 1eb:	5e                   	pop    %esi
+ 1ec:	5f                   	pop    %edi
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+
+000001ef <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ef:	55                   	push   %ebp
+ 1f0:	89 e5                	mov    %esp,%ebp
+ 1f2:	56                   	push   %esi
+ 1f3:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f4:	83 ec 08             	sub    $0x8,%esp
+ 1f7:	6a 00                	push   $0x0
+ 1f9:	ff 75 08             	push   0x8(%ebp)
+ 1fc:	e8 7f 01 00 00       	call   380 <open>
+  if(fd < 0)
+ 201:	83 c4 10             	add    $0x10,%esp
+ 204:	85 c0                	test   %eax,%eax
+ 206:	78 24                	js     22c <stat+0x3d>
+ 208:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 20a:	83 ec 08             	sub    $0x8,%esp
+ 20d:	ff 75 0c             	push   0xc(%ebp)
+ 210:	50                   	push   %eax
+ 211:	e8 82 01 00 00       	call   398 <fstat>
+ 216:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 218:	89 1c 24             	mov    %ebx,(%esp)
+ 21b:	e8 48 01 00 00       	call   368 <close>
+  return r;
+ 220:	83 c4 10             	add    $0x10,%esp
+}
+ 223:	89 f0                	mov    %esi,%eax
+ 225:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 228:	5b                   	pop    %ebx
+ 229:	5e                   	pop    %esi
+ 22a:	5d                   	pop    %ebp
+ 22b:	c3                   	ret
+    return -1;
+ 22c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 231:	eb f0                	jmp    223 <stat+0x34>
+
+00000233 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 233:	55                   	push   %ebp
+ 234:	89 e5                	mov    %esp,%ebp
+ 236:	56                   	push   %esi
+ 237:	53                   	push   %ebx
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 23b:	0f b6 0a             	movzbl (%edx),%ecx
+ 23e:	80 f9 20             	cmp    $0x20,%cl
+ 241:	75 0b                	jne    24e <atoi+0x1b>
+ 243:	83 c2 01             	add    $0x1,%edx
+ 246:	0f b6 0a             	movzbl (%edx),%ecx
+ 249:	80 f9 20             	cmp    $0x20,%cl
+ 24c:	74 f5                	je     243 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 24e:	80 f9 2d             	cmp    $0x2d,%cl
+ 251:	74 3c                	je     28f <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 253:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 256:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 25b:	f6 c1 fd             	test   $0xfd,%cl
+ 25e:	74 34                	je     294 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 260:	0f b6 0a             	movzbl (%edx),%ecx
+ 263:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 266:	3c 09                	cmp    $0x9,%al
+ 268:	77 2f                	ja     299 <atoi+0x66>
+ 26a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 26f:	83 c2 01             	add    $0x1,%edx
+ 272:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 275:	0f be c9             	movsbl %cl,%ecx
+ 278:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 27c:	0f b6 0a             	movzbl (%edx),%ecx
+ 27f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 282:	3c 09                	cmp    $0x9,%al
+ 284:	76 e9                	jbe    26f <atoi+0x3c>
+  return sign*n;
+ 286:	89 f0                	mov    %esi,%eax
+ 288:	0f af c3             	imul   %ebx,%eax
+}
+ 28b:	5b                   	pop    %ebx
+ 28c:	5e                   	pop    %esi
+ 28d:	5d                   	pop    %ebp
+ 28e:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 28f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 294:	83 c2 01             	add    $0x1,%edx
+ 297:	eb c7                	jmp    260 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 299:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 29e:	eb e6                	jmp    286 <atoi+0x53>
+
+000002a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+ 2a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2a8:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ab:	80 f9 20             	cmp    $0x20,%cl
+ 2ae:	75 0b                	jne    2bb <atoo+0x1b>
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	0f b6 0a             	movzbl (%edx),%ecx
+ 2b6:	80 f9 20             	cmp    $0x20,%cl
+ 2b9:	74 f5                	je     2b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2bb:	80 f9 2d             	cmp    $0x2d,%cl
+ 2be:	74 3a                	je     2fa <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 2c0:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2c3:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2c8:	f6 c1 fd             	test   $0xfd,%cl
+ 2cb:	74 32                	je     2ff <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2cd:	0f b6 0a             	movzbl (%edx),%ecx
+ 2d0:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2d3:	80 fb 07             	cmp    $0x7,%bl
+ 2d6:	77 2c                	ja     304 <atoo+0x64>
+ 2d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 2dd:	83 c2 01             	add    $0x1,%edx
+ 2e0:	0f be c9             	movsbl %cl,%ecx
+ 2e3:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 2e7:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ea:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2ed:	3c 07                	cmp    $0x7,%al
+ 2ef:	76 ec                	jbe    2dd <atoo+0x3d>
+  return sign*n;
+ 2f1:	89 f0                	mov    %esi,%eax
+ 2f3:	0f af c3             	imul   %ebx,%eax
+}
+ 2f6:	5b                   	pop    %ebx
+ 2f7:	5e                   	pop    %esi
+ 2f8:	5d                   	pop    %ebp
+ 2f9:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 2fa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2ff:	83 c2 01             	add    $0x1,%edx
+ 302:	eb c9                	jmp    2cd <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 304:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 309:	eb e6                	jmp    2f1 <atoo+0x51>
+
+0000030b <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 30b:	55                   	push   %ebp
+ 30c:	89 e5                	mov    %esp,%ebp
+ 30e:	56                   	push   %esi
+ 30f:	53                   	push   %ebx
+ 310:	8b 75 08             	mov    0x8(%ebp),%esi
+ 313:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 319:	85 db                	test   %ebx,%ebx
+ 31b:	7e 15                	jle    332 <memmove+0x27>
+ 31d:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 31f:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 321:	83 c2 01             	add    $0x1,%edx
+ 324:	83 c0 01             	add    $0x1,%eax
+ 327:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 32b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 32e:	39 c3                	cmp    %eax,%ebx
+ 330:	75 ef                	jne    321 <memmove+0x16>
+  return vdst;
+}
+ 332:	89 f0                	mov    %esi,%eax
+ 334:	5b                   	pop    %ebx
+ 335:	5e                   	pop    %esi
+ 336:	5d                   	pop    %ebp
+ 337:	c3                   	ret
+
+00000338 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 338:	b8 01 00 00 00       	mov    $0x1,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <exit>:
+SYSCALL(exit)
+ 340:	b8 02 00 00 00       	mov    $0x2,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <wait>:
+SYSCALL(wait)
+ 348:	b8 03 00 00 00       	mov    $0x3,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <pipe>:
+SYSCALL(pipe)
+ 350:	b8 04 00 00 00       	mov    $0x4,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <read>:
+SYSCALL(read)
+ 358:	b8 05 00 00 00       	mov    $0x5,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <write>:
+SYSCALL(write)
+ 360:	b8 10 00 00 00       	mov    $0x10,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <close>:
+SYSCALL(close)
+ 368:	b8 15 00 00 00       	mov    $0x15,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <kill>:
+SYSCALL(kill)
+ 370:	b8 06 00 00 00       	mov    $0x6,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <exec>:
+SYSCALL(exec)
+ 378:	b8 07 00 00 00       	mov    $0x7,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <open>:
+SYSCALL(open)
+ 380:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <mknod>:
+SYSCALL(mknod)
+ 388:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <unlink>:
+SYSCALL(unlink)
+ 390:	b8 12 00 00 00       	mov    $0x12,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <fstat>:
+SYSCALL(fstat)
+ 398:	b8 08 00 00 00       	mov    $0x8,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <link>:
+SYSCALL(link)
+ 3a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <mkdir>:
+SYSCALL(mkdir)
+ 3a8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <chdir>:
+SYSCALL(chdir)
+ 3b0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <dup>:
+SYSCALL(dup)
+ 3b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <getpid>:
+SYSCALL(getpid)
+ 3c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <sbrk>:
+SYSCALL(sbrk)
+ 3c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <sleep>:
+SYSCALL(sleep)
+ 3d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <uptime>:
+SYSCALL(uptime)
+ 3d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <halt>:
+SYSCALL(halt)
+ 3e0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <date>:
+SYSCALL(date)
+ 3e8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <getuid>:
+SYSCALL(getuid)
+ 3f0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <getgid>:
+SYSCALL(getgid)
+ 3f8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getppid>:
+SYSCALL(getppid)
+ 400:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <setuid>:
+SYSCALL(setuid)
+ 408:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <setgid>:
+SYSCALL(setgid)
+ 410:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <getprocs>:
+SYSCALL(getprocs)
+ 418:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <setpriority>:
+SYSCALL(setpriority)
+ 420:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <getpriority>:
+SYSCALL(getpriority)
+ 428:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <waitpid>:
+SYSCALL(waitpid)
+ 430:	b8 20 00 00 00       	mov    $0x20,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <setaffinity>:
+SYSCALL(setaffinity)
+ 438:	b8 21 00 00 00       	mov    $0x21,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <getaffinity>:
+SYSCALL(getaffinity)
+ 440:	b8 22 00 00 00       	mov    $0x22,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <setdeadline>:
+SYSCALL(setdeadline)
+ 448:	b8 23 00 00 00       	mov    $0x23,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <schedctl>:
+SYSCALL(schedctl)
+ 450:	b8 24 00 00 00       	mov    $0x24,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <spawn>:
+SYSCALL(spawn)
+ 458:	b8 25 00 00 00       	mov    $0x25,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <vmstats>:
+SYSCALL(vmstats)
+ 460:	b8 26 00 00 00       	mov    $0x26,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 468:	b8 27 00 00 00       	mov    $0x27,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <setshares>:
+SYSCALL(setshares)
+ 470:	b8 28 00 00 00       	mov    $0x28,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <getshares>:
+SYSCALL(getshares)
+ 478:	b8 29 00 00 00       	mov    $0x29,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 3c             	sub    $0x3c,%esp
+ 489:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 48c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 48e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 492:	74 79                	je     50d <printint+0x8d>
+ 494:	85 d2                	test   %edx,%edx
+ 496:	79 75                	jns    50d <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 498:	89 d1                	mov    %edx,%ecx
+ 49a:	f7 d9                	neg    %ecx
+    neg = 1;
+ 49c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4a8:	89 df                	mov    %ebx,%edi
+ 4aa:	83 c3 01             	add    $0x1,%ebx
+ 4ad:	89 c8                	mov    %ecx,%eax
+ 4af:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b4:	f7 f6                	div    %esi
+ 4b6:	0f b6 92 c0 08 00 00 	movzbl 0x8c0(%edx),%edx
+ 4bd:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4c1:	89 ca                	mov    %ecx,%edx
+ 4c3:	89 c1                	mov    %eax,%ecx
+ 4c5:	39 f2                	cmp    %esi,%edx
+ 4c7:	73 df                	jae    4a8 <printint+0x28>
+  if(neg)
+ 4c9:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 4cd:	74 08                	je     4d7 <printint+0x57>
+    buf[i++] = '-';
+ 4cf:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4d4:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 4d7:	85 db                	test   %ebx,%ebx
+ 4d9:	7e 2a                	jle    505 <printint+0x85>
+ 4db:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 4de:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 4e2:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 4e5:	0f b6 03             	movzbl (%ebx),%eax
+ 4e8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4eb:	83 ec 04             	sub    $0x4,%esp
+ 4ee:	6a 01                	push   $0x1
+ 4f0:	57                   	push   %edi
+ 4f1:	ff 75 c4             	push   -0x3c(%ebp)
+ 4f4:	e8 67 fe ff ff       	call   360 <write>
+  while(--i >= 0)
+ 4f9:	89 d8                	mov    %ebx,%eax
+ 4fb:	83 eb 01             	sub    $0x1,%ebx
+ 4fe:	83 c4 10             	add    $0x10,%esp
+ 501:	39 f0                	cmp    %esi,%eax
+ 503:	75 e0                	jne    4e5 <printint+0x65>
+}
+ 505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 508:	5b                   	pop    %ebx
+ 509:	5e                   	pop    %esi
+ 50a:	5f                   	pop    %edi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+    x = xx;
+ 50d:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 50f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 516:	eb 8b                	jmp    4a3 <printint+0x23>
+
+00000518 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 518:	55                   	push   %ebp
+ 519:	89 e5                	mov    %esp,%ebp
+ 51b:	57                   	push   %edi
+ 51c:	56                   	push   %esi
+ 51d:	53                   	push   %ebx
+ 51e:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 521:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 524:	0f b6 1e             	movzbl (%esi),%ebx
+ 527:	84 db                	test   %bl,%bl
+ 529:	0f 84 9e 01 00 00    	je     6cd <printf+0x1b5>
+ 52f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 532:	8d 45 10             	lea    0x10(%ebp),%eax
+ 535:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 538:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53d:	eb 2d                	jmp    56c <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 53f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 542:	83 ec 04             	sub    $0x4,%esp
+ 545:	6a 01                	push   $0x1
+ 547:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54a:	50                   	push   %eax
+ 54b:	ff 75 08             	push   0x8(%ebp)
+ 54e:	e8 0d fe ff ff       	call   360 <write>
+        putc(fd, c);
+ 553:	83 c4 10             	add    $0x10,%esp
+ 556:	eb 05                	jmp    55d <printf+0x45>
+      }
+    } else if(state == '%'){
+ 558:	83 ff 25             	cmp    $0x25,%edi
+ 55b:	74 1f                	je     57c <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 55d:	83 c6 01             	add    $0x1,%esi
+ 560:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 564:	84 db                	test   %bl,%bl
+ 566:	0f 84 61 01 00 00    	je     6cd <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 56c:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 56f:	85 ff                	test   %edi,%edi
+ 571:	75 e5                	jne    558 <printf+0x40>
+      if(c == '%'){
+ 573:	83 f8 25             	cmp    $0x25,%eax
+ 576:	75 c7                	jne    53f <printf+0x27>
+        state = '%';
+ 578:	89 c7                	mov    %eax,%edi
+ 57a:	eb e1                	jmp    55d <printf+0x45>
+      if(c == 'd'){
+ 57c:	83 f8 25             	cmp    $0x25,%eax
+ 57f:	0f 84 f4 00 00 00    	je     679 <printf+0x161>
+ 585:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 588:	83 fa 15             	cmp    $0x15,%edx
+ 58b:	0f 87 09 01 00 00    	ja     69a <printf+0x182>
+ 591:	0f 87 03 01 00 00    	ja     69a <printf+0x182>
+ 597:	ff 24 95 68 08 00 00 	jmp    *0x868(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 59e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5a1:	8b 17                	mov    (%edi),%edx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	6a 01                	push   $0x1
+ 5a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b0:	e8 cb fe ff ff       	call   480 <printint>
+        ap++;
+ 5b5:	83 c7 04             	add    $0x4,%edi
+ 5b8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5bb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5be:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c3:	eb 98                	jmp    55d <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5c5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5c8:	8b 17                	mov    (%edi),%edx
+ 5ca:	83 ec 0c             	sub    $0xc,%esp
+ 5cd:	6a 00                	push   $0x0
+ 5cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d7:	e8 a4 fe ff ff       	call   480 <printint>
+        ap++;
+ 5dc:	83 c7 04             	add    $0x4,%edi
+ 5df:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5e2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ea:	e9 6e ff ff ff       	jmp    55d <printf+0x45>
+        s = (char*)*ap;
+ 5ef:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 5f2:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 5f4:	83 c1 04             	add    $0x4,%ecx
+ 5f7:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 5fa:	85 c0                	test   %eax,%eax
+ 5fc:	74 13                	je     611 <printf+0xf9>
+        s = (char*)*ap;
+ 5fe:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 600:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 603:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 608:	84 c0                	test   %al,%al
+ 60a:	75 0f                	jne    61b <printf+0x103>
+ 60c:	e9 4c ff ff ff       	jmp    55d <printf+0x45>
+          s = "(null)";
+ 611:	bb 60 08 00 00       	mov    $0x860,%ebx
+        while(*s != 0){
+ 616:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 61b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 61e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 621:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 624:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 627:	83 ec 04             	sub    $0x4,%esp
+ 62a:	6a 01                	push   $0x1
+ 62c:	57                   	push   %edi
+ 62d:	56                   	push   %esi
+ 62e:	e8 2d fd ff ff       	call   360 <write>
+          s++;
+ 633:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 636:	0f b6 03             	movzbl (%ebx),%eax
+ 639:	83 c4 10             	add    $0x10,%esp
+ 63c:	84 c0                	test   %al,%al
+ 63e:	75 e4                	jne    624 <printf+0x10c>
+      state = 0;
+ 640:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 643:	bf 00 00 00 00       	mov    $0x0,%edi
+ 648:	e9 10 ff ff ff       	jmp    55d <printf+0x45>
+        putc(fd, *ap);
+ 64d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 650:	8b 07                	mov    (%edi),%eax
+ 652:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	6a 01                	push   $0x1
+ 65a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65d:	50                   	push   %eax
+ 65e:	ff 75 08             	push   0x8(%ebp)
+ 661:	e8 fa fc ff ff       	call   360 <write>
+        ap++;
+ 666:	83 c7 04             	add    $0x4,%edi
+ 669:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 66c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 674:	e9 e4 fe ff ff       	jmp    55d <printf+0x45>
+        putc(fd, c);
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 67c:	83 ec 04             	sub    $0x4,%esp
+ 67f:	6a 01                	push   $0x1
+ 681:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 684:	50                   	push   %eax
+ 685:	ff 75 08             	push   0x8(%ebp)
+ 688:	e8 d3 fc ff ff       	call   360 <write>
+ 68d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 690:	bf 00 00 00 00       	mov    $0x0,%edi
+ 695:	e9 c3 fe ff ff       	jmp    55d <printf+0x45>
+        putc(fd, '%');
+ 69a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 69e:	83 ec 04             	sub    $0x4,%esp
+ 6a1:	6a 01                	push   $0x1
+ 6a3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6a6:	57                   	push   %edi
+ 6a7:	ff 75 08             	push   0x8(%ebp)
+ 6aa:	e8 b1 fc ff ff       	call   360 <write>
+        putc(fd, c);
+ 6af:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b2:	83 c4 0c             	add    $0xc,%esp
+ 6b5:	6a 01                	push   $0x1
+ 6b7:	57                   	push   %edi
+ 6b8:	ff 75 08             	push   0x8(%ebp)
+ 6bb:	e8 a0 fc ff ff       	call   360 <write>
+        putc(fd, c);
+ 6c0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6c8:	e9 90 fe ff ff       	jmp    55d <printf+0x45>
+    }
+  }
+}
+ 6cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d0:	5b                   	pop    %ebx
+ 6d1:	5e                   	pop    %esi
+ 6d2:	5f                   	pop    %edi
+ 6d3:	5d                   	pop    %ebp
+ 6d4:	c3                   	ret
+
+000006d5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6d5:	55                   	push   %ebp
+ 6d6:	89 e5                	mov    %esp,%ebp
+ 6d8:	57                   	push   %edi
+ 6d9:	56                   	push   %esi
+ 6da:	53                   	push   %ebx
+ 6db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e1:	a1 64 0b 00 00       	mov    0xb64,%eax
+ 6e6:	eb 0c                	jmp    6f4 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e8:	8b 10                	mov    (%eax),%edx
+ 6ea:	39 d0                	cmp    %edx,%eax
+ 6ec:	72 04                	jb     6f2 <free+0x1d>
+ 6ee:	39 d1                	cmp    %edx,%ecx
+ 6f0:	72 10                	jb     702 <free+0x2d>
+{
+ 6f2:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f4:	39 c8                	cmp    %ecx,%eax
+ 6f6:	73 f0                	jae    6e8 <free+0x13>
+ 6f8:	8b 10                	mov    (%eax),%edx
+ 6fa:	39 d1                	cmp    %edx,%ecx
+ 6fc:	72 04                	jb     702 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fe:	39 d0                	cmp    %edx,%eax
+ 700:	72 f0                	jb     6f2 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 702:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 705:	8b 10                	mov    (%eax),%edx
+ 707:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 70a:	39 fa                	cmp    %edi,%edx
+ 70c:	74 19                	je     727 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 70e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 711:	8b 50 04             	mov    0x4(%eax),%edx
+ 714:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 717:	39 f1                	cmp    %esi,%ecx
+ 719:	74 18                	je     733 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 71b:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 71d:	a3 64 0b 00 00       	mov    %eax,0xb64
+}
+ 722:	5b                   	pop    %ebx
+ 723:	5e                   	pop    %esi
+ 724:	5f                   	pop    %edi
+ 725:	5d                   	pop    %ebp
+ 726:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 727:	03 72 04             	add    0x4(%edx),%esi
+ 72a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 72d:	8b 10                	mov    (%eax),%edx
+ 72f:	8b 12                	mov    (%edx),%edx
+ 731:	eb db                	jmp    70e <free+0x39>
+    p->s.size += bp->s.size;
+ 733:	03 53 fc             	add    -0x4(%ebx),%edx
+ 736:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 739:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 73c:	eb dd                	jmp    71b <free+0x46>
+
+0000073e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 73e:	55                   	push   %ebp
+ 73f:	89 e5                	mov    %esp,%ebp
+ 741:	57                   	push   %edi
+ 742:	56                   	push   %esi
+ 743:	53                   	push   %ebx
+ 744:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 747:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 74d:	c1 eb 03             	shr    $0x3,%ebx
+ 750:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 753:	8b 15 64 0b 00 00    	mov    0xb64,%edx
+ 759:	85 d2                	test   %edx,%edx
+ 75b:	74 1c                	je     779 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 75d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 75f:	8b 48 04             	mov    0x4(%eax),%ecx
+ 762:	39 d9                	cmp    %ebx,%ecx
+ 764:	73 38                	jae    79e <malloc+0x60>
+  if(nu < 4096)
+ 766:	be 00 10 00 00       	mov    $0x1000,%esi
+ 76b:	39 f3                	cmp    %esi,%ebx
+ 76d:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 770:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 777:	eb 72                	jmp    7eb <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 779:	c7 05 64 0b 00 00 68 	movl   $0xb68,0xb64
+ 780:	0b 00 00 
+ 783:	c7 05 68 0b 00 00 68 	movl   $0xb68,0xb68
+ 78a:	0b 00 00 
+    base.s.size = 0;
+ 78d:	c7 05 6c 0b 00 00 00 	movl   $0x0,0xb6c
+ 794:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 797:	b8 68 0b 00 00       	mov    $0xb68,%eax
+    if(p->s.size >= nunits){
+ 79c:	eb c8                	jmp    766 <malloc+0x28>
+      if(p->s.size == nunits)
+ 79e:	39 cb                	cmp    %ecx,%ebx
+ 7a0:	74 1e                	je     7c0 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7a2:	29 d9                	sub    %ebx,%ecx
+ 7a4:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7a7:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7aa:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7ad:	89 15 64 0b 00 00    	mov    %edx,0xb64
+      return (void*)(p + 1);
+ 7b3:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7b6:	89 d0                	mov    %edx,%eax
+ 7b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7bb:	5b                   	pop    %ebx
+ 7bc:	5e                   	pop    %esi
+ 7bd:	5f                   	pop    %edi
+ 7be:	5d                   	pop    %ebp
+ 7bf:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7c0:	8b 08                	mov    (%eax),%ecx
+ 7c2:	89 0a                	mov    %ecx,(%edx)
+ 7c4:	eb e7                	jmp    7ad <malloc+0x6f>
+  hp->s.size = nu;
+ 7c6:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7c9:	83 ec 0c             	sub    $0xc,%esp
+ 7cc:	83 c0 08             	add    $0x8,%eax
+ 7cf:	50                   	push   %eax
+ 7d0:	e8 00 ff ff ff       	call   6d5 <free>
+  return freep;
+ 7d5:	8b 15 64 0b 00 00    	mov    0xb64,%edx
+      if((p = morecore(nunits)) == 0)
+ 7db:	83 c4 10             	add    $0x10,%esp
+ 7de:	85 d2                	test   %edx,%edx
+ 7e0:	74 d4                	je     7b6 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7e2:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7e4:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e7:	39 d9                	cmp    %ebx,%ecx
+ 7e9:	73 b3                	jae    79e <malloc+0x60>
+    if(p == freep)
+ 7eb:	89 c2                	mov    %eax,%edx
+ 7ed:	39 05 64 0b 00 00    	cmp    %eax,0xb64
+ 7f3:	75 ed                	jne    7e2 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 7f5:	83 ec 0c             	sub    $0xc,%esp
+ 7f8:	57                   	push   %edi
+ 7f9:	e8 ca fb ff ff       	call   3c8 <sbrk>
+  if(p == (char*)-1)
+ 7fe:	83 c4 10             	add    $0x10,%esp
+ 801:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 804:	75 c0                	jne    7c6 <malloc+0x88>
+        return 0;
+ 806:	ba 00 00 00 00       	mov    $0x0,%edx
+ 80b:	eb a9                	jmp    7b6 <malloc+0x78>
@@ -1,6 +1,7 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, or runs of
+// 2^order physically contiguous pages with kallocorder().
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +9,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "vmstats.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,14 +17,31 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;            // Only on the buddy lists
 };
 
+struct kcache {
+  struct run *freelist;
+  int nfree;
+};
+
+// Free memory is kept as blocks of 2^order pages, each aligned to
+// its size, on one list per order.  Allocating splits a larger block
+// in halves as needed; freeing merges a block with its buddy, the
+// other half of the block they were split from, whenever the buddy
+// is free too.
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *free[NKORDER];   // Free blocks of each order
+  uchar order[PHYSTOP/PGSIZE]; // 1 + order of a free block, by its first page
+  struct kcache cache[NCPU];   // Per-CPU free pages; see kallocn()
+  ushort ref[PHYSTOP/PGSIZE];  // References to each page; see kref()
 } kmem;
 
+#define REF(v) (kmem.ref[V2P(v)/PGSIZE])
+#define ORDER(v) (kmem.order[V2P(v)/PGSIZE])
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -48,49 +67,298 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    REF(p) = 1;
     kfree(p);
+  }
 }
-//PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
-void
-kfree(char *v)
+
+//PAGEBREAK: 30
+// Buddy lists.  Caller must hold kmem.lock.
+
+static void
+bpush(char *v, int order)
+{
+  struct run *r;
+
+  r = (struct run*)v;
+  r->prev = 0;
+  r->next = kmem.free[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free[order] = r;
+  ORDER(v) = order + 1;
+}
+
+static void
+bremove(char *v, int order)
 {
   struct run *r;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
-    panic("kfree");
+  r = (struct run*)v;
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  ORDER(v) = 0;
+}
+
+// Take a block of 2^order pages off the lists, splitting a larger
+// one if there is none that size.  Returns 0 if none are left.
+static char*
+balloc(int order)
+{
+  char *v;
+  int o;
+
+  for(o = order; o < NKORDER && kmem.free[o] == 0; o++)
+    ;
+  if(o == NKORDER)
+    return 0;
+  v = (char*)kmem.free[o];
+  bremove(v, o);
+  while(o > order){
+    o--;
+    bpush(v + (PGSIZE << o), o);
+  }
+  return v;
+}
+
+// Put a block of 2^order pages back on the lists, merged with
+// its buddy for as long as the buddy is free.
+static void
+bfree(char *v, int order)
+{
+  char *buddy;
+
+  for(; order < NKORDER - 1; order++){
+    buddy = P2V(V2P(v) ^ (PGSIZE << order));
+    if(buddy < end || V2P(buddy) >= PHYSTOP || ORDER(buddy) != order + 1)
+      break;
+    bremove(buddy, order);
+    if(buddy < v)
+      v = buddy;
+  }
+  bpush(v, order);
+}
+
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  Returns 0 if the memory cannot be allocated.  Free with
+// kfreeorder().
+char*
+kallocorder(int order)
+{
+  char *v;
+
+  if(order < 0 || order >= NKORDER)
+    return 0;
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  v = balloc(order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(v)
+    REF(v) = 1;
+  return v;
+}
+
+// Free the 2^order pages at v, which should have been returned by
+// kallocorder(order).
+void
+kfreeorder(char *v, int order)
+{
+  if((uint)v % (PGSIZE << order) || v < end || V2P(v) >= PHYSTOP)
+    panic("kfreeorder");
+  if(REF(v) != 1)
+    panic("kfreeorder: ref");
+  REF(v) = 0;
 
   // Fill with junk to catch dangling refs.
-  memset(v, 1, PGSIZE);
+  memset(v, 1, PGSIZE << order);
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
+  bfree(v, order);
   if(kmem.use_lock)
     release(&kmem.lock);
 }
 
+//PAGEBREAK: 21
+// Each CPU keeps a cache of free pages, so that most calls to
+// kalloc() and kfree() need not take kmem.lock.  A CPU refills its
+// cache from the buddy lists, and drains it back there, KBATCH pages
+// at a time.  The caches are only used once kinit2() has started
+// the other CPUs; before that there are only the buddy lists.
+
+// Move up to n (at least KBATCH) pages from the buddy lists to c.
+static void
+krefill(struct kcache *c, int n)
+{
+  struct run *r;
+
+  if(n < KBATCH)
+    n = KBATCH;
+  acquire(&kmem.lock);
+  for(; n > 0 && (r = (struct run*)balloc(0)) != 0; n--){
+    r->next = c->freelist;
+    c->freelist = r;
+    c->nfree++;
+  }
+  release(&kmem.lock);
+}
+
+// Move KBATCH pages from c back to the buddy lists.
+static void
+kdrain(struct kcache *c)
+{
+  struct run *r;
+  int n;
+
+  acquire(&kmem.lock);
+  for(n = 0; n < KBATCH; n++){
+    r = c->freelist;
+    c->freelist = r->next;
+    c->nfree--;
+    bfree((char*)r, 0);
+  }
+  release(&kmem.lock);
+}
+
+// Drop a reference to each of the n pages of physical memory
+// in pv, which normally should have been returned by calls
+// to kalloc(), and free those with none left.
+// (The exception is when initializing the allocator;
+// see kinit above.)
+void
+kfreen(char **pv, int n)
+{
+  struct kcache *c;
+  struct run *r;
+  char *v;
+  int i, ref;
+
+  if(kmem.use_lock){
+    pushcli();
+    c = &kmem.cache[cpuid()];
+  } else
+    c = 0;
+  for(i = 0; i < n; i++){
+    v = pv[i];
+    if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+      panic("kfree");
+    if((ref = __sync_fetch_and_sub(&REF(v), 1)) == 0)
+      panic("kfree: free page");
+    if(ref > 1)
+      continue;
+
+    // Fill with junk to catch dangling refs.
+    memset(v, 1, PGSIZE);
+
+    if(c == 0){
+      bfree(v, 0);
+      continue;
+    }
+    r = (struct run*)v;
+    r->next = c->freelist;
+    c->freelist = r;
+    if(++c->nfree >= 2*KBATCH)
+      kdrain(c);
+  }
+  if(c)
+    popcli();
+}
+
+// Free the page of physical memory pointed at by v; see kfreen().
+void
+kfree(char *v)
+{
+  kfreen(&v, 1);
+}
+
+// Allocate n 4096-byte pages of physical memory, into pv.
+// Returns the number allocated, which is less than n only if
+// memory ran out.
+int
+kallocn(char **pv, int n)
+{
+  struct kcache *c;
+  struct run *r;
+  int i;
+
+  if(kmem.use_lock){
+    pushcli();
+    c = &kmem.cache[cpuid()];
+  } else
+    c = 0;
+  for(i = 0; i < n; i++){
+    if(c == 0){
+      if((r = (struct run*)balloc(0)) == 0)
+        break;
+    } else {
+      if(c->freelist == 0)
+        krefill(c, n - i);
+      if((r = c->freelist) == 0)
+        break;
+      c->freelist = r->next;
+      c->nfree--;
+    }
+    REF(r) = 1;
+    pv[i] = (char*)r;
+  }
+  if(c)
+    popcli();
+  return i;
+}
+
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
 char*
 kalloc(void)
 {
-  struct run *r;
+  char *v;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  return (char*)r;
+  if(kallocn(&v, 1) == 0)
+    return 0;
+  return v;
 }
 
+// Add a reference to the allocated page v, for a page shared
+// copy-on-write.  Each reference is dropped with kfree().
+void
+kref(char *v)
+{
+  if(__sync_fetch_and_add(&REF(v), 1) == 0)
+    panic("kref");
+}
+
+// Number of references to the allocated page v.
+int
+krefs(char *v)
+{
+  return REF(v);
+}
+
+// Fill in the free memory counts of vs: free blocks of each order,
+// and pages sitting in the per-CPU caches.
+void
+kmemstats(struct vmstats *vs)
+{
+  struct run *r;
+  int o, i;
+
+  acquire(&kmem.lock);
+  vs->freepages = 0;
+  for(o = 0; o < NKORDER; o++){
+    vs->freeblocks[o] = 0;
+    for(r = kmem.free[o]; r; r = r->next)
+      vs->freeblocks[o]++;
+    vs->freepages += vs->freeblocks[o] << o;
+  }
+  release(&kmem.lock);
+  vs->cachedpages = 0;
+  for(i = 0; i < NCPU; i++)
+    vs->cachedpages += kmem.cache[i].nfree;
+}
@@ -0,0 +1,21766 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 d0 10 00       	mov    $0x10d000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc d0 f3 15 80       	mov    $0x8015f3d0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 16 32 10 80       	mov    $0x80103216,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+
+80100034 <binit>:
+  struct buf head;
+} bcache;
+
+void
+binit(void)
+{
+80100034:	55                   	push   %ebp
+80100035:	89 e5                	mov    %esp,%ebp
+80100037:	53                   	push   %ebx
+80100038:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *b;
+
+  initlock(&bcache.lock, "bcache");
+8010003b:	68 60 ad 10 80       	push   $0x8010ad60
+80100040:	68 20 e5 10 80       	push   $0x8010e520
+80100045:	e8 1a 74 00 00       	call   80107464 <initlock>
+
+//PAGEBREAK!
+  // Create linked list of buffers
+  bcache.head.prev = &bcache.head;
+8010004a:	c7 05 6c 2c 11 80 1c 	movl   $0x80112c1c,0x80112c6c
+80100051:	2c 11 80 
+  bcache.head.next = &bcache.head;
+80100054:	c7 05 70 2c 11 80 1c 	movl   $0x80112c1c,0x80112c70
+8010005b:	2c 11 80 
+8010005e:	83 c4 10             	add    $0x10,%esp
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100061:	bb 54 e5 10 80       	mov    $0x8010e554,%ebx
+    b->next = bcache.head.next;
+80100066:	a1 70 2c 11 80       	mov    0x80112c70,%eax
+8010006b:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+8010006e:	c7 43 50 1c 2c 11 80 	movl   $0x80112c1c,0x50(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100075:	83 ec 08             	sub    $0x8,%esp
+80100078:	68 67 ad 10 80       	push   $0x8010ad67
+8010007d:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100080:	50                   	push   %eax
+80100081:	e8 f7 72 00 00       	call   8010737d <initsleeplock>
+    bcache.head.next->prev = b;
+80100086:	a1 70 2c 11 80       	mov    0x80112c70,%eax
+8010008b:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+8010008e:	89 1d 70 2c 11 80    	mov    %ebx,0x80112c70
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100094:	81 c3 5c 02 00 00    	add    $0x25c,%ebx
+8010009a:	83 c4 10             	add    $0x10,%esp
+8010009d:	81 fb 1c 2c 11 80    	cmp    $0x80112c1c,%ebx
+801000a3:	75 c1                	jne    80100066 <binit+0x32>
+  }
+}
+801000a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801000a8:	c9                   	leave
+801000a9:	c3                   	ret
+
+801000aa <bread>:
+}
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801000aa:	55                   	push   %ebp
+801000ab:	89 e5                	mov    %esp,%ebp
+801000ad:	57                   	push   %edi
+801000ae:	56                   	push   %esi
+801000af:	53                   	push   %ebx
+801000b0:	83 ec 18             	sub    $0x18,%esp
+801000b3:	8b 75 08             	mov    0x8(%ebp),%esi
+801000b6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  acquire(&bcache.lock);
+801000b9:	68 20 e5 10 80       	push   $0x8010e520
+801000be:	e8 ec 74 00 00       	call   801075af <acquire>
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+801000c3:	8b 1d 70 2c 11 80    	mov    0x80112c70,%ebx
+801000c9:	83 c4 10             	add    $0x10,%esp
+801000cc:	81 fb 1c 2c 11 80    	cmp    $0x80112c1c,%ebx
+801000d2:	75 26                	jne    801000fa <bread+0x50>
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+801000d4:	8b 1d 6c 2c 11 80    	mov    0x80112c6c,%ebx
+801000da:	81 fb 1c 2c 11 80    	cmp    $0x80112c1c,%ebx
+801000e0:	75 4e                	jne    80100130 <bread+0x86>
+  panic("bget: no buffers");
+801000e2:	83 ec 0c             	sub    $0xc,%esp
+801000e5:	68 6e ad 10 80       	push   $0x8010ad6e
+801000ea:	e8 53 02 00 00       	call   80100342 <panic>
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+801000ef:	8b 5b 54             	mov    0x54(%ebx),%ebx
+801000f2:	81 fb 1c 2c 11 80    	cmp    $0x80112c1c,%ebx
+801000f8:	74 da                	je     801000d4 <bread+0x2a>
+    if(b->dev == dev && b->blockno == blockno){
+801000fa:	3b 73 04             	cmp    0x4(%ebx),%esi
+801000fd:	75 f0                	jne    801000ef <bread+0x45>
+801000ff:	3b 7b 08             	cmp    0x8(%ebx),%edi
+80100102:	75 eb                	jne    801000ef <bread+0x45>
+      b->refcnt++;
+80100104:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+80100108:	83 ec 0c             	sub    $0xc,%esp
+8010010b:	68 20 e5 10 80       	push   $0x8010e520
+80100110:	e8 01 75 00 00       	call   80107616 <release>
+      acquiresleep(&b->lock);
+80100115:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100118:	89 04 24             	mov    %eax,(%esp)
+8010011b:	e8 90 72 00 00       	call   801073b0 <acquiresleep>
+      return b;
+80100120:	83 c4 10             	add    $0x10,%esp
+80100123:	eb 44                	jmp    80100169 <bread+0xbf>
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+80100125:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100128:	81 fb 1c 2c 11 80    	cmp    $0x80112c1c,%ebx
+8010012e:	74 b2                	je     801000e2 <bread+0x38>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+80100130:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+80100134:	75 ef                	jne    80100125 <bread+0x7b>
+80100136:	f6 03 04             	testb  $0x4,(%ebx)
+80100139:	75 ea                	jne    80100125 <bread+0x7b>
+      b->dev = dev;
+8010013b:	89 73 04             	mov    %esi,0x4(%ebx)
+      b->blockno = blockno;
+8010013e:	89 7b 08             	mov    %edi,0x8(%ebx)
+      b->flags = 0;
+80100141:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      b->refcnt = 1;
+80100147:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+8010014e:	83 ec 0c             	sub    $0xc,%esp
+80100151:	68 20 e5 10 80       	push   $0x8010e520
+80100156:	e8 bb 74 00 00       	call   80107616 <release>
+      acquiresleep(&b->lock);
+8010015b:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010015e:	89 04 24             	mov    %eax,(%esp)
+80100161:	e8 4a 72 00 00       	call   801073b0 <acquiresleep>
+      return b;
+80100166:	83 c4 10             	add    $0x10,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0) {
+80100169:	f6 03 02             	testb  $0x2,(%ebx)
+8010016c:	74 0a                	je     80100178 <bread+0xce>
+    iderw(b);
+  }
+  return b;
+}
+8010016e:	89 d8                	mov    %ebx,%eax
+80100170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100173:	5b                   	pop    %ebx
+80100174:	5e                   	pop    %esi
+80100175:	5f                   	pop    %edi
+80100176:	5d                   	pop    %ebp
+80100177:	c3                   	ret
+    iderw(b);
+80100178:	83 ec 0c             	sub    $0xc,%esp
+8010017b:	53                   	push   %ebx
+8010017c:	e8 c4 1e 00 00       	call   80102045 <iderw>
+80100181:	83 c4 10             	add    $0x10,%esp
+  return b;
+80100184:	eb e8                	jmp    8010016e <bread+0xc4>
+
+80100186 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+80100186:	55                   	push   %ebp
+80100187:	89 e5                	mov    %esp,%ebp
+80100189:	53                   	push   %ebx
+8010018a:	83 ec 10             	sub    $0x10,%esp
+8010018d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100190:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100193:	50                   	push   %eax
+80100194:	e8 a4 72 00 00       	call   8010743d <holdingsleep>
+80100199:	83 c4 10             	add    $0x10,%esp
+8010019c:	85 c0                	test   %eax,%eax
+8010019e:	74 14                	je     801001b4 <bwrite+0x2e>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801001a0:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+801001a3:	83 ec 0c             	sub    $0xc,%esp
+801001a6:	53                   	push   %ebx
+801001a7:	e8 99 1e 00 00       	call   80102045 <iderw>
+}
+801001ac:	83 c4 10             	add    $0x10,%esp
+801001af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001b2:	c9                   	leave
+801001b3:	c3                   	ret
+    panic("bwrite");
+801001b4:	83 ec 0c             	sub    $0xc,%esp
+801001b7:	68 7f ad 10 80       	push   $0x8010ad7f
+801001bc:	e8 81 01 00 00       	call   80100342 <panic>
+
+801001c1 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+801001c1:	55                   	push   %ebp
+801001c2:	89 e5                	mov    %esp,%ebp
+801001c4:	56                   	push   %esi
+801001c5:	53                   	push   %ebx
+801001c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001c9:	8d 73 0c             	lea    0xc(%ebx),%esi
+801001cc:	83 ec 0c             	sub    $0xc,%esp
+801001cf:	56                   	push   %esi
+801001d0:	e8 68 72 00 00       	call   8010743d <holdingsleep>
+801001d5:	83 c4 10             	add    $0x10,%esp
+801001d8:	85 c0                	test   %eax,%eax
+801001da:	74 68                	je     80100244 <brelse+0x83>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+801001dc:	83 ec 0c             	sub    $0xc,%esp
+801001df:	56                   	push   %esi
+801001e0:	e8 1d 72 00 00       	call   80107402 <releasesleep>
+
+  acquire(&bcache.lock);
+801001e5:	c7 04 24 20 e5 10 80 	movl   $0x8010e520,(%esp)
+801001ec:	e8 be 73 00 00       	call   801075af <acquire>
+  b->refcnt--;
+801001f1:	8b 43 4c             	mov    0x4c(%ebx),%eax
+801001f4:	83 e8 01             	sub    $0x1,%eax
+801001f7:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+801001fa:	83 c4 10             	add    $0x10,%esp
+801001fd:	85 c0                	test   %eax,%eax
+801001ff:	75 2c                	jne    8010022d <brelse+0x6c>
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+80100201:	8b 53 54             	mov    0x54(%ebx),%edx
+80100204:	8b 43 50             	mov    0x50(%ebx),%eax
+80100207:	89 42 50             	mov    %eax,0x50(%edx)
+    b->prev->next = b->next;
+8010020a:	8b 53 54             	mov    0x54(%ebx),%edx
+8010020d:	89 50 54             	mov    %edx,0x54(%eax)
+    b->next = bcache.head.next;
+80100210:	a1 70 2c 11 80       	mov    0x80112c70,%eax
+80100215:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+80100218:	c7 43 50 1c 2c 11 80 	movl   $0x80112c1c,0x50(%ebx)
+    bcache.head.next->prev = b;
+8010021f:	a1 70 2c 11 80       	mov    0x80112c70,%eax
+80100224:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+80100227:	89 1d 70 2c 11 80    	mov    %ebx,0x80112c70
+  }
+  
+  release(&bcache.lock);
+8010022d:	83 ec 0c             	sub    $0xc,%esp
+80100230:	68 20 e5 10 80       	push   $0x8010e520
+80100235:	e8 dc 73 00 00       	call   80107616 <release>
+}
+8010023a:	83 c4 10             	add    $0x10,%esp
+8010023d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100240:	5b                   	pop    %ebx
+80100241:	5e                   	pop    %esi
+80100242:	5d                   	pop    %ebp
+80100243:	c3                   	ret
+    panic("brelse");
+80100244:	83 ec 0c             	sub    $0xc,%esp
+80100247:	68 86 ad 10 80       	push   $0x8010ad86
+8010024c:	e8 f1 00 00 00       	call   80100342 <panic>
+
+80100251 <consoleread>:
+#endif
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100251:	55                   	push   %ebp
+80100252:	89 e5                	mov    %esp,%ebp
+80100254:	57                   	push   %edi
+80100255:	56                   	push   %esi
+80100256:	53                   	push   %ebx
+80100257:	83 ec 28             	sub    $0x28,%esp
+8010025a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010025d:	8b 75 10             	mov    0x10(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+80100260:	ff 75 08             	push   0x8(%ebp)
+80100263:	e8 82 14 00 00       	call   801016ea <iunlock>
+  target = n;
+80100268:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  acquire(&cons.lock);
+8010026b:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+80100272:	e8 38 73 00 00       	call   801075af <acquire>
+  while(n > 0){
+80100277:	83 c4 10             	add    $0x10,%esp
+    while(input.r == input.w){
+8010027a:	bb 80 2e 11 80       	mov    $0x80112e80,%ebx
+  while(n > 0){
+8010027f:	85 f6                	test   %esi,%esi
+80100281:	7e 67                	jle    801002ea <consoleread+0x99>
+    while(input.r == input.w){
+80100283:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80100289:	3b 83 84 00 00 00    	cmp    0x84(%ebx),%eax
+8010028f:	75 2e                	jne    801002bf <consoleread+0x6e>
+      if(myproc()->killed){
+80100291:	e8 22 45 00 00       	call   801047b8 <myproc>
+80100296:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+8010029a:	75 70                	jne    8010030c <consoleread+0xbb>
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+8010029c:	83 ec 08             	sub    $0x8,%esp
+8010029f:	68 20 2f 11 80       	push   $0x80112f20
+801002a4:	68 00 2f 11 80       	push   $0x80112f00
+801002a9:	e8 6d 48 00 00       	call   80104b1b <sleep>
+    while(input.r == input.w){
+801002ae:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801002b4:	83 c4 10             	add    $0x10,%esp
+801002b7:	3b 83 84 00 00 00    	cmp    0x84(%ebx),%eax
+801002bd:	74 d2                	je     80100291 <consoleread+0x40>
+    }
+    c = input.buf[input.r++ % INPUT_BUF];
+801002bf:	8d 50 01             	lea    0x1(%eax),%edx
+801002c2:	89 15 00 2f 11 80    	mov    %edx,0x80112f00
+801002c8:	89 c2                	mov    %eax,%edx
+801002ca:	83 e2 7f             	and    $0x7f,%edx
+801002cd:	0f b6 92 80 2e 11 80 	movzbl -0x7feed180(%edx),%edx
+801002d4:	0f be ca             	movsbl %dl,%ecx
+    if(c == C('D')){  // EOF
+801002d7:	80 fa 04             	cmp    $0x4,%dl
+801002da:	74 58                	je     80100334 <consoleread+0xe3>
+        // caller gets a 0-byte result.
+        input.r--;
+      }
+      break;
+    }
+    *dst++ = c;
+801002dc:	83 c7 01             	add    $0x1,%edi
+801002df:	88 57 ff             	mov    %dl,-0x1(%edi)
+    --n;
+801002e2:	83 ee 01             	sub    $0x1,%esi
+    if(c == '\n')
+801002e5:	83 f9 0a             	cmp    $0xa,%ecx
+801002e8:	75 95                	jne    8010027f <consoleread+0x2e>
+      break;
+  }
+  release(&cons.lock);
+801002ea:	83 ec 0c             	sub    $0xc,%esp
+801002ed:	68 20 2f 11 80       	push   $0x80112f20
+801002f2:	e8 1f 73 00 00       	call   80107616 <release>
+  ilock(ip);
+801002f7:	83 c4 04             	add    $0x4,%esp
+801002fa:	ff 75 08             	push   0x8(%ebp)
+801002fd:	e8 26 13 00 00       	call   80101628 <ilock>
+
+  return target - n;
+80100302:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100305:	29 f0                	sub    %esi,%eax
+80100307:	83 c4 10             	add    $0x10,%esp
+8010030a:	eb 20                	jmp    8010032c <consoleread+0xdb>
+        release(&cons.lock);
+8010030c:	83 ec 0c             	sub    $0xc,%esp
+8010030f:	68 20 2f 11 80       	push   $0x80112f20
+80100314:	e8 fd 72 00 00       	call   80107616 <release>
+        ilock(ip);
+80100319:	83 c4 04             	add    $0x4,%esp
+8010031c:	ff 75 08             	push   0x8(%ebp)
+8010031f:	e8 04 13 00 00       	call   80101628 <ilock>
+        return -1;
+80100324:	83 c4 10             	add    $0x10,%esp
+80100327:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010032c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010032f:	5b                   	pop    %ebx
+80100330:	5e                   	pop    %esi
+80100331:	5f                   	pop    %edi
+80100332:	5d                   	pop    %ebp
+80100333:	c3                   	ret
+      if(n < target){
+80100334:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80100337:	39 ce                	cmp    %ecx,%esi
+80100339:	73 af                	jae    801002ea <consoleread+0x99>
+        input.r--;
+8010033b:	a3 00 2f 11 80       	mov    %eax,0x80112f00
+80100340:	eb a8                	jmp    801002ea <consoleread+0x99>
+
+80100342 <panic>:
+{
+80100342:	55                   	push   %ebp
+80100343:	89 e5                	mov    %esp,%ebp
+80100345:	56                   	push   %esi
+80100346:	53                   	push   %ebx
+80100347:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+8010034a:	fa                   	cli
+  cons.locking = 0;
+8010034b:	c7 05 54 2f 11 80 00 	movl   $0x0,0x80112f54
+80100352:	00 00 00 
+  cprintf("lapicid %d: panic: ", lapicid());
+80100355:	e8 a2 27 00 00       	call   80102afc <lapicid>
+8010035a:	83 ec 08             	sub    $0x8,%esp
+8010035d:	50                   	push   %eax
+8010035e:	68 8d ad 10 80       	push   $0x8010ad8d
+80100363:	e8 9c 02 00 00       	call   80100604 <cprintf>
+  cprintf(s);
+80100368:	83 c4 04             	add    $0x4,%esp
+8010036b:	ff 75 08             	push   0x8(%ebp)
+8010036e:	e8 91 02 00 00       	call   80100604 <cprintf>
+  cprintf("\n");
+80100373:	c7 04 24 a9 b4 10 80 	movl   $0x8010b4a9,(%esp)
+8010037a:	e8 85 02 00 00       	call   80100604 <cprintf>
+  getcallerpcs(&s, pcs);
+8010037f:	83 c4 08             	add    $0x8,%esp
+80100382:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100385:	53                   	push   %ebx
+80100386:	8d 45 08             	lea    0x8(%ebp),%eax
+80100389:	50                   	push   %eax
+8010038a:	e8 f0 70 00 00       	call   8010747f <getcallerpcs>
+  for(i=0; i<10; i++)
+8010038f:	8d 75 f8             	lea    -0x8(%ebp),%esi
+80100392:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+80100395:	83 ec 08             	sub    $0x8,%esp
+80100398:	ff 33                	push   (%ebx)
+8010039a:	68 a1 ad 10 80       	push   $0x8010ada1
+8010039f:	e8 60 02 00 00       	call   80100604 <cprintf>
+  for(i=0; i<10; i++)
+801003a4:	83 c3 04             	add    $0x4,%ebx
+801003a7:	83 c4 10             	add    $0x10,%esp
+801003aa:	39 f3                	cmp    %esi,%ebx
+801003ac:	75 e7                	jne    80100395 <panic+0x53>
+  panicked = 1; // freeze other CPU
+801003ae:	c7 05 58 2f 11 80 01 	movl   $0x1,0x80112f58
+801003b5:	00 00 00 
+  for(;;)
+801003b8:	eb fe                	jmp    801003b8 <panic+0x76>
+
+801003ba <consputc>:
+  if(panicked){
+801003ba:	83 3d 58 2f 11 80 00 	cmpl   $0x0,0x80112f58
+801003c1:	74 03                	je     801003c6 <consputc+0xc>
+801003c3:	fa                   	cli
+    for(;;)
+801003c4:	eb fe                	jmp    801003c4 <consputc+0xa>
+{
+801003c6:	55                   	push   %ebp
+801003c7:	89 e5                	mov    %esp,%ebp
+801003c9:	57                   	push   %edi
+801003ca:	56                   	push   %esi
+801003cb:	53                   	push   %ebx
+801003cc:	83 ec 0c             	sub    $0xc,%esp
+801003cf:	89 c3                	mov    %eax,%ebx
+  if(c == BACKSPACE){
+801003d1:	3d 00 01 00 00       	cmp    $0x100,%eax
+801003d6:	0f 84 ae 00 00 00    	je     8010048a <consputc+0xd0>
+    uartputc(c);
+801003dc:	83 ec 0c             	sub    $0xc,%esp
+801003df:	50                   	push   %eax
+801003e0:	e8 06 8d 00 00       	call   801090eb <uartputc>
+801003e5:	83 c4 10             	add    $0x10,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801003e8:	bf d4 03 00 00       	mov    $0x3d4,%edi
+801003ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+801003f2:	89 fa                	mov    %edi,%edx
+801003f4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801003f5:	be d5 03 00 00       	mov    $0x3d5,%esi
+801003fa:	89 f2                	mov    %esi,%edx
+801003fc:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+801003fd:	0f b6 c8             	movzbl %al,%ecx
+80100400:	c1 e1 08             	shl    $0x8,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100403:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100408:	89 fa                	mov    %edi,%edx
+8010040a:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010040b:	89 f2                	mov    %esi,%edx
+8010040d:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+8010040e:	0f b6 c0             	movzbl %al,%eax
+80100411:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+80100413:	83 fb 0a             	cmp    $0xa,%ebx
+80100416:	0f 84 98 00 00 00    	je     801004b4 <consputc+0xfa>
+  else if(c == BACKSPACE){
+8010041c:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+80100422:	0f 84 a4 00 00 00    	je     801004cc <consputc+0x112>
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100428:	8d 70 01             	lea    0x1(%eax),%esi
+8010042b:	0f b6 db             	movzbl %bl,%ebx
+8010042e:	80 cf 07             	or     $0x7,%bh
+80100431:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+80100438:	80 
+  if(pos < 0 || pos > 25*80)
+80100439:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010043f:	0f 87 94 00 00 00    	ja     801004d9 <consputc+0x11f>
+  if((pos/80) >= 24){  // Scroll up.
+80100445:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+8010044b:	0f 8f 95 00 00 00    	jg     801004e6 <consputc+0x12c>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100451:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100456:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010045b:	89 da                	mov    %ebx,%edx
+8010045d:	ee                   	out    %al,(%dx)
+  outb(CRTPORT+1, pos>>8);
+8010045e:	89 f0                	mov    %esi,%eax
+80100460:	c1 f8 08             	sar    $0x8,%eax
+80100463:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100468:	89 ca                	mov    %ecx,%edx
+8010046a:	ee                   	out    %al,(%dx)
+8010046b:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100470:	89 da                	mov    %ebx,%edx
+80100472:	ee                   	out    %al,(%dx)
+80100473:	89 f0                	mov    %esi,%eax
+80100475:	89 ca                	mov    %ecx,%edx
+80100477:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100478:	66 c7 84 36 00 80 0b 	movw   $0x720,-0x7ff48000(%esi,%esi,1)
+8010047f:	80 20 07 
+}
+80100482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100485:	5b                   	pop    %ebx
+80100486:	5e                   	pop    %esi
+80100487:	5f                   	pop    %edi
+80100488:	5d                   	pop    %ebp
+80100489:	c3                   	ret
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+8010048a:	83 ec 0c             	sub    $0xc,%esp
+8010048d:	6a 08                	push   $0x8
+8010048f:	e8 57 8c 00 00       	call   801090eb <uartputc>
+80100494:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+8010049b:	e8 4b 8c 00 00       	call   801090eb <uartputc>
+801004a0:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+801004a7:	e8 3f 8c 00 00       	call   801090eb <uartputc>
+801004ac:	83 c4 10             	add    $0x10,%esp
+801004af:	e9 34 ff ff ff       	jmp    801003e8 <consputc+0x2e>
+    pos += 80 - pos%80;
+801004b4:	ba 67 66 66 66       	mov    $0x66666667,%edx
+801004b9:	f7 ea                	imul   %edx
+801004bb:	c1 fa 05             	sar    $0x5,%edx
+801004be:	8d 04 92             	lea    (%edx,%edx,4),%eax
+801004c1:	c1 e0 04             	shl    $0x4,%eax
+801004c4:	8d 70 50             	lea    0x50(%eax),%esi
+801004c7:	e9 6d ff ff ff       	jmp    80100439 <consputc+0x7f>
+    if(pos > 0) --pos;
+801004cc:	83 f8 01             	cmp    $0x1,%eax
+801004cf:	83 d0 ff             	adc    $0xffffffff,%eax
+801004d2:	89 c6                	mov    %eax,%esi
+801004d4:	e9 60 ff ff ff       	jmp    80100439 <consputc+0x7f>
+    panic("pos under/overflow");
+801004d9:	83 ec 0c             	sub    $0xc,%esp
+801004dc:	68 a5 ad 10 80       	push   $0x8010ada5
+801004e1:	e8 5c fe ff ff       	call   80100342 <panic>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+801004e6:	83 ec 04             	sub    $0x4,%esp
+801004e9:	68 60 0e 00 00       	push   $0xe60
+801004ee:	68 a0 80 0b 80       	push   $0x800b80a0
+801004f3:	68 00 80 0b 80       	push   $0x800b8000
+801004f8:	e8 d7 71 00 00       	call   801076d4 <memmove>
+    pos -= 80;
+801004fd:	83 ee 50             	sub    $0x50,%esi
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100500:	83 c4 0c             	add    $0xc,%esp
+80100503:	b8 80 07 00 00       	mov    $0x780,%eax
+80100508:	29 f0                	sub    %esi,%eax
+8010050a:	01 c0                	add    %eax,%eax
+8010050c:	50                   	push   %eax
+8010050d:	6a 00                	push   $0x0
+8010050f:	8d 84 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%eax
+80100516:	50                   	push   %eax
+80100517:	e8 41 71 00 00       	call   8010765d <memset>
+8010051c:	83 c4 10             	add    $0x10,%esp
+8010051f:	e9 2d ff ff ff       	jmp    80100451 <consputc+0x97>
+
+80100524 <printint>:
+{
+80100524:	55                   	push   %ebp
+80100525:	89 e5                	mov    %esp,%ebp
+80100527:	57                   	push   %edi
+80100528:	56                   	push   %esi
+80100529:	53                   	push   %ebx
+8010052a:	83 ec 2c             	sub    $0x2c,%esp
+8010052d:	89 d3                	mov    %edx,%ebx
+  if(sign && (sign = xx < 0))
+8010052f:	85 c9                	test   %ecx,%ecx
+80100531:	74 04                	je     80100537 <printint+0x13>
+80100533:	85 c0                	test   %eax,%eax
+80100535:	78 61                	js     80100598 <printint+0x74>
+    x = xx;
+80100537:	89 c1                	mov    %eax,%ecx
+80100539:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  i = 0;
+80100540:	bf 00 00 00 00       	mov    $0x0,%edi
+    buf[i++] = digits[x % base];
+80100545:	89 fe                	mov    %edi,%esi
+80100547:	83 c7 01             	add    $0x1,%edi
+8010054a:	89 c8                	mov    %ecx,%eax
+8010054c:	ba 00 00 00 00       	mov    $0x0,%edx
+80100551:	f7 f3                	div    %ebx
+80100553:	0f b6 92 24 ae 10 80 	movzbl -0x7fef51dc(%edx),%edx
+8010055a:	88 54 3d d7          	mov    %dl,-0x29(%ebp,%edi,1)
+  }while((x /= base) != 0);
+8010055e:	89 ca                	mov    %ecx,%edx
+80100560:	89 c1                	mov    %eax,%ecx
+80100562:	39 da                	cmp    %ebx,%edx
+80100564:	73 df                	jae    80100545 <printint+0x21>
+  if(sign)
+80100566:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+8010056a:	74 08                	je     80100574 <printint+0x50>
+    buf[i++] = '-';
+8010056c:	c6 44 3d d8 2d       	movb   $0x2d,-0x28(%ebp,%edi,1)
+80100571:	8d 7e 02             	lea    0x2(%esi),%edi
+  while(--i >= 0)
+80100574:	85 ff                	test   %edi,%edi
+80100576:	7e 18                	jle    80100590 <printint+0x6c>
+80100578:	8d 75 d8             	lea    -0x28(%ebp),%esi
+8010057b:	8d 5c 3d d7          	lea    -0x29(%ebp,%edi,1),%ebx
+    consputc(buf[i]);
+8010057f:	0f be 03             	movsbl (%ebx),%eax
+80100582:	e8 33 fe ff ff       	call   801003ba <consputc>
+  while(--i >= 0)
+80100587:	89 d8                	mov    %ebx,%eax
+80100589:	83 eb 01             	sub    $0x1,%ebx
+8010058c:	39 f0                	cmp    %esi,%eax
+8010058e:	75 ef                	jne    8010057f <printint+0x5b>
+}
+80100590:	83 c4 2c             	add    $0x2c,%esp
+80100593:	5b                   	pop    %ebx
+80100594:	5e                   	pop    %esi
+80100595:	5f                   	pop    %edi
+80100596:	5d                   	pop    %ebp
+80100597:	c3                   	ret
+    x = -xx;
+80100598:	f7 d8                	neg    %eax
+8010059a:	89 c1                	mov    %eax,%ecx
+  if(sign && (sign = xx < 0))
+8010059c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    x = -xx;
+801005a3:	eb 9b                	jmp    80100540 <printint+0x1c>
+
+801005a5 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+801005a5:	55                   	push   %ebp
+801005a6:	89 e5                	mov    %esp,%ebp
+801005a8:	57                   	push   %edi
+801005a9:	56                   	push   %esi
+801005aa:	53                   	push   %ebx
+801005ab:	83 ec 18             	sub    $0x18,%esp
+801005ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+801005b1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  iunlock(ip);
+801005b4:	ff 75 08             	push   0x8(%ebp)
+801005b7:	e8 2e 11 00 00       	call   801016ea <iunlock>
+  acquire(&cons.lock);
+801005bc:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+801005c3:	e8 e7 6f 00 00       	call   801075af <acquire>
+  for(i = 0; i < n; i++)
+801005c8:	83 c4 10             	add    $0x10,%esp
+801005cb:	85 ff                	test   %edi,%edi
+801005cd:	7e 13                	jle    801005e2 <consolewrite+0x3d>
+801005cf:	89 f3                	mov    %esi,%ebx
+801005d1:	01 fe                	add    %edi,%esi
+    consputc(buf[i] & 0xff);
+801005d3:	0f b6 03             	movzbl (%ebx),%eax
+801005d6:	e8 df fd ff ff       	call   801003ba <consputc>
+  for(i = 0; i < n; i++)
+801005db:	83 c3 01             	add    $0x1,%ebx
+801005de:	39 f3                	cmp    %esi,%ebx
+801005e0:	75 f1                	jne    801005d3 <consolewrite+0x2e>
+  release(&cons.lock);
+801005e2:	83 ec 0c             	sub    $0xc,%esp
+801005e5:	68 20 2f 11 80       	push   $0x80112f20
+801005ea:	e8 27 70 00 00       	call   80107616 <release>
+  ilock(ip);
+801005ef:	83 c4 04             	add    $0x4,%esp
+801005f2:	ff 75 08             	push   0x8(%ebp)
+801005f5:	e8 2e 10 00 00       	call   80101628 <ilock>
+
+  return n;
+}
+801005fa:	89 f8                	mov    %edi,%eax
+801005fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801005ff:	5b                   	pop    %ebx
+80100600:	5e                   	pop    %esi
+80100601:	5f                   	pop    %edi
+80100602:	5d                   	pop    %ebp
+80100603:	c3                   	ret
+
+80100604 <cprintf>:
+{
+80100604:	55                   	push   %ebp
+80100605:	89 e5                	mov    %esp,%ebp
+80100607:	57                   	push   %edi
+80100608:	56                   	push   %esi
+80100609:	53                   	push   %ebx
+8010060a:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+8010060d:	8b 1d 54 2f 11 80    	mov    0x80112f54,%ebx
+  if(locking)
+80100613:	85 db                	test   %ebx,%ebx
+80100615:	75 22                	jne    80100639 <cprintf+0x35>
+  if (fmt == 0)
+80100617:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010061a:	85 ff                	test   %edi,%edi
+8010061c:	74 2d                	je     8010064b <cprintf+0x47>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010061e:	0f b6 07             	movzbl (%edi),%eax
+  argp = (uint*)(void*)(&fmt + 1);
+80100621:	8d 4d 0c             	lea    0xc(%ebp),%ecx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100624:	be 00 00 00 00       	mov    $0x0,%esi
+80100629:	85 c0                	test   %eax,%eax
+8010062b:	0f 84 17 01 00 00    	je     80100748 <cprintf+0x144>
+80100631:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80100634:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80100637:	eb 33                	jmp    8010066c <cprintf+0x68>
+    acquire(&cons.lock);
+80100639:	83 ec 0c             	sub    $0xc,%esp
+8010063c:	68 20 2f 11 80       	push   $0x80112f20
+80100641:	e8 69 6f 00 00       	call   801075af <acquire>
+80100646:	83 c4 10             	add    $0x10,%esp
+80100649:	eb cc                	jmp    80100617 <cprintf+0x13>
+    panic("null fmt");
+8010064b:	83 ec 0c             	sub    $0xc,%esp
+8010064e:	68 bf ad 10 80       	push   $0x8010adbf
+80100653:	e8 ea fc ff ff       	call   80100342 <panic>
+      consputc(c);
+80100658:	e8 5d fd ff ff       	call   801003ba <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010065d:	83 c6 01             	add    $0x1,%esi
+80100660:	0f b6 04 37          	movzbl (%edi,%esi,1),%eax
+80100664:	85 c0                	test   %eax,%eax
+80100666:	0f 84 d9 00 00 00    	je     80100745 <cprintf+0x141>
+    if(c != '%'){
+8010066c:	83 f8 25             	cmp    $0x25,%eax
+8010066f:	75 e7                	jne    80100658 <cprintf+0x54>
+    c = fmt[++i] & 0xff;
+80100671:	83 c6 01             	add    $0x1,%esi
+80100674:	0f b6 1c 37          	movzbl (%edi,%esi,1),%ebx
+    if(c == 0)
+80100678:	85 db                	test   %ebx,%ebx
+8010067a:	0f 84 d4 00 00 00    	je     80100754 <cprintf+0x150>
+    switch(c){
+80100680:	83 fb 70             	cmp    $0x70,%ebx
+80100683:	74 3a                	je     801006bf <cprintf+0xbb>
+80100685:	7f 2e                	jg     801006b5 <cprintf+0xb1>
+80100687:	83 fb 25             	cmp    $0x25,%ebx
+8010068a:	0f 84 90 00 00 00    	je     80100720 <cprintf+0x11c>
+80100690:	83 fb 64             	cmp    $0x64,%ebx
+80100693:	0f 85 96 00 00 00    	jne    8010072f <cprintf+0x12b>
+      printint(*argp++, 10, 1);
+80100699:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010069c:	8d 58 04             	lea    0x4(%eax),%ebx
+8010069f:	8b 00                	mov    (%eax),%eax
+801006a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+801006a6:	ba 0a 00 00 00       	mov    $0xa,%edx
+801006ab:	e8 74 fe ff ff       	call   80100524 <printint>
+801006b0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      break;
+801006b3:	eb a8                	jmp    8010065d <cprintf+0x59>
+    switch(c){
+801006b5:	83 fb 73             	cmp    $0x73,%ebx
+801006b8:	74 21                	je     801006db <cprintf+0xd7>
+801006ba:	83 fb 78             	cmp    $0x78,%ebx
+801006bd:	75 70                	jne    8010072f <cprintf+0x12b>
+      printint(*argp++, 16, 0);
+801006bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801006c2:	8d 58 04             	lea    0x4(%eax),%ebx
+801006c5:	8b 00                	mov    (%eax),%eax
+801006c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+801006cc:	ba 10 00 00 00       	mov    $0x10,%edx
+801006d1:	e8 4e fe ff ff       	call   80100524 <printint>
+801006d6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      break;
+801006d9:	eb 82                	jmp    8010065d <cprintf+0x59>
+      if((s = (char*)*argp++) == 0)
+801006db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801006de:	8d 50 04             	lea    0x4(%eax),%edx
+801006e1:	8b 00                	mov    (%eax),%eax
+801006e3:	85 c0                	test   %eax,%eax
+801006e5:	74 15                	je     801006fc <cprintf+0xf8>
+801006e7:	89 c3                	mov    %eax,%ebx
+      for(; *s; s++)
+801006e9:	0f b6 00             	movzbl (%eax),%eax
+      if((s = (char*)*argp++) == 0)
+801006ec:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      for(; *s; s++)
+801006ef:	84 c0                	test   %al,%al
+801006f1:	0f 84 66 ff ff ff    	je     8010065d <cprintf+0x59>
+801006f7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801006fa:	eb 0d                	jmp    80100709 <cprintf+0x105>
+        s = "(null)";
+801006fc:	bb b8 ad 10 80       	mov    $0x8010adb8,%ebx
+      for(; *s; s++)
+80100701:	b8 28 00 00 00       	mov    $0x28,%eax
+80100706:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+        consputc(*s);
+80100709:	0f be c0             	movsbl %al,%eax
+8010070c:	e8 a9 fc ff ff       	call   801003ba <consputc>
+      for(; *s; s++)
+80100711:	83 c3 01             	add    $0x1,%ebx
+80100714:	0f b6 03             	movzbl (%ebx),%eax
+80100717:	84 c0                	test   %al,%al
+80100719:	75 ee                	jne    80100709 <cprintf+0x105>
+8010071b:	e9 3d ff ff ff       	jmp    8010065d <cprintf+0x59>
+      consputc('%');
+80100720:	b8 25 00 00 00       	mov    $0x25,%eax
+80100725:	e8 90 fc ff ff       	call   801003ba <consputc>
+      break;
+8010072a:	e9 2e ff ff ff       	jmp    8010065d <cprintf+0x59>
+      consputc('%');
+8010072f:	b8 25 00 00 00       	mov    $0x25,%eax
+80100734:	e8 81 fc ff ff       	call   801003ba <consputc>
+      consputc(c);
+80100739:	89 d8                	mov    %ebx,%eax
+8010073b:	e8 7a fc ff ff       	call   801003ba <consputc>
+      break;
+80100740:	e9 18 ff ff ff       	jmp    8010065d <cprintf+0x59>
+80100745:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  if(locking)
+80100748:	85 db                	test   %ebx,%ebx
+8010074a:	75 0d                	jne    80100759 <cprintf+0x155>
+}
+8010074c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010074f:	5b                   	pop    %ebx
+80100750:	5e                   	pop    %esi
+80100751:	5f                   	pop    %edi
+80100752:	5d                   	pop    %ebp
+80100753:	c3                   	ret
+80100754:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80100757:	eb ef                	jmp    80100748 <cprintf+0x144>
+    release(&cons.lock);
+80100759:	83 ec 0c             	sub    $0xc,%esp
+8010075c:	68 20 2f 11 80       	push   $0x80112f20
+80100761:	e8 b0 6e 00 00       	call   80107616 <release>
+80100766:	83 c4 10             	add    $0x10,%esp
+}
+80100769:	eb e1                	jmp    8010074c <cprintf+0x148>
+
+8010076b <consoleintr>:
+{
+8010076b:	55                   	push   %ebp
+8010076c:	89 e5                	mov    %esp,%ebp
+8010076e:	57                   	push   %edi
+8010076f:	56                   	push   %esi
+80100770:	53                   	push   %ebx
+80100771:	83 ec 28             	sub    $0x28,%esp
+80100774:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+80100777:	68 20 2f 11 80       	push   $0x80112f20
+8010077c:	e8 2e 6e 00 00       	call   801075af <acquire>
+  while((c = getc()) >= 0){
+80100781:	83 c4 10             	add    $0x10,%esp
+  int doinfodump = 0;
+80100784:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  char cmd = 0;
+8010078b:	c6 45 e3 00          	movb   $0x0,-0x1d(%ebp)
+  int c, doprocdump = 0;
+8010078f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+      if(input.e != input.w){
+80100796:	be 80 2e 11 80       	mov    $0x80112e80,%esi
+  while((c = getc()) >= 0){
+8010079b:	e9 bf 00 00 00       	jmp    8010085f <consoleintr+0xf4>
+      doinfodump = 1;
+801007a0:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      cmd = 'r';
+801007a7:	c6 45 e3 72          	movb   $0x72,-0x1d(%ebp)
+801007ab:	e9 af 00 00 00       	jmp    8010085f <consoleintr+0xf4>
+    switch(c){
+801007b0:	83 fb 7f             	cmp    $0x7f,%ebx
+801007b3:	0f 84 e1 00 00 00    	je     8010089a <consoleintr+0x12f>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+801007b9:	a1 08 2f 11 80       	mov    0x80112f08,%eax
+801007be:	89 c2                	mov    %eax,%edx
+801007c0:	2b 15 00 2f 11 80    	sub    0x80112f00,%edx
+801007c6:	83 fa 7f             	cmp    $0x7f,%edx
+801007c9:	0f 87 90 00 00 00    	ja     8010085f <consoleintr+0xf4>
+        c = (c == '\r') ? '\n' : c;
+801007cf:	83 fb 0d             	cmp    $0xd,%ebx
+801007d2:	0f 84 37 01 00 00    	je     8010090f <consoleintr+0x1a4>
+        input.buf[input.e++ % INPUT_BUF] = c;
+801007d8:	8d 50 01             	lea    0x1(%eax),%edx
+801007db:	89 15 08 2f 11 80    	mov    %edx,0x80112f08
+801007e1:	83 e0 7f             	and    $0x7f,%eax
+801007e4:	88 98 80 2e 11 80    	mov    %bl,-0x7feed180(%eax)
+        consputc(c);
+801007ea:	89 d8                	mov    %ebx,%eax
+801007ec:	e8 c9 fb ff ff       	call   801003ba <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+801007f1:	83 fb 0a             	cmp    $0xa,%ebx
+801007f4:	0f 84 32 01 00 00    	je     8010092c <consoleintr+0x1c1>
+801007fa:	83 fb 04             	cmp    $0x4,%ebx
+801007fd:	0f 84 29 01 00 00    	je     8010092c <consoleintr+0x1c1>
+80100803:	a1 00 2f 11 80       	mov    0x80112f00,%eax
+80100808:	83 e8 80             	sub    $0xffffff80,%eax
+8010080b:	39 05 08 2f 11 80    	cmp    %eax,0x80112f08
+80100811:	75 4c                	jne    8010085f <consoleintr+0xf4>
+80100813:	e9 14 01 00 00       	jmp    8010092c <consoleintr+0x1c1>
+      while(input.e != input.w &&
+80100818:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+8010081e:	3b 86 84 00 00 00    	cmp    0x84(%esi),%eax
+80100824:	74 39                	je     8010085f <consoleintr+0xf4>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100826:	83 e8 01             	sub    $0x1,%eax
+80100829:	89 c2                	mov    %eax,%edx
+8010082b:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010082e:	80 3c 16 0a          	cmpb   $0xa,(%esi,%edx,1)
+80100832:	74 2b                	je     8010085f <consoleintr+0xf4>
+        input.e--;
+80100834:	89 86 88 00 00 00    	mov    %eax,0x88(%esi)
+        consputc(BACKSPACE);
+8010083a:	b8 00 01 00 00       	mov    $0x100,%eax
+8010083f:	e8 76 fb ff ff       	call   801003ba <consputc>
+      while(input.e != input.w &&
+80100844:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+8010084a:	3b 86 84 00 00 00    	cmp    0x84(%esi),%eax
+80100850:	75 d4                	jne    80100826 <consoleintr+0xbb>
+80100852:	eb 0b                	jmp    8010085f <consoleintr+0xf4>
+      doinfodump = 1;
+80100854:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      cmd = 's';
+8010085b:	c6 45 e3 73          	movb   $0x73,-0x1d(%ebp)
+  while((c = getc()) >= 0){
+8010085f:	ff d7                	call   *%edi
+80100861:	89 c3                	mov    %eax,%ebx
+80100863:	85 c0                	test   %eax,%eax
+80100865:	78 6b                	js     801008d2 <consoleintr+0x167>
+    switch(c){
+80100867:	83 fb 1a             	cmp    $0x1a,%ebx
+8010086a:	0f 8f 40 ff ff ff    	jg     801007b0 <consoleintr+0x45>
+80100870:	83 fb 05             	cmp    $0x5,%ebx
+80100873:	7e 47                	jle    801008bc <consoleintr+0x151>
+80100875:	8d 43 fa             	lea    -0x6(%ebx),%eax
+80100878:	83 f8 14             	cmp    $0x14,%eax
+8010087b:	77 3f                	ja     801008bc <consoleintr+0x151>
+8010087d:	ff 24 85 d0 ad 10 80 	jmp    *-0x7fef5230(,%eax,4)
+      doinfodump = 1;
+80100884:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      cmd = 'z';
+8010088b:	c6 45 e3 7a          	movb   $0x7a,-0x1d(%ebp)
+      break;
+8010088f:	eb ce                	jmp    8010085f <consoleintr+0xf4>
+      doprocdump = 1;
+80100891:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+      break;
+80100898:	eb c5                	jmp    8010085f <consoleintr+0xf4>
+      if(input.e != input.w){
+8010089a:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+801008a0:	3b 86 84 00 00 00    	cmp    0x84(%esi),%eax
+801008a6:	74 b7                	je     8010085f <consoleintr+0xf4>
+        input.e--;
+801008a8:	83 e8 01             	sub    $0x1,%eax
+801008ab:	a3 08 2f 11 80       	mov    %eax,0x80112f08
+        consputc(BACKSPACE);
+801008b0:	b8 00 01 00 00       	mov    $0x100,%eax
+801008b5:	e8 00 fb ff ff       	call   801003ba <consputc>
+801008ba:	eb a3                	jmp    8010085f <consoleintr+0xf4>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+801008bc:	85 db                	test   %ebx,%ebx
+801008be:	74 9f                	je     8010085f <consoleintr+0xf4>
+801008c0:	e9 f4 fe ff ff       	jmp    801007b9 <consoleintr+0x4e>
+    switch(c){
+801008c5:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+801008cc:	c6 45 e3 66          	movb   $0x66,-0x1d(%ebp)
+801008d0:	eb 8d                	jmp    8010085f <consoleintr+0xf4>
+  release(&cons.lock);
+801008d2:	83 ec 0c             	sub    $0xc,%esp
+801008d5:	68 20 2f 11 80       	push   $0x80112f20
+801008da:	e8 37 6d 00 00       	call   80107616 <release>
+  if(doprocdump) {
+801008df:	83 c4 10             	add    $0x10,%esp
+801008e2:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+801008e6:	75 0e                	jne    801008f6 <consoleintr+0x18b>
+  if(doinfodump){
+801008e8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801008ec:	75 0f                	jne    801008fd <consoleintr+0x192>
+}
+801008ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801008f1:	5b                   	pop    %ebx
+801008f2:	5e                   	pop    %esi
+801008f3:	5f                   	pop    %edi
+801008f4:	5d                   	pop    %ebp
+801008f5:	c3                   	ret
+    procdump();  // now call procdump() wo. cons.lock held
+801008f6:	e8 93 4b 00 00       	call   8010548e <procdump>
+801008fb:	eb eb                	jmp    801008e8 <consoleintr+0x17d>
+    infodump(cmd);
+801008fd:	83 ec 0c             	sub    $0xc,%esp
+80100900:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+80100904:	50                   	push   %eax
+80100905:	e8 7d 54 00 00       	call   80105d87 <infodump>
+8010090a:	83 c4 10             	add    $0x10,%esp
+}
+8010090d:	eb df                	jmp    801008ee <consoleintr+0x183>
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010090f:	8d 50 01             	lea    0x1(%eax),%edx
+80100912:	89 15 08 2f 11 80    	mov    %edx,0x80112f08
+80100918:	83 e0 7f             	and    $0x7f,%eax
+8010091b:	c6 80 80 2e 11 80 0a 	movb   $0xa,-0x7feed180(%eax)
+        consputc(c);
+80100922:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100927:	e8 8e fa ff ff       	call   801003ba <consputc>
+          input.w = input.e;
+8010092c:	a1 08 2f 11 80       	mov    0x80112f08,%eax
+80100931:	a3 04 2f 11 80       	mov    %eax,0x80112f04
+          wakeup(&input.r);
+80100936:	83 ec 0c             	sub    $0xc,%esp
+80100939:	68 00 2f 11 80       	push   $0x80112f00
+8010093e:	e8 65 43 00 00       	call   80104ca8 <wakeup>
+80100943:	83 c4 10             	add    $0x10,%esp
+80100946:	e9 14 ff ff ff       	jmp    8010085f <consoleintr+0xf4>
+
+8010094b <consoleinit>:
+
+void
+consoleinit(void)
+{
+8010094b:	55                   	push   %ebp
+8010094c:	89 e5                	mov    %esp,%ebp
+8010094e:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100951:	68 c8 ad 10 80       	push   $0x8010adc8
+80100956:	68 20 2f 11 80       	push   $0x80112f20
+8010095b:	e8 04 6b 00 00       	call   80107464 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100960:	c7 05 0c 39 11 80 a5 	movl   $0x801005a5,0x8011390c
+80100967:	05 10 80 
+  devsw[CONSOLE].read = consoleread;
+8010096a:	c7 05 08 39 11 80 51 	movl   $0x80100251,0x80113908
+80100971:	02 10 80 
+  cons.locking = 1;
+80100974:	c7 05 54 2f 11 80 01 	movl   $0x1,0x80112f54
+8010097b:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+8010097e:	83 c4 08             	add    $0x8,%esp
+80100981:	6a 00                	push   $0x0
+80100983:	6a 01                	push   $0x1
+80100985:	e8 3d 18 00 00       	call   801021c7 <ioapicenable>
+}
+8010098a:	83 c4 10             	add    $0x10,%esp
+8010098d:	c9                   	leave
+8010098e:	c3                   	ret
+
+8010098f <freeregions>:
+
+// Drop the program segments in region[].  Starts its own file
+// system operation, for iput().
+void
+freeregions(struct vmregion *region)
+{
+8010098f:	55                   	push   %ebp
+80100990:	89 e5                	mov    %esp,%ebp
+80100992:	56                   	push   %esi
+80100993:	53                   	push   %ebx
+80100994:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct vmregion *r;
+
+  begin_op();
+80100997:	e8 ad 25 00 00       	call   80102f49 <begin_op>
+  for(r = region; r < &region[NREGION]; r++){
+8010099c:	8d 73 50             	lea    0x50(%ebx),%esi
+8010099f:	eb 0d                	jmp    801009ae <freeregions+0x1f>
+    if(r->ip)
+      iputregion(r->ip);
+    r->ip = 0;
+801009a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  for(r = region; r < &region[NREGION]; r++){
+801009a7:	83 c3 14             	add    $0x14,%ebx
+801009aa:	39 f3                	cmp    %esi,%ebx
+801009ac:	74 14                	je     801009c2 <freeregions+0x33>
+    if(r->ip)
+801009ae:	8b 03                	mov    (%ebx),%eax
+801009b0:	85 c0                	test   %eax,%eax
+801009b2:	74 ed                	je     801009a1 <freeregions+0x12>
+      iputregion(r->ip);
+801009b4:	83 ec 0c             	sub    $0xc,%esp
+801009b7:	50                   	push   %eax
+801009b8:	e8 11 0f 00 00       	call   801018ce <iputregion>
+801009bd:	83 c4 10             	add    $0x10,%esp
+801009c0:	eb df                	jmp    801009a1 <freeregions+0x12>
+  }
+  end_op();
+801009c2:	e8 fd 25 00 00       	call   80102fc4 <end_op>
+}
+801009c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801009ca:	5b                   	pop    %ebx
+801009cb:	5e                   	pop    %esi
+801009cc:	5d                   	pop    %ebp
+801009cd:	c3                   	ret
+
+801009ce <execload>:
+{
+801009ce:	55                   	push   %ebp
+801009cf:	89 e5                	mov    %esp,%ebp
+801009d1:	57                   	push   %edi
+801009d2:	56                   	push   %esi
+801009d3:	53                   	push   %ebx
+801009d4:	81 ec 10 01 00 00    	sub    $0x110,%esp
+  memset(region, 0, NREGION*sizeof(region[0]));
+801009da:	6a 50                	push   $0x50
+801009dc:	6a 00                	push   $0x0
+801009de:	ff 75 18             	push   0x18(%ebp)
+801009e1:	e8 77 6c 00 00       	call   8010765d <memset>
+  begin_op();
+801009e6:	e8 5e 25 00 00       	call   80102f49 <begin_op>
+  if((ip = namei(path)) == 0){
+801009eb:	83 c4 04             	add    $0x4,%esp
+801009ee:	ff 75 08             	push   0x8(%ebp)
+801009f1:	e8 4e 14 00 00       	call   80101e44 <namei>
+801009f6:	83 c4 10             	add    $0x10,%esp
+801009f9:	85 c0                	test   %eax,%eax
+801009fb:	74 7e                	je     80100a7b <execload+0xad>
+801009fd:	89 c7                	mov    %eax,%edi
+  ilock(ip);
+801009ff:	83 ec 0c             	sub    $0xc,%esp
+80100a02:	50                   	push   %eax
+80100a03:	e8 20 0c 00 00       	call   80101628 <ilock>
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100a08:	6a 34                	push   $0x34
+80100a0a:	6a 00                	push   $0x0
+80100a0c:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100a12:	50                   	push   %eax
+80100a13:	57                   	push   %edi
+80100a14:	e8 14 0f 00 00       	call   8010192d <readi>
+80100a19:	83 c4 20             	add    $0x20,%esp
+80100a1c:	83 f8 34             	cmp    $0x34,%eax
+80100a1f:	0f 85 99 02 00 00    	jne    80100cbe <execload+0x2f0>
+  if(elf.magic != ELF_MAGIC)
+80100a25:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100a2c:	45 4c 46 
+80100a2f:	0f 85 89 02 00 00    	jne    80100cbe <execload+0x2f0>
+  if((pgdir = setupkvm()) == 0)
+80100a35:	e8 38 94 00 00       	call   80109e72 <setupkvm>
+80100a3a:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+80100a40:	85 c0                	test   %eax,%eax
+80100a42:	0f 84 76 02 00 00    	je     80100cbe <execload+0x2f0>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100a48:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+80100a4e:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100a55:	00 
+80100a56:	0f 84 08 01 00 00    	je     80100b64 <execload+0x196>
+  r = region;
+80100a5c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+  sz = 0;
+80100a5f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100a66:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100a69:	be 00 00 00 00       	mov    $0x0,%esi
+    if(r == &region[NREGION])
+80100a6e:	89 d9                	mov    %ebx,%ecx
+80100a70:	83 c1 50             	add    $0x50,%ecx
+80100a73:	89 8d ec fe ff ff    	mov    %ecx,-0x114(%ebp)
+80100a79:	eb 2a                	jmp    80100aa5 <execload+0xd7>
+    end_op();
+80100a7b:	e8 44 25 00 00       	call   80102fc4 <end_op>
+    return -1;
+80100a80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100a85:	e9 58 02 00 00       	jmp    80100ce2 <execload+0x314>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100a8a:	83 c6 01             	add    $0x1,%esi
+80100a8d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+80100a93:	83 c0 20             	add    $0x20,%eax
+80100a96:	0f b7 95 50 ff ff ff 	movzwl -0xb0(%ebp),%edx
+80100a9d:	39 f2                	cmp    %esi,%edx
+80100a9f:	0f 8e c9 00 00 00    	jle    80100b6e <execload+0x1a0>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100aa5:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100aab:	6a 20                	push   $0x20
+80100aad:	50                   	push   %eax
+80100aae:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100ab4:	50                   	push   %eax
+80100ab5:	57                   	push   %edi
+80100ab6:	e8 72 0e 00 00       	call   8010192d <readi>
+80100abb:	83 c4 10             	add    $0x10,%esp
+80100abe:	83 f8 20             	cmp    $0x20,%eax
+80100ac1:	0f 85 e6 01 00 00    	jne    80100cad <execload+0x2df>
+    if(ph.type != ELF_PROG_LOAD)
+80100ac7:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100ace:	75 ba                	jne    80100a8a <execload+0xbc>
+    if(ph.memsz < ph.filesz)
+80100ad0:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100ad6:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100adc:	0f 82 cb 01 00 00    	jb     80100cad <execload+0x2df>
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100ae2:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+80100ae8:	01 d0                	add    %edx,%eax
+    if(ph.vaddr < sz || ph.vaddr + ph.memsz >= KERNBASE)
+80100aea:	8b 8d f0 fe ff ff    	mov    -0x110(%ebp),%ecx
+80100af0:	39 ca                	cmp    %ecx,%edx
+80100af2:	0f 82 b5 01 00 00    	jb     80100cad <execload+0x2df>
+80100af8:	39 d0                	cmp    %edx,%eax
+80100afa:	0f 82 ad 01 00 00    	jb     80100cad <execload+0x2df>
+80100b00:	85 c0                	test   %eax,%eax
+80100b02:	0f 88 a5 01 00 00    	js     80100cad <execload+0x2df>
+    if(ph.vaddr % PGSIZE != 0)
+80100b08:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+80100b0e:	0f 85 99 01 00 00    	jne    80100cad <execload+0x2df>
+    if(r == &region[NREGION])
+80100b14:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+80100b1a:	39 c3                	cmp    %eax,%ebx
+80100b1c:	0f 84 8b 01 00 00    	je     80100cad <execload+0x2df>
+    r->ip = idupregion(ip);
+80100b22:	83 ec 0c             	sub    $0xc,%esp
+80100b25:	57                   	push   %edi
+80100b26:	e8 74 0d 00 00       	call   8010189f <idupregion>
+80100b2b:	89 03                	mov    %eax,(%ebx)
+    r->va = ph.vaddr;
+80100b2d:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+80100b33:	89 53 04             	mov    %edx,0x4(%ebx)
+    r->filesz = ph.filesz;
+80100b36:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+80100b3c:	89 43 08             	mov    %eax,0x8(%ebx)
+    r->memsz = ph.memsz;
+80100b3f:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100b45:	89 43 0c             	mov    %eax,0xc(%ebx)
+    r->off = ph.off;
+80100b48:	8b 8d 08 ff ff ff    	mov    -0xf8(%ebp),%ecx
+80100b4e:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    r++;
+80100b51:	83 c3 14             	add    $0x14,%ebx
+    sz = ph.vaddr + ph.memsz;
+80100b54:	01 d0                	add    %edx,%eax
+80100b56:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100b5c:	83 c4 10             	add    $0x10,%esp
+80100b5f:	e9 26 ff ff ff       	jmp    80100a8a <execload+0xbc>
+  sz = 0;
+80100b64:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100b6b:	00 00 00 
+  iunlockput(ip);
+80100b6e:	83 ec 0c             	sub    $0xc,%esp
+80100b71:	57                   	push   %edi
+80100b72:	e8 08 0d 00 00       	call   8010187f <iunlockput>
+  end_op();
+80100b77:	e8 48 24 00 00       	call   80102fc4 <end_op>
+  sz = PGROUNDUP(sz);
+80100b7c:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+80100b82:	05 ff 0f 00 00       	add    $0xfff,%eax
+80100b87:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100b8c:	83 c4 0c             	add    $0xc,%esp
+80100b8f:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+80100b95:	52                   	push   %edx
+80100b96:	50                   	push   %eax
+80100b97:	8b b5 e8 fe ff ff    	mov    -0x118(%ebp),%esi
+80100b9d:	56                   	push   %esi
+80100b9e:	e8 9e 97 00 00       	call   8010a341 <allocuvm>
+80100ba3:	89 c7                	mov    %eax,%edi
+80100ba5:	83 c4 10             	add    $0x10,%esp
+80100ba8:	85 c0                	test   %eax,%eax
+80100baa:	74 78                	je     80100c24 <execload+0x256>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100bac:	83 ec 08             	sub    $0x8,%esp
+80100baf:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+80100bb5:	50                   	push   %eax
+80100bb6:	56                   	push   %esi
+80100bb7:	e8 7e 9a 00 00       	call   8010a63a <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100bbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100bbf:	8b 00                	mov    (%eax),%eax
+80100bc1:	83 c4 10             	add    $0x10,%esp
+  sp = sz;
+80100bc4:	89 fb                	mov    %edi,%ebx
+  for(argc = 0; argv[argc]; argc++) {
+80100bc6:	be 00 00 00 00       	mov    $0x0,%esi
+80100bcb:	85 c0                	test   %eax,%eax
+80100bcd:	74 71                	je     80100c40 <execload+0x272>
+80100bcf:	89 bd f4 fe ff ff    	mov    %edi,-0x10c(%ebp)
+80100bd5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100bd8:	83 ec 0c             	sub    $0xc,%esp
+80100bdb:	50                   	push   %eax
+80100bdc:	e8 24 6c 00 00       	call   80107805 <strlen>
+80100be1:	29 c3                	sub    %eax,%ebx
+80100be3:	83 eb 01             	sub    $0x1,%ebx
+80100be6:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100be9:	83 c4 04             	add    $0x4,%esp
+80100bec:	ff 34 b7             	push   (%edi,%esi,4)
+80100bef:	e8 11 6c 00 00       	call   80107805 <strlen>
+80100bf4:	83 c0 01             	add    $0x1,%eax
+80100bf7:	50                   	push   %eax
+80100bf8:	ff 34 b7             	push   (%edi,%esi,4)
+80100bfb:	53                   	push   %ebx
+80100bfc:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+80100c02:	e8 06 a0 00 00       	call   8010ac0d <copyout>
+80100c07:	83 c4 20             	add    $0x20,%esp
+80100c0a:	85 c0                	test   %eax,%eax
+80100c0c:	78 16                	js     80100c24 <execload+0x256>
+    ustack[3+argc] = sp;
+80100c0e:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+  for(argc = 0; argv[argc]; argc++) {
+80100c15:	83 c6 01             	add    $0x1,%esi
+80100c18:	8b 04 b7             	mov    (%edi,%esi,4),%eax
+80100c1b:	85 c0                	test   %eax,%eax
+80100c1d:	74 1b                	je     80100c3a <execload+0x26c>
+    if(argc >= MAXARG)
+80100c1f:	83 fe 20             	cmp    $0x20,%esi
+80100c22:	75 b4                	jne    80100bd8 <execload+0x20a>
+    freevm(pgdir);
+80100c24:	83 ec 0c             	sub    $0xc,%esp
+80100c27:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+80100c2d:	e8 7c 99 00 00       	call   8010a5ae <freevm>
+80100c32:	83 c4 10             	add    $0x10,%esp
+80100c35:	e9 95 00 00 00       	jmp    80100ccf <execload+0x301>
+80100c3a:	8b bd f4 fe ff ff    	mov    -0x10c(%ebp),%edi
+  ustack[3+argc] = 0;
+80100c40:	c7 84 b5 64 ff ff ff 	movl   $0x0,-0x9c(%ebp,%esi,4)
+80100c47:	00 00 00 00 
+  ustack[0] = 0xffffffff;  // fake return PC
+80100c4b:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80100c52:	ff ff ff 
+  ustack[1] = argc;
+80100c55:	89 b5 5c ff ff ff    	mov    %esi,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100c5b:	8d 04 b5 04 00 00 00 	lea    0x4(,%esi,4),%eax
+80100c62:	89 da                	mov    %ebx,%edx
+80100c64:	29 c2                	sub    %eax,%edx
+80100c66:	89 95 60 ff ff ff    	mov    %edx,-0xa0(%ebp)
+  sp -= (3+argc+1) * 4;
+80100c6c:	83 c0 0c             	add    $0xc,%eax
+80100c6f:	29 c3                	sub    %eax,%ebx
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80100c71:	50                   	push   %eax
+80100c72:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+80100c78:	50                   	push   %eax
+80100c79:	53                   	push   %ebx
+80100c7a:	8b b5 e8 fe ff ff    	mov    -0x118(%ebp),%esi
+80100c80:	56                   	push   %esi
+80100c81:	e8 87 9f 00 00       	call   8010ac0d <copyout>
+80100c86:	83 c4 10             	add    $0x10,%esp
+80100c89:	85 c0                	test   %eax,%eax
+80100c8b:	78 97                	js     80100c24 <execload+0x256>
+  *pgdirp = pgdir;
+80100c8d:	8b 45 10             	mov    0x10(%ebp),%eax
+80100c90:	89 30                	mov    %esi,(%eax)
+  *szp = sz;
+80100c92:	8b 45 14             	mov    0x14(%ebp),%eax
+80100c95:	89 38                	mov    %edi,(%eax)
+  tf->eip = elf.entry;  // main
+80100c97:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+80100c9d:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+80100ca0:	89 41 38             	mov    %eax,0x38(%ecx)
+  tf->esp = sp;
+80100ca3:	89 59 44             	mov    %ebx,0x44(%ecx)
+  return 0;
+80100ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+80100cab:	eb 35                	jmp    80100ce2 <execload+0x314>
+    freevm(pgdir);
+80100cad:	83 ec 0c             	sub    $0xc,%esp
+80100cb0:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+80100cb6:	e8 f3 98 00 00       	call   8010a5ae <freevm>
+80100cbb:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80100cbe:	83 ec 0c             	sub    $0xc,%esp
+80100cc1:	57                   	push   %edi
+80100cc2:	e8 b8 0b 00 00       	call   8010187f <iunlockput>
+    end_op();
+80100cc7:	e8 f8 22 00 00       	call   80102fc4 <end_op>
+80100ccc:	83 c4 10             	add    $0x10,%esp
+  freeregions(region);
+80100ccf:	83 ec 0c             	sub    $0xc,%esp
+80100cd2:	ff 75 18             	push   0x18(%ebp)
+80100cd5:	e8 b5 fc ff ff       	call   8010098f <freeregions>
+  return -1;
+80100cda:	83 c4 10             	add    $0x10,%esp
+80100cdd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80100ce2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100ce5:	5b                   	pop    %ebx
+80100ce6:	5e                   	pop    %esi
+80100ce7:	5f                   	pop    %edi
+80100ce8:	5d                   	pop    %ebp
+80100ce9:	c3                   	ret
+
+80100cea <execname>:
+
+// Last component of path, the name a program runs under.
+char*
+execname(char *path)
+{
+80100cea:	55                   	push   %ebp
+80100ceb:	89 e5                	mov    %esp,%ebp
+80100ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  char *s, *last;
+
+  for(last=s=path; *s; s++)
+80100cf0:	0f b6 08             	movzbl (%eax),%ecx
+80100cf3:	84 c9                	test   %cl,%cl
+80100cf5:	74 14                	je     80100d0b <execname+0x21>
+80100cf7:	8d 50 01             	lea    0x1(%eax),%edx
+    if(*s == '/')
+      last = s+1;
+80100cfa:	80 f9 2f             	cmp    $0x2f,%cl
+80100cfd:	0f 44 c2             	cmove  %edx,%eax
+  for(last=s=path; *s; s++)
+80100d00:	83 c2 01             	add    $0x1,%edx
+80100d03:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+80100d07:	84 c9                	test   %cl,%cl
+80100d09:	75 ef                	jne    80100cfa <execname+0x10>
+  return last;
+}
+80100d0b:	5d                   	pop    %ebp
+80100d0c:	c3                   	ret
+
+80100d0d <exec>:
+
+int
+exec(char *path, char **argv)
+{
+80100d0d:	55                   	push   %ebp
+80100d0e:	89 e5                	mov    %esp,%ebp
+80100d10:	57                   	push   %edi
+80100d11:	56                   	push   %esi
+80100d12:	53                   	push   %ebx
+80100d13:	81 ec cc 00 00 00    	sub    $0xcc,%esp
+80100d19:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint sz;
+  pde_t *pgdir, *oldpgdir;
+  struct vmregion region[NREGION], oldregion[NREGION];
+  struct proc *curproc = myproc();
+80100d1c:	e8 97 3a 00 00       	call   801047b8 <myproc>
+80100d21:	89 c3                	mov    %eax,%ebx
+
+  if(execload(path, argv, &pgdir, &sz, region, curproc->tf) < 0)
+80100d23:	83 ec 08             	sub    $0x8,%esp
+80100d26:	ff 70 18             	push   0x18(%eax)
+80100d29:	8d 45 90             	lea    -0x70(%ebp),%eax
+80100d2c:	50                   	push   %eax
+80100d2d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80100d30:	50                   	push   %eax
+80100d31:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80100d34:	50                   	push   %eax
+80100d35:	ff 75 0c             	push   0xc(%ebp)
+80100d38:	56                   	push   %esi
+80100d39:	e8 90 fc ff ff       	call   801009ce <execload>
+80100d3e:	83 c4 20             	add    $0x20,%esp
+80100d41:	85 c0                	test   %eax,%eax
+80100d43:	0f 88 8e 00 00 00    	js     80100dd7 <exec+0xca>
+    return -1;
+
+  // Save program name for debugging.
+#ifdef CS333_P4
+  metabegin(curproc);
+80100d49:	83 ec 0c             	sub    $0xc,%esp
+80100d4c:	53                   	push   %ebx
+80100d4d:	e8 e4 55 00 00       	call   80106336 <metabegin>
+  safestrcpy(curproc->name, execname(path), sizeof(curproc->name));
+80100d52:	89 34 24             	mov    %esi,(%esp)
+80100d55:	e8 90 ff ff ff       	call   80100cea <execname>
+80100d5a:	83 c4 0c             	add    $0xc,%esp
+80100d5d:	6a 10                	push   $0x10
+80100d5f:	50                   	push   %eax
+80100d60:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80100d63:	50                   	push   %eax
+80100d64:	e8 66 6a 00 00       	call   801077cf <safestrcpy>
+  metaend(curproc);
+80100d69:	89 1c 24             	mov    %ebx,(%esp)
+80100d6c:	e8 f0 55 00 00       	call   80106361 <metaend>
+#else
+  safestrcpy(curproc->name, execname(path), sizeof(curproc->name));
+#endif // CS333_P4
+
+  // Commit to the user image.
+  oldpgdir = curproc->pgdir;
+80100d71:	8b 43 04             	mov    0x4(%ebx),%eax
+80100d74:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+  memmove(oldregion, curproc->region, sizeof(oldregion));
+80100d7a:	8d 7b 7c             	lea    0x7c(%ebx),%edi
+80100d7d:	83 c4 0c             	add    $0xc,%esp
+80100d80:	6a 50                	push   $0x50
+80100d82:	57                   	push   %edi
+80100d83:	8d b5 40 ff ff ff    	lea    -0xc0(%ebp),%esi
+80100d89:	56                   	push   %esi
+80100d8a:	e8 45 69 00 00       	call   801076d4 <memmove>
+  curproc->pgdir = pgdir;
+80100d8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100d92:	89 43 04             	mov    %eax,0x4(%ebx)
+  curproc->sz = sz;
+80100d95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100d98:	89 03                	mov    %eax,(%ebx)
+  memmove(curproc->region, region, sizeof(region));
+80100d9a:	83 c4 0c             	add    $0xc,%esp
+80100d9d:	6a 50                	push   $0x50
+80100d9f:	8d 45 90             	lea    -0x70(%ebp),%eax
+80100da2:	50                   	push   %eax
+80100da3:	57                   	push   %edi
+80100da4:	e8 2b 69 00 00       	call   801076d4 <memmove>
+  switchuvm(curproc);
+80100da9:	89 1c 24             	mov    %ebx,(%esp)
+80100dac:	e8 46 92 00 00       	call   80109ff7 <switchuvm>
+  freevm(oldpgdir);
+80100db1:	83 c4 04             	add    $0x4,%esp
+80100db4:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+80100dba:	e8 ef 97 00 00       	call   8010a5ae <freevm>
+  freeregions(oldregion);
+80100dbf:	89 34 24             	mov    %esi,(%esp)
+80100dc2:	e8 c8 fb ff ff       	call   8010098f <freeregions>
+  return 0;
+80100dc7:	83 c4 10             	add    $0x10,%esp
+80100dca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80100dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100dd2:	5b                   	pop    %ebx
+80100dd3:	5e                   	pop    %esi
+80100dd4:	5f                   	pop    %edi
+80100dd5:	5d                   	pop    %ebp
+80100dd6:	c3                   	ret
+    return -1;
+80100dd7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100ddc:	eb f1                	jmp    80100dcf <exec+0xc2>
+
+80100dde <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80100dde:	55                   	push   %ebp
+80100ddf:	89 e5                	mov    %esp,%ebp
+80100de1:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80100de4:	68 35 ae 10 80       	push   $0x8010ae35
+80100de9:	68 60 2f 11 80       	push   $0x80112f60
+80100dee:	e8 71 66 00 00       	call   80107464 <initlock>
+}
+80100df3:	83 c4 10             	add    $0x10,%esp
+80100df6:	c9                   	leave
+80100df7:	c3                   	ret
+
+80100df8 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80100df8:	55                   	push   %ebp
+80100df9:	89 e5                	mov    %esp,%ebp
+80100dfb:	53                   	push   %ebx
+80100dfc:	83 ec 10             	sub    $0x10,%esp
+  struct file *f;
+
+  acquire(&ftable.lock);
+80100dff:	68 60 2f 11 80       	push   $0x80112f60
+80100e04:	e8 a6 67 00 00       	call   801075af <acquire>
+80100e09:	83 c4 10             	add    $0x10,%esp
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100e0c:	bb 94 2f 11 80       	mov    $0x80112f94,%ebx
+    if(f->ref == 0){
+80100e11:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+80100e15:	74 22                	je     80100e39 <filealloc+0x41>
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100e17:	83 c3 18             	add    $0x18,%ebx
+80100e1a:	81 fb f4 38 11 80    	cmp    $0x801138f4,%ebx
+80100e20:	75 ef                	jne    80100e11 <filealloc+0x19>
+      f->ref = 1;
+      release(&ftable.lock);
+      return f;
+    }
+  }
+  release(&ftable.lock);
+80100e22:	83 ec 0c             	sub    $0xc,%esp
+80100e25:	68 60 2f 11 80       	push   $0x80112f60
+80100e2a:	e8 e7 67 00 00       	call   80107616 <release>
+  return 0;
+80100e2f:	83 c4 10             	add    $0x10,%esp
+80100e32:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100e37:	eb 17                	jmp    80100e50 <filealloc+0x58>
+      f->ref = 1;
+80100e39:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+80100e40:	83 ec 0c             	sub    $0xc,%esp
+80100e43:	68 60 2f 11 80       	push   $0x80112f60
+80100e48:	e8 c9 67 00 00       	call   80107616 <release>
+      return f;
+80100e4d:	83 c4 10             	add    $0x10,%esp
+}
+80100e50:	89 d8                	mov    %ebx,%eax
+80100e52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100e55:	c9                   	leave
+80100e56:	c3                   	ret
+
+80100e57 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80100e57:	55                   	push   %ebp
+80100e58:	89 e5                	mov    %esp,%ebp
+80100e5a:	53                   	push   %ebx
+80100e5b:	83 ec 10             	sub    $0x10,%esp
+80100e5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+80100e61:	68 60 2f 11 80       	push   $0x80112f60
+80100e66:	e8 44 67 00 00       	call   801075af <acquire>
+  if(f->ref < 1)
+80100e6b:	8b 43 04             	mov    0x4(%ebx),%eax
+80100e6e:	83 c4 10             	add    $0x10,%esp
+80100e71:	85 c0                	test   %eax,%eax
+80100e73:	7e 1a                	jle    80100e8f <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80100e75:	83 c0 01             	add    $0x1,%eax
+80100e78:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80100e7b:	83 ec 0c             	sub    $0xc,%esp
+80100e7e:	68 60 2f 11 80       	push   $0x80112f60
+80100e83:	e8 8e 67 00 00       	call   80107616 <release>
+  return f;
+}
+80100e88:	89 d8                	mov    %ebx,%eax
+80100e8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100e8d:	c9                   	leave
+80100e8e:	c3                   	ret
+    panic("filedup");
+80100e8f:	83 ec 0c             	sub    $0xc,%esp
+80100e92:	68 3c ae 10 80       	push   $0x8010ae3c
+80100e97:	e8 a6 f4 ff ff       	call   80100342 <panic>
+
+80100e9c <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80100e9c:	55                   	push   %ebp
+80100e9d:	89 e5                	mov    %esp,%ebp
+80100e9f:	57                   	push   %edi
+80100ea0:	56                   	push   %esi
+80100ea1:	53                   	push   %ebx
+80100ea2:	83 ec 28             	sub    $0x28,%esp
+80100ea5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80100ea8:	68 60 2f 11 80       	push   $0x80112f60
+80100ead:	e8 fd 66 00 00       	call   801075af <acquire>
+  if(f->ref < 1)
+80100eb2:	8b 43 04             	mov    0x4(%ebx),%eax
+80100eb5:	83 c4 10             	add    $0x10,%esp
+80100eb8:	85 c0                	test   %eax,%eax
+80100eba:	7e 5d                	jle    80100f19 <fileclose+0x7d>
+    panic("fileclose");
+  if(--f->ref > 0){
+80100ebc:	83 e8 01             	sub    $0x1,%eax
+80100ebf:	89 43 04             	mov    %eax,0x4(%ebx)
+80100ec2:	85 c0                	test   %eax,%eax
+80100ec4:	7f 60                	jg     80100f26 <fileclose+0x8a>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+80100ec6:	8b 33                	mov    (%ebx),%esi
+80100ec8:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+80100ecc:	88 45 e7             	mov    %al,-0x19(%ebp)
+80100ecf:	8b 7b 0c             	mov    0xc(%ebx),%edi
+80100ed2:	8b 43 10             	mov    0x10(%ebx),%eax
+80100ed5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  f->ref = 0;
+80100ed8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  f->type = FD_NONE;
+80100edf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&ftable.lock);
+80100ee5:	83 ec 0c             	sub    $0xc,%esp
+80100ee8:	68 60 2f 11 80       	push   $0x80112f60
+80100eed:	e8 24 67 00 00       	call   80107616 <release>
+
+  if(ff.type == FD_PIPE)
+80100ef2:	83 c4 10             	add    $0x10,%esp
+80100ef5:	83 fe 01             	cmp    $0x1,%esi
+80100ef8:	74 44                	je     80100f3e <fileclose+0xa2>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80100efa:	83 fe 02             	cmp    $0x2,%esi
+80100efd:	75 37                	jne    80100f36 <fileclose+0x9a>
+    begin_op();
+80100eff:	e8 45 20 00 00       	call   80102f49 <begin_op>
+    iput(ff.ip);
+80100f04:	83 ec 0c             	sub    $0xc,%esp
+80100f07:	ff 75 e0             	push   -0x20(%ebp)
+80100f0a:	e8 20 08 00 00       	call   8010172f <iput>
+    end_op();
+80100f0f:	e8 b0 20 00 00       	call   80102fc4 <end_op>
+80100f14:	83 c4 10             	add    $0x10,%esp
+80100f17:	eb 1d                	jmp    80100f36 <fileclose+0x9a>
+    panic("fileclose");
+80100f19:	83 ec 0c             	sub    $0xc,%esp
+80100f1c:	68 44 ae 10 80       	push   $0x8010ae44
+80100f21:	e8 1c f4 ff ff       	call   80100342 <panic>
+    release(&ftable.lock);
+80100f26:	83 ec 0c             	sub    $0xc,%esp
+80100f29:	68 60 2f 11 80       	push   $0x80112f60
+80100f2e:	e8 e3 66 00 00       	call   80107616 <release>
+80100f33:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80100f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f39:	5b                   	pop    %ebx
+80100f3a:	5e                   	pop    %esi
+80100f3b:	5f                   	pop    %edi
+80100f3c:	5d                   	pop    %ebp
+80100f3d:	c3                   	ret
+    pipeclose(ff.pipe, ff.writable);
+80100f3e:	83 ec 08             	sub    $0x8,%esp
+80100f41:	0f be 45 e7          	movsbl -0x19(%ebp),%eax
+80100f45:	50                   	push   %eax
+80100f46:	57                   	push   %edi
+80100f47:	e8 cb 29 00 00       	call   80103917 <pipeclose>
+80100f4c:	83 c4 10             	add    $0x10,%esp
+80100f4f:	eb e5                	jmp    80100f36 <fileclose+0x9a>
+
+80100f51 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80100f51:	55                   	push   %ebp
+80100f52:	89 e5                	mov    %esp,%ebp
+80100f54:	53                   	push   %ebx
+80100f55:	83 ec 04             	sub    $0x4,%esp
+80100f58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+80100f5b:	83 3b 02             	cmpl   $0x2,(%ebx)
+80100f5e:	75 31                	jne    80100f91 <filestat+0x40>
+    ilock(f->ip);
+80100f60:	83 ec 0c             	sub    $0xc,%esp
+80100f63:	ff 73 10             	push   0x10(%ebx)
+80100f66:	e8 bd 06 00 00       	call   80101628 <ilock>
+    stati(f->ip, st);
+80100f6b:	83 c4 08             	add    $0x8,%esp
+80100f6e:	ff 75 0c             	push   0xc(%ebp)
+80100f71:	ff 73 10             	push   0x10(%ebx)
+80100f74:	e8 89 09 00 00       	call   80101902 <stati>
+    iunlock(f->ip);
+80100f79:	83 c4 04             	add    $0x4,%esp
+80100f7c:	ff 73 10             	push   0x10(%ebx)
+80100f7f:	e8 66 07 00 00       	call   801016ea <iunlock>
+    return 0;
+80100f84:	83 c4 10             	add    $0x10,%esp
+80100f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  return -1;
+}
+80100f8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100f8f:	c9                   	leave
+80100f90:	c3                   	ret
+  return -1;
+80100f91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100f96:	eb f4                	jmp    80100f8c <filestat+0x3b>
+
+80100f98 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80100f98:	55                   	push   %ebp
+80100f99:	89 e5                	mov    %esp,%ebp
+80100f9b:	56                   	push   %esi
+80100f9c:	53                   	push   %ebx
+80100f9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  if(f->readable == 0)
+80100fa0:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80100fa4:	74 70                	je     80101016 <fileread+0x7e>
+    return -1;
+  if(f->type == FD_PIPE)
+80100fa6:	8b 03                	mov    (%ebx),%eax
+80100fa8:	83 f8 01             	cmp    $0x1,%eax
+80100fab:	74 44                	je     80100ff1 <fileread+0x59>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+80100fad:	83 f8 02             	cmp    $0x2,%eax
+80100fb0:	75 57                	jne    80101009 <fileread+0x71>
+    ilock(f->ip);
+80100fb2:	83 ec 0c             	sub    $0xc,%esp
+80100fb5:	ff 73 10             	push   0x10(%ebx)
+80100fb8:	e8 6b 06 00 00       	call   80101628 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+80100fbd:	ff 75 10             	push   0x10(%ebp)
+80100fc0:	ff 73 14             	push   0x14(%ebx)
+80100fc3:	ff 75 0c             	push   0xc(%ebp)
+80100fc6:	ff 73 10             	push   0x10(%ebx)
+80100fc9:	e8 5f 09 00 00       	call   8010192d <readi>
+80100fce:	89 c6                	mov    %eax,%esi
+80100fd0:	83 c4 20             	add    $0x20,%esp
+80100fd3:	85 c0                	test   %eax,%eax
+80100fd5:	7e 03                	jle    80100fda <fileread+0x42>
+      f->off += r;
+80100fd7:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+80100fda:	83 ec 0c             	sub    $0xc,%esp
+80100fdd:	ff 73 10             	push   0x10(%ebx)
+80100fe0:	e8 05 07 00 00       	call   801016ea <iunlock>
+    return r;
+80100fe5:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+80100fe8:	89 f0                	mov    %esi,%eax
+80100fea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100fed:	5b                   	pop    %ebx
+80100fee:	5e                   	pop    %esi
+80100fef:	5d                   	pop    %ebp
+80100ff0:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80100ff1:	83 ec 04             	sub    $0x4,%esp
+80100ff4:	ff 75 10             	push   0x10(%ebp)
+80100ff7:	ff 75 0c             	push   0xc(%ebp)
+80100ffa:	ff 73 0c             	push   0xc(%ebx)
+80100ffd:	e8 8f 2a 00 00       	call   80103a91 <piperead>
+80101002:	89 c6                	mov    %eax,%esi
+80101004:	83 c4 10             	add    $0x10,%esp
+80101007:	eb df                	jmp    80100fe8 <fileread+0x50>
+  panic("fileread");
+80101009:	83 ec 0c             	sub    $0xc,%esp
+8010100c:	68 4e ae 10 80       	push   $0x8010ae4e
+80101011:	e8 2c f3 ff ff       	call   80100342 <panic>
+    return -1;
+80101016:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010101b:	eb cb                	jmp    80100fe8 <fileread+0x50>
+
+8010101d <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+8010101d:	55                   	push   %ebp
+8010101e:	89 e5                	mov    %esp,%ebp
+80101020:	57                   	push   %edi
+80101021:	56                   	push   %esi
+80101022:	53                   	push   %ebx
+80101023:	83 ec 1c             	sub    $0x1c,%esp
+80101026:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int r;
+
+  if(f->writable == 0)
+80101029:	80 7f 09 00          	cmpb   $0x0,0x9(%edi)
+8010102d:	0f 84 ea 00 00 00    	je     8010111d <filewrite+0x100>
+    return -1;
+  if(f->type == FD_PIPE)
+80101033:	8b 07                	mov    (%edi),%eax
+80101035:	83 f8 01             	cmp    $0x1,%eax
+80101038:	74 1a                	je     80101054 <filewrite+0x37>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010103a:	83 f8 02             	cmp    $0x2,%eax
+8010103d:	0f 85 cd 00 00 00    	jne    80101110 <filewrite+0xf3>
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+    while(i < n){
+80101043:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80101047:	0f 8e bc 00 00 00    	jle    80101109 <filewrite+0xec>
+    int i = 0;
+8010104d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101052:	eb 40                	jmp    80101094 <filewrite+0x77>
+    return pipewrite(f->pipe, addr, n);
+80101054:	83 ec 04             	sub    $0x4,%esp
+80101057:	ff 75 10             	push   0x10(%ebp)
+8010105a:	ff 75 0c             	push   0xc(%ebp)
+8010105d:	ff 77 0c             	push   0xc(%edi)
+80101060:	e8 3e 29 00 00       	call   801039a3 <pipewrite>
+80101065:	83 c4 10             	add    $0x10,%esp
+80101068:	e9 87 00 00 00       	jmp    801010f4 <filewrite+0xd7>
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+8010106d:	01 47 14             	add    %eax,0x14(%edi)
+      iunlock(f->ip);
+80101070:	83 ec 0c             	sub    $0xc,%esp
+80101073:	ff 77 10             	push   0x10(%edi)
+80101076:	e8 6f 06 00 00       	call   801016ea <iunlock>
+      end_op();
+8010107b:	e8 44 1f 00 00       	call   80102fc4 <end_op>
+80101080:	83 c4 10             	add    $0x10,%esp
+
+      if(r < 0)
+        break;
+      if(r != n1)
+80101083:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101086:	39 c6                	cmp    %eax,%esi
+80101088:	75 72                	jne    801010fc <filewrite+0xdf>
+        panic("short filewrite");
+      i += r;
+8010108a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010108d:	01 c3                	add    %eax,%ebx
+    while(i < n){
+8010108f:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+80101092:	7e 54                	jle    801010e8 <filewrite+0xcb>
+      int n1 = n - i;
+80101094:	8b 75 10             	mov    0x10(%ebp),%esi
+80101097:	29 de                	sub    %ebx,%esi
+      if(n1 > max)
+80101099:	b8 00 06 00 00       	mov    $0x600,%eax
+8010109e:	39 c6                	cmp    %eax,%esi
+801010a0:	0f 4f f0             	cmovg  %eax,%esi
+      begin_op();
+801010a3:	e8 a1 1e 00 00       	call   80102f49 <begin_op>
+      ilock(f->ip);
+801010a8:	83 ec 0c             	sub    $0xc,%esp
+801010ab:	ff 77 10             	push   0x10(%edi)
+801010ae:	e8 75 05 00 00       	call   80101628 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+801010b3:	56                   	push   %esi
+801010b4:	ff 77 14             	push   0x14(%edi)
+801010b7:	89 d8                	mov    %ebx,%eax
+801010b9:	03 45 0c             	add    0xc(%ebp),%eax
+801010bc:	50                   	push   %eax
+801010bd:	ff 77 10             	push   0x10(%edi)
+801010c0:	e8 62 09 00 00       	call   80101a27 <writei>
+801010c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801010c8:	83 c4 20             	add    $0x20,%esp
+801010cb:	85 c0                	test   %eax,%eax
+801010cd:	7f 9e                	jg     8010106d <filewrite+0x50>
+      iunlock(f->ip);
+801010cf:	83 ec 0c             	sub    $0xc,%esp
+801010d2:	ff 77 10             	push   0x10(%edi)
+801010d5:	e8 10 06 00 00       	call   801016ea <iunlock>
+      end_op();
+801010da:	e8 e5 1e 00 00       	call   80102fc4 <end_op>
+      if(r < 0)
+801010df:	83 c4 10             	add    $0x10,%esp
+801010e2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801010e6:	79 9b                	jns    80101083 <filewrite+0x66>
+    }
+    return i == n ? n : -1;
+801010e8:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+801010eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801010f0:	0f 44 45 10          	cmove  0x10(%ebp),%eax
+  }
+  panic("filewrite");
+}
+801010f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010f7:	5b                   	pop    %ebx
+801010f8:	5e                   	pop    %esi
+801010f9:	5f                   	pop    %edi
+801010fa:	5d                   	pop    %ebp
+801010fb:	c3                   	ret
+        panic("short filewrite");
+801010fc:	83 ec 0c             	sub    $0xc,%esp
+801010ff:	68 57 ae 10 80       	push   $0x8010ae57
+80101104:	e8 39 f2 ff ff       	call   80100342 <panic>
+    int i = 0;
+80101109:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010110e:	eb d8                	jmp    801010e8 <filewrite+0xcb>
+  panic("filewrite");
+80101110:	83 ec 0c             	sub    $0xc,%esp
+80101113:	68 5d ae 10 80       	push   $0x8010ae5d
+80101118:	e8 25 f2 ff ff       	call   80100342 <panic>
+    return -1;
+8010111d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101122:	eb d0                	jmp    801010f4 <filewrite+0xd7>
+
+80101124 <balloc>:
+// Blocks.
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+80101124:	55                   	push   %ebp
+80101125:	89 e5                	mov    %esp,%ebp
+80101127:	57                   	push   %edi
+80101128:	56                   	push   %esi
+80101129:	53                   	push   %ebx
+8010112a:	83 ec 1c             	sub    $0x1c,%esp
+8010112d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  int b, bi, m;
+  struct buf *bp;
+
+  bp = 0;
+  for(b = 0; b < sb.size; b += BPB){
+80101130:	83 3d 44 57 11 80 00 	cmpl   $0x0,0x80115744
+80101137:	0f 84 9d 00 00 00    	je     801011da <balloc+0xb6>
+8010113d:	bf 00 00 00 00       	mov    $0x0,%edi
+80101142:	eb 1f                	jmp    80101163 <balloc+0x3f>
+        brelse(bp);
+        bzero(dev, b + bi);
+        return b + bi;
+      }
+    }
+    brelse(bp);
+80101144:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80101147:	83 ec 0c             	sub    $0xc,%esp
+8010114a:	ff 75 e4             	push   -0x1c(%ebp)
+8010114d:	e8 6f f0 ff ff       	call   801001c1 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80101152:	81 c7 00 10 00 00    	add    $0x1000,%edi
+80101158:	83 c4 10             	add    $0x10,%esp
+8010115b:	3b 3d 44 57 11 80    	cmp    0x80115744,%edi
+80101161:	73 77                	jae    801011da <balloc+0xb6>
+    bp = bread(dev, BBLOCK(b, sb));
+80101163:	83 ec 08             	sub    $0x8,%esp
+80101166:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+8010116c:	85 ff                	test   %edi,%edi
+8010116e:	0f 49 c7             	cmovns %edi,%eax
+80101171:	c1 f8 0c             	sar    $0xc,%eax
+80101174:	03 05 5c 57 11 80    	add    0x8011575c,%eax
+8010117a:	50                   	push   %eax
+8010117b:	ff 75 dc             	push   -0x24(%ebp)
+8010117e:	e8 27 ef ff ff       	call   801000aa <bread>
+80101183:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101186:	a1 44 57 11 80       	mov    0x80115744,%eax
+8010118b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010118e:	89 fe                	mov    %edi,%esi
+80101190:	83 c4 10             	add    $0x10,%esp
+80101193:	b8 00 00 00 00       	mov    $0x0,%eax
+80101198:	89 7d d8             	mov    %edi,-0x28(%ebp)
+8010119b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010119e:	39 fe                	cmp    %edi,%esi
+801011a0:	73 a2                	jae    80101144 <balloc+0x20>
+      m = 1 << (bi % 8);
+801011a2:	89 c1                	mov    %eax,%ecx
+801011a4:	83 e1 07             	and    $0x7,%ecx
+801011a7:	bb 01 00 00 00       	mov    $0x1,%ebx
+801011ac:	d3 e3                	shl    %cl,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+801011ae:	8d 50 07             	lea    0x7(%eax),%edx
+801011b1:	85 c0                	test   %eax,%eax
+801011b3:	0f 49 d0             	cmovns %eax,%edx
+801011b6:	c1 fa 03             	sar    $0x3,%edx
+801011b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801011bc:	0f b6 4c 17 5c       	movzbl 0x5c(%edi,%edx,1),%ecx
+801011c1:	0f b6 f9             	movzbl %cl,%edi
+801011c4:	85 df                	test   %ebx,%edi
+801011c6:	74 1f                	je     801011e7 <balloc+0xc3>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+801011c8:	83 c0 01             	add    $0x1,%eax
+801011cb:	83 c6 01             	add    $0x1,%esi
+801011ce:	3d 00 10 00 00       	cmp    $0x1000,%eax
+801011d3:	75 c6                	jne    8010119b <balloc+0x77>
+801011d5:	e9 6a ff ff ff       	jmp    80101144 <balloc+0x20>
+  }
+  panic("balloc: out of blocks");
+801011da:	83 ec 0c             	sub    $0xc,%esp
+801011dd:	68 67 ae 10 80       	push   $0x8010ae67
+801011e2:	e8 5b f1 ff ff       	call   80100342 <panic>
+        bp->data[bi/8] |= m;  // Mark block in use.
+801011e7:	09 d9                	or     %ebx,%ecx
+801011e9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801011ec:	88 4c 13 5c          	mov    %cl,0x5c(%ebx,%edx,1)
+        log_write(bp);
+801011f0:	83 ec 0c             	sub    $0xc,%esp
+801011f3:	53                   	push   %ebx
+801011f4:	e8 0d 1f 00 00       	call   80103106 <log_write>
+        brelse(bp);
+801011f9:	89 1c 24             	mov    %ebx,(%esp)
+801011fc:	e8 c0 ef ff ff       	call   801001c1 <brelse>
+  bp = bread(dev, bno);
+80101201:	83 c4 08             	add    $0x8,%esp
+80101204:	56                   	push   %esi
+80101205:	ff 75 dc             	push   -0x24(%ebp)
+80101208:	e8 9d ee ff ff       	call   801000aa <bread>
+8010120d:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+8010120f:	83 c4 0c             	add    $0xc,%esp
+80101212:	68 00 02 00 00       	push   $0x200
+80101217:	6a 00                	push   $0x0
+80101219:	8d 40 5c             	lea    0x5c(%eax),%eax
+8010121c:	50                   	push   %eax
+8010121d:	e8 3b 64 00 00       	call   8010765d <memset>
+  log_write(bp);
+80101222:	89 1c 24             	mov    %ebx,(%esp)
+80101225:	e8 dc 1e 00 00       	call   80103106 <log_write>
+  brelse(bp);
+8010122a:	89 1c 24             	mov    %ebx,(%esp)
+8010122d:	e8 8f ef ff ff       	call   801001c1 <brelse>
+}
+80101232:	89 f0                	mov    %esi,%eax
+80101234:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101237:	5b                   	pop    %ebx
+80101238:	5e                   	pop    %esi
+80101239:	5f                   	pop    %edi
+8010123a:	5d                   	pop    %ebp
+8010123b:	c3                   	ret
+
+8010123c <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+8010123c:	55                   	push   %ebp
+8010123d:	89 e5                	mov    %esp,%ebp
+8010123f:	57                   	push   %edi
+80101240:	56                   	push   %esi
+80101241:	53                   	push   %ebx
+80101242:	83 ec 1c             	sub    $0x1c,%esp
+80101245:	89 c3                	mov    %eax,%ebx
+80101247:	89 d7                	mov    %edx,%edi
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+80101249:	83 fa 0b             	cmp    $0xb,%edx
+8010124c:	76 45                	jbe    80101293 <bmap+0x57>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+8010124e:	8d 72 f4             	lea    -0xc(%edx),%esi
+
+  if(bn < NINDIRECT){
+80101251:	83 fe 7f             	cmp    $0x7f,%esi
+80101254:	77 7f                	ja     801012d5 <bmap+0x99>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101256:	8b 80 94 00 00 00    	mov    0x94(%eax),%eax
+8010125c:	85 c0                	test   %eax,%eax
+8010125e:	74 4a                	je     801012aa <bmap+0x6e>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+80101260:	83 ec 08             	sub    $0x8,%esp
+80101263:	50                   	push   %eax
+80101264:	ff 33                	push   (%ebx)
+80101266:	e8 3f ee ff ff       	call   801000aa <bread>
+8010126b:	89 c7                	mov    %eax,%edi
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+8010126d:	8d 44 b0 5c          	lea    0x5c(%eax,%esi,4),%eax
+80101271:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101274:	8b 30                	mov    (%eax),%esi
+80101276:	83 c4 10             	add    $0x10,%esp
+80101279:	85 f6                	test   %esi,%esi
+8010127b:	74 3c                	je     801012b9 <bmap+0x7d>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+8010127d:	83 ec 0c             	sub    $0xc,%esp
+80101280:	57                   	push   %edi
+80101281:	e8 3b ef ff ff       	call   801001c1 <brelse>
+    return addr;
+80101286:	83 c4 10             	add    $0x10,%esp
+  }
+
+  panic("bmap: out of range");
+}
+80101289:	89 f0                	mov    %esi,%eax
+8010128b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010128e:	5b                   	pop    %ebx
+8010128f:	5e                   	pop    %esi
+80101290:	5f                   	pop    %edi
+80101291:	5d                   	pop    %ebp
+80101292:	c3                   	ret
+    if((addr = ip->addrs[bn]) == 0)
+80101293:	8b 74 90 64          	mov    0x64(%eax,%edx,4),%esi
+80101297:	85 f6                	test   %esi,%esi
+80101299:	75 ee                	jne    80101289 <bmap+0x4d>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+8010129b:	8b 00                	mov    (%eax),%eax
+8010129d:	e8 82 fe ff ff       	call   80101124 <balloc>
+801012a2:	89 c6                	mov    %eax,%esi
+801012a4:	89 44 bb 64          	mov    %eax,0x64(%ebx,%edi,4)
+801012a8:	eb df                	jmp    80101289 <bmap+0x4d>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+801012aa:	8b 03                	mov    (%ebx),%eax
+801012ac:	e8 73 fe ff ff       	call   80101124 <balloc>
+801012b1:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+801012b7:	eb a7                	jmp    80101260 <bmap+0x24>
+      a[bn] = addr = balloc(ip->dev);
+801012b9:	8b 03                	mov    (%ebx),%eax
+801012bb:	e8 64 fe ff ff       	call   80101124 <balloc>
+801012c0:	89 c6                	mov    %eax,%esi
+801012c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801012c5:	89 30                	mov    %esi,(%eax)
+      log_write(bp);
+801012c7:	83 ec 0c             	sub    $0xc,%esp
+801012ca:	57                   	push   %edi
+801012cb:	e8 36 1e 00 00       	call   80103106 <log_write>
+801012d0:	83 c4 10             	add    $0x10,%esp
+801012d3:	eb a8                	jmp    8010127d <bmap+0x41>
+  panic("bmap: out of range");
+801012d5:	83 ec 0c             	sub    $0xc,%esp
+801012d8:	68 7d ae 10 80       	push   $0x8010ae7d
+801012dd:	e8 60 f0 ff ff       	call   80100342 <panic>
+
+801012e2 <iget>:
+{
+801012e2:	55                   	push   %ebp
+801012e3:	89 e5                	mov    %esp,%ebp
+801012e5:	57                   	push   %edi
+801012e6:	56                   	push   %esi
+801012e7:	53                   	push   %ebx
+801012e8:	83 ec 28             	sub    $0x28,%esp
+801012eb:	89 c7                	mov    %eax,%edi
+801012ed:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+801012f0:	68 60 39 11 80       	push   $0x80113960
+801012f5:	e8 b5 62 00 00       	call   801075af <acquire>
+801012fa:	83 c4 10             	add    $0x10,%esp
+  empty = 0;
+801012fd:	be 00 00 00 00       	mov    $0x0,%esi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101302:	bb 94 39 11 80       	mov    $0x80113994,%ebx
+80101307:	eb 13                	jmp    8010131c <iget+0x3a>
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101309:	09 f0                	or     %esi,%eax
+8010130b:	0f 44 f3             	cmove  %ebx,%esi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010130e:	81 c3 98 00 00 00    	add    $0x98,%ebx
+80101314:	81 fb 44 57 11 80    	cmp    $0x80115744,%ebx
+8010131a:	74 2d                	je     80101349 <iget+0x67>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+8010131c:	8b 43 08             	mov    0x8(%ebx),%eax
+8010131f:	85 c0                	test   %eax,%eax
+80101321:	7e e6                	jle    80101309 <iget+0x27>
+80101323:	39 3b                	cmp    %edi,(%ebx)
+80101325:	75 e7                	jne    8010130e <iget+0x2c>
+80101327:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010132a:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+8010132d:	75 df                	jne    8010130e <iget+0x2c>
+      ip->ref++;
+8010132f:	83 c0 01             	add    $0x1,%eax
+80101332:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+80101335:	83 ec 0c             	sub    $0xc,%esp
+80101338:	68 60 39 11 80       	push   $0x80113960
+8010133d:	e8 d4 62 00 00       	call   80107616 <release>
+      return ip;
+80101342:	83 c4 10             	add    $0x10,%esp
+80101345:	89 de                	mov    %ebx,%esi
+80101347:	eb 36                	jmp    8010137f <iget+0x9d>
+  if(empty == 0)
+80101349:	85 f6                	test   %esi,%esi
+8010134b:	74 3c                	je     80101389 <iget+0xa7>
+  ip->dev = dev;
+8010134d:	89 3e                	mov    %edi,(%esi)
+  ip->inum = inum;
+8010134f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101352:	89 46 04             	mov    %eax,0x4(%esi)
+  ip->ref = 1;
+80101355:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+  ip->valid = 0;
+8010135c:	c7 46 50 00 00 00 00 	movl   $0x0,0x50(%esi)
+  ip->pcached = pcheld(dev, inum);  // pages from its last time here
+80101363:	83 ec 08             	sub    $0x8,%esp
+80101366:	50                   	push   %eax
+80101367:	57                   	push   %edi
+80101368:	e8 70 24 00 00       	call   801037dd <pcheld>
+8010136d:	89 46 54             	mov    %eax,0x54(%esi)
+  release(&icache.lock);
+80101370:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+80101377:	e8 9a 62 00 00       	call   80107616 <release>
+  return ip;
+8010137c:	83 c4 10             	add    $0x10,%esp
+}
+8010137f:	89 f0                	mov    %esi,%eax
+80101381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101384:	5b                   	pop    %ebx
+80101385:	5e                   	pop    %esi
+80101386:	5f                   	pop    %edi
+80101387:	5d                   	pop    %ebp
+80101388:	c3                   	ret
+    panic("iget: no inodes");
+80101389:	83 ec 0c             	sub    $0xc,%esp
+8010138c:	68 90 ae 10 80       	push   $0x8010ae90
+80101391:	e8 ac ef ff ff       	call   80100342 <panic>
+
+80101396 <readsb>:
+{
+80101396:	55                   	push   %ebp
+80101397:	89 e5                	mov    %esp,%ebp
+80101399:	53                   	push   %ebx
+8010139a:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, 1);
+8010139d:	6a 01                	push   $0x1
+8010139f:	ff 75 08             	push   0x8(%ebp)
+801013a2:	e8 03 ed ff ff       	call   801000aa <bread>
+801013a7:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+801013a9:	83 c4 0c             	add    $0xc,%esp
+801013ac:	6a 1c                	push   $0x1c
+801013ae:	8d 40 5c             	lea    0x5c(%eax),%eax
+801013b1:	50                   	push   %eax
+801013b2:	ff 75 0c             	push   0xc(%ebp)
+801013b5:	e8 1a 63 00 00       	call   801076d4 <memmove>
+  brelse(bp);
+801013ba:	89 1c 24             	mov    %ebx,(%esp)
+801013bd:	e8 ff ed ff ff       	call   801001c1 <brelse>
+}
+801013c2:	83 c4 10             	add    $0x10,%esp
+801013c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801013c8:	c9                   	leave
+801013c9:	c3                   	ret
+
+801013ca <bfree>:
+{
+801013ca:	55                   	push   %ebp
+801013cb:	89 e5                	mov    %esp,%ebp
+801013cd:	56                   	push   %esi
+801013ce:	53                   	push   %ebx
+801013cf:	89 c6                	mov    %eax,%esi
+801013d1:	89 d3                	mov    %edx,%ebx
+  readsb(dev, &sb);
+801013d3:	83 ec 08             	sub    $0x8,%esp
+801013d6:	68 44 57 11 80       	push   $0x80115744
+801013db:	50                   	push   %eax
+801013dc:	e8 b5 ff ff ff       	call   80101396 <readsb>
+  bp = bread(dev, BBLOCK(b, sb));
+801013e1:	83 c4 08             	add    $0x8,%esp
+801013e4:	89 d8                	mov    %ebx,%eax
+801013e6:	c1 e8 0c             	shr    $0xc,%eax
+801013e9:	03 05 5c 57 11 80    	add    0x8011575c,%eax
+801013ef:	50                   	push   %eax
+801013f0:	56                   	push   %esi
+801013f1:	e8 b4 ec ff ff       	call   801000aa <bread>
+801013f6:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+801013f8:	89 d9                	mov    %ebx,%ecx
+801013fa:	83 e1 07             	and    $0x7,%ecx
+801013fd:	b8 01 00 00 00       	mov    $0x1,%eax
+80101402:	d3 e0                	shl    %cl,%eax
+  bi = b % BPB;
+80101404:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if((bp->data[bi/8] & m) == 0)
+8010140a:	83 c4 10             	add    $0x10,%esp
+8010140d:	c1 fb 03             	sar    $0x3,%ebx
+80101410:	0f b6 54 1e 5c       	movzbl 0x5c(%esi,%ebx,1),%edx
+80101415:	0f b6 ca             	movzbl %dl,%ecx
+80101418:	85 c1                	test   %eax,%ecx
+8010141a:	74 23                	je     8010143f <bfree+0x75>
+  bp->data[bi/8] &= ~m;
+8010141c:	f7 d0                	not    %eax
+8010141e:	21 d0                	and    %edx,%eax
+80101420:	88 44 1e 5c          	mov    %al,0x5c(%esi,%ebx,1)
+  log_write(bp);
+80101424:	83 ec 0c             	sub    $0xc,%esp
+80101427:	56                   	push   %esi
+80101428:	e8 d9 1c 00 00       	call   80103106 <log_write>
+  brelse(bp);
+8010142d:	89 34 24             	mov    %esi,(%esp)
+80101430:	e8 8c ed ff ff       	call   801001c1 <brelse>
+}
+80101435:	83 c4 10             	add    $0x10,%esp
+80101438:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010143b:	5b                   	pop    %ebx
+8010143c:	5e                   	pop    %esi
+8010143d:	5d                   	pop    %ebp
+8010143e:	c3                   	ret
+    panic("freeing free block");
+8010143f:	83 ec 0c             	sub    $0xc,%esp
+80101442:	68 a0 ae 10 80       	push   $0x8010aea0
+80101447:	e8 f6 ee ff ff       	call   80100342 <panic>
+
+8010144c <iinit>:
+{
+8010144c:	55                   	push   %ebp
+8010144d:	89 e5                	mov    %esp,%ebp
+8010144f:	56                   	push   %esi
+80101450:	53                   	push   %ebx
+  initlock(&icache.lock, "icache");
+80101451:	83 ec 08             	sub    $0x8,%esp
+80101454:	68 b3 ae 10 80       	push   $0x8010aeb3
+80101459:	68 60 39 11 80       	push   $0x80113960
+8010145e:	e8 01 60 00 00       	call   80107464 <initlock>
+  for(i = 0; i < NINODE; i++) {
+80101463:	bb a4 39 11 80       	mov    $0x801139a4,%ebx
+80101468:	be 54 57 11 80       	mov    $0x80115754,%esi
+8010146d:	83 c4 10             	add    $0x10,%esp
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101470:	83 ec 08             	sub    $0x8,%esp
+80101473:	68 ba ae 10 80       	push   $0x8010aeba
+80101478:	53                   	push   %ebx
+80101479:	e8 ff 5e 00 00       	call   8010737d <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+8010147e:	81 c3 98 00 00 00    	add    $0x98,%ebx
+80101484:	83 c4 10             	add    $0x10,%esp
+80101487:	39 f3                	cmp    %esi,%ebx
+80101489:	75 e5                	jne    80101470 <iinit+0x24>
+  readsb(dev, &sb);
+8010148b:	83 ec 08             	sub    $0x8,%esp
+8010148e:	68 44 57 11 80       	push   $0x80115744
+80101493:	ff 75 08             	push   0x8(%ebp)
+80101496:	e8 fb fe ff ff       	call   80101396 <readsb>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+8010149b:	ff 35 5c 57 11 80    	push   0x8011575c
+801014a1:	ff 35 58 57 11 80    	push   0x80115758
+801014a7:	ff 35 54 57 11 80    	push   0x80115754
+801014ad:	ff 35 50 57 11 80    	push   0x80115750
+801014b3:	ff 35 4c 57 11 80    	push   0x8011574c
+801014b9:	ff 35 48 57 11 80    	push   0x80115748
+801014bf:	ff 35 44 57 11 80    	push   0x80115744
+801014c5:	68 20 af 10 80       	push   $0x8010af20
+801014ca:	e8 35 f1 ff ff       	call   80100604 <cprintf>
+}
+801014cf:	83 c4 30             	add    $0x30,%esp
+801014d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801014d5:	5b                   	pop    %ebx
+801014d6:	5e                   	pop    %esi
+801014d7:	5d                   	pop    %ebp
+801014d8:	c3                   	ret
+
+801014d9 <ialloc>:
+{
+801014d9:	55                   	push   %ebp
+801014da:	89 e5                	mov    %esp,%ebp
+801014dc:	57                   	push   %edi
+801014dd:	56                   	push   %esi
+801014de:	53                   	push   %ebx
+801014df:	83 ec 1c             	sub    $0x1c,%esp
+801014e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+801014e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+801014e8:	83 3d 4c 57 11 80 01 	cmpl   $0x1,0x8011574c
+801014ef:	76 4a                	jbe    8010153b <ialloc+0x62>
+801014f1:	be 01 00 00 00       	mov    $0x1,%esi
+    bp = bread(dev, IBLOCK(inum, sb));
+801014f6:	83 ec 08             	sub    $0x8,%esp
+801014f9:	89 f0                	mov    %esi,%eax
+801014fb:	c1 e8 03             	shr    $0x3,%eax
+801014fe:	03 05 58 57 11 80    	add    0x80115758,%eax
+80101504:	50                   	push   %eax
+80101505:	ff 75 08             	push   0x8(%ebp)
+80101508:	e8 9d eb ff ff       	call   801000aa <bread>
+8010150d:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + inum%IPB;
+8010150f:	89 f0                	mov    %esi,%eax
+80101511:	83 e0 07             	and    $0x7,%eax
+80101514:	c1 e0 06             	shl    $0x6,%eax
+80101517:	8d 7c 03 5c          	lea    0x5c(%ebx,%eax,1),%edi
+    if(dip->type == 0){  // a free inode
+8010151b:	83 c4 10             	add    $0x10,%esp
+8010151e:	66 83 3f 00          	cmpw   $0x0,(%edi)
+80101522:	74 24                	je     80101548 <ialloc+0x6f>
+    brelse(bp);
+80101524:	83 ec 0c             	sub    $0xc,%esp
+80101527:	53                   	push   %ebx
+80101528:	e8 94 ec ff ff       	call   801001c1 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010152d:	83 c6 01             	add    $0x1,%esi
+80101530:	83 c4 10             	add    $0x10,%esp
+80101533:	3b 35 4c 57 11 80    	cmp    0x8011574c,%esi
+80101539:	72 bb                	jb     801014f6 <ialloc+0x1d>
+  panic("ialloc: no inodes");
+8010153b:	83 ec 0c             	sub    $0xc,%esp
+8010153e:	68 c0 ae 10 80       	push   $0x8010aec0
+80101543:	e8 fa ed ff ff       	call   80100342 <panic>
+      memset(dip, 0, sizeof(*dip));
+80101548:	83 ec 04             	sub    $0x4,%esp
+8010154b:	6a 40                	push   $0x40
+8010154d:	6a 00                	push   $0x0
+8010154f:	57                   	push   %edi
+80101550:	e8 08 61 00 00       	call   8010765d <memset>
+      dip->type = type;
+80101555:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80101559:	66 89 07             	mov    %ax,(%edi)
+      log_write(bp);   // mark it allocated on the disk
+8010155c:	89 1c 24             	mov    %ebx,(%esp)
+8010155f:	e8 a2 1b 00 00       	call   80103106 <log_write>
+      brelse(bp);
+80101564:	89 1c 24             	mov    %ebx,(%esp)
+80101567:	e8 55 ec ff ff       	call   801001c1 <brelse>
+      return iget(dev, inum);
+8010156c:	89 f2                	mov    %esi,%edx
+8010156e:	8b 45 08             	mov    0x8(%ebp),%eax
+80101571:	e8 6c fd ff ff       	call   801012e2 <iget>
+}
+80101576:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101579:	5b                   	pop    %ebx
+8010157a:	5e                   	pop    %esi
+8010157b:	5f                   	pop    %edi
+8010157c:	5d                   	pop    %ebp
+8010157d:	c3                   	ret
+
+8010157e <iupdate>:
+{
+8010157e:	55                   	push   %ebp
+8010157f:	89 e5                	mov    %esp,%ebp
+80101581:	56                   	push   %esi
+80101582:	53                   	push   %ebx
+80101583:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101586:	83 ec 08             	sub    $0x8,%esp
+80101589:	8b 43 04             	mov    0x4(%ebx),%eax
+8010158c:	c1 e8 03             	shr    $0x3,%eax
+8010158f:	03 05 58 57 11 80    	add    0x80115758,%eax
+80101595:	50                   	push   %eax
+80101596:	ff 33                	push   (%ebx)
+80101598:	e8 0d eb ff ff       	call   801000aa <bread>
+8010159d:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010159f:	8b 43 04             	mov    0x4(%ebx),%eax
+801015a2:	83 e0 07             	and    $0x7,%eax
+801015a5:	c1 e0 06             	shl    $0x6,%eax
+801015a8:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+  dip->type = ip->type;
+801015ac:	0f b7 53 58          	movzwl 0x58(%ebx),%edx
+801015b0:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+801015b3:	0f b7 53 5a          	movzwl 0x5a(%ebx),%edx
+801015b7:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dip->minor = ip->minor;
+801015bb:	0f b7 53 5c          	movzwl 0x5c(%ebx),%edx
+801015bf:	66 89 50 04          	mov    %dx,0x4(%eax)
+  dip->nlink = ip->nlink;
+801015c3:	0f b7 53 5e          	movzwl 0x5e(%ebx),%edx
+801015c7:	66 89 50 06          	mov    %dx,0x6(%eax)
+  dip->size = ip->size;
+801015cb:	8b 53 60             	mov    0x60(%ebx),%edx
+801015ce:	89 50 08             	mov    %edx,0x8(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801015d1:	83 c4 0c             	add    $0xc,%esp
+801015d4:	6a 34                	push   $0x34
+801015d6:	83 c3 64             	add    $0x64,%ebx
+801015d9:	53                   	push   %ebx
+801015da:	83 c0 0c             	add    $0xc,%eax
+801015dd:	50                   	push   %eax
+801015de:	e8 f1 60 00 00       	call   801076d4 <memmove>
+  log_write(bp);
+801015e3:	89 34 24             	mov    %esi,(%esp)
+801015e6:	e8 1b 1b 00 00       	call   80103106 <log_write>
+  brelse(bp);
+801015eb:	89 34 24             	mov    %esi,(%esp)
+801015ee:	e8 ce eb ff ff       	call   801001c1 <brelse>
+}
+801015f3:	83 c4 10             	add    $0x10,%esp
+801015f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801015f9:	5b                   	pop    %ebx
+801015fa:	5e                   	pop    %esi
+801015fb:	5d                   	pop    %ebp
+801015fc:	c3                   	ret
+
+801015fd <idup>:
+{
+801015fd:	55                   	push   %ebp
+801015fe:	89 e5                	mov    %esp,%ebp
+80101600:	53                   	push   %ebx
+80101601:	83 ec 10             	sub    $0x10,%esp
+80101604:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+80101607:	68 60 39 11 80       	push   $0x80113960
+8010160c:	e8 9e 5f 00 00       	call   801075af <acquire>
+  ip->ref++;
+80101611:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80101615:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+8010161c:	e8 f5 5f 00 00       	call   80107616 <release>
+}
+80101621:	89 d8                	mov    %ebx,%eax
+80101623:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101626:	c9                   	leave
+80101627:	c3                   	ret
+
+80101628 <ilock>:
+{
+80101628:	55                   	push   %ebp
+80101629:	89 e5                	mov    %esp,%ebp
+8010162b:	56                   	push   %esi
+8010162c:	53                   	push   %ebx
+8010162d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80101630:	85 db                	test   %ebx,%ebx
+80101632:	74 22                	je     80101656 <ilock+0x2e>
+80101634:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80101638:	7e 1c                	jle    80101656 <ilock+0x2e>
+  acquiresleep(&ip->lock);
+8010163a:	83 ec 0c             	sub    $0xc,%esp
+8010163d:	8d 43 10             	lea    0x10(%ebx),%eax
+80101640:	50                   	push   %eax
+80101641:	e8 6a 5d 00 00       	call   801073b0 <acquiresleep>
+  if(ip->valid == 0){
+80101646:	83 c4 10             	add    $0x10,%esp
+80101649:	83 7b 50 00          	cmpl   $0x0,0x50(%ebx)
+8010164d:	74 14                	je     80101663 <ilock+0x3b>
+}
+8010164f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101652:	5b                   	pop    %ebx
+80101653:	5e                   	pop    %esi
+80101654:	5d                   	pop    %ebp
+80101655:	c3                   	ret
+    panic("ilock");
+80101656:	83 ec 0c             	sub    $0xc,%esp
+80101659:	68 d2 ae 10 80       	push   $0x8010aed2
+8010165e:	e8 df ec ff ff       	call   80100342 <panic>
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101663:	83 ec 08             	sub    $0x8,%esp
+80101666:	8b 43 04             	mov    0x4(%ebx),%eax
+80101669:	c1 e8 03             	shr    $0x3,%eax
+8010166c:	03 05 58 57 11 80    	add    0x80115758,%eax
+80101672:	50                   	push   %eax
+80101673:	ff 33                	push   (%ebx)
+80101675:	e8 30 ea ff ff       	call   801000aa <bread>
+8010167a:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010167c:	8b 43 04             	mov    0x4(%ebx),%eax
+8010167f:	83 e0 07             	and    $0x7,%eax
+80101682:	c1 e0 06             	shl    $0x6,%eax
+80101685:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    ip->type = dip->type;
+80101689:	0f b7 10             	movzwl (%eax),%edx
+8010168c:	66 89 53 58          	mov    %dx,0x58(%ebx)
+    ip->major = dip->major;
+80101690:	0f b7 50 02          	movzwl 0x2(%eax),%edx
+80101694:	66 89 53 5a          	mov    %dx,0x5a(%ebx)
+    ip->minor = dip->minor;
+80101698:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+8010169c:	66 89 53 5c          	mov    %dx,0x5c(%ebx)
+    ip->nlink = dip->nlink;
+801016a0:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+801016a4:	66 89 53 5e          	mov    %dx,0x5e(%ebx)
+    ip->size = dip->size;
+801016a8:	8b 50 08             	mov    0x8(%eax),%edx
+801016ab:	89 53 60             	mov    %edx,0x60(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801016ae:	83 c4 0c             	add    $0xc,%esp
+801016b1:	6a 34                	push   $0x34
+801016b3:	83 c0 0c             	add    $0xc,%eax
+801016b6:	50                   	push   %eax
+801016b7:	8d 43 64             	lea    0x64(%ebx),%eax
+801016ba:	50                   	push   %eax
+801016bb:	e8 14 60 00 00       	call   801076d4 <memmove>
+    brelse(bp);
+801016c0:	89 34 24             	mov    %esi,(%esp)
+801016c3:	e8 f9 ea ff ff       	call   801001c1 <brelse>
+    ip->valid = 1;
+801016c8:	c7 43 50 01 00 00 00 	movl   $0x1,0x50(%ebx)
+    if(ip->type == 0)
+801016cf:	83 c4 10             	add    $0x10,%esp
+801016d2:	66 83 7b 58 00       	cmpw   $0x0,0x58(%ebx)
+801016d7:	0f 85 72 ff ff ff    	jne    8010164f <ilock+0x27>
+      panic("ilock: no type");
+801016dd:	83 ec 0c             	sub    $0xc,%esp
+801016e0:	68 d8 ae 10 80       	push   $0x8010aed8
+801016e5:	e8 58 ec ff ff       	call   80100342 <panic>
+
+801016ea <iunlock>:
+{
+801016ea:	55                   	push   %ebp
+801016eb:	89 e5                	mov    %esp,%ebp
+801016ed:	56                   	push   %esi
+801016ee:	53                   	push   %ebx
+801016ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801016f2:	85 db                	test   %ebx,%ebx
+801016f4:	74 2c                	je     80101722 <iunlock+0x38>
+801016f6:	8d 73 10             	lea    0x10(%ebx),%esi
+801016f9:	83 ec 0c             	sub    $0xc,%esp
+801016fc:	56                   	push   %esi
+801016fd:	e8 3b 5d 00 00       	call   8010743d <holdingsleep>
+80101702:	83 c4 10             	add    $0x10,%esp
+80101705:	85 c0                	test   %eax,%eax
+80101707:	74 19                	je     80101722 <iunlock+0x38>
+80101709:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+8010170d:	7e 13                	jle    80101722 <iunlock+0x38>
+  releasesleep(&ip->lock);
+8010170f:	83 ec 0c             	sub    $0xc,%esp
+80101712:	56                   	push   %esi
+80101713:	e8 ea 5c 00 00       	call   80107402 <releasesleep>
+}
+80101718:	83 c4 10             	add    $0x10,%esp
+8010171b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010171e:	5b                   	pop    %ebx
+8010171f:	5e                   	pop    %esi
+80101720:	5d                   	pop    %ebp
+80101721:	c3                   	ret
+    panic("iunlock");
+80101722:	83 ec 0c             	sub    $0xc,%esp
+80101725:	68 e7 ae 10 80       	push   $0x8010aee7
+8010172a:	e8 13 ec ff ff       	call   80100342 <panic>
+
+8010172f <iput>:
+{
+8010172f:	55                   	push   %ebp
+80101730:	89 e5                	mov    %esp,%ebp
+80101732:	57                   	push   %edi
+80101733:	56                   	push   %esi
+80101734:	53                   	push   %ebx
+80101735:	83 ec 28             	sub    $0x28,%esp
+80101738:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010173b:	8d 7b 10             	lea    0x10(%ebx),%edi
+8010173e:	57                   	push   %edi
+8010173f:	e8 6c 5c 00 00       	call   801073b0 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80101744:	83 c4 10             	add    $0x10,%esp
+80101747:	83 7b 50 00          	cmpl   $0x0,0x50(%ebx)
+8010174b:	74 07                	je     80101754 <iput+0x25>
+8010174d:	66 83 7b 5e 00       	cmpw   $0x0,0x5e(%ebx)
+80101752:	74 30                	je     80101784 <iput+0x55>
+  releasesleep(&ip->lock);
+80101754:	83 ec 0c             	sub    $0xc,%esp
+80101757:	57                   	push   %edi
+80101758:	e8 a5 5c 00 00       	call   80107402 <releasesleep>
+  acquire(&icache.lock);
+8010175d:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+80101764:	e8 46 5e 00 00       	call   801075af <acquire>
+  ip->ref--;
+80101769:	83 6b 08 01          	subl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+8010176d:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+80101774:	e8 9d 5e 00 00       	call   80107616 <release>
+}
+80101779:	83 c4 10             	add    $0x10,%esp
+8010177c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010177f:	5b                   	pop    %ebx
+80101780:	5e                   	pop    %esi
+80101781:	5f                   	pop    %edi
+80101782:	5d                   	pop    %ebp
+80101783:	c3                   	ret
+    acquire(&icache.lock);
+80101784:	83 ec 0c             	sub    $0xc,%esp
+80101787:	68 60 39 11 80       	push   $0x80113960
+8010178c:	e8 1e 5e 00 00       	call   801075af <acquire>
+    int r = ip->ref;
+80101791:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+80101794:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+8010179b:	e8 76 5e 00 00       	call   80107616 <release>
+    if(r == 1){
+801017a0:	83 c4 10             	add    $0x10,%esp
+801017a3:	83 fe 01             	cmp    $0x1,%esi
+801017a6:	75 ac                	jne    80101754 <iput+0x25>
+{
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  pcinval(ip);
+801017a8:	83 ec 0c             	sub    $0xc,%esp
+801017ab:	53                   	push   %ebx
+801017ac:	e8 8e 1f 00 00       	call   8010373f <pcinval>
+  for(i = 0; i < NDIRECT; i++){
+801017b1:	8d 73 64             	lea    0x64(%ebx),%esi
+801017b4:	8d 83 94 00 00 00    	lea    0x94(%ebx),%eax
+801017ba:	83 c4 10             	add    $0x10,%esp
+801017bd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801017c0:	89 c7                	mov    %eax,%edi
+801017c2:	eb 07                	jmp    801017cb <iput+0x9c>
+801017c4:	83 c6 04             	add    $0x4,%esi
+801017c7:	39 fe                	cmp    %edi,%esi
+801017c9:	74 15                	je     801017e0 <iput+0xb1>
+    if(ip->addrs[i]){
+801017cb:	8b 16                	mov    (%esi),%edx
+801017cd:	85 d2                	test   %edx,%edx
+801017cf:	74 f3                	je     801017c4 <iput+0x95>
+      bfree(ip->dev, ip->addrs[i]);
+801017d1:	8b 03                	mov    (%ebx),%eax
+801017d3:	e8 f2 fb ff ff       	call   801013ca <bfree>
+      ip->addrs[i] = 0;
+801017d8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+801017de:	eb e4                	jmp    801017c4 <iput+0x95>
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+801017e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801017e3:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+801017e9:	85 c0                	test   %eax,%eax
+801017eb:	75 2d                	jne    8010181a <iput+0xeb>
+    brelse(bp);
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+801017ed:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+  iupdate(ip);
+801017f4:	83 ec 0c             	sub    $0xc,%esp
+801017f7:	53                   	push   %ebx
+801017f8:	e8 81 fd ff ff       	call   8010157e <iupdate>
+      ip->type = 0;
+801017fd:	66 c7 43 58 00 00    	movw   $0x0,0x58(%ebx)
+      iupdate(ip);
+80101803:	89 1c 24             	mov    %ebx,(%esp)
+80101806:	e8 73 fd ff ff       	call   8010157e <iupdate>
+      ip->valid = 0;
+8010180b:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+80101812:	83 c4 10             	add    $0x10,%esp
+80101815:	e9 3a ff ff ff       	jmp    80101754 <iput+0x25>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+8010181a:	83 ec 08             	sub    $0x8,%esp
+8010181d:	50                   	push   %eax
+8010181e:	ff 33                	push   (%ebx)
+80101820:	e8 85 e8 ff ff       	call   801000aa <bread>
+    for(j = 0; j < NINDIRECT; j++){
+80101825:	8d 70 5c             	lea    0x5c(%eax),%esi
+80101828:	8d 88 5c 02 00 00    	lea    0x25c(%eax),%ecx
+8010182e:	83 c4 10             	add    $0x10,%esp
+80101831:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101834:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101837:	89 cf                	mov    %ecx,%edi
+80101839:	eb 07                	jmp    80101842 <iput+0x113>
+8010183b:	83 c6 04             	add    $0x4,%esi
+8010183e:	39 fe                	cmp    %edi,%esi
+80101840:	74 0f                	je     80101851 <iput+0x122>
+      if(a[j])
+80101842:	8b 16                	mov    (%esi),%edx
+80101844:	85 d2                	test   %edx,%edx
+80101846:	74 f3                	je     8010183b <iput+0x10c>
+        bfree(ip->dev, a[j]);
+80101848:	8b 03                	mov    (%ebx),%eax
+8010184a:	e8 7b fb ff ff       	call   801013ca <bfree>
+8010184f:	eb ea                	jmp    8010183b <iput+0x10c>
+    brelse(bp);
+80101851:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101854:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101857:	83 ec 0c             	sub    $0xc,%esp
+8010185a:	50                   	push   %eax
+8010185b:	e8 61 e9 ff ff       	call   801001c1 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80101860:	8b 93 94 00 00 00    	mov    0x94(%ebx),%edx
+80101866:	8b 03                	mov    (%ebx),%eax
+80101868:	e8 5d fb ff ff       	call   801013ca <bfree>
+    ip->addrs[NDIRECT] = 0;
+8010186d:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+80101874:	00 00 00 
+80101877:	83 c4 10             	add    $0x10,%esp
+8010187a:	e9 6e ff ff ff       	jmp    801017ed <iput+0xbe>
+
+8010187f <iunlockput>:
+{
+8010187f:	55                   	push   %ebp
+80101880:	89 e5                	mov    %esp,%ebp
+80101882:	53                   	push   %ebx
+80101883:	83 ec 10             	sub    $0x10,%esp
+80101886:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iunlock(ip);
+80101889:	53                   	push   %ebx
+8010188a:	e8 5b fe ff ff       	call   801016ea <iunlock>
+  iput(ip);
+8010188f:	89 1c 24             	mov    %ebx,(%esp)
+80101892:	e8 98 fe ff ff       	call   8010172f <iput>
+}
+80101897:	83 c4 10             	add    $0x10,%esp
+8010189a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010189d:	c9                   	leave
+8010189e:	c3                   	ret
+
+8010189f <idupregion>:
+{
+8010189f:	55                   	push   %ebp
+801018a0:	89 e5                	mov    %esp,%ebp
+801018a2:	53                   	push   %ebx
+801018a3:	83 ec 10             	sub    $0x10,%esp
+801018a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+801018a9:	68 60 39 11 80       	push   $0x80113960
+801018ae:	e8 fc 5c 00 00       	call   801075af <acquire>
+  ip->ref++;
+801018b3:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  ip->nregion++;
+801018b7:	83 43 0c 01          	addl   $0x1,0xc(%ebx)
+  release(&icache.lock);
+801018bb:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+801018c2:	e8 4f 5d 00 00       	call   80107616 <release>
+}
+801018c7:	89 d8                	mov    %ebx,%eax
+801018c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801018cc:	c9                   	leave
+801018cd:	c3                   	ret
+
+801018ce <iputregion>:
+{
+801018ce:	55                   	push   %ebp
+801018cf:	89 e5                	mov    %esp,%ebp
+801018d1:	53                   	push   %ebx
+801018d2:	83 ec 10             	sub    $0x10,%esp
+801018d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+801018d8:	68 60 39 11 80       	push   $0x80113960
+801018dd:	e8 cd 5c 00 00       	call   801075af <acquire>
+  ip->nregion--;
+801018e2:	83 6b 0c 01          	subl   $0x1,0xc(%ebx)
+  release(&icache.lock);
+801018e6:	c7 04 24 60 39 11 80 	movl   $0x80113960,(%esp)
+801018ed:	e8 24 5d 00 00       	call   80107616 <release>
+  iput(ip);
+801018f2:	89 1c 24             	mov    %ebx,(%esp)
+801018f5:	e8 35 fe ff ff       	call   8010172f <iput>
+}
+801018fa:	83 c4 10             	add    $0x10,%esp
+801018fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101900:	c9                   	leave
+80101901:	c3                   	ret
+
+80101902 <stati>:
+
+// Copy stat information from inode.
+// Caller must hold ip->lock.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80101902:	55                   	push   %ebp
+80101903:	89 e5                	mov    %esp,%ebp
+80101905:	8b 55 08             	mov    0x8(%ebp),%edx
+80101908:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+8010190b:	8b 0a                	mov    (%edx),%ecx
+8010190d:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80101910:	8b 4a 04             	mov    0x4(%edx),%ecx
+80101913:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80101916:	0f b7 4a 58          	movzwl 0x58(%edx),%ecx
+8010191a:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+8010191d:	0f b7 4a 5e          	movzwl 0x5e(%edx),%ecx
+80101921:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80101925:	8b 52 60             	mov    0x60(%edx),%edx
+80101928:	89 50 10             	mov    %edx,0x10(%eax)
+}
+8010192b:	5d                   	pop    %ebp
+8010192c:	c3                   	ret
+
+8010192d <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+8010192d:	55                   	push   %ebp
+8010192e:	89 e5                	mov    %esp,%ebp
+80101930:	57                   	push   %edi
+80101931:	56                   	push   %esi
+80101932:	53                   	push   %ebx
+80101933:	83 ec 1c             	sub    $0x1c,%esp
+80101936:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80101939:	8b 7d 10             	mov    0x10(%ebp),%edi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+8010193c:	66 83 79 58 03       	cmpw   $0x3,0x58(%ecx)
+80101941:	0f 84 9d 00 00 00    	je     801019e4 <readi+0xb7>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101947:	8b 41 60             	mov    0x60(%ecx),%eax
+8010194a:	39 f8                	cmp    %edi,%eax
+8010194c:	0f 82 c7 00 00 00    	jb     80101a19 <readi+0xec>
+80101952:	89 fa                	mov    %edi,%edx
+80101954:	03 55 14             	add    0x14(%ebp),%edx
+80101957:	0f 82 c3 00 00 00    	jb     80101a20 <readi+0xf3>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+8010195d:	89 c3                	mov    %eax,%ebx
+8010195f:	29 fb                	sub    %edi,%ebx
+80101961:	39 d0                	cmp    %edx,%eax
+80101963:	0f 43 5d 14          	cmovae 0x14(%ebp),%ebx
+80101967:	89 5d 14             	mov    %ebx,0x14(%ebp)
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+8010196a:	85 db                	test   %ebx,%ebx
+8010196c:	74 6b                	je     801019d9 <readi+0xac>
+8010196e:	be 00 00 00 00       	mov    $0x0,%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101973:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101976:	89 fa                	mov    %edi,%edx
+80101978:	c1 ea 09             	shr    $0x9,%edx
+8010197b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010197e:	e8 b9 f8 ff ff       	call   8010123c <bmap>
+80101983:	83 ec 08             	sub    $0x8,%esp
+80101986:	50                   	push   %eax
+80101987:	8b 45 08             	mov    0x8(%ebp),%eax
+8010198a:	ff 30                	push   (%eax)
+8010198c:	e8 19 e7 ff ff       	call   801000aa <bread>
+80101991:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101993:	89 f8                	mov    %edi,%eax
+80101995:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010199a:	bb 00 02 00 00       	mov    $0x200,%ebx
+8010199f:	29 c3                	sub    %eax,%ebx
+801019a1:	8b 55 14             	mov    0x14(%ebp),%edx
+801019a4:	29 f2                	sub    %esi,%edx
+801019a6:	39 d3                	cmp    %edx,%ebx
+801019a8:	0f 47 da             	cmova  %edx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+801019ab:	83 c4 0c             	add    $0xc,%esp
+801019ae:	53                   	push   %ebx
+801019af:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801019b2:	8d 44 01 5c          	lea    0x5c(%ecx,%eax,1),%eax
+801019b6:	50                   	push   %eax
+801019b7:	ff 75 0c             	push   0xc(%ebp)
+801019ba:	e8 15 5d 00 00       	call   801076d4 <memmove>
+    brelse(bp);
+801019bf:	83 c4 04             	add    $0x4,%esp
+801019c2:	ff 75 e4             	push   -0x1c(%ebp)
+801019c5:	e8 f7 e7 ff ff       	call   801001c1 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801019ca:	01 de                	add    %ebx,%esi
+801019cc:	01 df                	add    %ebx,%edi
+801019ce:	01 5d 0c             	add    %ebx,0xc(%ebp)
+801019d1:	83 c4 10             	add    $0x10,%esp
+801019d4:	3b 75 14             	cmp    0x14(%ebp),%esi
+801019d7:	72 9d                	jb     80101976 <readi+0x49>
+  }
+  return n;
+801019d9:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+801019dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019df:	5b                   	pop    %ebx
+801019e0:	5e                   	pop    %esi
+801019e1:	5f                   	pop    %edi
+801019e2:	5d                   	pop    %ebp
+801019e3:	c3                   	ret
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+801019e4:	0f b7 41 5a          	movzwl 0x5a(%ecx),%eax
+801019e8:	66 83 f8 09          	cmp    $0x9,%ax
+801019ec:	77 1d                	ja     80101a0b <readi+0xde>
+801019ee:	98                   	cwtl
+801019ef:	8b 04 c5 00 39 11 80 	mov    -0x7feec700(,%eax,8),%eax
+801019f6:	85 c0                	test   %eax,%eax
+801019f8:	74 18                	je     80101a12 <readi+0xe5>
+    return devsw[ip->major].read(ip, dst, n);
+801019fa:	83 ec 04             	sub    $0x4,%esp
+801019fd:	ff 75 14             	push   0x14(%ebp)
+80101a00:	ff 75 0c             	push   0xc(%ebp)
+80101a03:	51                   	push   %ecx
+80101a04:	ff d0                	call   *%eax
+80101a06:	83 c4 10             	add    $0x10,%esp
+80101a09:	eb d1                	jmp    801019dc <readi+0xaf>
+      return -1;
+80101a0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101a10:	eb ca                	jmp    801019dc <readi+0xaf>
+80101a12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101a17:	eb c3                	jmp    801019dc <readi+0xaf>
+    return -1;
+80101a19:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101a1e:	eb bc                	jmp    801019dc <readi+0xaf>
+80101a20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101a25:	eb b5                	jmp    801019dc <readi+0xaf>
+
+80101a27 <writei>:
+// PAGEBREAK!
+// Write data to inode.
+// Caller must hold ip->lock.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+80101a27:	55                   	push   %ebp
+80101a28:	89 e5                	mov    %esp,%ebp
+80101a2a:	57                   	push   %edi
+80101a2b:	56                   	push   %esi
+80101a2c:	53                   	push   %ebx
+80101a2d:	83 ec 1c             	sub    $0x1c,%esp
+80101a30:	8b 7d 10             	mov    0x10(%ebp),%edi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80101a33:	8b 45 08             	mov    0x8(%ebp),%eax
+80101a36:	66 83 78 58 03       	cmpw   $0x3,0x58(%eax)
+80101a3b:	0f 84 c9 00 00 00    	je     80101b0a <writei+0xe3>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101a41:	8b 45 08             	mov    0x8(%ebp),%eax
+80101a44:	39 78 60             	cmp    %edi,0x60(%eax)
+80101a47:	0f 82 05 01 00 00    	jb     80101b52 <writei+0x12b>
+80101a4d:	89 f8                	mov    %edi,%eax
+80101a4f:	03 45 14             	add    0x14(%ebp),%eax
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+80101a52:	3d 00 18 01 00       	cmp    $0x11800,%eax
+80101a57:	0f 87 fc 00 00 00    	ja     80101b59 <writei+0x132>
+80101a5d:	39 f8                	cmp    %edi,%eax
+80101a5f:	0f 82 f4 00 00 00    	jb     80101b59 <writei+0x132>
+    return -1;
+  // A running program's text and data come from here.
+  if(ip->nregion > 0)
+80101a65:	8b 45 08             	mov    0x8(%ebp),%eax
+80101a68:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+80101a6c:	0f 8f ee 00 00 00    	jg     80101b60 <writei+0x139>
+    return -1;
+
+  pcinval(ip);
+80101a72:	83 ec 0c             	sub    $0xc,%esp
+80101a75:	50                   	push   %eax
+80101a76:	e8 c4 1c 00 00       	call   8010373f <pcinval>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101a7b:	83 c4 10             	add    $0x10,%esp
+80101a7e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+80101a82:	74 7b                	je     80101aff <writei+0xd8>
+80101a84:	be 00 00 00 00       	mov    $0x0,%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101a89:	89 fa                	mov    %edi,%edx
+80101a8b:	c1 ea 09             	shr    $0x9,%edx
+80101a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+80101a91:	e8 a6 f7 ff ff       	call   8010123c <bmap>
+80101a96:	83 ec 08             	sub    $0x8,%esp
+80101a99:	50                   	push   %eax
+80101a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+80101a9d:	ff 30                	push   (%eax)
+80101a9f:	e8 06 e6 ff ff       	call   801000aa <bread>
+80101aa4:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101aa6:	89 f8                	mov    %edi,%eax
+80101aa8:	25 ff 01 00 00       	and    $0x1ff,%eax
+80101aad:	bb 00 02 00 00       	mov    $0x200,%ebx
+80101ab2:	29 c3                	sub    %eax,%ebx
+80101ab4:	8b 55 14             	mov    0x14(%ebp),%edx
+80101ab7:	29 f2                	sub    %esi,%edx
+80101ab9:	39 d3                	cmp    %edx,%ebx
+80101abb:	0f 47 da             	cmova  %edx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80101abe:	83 c4 0c             	add    $0xc,%esp
+80101ac1:	53                   	push   %ebx
+80101ac2:	ff 75 0c             	push   0xc(%ebp)
+80101ac5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101ac8:	8d 44 01 5c          	lea    0x5c(%ecx,%eax,1),%eax
+80101acc:	50                   	push   %eax
+80101acd:	e8 02 5c 00 00       	call   801076d4 <memmove>
+    log_write(bp);
+80101ad2:	83 c4 04             	add    $0x4,%esp
+80101ad5:	ff 75 e4             	push   -0x1c(%ebp)
+80101ad8:	e8 29 16 00 00       	call   80103106 <log_write>
+    brelse(bp);
+80101add:	83 c4 04             	add    $0x4,%esp
+80101ae0:	ff 75 e4             	push   -0x1c(%ebp)
+80101ae3:	e8 d9 e6 ff ff       	call   801001c1 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101ae8:	01 de                	add    %ebx,%esi
+80101aea:	01 df                	add    %ebx,%edi
+80101aec:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80101aef:	83 c4 10             	add    $0x10,%esp
+80101af2:	3b 75 14             	cmp    0x14(%ebp),%esi
+80101af5:	72 92                	jb     80101a89 <writei+0x62>
+  }
+
+  if(n > 0 && off > ip->size){
+80101af7:	8b 45 08             	mov    0x8(%ebp),%eax
+80101afa:	39 78 60             	cmp    %edi,0x60(%eax)
+80101afd:	72 34                	jb     80101b33 <writei+0x10c>
+    ip->size = off;
+    iupdate(ip);
+  }
+  return n;
+80101aff:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80101b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b05:	5b                   	pop    %ebx
+80101b06:	5e                   	pop    %esi
+80101b07:	5f                   	pop    %edi
+80101b08:	5d                   	pop    %ebp
+80101b09:	c3                   	ret
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80101b0a:	0f b7 40 5a          	movzwl 0x5a(%eax),%eax
+80101b0e:	66 83 f8 09          	cmp    $0x9,%ax
+80101b12:	77 30                	ja     80101b44 <writei+0x11d>
+80101b14:	98                   	cwtl
+80101b15:	8b 04 c5 04 39 11 80 	mov    -0x7feec6fc(,%eax,8),%eax
+80101b1c:	85 c0                	test   %eax,%eax
+80101b1e:	74 2b                	je     80101b4b <writei+0x124>
+    return devsw[ip->major].write(ip, src, n);
+80101b20:	83 ec 04             	sub    $0x4,%esp
+80101b23:	ff 75 14             	push   0x14(%ebp)
+80101b26:	ff 75 0c             	push   0xc(%ebp)
+80101b29:	ff 75 08             	push   0x8(%ebp)
+80101b2c:	ff d0                	call   *%eax
+80101b2e:	83 c4 10             	add    $0x10,%esp
+80101b31:	eb cf                	jmp    80101b02 <writei+0xdb>
+    ip->size = off;
+80101b33:	89 78 60             	mov    %edi,0x60(%eax)
+    iupdate(ip);
+80101b36:	83 ec 0c             	sub    $0xc,%esp
+80101b39:	50                   	push   %eax
+80101b3a:	e8 3f fa ff ff       	call   8010157e <iupdate>
+80101b3f:	83 c4 10             	add    $0x10,%esp
+80101b42:	eb bb                	jmp    80101aff <writei+0xd8>
+      return -1;
+80101b44:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101b49:	eb b7                	jmp    80101b02 <writei+0xdb>
+80101b4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101b50:	eb b0                	jmp    80101b02 <writei+0xdb>
+    return -1;
+80101b52:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101b57:	eb a9                	jmp    80101b02 <writei+0xdb>
+    return -1;
+80101b59:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101b5e:	eb a2                	jmp    80101b02 <writei+0xdb>
+    return -1;
+80101b60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101b65:	eb 9b                	jmp    80101b02 <writei+0xdb>
+
+80101b67 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80101b67:	55                   	push   %ebp
+80101b68:	89 e5                	mov    %esp,%ebp
+80101b6a:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80101b6d:	6a 0e                	push   $0xe
+80101b6f:	ff 75 0c             	push   0xc(%ebp)
+80101b72:	ff 75 08             	push   0x8(%ebp)
+80101b75:	e8 c1 5b 00 00       	call   8010773b <strncmp>
+}
+80101b7a:	c9                   	leave
+80101b7b:	c3                   	ret
+
+80101b7c <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80101b7c:	55                   	push   %ebp
+80101b7d:	89 e5                	mov    %esp,%ebp
+80101b7f:	57                   	push   %edi
+80101b80:	56                   	push   %esi
+80101b81:	53                   	push   %ebx
+80101b82:	83 ec 1c             	sub    $0x1c,%esp
+80101b85:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+80101b88:	66 83 7e 58 01       	cmpw   $0x1,0x58(%esi)
+80101b8d:	75 15                	jne    80101ba4 <dirlookup+0x28>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101b8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101b94:	8d 7d d8             	lea    -0x28(%ebp),%edi
+      inum = de.inum;
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+80101b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101b9c:	83 7e 60 00          	cmpl   $0x0,0x60(%esi)
+80101ba0:	75 24                	jne    80101bc6 <dirlookup+0x4a>
+80101ba2:	eb 6e                	jmp    80101c12 <dirlookup+0x96>
+    panic("dirlookup not DIR");
+80101ba4:	83 ec 0c             	sub    $0xc,%esp
+80101ba7:	68 ef ae 10 80       	push   $0x8010aeef
+80101bac:	e8 91 e7 ff ff       	call   80100342 <panic>
+      panic("dirlookup read");
+80101bb1:	83 ec 0c             	sub    $0xc,%esp
+80101bb4:	68 01 af 10 80       	push   $0x8010af01
+80101bb9:	e8 84 e7 ff ff       	call   80100342 <panic>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101bbe:	83 c3 10             	add    $0x10,%ebx
+80101bc1:	3b 5e 60             	cmp    0x60(%esi),%ebx
+80101bc4:	73 47                	jae    80101c0d <dirlookup+0x91>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101bc6:	6a 10                	push   $0x10
+80101bc8:	53                   	push   %ebx
+80101bc9:	57                   	push   %edi
+80101bca:	56                   	push   %esi
+80101bcb:	e8 5d fd ff ff       	call   8010192d <readi>
+80101bd0:	83 c4 10             	add    $0x10,%esp
+80101bd3:	83 f8 10             	cmp    $0x10,%eax
+80101bd6:	75 d9                	jne    80101bb1 <dirlookup+0x35>
+    if(de.inum == 0)
+80101bd8:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80101bdd:	74 df                	je     80101bbe <dirlookup+0x42>
+    if(namecmp(name, de.name) == 0){
+80101bdf:	83 ec 08             	sub    $0x8,%esp
+80101be2:	8d 45 da             	lea    -0x26(%ebp),%eax
+80101be5:	50                   	push   %eax
+80101be6:	ff 75 0c             	push   0xc(%ebp)
+80101be9:	e8 79 ff ff ff       	call   80101b67 <namecmp>
+80101bee:	83 c4 10             	add    $0x10,%esp
+80101bf1:	85 c0                	test   %eax,%eax
+80101bf3:	75 c9                	jne    80101bbe <dirlookup+0x42>
+      if(poff)
+80101bf5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80101bf9:	74 05                	je     80101c00 <dirlookup+0x84>
+        *poff = off;
+80101bfb:	8b 45 10             	mov    0x10(%ebp),%eax
+80101bfe:	89 18                	mov    %ebx,(%eax)
+      inum = de.inum;
+80101c00:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80101c04:	8b 06                	mov    (%esi),%eax
+80101c06:	e8 d7 f6 ff ff       	call   801012e2 <iget>
+80101c0b:	eb 05                	jmp    80101c12 <dirlookup+0x96>
+  return 0;
+80101c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80101c12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c15:	5b                   	pop    %ebx
+80101c16:	5e                   	pop    %esi
+80101c17:	5f                   	pop    %edi
+80101c18:	5d                   	pop    %ebp
+80101c19:	c3                   	ret
+
+80101c1a <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80101c1a:	55                   	push   %ebp
+80101c1b:	89 e5                	mov    %esp,%ebp
+80101c1d:	57                   	push   %edi
+80101c1e:	56                   	push   %esi
+80101c1f:	53                   	push   %ebx
+80101c20:	83 ec 1c             	sub    $0x1c,%esp
+80101c23:	89 c3                	mov    %eax,%ebx
+80101c25:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80101c28:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80101c2b:	80 38 2f             	cmpb   $0x2f,(%eax)
+80101c2e:	74 1a                	je     80101c4a <namex+0x30>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80101c30:	e8 83 2b 00 00       	call   801047b8 <myproc>
+80101c35:	83 ec 0c             	sub    $0xc,%esp
+80101c38:	ff 70 68             	push   0x68(%eax)
+80101c3b:	e8 bd f9 ff ff       	call   801015fd <idup>
+80101c40:	89 c7                	mov    %eax,%edi
+80101c42:	83 c4 10             	add    $0x10,%esp
+80101c45:	e9 c2 00 00 00       	jmp    80101d0c <namex+0xf2>
+    ip = iget(ROOTDEV, ROOTINO);
+80101c4a:	ba 01 00 00 00       	mov    $0x1,%edx
+80101c4f:	b8 01 00 00 00       	mov    $0x1,%eax
+80101c54:	e8 89 f6 ff ff       	call   801012e2 <iget>
+80101c59:	89 c7                	mov    %eax,%edi
+80101c5b:	e9 ac 00 00 00       	jmp    80101d0c <namex+0xf2>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+    if(ip->type != T_DIR){
+      iunlockput(ip);
+80101c60:	83 ec 0c             	sub    $0xc,%esp
+80101c63:	57                   	push   %edi
+80101c64:	e8 16 fc ff ff       	call   8010187f <iunlockput>
+      return 0;
+80101c69:	83 c4 10             	add    $0x10,%esp
+80101c6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80101c71:	89 f8                	mov    %edi,%eax
+80101c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c76:	5b                   	pop    %ebx
+80101c77:	5e                   	pop    %esi
+80101c78:	5f                   	pop    %edi
+80101c79:	5d                   	pop    %ebp
+80101c7a:	c3                   	ret
+      iunlock(ip);
+80101c7b:	83 ec 0c             	sub    $0xc,%esp
+80101c7e:	57                   	push   %edi
+80101c7f:	e8 66 fa ff ff       	call   801016ea <iunlock>
+      return ip;
+80101c84:	83 c4 10             	add    $0x10,%esp
+80101c87:	eb e8                	jmp    80101c71 <namex+0x57>
+      iunlockput(ip);
+80101c89:	83 ec 0c             	sub    $0xc,%esp
+80101c8c:	57                   	push   %edi
+80101c8d:	e8 ed fb ff ff       	call   8010187f <iunlockput>
+      return 0;
+80101c92:	83 c4 10             	add    $0x10,%esp
+80101c95:	89 f7                	mov    %esi,%edi
+80101c97:	eb d8                	jmp    80101c71 <namex+0x57>
+  len = path - s;
+80101c99:	89 f0                	mov    %esi,%eax
+80101c9b:	29 d8                	sub    %ebx,%eax
+80101c9d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(len >= DIRSIZ)
+80101ca0:	83 f8 0d             	cmp    $0xd,%eax
+80101ca3:	0f 8e a5 00 00 00    	jle    80101d4e <namex+0x134>
+    memmove(name, s, DIRSIZ);
+80101ca9:	83 ec 04             	sub    $0x4,%esp
+80101cac:	6a 0e                	push   $0xe
+80101cae:	53                   	push   %ebx
+80101caf:	ff 75 e4             	push   -0x1c(%ebp)
+80101cb2:	e8 1d 5a 00 00       	call   801076d4 <memmove>
+80101cb7:	83 c4 10             	add    $0x10,%esp
+    path++;
+80101cba:	89 f3                	mov    %esi,%ebx
+  while(*path == '/')
+80101cbc:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101cbf:	75 08                	jne    80101cc9 <namex+0xaf>
+    path++;
+80101cc1:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101cc4:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101cc7:	74 f8                	je     80101cc1 <namex+0xa7>
+    ilock(ip);
+80101cc9:	83 ec 0c             	sub    $0xc,%esp
+80101ccc:	57                   	push   %edi
+80101ccd:	e8 56 f9 ff ff       	call   80101628 <ilock>
+    if(ip->type != T_DIR){
+80101cd2:	83 c4 10             	add    $0x10,%esp
+80101cd5:	66 83 7f 58 01       	cmpw   $0x1,0x58(%edi)
+80101cda:	75 84                	jne    80101c60 <namex+0x46>
+    if(nameiparent && *path == '\0'){
+80101cdc:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+80101ce0:	74 05                	je     80101ce7 <namex+0xcd>
+80101ce2:	80 3b 00             	cmpb   $0x0,(%ebx)
+80101ce5:	74 94                	je     80101c7b <namex+0x61>
+    if((next = dirlookup(ip, name, 0)) == 0){
+80101ce7:	83 ec 04             	sub    $0x4,%esp
+80101cea:	6a 00                	push   $0x0
+80101cec:	ff 75 e4             	push   -0x1c(%ebp)
+80101cef:	57                   	push   %edi
+80101cf0:	e8 87 fe ff ff       	call   80101b7c <dirlookup>
+80101cf5:	89 c6                	mov    %eax,%esi
+80101cf7:	83 c4 10             	add    $0x10,%esp
+80101cfa:	85 c0                	test   %eax,%eax
+80101cfc:	74 8b                	je     80101c89 <namex+0x6f>
+    iunlockput(ip);
+80101cfe:	83 ec 0c             	sub    $0xc,%esp
+80101d01:	57                   	push   %edi
+80101d02:	e8 78 fb ff ff       	call   8010187f <iunlockput>
+80101d07:	83 c4 10             	add    $0x10,%esp
+    ip = next;
+80101d0a:	89 f7                	mov    %esi,%edi
+  while(*path == '/')
+80101d0c:	0f b6 03             	movzbl (%ebx),%eax
+80101d0f:	3c 2f                	cmp    $0x2f,%al
+80101d11:	75 0a                	jne    80101d1d <namex+0x103>
+    path++;
+80101d13:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101d16:	0f b6 03             	movzbl (%ebx),%eax
+80101d19:	3c 2f                	cmp    $0x2f,%al
+80101d1b:	74 f6                	je     80101d13 <namex+0xf9>
+  if(*path == 0)
+80101d1d:	84 c0                	test   %al,%al
+80101d1f:	74 4e                	je     80101d6f <namex+0x155>
+  while(*path != '/' && *path != 0)
+80101d21:	0f b6 03             	movzbl (%ebx),%eax
+80101d24:	3c 2f                	cmp    $0x2f,%al
+80101d26:	74 1d                	je     80101d45 <namex+0x12b>
+80101d28:	84 c0                	test   %al,%al
+80101d2a:	74 19                	je     80101d45 <namex+0x12b>
+80101d2c:	89 de                	mov    %ebx,%esi
+    path++;
+80101d2e:	83 c6 01             	add    $0x1,%esi
+  while(*path != '/' && *path != 0)
+80101d31:	0f b6 06             	movzbl (%esi),%eax
+80101d34:	3c 2f                	cmp    $0x2f,%al
+80101d36:	0f 84 5d ff ff ff    	je     80101c99 <namex+0x7f>
+80101d3c:	84 c0                	test   %al,%al
+80101d3e:	75 ee                	jne    80101d2e <namex+0x114>
+80101d40:	e9 54 ff ff ff       	jmp    80101c99 <namex+0x7f>
+80101d45:	89 de                	mov    %ebx,%esi
+  len = path - s;
+80101d47:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    memmove(name, s, len);
+80101d4e:	83 ec 04             	sub    $0x4,%esp
+80101d51:	ff 75 e0             	push   -0x20(%ebp)
+80101d54:	53                   	push   %ebx
+80101d55:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101d58:	53                   	push   %ebx
+80101d59:	e8 76 59 00 00       	call   801076d4 <memmove>
+    name[len] = 0;
+80101d5e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101d61:	c6 04 0b 00          	movb   $0x0,(%ebx,%ecx,1)
+80101d65:	83 c4 10             	add    $0x10,%esp
+80101d68:	89 f3                	mov    %esi,%ebx
+80101d6a:	e9 4d ff ff ff       	jmp    80101cbc <namex+0xa2>
+  if(nameiparent){
+80101d6f:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+80101d73:	0f 84 f8 fe ff ff    	je     80101c71 <namex+0x57>
+    iput(ip);
+80101d79:	83 ec 0c             	sub    $0xc,%esp
+80101d7c:	57                   	push   %edi
+80101d7d:	e8 ad f9 ff ff       	call   8010172f <iput>
+    return 0;
+80101d82:	83 c4 10             	add    $0x10,%esp
+80101d85:	bf 00 00 00 00       	mov    $0x0,%edi
+80101d8a:	e9 e2 fe ff ff       	jmp    80101c71 <namex+0x57>
+
+80101d8f <dirlink>:
+{
+80101d8f:	55                   	push   %ebp
+80101d90:	89 e5                	mov    %esp,%ebp
+80101d92:	57                   	push   %edi
+80101d93:	56                   	push   %esi
+80101d94:	53                   	push   %ebx
+80101d95:	83 ec 20             	sub    $0x20,%esp
+80101d98:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80101d9b:	6a 00                	push   $0x0
+80101d9d:	ff 75 0c             	push   0xc(%ebp)
+80101da0:	56                   	push   %esi
+80101da1:	e8 d6 fd ff ff       	call   80101b7c <dirlookup>
+80101da6:	83 c4 10             	add    $0x10,%esp
+80101da9:	85 c0                	test   %eax,%eax
+80101dab:	75 6a                	jne    80101e17 <dirlink+0x88>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101dad:	8b 5e 60             	mov    0x60(%esi),%ebx
+80101db0:	85 db                	test   %ebx,%ebx
+80101db2:	74 29                	je     80101ddd <dirlink+0x4e>
+80101db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101db9:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80101dbc:	6a 10                	push   $0x10
+80101dbe:	53                   	push   %ebx
+80101dbf:	57                   	push   %edi
+80101dc0:	56                   	push   %esi
+80101dc1:	e8 67 fb ff ff       	call   8010192d <readi>
+80101dc6:	83 c4 10             	add    $0x10,%esp
+80101dc9:	83 f8 10             	cmp    $0x10,%eax
+80101dcc:	75 5c                	jne    80101e2a <dirlink+0x9b>
+    if(de.inum == 0)
+80101dce:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80101dd3:	74 08                	je     80101ddd <dirlink+0x4e>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101dd5:	83 c3 10             	add    $0x10,%ebx
+80101dd8:	3b 5e 60             	cmp    0x60(%esi),%ebx
+80101ddb:	72 df                	jb     80101dbc <dirlink+0x2d>
+  strncpy(de.name, name, DIRSIZ);
+80101ddd:	83 ec 04             	sub    $0x4,%esp
+80101de0:	6a 0e                	push   $0xe
+80101de2:	ff 75 0c             	push   0xc(%ebp)
+80101de5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80101de8:	8d 45 da             	lea    -0x26(%ebp),%eax
+80101deb:	50                   	push   %eax
+80101dec:	e8 90 59 00 00       	call   80107781 <strncpy>
+  de.inum = inum;
+80101df1:	8b 45 10             	mov    0x10(%ebp),%eax
+80101df4:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101df8:	6a 10                	push   $0x10
+80101dfa:	53                   	push   %ebx
+80101dfb:	57                   	push   %edi
+80101dfc:	56                   	push   %esi
+80101dfd:	e8 25 fc ff ff       	call   80101a27 <writei>
+80101e02:	83 c4 20             	add    $0x20,%esp
+80101e05:	83 f8 10             	cmp    $0x10,%eax
+80101e08:	75 2d                	jne    80101e37 <dirlink+0xa8>
+  return 0;
+80101e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80101e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101e12:	5b                   	pop    %ebx
+80101e13:	5e                   	pop    %esi
+80101e14:	5f                   	pop    %edi
+80101e15:	5d                   	pop    %ebp
+80101e16:	c3                   	ret
+    iput(ip);
+80101e17:	83 ec 0c             	sub    $0xc,%esp
+80101e1a:	50                   	push   %eax
+80101e1b:	e8 0f f9 ff ff       	call   8010172f <iput>
+    return -1;
+80101e20:	83 c4 10             	add    $0x10,%esp
+80101e23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101e28:	eb e5                	jmp    80101e0f <dirlink+0x80>
+      panic("dirlink read");
+80101e2a:	83 ec 0c             	sub    $0xc,%esp
+80101e2d:	68 10 af 10 80       	push   $0x8010af10
+80101e32:	e8 0b e5 ff ff       	call   80100342 <panic>
+    panic("dirlink");
+80101e37:	83 ec 0c             	sub    $0xc,%esp
+80101e3a:	68 2e ba 10 80       	push   $0x8010ba2e
+80101e3f:	e8 fe e4 ff ff       	call   80100342 <panic>
+
+80101e44 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80101e44:	55                   	push   %ebp
+80101e45:	89 e5                	mov    %esp,%ebp
+80101e47:	83 ec 18             	sub    $0x18,%esp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80101e4a:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+80101e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+80101e52:	8b 45 08             	mov    0x8(%ebp),%eax
+80101e55:	e8 c0 fd ff ff       	call   80101c1a <namex>
+}
+80101e5a:	c9                   	leave
+80101e5b:	c3                   	ret
+
+80101e5c <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80101e5c:	55                   	push   %ebp
+80101e5d:	89 e5                	mov    %esp,%ebp
+80101e5f:	83 ec 08             	sub    $0x8,%esp
+  return namex(path, 1, name);
+80101e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80101e65:	ba 01 00 00 00       	mov    $0x1,%edx
+80101e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+80101e6d:	e8 a8 fd ff ff       	call   80101c1a <namex>
+}
+80101e72:	c9                   	leave
+80101e73:	c3                   	ret
+
+80101e74 <idestart>:
+}
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80101e74:	55                   	push   %ebp
+80101e75:	89 e5                	mov    %esp,%ebp
+80101e77:	56                   	push   %esi
+80101e78:	53                   	push   %ebx
+  if(b == 0)
+80101e79:	85 c0                	test   %eax,%eax
+80101e7b:	0f 84 8b 00 00 00    	je     80101f0c <idestart+0x98>
+80101e81:	89 c1                	mov    %eax,%ecx
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+80101e83:	8b 58 08             	mov    0x8(%eax),%ebx
+80101e86:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+80101e8c:	0f 87 87 00 00 00    	ja     80101f19 <idestart+0xa5>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101e92:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101e97:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80101e98:	83 e0 c0             	and    $0xffffffc0,%eax
+80101e9b:	3c 40                	cmp    $0x40,%al
+80101e9d:	75 f8                	jne    80101e97 <idestart+0x23>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101e9f:	be 00 00 00 00       	mov    $0x0,%esi
+80101ea4:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80101ea9:	89 f0                	mov    %esi,%eax
+80101eab:	ee                   	out    %al,(%dx)
+80101eac:	b8 01 00 00 00       	mov    $0x1,%eax
+80101eb1:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80101eb6:	ee                   	out    %al,(%dx)
+80101eb7:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80101ebc:	89 d8                	mov    %ebx,%eax
+80101ebe:	ee                   	out    %al,(%dx)
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80101ebf:	89 d8                	mov    %ebx,%eax
+80101ec1:	c1 f8 08             	sar    $0x8,%eax
+80101ec4:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80101ec9:	ee                   	out    %al,(%dx)
+80101eca:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80101ecf:	89 f0                	mov    %esi,%eax
+80101ed1:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80101ed2:	0f b6 41 04          	movzbl 0x4(%ecx),%eax
+80101ed6:	c1 e0 04             	shl    $0x4,%eax
+80101ed9:	83 e0 10             	and    $0x10,%eax
+80101edc:	83 c8 e0             	or     $0xffffffe0,%eax
+80101edf:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80101ee4:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+80101ee5:	f6 01 04             	testb  $0x4,(%ecx)
+80101ee8:	74 3c                	je     80101f26 <idestart+0xb2>
+80101eea:	b8 30 00 00 00       	mov    $0x30,%eax
+80101eef:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101ef4:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+80101ef5:	8d 71 5c             	lea    0x5c(%ecx),%esi
+  asm volatile("cld; rep outsl" :
+80101ef8:	b9 80 00 00 00       	mov    $0x80,%ecx
+80101efd:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80101f02:	fc                   	cld
+80101f03:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+80101f05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101f08:	5b                   	pop    %ebx
+80101f09:	5e                   	pop    %esi
+80101f0a:	5d                   	pop    %ebp
+80101f0b:	c3                   	ret
+    panic("idestart");
+80101f0c:	83 ec 0c             	sub    $0xc,%esp
+80101f0f:	68 73 af 10 80       	push   $0x8010af73
+80101f14:	e8 29 e4 ff ff       	call   80100342 <panic>
+    panic("incorrect blockno");
+80101f19:	83 ec 0c             	sub    $0xc,%esp
+80101f1c:	68 7c af 10 80       	push   $0x8010af7c
+80101f21:	e8 1c e4 ff ff       	call   80100342 <panic>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101f26:	b8 20 00 00 00       	mov    $0x20,%eax
+80101f2b:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101f30:	ee                   	out    %al,(%dx)
+}
+80101f31:	eb d2                	jmp    80101f05 <idestart+0x91>
+
+80101f33 <ideinit>:
+{
+80101f33:	55                   	push   %ebp
+80101f34:	89 e5                	mov    %esp,%ebp
+80101f36:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80101f39:	68 8e af 10 80       	push   $0x8010af8e
+80101f3e:	68 80 57 11 80       	push   $0x80115780
+80101f43:	e8 1c 55 00 00       	call   80107464 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80101f48:	83 c4 08             	add    $0x8,%esp
+80101f4b:	a1 64 f9 13 80       	mov    0x8013f964,%eax
+80101f50:	83 e8 01             	sub    $0x1,%eax
+80101f53:	50                   	push   %eax
+80101f54:	6a 0e                	push   $0xe
+80101f56:	e8 6c 02 00 00       	call   801021c7 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80101f5b:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101f5e:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101f63:	ec                   	in     (%dx),%al
+80101f64:	83 e0 c0             	and    $0xffffffc0,%eax
+80101f67:	3c 40                	cmp    $0x40,%al
+80101f69:	75 f8                	jne    80101f63 <ideinit+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101f6b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80101f70:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80101f75:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101f76:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80101f7b:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80101f7c:	84 c0                	test   %al,%al
+80101f7e:	75 0f                	jne    80101f8f <ideinit+0x5c>
+80101f80:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+  for(i=0; i<1000; i++){
+80101f85:	83 e9 01             	sub    $0x1,%ecx
+80101f88:	74 0f                	je     80101f99 <ideinit+0x66>
+80101f8a:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80101f8b:	84 c0                	test   %al,%al
+80101f8d:	74 f6                	je     80101f85 <ideinit+0x52>
+      havedisk1 = 1;
+80101f8f:	c7 05 60 57 11 80 01 	movl   $0x1,0x80115760
+80101f96:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101f99:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80101f9e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80101fa3:	ee                   	out    %al,(%dx)
+}
+80101fa4:	c9                   	leave
+80101fa5:	c3                   	ret
+
+80101fa6 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+80101fa6:	55                   	push   %ebp
+80101fa7:	89 e5                	mov    %esp,%ebp
+80101fa9:	57                   	push   %edi
+80101faa:	53                   	push   %ebx
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+80101fab:	83 ec 0c             	sub    $0xc,%esp
+80101fae:	68 80 57 11 80       	push   $0x80115780
+80101fb3:	e8 f7 55 00 00       	call   801075af <acquire>
+
+  if((b = idequeue) == 0){
+80101fb8:	8b 1d 64 57 11 80    	mov    0x80115764,%ebx
+80101fbe:	83 c4 10             	add    $0x10,%esp
+80101fc1:	85 db                	test   %ebx,%ebx
+80101fc3:	74 48                	je     8010200d <ideintr+0x67>
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
+80101fc5:	8b 43 58             	mov    0x58(%ebx),%eax
+80101fc8:	a3 64 57 11 80       	mov    %eax,0x80115764
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+80101fcd:	f6 03 04             	testb  $0x4,(%ebx)
+80101fd0:	74 4d                	je     8010201f <ideintr+0x79>
+    insl(0x1f0, b->data, BSIZE/4);
+
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+80101fd2:	8b 03                	mov    (%ebx),%eax
+80101fd4:	83 e0 fb             	and    $0xfffffffb,%eax
+80101fd7:	83 c8 02             	or     $0x2,%eax
+80101fda:	89 03                	mov    %eax,(%ebx)
+  wakeupone(b);
+80101fdc:	83 ec 0c             	sub    $0xc,%esp
+80101fdf:	53                   	push   %ebx
+80101fe0:	e8 6d 2c 00 00       	call   80104c52 <wakeupone>
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+80101fe5:	a1 64 57 11 80       	mov    0x80115764,%eax
+80101fea:	83 c4 10             	add    $0x10,%esp
+80101fed:	85 c0                	test   %eax,%eax
+80101fef:	74 05                	je     80101ff6 <ideintr+0x50>
+    idestart(idequeue);
+80101ff1:	e8 7e fe ff ff       	call   80101e74 <idestart>
+
+  release(&idelock);
+80101ff6:	83 ec 0c             	sub    $0xc,%esp
+80101ff9:	68 80 57 11 80       	push   $0x80115780
+80101ffe:	e8 13 56 00 00       	call   80107616 <release>
+80102003:	83 c4 10             	add    $0x10,%esp
+}
+80102006:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102009:	5b                   	pop    %ebx
+8010200a:	5f                   	pop    %edi
+8010200b:	5d                   	pop    %ebp
+8010200c:	c3                   	ret
+    release(&idelock);
+8010200d:	83 ec 0c             	sub    $0xc,%esp
+80102010:	68 80 57 11 80       	push   $0x80115780
+80102015:	e8 fc 55 00 00       	call   80107616 <release>
+    return;
+8010201a:	83 c4 10             	add    $0x10,%esp
+8010201d:	eb e7                	jmp    80102006 <ideintr+0x60>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010201f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102024:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102025:	89 c1                	mov    %eax,%ecx
+80102027:	83 e1 c0             	and    $0xffffffc0,%ecx
+8010202a:	80 f9 40             	cmp    $0x40,%cl
+8010202d:	75 f5                	jne    80102024 <ideintr+0x7e>
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+8010202f:	a8 21                	test   $0x21,%al
+80102031:	75 9f                	jne    80101fd2 <ideintr+0x2c>
+    insl(0x1f0, b->data, BSIZE/4);
+80102033:	8d 7b 5c             	lea    0x5c(%ebx),%edi
+  asm volatile("cld; rep insl" :
+80102036:	b9 80 00 00 00       	mov    $0x80,%ecx
+8010203b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102040:	fc                   	cld
+80102041:	f3 6d                	rep insl (%dx),%es:(%edi)
+}
+80102043:	eb 8d                	jmp    80101fd2 <ideintr+0x2c>
+
+80102045 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80102045:	55                   	push   %ebp
+80102046:	89 e5                	mov    %esp,%ebp
+80102048:	53                   	push   %ebx
+80102049:	83 ec 10             	sub    $0x10,%esp
+8010204c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+8010204f:	8d 43 0c             	lea    0xc(%ebx),%eax
+80102052:	50                   	push   %eax
+80102053:	e8 e5 53 00 00       	call   8010743d <holdingsleep>
+80102058:	83 c4 10             	add    $0x10,%esp
+8010205b:	85 c0                	test   %eax,%eax
+8010205d:	0f 84 91 00 00 00    	je     801020f4 <iderw+0xaf>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80102063:	8b 03                	mov    (%ebx),%eax
+80102065:	83 e0 06             	and    $0x6,%eax
+80102068:	83 f8 02             	cmp    $0x2,%eax
+8010206b:	0f 84 90 00 00 00    	je     80102101 <iderw+0xbc>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+80102071:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+80102075:	74 0d                	je     80102084 <iderw+0x3f>
+80102077:	83 3d 60 57 11 80 00 	cmpl   $0x0,0x80115760
+8010207e:	0f 84 8a 00 00 00    	je     8010210e <iderw+0xc9>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+80102084:	83 ec 0c             	sub    $0xc,%esp
+80102087:	68 80 57 11 80       	push   $0x80115780
+8010208c:	e8 1e 55 00 00       	call   801075af <acquire>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+80102091:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102098:	a1 64 57 11 80       	mov    0x80115764,%eax
+8010209d:	83 c4 10             	add    $0x10,%esp
+801020a0:	85 c0                	test   %eax,%eax
+801020a2:	74 77                	je     8010211b <iderw+0xd6>
+801020a4:	89 c2                	mov    %eax,%edx
+801020a6:	8b 40 58             	mov    0x58(%eax),%eax
+801020a9:	85 c0                	test   %eax,%eax
+801020ab:	75 f7                	jne    801020a4 <iderw+0x5f>
+801020ad:	83 c2 58             	add    $0x58,%edx
+    ;
+  *pp = b;
+801020b0:	89 1a                	mov    %ebx,(%edx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+801020b2:	39 1d 64 57 11 80    	cmp    %ebx,0x80115764
+801020b8:	74 68                	je     80102122 <iderw+0xdd>
+    idestart(b);
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+801020ba:	8b 03                	mov    (%ebx),%eax
+801020bc:	83 e0 06             	and    $0x6,%eax
+801020bf:	83 f8 02             	cmp    $0x2,%eax
+801020c2:	74 1b                	je     801020df <iderw+0x9a>
+    sleep(b, &idelock);
+801020c4:	83 ec 08             	sub    $0x8,%esp
+801020c7:	68 80 57 11 80       	push   $0x80115780
+801020cc:	53                   	push   %ebx
+801020cd:	e8 49 2a 00 00       	call   80104b1b <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+801020d2:	8b 03                	mov    (%ebx),%eax
+801020d4:	83 e0 06             	and    $0x6,%eax
+801020d7:	83 c4 10             	add    $0x10,%esp
+801020da:	83 f8 02             	cmp    $0x2,%eax
+801020dd:	75 e5                	jne    801020c4 <iderw+0x7f>
+  }
+
+
+  release(&idelock);
+801020df:	83 ec 0c             	sub    $0xc,%esp
+801020e2:	68 80 57 11 80       	push   $0x80115780
+801020e7:	e8 2a 55 00 00       	call   80107616 <release>
+}
+801020ec:	83 c4 10             	add    $0x10,%esp
+801020ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801020f2:	c9                   	leave
+801020f3:	c3                   	ret
+    panic("iderw: buf not locked");
+801020f4:	83 ec 0c             	sub    $0xc,%esp
+801020f7:	68 92 af 10 80       	push   $0x8010af92
+801020fc:	e8 41 e2 ff ff       	call   80100342 <panic>
+    panic("iderw: nothing to do");
+80102101:	83 ec 0c             	sub    $0xc,%esp
+80102104:	68 a8 af 10 80       	push   $0x8010afa8
+80102109:	e8 34 e2 ff ff       	call   80100342 <panic>
+    panic("iderw: ide disk 1 not present");
+8010210e:	83 ec 0c             	sub    $0xc,%esp
+80102111:	68 bd af 10 80       	push   $0x8010afbd
+80102116:	e8 27 e2 ff ff       	call   80100342 <panic>
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+8010211b:	ba 64 57 11 80       	mov    $0x80115764,%edx
+80102120:	eb 8e                	jmp    801020b0 <iderw+0x6b>
+    idestart(b);
+80102122:	89 d8                	mov    %ebx,%eax
+80102124:	e8 4b fd ff ff       	call   80101e74 <idestart>
+80102129:	eb 8f                	jmp    801020ba <iderw+0x75>
+
+8010212b <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+8010212b:	55                   	push   %ebp
+8010212c:	89 e5                	mov    %esp,%ebp
+8010212e:	56                   	push   %esi
+8010212f:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80102130:	c7 05 b4 57 11 80 00 	movl   $0xfec00000,0x801157b4
+80102137:	00 c0 fe 
+  ioapic->reg = reg;
+8010213a:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80102141:	00 00 00 
+  return ioapic->data;
+80102144:	a1 b4 57 11 80       	mov    0x801157b4,%eax
+80102149:	8b 58 10             	mov    0x10(%eax),%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+8010214c:	c1 eb 10             	shr    $0x10,%ebx
+8010214f:	0f b6 db             	movzbl %bl,%ebx
+  ioapic->reg = reg;
+80102152:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  return ioapic->data;
+80102158:	a1 b4 57 11 80       	mov    0x801157b4,%eax
+8010215d:	8b 40 10             	mov    0x10(%eax),%eax
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+80102160:	0f b6 15 60 f9 13 80 	movzbl 0x8013f960,%edx
+  id = ioapicread(REG_ID) >> 24;
+80102167:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+8010216a:	39 c2                	cmp    %eax,%edx
+8010216c:	75 47                	jne    801021b5 <ioapicinit+0x8a>
+{
+8010216e:	ba 10 00 00 00       	mov    $0x10,%edx
+80102173:	b8 00 00 00 00       	mov    $0x0,%eax
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+80102178:	8d 48 20             	lea    0x20(%eax),%ecx
+8010217b:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->reg = reg;
+80102181:	8b 35 b4 57 11 80    	mov    0x801157b4,%esi
+80102187:	89 16                	mov    %edx,(%esi)
+  ioapic->data = data;
+80102189:	8b 35 b4 57 11 80    	mov    0x801157b4,%esi
+8010218f:	89 4e 10             	mov    %ecx,0x10(%esi)
+  ioapic->reg = reg;
+80102192:	8d 4a 01             	lea    0x1(%edx),%ecx
+80102195:	89 0e                	mov    %ecx,(%esi)
+  ioapic->data = data;
+80102197:	8b 0d b4 57 11 80    	mov    0x801157b4,%ecx
+8010219d:	c7 41 10 00 00 00 00 	movl   $0x0,0x10(%ecx)
+  for(i = 0; i <= maxintr; i++){
+801021a4:	83 c0 01             	add    $0x1,%eax
+801021a7:	83 c2 02             	add    $0x2,%edx
+801021aa:	39 c3                	cmp    %eax,%ebx
+801021ac:	7d ca                	jge    80102178 <ioapicinit+0x4d>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+801021ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801021b1:	5b                   	pop    %ebx
+801021b2:	5e                   	pop    %esi
+801021b3:	5d                   	pop    %ebp
+801021b4:	c3                   	ret
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+801021b5:	83 ec 0c             	sub    $0xc,%esp
+801021b8:	68 dc af 10 80       	push   $0x8010afdc
+801021bd:	e8 42 e4 ff ff       	call   80100604 <cprintf>
+801021c2:	83 c4 10             	add    $0x10,%esp
+801021c5:	eb a7                	jmp    8010216e <ioapicinit+0x43>
+
+801021c7 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+801021c7:	55                   	push   %ebp
+801021c8:	89 e5                	mov    %esp,%ebp
+801021ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+801021cd:	8d 50 20             	lea    0x20(%eax),%edx
+801021d0:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+801021d4:	8b 0d b4 57 11 80    	mov    0x801157b4,%ecx
+801021da:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801021dc:	8b 0d b4 57 11 80    	mov    0x801157b4,%ecx
+801021e2:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801021e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+801021e8:	c1 e2 18             	shl    $0x18,%edx
+801021eb:	83 c0 01             	add    $0x1,%eax
+  ioapic->reg = reg;
+801021ee:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801021f0:	a1 b4 57 11 80       	mov    0x801157b4,%eax
+801021f5:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801021f8:	5d                   	pop    %ebp
+801021f9:	c3                   	ret
+
+801021fa <bpush>:
+bpush(char *v, int order)
+{
+  struct run *r;
+
+  r = (struct run*)v;
+  r->prev = 0;
+801021fa:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  r->next = kmem.free[order];
+80102201:	8b 0c 95 f8 57 11 80 	mov    -0x7feea808(,%edx,4),%ecx
+80102208:	89 08                	mov    %ecx,(%eax)
+  if(r->next)
+8010220a:	85 c9                	test   %ecx,%ecx
+8010220c:	74 03                	je     80102211 <bpush+0x17>
+    r->next->prev = r;
+8010220e:	89 41 04             	mov    %eax,0x4(%ecx)
+  kmem.free[order] = r;
+80102211:	89 04 95 f8 57 11 80 	mov    %eax,-0x7feea808(,%edx,4)
+  ORDER(v) = order + 1;
+80102218:	05 00 00 00 80       	add    $0x80000000,%eax
+8010221d:	c1 e8 0c             	shr    $0xc,%eax
+80102220:	83 c2 01             	add    $0x1,%edx
+80102223:	88 90 24 58 11 80    	mov    %dl,-0x7feea7dc(%eax)
+}
+80102229:	c3                   	ret
+
+8010222a <bremove>:
+bremove(char *v, int order)
+{
+  struct run *r;
+
+  r = (struct run*)v;
+  if(r->prev)
+8010222a:	8b 48 04             	mov    0x4(%eax),%ecx
+8010222d:	85 c9                	test   %ecx,%ecx
+8010222f:	74 20                	je     80102251 <bremove+0x27>
+    r->prev->next = r->next;
+80102231:	8b 10                	mov    (%eax),%edx
+80102233:	89 11                	mov    %edx,(%ecx)
+  else
+    kmem.free[order] = r->next;
+  if(r->next)
+80102235:	8b 10                	mov    (%eax),%edx
+80102237:	85 d2                	test   %edx,%edx
+80102239:	74 06                	je     80102241 <bremove+0x17>
+    r->next->prev = r->prev;
+8010223b:	8b 48 04             	mov    0x4(%eax),%ecx
+8010223e:	89 4a 04             	mov    %ecx,0x4(%edx)
+  ORDER(v) = 0;
+80102241:	05 00 00 00 80       	add    $0x80000000,%eax
+80102246:	c1 e8 0c             	shr    $0xc,%eax
+80102249:	c6 80 24 58 11 80 00 	movb   $0x0,-0x7feea7dc(%eax)
+}
+80102250:	c3                   	ret
+    kmem.free[order] = r->next;
+80102251:	8b 08                	mov    (%eax),%ecx
+80102253:	89 0c 95 f8 57 11 80 	mov    %ecx,-0x7feea808(,%edx,4)
+8010225a:	eb d9                	jmp    80102235 <bremove+0xb>
+
+8010225c <balloc>:
+
+// Take a block of 2^order pages off the lists, splitting a larger
+// one if there is none that size.  Returns 0 if none are left.
+static char*
+balloc(int order)
+{
+8010225c:	55                   	push   %ebp
+8010225d:	89 e5                	mov    %esp,%ebp
+8010225f:	57                   	push   %edi
+80102260:	56                   	push   %esi
+80102261:	53                   	push   %ebx
+80102262:	83 ec 0c             	sub    $0xc,%esp
+80102265:	89 c7                	mov    %eax,%edi
+  char *v;
+  int o;
+
+  for(o = order; o < NKORDER && kmem.free[o] == 0; o++)
+80102267:	89 c3                	mov    %eax,%ebx
+80102269:	83 f8 0a             	cmp    $0xa,%eax
+8010226c:	7f 15                	jg     80102283 <balloc+0x27>
+8010226e:	8b 34 9d f8 57 11 80 	mov    -0x7feea808(,%ebx,4),%esi
+80102275:	85 f6                	test   %esi,%esi
+80102277:	75 0a                	jne    80102283 <balloc+0x27>
+80102279:	83 c3 01             	add    $0x1,%ebx
+8010227c:	83 fb 0b             	cmp    $0xb,%ebx
+8010227f:	75 ed                	jne    8010226e <balloc+0x12>
+80102281:	eb 32                	jmp    801022b5 <balloc+0x59>
+    ;
+  if(o == NKORDER)
+80102283:	83 fb 0b             	cmp    $0xb,%ebx
+80102286:	74 37                	je     801022bf <balloc+0x63>
+    return 0;
+  v = (char*)kmem.free[o];
+80102288:	8b 34 9d f8 57 11 80 	mov    -0x7feea808(,%ebx,4),%esi
+  bremove(v, o);
+8010228f:	89 da                	mov    %ebx,%edx
+80102291:	89 f0                	mov    %esi,%eax
+80102293:	e8 92 ff ff ff       	call   8010222a <bremove>
+  while(o > order){
+80102298:	39 df                	cmp    %ebx,%edi
+8010229a:	7d 19                	jge    801022b5 <balloc+0x59>
+    o--;
+8010229c:	83 eb 01             	sub    $0x1,%ebx
+    bpush(v + (PGSIZE << o), o);
+8010229f:	b8 00 10 00 00       	mov    $0x1000,%eax
+801022a4:	89 d9                	mov    %ebx,%ecx
+801022a6:	d3 e0                	shl    %cl,%eax
+801022a8:	01 f0                	add    %esi,%eax
+801022aa:	89 da                	mov    %ebx,%edx
+801022ac:	e8 49 ff ff ff       	call   801021fa <bpush>
+  while(o > order){
+801022b1:	39 df                	cmp    %ebx,%edi
+801022b3:	75 e7                	jne    8010229c <balloc+0x40>
+  }
+  return v;
+}
+801022b5:	89 f0                	mov    %esi,%eax
+801022b7:	83 c4 0c             	add    $0xc,%esp
+801022ba:	5b                   	pop    %ebx
+801022bb:	5e                   	pop    %esi
+801022bc:	5f                   	pop    %edi
+801022bd:	5d                   	pop    %ebp
+801022be:	c3                   	ret
+    return 0;
+801022bf:	be 00 00 00 00       	mov    $0x0,%esi
+801022c4:	eb ef                	jmp    801022b5 <balloc+0x59>
+
+801022c6 <bfree>:
+
+// Put a block of 2^order pages back on the lists, merged with
+// its buddy for as long as the buddy is free.
+static void
+bfree(char *v, int order)
+{
+801022c6:	55                   	push   %ebp
+801022c7:	89 e5                	mov    %esp,%ebp
+801022c9:	57                   	push   %edi
+801022ca:	56                   	push   %esi
+801022cb:	53                   	push   %ebx
+801022cc:	83 ec 0c             	sub    $0xc,%esp
+801022cf:	89 c7                	mov    %eax,%edi
+801022d1:	89 d3                	mov    %edx,%ebx
+  char *buddy;
+
+  for(; order < NKORDER - 1; order++){
+801022d3:	83 fa 09             	cmp    $0x9,%edx
+801022d6:	7f 77                	jg     8010234f <bfree+0x89>
+    buddy = P2V(V2P(v) ^ (PGSIZE << order));
+801022d8:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+801022de:	ba 00 10 00 00       	mov    $0x1000,%edx
+801022e3:	89 d9                	mov    %ebx,%ecx
+801022e5:	d3 e2                	shl    %cl,%edx
+801022e7:	31 d0                	xor    %edx,%eax
+801022e9:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+    if(buddy < end || V2P(buddy) >= PHYSTOP || ORDER(buddy) != order + 1)
+801022ef:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801022f4:	77 59                	ja     8010234f <bfree+0x89>
+801022f6:	81 fe d0 f3 15 80    	cmp    $0x8015f3d0,%esi
+801022fc:	72 51                	jb     8010234f <bfree+0x89>
+801022fe:	89 da                	mov    %ebx,%edx
+80102300:	83 c3 01             	add    $0x1,%ebx
+80102303:	c1 e8 0c             	shr    $0xc,%eax
+80102306:	b9 c0 57 11 80       	mov    $0x801157c0,%ecx
+8010230b:	0f b6 44 01 64       	movzbl 0x64(%ecx,%eax,1),%eax
+80102310:	39 d8                	cmp    %ebx,%eax
+80102312:	75 39                	jne    8010234d <bfree+0x87>
+      break;
+    bremove(buddy, order);
+80102314:	89 f0                	mov    %esi,%eax
+80102316:	e8 0f ff ff ff       	call   8010222a <bremove>
+    if(buddy < v)
+8010231b:	39 f7                	cmp    %esi,%edi
+8010231d:	0f 47 fe             	cmova  %esi,%edi
+  for(; order < NKORDER - 1; order++){
+80102320:	83 fb 0a             	cmp    $0xa,%ebx
+80102323:	74 2a                	je     8010234f <bfree+0x89>
+    buddy = P2V(V2P(v) ^ (PGSIZE << order));
+80102325:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010232b:	ba 00 10 00 00       	mov    $0x1000,%edx
+80102330:	89 d9                	mov    %ebx,%ecx
+80102332:	d3 e2                	shl    %cl,%edx
+80102334:	31 d0                	xor    %edx,%eax
+80102336:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+    if(buddy < end || V2P(buddy) >= PHYSTOP || ORDER(buddy) != order + 1)
+8010233c:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80102341:	77 0c                	ja     8010234f <bfree+0x89>
+80102343:	81 fe d0 f3 15 80    	cmp    $0x8015f3d0,%esi
+80102349:	73 b3                	jae    801022fe <bfree+0x38>
+8010234b:	eb 02                	jmp    8010234f <bfree+0x89>
+8010234d:	89 d3                	mov    %edx,%ebx
+      v = buddy;
+  }
+  bpush(v, order);
+8010234f:	89 da                	mov    %ebx,%edx
+80102351:	89 f8                	mov    %edi,%eax
+80102353:	e8 a2 fe ff ff       	call   801021fa <bpush>
+}
+80102358:	83 c4 0c             	add    $0xc,%esp
+8010235b:	5b                   	pop    %ebx
+8010235c:	5e                   	pop    %esi
+8010235d:	5f                   	pop    %edi
+8010235e:	5d                   	pop    %ebp
+8010235f:	c3                   	ret
+
+80102360 <kallocorder>:
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  Returns 0 if the memory cannot be allocated.  Free with
+// kfreeorder().
+char*
+kallocorder(int order)
+{
+80102360:	55                   	push   %ebp
+80102361:	89 e5                	mov    %esp,%ebp
+80102363:	53                   	push   %ebx
+80102364:	83 ec 04             	sub    $0x4,%esp
+80102367:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *v;
+
+  if(order < 0 || order >= NKORDER)
+8010236a:	83 fb 0a             	cmp    $0xa,%ebx
+8010236d:	77 5d                	ja     801023cc <kallocorder+0x6c>
+    return 0;
+  if(kmem.use_lock)
+8010236f:	83 3d f4 57 11 80 00 	cmpl   $0x0,0x801157f4
+80102376:	75 30                	jne    801023a8 <kallocorder+0x48>
+    acquire(&kmem.lock);
+  v = balloc(order);
+80102378:	89 d8                	mov    %ebx,%eax
+8010237a:	e8 dd fe ff ff       	call   8010225c <balloc>
+8010237f:	89 c3                	mov    %eax,%ebx
+  if(kmem.use_lock)
+80102381:	83 3d f4 57 11 80 00 	cmpl   $0x0,0x801157f4
+80102388:	75 30                	jne    801023ba <kallocorder+0x5a>
+    release(&kmem.lock);
+  if(v)
+8010238a:	85 db                	test   %ebx,%ebx
+8010238c:	74 13                	je     801023a1 <kallocorder+0x41>
+    REF(v) = 1;
+8010238e:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80102394:	c1 e8 0c             	shr    $0xc,%eax
+80102397:	66 c7 84 00 64 38 12 	movw   $0x1,-0x7fedc79c(%eax,%eax,1)
+8010239e:	80 01 00 
+  return v;
+}
+801023a1:	89 d8                	mov    %ebx,%eax
+801023a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801023a6:	c9                   	leave
+801023a7:	c3                   	ret
+    acquire(&kmem.lock);
+801023a8:	83 ec 0c             	sub    $0xc,%esp
+801023ab:	68 c0 57 11 80       	push   $0x801157c0
+801023b0:	e8 fa 51 00 00       	call   801075af <acquire>
+801023b5:	83 c4 10             	add    $0x10,%esp
+801023b8:	eb be                	jmp    80102378 <kallocorder+0x18>
+    release(&kmem.lock);
+801023ba:	83 ec 0c             	sub    $0xc,%esp
+801023bd:	68 c0 57 11 80       	push   $0x801157c0
+801023c2:	e8 4f 52 00 00       	call   80107616 <release>
+801023c7:	83 c4 10             	add    $0x10,%esp
+801023ca:	eb be                	jmp    8010238a <kallocorder+0x2a>
+    return 0;
+801023cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+801023d1:	eb ce                	jmp    801023a1 <kallocorder+0x41>
+
+801023d3 <kfreeorder>:
+
+// Free the 2^order pages at v, which should have been returned by
+// kallocorder(order).
+void
+kfreeorder(char *v, int order)
+{
+801023d3:	55                   	push   %ebp
+801023d4:	89 e5                	mov    %esp,%ebp
+801023d6:	56                   	push   %esi
+801023d7:	53                   	push   %ebx
+801023d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801023db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if((uint)v % (PGSIZE << order) || v < end || V2P(v) >= PHYSTOP)
+801023de:	ba 00 10 00 00       	mov    $0x1000,%edx
+801023e3:	89 f1                	mov    %esi,%ecx
+801023e5:	d3 e2                	shl    %cl,%edx
+801023e7:	8d 42 ff             	lea    -0x1(%edx),%eax
+801023ea:	85 c3                	test   %eax,%ebx
+801023ec:	75 5e                	jne    8010244c <kfreeorder+0x79>
+801023ee:	81 fb d0 f3 15 80    	cmp    $0x8015f3d0,%ebx
+801023f4:	72 56                	jb     8010244c <kfreeorder+0x79>
+801023f6:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801023fc:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80102401:	77 49                	ja     8010244c <kfreeorder+0x79>
+    panic("kfreeorder");
+  if(REF(v) != 1)
+80102403:	c1 e8 0c             	shr    $0xc,%eax
+80102406:	66 83 bc 00 64 38 12 	cmpw   $0x1,-0x7fedc79c(%eax,%eax,1)
+8010240d:	80 01 
+8010240f:	75 48                	jne    80102459 <kfreeorder+0x86>
+    panic("kfreeorder: ref");
+  REF(v) = 0;
+80102411:	66 c7 84 00 64 38 12 	movw   $0x0,-0x7fedc79c(%eax,%eax,1)
+80102418:	80 00 00 
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE << order);
+8010241b:	83 ec 04             	sub    $0x4,%esp
+8010241e:	52                   	push   %edx
+8010241f:	6a 01                	push   $0x1
+80102421:	53                   	push   %ebx
+80102422:	e8 36 52 00 00       	call   8010765d <memset>
+
+  if(kmem.use_lock)
+80102427:	83 c4 10             	add    $0x10,%esp
+8010242a:	83 3d f4 57 11 80 00 	cmpl   $0x0,0x801157f4
+80102431:	75 33                	jne    80102466 <kfreeorder+0x93>
+    acquire(&kmem.lock);
+  bfree(v, order);
+80102433:	89 f2                	mov    %esi,%edx
+80102435:	89 d8                	mov    %ebx,%eax
+80102437:	e8 8a fe ff ff       	call   801022c6 <bfree>
+  if(kmem.use_lock)
+8010243c:	83 3d f4 57 11 80 00 	cmpl   $0x0,0x801157f4
+80102443:	75 33                	jne    80102478 <kfreeorder+0xa5>
+    release(&kmem.lock);
+}
+80102445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102448:	5b                   	pop    %ebx
+80102449:	5e                   	pop    %esi
+8010244a:	5d                   	pop    %ebp
+8010244b:	c3                   	ret
+    panic("kfreeorder");
+8010244c:	83 ec 0c             	sub    $0xc,%esp
+8010244f:	68 0e b0 10 80       	push   $0x8010b00e
+80102454:	e8 e9 de ff ff       	call   80100342 <panic>
+    panic("kfreeorder: ref");
+80102459:	83 ec 0c             	sub    $0xc,%esp
+8010245c:	68 19 b0 10 80       	push   $0x8010b019
+80102461:	e8 dc de ff ff       	call   80100342 <panic>
+    acquire(&kmem.lock);
+80102466:	83 ec 0c             	sub    $0xc,%esp
+80102469:	68 c0 57 11 80       	push   $0x801157c0
+8010246e:	e8 3c 51 00 00       	call   801075af <acquire>
+80102473:	83 c4 10             	add    $0x10,%esp
+80102476:	eb bb                	jmp    80102433 <kfreeorder+0x60>
+    release(&kmem.lock);
+80102478:	83 ec 0c             	sub    $0xc,%esp
+8010247b:	68 c0 57 11 80       	push   $0x801157c0
+80102480:	e8 91 51 00 00       	call   80107616 <release>
+80102485:	83 c4 10             	add    $0x10,%esp
+}
+80102488:	eb bb                	jmp    80102445 <kfreeorder+0x72>
+
+8010248a <kfreen>:
+// to kalloc(), and free those with none left.
+// (The exception is when initializing the allocator;
+// see kinit above.)
+void
+kfreen(char **pv, int n)
+{
+8010248a:	55                   	push   %ebp
+8010248b:	89 e5                	mov    %esp,%ebp
+8010248d:	57                   	push   %edi
+8010248e:	56                   	push   %esi
+8010248f:	53                   	push   %ebx
+80102490:	83 ec 0c             	sub    $0xc,%esp
+  struct kcache *c;
+  struct run *r;
+  char *v;
+  int i, ref;
+
+  if(kmem.use_lock){
+80102493:	83 3d f4 57 11 80 00 	cmpl   $0x0,0x801157f4
+8010249a:	75 16                	jne    801024b2 <kfreen+0x28>
+    pushcli();
+    c = &kmem.cache[cpuid()];
+  } else
+    c = 0;
+8010249c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(i = 0; i < n; i++){
+801024a1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+801024a5:	0f 8e 1c 01 00 00    	jle    801025c7 <kfreen+0x13d>
+801024ab:	bf 00 00 00 00       	mov    $0x0,%edi
+801024b0:	eb 60                	jmp    80102512 <kfreen+0x88>
+    pushcli();
+801024b2:	e8 28 50 00 00       	call   801074df <pushcli>
+    c = &kmem.cache[cpuid()];
+801024b7:	e8 7f 1f 00 00       	call   8010443b <cpuid>
+801024bc:	8d 1c c5 24 38 12 80 	lea    -0x7fedc7dc(,%eax,8),%ebx
+  for(i = 0; i < n; i++){
+801024c3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+801024c7:	7f e2                	jg     801024ab <kfreen+0x21>
+801024c9:	e9 f4 00 00 00       	jmp    801025c2 <kfreen+0x138>
+    v = pv[i];
+    if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+      panic("kfree");
+801024ce:	83 ec 0c             	sub    $0xc,%esp
+801024d1:	68 29 b0 10 80       	push   $0x8010b029
+801024d6:	e8 67 de ff ff       	call   80100342 <panic>
+    if((ref = __sync_fetch_and_sub(&REF(v), 1)) == 0)
+      panic("kfree: free page");
+801024db:	83 ec 0c             	sub    $0xc,%esp
+801024de:	68 2f b0 10 80       	push   $0x8010b02f
+801024e3:	e8 5a de ff ff       	call   80100342 <panic>
+
+    // Fill with junk to catch dangling refs.
+    memset(v, 1, PGSIZE);
+
+    if(c == 0){
+      bfree(v, 0);
+801024e8:	ba 00 00 00 00       	mov    $0x0,%edx
+801024ed:	89 f0                	mov    %esi,%eax
+801024ef:	e8 d2 fd ff ff       	call   801022c6 <bfree>
+      continue;
+801024f4:	eb 10                	jmp    80102506 <kfreen+0x7c>
+  release(&kmem.lock);
+801024f6:	83 ec 0c             	sub    $0xc,%esp
+801024f9:	68 c0 57 11 80       	push   $0x801157c0
+801024fe:	e8 13 51 00 00       	call   80107616 <release>
+}
+80102503:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+80102506:	83 c7 01             	add    $0x1,%edi
+80102509:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+8010250c:	0f 8e ac 00 00 00    	jle    801025be <kfreen+0x134>
+    v = pv[i];
+80102512:	8b 45 08             	mov    0x8(%ebp),%eax
+80102515:	8b 34 b8             	mov    (%eax,%edi,4),%esi
+    if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80102518:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+8010251e:	75 ae                	jne    801024ce <kfreen+0x44>
+80102520:	81 fe d0 f3 15 80    	cmp    $0x8015f3d0,%esi
+80102526:	72 a6                	jb     801024ce <kfreen+0x44>
+80102528:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+8010252e:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80102533:	77 99                	ja     801024ce <kfreen+0x44>
+    if((ref = __sync_fetch_and_sub(&REF(v), 1)) == 0)
+80102535:	c1 e8 0c             	shr    $0xc,%eax
+80102538:	05 52 70 00 00       	add    $0x7052,%eax
+8010253d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80102542:	66 f0 0f c1 94 00 c0 	lock xadd %dx,-0x7feea840(%eax,%eax,1)
+80102549:	57 11 80 
+8010254c:	0f b7 c2             	movzwl %dx,%eax
+8010254f:	85 c0                	test   %eax,%eax
+80102551:	74 88                	je     801024db <kfreen+0x51>
+    if(ref > 1)
+80102553:	83 f8 01             	cmp    $0x1,%eax
+80102556:	7f ae                	jg     80102506 <kfreen+0x7c>
+    memset(v, 1, PGSIZE);
+80102558:	83 ec 04             	sub    $0x4,%esp
+8010255b:	68 00 10 00 00       	push   $0x1000
+80102560:	6a 01                	push   $0x1
+80102562:	56                   	push   %esi
+80102563:	e8 f5 50 00 00       	call   8010765d <memset>
+    if(c == 0){
+80102568:	83 c4 10             	add    $0x10,%esp
+8010256b:	85 db                	test   %ebx,%ebx
+8010256d:	0f 84 75 ff ff ff    	je     801024e8 <kfreen+0x5e>
+    }
+    r = (struct run*)v;
+    r->next = c->freelist;
+80102573:	8b 03                	mov    (%ebx),%eax
+80102575:	89 06                	mov    %eax,(%esi)
+    c->freelist = r;
+80102577:	89 33                	mov    %esi,(%ebx)
+    if(++c->nfree >= 2*KBATCH)
+80102579:	8b 43 04             	mov    0x4(%ebx),%eax
+8010257c:	83 c0 01             	add    $0x1,%eax
+8010257f:	89 43 04             	mov    %eax,0x4(%ebx)
+80102582:	83 f8 3f             	cmp    $0x3f,%eax
+80102585:	0f 8e 7b ff ff ff    	jle    80102506 <kfreen+0x7c>
+  acquire(&kmem.lock);
+8010258b:	83 ec 0c             	sub    $0xc,%esp
+8010258e:	68 c0 57 11 80       	push   $0x801157c0
+80102593:	e8 17 50 00 00       	call   801075af <acquire>
+80102598:	83 c4 10             	add    $0x10,%esp
+8010259b:	be 20 00 00 00       	mov    $0x20,%esi
+    r = c->freelist;
+801025a0:	8b 03                	mov    (%ebx),%eax
+    c->freelist = r->next;
+801025a2:	8b 10                	mov    (%eax),%edx
+801025a4:	89 13                	mov    %edx,(%ebx)
+    c->nfree--;
+801025a6:	83 6b 04 01          	subl   $0x1,0x4(%ebx)
+    bfree((char*)r, 0);
+801025aa:	ba 00 00 00 00       	mov    $0x0,%edx
+801025af:	e8 12 fd ff ff       	call   801022c6 <bfree>
+  for(n = 0; n < KBATCH; n++){
+801025b4:	83 ee 01             	sub    $0x1,%esi
+801025b7:	75 e7                	jne    801025a0 <kfreen+0x116>
+801025b9:	e9 38 ff ff ff       	jmp    801024f6 <kfreen+0x6c>
+      kdrain(c);
+  }
+  if(c)
+801025be:	85 db                	test   %ebx,%ebx
+801025c0:	74 05                	je     801025c7 <kfreen+0x13d>
+    popcli();
+801025c2:	e8 54 4f 00 00       	call   8010751b <popcli>
+}
+801025c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801025ca:	5b                   	pop    %ebx
+801025cb:	5e                   	pop    %esi
+801025cc:	5f                   	pop    %edi
+801025cd:	5d                   	pop    %ebp
+801025ce:	c3                   	ret
+
+801025cf <kfree>:
+
+// Free the page of physical memory pointed at by v; see kfreen().
+void
+kfree(char *v)
+{
+801025cf:	55                   	push   %ebp
+801025d0:	89 e5                	mov    %esp,%ebp
+801025d2:	83 ec 10             	sub    $0x10,%esp
+  kfreen(&v, 1);
+801025d5:	6a 01                	push   $0x1
+801025d7:	8d 45 08             	lea    0x8(%ebp),%eax
+801025da:	50                   	push   %eax
+801025db:	e8 aa fe ff ff       	call   8010248a <kfreen>
+}
+801025e0:	83 c4 10             	add    $0x10,%esp
+801025e3:	c9                   	leave
+801025e4:	c3                   	ret
+
+801025e5 <freerange>:
+{
+801025e5:	55                   	push   %ebp
+801025e6:	89 e5                	mov    %esp,%ebp
+801025e8:	56                   	push   %esi
+801025e9:	53                   	push   %ebx
+801025ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801025ed:	8b 45 08             	mov    0x8(%ebp),%eax
+801025f0:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801025f6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801025fc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80102602:	39 de                	cmp    %ebx,%esi
+80102604:	72 2f                	jb     80102635 <freerange+0x50>
+    REF(p) = 1;
+80102606:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+8010260c:	c1 e8 0c             	shr    $0xc,%eax
+8010260f:	66 c7 84 00 64 38 12 	movw   $0x1,-0x7fedc79c(%eax,%eax,1)
+80102616:	80 01 00 
+    kfree(p);
+80102619:	83 ec 0c             	sub    $0xc,%esp
+8010261c:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+80102622:	50                   	push   %eax
+80102623:	e8 a7 ff ff ff       	call   801025cf <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80102628:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010262e:	83 c4 10             	add    $0x10,%esp
+80102631:	39 de                	cmp    %ebx,%esi
+80102633:	73 d1                	jae    80102606 <freerange+0x21>
+}
+80102635:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102638:	5b                   	pop    %ebx
+80102639:	5e                   	pop    %esi
+8010263a:	5d                   	pop    %ebp
+8010263b:	c3                   	ret
+
+8010263c <kinit1>:
+{
+8010263c:	55                   	push   %ebp
+8010263d:	89 e5                	mov    %esp,%ebp
+8010263f:	83 ec 10             	sub    $0x10,%esp
+  initlock(&kmem.lock, "kmem");
+80102642:	68 40 b0 10 80       	push   $0x8010b040
+80102647:	68 c0 57 11 80       	push   $0x801157c0
+8010264c:	e8 13 4e 00 00       	call   80107464 <initlock>
+  kmem.use_lock = 0;
+80102651:	c7 05 f4 57 11 80 00 	movl   $0x0,0x801157f4
+80102658:	00 00 00 
+  freerange(vstart, vend);
+8010265b:	83 c4 08             	add    $0x8,%esp
+8010265e:	ff 75 0c             	push   0xc(%ebp)
+80102661:	ff 75 08             	push   0x8(%ebp)
+80102664:	e8 7c ff ff ff       	call   801025e5 <freerange>
+}
+80102669:	83 c4 10             	add    $0x10,%esp
+8010266c:	c9                   	leave
+8010266d:	c3                   	ret
+
+8010266e <kinit2>:
+{
+8010266e:	55                   	push   %ebp
+8010266f:	89 e5                	mov    %esp,%ebp
+80102671:	83 ec 10             	sub    $0x10,%esp
+  freerange(vstart, vend);
+80102674:	ff 75 0c             	push   0xc(%ebp)
+80102677:	ff 75 08             	push   0x8(%ebp)
+8010267a:	e8 66 ff ff ff       	call   801025e5 <freerange>
+  kmem.use_lock = 1;
+8010267f:	c7 05 f4 57 11 80 01 	movl   $0x1,0x801157f4
+80102686:	00 00 00 
+}
+80102689:	83 c4 10             	add    $0x10,%esp
+8010268c:	c9                   	leave
+8010268d:	c3                   	ret
+
+8010268e <kallocn>:
+// Allocate n 4096-byte pages of physical memory, into pv.
+// Returns the number allocated, which is less than n only if
+// memory ran out.
+int
+kallocn(char **pv, int n)
+{
+8010268e:	55                   	push   %ebp
+8010268f:	89 e5                	mov    %esp,%ebp
+80102691:	57                   	push   %edi
+80102692:	56                   	push   %esi
+80102693:	53                   	push   %ebx
+80102694:	83 ec 0c             	sub    $0xc,%esp
+  struct kcache *c;
+  struct run *r;
+  int i;
+
+  if(kmem.use_lock){
+80102697:	8b 35 f4 57 11 80    	mov    0x801157f4,%esi
+8010269d:	85 f6                	test   %esi,%esi
+8010269f:	75 16                	jne    801026b7 <kallocn+0x29>
+    pushcli();
+    c = &kmem.cache[cpuid()];
+  } else
+    c = 0;
+801026a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(i = 0; i < n; i++){
+801026a6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+801026aa:	0f 8e ce 00 00 00    	jle    8010277e <kallocn+0xf0>
+801026b0:	be 00 00 00 00       	mov    $0x0,%esi
+801026b5:	eb 73                	jmp    8010272a <kallocn+0x9c>
+    pushcli();
+801026b7:	e8 23 4e 00 00       	call   801074df <pushcli>
+    c = &kmem.cache[cpuid()];
+801026bc:	e8 7a 1d 00 00       	call   8010443b <cpuid>
+801026c1:	8d 1c c5 24 38 12 80 	lea    -0x7fedc7dc(,%eax,8),%ebx
+  for(i = 0; i < n; i++){
+801026c8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+801026cc:	7f e2                	jg     801026b0 <kallocn+0x22>
+801026ce:	be 00 00 00 00       	mov    $0x0,%esi
+801026d3:	e9 a1 00 00 00       	jmp    80102779 <kallocn+0xeb>
+    if(c == 0){
+      if((r = (struct run*)balloc(0)) == 0)
+801026d8:	b8 00 00 00 00       	mov    $0x0,%eax
+801026dd:	e8 7a fb ff ff       	call   8010225c <balloc>
+801026e2:	85 c0                	test   %eax,%eax
+801026e4:	75 23                	jne    80102709 <kallocn+0x7b>
+801026e6:	e9 93 00 00 00       	jmp    8010277e <kallocn+0xf0>
+  release(&kmem.lock);
+801026eb:	83 ec 0c             	sub    $0xc,%esp
+801026ee:	68 c0 57 11 80       	push   $0x801157c0
+801026f3:	e8 1e 4f 00 00       	call   80107616 <release>
+        break;
+    } else {
+      if(c->freelist == 0)
+        krefill(c, n - i);
+      if((r = c->freelist) == 0)
+801026f8:	8b 03                	mov    (%ebx),%eax
+801026fa:	83 c4 10             	add    $0x10,%esp
+801026fd:	85 c0                	test   %eax,%eax
+801026ff:	74 78                	je     80102779 <kallocn+0xeb>
+        break;
+      c->freelist = r->next;
+80102701:	8b 10                	mov    (%eax),%edx
+80102703:	89 13                	mov    %edx,(%ebx)
+      c->nfree--;
+80102705:	83 6b 04 01          	subl   $0x1,0x4(%ebx)
+    }
+    REF(r) = 1;
+80102709:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+8010270f:	c1 ea 0c             	shr    $0xc,%edx
+80102712:	66 c7 84 12 64 38 12 	movw   $0x1,-0x7fedc79c(%edx,%edx,1)
+80102719:	80 01 00 
+    pv[i] = (char*)r;
+8010271c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010271f:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+  for(i = 0; i < n; i++){
+80102722:	83 c6 01             	add    $0x1,%esi
+80102725:	39 75 0c             	cmp    %esi,0xc(%ebp)
+80102728:	7e 4b                	jle    80102775 <kallocn+0xe7>
+    if(c == 0){
+8010272a:	85 db                	test   %ebx,%ebx
+8010272c:	74 aa                	je     801026d8 <kallocn+0x4a>
+      if(c->freelist == 0)
+8010272e:	8b 03                	mov    (%ebx),%eax
+80102730:	85 c0                	test   %eax,%eax
+80102732:	75 cd                	jne    80102701 <kallocn+0x73>
+        krefill(c, n - i);
+80102734:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80102737:	29 f7                	sub    %esi,%edi
+  if(n < KBATCH)
+80102739:	b8 20 00 00 00       	mov    $0x20,%eax
+8010273e:	39 c7                	cmp    %eax,%edi
+80102740:	0f 4c f8             	cmovl  %eax,%edi
+  acquire(&kmem.lock);
+80102743:	83 ec 0c             	sub    $0xc,%esp
+80102746:	68 c0 57 11 80       	push   $0x801157c0
+8010274b:	e8 5f 4e 00 00       	call   801075af <acquire>
+80102750:	83 c4 10             	add    $0x10,%esp
+  for(; n > 0 && (r = (struct run*)balloc(0)) != 0; n--){
+80102753:	b8 00 00 00 00       	mov    $0x0,%eax
+80102758:	e8 ff fa ff ff       	call   8010225c <balloc>
+8010275d:	85 c0                	test   %eax,%eax
+8010275f:	74 8a                	je     801026eb <kallocn+0x5d>
+    r->next = c->freelist;
+80102761:	8b 13                	mov    (%ebx),%edx
+80102763:	89 10                	mov    %edx,(%eax)
+    c->freelist = r;
+80102765:	89 03                	mov    %eax,(%ebx)
+    c->nfree++;
+80102767:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  for(; n > 0 && (r = (struct run*)balloc(0)) != 0; n--){
+8010276b:	83 ef 01             	sub    $0x1,%edi
+8010276e:	75 e3                	jne    80102753 <kallocn+0xc5>
+80102770:	e9 76 ff ff ff       	jmp    801026eb <kallocn+0x5d>
+  }
+  if(c)
+80102775:	85 db                	test   %ebx,%ebx
+80102777:	74 05                	je     8010277e <kallocn+0xf0>
+    popcli();
+80102779:	e8 9d 4d 00 00       	call   8010751b <popcli>
+  return i;
+}
+8010277e:	89 f0                	mov    %esi,%eax
+80102780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102783:	5b                   	pop    %ebx
+80102784:	5e                   	pop    %esi
+80102785:	5f                   	pop    %edi
+80102786:	5d                   	pop    %ebp
+80102787:	c3                   	ret
+
+80102788 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80102788:	55                   	push   %ebp
+80102789:	89 e5                	mov    %esp,%ebp
+8010278b:	83 ec 20             	sub    $0x20,%esp
+  char *v;
+
+  if(kallocn(&v, 1) == 0)
+8010278e:	6a 01                	push   $0x1
+80102790:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80102793:	50                   	push   %eax
+80102794:	e8 f5 fe ff ff       	call   8010268e <kallocn>
+80102799:	83 c4 10             	add    $0x10,%esp
+8010279c:	85 c0                	test   %eax,%eax
+8010279e:	74 05                	je     801027a5 <kalloc+0x1d>
+    return 0;
+  return v;
+801027a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+801027a3:	c9                   	leave
+801027a4:	c3                   	ret
+    return 0;
+801027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+801027aa:	eb f7                	jmp    801027a3 <kalloc+0x1b>
+
+801027ac <kref>:
+
+// Add a reference to the allocated page v, for a page shared
+// copy-on-write.  Each reference is dropped with kfree().
+void
+kref(char *v)
+{
+801027ac:	55                   	push   %ebp
+801027ad:	89 e5                	mov    %esp,%ebp
+801027af:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_add(&REF(v), 1) == 0)
+801027b2:	8b 45 08             	mov    0x8(%ebp),%eax
+801027b5:	05 00 00 00 80       	add    $0x80000000,%eax
+801027ba:	c1 e8 0c             	shr    $0xc,%eax
+801027bd:	05 52 70 00 00       	add    $0x7052,%eax
+801027c2:	ba 01 00 00 00       	mov    $0x1,%edx
+801027c7:	66 f0 0f c1 94 00 c0 	lock xadd %dx,-0x7feea840(%eax,%eax,1)
+801027ce:	57 11 80 
+801027d1:	66 85 d2             	test   %dx,%dx
+801027d4:	74 02                	je     801027d8 <kref+0x2c>
+    panic("kref");
+}
+801027d6:	c9                   	leave
+801027d7:	c3                   	ret
+    panic("kref");
+801027d8:	83 ec 0c             	sub    $0xc,%esp
+801027db:	68 45 b0 10 80       	push   $0x8010b045
+801027e0:	e8 5d db ff ff       	call   80100342 <panic>
+
+801027e5 <krefs>:
+
+// Number of references to the allocated page v.
+int
+krefs(char *v)
+{
+801027e5:	55                   	push   %ebp
+801027e6:	89 e5                	mov    %esp,%ebp
+  return REF(v);
+801027e8:	8b 45 08             	mov    0x8(%ebp),%eax
+801027eb:	05 00 00 00 80       	add    $0x80000000,%eax
+801027f0:	c1 e8 0c             	shr    $0xc,%eax
+801027f3:	0f b7 84 00 64 38 12 	movzwl -0x7fedc79c(%eax,%eax,1),%eax
+801027fa:	80 
+}
+801027fb:	5d                   	pop    %ebp
+801027fc:	c3                   	ret
+
+801027fd <kmemstats>:
+
+// Fill in the free memory counts of vs: free blocks of each order,
+// and pages sitting in the per-CPU caches.
+void
+kmemstats(struct vmstats *vs)
+{
+801027fd:	55                   	push   %ebp
+801027fe:	89 e5                	mov    %esp,%ebp
+80102800:	56                   	push   %esi
+80102801:	53                   	push   %ebx
+80102802:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+  int o, i;
+
+  acquire(&kmem.lock);
+80102805:	83 ec 0c             	sub    $0xc,%esp
+80102808:	68 c0 57 11 80       	push   $0x801157c0
+8010280d:	e8 9d 4d 00 00       	call   801075af <acquire>
+  vs->freepages = 0;
+80102812:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  for(o = 0; o < NKORDER; o++){
+80102819:	8d 73 1c             	lea    0x1c(%ebx),%esi
+8010281c:	83 c4 10             	add    $0x10,%esp
+8010281f:	b9 00 00 00 00       	mov    $0x0,%ecx
+80102824:	eb 12                	jmp    80102838 <kmemstats+0x3b>
+    vs->freeblocks[o] = 0;
+    for(r = kmem.free[o]; r; r = r->next)
+      vs->freeblocks[o]++;
+    vs->freepages += vs->freeblocks[o] << o;
+80102826:	8b 02                	mov    (%edx),%eax
+80102828:	d3 e0                	shl    %cl,%eax
+8010282a:	01 43 18             	add    %eax,0x18(%ebx)
+  for(o = 0; o < NKORDER; o++){
+8010282d:	83 c1 01             	add    $0x1,%ecx
+80102830:	83 c6 04             	add    $0x4,%esi
+80102833:	83 f9 0b             	cmp    $0xb,%ecx
+80102836:	74 1e                	je     80102856 <kmemstats+0x59>
+    vs->freeblocks[o] = 0;
+80102838:	89 f2                	mov    %esi,%edx
+8010283a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    for(r = kmem.free[o]; r; r = r->next)
+80102840:	8b 04 8d f8 57 11 80 	mov    -0x7feea808(,%ecx,4),%eax
+80102847:	85 c0                	test   %eax,%eax
+80102849:	74 db                	je     80102826 <kmemstats+0x29>
+      vs->freeblocks[o]++;
+8010284b:	83 02 01             	addl   $0x1,(%edx)
+    for(r = kmem.free[o]; r; r = r->next)
+8010284e:	8b 00                	mov    (%eax),%eax
+80102850:	85 c0                	test   %eax,%eax
+80102852:	75 f7                	jne    8010284b <kmemstats+0x4e>
+80102854:	eb d0                	jmp    80102826 <kmemstats+0x29>
+  }
+  release(&kmem.lock);
+80102856:	83 ec 0c             	sub    $0xc,%esp
+80102859:	68 c0 57 11 80       	push   $0x801157c0
+8010285e:	e8 b3 4d 00 00       	call   80107616 <release>
+  vs->cachedpages = 0;
+80102863:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+8010286a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NCPU; i++)
+8010286d:	b8 00 00 00 00       	mov    $0x0,%eax
+    vs->cachedpages += kmem.cache[i].nfree;
+80102872:	8b 14 c5 28 38 12 80 	mov    -0x7fedc7d8(,%eax,8),%edx
+80102879:	01 53 48             	add    %edx,0x48(%ebx)
+  for(i = 0; i < NCPU; i++)
+8010287c:	83 c0 01             	add    $0x1,%eax
+8010287f:	83 f8 08             	cmp    $0x8,%eax
+80102882:	75 ee                	jne    80102872 <kmemstats+0x75>
+}
+80102884:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102887:	5b                   	pop    %ebx
+80102888:	5e                   	pop    %esi
+80102889:	5d                   	pop    %ebp
+8010288a:	c3                   	ret
+
+8010288b <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010288b:	ba 64 00 00 00       	mov    $0x64,%edx
+80102890:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80102891:	a8 01                	test   $0x1,%al
+80102893:	0f 84 ad 00 00 00    	je     80102946 <kbdgetc+0xbb>
+80102899:	ba 60 00 00 00       	mov    $0x60,%edx
+8010289e:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+8010289f:	0f b6 c8             	movzbl %al,%ecx
+
+  if(data == 0xE0){
+801028a2:	3c e0                	cmp    $0xe0,%al
+801028a4:	74 5b                	je     80102901 <kbdgetc+0x76>
+    shift |= E0ESC;
+    return 0;
+  } else if(data & 0x80){
+801028a6:	84 c0                	test   %al,%al
+801028a8:	78 64                	js     8010290e <kbdgetc+0x83>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+801028aa:	8b 15 64 f8 13 80    	mov    0x8013f864,%edx
+801028b0:	f6 c2 40             	test   $0x40,%dl
+801028b3:	74 0f                	je     801028c4 <kbdgetc+0x39>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+801028b5:	83 c8 80             	or     $0xffffff80,%eax
+801028b8:	0f b6 c8             	movzbl %al,%ecx
+    shift &= ~E0ESC;
+801028bb:	83 e2 bf             	and    $0xffffffbf,%edx
+801028be:	89 15 64 f8 13 80    	mov    %edx,0x8013f864
+  }
+
+  shift |= shiftcode[data];
+801028c4:	0f b6 91 80 b1 10 80 	movzbl -0x7fef4e80(%ecx),%edx
+801028cb:	0b 15 64 f8 13 80    	or     0x8013f864,%edx
+  shift ^= togglecode[data];
+801028d1:	0f b6 81 80 b0 10 80 	movzbl -0x7fef4f80(%ecx),%eax
+801028d8:	31 c2                	xor    %eax,%edx
+801028da:	89 15 64 f8 13 80    	mov    %edx,0x8013f864
+  c = charcode[shift & (CTL | SHIFT)][data];
+801028e0:	89 d0                	mov    %edx,%eax
+801028e2:	83 e0 03             	and    $0x3,%eax
+801028e5:	8b 04 85 60 b0 10 80 	mov    -0x7fef4fa0(,%eax,4),%eax
+801028ec:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+801028f0:	f6 c2 08             	test   $0x8,%dl
+801028f3:	74 56                	je     8010294b <kbdgetc+0xc0>
+    if('a' <= c && c <= 'z')
+801028f5:	8d 50 9f             	lea    -0x61(%eax),%edx
+801028f8:	83 fa 19             	cmp    $0x19,%edx
+801028fb:	77 3c                	ja     80102939 <kbdgetc+0xae>
+      c += 'A' - 'a';
+801028fd:	83 e8 20             	sub    $0x20,%eax
+80102900:	c3                   	ret
+    shift |= E0ESC;
+80102901:	83 0d 64 f8 13 80 40 	orl    $0x40,0x8013f864
+    return 0;
+80102908:	b8 00 00 00 00       	mov    $0x0,%eax
+8010290d:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+8010290e:	8b 15 64 f8 13 80    	mov    0x8013f864,%edx
+80102914:	83 e0 7f             	and    $0x7f,%eax
+80102917:	f6 c2 40             	test   $0x40,%dl
+8010291a:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+8010291d:	0f b6 81 80 b1 10 80 	movzbl -0x7fef4e80(%ecx),%eax
+80102924:	83 c8 40             	or     $0x40,%eax
+80102927:	0f b6 c0             	movzbl %al,%eax
+8010292a:	f7 d0                	not    %eax
+8010292c:	21 d0                	and    %edx,%eax
+8010292e:	a3 64 f8 13 80       	mov    %eax,0x8013f864
+    return 0;
+80102933:	b8 00 00 00 00       	mov    $0x0,%eax
+80102938:	c3                   	ret
+    else if('A' <= c && c <= 'Z')
+80102939:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+8010293c:	8d 50 20             	lea    0x20(%eax),%edx
+8010293f:	83 f9 1a             	cmp    $0x1a,%ecx
+80102942:	0f 42 c2             	cmovb  %edx,%eax
+  }
+  return c;
+80102945:	c3                   	ret
+    return -1;
+80102946:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010294b:	c3                   	ret
+
+8010294c <kbdintr>:
+
+void
+kbdintr(void)
+{
+8010294c:	55                   	push   %ebp
+8010294d:	89 e5                	mov    %esp,%ebp
+8010294f:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80102952:	68 8b 28 10 80       	push   $0x8010288b
+80102957:	e8 0f de ff ff       	call   8010076b <consoleintr>
+}
+8010295c:	83 c4 10             	add    $0x10,%esp
+8010295f:	c9                   	leave
+80102960:	c3                   	ret
+
+80102961 <lapicw>:
+
+//PAGEBREAK!
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+80102961:	8b 0d 68 f8 13 80    	mov    0x8013f868,%ecx
+80102967:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+8010296a:	89 10                	mov    %edx,(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010296c:	a1 68 f8 13 80       	mov    0x8013f868,%eax
+80102971:	8b 40 20             	mov    0x20(%eax),%eax
+}
+80102974:	c3                   	ret
+
+80102975 <fill_rtcdate>:
+
+  return inb(CMOS_RETURN);
+}
+
+static void fill_rtcdate(struct rtcdate *r)
+{
+80102975:	55                   	push   %ebp
+80102976:	89 e5                	mov    %esp,%ebp
+80102978:	56                   	push   %esi
+80102979:	53                   	push   %ebx
+8010297a:	89 c1                	mov    %eax,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010297c:	be 70 00 00 00       	mov    $0x70,%esi
+80102981:	b8 00 00 00 00       	mov    $0x0,%eax
+80102986:	89 f2                	mov    %esi,%edx
+80102988:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102989:	bb 71 00 00 00       	mov    $0x71,%ebx
+8010298e:	89 da                	mov    %ebx,%edx
+80102990:	ec                   	in     (%dx),%al
+  return inb(CMOS_RETURN);
+80102991:	0f b6 c0             	movzbl %al,%eax
+80102994:	89 01                	mov    %eax,(%ecx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102996:	b8 02 00 00 00       	mov    $0x2,%eax
+8010299b:	89 f2                	mov    %esi,%edx
+8010299d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010299e:	89 da                	mov    %ebx,%edx
+801029a0:	ec                   	in     (%dx),%al
+801029a1:	0f b6 c0             	movzbl %al,%eax
+801029a4:	89 41 04             	mov    %eax,0x4(%ecx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801029a7:	b8 04 00 00 00       	mov    $0x4,%eax
+801029ac:	89 f2                	mov    %esi,%edx
+801029ae:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801029af:	89 da                	mov    %ebx,%edx
+801029b1:	ec                   	in     (%dx),%al
+801029b2:	0f b6 c0             	movzbl %al,%eax
+801029b5:	89 41 08             	mov    %eax,0x8(%ecx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801029b8:	b8 07 00 00 00       	mov    $0x7,%eax
+801029bd:	89 f2                	mov    %esi,%edx
+801029bf:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801029c0:	89 da                	mov    %ebx,%edx
+801029c2:	ec                   	in     (%dx),%al
+801029c3:	0f b6 c0             	movzbl %al,%eax
+801029c6:	89 41 0c             	mov    %eax,0xc(%ecx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801029c9:	b8 08 00 00 00       	mov    $0x8,%eax
+801029ce:	89 f2                	mov    %esi,%edx
+801029d0:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801029d1:	89 da                	mov    %ebx,%edx
+801029d3:	ec                   	in     (%dx),%al
+801029d4:	0f b6 c0             	movzbl %al,%eax
+801029d7:	89 41 10             	mov    %eax,0x10(%ecx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801029da:	b8 09 00 00 00       	mov    $0x9,%eax
+801029df:	89 f2                	mov    %esi,%edx
+801029e1:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801029e2:	89 da                	mov    %ebx,%edx
+801029e4:	ec                   	in     (%dx),%al
+801029e5:	0f b6 c0             	movzbl %al,%eax
+801029e8:	89 41 14             	mov    %eax,0x14(%ecx)
+  r->minute = cmos_read(MINS);
+  r->hour   = cmos_read(HOURS);
+  r->day    = cmos_read(DAY);
+  r->month  = cmos_read(MONTH);
+  r->year   = cmos_read(YEAR);
+}
+801029eb:	5b                   	pop    %ebx
+801029ec:	5e                   	pop    %esi
+801029ed:	5d                   	pop    %ebp
+801029ee:	c3                   	ret
+
+801029ef <lapicinit>:
+  if(!lapic)
+801029ef:	83 3d 68 f8 13 80 00 	cmpl   $0x0,0x8013f868
+801029f6:	0f 84 ff 00 00 00    	je     80102afb <lapicinit+0x10c>
+{
+801029fc:	55                   	push   %ebp
+801029fd:	89 e5                	mov    %esp,%ebp
+801029ff:	83 ec 08             	sub    $0x8,%esp
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+80102a02:	ba 3f 01 00 00       	mov    $0x13f,%edx
+80102a07:	b8 3c 00 00 00       	mov    $0x3c,%eax
+80102a0c:	e8 50 ff ff ff       	call   80102961 <lapicw>
+  lapicw(TDCR, X1);
+80102a11:	ba 0b 00 00 00       	mov    $0xb,%edx
+80102a16:	b8 f8 00 00 00       	mov    $0xf8,%eax
+80102a1b:	e8 41 ff ff ff       	call   80102961 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+80102a20:	ba 20 00 02 00       	mov    $0x20020,%edx
+80102a25:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80102a2a:	e8 32 ff ff ff       	call   80102961 <lapicw>
+  lapicw(TICR, TICKCOUNT);
+80102a2f:	ba 40 42 0f 00       	mov    $0xf4240,%edx
+80102a34:	b8 e0 00 00 00       	mov    $0xe0,%eax
+80102a39:	e8 23 ff ff ff       	call   80102961 <lapicw>
+  lapicw(LINT0, MASKED);
+80102a3e:	ba 00 00 01 00       	mov    $0x10000,%edx
+80102a43:	b8 d4 00 00 00       	mov    $0xd4,%eax
+80102a48:	e8 14 ff ff ff       	call   80102961 <lapicw>
+  lapicw(LINT1, MASKED);
+80102a4d:	ba 00 00 01 00       	mov    $0x10000,%edx
+80102a52:	b8 d8 00 00 00       	mov    $0xd8,%eax
+80102a57:	e8 05 ff ff ff       	call   80102961 <lapicw>
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80102a5c:	a1 68 f8 13 80       	mov    0x8013f868,%eax
+80102a61:	8b 40 30             	mov    0x30(%eax),%eax
+80102a64:	c1 e8 10             	shr    $0x10,%eax
+80102a67:	a8 fc                	test   $0xfc,%al
+80102a69:	75 7c                	jne    80102ae7 <lapicinit+0xf8>
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+80102a6b:	ba 33 00 00 00       	mov    $0x33,%edx
+80102a70:	b8 dc 00 00 00       	mov    $0xdc,%eax
+80102a75:	e8 e7 fe ff ff       	call   80102961 <lapicw>
+  lapicw(ESR, 0);
+80102a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+80102a7f:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80102a84:	e8 d8 fe ff ff       	call   80102961 <lapicw>
+  lapicw(ESR, 0);
+80102a89:	ba 00 00 00 00       	mov    $0x0,%edx
+80102a8e:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80102a93:	e8 c9 fe ff ff       	call   80102961 <lapicw>
+  lapicw(EOI, 0);
+80102a98:	ba 00 00 00 00       	mov    $0x0,%edx
+80102a9d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80102aa2:	e8 ba fe ff ff       	call   80102961 <lapicw>
+  lapicw(ICRHI, 0);
+80102aa7:	ba 00 00 00 00       	mov    $0x0,%edx
+80102aac:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102ab1:	e8 ab fe ff ff       	call   80102961 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+80102ab6:	ba 00 85 08 00       	mov    $0x88500,%edx
+80102abb:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102ac0:	e8 9c fe ff ff       	call   80102961 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+80102ac5:	8b 15 68 f8 13 80    	mov    0x8013f868,%edx
+80102acb:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+80102ad1:	f6 c4 10             	test   $0x10,%ah
+80102ad4:	75 f5                	jne    80102acb <lapicinit+0xdc>
+  lapicw(TPR, 0);
+80102ad6:	ba 00 00 00 00       	mov    $0x0,%edx
+80102adb:	b8 20 00 00 00       	mov    $0x20,%eax
+80102ae0:	e8 7c fe ff ff       	call   80102961 <lapicw>
+}
+80102ae5:	c9                   	leave
+80102ae6:	c3                   	ret
+    lapicw(PCINT, MASKED);
+80102ae7:	ba 00 00 01 00       	mov    $0x10000,%edx
+80102aec:	b8 d0 00 00 00       	mov    $0xd0,%eax
+80102af1:	e8 6b fe ff ff       	call   80102961 <lapicw>
+80102af6:	e9 70 ff ff ff       	jmp    80102a6b <lapicinit+0x7c>
+80102afb:	c3                   	ret
+
+80102afc <lapicid>:
+  if (!lapic)
+80102afc:	a1 68 f8 13 80       	mov    0x8013f868,%eax
+80102b01:	85 c0                	test   %eax,%eax
+80102b03:	74 07                	je     80102b0c <lapicid+0x10>
+  return lapic[ID] >> 24;
+80102b05:	8b 40 20             	mov    0x20(%eax),%eax
+80102b08:	c1 e8 18             	shr    $0x18,%eax
+80102b0b:	c3                   	ret
+    return 0;
+80102b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80102b11:	c3                   	ret
+
+80102b12 <lapiceoi>:
+  if(lapic)
+80102b12:	83 3d 68 f8 13 80 00 	cmpl   $0x0,0x8013f868
+80102b19:	74 17                	je     80102b32 <lapiceoi+0x20>
+{
+80102b1b:	55                   	push   %ebp
+80102b1c:	89 e5                	mov    %esp,%ebp
+80102b1e:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+80102b21:	ba 00 00 00 00       	mov    $0x0,%edx
+80102b26:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80102b2b:	e8 31 fe ff ff       	call   80102961 <lapicw>
+}
+80102b30:	c9                   	leave
+80102b31:	c3                   	ret
+80102b32:	c3                   	ret
+
+80102b33 <lapicsettimer>:
+{
+80102b33:	55                   	push   %ebp
+80102b34:	89 e5                	mov    %esp,%ebp
+80102b36:	53                   	push   %ebx
+80102b37:	83 ec 04             	sub    $0x4,%esp
+80102b3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(!lapic)
+80102b3d:	83 3d 68 f8 13 80 00 	cmpl   $0x0,0x8013f868
+80102b44:	74 38                	je     80102b7e <lapicsettimer+0x4b>
+  if(n > 0xFFFFFFFF / TICKCOUNT)
+80102b46:	b8 c6 10 00 00       	mov    $0x10c6,%eax
+80102b4b:	39 c2                	cmp    %eax,%edx
+80102b4d:	0f 46 c2             	cmovbe %edx,%eax
+80102b50:	89 c3                	mov    %eax,%ebx
+  lapicw(TIMER, (periodic ? PERIODIC : 0) | (T_IRQ0 + IRQ_TIMER));
+80102b52:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+80102b56:	19 d2                	sbb    %edx,%edx
+80102b58:	81 e2 00 00 fe ff    	and    $0xfffe0000,%edx
+80102b5e:	81 c2 20 00 02 00    	add    $0x20020,%edx
+80102b64:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80102b69:	e8 f3 fd ff ff       	call   80102961 <lapicw>
+  lapicw(TICR, n * TICKCOUNT);
+80102b6e:	69 d3 40 42 0f 00    	imul   $0xf4240,%ebx,%edx
+80102b74:	b8 e0 00 00 00       	mov    $0xe0,%eax
+80102b79:	e8 e3 fd ff ff       	call   80102961 <lapicw>
+}
+80102b7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102b81:	c9                   	leave
+80102b82:	c3                   	ret
+
+80102b83 <lapicelapsed>:
+{
+80102b83:	55                   	push   %ebp
+80102b84:	89 e5                	mov    %esp,%ebp
+80102b86:	53                   	push   %ebx
+80102b87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!lapic)
+80102b8a:	a1 68 f8 13 80       	mov    0x8013f868,%eax
+80102b8f:	85 c0                	test   %eax,%eax
+80102b91:	74 42                	je     80102bd5 <lapicelapsed+0x52>
+  count = lapic[TICR] - lapic[TCCR];
+80102b93:	8b 88 80 03 00 00    	mov    0x380(%eax),%ecx
+80102b99:	8b 80 90 03 00 00    	mov    0x390(%eax),%eax
+80102b9f:	29 c1                	sub    %eax,%ecx
+  n = count / TICKCOUNT;
+80102ba1:	ba 83 de 1b 43       	mov    $0x431bde83,%edx
+80102ba6:	89 c8                	mov    %ecx,%eax
+80102ba8:	f7 e2                	mul    %edx
+80102baa:	89 d0                	mov    %edx,%eax
+80102bac:	c1 e8 12             	shr    $0x12,%eax
+  *frac += count % TICKCOUNT;
+80102baf:	69 d0 40 42 0f 00    	imul   $0xf4240,%eax,%edx
+80102bb5:	29 d1                	sub    %edx,%ecx
+80102bb7:	03 0b                	add    (%ebx),%ecx
+  if(*frac >= TICKCOUNT){
+80102bb9:	81 f9 3f 42 0f 00    	cmp    $0xf423f,%ecx
+80102bbf:	77 07                	ja     80102bc8 <lapicelapsed+0x45>
+  *frac += count % TICKCOUNT;
+80102bc1:	89 0b                	mov    %ecx,(%ebx)
+}
+80102bc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102bc6:	c9                   	leave
+80102bc7:	c3                   	ret
+    *frac -= TICKCOUNT;
+80102bc8:	81 e9 40 42 0f 00    	sub    $0xf4240,%ecx
+80102bce:	89 0b                	mov    %ecx,(%ebx)
+    n++;
+80102bd0:	83 c0 01             	add    $0x1,%eax
+80102bd3:	eb ee                	jmp    80102bc3 <lapicelapsed+0x40>
+    return 0;
+80102bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+80102bda:	eb e7                	jmp    80102bc3 <lapicelapsed+0x40>
+
+80102bdc <lapicipi>:
+  if(!lapic)
+80102bdc:	83 3d 68 f8 13 80 00 	cmpl   $0x0,0x8013f868
+80102be3:	74 36                	je     80102c1b <lapicipi+0x3f>
+{
+80102be5:	55                   	push   %ebp
+80102be6:	89 e5                	mov    %esp,%ebp
+80102be8:	83 ec 08             	sub    $0x8,%esp
+  lapicw(ICRHI, apicid<<24);
+80102beb:	8b 55 08             	mov    0x8(%ebp),%edx
+80102bee:	c1 e2 18             	shl    $0x18,%edx
+80102bf1:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102bf6:	e8 66 fd ff ff       	call   80102961 <lapicw>
+  lapicw(ICRLO, FIXED | vector);
+80102bfb:	8b 55 0c             	mov    0xc(%ebp),%edx
+80102bfe:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102c03:	e8 59 fd ff ff       	call   80102961 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+80102c08:	8b 15 68 f8 13 80    	mov    0x8013f868,%edx
+80102c0e:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+80102c14:	f6 c4 10             	test   $0x10,%ah
+80102c17:	75 f5                	jne    80102c0e <lapicipi+0x32>
+}
+80102c19:	c9                   	leave
+80102c1a:	c3                   	ret
+80102c1b:	c3                   	ret
+
+80102c1c <microdelay>:
+}
+80102c1c:	c3                   	ret
+
+80102c1d <lapicstartap>:
+{
+80102c1d:	55                   	push   %ebp
+80102c1e:	89 e5                	mov    %esp,%ebp
+80102c20:	56                   	push   %esi
+80102c21:	53                   	push   %ebx
+80102c22:	8b 75 08             	mov    0x8(%ebp),%esi
+80102c25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102c28:	b8 0f 00 00 00       	mov    $0xf,%eax
+80102c2d:	ba 70 00 00 00       	mov    $0x70,%edx
+80102c32:	ee                   	out    %al,(%dx)
+80102c33:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102c38:	ba 71 00 00 00       	mov    $0x71,%edx
+80102c3d:	ee                   	out    %al,(%dx)
+  wrv[0] = 0;
+80102c3e:	66 c7 05 67 04 00 80 	movw   $0x0,0x80000467
+80102c45:	00 00 
+  wrv[1] = addr >> 4;
+80102c47:	89 d8                	mov    %ebx,%eax
+80102c49:	c1 e8 04             	shr    $0x4,%eax
+80102c4c:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapicw(ICRHI, apicid<<24);
+80102c52:	c1 e6 18             	shl    $0x18,%esi
+80102c55:	89 f2                	mov    %esi,%edx
+80102c57:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102c5c:	e8 00 fd ff ff       	call   80102961 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+80102c61:	ba 00 c5 00 00       	mov    $0xc500,%edx
+80102c66:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102c6b:	e8 f1 fc ff ff       	call   80102961 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL);
+80102c70:	ba 00 85 00 00       	mov    $0x8500,%edx
+80102c75:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102c7a:	e8 e2 fc ff ff       	call   80102961 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102c7f:	c1 eb 0c             	shr    $0xc,%ebx
+80102c82:	80 cf 06             	or     $0x6,%bh
+    lapicw(ICRHI, apicid<<24);
+80102c85:	89 f2                	mov    %esi,%edx
+80102c87:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102c8c:	e8 d0 fc ff ff       	call   80102961 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102c91:	89 da                	mov    %ebx,%edx
+80102c93:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102c98:	e8 c4 fc ff ff       	call   80102961 <lapicw>
+    lapicw(ICRHI, apicid<<24);
+80102c9d:	89 f2                	mov    %esi,%edx
+80102c9f:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80102ca4:	e8 b8 fc ff ff       	call   80102961 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102ca9:	89 da                	mov    %ebx,%edx
+80102cab:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80102cb0:	e8 ac fc ff ff       	call   80102961 <lapicw>
+}
+80102cb5:	5b                   	pop    %ebx
+80102cb6:	5e                   	pop    %esi
+80102cb7:	5d                   	pop    %ebp
+80102cb8:	c3                   	ret
+
+80102cb9 <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void cmostime(struct rtcdate *r)
+{
+80102cb9:	55                   	push   %ebp
+80102cba:	89 e5                	mov    %esp,%ebp
+80102cbc:	57                   	push   %edi
+80102cbd:	56                   	push   %esi
+80102cbe:	53                   	push   %ebx
+80102cbf:	83 ec 4c             	sub    $0x4c,%esp
+80102cc2:	b8 0b 00 00 00       	mov    $0xb,%eax
+80102cc7:	ba 70 00 00 00       	mov    $0x70,%edx
+80102ccc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ccd:	ba 71 00 00 00       	mov    $0x71,%edx
+80102cd2:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+80102cd3:	83 e0 04             	and    $0x4,%eax
+80102cd6:	88 45 b7             	mov    %al,-0x49(%ebp)
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+80102cd9:	8d 75 d0             	lea    -0x30(%ebp),%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102cdc:	bf 0a 00 00 00       	mov    $0xa,%edi
+80102ce1:	89 f0                	mov    %esi,%eax
+80102ce3:	e8 8d fc ff ff       	call   80102975 <fill_rtcdate>
+80102ce8:	ba 70 00 00 00       	mov    $0x70,%edx
+80102ced:	89 f8                	mov    %edi,%eax
+80102cef:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102cf0:	ba 71 00 00 00       	mov    $0x71,%edx
+80102cf5:	ec                   	in     (%dx),%al
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80102cf6:	84 c0                	test   %al,%al
+80102cf8:	78 e7                	js     80102ce1 <cmostime+0x28>
+        continue;
+    fill_rtcdate(&t2);
+80102cfa:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+80102cfd:	89 d8                	mov    %ebx,%eax
+80102cff:	e8 71 fc ff ff       	call   80102975 <fill_rtcdate>
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80102d04:	83 ec 04             	sub    $0x4,%esp
+80102d07:	6a 18                	push   $0x18
+80102d09:	53                   	push   %ebx
+80102d0a:	56                   	push   %esi
+80102d0b:	e8 82 49 00 00       	call   80107692 <memcmp>
+80102d10:	83 c4 10             	add    $0x10,%esp
+80102d13:	85 c0                	test   %eax,%eax
+80102d15:	75 ca                	jne    80102ce1 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80102d17:	80 7d b7 00          	cmpb   $0x0,-0x49(%ebp)
+80102d1b:	75 78                	jne    80102d95 <cmostime+0xdc>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80102d1d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80102d20:	89 c2                	mov    %eax,%edx
+80102d22:	c1 ea 04             	shr    $0x4,%edx
+80102d25:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102d28:	83 e0 0f             	and    $0xf,%eax
+80102d2b:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102d2e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    CONV(minute);
+80102d31:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102d34:	89 c2                	mov    %eax,%edx
+80102d36:	c1 ea 04             	shr    $0x4,%edx
+80102d39:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102d3c:	83 e0 0f             	and    $0xf,%eax
+80102d3f:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102d42:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    CONV(hour  );
+80102d45:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102d48:	89 c2                	mov    %eax,%edx
+80102d4a:	c1 ea 04             	shr    $0x4,%edx
+80102d4d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102d50:	83 e0 0f             	and    $0xf,%eax
+80102d53:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102d56:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    CONV(day   );
+80102d59:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102d5c:	89 c2                	mov    %eax,%edx
+80102d5e:	c1 ea 04             	shr    $0x4,%edx
+80102d61:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102d64:	83 e0 0f             	and    $0xf,%eax
+80102d67:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102d6a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    CONV(month );
+80102d6d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102d70:	89 c2                	mov    %eax,%edx
+80102d72:	c1 ea 04             	shr    $0x4,%edx
+80102d75:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102d78:	83 e0 0f             	and    $0xf,%eax
+80102d7b:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102d7e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    CONV(year  );
+80102d81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102d84:	89 c2                	mov    %eax,%edx
+80102d86:	c1 ea 04             	shr    $0x4,%edx
+80102d89:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102d8c:	83 e0 0f             	and    $0xf,%eax
+80102d8f:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102d92:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80102d95:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80102d98:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80102d9b:	89 01                	mov    %eax,(%ecx)
+80102d9d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102da0:	89 41 04             	mov    %eax,0x4(%ecx)
+80102da3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102da6:	89 41 08             	mov    %eax,0x8(%ecx)
+80102da9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102dac:	89 41 0c             	mov    %eax,0xc(%ecx)
+80102daf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102db2:	89 41 10             	mov    %eax,0x10(%ecx)
+80102db5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102db8:	89 41 14             	mov    %eax,0x14(%ecx)
+  r->year += 2000;
+80102dbb:	81 41 14 d0 07 00 00 	addl   $0x7d0,0x14(%ecx)
+}
+80102dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102dc5:	5b                   	pop    %ebx
+80102dc6:	5e                   	pop    %esi
+80102dc7:	5f                   	pop    %edi
+80102dc8:	5d                   	pop    %ebp
+80102dc9:	c3                   	ret
+
+80102dca <install_trans>:
+static void
+install_trans(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102dca:	83 3d c8 f8 13 80 00 	cmpl   $0x0,0x8013f8c8
+80102dd1:	0f 8e 84 00 00 00    	jle    80102e5b <install_trans+0x91>
+{
+80102dd7:	55                   	push   %ebp
+80102dd8:	89 e5                	mov    %esp,%ebp
+80102dda:	57                   	push   %edi
+80102ddb:	56                   	push   %esi
+80102ddc:	53                   	push   %ebx
+80102ddd:	83 ec 1c             	sub    $0x1c,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102de0:	be 00 00 00 00       	mov    $0x0,%esi
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80102de5:	bf 80 f8 13 80       	mov    $0x8013f880,%edi
+80102dea:	83 ec 08             	sub    $0x8,%esp
+80102ded:	89 f0                	mov    %esi,%eax
+80102def:	03 47 34             	add    0x34(%edi),%eax
+80102df2:	83 c0 01             	add    $0x1,%eax
+80102df5:	50                   	push   %eax
+80102df6:	ff 77 44             	push   0x44(%edi)
+80102df9:	e8 ac d2 ff ff       	call   801000aa <bread>
+80102dfe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102e01:	83 c4 08             	add    $0x8,%esp
+80102e04:	ff 34 b5 cc f8 13 80 	push   -0x7fec0734(,%esi,4)
+80102e0b:	ff 77 44             	push   0x44(%edi)
+80102e0e:	e8 97 d2 ff ff       	call   801000aa <bread>
+80102e13:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80102e15:	83 c4 0c             	add    $0xc,%esp
+80102e18:	68 00 02 00 00       	push   $0x200
+80102e1d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102e20:	83 c0 5c             	add    $0x5c,%eax
+80102e23:	50                   	push   %eax
+80102e24:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80102e27:	50                   	push   %eax
+80102e28:	e8 a7 48 00 00       	call   801076d4 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80102e2d:	89 1c 24             	mov    %ebx,(%esp)
+80102e30:	e8 51 d3 ff ff       	call   80100186 <bwrite>
+    brelse(lbuf);
+80102e35:	83 c4 04             	add    $0x4,%esp
+80102e38:	ff 75 e4             	push   -0x1c(%ebp)
+80102e3b:	e8 81 d3 ff ff       	call   801001c1 <brelse>
+    brelse(dbuf);
+80102e40:	89 1c 24             	mov    %ebx,(%esp)
+80102e43:	e8 79 d3 ff ff       	call   801001c1 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102e48:	83 c6 01             	add    $0x1,%esi
+80102e4b:	83 c4 10             	add    $0x10,%esp
+80102e4e:	39 77 48             	cmp    %esi,0x48(%edi)
+80102e51:	7f 97                	jg     80102dea <install_trans+0x20>
+  }
+}
+80102e53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e56:	5b                   	pop    %ebx
+80102e57:	5e                   	pop    %esi
+80102e58:	5f                   	pop    %edi
+80102e59:	5d                   	pop    %ebp
+80102e5a:	c3                   	ret
+80102e5b:	c3                   	ret
+
+80102e5c <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80102e5c:	55                   	push   %ebp
+80102e5d:	89 e5                	mov    %esp,%ebp
+80102e5f:	53                   	push   %ebx
+80102e60:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80102e63:	ff 35 b4 f8 13 80    	push   0x8013f8b4
+80102e69:	ff 35 c4 f8 13 80    	push   0x8013f8c4
+80102e6f:	e8 36 d2 ff ff       	call   801000aa <bread>
+80102e74:	89 c3                	mov    %eax,%ebx
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+80102e76:	8b 0d c8 f8 13 80    	mov    0x8013f8c8,%ecx
+80102e7c:	89 48 5c             	mov    %ecx,0x5c(%eax)
+  for (i = 0; i < log.lh.n; i++) {
+80102e7f:	83 c4 10             	add    $0x10,%esp
+80102e82:	85 c9                	test   %ecx,%ecx
+80102e84:	7e 17                	jle    80102e9d <write_head+0x41>
+80102e86:	b8 00 00 00 00       	mov    $0x0,%eax
+    hb->block[i] = log.lh.block[i];
+80102e8b:	8b 14 85 cc f8 13 80 	mov    -0x7fec0734(,%eax,4),%edx
+80102e92:	89 54 83 60          	mov    %edx,0x60(%ebx,%eax,4)
+  for (i = 0; i < log.lh.n; i++) {
+80102e96:	83 c0 01             	add    $0x1,%eax
+80102e99:	39 c1                	cmp    %eax,%ecx
+80102e9b:	75 ee                	jne    80102e8b <write_head+0x2f>
+  }
+  bwrite(buf);
+80102e9d:	83 ec 0c             	sub    $0xc,%esp
+80102ea0:	53                   	push   %ebx
+80102ea1:	e8 e0 d2 ff ff       	call   80100186 <bwrite>
+  brelse(buf);
+80102ea6:	89 1c 24             	mov    %ebx,(%esp)
+80102ea9:	e8 13 d3 ff ff       	call   801001c1 <brelse>
+}
+80102eae:	83 c4 10             	add    $0x10,%esp
+80102eb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102eb4:	c9                   	leave
+80102eb5:	c3                   	ret
+
+80102eb6 <initlog>:
+{
+80102eb6:	55                   	push   %ebp
+80102eb7:	89 e5                	mov    %esp,%ebp
+80102eb9:	53                   	push   %ebx
+80102eba:	83 ec 2c             	sub    $0x2c,%esp
+80102ebd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80102ec0:	68 80 b2 10 80       	push   $0x8010b280
+80102ec5:	68 80 f8 13 80       	push   $0x8013f880
+80102eca:	e8 95 45 00 00       	call   80107464 <initlock>
+  readsb(dev, &sb);
+80102ecf:	83 c4 08             	add    $0x8,%esp
+80102ed2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80102ed5:	50                   	push   %eax
+80102ed6:	53                   	push   %ebx
+80102ed7:	e8 ba e4 ff ff       	call   80101396 <readsb>
+  log.start = sb.logstart;
+80102edc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80102edf:	a3 b4 f8 13 80       	mov    %eax,0x8013f8b4
+  log.size = sb.nlog;
+80102ee4:	8b 55 e8             	mov    -0x18(%ebp),%edx
+80102ee7:	89 15 b8 f8 13 80    	mov    %edx,0x8013f8b8
+  log.dev = dev;
+80102eed:	89 1d c4 f8 13 80    	mov    %ebx,0x8013f8c4
+  struct buf *buf = bread(log.dev, log.start);
+80102ef3:	83 c4 08             	add    $0x8,%esp
+80102ef6:	50                   	push   %eax
+80102ef7:	53                   	push   %ebx
+80102ef8:	e8 ad d1 ff ff       	call   801000aa <bread>
+  log.lh.n = lh->n;
+80102efd:	8b 58 5c             	mov    0x5c(%eax),%ebx
+80102f00:	89 1d c8 f8 13 80    	mov    %ebx,0x8013f8c8
+  for (i = 0; i < log.lh.n; i++) {
+80102f06:	83 c4 10             	add    $0x10,%esp
+80102f09:	85 db                	test   %ebx,%ebx
+80102f0b:	7e 17                	jle    80102f24 <initlog+0x6e>
+80102f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+    log.lh.block[i] = lh->block[i];
+80102f12:	8b 4c 90 60          	mov    0x60(%eax,%edx,4),%ecx
+80102f16:	89 0c 95 cc f8 13 80 	mov    %ecx,-0x7fec0734(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80102f1d:	83 c2 01             	add    $0x1,%edx
+80102f20:	39 d3                	cmp    %edx,%ebx
+80102f22:	75 ee                	jne    80102f12 <initlog+0x5c>
+  brelse(buf);
+80102f24:	83 ec 0c             	sub    $0xc,%esp
+80102f27:	50                   	push   %eax
+80102f28:	e8 94 d2 ff ff       	call   801001c1 <brelse>
+
+static void
+recover_from_log(void)
+{
+  read_head();
+  install_trans(); // if committed, copy from log to disk
+80102f2d:	e8 98 fe ff ff       	call   80102dca <install_trans>
+  log.lh.n = 0;
+80102f32:	c7 05 c8 f8 13 80 00 	movl   $0x0,0x8013f8c8
+80102f39:	00 00 00 
+  write_head(); // clear the log
+80102f3c:	e8 1b ff ff ff       	call   80102e5c <write_head>
+}
+80102f41:	83 c4 10             	add    $0x10,%esp
+80102f44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102f47:	c9                   	leave
+80102f48:	c3                   	ret
+
+80102f49 <begin_op>:
+}
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+80102f49:	55                   	push   %ebp
+80102f4a:	89 e5                	mov    %esp,%ebp
+80102f4c:	53                   	push   %ebx
+80102f4d:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+80102f50:	68 80 f8 13 80       	push   $0x8013f880
+80102f55:	e8 55 46 00 00       	call   801075af <acquire>
+80102f5a:	83 c4 10             	add    $0x10,%esp
+  while(1){
+    if(log.committing){
+80102f5d:	bb 80 f8 13 80       	mov    $0x8013f880,%ebx
+80102f62:	eb 15                	jmp    80102f79 <begin_op+0x30>
+      sleep(&log, &log.lock);
+80102f64:	83 ec 08             	sub    $0x8,%esp
+80102f67:	68 80 f8 13 80       	push   $0x8013f880
+80102f6c:	68 80 f8 13 80       	push   $0x8013f880
+80102f71:	e8 a5 1b 00 00       	call   80104b1b <sleep>
+80102f76:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80102f79:	83 7b 40 00          	cmpl   $0x0,0x40(%ebx)
+80102f7d:	75 e5                	jne    80102f64 <begin_op+0x1b>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80102f7f:	8b 43 3c             	mov    0x3c(%ebx),%eax
+80102f82:	83 c0 01             	add    $0x1,%eax
+80102f85:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80102f88:	8b 53 48             	mov    0x48(%ebx),%edx
+80102f8b:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80102f8e:	83 fa 1e             	cmp    $0x1e,%edx
+80102f91:	7e 17                	jle    80102faa <begin_op+0x61>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+80102f93:	83 ec 08             	sub    $0x8,%esp
+80102f96:	68 80 f8 13 80       	push   $0x8013f880
+80102f9b:	68 80 f8 13 80       	push   $0x8013f880
+80102fa0:	e8 76 1b 00 00       	call   80104b1b <sleep>
+80102fa5:	83 c4 10             	add    $0x10,%esp
+80102fa8:	eb cf                	jmp    80102f79 <begin_op+0x30>
+    } else {
+      log.outstanding += 1;
+80102faa:	a3 bc f8 13 80       	mov    %eax,0x8013f8bc
+      release(&log.lock);
+80102faf:	83 ec 0c             	sub    $0xc,%esp
+80102fb2:	68 80 f8 13 80       	push   $0x8013f880
+80102fb7:	e8 5a 46 00 00       	call   80107616 <release>
+      break;
+    }
+  }
+}
+80102fbc:	83 c4 10             	add    $0x10,%esp
+80102fbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102fc2:	c9                   	leave
+80102fc3:	c3                   	ret
+
+80102fc4 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+80102fc4:	55                   	push   %ebp
+80102fc5:	89 e5                	mov    %esp,%ebp
+80102fc7:	57                   	push   %edi
+80102fc8:	56                   	push   %esi
+80102fc9:	53                   	push   %ebx
+80102fca:	83 ec 28             	sub    $0x28,%esp
+  int do_commit = 0;
+
+  acquire(&log.lock);
+80102fcd:	68 80 f8 13 80       	push   $0x8013f880
+80102fd2:	e8 d8 45 00 00       	call   801075af <acquire>
+  log.outstanding -= 1;
+80102fd7:	a1 bc f8 13 80       	mov    0x8013f8bc,%eax
+80102fdc:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80102fdf:	89 1d bc f8 13 80    	mov    %ebx,0x8013f8bc
+  if(log.committing)
+80102fe5:	83 c4 10             	add    $0x10,%esp
+80102fe8:	83 3d c0 f8 13 80 00 	cmpl   $0x0,0x8013f8c0
+80102fef:	75 60                	jne    80103051 <end_op+0x8d>
+    panic("log.committing");
+  if(log.outstanding == 0){
+80102ff1:	85 db                	test   %ebx,%ebx
+80102ff3:	75 69                	jne    8010305e <end_op+0x9a>
+    do_commit = 1;
+    log.committing = 1;
+80102ff5:	c7 05 c0 f8 13 80 01 	movl   $0x1,0x8013f8c0
+80102ffc:	00 00 00 
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+80102fff:	83 ec 0c             	sub    $0xc,%esp
+80103002:	68 80 f8 13 80       	push   $0x8013f880
+80103007:	e8 0a 46 00 00       	call   80107616 <release>
+}
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+8010300c:	83 c4 10             	add    $0x10,%esp
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+8010300f:	bf 80 f8 13 80       	mov    $0x8013f880,%edi
+  if (log.lh.n > 0) {
+80103014:	83 3d c8 f8 13 80 00 	cmpl   $0x0,0x8013f8c8
+8010301b:	7f 65                	jg     80103082 <end_op+0xbe>
+    acquire(&log.lock);
+8010301d:	83 ec 0c             	sub    $0xc,%esp
+80103020:	68 80 f8 13 80       	push   $0x8013f880
+80103025:	e8 85 45 00 00       	call   801075af <acquire>
+    log.committing = 0;
+8010302a:	c7 05 c0 f8 13 80 00 	movl   $0x0,0x8013f8c0
+80103031:	00 00 00 
+    wakeup(&log);
+80103034:	c7 04 24 80 f8 13 80 	movl   $0x8013f880,(%esp)
+8010303b:	e8 68 1c 00 00       	call   80104ca8 <wakeup>
+    release(&log.lock);
+80103040:	c7 04 24 80 f8 13 80 	movl   $0x8013f880,(%esp)
+80103047:	e8 ca 45 00 00       	call   80107616 <release>
+8010304c:	83 c4 10             	add    $0x10,%esp
+}
+8010304f:	eb 29                	jmp    8010307a <end_op+0xb6>
+    panic("log.committing");
+80103051:	83 ec 0c             	sub    $0xc,%esp
+80103054:	68 84 b2 10 80       	push   $0x8010b284
+80103059:	e8 e4 d2 ff ff       	call   80100342 <panic>
+    wakeup(&log);
+8010305e:	83 ec 0c             	sub    $0xc,%esp
+80103061:	68 80 f8 13 80       	push   $0x8013f880
+80103066:	e8 3d 1c 00 00       	call   80104ca8 <wakeup>
+  release(&log.lock);
+8010306b:	c7 04 24 80 f8 13 80 	movl   $0x8013f880,(%esp)
+80103072:	e8 9f 45 00 00       	call   80107616 <release>
+80103077:	83 c4 10             	add    $0x10,%esp
+}
+8010307a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010307d:	5b                   	pop    %ebx
+8010307e:	5e                   	pop    %esi
+8010307f:	5f                   	pop    %edi
+80103080:	5d                   	pop    %ebp
+80103081:	c3                   	ret
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80103082:	83 ec 08             	sub    $0x8,%esp
+80103085:	89 d8                	mov    %ebx,%eax
+80103087:	03 47 34             	add    0x34(%edi),%eax
+8010308a:	83 c0 01             	add    $0x1,%eax
+8010308d:	50                   	push   %eax
+8010308e:	ff 77 44             	push   0x44(%edi)
+80103091:	e8 14 d0 ff ff       	call   801000aa <bread>
+80103096:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80103098:	83 c4 08             	add    $0x8,%esp
+8010309b:	ff 34 9d cc f8 13 80 	push   -0x7fec0734(,%ebx,4)
+801030a2:	ff 77 44             	push   0x44(%edi)
+801030a5:	e8 00 d0 ff ff       	call   801000aa <bread>
+    memmove(to->data, from->data, BSIZE);
+801030aa:	83 c4 0c             	add    $0xc,%esp
+801030ad:	68 00 02 00 00       	push   $0x200
+801030b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801030b5:	83 c0 5c             	add    $0x5c,%eax
+801030b8:	50                   	push   %eax
+801030b9:	8d 46 5c             	lea    0x5c(%esi),%eax
+801030bc:	50                   	push   %eax
+801030bd:	e8 12 46 00 00       	call   801076d4 <memmove>
+    bwrite(to);  // write the log
+801030c2:	89 34 24             	mov    %esi,(%esp)
+801030c5:	e8 bc d0 ff ff       	call   80100186 <bwrite>
+    brelse(from);
+801030ca:	83 c4 04             	add    $0x4,%esp
+801030cd:	ff 75 e4             	push   -0x1c(%ebp)
+801030d0:	e8 ec d0 ff ff       	call   801001c1 <brelse>
+    brelse(to);
+801030d5:	89 34 24             	mov    %esi,(%esp)
+801030d8:	e8 e4 d0 ff ff       	call   801001c1 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+801030dd:	83 c3 01             	add    $0x1,%ebx
+801030e0:	83 c4 10             	add    $0x10,%esp
+801030e3:	3b 5f 48             	cmp    0x48(%edi),%ebx
+801030e6:	7c 9a                	jl     80103082 <end_op+0xbe>
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+801030e8:	e8 6f fd ff ff       	call   80102e5c <write_head>
+    install_trans(); // Now install writes to home locations
+801030ed:	e8 d8 fc ff ff       	call   80102dca <install_trans>
+    log.lh.n = 0;
+801030f2:	c7 05 c8 f8 13 80 00 	movl   $0x0,0x8013f8c8
+801030f9:	00 00 00 
+    write_head();    // Erase the transaction from the log
+801030fc:	e8 5b fd ff ff       	call   80102e5c <write_head>
+80103101:	e9 17 ff ff ff       	jmp    8010301d <end_op+0x59>
+
+80103106 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80103106:	55                   	push   %ebp
+80103107:	89 e5                	mov    %esp,%ebp
+80103109:	53                   	push   %ebx
+8010310a:	83 ec 04             	sub    $0x4,%esp
+8010310d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103110:	8b 15 c8 f8 13 80    	mov    0x8013f8c8,%edx
+80103116:	83 fa 1d             	cmp    $0x1d,%edx
+80103119:	7f 5c                	jg     80103177 <log_write+0x71>
+8010311b:	a1 b8 f8 13 80       	mov    0x8013f8b8,%eax
+80103120:	83 e8 01             	sub    $0x1,%eax
+80103123:	39 c2                	cmp    %eax,%edx
+80103125:	7d 50                	jge    80103177 <log_write+0x71>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80103127:	83 3d bc f8 13 80 00 	cmpl   $0x0,0x8013f8bc
+8010312e:	7e 54                	jle    80103184 <log_write+0x7e>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80103130:	83 ec 0c             	sub    $0xc,%esp
+80103133:	68 80 f8 13 80       	push   $0x8013f880
+80103138:	e8 72 44 00 00       	call   801075af <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+8010313d:	8b 15 c8 f8 13 80    	mov    0x8013f8c8,%edx
+80103143:	83 c4 10             	add    $0x10,%esp
+80103146:	85 d2                	test   %edx,%edx
+80103148:	7e 47                	jle    80103191 <log_write+0x8b>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+8010314a:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+8010314d:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103152:	39 0c 85 cc f8 13 80 	cmp    %ecx,-0x7fec0734(,%eax,4)
+80103159:	74 3b                	je     80103196 <log_write+0x90>
+  for (i = 0; i < log.lh.n; i++) {
+8010315b:	83 c0 01             	add    $0x1,%eax
+8010315e:	39 d0                	cmp    %edx,%eax
+80103160:	75 f0                	jne    80103152 <log_write+0x4c>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80103162:	8b 43 08             	mov    0x8(%ebx),%eax
+80103165:	89 04 95 cc f8 13 80 	mov    %eax,-0x7fec0734(,%edx,4)
+  if (i == log.lh.n)
+    log.lh.n++;
+8010316c:	83 c2 01             	add    $0x1,%edx
+8010316f:	89 15 c8 f8 13 80    	mov    %edx,0x8013f8c8
+80103175:	eb 2d                	jmp    801031a4 <log_write+0x9e>
+    panic("too big a transaction");
+80103177:	83 ec 0c             	sub    $0xc,%esp
+8010317a:	68 93 b2 10 80       	push   $0x8010b293
+8010317f:	e8 be d1 ff ff       	call   80100342 <panic>
+    panic("log_write outside of trans");
+80103184:	83 ec 0c             	sub    $0xc,%esp
+80103187:	68 a9 b2 10 80       	push   $0x8010b2a9
+8010318c:	e8 b1 d1 ff ff       	call   80100342 <panic>
+  for (i = 0; i < log.lh.n; i++) {
+80103191:	b8 00 00 00 00       	mov    $0x0,%eax
+  log.lh.block[i] = b->blockno;
+80103196:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80103199:	89 0c 85 cc f8 13 80 	mov    %ecx,-0x7fec0734(,%eax,4)
+  if (i == log.lh.n)
+801031a0:	39 c2                	cmp    %eax,%edx
+801031a2:	74 15                	je     801031b9 <log_write+0xb3>
+  b->flags |= B_DIRTY; // prevent eviction
+801031a4:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+801031a7:	83 ec 0c             	sub    $0xc,%esp
+801031aa:	68 80 f8 13 80       	push   $0x8013f880
+801031af:	e8 62 44 00 00       	call   80107616 <release>
+}
+801031b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801031b7:	c9                   	leave
+801031b8:	c3                   	ret
+801031b9:	89 c2                	mov    %eax,%edx
+801031bb:	eb af                	jmp    8010316c <log_write+0x66>
+
+801031bd <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801031bd:	55                   	push   %ebp
+801031be:	89 e5                	mov    %esp,%ebp
+801031c0:	53                   	push   %ebx
+801031c1:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801031c4:	e8 72 12 00 00       	call   8010443b <cpuid>
+801031c9:	89 c3                	mov    %eax,%ebx
+801031cb:	e8 6b 12 00 00       	call   8010443b <cpuid>
+801031d0:	83 ec 04             	sub    $0x4,%esp
+801031d3:	53                   	push   %ebx
+801031d4:	50                   	push   %eax
+801031d5:	68 c4 b2 10 80       	push   $0x8010b2c4
+801031da:	e8 25 d4 ff ff       	call   80100604 <cprintf>
+  idtinit();       // load idt register
+801031df:	e8 d4 5b 00 00       	call   80108db8 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+801031e4:	e8 f3 11 00 00       	call   801043dc <mycpu>
+801031e9:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+801031eb:	b8 01 00 00 00       	mov    $0x1,%eax
+801031f0:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+801031f7:	e8 19 1c 00 00       	call   80104e15 <scheduler>
+
+801031fc <mpenter>:
+{
+801031fc:	55                   	push   %ebp
+801031fd:	89 e5                	mov    %esp,%ebp
+801031ff:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80103202:	e8 d4 6c 00 00       	call   80109edb <switchkvm>
+  seginit();
+80103207:	e8 58 6b 00 00       	call   80109d64 <seginit>
+  lapicinit();
+8010320c:	e8 de f7 ff ff       	call   801029ef <lapicinit>
+  mpmain();
+80103211:	e8 a7 ff ff ff       	call   801031bd <mpmain>
+
+80103216 <main>:
+{
+80103216:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+8010321a:	83 e4 f0             	and    $0xfffffff0,%esp
+8010321d:	ff 71 fc             	push   -0x4(%ecx)
+80103220:	55                   	push   %ebp
+80103221:	89 e5                	mov    %esp,%ebp
+80103223:	53                   	push   %ebx
+80103224:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80103225:	83 ec 08             	sub    $0x8,%esp
+80103228:	68 00 00 40 80       	push   $0x80400000
+8010322d:	68 d0 f3 15 80       	push   $0x8015f3d0
+80103232:	e8 05 f4 ff ff       	call   8010263c <kinit1>
+  kvmalloc();      // kernel page table
+80103237:	e8 ad 6c 00 00       	call   80109ee9 <kvmalloc>
+  mpinit();        // detect other processors
+8010323c:	e8 5f 01 00 00       	call   801033a0 <mpinit>
+  lapicinit();     // interrupt controller
+80103241:	e8 a9 f7 ff ff       	call   801029ef <lapicinit>
+  seginit();       // segment descriptors
+80103246:	e8 19 6b 00 00       	call   80109d64 <seginit>
+  picinit();       // disable pic
+8010324b:	e8 ba 05 00 00       	call   8010380a <picinit>
+  ioapicinit();    // another interrupt controller
+80103250:	e8 d6 ee ff ff       	call   8010212b <ioapicinit>
+  consoleinit();   // console hardware
+80103255:	e8 f1 d6 ff ff       	call   8010094b <consoleinit>
+  uartinit();      // serial port
+8010325a:	e8 d8 5e 00 00       	call   80109137 <uartinit>
+  pinit();         // process table
+8010325f:	e8 16 11 00 00       	call   8010437a <pinit>
+  tvinit();        // trap vectors
+80103264:	e8 e0 5a 00 00       	call   80108d49 <tvinit>
+  binit();         // buffer cache
+80103269:	e8 c6 cd ff ff       	call   80100034 <binit>
+  pcinit();        // program page cache
+8010326e:	e8 ee 02 00 00       	call   80103561 <pcinit>
+  fileinit();      // file table
+80103273:	e8 66 db ff ff       	call   80100dde <fileinit>
+  ideinit();       // disk 
+80103278:	e8 b6 ec ff ff       	call   80101f33 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+8010327d:	83 c4 0c             	add    $0xc,%esp
+80103280:	68 8a 00 00 00       	push   $0x8a
+80103285:	68 8c e4 10 80       	push   $0x8010e48c
+8010328a:	68 00 70 00 80       	push   $0x80007000
+8010328f:	e8 40 44 00 00       	call   801076d4 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80103294:	a1 64 f9 13 80       	mov    0x8013f964,%eax
+80103299:	8d 04 40             	lea    (%eax,%eax,2),%eax
+8010329c:	c1 e0 06             	shl    $0x6,%eax
+8010329f:	05 80 f9 13 80       	add    $0x8013f980,%eax
+801032a4:	83 c4 10             	add    $0x10,%esp
+801032a7:	3d 80 f9 13 80       	cmp    $0x8013f980,%eax
+801032ac:	76 6d                	jbe    8010331b <main+0x105>
+801032ae:	bb 80 f9 13 80       	mov    $0x8013f980,%ebx
+801032b3:	eb 1a                	jmp    801032cf <main+0xb9>
+801032b5:	81 c3 c0 00 00 00    	add    $0xc0,%ebx
+801032bb:	a1 64 f9 13 80       	mov    0x8013f964,%eax
+801032c0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+801032c3:	c1 e0 06             	shl    $0x6,%eax
+801032c6:	05 80 f9 13 80       	add    $0x8013f980,%eax
+801032cb:	39 c3                	cmp    %eax,%ebx
+801032cd:	73 4c                	jae    8010331b <main+0x105>
+    if(c == mycpu())  // We've started already.
+801032cf:	e8 08 11 00 00       	call   801043dc <mycpu>
+801032d4:	39 c3                	cmp    %eax,%ebx
+801032d6:	74 dd                	je     801032b5 <main+0x9f>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+801032d8:	e8 ab f4 ff ff       	call   80102788 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+801032dd:	05 00 10 00 00       	add    $0x1000,%eax
+801032e2:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    *(void**)(code-8) = mpenter;
+801032e7:	c7 05 f8 6f 00 80 fc 	movl   $0x801031fc,0x80006ff8
+801032ee:	31 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+801032f1:	c7 05 f4 6f 00 80 00 	movl   $0x10d000,0x80006ff4
+801032f8:	d0 10 00 
+
+    lapicstartap(c->apicid, V2P(code));
+801032fb:	83 ec 08             	sub    $0x8,%esp
+801032fe:	68 00 70 00 00       	push   $0x7000
+80103303:	0f b6 03             	movzbl (%ebx),%eax
+80103306:	50                   	push   %eax
+80103307:	e8 11 f9 ff ff       	call   80102c1d <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+8010330c:	83 c4 10             	add    $0x10,%esp
+8010330f:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80103315:	85 c0                	test   %eax,%eax
+80103317:	74 f6                	je     8010330f <main+0xf9>
+80103319:	eb 9a                	jmp    801032b5 <main+0x9f>
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+8010331b:	83 ec 08             	sub    $0x8,%esp
+8010331e:	68 00 00 00 8e       	push   $0x8e000000
+80103323:	68 00 00 40 80       	push   $0x80400000
+80103328:	e8 41 f3 ff ff       	call   8010266e <kinit2>
+  userinit();      // first user process
+8010332d:	e8 0d 33 00 00       	call   8010663f <userinit>
+  mpmain();        // finish this processor's setup
+80103332:	e8 86 fe ff ff       	call   801031bd <mpmain>
+
+80103337 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80103337:	55                   	push   %ebp
+80103338:	89 e5                	mov    %esp,%ebp
+8010333a:	57                   	push   %edi
+8010333b:	56                   	push   %esi
+8010333c:	53                   	push   %ebx
+8010333d:	83 ec 0c             	sub    $0xc,%esp
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80103340:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+  e = addr+len;
+80103346:	8d 3c 16             	lea    (%esi,%edx,1),%edi
+  for(p = addr; p < e; p += sizeof(struct mp))
+80103349:	39 fe                	cmp    %edi,%esi
+8010334b:	73 4c                	jae    80103399 <mpsearch1+0x62>
+8010334d:	8d 98 10 00 00 80    	lea    -0x7ffffff0(%eax),%ebx
+80103353:	eb 0e                	jmp    80103363 <mpsearch1+0x2c>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80103355:	84 c0                	test   %al,%al
+80103357:	74 36                	je     8010338f <mpsearch1+0x58>
+  for(p = addr; p < e; p += sizeof(struct mp))
+80103359:	83 c6 10             	add    $0x10,%esi
+8010335c:	83 c3 10             	add    $0x10,%ebx
+8010335f:	39 fe                	cmp    %edi,%esi
+80103361:	73 27                	jae    8010338a <mpsearch1+0x53>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80103363:	83 ec 04             	sub    $0x4,%esp
+80103366:	6a 04                	push   $0x4
+80103368:	68 d8 b2 10 80       	push   $0x8010b2d8
+8010336d:	56                   	push   %esi
+8010336e:	e8 1f 43 00 00       	call   80107692 <memcmp>
+80103373:	83 c4 10             	add    $0x10,%esp
+80103376:	85 c0                	test   %eax,%eax
+80103378:	75 df                	jne    80103359 <mpsearch1+0x22>
+8010337a:	89 f2                	mov    %esi,%edx
+    sum += addr[i];
+8010337c:	0f b6 0a             	movzbl (%edx),%ecx
+8010337f:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80103381:	83 c2 01             	add    $0x1,%edx
+80103384:	39 da                	cmp    %ebx,%edx
+80103386:	75 f4                	jne    8010337c <mpsearch1+0x45>
+80103388:	eb cb                	jmp    80103355 <mpsearch1+0x1e>
+      return (struct mp*)p;
+  return 0;
+8010338a:	be 00 00 00 00       	mov    $0x0,%esi
+}
+8010338f:	89 f0                	mov    %esi,%eax
+80103391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103394:	5b                   	pop    %ebx
+80103395:	5e                   	pop    %esi
+80103396:	5f                   	pop    %edi
+80103397:	5d                   	pop    %ebp
+80103398:	c3                   	ret
+  return 0;
+80103399:	be 00 00 00 00       	mov    $0x0,%esi
+8010339e:	eb ef                	jmp    8010338f <mpsearch1+0x58>
+
+801033a0 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+801033a0:	55                   	push   %ebp
+801033a1:	89 e5                	mov    %esp,%ebp
+801033a3:	57                   	push   %edi
+801033a4:	56                   	push   %esi
+801033a5:	53                   	push   %ebx
+801033a6:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+801033a9:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+801033b0:	c1 e0 08             	shl    $0x8,%eax
+801033b3:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+801033ba:	09 d0                	or     %edx,%eax
+801033bc:	c1 e0 04             	shl    $0x4,%eax
+801033bf:	0f 84 c9 00 00 00    	je     8010348e <mpinit+0xee>
+    if((mp = mpsearch1(p, 1024)))
+801033c5:	ba 00 04 00 00       	mov    $0x400,%edx
+801033ca:	e8 68 ff ff ff       	call   80103337 <mpsearch1>
+801033cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801033d2:	85 c0                	test   %eax,%eax
+801033d4:	75 1a                	jne    801033f0 <mpinit+0x50>
+  return mpsearch1(0xF0000, 0x10000);
+801033d6:	ba 00 00 01 00       	mov    $0x10000,%edx
+801033db:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+801033e0:	e8 52 ff ff ff       	call   80103337 <mpsearch1>
+801033e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+801033e8:	85 c0                	test   %eax,%eax
+801033ea:	0f 84 64 01 00 00    	je     80103554 <mpinit+0x1b4>
+801033f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801033f3:	8b 70 04             	mov    0x4(%eax),%esi
+801033f6:	85 f6                	test   %esi,%esi
+801033f8:	0f 84 56 01 00 00    	je     80103554 <mpinit+0x1b4>
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+801033fe:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103404:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80103407:	83 ec 04             	sub    $0x4,%esp
+8010340a:	6a 04                	push   $0x4
+8010340c:	68 dd b2 10 80       	push   $0x8010b2dd
+80103411:	50                   	push   %eax
+80103412:	e8 7b 42 00 00       	call   80107692 <memcmp>
+80103417:	89 c3                	mov    %eax,%ebx
+80103419:	83 c4 10             	add    $0x10,%esp
+8010341c:	85 c0                	test   %eax,%eax
+8010341e:	0f 85 30 01 00 00    	jne    80103554 <mpinit+0x1b4>
+  if(conf->version != 1 && conf->version != 4)
+80103424:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+8010342b:	3c 01                	cmp    $0x1,%al
+8010342d:	74 08                	je     80103437 <mpinit+0x97>
+8010342f:	3c 04                	cmp    $0x4,%al
+80103431:	0f 85 1d 01 00 00    	jne    80103554 <mpinit+0x1b4>
+  if(sum((uchar*)conf, conf->length) != 0)
+80103437:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+8010343e:	66 85 d2             	test   %dx,%dx
+80103441:	74 22                	je     80103465 <mpinit+0xc5>
+80103443:	89 f0                	mov    %esi,%eax
+80103445:	0f b7 d2             	movzwl %dx,%edx
+80103448:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+  sum = 0;
+8010344b:	89 da                	mov    %ebx,%edx
+    sum += addr[i];
+8010344d:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+80103454:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+80103456:	83 c0 01             	add    $0x1,%eax
+80103459:	39 f8                	cmp    %edi,%eax
+8010345b:	75 f0                	jne    8010344d <mpinit+0xad>
+  if(sum((uchar*)conf, conf->length) != 0)
+8010345d:	84 d2                	test   %dl,%dl
+8010345f:	0f 85 ef 00 00 00    	jne    80103554 <mpinit+0x1b4>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80103465:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+8010346b:	a3 68 f8 13 80       	mov    %eax,0x8013f868
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103470:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+80103476:	0f b7 8e 04 00 00 80 	movzwl -0x7ffffffc(%esi),%ecx
+8010347d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103480:	01 cf                	add    %ecx,%edi
+80103482:	89 f9                	mov    %edi,%ecx
+  ismp = 1;
+80103484:	be 01 00 00 00       	mov    $0x1,%esi
+80103489:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+8010348c:	eb 40                	jmp    801034ce <mpinit+0x12e>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+8010348e:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80103495:	c1 e0 08             	shl    $0x8,%eax
+80103498:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010349f:	09 d0                	or     %edx,%eax
+801034a1:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+801034a4:	2d 00 04 00 00       	sub    $0x400,%eax
+801034a9:	ba 00 04 00 00       	mov    $0x400,%edx
+801034ae:	e8 84 fe ff ff       	call   80103337 <mpsearch1>
+801034b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801034b6:	85 c0                	test   %eax,%eax
+801034b8:	0f 85 32 ff ff ff    	jne    801033f0 <mpinit+0x50>
+801034be:	e9 13 ff ff ff       	jmp    801033d6 <mpinit+0x36>
+    switch(*p){
+801034c3:	83 ea 03             	sub    $0x3,%edx
+801034c6:	80 fa 01             	cmp    $0x1,%dl
+801034c9:	76 15                	jbe    801034e0 <mpinit+0x140>
+801034cb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801034ce:	39 c8                	cmp    %ecx,%eax
+801034d0:	73 4b                	jae    8010351d <mpinit+0x17d>
+    switch(*p){
+801034d2:	0f b6 10             	movzbl (%eax),%edx
+801034d5:	80 fa 02             	cmp    $0x2,%dl
+801034d8:	74 34                	je     8010350e <mpinit+0x16e>
+801034da:	77 e7                	ja     801034c3 <mpinit+0x123>
+801034dc:	84 d2                	test   %dl,%dl
+801034de:	74 05                	je     801034e5 <mpinit+0x145>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+801034e0:	83 c0 08             	add    $0x8,%eax
+      continue;
+801034e3:	eb e9                	jmp    801034ce <mpinit+0x12e>
+      if(ncpu < NCPU) {
+801034e5:	8b 15 64 f9 13 80    	mov    0x8013f964,%edx
+801034eb:	83 fa 07             	cmp    $0x7,%edx
+801034ee:	7f 19                	jg     80103509 <mpinit+0x169>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801034f0:	8d 3c 52             	lea    (%edx,%edx,2),%edi
+801034f3:	c1 e7 06             	shl    $0x6,%edi
+801034f6:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+801034fa:	88 9f 80 f9 13 80    	mov    %bl,-0x7fec0680(%edi)
+        ncpu++;
+80103500:	83 c2 01             	add    $0x1,%edx
+80103503:	89 15 64 f9 13 80    	mov    %edx,0x8013f964
+      p += sizeof(struct mpproc);
+80103509:	83 c0 14             	add    $0x14,%eax
+      continue;
+8010350c:	eb c0                	jmp    801034ce <mpinit+0x12e>
+      ioapicid = ioapic->apicno;
+8010350e:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+80103512:	88 15 60 f9 13 80    	mov    %dl,0x8013f960
+      p += sizeof(struct mpioapic);
+80103518:	83 c0 08             	add    $0x8,%eax
+      continue;
+8010351b:	eb b1                	jmp    801034ce <mpinit+0x12e>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+8010351d:	85 f6                	test   %esi,%esi
+8010351f:	74 26                	je     80103547 <mpinit+0x1a7>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80103521:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103524:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+80103528:	74 15                	je     8010353f <mpinit+0x19f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010352a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010352f:	ba 22 00 00 00       	mov    $0x22,%edx
+80103534:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103535:	ba 23 00 00 00       	mov    $0x23,%edx
+8010353a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010353b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010353e:	ee                   	out    %al,(%dx)
+  }
+}
+8010353f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103542:	5b                   	pop    %ebx
+80103543:	5e                   	pop    %esi
+80103544:	5f                   	pop    %edi
+80103545:	5d                   	pop    %ebp
+80103546:	c3                   	ret
+    panic("Didn't find a suitable machine");
+80103547:	83 ec 0c             	sub    $0xc,%esp
+8010354a:	68 fc b2 10 80       	push   $0x8010b2fc
+8010354f:	e8 ee cd ff ff       	call   80100342 <panic>
+    panic("Expect to run on an SMP");
+80103554:	83 ec 0c             	sub    $0xc,%esp
+80103557:	68 e2 b2 10 80       	push   $0x8010b2e2
+8010355c:	e8 e1 cd ff ff       	call   80100342 <panic>
+
+80103561 <pcinit>:
+  ushort nino[NPCACHE];   // Entries held for inodes, by PCIHASH
+} pcache;
+
+void
+pcinit(void)
+{
+80103561:	55                   	push   %ebp
+80103562:	89 e5                	mov    %esp,%ebp
+80103564:	83 ec 10             	sub    $0x10,%esp
+  initlock(&pcache.lock, "pcache");
+80103567:	68 1b b3 10 80       	push   $0x8010b31b
+8010356c:	68 80 ff 13 80       	push   $0x8013ff80
+80103571:	e8 ee 3e 00 00       	call   80107464 <initlock>
+}
+80103576:	83 c4 10             	add    $0x10,%esp
+80103579:	c9                   	leave
+8010357a:	c3                   	ret
+
+8010357b <pcget>:
+// if there is no memory or the file is too short.  Caller must hold
+// ip->lock, which also keeps two processes from reading the same
+// page at once.
+char*
+pcget(struct inode *ip, uint off)
+{
+8010357b:	55                   	push   %ebp
+8010357c:	89 e5                	mov    %esp,%ebp
+8010357e:	57                   	push   %edi
+8010357f:	56                   	push   %esi
+80103580:	53                   	push   %ebx
+80103581:	83 ec 18             	sub    $0x18,%esp
+80103584:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct pcent *e;
+  char *mem;
+
+  e = &pcache.ent[PCHASH(ip->dev, ip->inum, off)];
+80103587:	8b 07                	mov    (%edi),%eax
+80103589:	89 c3                	mov    %eax,%ebx
+8010358b:	c1 e3 05             	shl    $0x5,%ebx
+8010358e:	29 c3                	sub    %eax,%ebx
+80103590:	8b 57 04             	mov    0x4(%edi),%edx
+80103593:	89 d0                	mov    %edx,%eax
+80103595:	c1 e0 04             	shl    $0x4,%eax
+80103598:	01 d0                	add    %edx,%eax
+8010359a:	01 c3                	add    %eax,%ebx
+8010359c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010359f:	c1 e8 0c             	shr    $0xc,%eax
+801035a2:	01 c3                	add    %eax,%ebx
+801035a4:	0f b6 db             	movzbl %bl,%ebx
+  acquire(&pcache.lock);
+801035a7:	68 80 ff 13 80       	push   $0x8013ff80
+801035ac:	e8 fe 3f 00 00       	call   801075af <acquire>
+  if(e->page && e->dev == ip->dev && e->inum == ip->inum && e->off == off){
+801035b1:	89 d8                	mov    %ebx,%eax
+801035b3:	c1 e0 04             	shl    $0x4,%eax
+801035b6:	8b b0 c0 ff 13 80    	mov    -0x7fec0040(%eax),%esi
+801035bc:	83 c4 10             	add    $0x10,%esp
+801035bf:	85 f6                	test   %esi,%esi
+801035c1:	74 13                	je     801035d6 <pcget+0x5b>
+801035c3:	89 d8                	mov    %ebx,%eax
+801035c5:	c1 e0 04             	shl    $0x4,%eax
+801035c8:	8b 0f                	mov    (%edi),%ecx
+801035ca:	39 88 b4 ff 13 80    	cmp    %ecx,-0x7fec004c(%eax)
+801035d0:	0f 84 0c 01 00 00    	je     801036e2 <pcget+0x167>
+    kref(mem);
+    release(&pcache.lock);
+    __sync_fetch_and_add(&vmstat.textshared, 1);
+    return mem;
+  }
+  release(&pcache.lock);
+801035d6:	83 ec 0c             	sub    $0xc,%esp
+801035d9:	68 80 ff 13 80       	push   $0x8013ff80
+801035de:	e8 33 40 00 00       	call   80107616 <release>
+
+  if((mem = kalloc()) == 0)
+801035e3:	e8 a0 f1 ff ff       	call   80102788 <kalloc>
+801035e8:	89 c6                	mov    %eax,%esi
+801035ea:	83 c4 10             	add    $0x10,%esp
+801035ed:	85 c0                	test   %eax,%eax
+801035ef:	0f 84 e3 00 00 00    	je     801036d8 <pcget+0x15d>
+    return 0;
+  if(readi(ip, mem, off, PGSIZE) != PGSIZE){
+801035f5:	68 00 10 00 00       	push   $0x1000
+801035fa:	ff 75 0c             	push   0xc(%ebp)
+801035fd:	50                   	push   %eax
+801035fe:	57                   	push   %edi
+801035ff:	e8 29 e3 ff ff       	call   8010192d <readi>
+80103604:	83 c4 10             	add    $0x10,%esp
+80103607:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010360c:	0f 85 1a 01 00 00    	jne    8010372c <pcget+0x1b1>
+    kfree(mem);
+    return 0;
+  }
+  __sync_fetch_and_add(&vmstat.filefaults, 1);
+80103612:	f0 83 05 8c e3 15 80 	lock addl $0x1,0x8015e38c
+80103619:	01 
+
+  acquire(&pcache.lock);
+8010361a:	83 ec 0c             	sub    $0xc,%esp
+8010361d:	68 80 ff 13 80       	push   $0x8013ff80
+80103622:	e8 88 3f 00 00       	call   801075af <acquire>
+  if(e->page){
+80103627:	89 d8                	mov    %ebx,%eax
+80103629:	c1 e0 04             	shl    $0x4,%eax
+8010362c:	8b 80 c0 ff 13 80    	mov    -0x7fec0040(%eax),%eax
+80103632:	83 c4 10             	add    $0x10,%esp
+80103635:	85 c0                	test   %eax,%eax
+80103637:	74 3c                	je     80103675 <pcget+0xfa>
+    kfree(e->page);
+80103639:	83 ec 0c             	sub    $0xc,%esp
+8010363c:	50                   	push   %eax
+8010363d:	e8 8d ef ff ff       	call   801025cf <kfree>
+    pcache.nino[PCIHASH(e->dev, e->inum)]--;
+80103642:	89 d8                	mov    %ebx,%eax
+80103644:	c1 e0 04             	shl    $0x4,%eax
+80103647:	8d 90 b0 ff 13 80    	lea    -0x7fec0050(%eax),%edx
+8010364d:	8b 88 b4 ff 13 80    	mov    -0x7fec004c(%eax),%ecx
+80103653:	89 c8                	mov    %ecx,%eax
+80103655:	c1 e0 05             	shl    $0x5,%eax
+80103658:	29 c8                	sub    %ecx,%eax
+8010365a:	8b 4a 08             	mov    0x8(%edx),%ecx
+8010365d:	89 ca                	mov    %ecx,%edx
+8010365f:	c1 e2 04             	shl    $0x4,%edx
+80103662:	01 ca                	add    %ecx,%edx
+80103664:	01 d0                	add    %edx,%eax
+80103666:	0f b6 c0             	movzbl %al,%eax
+80103669:	66 83 ac 00 b4 0f 14 	subw   $0x1,-0x7febf04c(%eax,%eax,1)
+80103670:	80 01 
+80103672:	83 c4 10             	add    $0x10,%esp
+  }
+  pcache.nino[PCIHASH(ip->dev, ip->inum)]++;
+80103675:	8b 17                	mov    (%edi),%edx
+80103677:	89 d0                	mov    %edx,%eax
+80103679:	c1 e0 05             	shl    $0x5,%eax
+8010367c:	29 d0                	sub    %edx,%eax
+8010367e:	8b 4f 04             	mov    0x4(%edi),%ecx
+80103681:	89 ca                	mov    %ecx,%edx
+80103683:	c1 e2 04             	shl    $0x4,%edx
+80103686:	01 ca                	add    %ecx,%edx
+80103688:	01 d0                	add    %edx,%eax
+8010368a:	0f b6 c0             	movzbl %al,%eax
+8010368d:	66 83 84 00 b4 0f 14 	addw   $0x1,-0x7febf04c(%eax,%eax,1)
+80103694:	80 01 
+  e->dev = ip->dev;
+80103696:	8b 17                	mov    (%edi),%edx
+80103698:	c1 e3 04             	shl    $0x4,%ebx
+8010369b:	89 93 b4 ff 13 80    	mov    %edx,-0x7fec004c(%ebx)
+  e->inum = ip->inum;
+801036a1:	8b 57 04             	mov    0x4(%edi),%edx
+801036a4:	89 93 b8 ff 13 80    	mov    %edx,-0x7fec0048(%ebx)
+  e->off = off;
+801036aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801036ad:	89 8b bc ff 13 80    	mov    %ecx,-0x7fec0044(%ebx)
+  e->page = mem;
+801036b3:	89 b3 c0 ff 13 80    	mov    %esi,-0x7fec0040(%ebx)
+  kref(mem);
+801036b9:	83 ec 0c             	sub    $0xc,%esp
+801036bc:	56                   	push   %esi
+801036bd:	e8 ea f0 ff ff       	call   801027ac <kref>
+  ip->pcached = 1;
+801036c2:	c7 47 54 01 00 00 00 	movl   $0x1,0x54(%edi)
+  release(&pcache.lock);
+801036c9:	c7 04 24 80 ff 13 80 	movl   $0x8013ff80,(%esp)
+801036d0:	e8 41 3f 00 00       	call   80107616 <release>
+  return mem;
+801036d5:	83 c4 10             	add    $0x10,%esp
+}
+801036d8:	89 f0                	mov    %esi,%eax
+801036da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801036dd:	5b                   	pop    %ebx
+801036de:	5e                   	pop    %esi
+801036df:	5f                   	pop    %edi
+801036e0:	5d                   	pop    %ebp
+801036e1:	c3                   	ret
+  if(e->page && e->dev == ip->dev && e->inum == ip->inum && e->off == off){
+801036e2:	89 d8                	mov    %ebx,%eax
+801036e4:	c1 e0 04             	shl    $0x4,%eax
+801036e7:	8b 4f 04             	mov    0x4(%edi),%ecx
+801036ea:	39 88 b8 ff 13 80    	cmp    %ecx,-0x7fec0048(%eax)
+801036f0:	0f 85 e0 fe ff ff    	jne    801035d6 <pcget+0x5b>
+801036f6:	89 d8                	mov    %ebx,%eax
+801036f8:	c1 e0 04             	shl    $0x4,%eax
+801036fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801036fe:	39 88 bc ff 13 80    	cmp    %ecx,-0x7fec0044(%eax)
+80103704:	0f 85 cc fe ff ff    	jne    801035d6 <pcget+0x5b>
+    kref(mem);
+8010370a:	83 ec 0c             	sub    $0xc,%esp
+8010370d:	56                   	push   %esi
+8010370e:	e8 99 f0 ff ff       	call   801027ac <kref>
+    release(&pcache.lock);
+80103713:	c7 04 24 80 ff 13 80 	movl   $0x8013ff80,(%esp)
+8010371a:	e8 f7 3e 00 00       	call   80107616 <release>
+    __sync_fetch_and_add(&vmstat.textshared, 1);
+8010371f:	f0 83 05 90 e3 15 80 	lock addl $0x1,0x8015e390
+80103726:	01 
+    return mem;
+80103727:	83 c4 10             	add    $0x10,%esp
+8010372a:	eb ac                	jmp    801036d8 <pcget+0x15d>
+    kfree(mem);
+8010372c:	83 ec 0c             	sub    $0xc,%esp
+8010372f:	56                   	push   %esi
+80103730:	e8 9a ee ff ff       	call   801025cf <kfree>
+    return 0;
+80103735:	83 c4 10             	add    $0x10,%esp
+80103738:	be 00 00 00 00       	mov    $0x0,%esi
+8010373d:	eb 99                	jmp    801036d8 <pcget+0x15d>
+
+8010373f <pcinval>:
+
+// Drop every cached page of ip.  Caller must hold ip->lock.
+void
+pcinval(struct inode *ip)
+{
+8010373f:	55                   	push   %ebp
+80103740:	89 e5                	mov    %esp,%ebp
+80103742:	56                   	push   %esi
+80103743:	53                   	push   %ebx
+80103744:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct pcent *e;
+
+  if(!ip->pcached)
+80103747:	83 7e 54 00          	cmpl   $0x0,0x54(%esi)
+8010374b:	75 07                	jne    80103754 <pcinval+0x15>
+      pcache.nino[PCIHASH(e->dev, e->inum)]--;
+    }
+  }
+  ip->pcached = 0;
+  release(&pcache.lock);
+}
+8010374d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103750:	5b                   	pop    %ebx
+80103751:	5e                   	pop    %esi
+80103752:	5d                   	pop    %ebp
+80103753:	c3                   	ret
+  acquire(&pcache.lock);
+80103754:	83 ec 0c             	sub    $0xc,%esp
+80103757:	68 80 ff 13 80       	push   $0x8013ff80
+8010375c:	e8 4e 3e 00 00       	call   801075af <acquire>
+80103761:	83 c4 10             	add    $0x10,%esp
+  for(e = pcache.ent; e < &pcache.ent[NPCACHE]; e++){
+80103764:	bb b4 ff 13 80       	mov    $0x8013ffb4,%ebx
+80103769:	eb 0b                	jmp    80103776 <pcinval+0x37>
+8010376b:	83 c3 10             	add    $0x10,%ebx
+8010376e:	81 fb b4 0f 14 80    	cmp    $0x80140fb4,%ebx
+80103774:	74 4b                	je     801037c1 <pcinval+0x82>
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum){
+80103776:	8b 43 0c             	mov    0xc(%ebx),%eax
+80103779:	85 c0                	test   %eax,%eax
+8010377b:	74 ee                	je     8010376b <pcinval+0x2c>
+8010377d:	8b 0e                	mov    (%esi),%ecx
+8010377f:	39 0b                	cmp    %ecx,(%ebx)
+80103781:	75 e8                	jne    8010376b <pcinval+0x2c>
+80103783:	8b 56 04             	mov    0x4(%esi),%edx
+80103786:	39 53 04             	cmp    %edx,0x4(%ebx)
+80103789:	75 e0                	jne    8010376b <pcinval+0x2c>
+      kfree(e->page);
+8010378b:	83 ec 0c             	sub    $0xc,%esp
+8010378e:	50                   	push   %eax
+8010378f:	e8 3b ee ff ff       	call   801025cf <kfree>
+      e->page = 0;
+80103794:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+      pcache.nino[PCIHASH(e->dev, e->inum)]--;
+8010379b:	8b 13                	mov    (%ebx),%edx
+8010379d:	89 d0                	mov    %edx,%eax
+8010379f:	c1 e0 05             	shl    $0x5,%eax
+801037a2:	29 d0                	sub    %edx,%eax
+801037a4:	8b 4b 04             	mov    0x4(%ebx),%ecx
+801037a7:	89 ca                	mov    %ecx,%edx
+801037a9:	c1 e2 04             	shl    $0x4,%edx
+801037ac:	01 ca                	add    %ecx,%edx
+801037ae:	01 d0                	add    %edx,%eax
+801037b0:	0f b6 c0             	movzbl %al,%eax
+801037b3:	66 83 ac 00 b4 0f 14 	subw   $0x1,-0x7febf04c(%eax,%eax,1)
+801037ba:	80 01 
+801037bc:	83 c4 10             	add    $0x10,%esp
+801037bf:	eb aa                	jmp    8010376b <pcinval+0x2c>
+  ip->pcached = 0;
+801037c1:	c7 46 54 00 00 00 00 	movl   $0x0,0x54(%esi)
+  release(&pcache.lock);
+801037c8:	83 ec 0c             	sub    $0xc,%esp
+801037cb:	68 80 ff 13 80       	push   $0x8013ff80
+801037d0:	e8 41 3e 00 00       	call   80107616 <release>
+801037d5:	83 c4 10             	add    $0x10,%esp
+801037d8:	e9 70 ff ff ff       	jmp    8010374d <pcinval+0xe>
+
+801037dd <pcheld>:
+// Might the cache hold pages of inode inum on dev?  Pages are only
+// added with the inode locked, so for an inode with no in-memory
+// copy the answer cannot change under the caller.
+int
+pcheld(uint dev, uint inum)
+{
+801037dd:	55                   	push   %ebp
+801037de:	89 e5                	mov    %esp,%ebp
+801037e0:	8b 55 08             	mov    0x8(%ebp),%edx
+801037e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  return pcache.nino[PCIHASH(dev, inum)] != 0;
+801037e6:	89 d0                	mov    %edx,%eax
+801037e8:	c1 e0 05             	shl    $0x5,%eax
+801037eb:	29 d0                	sub    %edx,%eax
+801037ed:	89 ca                	mov    %ecx,%edx
+801037ef:	c1 e2 04             	shl    $0x4,%edx
+801037f2:	01 ca                	add    %ecx,%edx
+801037f4:	01 d0                	add    %edx,%eax
+801037f6:	0f b6 c0             	movzbl %al,%eax
+801037f9:	66 83 bc 00 b4 0f 14 	cmpw   $0x0,-0x7febf04c(%eax,%eax,1)
+80103800:	80 00 
+80103802:	0f 95 c0             	setne  %al
+80103805:	0f b6 c0             	movzbl %al,%eax
+}
+80103808:	5d                   	pop    %ebp
+80103809:	c3                   	ret
+
+8010380a <picinit>:
+8010380a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010380f:	ba 21 00 00 00       	mov    $0x21,%edx
+80103814:	ee                   	out    %al,(%dx)
+80103815:	ba a1 00 00 00       	mov    $0xa1,%edx
+8010381a:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+8010381b:	c3                   	ret
+
+8010381c <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+8010381c:	55                   	push   %ebp
+8010381d:	89 e5                	mov    %esp,%ebp
+8010381f:	57                   	push   %edi
+80103820:	56                   	push   %esi
+80103821:	53                   	push   %ebx
+80103822:	83 ec 0c             	sub    $0xc,%esp
+80103825:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103828:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010382b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80103831:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80103837:	e8 bc d5 ff ff       	call   80100df8 <filealloc>
+8010383c:	89 03                	mov    %eax,(%ebx)
+8010383e:	85 c0                	test   %eax,%eax
+80103840:	0f 84 a6 00 00 00    	je     801038ec <pipealloc+0xd0>
+80103846:	e8 ad d5 ff ff       	call   80100df8 <filealloc>
+8010384b:	89 06                	mov    %eax,(%esi)
+8010384d:	85 c0                	test   %eax,%eax
+8010384f:	0f 84 85 00 00 00    	je     801038da <pipealloc+0xbe>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+80103855:	e8 2e ef ff ff       	call   80102788 <kalloc>
+8010385a:	89 c7                	mov    %eax,%edi
+8010385c:	85 c0                	test   %eax,%eax
+8010385e:	74 72                	je     801038d2 <pipealloc+0xb6>
+    goto bad;
+  p->readopen = 1;
+80103860:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+80103867:	00 00 00 
+  p->writeopen = 1;
+8010386a:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+80103871:	00 00 00 
+  p->nwrite = 0;
+80103874:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+8010387b:	00 00 00 
+  p->nread = 0;
+8010387e:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+80103885:	00 00 00 
+  initlock(&p->lock, "pipe");
+80103888:	83 ec 08             	sub    $0x8,%esp
+8010388b:	68 22 b3 10 80       	push   $0x8010b322
+80103890:	50                   	push   %eax
+80103891:	e8 ce 3b 00 00       	call   80107464 <initlock>
+  (*f0)->type = FD_PIPE;
+80103896:	8b 03                	mov    (%ebx),%eax
+80103898:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+8010389e:	8b 03                	mov    (%ebx),%eax
+801038a0:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+801038a4:	8b 03                	mov    (%ebx),%eax
+801038a6:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+801038aa:	8b 03                	mov    (%ebx),%eax
+801038ac:	89 78 0c             	mov    %edi,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+801038af:	8b 06                	mov    (%esi),%eax
+801038b1:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+801038b7:	8b 06                	mov    (%esi),%eax
+801038b9:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+801038bd:	8b 06                	mov    (%esi),%eax
+801038bf:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+801038c3:	8b 06                	mov    (%esi),%eax
+801038c5:	89 78 0c             	mov    %edi,0xc(%eax)
+  return 0;
+801038c8:	83 c4 10             	add    $0x10,%esp
+801038cb:	b8 00 00 00 00       	mov    $0x0,%eax
+801038d0:	eb 36                	jmp    80103908 <pipealloc+0xec>
+
+//PAGEBREAK: 20
+ bad:
+  if(p)
+    kfree((char*)p);
+  if(*f0)
+801038d2:	8b 03                	mov    (%ebx),%eax
+801038d4:	85 c0                	test   %eax,%eax
+801038d6:	75 08                	jne    801038e0 <pipealloc+0xc4>
+801038d8:	eb 12                	jmp    801038ec <pipealloc+0xd0>
+801038da:	8b 03                	mov    (%ebx),%eax
+801038dc:	85 c0                	test   %eax,%eax
+801038de:	74 30                	je     80103910 <pipealloc+0xf4>
+    fileclose(*f0);
+801038e0:	83 ec 0c             	sub    $0xc,%esp
+801038e3:	50                   	push   %eax
+801038e4:	e8 b3 d5 ff ff       	call   80100e9c <fileclose>
+801038e9:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+801038ec:	8b 16                	mov    (%esi),%edx
+    fileclose(*f1);
+  return -1;
+801038ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if(*f1)
+801038f3:	85 d2                	test   %edx,%edx
+801038f5:	74 11                	je     80103908 <pipealloc+0xec>
+    fileclose(*f1);
+801038f7:	83 ec 0c             	sub    $0xc,%esp
+801038fa:	52                   	push   %edx
+801038fb:	e8 9c d5 ff ff       	call   80100e9c <fileclose>
+80103900:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80103903:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103908:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010390b:	5b                   	pop    %ebx
+8010390c:	5e                   	pop    %esi
+8010390d:	5f                   	pop    %edi
+8010390e:	5d                   	pop    %ebp
+8010390f:	c3                   	ret
+  return -1;
+80103910:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103915:	eb f1                	jmp    80103908 <pipealloc+0xec>
+
+80103917 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80103917:	55                   	push   %ebp
+80103918:	89 e5                	mov    %esp,%ebp
+8010391a:	53                   	push   %ebx
+8010391b:	83 ec 10             	sub    $0x10,%esp
+8010391e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+80103921:	53                   	push   %ebx
+80103922:	e8 88 3c 00 00       	call   801075af <acquire>
+  if(writable){
+80103927:	83 c4 10             	add    $0x10,%esp
+8010392a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010392e:	74 3f                	je     8010396f <pipeclose+0x58>
+    p->writeopen = 0;
+80103930:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+80103937:	00 00 00 
+    wakeup(&p->nread);
+8010393a:	83 ec 0c             	sub    $0xc,%esp
+8010393d:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80103943:	50                   	push   %eax
+80103944:	e8 5f 13 00 00       	call   80104ca8 <wakeup>
+80103949:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+8010394c:	83 bb 3c 02 00 00 00 	cmpl   $0x0,0x23c(%ebx)
+80103953:	75 09                	jne    8010395e <pipeclose+0x47>
+80103955:	83 bb 40 02 00 00 00 	cmpl   $0x0,0x240(%ebx)
+8010395c:	74 2f                	je     8010398d <pipeclose+0x76>
+    release(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+8010395e:	83 ec 0c             	sub    $0xc,%esp
+80103961:	53                   	push   %ebx
+80103962:	e8 af 3c 00 00       	call   80107616 <release>
+80103967:	83 c4 10             	add    $0x10,%esp
+}
+8010396a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010396d:	c9                   	leave
+8010396e:	c3                   	ret
+    p->readopen = 0;
+8010396f:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+80103976:	00 00 00 
+    wakeup(&p->nwrite);
+80103979:	83 ec 0c             	sub    $0xc,%esp
+8010397c:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+80103982:	50                   	push   %eax
+80103983:	e8 20 13 00 00       	call   80104ca8 <wakeup>
+80103988:	83 c4 10             	add    $0x10,%esp
+8010398b:	eb bf                	jmp    8010394c <pipeclose+0x35>
+    release(&p->lock);
+8010398d:	83 ec 0c             	sub    $0xc,%esp
+80103990:	53                   	push   %ebx
+80103991:	e8 80 3c 00 00       	call   80107616 <release>
+    kfree((char*)p);
+80103996:	89 1c 24             	mov    %ebx,(%esp)
+80103999:	e8 31 ec ff ff       	call   801025cf <kfree>
+8010399e:	83 c4 10             	add    $0x10,%esp
+801039a1:	eb c7                	jmp    8010396a <pipeclose+0x53>
+
+801039a3 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801039a3:	55                   	push   %ebp
+801039a4:	89 e5                	mov    %esp,%ebp
+801039a6:	57                   	push   %edi
+801039a7:	56                   	push   %esi
+801039a8:	53                   	push   %ebx
+801039a9:	83 ec 28             	sub    $0x28,%esp
+801039ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801039af:	8b 75 0c             	mov    0xc(%ebp),%esi
+801039b2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+801039b5:	53                   	push   %ebx
+801039b6:	e8 f4 3b 00 00       	call   801075af <acquire>
+  for(i = 0; i < n; i++){
+801039bb:	83 c4 10             	add    $0x10,%esp
+801039be:	85 ff                	test   %edi,%edi
+801039c0:	0f 8e 94 00 00 00    	jle    80103a5a <pipewrite+0xb7>
+801039c6:	89 f1                	mov    %esi,%ecx
+801039c8:	8d 04 3e             	lea    (%esi,%edi,1),%eax
+801039cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+801039ce:	8d b3 34 02 00 00    	lea    0x234(%ebx),%esi
+801039d4:	89 7d 10             	mov    %edi,0x10(%ebp)
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801039d7:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+801039dd:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+801039e3:	05 00 02 00 00       	add    $0x200,%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+801039e8:	8d bb 38 02 00 00    	lea    0x238(%ebx),%edi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801039ee:	39 c2                	cmp    %eax,%edx
+801039f0:	75 45                	jne    80103a37 <pipewrite+0x94>
+801039f2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      if(p->readopen == 0 || myproc()->killed){
+801039f5:	83 bb 3c 02 00 00 00 	cmpl   $0x0,0x23c(%ebx)
+801039fc:	74 7a                	je     80103a78 <pipewrite+0xd5>
+801039fe:	e8 b5 0d 00 00       	call   801047b8 <myproc>
+80103a03:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80103a07:	75 6f                	jne    80103a78 <pipewrite+0xd5>
+      wakeup(&p->nread);
+80103a09:	83 ec 0c             	sub    $0xc,%esp
+80103a0c:	56                   	push   %esi
+80103a0d:	e8 96 12 00 00       	call   80104ca8 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103a12:	83 c4 08             	add    $0x8,%esp
+80103a15:	53                   	push   %ebx
+80103a16:	57                   	push   %edi
+80103a17:	e8 ff 10 00 00       	call   80104b1b <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103a1c:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+80103a22:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80103a28:	05 00 02 00 00       	add    $0x200,%eax
+80103a2d:	83 c4 10             	add    $0x10,%esp
+80103a30:	39 c2                	cmp    %eax,%edx
+80103a32:	74 c1                	je     801039f5 <pipewrite+0x52>
+80103a34:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    }
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80103a37:	8d 42 01             	lea    0x1(%edx),%eax
+80103a3a:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+80103a40:	0f b6 01             	movzbl (%ecx),%eax
+80103a43:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+80103a49:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+80103a4d:	83 c1 01             	add    $0x1,%ecx
+80103a50:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103a53:	39 c1                	cmp    %eax,%ecx
+80103a55:	75 80                	jne    801039d7 <pipewrite+0x34>
+80103a57:	8b 7d 10             	mov    0x10(%ebp),%edi
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80103a5a:	83 ec 0c             	sub    $0xc,%esp
+80103a5d:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80103a63:	50                   	push   %eax
+80103a64:	e8 3f 12 00 00       	call   80104ca8 <wakeup>
+  release(&p->lock);
+80103a69:	89 1c 24             	mov    %ebx,(%esp)
+80103a6c:	e8 a5 3b 00 00       	call   80107616 <release>
+  return n;
+80103a71:	83 c4 10             	add    $0x10,%esp
+80103a74:	89 f8                	mov    %edi,%eax
+80103a76:	eb 11                	jmp    80103a89 <pipewrite+0xe6>
+        release(&p->lock);
+80103a78:	83 ec 0c             	sub    $0xc,%esp
+80103a7b:	53                   	push   %ebx
+80103a7c:	e8 95 3b 00 00       	call   80107616 <release>
+        return -1;
+80103a81:	83 c4 10             	add    $0x10,%esp
+80103a84:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103a8c:	5b                   	pop    %ebx
+80103a8d:	5e                   	pop    %esi
+80103a8e:	5f                   	pop    %edi
+80103a8f:	5d                   	pop    %ebp
+80103a90:	c3                   	ret
+
+80103a91 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80103a91:	55                   	push   %ebp
+80103a92:	89 e5                	mov    %esp,%ebp
+80103a94:	57                   	push   %edi
+80103a95:	56                   	push   %esi
+80103a96:	53                   	push   %ebx
+80103a97:	83 ec 18             	sub    $0x18,%esp
+80103a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103a9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+80103aa0:	53                   	push   %ebx
+80103aa1:	e8 09 3b 00 00       	call   801075af <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80103aa6:	83 c4 10             	add    $0x10,%esp
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80103aa9:	8d b3 34 02 00 00    	lea    0x234(%ebx),%esi
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80103aaf:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+80103ab5:	39 83 34 02 00 00    	cmp    %eax,0x234(%ebx)
+80103abb:	75 2f                	jne    80103aec <piperead+0x5b>
+80103abd:	83 bb 40 02 00 00 00 	cmpl   $0x0,0x240(%ebx)
+80103ac4:	74 26                	je     80103aec <piperead+0x5b>
+    if(myproc()->killed){
+80103ac6:	e8 ed 0c 00 00       	call   801047b8 <myproc>
+80103acb:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80103acf:	75 79                	jne    80103b4a <piperead+0xb9>
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80103ad1:	83 ec 08             	sub    $0x8,%esp
+80103ad4:	53                   	push   %ebx
+80103ad5:	56                   	push   %esi
+80103ad6:	e8 40 10 00 00       	call   80104b1b <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80103adb:	83 c4 10             	add    $0x10,%esp
+80103ade:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+80103ae4:	39 83 34 02 00 00    	cmp    %eax,0x234(%ebx)
+80103aea:	74 d1                	je     80103abd <piperead+0x2c>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103aec:	be 00 00 00 00       	mov    $0x0,%esi
+80103af1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80103af5:	7e 2f                	jle    80103b26 <piperead+0x95>
+    if(p->nread == p->nwrite)
+80103af7:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80103afd:	3b 83 38 02 00 00    	cmp    0x238(%ebx),%eax
+80103b03:	74 21                	je     80103b26 <piperead+0x95>
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80103b05:	8d 50 01             	lea    0x1(%eax),%edx
+80103b08:	89 93 34 02 00 00    	mov    %edx,0x234(%ebx)
+80103b0e:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103b13:	0f b6 44 03 34       	movzbl 0x34(%ebx,%eax,1),%eax
+80103b18:	88 04 37             	mov    %al,(%edi,%esi,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103b1b:	83 c6 01             	add    $0x1,%esi
+80103b1e:	39 75 10             	cmp    %esi,0x10(%ebp)
+80103b21:	75 d4                	jne    80103af7 <piperead+0x66>
+80103b23:	8b 75 10             	mov    0x10(%ebp),%esi
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80103b26:	83 ec 0c             	sub    $0xc,%esp
+80103b29:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+80103b2f:	50                   	push   %eax
+80103b30:	e8 73 11 00 00       	call   80104ca8 <wakeup>
+  release(&p->lock);
+80103b35:	89 1c 24             	mov    %ebx,(%esp)
+80103b38:	e8 d9 3a 00 00       	call   80107616 <release>
+  return i;
+80103b3d:	83 c4 10             	add    $0x10,%esp
+}
+80103b40:	89 f0                	mov    %esi,%eax
+80103b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103b45:	5b                   	pop    %ebx
+80103b46:	5e                   	pop    %esi
+80103b47:	5f                   	pop    %edi
+80103b48:	5d                   	pop    %ebp
+80103b49:	c3                   	ret
+      release(&p->lock);
+80103b4a:	83 ec 0c             	sub    $0xc,%esp
+80103b4d:	53                   	push   %ebx
+80103b4e:	e8 c3 3a 00 00       	call   80107616 <release>
+      return -1;
+80103b53:	83 c4 10             	add    $0x10,%esp
+80103b56:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80103b5b:	eb e3                	jmp    80103b40 <piperead+0xaf>
+
+80103b5d <strideCharge>:
+
+// Advance the passes of p and its group for the ticks p has just
+// run, counting at least one.  Caller holds ptable.lock.
+static void
+strideCharge(struct proc *p)
+{
+80103b5d:	89 c2                	mov    %eax,%edx
+  uint used = ticks - p->cpu_ticks_in;
+80103b5f:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80103b64:	2b 82 dc 00 00 00    	sub    0xdc(%edx),%eax
+
+  if(p->group == 0)
+80103b6a:	8b 8a 28 01 00 00    	mov    0x128(%edx),%ecx
+80103b70:	85 c9                	test   %ecx,%ecx
+80103b72:	74 25                	je     80103b99 <strideCharge+0x3c>
+{
+80103b74:	55                   	push   %ebp
+80103b75:	89 e5                	mov    %esp,%ebp
+80103b77:	53                   	push   %ebx
+    return;
+  if(used == 0)
+80103b78:	85 c0                	test   %eax,%eax
+80103b7a:	bb 01 00 00 00       	mov    $0x1,%ebx
+80103b7f:	0f 44 c3             	cmove  %ebx,%eax
+    used = 1;
+  p->group->pass += used * p->group->stride;
+80103b82:	89 c3                	mov    %eax,%ebx
+80103b84:	0f af 59 0c          	imul   0xc(%ecx),%ebx
+80103b88:	01 59 10             	add    %ebx,0x10(%ecx)
+  p->pass += used * STRIDE1;
+80103b8b:	c1 e0 10             	shl    $0x10,%eax
+80103b8e:	01 82 2c 01 00 00    	add    %eax,0x12c(%edx)
+}
+80103b94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b97:	c9                   	leave
+80103b98:	c3                   	ret
+80103b99:	c3                   	ret
+
+80103b9a <promote>:
+#endif // PDX_STRIDE
+
+// Apply the promotions p has missed between p->epoch and epoch.
+static void
+promote(struct proc *p, uint epoch)
+{
+80103b9a:	55                   	push   %ebp
+80103b9b:	89 e5                	mov    %esp,%ebp
+80103b9d:	56                   	push   %esi
+80103b9e:	53                   	push   %ebx
+  uint owed = epoch - p->epoch;
+
+  if(owed && p->priority < MAXPRIO){
+80103b9f:	89 d3                	mov    %edx,%ebx
+80103ba1:	2b 98 f4 00 00 00    	sub    0xf4(%eax),%ebx
+80103ba7:	74 30                	je     80103bd9 <promote+0x3f>
+80103ba9:	8b 88 ec 00 00 00    	mov    0xec(%eax),%ecx
+80103baf:	83 f9 05             	cmp    $0x5,%ecx
+80103bb2:	77 25                	ja     80103bd9 <promote+0x3f>
+    if(owed >= MAXPRIO - p->priority)
+80103bb4:	be 06 00 00 00       	mov    $0x6,%esi
+80103bb9:	29 ce                	sub    %ecx,%esi
+      p->priority = MAXPRIO;
+    else
+      p->priority += owed;
+80103bbb:	01 d9                	add    %ebx,%ecx
+80103bbd:	39 f3                	cmp    %esi,%ebx
+80103bbf:	bb 06 00 00 00       	mov    $0x6,%ebx
+80103bc4:	0f 43 cb             	cmovae %ebx,%ecx
+80103bc7:	89 88 ec 00 00 00    	mov    %ecx,0xec(%eax)
+    p->budget = ptable.params.budget;
+80103bcd:	8b 0d 98 16 14 80    	mov    0x80141698,%ecx
+80103bd3:	89 88 f0 00 00 00    	mov    %ecx,0xf0(%eax)
+  }
+  p->epoch = epoch;
+80103bd9:	89 90 f4 00 00 00    	mov    %edx,0xf4(%eax)
+}
+80103bdf:	5b                   	pop    %ebx
+80103be0:	5e                   	pop    %esi
+80103be1:	5d                   	pop    %ebp
+80103be2:	c3                   	ret
+
+80103be3 <edfcharge>:
+// period is gone.  Caller holds ptable.lock, which setdeadline()
+// also holds to change p's budget.
+static void
+edfcharge(struct proc *p)
+{
+  if(p->dl_period == 0)
+80103be3:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+80103bea:	74 24                	je     80103c10 <edfcharge+0x2d>
+    return;
+  p->dl_left -= ticks - p->dl_stamp;
+80103bec:	8b 0d 40 db 15 80    	mov    0x8015db40,%ecx
+80103bf2:	8b 90 14 01 00 00    	mov    0x114(%eax),%edx
+80103bf8:	29 ca                	sub    %ecx,%edx
+80103bfa:	03 90 10 01 00 00    	add    0x110(%eax),%edx
+80103c00:	89 90 10 01 00 00    	mov    %edx,0x110(%eax)
+  p->dl_stamp = ticks;
+80103c06:	89 88 14 01 00 00    	mov    %ecx,0x114(%eax)
+  if(p->dl_left <= 0)
+80103c0c:	85 d2                	test   %edx,%edx
+80103c0e:	7e 01                	jle    80103c11 <edfcharge+0x2e>
+    p->needresched = 1;
+}
+80103c10:	c3                   	ret
+    p->needresched = 1;
+80103c11:	c7 80 00 01 00 00 01 	movl   $0x1,0x100(%eax)
+80103c18:	00 00 00 
+80103c1b:	eb f3                	jmp    80103c10 <edfcharge+0x2d>
+
+80103c1d <findproc>:
+}
+
+// Look up a live process by pid.  Caller holds ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+80103c1d:	89 c2                	mov    %eax,%edx
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80103c1f:	83 e0 3f             	and    $0x3f,%eax
+80103c22:	8b 04 85 28 98 15 80 	mov    -0x7fea67d8(,%eax,4),%eax
+80103c29:	85 c0                	test   %eax,%eax
+80103c2b:	74 0f                	je     80103c3c <findproc+0x1f>
+    if(p->pid == pid)
+80103c2d:	3b 50 10             	cmp    0x10(%eax),%edx
+80103c30:	74 0a                	je     80103c3c <findproc+0x1f>
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80103c32:	8b 80 34 01 00 00    	mov    0x134(%eax),%eax
+80103c38:	85 c0                	test   %eax,%eax
+80103c3a:	75 f1                	jne    80103c2d <findproc+0x10>
+      return p;
+  return 0;
+}
+80103c3c:	c3                   	ret
+
+80103c3d <childRemove>:
+
+// Caller holds ptable.lock.
+static void
+childRemove(struct proc *p)
+{
+  if(p->sibprev)
+80103c3d:	8b 90 40 01 00 00    	mov    0x140(%eax),%edx
+80103c43:	85 d2                	test   %edx,%edx
+80103c45:	74 37                	je     80103c7e <childRemove+0x41>
+    p->sibprev->sibnext = p->sibnext;
+80103c47:	8b 88 3c 01 00 00    	mov    0x13c(%eax),%ecx
+80103c4d:	89 8a 3c 01 00 00    	mov    %ecx,0x13c(%edx)
+  else
+    p->parent->children = p->sibnext;
+  if(p->sibnext)
+80103c53:	8b 90 3c 01 00 00    	mov    0x13c(%eax),%edx
+80103c59:	85 d2                	test   %edx,%edx
+80103c5b:	74 0c                	je     80103c69 <childRemove+0x2c>
+    p->sibnext->sibprev = p->sibprev;
+80103c5d:	8b 88 40 01 00 00    	mov    0x140(%eax),%ecx
+80103c63:	89 8a 40 01 00 00    	mov    %ecx,0x140(%edx)
+  p->sibnext = 0;
+80103c69:	c7 80 3c 01 00 00 00 	movl   $0x0,0x13c(%eax)
+80103c70:	00 00 00 
+  p->sibprev = 0;
+80103c73:	c7 80 40 01 00 00 00 	movl   $0x0,0x140(%eax)
+80103c7a:	00 00 00 
+}
+80103c7d:	c3                   	ret
+    p->parent->children = p->sibnext;
+80103c7e:	8b 50 14             	mov    0x14(%eax),%edx
+80103c81:	8b 88 3c 01 00 00    	mov    0x13c(%eax),%ecx
+80103c87:	89 8a 38 01 00 00    	mov    %ecx,0x138(%edx)
+80103c8d:	eb c4                	jmp    80103c53 <childRemove+0x16>
+
+80103c8f <waitqAdd>:
+
+// Append sleeping p to the wait queue for p->chan.
+// Caller holds ptable.lock.
+static void
+waitqAdd(struct proc *p)
+{
+80103c8f:	55                   	push   %ebp
+80103c90:	89 e5                	mov    %esp,%ebp
+80103c92:	53                   	push   %ebx
+  struct ptrs *q = WAITQ(p->chan);
+80103c93:	69 50 20 b1 79 37 9e 	imul   $0x9e3779b1,0x20(%eax),%edx
+80103c9a:	c1 ea 1a             	shr    $0x1a,%edx
+
+  p->wqnext = 0;
+80103c9d:	c7 80 48 01 00 00 00 	movl   $0x0,0x148(%eax)
+80103ca4:	00 00 00 
+  p->wqprev = q->tail;
+80103ca7:	8d 8a e8 30 00 00    	lea    0x30e8(%edx),%ecx
+80103cad:	8b 1c cd ec 11 14 80 	mov    -0x7febee14(,%ecx,8),%ebx
+80103cb4:	89 98 4c 01 00 00    	mov    %ebx,0x14c(%eax)
+  if(q->head == 0)
+80103cba:	83 3c cd e8 11 14 80 	cmpl   $0x0,-0x7febee18(,%ecx,8)
+80103cc1:	00 
+80103cc2:	74 12                	je     80103cd6 <waitqAdd+0x47>
+    q->head = p;
+  else
+    q->tail->wqnext = p;
+80103cc4:	89 83 48 01 00 00    	mov    %eax,0x148(%ebx)
+  q->tail = p;
+80103cca:	89 04 d5 2c 99 15 80 	mov    %eax,-0x7fea66d4(,%edx,8)
+}
+80103cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103cd4:	c9                   	leave
+80103cd5:	c3                   	ret
+    q->head = p;
+80103cd6:	89 04 d5 28 99 15 80 	mov    %eax,-0x7fea66d8(,%edx,8)
+80103cdd:	eb eb                	jmp    80103cca <waitqAdd+0x3b>
+
+80103cdf <stateListAdd>:
+// The state lists are doubly linked through p->next and p->prev, and
+// p->list names the list p is on, so removal never has to walk.
+static void
+stateListAdd(struct ptrs* list, struct proc* p)
+{
+  p->next = NULL;
+80103cdf:	c7 82 e0 00 00 00 00 	movl   $0x0,0xe0(%edx)
+80103ce6:	00 00 00 
+  p->prev = (*list).tail;
+80103ce9:	8b 48 04             	mov    0x4(%eax),%ecx
+80103cec:	89 8a e4 00 00 00    	mov    %ecx,0xe4(%edx)
+  if((*list).head == NULL)
+80103cf2:	83 38 00             	cmpl   $0x0,(%eax)
+80103cf5:	74 10                	je     80103d07 <stateListAdd+0x28>
+    (*list).head = p;
+  else
+    ((*list).tail)->next = p;
+80103cf7:	89 91 e0 00 00 00    	mov    %edx,0xe0(%ecx)
+  (*list).tail = p;
+80103cfd:	89 50 04             	mov    %edx,0x4(%eax)
+  p->list = list;
+80103d00:	89 82 e8 00 00 00    	mov    %eax,0xe8(%edx)
+}
+80103d06:	c3                   	ret
+    (*list).head = p;
+80103d07:	89 10                	mov    %edx,(%eax)
+80103d09:	eb f2                	jmp    80103cfd <stateListAdd+0x1e>
+
+80103d0b <stateListRemove>:
+
+static int 
+stateListRemove(struct ptrs* list, struct proc* p)
+{
+  if(p == NULL || p->list != list){
+80103d0b:	85 d2                	test   %edx,%edx
+80103d0d:	74 79                	je     80103d88 <stateListRemove+0x7d>
+80103d0f:	89 c1                	mov    %eax,%ecx
+80103d11:	89 d0                	mov    %edx,%eax
+80103d13:	39 8a e8 00 00 00    	cmp    %ecx,0xe8(%edx)
+80103d19:	75 73                	jne    80103d8e <stateListRemove+0x83>
+{
+80103d1b:	55                   	push   %ebp
+80103d1c:	89 e5                	mov    %esp,%ebp
+80103d1e:	53                   	push   %ebx
+    return -1;
+  }
+
+  if(p->prev)
+80103d1f:	8b 92 e4 00 00 00    	mov    0xe4(%edx),%edx
+80103d25:	85 d2                	test   %edx,%edx
+80103d27:	74 4a                	je     80103d73 <stateListRemove+0x68>
+    p->prev->next = p->next;
+80103d29:	8b 98 e0 00 00 00    	mov    0xe0(%eax),%ebx
+80103d2f:	89 9a e0 00 00 00    	mov    %ebx,0xe0(%edx)
+  else
+    (*list).head = p->next;
+  if(p->next)
+80103d35:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80103d3b:	85 d2                	test   %edx,%edx
+80103d3d:	74 3e                	je     80103d7d <stateListRemove+0x72>
+    p->next->prev = p->prev;
+80103d3f:	8b 88 e4 00 00 00    	mov    0xe4(%eax),%ecx
+80103d45:	89 8a e4 00 00 00    	mov    %ecx,0xe4(%edx)
+  else
+    (*list).tail = p->prev;
+
+  // Make sure p doesn't point into the list.
+  p->next = NULL;
+80103d4b:	c7 80 e0 00 00 00 00 	movl   $0x0,0xe0(%eax)
+80103d52:	00 00 00 
+  p->prev = NULL;
+80103d55:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+80103d5c:	00 00 00 
+  p->list = NULL;
+80103d5f:	c7 80 e8 00 00 00 00 	movl   $0x0,0xe8(%eax)
+80103d66:	00 00 00 
+
+  return 0;
+80103d69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80103d6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d71:	c9                   	leave
+80103d72:	c3                   	ret
+    (*list).head = p->next;
+80103d73:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80103d79:	89 11                	mov    %edx,(%ecx)
+80103d7b:	eb b8                	jmp    80103d35 <stateListRemove+0x2a>
+    (*list).tail = p->prev;
+80103d7d:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+80103d83:	89 51 04             	mov    %edx,0x4(%ecx)
+80103d86:	eb c3                	jmp    80103d4b <stateListRemove+0x40>
+    return -1;
+80103d88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103d8d:	c3                   	ret
+80103d8e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103d93:	c3                   	ret
+
+80103d94 <readyListRemove>:
+  if(p->rq != rq)
+80103d94:	39 82 30 01 00 00    	cmp    %eax,0x130(%edx)
+80103d9a:	75 61                	jne    80103dfd <readyListRemove+0x69>
+{
+80103d9c:	55                   	push   %ebp
+80103d9d:	89 e5                	mov    %esp,%ebp
+80103d9f:	56                   	push   %esi
+80103da0:	53                   	push   %ebx
+80103da1:	89 c3                	mov    %eax,%ebx
+80103da3:	89 d6                	mov    %edx,%esi
+  if(p->list == &rq->edf){
+80103da5:	8d 40 78             	lea    0x78(%eax),%eax
+80103da8:	39 82 e8 00 00 00    	cmp    %eax,0xe8(%edx)
+80103dae:	74 29                	je     80103dd9 <readyListRemove+0x45>
+  if(stateListRemove(&rq->ready[LEVEL(p)], p) < 0)
+80103db0:	8d 43 34             	lea    0x34(%ebx),%eax
+80103db3:	e8 53 ff ff ff       	call   80103d0b <stateListRemove>
+80103db8:	85 c0                	test   %eax,%eax
+80103dba:	78 4e                	js     80103e0a <readyListRemove+0x76>
+  if(rq->ready[LEVEL(p)].head == NULL)
+80103dbc:	83 7b 34 00          	cmpl   $0x0,0x34(%ebx)
+80103dc0:	74 35                	je     80103df7 <readyListRemove+0x63>
+  p->rq = 0;
+80103dc2:	c7 86 30 01 00 00 00 	movl   $0x0,0x130(%esi)
+80103dc9:	00 00 00 
+  rq->nready--;
+80103dcc:	83 6b 70 01          	subl   $0x1,0x70(%ebx)
+  return 0;
+80103dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80103dd5:	5b                   	pop    %ebx
+80103dd6:	5e                   	pop    %esi
+80103dd7:	5d                   	pop    %ebp
+80103dd8:	c3                   	ret
+    if(stateListRemove(&rq->edf, p) < 0)
+80103dd9:	e8 2d ff ff ff       	call   80103d0b <stateListRemove>
+80103dde:	85 c0                	test   %eax,%eax
+80103de0:	78 21                	js     80103e03 <readyListRemove+0x6f>
+    p->rq = 0;
+80103de2:	c7 86 30 01 00 00 00 	movl   $0x0,0x130(%esi)
+80103de9:	00 00 00 
+    rq->nready--;
+80103dec:	83 6b 70 01          	subl   $0x1,0x70(%ebx)
+    return 0;
+80103df0:	b8 00 00 00 00       	mov    $0x0,%eax
+80103df5:	eb de                	jmp    80103dd5 <readyListRemove+0x41>
+    rq->readymask[LEVEL(p)/32] &= ~(1U << (LEVEL(p)%32));
+80103df7:	83 63 6c fe          	andl   $0xfffffffe,0x6c(%ebx)
+80103dfb:	eb c5                	jmp    80103dc2 <readyListRemove+0x2e>
+    return -1;
+80103dfd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103e02:	c3                   	ret
+      return -1;
+80103e03:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103e08:	eb cb                	jmp    80103dd5 <readyListRemove+0x41>
+    return -1;
+80103e0a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103e0f:	eb c4                	jmp    80103dd5 <readyListRemove+0x41>
+
+80103e11 <pidhashRemove>:
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext)
+80103e11:	8b 48 10             	mov    0x10(%eax),%ecx
+80103e14:	83 e1 3f             	and    $0x3f,%ecx
+80103e17:	8b 14 8d 28 98 15 80 	mov    -0x7fea67d8(,%ecx,4),%edx
+80103e1e:	85 d2                	test   %edx,%edx
+80103e20:	74 36                	je     80103e58 <pidhashRemove+0x47>
+    if(*pp == p){
+80103e22:	39 d0                	cmp    %edx,%eax
+80103e24:	74 29                	je     80103e4f <pidhashRemove+0x3e>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext)
+80103e26:	89 d1                	mov    %edx,%ecx
+80103e28:	8b 92 34 01 00 00    	mov    0x134(%edx),%edx
+80103e2e:	85 d2                	test   %edx,%edx
+80103e30:	74 26                	je     80103e58 <pidhashRemove+0x47>
+    if(*pp == p){
+80103e32:	39 d0                	cmp    %edx,%eax
+80103e34:	75 f0                	jne    80103e26 <pidhashRemove+0x15>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext)
+80103e36:	81 c1 34 01 00 00    	add    $0x134,%ecx
+      *pp = p->pidnext;
+80103e3c:	8b 90 34 01 00 00    	mov    0x134(%eax),%edx
+80103e42:	89 11                	mov    %edx,(%ecx)
+      p->pidnext = 0;
+80103e44:	c7 80 34 01 00 00 00 	movl   $0x0,0x134(%eax)
+80103e4b:	00 00 00 
+      return;
+80103e4e:	c3                   	ret
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext)
+80103e4f:	8d 0c 8d 28 98 15 80 	lea    -0x7fea67d8(,%ecx,4),%ecx
+80103e56:	eb e4                	jmp    80103e3c <pidhashRemove+0x2b>
+{
+80103e58:	55                   	push   %ebp
+80103e59:	89 e5                	mov    %esp,%ebp
+80103e5b:	83 ec 14             	sub    $0x14,%esp
+  panic("pidhashRemove");
+80103e5e:	68 27 b3 10 80       	push   $0x8010b327
+80103e63:	e8 da c4 ff ff       	call   80100342 <panic>
+
+80103e68 <groupFind>:
+{
+80103e68:	89 c1                	mov    %eax,%ecx
+  struct group *g, *slot = 0;
+80103e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++){
+80103e6f:	b8 a4 16 14 80       	mov    $0x801416a4,%eax
+80103e74:	eb 0f                	jmp    80103e85 <groupFind+0x1d>
+    if(g->shares == 0 && slot == 0)
+80103e76:	85 d2                	test   %edx,%edx
+80103e78:	0f 44 d0             	cmove  %eax,%edx
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++){
+80103e7b:	83 c0 18             	add    $0x18,%eax
+80103e7e:	3d 24 98 15 80       	cmp    $0x80159824,%eax
+80103e83:	74 0b                	je     80103e90 <groupFind+0x28>
+    if(g->shares && g->uid == uid)
+80103e85:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+80103e89:	74 eb                	je     80103e76 <groupFind+0xe>
+80103e8b:	39 08                	cmp    %ecx,(%eax)
+80103e8d:	75 ec                	jne    80103e7b <groupFind+0x13>
+80103e8f:	c3                   	ret
+{
+80103e90:	55                   	push   %ebp
+80103e91:	89 e5                	mov    %esp,%ebp
+80103e93:	56                   	push   %esi
+80103e94:	53                   	push   %ebx
+  for(g = ptable.groups; slot == 0 && g < &ptable.groups[NGROUP]; g++){
+80103e95:	85 d2                	test   %edx,%edx
+80103e97:	75 3f                	jne    80103ed8 <groupFind+0x70>
+    for(p = ptable.all; p != 0; p = p->allnext)
+80103e99:	8b 1d 14 12 14 80    	mov    0x80141214,%ebx
+  for(g = ptable.groups; slot == 0 && g < &ptable.groups[NGROUP]; g++){
+80103e9f:	b8 a4 16 14 80       	mov    $0x801416a4,%eax
+80103ea4:	eb 24                	jmp    80103eca <groupFind+0x62>
+    for(p = ptable.all; p != 0; p = p->allnext)
+80103ea6:	8b 92 20 01 00 00    	mov    0x120(%edx),%edx
+80103eac:	85 d2                	test   %edx,%edx
+80103eae:	74 2a                	je     80103eda <groupFind+0x72>
+      if(p->state != UNUSED && p->uid == g->uid)
+80103eb0:	83 7a 0c 00          	cmpl   $0x0,0xc(%edx)
+80103eb4:	74 f0                	je     80103ea6 <groupFind+0x3e>
+80103eb6:	8b 30                	mov    (%eax),%esi
+80103eb8:	39 b2 d0 00 00 00    	cmp    %esi,0xd0(%edx)
+80103ebe:	75 e6                	jne    80103ea6 <groupFind+0x3e>
+  for(g = ptable.groups; slot == 0 && g < &ptable.groups[NGROUP]; g++){
+80103ec0:	83 c0 18             	add    $0x18,%eax
+80103ec3:	3d 24 98 15 80       	cmp    $0x80159824,%eax
+80103ec8:	73 3e                	jae    80103f08 <groupFind+0xa0>
+    if(g->fixed)
+80103eca:	83 78 08 00          	cmpl   $0x0,0x8(%eax)
+80103ece:	75 f0                	jne    80103ec0 <groupFind+0x58>
+    for(p = ptable.all; p != 0; p = p->allnext)
+80103ed0:	85 db                	test   %ebx,%ebx
+80103ed2:	74 06                	je     80103eda <groupFind+0x72>
+80103ed4:	89 da                	mov    %ebx,%edx
+80103ed6:	eb d8                	jmp    80103eb0 <groupFind+0x48>
+  for(g = ptable.groups; slot == 0 && g < &ptable.groups[NGROUP]; g++){
+80103ed8:	89 d0                	mov    %edx,%eax
+  slot->uid = uid;
+80103eda:	89 08                	mov    %ecx,(%eax)
+  slot->shares = STRIDE_SHARES;
+80103edc:	c7 40 04 64 00 00 00 	movl   $0x64,0x4(%eax)
+  slot->fixed = 0;
+80103ee3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  slot->stride = STRIDE1 / STRIDE_SHARES;
+80103eea:	c7 40 0c 8f 02 00 00 	movl   $0x28f,0xc(%eax)
+  slot->pass = ptable.stridevt;
+80103ef1:	8b 15 24 98 15 80    	mov    0x80159824,%edx
+80103ef7:	89 50 10             	mov    %edx,0x10(%eax)
+  slot->vt = 0;
+80103efa:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+}
+80103f01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103f04:	5b                   	pop    %ebx
+80103f05:	5e                   	pop    %esi
+80103f06:	5d                   	pop    %ebp
+80103f07:	c3                   	ret
+    panic("groupFind");
+80103f08:	83 ec 0c             	sub    $0xc,%esp
+80103f0b:	68 35 b3 10 80       	push   $0x8010b335
+80103f10:	e8 2d c4 ff ff       	call   80100342 <panic>
+
+80103f15 <dequeue>:
+{
+80103f15:	55                   	push   %ebp
+80103f16:	89 e5                	mov    %esp,%ebp
+80103f18:	57                   	push   %edi
+80103f19:	56                   	push   %esi
+80103f1a:	53                   	push   %ebx
+80103f1b:	83 ec 1c             	sub    $0x1c,%esp
+  if(rq->nready == 0)
+80103f1e:	83 78 70 00          	cmpl   $0x0,0x70(%eax)
+80103f22:	0f 84 50 01 00 00    	je     80104078 <dequeue+0x163>
+80103f28:	89 c6                	mov    %eax,%esi
+80103f2a:	89 d7                	mov    %edx,%edi
+  acquire(&rq->lock);
+80103f2c:	83 ec 0c             	sub    $0xc,%esp
+80103f2f:	50                   	push   %eax
+80103f30:	e8 7a 36 00 00       	call   801075af <acquire>
+  for(p = rq->edf.head; p != 0; p = p->next)
+80103f35:	8b 5e 78             	mov    0x78(%esi),%ebx
+80103f38:	83 c4 10             	add    $0x10,%esp
+80103f3b:	85 db                	test   %ebx,%ebx
+80103f3d:	74 4c                	je     80103f8b <dequeue+0x76>
+    if(ALLOWED(p, c - cpus))
+80103f3f:	89 f9                	mov    %edi,%ecx
+80103f41:	81 e9 80 f9 13 80    	sub    $0x8013f980,%ecx
+80103f47:	c1 f9 06             	sar    $0x6,%ecx
+80103f4a:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+80103f50:	ba 01 00 00 00       	mov    $0x1,%edx
+80103f55:	d3 e2                	shl    %cl,%edx
+80103f57:	eb 17                	jmp    80103f70 <dequeue+0x5b>
+80103f59:	89 d0                	mov    %edx,%eax
+80103f5b:	23 83 f8 00 00 00    	and    0xf8(%ebx),%eax
+80103f61:	0f 95 c0             	setne  %al
+80103f64:	eb 1c                	jmp    80103f82 <dequeue+0x6d>
+  for(p = rq->edf.head; p != 0; p = p->next)
+80103f66:	8b 9b e0 00 00 00    	mov    0xe0(%ebx),%ebx
+80103f6c:	85 db                	test   %ebx,%ebx
+80103f6e:	74 1b                	je     80103f8b <dequeue+0x76>
+    if(ALLOWED(p, c - cpus))
+80103f70:	83 bb 08 01 00 00 00 	cmpl   $0x0,0x108(%ebx)
+80103f77:	74 e0                	je     80103f59 <dequeue+0x44>
+80103f79:	39 8b 18 01 00 00    	cmp    %ecx,0x118(%ebx)
+80103f7f:	0f 94 c0             	sete   %al
+80103f82:	84 c0                	test   %al,%al
+80103f84:	74 e0                	je     80103f66 <dequeue+0x51>
+80103f86:	e9 b9 00 00 00       	jmp    80104044 <dequeue+0x12f>
+    for(q = rq->ready[0].head; q != 0; q = q->next){
+80103f8b:	8b 46 34             	mov    0x34(%esi),%eax
+80103f8e:	85 c0                	test   %eax,%eax
+80103f90:	0f 84 de 00 00 00    	je     80104074 <dequeue+0x15f>
+      if(!ALLOWED(q, c - cpus))
+80103f96:	81 ef 80 f9 13 80    	sub    $0x8013f980,%edi
+80103f9c:	c1 ff 06             	sar    $0x6,%edi
+80103f9f:	69 cf ab aa aa aa    	imul   $0xaaaaaaab,%edi,%ecx
+80103fa5:	ba 01 00 00 00       	mov    $0x1,%edx
+80103faa:	89 d7                	mov    %edx,%edi
+80103fac:	d3 e7                	shl    %cl,%edi
+80103fae:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103fb3:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80103fb6:	89 fe                	mov    %edi,%esi
+80103fb8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103fbb:	eb 19                	jmp    80103fd6 <dequeue+0xc1>
+80103fbd:	89 f2                	mov    %esi,%edx
+80103fbf:	23 90 f8 00 00 00    	and    0xf8(%eax),%edx
+80103fc5:	0f 94 c2             	sete   %dl
+80103fc8:	eb 21                	jmp    80103feb <dequeue+0xd6>
+80103fca:	89 c3                	mov    %eax,%ebx
+    for(q = rq->ready[0].head; q != 0; q = q->next){
+80103fcc:	8b 80 e0 00 00 00    	mov    0xe0(%eax),%eax
+80103fd2:	85 c0                	test   %eax,%eax
+80103fd4:	74 4a                	je     80104020 <dequeue+0x10b>
+      if(!ALLOWED(q, c - cpus))
+80103fd6:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+80103fdd:	74 de                	je     80103fbd <dequeue+0xa8>
+80103fdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103fe2:	39 b8 18 01 00 00    	cmp    %edi,0x118(%eax)
+80103fe8:	0f 95 c2             	setne  %dl
+80103feb:	84 d2                	test   %dl,%dl
+80103fed:	75 dd                	jne    80103fcc <dequeue+0xb7>
+      if(p == 0 || PASSBEFORE(q->group->pass, p->group->pass) ||
+80103fef:	85 db                	test   %ebx,%ebx
+80103ff1:	74 d7                	je     80103fca <dequeue+0xb5>
+80103ff3:	8b b8 28 01 00 00    	mov    0x128(%eax),%edi
+80103ff9:	8b 93 28 01 00 00    	mov    0x128(%ebx),%edx
+80103fff:	8b 4a 10             	mov    0x10(%edx),%ecx
+80104002:	39 4f 10             	cmp    %ecx,0x10(%edi)
+80104005:	78 15                	js     8010401c <dequeue+0x107>
+80104007:	39 d7                	cmp    %edx,%edi
+80104009:	75 c1                	jne    80103fcc <dequeue+0xb7>
+8010400b:	8b bb 2c 01 00 00    	mov    0x12c(%ebx),%edi
+80104011:	39 b8 2c 01 00 00    	cmp    %edi,0x12c(%eax)
+80104017:	0f 48 d8             	cmovs  %eax,%ebx
+8010401a:	eb b0                	jmp    80103fcc <dequeue+0xb7>
+8010401c:	89 c3                	mov    %eax,%ebx
+8010401e:	eb ac                	jmp    80103fcc <dequeue+0xb7>
+    if(p){
+80104020:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80104023:	85 db                	test   %ebx,%ebx
+80104025:	74 2a                	je     80104051 <dequeue+0x13c>
+      ptable.stridevt = p->group->pass;
+80104027:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+8010402d:	8b 40 10             	mov    0x10(%eax),%eax
+80104030:	a3 24 98 15 80       	mov    %eax,0x80159824
+      p->group->vt = p->pass;
+80104035:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+8010403b:	8b 93 2c 01 00 00    	mov    0x12c(%ebx),%edx
+80104041:	89 50 14             	mov    %edx,0x14(%eax)
+  if(p && readyListRemove(rq, p) < 0)
+80104044:	89 da                	mov    %ebx,%edx
+80104046:	89 f0                	mov    %esi,%eax
+80104048:	e8 47 fd ff ff       	call   80103d94 <readyListRemove>
+8010404d:	85 c0                	test   %eax,%eax
+8010404f:	78 16                	js     80104067 <dequeue+0x152>
+  release(&rq->lock);
+80104051:	83 ec 0c             	sub    $0xc,%esp
+80104054:	56                   	push   %esi
+80104055:	e8 bc 35 00 00       	call   80107616 <release>
+  return p;
+8010405a:	83 c4 10             	add    $0x10,%esp
+}
+8010405d:	89 d8                	mov    %ebx,%eax
+8010405f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104062:	5b                   	pop    %ebx
+80104063:	5e                   	pop    %esi
+80104064:	5f                   	pop    %edi
+80104065:	5d                   	pop    %ebp
+80104066:	c3                   	ret
+    panic("Error removing from ready list in dequeue().\n");
+80104067:	83 ec 0c             	sub    $0xc,%esp
+8010406a:	68 90 b5 10 80       	push   $0x8010b590
+8010406f:	e8 ce c2 ff ff       	call   80100342 <panic>
+    for(q = rq->ready[0].head; q != 0; q = q->next){
+80104074:	89 c3                	mov    %eax,%ebx
+80104076:	eb d9                	jmp    80104051 <dequeue+0x13c>
+    return 0;
+80104078:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010407d:	eb de                	jmp    8010405d <dequeue+0x148>
+
+8010407f <assertState>:
+#endif // CS333_P4
+
+static void
+assertState(struct proc* p, enum procstate state)
+{
+  if(p->state != state){
+8010407f:	8b 40 0c             	mov    0xc(%eax),%eax
+80104082:	39 d0                	cmp    %edx,%eax
+80104084:	75 01                	jne    80104087 <assertState+0x8>
+80104086:	c3                   	ret
+{
+80104087:	55                   	push   %ebp
+80104088:	89 e5                	mov    %esp,%ebp
+8010408a:	83 ec 0c             	sub    $0xc,%esp
+    cprintf("p->state is in %d, when it needs to be in %d\n",states[p->state], states[state]);
+8010408d:	ff 34 95 ec b8 10 80 	push   -0x7fef4714(,%edx,4)
+80104094:	ff 34 85 ec b8 10 80 	push   -0x7fef4714(,%eax,4)
+8010409b:	68 c0 b5 10 80       	push   $0x8010b5c0
+801040a0:	e8 5f c5 ff ff       	call   80100604 <cprintf>
+    panic("assertState() failed.\n");
+801040a5:	c7 04 24 3f b3 10 80 	movl   $0x8010b33f,(%esp)
+801040ac:	e8 91 c2 ff ff       	call   80100342 <panic>
+
+801040b1 <readyListAdd>:
+{
+801040b1:	55                   	push   %ebp
+801040b2:	89 e5                	mov    %esp,%ebp
+801040b4:	56                   	push   %esi
+801040b5:	53                   	push   %ebx
+801040b6:	89 c6                	mov    %eax,%esi
+801040b8:	89 d3                	mov    %edx,%ebx
+  assertState(p, RUNNABLE);
+801040ba:	ba 03 00 00 00       	mov    $0x3,%edx
+801040bf:	89 d8                	mov    %ebx,%eax
+801040c1:	e8 b9 ff ff ff       	call   8010407f <assertState>
+  promote(p, ptable.epoch);
+801040c6:	8b 15 78 16 14 80    	mov    0x80141678,%edx
+801040cc:	89 d8                	mov    %ebx,%eax
+801040ce:	e8 c7 fa ff ff       	call   80103b9a <promote>
+  if(p->dl_period)
+801040d3:	8b 83 08 01 00 00    	mov    0x108(%ebx),%eax
+801040d9:	85 c0                	test   %eax,%eax
+801040db:	75 3e                	jne    8010411b <readyListAdd+0x6a>
+    if(PASSBEFORE(p->group->pass, ptable.stridevt))
+801040dd:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+801040e3:	8b 15 24 98 15 80    	mov    0x80159824,%edx
+801040e9:	39 50 10             	cmp    %edx,0x10(%eax)
+801040ec:	78 7f                	js     8010416d <readyListAdd+0xbc>
+    if(PASSBEFORE(p->pass, p->group->vt))
+801040ee:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+801040f4:	8b 40 14             	mov    0x14(%eax),%eax
+801040f7:	39 83 2c 01 00 00    	cmp    %eax,0x12c(%ebx)
+801040fd:	78 76                	js     80104175 <readyListAdd+0xc4>
+    stateListAdd(&rq->ready[LEVEL(p)], p);
+801040ff:	8d 46 34             	lea    0x34(%esi),%eax
+80104102:	89 da                	mov    %ebx,%edx
+80104104:	e8 d6 fb ff ff       	call   80103cdf <stateListAdd>
+    rq->readymask[LEVEL(p)/32] |= 1U << (LEVEL(p)%32);
+80104109:	83 4e 6c 01          	orl    $0x1,0x6c(%esi)
+  p->rq = rq;
+8010410d:	89 b3 30 01 00 00    	mov    %esi,0x130(%ebx)
+  rq->nready++;
+80104113:	83 46 70 01          	addl   $0x1,0x70(%esi)
+}
+80104117:	5b                   	pop    %ebx
+80104118:	5e                   	pop    %esi
+80104119:	5d                   	pop    %ebp
+8010411a:	c3                   	ret
+  if((int)(ticks - p->dl_deadline) >= 0){
+8010411b:	8b 15 40 db 15 80    	mov    0x8015db40,%edx
+80104121:	3b 93 0c 01 00 00    	cmp    0x10c(%ebx),%edx
+80104127:	78 14                	js     8010413d <readyListAdd+0x8c>
+    p->dl_deadline = ticks + p->dl_period;
+80104129:	01 d0                	add    %edx,%eax
+8010412b:	89 83 0c 01 00 00    	mov    %eax,0x10c(%ebx)
+    p->dl_left = p->dl_runtime;
+80104131:	8b 83 04 01 00 00    	mov    0x104(%ebx),%eax
+80104137:	89 83 10 01 00 00    	mov    %eax,0x110(%ebx)
+  for(q = rq->edf.head; q != 0; q = q->next)
+8010413d:	8b 46 78             	mov    0x78(%esi),%eax
+80104140:	85 c0                	test   %eax,%eax
+80104142:	74 18                	je     8010415c <readyListAdd+0xab>
+    if((int)(p->dl_deadline - q->dl_deadline) < 0)
+80104144:	8b 93 0c 01 00 00    	mov    0x10c(%ebx),%edx
+8010414a:	3b 90 0c 01 00 00    	cmp    0x10c(%eax),%edx
+80104150:	78 2b                	js     8010417d <readyListAdd+0xcc>
+  for(q = rq->edf.head; q != 0; q = q->next)
+80104152:	8b 80 e0 00 00 00    	mov    0xe0(%eax),%eax
+80104158:	85 c0                	test   %eax,%eax
+8010415a:	75 ee                	jne    8010414a <readyListAdd+0x99>
+    stateListAdd(&rq->edf, p);
+8010415c:	8d 46 78             	lea    0x78(%esi),%eax
+8010415f:	89 da                	mov    %ebx,%edx
+80104161:	e8 79 fb ff ff       	call   80103cdf <stateListAdd>
+    return;
+80104166:	eb a5                	jmp    8010410d <readyListAdd+0x5c>
+    rq->edf.head = p;
+80104168:	89 5e 78             	mov    %ebx,0x78(%esi)
+8010416b:	eb 2c                	jmp    80104199 <readyListAdd+0xe8>
+      p->group->pass = ptable.stridevt;
+8010416d:	89 50 10             	mov    %edx,0x10(%eax)
+80104170:	e9 79 ff ff ff       	jmp    801040ee <readyListAdd+0x3d>
+      p->pass = p->group->vt;
+80104175:	89 83 2c 01 00 00    	mov    %eax,0x12c(%ebx)
+8010417b:	eb 82                	jmp    801040ff <readyListAdd+0x4e>
+  p->next = q;
+8010417d:	89 83 e0 00 00 00    	mov    %eax,0xe0(%ebx)
+  p->prev = q->prev;
+80104183:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+80104189:	89 93 e4 00 00 00    	mov    %edx,0xe4(%ebx)
+  if(q->prev)
+8010418f:	85 d2                	test   %edx,%edx
+80104191:	74 d5                	je     80104168 <readyListAdd+0xb7>
+    q->prev->next = p;
+80104193:	89 9a e0 00 00 00    	mov    %ebx,0xe0(%edx)
+  q->prev = p;
+80104199:	89 98 e4 00 00 00    	mov    %ebx,0xe4(%eax)
+  p->list = &rq->edf;
+8010419f:	8d 46 78             	lea    0x78(%esi),%eax
+801041a2:	89 83 e8 00 00 00    	mov    %eax,0xe8(%ebx)
+801041a8:	e9 60 ff ff ff       	jmp    8010410d <readyListAdd+0x5c>
+
+801041ad <forkret>:
+{
+801041ad:	55                   	push   %ebp
+801041ae:	89 e5                	mov    %esp,%ebp
+801041b0:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+801041b3:	68 e0 11 14 80       	push   $0x801411e0
+801041b8:	e8 59 34 00 00       	call   80107616 <release>
+  if (first) {
+801041bd:	83 c4 10             	add    $0x10,%esp
+801041c0:	83 3d 00 e0 10 80 00 	cmpl   $0x0,0x8010e000
+801041c7:	75 02                	jne    801041cb <forkret+0x1e>
+}
+801041c9:	c9                   	leave
+801041ca:	c3                   	ret
+    first = 0;
+801041cb:	c7 05 00 e0 10 80 00 	movl   $0x0,0x8010e000
+801041d2:	00 00 00 
+    iinit(ROOTDEV);
+801041d5:	83 ec 0c             	sub    $0xc,%esp
+801041d8:	6a 01                	push   $0x1
+801041da:	e8 6d d2 ff ff       	call   8010144c <iinit>
+    initlog(ROOTDEV);
+801041df:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801041e6:	e8 cb ec ff ff       	call   80102eb6 <initlog>
+801041eb:	83 c4 10             	add    $0x10,%esp
+}
+801041ee:	eb d9                	jmp    801041c9 <forkret+0x1c>
+
+801041f0 <timerUp>:
+{
+801041f0:	55                   	push   %ebp
+801041f1:	89 e5                	mov    %esp,%ebp
+801041f3:	57                   	push   %edi
+801041f4:	56                   	push   %esi
+801041f5:	53                   	push   %ebx
+  struct proc *p = ptable.timers[i];
+801041f6:	8b 1c 85 28 9b 15 80 	mov    -0x7fea64d8(,%eax,4),%ebx
+  while(i > 0 && TIMERBEFORE(p, ptable.timers[(i-1)/2])){
+801041fd:	89 c1                	mov    %eax,%ecx
+801041ff:	85 c0                	test   %eax,%eax
+80104201:	7e 39                	jle    8010423c <timerUp+0x4c>
+80104203:	89 c1                	mov    %eax,%ecx
+80104205:	83 e8 01             	sub    $0x1,%eax
+80104208:	89 c2                	mov    %eax,%edx
+8010420a:	c1 ea 1f             	shr    $0x1f,%edx
+8010420d:	01 c2                	add    %eax,%edx
+8010420f:	d1 fa                	sar    %edx
+80104211:	89 d0                	mov    %edx,%eax
+80104213:	8b 34 95 28 9b 15 80 	mov    -0x7fea64d8(,%edx,4),%esi
+8010421a:	8b be 50 01 00 00    	mov    0x150(%esi),%edi
+80104220:	39 bb 50 01 00 00    	cmp    %edi,0x150(%ebx)
+80104226:	79 14                	jns    8010423c <timerUp+0x4c>
+  ptable.timers[i] = p;
+80104228:	89 34 8d 28 9b 15 80 	mov    %esi,-0x7fea64d8(,%ecx,4)
+  p->timeridx = i;
+8010422f:	89 8e 54 01 00 00    	mov    %ecx,0x154(%esi)
+  while(i > 0 && TIMERBEFORE(p, ptable.timers[(i-1)/2])){
+80104235:	83 f9 02             	cmp    $0x2,%ecx
+80104238:	7f c9                	jg     80104203 <timerUp+0x13>
+8010423a:	89 d1                	mov    %edx,%ecx
+  ptable.timers[i] = p;
+8010423c:	89 1c 8d 28 9b 15 80 	mov    %ebx,-0x7fea64d8(,%ecx,4)
+  p->timeridx = i;
+80104243:	89 8b 54 01 00 00    	mov    %ecx,0x154(%ebx)
+}
+80104249:	5b                   	pop    %ebx
+8010424a:	5e                   	pop    %esi
+8010424b:	5f                   	pop    %edi
+8010424c:	5d                   	pop    %ebp
+8010424d:	c3                   	ret
+
+8010424e <timerAdd>:
+{
+8010424e:	55                   	push   %ebp
+8010424f:	89 e5                	mov    %esp,%ebp
+80104251:	83 ec 08             	sub    $0x8,%esp
+80104254:	89 c2                	mov    %eax,%edx
+  timerSet(ptable.ntimers++, p);
+80104256:	a1 28 db 15 80       	mov    0x8015db28,%eax
+8010425b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010425e:	89 0d 28 db 15 80    	mov    %ecx,0x8015db28
+  ptable.timers[i] = p;
+80104264:	89 14 85 28 9b 15 80 	mov    %edx,-0x7fea64d8(,%eax,4)
+  p->timeridx = i;
+8010426b:	89 82 54 01 00 00    	mov    %eax,0x154(%edx)
+  timerUp(p->timeridx);
+80104271:	e8 7a ff ff ff       	call   801041f0 <timerUp>
+  ptable.nexttimer = ptable.timers[0]->wakeat;
+80104276:	a1 28 9b 15 80       	mov    0x80159b28,%eax
+8010427b:	8b 80 50 01 00 00    	mov    0x150(%eax),%eax
+80104281:	a3 2c db 15 80       	mov    %eax,0x8015db2c
+}
+80104286:	c9                   	leave
+80104287:	c3                   	ret
+
+80104288 <timerRemove>:
+{
+80104288:	55                   	push   %ebp
+80104289:	89 e5                	mov    %esp,%ebp
+8010428b:	57                   	push   %edi
+8010428c:	56                   	push   %esi
+8010428d:	53                   	push   %ebx
+8010428e:	83 ec 0c             	sub    $0xc,%esp
+  int i = p->timeridx;
+80104291:	8b 90 54 01 00 00    	mov    0x154(%eax),%edx
+  p->timeridx = -1;
+80104297:	c7 80 54 01 00 00 ff 	movl   $0xffffffff,0x154(%eax)
+8010429e:	ff ff ff 
+  if(i != --ptable.ntimers){
+801042a1:	a1 28 db 15 80       	mov    0x8015db28,%eax
+801042a6:	83 e8 01             	sub    $0x1,%eax
+801042a9:	a3 28 db 15 80       	mov    %eax,0x8015db28
+801042ae:	39 d0                	cmp    %edx,%eax
+801042b0:	75 21                	jne    801042d3 <timerRemove+0x4b>
+  if(ptable.ntimers > 0)
+801042b2:	83 3d 28 db 15 80 00 	cmpl   $0x0,0x8015db28
+801042b9:	7e 10                	jle    801042cb <timerRemove+0x43>
+    ptable.nexttimer = ptable.timers[0]->wakeat;
+801042bb:	a1 28 9b 15 80       	mov    0x80159b28,%eax
+801042c0:	8b 80 50 01 00 00    	mov    0x150(%eax),%eax
+801042c6:	a3 2c db 15 80       	mov    %eax,0x8015db2c
+}
+801042cb:	83 c4 0c             	add    $0xc,%esp
+801042ce:	5b                   	pop    %ebx
+801042cf:	5e                   	pop    %esi
+801042d0:	5f                   	pop    %edi
+801042d1:	5d                   	pop    %ebp
+801042d2:	c3                   	ret
+    last = ptable.timers[ptable.ntimers];
+801042d3:	8b 1c 85 28 9b 15 80 	mov    -0x7fea64d8(,%eax,4),%ebx
+  ptable.timers[i] = p;
+801042da:	89 1c 95 28 9b 15 80 	mov    %ebx,-0x7fea64d8(,%edx,4)
+  p->timeridx = i;
+801042e1:	89 93 54 01 00 00    	mov    %edx,0x154(%ebx)
+    timerUp(i);
+801042e7:	89 d0                	mov    %edx,%eax
+801042e9:	e8 02 ff ff ff       	call   801041f0 <timerUp>
+    timerDown(last->timeridx);
+801042ee:	8b 93 54 01 00 00    	mov    0x154(%ebx),%edx
+  struct proc *p = ptable.timers[i];
+801042f4:	8b 34 95 28 9b 15 80 	mov    -0x7fea64d8(,%edx,4),%esi
+  while((c = 2*i + 1) < ptable.ntimers){
+801042fb:	8d 4c 12 01          	lea    0x1(%edx,%edx,1),%ecx
+801042ff:	8b 1d 28 db 15 80    	mov    0x8015db28,%ebx
+80104305:	39 d9                	cmp    %ebx,%ecx
+80104307:	7c 36                	jl     8010433f <timerRemove+0xb7>
+80104309:	eb 5d                	jmp    80104368 <timerRemove+0xe0>
+8010430b:	89 c8                	mov    %ecx,%eax
+    if(!TIMERBEFORE(ptable.timers[c], p))
+8010430d:	8b 0c 85 28 9b 15 80 	mov    -0x7fea64d8(,%eax,4),%ecx
+80104314:	8b 9e 50 01 00 00    	mov    0x150(%esi),%ebx
+8010431a:	39 99 50 01 00 00    	cmp    %ebx,0x150(%ecx)
+80104320:	79 46                	jns    80104368 <timerRemove+0xe0>
+  ptable.timers[i] = p;
+80104322:	89 0c 95 28 9b 15 80 	mov    %ecx,-0x7fea64d8(,%edx,4)
+  p->timeridx = i;
+80104329:	89 91 54 01 00 00    	mov    %edx,0x154(%ecx)
+  while((c = 2*i + 1) < ptable.ntimers){
+8010432f:	8d 4c 00 01          	lea    0x1(%eax,%eax,1),%ecx
+80104333:	8b 1d 28 db 15 80    	mov    0x8015db28,%ebx
+80104339:	39 cb                	cmp    %ecx,%ebx
+8010433b:	7e 29                	jle    80104366 <timerRemove+0xde>
+8010433d:	89 c2                	mov    %eax,%edx
+    if(c+1 < ptable.ntimers && TIMERBEFORE(ptable.timers[c+1], ptable.timers[c]))
+8010433f:	8d 44 12 02          	lea    0x2(%edx,%edx,1),%eax
+80104343:	39 d8                	cmp    %ebx,%eax
+80104345:	7d c4                	jge    8010430b <timerRemove+0x83>
+80104347:	8b 1c 8d 28 9b 15 80 	mov    -0x7fea64d8(,%ecx,4),%ebx
+8010434e:	8b 3c 85 28 9b 15 80 	mov    -0x7fea64d8(,%eax,4),%edi
+80104355:	8b 9b 50 01 00 00    	mov    0x150(%ebx),%ebx
+8010435b:	39 9f 50 01 00 00    	cmp    %ebx,0x150(%edi)
+80104361:	0f 49 c1             	cmovns %ecx,%eax
+80104364:	eb a7                	jmp    8010430d <timerRemove+0x85>
+80104366:	89 c2                	mov    %eax,%edx
+  ptable.timers[i] = p;
+80104368:	89 34 95 28 9b 15 80 	mov    %esi,-0x7fea64d8(,%edx,4)
+  p->timeridx = i;
+8010436f:	89 96 54 01 00 00    	mov    %edx,0x154(%esi)
+}
+80104375:	e9 38 ff ff ff       	jmp    801042b2 <timerRemove+0x2a>
+
+8010437a <pinit>:
+{
+8010437a:	55                   	push   %ebp
+8010437b:	89 e5                	mov    %esp,%ebp
+8010437d:	56                   	push   %esi
+8010437e:	53                   	push   %ebx
+  initlock(&ptable.lock, "ptable");
+8010437f:	83 ec 08             	sub    $0x8,%esp
+80104382:	68 56 b3 10 80       	push   $0x8010b356
+80104387:	68 e0 11 14 80       	push   $0x801411e0
+8010438c:	e8 d3 30 00 00       	call   80107464 <initlock>
+  for(int i = 0; i < ncpu; i++){
+80104391:	83 c4 10             	add    $0x10,%esp
+80104394:	83 3d 64 f9 13 80 00 	cmpl   $0x0,0x8013f964
+8010439b:	7e 38                	jle    801043d5 <pinit+0x5b>
+8010439d:	be 50 12 14 80       	mov    $0x80141250,%esi
+801043a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    initlock(&ptable.rq[i].lock, "runq");
+801043a7:	83 ec 08             	sub    $0x8,%esp
+801043aa:	68 5d b3 10 80       	push   $0x8010b35d
+801043af:	56                   	push   %esi
+801043b0:	e8 af 30 00 00       	call   80107464 <initlock>
+    cpus[i].rq = &ptable.rq[i];
+801043b5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+801043b8:	c1 e0 06             	shl    $0x6,%eax
+801043bb:	89 b0 30 fa 13 80    	mov    %esi,-0x7fec05d0(%eax)
+  for(int i = 0; i < ncpu; i++){
+801043c1:	83 c3 01             	add    $0x1,%ebx
+801043c4:	81 c6 84 00 00 00    	add    $0x84,%esi
+801043ca:	83 c4 10             	add    $0x10,%esp
+801043cd:	39 1d 64 f9 13 80    	cmp    %ebx,0x8013f964
+801043d3:	7f d2                	jg     801043a7 <pinit+0x2d>
+}
+801043d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801043d8:	5b                   	pop    %ebx
+801043d9:	5e                   	pop    %esi
+801043da:	5d                   	pop    %ebp
+801043db:	c3                   	ret
+
+801043dc <mycpu>:
+{
+801043dc:	55                   	push   %ebp
+801043dd:	89 e5                	mov    %esp,%ebp
+801043df:	56                   	push   %esi
+801043e0:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801043e1:	9c                   	pushf
+801043e2:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801043e3:	f6 c4 02             	test   $0x2,%ah
+801043e6:	75 39                	jne    80104421 <mycpu+0x45>
+  apicid = lapicid();
+801043e8:	e8 0f e7 ff ff       	call   80102afc <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+801043ed:	8b 35 64 f9 13 80    	mov    0x8013f964,%esi
+801043f3:	85 f6                	test   %esi,%esi
+801043f5:	7e 1d                	jle    80104414 <mycpu+0x38>
+801043f7:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (cpus[i].apicid == apicid) {
+801043fc:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+801043ff:	c1 e1 06             	shl    $0x6,%ecx
+80104402:	0f b6 99 80 f9 13 80 	movzbl -0x7fec0680(%ecx),%ebx
+80104409:	39 c3                	cmp    %eax,%ebx
+8010440b:	74 21                	je     8010442e <mycpu+0x52>
+  for (i = 0; i < ncpu; ++i) {
+8010440d:	83 c2 01             	add    $0x1,%edx
+80104410:	39 f2                	cmp    %esi,%edx
+80104412:	75 e8                	jne    801043fc <mycpu+0x20>
+  panic("unknown apicid\n");
+80104414:	83 ec 0c             	sub    $0xc,%esp
+80104417:	68 62 b3 10 80       	push   $0x8010b362
+8010441c:	e8 21 bf ff ff       	call   80100342 <panic>
+    panic("mycpu called with interrupts enabled\n");
+80104421:	83 ec 0c             	sub    $0xc,%esp
+80104424:	68 f0 b5 10 80       	push   $0x8010b5f0
+80104429:	e8 14 bf ff ff       	call   80100342 <panic>
+      return &cpus[i];
+8010442e:	8d 81 80 f9 13 80    	lea    -0x7fec0680(%ecx),%eax
+}
+80104434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104437:	5b                   	pop    %ebx
+80104438:	5e                   	pop    %esi
+80104439:	5d                   	pop    %ebp
+8010443a:	c3                   	ret
+
+8010443b <cpuid>:
+cpuid() {
+8010443b:	55                   	push   %ebp
+8010443c:	89 e5                	mov    %esp,%ebp
+8010443e:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80104441:	e8 96 ff ff ff       	call   801043dc <mycpu>
+80104446:	2d 80 f9 13 80       	sub    $0x8013f980,%eax
+8010444b:	c1 f8 06             	sar    $0x6,%eax
+8010444e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+}
+80104454:	c9                   	leave
+80104455:	c3                   	ret
+
+80104456 <selectrq>:
+{
+80104456:	55                   	push   %ebp
+80104457:	89 e5                	mov    %esp,%ebp
+80104459:	57                   	push   %edi
+8010445a:	56                   	push   %esi
+8010445b:	53                   	push   %ebx
+8010445c:	83 ec 1c             	sub    $0x1c,%esp
+8010445f:	89 c3                	mov    %eax,%ebx
+  if(p->lastcpu >= 0 && ALLOWED(p, p->lastcpu))
+80104461:	8b 88 fc 00 00 00    	mov    0xfc(%eax),%ecx
+80104467:	85 c9                	test   %ecx,%ecx
+80104469:	78 48                	js     801044b3 <selectrq+0x5d>
+8010446b:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+80104472:	74 23                	je     80104497 <selectrq+0x41>
+80104474:	3b 88 18 01 00 00    	cmp    0x118(%eax),%ecx
+8010447a:	74 2a                	je     801044a6 <selectrq+0x50>
+  else if(ALLOWED(p, cpuid()))
+8010447c:	8b b3 18 01 00 00    	mov    0x118(%ebx),%esi
+80104482:	e8 b4 ff ff ff       	call   8010443b <cpuid>
+80104487:	39 c6                	cmp    %eax,%esi
+80104489:	0f 94 c0             	sete   %al
+8010448c:	84 c0                	test   %al,%al
+8010448e:	75 47                	jne    801044d7 <selectrq+0x81>
+  struct runq *best = 0;
+80104490:	b8 00 00 00 00       	mov    $0x0,%eax
+80104495:	eb 4b                	jmp    801044e2 <selectrq+0x8c>
+  if(p->lastcpu >= 0 && ALLOWED(p, p->lastcpu))
+80104497:	b8 01 00 00 00       	mov    $0x1,%eax
+8010449c:	d3 e0                	shl    %cl,%eax
+8010449e:	23 83 f8 00 00 00    	and    0xf8(%ebx),%eax
+801044a4:	74 16                	je     801044bc <selectrq+0x66>
+    best = &ptable.rq[p->lastcpu];
+801044a6:	69 c1 84 00 00 00    	imul   $0x84,%ecx,%eax
+801044ac:	05 50 12 14 80       	add    $0x80141250,%eax
+801044b1:	eb 2f                	jmp    801044e2 <selectrq+0x8c>
+  else if(ALLOWED(p, cpuid()))
+801044b3:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+801044ba:	75 c0                	jne    8010447c <selectrq+0x26>
+801044bc:	8b b3 f8 00 00 00    	mov    0xf8(%ebx),%esi
+801044c2:	e8 74 ff ff ff       	call   8010443b <cpuid>
+801044c7:	ba 01 00 00 00       	mov    $0x1,%edx
+801044cc:	89 c1                	mov    %eax,%ecx
+801044ce:	d3 e2                	shl    %cl,%edx
+801044d0:	85 f2                	test   %esi,%edx
+801044d2:	0f 95 c0             	setne  %al
+801044d5:	eb b5                	jmp    8010448c <selectrq+0x36>
+    best = mycpu()->rq;
+801044d7:	e8 00 ff ff ff       	call   801043dc <mycpu>
+801044dc:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+  for(i = 0; i < ncpu; i++)
+801044e2:	8b 3d 64 f9 13 80    	mov    0x8013f964,%edi
+801044e8:	85 ff                	test   %edi,%edi
+801044ea:	7e 66                	jle    80104552 <selectrq+0xfc>
+    if(ALLOWED(p, i) && (best == 0 || ptable.rq[i].nready < best->nready))
+801044ec:	8b 93 08 01 00 00    	mov    0x108(%ebx),%edx
+801044f2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801044f5:	ba 50 12 14 80       	mov    $0x80141250,%edx
+  for(i = 0; i < ncpu; i++)
+801044fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if(ALLOWED(p, i) && (best == 0 || ptable.rq[i].nready < best->nready))
+801044ff:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80104502:	eb 32                	jmp    80104536 <selectrq+0xe0>
+80104504:	be 01 00 00 00       	mov    $0x1,%esi
+80104509:	d3 e6                	shl    %cl,%esi
+8010450b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010450e:	23 b3 f8 00 00 00    	and    0xf8(%ebx),%esi
+80104514:	0f 95 c3             	setne  %bl
+80104517:	89 de                	mov    %ebx,%esi
+80104519:	eb 2f                	jmp    8010454a <selectrq+0xf4>
+8010451b:	85 c0                	test   %eax,%eax
+8010451d:	74 08                	je     80104527 <selectrq+0xd1>
+8010451f:	8b 58 70             	mov    0x70(%eax),%ebx
+80104522:	39 5a 70             	cmp    %ebx,0x70(%edx)
+80104525:	7d 02                	jge    80104529 <selectrq+0xd3>
+      best = &ptable.rq[i];
+80104527:	89 d0                	mov    %edx,%eax
+  for(i = 0; i < ncpu; i++)
+80104529:	83 c1 01             	add    $0x1,%ecx
+8010452c:	81 c2 84 00 00 00    	add    $0x84,%edx
+80104532:	39 f9                	cmp    %edi,%ecx
+80104534:	74 1c                	je     80104552 <selectrq+0xfc>
+    if(ALLOWED(p, i) && (best == 0 || ptable.rq[i].nready < best->nready))
+80104536:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+8010453a:	74 c8                	je     80104504 <selectrq+0xae>
+8010453c:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010453f:	39 8e 18 01 00 00    	cmp    %ecx,0x118(%esi)
+80104545:	0f 94 c3             	sete   %bl
+80104548:	89 de                	mov    %ebx,%esi
+8010454a:	89 f3                	mov    %esi,%ebx
+8010454c:	84 db                	test   %bl,%bl
+8010454e:	75 cb                	jne    8010451b <selectrq+0xc5>
+80104550:	eb d7                	jmp    80104529 <selectrq+0xd3>
+}
+80104552:	83 c4 1c             	add    $0x1c,%esp
+80104555:	5b                   	pop    %ebx
+80104556:	5e                   	pop    %esi
+80104557:	5f                   	pop    %edi
+80104558:	5d                   	pop    %ebp
+80104559:	c3                   	ret
+
+8010455a <enqueue>:
+{
+8010455a:	55                   	push   %ebp
+8010455b:	89 e5                	mov    %esp,%ebp
+8010455d:	57                   	push   %edi
+8010455e:	56                   	push   %esi
+8010455f:	53                   	push   %ebx
+80104560:	83 ec 28             	sub    $0x28,%esp
+80104563:	89 c3                	mov    %eax,%ebx
+80104565:	89 d7                	mov    %edx,%edi
+  acquire(&rq->lock);
+80104567:	50                   	push   %eax
+80104568:	e8 42 30 00 00       	call   801075af <acquire>
+  readyListAdd(rq, p);
+8010456d:	89 fa                	mov    %edi,%edx
+8010456f:	89 d8                	mov    %ebx,%eax
+80104571:	e8 3b fb ff ff       	call   801040b1 <readyListAdd>
+  release(&rq->lock);
+80104576:	89 1c 24             	mov    %ebx,(%esp)
+80104579:	e8 98 30 00 00       	call   80107616 <release>
+  struct cpu *c = &cpus[rq - ptable.rq];
+8010457e:	81 eb 50 12 14 80    	sub    $0x80141250,%ebx
+80104584:	c1 fb 02             	sar    $0x2,%ebx
+80104587:	69 db e1 83 0f 3e    	imul   $0x3e0f83e1,%ebx,%ebx
+8010458d:	8d 34 5b             	lea    (%ebx,%ebx,2),%esi
+80104590:	c1 e6 06             	shl    $0x6,%esi
+80104593:	81 c6 80 f9 13 80    	add    $0x8013f980,%esi
+  struct proc *cur = c->proc;
+80104599:	8b 86 ac 00 00 00    	mov    0xac(%esi),%eax
+  if(cur){
+8010459f:	83 c4 10             	add    $0x10,%esp
+801045a2:	85 c0                	test   %eax,%eax
+801045a4:	0f 84 03 01 00 00    	je     801046ad <enqueue+0x153>
+  if(p->dl_period && q->dl_period)
+801045aa:	8b 8f 08 01 00 00    	mov    0x108(%edi),%ecx
+801045b0:	85 c9                	test   %ecx,%ecx
+801045b2:	74 53                	je     80104607 <enqueue+0xad>
+801045b4:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+801045bb:	75 3a                	jne    801045f7 <enqueue+0x9d>
+    if(!outranks(p, cur)){
+801045bd:	85 c9                	test   %ecx,%ecx
+801045bf:	74 4f                	je     80104610 <enqueue+0xb6>
+    cur->needresched = 1;
+801045c1:	c7 80 00 01 00 00 01 	movl   $0x1,0x100(%eax)
+801045c8:	00 00 00 
+  if(c != mycpu())
+801045cb:	e8 0c fe ff ff       	call   801043dc <mycpu>
+801045d0:	39 c6                	cmp    %eax,%esi
+801045d2:	74 1b                	je     801045ef <enqueue+0x95>
+    lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+801045d4:	83 ec 08             	sub    $0x8,%esp
+801045d7:	6a 3e                	push   $0x3e
+801045d9:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+801045dc:	c1 e0 06             	shl    $0x6,%eax
+801045df:	0f b6 80 80 f9 13 80 	movzbl -0x7fec0680(%eax),%eax
+801045e6:	50                   	push   %eax
+801045e7:	e8 f0 e5 ff ff       	call   80102bdc <lapicipi>
+801045ec:	83 c4 10             	add    $0x10,%esp
+}
+801045ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801045f2:	5b                   	pop    %ebx
+801045f3:	5e                   	pop    %esi
+801045f4:	5f                   	pop    %edi
+801045f5:	5d                   	pop    %ebp
+801045f6:	c3                   	ret
+    if(!outranks(p, cur)){
+801045f7:	8b 90 0c 01 00 00    	mov    0x10c(%eax),%edx
+801045fd:	39 97 0c 01 00 00    	cmp    %edx,0x10c(%edi)
+80104603:	78 bc                	js     801045c1 <enqueue+0x67>
+80104605:	eb 09                	jmp    80104610 <enqueue+0xb6>
+  if(p->dl_period || q->dl_period)
+80104607:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+8010460e:	75 ad                	jne    801045bd <enqueue+0x63>
+      for(idle = cpus; idle < &cpus[ncpu]; idle++)
+80104610:	a1 64 f9 13 80       	mov    0x8013f964,%eax
+80104615:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80104618:	c1 e0 06             	shl    $0x6,%eax
+8010461b:	05 80 f9 13 80       	add    $0x8013f980,%eax
+80104620:	3d 80 f9 13 80       	cmp    $0x8013f980,%eax
+80104625:	76 c8                	jbe    801045ef <enqueue+0x95>
+80104627:	bb 80 f9 13 80       	mov    $0x8013f980,%ebx
+        if(idle != c && idle->tickless && ALLOWED(p, idle - cpus)){
+8010462c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010462f:	eb 2c                	jmp    8010465d <enqueue+0x103>
+80104631:	89 d9                	mov    %ebx,%ecx
+80104633:	81 e9 80 f9 13 80    	sub    $0x8013f980,%ecx
+80104639:	c1 f9 06             	sar    $0x6,%ecx
+8010463c:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+80104642:	ba 01 00 00 00       	mov    $0x1,%edx
+80104647:	d3 e2                	shl    %cl,%edx
+80104649:	89 d1                	mov    %edx,%ecx
+8010464b:	23 8f f8 00 00 00    	and    0xf8(%edi),%ecx
+80104651:	75 37                	jne    8010468a <enqueue+0x130>
+      for(idle = cpus; idle < &cpus[ncpu]; idle++)
+80104653:	81 c3 c0 00 00 00    	add    $0xc0,%ebx
+80104659:	39 c3                	cmp    %eax,%ebx
+8010465b:	73 92                	jae    801045ef <enqueue+0x95>
+        if(idle != c && idle->tickless && ALLOWED(p, idle - cpus)){
+8010465d:	39 de                	cmp    %ebx,%esi
+8010465f:	74 f2                	je     80104653 <enqueue+0xf9>
+80104661:	8b 8b b8 00 00 00    	mov    0xb8(%ebx),%ecx
+80104667:	85 c9                	test   %ecx,%ecx
+80104669:	74 e8                	je     80104653 <enqueue+0xf9>
+8010466b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+8010466f:	74 c0                	je     80104631 <enqueue+0xd7>
+80104671:	89 d9                	mov    %ebx,%ecx
+80104673:	81 e9 80 f9 13 80    	sub    $0x8013f980,%ecx
+80104679:	c1 f9 06             	sar    $0x6,%ecx
+8010467c:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+80104682:	39 8f 18 01 00 00    	cmp    %ecx,0x118(%edi)
+80104688:	75 c9                	jne    80104653 <enqueue+0xf9>
+          if(idle != mycpu())
+8010468a:	e8 4d fd ff ff       	call   801043dc <mycpu>
+8010468f:	39 c3                	cmp    %eax,%ebx
+80104691:	0f 84 58 ff ff ff    	je     801045ef <enqueue+0x95>
+            lapicipi(idle->apicid, T_IRQ0 + IRQ_RESCHED);
+80104697:	83 ec 08             	sub    $0x8,%esp
+8010469a:	6a 3e                	push   $0x3e
+8010469c:	0f b6 03             	movzbl (%ebx),%eax
+8010469f:	50                   	push   %eax
+801046a0:	e8 37 e5 ff ff       	call   80102bdc <lapicipi>
+801046a5:	83 c4 10             	add    $0x10,%esp
+801046a8:	e9 42 ff ff ff       	jmp    801045ef <enqueue+0x95>
+  } else if(!c->halted)
+801046ad:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+801046b0:	c1 e0 06             	shl    $0x6,%eax
+801046b3:	05 80 f9 13 80       	add    $0x8013f980,%eax
+801046b8:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+801046be:	85 c0                	test   %eax,%eax
+801046c0:	0f 85 05 ff ff ff    	jne    801045cb <enqueue+0x71>
+801046c6:	e9 24 ff ff ff       	jmp    801045ef <enqueue+0x95>
+
+801046cb <wakeproc>:
+{
+801046cb:	55                   	push   %ebp
+801046cc:	89 e5                	mov    %esp,%ebp
+801046ce:	53                   	push   %ebx
+801046cf:	83 ec 04             	sub    $0x4,%esp
+801046d2:	89 c3                	mov    %eax,%ebx
+  int rc = stateListRemove(&ptable.list[SLEEPING], p);
+801046d4:	89 c2                	mov    %eax,%edx
+801046d6:	b8 30 12 14 80       	mov    $0x80141230,%eax
+801046db:	e8 2b f6 ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+801046e0:	85 c0                	test   %eax,%eax
+801046e2:	78 72                	js     80104756 <wakeproc+0x8b>
+  struct ptrs *q = WAITQ(p->chan);
+801046e4:	69 43 20 b1 79 37 9e 	imul   $0x9e3779b1,0x20(%ebx),%eax
+801046eb:	c1 e8 1a             	shr    $0x1a,%eax
+801046ee:	89 c2                	mov    %eax,%edx
+  if(p->wqprev)
+801046f0:	8b 83 4c 01 00 00    	mov    0x14c(%ebx),%eax
+801046f6:	85 c0                	test   %eax,%eax
+801046f8:	74 69                	je     80104763 <wakeproc+0x98>
+    p->wqprev->wqnext = p->wqnext;
+801046fa:	8b 8b 48 01 00 00    	mov    0x148(%ebx),%ecx
+80104700:	89 88 48 01 00 00    	mov    %ecx,0x148(%eax)
+  if(p->wqnext)
+80104706:	8b 83 48 01 00 00    	mov    0x148(%ebx),%eax
+8010470c:	85 c0                	test   %eax,%eax
+8010470e:	74 62                	je     80104772 <wakeproc+0xa7>
+    p->wqnext->wqprev = p->wqprev;
+80104710:	8b 93 4c 01 00 00    	mov    0x14c(%ebx),%edx
+80104716:	89 90 4c 01 00 00    	mov    %edx,0x14c(%eax)
+  p->wqnext = 0;
+8010471c:	c7 83 48 01 00 00 00 	movl   $0x0,0x148(%ebx)
+80104723:	00 00 00 
+  p->wqprev = 0;
+80104726:	c7 83 4c 01 00 00 00 	movl   $0x0,0x14c(%ebx)
+8010472d:	00 00 00 
+  assertState(p, SLEEPING);
+80104730:	ba 02 00 00 00       	mov    $0x2,%edx
+80104735:	89 d8                	mov    %ebx,%eax
+80104737:	e8 43 f9 ff ff       	call   8010407f <assertState>
+  p->state = RUNNABLE;
+8010473c:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  enqueue(selectrq(p),p);
+80104743:	89 d8                	mov    %ebx,%eax
+80104745:	e8 0c fd ff ff       	call   80104456 <selectrq>
+8010474a:	89 da                	mov    %ebx,%edx
+8010474c:	e8 09 fe ff ff       	call   8010455a <enqueue>
+}
+80104751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104754:	c9                   	leave
+80104755:	c3                   	ret
+     panic("Error removing from SLEEPING in wakeup1().\n");
+80104756:	83 ec 0c             	sub    $0xc,%esp
+80104759:	68 18 b6 10 80       	push   $0x8010b618
+8010475e:	e8 df bb ff ff       	call   80100342 <panic>
+    q->head = p->wqnext;
+80104763:	8b 83 48 01 00 00    	mov    0x148(%ebx),%eax
+80104769:	89 04 d5 28 99 15 80 	mov    %eax,-0x7fea66d8(,%edx,8)
+80104770:	eb 94                	jmp    80104706 <wakeproc+0x3b>
+    q->tail = p->wqprev;
+80104772:	8b 83 4c 01 00 00    	mov    0x14c(%ebx),%eax
+80104778:	89 04 d5 2c 99 15 80 	mov    %eax,-0x7fea66d4(,%edx,8)
+8010477f:	eb 9b                	jmp    8010471c <wakeproc+0x51>
+
+80104781 <wakeup1>:
+{
+80104781:	55                   	push   %ebp
+80104782:	89 e5                	mov    %esp,%ebp
+80104784:	56                   	push   %esi
+80104785:	53                   	push   %ebx
+80104786:	89 c6                	mov    %eax,%esi
+  p = WAITQ(chan)->head;
+80104788:	69 c0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%eax
+8010478e:	c1 e8 1a             	shr    $0x1a,%eax
+80104791:	8b 1c c5 28 99 15 80 	mov    -0x7fea66d8(,%eax,8),%ebx
+  while(p != 0){
+80104798:	85 db                	test   %ebx,%ebx
+8010479a:	75 08                	jne    801047a4 <wakeup1+0x23>
+}
+8010479c:	5b                   	pop    %ebx
+8010479d:	5e                   	pop    %esi
+8010479e:	5d                   	pop    %ebp
+8010479f:	c3                   	ret
+  while(p != 0){
+801047a0:	85 db                	test   %ebx,%ebx
+801047a2:	74 f8                	je     8010479c <wakeup1+0x1b>
+    next = p->wqnext;
+801047a4:	89 d8                	mov    %ebx,%eax
+801047a6:	8b 9b 48 01 00 00    	mov    0x148(%ebx),%ebx
+    if(p->chan == chan)
+801047ac:	39 70 20             	cmp    %esi,0x20(%eax)
+801047af:	75 ef                	jne    801047a0 <wakeup1+0x1f>
+      wakeproc(p);
+801047b1:	e8 15 ff ff ff       	call   801046cb <wakeproc>
+801047b6:	eb e8                	jmp    801047a0 <wakeup1+0x1f>
+
+801047b8 <myproc>:
+myproc(void) {
+801047b8:	55                   	push   %ebp
+801047b9:	89 e5                	mov    %esp,%ebp
+801047bb:	53                   	push   %ebx
+801047bc:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+801047bf:	e8 1b 2d 00 00       	call   801074df <pushcli>
+  c = mycpu();
+801047c4:	e8 13 fc ff ff       	call   801043dc <mycpu>
+  p = c->proc;
+801047c9:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801047cf:	e8 47 2d 00 00       	call   8010751b <popcli>
+}
+801047d4:	89 d8                	mov    %ebx,%eax
+801047d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801047d9:	c9                   	leave
+801047da:	c3                   	ret
+
+801047db <growproc>:
+{
+801047db:	55                   	push   %ebp
+801047dc:	89 e5                	mov    %esp,%ebp
+801047de:	56                   	push   %esi
+801047df:	53                   	push   %ebx
+801047e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+801047e3:	e8 d0 ff ff ff       	call   801047b8 <myproc>
+801047e8:	89 c3                	mov    %eax,%ebx
+  sz = curproc->sz;
+801047ea:	8b 10                	mov    (%eax),%edx
+  if(n > 0){
+801047ec:	85 f6                	test   %esi,%esi
+801047ee:	7e 24                	jle    80104814 <growproc+0x39>
+    if(sz + n < sz || sz + n >= KERNBASE)
+801047f0:	89 f0                	mov    %esi,%eax
+801047f2:	01 d0                	add    %edx,%eax
+801047f4:	72 3f                	jb     80104835 <growproc+0x5a>
+801047f6:	85 c0                	test   %eax,%eax
+801047f8:	78 42                	js     8010483c <growproc+0x61>
+  curproc->sz = sz;
+801047fa:	89 03                	mov    %eax,(%ebx)
+  switchuvm(curproc);
+801047fc:	83 ec 0c             	sub    $0xc,%esp
+801047ff:	53                   	push   %ebx
+80104800:	e8 f2 57 00 00       	call   80109ff7 <switchuvm>
+  return 0;
+80104805:	83 c4 10             	add    $0x10,%esp
+80104808:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010480d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104810:	5b                   	pop    %ebx
+80104811:	5e                   	pop    %esi
+80104812:	5d                   	pop    %ebp
+80104813:	c3                   	ret
+  sz = curproc->sz;
+80104814:	89 d0                	mov    %edx,%eax
+  } else if(n < 0){
+80104816:	79 e2                	jns    801047fa <growproc+0x1f>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80104818:	83 ec 04             	sub    $0x4,%esp
+8010481b:	01 d6                	add    %edx,%esi
+8010481d:	56                   	push   %esi
+8010481e:	52                   	push   %edx
+8010481f:	ff 73 04             	push   0x4(%ebx)
+80104822:	e8 d6 59 00 00       	call   8010a1fd <deallocuvm>
+80104827:	83 c4 10             	add    $0x10,%esp
+8010482a:	85 c0                	test   %eax,%eax
+8010482c:	75 cc                	jne    801047fa <growproc+0x1f>
+      return -1;
+8010482e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104833:	eb d8                	jmp    8010480d <growproc+0x32>
+      return -1;
+80104835:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010483a:	eb d1                	jmp    8010480d <growproc+0x32>
+8010483c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104841:	eb ca                	jmp    8010480d <growproc+0x32>
+
+80104843 <growhuge>:
+{
+80104843:	55                   	push   %ebp
+80104844:	89 e5                	mov    %esp,%ebp
+80104846:	57                   	push   %edi
+80104847:	56                   	push   %esi
+80104848:	53                   	push   %ebx
+80104849:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+8010484c:	e8 67 ff ff ff       	call   801047b8 <myproc>
+80104851:	89 c7                	mov    %eax,%edi
+  start = HUGEROUNDUP(curproc->sz);
+80104853:	8b 10                	mov    (%eax),%edx
+80104855:	8d 9a ff ff 3f 00    	lea    0x3fffff(%edx),%ebx
+8010485b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  sz = start + HUGEROUNDUP((uint)n);
+80104861:	8b 45 08             	mov    0x8(%ebp),%eax
+80104864:	8d b0 ff ff 3f 00    	lea    0x3fffff(%eax),%esi
+8010486a:	81 e6 00 00 c0 ff    	and    $0xffc00000,%esi
+80104870:	01 de                	add    %ebx,%esi
+  if(n <= 0 || sz <= start)
+80104872:	85 c0                	test   %eax,%eax
+80104874:	7e 30                	jle    801048a6 <growhuge+0x63>
+80104876:	39 f3                	cmp    %esi,%ebx
+80104878:	73 2c                	jae    801048a6 <growhuge+0x63>
+  if(allochuge(curproc->pgdir, curproc->sz, sz) == 0)
+8010487a:	83 ec 04             	sub    $0x4,%esp
+8010487d:	56                   	push   %esi
+8010487e:	52                   	push   %edx
+8010487f:	ff 77 04             	push   0x4(%edi)
+80104882:	e8 33 5c 00 00       	call   8010a4ba <allochuge>
+80104887:	83 c4 10             	add    $0x10,%esp
+8010488a:	85 c0                	test   %eax,%eax
+8010488c:	74 1f                	je     801048ad <growhuge+0x6a>
+  curproc->sz = sz;
+8010488e:	89 37                	mov    %esi,(%edi)
+  switchuvm(curproc);
+80104890:	83 ec 0c             	sub    $0xc,%esp
+80104893:	57                   	push   %edi
+80104894:	e8 5e 57 00 00       	call   80109ff7 <switchuvm>
+  return start;
+80104899:	89 d8                	mov    %ebx,%eax
+8010489b:	83 c4 10             	add    $0x10,%esp
+}
+8010489e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801048a1:	5b                   	pop    %ebx
+801048a2:	5e                   	pop    %esi
+801048a3:	5f                   	pop    %edi
+801048a4:	5d                   	pop    %ebp
+801048a5:	c3                   	ret
+    return -1;
+801048a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801048ab:	eb f1                	jmp    8010489e <growhuge+0x5b>
+    return -1;
+801048ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801048b2:	eb ea                	jmp    8010489e <growhuge+0x5b>
+
+801048b4 <sched>:
+{
+801048b4:	55                   	push   %ebp
+801048b5:	89 e5                	mov    %esp,%ebp
+801048b7:	56                   	push   %esi
+801048b8:	53                   	push   %ebx
+  struct proc *p = myproc();
+801048b9:	e8 fa fe ff ff       	call   801047b8 <myproc>
+801048be:	89 c3                	mov    %eax,%ebx
+  if(!holding(&ptable.lock))
+801048c0:	83 ec 0c             	sub    $0xc,%esp
+801048c3:	68 e0 11 14 80       	push   $0x801411e0
+801048c8:	e8 ae 2c 00 00       	call   8010757b <holding>
+801048cd:	83 c4 10             	add    $0x10,%esp
+801048d0:	85 c0                	test   %eax,%eax
+801048d2:	74 66                	je     8010493a <sched+0x86>
+  if(mycpu()->ncli != 1)
+801048d4:	e8 03 fb ff ff       	call   801043dc <mycpu>
+801048d9:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+801048e0:	75 65                	jne    80104947 <sched+0x93>
+  if(p->state == RUNNING)
+801048e2:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+801048e6:	74 6c                	je     80104954 <sched+0xa0>
+801048e8:	9c                   	pushf
+801048e9:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801048ea:	f6 c4 02             	test   $0x2,%ah
+801048ed:	75 72                	jne    80104961 <sched+0xad>
+  p->cpu_ticks_total += (ticks - p->cpu_ticks_in);
+801048ef:	a1 40 db 15 80       	mov    0x8015db40,%eax
+801048f4:	03 83 d8 00 00 00    	add    0xd8(%ebx),%eax
+801048fa:	2b 83 dc 00 00 00    	sub    0xdc(%ebx),%eax
+80104900:	89 83 d8 00 00 00    	mov    %eax,0xd8(%ebx)
+  intena = mycpu()->intena;
+80104906:	e8 d1 fa ff ff       	call   801043dc <mycpu>
+8010490b:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80104911:	e8 c6 fa ff ff       	call   801043dc <mycpu>
+80104916:	83 ec 08             	sub    $0x8,%esp
+80104919:	ff 70 04             	push   0x4(%eax)
+8010491c:	83 c3 1c             	add    $0x1c,%ebx
+8010491f:	53                   	push   %ebx
+80104920:	e8 02 2f 00 00       	call   80107827 <swtch>
+  mycpu()->intena = intena;
+80104925:	e8 b2 fa ff ff       	call   801043dc <mycpu>
+8010492a:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80104930:	83 c4 10             	add    $0x10,%esp
+80104933:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104936:	5b                   	pop    %ebx
+80104937:	5e                   	pop    %esi
+80104938:	5d                   	pop    %ebp
+80104939:	c3                   	ret
+    panic("sched ptable.lock");
+8010493a:	83 ec 0c             	sub    $0xc,%esp
+8010493d:	68 72 b3 10 80       	push   $0x8010b372
+80104942:	e8 fb b9 ff ff       	call   80100342 <panic>
+    panic("sched locks");
+80104947:	83 ec 0c             	sub    $0xc,%esp
+8010494a:	68 84 b3 10 80       	push   $0x8010b384
+8010494f:	e8 ee b9 ff ff       	call   80100342 <panic>
+    panic("sched running");
+80104954:	83 ec 0c             	sub    $0xc,%esp
+80104957:	68 90 b3 10 80       	push   $0x8010b390
+8010495c:	e8 e1 b9 ff ff       	call   80100342 <panic>
+    panic("sched interruptible");
+80104961:	83 ec 0c             	sub    $0xc,%esp
+80104964:	68 9e b3 10 80       	push   $0x8010b39e
+80104969:	e8 d4 b9 ff ff       	call   80100342 <panic>
+
+8010496e <yield>:
+{
+8010496e:	55                   	push   %ebp
+8010496f:	89 e5                	mov    %esp,%ebp
+80104971:	56                   	push   %esi
+80104972:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+80104973:	e8 40 fe ff ff       	call   801047b8 <myproc>
+80104978:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);  //DOC: yieldlock
+8010497a:	83 ec 0c             	sub    $0xc,%esp
+8010497d:	68 e0 11 14 80       	push   $0x801411e0
+80104982:	e8 28 2c 00 00       	call   801075af <acquire>
+  curproc->needresched = 0;
+80104987:	c7 83 00 01 00 00 00 	movl   $0x0,0x100(%ebx)
+8010498e:	00 00 00 
+  edfcharge(curproc);
+80104991:	89 d8                	mov    %ebx,%eax
+80104993:	e8 4b f2 ff ff       	call   80103be3 <edfcharge>
+  strideCharge(curproc);
+80104998:	89 d8                	mov    %ebx,%eax
+8010499a:	e8 be f1 ff ff       	call   80103b5d <strideCharge>
+  promote(p, ptable.epoch);
+8010499f:	8b 15 78 16 14 80    	mov    0x80141678,%edx
+801049a5:	89 d8                	mov    %ebx,%eax
+801049a7:	e8 ee f1 ff ff       	call   80103b9a <promote>
+  curproc->budget = curproc->budget - (ticks - curproc->cpu_ticks_in);
+801049ac:	8b 83 dc 00 00 00    	mov    0xdc(%ebx),%eax
+801049b2:	2b 05 40 db 15 80    	sub    0x8015db40,%eax
+801049b8:	03 83 f0 00 00 00    	add    0xf0(%ebx),%eax
+801049be:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+  if(curproc->budget <= 0 && curproc->priority > 0 && curproc->priority <= MAXPRIO){
+801049c4:	83 c4 10             	add    $0x10,%esp
+801049c7:	85 c0                	test   %eax,%eax
+801049c9:	7e 5f                	jle    80104a2a <yield+0xbc>
+  int rc = stateListRemove(&ptable.list[RUNNING], curproc);
+801049cb:	89 da                	mov    %ebx,%edx
+801049cd:	b8 40 12 14 80       	mov    $0x80141240,%eax
+801049d2:	e8 34 f3 ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+801049d7:	85 c0                	test   %eax,%eax
+801049d9:	78 70                	js     80104a4b <yield+0xdd>
+  assertState(curproc, RUNNING);
+801049db:	ba 04 00 00 00       	mov    $0x4,%edx
+801049e0:	89 d8                	mov    %ebx,%eax
+801049e2:	e8 98 f6 ff ff       	call   8010407f <assertState>
+  if(curproc->dl_period && curproc->dl_left <= 0 &&
+801049e7:	83 bb 08 01 00 00 00 	cmpl   $0x0,0x108(%ebx)
+801049ee:	0f 84 d6 00 00 00    	je     80104aca <yield+0x15c>
+801049f4:	83 bb 10 01 00 00 00 	cmpl   $0x0,0x110(%ebx)
+801049fb:	7e 5b                	jle    80104a58 <yield+0xea>
+  curproc->state = RUNNABLE;
+801049fd:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  if(ALLOWED(curproc, cpuid()))
+80104a04:	8b b3 18 01 00 00    	mov    0x118(%ebx),%esi
+80104a0a:	e8 2c fa ff ff       	call   8010443b <cpuid>
+80104a0f:	39 c6                	cmp    %eax,%esi
+80104a11:	0f 84 d6 00 00 00    	je     80104aed <yield+0x17f>
+    enqueue(selectrq(curproc),curproc);
+80104a17:	89 d8                	mov    %ebx,%eax
+80104a19:	e8 38 fa ff ff       	call   80104456 <selectrq>
+80104a1e:	89 da                	mov    %ebx,%edx
+80104a20:	e8 35 fb ff ff       	call   8010455a <enqueue>
+80104a25:	e9 d5 00 00 00       	jmp    80104aff <yield+0x191>
+  if(curproc->budget <= 0 && curproc->priority > 0 && curproc->priority <= MAXPRIO){
+80104a2a:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+80104a30:	83 e8 01             	sub    $0x1,%eax
+80104a33:	83 f8 05             	cmp    $0x5,%eax
+80104a36:	77 93                	ja     801049cb <yield+0x5d>
+    curproc->priority--;
+80104a38:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+    curproc->budget = ptable.params.budget;
+80104a3e:	a1 98 16 14 80       	mov    0x80141698,%eax
+80104a43:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+80104a49:	eb 80                	jmp    801049cb <yield+0x5d>
+    panic("Error removing from RUNNING in yield().\n");
+80104a4b:	83 ec 0c             	sub    $0xc,%esp
+80104a4e:	68 44 b6 10 80       	push   $0x8010b644
+80104a53:	e8 ea b8 ff ff       	call   80100342 <panic>
+     (int)(curproc->dl_deadline - ticks) > 0){
+80104a58:	8b 83 0c 01 00 00    	mov    0x10c(%ebx),%eax
+80104a5e:	89 c2                	mov    %eax,%edx
+80104a60:	2b 15 40 db 15 80    	sub    0x8015db40,%edx
+  if(curproc->dl_period && curproc->dl_left <= 0 &&
+80104a66:	85 d2                	test   %edx,%edx
+80104a68:	7e 93                	jle    801049fd <yield+0x8f>
+  p->chan = &p->wakeat;
+80104a6a:	8d 93 50 01 00 00    	lea    0x150(%ebx),%edx
+80104a70:	89 53 20             	mov    %edx,0x20(%ebx)
+  p->wakeat = p->dl_deadline;
+80104a73:	89 83 50 01 00 00    	mov    %eax,0x150(%ebx)
+  timerAdd(p);
+80104a79:	89 d8                	mov    %ebx,%eax
+80104a7b:	e8 ce f7 ff ff       	call   8010424e <timerAdd>
+  p->state = SLEEPING;
+80104a80:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  stateListAdd(&ptable.list[SLEEPING],p);
+80104a87:	89 da                	mov    %ebx,%edx
+80104a89:	b8 30 12 14 80       	mov    $0x80141230,%eax
+80104a8e:	e8 4c f2 ff ff       	call   80103cdf <stateListAdd>
+  waitqAdd(p);
+80104a93:	89 d8                	mov    %ebx,%eax
+80104a95:	e8 f5 f1 ff ff       	call   80103c8f <waitqAdd>
+  sched();
+80104a9a:	e8 15 fe ff ff       	call   801048b4 <sched>
+  p->chan = 0;
+80104a9f:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  if(p->timeridx >= 0)
+80104aa6:	83 bb 54 01 00 00 00 	cmpl   $0x0,0x154(%ebx)
+80104aad:	79 12                	jns    80104ac1 <yield+0x153>
+    release(&ptable.lock);
+80104aaf:	83 ec 0c             	sub    $0xc,%esp
+80104ab2:	68 e0 11 14 80       	push   $0x801411e0
+80104ab7:	e8 5a 2b 00 00       	call   80107616 <release>
+    return;
+80104abc:	83 c4 10             	add    $0x10,%esp
+80104abf:	eb 53                	jmp    80104b14 <yield+0x1a6>
+    timerRemove(p);
+80104ac1:	89 d8                	mov    %ebx,%eax
+80104ac3:	e8 c0 f7 ff ff       	call   80104288 <timerRemove>
+80104ac8:	eb e5                	jmp    80104aaf <yield+0x141>
+  curproc->state = RUNNABLE;
+80104aca:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  if(ALLOWED(curproc, cpuid()))
+80104ad1:	8b b3 f8 00 00 00    	mov    0xf8(%ebx),%esi
+80104ad7:	e8 5f f9 ff ff       	call   8010443b <cpuid>
+80104adc:	ba 01 00 00 00       	mov    $0x1,%edx
+80104ae1:	89 c1                	mov    %eax,%ecx
+80104ae3:	d3 e2                	shl    %cl,%edx
+80104ae5:	85 f2                	test   %esi,%edx
+80104ae7:	0f 84 2a ff ff ff    	je     80104a17 <yield+0xa9>
+    enqueue(mycpu()->rq,curproc);
+80104aed:	e8 ea f8 ff ff       	call   801043dc <mycpu>
+80104af2:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+80104af8:	89 da                	mov    %ebx,%edx
+80104afa:	e8 5b fa ff ff       	call   8010455a <enqueue>
+  sched();
+80104aff:	e8 b0 fd ff ff       	call   801048b4 <sched>
+  release(&ptable.lock);
+80104b04:	83 ec 0c             	sub    $0xc,%esp
+80104b07:	68 e0 11 14 80       	push   $0x801411e0
+80104b0c:	e8 05 2b 00 00       	call   80107616 <release>
+80104b11:	83 c4 10             	add    $0x10,%esp
+}
+80104b14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104b17:	5b                   	pop    %ebx
+80104b18:	5e                   	pop    %esi
+80104b19:	5d                   	pop    %ebp
+80104b1a:	c3                   	ret
+
+80104b1b <sleep>:
+{
+80104b1b:	55                   	push   %ebp
+80104b1c:	89 e5                	mov    %esp,%ebp
+80104b1e:	56                   	push   %esi
+80104b1f:	53                   	push   %ebx
+80104b20:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+80104b23:	e8 90 fc ff ff       	call   801047b8 <myproc>
+  if(p == 0)
+80104b28:	85 c0                	test   %eax,%eax
+80104b2a:	0f 84 e0 00 00 00    	je     80104c10 <sleep+0xf5>
+80104b30:	89 c3                	mov    %eax,%ebx
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+80104b32:	81 fe e0 11 14 80    	cmp    $0x801411e0,%esi
+80104b38:	74 20                	je     80104b5a <sleep+0x3f>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80104b3a:	83 ec 0c             	sub    $0xc,%esp
+80104b3d:	68 e0 11 14 80       	push   $0x801411e0
+80104b42:	e8 68 2a 00 00       	call   801075af <acquire>
+    if (lk) release(lk);
+80104b47:	83 c4 10             	add    $0x10,%esp
+80104b4a:	85 f6                	test   %esi,%esi
+80104b4c:	74 0c                	je     80104b5a <sleep+0x3f>
+80104b4e:	83 ec 0c             	sub    $0xc,%esp
+80104b51:	56                   	push   %esi
+80104b52:	e8 bf 2a 00 00       	call   80107616 <release>
+80104b57:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+80104b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+80104b5d:	89 43 20             	mov    %eax,0x20(%ebx)
+  edfcharge(p);
+80104b60:	89 d8                	mov    %ebx,%eax
+80104b62:	e8 7c f0 ff ff       	call   80103be3 <edfcharge>
+  strideCharge(p);
+80104b67:	89 d8                	mov    %ebx,%eax
+80104b69:	e8 ef ef ff ff       	call   80103b5d <strideCharge>
+  promote(p, ptable.epoch);
+80104b6e:	8b 15 78 16 14 80    	mov    0x80141678,%edx
+80104b74:	89 d8                	mov    %ebx,%eax
+80104b76:	e8 1f f0 ff ff       	call   80103b9a <promote>
+  p->budget = p->budget - (ticks - p->cpu_ticks_in);
+80104b7b:	8b 83 dc 00 00 00    	mov    0xdc(%ebx),%eax
+80104b81:	2b 05 40 db 15 80    	sub    0x8015db40,%eax
+80104b87:	03 83 f0 00 00 00    	add    0xf0(%ebx),%eax
+80104b8d:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+  if(p->budget <= 0 && p->priority > 0 && p->priority <= MAXPRIO){
+80104b93:	85 c0                	test   %eax,%eax
+80104b95:	0f 8e 82 00 00 00    	jle    80104c1d <sleep+0x102>
+  int rc = stateListRemove(&ptable.list[RUNNING], p);
+80104b9b:	89 da                	mov    %ebx,%edx
+80104b9d:	b8 40 12 14 80       	mov    $0x80141240,%eax
+80104ba2:	e8 64 f1 ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+80104ba7:	85 c0                	test   %eax,%eax
+80104ba9:	0f 88 96 00 00 00    	js     80104c45 <sleep+0x12a>
+  assertState(p, RUNNING);
+80104baf:	ba 04 00 00 00       	mov    $0x4,%edx
+80104bb4:	89 d8                	mov    %ebx,%eax
+80104bb6:	e8 c4 f4 ff ff       	call   8010407f <assertState>
+  p->state = SLEEPING;
+80104bbb:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  stateListAdd(&ptable.list[SLEEPING],p);
+80104bc2:	89 da                	mov    %ebx,%edx
+80104bc4:	b8 30 12 14 80       	mov    $0x80141230,%eax
+80104bc9:	e8 11 f1 ff ff       	call   80103cdf <stateListAdd>
+  waitqAdd(p);
+80104bce:	89 d8                	mov    %ebx,%eax
+80104bd0:	e8 ba f0 ff ff       	call   80103c8f <waitqAdd>
+  sched();
+80104bd5:	e8 da fc ff ff       	call   801048b4 <sched>
+  p->chan = 0;
+80104bda:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+80104be1:	81 fe e0 11 14 80    	cmp    $0x801411e0,%esi
+80104be7:	74 20                	je     80104c09 <sleep+0xee>
+    release(&ptable.lock);
+80104be9:	83 ec 0c             	sub    $0xc,%esp
+80104bec:	68 e0 11 14 80       	push   $0x801411e0
+80104bf1:	e8 20 2a 00 00       	call   80107616 <release>
+    if (lk) acquire(lk);
+80104bf6:	83 c4 10             	add    $0x10,%esp
+80104bf9:	85 f6                	test   %esi,%esi
+80104bfb:	74 0c                	je     80104c09 <sleep+0xee>
+80104bfd:	83 ec 0c             	sub    $0xc,%esp
+80104c00:	56                   	push   %esi
+80104c01:	e8 a9 29 00 00       	call   801075af <acquire>
+80104c06:	83 c4 10             	add    $0x10,%esp
+}
+80104c09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104c0c:	5b                   	pop    %ebx
+80104c0d:	5e                   	pop    %esi
+80104c0e:	5d                   	pop    %ebp
+80104c0f:	c3                   	ret
+    panic("sleep");
+80104c10:	83 ec 0c             	sub    $0xc,%esp
+80104c13:	68 b2 b3 10 80       	push   $0x8010b3b2
+80104c18:	e8 25 b7 ff ff       	call   80100342 <panic>
+  if(p->budget <= 0 && p->priority > 0 && p->priority <= MAXPRIO){
+80104c1d:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+80104c23:	83 e8 01             	sub    $0x1,%eax
+80104c26:	83 f8 05             	cmp    $0x5,%eax
+80104c29:	0f 87 6c ff ff ff    	ja     80104b9b <sleep+0x80>
+    p->priority--;
+80104c2f:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+    p->budget = ptable.params.budget;
+80104c35:	a1 98 16 14 80       	mov    0x80141698,%eax
+80104c3a:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+80104c40:	e9 56 ff ff ff       	jmp    80104b9b <sleep+0x80>
+    panic("Error removing from RUNNING in sleep().\n");
+80104c45:	83 ec 0c             	sub    $0xc,%esp
+80104c48:	68 70 b6 10 80       	push   $0x8010b670
+80104c4d:	e8 f0 b6 ff ff       	call   80100342 <panic>
+
+80104c52 <wakeupone>:
+{
+80104c52:	55                   	push   %ebp
+80104c53:	89 e5                	mov    %esp,%ebp
+80104c55:	53                   	push   %ebx
+80104c56:	83 ec 10             	sub    $0x10,%esp
+80104c59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+80104c5c:	68 e0 11 14 80       	push   $0x801411e0
+80104c61:	e8 49 29 00 00       	call   801075af <acquire>
+  for(p = WAITQ(chan)->head; p != 0; p = p->wqnext)
+80104c66:	69 c3 b1 79 37 9e    	imul   $0x9e3779b1,%ebx,%eax
+80104c6c:	c1 e8 1a             	shr    $0x1a,%eax
+80104c6f:	8b 04 c5 28 99 15 80 	mov    -0x7fea66d8(,%eax,8),%eax
+80104c76:	83 c4 10             	add    $0x10,%esp
+80104c79:	85 c0                	test   %eax,%eax
+80104c7b:	74 16                	je     80104c93 <wakeupone+0x41>
+    if(p->chan == chan){
+80104c7d:	39 58 20             	cmp    %ebx,0x20(%eax)
+80104c80:	74 0c                	je     80104c8e <wakeupone+0x3c>
+  for(p = WAITQ(chan)->head; p != 0; p = p->wqnext)
+80104c82:	8b 80 48 01 00 00    	mov    0x148(%eax),%eax
+80104c88:	85 c0                	test   %eax,%eax
+80104c8a:	75 f1                	jne    80104c7d <wakeupone+0x2b>
+80104c8c:	eb 05                	jmp    80104c93 <wakeupone+0x41>
+      wakeproc(p);
+80104c8e:	e8 38 fa ff ff       	call   801046cb <wakeproc>
+  release(&ptable.lock);
+80104c93:	83 ec 0c             	sub    $0xc,%esp
+80104c96:	68 e0 11 14 80       	push   $0x801411e0
+80104c9b:	e8 76 29 00 00       	call   80107616 <release>
+}
+80104ca0:	83 c4 10             	add    $0x10,%esp
+80104ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ca6:	c9                   	leave
+80104ca7:	c3                   	ret
+
+80104ca8 <wakeup>:
+{
+80104ca8:	55                   	push   %ebp
+80104ca9:	89 e5                	mov    %esp,%ebp
+80104cab:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+80104cae:	68 e0 11 14 80       	push   $0x801411e0
+80104cb3:	e8 f7 28 00 00       	call   801075af <acquire>
+  wakeup1(chan);
+80104cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+80104cbb:	e8 c1 fa ff ff       	call   80104781 <wakeup1>
+  release(&ptable.lock);
+80104cc0:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80104cc7:	e8 4a 29 00 00       	call   80107616 <release>
+}
+80104ccc:	83 c4 10             	add    $0x10,%esp
+80104ccf:	c9                   	leave
+80104cd0:	c3                   	ret
+
+80104cd1 <sleepticks>:
+{
+80104cd1:	55                   	push   %ebp
+80104cd2:	89 e5                	mov    %esp,%ebp
+80104cd4:	56                   	push   %esi
+80104cd5:	53                   	push   %ebx
+80104cd6:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *p = myproc();
+80104cd9:	e8 da fa ff ff       	call   801047b8 <myproc>
+80104cde:	89 c3                	mov    %eax,%ebx
+  if(n <= 0)
+80104ce0:	85 f6                	test   %esi,%esi
+80104ce2:	0f 8e 90 00 00 00    	jle    80104d78 <sleepticks+0xa7>
+  acquire(&ptable.lock);
+80104ce8:	83 ec 0c             	sub    $0xc,%esp
+80104ceb:	68 e0 11 14 80       	push   $0x801411e0
+80104cf0:	e8 ba 28 00 00       	call   801075af <acquire>
+  uint when = ticks + n;
+80104cf5:	89 f0                	mov    %esi,%eax
+80104cf7:	03 05 40 db 15 80    	add    0x8015db40,%eax
+  if(n < (2 << TIMER_SLACK_SHIFT))
+80104cfd:	83 c4 10             	add    $0x10,%esp
+80104d00:	83 fe 7f             	cmp    $0x7f,%esi
+80104d03:	76 15                	jbe    80104d1a <sleepticks+0x49>
+// Index of the most significant set bit; val must be non-zero.
+static inline int
+bsr(uint val)
+{
+  int idx;
+  asm("bsrl %1,%0" : "=r" (idx) : "rm" (val) : "cc");
+80104d05:	0f bd ce             	bsr    %esi,%ecx
+  slack = 1 << (bsr(n) - TIMER_SLACK_SHIFT);
+80104d08:	83 e9 06             	sub    $0x6,%ecx
+80104d0b:	ba 01 00 00 00       	mov    $0x1,%edx
+80104d10:	d3 e2                	shl    %cl,%edx
+  return (when + slack - 1) & ~(slack - 1);
+80104d12:	8d 44 10 ff          	lea    -0x1(%eax,%edx,1),%eax
+80104d16:	f7 da                	neg    %edx
+80104d18:	21 d0                	and    %edx,%eax
+  p->wakeat = timerDeadline(n);
+80104d1a:	89 83 50 01 00 00    	mov    %eax,0x150(%ebx)
+  timerAdd(p);
+80104d20:	89 d8                	mov    %ebx,%eax
+80104d22:	e8 27 f5 ff ff       	call   8010424e <timerAdd>
+  while(p->timeridx >= 0 && !p->killed)
+80104d27:	8b 83 54 01 00 00    	mov    0x154(%ebx),%eax
+    sleep(&p->wakeat, &ptable.lock);
+80104d2d:	8d b3 50 01 00 00    	lea    0x150(%ebx),%esi
+  while(p->timeridx >= 0 && !p->killed)
+80104d33:	85 c0                	test   %eax,%eax
+80104d35:	78 21                	js     80104d58 <sleepticks+0x87>
+80104d37:	83 7b 24 00          	cmpl   $0x0,0x24(%ebx)
+80104d3b:	75 44                	jne    80104d81 <sleepticks+0xb0>
+    sleep(&p->wakeat, &ptable.lock);
+80104d3d:	83 ec 08             	sub    $0x8,%esp
+80104d40:	68 e0 11 14 80       	push   $0x801411e0
+80104d45:	56                   	push   %esi
+80104d46:	e8 d0 fd ff ff       	call   80104b1b <sleep>
+  while(p->timeridx >= 0 && !p->killed)
+80104d4b:	8b 83 54 01 00 00    	mov    0x154(%ebx),%eax
+80104d51:	83 c4 10             	add    $0x10,%esp
+80104d54:	85 c0                	test   %eax,%eax
+80104d56:	79 df                	jns    80104d37 <sleepticks+0x66>
+  rc = p->killed ? -1 : 0;
+80104d58:	8b 43 24             	mov    0x24(%ebx),%eax
+80104d5b:	f7 d8                	neg    %eax
+80104d5d:	19 db                	sbb    %ebx,%ebx
+  release(&ptable.lock);
+80104d5f:	83 ec 0c             	sub    $0xc,%esp
+80104d62:	68 e0 11 14 80       	push   $0x801411e0
+80104d67:	e8 aa 28 00 00       	call   80107616 <release>
+  return rc;
+80104d6c:	83 c4 10             	add    $0x10,%esp
+}
+80104d6f:	89 d8                	mov    %ebx,%eax
+80104d71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104d74:	5b                   	pop    %ebx
+80104d75:	5e                   	pop    %esi
+80104d76:	5d                   	pop    %ebp
+80104d77:	c3                   	ret
+    return p->killed ? -1 : 0;
+80104d78:	8b 40 24             	mov    0x24(%eax),%eax
+80104d7b:	f7 d8                	neg    %eax
+80104d7d:	19 db                	sbb    %ebx,%ebx
+80104d7f:	eb ee                	jmp    80104d6f <sleepticks+0x9e>
+  if(p->timeridx >= 0)
+80104d81:	85 c0                	test   %eax,%eax
+80104d83:	78 d3                	js     80104d58 <sleepticks+0x87>
+    timerRemove(p);
+80104d85:	89 d8                	mov    %ebx,%eax
+80104d87:	e8 fc f4 ff ff       	call   80104288 <timerRemove>
+80104d8c:	eb ca                	jmp    80104d58 <sleepticks+0x87>
+
+80104d8e <timertick>:
+  if(ptable.ntimers == 0 || (int)(ticks - ptable.nexttimer) < 0)
+80104d8e:	83 3d 28 db 15 80 00 	cmpl   $0x0,0x8015db28
+80104d95:	74 7d                	je     80104e14 <timertick+0x86>
+80104d97:	a1 2c db 15 80       	mov    0x8015db2c,%eax
+80104d9c:	39 05 40 db 15 80    	cmp    %eax,0x8015db40
+80104da2:	78 70                	js     80104e14 <timertick+0x86>
+{
+80104da4:	55                   	push   %ebp
+80104da5:	89 e5                	mov    %esp,%ebp
+80104da7:	53                   	push   %ebx
+80104da8:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80104dab:	68 e0 11 14 80       	push   $0x801411e0
+80104db0:	e8 fa 27 00 00       	call   801075af <acquire>
+  while(ptable.ntimers > 0 &&
+80104db5:	83 c4 10             	add    $0x10,%esp
+80104db8:	83 3d 28 db 15 80 00 	cmpl   $0x0,0x8015db28
+80104dbf:	7f 1e                	jg     80104ddf <timertick+0x51>
+  release(&ptable.lock);
+80104dc1:	83 ec 0c             	sub    $0xc,%esp
+80104dc4:	68 e0 11 14 80       	push   $0x801411e0
+80104dc9:	e8 48 28 00 00       	call   80107616 <release>
+80104dce:	83 c4 10             	add    $0x10,%esp
+}
+80104dd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104dd4:	c9                   	leave
+80104dd5:	c3                   	ret
+  while(ptable.ntimers > 0 &&
+80104dd6:	83 3d 28 db 15 80 00 	cmpl   $0x0,0x8015db28
+80104ddd:	7e e2                	jle    80104dc1 <timertick+0x33>
+        (int)(ticks - (p = ptable.timers[0])->wakeat) >= 0){
+80104ddf:	8b 1d 28 9b 15 80    	mov    0x80159b28,%ebx
+  while(ptable.ntimers > 0 &&
+80104de5:	8b 83 50 01 00 00    	mov    0x150(%ebx),%eax
+80104deb:	39 05 40 db 15 80    	cmp    %eax,0x8015db40
+80104df1:	78 ce                	js     80104dc1 <timertick+0x33>
+    timerRemove(p);
+80104df3:	89 d8                	mov    %ebx,%eax
+80104df5:	e8 8e f4 ff ff       	call   80104288 <timerRemove>
+    if(p->state == SLEEPING && p->chan == &p->wakeat)
+80104dfa:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80104dfe:	75 d6                	jne    80104dd6 <timertick+0x48>
+80104e00:	8d 83 50 01 00 00    	lea    0x150(%ebx),%eax
+80104e06:	39 43 20             	cmp    %eax,0x20(%ebx)
+80104e09:	75 cb                	jne    80104dd6 <timertick+0x48>
+      wakeproc(p);
+80104e0b:	89 d8                	mov    %ebx,%eax
+80104e0d:	e8 b9 f8 ff ff       	call   801046cb <wakeproc>
+80104e12:	eb c2                	jmp    80104dd6 <timertick+0x48>
+80104e14:	c3                   	ret
+
+80104e15 <scheduler>:
+{
+80104e15:	55                   	push   %ebp
+80104e16:	89 e5                	mov    %esp,%ebp
+80104e18:	57                   	push   %edi
+80104e19:	56                   	push   %esi
+80104e1a:	53                   	push   %ebx
+80104e1b:	83 ec 2c             	sub    $0x2c,%esp
+  struct cpu *c = mycpu();
+80104e1e:	e8 b9 f5 ff ff       	call   801043dc <mycpu>
+80104e23:	89 c3                	mov    %eax,%ebx
+  c->proc = 0;
+80104e25:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+80104e2c:	00 00 00 
+  lapicsettimer(1, 1);
+80104e2f:	83 ec 08             	sub    $0x8,%esp
+80104e32:	6a 01                	push   $0x1
+80104e34:	6a 01                	push   $0x1
+80104e36:	e8 f8 dc ff ff       	call   80102b33 <lapicsettimer>
+      p->lastcpu = c - cpus;
+80104e3b:	89 d8                	mov    %ebx,%eax
+80104e3d:	2d 80 f9 13 80       	sub    $0x8013f980,%eax
+80104e42:	c1 f8 06             	sar    $0x6,%eax
+80104e45:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+80104e4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104e4e:	83 c4 10             	add    $0x10,%esp
+80104e51:	e9 e0 00 00 00       	jmp    80104f36 <scheduler+0x121>
+      if(ticks >= ptable.BalanceAtTime){
+80104e56:	ba e0 11 14 80       	mov    $0x801411e0,%edx
+80104e5b:	3b 82 94 04 00 00    	cmp    0x494(%edx),%eax
+80104e61:	0f 83 27 01 00 00    	jae    80104f8e <scheduler+0x179>
+      release(&ptable.lock);
+80104e67:	83 ec 0c             	sub    $0xc,%esp
+80104e6a:	68 e0 11 14 80       	push   $0x801411e0
+80104e6f:	e8 a2 27 00 00       	call   80107616 <release>
+80104e74:	83 c4 10             	add    $0x10,%esp
+    p = dequeue(c->rq, c);
+80104e77:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+80104e7d:	89 da                	mov    %ebx,%edx
+80104e7f:	e8 91 f0 ff ff       	call   80103f15 <dequeue>
+80104e84:	89 c6                	mov    %eax,%esi
+    if(p == 0)
+80104e86:	85 c0                	test   %eax,%eax
+80104e88:	0f 84 44 02 00 00    	je     801050d2 <scheduler+0x2bd>
+      acquire(&ptable.lock);
+80104e8e:	83 ec 0c             	sub    $0xc,%esp
+80104e91:	68 e0 11 14 80       	push   $0x801411e0
+80104e96:	e8 14 27 00 00       	call   801075af <acquire>
+      assertState(p,RUNNABLE);
+80104e9b:	ba 03 00 00 00       	mov    $0x3,%edx
+80104ea0:	89 f0                	mov    %esi,%eax
+80104ea2:	e8 d8 f1 ff ff       	call   8010407f <assertState>
+      c->proc = p;
+80104ea7:	89 b3 ac 00 00 00    	mov    %esi,0xac(%ebx)
+      switchuvm(p);
+80104ead:	89 34 24             	mov    %esi,(%esp)
+80104eb0:	e8 42 51 00 00       	call   80109ff7 <switchuvm>
+      p->cpu_ticks_in = ticks;
+80104eb5:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80104eba:	89 86 dc 00 00 00    	mov    %eax,0xdc(%esi)
+      p->state = RUNNING;
+80104ec0:	c7 46 0c 04 00 00 00 	movl   $0x4,0xc(%esi)
+      stateListAdd(&ptable.list[RUNNING],p);
+80104ec7:	89 f2                	mov    %esi,%edx
+80104ec9:	b8 40 12 14 80       	mov    $0x80141240,%eax
+80104ece:	e8 0c ee ff ff       	call   80103cdf <stateListAdd>
+      p->lastcpu = c - cpus;
+80104ed3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104ed6:	89 86 fc 00 00 00    	mov    %eax,0xfc(%esi)
+      p->needresched = 0;
+80104edc:	c7 86 00 01 00 00 00 	movl   $0x0,0x100(%esi)
+80104ee3:	00 00 00 
+      p->slice = ptable.params.quantum[p->priority];
+80104ee6:	8b 86 ec 00 00 00    	mov    0xec(%esi),%eax
+80104eec:	ba e0 11 14 80       	mov    $0x801411e0,%edx
+80104ef1:	8b 84 82 9c 04 00 00 	mov    0x49c(%edx,%eax,4),%eax
+80104ef8:	89 86 1c 01 00 00    	mov    %eax,0x11c(%esi)
+      p->dl_stamp = ticks;
+80104efe:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80104f03:	89 86 14 01 00 00    	mov    %eax,0x114(%esi)
+      swtch(&(c->scheduler), p->context);
+80104f09:	83 c4 08             	add    $0x8,%esp
+80104f0c:	ff 76 1c             	push   0x1c(%esi)
+80104f0f:	8d 43 04             	lea    0x4(%ebx),%eax
+80104f12:	50                   	push   %eax
+80104f13:	e8 0f 29 00 00       	call   80107827 <swtch>
+      switchkvm();
+80104f18:	e8 be 4f 00 00       	call   80109edb <switchkvm>
+      c->proc = 0;
+80104f1d:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+80104f24:	00 00 00 
+      release(&ptable.lock);
+80104f27:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80104f2e:	e8 e3 26 00 00       	call   80107616 <release>
+    if (idle)
+80104f33:	83 c4 10             	add    $0x10,%esp
+  asm volatile("sti");
+80104f36:	fb                   	sti
+    if(ticks >= ptable.PromoteAtTime || ticks >= ptable.BalanceAtTime){
+80104f37:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80104f3c:	b9 e0 11 14 80       	mov    $0x801411e0,%ecx
+80104f41:	3b 81 90 04 00 00    	cmp    0x490(%ecx),%eax
+80104f47:	73 0c                	jae    80104f55 <scheduler+0x140>
+80104f49:	3b 81 94 04 00 00    	cmp    0x494(%ecx),%eax
+80104f4f:	0f 82 22 ff ff ff    	jb     80104e77 <scheduler+0x62>
+      acquire(&ptable.lock);
+80104f55:	83 ec 0c             	sub    $0xc,%esp
+80104f58:	68 e0 11 14 80       	push   $0x801411e0
+80104f5d:	e8 4d 26 00 00       	call   801075af <acquire>
+      if(ticks >= ptable.PromoteAtTime){
+80104f62:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80104f67:	83 c4 10             	add    $0x10,%esp
+80104f6a:	b9 e0 11 14 80       	mov    $0x801411e0,%ecx
+80104f6f:	3b 81 90 04 00 00    	cmp    0x490(%ecx),%eax
+80104f75:	0f 82 db fe ff ff    	jb     80104e56 <scheduler+0x41>
+        ptable.PromoteAtTime = ticks + ptable.params.promote;
+80104f7b:	89 c2                	mov    %eax,%edx
+80104f7d:	03 91 bc 04 00 00    	add    0x4bc(%ecx),%edx
+80104f83:	89 91 90 04 00 00    	mov    %edx,0x490(%ecx)
+80104f89:	e9 c8 fe ff ff       	jmp    80104e56 <scheduler+0x41>
+  for(int moved = 0; moved < ptable.nproc; moved++){
+80104f8e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+80104f95:	83 7a 3c 00          	cmpl   $0x0,0x3c(%edx)
+80104f99:	7e 46                	jle    80104fe1 <scheduler+0x1cc>
+80104f9b:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+80104f9e:	69 0d 64 f9 13 80 84 	imul   $0x84,0x8013f964,%ecx
+80104fa5:	00 00 00 
+80104fa8:	81 c1 50 12 14 80    	add    $0x80141250,%ecx
+    busiest = idlest = ptable.rq;
+80104fae:	bf 50 12 14 80       	mov    $0x80141250,%edi
+80104fb3:	89 fe                	mov    %edi,%esi
+    for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+80104fb5:	89 f8                	mov    %edi,%eax
+80104fb7:	39 f9                	cmp    %edi,%ecx
+80104fb9:	76 18                	jbe    80104fd3 <scheduler+0x1be>
+      if(rq->nready > busiest->nready)
+80104fbb:	8b 50 70             	mov    0x70(%eax),%edx
+80104fbe:	3b 56 70             	cmp    0x70(%esi),%edx
+80104fc1:	0f 4f f0             	cmovg  %eax,%esi
+      if(rq->nready < idlest->nready)
+80104fc4:	3b 57 70             	cmp    0x70(%edi),%edx
+80104fc7:	0f 4c f8             	cmovl  %eax,%edi
+    for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+80104fca:	05 84 00 00 00       	add    $0x84,%eax
+80104fcf:	39 c8                	cmp    %ecx,%eax
+80104fd1:	72 e8                	jb     80104fbb <scheduler+0x1a6>
+    if(busiest->nready - idlest->nready < 2)
+80104fd3:	8b 46 70             	mov    0x70(%esi),%eax
+80104fd6:	2b 47 70             	sub    0x70(%edi),%eax
+80104fd9:	83 f8 01             	cmp    $0x1,%eax
+80104fdc:	7f 1b                	jg     80104ff9 <scheduler+0x1e4>
+80104fde:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+        ptable.BalanceAtTime = ticks + TICKS_TO_BALANCE;
+80104fe1:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80104fe6:	83 c0 64             	add    $0x64,%eax
+80104fe9:	bf e0 11 14 80       	mov    $0x801411e0,%edi
+80104fee:	89 87 94 04 00 00    	mov    %eax,0x494(%edi)
+80104ff4:	e9 6e fe ff ff       	jmp    80104e67 <scheduler+0x52>
+    acquire(&busiest->lock);
+80104ff9:	89 75 d0             	mov    %esi,-0x30(%ebp)
+80104ffc:	83 ec 0c             	sub    $0xc,%esp
+80104fff:	56                   	push   %esi
+80105000:	e8 aa 25 00 00       	call   801075af <acquire>
+        if(ALLOWED(p, idlest - ptable.rq))
+80105005:	89 f9                	mov    %edi,%ecx
+80105007:	81 e9 50 12 14 80    	sub    $0x80141250,%ecx
+8010500d:	c1 f9 02             	sar    $0x2,%ecx
+80105010:	69 c9 e1 83 0f 3e    	imul   $0x3e0f83e1,%ecx,%ecx
+80105016:	ba 01 00 00 00       	mov    $0x1,%edx
+8010501b:	d3 e2                	shl    %cl,%edx
+8010501d:	8d 46 38             	lea    0x38(%esi),%eax
+80105020:	8d 5e 70             	lea    0x70(%esi),%ebx
+80105023:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+80105026:	83 c4 10             	add    $0x10,%esp
+80105029:	eb 79                	jmp    801050a4 <scheduler+0x28f>
+8010502b:	89 d0                	mov    %edx,%eax
+8010502d:	23 83 f8 00 00 00    	and    0xf8(%ebx),%eax
+80105033:	0f 95 c0             	setne  %al
+80105036:	eb 1c                	jmp    80105054 <scheduler+0x23f>
+      for(p = busiest->ready[i].tail; p != 0; p = p->prev)
+80105038:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+8010503e:	85 db                	test   %ebx,%ebx
+80105040:	74 57                	je     80105099 <scheduler+0x284>
+        if(ALLOWED(p, idlest - ptable.rq))
+80105042:	83 bb 08 01 00 00 00 	cmpl   $0x0,0x108(%ebx)
+80105049:	74 e0                	je     8010502b <scheduler+0x216>
+8010504b:	39 8b 18 01 00 00    	cmp    %ecx,0x118(%ebx)
+80105051:	0f 94 c0             	sete   %al
+80105054:	84 c0                	test   %al,%al
+80105056:	74 e0                	je     80105038 <scheduler+0x223>
+    if(p && readyListRemove(busiest, p) < 0)
+80105058:	89 da                	mov    %ebx,%edx
+8010505a:	89 f0                	mov    %esi,%eax
+8010505c:	e8 33 ed ff ff       	call   80103d94 <readyListRemove>
+80105061:	85 c0                	test   %eax,%eax
+80105063:	78 60                	js     801050c5 <scheduler+0x2b0>
+    release(&busiest->lock);
+80105065:	83 ec 0c             	sub    $0xc,%esp
+80105068:	ff 75 d0             	push   -0x30(%ebp)
+8010506b:	e8 a6 25 00 00       	call   80107616 <release>
+    enqueue(idlest, p);
+80105070:	89 da                	mov    %ebx,%edx
+80105072:	89 f8                	mov    %edi,%eax
+80105074:	e8 e1 f4 ff ff       	call   8010455a <enqueue>
+  for(int moved = 0; moved < ptable.nproc; moved++){
+80105079:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+8010507d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80105080:	83 c4 10             	add    $0x10,%esp
+80105083:	bf e0 11 14 80       	mov    $0x801411e0,%edi
+80105088:	3b 47 3c             	cmp    0x3c(%edi),%eax
+8010508b:	0f 8c 0d ff ff ff    	jl     80104f9e <scheduler+0x189>
+80105091:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80105094:	e9 48 ff ff ff       	jmp    80104fe1 <scheduler+0x1cc>
+80105099:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    for(i = 0; i <= MAXPRIO && p == 0; i++)
+8010509c:	83 c0 08             	add    $0x8,%eax
+8010509f:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+801050a2:	74 0b                	je     801050af <scheduler+0x29a>
+      for(p = busiest->ready[i].tail; p != 0; p = p->prev)
+801050a4:	8b 18                	mov    (%eax),%ebx
+801050a6:	85 db                	test   %ebx,%ebx
+801050a8:	74 f2                	je     8010509c <scheduler+0x287>
+801050aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801050ad:	eb 93                	jmp    80105042 <scheduler+0x22d>
+801050af:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    release(&busiest->lock);
+801050b2:	83 ec 0c             	sub    $0xc,%esp
+801050b5:	ff 75 d0             	push   -0x30(%ebp)
+801050b8:	e8 59 25 00 00       	call   80107616 <release>
+801050bd:	83 c4 10             	add    $0x10,%esp
+801050c0:	e9 1c ff ff ff       	jmp    80104fe1 <scheduler+0x1cc>
+      panic("Error removing from ready list in balanceLists().\n");
+801050c5:	83 ec 0c             	sub    $0xc,%esp
+801050c8:	68 9c b6 10 80       	push   $0x8010b69c
+801050cd:	e8 70 b2 ff ff       	call   80100342 <panic>
+  for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++)
+801050d2:	69 0d 64 f9 13 80 84 	imul   $0x84,0x8013f964,%ecx
+801050d9:	00 00 00 
+801050dc:	81 c1 50 12 14 80    	add    $0x80141250,%ecx
+801050e2:	81 f9 50 12 14 80    	cmp    $0x80141250,%ecx
+801050e8:	76 46                	jbe    80105130 <scheduler+0x31b>
+    if(rq != c->rq && rq->nready > 0 &&
+801050ea:	8b bb b0 00 00 00    	mov    0xb0(%ebx),%edi
+  for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++)
+801050f0:	b8 50 12 14 80       	mov    $0x80141250,%eax
+801050f5:	eb 0b                	jmp    80105102 <scheduler+0x2ed>
+801050f7:	89 c6                	mov    %eax,%esi
+801050f9:	05 84 00 00 00       	add    $0x84,%eax
+801050fe:	39 c8                	cmp    %ecx,%eax
+80105100:	73 17                	jae    80105119 <scheduler+0x304>
+    if(rq != c->rq && rq->nready > 0 &&
+80105102:	39 c7                	cmp    %eax,%edi
+80105104:	74 f3                	je     801050f9 <scheduler+0x2e4>
+80105106:	8b 50 70             	mov    0x70(%eax),%edx
+80105109:	85 d2                	test   %edx,%edx
+8010510b:	7e ec                	jle    801050f9 <scheduler+0x2e4>
+8010510d:	85 f6                	test   %esi,%esi
+8010510f:	74 e6                	je     801050f7 <scheduler+0x2e2>
+80105111:	3b 56 70             	cmp    0x70(%esi),%edx
+80105114:	0f 4f f0             	cmovg  %eax,%esi
+80105117:	eb e0                	jmp    801050f9 <scheduler+0x2e4>
+  if(victim == 0)
+80105119:	85 f6                	test   %esi,%esi
+8010511b:	74 13                	je     80105130 <scheduler+0x31b>
+  return dequeue(victim, c);
+8010511d:	89 da                	mov    %ebx,%edx
+8010511f:	89 f0                	mov    %esi,%eax
+80105121:	e8 ef ed ff ff       	call   80103f15 <dequeue>
+80105126:	89 c6                	mov    %eax,%esi
+    if(p != 0) {
+80105128:	85 c0                	test   %eax,%eax
+8010512a:	0f 85 5e fd ff ff    	jne    80104e8e <scheduler+0x79>
+  asm volatile("cli");
+80105130:	fa                   	cli
+  c->halted = 1;
+80105131:	c7 83 b4 00 00 00 01 	movl   $0x1,0xb4(%ebx)
+80105138:	00 00 00 
+  __sync_synchronize();
+8010513b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(c->rq->nready == 0){
+80105140:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+80105146:	83 78 70 00          	cmpl   $0x0,0x70(%eax)
+8010514a:	74 10                	je     8010515c <scheduler+0x347>
+  c->halted = 0;
+8010514c:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+80105153:	00 00 00 
+  asm volatile("sti");
+80105156:	fb                   	sti
+}
+80105157:	e9 da fd ff ff       	jmp    80104f36 <scheduler+0x121>
+  c->tickless = 1;
+8010515c:	c7 83 b8 00 00 00 01 	movl   $0x1,0xb8(%ebx)
+80105163:	00 00 00 
+  __sync_synchronize();
+80105166:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  for(other = cpus; other < &cpus[ncpu]; other++)
+8010516b:	a1 64 f9 13 80       	mov    0x8013f964,%eax
+80105170:	8d 14 40             	lea    (%eax,%eax,2),%edx
+80105173:	c1 e2 06             	shl    $0x6,%edx
+80105176:	81 c2 80 f9 13 80    	add    $0x8013f980,%edx
+8010517c:	81 fa 80 f9 13 80    	cmp    $0x8013f980,%edx
+80105182:	0f 86 49 01 00 00    	jbe    801052d1 <scheduler+0x4bc>
+80105188:	b8 80 f9 13 80       	mov    $0x8013f980,%eax
+8010518d:	eb 0d                	jmp    8010519c <scheduler+0x387>
+8010518f:	05 c0 00 00 00       	add    $0xc0,%eax
+80105194:	39 d0                	cmp    %edx,%eax
+80105196:	0f 83 ab 00 00 00    	jae    80105247 <scheduler+0x432>
+    if(other != c && other->rq->nready > 0)
+8010519c:	39 c3                	cmp    %eax,%ebx
+8010519e:	74 ef                	je     8010518f <scheduler+0x37a>
+801051a0:	8b 88 b0 00 00 00    	mov    0xb0(%eax),%ecx
+801051a6:	83 79 70 00          	cmpl   $0x0,0x70(%ecx)
+801051aa:	7e e3                	jle    8010518f <scheduler+0x37a>
+  if(other < &cpus[ncpu]){
+801051ac:	39 d0                	cmp    %edx,%eax
+801051ae:	0f 83 93 00 00 00    	jae    80105247 <scheduler+0x432>
+    c->tickless = 0;
+801051b4:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+801051bb:	00 00 00 
+801051be:	fb                   	sti
+
+// hlt() added by Noah Zentzis, Fall 2016.
+static inline void
+hlt()
+{
+  asm volatile("hlt");
+801051bf:	f4                   	hlt
+  asm volatile("cli");
+801051c0:	fa                   	cli
+    return;
+801051c1:	eb 89                	jmp    8010514c <scheduler+0x337>
+  if(c == &cpus[0]){
+801051c3:	b8 80 f9 13 80       	mov    $0x8013f980,%eax
+      if(!other->halted)
+801051c8:	8b 88 b4 00 00 00    	mov    0xb4(%eax),%ecx
+801051ce:	85 c9                	test   %ecx,%ecx
+801051d0:	74 09                	je     801051db <scheduler+0x3c6>
+    for(other = cpus; other < &cpus[ncpu]; other++)
+801051d2:	05 c0 00 00 00       	add    $0xc0,%eax
+801051d7:	39 d0                	cmp    %edx,%eax
+801051d9:	72 ed                	jb     801051c8 <scheduler+0x3b3>
+  uint n = TICKLESS_MAXIDLE;
+801051db:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    if(ptable.ntimers){
+801051e0:	83 3d 28 db 15 80 00 	cmpl   $0x0,0x8015db28
+801051e7:	75 42                	jne    8010522b <scheduler+0x416>
+    if(other < &cpus[ncpu] || n == 0){
+801051e9:	39 d0                	cmp    %edx,%eax
+801051eb:	73 6b                	jae    80105258 <scheduler+0x443>
+      c->tickless = 0;
+801051ed:	c7 05 38 fa 13 80 00 	movl   $0x0,0x8013fa38
+801051f4:	00 00 00 
+  asm volatile("sti");
+801051f7:	fb                   	sti
+801051f8:	f4                   	hlt
+  asm volatile("cli");
+801051f9:	fa                   	cli
+      return;
+801051fa:	e9 4d ff ff ff       	jmp    8010514c <scheduler+0x337>
+    if(elapsed){
+801051ff:	85 f6                	test   %esi,%esi
+80105201:	0f 84 45 ff ff ff    	je     8010514c <scheduler+0x337>
+}
+
+static inline void
+atom_add(volatile int *num, int n)
+{
+  asm volatile("lock addl %1, %0" : "+m" (*num) : "ir" (n));
+80105207:	f0 01 35 40 db 15 80 	lock add %esi,0x8015db40
+      timertick();
+8010520e:	e8 7b fb ff ff       	call   80104d8e <timertick>
+80105213:	e9 34 ff ff ff       	jmp    8010514c <scheduler+0x337>
+  uint n = TICKLESS_MAXIDLE;
+80105218:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    if(ptable.ntimers){
+8010521d:	83 3d 28 db 15 80 00 	cmpl   $0x0,0x8015db28
+80105224:	74 32                	je     80105258 <scheduler+0x443>
+    for(other = cpus; other < &cpus[ncpu]; other++)
+80105226:	b8 80 f9 13 80       	mov    $0x8013f980,%eax
+      left = ptable.nexttimer - ticks;
+8010522b:	8b 0d 2c db 15 80    	mov    0x8015db2c,%ecx
+80105231:	2b 0d 40 db 15 80    	sub    0x8015db40,%ecx
+      if(left <= 0)
+80105237:	85 c9                	test   %ecx,%ecx
+80105239:	7e b2                	jle    801051ed <scheduler+0x3d8>
+      else if((uint)left < n)
+8010523b:	be e8 03 00 00       	mov    $0x3e8,%esi
+80105240:	39 f1                	cmp    %esi,%ecx
+80105242:	0f 47 ce             	cmova  %esi,%ecx
+80105245:	eb a2                	jmp    801051e9 <scheduler+0x3d4>
+  uint n = TICKLESS_MAXIDLE;
+80105247:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+  if(c == &cpus[0]){
+8010524c:	81 fb 80 f9 13 80    	cmp    $0x8013f980,%ebx
+80105252:	0f 84 6b ff ff ff    	je     801051c3 <scheduler+0x3ae>
+  lapicsettimer(n, 0);
+80105258:	83 ec 08             	sub    $0x8,%esp
+8010525b:	6a 00                	push   $0x0
+8010525d:	51                   	push   %ecx
+8010525e:	e8 d0 d8 ff ff       	call   80102b33 <lapicsettimer>
+  asm volatile("sti");
+80105263:	fb                   	sti
+  asm volatile("hlt");
+80105264:	f4                   	hlt
+  asm volatile("cli");
+80105265:	fa                   	cli
+  c->tickless = 0;
+80105266:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+8010526d:	00 00 00 
+  elapsed = lapicelapsed(&c->tickfrac);
+80105270:	8d 83 bc 00 00 00    	lea    0xbc(%ebx),%eax
+80105276:	89 04 24             	mov    %eax,(%esp)
+80105279:	e8 05 d9 ff ff       	call   80102b83 <lapicelapsed>
+8010527e:	89 c6                	mov    %eax,%esi
+  lapicsettimer(1, 1);
+80105280:	83 c4 08             	add    $0x8,%esp
+80105283:	6a 01                	push   $0x1
+80105285:	6a 01                	push   $0x1
+80105287:	e8 a7 d8 ff ff       	call   80102b33 <lapicsettimer>
+  if(c == &cpus[0]){
+8010528c:	83 c4 10             	add    $0x10,%esp
+8010528f:	81 fb 80 f9 13 80    	cmp    $0x8013f980,%ebx
+80105295:	0f 84 64 ff ff ff    	je     801051ff <scheduler+0x3ea>
+    c->halted = 0;
+8010529b:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+801052a2:	00 00 00 
+    __sync_synchronize();
+801052a5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if(cpus[0].tickless)
+801052aa:	a1 38 fa 13 80       	mov    0x8013fa38,%eax
+801052af:	85 c0                	test   %eax,%eax
+801052b1:	0f 84 95 fe ff ff    	je     8010514c <scheduler+0x337>
+      lapicipi(cpus[0].apicid, T_IRQ0 + IRQ_RESCHED);
+801052b7:	83 ec 08             	sub    $0x8,%esp
+801052ba:	6a 3e                	push   $0x3e
+801052bc:	0f b6 05 80 f9 13 80 	movzbl 0x8013f980,%eax
+801052c3:	50                   	push   %eax
+801052c4:	e8 13 d9 ff ff       	call   80102bdc <lapicipi>
+801052c9:	83 c4 10             	add    $0x10,%esp
+801052cc:	e9 7b fe ff ff       	jmp    8010514c <scheduler+0x337>
+  if(c == &cpus[0]){
+801052d1:	81 fb 80 f9 13 80    	cmp    $0x8013f980,%ebx
+801052d7:	0f 84 3b ff ff ff    	je     80105218 <scheduler+0x403>
+  uint n = TICKLESS_MAXIDLE;
+801052dd:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+801052e2:	e9 71 ff ff ff       	jmp    80105258 <scheduler+0x443>
+
+801052e7 <kill>:
+{
+801052e7:	55                   	push   %ebp
+801052e8:	89 e5                	mov    %esp,%ebp
+801052ea:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+801052ed:	68 e0 11 14 80       	push   $0x801411e0
+801052f2:	e8 b8 22 00 00       	call   801075af <acquire>
+  p = findproc(pid);
+801052f7:	8b 45 08             	mov    0x8(%ebp),%eax
+801052fa:	e8 1e e9 ff ff       	call   80103c1d <findproc>
+  if(p == 0){
+801052ff:	83 c4 10             	add    $0x10,%esp
+80105302:	85 c0                	test   %eax,%eax
+80105304:	74 24                	je     8010532a <kill+0x43>
+  p->killed = 1;
+80105306:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+  if(p->state == SLEEPING)
+8010530d:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+80105311:	74 2e                	je     80105341 <kill+0x5a>
+  release(&ptable.lock);
+80105313:	83 ec 0c             	sub    $0xc,%esp
+80105316:	68 e0 11 14 80       	push   $0x801411e0
+8010531b:	e8 f6 22 00 00       	call   80107616 <release>
+  return 0;
+80105320:	83 c4 10             	add    $0x10,%esp
+80105323:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105328:	c9                   	leave
+80105329:	c3                   	ret
+    release(&ptable.lock);
+8010532a:	83 ec 0c             	sub    $0xc,%esp
+8010532d:	68 e0 11 14 80       	push   $0x801411e0
+80105332:	e8 df 22 00 00       	call   80107616 <release>
+    return -1;
+80105337:	83 c4 10             	add    $0x10,%esp
+8010533a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010533f:	eb e7                	jmp    80105328 <kill+0x41>
+    wakeproc(p);
+80105341:	e8 85 f3 ff ff       	call   801046cb <wakeproc>
+80105346:	eb cb                	jmp    80105313 <kill+0x2c>
+
+80105348 <procdumpP4>:
+procdumpP4(struct proc *p,char *state){
+80105348:	55                   	push   %ebp
+80105349:	89 e5                	mov    %esp,%ebp
+8010534b:	53                   	push   %ebx
+8010534c:	83 ec 04             	sub    $0x4,%esp
+8010534f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  return owedpriority(p->priority, p->epoch, ptable.epoch);
+80105352:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+  uint owed = epoch - pepoch;
+80105358:	8b 15 78 16 14 80    	mov    0x80141678,%edx
+8010535e:	2b 93 f4 00 00 00    	sub    0xf4(%ebx),%edx
+  if(owed >= MAXPRIO - priority)
+80105364:	b9 06 00 00 00       	mov    $0x6,%ecx
+80105369:	29 c1                	sub    %eax,%ecx
+  return priority + owed;
+8010536b:	01 d0                	add    %edx,%eax
+8010536d:	39 ca                	cmp    %ecx,%edx
+8010536f:	ba 06 00 00 00       	mov    $0x6,%edx
+80105374:	0f 43 c2             	cmovae %edx,%eax
+  cprintf("%d\t%s\t\t%d\t%d\t%d\t%d\t",p->pid,p->name,p->uid,p->gid,p->parent ? p->parent->pid : p->pid,curpriority(p));
+80105377:	8b 53 14             	mov    0x14(%ebx),%edx
+8010537a:	85 d2                	test   %edx,%edx
+8010537c:	0f 84 b4 00 00 00    	je     80105436 <procdumpP4+0xee>
+80105382:	8b 52 10             	mov    0x10(%edx),%edx
+80105385:	83 ec 04             	sub    $0x4,%esp
+80105388:	50                   	push   %eax
+80105389:	52                   	push   %edx
+8010538a:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+80105390:	ff b3 d0 00 00 00    	push   0xd0(%ebx)
+80105396:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80105399:	50                   	push   %eax
+8010539a:	ff 73 10             	push   0x10(%ebx)
+8010539d:	68 b8 b3 10 80       	push   $0x8010b3b8
+801053a2:	e8 5d b2 ff ff       	call   80100604 <cprintf>
+  s  = (ticks - p->start_ticks) / 1000;
+801053a7:	8b 0d 40 db 15 80    	mov    0x8015db40,%ecx
+801053ad:	2b 8b cc 00 00 00    	sub    0xcc(%ebx),%ecx
+801053b3:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+801053b8:	89 c8                	mov    %ecx,%eax
+801053ba:	f7 e2                	mul    %edx
+801053bc:	c1 ea 06             	shr    $0x6,%edx
+  ms = (ticks - p->start_ticks) % 1000;
+801053bf:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+801053c5:	29 c1                	sub    %eax,%ecx
+  if(ms >= 100)
+801053c7:	83 c4 20             	add    $0x20,%esp
+801053ca:	83 f9 63             	cmp    $0x63,%ecx
+801053cd:	77 6f                	ja     8010543e <procdumpP4+0xf6>
+  else if(ms < 11)
+801053cf:	83 f9 0a             	cmp    $0xa,%ecx
+801053d2:	77 7e                	ja     80105452 <procdumpP4+0x10a>
+     cprintf("%d.00%d\t",s,ms);
+801053d4:	83 ec 04             	sub    $0x4,%esp
+801053d7:	51                   	push   %ecx
+801053d8:	52                   	push   %edx
+801053d9:	68 d3 b3 10 80       	push   $0x8010b3d3
+801053de:	e8 21 b2 ff ff       	call   80100604 <cprintf>
+801053e3:	83 c4 10             	add    $0x10,%esp
+  s  = p->cpu_ticks_total / 1000;
+801053e6:	8b 8b d8 00 00 00    	mov    0xd8(%ebx),%ecx
+801053ec:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+801053f1:	89 c8                	mov    %ecx,%eax
+801053f3:	f7 e2                	mul    %edx
+801053f5:	c1 ea 06             	shr    $0x6,%edx
+  ms = p->cpu_ticks_total % 1000;
+801053f8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+801053fe:	29 c1                	sub    %eax,%ecx
+  if(ms >= 100)
+80105400:	83 f9 63             	cmp    $0x63,%ecx
+80105403:	77 61                	ja     80105466 <procdumpP4+0x11e>
+  else if(ms < 10)
+80105405:	83 f9 09             	cmp    $0x9,%ecx
+80105408:	77 70                	ja     8010547a <procdumpP4+0x132>
+     cprintf("%d.00%d\t",s,ms);
+8010540a:	83 ec 04             	sub    $0x4,%esp
+8010540d:	51                   	push   %ecx
+8010540e:	52                   	push   %edx
+8010540f:	68 d3 b3 10 80       	push   $0x8010b3d3
+80105414:	e8 eb b1 ff ff       	call   80100604 <cprintf>
+80105419:	83 c4 10             	add    $0x10,%esp
+  cprintf("%s\t%d\t",state,p->sz);
+8010541c:	83 ec 04             	sub    $0x4,%esp
+8010541f:	ff 33                	push   (%ebx)
+80105421:	ff 75 0c             	push   0xc(%ebp)
+80105424:	68 e4 b3 10 80       	push   $0x8010b3e4
+80105429:	e8 d6 b1 ff ff       	call   80100604 <cprintf>
+}
+8010542e:	83 c4 10             	add    $0x10,%esp
+80105431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105434:	c9                   	leave
+80105435:	c3                   	ret
+  cprintf("%d\t%s\t\t%d\t%d\t%d\t%d\t",p->pid,p->name,p->uid,p->gid,p->parent ? p->parent->pid : p->pid,curpriority(p));
+80105436:	8b 53 10             	mov    0x10(%ebx),%edx
+80105439:	e9 47 ff ff ff       	jmp    80105385 <procdumpP4+0x3d>
+     cprintf("%d.%d\t",s,ms);
+8010543e:	83 ec 04             	sub    $0x4,%esp
+80105441:	51                   	push   %ecx
+80105442:	52                   	push   %edx
+80105443:	68 cc b3 10 80       	push   $0x8010b3cc
+80105448:	e8 b7 b1 ff ff       	call   80100604 <cprintf>
+8010544d:	83 c4 10             	add    $0x10,%esp
+80105450:	eb 94                	jmp    801053e6 <procdumpP4+0x9e>
+     cprintf("%d.0%d\t",s,ms);
+80105452:	83 ec 04             	sub    $0x4,%esp
+80105455:	51                   	push   %ecx
+80105456:	52                   	push   %edx
+80105457:	68 dc b3 10 80       	push   $0x8010b3dc
+8010545c:	e8 a3 b1 ff ff       	call   80100604 <cprintf>
+80105461:	83 c4 10             	add    $0x10,%esp
+80105464:	eb 80                	jmp    801053e6 <procdumpP4+0x9e>
+     cprintf("%d.%d\t",s,ms);
+80105466:	83 ec 04             	sub    $0x4,%esp
+80105469:	51                   	push   %ecx
+8010546a:	52                   	push   %edx
+8010546b:	68 cc b3 10 80       	push   $0x8010b3cc
+80105470:	e8 8f b1 ff ff       	call   80100604 <cprintf>
+80105475:	83 c4 10             	add    $0x10,%esp
+80105478:	eb a2                	jmp    8010541c <procdumpP4+0xd4>
+     cprintf("%d.0%d\t",s,ms);
+8010547a:	83 ec 04             	sub    $0x4,%esp
+8010547d:	51                   	push   %ecx
+8010547e:	52                   	push   %edx
+8010547f:	68 dc b3 10 80       	push   $0x8010b3dc
+80105484:	e8 7b b1 ff ff       	call   80100604 <cprintf>
+80105489:	83 c4 10             	add    $0x10,%esp
+8010548c:	eb 8e                	jmp    8010541c <procdumpP4+0xd4>
+
+8010548e <procdump>:
+{
+8010548e:	55                   	push   %ebp
+8010548f:	89 e5                	mov    %esp,%ebp
+80105491:	57                   	push   %edi
+80105492:	56                   	push   %esi
+80105493:	53                   	push   %ebx
+80105494:	83 ec 48             	sub    $0x48,%esp
+  cprintf(HEADER);
+80105497:	68 d0 b6 10 80       	push   $0x8010b6d0
+8010549c:	e8 63 b1 ff ff       	call   80100604 <cprintf>
+  for(p = ptable.all; p != 0; p = p->allnext){
+801054a1:	8b 1d 14 12 14 80    	mov    0x80141214,%ebx
+801054a7:	83 c4 10             	add    $0x10,%esp
+801054aa:	85 db                	test   %ebx,%ebx
+801054ac:	75 35                	jne    801054e3 <procdump+0x55>
+}
+801054ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801054b1:	5b                   	pop    %ebx
+801054b2:	5e                   	pop    %esi
+801054b3:	5f                   	pop    %edi
+801054b4:	5d                   	pop    %ebp
+801054b5:	c3                   	ret
+    procdumpP4(p,state);
+801054b6:	83 ec 08             	sub    $0x8,%esp
+801054b9:	52                   	push   %edx
+801054ba:	53                   	push   %ebx
+801054bb:	e8 88 fe ff ff       	call   80105348 <procdumpP4>
+    if(p->state == SLEEPING){
+801054c0:	83 c4 10             	add    $0x10,%esp
+801054c3:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+801054c7:	74 3e                	je     80105507 <procdump+0x79>
+    cprintf("\n");
+801054c9:	83 ec 0c             	sub    $0xc,%esp
+801054cc:	68 a9 b4 10 80       	push   $0x8010b4a9
+801054d1:	e8 2e b1 ff ff       	call   80100604 <cprintf>
+801054d6:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.all; p != 0; p = p->allnext){
+801054d9:	8b 9b 20 01 00 00    	mov    0x120(%ebx),%ebx
+801054df:	85 db                	test   %ebx,%ebx
+801054e1:	74 cb                	je     801054ae <procdump+0x20>
+    if(p->state == UNUSED)
+801054e3:	8b 43 0c             	mov    0xc(%ebx),%eax
+801054e6:	85 c0                	test   %eax,%eax
+801054e8:	74 ef                	je     801054d9 <procdump+0x4b>
+      state = "???";
+801054ea:	ba eb b3 10 80       	mov    $0x8010b3eb,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801054ef:	83 f8 05             	cmp    $0x5,%eax
+801054f2:	77 c2                	ja     801054b6 <procdump+0x28>
+801054f4:	8b 14 85 ec b8 10 80 	mov    -0x7fef4714(,%eax,4),%edx
+      state = "???";
+801054fb:	85 d2                	test   %edx,%edx
+801054fd:	b8 eb b3 10 80       	mov    $0x8010b3eb,%eax
+80105502:	0f 44 d0             	cmove  %eax,%edx
+80105505:	eb af                	jmp    801054b6 <procdump+0x28>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80105507:	83 ec 08             	sub    $0x8,%esp
+8010550a:	8d 75 c0             	lea    -0x40(%ebp),%esi
+8010550d:	56                   	push   %esi
+8010550e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80105511:	8b 40 0c             	mov    0xc(%eax),%eax
+80105514:	83 c0 08             	add    $0x8,%eax
+80105517:	50                   	push   %eax
+80105518:	e8 62 1f 00 00       	call   8010747f <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010551d:	8d 7d e8             	lea    -0x18(%ebp),%edi
+80105520:	83 c4 10             	add    $0x10,%esp
+80105523:	8b 06                	mov    (%esi),%eax
+80105525:	85 c0                	test   %eax,%eax
+80105527:	74 a0                	je     801054c9 <procdump+0x3b>
+        cprintf(" %p", pc[i]);
+80105529:	83 ec 08             	sub    $0x8,%esp
+8010552c:	50                   	push   %eax
+8010552d:	68 a1 ad 10 80       	push   $0x8010ada1
+80105532:	e8 cd b0 ff ff       	call   80100604 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80105537:	83 c6 04             	add    $0x4,%esi
+8010553a:	83 c4 10             	add    $0x10,%esp
+8010553d:	39 fe                	cmp    %edi,%esi
+8010553f:	75 e2                	jne    80105523 <procdump+0x95>
+80105541:	eb 86                	jmp    801054c9 <procdump+0x3b>
+
+80105543 <setpriority>:
+{
+80105543:	55                   	push   %ebp
+80105544:	89 e5                	mov    %esp,%ebp
+80105546:	57                   	push   %edi
+80105547:	56                   	push   %esi
+80105548:	53                   	push   %ebx
+80105549:	83 ec 0c             	sub    $0xc,%esp
+8010554c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010554f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(pid < 0 || priority < 0 || priority > MAXPRIO)
+80105552:	85 db                	test   %ebx,%ebx
+80105554:	0f 88 c7 00 00 00    	js     80105621 <setpriority+0xde>
+8010555a:	83 ff 06             	cmp    $0x6,%edi
+8010555d:	0f 87 be 00 00 00    	ja     80105621 <setpriority+0xde>
+  acquire(&ptable.lock);
+80105563:	83 ec 0c             	sub    $0xc,%esp
+80105566:	68 e0 11 14 80       	push   $0x801411e0
+8010556b:	e8 3f 20 00 00       	call   801075af <acquire>
+  p = findproc(pid);
+80105570:	89 d8                	mov    %ebx,%eax
+80105572:	e8 a6 e6 ff ff       	call   80103c1d <findproc>
+80105577:	89 c3                	mov    %eax,%ebx
+  if(p == 0){
+80105579:	83 c4 10             	add    $0x10,%esp
+8010557c:	85 c0                	test   %eax,%eax
+8010557e:	74 6a                	je     801055ea <setpriority+0xa7>
+  rq = p->rq;
+80105580:	8b b0 30 01 00 00    	mov    0x130(%eax),%esi
+  if(rq){
+80105586:	85 f6                	test   %esi,%esi
+80105588:	0f 84 80 00 00 00    	je     8010560e <setpriority+0xcb>
+    acquire(&rq->lock);
+8010558e:	83 ec 0c             	sub    $0xc,%esp
+80105591:	56                   	push   %esi
+80105592:	e8 18 20 00 00       	call   801075af <acquire>
+    if(readyListRemove(rq, p) < 0)
+80105597:	89 da                	mov    %ebx,%edx
+80105599:	89 f0                	mov    %esi,%eax
+8010559b:	e8 f4 e7 ff ff       	call   80103d94 <readyListRemove>
+801055a0:	83 c4 10             	add    $0x10,%esp
+801055a3:	85 c0                	test   %eax,%eax
+801055a5:	78 5a                	js     80105601 <setpriority+0xbe>
+    p->priority = priority;
+801055a7:	89 bb ec 00 00 00    	mov    %edi,0xec(%ebx)
+    readyListAdd(rq, p);
+801055ad:	89 da                	mov    %ebx,%edx
+801055af:	89 f0                	mov    %esi,%eax
+801055b1:	e8 fb ea ff ff       	call   801040b1 <readyListAdd>
+    release(&rq->lock);
+801055b6:	83 ec 0c             	sub    $0xc,%esp
+801055b9:	56                   	push   %esi
+801055ba:	e8 57 20 00 00       	call   80107616 <release>
+801055bf:	83 c4 10             	add    $0x10,%esp
+  p->budget = ptable.params.budget;
+801055c2:	a1 98 16 14 80       	mov    0x80141698,%eax
+801055c7:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+  release(&ptable.lock);
+801055cd:	83 ec 0c             	sub    $0xc,%esp
+801055d0:	68 e0 11 14 80       	push   $0x801411e0
+801055d5:	e8 3c 20 00 00       	call   80107616 <release>
+  return 0;
+801055da:	83 c4 10             	add    $0x10,%esp
+801055dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801055e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801055e5:	5b                   	pop    %ebx
+801055e6:	5e                   	pop    %esi
+801055e7:	5f                   	pop    %edi
+801055e8:	5d                   	pop    %ebp
+801055e9:	c3                   	ret
+    release(&ptable.lock);
+801055ea:	83 ec 0c             	sub    $0xc,%esp
+801055ed:	68 e0 11 14 80       	push   $0x801411e0
+801055f2:	e8 1f 20 00 00       	call   80107616 <release>
+    return -1;
+801055f7:	83 c4 10             	add    $0x10,%esp
+801055fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801055ff:	eb e1                	jmp    801055e2 <setpriority+0x9f>
+      panic("Error removing from ready list in setpriority().\n");
+80105601:	83 ec 0c             	sub    $0xc,%esp
+80105604:	68 0c b7 10 80       	push   $0x8010b70c
+80105609:	e8 34 ad ff ff       	call   80100342 <panic>
+    p->priority = priority;
+8010560e:	89 b8 ec 00 00 00    	mov    %edi,0xec(%eax)
+    p->epoch = ptable.epoch;  // Forget any promotions owed
+80105614:	a1 78 16 14 80       	mov    0x80141678,%eax
+80105619:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+8010561f:	eb a1                	jmp    801055c2 <setpriority+0x7f>
+    return -1;
+80105621:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105626:	eb ba                	jmp    801055e2 <setpriority+0x9f>
+
+80105628 <getpriority>:
+{
+80105628:	55                   	push   %ebp
+80105629:	89 e5                	mov    %esp,%ebp
+8010562b:	53                   	push   %ebx
+8010562c:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+8010562f:	68 e0 11 14 80       	push   $0x801411e0
+80105634:	e8 76 1f 00 00       	call   801075af <acquire>
+  p = findproc(pid);
+80105639:	8b 45 08             	mov    0x8(%ebp),%eax
+8010563c:	e8 dc e5 ff ff       	call   80103c1d <findproc>
+  if(p == 0){
+80105641:	83 c4 10             	add    $0x10,%esp
+80105644:	85 c0                	test   %eax,%eax
+80105646:	74 40                	je     80105688 <getpriority+0x60>
+  return owedpriority(p->priority, p->epoch, ptable.epoch);
+80105648:	8b 90 ec 00 00 00    	mov    0xec(%eax),%edx
+  uint owed = epoch - pepoch;
+8010564e:	8b 0d 78 16 14 80    	mov    0x80141678,%ecx
+80105654:	2b 88 f4 00 00 00    	sub    0xf4(%eax),%ecx
+8010565a:	89 c8                	mov    %ecx,%eax
+  if(owed >= MAXPRIO - priority)
+8010565c:	b9 06 00 00 00       	mov    $0x6,%ecx
+80105661:	29 d1                	sub    %edx,%ecx
+  return priority + owed;
+80105663:	01 c2                	add    %eax,%edx
+80105665:	39 c8                	cmp    %ecx,%eax
+  priority = curpriority(p);
+80105667:	b8 06 00 00 00       	mov    $0x6,%eax
+8010566c:	0f 42 c2             	cmovb  %edx,%eax
+8010566f:	89 c3                	mov    %eax,%ebx
+  release(&ptable.lock);
+80105671:	83 ec 0c             	sub    $0xc,%esp
+80105674:	68 e0 11 14 80       	push   $0x801411e0
+80105679:	e8 98 1f 00 00       	call   80107616 <release>
+  return priority;
+8010567e:	83 c4 10             	add    $0x10,%esp
+}
+80105681:	89 d8                	mov    %ebx,%eax
+80105683:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105686:	c9                   	leave
+80105687:	c3                   	ret
+    release(&ptable.lock);
+80105688:	83 ec 0c             	sub    $0xc,%esp
+8010568b:	68 e0 11 14 80       	push   $0x801411e0
+80105690:	e8 81 1f 00 00       	call   80107616 <release>
+    return -1;
+80105695:	83 c4 10             	add    $0x10,%esp
+80105698:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010569d:	eb e2                	jmp    80105681 <getpriority+0x59>
+
+8010569f <setdeadline>:
+{
+8010569f:	55                   	push   %ebp
+801056a0:	89 e5                	mov    %esp,%ebp
+801056a2:	57                   	push   %edi
+801056a3:	56                   	push   %esi
+801056a4:	53                   	push   %ebx
+801056a5:	83 ec 28             	sub    $0x28,%esp
+  acquire(&ptable.lock);
+801056a8:	68 e0 11 14 80       	push   $0x801411e0
+801056ad:	e8 fd 1e 00 00       	call   801075af <acquire>
+  p = findproc(pid);
+801056b2:	8b 45 08             	mov    0x8(%ebp),%eax
+801056b5:	e8 63 e5 ff ff       	call   80103c1d <findproc>
+  if(p == 0){
+801056ba:	83 c4 10             	add    $0x10,%esp
+801056bd:	85 c0                	test   %eax,%eax
+801056bf:	0f 84 95 00 00 00    	je     8010575a <setdeadline+0xbb>
+801056c5:	89 c3                	mov    %eax,%ebx
+  old = p->dl_period ? EDFUTIL(p->dl_runtime, p->dl_period) : 0;
+801056c7:	8b 88 08 01 00 00    	mov    0x108(%eax),%ecx
+801056cd:	85 c9                	test   %ecx,%ecx
+801056cf:	0f 84 3d 02 00 00    	je     80105912 <setdeadline+0x273>
+801056d5:	69 80 04 01 00 00 e8 	imul   $0x3e8,0x104(%eax),%eax
+801056dc:	03 00 00 
+801056df:	8d 74 01 ff          	lea    -0x1(%ecx,%eax,1),%esi
+801056e3:	89 f0                	mov    %esi,%eax
+801056e5:	ba 00 00 00 00       	mov    $0x0,%edx
+801056ea:	f7 f1                	div    %ecx
+801056ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  new = period ? EDFUTIL(runtime, period) : 0;
+801056ef:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+801056f3:	0f 84 25 02 00 00    	je     8010591e <setdeadline+0x27f>
+801056f9:	69 45 0c e8 03 00 00 	imul   $0x3e8,0xc(%ebp),%eax
+80105700:	8b 7d 10             	mov    0x10(%ebp),%edi
+80105703:	8d 44 07 ff          	lea    -0x1(%edi,%eax,1),%eax
+80105707:	ba 00 00 00 00       	mov    $0x0,%edx
+8010570c:	f7 f7                	div    %edi
+8010570e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(old)
+80105711:	39 ce                	cmp    %ecx,%esi
+80105713:	72 13                	jb     80105728 <setdeadline+0x89>
+    ptable.rq[p->dl_cpu].edfutil -= old;
+80105715:	69 83 18 01 00 00 84 	imul   $0x84,0x118(%ebx),%eax
+8010571c:	00 00 00 
+8010571f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80105722:	29 b0 d0 12 14 80    	sub    %esi,-0x7febed30(%eax)
+  if(new){
+80105728:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+8010572c:	0f 84 6d 01 00 00    	je     8010589f <setdeadline+0x200>
+    for(i = 0; i < ncpu; i++)
+80105732:	8b 3d 64 f9 13 80    	mov    0x8013f964,%edi
+80105738:	85 ff                	test   %edi,%edi
+8010573a:	0f 8e 27 01 00 00    	jle    80105867 <setdeadline+0x1c8>
+      if((p->affinity & (1U << i)) &&
+80105740:	8b 93 f8 00 00 00    	mov    0xf8(%ebx),%edx
+80105746:	b8 d0 12 14 80       	mov    $0x801412d0,%eax
+  int i, best = -1;
+8010574b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    for(i = 0; i < ncpu; i++)
+80105750:	b9 00 00 00 00       	mov    $0x0,%ecx
+      if((p->affinity & (1U << i)) &&
+80105755:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+80105758:	eb 28                	jmp    80105782 <setdeadline+0xe3>
+    release(&ptable.lock);
+8010575a:	83 ec 0c             	sub    $0xc,%esp
+8010575d:	68 e0 11 14 80       	push   $0x801411e0
+80105762:	e8 af 1e 00 00       	call   80107616 <release>
+    return -1;
+80105767:	83 c4 10             	add    $0x10,%esp
+8010576a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010576f:	e9 eb 00 00 00       	jmp    8010585f <setdeadline+0x1c0>
+80105774:	89 ce                	mov    %ecx,%esi
+    for(i = 0; i < ncpu; i++)
+80105776:	83 c1 01             	add    $0x1,%ecx
+80105779:	05 84 00 00 00       	add    $0x84,%eax
+8010577e:	39 f9                	cmp    %edi,%ecx
+80105780:	74 22                	je     801057a4 <setdeadline+0x105>
+      if((p->affinity & (1U << i)) &&
+80105782:	bb 01 00 00 00       	mov    $0x1,%ebx
+80105787:	d3 e3                	shl    %cl,%ebx
+80105789:	85 d3                	test   %edx,%ebx
+8010578b:	74 e9                	je     80105776 <setdeadline+0xd7>
+8010578d:	85 f6                	test   %esi,%esi
+8010578f:	78 e3                	js     80105774 <setdeadline+0xd5>
+         (best < 0 || ptable.rq[i].edfutil < ptable.rq[best].edfutil))
+80105791:	69 de 84 00 00 00    	imul   $0x84,%esi,%ebx
+80105797:	8b 9b d0 12 14 80    	mov    -0x7febed30(%ebx),%ebx
+8010579d:	39 18                	cmp    %ebx,(%eax)
+8010579f:	0f 42 f1             	cmovb  %ecx,%esi
+801057a2:	eb d2                	jmp    80105776 <setdeadline+0xd7>
+801057a4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    if(ptable.rq[best].edfutil + new > EDF_MAXUTIL * 10){
+801057a7:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+801057ad:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801057b0:	03 b8 d0 12 14 80    	add    -0x7febed30(%eax),%edi
+801057b6:	81 ff 84 03 00 00    	cmp    $0x384,%edi
+801057bc:	0f 87 af 00 00 00    	ja     80105871 <setdeadline+0x1d2>
+    ptable.rq[best].edfutil += new;
+801057c2:	69 d6 84 00 00 00    	imul   $0x84,%esi,%edx
+801057c8:	89 ba d0 12 14 80    	mov    %edi,-0x7febed30(%edx)
+  rq = p->rq;
+801057ce:	8b bb 30 01 00 00    	mov    0x130(%ebx),%edi
+  if(rq){
+801057d4:	85 ff                	test   %edi,%edi
+801057d6:	0f 84 da 00 00 00    	je     801058b6 <setdeadline+0x217>
+    acquire(&rq->lock);
+801057dc:	83 ec 0c             	sub    $0xc,%esp
+801057df:	57                   	push   %edi
+801057e0:	e8 ca 1d 00 00       	call   801075af <acquire>
+    if(readyListRemove(rq, p) < 0)
+801057e5:	89 da                	mov    %ebx,%edx
+801057e7:	89 f8                	mov    %edi,%eax
+801057e9:	e8 a6 e5 ff ff       	call   80103d94 <readyListRemove>
+801057ee:	83 c4 10             	add    $0x10,%esp
+801057f1:	85 c0                	test   %eax,%eax
+801057f3:	0f 88 b0 00 00 00    	js     801058a9 <setdeadline+0x20a>
+    release(&rq->lock);
+801057f9:	83 ec 0c             	sub    $0xc,%esp
+801057fc:	57                   	push   %edi
+801057fd:	e8 14 1e 00 00       	call   80107616 <release>
+  p->dl_runtime = runtime;
+80105802:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105805:	89 83 04 01 00 00    	mov    %eax,0x104(%ebx)
+  p->dl_period = period;
+8010580b:	8b 45 10             	mov    0x10(%ebp),%eax
+8010580e:	89 83 08 01 00 00    	mov    %eax,0x108(%ebx)
+  p->dl_cpu = best;
+80105814:	89 b3 18 01 00 00    	mov    %esi,0x118(%ebx)
+  p->dl_deadline = ticks + period;
+8010581a:	a1 40 db 15 80       	mov    0x8015db40,%eax
+8010581f:	89 c2                	mov    %eax,%edx
+80105821:	03 55 10             	add    0x10(%ebp),%edx
+80105824:	89 93 0c 01 00 00    	mov    %edx,0x10c(%ebx)
+  p->dl_left = runtime;
+8010582a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010582d:	89 bb 10 01 00 00    	mov    %edi,0x110(%ebx)
+  p->dl_stamp = ticks;
+80105833:	89 83 14 01 00 00    	mov    %eax,0x114(%ebx)
+    enqueue(selectrq(p), p);
+80105839:	89 d8                	mov    %ebx,%eax
+8010583b:	e8 16 ec ff ff       	call   80104456 <selectrq>
+80105840:	89 da                	mov    %ebx,%edx
+80105842:	e8 13 ed ff ff       	call   8010455a <enqueue>
+80105847:	83 c4 10             	add    $0x10,%esp
+  release(&ptable.lock);
+8010584a:	83 ec 0c             	sub    $0xc,%esp
+8010584d:	68 e0 11 14 80       	push   $0x801411e0
+80105852:	e8 bf 1d 00 00       	call   80107616 <release>
+  return 0;
+80105857:	83 c4 10             	add    $0x10,%esp
+8010585a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010585f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105862:	5b                   	pop    %ebx
+80105863:	5e                   	pop    %esi
+80105864:	5f                   	pop    %edi
+80105865:	5d                   	pop    %ebp
+80105866:	c3                   	ret
+  int i, best = -1;
+80105867:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010586c:	e9 36 ff ff ff       	jmp    801057a7 <setdeadline+0x108>
+      if(old)
+80105871:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80105874:	85 f6                	test   %esi,%esi
+80105876:	74 10                	je     80105888 <setdeadline+0x1e9>
+        ptable.rq[p->dl_cpu].edfutil += old;
+80105878:	69 83 18 01 00 00 84 	imul   $0x84,0x118(%ebx),%eax
+8010587f:	00 00 00 
+80105882:	01 b0 d0 12 14 80    	add    %esi,-0x7febed30(%eax)
+      release(&ptable.lock);
+80105888:	83 ec 0c             	sub    $0xc,%esp
+8010588b:	68 e0 11 14 80       	push   $0x801411e0
+80105890:	e8 81 1d 00 00       	call   80107616 <release>
+      return -1;
+80105895:	83 c4 10             	add    $0x10,%esp
+80105898:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010589d:	eb c0                	jmp    8010585f <setdeadline+0x1c0>
+  int i, best = -1;
+8010589f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801058a4:	e9 25 ff ff ff       	jmp    801057ce <setdeadline+0x12f>
+      panic("Error removing from ready list in setdeadline().\n");
+801058a9:	83 ec 0c             	sub    $0xc,%esp
+801058ac:	68 40 b7 10 80       	push   $0x8010b740
+801058b1:	e8 8c aa ff ff       	call   80100342 <panic>
+  p->dl_runtime = runtime;
+801058b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+801058b9:	89 83 04 01 00 00    	mov    %eax,0x104(%ebx)
+  p->dl_period = period;
+801058bf:	8b 45 10             	mov    0x10(%ebp),%eax
+801058c2:	89 83 08 01 00 00    	mov    %eax,0x108(%ebx)
+  p->dl_cpu = best;
+801058c8:	89 b3 18 01 00 00    	mov    %esi,0x118(%ebx)
+  p->dl_deadline = ticks + period;
+801058ce:	a1 40 db 15 80       	mov    0x8015db40,%eax
+801058d3:	89 c2                	mov    %eax,%edx
+801058d5:	03 55 10             	add    0x10(%ebp),%edx
+801058d8:	89 93 0c 01 00 00    	mov    %edx,0x10c(%ebx)
+  p->dl_left = runtime;
+801058de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801058e1:	89 bb 10 01 00 00    	mov    %edi,0x110(%ebx)
+  p->dl_stamp = ticks;
+801058e7:	89 83 14 01 00 00    	mov    %eax,0x114(%ebx)
+  if(rq)
+801058ed:	e9 58 ff ff ff       	jmp    8010584a <setdeadline+0x1ab>
+  new = period ? EDFUTIL(runtime, period) : 0;
+801058f2:	69 45 0c e8 03 00 00 	imul   $0x3e8,0xc(%ebp),%eax
+801058f9:	8b 75 10             	mov    0x10(%ebp),%esi
+801058fc:	8d 44 06 ff          	lea    -0x1(%esi,%eax,1),%eax
+80105900:	ba 00 00 00 00       	mov    $0x0,%edx
+80105905:	f7 f6                	div    %esi
+80105907:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  old = p->dl_period ? EDFUTIL(p->dl_runtime, p->dl_period) : 0;
+8010590a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010590d:	e9 16 fe ff ff       	jmp    80105728 <setdeadline+0x89>
+  new = period ? EDFUTIL(runtime, period) : 0;
+80105912:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80105916:	75 da                	jne    801058f2 <setdeadline+0x253>
+  old = p->dl_period ? EDFUTIL(p->dl_runtime, p->dl_period) : 0;
+80105918:	8b 45 10             	mov    0x10(%ebp),%eax
+8010591b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i, best = -1;
+8010591e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  if(old)
+80105923:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+80105927:	0f 84 a1 fe ff ff    	je     801057ce <setdeadline+0x12f>
+  new = period ? EDFUTIL(runtime, period) : 0;
+8010592d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+80105934:	e9 dc fd ff ff       	jmp    80105715 <setdeadline+0x76>
+
+80105939 <setshares>:
+{
+80105939:	55                   	push   %ebp
+8010593a:	89 e5                	mov    %esp,%ebp
+8010593c:	56                   	push   %esi
+8010593d:	53                   	push   %ebx
+8010593e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(n < 1 || n > STRIDE_MAXSHARES)
+80105941:	8d 46 ff             	lea    -0x1(%esi),%eax
+80105944:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+80105949:	0f 87 8c 00 00 00    	ja     801059db <setshares+0xa2>
+  acquire(&ptable.lock);
+8010594f:	83 ec 0c             	sub    $0xc,%esp
+80105952:	68 e0 11 14 80       	push   $0x801411e0
+80105957:	e8 53 1c 00 00       	call   801075af <acquire>
+8010595c:	83 c4 10             	add    $0x10,%esp
+  int nfixed = 0;
+8010595f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++)
+80105964:	b8 a4 16 14 80       	mov    $0x801416a4,%eax
+      nfixed++;
+80105969:	83 78 08 01          	cmpl   $0x1,0x8(%eax)
+8010596d:	83 db ff             	sbb    $0xffffffff,%ebx
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++)
+80105970:	83 c0 18             	add    $0x18,%eax
+80105973:	3d 24 98 15 80       	cmp    $0x80159824,%eax
+80105978:	75 ef                	jne    80105969 <setshares+0x30>
+  g = groupFind(uid);
+8010597a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010597d:	e8 e6 e4 ff ff       	call   80103e68 <groupFind>
+80105982:	89 c1                	mov    %eax,%ecx
+  if(!g->fixed && nfixed == STRIDE_NFIXED){
+80105984:	83 78 08 00          	cmpl   $0x0,0x8(%eax)
+80105988:	75 05                	jne    8010598f <setshares+0x56>
+8010598a:	83 fb 10             	cmp    $0x10,%ebx
+8010598d:	74 35                	je     801059c4 <setshares+0x8b>
+  g->fixed = 1;
+8010598f:	c7 41 08 01 00 00 00 	movl   $0x1,0x8(%ecx)
+  g->shares = n;
+80105996:	89 71 04             	mov    %esi,0x4(%ecx)
+  g->stride = STRIDE1 / n;
+80105999:	b8 00 00 01 00       	mov    $0x10000,%eax
+8010599e:	ba 00 00 00 00       	mov    $0x0,%edx
+801059a3:	f7 f6                	div    %esi
+801059a5:	89 41 0c             	mov    %eax,0xc(%ecx)
+  release(&ptable.lock);
+801059a8:	83 ec 0c             	sub    $0xc,%esp
+801059ab:	68 e0 11 14 80       	push   $0x801411e0
+801059b0:	e8 61 1c 00 00       	call   80107616 <release>
+  return 0;
+801059b5:	83 c4 10             	add    $0x10,%esp
+801059b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801059bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801059c0:	5b                   	pop    %ebx
+801059c1:	5e                   	pop    %esi
+801059c2:	5d                   	pop    %ebp
+801059c3:	c3                   	ret
+    release(&ptable.lock);
+801059c4:	83 ec 0c             	sub    $0xc,%esp
+801059c7:	68 e0 11 14 80       	push   $0x801411e0
+801059cc:	e8 45 1c 00 00       	call   80107616 <release>
+    return -1;
+801059d1:	83 c4 10             	add    $0x10,%esp
+801059d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801059d9:	eb e2                	jmp    801059bd <setshares+0x84>
+    return -1;
+801059db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801059e0:	eb db                	jmp    801059bd <setshares+0x84>
+
+801059e2 <getshares>:
+{
+801059e2:	55                   	push   %ebp
+801059e3:	89 e5                	mov    %esp,%ebp
+801059e5:	56                   	push   %esi
+801059e6:	53                   	push   %ebx
+801059e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&ptable.lock);
+801059ea:	83 ec 0c             	sub    $0xc,%esp
+801059ed:	68 e0 11 14 80       	push   $0x801411e0
+801059f2:	e8 b8 1b 00 00       	call   801075af <acquire>
+801059f7:	83 c4 10             	add    $0x10,%esp
+  int n = STRIDE_SHARES;
+801059fa:	bb 64 00 00 00       	mov    $0x64,%ebx
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++)
+801059ff:	b8 a4 16 14 80       	mov    $0x801416a4,%eax
+80105a04:	eb 0a                	jmp    80105a10 <getshares+0x2e>
+80105a06:	83 c0 18             	add    $0x18,%eax
+80105a09:	3d 24 98 15 80       	cmp    $0x80159824,%eax
+80105a0e:	74 0e                	je     80105a1e <getshares+0x3c>
+    if(g->shares && g->uid == uid)
+80105a10:	8b 50 04             	mov    0x4(%eax),%edx
+80105a13:	85 d2                	test   %edx,%edx
+80105a15:	74 ef                	je     80105a06 <getshares+0x24>
+      n = g->shares;
+80105a17:	39 30                	cmp    %esi,(%eax)
+80105a19:	0f 44 da             	cmove  %edx,%ebx
+80105a1c:	eb e8                	jmp    80105a06 <getshares+0x24>
+  release(&ptable.lock);
+80105a1e:	83 ec 0c             	sub    $0xc,%esp
+80105a21:	68 e0 11 14 80       	push   $0x801411e0
+80105a26:	e8 eb 1b 00 00       	call   80107616 <release>
+}
+80105a2b:	89 d8                	mov    %ebx,%eax
+80105a2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105a30:	5b                   	pop    %ebx
+80105a31:	5e                   	pop    %esi
+80105a32:	5d                   	pop    %ebp
+80105a33:	c3                   	ret
+
+80105a34 <schedctl>:
+{
+80105a34:	55                   	push   %ebp
+80105a35:	89 e5                	mov    %esp,%ebp
+80105a37:	56                   	push   %esi
+80105a38:	53                   	push   %ebx
+80105a39:	8b 75 08             	mov    0x8(%ebp),%esi
+80105a3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  switch(cmd){
+80105a3f:	85 f6                	test   %esi,%esi
+80105a41:	0f 84 e2 00 00 00    	je     80105b29 <schedctl+0xf5>
+80105a47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105a4c:	83 fe 01             	cmp    $0x1,%esi
+80105a4f:	0f 85 41 01 00 00    	jne    80105b96 <schedctl+0x162>
+80105a55:	89 d8                	mov    %ebx,%eax
+80105a57:	8d 4b 1c             	lea    0x1c(%ebx),%ecx
+      if(sp->quantum[i] < 1 || sp->quantum[i] > QUANTUM_MAX)
+80105a5a:	8b 30                	mov    (%eax),%esi
+80105a5c:	8d 56 ff             	lea    -0x1(%esi),%edx
+80105a5f:	81 fa 0f 27 00 00    	cmp    $0x270f,%edx
+80105a65:	0f 87 32 01 00 00    	ja     80105b9d <schedctl+0x169>
+    for(i = 0; i <= MAXPRIO; i++)
+80105a6b:	83 c0 04             	add    $0x4,%eax
+80105a6e:	39 c8                	cmp    %ecx,%eax
+80105a70:	75 e8                	jne    80105a5a <schedctl+0x26>
+    if(sp->budget < 1 || sp->promote < 1 ||
+80105a72:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+80105a76:	0f 84 28 01 00 00    	je     80105ba4 <schedctl+0x170>
+80105a7c:	83 7b 20 00          	cmpl   $0x0,0x20(%ebx)
+80105a80:	0f 84 25 01 00 00    	je     80105bab <schedctl+0x177>
+       sp->maxproc < 1 || sp->maxproc > MAXPROC)
+80105a86:	8b 43 24             	mov    0x24(%ebx),%eax
+80105a89:	83 e8 01             	sub    $0x1,%eax
+80105a8c:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80105a91:	0f 87 1b 01 00 00    	ja     80105bb2 <schedctl+0x17e>
+    acquire(&ptable.lock);
+80105a97:	83 ec 0c             	sub    $0xc,%esp
+80105a9a:	68 e0 11 14 80       	push   $0x801411e0
+80105a9f:	e8 0b 1b 00 00       	call   801075af <acquire>
+    ptable.params = *sp;
+80105aa4:	8b 03                	mov    (%ebx),%eax
+80105aa6:	a3 7c 16 14 80       	mov    %eax,0x8014167c
+80105aab:	8b 43 04             	mov    0x4(%ebx),%eax
+80105aae:	a3 80 16 14 80       	mov    %eax,0x80141680
+80105ab3:	8b 43 08             	mov    0x8(%ebx),%eax
+80105ab6:	a3 84 16 14 80       	mov    %eax,0x80141684
+80105abb:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105abe:	a3 88 16 14 80       	mov    %eax,0x80141688
+80105ac3:	8b 43 10             	mov    0x10(%ebx),%eax
+80105ac6:	a3 8c 16 14 80       	mov    %eax,0x8014168c
+80105acb:	8b 43 14             	mov    0x14(%ebx),%eax
+80105ace:	a3 90 16 14 80       	mov    %eax,0x80141690
+80105ad3:	8b 43 18             	mov    0x18(%ebx),%eax
+80105ad6:	a3 94 16 14 80       	mov    %eax,0x80141694
+80105adb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80105ade:	a3 98 16 14 80       	mov    %eax,0x80141698
+80105ae3:	8b 43 20             	mov    0x20(%ebx),%eax
+80105ae6:	a3 9c 16 14 80       	mov    %eax,0x8014169c
+80105aeb:	8b 43 24             	mov    0x24(%ebx),%eax
+80105aee:	a3 a0 16 14 80       	mov    %eax,0x801416a0
+    if(ptable.PromoteAtTime - ticks > sp->promote)
+80105af3:	8b 15 40 db 15 80    	mov    0x8015db40,%edx
+80105af9:	8b 4b 20             	mov    0x20(%ebx),%ecx
+80105afc:	a1 70 16 14 80       	mov    0x80141670,%eax
+80105b01:	29 d0                	sub    %edx,%eax
+80105b03:	83 c4 10             	add    $0x10,%esp
+80105b06:	39 c1                	cmp    %eax,%ecx
+80105b08:	73 08                	jae    80105b12 <schedctl+0xde>
+      ptable.PromoteAtTime = ticks + sp->promote;
+80105b0a:	01 ca                	add    %ecx,%edx
+80105b0c:	89 15 70 16 14 80    	mov    %edx,0x80141670
+    release(&ptable.lock);
+80105b12:	83 ec 0c             	sub    $0xc,%esp
+80105b15:	68 e0 11 14 80       	push   $0x801411e0
+80105b1a:	e8 f7 1a 00 00       	call   80107616 <release>
+    return 0;
+80105b1f:	83 c4 10             	add    $0x10,%esp
+80105b22:	b8 00 00 00 00       	mov    $0x0,%eax
+80105b27:	eb 6d                	jmp    80105b96 <schedctl+0x162>
+    acquire(&ptable.lock);
+80105b29:	83 ec 0c             	sub    $0xc,%esp
+80105b2c:	68 e0 11 14 80       	push   $0x801411e0
+80105b31:	e8 79 1a 00 00       	call   801075af <acquire>
+    *sp = ptable.params;
+80105b36:	a1 7c 16 14 80       	mov    0x8014167c,%eax
+80105b3b:	89 03                	mov    %eax,(%ebx)
+80105b3d:	a1 80 16 14 80       	mov    0x80141680,%eax
+80105b42:	89 43 04             	mov    %eax,0x4(%ebx)
+80105b45:	a1 84 16 14 80       	mov    0x80141684,%eax
+80105b4a:	89 43 08             	mov    %eax,0x8(%ebx)
+80105b4d:	a1 88 16 14 80       	mov    0x80141688,%eax
+80105b52:	89 43 0c             	mov    %eax,0xc(%ebx)
+80105b55:	a1 8c 16 14 80       	mov    0x8014168c,%eax
+80105b5a:	89 43 10             	mov    %eax,0x10(%ebx)
+80105b5d:	a1 90 16 14 80       	mov    0x80141690,%eax
+80105b62:	89 43 14             	mov    %eax,0x14(%ebx)
+80105b65:	a1 94 16 14 80       	mov    0x80141694,%eax
+80105b6a:	89 43 18             	mov    %eax,0x18(%ebx)
+80105b6d:	a1 98 16 14 80       	mov    0x80141698,%eax
+80105b72:	89 43 1c             	mov    %eax,0x1c(%ebx)
+80105b75:	a1 9c 16 14 80       	mov    0x8014169c,%eax
+80105b7a:	89 43 20             	mov    %eax,0x20(%ebx)
+80105b7d:	a1 a0 16 14 80       	mov    0x801416a0,%eax
+80105b82:	89 43 24             	mov    %eax,0x24(%ebx)
+    release(&ptable.lock);
+80105b85:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80105b8c:	e8 85 1a 00 00       	call   80107616 <release>
+    return 0;
+80105b91:	83 c4 10             	add    $0x10,%esp
+80105b94:	89 f0                	mov    %esi,%eax
+}
+80105b96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105b99:	5b                   	pop    %ebx
+80105b9a:	5e                   	pop    %esi
+80105b9b:	5d                   	pop    %ebp
+80105b9c:	c3                   	ret
+        return -1;
+80105b9d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105ba2:	eb f2                	jmp    80105b96 <schedctl+0x162>
+      return -1;
+80105ba4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105ba9:	eb eb                	jmp    80105b96 <schedctl+0x162>
+80105bab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105bb0:	eb e4                	jmp    80105b96 <schedctl+0x162>
+80105bb2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105bb7:	eb dd                	jmp    80105b96 <schedctl+0x162>
+
+80105bb9 <setaffinity>:
+{
+80105bb9:	55                   	push   %ebp
+80105bba:	89 e5                	mov    %esp,%ebp
+80105bbc:	57                   	push   %edi
+80105bbd:	56                   	push   %esi
+80105bbe:	53                   	push   %ebx
+80105bbf:	83 ec 0c             	sub    $0xc,%esp
+  mask &= (1U << ncpu) - 1;
+80105bc2:	8b 0d 64 f9 13 80    	mov    0x8013f964,%ecx
+80105bc8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105bcd:	d3 e0                	shl    %cl,%eax
+80105bcf:	f7 d0                	not    %eax
+  if(mask == 0)
+80105bd1:	23 45 0c             	and    0xc(%ebp),%eax
+80105bd4:	0f 84 15 01 00 00    	je     80105cef <setaffinity+0x136>
+80105bda:	89 c6                	mov    %eax,%esi
+  acquire(&ptable.lock);
+80105bdc:	83 ec 0c             	sub    $0xc,%esp
+80105bdf:	68 e0 11 14 80       	push   $0x801411e0
+80105be4:	e8 c6 19 00 00       	call   801075af <acquire>
+  p = findproc(pid);
+80105be9:	8b 45 08             	mov    0x8(%ebp),%eax
+80105bec:	e8 2c e0 ff ff       	call   80103c1d <findproc>
+80105bf1:	89 c3                	mov    %eax,%ebx
+  if(p == 0 || (p->dl_period && !(mask & (1U << p->dl_cpu)))){
+80105bf3:	83 c4 10             	add    $0x10,%esp
+80105bf6:	85 c0                	test   %eax,%eax
+80105bf8:	74 69                	je     80105c63 <setaffinity+0xaa>
+80105bfa:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+80105c01:	74 11                	je     80105c14 <setaffinity+0x5b>
+80105c03:	8b 88 18 01 00 00    	mov    0x118(%eax),%ecx
+80105c09:	b8 01 00 00 00       	mov    $0x1,%eax
+80105c0e:	d3 e0                	shl    %cl,%eax
+80105c10:	85 f0                	test   %esi,%eax
+80105c12:	74 4f                	je     80105c63 <setaffinity+0xaa>
+  rq = p->rq;
+80105c14:	8b bb 30 01 00 00    	mov    0x130(%ebx),%edi
+  if(rq){
+80105c1a:	85 ff                	test   %edi,%edi
+80105c1c:	0f 84 aa 00 00 00    	je     80105ccc <setaffinity+0x113>
+    acquire(&rq->lock);
+80105c22:	83 ec 0c             	sub    $0xc,%esp
+80105c25:	57                   	push   %edi
+80105c26:	e8 84 19 00 00       	call   801075af <acquire>
+    p->affinity = mask;
+80105c2b:	89 b3 f8 00 00 00    	mov    %esi,0xf8(%ebx)
+    move = !ALLOWED(p, rq - ptable.rq);
+80105c31:	83 c4 10             	add    $0x10,%esp
+80105c34:	83 bb 08 01 00 00 00 	cmpl   $0x0,0x108(%ebx)
+80105c3b:	74 3d                	je     80105c7a <setaffinity+0xc1>
+80105c3d:	89 f8                	mov    %edi,%eax
+80105c3f:	2d 50 12 14 80       	sub    $0x80141250,%eax
+80105c44:	c1 f8 02             	sar    $0x2,%eax
+80105c47:	69 c0 e1 83 0f 3e    	imul   $0x3e0f83e1,%eax,%eax
+    if(move && readyListRemove(rq, p) < 0)
+80105c4d:	39 83 18 01 00 00    	cmp    %eax,0x118(%ebx)
+80105c53:	75 41                	jne    80105c96 <setaffinity+0xdd>
+    release(&rq->lock);
+80105c55:	83 ec 0c             	sub    $0xc,%esp
+80105c58:	57                   	push   %edi
+80105c59:	e8 b8 19 00 00       	call   80107616 <release>
+80105c5e:	83 c4 10             	add    $0x10,%esp
+80105c61:	eb 6f                	jmp    80105cd2 <setaffinity+0x119>
+    release(&ptable.lock);
+80105c63:	83 ec 0c             	sub    $0xc,%esp
+80105c66:	68 e0 11 14 80       	push   $0x801411e0
+80105c6b:	e8 a6 19 00 00       	call   80107616 <release>
+    return -1;
+80105c70:	83 c4 10             	add    $0x10,%esp
+80105c73:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105c78:	eb 6d                	jmp    80105ce7 <setaffinity+0x12e>
+    move = !ALLOWED(p, rq - ptable.rq);
+80105c7a:	89 f9                	mov    %edi,%ecx
+80105c7c:	81 e9 50 12 14 80    	sub    $0x80141250,%ecx
+80105c82:	c1 f9 02             	sar    $0x2,%ecx
+80105c85:	69 c9 e1 83 0f 3e    	imul   $0x3e0f83e1,%ecx,%ecx
+80105c8b:	b8 01 00 00 00       	mov    $0x1,%eax
+80105c90:	d3 e0                	shl    %cl,%eax
+    if(move && readyListRemove(rq, p) < 0)
+80105c92:	85 f0                	test   %esi,%eax
+80105c94:	75 bf                	jne    80105c55 <setaffinity+0x9c>
+80105c96:	89 da                	mov    %ebx,%edx
+80105c98:	89 f8                	mov    %edi,%eax
+80105c9a:	e8 f5 e0 ff ff       	call   80103d94 <readyListRemove>
+80105c9f:	85 c0                	test   %eax,%eax
+80105ca1:	78 1c                	js     80105cbf <setaffinity+0x106>
+    release(&rq->lock);
+80105ca3:	83 ec 0c             	sub    $0xc,%esp
+80105ca6:	57                   	push   %edi
+80105ca7:	e8 6a 19 00 00       	call   80107616 <release>
+      enqueue(selectrq(p), p);
+80105cac:	89 d8                	mov    %ebx,%eax
+80105cae:	e8 a3 e7 ff ff       	call   80104456 <selectrq>
+80105cb3:	89 da                	mov    %ebx,%edx
+80105cb5:	e8 a0 e8 ff ff       	call   8010455a <enqueue>
+80105cba:	83 c4 10             	add    $0x10,%esp
+80105cbd:	eb 13                	jmp    80105cd2 <setaffinity+0x119>
+      panic("Error removing from ready list in setaffinity().\n");
+80105cbf:	83 ec 0c             	sub    $0xc,%esp
+80105cc2:	68 74 b7 10 80       	push   $0x8010b774
+80105cc7:	e8 76 a6 ff ff       	call   80100342 <panic>
+    p->affinity = mask;
+80105ccc:	89 b3 f8 00 00 00    	mov    %esi,0xf8(%ebx)
+  release(&ptable.lock);
+80105cd2:	83 ec 0c             	sub    $0xc,%esp
+80105cd5:	68 e0 11 14 80       	push   $0x801411e0
+80105cda:	e8 37 19 00 00       	call   80107616 <release>
+  return 0;
+80105cdf:	83 c4 10             	add    $0x10,%esp
+80105ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105cea:	5b                   	pop    %ebx
+80105ceb:	5e                   	pop    %esi
+80105cec:	5f                   	pop    %edi
+80105ced:	5d                   	pop    %ebp
+80105cee:	c3                   	ret
+    return -1;
+80105cef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105cf4:	eb f1                	jmp    80105ce7 <setaffinity+0x12e>
+
+80105cf6 <getaffinity>:
+{
+80105cf6:	55                   	push   %ebp
+80105cf7:	89 e5                	mov    %esp,%ebp
+80105cf9:	53                   	push   %ebx
+80105cfa:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80105cfd:	68 e0 11 14 80       	push   $0x801411e0
+80105d02:	e8 a8 18 00 00       	call   801075af <acquire>
+  p = findproc(pid);
+80105d07:	8b 45 08             	mov    0x8(%ebp),%eax
+80105d0a:	e8 0e df ff ff       	call   80103c1d <findproc>
+  if(p == 0){
+80105d0f:	83 c4 10             	add    $0x10,%esp
+80105d12:	85 c0                	test   %eax,%eax
+80105d14:	74 1d                	je     80105d33 <getaffinity+0x3d>
+  mask = p->affinity;
+80105d16:	8b 98 f8 00 00 00    	mov    0xf8(%eax),%ebx
+  release(&ptable.lock);
+80105d1c:	83 ec 0c             	sub    $0xc,%esp
+80105d1f:	68 e0 11 14 80       	push   $0x801411e0
+80105d24:	e8 ed 18 00 00       	call   80107616 <release>
+  return mask;
+80105d29:	83 c4 10             	add    $0x10,%esp
+}
+80105d2c:	89 d8                	mov    %ebx,%eax
+80105d2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d31:	c9                   	leave
+80105d32:	c3                   	ret
+    release(&ptable.lock);
+80105d33:	83 ec 0c             	sub    $0xc,%esp
+80105d36:	68 e0 11 14 80       	push   $0x801411e0
+80105d3b:	e8 d6 18 00 00       	call   80107616 <release>
+    return -1;
+80105d40:	83 c4 10             	add    $0x10,%esp
+80105d43:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105d48:	eb e2                	jmp    80105d2c <getaffinity+0x36>
+
+80105d4a <edftick>:
+{
+80105d4a:	55                   	push   %ebp
+80105d4b:	89 e5                	mov    %esp,%ebp
+80105d4d:	53                   	push   %ebx
+80105d4e:	83 ec 04             	sub    $0x4,%esp
+80105d51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(p->dl_period == 0)
+80105d54:	83 bb 08 01 00 00 00 	cmpl   $0x0,0x108(%ebx)
+80105d5b:	75 05                	jne    80105d62 <edftick+0x18>
+}
+80105d5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d60:	c9                   	leave
+80105d61:	c3                   	ret
+  acquire(&ptable.lock);
+80105d62:	83 ec 0c             	sub    $0xc,%esp
+80105d65:	68 e0 11 14 80       	push   $0x801411e0
+80105d6a:	e8 40 18 00 00       	call   801075af <acquire>
+  edfcharge(p);
+80105d6f:	89 d8                	mov    %ebx,%eax
+80105d71:	e8 6d de ff ff       	call   80103be3 <edfcharge>
+  release(&ptable.lock);
+80105d76:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80105d7d:	e8 94 18 00 00       	call   80107616 <release>
+80105d82:	83 c4 10             	add    $0x10,%esp
+80105d85:	eb d6                	jmp    80105d5d <edftick+0x13>
+
+80105d87 <infodump>:
+{
+80105d87:	55                   	push   %ebp
+80105d88:	89 e5                	mov    %esp,%ebp
+80105d8a:	57                   	push   %edi
+80105d8b:	56                   	push   %esi
+80105d8c:	53                   	push   %ebx
+80105d8d:	83 ec 1c             	sub    $0x1c,%esp
+80105d90:	8b 45 08             	mov    0x8(%ebp),%eax
+  switch(input)
+80105d93:	3c 73                	cmp    $0x73,%al
+80105d95:	0f 84 e6 01 00 00    	je     80105f81 <infodump+0x1fa>
+80105d9b:	7f 4a                	jg     80105de7 <infodump+0x60>
+80105d9d:	3c 66                	cmp    $0x66,%al
+80105d9f:	0f 84 56 01 00 00    	je     80105efb <infodump+0x174>
+80105da5:	3c 72                	cmp    $0x72,%al
+80105da7:	0f 85 f4 02 00 00    	jne    801060a1 <infodump+0x31a>
+      acquire(&ptable.lock);
+80105dad:	83 ec 0c             	sub    $0xc,%esp
+80105db0:	68 e0 11 14 80       	push   $0x801411e0
+80105db5:	e8 f5 17 00 00       	call   801075af <acquire>
+      cprintf("Ready List Processes: \n");
+80105dba:	c7 04 24 ef b3 10 80 	movl   $0x8010b3ef,(%esp)
+80105dc1:	e8 3e a8 ff ff       	call   80100604 <cprintf>
+      for(int c = 0; c < ncpu; c++){
+80105dc6:	83 c4 10             	add    $0x10,%esp
+80105dc9:	83 3d 64 f9 13 80 00 	cmpl   $0x0,0x8013f964
+80105dd0:	0f 8e 0d 01 00 00    	jle    80105ee3 <infodump+0x15c>
+80105dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+80105ddb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80105de2:	e9 d0 00 00 00       	jmp    80105eb7 <infodump+0x130>
+  switch(input)
+80105de7:	3c 7a                	cmp    $0x7a,%al
+80105de9:	0f 85 b2 02 00 00    	jne    801060a1 <infodump+0x31a>
+      acquire(&ptable.lock);
+80105def:	83 ec 0c             	sub    $0xc,%esp
+80105df2:	68 e0 11 14 80       	push   $0x801411e0
+80105df7:	e8 b3 17 00 00       	call   801075af <acquire>
+      p = ptable.list[ZOMBIE].head;
+80105dfc:	8b 1d 48 12 14 80    	mov    0x80141248,%ebx
+      if(p == 0)
+80105e02:	83 c4 10             	add    $0x10,%esp
+80105e05:	85 db                	test   %ebx,%ebx
+80105e07:	0f 84 0f 02 00 00    	je     8010601c <infodump+0x295>
+        cprintf("Zombie List Processes: \n");
+80105e0d:	83 ec 0c             	sub    $0xc,%esp
+80105e10:	68 92 b4 10 80       	push   $0x8010b492
+80105e15:	e8 ea a7 ff ff       	call   80100604 <cprintf>
+80105e1a:	83 c4 10             	add    $0x10,%esp
+80105e1d:	e9 2b 02 00 00       	jmp    8010604d <infodump+0x2c6>
+              cprintf(" -> ");
+80105e22:	83 ec 0c             	sub    $0xc,%esp
+80105e25:	68 1d b4 10 80       	push   $0x8010b41d
+80105e2a:	e8 d5 a7 ff ff       	call   80100604 <cprintf>
+            p = p->next;
+80105e2f:	8b 9b e0 00 00 00    	mov    0xe0(%ebx),%ebx
+          while(p != 0){
+80105e35:	83 c4 10             	add    $0x10,%esp
+80105e38:	85 db                	test   %ebx,%ebx
+80105e3a:	74 22                	je     80105e5e <infodump+0xd7>
+            cprintf("(%d, %d)",p->pid,p->budget);
+80105e3c:	83 ec 04             	sub    $0x4,%esp
+80105e3f:	ff b3 f0 00 00 00    	push   0xf0(%ebx)
+80105e45:	ff 73 10             	push   0x10(%ebx)
+80105e48:	68 14 b4 10 80       	push   $0x8010b414
+80105e4d:	e8 b2 a7 ff ff       	call   80100604 <cprintf>
+            if(p->next)
+80105e52:	83 c4 10             	add    $0x10,%esp
+80105e55:	83 bb e0 00 00 00 00 	cmpl   $0x0,0xe0(%ebx)
+80105e5c:	75 c4                	jne    80105e22 <infodump+0x9b>
+          cprintf("\n");
+80105e5e:	83 ec 0c             	sub    $0xc,%esp
+80105e61:	68 a9 b4 10 80       	push   $0x8010b4a9
+80105e66:	e8 99 a7 ff ff       	call   80100604 <cprintf>
+        for(int i = MAXPRIO; i >= 0; i--){
+80105e6b:	83 ee 01             	sub    $0x1,%esi
+80105e6e:	83 c4 10             	add    $0x10,%esp
+80105e71:	83 fe ff             	cmp    $0xffffffff,%esi
+80105e74:	74 1e                	je     80105e94 <infodump+0x10d>
+          p = rq->ready[i].head;
+80105e76:	8b 9c f7 84 12 14 80 	mov    -0x7febed7c(%edi,%esi,8),%ebx
+          cprintf("%d: ",i);
+80105e7d:	83 ec 08             	sub    $0x8,%esp
+80105e80:	56                   	push   %esi
+80105e81:	68 0f b4 10 80       	push   $0x8010b40f
+80105e86:	e8 79 a7 ff ff       	call   80100604 <cprintf>
+          while(p != 0){
+80105e8b:	83 c4 10             	add    $0x10,%esp
+80105e8e:	85 db                	test   %ebx,%ebx
+80105e90:	75 aa                	jne    80105e3c <infodump+0xb5>
+80105e92:	eb ca                	jmp    80105e5e <infodump+0xd7>
+        release(&rq->lock);
+80105e94:	83 ec 0c             	sub    $0xc,%esp
+80105e97:	ff 75 e0             	push   -0x20(%ebp)
+80105e9a:	e8 77 17 00 00       	call   80107616 <release>
+      for(int c = 0; c < ncpu; c++){
+80105e9f:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+80105ea3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105ea6:	81 c7 84 00 00 00    	add    $0x84,%edi
+80105eac:	83 c4 10             	add    $0x10,%esp
+80105eaf:	39 05 64 f9 13 80    	cmp    %eax,0x8013f964
+80105eb5:	7e 2c                	jle    80105ee3 <infodump+0x15c>
+        acquire(&rq->lock);
+80105eb7:	8d 87 50 12 14 80    	lea    -0x7febedb0(%edi),%eax
+80105ebd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105ec0:	83 ec 0c             	sub    $0xc,%esp
+80105ec3:	50                   	push   %eax
+80105ec4:	e8 e6 16 00 00       	call   801075af <acquire>
+        cprintf("cpu%d:\n",c);
+80105ec9:	83 c4 08             	add    $0x8,%esp
+80105ecc:	ff 75 e4             	push   -0x1c(%ebp)
+80105ecf:	68 07 b4 10 80       	push   $0x8010b407
+80105ed4:	e8 2b a7 ff ff       	call   80100604 <cprintf>
+80105ed9:	83 c4 10             	add    $0x10,%esp
+        for(int i = MAXPRIO; i >= 0; i--){
+80105edc:	be 06 00 00 00       	mov    $0x6,%esi
+80105ee1:	eb 93                	jmp    80105e76 <infodump+0xef>
+      release(&ptable.lock);
+80105ee3:	83 ec 0c             	sub    $0xc,%esp
+80105ee6:	68 e0 11 14 80       	push   $0x801411e0
+80105eeb:	e8 26 17 00 00       	call   80107616 <release>
+      break;
+80105ef0:	83 c4 10             	add    $0x10,%esp
+}
+80105ef3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105ef6:	5b                   	pop    %ebx
+80105ef7:	5e                   	pop    %esi
+80105ef8:	5f                   	pop    %edi
+80105ef9:	5d                   	pop    %ebp
+80105efa:	c3                   	ret
+      acquire(&ptable.lock);
+80105efb:	83 ec 0c             	sub    $0xc,%esp
+80105efe:	68 e0 11 14 80       	push   $0x801411e0
+80105f03:	e8 a7 16 00 00       	call   801075af <acquire>
+      p = ptable.list[UNUSED].head;
+80105f08:	8b 1d 20 12 14 80    	mov    0x80141220,%ebx
+      if(p == 0)
+80105f0e:	83 c4 10             	add    $0x10,%esp
+80105f11:	be 00 00 00 00       	mov    $0x0,%esi
+80105f16:	85 db                	test   %ebx,%ebx
+80105f18:	74 43                	je     80105f5d <infodump+0x1d6>
+        assertState(p,UNUSED);
+80105f1a:	ba 00 00 00 00       	mov    $0x0,%edx
+80105f1f:	89 d8                	mov    %ebx,%eax
+80105f21:	e8 59 e1 ff ff       	call   8010407f <assertState>
+        ++num_free;
+80105f26:	83 c6 01             	add    $0x1,%esi
+        p = p->next;
+80105f29:	8b 9b e0 00 00 00    	mov    0xe0(%ebx),%ebx
+      while(p != 0){
+80105f2f:	85 db                	test   %ebx,%ebx
+80105f31:	75 e7                	jne    80105f1a <infodump+0x193>
+      if(num_free == 1)
+80105f33:	83 fe 01             	cmp    $0x1,%esi
+80105f36:	74 37                	je     80105f6f <infodump+0x1e8>
+      if(num_free > 1)
+80105f38:	7e 11                	jle    80105f4b <infodump+0x1c4>
+        cprintf("Free List Size: %d processes.\n", num_free);
+80105f3a:	83 ec 08             	sub    $0x8,%esp
+80105f3d:	56                   	push   %esi
+80105f3e:	68 a8 b7 10 80       	push   $0x8010b7a8
+80105f43:	e8 bc a6 ff ff       	call   80100604 <cprintf>
+80105f48:	83 c4 10             	add    $0x10,%esp
+      release(&ptable.lock);
+80105f4b:	83 ec 0c             	sub    $0xc,%esp
+80105f4e:	68 e0 11 14 80       	push   $0x801411e0
+80105f53:	e8 be 16 00 00       	call   80107616 <release>
+      break;
+80105f58:	83 c4 10             	add    $0x10,%esp
+80105f5b:	eb 96                	jmp    80105ef3 <infodump+0x16c>
+        cprintf("Free List Empty.\n");
+80105f5d:	83 ec 0c             	sub    $0xc,%esp
+80105f60:	68 22 b4 10 80       	push   $0x8010b422
+80105f65:	e8 9a a6 ff ff       	call   80100604 <cprintf>
+80105f6a:	83 c4 10             	add    $0x10,%esp
+80105f6d:	eb dc                	jmp    80105f4b <infodump+0x1c4>
+        cprintf("Free List Size: 1 process.\n");
+80105f6f:	83 ec 0c             	sub    $0xc,%esp
+80105f72:	68 34 b4 10 80       	push   $0x8010b434
+80105f77:	e8 88 a6 ff ff       	call   80100604 <cprintf>
+80105f7c:	83 c4 10             	add    $0x10,%esp
+80105f7f:	eb ca                	jmp    80105f4b <infodump+0x1c4>
+      acquire(&ptable.lock);
+80105f81:	83 ec 0c             	sub    $0xc,%esp
+80105f84:	68 e0 11 14 80       	push   $0x801411e0
+80105f89:	e8 21 16 00 00       	call   801075af <acquire>
+      p = ptable.list[SLEEPING].head;
+80105f8e:	8b 1d 30 12 14 80    	mov    0x80141230,%ebx
+      cprintf("Sleep List Processes: \n");
+80105f94:	c7 04 24 50 b4 10 80 	movl   $0x8010b450,(%esp)
+80105f9b:	e8 64 a6 ff ff       	call   80100604 <cprintf>
+      if(p == 0)
+80105fa0:	83 c4 10             	add    $0x10,%esp
+80105fa3:	85 db                	test   %ebx,%ebx
+80105fa5:	75 2c                	jne    80105fd3 <infodump+0x24c>
+        cprintf("Sleep List Empty\n");
+80105fa7:	83 ec 0c             	sub    $0xc,%esp
+80105faa:	68 68 b4 10 80       	push   $0x8010b468
+80105faf:	e8 50 a6 ff ff       	call   80100604 <cprintf>
+80105fb4:	83 c4 10             	add    $0x10,%esp
+80105fb7:	eb 42                	jmp    80105ffb <infodump+0x274>
+          cprintf("-> ");
+80105fb9:	83 ec 0c             	sub    $0xc,%esp
+80105fbc:	68 1e b4 10 80       	push   $0x8010b41e
+80105fc1:	e8 3e a6 ff ff       	call   80100604 <cprintf>
+        p = p->next;
+80105fc6:	8b 9b e0 00 00 00    	mov    0xe0(%ebx),%ebx
+      while(p != 0){
+80105fcc:	83 c4 10             	add    $0x10,%esp
+80105fcf:	85 db                	test   %ebx,%ebx
+80105fd1:	74 28                	je     80105ffb <infodump+0x274>
+        assertState(p,SLEEPING);
+80105fd3:	ba 02 00 00 00       	mov    $0x2,%edx
+80105fd8:	89 d8                	mov    %ebx,%eax
+80105fda:	e8 a0 e0 ff ff       	call   8010407f <assertState>
+        cprintf("%d ", p->pid);
+80105fdf:	83 ec 08             	sub    $0x8,%esp
+80105fe2:	ff 73 10             	push   0x10(%ebx)
+80105fe5:	68 7a b4 10 80       	push   $0x8010b47a
+80105fea:	e8 15 a6 ff ff       	call   80100604 <cprintf>
+        if(p->next)
+80105fef:	83 c4 10             	add    $0x10,%esp
+80105ff2:	83 bb e0 00 00 00 00 	cmpl   $0x0,0xe0(%ebx)
+80105ff9:	75 be                	jne    80105fb9 <infodump+0x232>
+      cprintf("\n");
+80105ffb:	83 ec 0c             	sub    $0xc,%esp
+80105ffe:	68 a9 b4 10 80       	push   $0x8010b4a9
+80106003:	e8 fc a5 ff ff       	call   80100604 <cprintf>
+      release(&ptable.lock);
+80106008:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+8010600f:	e8 02 16 00 00       	call   80107616 <release>
+      break;
+80106014:	83 c4 10             	add    $0x10,%esp
+80106017:	e9 d7 fe ff ff       	jmp    80105ef3 <infodump+0x16c>
+        cprintf("Zombie List Empty.\n");
+8010601c:	83 ec 0c             	sub    $0xc,%esp
+8010601f:	68 7e b4 10 80       	push   $0x8010b47e
+80106024:	e8 db a5 ff ff       	call   80100604 <cprintf>
+80106029:	83 c4 10             	add    $0x10,%esp
+8010602c:	eb 52                	jmp    80106080 <infodump+0x2f9>
+          ppid = p->pid;
+8010602e:	8b 43 10             	mov    0x10(%ebx),%eax
+80106031:	eb 30                	jmp    80106063 <infodump+0x2dc>
+          cprintf("-> ");
+80106033:	83 ec 0c             	sub    $0xc,%esp
+80106036:	68 1e b4 10 80       	push   $0x8010b41e
+8010603b:	e8 c4 a5 ff ff       	call   80100604 <cprintf>
+        p = p->next;
+80106040:	8b 9b e0 00 00 00    	mov    0xe0(%ebx),%ebx
+      while(p != 0){
+80106046:	83 c4 10             	add    $0x10,%esp
+80106049:	85 db                	test   %ebx,%ebx
+8010604b:	74 33                	je     80106080 <infodump+0x2f9>
+        assertState(p,ZOMBIE);
+8010604d:	ba 05 00 00 00       	mov    $0x5,%edx
+80106052:	89 d8                	mov    %ebx,%eax
+80106054:	e8 26 e0 ff ff       	call   8010407f <assertState>
+        if(p->parent)
+80106059:	8b 43 14             	mov    0x14(%ebx),%eax
+8010605c:	85 c0                	test   %eax,%eax
+8010605e:	74 ce                	je     8010602e <infodump+0x2a7>
+          ppid = p->parent->pid;
+80106060:	8b 40 10             	mov    0x10(%eax),%eax
+        cprintf("(PID%d,PPID%d) ",p->pid,ppid);
+80106063:	83 ec 04             	sub    $0x4,%esp
+80106066:	50                   	push   %eax
+80106067:	ff 73 10             	push   0x10(%ebx)
+8010606a:	68 ab b4 10 80       	push   $0x8010b4ab
+8010606f:	e8 90 a5 ff ff       	call   80100604 <cprintf>
+        if(p->next)
+80106074:	83 c4 10             	add    $0x10,%esp
+80106077:	83 bb e0 00 00 00 00 	cmpl   $0x0,0xe0(%ebx)
+8010607e:	75 b3                	jne    80106033 <infodump+0x2ac>
+      cprintf("\n");
+80106080:	83 ec 0c             	sub    $0xc,%esp
+80106083:	68 a9 b4 10 80       	push   $0x8010b4a9
+80106088:	e8 77 a5 ff ff       	call   80100604 <cprintf>
+      release(&ptable.lock);
+8010608d:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106094:	e8 7d 15 00 00       	call   80107616 <release>
+      break;
+80106099:	83 c4 10             	add    $0x10,%esp
+8010609c:	e9 52 fe ff ff       	jmp    80105ef3 <infodump+0x16c>
+      cprintf("Invalid Input in info dump\n");
+801060a1:	83 ec 0c             	sub    $0xc,%esp
+801060a4:	68 bb b4 10 80       	push   $0x8010b4bb
+801060a9:	e8 56 a5 ff ff       	call   80100604 <cprintf>
+801060ae:	83 c4 10             	add    $0x10,%esp
+}
+801060b1:	e9 3d fe ff ff       	jmp    80105ef3 <infodump+0x16c>
+
+801060b6 <procdumpP2>:
+#endif // CS333_P3
+
+#ifdef CS333_P2
+void
+procdumpP2(struct proc *p,char *state)
+{
+801060b6:	55                   	push   %ebp
+801060b7:	89 e5                	mov    %esp,%ebp
+801060b9:	53                   	push   %ebx
+801060ba:	83 ec 04             	sub    $0x4,%esp
+801060bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint s;
+  uint ms;
+  
+  // Print PID, Name, UID, GID, PPID,
+  cprintf("%d\t%s\t%d\t%d\t%d\t",p->pid,p->name,p->uid,p->gid,p->parent ? p->parent->pid : p->pid);
+801060c0:	8b 43 14             	mov    0x14(%ebx),%eax
+801060c3:	85 c0                	test   %eax,%eax
+801060c5:	0f 84 b3 00 00 00    	je     8010617e <procdumpP2+0xc8>
+801060cb:	8b 40 10             	mov    0x10(%eax),%eax
+801060ce:	83 ec 08             	sub    $0x8,%esp
+801060d1:	50                   	push   %eax
+801060d2:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+801060d8:	ff b3 d0 00 00 00    	push   0xd0(%ebx)
+801060de:	8d 43 6c             	lea    0x6c(%ebx),%eax
+801060e1:	50                   	push   %eax
+801060e2:	ff 73 10             	push   0x10(%ebx)
+801060e5:	68 d7 b4 10 80       	push   $0x8010b4d7
+801060ea:	e8 15 a5 ff ff       	call   80100604 <cprintf>
+
+  // Calculate and print Elapsed Time
+  s  = (ticks - p->start_ticks) / 1000;
+801060ef:	8b 0d 40 db 15 80    	mov    0x8015db40,%ecx
+801060f5:	2b 8b cc 00 00 00    	sub    0xcc(%ebx),%ecx
+801060fb:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80106100:	89 c8                	mov    %ecx,%eax
+80106102:	f7 e2                	mul    %edx
+80106104:	c1 ea 06             	shr    $0x6,%edx
+  ms = (ticks - p->start_ticks) % 1000;
+80106107:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+8010610d:	29 c1                	sub    %eax,%ecx
+
+  if(ms >= 100)
+8010610f:	83 c4 20             	add    $0x20,%esp
+80106112:	83 f9 63             	cmp    $0x63,%ecx
+80106115:	77 6f                	ja     80106186 <procdumpP2+0xd0>
+     cprintf("%d.%d\t",s,ms);
+  else if(ms < 11)
+80106117:	83 f9 0a             	cmp    $0xa,%ecx
+8010611a:	77 7e                	ja     8010619a <procdumpP2+0xe4>
+     cprintf("%d.00%d\t",s,ms);
+8010611c:	83 ec 04             	sub    $0x4,%esp
+8010611f:	51                   	push   %ecx
+80106120:	52                   	push   %edx
+80106121:	68 d3 b3 10 80       	push   $0x8010b3d3
+80106126:	e8 d9 a4 ff ff       	call   80100604 <cprintf>
+8010612b:	83 c4 10             	add    $0x10,%esp
+  else
+     cprintf("%d.0%d\t",s,ms);
+
+  // Calculate and print CPU Time
+  s  = p->cpu_ticks_total / 1000;
+8010612e:	8b 8b d8 00 00 00    	mov    0xd8(%ebx),%ecx
+80106134:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80106139:	89 c8                	mov    %ecx,%eax
+8010613b:	f7 e2                	mul    %edx
+8010613d:	c1 ea 06             	shr    $0x6,%edx
+  ms = p->cpu_ticks_total % 1000;
+80106140:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80106146:	29 c1                	sub    %eax,%ecx
+
+  if(ms >= 100)
+80106148:	83 f9 63             	cmp    $0x63,%ecx
+8010614b:	77 61                	ja     801061ae <procdumpP2+0xf8>
+     cprintf("%d.%d\t",s,ms);
+  else if(ms < 10)
+8010614d:	83 f9 09             	cmp    $0x9,%ecx
+80106150:	77 70                	ja     801061c2 <procdumpP2+0x10c>
+     cprintf("%d.00%d\t",s,ms);
+80106152:	83 ec 04             	sub    $0x4,%esp
+80106155:	51                   	push   %ecx
+80106156:	52                   	push   %edx
+80106157:	68 d3 b3 10 80       	push   $0x8010b3d3
+8010615c:	e8 a3 a4 ff ff       	call   80100604 <cprintf>
+80106161:	83 c4 10             	add    $0x10,%esp
+  else
+     cprintf("%d.0%d\t",s,ms);
+
+  // Print State, Size
+  cprintf("%s\t%d\t",state,p->sz);
+80106164:	83 ec 04             	sub    $0x4,%esp
+80106167:	ff 33                	push   (%ebx)
+80106169:	ff 75 0c             	push   0xc(%ebp)
+8010616c:	68 e4 b3 10 80       	push   $0x8010b3e4
+80106171:	e8 8e a4 ff ff       	call   80100604 <cprintf>
+}
+80106176:	83 c4 10             	add    $0x10,%esp
+80106179:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010617c:	c9                   	leave
+8010617d:	c3                   	ret
+  cprintf("%d\t%s\t%d\t%d\t%d\t",p->pid,p->name,p->uid,p->gid,p->parent ? p->parent->pid : p->pid);
+8010617e:	8b 43 10             	mov    0x10(%ebx),%eax
+80106181:	e9 48 ff ff ff       	jmp    801060ce <procdumpP2+0x18>
+     cprintf("%d.%d\t",s,ms);
+80106186:	83 ec 04             	sub    $0x4,%esp
+80106189:	51                   	push   %ecx
+8010618a:	52                   	push   %edx
+8010618b:	68 cc b3 10 80       	push   $0x8010b3cc
+80106190:	e8 6f a4 ff ff       	call   80100604 <cprintf>
+80106195:	83 c4 10             	add    $0x10,%esp
+80106198:	eb 94                	jmp    8010612e <procdumpP2+0x78>
+     cprintf("%d.0%d\t",s,ms);
+8010619a:	83 ec 04             	sub    $0x4,%esp
+8010619d:	51                   	push   %ecx
+8010619e:	52                   	push   %edx
+8010619f:	68 dc b3 10 80       	push   $0x8010b3dc
+801061a4:	e8 5b a4 ff ff       	call   80100604 <cprintf>
+801061a9:	83 c4 10             	add    $0x10,%esp
+801061ac:	eb 80                	jmp    8010612e <procdumpP2+0x78>
+     cprintf("%d.%d\t",s,ms);
+801061ae:	83 ec 04             	sub    $0x4,%esp
+801061b1:	51                   	push   %ecx
+801061b2:	52                   	push   %edx
+801061b3:	68 cc b3 10 80       	push   $0x8010b3cc
+801061b8:	e8 47 a4 ff ff       	call   80100604 <cprintf>
+801061bd:	83 c4 10             	add    $0x10,%esp
+801061c0:	eb a2                	jmp    80106164 <procdumpP2+0xae>
+     cprintf("%d.0%d\t",s,ms);
+801061c2:	83 ec 04             	sub    $0x4,%esp
+801061c5:	51                   	push   %ecx
+801061c6:	52                   	push   %edx
+801061c7:	68 dc b3 10 80       	push   $0x8010b3dc
+801061cc:	e8 33 a4 ff ff       	call   80100604 <cprintf>
+801061d1:	83 c4 10             	add    $0x10,%esp
+801061d4:	eb 8e                	jmp    80106164 <procdumpP2+0xae>
+
+801061d6 <getprocs>:
+// slot is read like a seqlock: a copy that overlapped a change to
+// the slot's identity (see metabegin()) is thrown away and retried.
+// The other fields are single words and may each be a little stale.
+int
+getprocs(uint max, struct uproc* table)
+{
+801061d6:	55                   	push   %ebp
+801061d7:	89 e5                	mov    %esp,%ebp
+801061d9:	57                   	push   %edi
+801061da:	56                   	push   %esi
+801061db:	53                   	push   %ebx
+801061dc:	83 ec 7c             	sub    $0x7c,%esp
+  struct proc *p, *pp;
+  struct uproc u;
+  uint seq, prio, pepoch, epoch;
+  int proc_num = 0;
+
+  for(p = ptable.all; p != 0 && proc_num < max; p = p->allnext){
+801061df:	8b 1d 14 12 14 80    	mov    0x80141214,%ebx
+801061e5:	85 db                	test   %ebx,%ebx
+801061e7:	0f 84 3b 01 00 00    	je     80106328 <getprocs+0x152>
+801061ed:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+801061f1:	0f 84 31 01 00 00    	je     80106328 <getprocs+0x152>
+  int proc_num = 0;
+801061f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(p = ptable.all; p != 0 && proc_num < max; p = p->allnext){
+801061fc:	c7 45 84 00 00 00 00 	movl   $0x0,-0x7c(%ebp)
+  if(owed >= MAXPRIO - priority)
+80106203:	89 55 88             	mov    %edx,-0x78(%ebp)
+80106206:	e9 01 01 00 00       	jmp    8010630c <getprocs+0x136>
+      u.state = p->state;
+      u.pid = p->pid;
+      u.uid = p->uid;
+      u.gid = p->gid;
+      pp = p->parent;
+      u.ppid = pp ? pp->pid : u.pid;
+8010620b:	89 45 a8             	mov    %eax,-0x58(%ebp)
+      u.elapsed_ticks = ticks - p->start_ticks;
+8010620e:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80106213:	2b 83 cc 00 00 00    	sub    0xcc(%ebx),%eax
+80106219:	89 45 b8             	mov    %eax,-0x48(%ebp)
+      u.CPU_total_ticks = p->cpu_ticks_total;
+8010621c:	8b 83 d8 00 00 00    	mov    0xd8(%ebx),%eax
+80106222:	89 45 bc             	mov    %eax,-0x44(%ebp)
+      u.size = p->sz;
+80106225:	8b 03                	mov    (%ebx),%eax
+80106227:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      // Not curpriority(), which needs ptable.lock; a promotion
+      // racing with this copy only makes the answer one step stale.
+      prio = p->priority;
+8010622a:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+80106230:	89 45 8c             	mov    %eax,-0x74(%ebp)
+      pepoch = p->epoch;
+80106233:	8b 83 f4 00 00 00    	mov    0xf4(%ebx),%eax
+80106239:	89 45 94             	mov    %eax,-0x6c(%ebp)
+      epoch = ptable.epoch;
+8010623c:	8b 3d 78 16 14 80    	mov    0x80141678,%edi
+      u.lastcpu = p->lastcpu;
+80106242:	8b 83 fc 00 00 00    	mov    0xfc(%ebx),%eax
+80106248:	89 45 b0             	mov    %eax,-0x50(%ebp)
+      u.affinity = p->affinity;
+8010624b:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80106251:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+      safestrcpy(u.name, p->name, sizeof(p->name));
+80106254:	83 ec 04             	sub    $0x4,%esp
+80106257:	6a 10                	push   $0x10
+80106259:	ff 75 90             	push   -0x70(%ebp)
+8010625c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+8010625f:	50                   	push   %eax
+80106260:	e8 6a 15 00 00       	call   801077cf <safestrcpy>
+      __sync_synchronize();
+80106265:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    } while(p->seq != seq);
+8010626a:	8b 83 24 01 00 00    	mov    0x124(%ebx),%eax
+80106270:	83 c4 10             	add    $0x10,%esp
+80106273:	39 f0                	cmp    %esi,%eax
+80106275:	74 44                	je     801062bb <getprocs+0xe5>
+      while((seq = p->seq) & 1)
+80106277:	8b b3 24 01 00 00    	mov    0x124(%ebx),%esi
+8010627d:	f7 c6 01 00 00 00    	test   $0x1,%esi
+80106283:	75 f2                	jne    80106277 <getprocs+0xa1>
+      __sync_synchronize();
+80106285:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+      u.state = p->state;
+8010628a:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010628d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+      u.pid = p->pid;
+80106290:	8b 43 10             	mov    0x10(%ebx),%eax
+80106293:	89 45 9c             	mov    %eax,-0x64(%ebp)
+      u.uid = p->uid;
+80106296:	8b 93 d0 00 00 00    	mov    0xd0(%ebx),%edx
+8010629c:	89 55 a0             	mov    %edx,-0x60(%ebp)
+      u.gid = p->gid;
+8010629f:	8b 93 d4 00 00 00    	mov    0xd4(%ebx),%edx
+801062a5:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+      pp = p->parent;
+801062a8:	8b 53 14             	mov    0x14(%ebx),%edx
+      u.ppid = pp ? pp->pid : u.pid;
+801062ab:	85 d2                	test   %edx,%edx
+801062ad:	0f 84 58 ff ff ff    	je     8010620b <getprocs+0x35>
+801062b3:	8b 42 10             	mov    0x10(%edx),%eax
+801062b6:	e9 50 ff ff ff       	jmp    8010620b <getprocs+0x35>
+  uint owed = epoch - pepoch;
+801062bb:	8b 55 8c             	mov    -0x74(%ebp),%edx
+801062be:	8b 45 94             	mov    -0x6c(%ebp),%eax
+801062c1:	29 c7                	sub    %eax,%edi
+  if(owed >= MAXPRIO - priority)
+801062c3:	b9 06 00 00 00       	mov    $0x6,%ecx
+801062c8:	29 d1                	sub    %edx,%ecx
+  return priority + owed;
+801062ca:	8d 04 3a             	lea    (%edx,%edi,1),%eax
+801062cd:	39 cf                	cmp    %ecx,%edi
+801062cf:	b9 06 00 00 00       	mov    $0x6,%ecx
+801062d4:	0f 43 c1             	cmovae %ecx,%eax
+    u.priority = owedpriority(prio, pepoch, epoch);
+801062d7:	89 45 ac             	mov    %eax,-0x54(%ebp)
+
+    if(u.state != UNUSED && u.state != EMBRYO)
+801062da:	83 7d c0 01          	cmpl   $0x1,-0x40(%ebp)
+801062de:	76 17                	jbe    801062f7 <getprocs+0x121>
+      table[proc_num++] = u;
+801062e0:	83 45 88 01          	addl   $0x1,-0x78(%ebp)
+801062e4:	6b 45 84 4c          	imul   $0x4c,-0x7c(%ebp),%eax
+801062e8:	03 45 0c             	add    0xc(%ebp),%eax
+801062eb:	8d 75 9c             	lea    -0x64(%ebp),%esi
+801062ee:	b9 13 00 00 00       	mov    $0x13,%ecx
+801062f3:	89 c7                	mov    %eax,%edi
+801062f5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(p = ptable.all; p != 0 && proc_num < max; p = p->allnext){
+801062f7:	8b 9b 20 01 00 00    	mov    0x120(%ebx),%ebx
+801062fd:	8b 45 88             	mov    -0x78(%ebp),%eax
+80106300:	89 45 84             	mov    %eax,-0x7c(%ebp)
+80106303:	85 db                	test   %ebx,%ebx
+80106305:	74 10                	je     80106317 <getprocs+0x141>
+80106307:	3b 45 08             	cmp    0x8(%ebp),%eax
+8010630a:	73 0b                	jae    80106317 <getprocs+0x141>
+      safestrcpy(u.name, p->name, sizeof(p->name));
+8010630c:	8d 43 6c             	lea    0x6c(%ebx),%eax
+8010630f:	89 45 90             	mov    %eax,-0x70(%ebp)
+80106312:	e9 60 ff ff ff       	jmp    80106277 <getprocs+0xa1>
+  }
+
+  if(proc_num == 0)
+80106317:	8b 55 88             	mov    -0x78(%ebp),%edx
+8010631a:	85 d2                	test   %edx,%edx
+8010631c:	74 11                	je     8010632f <getprocs+0x159>
+    return -1;
+
+  return proc_num;
+}
+8010631e:	89 d0                	mov    %edx,%eax
+80106320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106323:	5b                   	pop    %ebx
+80106324:	5e                   	pop    %esi
+80106325:	5f                   	pop    %edi
+80106326:	5d                   	pop    %ebp
+80106327:	c3                   	ret
+    return -1;
+80106328:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010632d:	eb ef                	jmp    8010631e <getprocs+0x148>
+8010632f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80106334:	eb e8                	jmp    8010631e <getprocs+0x148>
+
+80106336 <metabegin>:
+// reads without ptable.lock.  An odd seq also shuts out other
+// writers, such as a reparent racing exec() renaming the child, so
+// the bracket must not be held across a lock or a sleep.
+void
+metabegin(struct proc *p)
+{
+80106336:	55                   	push   %ebp
+80106337:	89 e5                	mov    %esp,%ebp
+80106339:	53                   	push   %ebx
+8010633a:	83 ec 04             	sub    $0x4,%esp
+8010633d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint seq;
+
+  pushcli();
+80106340:	e8 9a 11 00 00       	call   801074df <pushcli>
+  do {
+    while((seq = p->seq) & 1)
+80106345:	8b 83 24 01 00 00    	mov    0x124(%ebx),%eax
+8010634b:	a8 01                	test   $0x1,%al
+8010634d:	75 f6                	jne    80106345 <metabegin+0xf>
+      ;
+  } while(!__sync_bool_compare_and_swap(&p->seq, seq, seq + 1));
+8010634f:	8d 50 01             	lea    0x1(%eax),%edx
+80106352:	f0 0f b1 93 24 01 00 	lock cmpxchg %edx,0x124(%ebx)
+80106359:	00 
+8010635a:	75 e9                	jne    80106345 <metabegin+0xf>
+}
+8010635c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010635f:	c9                   	leave
+80106360:	c3                   	ret
+
+80106361 <metaend>:
+
+void
+metaend(struct proc *p)
+{
+80106361:	55                   	push   %ebp
+80106362:	89 e5                	mov    %esp,%ebp
+80106364:	83 ec 08             	sub    $0x8,%esp
+80106367:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+8010636a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  p->seq++;
+8010636f:	8b 82 24 01 00 00    	mov    0x124(%edx),%eax
+80106375:	83 c0 01             	add    $0x1,%eax
+80106378:	89 82 24 01 00 00    	mov    %eax,0x124(%edx)
+  popcli();
+8010637e:	e8 98 11 00 00       	call   8010751b <popcli>
+}
+80106383:	c9                   	leave
+80106384:	c3                   	ret
+
+80106385 <allocproc>:
+{
+80106385:	55                   	push   %ebp
+80106386:	89 e5                	mov    %esp,%ebp
+80106388:	56                   	push   %esi
+80106389:	53                   	push   %ebx
+  acquire(&ptable.lock);
+8010638a:	83 ec 0c             	sub    $0xc,%esp
+8010638d:	68 e0 11 14 80       	push   $0x801411e0
+80106392:	e8 18 12 00 00       	call   801075af <acquire>
+  if(ptable.nproc >= ptable.params.maxproc ||
+80106397:	83 c4 10             	add    $0x10,%esp
+8010639a:	a1 a0 16 14 80       	mov    0x801416a0,%eax
+8010639f:	39 05 1c 12 14 80    	cmp    %eax,0x8014121c
+801063a5:	0f 83 fc 01 00 00    	jae    801065a7 <allocproc+0x222>
+801063ab:	83 3d 20 12 14 80 00 	cmpl   $0x0,0x80141220
+801063b2:	0f 84 86 01 00 00    	je     8010653e <allocproc+0x1b9>
+  ptable.nproc++;
+801063b8:	83 05 1c 12 14 80 01 	addl   $0x1,0x8014121c
+  p = ptable.list[UNUSED].head;
+801063bf:	8b 1d 20 12 14 80    	mov    0x80141220,%ebx
+  int rc = stateListRemove(&ptable.list[UNUSED], p);
+801063c5:	89 da                	mov    %ebx,%edx
+801063c7:	b8 20 12 14 80       	mov    $0x80141220,%eax
+801063cc:	e8 3a d9 ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+801063d1:	85 c0                	test   %eax,%eax
+801063d3:	0f 88 e8 01 00 00    	js     801065c1 <allocproc+0x23c>
+  assertState(p,UNUSED);
+801063d9:	ba 00 00 00 00       	mov    $0x0,%edx
+801063de:	89 d8                	mov    %ebx,%eax
+801063e0:	e8 9a dc ff ff       	call   8010407f <assertState>
+  p->state = EMBRYO;
+801063e5:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  stateListAdd(&ptable.list[EMBRYO],p);
+801063ec:	89 da                	mov    %ebx,%edx
+801063ee:	b8 28 12 14 80       	mov    $0x80141228,%eax
+801063f3:	e8 e7 d8 ff ff       	call   80103cdf <stateListAdd>
+  metabegin(p);
+801063f8:	83 ec 0c             	sub    $0xc,%esp
+801063fb:	53                   	push   %ebx
+801063fc:	e8 35 ff ff ff       	call   80106336 <metabegin>
+  p->pid = nextpid++;
+80106401:	a1 04 e0 10 80       	mov    0x8010e004,%eax
+80106406:	8d 50 01             	lea    0x1(%eax),%edx
+80106409:	89 15 04 e0 10 80    	mov    %edx,0x8010e004
+8010640f:	89 43 10             	mov    %eax,0x10(%ebx)
+  metaend(p);
+80106412:	89 1c 24             	mov    %ebx,(%esp)
+80106415:	e8 47 ff ff ff       	call   80106361 <metaend>
+  struct proc **pp = &ptable.pidhash[PIDHASH(p->pid)];
+8010641a:	8b 43 10             	mov    0x10(%ebx),%eax
+8010641d:	83 e0 3f             	and    $0x3f,%eax
+  p->pidnext = *pp;
+80106420:	05 90 61 00 00       	add    $0x6190,%eax
+80106425:	8b 14 85 e8 11 14 80 	mov    -0x7febee18(,%eax,4),%edx
+8010642c:	89 93 34 01 00 00    	mov    %edx,0x134(%ebx)
+  *pp = p;
+80106432:	89 1c 85 e8 11 14 80 	mov    %ebx,-0x7febee18(,%eax,4)
+  p->children = 0;
+80106439:	c7 83 38 01 00 00 00 	movl   $0x0,0x138(%ebx)
+80106440:	00 00 00 
+  p->nzombie = 0;
+80106443:	c7 83 44 01 00 00 00 	movl   $0x0,0x144(%ebx)
+8010644a:	00 00 00 
+  p->timeridx = -1;
+8010644d:	c7 83 54 01 00 00 ff 	movl   $0xffffffff,0x154(%ebx)
+80106454:	ff ff ff 
+  p->group = 0;
+80106457:	c7 83 28 01 00 00 00 	movl   $0x0,0x128(%ebx)
+8010645e:	00 00 00 
+  p->pass = 0;
+80106461:	c7 83 2c 01 00 00 00 	movl   $0x0,0x12c(%ebx)
+80106468:	00 00 00 
+  release(&ptable.lock);
+8010646b:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106472:	e8 9f 11 00 00       	call   80107616 <release>
+  if((p->kstack = kalloc()) == 0){
+80106477:	e8 0c c3 ff ff       	call   80102788 <kalloc>
+8010647c:	89 c6                	mov    %eax,%esi
+8010647e:	89 43 08             	mov    %eax,0x8(%ebx)
+80106481:	83 c4 10             	add    $0x10,%esp
+80106484:	85 c0                	test   %eax,%eax
+80106486:	0f 84 42 01 00 00    	je     801065ce <allocproc+0x249>
+  sp -= sizeof *p->tf;
+8010648c:	8d 80 b4 0f 00 00    	lea    0xfb4(%eax),%eax
+80106492:	89 43 18             	mov    %eax,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+80106495:	c7 86 b0 0f 00 00 3e 	movl   $0x80108d3e,0xfb0(%esi)
+8010649c:	8d 10 80 
+  sp -= sizeof *p->context;
+8010649f:	81 c6 9c 0f 00 00    	add    $0xf9c,%esi
+  p->context = (struct context*)sp;
+801064a5:	89 73 1c             	mov    %esi,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+801064a8:	83 ec 04             	sub    $0x4,%esp
+801064ab:	6a 14                	push   $0x14
+801064ad:	6a 00                	push   $0x0
+801064af:	56                   	push   %esi
+801064b0:	e8 a8 11 00 00       	call   8010765d <memset>
+  p->context->eip = (uint)forkret;
+801064b5:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801064b8:	c7 40 10 ad 41 10 80 	movl   $0x801041ad,0x10(%eax)
+  p->start_ticks = ticks;
+801064bf:	a1 40 db 15 80       	mov    0x8015db40,%eax
+801064c4:	89 83 cc 00 00 00    	mov    %eax,0xcc(%ebx)
+  p->cpu_ticks_total = 0;
+801064ca:	c7 83 d8 00 00 00 00 	movl   $0x0,0xd8(%ebx)
+801064d1:	00 00 00 
+  p->cpu_ticks_in = 0;
+801064d4:	c7 83 dc 00 00 00 00 	movl   $0x0,0xdc(%ebx)
+801064db:	00 00 00 
+  p->priority = PRIORITY;
+801064de:	c7 83 ec 00 00 00 06 	movl   $0x6,0xec(%ebx)
+801064e5:	00 00 00 
+  p->budget = ptable.params.budget;
+801064e8:	a1 98 16 14 80       	mov    0x80141698,%eax
+801064ed:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+  p->epoch = ptable.epoch;
+801064f3:	a1 78 16 14 80       	mov    0x80141678,%eax
+801064f8:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  p->affinity = (1U << ncpu) - 1;
+801064fe:	8b 0d 64 f9 13 80    	mov    0x8013f964,%ecx
+80106504:	b8 01 00 00 00       	mov    $0x1,%eax
+80106509:	d3 e0                	shl    %cl,%eax
+8010650b:	83 e8 01             	sub    $0x1,%eax
+8010650e:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+  p->lastcpu = -1;
+80106514:	c7 83 fc 00 00 00 ff 	movl   $0xffffffff,0xfc(%ebx)
+8010651b:	ff ff ff 
+  p->dl_runtime = p->dl_period = 0;
+8010651e:	c7 83 08 01 00 00 00 	movl   $0x0,0x108(%ebx)
+80106525:	00 00 00 
+80106528:	c7 83 04 01 00 00 00 	movl   $0x0,0x104(%ebx)
+8010652f:	00 00 00 
+  return p;
+80106532:	83 c4 10             	add    $0x10,%esp
+}
+80106535:	89 d8                	mov    %ebx,%eax
+80106537:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010653a:	5b                   	pop    %ebx
+8010653b:	5e                   	pop    %esi
+8010653c:	5d                   	pop    %ebp
+8010653d:	c3                   	ret
+  if((page = (struct proc*)kalloc()) == 0)
+8010653e:	e8 45 c2 ff ff       	call   80102788 <kalloc>
+80106543:	89 c3                	mov    %eax,%ebx
+80106545:	85 c0                	test   %eax,%eax
+80106547:	74 5e                	je     801065a7 <allocproc+0x222>
+  memset(page, 0, PGSIZE);
+80106549:	83 ec 04             	sub    $0x4,%esp
+8010654c:	68 00 10 00 00       	push   $0x1000
+80106551:	6a 00                	push   $0x0
+80106553:	50                   	push   %eax
+80106554:	e8 04 11 00 00       	call   8010765d <memset>
+  for(p = page; p < page + PGSIZE/sizeof(struct proc); p++){
+80106559:	8d b3 c8 0e 00 00    	lea    0xec8(%ebx),%esi
+8010655f:	83 c4 10             	add    $0x10,%esp
+80106562:	eb 1a                	jmp    8010657e <allocproc+0x1f9>
+      ptable.all = p;
+80106564:	89 1d 14 12 14 80    	mov    %ebx,0x80141214
+    ptable.alltail = p;
+8010656a:	89 1d 18 12 14 80    	mov    %ebx,0x80141218
+  for(p = page; p < page + PGSIZE/sizeof(struct proc); p++){
+80106570:	81 c3 58 01 00 00    	add    $0x158,%ebx
+80106576:	39 de                	cmp    %ebx,%esi
+80106578:	0f 84 3a fe ff ff    	je     801063b8 <allocproc+0x33>
+    p->state = UNUSED;
+8010657e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[UNUSED], p);
+80106585:	89 da                	mov    %ebx,%edx
+80106587:	b8 20 12 14 80       	mov    $0x80141220,%eax
+8010658c:	e8 4e d7 ff ff       	call   80103cdf <stateListAdd>
+    __sync_synchronize();  // p is ready before readers can find it
+80106591:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if(ptable.alltail)
+80106596:	a1 18 12 14 80       	mov    0x80141218,%eax
+8010659b:	85 c0                	test   %eax,%eax
+8010659d:	74 c5                	je     80106564 <allocproc+0x1df>
+      ptable.alltail->allnext = p;
+8010659f:	89 98 20 01 00 00    	mov    %ebx,0x120(%eax)
+801065a5:	eb c3                	jmp    8010656a <allocproc+0x1e5>
+    release(&ptable.lock);
+801065a7:	83 ec 0c             	sub    $0xc,%esp
+801065aa:	68 e0 11 14 80       	push   $0x801411e0
+801065af:	e8 62 10 00 00       	call   80107616 <release>
+    return 0;
+801065b4:	83 c4 10             	add    $0x10,%esp
+801065b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+801065bc:	e9 74 ff ff ff       	jmp    80106535 <allocproc+0x1b0>
+    panic("Error removing from UNUSED in allocproc().\n");
+801065c1:	83 ec 0c             	sub    $0xc,%esp
+801065c4:	68 c8 b7 10 80       	push   $0x8010b7c8
+801065c9:	e8 74 9d ff ff       	call   80100342 <panic>
+    acquire(&ptable.lock);
+801065ce:	83 ec 0c             	sub    $0xc,%esp
+801065d1:	68 e0 11 14 80       	push   $0x801411e0
+801065d6:	e8 d4 0f 00 00       	call   801075af <acquire>
+    int rc = stateListRemove(&ptable.list[EMBRYO],p);
+801065db:	89 da                	mov    %ebx,%edx
+801065dd:	b8 28 12 14 80       	mov    $0x80141228,%eax
+801065e2:	e8 24 d7 ff ff       	call   80103d0b <stateListRemove>
+    if(rc < 0)
+801065e7:	83 c4 10             	add    $0x10,%esp
+801065ea:	85 c0                	test   %eax,%eax
+801065ec:	78 44                	js     80106632 <allocproc+0x2ad>
+    pidhashRemove(p);
+801065ee:	89 d8                	mov    %ebx,%eax
+801065f0:	e8 1c d8 ff ff       	call   80103e11 <pidhashRemove>
+    ptable.nproc--;
+801065f5:	83 2d 1c 12 14 80 01 	subl   $0x1,0x8014121c
+    assertState(p,EMBRYO);
+801065fc:	ba 01 00 00 00       	mov    $0x1,%edx
+80106601:	89 d8                	mov    %ebx,%eax
+80106603:	e8 77 da ff ff       	call   8010407f <assertState>
+    p->state = UNUSED;
+80106608:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[UNUSED],p);
+8010660f:	89 da                	mov    %ebx,%edx
+80106611:	b8 20 12 14 80       	mov    $0x80141220,%eax
+80106616:	e8 c4 d6 ff ff       	call   80103cdf <stateListAdd>
+    release(&ptable.lock);
+8010661b:	83 ec 0c             	sub    $0xc,%esp
+8010661e:	68 e0 11 14 80       	push   $0x801411e0
+80106623:	e8 ee 0f 00 00       	call   80107616 <release>
+    return 0;
+80106628:	83 c4 10             	add    $0x10,%esp
+8010662b:	89 f3                	mov    %esi,%ebx
+8010662d:	e9 03 ff ff ff       	jmp    80106535 <allocproc+0x1b0>
+      panic("Error removing from EMBRYO in allocproc().\n");
+80106632:	83 ec 0c             	sub    $0xc,%esp
+80106635:	68 f4 b7 10 80       	push   $0x8010b7f4
+8010663a:	e8 03 9d ff ff       	call   80100342 <panic>
+
+8010663f <userinit>:
+{
+8010663f:	55                   	push   %ebp
+80106640:	89 e5                	mov    %esp,%ebp
+80106642:	53                   	push   %ebx
+80106643:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80106646:	68 e0 11 14 80       	push   $0x801411e0
+8010664b:	e8 5f 0f 00 00       	call   801075af <acquire>
+80106650:	83 c4 10             	add    $0x10,%esp
+  for(i = UNUSED; i<= ZOMBIE; i++){
+80106653:	b8 00 00 00 00       	mov    $0x0,%eax
+    ptable.list[i].head = NULL;
+80106658:	c7 04 c5 20 12 14 80 	movl   $0x0,-0x7febede0(,%eax,8)
+8010665f:	00 00 00 00 
+    ptable.list[i].tail = NULL;
+80106663:	c7 04 c5 24 12 14 80 	movl   $0x0,-0x7febeddc(,%eax,8)
+8010666a:	00 00 00 00 
+  for(i = UNUSED; i<= ZOMBIE; i++){
+8010666e:	83 c0 01             	add    $0x1,%eax
+80106671:	83 f8 06             	cmp    $0x6,%eax
+80106674:	75 e2                	jne    80106658 <userinit+0x19>
+    ptable.rq[c].epoch = ptable.epoch;
+80106676:	8b 0d 78 16 14 80    	mov    0x80141678,%ecx
+8010667c:	ba 38 00 00 00       	mov    $0x38,%edx
+80106681:	eb 56                	jmp    801066d9 <userinit+0x9a>
+    panic("userinit: out of memory?");
+80106683:	83 ec 0c             	sub    $0xc,%esp
+80106686:	68 e7 b4 10 80       	push   $0x8010b4e7
+8010668b:	e8 b2 9c ff ff       	call   80100342 <panic>
+    panic("Error removing from EMBRYO in userinit().\n");
+80106690:	83 ec 0c             	sub    $0xc,%esp
+80106693:	68 20 b8 10 80       	push   $0x8010b820
+80106698:	e8 a5 9c ff ff       	call   80100342 <panic>
+      ptable.rq[c].readymask[i] = 0;
+8010669d:	c7 82 84 12 14 80 00 	movl   $0x0,-0x7febed7c(%edx)
+801066a4:	00 00 00 
+    ptable.rq[c].nready = 0;
+801066a7:	c7 82 88 12 14 80 00 	movl   $0x0,-0x7febed78(%edx)
+801066ae:	00 00 00 
+    ptable.rq[c].epoch = ptable.epoch;
+801066b1:	89 8a 8c 12 14 80    	mov    %ecx,-0x7febed74(%edx)
+    ptable.rq[c].edf.head = NULL;
+801066b7:	c7 82 90 12 14 80 00 	movl   $0x0,-0x7febed70(%edx)
+801066be:	00 00 00 
+    ptable.rq[c].edf.tail = NULL;
+801066c1:	c7 82 94 12 14 80 00 	movl   $0x0,-0x7febed6c(%edx)
+801066c8:	00 00 00 
+  for(int c = 0; c < NCPU; c++){
+801066cb:	81 c2 84 00 00 00    	add    $0x84,%edx
+801066d1:	81 fa 58 04 00 00    	cmp    $0x458,%edx
+801066d7:	74 20                	je     801066f9 <userinit+0xba>
+    for(i = 0; i <= MAXPRIO; i++){
+801066d9:	8d 42 c8             	lea    -0x38(%edx),%eax
+      ptable.rq[c].ready[i].head = NULL;
+801066dc:	c7 80 84 12 14 80 00 	movl   $0x0,-0x7febed7c(%eax)
+801066e3:	00 00 00 
+      ptable.rq[c].ready[i].tail = NULL;
+801066e6:	c7 80 88 12 14 80 00 	movl   $0x0,-0x7febed78(%eax)
+801066ed:	00 00 00 
+    for(i = 0; i <= MAXPRIO; i++){
+801066f0:	83 c0 08             	add    $0x8,%eax
+801066f3:	39 c2                	cmp    %eax,%edx
+801066f5:	75 e5                	jne    801066dc <userinit+0x9d>
+801066f7:	eb a4                	jmp    8010669d <userinit+0x5e>
+  for(i = 0; i < NWAITQ; i++){
+801066f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    ptable.waitq[i].head = NULL;
+801066fe:	c7 04 c5 28 99 15 80 	movl   $0x0,-0x7fea66d8(,%eax,8)
+80106705:	00 00 00 00 
+    ptable.waitq[i].tail = NULL;
+80106709:	c7 04 c5 2c 99 15 80 	movl   $0x0,-0x7fea66d4(,%eax,8)
+80106710:	00 00 00 00 
+  for(i = 0; i < NWAITQ; i++){
+80106714:	83 c0 01             	add    $0x1,%eax
+80106717:	83 f8 40             	cmp    $0x40,%eax
+8010671a:	75 e2                	jne    801066fe <userinit+0xbf>
+  ptable.all = ptable.alltail = 0;
+8010671c:	c7 05 18 12 14 80 00 	movl   $0x0,0x80141218
+80106723:	00 00 00 
+80106726:	c7 05 14 12 14 80 00 	movl   $0x0,0x80141214
+8010672d:	00 00 00 
+  ptable.nproc = 0;
+80106730:	c7 05 1c 12 14 80 00 	movl   $0x0,0x8014121c
+80106737:	00 00 00 
+    ptable.params.quantum[i] = QUANTUM(i);
+8010673a:	c7 05 7c 16 14 80 50 	movl   $0x50,0x8014167c
+80106741:	00 00 00 
+80106744:	c7 05 80 16 14 80 50 	movl   $0x50,0x80141680
+8010674b:	00 00 00 
+8010674e:	c7 05 84 16 14 80 50 	movl   $0x50,0x80141684
+80106755:	00 00 00 
+80106758:	c7 05 88 16 14 80 50 	movl   $0x50,0x80141688
+8010675f:	00 00 00 
+80106762:	c7 05 8c 16 14 80 28 	movl   $0x28,0x8014168c
+80106769:	00 00 00 
+8010676c:	c7 05 90 16 14 80 14 	movl   $0x14,0x80141690
+80106773:	00 00 00 
+80106776:	c7 05 94 16 14 80 0a 	movl   $0xa,0x80141694
+8010677d:	00 00 00 
+  ptable.params.budget = BUDGET;
+80106780:	c7 05 98 16 14 80 2c 	movl   $0x12c,0x80141698
+80106787:	01 00 00 
+  ptable.params.promote = TICKS_TO_PROMOTE;
+8010678a:	c7 05 9c 16 14 80 e8 	movl   $0x3e8,0x8014169c
+80106791:	03 00 00 
+  ptable.params.maxproc = NPROC;
+80106794:	c7 05 a0 16 14 80 40 	movl   $0x40,0x801416a0
+8010679b:	00 00 00 
+  ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+8010679e:	a1 40 db 15 80       	mov    0x8015db40,%eax
+801067a3:	8d 90 e8 03 00 00    	lea    0x3e8(%eax),%edx
+801067a9:	89 15 70 16 14 80    	mov    %edx,0x80141670
+  ptable.BalanceAtTime = ticks + TICKS_TO_BALANCE;
+801067af:	83 c0 64             	add    $0x64,%eax
+801067b2:	a3 74 16 14 80       	mov    %eax,0x80141674
+  release(&ptable.lock);
+801067b7:	83 ec 0c             	sub    $0xc,%esp
+801067ba:	68 e0 11 14 80       	push   $0x801411e0
+801067bf:	e8 52 0e 00 00       	call   80107616 <release>
+  p = allocproc();
+801067c4:	e8 bc fb ff ff       	call   80106385 <allocproc>
+801067c9:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+801067cb:	a3 c0 11 14 80       	mov    %eax,0x801411c0
+  if((p->pgdir = setupkvm()) == 0)
+801067d0:	e8 9d 36 00 00       	call   80109e72 <setupkvm>
+801067d5:	89 43 04             	mov    %eax,0x4(%ebx)
+801067d8:	83 c4 10             	add    $0x10,%esp
+801067db:	85 c0                	test   %eax,%eax
+801067dd:	0f 84 a0 fe ff ff    	je     80106683 <userinit+0x44>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+801067e3:	83 ec 04             	sub    $0x4,%esp
+801067e6:	68 2c 00 00 00       	push   $0x2c
+801067eb:	68 60 e4 10 80       	push   $0x8010e460
+801067f0:	50                   	push   %eax
+801067f1:	e8 ff 38 00 00       	call   8010a0f5 <inituvm>
+  p->sz = PGSIZE;
+801067f6:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+801067fc:	83 c4 0c             	add    $0xc,%esp
+801067ff:	6a 4c                	push   $0x4c
+80106801:	6a 00                	push   $0x0
+80106803:	ff 73 18             	push   0x18(%ebx)
+80106806:	e8 52 0e 00 00       	call   8010765d <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+8010680b:	8b 43 18             	mov    0x18(%ebx),%eax
+8010680e:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106814:	8b 43 18             	mov    0x18(%ebx),%eax
+80106817:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+8010681d:	8b 43 18             	mov    0x18(%ebx),%eax
+80106820:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106824:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80106828:	8b 43 18             	mov    0x18(%ebx),%eax
+8010682b:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+8010682f:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80106833:	8b 43 18             	mov    0x18(%ebx),%eax
+80106836:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+8010683d:	8b 43 18             	mov    0x18(%ebx),%eax
+80106840:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80106847:	8b 43 18             	mov    0x18(%ebx),%eax
+8010684a:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  p->uid = UID;
+80106851:	c7 83 d0 00 00 00 00 	movl   $0x0,0xd0(%ebx)
+80106858:	00 00 00 
+  p->gid = GID;
+8010685b:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+80106862:	00 00 00 
+  p->parent = 0;
+80106865:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+8010686c:	83 c4 0c             	add    $0xc,%esp
+8010686f:	6a 10                	push   $0x10
+80106871:	68 00 b5 10 80       	push   $0x8010b500
+80106876:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80106879:	50                   	push   %eax
+8010687a:	e8 50 0f 00 00       	call   801077cf <safestrcpy>
+  p->cwd = namei("/");
+8010687f:	c7 04 24 09 b5 10 80 	movl   $0x8010b509,(%esp)
+80106886:	e8 b9 b5 ff ff       	call   80101e44 <namei>
+8010688b:	89 43 68             	mov    %eax,0x68(%ebx)
+  acquire(&ptable.lock);
+8010688e:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106895:	e8 15 0d 00 00       	call   801075af <acquire>
+  p->group = groupFind(p->uid);
+8010689a:	8b 83 d0 00 00 00    	mov    0xd0(%ebx),%eax
+801068a0:	e8 c3 d5 ff ff       	call   80103e68 <groupFind>
+801068a5:	89 83 28 01 00 00    	mov    %eax,0x128(%ebx)
+int rc = stateListRemove(&ptable.list[EMBRYO],p);
+801068ab:	89 da                	mov    %ebx,%edx
+801068ad:	b8 28 12 14 80       	mov    $0x80141228,%eax
+801068b2:	e8 54 d4 ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+801068b7:	83 c4 10             	add    $0x10,%esp
+801068ba:	85 c0                	test   %eax,%eax
+801068bc:	0f 88 ce fd ff ff    	js     80106690 <userinit+0x51>
+  assertState(p,EMBRYO);
+801068c2:	ba 01 00 00 00       	mov    $0x1,%edx
+801068c7:	89 d8                	mov    %ebx,%eax
+801068c9:	e8 b1 d7 ff ff       	call   8010407f <assertState>
+  p->state = RUNNABLE;
+801068ce:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  enqueue(selectrq(p),p);
+801068d5:	89 d8                	mov    %ebx,%eax
+801068d7:	e8 7a db ff ff       	call   80104456 <selectrq>
+801068dc:	89 da                	mov    %ebx,%edx
+801068de:	e8 77 dc ff ff       	call   8010455a <enqueue>
+  release(&ptable.lock);
+801068e3:	83 ec 0c             	sub    $0xc,%esp
+801068e6:	68 e0 11 14 80       	push   $0x801411e0
+801068eb:	e8 26 0d 00 00       	call   80107616 <release>
+}
+801068f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801068f3:	c9                   	leave
+801068f4:	c3                   	ret
+
+801068f5 <childAdd>:
+{
+801068f5:	55                   	push   %ebp
+801068f6:	89 e5                	mov    %esp,%ebp
+801068f8:	57                   	push   %edi
+801068f9:	56                   	push   %esi
+801068fa:	53                   	push   %ebx
+801068fb:	83 ec 1c             	sub    $0x1c,%esp
+801068fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106901:	89 d7                	mov    %edx,%edi
+  struct proc *prev = 0, *next = parent->children;
+80106903:	8b 98 38 01 00 00    	mov    0x138(%eax),%ebx
+  if(p->state != ZOMBIE)
+80106909:	83 7a 0c 05          	cmpl   $0x5,0xc(%edx)
+8010690d:	74 6e                	je     8010697d <childAdd+0x88>
+  struct proc *prev = 0, *next = parent->children;
+8010690f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    while(next && next->state == ZOMBIE){
+80106916:	85 db                	test   %ebx,%ebx
+80106918:	74 63                	je     8010697d <childAdd+0x88>
+8010691a:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+8010691e:	75 15                	jne    80106935 <childAdd+0x40>
+      next = next->sibnext;
+80106920:	8b b3 3c 01 00 00    	mov    0x13c(%ebx),%esi
+    while(next && next->state == ZOMBIE){
+80106926:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80106929:	85 f6                	test   %esi,%esi
+8010692b:	0f 84 81 00 00 00    	je     801069b2 <childAdd+0xbd>
+      next = next->sibnext;
+80106931:	89 f3                	mov    %esi,%ebx
+80106933:	eb e5                	jmp    8010691a <childAdd+0x25>
+  metabegin(p);
+80106935:	83 ec 0c             	sub    $0xc,%esp
+80106938:	57                   	push   %edi
+80106939:	e8 f8 f9 ff ff       	call   80106336 <metabegin>
+  p->parent = parent;
+8010693e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80106941:	89 47 14             	mov    %eax,0x14(%edi)
+  metaend(p);
+80106944:	89 3c 24             	mov    %edi,(%esp)
+80106947:	e8 15 fa ff ff       	call   80106361 <metaend>
+  p->sibprev = prev;
+8010694c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010694f:	89 87 40 01 00 00    	mov    %eax,0x140(%edi)
+  p->sibnext = next;
+80106955:	89 9f 3c 01 00 00    	mov    %ebx,0x13c(%edi)
+  if(prev)
+8010695b:	83 c4 10             	add    $0x10,%esp
+8010695e:	85 c0                	test   %eax,%eax
+80106960:	74 45                	je     801069a7 <childAdd+0xb2>
+    prev->sibnext = p;
+80106962:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106965:	89 b8 3c 01 00 00    	mov    %edi,0x13c(%eax)
+  if(next)
+8010696b:	85 db                	test   %ebx,%ebx
+8010696d:	74 06                	je     80106975 <childAdd+0x80>
+    next->sibprev = p;
+8010696f:	89 bb 40 01 00 00    	mov    %edi,0x140(%ebx)
+}
+80106975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106978:	5b                   	pop    %ebx
+80106979:	5e                   	pop    %esi
+8010697a:	5f                   	pop    %edi
+8010697b:	5d                   	pop    %ebp
+8010697c:	c3                   	ret
+  metabegin(p);
+8010697d:	83 ec 0c             	sub    $0xc,%esp
+80106980:	57                   	push   %edi
+80106981:	e8 b0 f9 ff ff       	call   80106336 <metabegin>
+  p->parent = parent;
+80106986:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80106989:	89 47 14             	mov    %eax,0x14(%edi)
+  metaend(p);
+8010698c:	89 3c 24             	mov    %edi,(%esp)
+8010698f:	e8 cd f9 ff ff       	call   80106361 <metaend>
+  p->sibprev = prev;
+80106994:	c7 87 40 01 00 00 00 	movl   $0x0,0x140(%edi)
+8010699b:	00 00 00 
+  p->sibnext = next;
+8010699e:	89 9f 3c 01 00 00    	mov    %ebx,0x13c(%edi)
+801069a4:	83 c4 10             	add    $0x10,%esp
+    parent->children = p;
+801069a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801069aa:	89 b8 38 01 00 00    	mov    %edi,0x138(%eax)
+801069b0:	eb b9                	jmp    8010696b <childAdd+0x76>
+  metabegin(p);
+801069b2:	83 ec 0c             	sub    $0xc,%esp
+801069b5:	57                   	push   %edi
+801069b6:	e8 7b f9 ff ff       	call   80106336 <metabegin>
+  p->parent = parent;
+801069bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801069be:	89 47 14             	mov    %eax,0x14(%edi)
+  metaend(p);
+801069c1:	89 3c 24             	mov    %edi,(%esp)
+801069c4:	e8 98 f9 ff ff       	call   80106361 <metaend>
+  p->sibprev = prev;
+801069c9:	89 9f 40 01 00 00    	mov    %ebx,0x140(%edi)
+  p->sibnext = next;
+801069cf:	c7 87 3c 01 00 00 00 	movl   $0x0,0x13c(%edi)
+801069d6:	00 00 00 
+801069d9:	83 c4 10             	add    $0x10,%esp
+801069dc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      next = next->sibnext;
+801069df:	89 f3                	mov    %esi,%ebx
+801069e1:	e9 7c ff ff ff       	jmp    80106962 <childAdd+0x6d>
+
+801069e6 <exit>:
+{
+801069e6:	55                   	push   %ebp
+801069e7:	89 e5                	mov    %esp,%ebp
+801069e9:	57                   	push   %edi
+801069ea:	56                   	push   %esi
+801069eb:	53                   	push   %ebx
+801069ec:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+801069ef:	e8 c4 dd ff ff       	call   801047b8 <myproc>
+801069f4:	89 c6                	mov    %eax,%esi
+  if(curproc == initproc)
+801069f6:	8d 58 28             	lea    0x28(%eax),%ebx
+801069f9:	8d 78 68             	lea    0x68(%eax),%edi
+801069fc:	39 05 c0 11 14 80    	cmp    %eax,0x801411c0
+80106a02:	75 26                	jne    80106a2a <exit+0x44>
+    panic("init exiting");
+80106a04:	83 ec 0c             	sub    $0xc,%esp
+80106a07:	68 0b b5 10 80       	push   $0x8010b50b
+80106a0c:	e8 31 99 ff ff       	call   80100342 <panic>
+      fileclose(curproc->ofile[fd]);
+80106a11:	83 ec 0c             	sub    $0xc,%esp
+80106a14:	50                   	push   %eax
+80106a15:	e8 82 a4 ff ff       	call   80100e9c <fileclose>
+      curproc->ofile[fd] = 0;
+80106a1a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+80106a20:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80106a23:	83 c3 04             	add    $0x4,%ebx
+80106a26:	39 fb                	cmp    %edi,%ebx
+80106a28:	74 08                	je     80106a32 <exit+0x4c>
+    if(curproc->ofile[fd]){
+80106a2a:	8b 03                	mov    (%ebx),%eax
+80106a2c:	85 c0                	test   %eax,%eax
+80106a2e:	75 e1                	jne    80106a11 <exit+0x2b>
+80106a30:	eb f1                	jmp    80106a23 <exit+0x3d>
+  begin_op();
+80106a32:	e8 12 c5 ff ff       	call   80102f49 <begin_op>
+  iput(curproc->cwd);
+80106a37:	83 ec 0c             	sub    $0xc,%esp
+80106a3a:	ff 76 68             	push   0x68(%esi)
+80106a3d:	e8 ed ac ff ff       	call   8010172f <iput>
+  end_op();
+80106a42:	e8 7d c5 ff ff       	call   80102fc4 <end_op>
+  curproc->cwd = 0;
+80106a47:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+  freeregions(curproc->region);
+80106a4e:	8d 46 7c             	lea    0x7c(%esi),%eax
+80106a51:	89 04 24             	mov    %eax,(%esp)
+80106a54:	e8 36 9f ff ff       	call   8010098f <freeregions>
+  acquire(&ptable.lock);
+80106a59:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106a60:	e8 4a 0b 00 00       	call   801075af <acquire>
+  strideCharge(curproc);
+80106a65:	89 f0                	mov    %esi,%eax
+80106a67:	e8 f1 d0 ff ff       	call   80103b5d <strideCharge>
+  if(curproc->dl_period){
+80106a6c:	8b 8e 08 01 00 00    	mov    0x108(%esi),%ecx
+80106a72:	83 c4 10             	add    $0x10,%esp
+80106a75:	85 c9                	test   %ecx,%ecx
+80106a77:	74 2f                	je     80106aa8 <exit+0xc2>
+    ptable.rq[curproc->dl_cpu].edfutil -=
+80106a79:	69 9e 18 01 00 00 84 	imul   $0x84,0x118(%esi),%ebx
+80106a80:	00 00 00 
+      EDFUTIL(curproc->dl_runtime, curproc->dl_period);
+80106a83:	69 86 04 01 00 00 e8 	imul   $0x3e8,0x104(%esi),%eax
+80106a8a:	03 00 00 
+80106a8d:	8d 44 01 ff          	lea    -0x1(%ecx,%eax,1),%eax
+80106a91:	ba 00 00 00 00       	mov    $0x0,%edx
+80106a96:	f7 f1                	div    %ecx
+    ptable.rq[curproc->dl_cpu].edfutil -=
+80106a98:	29 83 d0 12 14 80    	sub    %eax,-0x7febed30(%ebx)
+    curproc->dl_period = 0;
+80106a9e:	c7 86 08 01 00 00 00 	movl   $0x0,0x108(%esi)
+80106aa5:	00 00 00 
+  wakeup1(curproc->parent);
+80106aa8:	8b 46 14             	mov    0x14(%esi),%eax
+80106aab:	e8 d1 dc ff ff       	call   80104781 <wakeup1>
+  while((p = curproc->children) != 0){
+80106ab0:	8b 9e 38 01 00 00    	mov    0x138(%esi),%ebx
+80106ab6:	85 db                	test   %ebx,%ebx
+80106ab8:	74 1d                	je     80106ad7 <exit+0xf1>
+    childRemove(p);
+80106aba:	89 d8                	mov    %ebx,%eax
+80106abc:	e8 7c d1 ff ff       	call   80103c3d <childRemove>
+    childAdd(initproc, p);
+80106ac1:	89 da                	mov    %ebx,%edx
+80106ac3:	a1 c0 11 14 80       	mov    0x801411c0,%eax
+80106ac8:	e8 28 fe ff ff       	call   801068f5 <childAdd>
+  while((p = curproc->children) != 0){
+80106acd:	8b 9e 38 01 00 00    	mov    0x138(%esi),%ebx
+80106ad3:	85 db                	test   %ebx,%ebx
+80106ad5:	75 e3                	jne    80106aba <exit+0xd4>
+  if(curproc->nzombie){
+80106ad7:	8b 86 44 01 00 00    	mov    0x144(%esi),%eax
+80106add:	85 c0                	test   %eax,%eax
+80106adf:	75 5c                	jne    80106b3d <exit+0x157>
+  int rc = stateListRemove(&ptable.list[RUNNING], curproc);
+80106ae1:	89 f2                	mov    %esi,%edx
+80106ae3:	b8 40 12 14 80       	mov    $0x80141240,%eax
+80106ae8:	e8 1e d2 ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+80106aed:	85 c0                	test   %eax,%eax
+80106aef:	78 6b                	js     80106b5c <exit+0x176>
+  assertState(curproc, RUNNING);
+80106af1:	ba 04 00 00 00       	mov    $0x4,%edx
+80106af6:	89 f0                	mov    %esi,%eax
+80106af8:	e8 82 d5 ff ff       	call   8010407f <assertState>
+  curproc->state = ZOMBIE;
+80106afd:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  stateListAdd(&ptable.list[ZOMBIE],curproc);
+80106b04:	89 f2                	mov    %esi,%edx
+80106b06:	b8 48 12 14 80       	mov    $0x80141248,%eax
+80106b0b:	e8 cf d1 ff ff       	call   80103cdf <stateListAdd>
+  childRemove(curproc);
+80106b10:	89 f0                	mov    %esi,%eax
+80106b12:	e8 26 d1 ff ff       	call   80103c3d <childRemove>
+  childAdd(curproc->parent, curproc);
+80106b17:	8b 46 14             	mov    0x14(%esi),%eax
+80106b1a:	89 f2                	mov    %esi,%edx
+80106b1c:	e8 d4 fd ff ff       	call   801068f5 <childAdd>
+  curproc->parent->nzombie++;
+80106b21:	8b 46 14             	mov    0x14(%esi),%eax
+80106b24:	83 80 44 01 00 00 01 	addl   $0x1,0x144(%eax)
+  sched();
+80106b2b:	e8 84 dd ff ff       	call   801048b4 <sched>
+  panic("zombie exit");
+80106b30:	83 ec 0c             	sub    $0xc,%esp
+80106b33:	68 18 b5 10 80       	push   $0x8010b518
+80106b38:	e8 05 98 ff ff       	call   80100342 <panic>
+    initproc->nzombie += curproc->nzombie;
+80106b3d:	8b 15 c0 11 14 80    	mov    0x801411c0,%edx
+80106b43:	01 82 44 01 00 00    	add    %eax,0x144(%edx)
+    curproc->nzombie = 0;
+80106b49:	c7 86 44 01 00 00 00 	movl   $0x0,0x144(%esi)
+80106b50:	00 00 00 
+    wakeup1(initproc);
+80106b53:	89 d0                	mov    %edx,%eax
+80106b55:	e8 27 dc ff ff       	call   80104781 <wakeup1>
+80106b5a:	eb 85                	jmp    80106ae1 <exit+0xfb>
+    panic("Error removing from RUNNING in exit().\n");
+80106b5c:	83 ec 0c             	sub    $0xc,%esp
+80106b5f:	68 4c b8 10 80       	push   $0x8010b84c
+80106b64:	e8 d9 97 ff ff       	call   80100342 <panic>
+
+80106b69 <fork>:
+{
+80106b69:	55                   	push   %ebp
+80106b6a:	89 e5                	mov    %esp,%ebp
+80106b6c:	57                   	push   %edi
+80106b6d:	56                   	push   %esi
+80106b6e:	53                   	push   %ebx
+80106b6f:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80106b72:	e8 41 dc ff ff       	call   801047b8 <myproc>
+80106b77:	89 c3                	mov    %eax,%ebx
+  if((np = allocproc()) == 0){
+80106b79:	e8 07 f8 ff ff       	call   80106385 <allocproc>
+80106b7e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106b81:	85 c0                	test   %eax,%eax
+80106b83:	0f 84 37 02 00 00    	je     80106dc0 <fork+0x257>
+80106b89:	89 c7                	mov    %eax,%edi
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80106b8b:	83 ec 08             	sub    $0x8,%esp
+80106b8e:	ff 33                	push   (%ebx)
+80106b90:	ff 73 04             	push   0x4(%ebx)
+80106b93:	e8 ce 3a 00 00       	call   8010a666 <copyuvm>
+80106b98:	89 47 04             	mov    %eax,0x4(%edi)
+80106b9b:	83 c4 10             	add    $0x10,%esp
+80106b9e:	85 c0                	test   %eax,%eax
+80106ba0:	74 71                	je     80106c13 <fork+0xaa>
+  np->uid = curproc->uid;
+80106ba2:	8b 83 d0 00 00 00    	mov    0xd0(%ebx),%eax
+80106ba8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106bab:	89 87 d0 00 00 00    	mov    %eax,0xd0(%edi)
+  np->gid = curproc->gid;
+80106bb1:	8b 83 d4 00 00 00    	mov    0xd4(%ebx),%eax
+80106bb7:	89 87 d4 00 00 00    	mov    %eax,0xd4(%edi)
+  np->affinity = curproc->affinity;
+80106bbd:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80106bc3:	89 87 f8 00 00 00    	mov    %eax,0xf8(%edi)
+  np->group = curproc->group;
+80106bc9:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+80106bcf:	89 87 28 01 00 00    	mov    %eax,0x128(%edi)
+  np->sz = curproc->sz;
+80106bd5:	8b 03                	mov    (%ebx),%eax
+80106bd7:	89 07                	mov    %eax,(%edi)
+  metabegin(np);
+80106bd9:	83 ec 0c             	sub    $0xc,%esp
+80106bdc:	57                   	push   %edi
+80106bdd:	e8 54 f7 ff ff       	call   80106336 <metabegin>
+  np->parent = curproc;
+80106be2:	89 5f 14             	mov    %ebx,0x14(%edi)
+  metaend(np);
+80106be5:	89 3c 24             	mov    %edi,(%esp)
+80106be8:	e8 74 f7 ff ff       	call   80106361 <metaend>
+  *np->tf = *curproc->tf;
+80106bed:	8b 73 18             	mov    0x18(%ebx),%esi
+80106bf0:	89 f8                	mov    %edi,%eax
+80106bf2:	8b 7f 18             	mov    0x18(%edi),%edi
+80106bf5:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106bfa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  np->tf->eax = 0;
+80106bfc:	8b 40 18             	mov    0x18(%eax),%eax
+80106bff:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+80106c06:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NOFILE; i++)
+80106c09:	be 00 00 00 00       	mov    $0x0,%esi
+80106c0e:	e9 a6 00 00 00       	jmp    80106cb9 <fork+0x150>
+    kfree(np->kstack);
+80106c13:	83 ec 0c             	sub    $0xc,%esp
+80106c16:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80106c19:	ff 73 08             	push   0x8(%ebx)
+80106c1c:	e8 ae b9 ff ff       	call   801025cf <kfree>
+    np->kstack = 0;
+80106c21:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    acquire(&ptable.lock);
+80106c28:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106c2f:	e8 7b 09 00 00       	call   801075af <acquire>
+    int rc = stateListRemove(&ptable.list[EMBRYO],np);
+80106c34:	89 da                	mov    %ebx,%edx
+80106c36:	b8 28 12 14 80       	mov    $0x80141228,%eax
+80106c3b:	e8 cb d0 ff ff       	call   80103d0b <stateListRemove>
+    if(rc < 0)
+80106c40:	83 c4 10             	add    $0x10,%esp
+80106c43:	85 c0                	test   %eax,%eax
+80106c45:	78 4a                	js     80106c91 <fork+0x128>
+    pidhashRemove(np);
+80106c47:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80106c4a:	89 d8                	mov    %ebx,%eax
+80106c4c:	e8 c0 d1 ff ff       	call   80103e11 <pidhashRemove>
+    ptable.nproc--;
+80106c51:	83 2d 1c 12 14 80 01 	subl   $0x1,0x8014121c
+    assertState(np,EMBRYO);
+80106c58:	ba 01 00 00 00       	mov    $0x1,%edx
+80106c5d:	89 d8                	mov    %ebx,%eax
+80106c5f:	e8 1b d4 ff ff       	call   8010407f <assertState>
+    np->state = UNUSED;
+80106c64:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[UNUSED],np);
+80106c6b:	89 da                	mov    %ebx,%edx
+80106c6d:	b8 20 12 14 80       	mov    $0x80141220,%eax
+80106c72:	e8 68 d0 ff ff       	call   80103cdf <stateListAdd>
+    release(&ptable.lock);
+80106c77:	83 ec 0c             	sub    $0xc,%esp
+80106c7a:	68 e0 11 14 80       	push   $0x801411e0
+80106c7f:	e8 92 09 00 00       	call   80107616 <release>
+    return -1;
+80106c84:	83 c4 10             	add    $0x10,%esp
+80106c87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106c8c:	e9 1a 01 00 00       	jmp    80106dab <fork+0x242>
+      panic("Error removing from EMBRYO in fork().\n");
+80106c91:	83 ec 0c             	sub    $0xc,%esp
+80106c94:	68 74 b8 10 80       	push   $0x8010b874
+80106c99:	e8 a4 96 ff ff       	call   80100342 <panic>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80106c9e:	83 ec 0c             	sub    $0xc,%esp
+80106ca1:	50                   	push   %eax
+80106ca2:	e8 b0 a1 ff ff       	call   80100e57 <filedup>
+80106ca7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106caa:	89 44 b7 28          	mov    %eax,0x28(%edi,%esi,4)
+80106cae:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NOFILE; i++)
+80106cb1:	83 c6 01             	add    $0x1,%esi
+80106cb4:	83 fe 10             	cmp    $0x10,%esi
+80106cb7:	74 0a                	je     80106cc3 <fork+0x15a>
+    if(curproc->ofile[i])
+80106cb9:	8b 44 b3 28          	mov    0x28(%ebx,%esi,4),%eax
+80106cbd:	85 c0                	test   %eax,%eax
+80106cbf:	75 dd                	jne    80106c9e <fork+0x135>
+80106cc1:	eb ee                	jmp    80106cb1 <fork+0x148>
+  np->cwd = idup(curproc->cwd);
+80106cc3:	83 ec 0c             	sub    $0xc,%esp
+80106cc6:	ff 73 68             	push   0x68(%ebx)
+80106cc9:	e8 2f a9 ff ff       	call   801015fd <idup>
+80106cce:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106cd1:	89 42 68             	mov    %eax,0x68(%edx)
+80106cd4:	83 c4 10             	add    $0x10,%esp
+80106cd7:	be 7c 00 00 00       	mov    $0x7c,%esi
+80106cdc:	eb 0b                	jmp    80106ce9 <fork+0x180>
+  for(i = 0; i < NREGION; i++){
+80106cde:	83 c6 14             	add    $0x14,%esi
+80106ce1:	81 fe cc 00 00 00    	cmp    $0xcc,%esi
+80106ce7:	74 3b                	je     80106d24 <fork+0x1bb>
+    np->region[i] = curproc->region[i];
+80106ce9:	8b 04 33             	mov    (%ebx,%esi,1),%eax
+80106cec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106cef:	89 04 31             	mov    %eax,(%ecx,%esi,1)
+80106cf2:	8b 54 33 04          	mov    0x4(%ebx,%esi,1),%edx
+80106cf6:	89 54 31 04          	mov    %edx,0x4(%ecx,%esi,1)
+80106cfa:	8b 54 33 08          	mov    0x8(%ebx,%esi,1),%edx
+80106cfe:	89 54 31 08          	mov    %edx,0x8(%ecx,%esi,1)
+80106d02:	8b 54 33 0c          	mov    0xc(%ebx,%esi,1),%edx
+80106d06:	89 54 31 0c          	mov    %edx,0xc(%ecx,%esi,1)
+80106d0a:	8b 54 33 10          	mov    0x10(%ebx,%esi,1),%edx
+80106d0e:	89 54 31 10          	mov    %edx,0x10(%ecx,%esi,1)
+    if(np->region[i].ip)
+80106d12:	85 c0                	test   %eax,%eax
+80106d14:	74 c8                	je     80106cde <fork+0x175>
+      idupregion(np->region[i].ip);
+80106d16:	83 ec 0c             	sub    $0xc,%esp
+80106d19:	50                   	push   %eax
+80106d1a:	e8 80 ab ff ff       	call   8010189f <idupregion>
+80106d1f:	83 c4 10             	add    $0x10,%esp
+80106d22:	eb ba                	jmp    80106cde <fork+0x175>
+  metabegin(np);
+80106d24:	83 ec 0c             	sub    $0xc,%esp
+80106d27:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106d2a:	57                   	push   %edi
+80106d2b:	e8 06 f6 ff ff       	call   80106336 <metabegin>
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106d30:	83 c4 0c             	add    $0xc,%esp
+80106d33:	6a 10                	push   $0x10
+80106d35:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80106d38:	50                   	push   %eax
+80106d39:	8d 47 6c             	lea    0x6c(%edi),%eax
+80106d3c:	50                   	push   %eax
+80106d3d:	e8 8d 0a 00 00       	call   801077cf <safestrcpy>
+  metaend(np);
+80106d42:	89 3c 24             	mov    %edi,(%esp)
+80106d45:	e8 17 f6 ff ff       	call   80106361 <metaend>
+  pid = np->pid;
+80106d4a:	8b 77 10             	mov    0x10(%edi),%esi
+  acquire(&ptable.lock);
+80106d4d:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106d54:	e8 56 08 00 00       	call   801075af <acquire>
+    int rc = stateListRemove(&ptable.list[EMBRYO],np);
+80106d59:	89 fa                	mov    %edi,%edx
+80106d5b:	b8 28 12 14 80       	mov    $0x80141228,%eax
+80106d60:	e8 a6 cf ff ff       	call   80103d0b <stateListRemove>
+    if(rc < 0)
+80106d65:	83 c4 10             	add    $0x10,%esp
+80106d68:	85 c0                	test   %eax,%eax
+80106d6a:	78 47                	js     80106db3 <fork+0x24a>
+    assertState(np,EMBRYO);
+80106d6c:	ba 01 00 00 00       	mov    $0x1,%edx
+80106d71:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106d74:	89 f8                	mov    %edi,%eax
+80106d76:	e8 04 d3 ff ff       	call   8010407f <assertState>
+    np->state = RUNNABLE;
+80106d7b:	c7 47 0c 03 00 00 00 	movl   $0x3,0xc(%edi)
+    childAdd(curproc, np);
+80106d82:	89 fa                	mov    %edi,%edx
+80106d84:	89 d8                	mov    %ebx,%eax
+80106d86:	e8 6a fb ff ff       	call   801068f5 <childAdd>
+    enqueue(selectrq(np),np);
+80106d8b:	89 f8                	mov    %edi,%eax
+80106d8d:	e8 c4 d6 ff ff       	call   80104456 <selectrq>
+80106d92:	89 fa                	mov    %edi,%edx
+80106d94:	e8 c1 d7 ff ff       	call   8010455a <enqueue>
+  release(&ptable.lock);
+80106d99:	83 ec 0c             	sub    $0xc,%esp
+80106d9c:	68 e0 11 14 80       	push   $0x801411e0
+80106da1:	e8 70 08 00 00       	call   80107616 <release>
+  return pid;
+80106da6:	89 f0                	mov    %esi,%eax
+80106da8:	83 c4 10             	add    $0x10,%esp
+}
+80106dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106dae:	5b                   	pop    %ebx
+80106daf:	5e                   	pop    %esi
+80106db0:	5f                   	pop    %edi
+80106db1:	5d                   	pop    %ebp
+80106db2:	c3                   	ret
+      panic("Error removing from EMBRYO in fork().\n");
+80106db3:	83 ec 0c             	sub    $0xc,%esp
+80106db6:	68 74 b8 10 80       	push   $0x8010b874
+80106dbb:	e8 82 95 ff ff       	call   80100342 <panic>
+    return -1;
+80106dc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106dc5:	eb e4                	jmp    80106dab <fork+0x242>
+
+80106dc7 <reap>:
+{
+80106dc7:	55                   	push   %ebp
+80106dc8:	89 e5                	mov    %esp,%ebp
+80106dca:	56                   	push   %esi
+80106dcb:	53                   	push   %ebx
+80106dcc:	89 c3                	mov    %eax,%ebx
+  pid = p->pid;
+80106dce:	8b 70 10             	mov    0x10(%eax),%esi
+  kfree(p->kstack);
+80106dd1:	83 ec 0c             	sub    $0xc,%esp
+80106dd4:	ff 70 08             	push   0x8(%eax)
+80106dd7:	e8 f3 b7 ff ff       	call   801025cf <kfree>
+  p->kstack = 0;
+80106ddc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  freevm(p->pgdir);
+80106de3:	83 c4 04             	add    $0x4,%esp
+80106de6:	ff 73 04             	push   0x4(%ebx)
+80106de9:	e8 c0 37 00 00       	call   8010a5ae <freevm>
+  int rc = stateListRemove(&ptable.list[ZOMBIE],p);
+80106dee:	89 da                	mov    %ebx,%edx
+80106df0:	b8 48 12 14 80       	mov    $0x80141248,%eax
+80106df5:	e8 11 cf ff ff       	call   80103d0b <stateListRemove>
+  if(rc < 0)
+80106dfa:	83 c4 10             	add    $0x10,%esp
+80106dfd:	85 c0                	test   %eax,%eax
+80106dff:	78 7d                	js     80106e7e <reap+0xb7>
+  assertState(p,ZOMBIE);
+80106e01:	ba 05 00 00 00       	mov    $0x5,%edx
+80106e06:	89 d8                	mov    %ebx,%eax
+80106e08:	e8 72 d2 ff ff       	call   8010407f <assertState>
+  p->state = UNUSED;
+80106e0d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  stateListAdd(&ptable.list[UNUSED],p);
+80106e14:	89 da                	mov    %ebx,%edx
+80106e16:	b8 20 12 14 80       	mov    $0x80141220,%eax
+80106e1b:	e8 bf ce ff ff       	call   80103cdf <stateListAdd>
+  childRemove(p);
+80106e20:	89 d8                	mov    %ebx,%eax
+80106e22:	e8 16 ce ff ff       	call   80103c3d <childRemove>
+  p->parent->nzombie--;
+80106e27:	8b 43 14             	mov    0x14(%ebx),%eax
+80106e2a:	83 a8 44 01 00 00 01 	subl   $0x1,0x144(%eax)
+  pidhashRemove(p);
+80106e31:	89 d8                	mov    %ebx,%eax
+80106e33:	e8 d9 cf ff ff       	call   80103e11 <pidhashRemove>
+  ptable.nproc--;
+80106e38:	83 2d 1c 12 14 80 01 	subl   $0x1,0x8014121c
+  metabegin(p);
+80106e3f:	83 ec 0c             	sub    $0xc,%esp
+80106e42:	53                   	push   %ebx
+80106e43:	e8 ee f4 ff ff       	call   80106336 <metabegin>
+  p->pid = 0;
+80106e48:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  p->parent = 0;
+80106e4f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  p->name[0] = 0;
+80106e56:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+  metaend(p);
+80106e5a:	89 1c 24             	mov    %ebx,(%esp)
+80106e5d:	e8 ff f4 ff ff       	call   80106361 <metaend>
+  p->killed = 0;
+80106e62:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+  release(&ptable.lock);
+80106e69:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80106e70:	e8 a1 07 00 00       	call   80107616 <release>
+}
+80106e75:	89 f0                	mov    %esi,%eax
+80106e77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106e7a:	5b                   	pop    %ebx
+80106e7b:	5e                   	pop    %esi
+80106e7c:	5d                   	pop    %ebp
+80106e7d:	c3                   	ret
+    panic("Error removing from ZOMBIE in wait().\n");
+80106e7e:	83 ec 0c             	sub    $0xc,%esp
+80106e81:	68 9c b8 10 80       	push   $0x8010b89c
+80106e86:	e8 b7 94 ff ff       	call   80100342 <panic>
+
+80106e8b <wait>:
+{
+80106e8b:	55                   	push   %ebp
+80106e8c:	89 e5                	mov    %esp,%ebp
+80106e8e:	53                   	push   %ebx
+80106e8f:	83 ec 04             	sub    $0x4,%esp
+  struct proc *curproc = myproc();
+80106e92:	e8 21 d9 ff ff       	call   801047b8 <myproc>
+80106e97:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+80106e99:	83 ec 0c             	sub    $0xc,%esp
+80106e9c:	68 e0 11 14 80       	push   $0x801411e0
+80106ea1:	e8 09 07 00 00       	call   801075af <acquire>
+    p = curproc->children;
+80106ea6:	8b 83 38 01 00 00    	mov    0x138(%ebx),%eax
+    if(p != 0 && p->state == ZOMBIE)
+80106eac:	83 c4 10             	add    $0x10,%esp
+80106eaf:	85 c0                	test   %eax,%eax
+80106eb1:	74 27                	je     80106eda <wait+0x4f>
+80106eb3:	83 78 0c 05          	cmpl   $0x5,0xc(%eax)
+80106eb7:	74 3b                	je     80106ef4 <wait+0x69>
+    if(p == 0 || curproc->killed){
+80106eb9:	83 7b 24 00          	cmpl   $0x0,0x24(%ebx)
+80106ebd:	75 1b                	jne    80106eda <wait+0x4f>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+80106ebf:	83 ec 08             	sub    $0x8,%esp
+80106ec2:	68 e0 11 14 80       	push   $0x801411e0
+80106ec7:	53                   	push   %ebx
+80106ec8:	e8 4e dc ff ff       	call   80104b1b <sleep>
+    p = curproc->children;
+80106ecd:	8b 83 38 01 00 00    	mov    0x138(%ebx),%eax
+    if(p != 0 && p->state == ZOMBIE)
+80106ed3:	83 c4 10             	add    $0x10,%esp
+80106ed6:	85 c0                	test   %eax,%eax
+80106ed8:	75 d9                	jne    80106eb3 <wait+0x28>
+      release(&ptable.lock);
+80106eda:	83 ec 0c             	sub    $0xc,%esp
+80106edd:	68 e0 11 14 80       	push   $0x801411e0
+80106ee2:	e8 2f 07 00 00       	call   80107616 <release>
+      return -1;
+80106ee7:	83 c4 10             	add    $0x10,%esp
+80106eea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106eef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106ef2:	c9                   	leave
+80106ef3:	c3                   	ret
+      return reap(p);
+80106ef4:	e8 ce fe ff ff       	call   80106dc7 <reap>
+80106ef9:	eb f4                	jmp    80106eef <wait+0x64>
+
+80106efb <waitpid>:
+{
+80106efb:	55                   	push   %ebp
+80106efc:	89 e5                	mov    %esp,%ebp
+80106efe:	56                   	push   %esi
+80106eff:	53                   	push   %ebx
+80106f00:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+80106f03:	e8 b0 d8 ff ff       	call   801047b8 <myproc>
+  if(pid == -1)
+80106f08:	83 fe ff             	cmp    $0xffffffff,%esi
+80106f0b:	74 41                	je     80106f4e <waitpid+0x53>
+80106f0d:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+80106f0f:	83 ec 0c             	sub    $0xc,%esp
+80106f12:	68 e0 11 14 80       	push   $0x801411e0
+80106f17:	e8 93 06 00 00       	call   801075af <acquire>
+80106f1c:	83 c4 10             	add    $0x10,%esp
+    p = findproc(pid);
+80106f1f:	89 f0                	mov    %esi,%eax
+80106f21:	e8 f7 cc ff ff       	call   80103c1d <findproc>
+    if(p == 0 || p->parent != curproc || curproc->killed){
+80106f26:	85 c0                	test   %eax,%eax
+80106f28:	74 2b                	je     80106f55 <waitpid+0x5a>
+80106f2a:	39 58 14             	cmp    %ebx,0x14(%eax)
+80106f2d:	75 26                	jne    80106f55 <waitpid+0x5a>
+80106f2f:	83 7b 24 00          	cmpl   $0x0,0x24(%ebx)
+80106f33:	75 20                	jne    80106f55 <waitpid+0x5a>
+    if(p->state == ZOMBIE)
+80106f35:	83 78 0c 05          	cmpl   $0x5,0xc(%eax)
+80106f39:	74 36                	je     80106f71 <waitpid+0x76>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+80106f3b:	83 ec 08             	sub    $0x8,%esp
+80106f3e:	68 e0 11 14 80       	push   $0x801411e0
+80106f43:	53                   	push   %ebx
+80106f44:	e8 d2 db ff ff       	call   80104b1b <sleep>
+    p = findproc(pid);
+80106f49:	83 c4 10             	add    $0x10,%esp
+80106f4c:	eb d1                	jmp    80106f1f <waitpid+0x24>
+    return wait();
+80106f4e:	e8 38 ff ff ff       	call   80106e8b <wait>
+80106f53:	eb 15                	jmp    80106f6a <waitpid+0x6f>
+      release(&ptable.lock);
+80106f55:	83 ec 0c             	sub    $0xc,%esp
+80106f58:	68 e0 11 14 80       	push   $0x801411e0
+80106f5d:	e8 b4 06 00 00       	call   80107616 <release>
+      return -1;
+80106f62:	83 c4 10             	add    $0x10,%esp
+80106f65:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106f6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106f6d:	5b                   	pop    %ebx
+80106f6e:	5e                   	pop    %esi
+80106f6f:	5d                   	pop    %ebp
+80106f70:	c3                   	ret
+      return reap(p);
+80106f71:	e8 51 fe ff ff       	call   80106dc7 <reap>
+80106f76:	eb f2                	jmp    80106f6a <waitpid+0x6f>
+
+80106f78 <spawn>:
+{
+80106f78:	55                   	push   %ebp
+80106f79:	89 e5                	mov    %esp,%ebp
+80106f7b:	57                   	push   %edi
+80106f7c:	56                   	push   %esi
+80106f7d:	53                   	push   %ebx
+80106f7e:	83 ec 2c             	sub    $0x2c,%esp
+80106f81:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct proc *curproc = myproc();
+80106f84:	e8 2f d8 ff ff       	call   801047b8 <myproc>
+80106f89:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < NOFILE; i++)
+80106f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+    open[i] = curproc->ofile[i] != 0;
+80106f90:	83 7c 83 28 00       	cmpl   $0x0,0x28(%ebx,%eax,4)
+80106f95:	0f 95 44 05 d8       	setne  -0x28(%ebp,%eax,1)
+  for(i = 0; i < NOFILE; i++)
+80106f9a:	83 c0 01             	add    $0x1,%eax
+80106f9d:	83 f8 10             	cmp    $0x10,%eax
+80106fa0:	75 ee                	jne    80106f90 <spawn+0x18>
+80106fa2:	89 75 cc             	mov    %esi,-0x34(%ebp)
+80106fa5:	89 f0                	mov    %esi,%eax
+  for(n = 0; n < SPAWN_MAXFD && fa[n].op != SPAWN_END; n++){
+80106fa7:	be 00 00 00 00       	mov    $0x0,%esi
+80106fac:	eb 2e                	jmp    80106fdc <spawn+0x64>
+      if(fa[n].newfd < 0 || fa[n].newfd >= NOFILE || !open[fa[n].fd])
+80106fae:	8b 57 08             	mov    0x8(%edi),%edx
+80106fb1:	83 fa 0f             	cmp    $0xf,%edx
+80106fb4:	0f 87 c9 02 00 00    	ja     80107283 <spawn+0x30b>
+80106fba:	80 7c 0d d8 00       	cmpb   $0x0,-0x28(%ebp,%ecx,1)
+80106fbf:	0f 84 c8 02 00 00    	je     8010728d <spawn+0x315>
+      open[fa[n].newfd] = 1;
+80106fc5:	c6 44 15 d8 01       	movb   $0x1,-0x28(%ebp,%edx,1)
+      break;
+80106fca:	eb 05                	jmp    80106fd1 <spawn+0x59>
+      open[fa[n].fd] = 0;
+80106fcc:	c6 44 0d d8 00       	movb   $0x0,-0x28(%ebp,%ecx,1)
+  for(n = 0; n < SPAWN_MAXFD && fa[n].op != SPAWN_END; n++){
+80106fd1:	83 c6 01             	add    $0x1,%esi
+80106fd4:	83 c0 0c             	add    $0xc,%eax
+80106fd7:	83 fe 10             	cmp    $0x10,%esi
+80106fda:	74 2b                	je     80107007 <spawn+0x8f>
+80106fdc:	89 c7                	mov    %eax,%edi
+80106fde:	8b 10                	mov    (%eax),%edx
+80106fe0:	85 d2                	test   %edx,%edx
+80106fe2:	74 23                	je     80107007 <spawn+0x8f>
+    if(fa[n].fd < 0 || fa[n].fd >= NOFILE)
+80106fe4:	8b 48 04             	mov    0x4(%eax),%ecx
+80106fe7:	83 f9 0f             	cmp    $0xf,%ecx
+80106fea:	0f 87 89 02 00 00    	ja     80107279 <spawn+0x301>
+    switch(fa[n].op){
+80106ff0:	83 fa 01             	cmp    $0x1,%edx
+80106ff3:	74 b9                	je     80106fae <spawn+0x36>
+80106ff5:	83 fa 02             	cmp    $0x2,%edx
+80106ff8:	74 d2                	je     80106fcc <spawn+0x54>
+80106ffa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106fff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107002:	5b                   	pop    %ebx
+80107003:	5e                   	pop    %esi
+80107004:	5f                   	pop    %edi
+80107005:	5d                   	pop    %ebp
+80107006:	c3                   	ret
+  if((np = allocproc()) == 0)
+80107007:	89 75 d0             	mov    %esi,-0x30(%ebp)
+8010700a:	e8 76 f3 ff ff       	call   80106385 <allocproc>
+8010700f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80107012:	85 c0                	test   %eax,%eax
+80107014:	0f 84 7d 02 00 00    	je     80107297 <spawn+0x31f>
+  *np->tf = *curproc->tf;  // Segment registers and eflags
+8010701a:	8b 73 18             	mov    0x18(%ebx),%esi
+8010701d:	8b 78 18             	mov    0x18(%eax),%edi
+80107020:	b9 13 00 00 00       	mov    $0x13,%ecx
+80107025:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  if(execload(path, argv, &np->pgdir, &np->sz, np->region, np->tf) < 0){
+80107027:	83 ec 08             	sub    $0x8,%esp
+8010702a:	89 c7                	mov    %eax,%edi
+8010702c:	ff 70 18             	push   0x18(%eax)
+8010702f:	8d 40 7c             	lea    0x7c(%eax),%eax
+80107032:	50                   	push   %eax
+80107033:	57                   	push   %edi
+80107034:	8d 47 04             	lea    0x4(%edi),%eax
+80107037:	50                   	push   %eax
+80107038:	ff 75 0c             	push   0xc(%ebp)
+8010703b:	ff 75 08             	push   0x8(%ebp)
+8010703e:	e8 8b 99 ff ff       	call   801009ce <execload>
+80107043:	83 c4 20             	add    $0x20,%esp
+80107046:	85 c0                	test   %eax,%eax
+80107048:	78 54                	js     8010709e <spawn+0x126>
+  np->uid = curproc->uid;
+8010704a:	8b 83 d0 00 00 00    	mov    0xd0(%ebx),%eax
+80107050:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107053:	89 87 d0 00 00 00    	mov    %eax,0xd0(%edi)
+  np->gid = curproc->gid;
+80107059:	8b 83 d4 00 00 00    	mov    0xd4(%ebx),%eax
+8010705f:	89 87 d4 00 00 00    	mov    %eax,0xd4(%edi)
+  np->affinity = curproc->affinity;
+80107065:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+8010706b:	89 87 f8 00 00 00    	mov    %eax,0xf8(%edi)
+  np->group = curproc->group;
+80107071:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+80107077:	89 87 28 01 00 00    	mov    %eax,0x128(%edi)
+  metabegin(np);
+8010707d:	83 ec 0c             	sub    $0xc,%esp
+80107080:	57                   	push   %edi
+80107081:	e8 b0 f2 ff ff       	call   80106336 <metabegin>
+  np->parent = curproc;
+80107086:	89 5f 14             	mov    %ebx,0x14(%edi)
+  metaend(np);
+80107089:	89 3c 24             	mov    %edi,(%esp)
+8010708c:	e8 d0 f2 ff ff       	call   80106361 <metaend>
+80107091:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NOFILE; i++)
+80107094:	be 00 00 00 00       	mov    $0x0,%esi
+80107099:	e9 90 00 00 00       	jmp    8010712e <spawn+0x1b6>
+    kfree(np->kstack);
+8010709e:	83 ec 0c             	sub    $0xc,%esp
+801070a1:	ff 77 08             	push   0x8(%edi)
+801070a4:	e8 26 b5 ff ff       	call   801025cf <kfree>
+    np->kstack = 0;
+801070a9:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    acquire(&ptable.lock);
+801070b0:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+801070b7:	e8 f3 04 00 00       	call   801075af <acquire>
+    if(stateListRemove(&ptable.list[EMBRYO],np) < 0)
+801070bc:	89 fa                	mov    %edi,%edx
+801070be:	b8 28 12 14 80       	mov    $0x80141228,%eax
+801070c3:	e8 43 cc ff ff       	call   80103d0b <stateListRemove>
+801070c8:	83 c4 10             	add    $0x10,%esp
+801070cb:	85 c0                	test   %eax,%eax
+801070cd:	78 4a                	js     80107119 <spawn+0x1a1>
+    pidhashRemove(np);
+801070cf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+801070d2:	89 f8                	mov    %edi,%eax
+801070d4:	e8 38 cd ff ff       	call   80103e11 <pidhashRemove>
+    ptable.nproc--;
+801070d9:	83 2d 1c 12 14 80 01 	subl   $0x1,0x8014121c
+    assertState(np,EMBRYO);
+801070e0:	ba 01 00 00 00       	mov    $0x1,%edx
+801070e5:	89 f8                	mov    %edi,%eax
+801070e7:	e8 93 cf ff ff       	call   8010407f <assertState>
+    np->state = UNUSED;
+801070ec:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+    stateListAdd(&ptable.list[UNUSED],np);
+801070f3:	89 fa                	mov    %edi,%edx
+801070f5:	b8 20 12 14 80       	mov    $0x80141220,%eax
+801070fa:	e8 e0 cb ff ff       	call   80103cdf <stateListAdd>
+    release(&ptable.lock);
+801070ff:	83 ec 0c             	sub    $0xc,%esp
+80107102:	68 e0 11 14 80       	push   $0x801411e0
+80107107:	e8 0a 05 00 00       	call   80107616 <release>
+    return -1;
+8010710c:	83 c4 10             	add    $0x10,%esp
+8010710f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107114:	e9 e6 fe ff ff       	jmp    80106fff <spawn+0x87>
+      panic("Error removing from EMBRYO in spawn().\n");
+80107119:	83 ec 0c             	sub    $0xc,%esp
+8010711c:	68 c4 b8 10 80       	push   $0x8010b8c4
+80107121:	e8 1c 92 ff ff       	call   80100342 <panic>
+  for(i = 0; i < NOFILE; i++)
+80107126:	83 c6 01             	add    $0x1,%esi
+80107129:	83 fe 10             	cmp    $0x10,%esi
+8010712c:	74 1a                	je     80107148 <spawn+0x1d0>
+    if(curproc->ofile[i])
+8010712e:	8b 44 b3 28          	mov    0x28(%ebx,%esi,4),%eax
+80107132:	85 c0                	test   %eax,%eax
+80107134:	74 f0                	je     80107126 <spawn+0x1ae>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80107136:	83 ec 0c             	sub    $0xc,%esp
+80107139:	50                   	push   %eax
+8010713a:	e8 18 9d ff ff       	call   80100e57 <filedup>
+8010713f:	89 44 b7 28          	mov    %eax,0x28(%edi,%esi,4)
+80107143:	83 c4 10             	add    $0x10,%esp
+80107146:	eb de                	jmp    80107126 <spawn+0x1ae>
+  for(i = 0; i < n; i++){
+80107148:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+8010714c:	7e 7d                	jle    801071cb <spawn+0x253>
+8010714e:	bf 00 00 00 00       	mov    $0x0,%edi
+80107153:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+80107156:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+80107159:	eb 24                	jmp    8010717f <spawn+0x207>
+      f = np->ofile[fa[i].fd];
+8010715b:	8b 43 04             	mov    0x4(%ebx),%eax
+8010715e:	83 c0 08             	add    $0x8,%eax
+80107161:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80107164:	8b 74 81 08          	mov    0x8(%ecx,%eax,4),%esi
+      np->ofile[fa[i].fd] = 0;
+80107168:	c7 44 81 08 00 00 00 	movl   $0x0,0x8(%ecx,%eax,4)
+8010716f:	00 
+80107170:	eb 44                	jmp    801071b6 <spawn+0x23e>
+  for(i = 0; i < n; i++){
+80107172:	83 c7 01             	add    $0x1,%edi
+80107175:	83 c3 0c             	add    $0xc,%ebx
+80107178:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010717b:	39 c7                	cmp    %eax,%edi
+8010717d:	74 49                	je     801071c8 <spawn+0x250>
+    if(fa[i].op == SPAWN_CLOSE){
+8010717f:	83 3b 02             	cmpl   $0x2,(%ebx)
+80107182:	74 d7                	je     8010715b <spawn+0x1e3>
+    } else if(fa[i].newfd != fa[i].fd){
+80107184:	8b 53 08             	mov    0x8(%ebx),%edx
+80107187:	8b 43 04             	mov    0x4(%ebx),%eax
+8010718a:	39 c2                	cmp    %eax,%edx
+8010718c:	74 e4                	je     80107172 <spawn+0x1fa>
+      f = np->ofile[fa[i].newfd];
+8010718e:	8d 4a 08             	lea    0x8(%edx),%ecx
+80107191:	89 ca                	mov    %ecx,%edx
+80107193:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80107196:	89 55 cc             	mov    %edx,-0x34(%ebp)
+80107199:	8b 74 91 08          	mov    0x8(%ecx,%edx,4),%esi
+      np->ofile[fa[i].newfd] = filedup(np->ofile[fa[i].fd]);
+8010719d:	83 ec 0c             	sub    $0xc,%esp
+801071a0:	ff 74 81 28          	push   0x28(%ecx,%eax,4)
+801071a4:	e8 ae 9c ff ff       	call   80100e57 <filedup>
+801071a9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+801071ac:	8b 55 cc             	mov    -0x34(%ebp),%edx
+801071af:	89 44 91 08          	mov    %eax,0x8(%ecx,%edx,4)
+801071b3:	83 c4 10             	add    $0x10,%esp
+    if(f)
+801071b6:	85 f6                	test   %esi,%esi
+801071b8:	74 b8                	je     80107172 <spawn+0x1fa>
+      fileclose(f);
+801071ba:	83 ec 0c             	sub    $0xc,%esp
+801071bd:	56                   	push   %esi
+801071be:	e8 d9 9c ff ff       	call   80100e9c <fileclose>
+801071c3:	83 c4 10             	add    $0x10,%esp
+801071c6:	eb aa                	jmp    80107172 <spawn+0x1fa>
+801071c8:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  np->cwd = idup(curproc->cwd);
+801071cb:	83 ec 0c             	sub    $0xc,%esp
+801071ce:	ff 73 68             	push   0x68(%ebx)
+801071d1:	e8 27 a4 ff ff       	call   801015fd <idup>
+801071d6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+801071d9:	89 47 68             	mov    %eax,0x68(%edi)
+  metabegin(np);
+801071dc:	89 3c 24             	mov    %edi,(%esp)
+801071df:	e8 52 f1 ff ff       	call   80106336 <metabegin>
+  safestrcpy(np->name, execname(path), sizeof(np->name));
+801071e4:	83 c4 04             	add    $0x4,%esp
+801071e7:	ff 75 08             	push   0x8(%ebp)
+801071ea:	e8 fb 9a ff ff       	call   80100cea <execname>
+801071ef:	83 c4 0c             	add    $0xc,%esp
+801071f2:	6a 10                	push   $0x10
+801071f4:	50                   	push   %eax
+801071f5:	8d 47 6c             	lea    0x6c(%edi),%eax
+801071f8:	50                   	push   %eax
+801071f9:	e8 d1 05 00 00       	call   801077cf <safestrcpy>
+  metaend(np);
+801071fe:	89 3c 24             	mov    %edi,(%esp)
+80107201:	e8 5b f1 ff ff       	call   80106361 <metaend>
+  pid = np->pid;
+80107206:	8b 77 10             	mov    0x10(%edi),%esi
+  acquire(&ptable.lock);
+80107209:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+80107210:	e8 9a 03 00 00       	call   801075af <acquire>
+  if(stateListRemove(&ptable.list[EMBRYO],np) < 0)
+80107215:	89 fa                	mov    %edi,%edx
+80107217:	b8 28 12 14 80       	mov    $0x80141228,%eax
+8010721c:	e8 ea ca ff ff       	call   80103d0b <stateListRemove>
+80107221:	83 c4 10             	add    $0x10,%esp
+80107224:	85 c0                	test   %eax,%eax
+80107226:	78 44                	js     8010726c <spawn+0x2f4>
+  assertState(np,EMBRYO);
+80107228:	ba 01 00 00 00       	mov    $0x1,%edx
+8010722d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107230:	89 f8                	mov    %edi,%eax
+80107232:	e8 48 ce ff ff       	call   8010407f <assertState>
+  np->state = RUNNABLE;
+80107237:	c7 47 0c 03 00 00 00 	movl   $0x3,0xc(%edi)
+  childAdd(curproc, np);
+8010723e:	89 fa                	mov    %edi,%edx
+80107240:	89 d8                	mov    %ebx,%eax
+80107242:	e8 ae f6 ff ff       	call   801068f5 <childAdd>
+  enqueue(selectrq(np),np);
+80107247:	89 f8                	mov    %edi,%eax
+80107249:	e8 08 d2 ff ff       	call   80104456 <selectrq>
+8010724e:	89 fa                	mov    %edi,%edx
+80107250:	e8 05 d3 ff ff       	call   8010455a <enqueue>
+  release(&ptable.lock);
+80107255:	83 ec 0c             	sub    $0xc,%esp
+80107258:	68 e0 11 14 80       	push   $0x801411e0
+8010725d:	e8 b4 03 00 00       	call   80107616 <release>
+  return pid;
+80107262:	89 f0                	mov    %esi,%eax
+80107264:	83 c4 10             	add    $0x10,%esp
+80107267:	e9 93 fd ff ff       	jmp    80106fff <spawn+0x87>
+    panic("Error removing from EMBRYO in spawn().\n");
+8010726c:	83 ec 0c             	sub    $0xc,%esp
+8010726f:	68 c4 b8 10 80       	push   $0x8010b8c4
+80107274:	e8 c9 90 ff ff       	call   80100342 <panic>
+      return -1;
+80107279:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010727e:	e9 7c fd ff ff       	jmp    80106fff <spawn+0x87>
+        return -1;
+80107283:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107288:	e9 72 fd ff ff       	jmp    80106fff <spawn+0x87>
+8010728d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107292:	e9 68 fd ff ff       	jmp    80106fff <spawn+0x87>
+    return -1;
+80107297:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010729c:	e9 5e fd ff ff       	jmp    80106fff <spawn+0x87>
+
+801072a1 <setuid>:
+
+// Give the current process a new uid, moving it to that uid's stride
+// group so the scheduler never has to look the group up.
+void
+setuid(uint uid)
+{
+801072a1:	55                   	push   %ebp
+801072a2:	89 e5                	mov    %esp,%ebp
+801072a4:	56                   	push   %esi
+801072a5:	53                   	push   %ebx
+801072a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+801072a9:	e8 0a d5 ff ff       	call   801047b8 <myproc>
+801072ae:	89 c3                	mov    %eax,%ebx
+
+  acquire(&ptable.lock);
+801072b0:	83 ec 0c             	sub    $0xc,%esp
+801072b3:	68 e0 11 14 80       	push   $0x801411e0
+801072b8:	e8 f2 02 00 00       	call   801075af <acquire>
+  curproc->uid = uid;
+801072bd:	89 b3 d0 00 00 00    	mov    %esi,0xd0(%ebx)
+#ifdef PDX_STRIDE
+  curproc->group = groupFind(uid);
+801072c3:	89 f0                	mov    %esi,%eax
+801072c5:	e8 9e cb ff ff       	call   80103e68 <groupFind>
+801072ca:	89 83 28 01 00 00    	mov    %eax,0x128(%ebx)
+#endif // PDX_STRIDE
+  release(&ptable.lock);
+801072d0:	c7 04 24 e0 11 14 80 	movl   $0x801411e0,(%esp)
+801072d7:	e8 3a 03 00 00       	call   80107616 <release>
+}
+801072dc:	83 c4 10             	add    $0x10,%esp
+801072df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801072e2:	5b                   	pop    %ebx
+801072e3:	5e                   	pop    %esi
+801072e4:	5d                   	pop    %ebp
+801072e5:	c3                   	ret
+
+801072e6 <procdumpP1>:
+
+#ifdef CS333_P1
+// Helper function to display correct information for Project 1
+void
+procdumpP1(struct proc *p,char *state)
+{
+801072e6:	55                   	push   %ebp
+801072e7:	89 e5                	mov    %esp,%ebp
+801072e9:	56                   	push   %esi
+801072ea:	53                   	push   %ebx
+801072eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  uint s;
+  uint ms;
+  uint size;
+   	
+  s  = (ticks - p->start_ticks) / 1000;
+801072ee:	a1 40 db 15 80       	mov    0x8015db40,%eax
+801072f3:	2b 81 cc 00 00 00    	sub    0xcc(%ecx),%eax
+801072f9:	89 c3                	mov    %eax,%ebx
+801072fb:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107300:	f7 e2                	mul    %edx
+80107302:	c1 ea 06             	shr    $0x6,%edx
+  ms = (ticks - p->start_ticks) % 1000;
+80107305:	69 f2 e8 03 00 00    	imul   $0x3e8,%edx,%esi
+8010730b:	89 d8                	mov    %ebx,%eax
+8010730d:	29 f0                	sub    %esi,%eax
+  size = p->sz;
+8010730f:	8b 19                	mov    (%ecx),%ebx
+  if(ms >= 100){
+80107311:	83 f8 63             	cmp    $0x63,%eax
+80107314:	77 29                	ja     8010733f <procdumpP1+0x59>
+    cprintf("%d\t%s\t%d.%d\t%s\t%d\t%",p->pid,p->name,s,ms,state,size);
+  }else if(ms < 10){
+80107316:	83 f8 09             	cmp    $0x9,%eax
+80107319:	77 43                	ja     8010735e <procdumpP1+0x78>
+    cprintf("%d\t%s\t%d.00%d\t%s\t%d\t%",p->pid,p->name,s,ms,state,size);
+8010731b:	83 ec 04             	sub    $0x4,%esp
+8010731e:	53                   	push   %ebx
+8010731f:	ff 75 0c             	push   0xc(%ebp)
+80107322:	50                   	push   %eax
+80107323:	52                   	push   %edx
+80107324:	8d 41 6c             	lea    0x6c(%ecx),%eax
+80107327:	50                   	push   %eax
+80107328:	ff 71 10             	push   0x10(%ecx)
+8010732b:	68 38 b5 10 80       	push   $0x8010b538
+80107330:	e8 cf 92 ff ff       	call   80100604 <cprintf>
+80107335:	83 c4 20             	add    $0x20,%esp
+  }else{
+    cprintf("%d\t%s\t%d.0%d\t%s\t%d\t%",p->pid,p->name,s,ms,state,size);
+  }
+}
+80107338:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010733b:	5b                   	pop    %ebx
+8010733c:	5e                   	pop    %esi
+8010733d:	5d                   	pop    %ebp
+8010733e:	c3                   	ret
+    cprintf("%d\t%s\t%d.%d\t%s\t%d\t%",p->pid,p->name,s,ms,state,size);
+8010733f:	83 ec 04             	sub    $0x4,%esp
+80107342:	53                   	push   %ebx
+80107343:	ff 75 0c             	push   0xc(%ebp)
+80107346:	50                   	push   %eax
+80107347:	52                   	push   %edx
+80107348:	8d 41 6c             	lea    0x6c(%ecx),%eax
+8010734b:	50                   	push   %eax
+8010734c:	ff 71 10             	push   0x10(%ecx)
+8010734f:	68 24 b5 10 80       	push   $0x8010b524
+80107354:	e8 ab 92 ff ff       	call   80100604 <cprintf>
+80107359:	83 c4 20             	add    $0x20,%esp
+8010735c:	eb da                	jmp    80107338 <procdumpP1+0x52>
+    cprintf("%d\t%s\t%d.0%d\t%s\t%d\t%",p->pid,p->name,s,ms,state,size);
+8010735e:	83 ec 04             	sub    $0x4,%esp
+80107361:	53                   	push   %ebx
+80107362:	ff 75 0c             	push   0xc(%ebp)
+80107365:	50                   	push   %eax
+80107366:	52                   	push   %edx
+80107367:	8d 41 6c             	lea    0x6c(%ecx),%eax
+8010736a:	50                   	push   %eax
+8010736b:	ff 71 10             	push   0x10(%ecx)
+8010736e:	68 4e b5 10 80       	push   $0x8010b54e
+80107373:	e8 8c 92 ff ff       	call   80100604 <cprintf>
+80107378:	83 c4 20             	add    $0x20,%esp
+}
+8010737b:	eb bb                	jmp    80107338 <procdumpP1+0x52>
+
+8010737d <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+8010737d:	55                   	push   %ebp
+8010737e:	89 e5                	mov    %esp,%ebp
+80107380:	53                   	push   %ebx
+80107381:	83 ec 0c             	sub    $0xc,%esp
+80107384:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+80107387:	68 04 b9 10 80       	push   $0x8010b904
+8010738c:	8d 43 04             	lea    0x4(%ebx),%eax
+8010738f:	50                   	push   %eax
+80107390:	e8 cf 00 00 00       	call   80107464 <initlock>
+  lk->name = name;
+80107395:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107398:	89 43 38             	mov    %eax,0x38(%ebx)
+  lk->locked = 0;
+8010739b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801073a1:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+}
+801073a8:	83 c4 10             	add    $0x10,%esp
+801073ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801073ae:	c9                   	leave
+801073af:	c3                   	ret
+
+801073b0 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801073b0:	55                   	push   %ebp
+801073b1:	89 e5                	mov    %esp,%ebp
+801073b3:	56                   	push   %esi
+801073b4:	53                   	push   %ebx
+801073b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801073b8:	8d 73 04             	lea    0x4(%ebx),%esi
+801073bb:	83 ec 0c             	sub    $0xc,%esp
+801073be:	56                   	push   %esi
+801073bf:	e8 eb 01 00 00       	call   801075af <acquire>
+  while (lk->locked) {
+801073c4:	83 c4 10             	add    $0x10,%esp
+801073c7:	83 3b 00             	cmpl   $0x0,(%ebx)
+801073ca:	74 12                	je     801073de <acquiresleep+0x2e>
+    sleep(lk, &lk->lk);
+801073cc:	83 ec 08             	sub    $0x8,%esp
+801073cf:	56                   	push   %esi
+801073d0:	53                   	push   %ebx
+801073d1:	e8 45 d7 ff ff       	call   80104b1b <sleep>
+  while (lk->locked) {
+801073d6:	83 c4 10             	add    $0x10,%esp
+801073d9:	83 3b 00             	cmpl   $0x0,(%ebx)
+801073dc:	75 ee                	jne    801073cc <acquiresleep+0x1c>
+  }
+  lk->locked = 1;
+801073de:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+801073e4:	e8 cf d3 ff ff       	call   801047b8 <myproc>
+801073e9:	8b 40 10             	mov    0x10(%eax),%eax
+801073ec:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+801073ef:	83 ec 0c             	sub    $0xc,%esp
+801073f2:	56                   	push   %esi
+801073f3:	e8 1e 02 00 00       	call   80107616 <release>
+}
+801073f8:	83 c4 10             	add    $0x10,%esp
+801073fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801073fe:	5b                   	pop    %ebx
+801073ff:	5e                   	pop    %esi
+80107400:	5d                   	pop    %ebp
+80107401:	c3                   	ret
+
+80107402 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107402:	55                   	push   %ebp
+80107403:	89 e5                	mov    %esp,%ebp
+80107405:	56                   	push   %esi
+80107406:	53                   	push   %ebx
+80107407:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+8010740a:	8d 73 04             	lea    0x4(%ebx),%esi
+8010740d:	83 ec 0c             	sub    $0xc,%esp
+80107410:	56                   	push   %esi
+80107411:	e8 99 01 00 00       	call   801075af <acquire>
+  lk->locked = 0;
+80107416:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+8010741c:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeupone(lk);
+80107423:	89 1c 24             	mov    %ebx,(%esp)
+80107426:	e8 27 d8 ff ff       	call   80104c52 <wakeupone>
+  release(&lk->lk);
+8010742b:	89 34 24             	mov    %esi,(%esp)
+8010742e:	e8 e3 01 00 00       	call   80107616 <release>
+}
+80107433:	83 c4 10             	add    $0x10,%esp
+80107436:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107439:	5b                   	pop    %ebx
+8010743a:	5e                   	pop    %esi
+8010743b:	5d                   	pop    %ebp
+8010743c:	c3                   	ret
+
+8010743d <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+8010743d:	55                   	push   %ebp
+8010743e:	89 e5                	mov    %esp,%ebp
+80107440:	56                   	push   %esi
+80107441:	53                   	push   %ebx
+80107442:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  
+  acquire(&lk->lk);
+80107445:	8d 5e 04             	lea    0x4(%esi),%ebx
+80107448:	83 ec 0c             	sub    $0xc,%esp
+8010744b:	53                   	push   %ebx
+8010744c:	e8 5e 01 00 00       	call   801075af <acquire>
+  r = lk->locked;
+80107451:	8b 36                	mov    (%esi),%esi
+  release(&lk->lk);
+80107453:	89 1c 24             	mov    %ebx,(%esp)
+80107456:	e8 bb 01 00 00       	call   80107616 <release>
+  return r;
+}
+8010745b:	89 f0                	mov    %esi,%eax
+8010745d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107460:	5b                   	pop    %ebx
+80107461:	5e                   	pop    %esi
+80107462:	5d                   	pop    %ebp
+80107463:	c3                   	ret
+
+80107464 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107464:	55                   	push   %ebp
+80107465:	89 e5                	mov    %esp,%ebp
+80107467:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+8010746a:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010746d:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->locked = 0;
+80107470:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->cpu = 0;
+80107476:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+8010747d:	5d                   	pop    %ebp
+8010747e:	c3                   	ret
+
+8010747f <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+8010747f:	55                   	push   %ebp
+80107480:	89 e5                	mov    %esp,%ebp
+80107482:	53                   	push   %ebx
+80107483:	8b 45 08             	mov    0x8(%ebp),%eax
+80107486:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80107489:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+8010748c:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80107491:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80107496:	77 40                	ja     801074d8 <getcallerpcs+0x59>
+  for(i = 0; i < 10; i++){
+80107498:	b8 00 00 00 00       	mov    $0x0,%eax
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+8010749d:	8b 5a 04             	mov    0x4(%edx),%ebx
+801074a0:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    ebp = (uint*)ebp[0]; // saved %ebp
+801074a3:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+801074a5:	83 c0 01             	add    $0x1,%eax
+801074a8:	83 f8 0a             	cmp    $0xa,%eax
+801074ab:	74 26                	je     801074d3 <getcallerpcs+0x54>
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801074ad:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801074b3:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801074b9:	76 e2                	jbe    8010749d <getcallerpcs+0x1e>
+  }
+  for(; i < 10; i++)
+801074bb:	83 f8 09             	cmp    $0x9,%eax
+801074be:	7f 13                	jg     801074d3 <getcallerpcs+0x54>
+801074c0:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801074c3:	8d 51 28             	lea    0x28(%ecx),%edx
+    pcs[i] = 0;
+801074c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+801074cc:	83 c0 04             	add    $0x4,%eax
+801074cf:	39 d0                	cmp    %edx,%eax
+801074d1:	75 f3                	jne    801074c6 <getcallerpcs+0x47>
+}
+801074d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801074d6:	c9                   	leave
+801074d7:	c3                   	ret
+  for(i = 0; i < 10; i++){
+801074d8:	b8 00 00 00 00       	mov    $0x0,%eax
+801074dd:	eb e1                	jmp    801074c0 <getcallerpcs+0x41>
+
+801074df <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+801074df:	55                   	push   %ebp
+801074e0:	89 e5                	mov    %esp,%ebp
+801074e2:	53                   	push   %ebx
+801074e3:	83 ec 04             	sub    $0x4,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801074e6:	9c                   	pushf
+801074e7:	5b                   	pop    %ebx
+  asm volatile("cli");
+801074e8:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+801074e9:	e8 ee ce ff ff       	call   801043dc <mycpu>
+801074ee:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+801074f5:	74 11                	je     80107508 <pushcli+0x29>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+801074f7:	e8 e0 ce ff ff       	call   801043dc <mycpu>
+801074fc:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80107503:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107506:	c9                   	leave
+80107507:	c3                   	ret
+    mycpu()->intena = eflags & FL_IF;
+80107508:	e8 cf ce ff ff       	call   801043dc <mycpu>
+8010750d:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80107513:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80107519:	eb dc                	jmp    801074f7 <pushcli+0x18>
+
+8010751b <popcli>:
+
+void
+popcli(void)
+{
+8010751b:	55                   	push   %ebp
+8010751c:	89 e5                	mov    %esp,%ebp
+8010751e:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107521:	9c                   	pushf
+80107522:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107523:	f6 c4 02             	test   $0x2,%ah
+80107526:	75 28                	jne    80107550 <popcli+0x35>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107528:	e8 af ce ff ff       	call   801043dc <mycpu>
+8010752d:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+80107533:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80107536:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+8010753c:	85 d2                	test   %edx,%edx
+8010753e:	78 1d                	js     8010755d <popcli+0x42>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107540:	e8 97 ce ff ff       	call   801043dc <mycpu>
+80107545:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+8010754c:	74 1c                	je     8010756a <popcli+0x4f>
+    sti();
+}
+8010754e:	c9                   	leave
+8010754f:	c3                   	ret
+    panic("popcli - interruptible");
+80107550:	83 ec 0c             	sub    $0xc,%esp
+80107553:	68 0f b9 10 80       	push   $0x8010b90f
+80107558:	e8 e5 8d ff ff       	call   80100342 <panic>
+    panic("popcli");
+8010755d:	83 ec 0c             	sub    $0xc,%esp
+80107560:	68 26 b9 10 80       	push   $0x8010b926
+80107565:	e8 d8 8d ff ff       	call   80100342 <panic>
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+8010756a:	e8 6d ce ff ff       	call   801043dc <mycpu>
+8010756f:	83 b8 a8 00 00 00 00 	cmpl   $0x0,0xa8(%eax)
+80107576:	74 d6                	je     8010754e <popcli+0x33>
+  asm volatile("sti");
+80107578:	fb                   	sti
+}
+80107579:	eb d3                	jmp    8010754e <popcli+0x33>
+
+8010757b <holding>:
+{
+8010757b:	55                   	push   %ebp
+8010757c:	89 e5                	mov    %esp,%ebp
+8010757e:	56                   	push   %esi
+8010757f:	53                   	push   %ebx
+80107580:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+80107583:	e8 57 ff ff ff       	call   801074df <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107588:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010758d:	83 3e 00             	cmpl   $0x0,(%esi)
+80107590:	75 0b                	jne    8010759d <holding+0x22>
+  popcli();
+80107592:	e8 84 ff ff ff       	call   8010751b <popcli>
+}
+80107597:	89 d8                	mov    %ebx,%eax
+80107599:	5b                   	pop    %ebx
+8010759a:	5e                   	pop    %esi
+8010759b:	5d                   	pop    %ebp
+8010759c:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+8010759d:	8b 5e 08             	mov    0x8(%esi),%ebx
+801075a0:	e8 37 ce ff ff       	call   801043dc <mycpu>
+801075a5:	39 c3                	cmp    %eax,%ebx
+801075a7:	0f 94 c3             	sete   %bl
+801075aa:	0f b6 db             	movzbl %bl,%ebx
+801075ad:	eb e3                	jmp    80107592 <holding+0x17>
+
+801075af <acquire>:
+{
+801075af:	55                   	push   %ebp
+801075b0:	89 e5                	mov    %esp,%ebp
+801075b2:	53                   	push   %ebx
+801075b3:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+801075b6:	e8 24 ff ff ff       	call   801074df <pushcli>
+  if(holding(lk))
+801075bb:	83 ec 0c             	sub    $0xc,%esp
+801075be:	ff 75 08             	push   0x8(%ebp)
+801075c1:	e8 b5 ff ff ff       	call   8010757b <holding>
+801075c6:	83 c4 10             	add    $0x10,%esp
+801075c9:	85 c0                	test   %eax,%eax
+801075cb:	75 3c                	jne    80107609 <acquire+0x5a>
+  asm volatile("lock; xchgl %0, %1" :
+801075cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  while(xchg(&lk->locked, 1) != 0)
+801075d2:	8b 55 08             	mov    0x8(%ebp),%edx
+801075d5:	89 c8                	mov    %ecx,%eax
+801075d7:	f0 87 02             	lock xchg %eax,(%edx)
+801075da:	85 c0                	test   %eax,%eax
+801075dc:	75 f4                	jne    801075d2 <acquire+0x23>
+  __sync_synchronize();
+801075de:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+801075e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801075e6:	e8 f1 cd ff ff       	call   801043dc <mycpu>
+801075eb:	89 43 08             	mov    %eax,0x8(%ebx)
+  getcallerpcs(&lk, lk->pcs);
+801075ee:	83 ec 08             	sub    $0x8,%esp
+801075f1:	8b 45 08             	mov    0x8(%ebp),%eax
+801075f4:	83 c0 0c             	add    $0xc,%eax
+801075f7:	50                   	push   %eax
+801075f8:	8d 45 08             	lea    0x8(%ebp),%eax
+801075fb:	50                   	push   %eax
+801075fc:	e8 7e fe ff ff       	call   8010747f <getcallerpcs>
+}
+80107601:	83 c4 10             	add    $0x10,%esp
+80107604:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107607:	c9                   	leave
+80107608:	c3                   	ret
+    panic("acquire");
+80107609:	83 ec 0c             	sub    $0xc,%esp
+8010760c:	68 2d b9 10 80       	push   $0x8010b92d
+80107611:	e8 2c 8d ff ff       	call   80100342 <panic>
+
+80107616 <release>:
+{
+80107616:	55                   	push   %ebp
+80107617:	89 e5                	mov    %esp,%ebp
+80107619:	53                   	push   %ebx
+8010761a:	83 ec 10             	sub    $0x10,%esp
+8010761d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(lk))
+80107620:	53                   	push   %ebx
+80107621:	e8 55 ff ff ff       	call   8010757b <holding>
+80107626:	83 c4 10             	add    $0x10,%esp
+80107629:	85 c0                	test   %eax,%eax
+8010762b:	74 23                	je     80107650 <release+0x3a>
+  lk->pcs[0] = 0;
+8010762d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107634:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+8010763b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107640:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+80107646:	e8 d0 fe ff ff       	call   8010751b <popcli>
+}
+8010764b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010764e:	c9                   	leave
+8010764f:	c3                   	ret
+    panic("release");
+80107650:	83 ec 0c             	sub    $0xc,%esp
+80107653:	68 35 b9 10 80       	push   $0x8010b935
+80107658:	e8 e5 8c ff ff       	call   80100342 <panic>
+
+8010765d <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+8010765d:	55                   	push   %ebp
+8010765e:	89 e5                	mov    %esp,%ebp
+80107660:	57                   	push   %edi
+80107661:	8b 55 08             	mov    0x8(%ebp),%edx
+80107664:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107667:	89 d0                	mov    %edx,%eax
+80107669:	09 c8                	or     %ecx,%eax
+8010766b:	a8 03                	test   $0x3,%al
+8010766d:	75 14                	jne    80107683 <memset+0x26>
+    c &= 0xFF;
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+8010766f:	c1 e9 02             	shr    $0x2,%ecx
+    c &= 0xFF;
+80107672:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107676:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  asm volatile("cld; rep stosl" :
+8010767c:	89 d7                	mov    %edx,%edi
+8010767e:	fc                   	cld
+8010767f:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+80107681:	eb 08                	jmp    8010768b <memset+0x2e>
+  asm volatile("cld; rep stosb" :
+80107683:	89 d7                	mov    %edx,%edi
+80107685:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107688:	fc                   	cld
+80107689:	f3 aa                	rep stos %al,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+8010768b:	89 d0                	mov    %edx,%eax
+8010768d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107690:	c9                   	leave
+80107691:	c3                   	ret
+
+80107692 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107692:	55                   	push   %ebp
+80107693:	89 e5                	mov    %esp,%ebp
+80107695:	56                   	push   %esi
+80107696:	53                   	push   %ebx
+80107697:	8b 45 08             	mov    0x8(%ebp),%eax
+8010769a:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010769d:	8b 75 10             	mov    0x10(%ebp),%esi
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+801076a0:	85 f6                	test   %esi,%esi
+801076a2:	74 29                	je     801076cd <memcmp+0x3b>
+801076a4:	01 c6                	add    %eax,%esi
+    if(*s1 != *s2)
+801076a6:	0f b6 08             	movzbl (%eax),%ecx
+801076a9:	0f b6 1a             	movzbl (%edx),%ebx
+801076ac:	38 d9                	cmp    %bl,%cl
+801076ae:	75 11                	jne    801076c1 <memcmp+0x2f>
+      return *s1 - *s2;
+    s1++, s2++;
+801076b0:	83 c0 01             	add    $0x1,%eax
+801076b3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+801076b6:	39 c6                	cmp    %eax,%esi
+801076b8:	75 ec                	jne    801076a6 <memcmp+0x14>
+  }
+
+  return 0;
+801076ba:	b8 00 00 00 00       	mov    $0x0,%eax
+801076bf:	eb 08                	jmp    801076c9 <memcmp+0x37>
+      return *s1 - *s2;
+801076c1:	0f b6 c1             	movzbl %cl,%eax
+801076c4:	0f b6 db             	movzbl %bl,%ebx
+801076c7:	29 d8                	sub    %ebx,%eax
+}
+801076c9:	5b                   	pop    %ebx
+801076ca:	5e                   	pop    %esi
+801076cb:	5d                   	pop    %ebp
+801076cc:	c3                   	ret
+  return 0;
+801076cd:	b8 00 00 00 00       	mov    $0x0,%eax
+801076d2:	eb f5                	jmp    801076c9 <memcmp+0x37>
+
+801076d4 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+801076d4:	55                   	push   %ebp
+801076d5:	89 e5                	mov    %esp,%ebp
+801076d7:	56                   	push   %esi
+801076d8:	53                   	push   %ebx
+801076d9:	8b 75 08             	mov    0x8(%ebp),%esi
+801076dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+801076df:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+801076e2:	39 f0                	cmp    %esi,%eax
+801076e4:	72 20                	jb     80107706 <memmove+0x32>
+    s += n;
+    d += n;
+    while(n-- > 0)
+      *--d = *--s;
+  } else
+    while(n-- > 0)
+801076e6:	8d 1c 08             	lea    (%eax,%ecx,1),%ebx
+801076e9:	89 f2                	mov    %esi,%edx
+801076eb:	85 c9                	test   %ecx,%ecx
+801076ed:	74 11                	je     80107700 <memmove+0x2c>
+      *d++ = *s++;
+801076ef:	83 c0 01             	add    $0x1,%eax
+801076f2:	83 c2 01             	add    $0x1,%edx
+801076f5:	0f b6 48 ff          	movzbl -0x1(%eax),%ecx
+801076f9:	88 4a ff             	mov    %cl,-0x1(%edx)
+    while(n-- > 0)
+801076fc:	39 d8                	cmp    %ebx,%eax
+801076fe:	75 ef                	jne    801076ef <memmove+0x1b>
+
+  return dst;
+}
+80107700:	89 f0                	mov    %esi,%eax
+80107702:	5b                   	pop    %ebx
+80107703:	5e                   	pop    %esi
+80107704:	5d                   	pop    %ebp
+80107705:	c3                   	ret
+  if(s < d && s + n > d){
+80107706:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+80107709:	39 d6                	cmp    %edx,%esi
+8010770b:	73 d9                	jae    801076e6 <memmove+0x12>
+    while(n-- > 0)
+8010770d:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80107710:	85 c9                	test   %ecx,%ecx
+80107712:	74 ec                	je     80107700 <memmove+0x2c>
+      *--d = *--s;
+80107714:	0f b6 0c 10          	movzbl (%eax,%edx,1),%ecx
+80107718:	88 0c 16             	mov    %cl,(%esi,%edx,1)
+    while(n-- > 0)
+8010771b:	83 ea 01             	sub    $0x1,%edx
+8010771e:	83 fa ff             	cmp    $0xffffffff,%edx
+80107721:	75 f1                	jne    80107714 <memmove+0x40>
+80107723:	eb db                	jmp    80107700 <memmove+0x2c>
+
+80107725 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+80107725:	55                   	push   %ebp
+80107726:	89 e5                	mov    %esp,%ebp
+80107728:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+8010772b:	ff 75 10             	push   0x10(%ebp)
+8010772e:	ff 75 0c             	push   0xc(%ebp)
+80107731:	ff 75 08             	push   0x8(%ebp)
+80107734:	e8 9b ff ff ff       	call   801076d4 <memmove>
+}
+80107739:	c9                   	leave
+8010773a:	c3                   	ret
+
+8010773b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+8010773b:	55                   	push   %ebp
+8010773c:	89 e5                	mov    %esp,%ebp
+8010773e:	53                   	push   %ebx
+8010773f:	8b 55 08             	mov    0x8(%ebp),%edx
+80107742:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107745:	8b 45 10             	mov    0x10(%ebp),%eax
+  while(n > 0 && *p && *p == *q)
+80107748:	85 c0                	test   %eax,%eax
+8010774a:	74 29                	je     80107775 <strncmp+0x3a>
+8010774c:	0f b6 1a             	movzbl (%edx),%ebx
+8010774f:	84 db                	test   %bl,%bl
+80107751:	74 16                	je     80107769 <strncmp+0x2e>
+80107753:	3a 19                	cmp    (%ecx),%bl
+80107755:	75 12                	jne    80107769 <strncmp+0x2e>
+    n--, p++, q++;
+80107757:	83 c2 01             	add    $0x1,%edx
+8010775a:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+8010775d:	83 e8 01             	sub    $0x1,%eax
+80107760:	75 ea                	jne    8010774c <strncmp+0x11>
+  if(n == 0)
+    return 0;
+80107762:	b8 00 00 00 00       	mov    $0x0,%eax
+80107767:	eb 0c                	jmp    80107775 <strncmp+0x3a>
+  if(n == 0)
+80107769:	85 c0                	test   %eax,%eax
+8010776b:	74 0d                	je     8010777a <strncmp+0x3f>
+  return (uchar)*p - (uchar)*q;
+8010776d:	0f b6 02             	movzbl (%edx),%eax
+80107770:	0f b6 11             	movzbl (%ecx),%edx
+80107773:	29 d0                	sub    %edx,%eax
+}
+80107775:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107778:	c9                   	leave
+80107779:	c3                   	ret
+    return 0;
+8010777a:	b8 00 00 00 00       	mov    $0x0,%eax
+8010777f:	eb f4                	jmp    80107775 <strncmp+0x3a>
+
+80107781 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107781:	55                   	push   %ebp
+80107782:	89 e5                	mov    %esp,%ebp
+80107784:	57                   	push   %edi
+80107785:	56                   	push   %esi
+80107786:	53                   	push   %ebx
+80107787:	8b 75 08             	mov    0x8(%ebp),%esi
+8010778a:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010778d:	89 f1                	mov    %esi,%ecx
+8010778f:	89 d3                	mov    %edx,%ebx
+80107791:	83 ea 01             	sub    $0x1,%edx
+80107794:	85 db                	test   %ebx,%ebx
+80107796:	7e 17                	jle    801077af <strncpy+0x2e>
+80107798:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+8010779c:	83 c1 01             	add    $0x1,%ecx
+8010779f:	8b 45 0c             	mov    0xc(%ebp),%eax
+801077a2:	0f b6 78 ff          	movzbl -0x1(%eax),%edi
+801077a6:	89 f8                	mov    %edi,%eax
+801077a8:	88 41 ff             	mov    %al,-0x1(%ecx)
+801077ab:	84 c0                	test   %al,%al
+801077ad:	75 e0                	jne    8010778f <strncpy+0xe>
+    ;
+  while(n-- > 0)
+801077af:	89 c8                	mov    %ecx,%eax
+801077b1:	8d 4c 19 ff          	lea    -0x1(%ecx,%ebx,1),%ecx
+801077b5:	85 d2                	test   %edx,%edx
+801077b7:	7e 0f                	jle    801077c8 <strncpy+0x47>
+    *s++ = 0;
+801077b9:	83 c0 01             	add    $0x1,%eax
+801077bc:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+801077c0:	89 ca                	mov    %ecx,%edx
+801077c2:	29 c2                	sub    %eax,%edx
+801077c4:	85 d2                	test   %edx,%edx
+801077c6:	7f f1                	jg     801077b9 <strncpy+0x38>
+  return os;
+}
+801077c8:	89 f0                	mov    %esi,%eax
+801077ca:	5b                   	pop    %ebx
+801077cb:	5e                   	pop    %esi
+801077cc:	5f                   	pop    %edi
+801077cd:	5d                   	pop    %ebp
+801077ce:	c3                   	ret
+
+801077cf <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+801077cf:	55                   	push   %ebp
+801077d0:	89 e5                	mov    %esp,%ebp
+801077d2:	56                   	push   %esi
+801077d3:	53                   	push   %ebx
+801077d4:	8b 75 08             	mov    0x8(%ebp),%esi
+801077d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+801077da:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  if(n <= 0)
+801077dd:	85 d2                	test   %edx,%edx
+801077df:	7e 1e                	jle    801077ff <safestrcpy+0x30>
+801077e1:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+801077e5:	89 f2                	mov    %esi,%edx
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+801077e7:	39 d8                	cmp    %ebx,%eax
+801077e9:	74 11                	je     801077fc <safestrcpy+0x2d>
+801077eb:	83 c0 01             	add    $0x1,%eax
+801077ee:	83 c2 01             	add    $0x1,%edx
+801077f1:	0f b6 48 ff          	movzbl -0x1(%eax),%ecx
+801077f5:	88 4a ff             	mov    %cl,-0x1(%edx)
+801077f8:	84 c9                	test   %cl,%cl
+801077fa:	75 eb                	jne    801077e7 <safestrcpy+0x18>
+    ;
+  *s = 0;
+801077fc:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+801077ff:	89 f0                	mov    %esi,%eax
+80107801:	5b                   	pop    %ebx
+80107802:	5e                   	pop    %esi
+80107803:	5d                   	pop    %ebp
+80107804:	c3                   	ret
+
+80107805 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107805:	55                   	push   %ebp
+80107806:	89 e5                	mov    %esp,%ebp
+80107808:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+8010780b:	80 3a 00             	cmpb   $0x0,(%edx)
+8010780e:	74 10                	je     80107820 <strlen+0x1b>
+80107810:	b8 00 00 00 00       	mov    $0x0,%eax
+80107815:	83 c0 01             	add    $0x1,%eax
+80107818:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+8010781c:	75 f7                	jne    80107815 <strlen+0x10>
+    ;
+  return n;
+}
+8010781e:	5d                   	pop    %ebp
+8010781f:	c3                   	ret
+  for(n = 0; s[n]; n++)
+80107820:	b8 00 00 00 00       	mov    $0x0,%eax
+  return n;
+80107825:	eb f7                	jmp    8010781e <strlen+0x19>
+
+80107827 <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80107827:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+8010782b:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebp
+8010782f:	55                   	push   %ebp
+  pushl %ebx
+80107830:	53                   	push   %ebx
+  pushl %esi
+80107831:	56                   	push   %esi
+  pushl %edi
+80107832:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107833:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107835:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-save registers
+  popl %edi
+80107837:	5f                   	pop    %edi
+  popl %esi
+80107838:	5e                   	pop    %esi
+  popl %ebx
+80107839:	5b                   	pop    %ebx
+  popl %ebp
+8010783a:	5d                   	pop    %ebp
+  ret
+8010783b:	c3                   	ret
+
+8010783c <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+8010783c:	55                   	push   %ebp
+8010783d:	89 e5                	mov    %esp,%ebp
+8010783f:	53                   	push   %ebx
+80107840:	83 ec 04             	sub    $0x4,%esp
+80107843:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80107846:	e8 6d cf ff ff       	call   801047b8 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010784b:	8b 10                	mov    (%eax),%edx
+8010784d:	39 d3                	cmp    %edx,%ebx
+8010784f:	73 2a                	jae    8010787b <fetchint+0x3f>
+80107851:	8d 4b 04             	lea    0x4(%ebx),%ecx
+80107854:	39 ca                	cmp    %ecx,%edx
+80107856:	72 2a                	jb     80107882 <fetchint+0x46>
+    return -1;
+  if(uvmtouch(curproc, addr, 4, 0) < 0)
+80107858:	6a 00                	push   $0x0
+8010785a:	6a 04                	push   $0x4
+8010785c:	53                   	push   %ebx
+8010785d:	50                   	push   %eax
+8010785e:	e8 73 32 00 00       	call   8010aad6 <uvmtouch>
+80107863:	83 c4 10             	add    $0x10,%esp
+80107866:	85 c0                	test   %eax,%eax
+80107868:	78 1f                	js     80107889 <fetchint+0x4d>
+    return -1;
+  *ip = *(int*)(addr);
+8010786a:	8b 13                	mov    (%ebx),%edx
+8010786c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010786f:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107871:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107876:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107879:	c9                   	leave
+8010787a:	c3                   	ret
+    return -1;
+8010787b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107880:	eb f4                	jmp    80107876 <fetchint+0x3a>
+80107882:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107887:	eb ed                	jmp    80107876 <fetchint+0x3a>
+    return -1;
+80107889:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010788e:	eb e6                	jmp    80107876 <fetchint+0x3a>
+
+80107890 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80107890:	55                   	push   %ebp
+80107891:	89 e5                	mov    %esp,%ebp
+80107893:	57                   	push   %edi
+80107894:	56                   	push   %esi
+80107895:	53                   	push   %ebx
+80107896:	83 ec 1c             	sub    $0x1c,%esp
+80107899:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *s, *ep;
+  struct proc *curproc = myproc();
+8010789c:	e8 17 cf ff ff       	call   801047b8 <myproc>
+801078a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if(addr >= curproc->sz)
+801078a4:	8b 10                	mov    (%eax),%edx
+801078a6:	39 55 08             	cmp    %edx,0x8(%ebp)
+801078a9:	73 53                	jae    801078fe <fetchstr+0x6e>
+    return -1;
+  *pp = (char*)addr;
+801078ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801078ae:	89 1f                	mov    %ebx,(%edi)
+  ep = (char*)curproc->sz;
+801078b0:	8b 30                	mov    (%eax),%esi
+  for(s = *pp; s < ep; s++){
+801078b2:	39 f3                	cmp    %esi,%ebx
+801078b4:	72 27                	jb     801078dd <fetchstr+0x4d>
+       uvmtouch(curproc, (uint)s, 1, 0) < 0)
+      return -1;
+    if(*s == 0)
+      return s - *pp;
+  }
+  return -1;
+801078b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801078bb:	eb 32                	jmp    801078ef <fetchstr+0x5f>
+       uvmtouch(curproc, (uint)s, 1, 0) < 0)
+801078bd:	6a 00                	push   $0x0
+801078bf:	6a 01                	push   $0x1
+801078c1:	53                   	push   %ebx
+801078c2:	ff 75 e4             	push   -0x1c(%ebp)
+801078c5:	e8 0c 32 00 00       	call   8010aad6 <uvmtouch>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801078ca:	83 c4 10             	add    $0x10,%esp
+801078cd:	85 c0                	test   %eax,%eax
+801078cf:	78 34                	js     80107905 <fetchstr+0x75>
+    if(*s == 0)
+801078d1:	80 3b 00             	cmpb   $0x0,(%ebx)
+801078d4:	74 15                	je     801078eb <fetchstr+0x5b>
+  for(s = *pp; s < ep; s++){
+801078d6:	83 c3 01             	add    $0x1,%ebx
+801078d9:	39 f3                	cmp    %esi,%ebx
+801078db:	73 1a                	jae    801078f7 <fetchstr+0x67>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801078dd:	39 1f                	cmp    %ebx,(%edi)
+801078df:	74 dc                	je     801078bd <fetchstr+0x2d>
+801078e1:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801078e7:	75 e8                	jne    801078d1 <fetchstr+0x41>
+801078e9:	eb d2                	jmp    801078bd <fetchstr+0x2d>
+      return s - *pp;
+801078eb:	89 d8                	mov    %ebx,%eax
+801078ed:	2b 07                	sub    (%edi),%eax
+}
+801078ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801078f2:	5b                   	pop    %ebx
+801078f3:	5e                   	pop    %esi
+801078f4:	5f                   	pop    %edi
+801078f5:	5d                   	pop    %ebp
+801078f6:	c3                   	ret
+  return -1;
+801078f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801078fc:	eb f1                	jmp    801078ef <fetchstr+0x5f>
+    return -1;
+801078fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107903:	eb ea                	jmp    801078ef <fetchstr+0x5f>
+      return -1;
+80107905:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010790a:	eb e3                	jmp    801078ef <fetchstr+0x5f>
+
+8010790c <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+8010790c:	55                   	push   %ebp
+8010790d:	89 e5                	mov    %esp,%ebp
+8010790f:	83 ec 08             	sub    $0x8,%esp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107912:	e8 a1 ce ff ff       	call   801047b8 <myproc>
+80107917:	83 ec 08             	sub    $0x8,%esp
+8010791a:	ff 75 0c             	push   0xc(%ebp)
+8010791d:	8b 40 18             	mov    0x18(%eax),%eax
+80107920:	8b 40 44             	mov    0x44(%eax),%eax
+80107923:	8b 55 08             	mov    0x8(%ebp),%edx
+80107926:	8d 44 90 04          	lea    0x4(%eax,%edx,4),%eax
+8010792a:	50                   	push   %eax
+8010792b:	e8 0c ff ff ff       	call   8010783c <fetchint>
+}
+80107930:	c9                   	leave
+80107931:	c3                   	ret
+
+80107932 <fetchptr>:
+
+static int
+fetchptr(int n, char **pp, int size, int write)
+{
+80107932:	55                   	push   %ebp
+80107933:	89 e5                	mov    %esp,%ebp
+80107935:	57                   	push   %edi
+80107936:	56                   	push   %esi
+80107937:	53                   	push   %ebx
+80107938:	83 ec 2c             	sub    $0x2c,%esp
+8010793b:	89 c7                	mov    %eax,%edi
+8010793d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107940:	89 cb                	mov    %ecx,%ebx
+  int i;
+  struct proc *curproc = myproc();
+80107942:	e8 71 ce ff ff       	call   801047b8 <myproc>
+80107947:	89 c6                	mov    %eax,%esi
+
+  if(argint(n, &i) < 0)
+80107949:	83 ec 08             	sub    $0x8,%esp
+8010794c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010794f:	50                   	push   %eax
+80107950:	57                   	push   %edi
+80107951:	e8 b6 ff ff ff       	call   8010790c <argint>
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107956:	83 c4 10             	add    $0x10,%esp
+80107959:	09 d8                	or     %ebx,%eax
+8010795b:	78 34                	js     80107991 <fetchptr+0x5f>
+8010795d:	8b 06                	mov    (%esi),%eax
+8010795f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80107962:	39 c7                	cmp    %eax,%edi
+80107964:	73 32                	jae    80107998 <fetchptr+0x66>
+80107966:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+80107969:	39 d0                	cmp    %edx,%eax
+8010796b:	72 32                	jb     8010799f <fetchptr+0x6d>
+    return -1;
+  if(uvmtouch(curproc, i, size, write) < 0)
+8010796d:	ff 75 08             	push   0x8(%ebp)
+80107970:	53                   	push   %ebx
+80107971:	57                   	push   %edi
+80107972:	56                   	push   %esi
+80107973:	e8 5e 31 00 00       	call   8010aad6 <uvmtouch>
+80107978:	83 c4 10             	add    $0x10,%esp
+8010797b:	85 c0                	test   %eax,%eax
+8010797d:	78 27                	js     801079a6 <fetchptr+0x74>
+    return -1;
+  *pp = (char*)i;
+8010797f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80107982:	89 38                	mov    %edi,(%eax)
+  return 0;
+80107984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010798c:	5b                   	pop    %ebx
+8010798d:	5e                   	pop    %esi
+8010798e:	5f                   	pop    %edi
+8010798f:	5d                   	pop    %ebp
+80107990:	c3                   	ret
+    return -1;
+80107991:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107996:	eb f1                	jmp    80107989 <fetchptr+0x57>
+80107998:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010799d:	eb ea                	jmp    80107989 <fetchptr+0x57>
+8010799f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801079a4:	eb e3                	jmp    80107989 <fetchptr+0x57>
+    return -1;
+801079a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801079ab:	eb dc                	jmp    80107989 <fetchptr+0x57>
+
+801079ad <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+801079ad:	55                   	push   %ebp
+801079ae:	89 e5                	mov    %esp,%ebp
+801079b0:	83 ec 14             	sub    $0x14,%esp
+  return fetchptr(n, pp, size, 0);
+801079b3:	6a 00                	push   $0x0
+801079b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801079b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+801079bb:	8b 45 08             	mov    0x8(%ebp),%eax
+801079be:	e8 6f ff ff ff       	call   80107932 <fetchptr>
+}
+801079c3:	c9                   	leave
+801079c4:	c3                   	ret
+
+801079c5 <argptrw>:
+
+// Like argptr(), for a block the kernel will write: make it
+// writable now, so that writing it cannot fault.
+int
+argptrw(int n, char **pp, int size)
+{
+801079c5:	55                   	push   %ebp
+801079c6:	89 e5                	mov    %esp,%ebp
+801079c8:	83 ec 14             	sub    $0x14,%esp
+  return fetchptr(n, pp, size, 1);
+801079cb:	6a 01                	push   $0x1
+801079cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801079d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+801079d3:	8b 45 08             	mov    0x8(%ebp),%eax
+801079d6:	e8 57 ff ff ff       	call   80107932 <fetchptr>
+}
+801079db:	c9                   	leave
+801079dc:	c3                   	ret
+
+801079dd <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+801079dd:	55                   	push   %ebp
+801079de:	89 e5                	mov    %esp,%ebp
+801079e0:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+  if(argint(n, &addr) < 0)
+801079e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801079e6:	50                   	push   %eax
+801079e7:	ff 75 08             	push   0x8(%ebp)
+801079ea:	e8 1d ff ff ff       	call   8010790c <argint>
+801079ef:	83 c4 10             	add    $0x10,%esp
+801079f2:	85 c0                	test   %eax,%eax
+801079f4:	78 13                	js     80107a09 <argstr+0x2c>
+    return -1;
+  return fetchstr(addr, pp);
+801079f6:	83 ec 08             	sub    $0x8,%esp
+801079f9:	ff 75 0c             	push   0xc(%ebp)
+801079fc:	ff 75 f4             	push   -0xc(%ebp)
+801079ff:	e8 8c fe ff ff       	call   80107890 <fetchstr>
+80107a04:	83 c4 10             	add    $0x10,%esp
+}
+80107a07:	c9                   	leave
+80107a08:	c3                   	ret
+    return -1;
+80107a09:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107a0e:	eb f7                	jmp    80107a07 <argstr+0x2a>
+
+80107a10 <syscall>:
+};
+#endif // PRINT_SYSCALLS
+
+void
+syscall(void)
+{
+80107a10:	55                   	push   %ebp
+80107a11:	89 e5                	mov    %esp,%ebp
+80107a13:	53                   	push   %ebx
+80107a14:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80107a17:	e8 9c cd ff ff       	call   801047b8 <myproc>
+80107a1c:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80107a1e:	8b 40 18             	mov    0x18(%eax),%eax
+80107a21:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80107a24:	8d 50 ff             	lea    -0x1(%eax),%edx
+80107a27:	83 fa 28             	cmp    $0x28,%edx
+80107a2a:	77 17                	ja     80107a43 <syscall+0x33>
+80107a2c:	8b 14 85 60 b9 10 80 	mov    -0x7fef46a0(,%eax,4),%edx
+80107a33:	85 d2                	test   %edx,%edx
+80107a35:	74 0c                	je     80107a43 <syscall+0x33>
+    curproc->tf->eax = syscalls[num]();
+80107a37:	ff d2                	call   *%edx
+80107a39:	89 c2                	mov    %eax,%edx
+80107a3b:	8b 43 18             	mov    0x18(%ebx),%eax
+80107a3e:	89 50 1c             	mov    %edx,0x1c(%eax)
+80107a41:	eb 1f                	jmp    80107a62 <syscall+0x52>
+#ifdef PRINT_SYSCALLS
+    cprintf("%s -> %d\n",syscallnames[num],curproc->tf->eax);
+#endif // PRINT_SYSCALLS
+#endif // CS333_P1
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+80107a43:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+80107a44:	8d 43 6c             	lea    0x6c(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+80107a47:	50                   	push   %eax
+80107a48:	ff 73 10             	push   0x10(%ebx)
+80107a4b:	68 3d b9 10 80       	push   $0x8010b93d
+80107a50:	e8 af 8b ff ff       	call   80100604 <cprintf>
+    curproc->tf->eax = -1;
+80107a55:	8b 43 18             	mov    0x18(%ebx),%eax
+80107a58:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+80107a5f:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80107a62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107a65:	c9                   	leave
+80107a66:	c3                   	ret
+
+80107a67 <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+80107a67:	55                   	push   %ebp
+80107a68:	89 e5                	mov    %esp,%ebp
+80107a6a:	56                   	push   %esi
+80107a6b:	53                   	push   %ebx
+80107a6c:	83 ec 18             	sub    $0x18,%esp
+80107a6f:	89 d6                	mov    %edx,%esi
+80107a71:	89 cb                	mov    %ecx,%ebx
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+80107a73:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80107a76:	52                   	push   %edx
+80107a77:	50                   	push   %eax
+80107a78:	e8 8f fe ff ff       	call   8010790c <argint>
+80107a7d:	83 c4 10             	add    $0x10,%esp
+80107a80:	85 c0                	test   %eax,%eax
+80107a82:	78 30                	js     80107ab4 <argfd+0x4d>
+    return -1;
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107a84:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107a88:	77 31                	ja     80107abb <argfd+0x54>
+80107a8a:	e8 29 cd ff ff       	call   801047b8 <myproc>
+80107a8f:	89 c2                	mov    %eax,%edx
+80107a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80107a94:	8b 54 82 28          	mov    0x28(%edx,%eax,4),%edx
+80107a98:	85 d2                	test   %edx,%edx
+80107a9a:	74 26                	je     80107ac2 <argfd+0x5b>
+    return -1;
+  if(pfd)
+80107a9c:	85 f6                	test   %esi,%esi
+80107a9e:	74 02                	je     80107aa2 <argfd+0x3b>
+    *pfd = fd;
+80107aa0:	89 06                	mov    %eax,(%esi)
+  if(pf)
+    *pf = f;
+  return 0;
+80107aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  if(pf)
+80107aa7:	85 db                	test   %ebx,%ebx
+80107aa9:	74 02                	je     80107aad <argfd+0x46>
+    *pf = f;
+80107aab:	89 13                	mov    %edx,(%ebx)
+}
+80107aad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ab0:	5b                   	pop    %ebx
+80107ab1:	5e                   	pop    %esi
+80107ab2:	5d                   	pop    %ebp
+80107ab3:	c3                   	ret
+    return -1;
+80107ab4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ab9:	eb f2                	jmp    80107aad <argfd+0x46>
+    return -1;
+80107abb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ac0:	eb eb                	jmp    80107aad <argfd+0x46>
+80107ac2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ac7:	eb e4                	jmp    80107aad <argfd+0x46>
+
+80107ac9 <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80107ac9:	55                   	push   %ebp
+80107aca:	89 e5                	mov    %esp,%ebp
+80107acc:	53                   	push   %ebx
+80107acd:	83 ec 04             	sub    $0x4,%esp
+80107ad0:	89 c3                	mov    %eax,%ebx
+  int fd;
+  struct proc *curproc = myproc();
+80107ad2:	e8 e1 cc ff ff       	call   801047b8 <myproc>
+80107ad7:	89 c2                	mov    %eax,%edx
+
+  for(fd = 0; fd < NOFILE; fd++){
+80107ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(curproc->ofile[fd] == 0){
+80107ade:	83 7c 82 28 00       	cmpl   $0x0,0x28(%edx,%eax,4)
+80107ae3:	74 12                	je     80107af7 <fdalloc+0x2e>
+  for(fd = 0; fd < NOFILE; fd++){
+80107ae5:	83 c0 01             	add    $0x1,%eax
+80107ae8:	83 f8 10             	cmp    $0x10,%eax
+80107aeb:	75 f1                	jne    80107ade <fdalloc+0x15>
+      curproc->ofile[fd] = f;
+      return fd;
+    }
+  }
+  return -1;
+80107aed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107af5:	c9                   	leave
+80107af6:	c3                   	ret
+      curproc->ofile[fd] = f;
+80107af7:	89 5c 82 28          	mov    %ebx,0x28(%edx,%eax,4)
+      return fd;
+80107afb:	eb f5                	jmp    80107af2 <fdalloc+0x29>
+
+80107afd <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80107afd:	55                   	push   %ebp
+80107afe:	89 e5                	mov    %esp,%ebp
+80107b00:	57                   	push   %edi
+80107b01:	56                   	push   %esi
+80107b02:	53                   	push   %ebx
+80107b03:	83 ec 44             	sub    $0x44,%esp
+80107b06:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80107b09:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+80107b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80107b0f:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+80107b12:	52                   	push   %edx
+80107b13:	50                   	push   %eax
+80107b14:	e8 43 a3 ff ff       	call   80101e5c <nameiparent>
+80107b19:	89 c6                	mov    %eax,%esi
+80107b1b:	83 c4 10             	add    $0x10,%esp
+80107b1e:	85 c0                	test   %eax,%eax
+80107b20:	0f 84 2f 01 00 00    	je     80107c55 <create+0x158>
+    return 0;
+  ilock(dp);
+80107b26:	83 ec 0c             	sub    $0xc,%esp
+80107b29:	50                   	push   %eax
+80107b2a:	e8 f9 9a ff ff       	call   80101628 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+80107b2f:	83 c4 0c             	add    $0xc,%esp
+80107b32:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80107b35:	50                   	push   %eax
+80107b36:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80107b39:	50                   	push   %eax
+80107b3a:	56                   	push   %esi
+80107b3b:	e8 3c a0 ff ff       	call   80101b7c <dirlookup>
+80107b40:	89 c3                	mov    %eax,%ebx
+80107b42:	83 c4 10             	add    $0x10,%esp
+80107b45:	85 c0                	test   %eax,%eax
+80107b47:	74 3d                	je     80107b86 <create+0x89>
+    iunlockput(dp);
+80107b49:	83 ec 0c             	sub    $0xc,%esp
+80107b4c:	56                   	push   %esi
+80107b4d:	e8 2d 9d ff ff       	call   8010187f <iunlockput>
+    ilock(ip);
+80107b52:	89 1c 24             	mov    %ebx,(%esp)
+80107b55:	e8 ce 9a ff ff       	call   80101628 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80107b5a:	83 c4 10             	add    $0x10,%esp
+80107b5d:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%ebp)
+80107b62:	75 07                	jne    80107b6b <create+0x6e>
+80107b64:	66 83 7b 58 02       	cmpw   $0x2,0x58(%ebx)
+80107b69:	74 11                	je     80107b7c <create+0x7f>
+      return ip;
+    iunlockput(ip);
+80107b6b:	83 ec 0c             	sub    $0xc,%esp
+80107b6e:	53                   	push   %ebx
+80107b6f:	e8 0b 9d ff ff       	call   8010187f <iunlockput>
+    return 0;
+80107b74:	83 c4 10             	add    $0x10,%esp
+80107b77:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80107b7c:	89 d8                	mov    %ebx,%eax
+80107b7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b81:	5b                   	pop    %ebx
+80107b82:	5e                   	pop    %esi
+80107b83:	5f                   	pop    %edi
+80107b84:	5d                   	pop    %ebp
+80107b85:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80107b86:	83 ec 08             	sub    $0x8,%esp
+80107b89:	0f bf 45 c4          	movswl -0x3c(%ebp),%eax
+80107b8d:	50                   	push   %eax
+80107b8e:	ff 36                	push   (%esi)
+80107b90:	e8 44 99 ff ff       	call   801014d9 <ialloc>
+80107b95:	89 c3                	mov    %eax,%ebx
+80107b97:	83 c4 10             	add    $0x10,%esp
+80107b9a:	85 c0                	test   %eax,%eax
+80107b9c:	74 52                	je     80107bf0 <create+0xf3>
+  ilock(ip);
+80107b9e:	83 ec 0c             	sub    $0xc,%esp
+80107ba1:	50                   	push   %eax
+80107ba2:	e8 81 9a ff ff       	call   80101628 <ilock>
+  ip->major = major;
+80107ba7:	0f b7 45 c0          	movzwl -0x40(%ebp),%eax
+80107bab:	66 89 43 5a          	mov    %ax,0x5a(%ebx)
+  ip->minor = minor;
+80107baf:	66 89 7b 5c          	mov    %di,0x5c(%ebx)
+  ip->nlink = 1;
+80107bb3:	66 c7 43 5e 01 00    	movw   $0x1,0x5e(%ebx)
+  iupdate(ip);
+80107bb9:	89 1c 24             	mov    %ebx,(%esp)
+80107bbc:	e8 bd 99 ff ff       	call   8010157e <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80107bc1:	83 c4 10             	add    $0x10,%esp
+80107bc4:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%ebp)
+80107bc9:	74 32                	je     80107bfd <create+0x100>
+  if(dirlink(dp, name, ip->inum) < 0)
+80107bcb:	83 ec 04             	sub    $0x4,%esp
+80107bce:	ff 73 04             	push   0x4(%ebx)
+80107bd1:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80107bd4:	50                   	push   %eax
+80107bd5:	56                   	push   %esi
+80107bd6:	e8 b4 a1 ff ff       	call   80101d8f <dirlink>
+80107bdb:	83 c4 10             	add    $0x10,%esp
+80107bde:	85 c0                	test   %eax,%eax
+80107be0:	78 66                	js     80107c48 <create+0x14b>
+  iunlockput(dp);
+80107be2:	83 ec 0c             	sub    $0xc,%esp
+80107be5:	56                   	push   %esi
+80107be6:	e8 94 9c ff ff       	call   8010187f <iunlockput>
+  return ip;
+80107beb:	83 c4 10             	add    $0x10,%esp
+80107bee:	eb 8c                	jmp    80107b7c <create+0x7f>
+    panic("create: ialloc");
+80107bf0:	83 ec 0c             	sub    $0xc,%esp
+80107bf3:	68 08 ba 10 80       	push   $0x8010ba08
+80107bf8:	e8 45 87 ff ff       	call   80100342 <panic>
+    dp->nlink++;  // for ".."
+80107bfd:	66 83 46 5e 01       	addw   $0x1,0x5e(%esi)
+    iupdate(dp);
+80107c02:	83 ec 0c             	sub    $0xc,%esp
+80107c05:	56                   	push   %esi
+80107c06:	e8 73 99 ff ff       	call   8010157e <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80107c0b:	83 c4 0c             	add    $0xc,%esp
+80107c0e:	ff 73 04             	push   0x4(%ebx)
+80107c11:	68 18 ba 10 80       	push   $0x8010ba18
+80107c16:	53                   	push   %ebx
+80107c17:	e8 73 a1 ff ff       	call   80101d8f <dirlink>
+80107c1c:	83 c4 10             	add    $0x10,%esp
+80107c1f:	85 c0                	test   %eax,%eax
+80107c21:	78 18                	js     80107c3b <create+0x13e>
+80107c23:	83 ec 04             	sub    $0x4,%esp
+80107c26:	ff 76 04             	push   0x4(%esi)
+80107c29:	68 17 ba 10 80       	push   $0x8010ba17
+80107c2e:	53                   	push   %ebx
+80107c2f:	e8 5b a1 ff ff       	call   80101d8f <dirlink>
+80107c34:	83 c4 10             	add    $0x10,%esp
+80107c37:	85 c0                	test   %eax,%eax
+80107c39:	79 90                	jns    80107bcb <create+0xce>
+      panic("create dots");
+80107c3b:	83 ec 0c             	sub    $0xc,%esp
+80107c3e:	68 1a ba 10 80       	push   $0x8010ba1a
+80107c43:	e8 fa 86 ff ff       	call   80100342 <panic>
+    panic("create: dirlink");
+80107c48:	83 ec 0c             	sub    $0xc,%esp
+80107c4b:	68 26 ba 10 80       	push   $0x8010ba26
+80107c50:	e8 ed 86 ff ff       	call   80100342 <panic>
+    return 0;
+80107c55:	89 c3                	mov    %eax,%ebx
+80107c57:	e9 20 ff ff ff       	jmp    80107b7c <create+0x7f>
+
+80107c5c <fetchargv>:
+}
+
+// Fetch the null-terminated argument vector at user address uargv.
+static int
+fetchargv(uint uargv, char **argv)
+{
+80107c5c:	55                   	push   %ebp
+80107c5d:	89 e5                	mov    %esp,%ebp
+80107c5f:	57                   	push   %edi
+80107c60:	56                   	push   %esi
+80107c61:	53                   	push   %ebx
+80107c62:	83 ec 30             	sub    $0x30,%esp
+80107c65:	89 c7                	mov    %eax,%edi
+  int i;
+  uint uarg;
+
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
+80107c67:	68 80 00 00 00       	push   $0x80
+80107c6c:	6a 00                	push   $0x0
+80107c6e:	89 55 d0             	mov    %edx,-0x30(%ebp)
+80107c71:	52                   	push   %edx
+80107c72:	e8 e6 f9 ff ff       	call   8010765d <memset>
+80107c77:	83 c4 10             	add    $0x10,%esp
+80107c7a:	89 f9                	mov    %edi,%ecx
+80107c7c:	89 fb                	mov    %edi,%ebx
+  for(i=0;; i++){
+80107c7e:	be 00 00 00 00       	mov    $0x0,%esi
+    if(i >= MAXARG)
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80107c83:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80107c86:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80107c89:	29 c8                	sub    %ecx,%eax
+80107c8b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80107c8e:	83 ec 08             	sub    $0x8,%esp
+80107c91:	57                   	push   %edi
+80107c92:	53                   	push   %ebx
+80107c93:	e8 a4 fb ff ff       	call   8010783c <fetchint>
+80107c98:	83 c4 10             	add    $0x10,%esp
+80107c9b:	85 c0                	test   %eax,%eax
+80107c9d:	78 47                	js     80107ce6 <fetchargv+0x8a>
+    if(uarg == 0){
+80107c9f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107ca2:	85 c0                	test   %eax,%eax
+80107ca4:	74 2f                	je     80107cd5 <fetchargv+0x79>
+    if(fetchstr(uarg, &argv[i]) < 0)
+80107ca6:	83 ec 08             	sub    $0x8,%esp
+80107ca9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80107cac:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+80107caf:	52                   	push   %edx
+80107cb0:	50                   	push   %eax
+80107cb1:	e8 da fb ff ff       	call   80107890 <fetchstr>
+80107cb6:	83 c4 10             	add    $0x10,%esp
+80107cb9:	85 c0                	test   %eax,%eax
+80107cbb:	78 30                	js     80107ced <fetchargv+0x91>
+  for(i=0;; i++){
+80107cbd:	83 c6 01             	add    $0x1,%esi
+    if(i >= MAXARG)
+80107cc0:	83 c3 04             	add    $0x4,%ebx
+80107cc3:	83 fe 20             	cmp    $0x20,%esi
+80107cc6:	75 c6                	jne    80107c8e <fetchargv+0x32>
+      return -1;
+80107cc8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      return -1;
+  }
+  return 0;
+}
+80107ccd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107cd0:	5b                   	pop    %ebx
+80107cd1:	5e                   	pop    %esi
+80107cd2:	5f                   	pop    %edi
+80107cd3:	5d                   	pop    %ebp
+80107cd4:	c3                   	ret
+      argv[i] = 0;
+80107cd5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80107cd8:	c7 04 b0 00 00 00 00 	movl   $0x0,(%eax,%esi,4)
+  return 0;
+80107cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+80107ce4:	eb e7                	jmp    80107ccd <fetchargv+0x71>
+      return -1;
+80107ce6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ceb:	eb e0                	jmp    80107ccd <fetchargv+0x71>
+      return -1;
+80107ced:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107cf2:	eb d9                	jmp    80107ccd <fetchargv+0x71>
+
+80107cf4 <sys_dup>:
+{
+80107cf4:	55                   	push   %ebp
+80107cf5:	89 e5                	mov    %esp,%ebp
+80107cf7:	56                   	push   %esi
+80107cf8:	53                   	push   %ebx
+80107cf9:	83 ec 10             	sub    $0x10,%esp
+  if(argfd(0, 0, &f) < 0)
+80107cfc:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80107cff:	ba 00 00 00 00       	mov    $0x0,%edx
+80107d04:	b8 00 00 00 00       	mov    $0x0,%eax
+80107d09:	e8 59 fd ff ff       	call   80107a67 <argfd>
+80107d0e:	85 c0                	test   %eax,%eax
+80107d10:	78 25                	js     80107d37 <sys_dup+0x43>
+  if((fd=fdalloc(f)) < 0)
+80107d12:	8b 75 f4             	mov    -0xc(%ebp),%esi
+80107d15:	89 f0                	mov    %esi,%eax
+80107d17:	e8 ad fd ff ff       	call   80107ac9 <fdalloc>
+80107d1c:	89 c3                	mov    %eax,%ebx
+80107d1e:	85 c0                	test   %eax,%eax
+80107d20:	78 1c                	js     80107d3e <sys_dup+0x4a>
+  filedup(f);
+80107d22:	83 ec 0c             	sub    $0xc,%esp
+80107d25:	56                   	push   %esi
+80107d26:	e8 2c 91 ff ff       	call   80100e57 <filedup>
+  return fd;
+80107d2b:	83 c4 10             	add    $0x10,%esp
+}
+80107d2e:	89 d8                	mov    %ebx,%eax
+80107d30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d33:	5b                   	pop    %ebx
+80107d34:	5e                   	pop    %esi
+80107d35:	5d                   	pop    %ebp
+80107d36:	c3                   	ret
+    return -1;
+80107d37:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80107d3c:	eb f0                	jmp    80107d2e <sys_dup+0x3a>
+    return -1;
+80107d3e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80107d43:	eb e9                	jmp    80107d2e <sys_dup+0x3a>
+
+80107d45 <sys_read>:
+{
+80107d45:	55                   	push   %ebp
+80107d46:	89 e5                	mov    %esp,%ebp
+80107d48:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+80107d4b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80107d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+80107d53:	b8 00 00 00 00       	mov    $0x0,%eax
+80107d58:	e8 0a fd ff ff       	call   80107a67 <argfd>
+80107d5d:	85 c0                	test   %eax,%eax
+80107d5f:	78 43                	js     80107da4 <sys_read+0x5f>
+80107d61:	83 ec 08             	sub    $0x8,%esp
+80107d64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107d67:	50                   	push   %eax
+80107d68:	6a 02                	push   $0x2
+80107d6a:	e8 9d fb ff ff       	call   8010790c <argint>
+80107d6f:	83 c4 10             	add    $0x10,%esp
+80107d72:	85 c0                	test   %eax,%eax
+80107d74:	78 35                	js     80107dab <sys_read+0x66>
+80107d76:	83 ec 04             	sub    $0x4,%esp
+80107d79:	ff 75 f0             	push   -0x10(%ebp)
+80107d7c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80107d7f:	50                   	push   %eax
+80107d80:	6a 01                	push   $0x1
+80107d82:	e8 3e fc ff ff       	call   801079c5 <argptrw>
+80107d87:	83 c4 10             	add    $0x10,%esp
+80107d8a:	85 c0                	test   %eax,%eax
+80107d8c:	78 24                	js     80107db2 <sys_read+0x6d>
+  return fileread(f, p, n);
+80107d8e:	83 ec 04             	sub    $0x4,%esp
+80107d91:	ff 75 f0             	push   -0x10(%ebp)
+80107d94:	ff 75 ec             	push   -0x14(%ebp)
+80107d97:	ff 75 f4             	push   -0xc(%ebp)
+80107d9a:	e8 f9 91 ff ff       	call   80100f98 <fileread>
+80107d9f:	83 c4 10             	add    $0x10,%esp
+}
+80107da2:	c9                   	leave
+80107da3:	c3                   	ret
+    return -1;
+80107da4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107da9:	eb f7                	jmp    80107da2 <sys_read+0x5d>
+80107dab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107db0:	eb f0                	jmp    80107da2 <sys_read+0x5d>
+80107db2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107db7:	eb e9                	jmp    80107da2 <sys_read+0x5d>
+
+80107db9 <sys_write>:
+{
+80107db9:	55                   	push   %ebp
+80107dba:	89 e5                	mov    %esp,%ebp
+80107dbc:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80107dbf:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80107dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+80107dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+80107dcc:	e8 96 fc ff ff       	call   80107a67 <argfd>
+80107dd1:	85 c0                	test   %eax,%eax
+80107dd3:	78 43                	js     80107e18 <sys_write+0x5f>
+80107dd5:	83 ec 08             	sub    $0x8,%esp
+80107dd8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107ddb:	50                   	push   %eax
+80107ddc:	6a 02                	push   $0x2
+80107dde:	e8 29 fb ff ff       	call   8010790c <argint>
+80107de3:	83 c4 10             	add    $0x10,%esp
+80107de6:	85 c0                	test   %eax,%eax
+80107de8:	78 35                	js     80107e1f <sys_write+0x66>
+80107dea:	83 ec 04             	sub    $0x4,%esp
+80107ded:	ff 75 f0             	push   -0x10(%ebp)
+80107df0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80107df3:	50                   	push   %eax
+80107df4:	6a 01                	push   $0x1
+80107df6:	e8 b2 fb ff ff       	call   801079ad <argptr>
+80107dfb:	83 c4 10             	add    $0x10,%esp
+80107dfe:	85 c0                	test   %eax,%eax
+80107e00:	78 24                	js     80107e26 <sys_write+0x6d>
+  return filewrite(f, p, n);
+80107e02:	83 ec 04             	sub    $0x4,%esp
+80107e05:	ff 75 f0             	push   -0x10(%ebp)
+80107e08:	ff 75 ec             	push   -0x14(%ebp)
+80107e0b:	ff 75 f4             	push   -0xc(%ebp)
+80107e0e:	e8 0a 92 ff ff       	call   8010101d <filewrite>
+80107e13:	83 c4 10             	add    $0x10,%esp
+}
+80107e16:	c9                   	leave
+80107e17:	c3                   	ret
+    return -1;
+80107e18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e1d:	eb f7                	jmp    80107e16 <sys_write+0x5d>
+80107e1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e24:	eb f0                	jmp    80107e16 <sys_write+0x5d>
+80107e26:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e2b:	eb e9                	jmp    80107e16 <sys_write+0x5d>
+
+80107e2d <sys_close>:
+{
+80107e2d:	55                   	push   %ebp
+80107e2e:	89 e5                	mov    %esp,%ebp
+80107e30:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, &fd, &f) < 0)
+80107e33:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+80107e36:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80107e39:	b8 00 00 00 00       	mov    $0x0,%eax
+80107e3e:	e8 24 fc ff ff       	call   80107a67 <argfd>
+80107e43:	85 c0                	test   %eax,%eax
+80107e45:	78 25                	js     80107e6c <sys_close+0x3f>
+  myproc()->ofile[fd] = 0;
+80107e47:	e8 6c c9 ff ff       	call   801047b8 <myproc>
+80107e4c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107e4f:	c7 44 90 28 00 00 00 	movl   $0x0,0x28(%eax,%edx,4)
+80107e56:	00 
+  fileclose(f);
+80107e57:	83 ec 0c             	sub    $0xc,%esp
+80107e5a:	ff 75 f0             	push   -0x10(%ebp)
+80107e5d:	e8 3a 90 ff ff       	call   80100e9c <fileclose>
+  return 0;
+80107e62:	83 c4 10             	add    $0x10,%esp
+80107e65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107e6a:	c9                   	leave
+80107e6b:	c3                   	ret
+    return -1;
+80107e6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e71:	eb f7                	jmp    80107e6a <sys_close+0x3d>
+
+80107e73 <sys_fstat>:
+{
+80107e73:	55                   	push   %ebp
+80107e74:	89 e5                	mov    %esp,%ebp
+80107e76:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
+80107e79:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80107e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+80107e81:	b8 00 00 00 00       	mov    $0x0,%eax
+80107e86:	e8 dc fb ff ff       	call   80107a67 <argfd>
+80107e8b:	85 c0                	test   %eax,%eax
+80107e8d:	78 2a                	js     80107eb9 <sys_fstat+0x46>
+80107e8f:	83 ec 04             	sub    $0x4,%esp
+80107e92:	6a 14                	push   $0x14
+80107e94:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107e97:	50                   	push   %eax
+80107e98:	6a 01                	push   $0x1
+80107e9a:	e8 26 fb ff ff       	call   801079c5 <argptrw>
+80107e9f:	83 c4 10             	add    $0x10,%esp
+80107ea2:	85 c0                	test   %eax,%eax
+80107ea4:	78 1a                	js     80107ec0 <sys_fstat+0x4d>
+  return filestat(f, st);
+80107ea6:	83 ec 08             	sub    $0x8,%esp
+80107ea9:	ff 75 f0             	push   -0x10(%ebp)
+80107eac:	ff 75 f4             	push   -0xc(%ebp)
+80107eaf:	e8 9d 90 ff ff       	call   80100f51 <filestat>
+80107eb4:	83 c4 10             	add    $0x10,%esp
+}
+80107eb7:	c9                   	leave
+80107eb8:	c3                   	ret
+    return -1;
+80107eb9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ebe:	eb f7                	jmp    80107eb7 <sys_fstat+0x44>
+80107ec0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ec5:	eb f0                	jmp    80107eb7 <sys_fstat+0x44>
+
+80107ec7 <sys_link>:
+{
+80107ec7:	55                   	push   %ebp
+80107ec8:	89 e5                	mov    %esp,%ebp
+80107eca:	56                   	push   %esi
+80107ecb:	53                   	push   %ebx
+80107ecc:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107ecf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80107ed2:	50                   	push   %eax
+80107ed3:	6a 00                	push   $0x0
+80107ed5:	e8 03 fb ff ff       	call   801079dd <argstr>
+80107eda:	83 c4 10             	add    $0x10,%esp
+80107edd:	85 c0                	test   %eax,%eax
+80107edf:	0f 88 26 01 00 00    	js     8010800b <sys_link+0x144>
+80107ee5:	83 ec 08             	sub    $0x8,%esp
+80107ee8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80107eeb:	50                   	push   %eax
+80107eec:	6a 01                	push   $0x1
+80107eee:	e8 ea fa ff ff       	call   801079dd <argstr>
+80107ef3:	83 c4 10             	add    $0x10,%esp
+80107ef6:	85 c0                	test   %eax,%eax
+80107ef8:	0f 88 14 01 00 00    	js     80108012 <sys_link+0x14b>
+  begin_op();
+80107efe:	e8 46 b0 ff ff       	call   80102f49 <begin_op>
+  if((ip = namei(old)) == 0){
+80107f03:	83 ec 0c             	sub    $0xc,%esp
+80107f06:	ff 75 e0             	push   -0x20(%ebp)
+80107f09:	e8 36 9f ff ff       	call   80101e44 <namei>
+80107f0e:	89 c3                	mov    %eax,%ebx
+80107f10:	83 c4 10             	add    $0x10,%esp
+80107f13:	85 c0                	test   %eax,%eax
+80107f15:	0f 84 93 00 00 00    	je     80107fae <sys_link+0xe7>
+  ilock(ip);
+80107f1b:	83 ec 0c             	sub    $0xc,%esp
+80107f1e:	50                   	push   %eax
+80107f1f:	e8 04 97 ff ff       	call   80101628 <ilock>
+  if(ip->type == T_DIR){
+80107f24:	83 c4 10             	add    $0x10,%esp
+80107f27:	66 83 7b 58 01       	cmpw   $0x1,0x58(%ebx)
+80107f2c:	0f 84 88 00 00 00    	je     80107fba <sys_link+0xf3>
+  ip->nlink++;
+80107f32:	66 83 43 5e 01       	addw   $0x1,0x5e(%ebx)
+  iupdate(ip);
+80107f37:	83 ec 0c             	sub    $0xc,%esp
+80107f3a:	53                   	push   %ebx
+80107f3b:	e8 3e 96 ff ff       	call   8010157e <iupdate>
+  iunlock(ip);
+80107f40:	89 1c 24             	mov    %ebx,(%esp)
+80107f43:	e8 a2 97 ff ff       	call   801016ea <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80107f48:	83 c4 08             	add    $0x8,%esp
+80107f4b:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80107f4e:	50                   	push   %eax
+80107f4f:	ff 75 e4             	push   -0x1c(%ebp)
+80107f52:	e8 05 9f ff ff       	call   80101e5c <nameiparent>
+80107f57:	89 c6                	mov    %eax,%esi
+80107f59:	83 c4 10             	add    $0x10,%esp
+80107f5c:	85 c0                	test   %eax,%eax
+80107f5e:	74 7e                	je     80107fde <sys_link+0x117>
+  ilock(dp);
+80107f60:	83 ec 0c             	sub    $0xc,%esp
+80107f63:	50                   	push   %eax
+80107f64:	e8 bf 96 ff ff       	call   80101628 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80107f69:	83 c4 10             	add    $0x10,%esp
+80107f6c:	8b 03                	mov    (%ebx),%eax
+80107f6e:	39 06                	cmp    %eax,(%esi)
+80107f70:	75 60                	jne    80107fd2 <sys_link+0x10b>
+80107f72:	83 ec 04             	sub    $0x4,%esp
+80107f75:	ff 73 04             	push   0x4(%ebx)
+80107f78:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80107f7b:	50                   	push   %eax
+80107f7c:	56                   	push   %esi
+80107f7d:	e8 0d 9e ff ff       	call   80101d8f <dirlink>
+80107f82:	83 c4 10             	add    $0x10,%esp
+80107f85:	85 c0                	test   %eax,%eax
+80107f87:	78 49                	js     80107fd2 <sys_link+0x10b>
+  iunlockput(dp);
+80107f89:	83 ec 0c             	sub    $0xc,%esp
+80107f8c:	56                   	push   %esi
+80107f8d:	e8 ed 98 ff ff       	call   8010187f <iunlockput>
+  iput(ip);
+80107f92:	89 1c 24             	mov    %ebx,(%esp)
+80107f95:	e8 95 97 ff ff       	call   8010172f <iput>
+  end_op();
+80107f9a:	e8 25 b0 ff ff       	call   80102fc4 <end_op>
+  return 0;
+80107f9f:	83 c4 10             	add    $0x10,%esp
+80107fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107fa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107faa:	5b                   	pop    %ebx
+80107fab:	5e                   	pop    %esi
+80107fac:	5d                   	pop    %ebp
+80107fad:	c3                   	ret
+    end_op();
+80107fae:	e8 11 b0 ff ff       	call   80102fc4 <end_op>
+    return -1;
+80107fb3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fb8:	eb ed                	jmp    80107fa7 <sys_link+0xe0>
+    iunlockput(ip);
+80107fba:	83 ec 0c             	sub    $0xc,%esp
+80107fbd:	53                   	push   %ebx
+80107fbe:	e8 bc 98 ff ff       	call   8010187f <iunlockput>
+    end_op();
+80107fc3:	e8 fc af ff ff       	call   80102fc4 <end_op>
+    return -1;
+80107fc8:	83 c4 10             	add    $0x10,%esp
+80107fcb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fd0:	eb d5                	jmp    80107fa7 <sys_link+0xe0>
+    iunlockput(dp);
+80107fd2:	83 ec 0c             	sub    $0xc,%esp
+80107fd5:	56                   	push   %esi
+80107fd6:	e8 a4 98 ff ff       	call   8010187f <iunlockput>
+    goto bad;
+80107fdb:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80107fde:	83 ec 0c             	sub    $0xc,%esp
+80107fe1:	53                   	push   %ebx
+80107fe2:	e8 41 96 ff ff       	call   80101628 <ilock>
+  ip->nlink--;
+80107fe7:	66 83 6b 5e 01       	subw   $0x1,0x5e(%ebx)
+  iupdate(ip);
+80107fec:	89 1c 24             	mov    %ebx,(%esp)
+80107fef:	e8 8a 95 ff ff       	call   8010157e <iupdate>
+  iunlockput(ip);
+80107ff4:	89 1c 24             	mov    %ebx,(%esp)
+80107ff7:	e8 83 98 ff ff       	call   8010187f <iunlockput>
+  end_op();
+80107ffc:	e8 c3 af ff ff       	call   80102fc4 <end_op>
+  return -1;
+80108001:	83 c4 10             	add    $0x10,%esp
+80108004:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108009:	eb 9c                	jmp    80107fa7 <sys_link+0xe0>
+    return -1;
+8010800b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108010:	eb 95                	jmp    80107fa7 <sys_link+0xe0>
+80108012:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108017:	eb 8e                	jmp    80107fa7 <sys_link+0xe0>
+
+80108019 <sys_unlink>:
+{
+80108019:	55                   	push   %ebp
+8010801a:	89 e5                	mov    %esp,%ebp
+8010801c:	57                   	push   %edi
+8010801d:	56                   	push   %esi
+8010801e:	53                   	push   %ebx
+8010801f:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+80108022:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80108025:	50                   	push   %eax
+80108026:	6a 00                	push   $0x0
+80108028:	e8 b0 f9 ff ff       	call   801079dd <argstr>
+8010802d:	83 c4 10             	add    $0x10,%esp
+80108030:	85 c0                	test   %eax,%eax
+80108032:	0f 88 91 01 00 00    	js     801081c9 <sys_unlink+0x1b0>
+  begin_op();
+80108038:	e8 0c af ff ff       	call   80102f49 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+8010803d:	83 ec 08             	sub    $0x8,%esp
+80108040:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108043:	50                   	push   %eax
+80108044:	ff 75 c4             	push   -0x3c(%ebp)
+80108047:	e8 10 9e ff ff       	call   80101e5c <nameiparent>
+8010804c:	89 c7                	mov    %eax,%edi
+8010804e:	83 c4 10             	add    $0x10,%esp
+80108051:	85 c0                	test   %eax,%eax
+80108053:	0f 84 ef 00 00 00    	je     80108148 <sys_unlink+0x12f>
+  ilock(dp);
+80108059:	83 ec 0c             	sub    $0xc,%esp
+8010805c:	50                   	push   %eax
+8010805d:	e8 c6 95 ff ff       	call   80101628 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80108062:	83 c4 08             	add    $0x8,%esp
+80108065:	68 18 ba 10 80       	push   $0x8010ba18
+8010806a:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010806d:	50                   	push   %eax
+8010806e:	e8 f4 9a ff ff       	call   80101b67 <namecmp>
+80108073:	83 c4 10             	add    $0x10,%esp
+80108076:	85 c0                	test   %eax,%eax
+80108078:	0f 84 61 01 00 00    	je     801081df <sys_unlink+0x1c6>
+8010807e:	83 ec 08             	sub    $0x8,%esp
+80108081:	68 17 ba 10 80       	push   $0x8010ba17
+80108086:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108089:	50                   	push   %eax
+8010808a:	e8 d8 9a ff ff       	call   80101b67 <namecmp>
+8010808f:	83 c4 10             	add    $0x10,%esp
+80108092:	85 c0                	test   %eax,%eax
+80108094:	0f 84 45 01 00 00    	je     801081df <sys_unlink+0x1c6>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+8010809a:	83 ec 04             	sub    $0x4,%esp
+8010809d:	8d 45 c0             	lea    -0x40(%ebp),%eax
+801080a0:	50                   	push   %eax
+801080a1:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801080a4:	50                   	push   %eax
+801080a5:	57                   	push   %edi
+801080a6:	e8 d1 9a ff ff       	call   80101b7c <dirlookup>
+801080ab:	89 c3                	mov    %eax,%ebx
+801080ad:	83 c4 10             	add    $0x10,%esp
+801080b0:	85 c0                	test   %eax,%eax
+801080b2:	0f 84 27 01 00 00    	je     801081df <sys_unlink+0x1c6>
+  ilock(ip);
+801080b8:	83 ec 0c             	sub    $0xc,%esp
+801080bb:	50                   	push   %eax
+801080bc:	e8 67 95 ff ff       	call   80101628 <ilock>
+  if(ip->nlink < 1)
+801080c1:	83 c4 10             	add    $0x10,%esp
+801080c4:	66 83 7b 5e 00       	cmpw   $0x0,0x5e(%ebx)
+801080c9:	0f 8e 85 00 00 00    	jle    80108154 <sys_unlink+0x13b>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801080cf:	66 83 7b 58 01       	cmpw   $0x1,0x58(%ebx)
+801080d4:	0f 84 87 00 00 00    	je     80108161 <sys_unlink+0x148>
+  memset(&de, 0, sizeof(de));
+801080da:	83 ec 04             	sub    $0x4,%esp
+801080dd:	6a 10                	push   $0x10
+801080df:	6a 00                	push   $0x0
+801080e1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801080e4:	56                   	push   %esi
+801080e5:	e8 73 f5 ff ff       	call   8010765d <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801080ea:	6a 10                	push   $0x10
+801080ec:	ff 75 c0             	push   -0x40(%ebp)
+801080ef:	56                   	push   %esi
+801080f0:	57                   	push   %edi
+801080f1:	e8 31 99 ff ff       	call   80101a27 <writei>
+801080f6:	83 c4 20             	add    $0x20,%esp
+801080f9:	83 f8 10             	cmp    $0x10,%eax
+801080fc:	0f 85 a4 00 00 00    	jne    801081a6 <sys_unlink+0x18d>
+  if(ip->type == T_DIR){
+80108102:	66 83 7b 58 01       	cmpw   $0x1,0x58(%ebx)
+80108107:	0f 84 a6 00 00 00    	je     801081b3 <sys_unlink+0x19a>
+  iunlockput(dp);
+8010810d:	83 ec 0c             	sub    $0xc,%esp
+80108110:	57                   	push   %edi
+80108111:	e8 69 97 ff ff       	call   8010187f <iunlockput>
+  ip->nlink--;
+80108116:	66 83 6b 5e 01       	subw   $0x1,0x5e(%ebx)
+  iupdate(ip);
+8010811b:	89 1c 24             	mov    %ebx,(%esp)
+8010811e:	e8 5b 94 ff ff       	call   8010157e <iupdate>
+  pcinval(ip);
+80108123:	89 1c 24             	mov    %ebx,(%esp)
+80108126:	e8 14 b6 ff ff       	call   8010373f <pcinval>
+  iunlockput(ip);
+8010812b:	89 1c 24             	mov    %ebx,(%esp)
+8010812e:	e8 4c 97 ff ff       	call   8010187f <iunlockput>
+  end_op();
+80108133:	e8 8c ae ff ff       	call   80102fc4 <end_op>
+  return 0;
+80108138:	83 c4 10             	add    $0x10,%esp
+8010813b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108143:	5b                   	pop    %ebx
+80108144:	5e                   	pop    %esi
+80108145:	5f                   	pop    %edi
+80108146:	5d                   	pop    %ebp
+80108147:	c3                   	ret
+    end_op();
+80108148:	e8 77 ae ff ff       	call   80102fc4 <end_op>
+    return -1;
+8010814d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108152:	eb ec                	jmp    80108140 <sys_unlink+0x127>
+    panic("unlink: nlink < 1");
+80108154:	83 ec 0c             	sub    $0xc,%esp
+80108157:	68 36 ba 10 80       	push   $0x8010ba36
+8010815c:	e8 e1 81 ff ff       	call   80100342 <panic>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108161:	83 7b 60 20          	cmpl   $0x20,0x60(%ebx)
+80108165:	0f 86 6f ff ff ff    	jbe    801080da <sys_unlink+0xc1>
+8010816b:	be 20 00 00 00       	mov    $0x20,%esi
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108170:	6a 10                	push   $0x10
+80108172:	56                   	push   %esi
+80108173:	8d 45 b0             	lea    -0x50(%ebp),%eax
+80108176:	50                   	push   %eax
+80108177:	53                   	push   %ebx
+80108178:	e8 b0 97 ff ff       	call   8010192d <readi>
+8010817d:	83 c4 10             	add    $0x10,%esp
+80108180:	83 f8 10             	cmp    $0x10,%eax
+80108183:	75 14                	jne    80108199 <sys_unlink+0x180>
+    if(de.inum != 0)
+80108185:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+8010818a:	75 47                	jne    801081d3 <sys_unlink+0x1ba>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+8010818c:	83 c6 10             	add    $0x10,%esi
+8010818f:	3b 73 60             	cmp    0x60(%ebx),%esi
+80108192:	72 dc                	jb     80108170 <sys_unlink+0x157>
+80108194:	e9 41 ff ff ff       	jmp    801080da <sys_unlink+0xc1>
+      panic("isdirempty: readi");
+80108199:	83 ec 0c             	sub    $0xc,%esp
+8010819c:	68 48 ba 10 80       	push   $0x8010ba48
+801081a1:	e8 9c 81 ff ff       	call   80100342 <panic>
+    panic("unlink: writei");
+801081a6:	83 ec 0c             	sub    $0xc,%esp
+801081a9:	68 5a ba 10 80       	push   $0x8010ba5a
+801081ae:	e8 8f 81 ff ff       	call   80100342 <panic>
+    dp->nlink--;
+801081b3:	66 83 6f 5e 01       	subw   $0x1,0x5e(%edi)
+    iupdate(dp);
+801081b8:	83 ec 0c             	sub    $0xc,%esp
+801081bb:	57                   	push   %edi
+801081bc:	e8 bd 93 ff ff       	call   8010157e <iupdate>
+801081c1:	83 c4 10             	add    $0x10,%esp
+801081c4:	e9 44 ff ff ff       	jmp    8010810d <sys_unlink+0xf4>
+    return -1;
+801081c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801081ce:	e9 6d ff ff ff       	jmp    80108140 <sys_unlink+0x127>
+    iunlockput(ip);
+801081d3:	83 ec 0c             	sub    $0xc,%esp
+801081d6:	53                   	push   %ebx
+801081d7:	e8 a3 96 ff ff       	call   8010187f <iunlockput>
+    goto bad;
+801081dc:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+801081df:	83 ec 0c             	sub    $0xc,%esp
+801081e2:	57                   	push   %edi
+801081e3:	e8 97 96 ff ff       	call   8010187f <iunlockput>
+  end_op();
+801081e8:	e8 d7 ad ff ff       	call   80102fc4 <end_op>
+  return -1;
+801081ed:	83 c4 10             	add    $0x10,%esp
+801081f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801081f5:	e9 46 ff ff ff       	jmp    80108140 <sys_unlink+0x127>
+
+801081fa <sys_open>:
+{
+801081fa:	55                   	push   %ebp
+801081fb:	89 e5                	mov    %esp,%ebp
+801081fd:	57                   	push   %edi
+801081fe:	56                   	push   %esi
+801081ff:	53                   	push   %ebx
+80108200:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108203:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108206:	50                   	push   %eax
+80108207:	6a 00                	push   $0x0
+80108209:	e8 cf f7 ff ff       	call   801079dd <argstr>
+8010820e:	83 c4 10             	add    $0x10,%esp
+80108211:	85 c0                	test   %eax,%eax
+80108213:	0f 88 32 01 00 00    	js     8010834b <sys_open+0x151>
+80108219:	83 ec 08             	sub    $0x8,%esp
+8010821c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010821f:	50                   	push   %eax
+80108220:	6a 01                	push   $0x1
+80108222:	e8 e5 f6 ff ff       	call   8010790c <argint>
+80108227:	83 c4 10             	add    $0x10,%esp
+8010822a:	85 c0                	test   %eax,%eax
+8010822c:	0f 88 23 01 00 00    	js     80108355 <sys_open+0x15b>
+  begin_op();
+80108232:	e8 12 ad ff ff       	call   80102f49 <begin_op>
+  if(omode & O_CREATE){
+80108237:	f6 45 e1 02          	testb  $0x2,-0x1f(%ebp)
+8010823b:	0f 84 8a 00 00 00    	je     801082cb <sys_open+0xd1>
+    ip = create(path, T_FILE, 0, 0);
+80108241:	83 ec 0c             	sub    $0xc,%esp
+80108244:	6a 00                	push   $0x0
+80108246:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010824b:	ba 02 00 00 00       	mov    $0x2,%edx
+80108250:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80108253:	e8 a5 f8 ff ff       	call   80107afd <create>
+80108258:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+8010825a:	83 c4 10             	add    $0x10,%esp
+8010825d:	85 c0                	test   %eax,%eax
+8010825f:	74 5e                	je     801082bf <sys_open+0xc5>
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80108261:	e8 92 8b ff ff       	call   80100df8 <filealloc>
+80108266:	89 c3                	mov    %eax,%ebx
+80108268:	85 c0                	test   %eax,%eax
+8010826a:	0f 84 c0 00 00 00    	je     80108330 <sys_open+0x136>
+80108270:	e8 54 f8 ff ff       	call   80107ac9 <fdalloc>
+80108275:	89 c7                	mov    %eax,%edi
+80108277:	85 c0                	test   %eax,%eax
+80108279:	0f 88 a5 00 00 00    	js     80108324 <sys_open+0x12a>
+  iunlock(ip);
+8010827f:	83 ec 0c             	sub    $0xc,%esp
+80108282:	56                   	push   %esi
+80108283:	e8 62 94 ff ff       	call   801016ea <iunlock>
+  end_op();
+80108288:	e8 37 ad ff ff       	call   80102fc4 <end_op>
+  f->type = FD_INODE;
+8010828d:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+80108293:	89 73 10             	mov    %esi,0x10(%ebx)
+  f->off = 0;
+80108296:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  f->readable = !(omode & O_WRONLY);
+8010829d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801082a0:	89 d0                	mov    %edx,%eax
+801082a2:	83 f0 01             	xor    $0x1,%eax
+801082a5:	83 e0 01             	and    $0x1,%eax
+801082a8:	88 43 08             	mov    %al,0x8(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801082ab:	83 c4 10             	add    $0x10,%esp
+801082ae:	f6 c2 03             	test   $0x3,%dl
+801082b1:	0f 95 43 09          	setne  0x9(%ebx)
+}
+801082b5:	89 f8                	mov    %edi,%eax
+801082b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801082ba:	5b                   	pop    %ebx
+801082bb:	5e                   	pop    %esi
+801082bc:	5f                   	pop    %edi
+801082bd:	5d                   	pop    %ebp
+801082be:	c3                   	ret
+      end_op();
+801082bf:	e8 00 ad ff ff       	call   80102fc4 <end_op>
+      return -1;
+801082c4:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801082c9:	eb ea                	jmp    801082b5 <sys_open+0xbb>
+    if((ip = namei(path)) == 0){
+801082cb:	83 ec 0c             	sub    $0xc,%esp
+801082ce:	ff 75 e4             	push   -0x1c(%ebp)
+801082d1:	e8 6e 9b ff ff       	call   80101e44 <namei>
+801082d6:	89 c6                	mov    %eax,%esi
+801082d8:	83 c4 10             	add    $0x10,%esp
+801082db:	85 c0                	test   %eax,%eax
+801082dd:	74 39                	je     80108318 <sys_open+0x11e>
+    ilock(ip);
+801082df:	83 ec 0c             	sub    $0xc,%esp
+801082e2:	50                   	push   %eax
+801082e3:	e8 40 93 ff ff       	call   80101628 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+801082e8:	83 c4 10             	add    $0x10,%esp
+801082eb:	66 83 7e 58 01       	cmpw   $0x1,0x58(%esi)
+801082f0:	0f 85 6b ff ff ff    	jne    80108261 <sys_open+0x67>
+801082f6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801082fa:	0f 84 61 ff ff ff    	je     80108261 <sys_open+0x67>
+      iunlockput(ip);
+80108300:	83 ec 0c             	sub    $0xc,%esp
+80108303:	56                   	push   %esi
+80108304:	e8 76 95 ff ff       	call   8010187f <iunlockput>
+      end_op();
+80108309:	e8 b6 ac ff ff       	call   80102fc4 <end_op>
+      return -1;
+8010830e:	83 c4 10             	add    $0x10,%esp
+80108311:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108316:	eb 9d                	jmp    801082b5 <sys_open+0xbb>
+      end_op();
+80108318:	e8 a7 ac ff ff       	call   80102fc4 <end_op>
+      return -1;
+8010831d:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108322:	eb 91                	jmp    801082b5 <sys_open+0xbb>
+      fileclose(f);
+80108324:	83 ec 0c             	sub    $0xc,%esp
+80108327:	53                   	push   %ebx
+80108328:	e8 6f 8b ff ff       	call   80100e9c <fileclose>
+8010832d:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80108330:	83 ec 0c             	sub    $0xc,%esp
+80108333:	56                   	push   %esi
+80108334:	e8 46 95 ff ff       	call   8010187f <iunlockput>
+    end_op();
+80108339:	e8 86 ac ff ff       	call   80102fc4 <end_op>
+    return -1;
+8010833e:	83 c4 10             	add    $0x10,%esp
+80108341:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108346:	e9 6a ff ff ff       	jmp    801082b5 <sys_open+0xbb>
+    return -1;
+8010834b:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108350:	e9 60 ff ff ff       	jmp    801082b5 <sys_open+0xbb>
+80108355:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010835a:	e9 56 ff ff ff       	jmp    801082b5 <sys_open+0xbb>
+
+8010835f <sys_mkdir>:
+{
+8010835f:	55                   	push   %ebp
+80108360:	89 e5                	mov    %esp,%ebp
+80108362:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+80108365:	e8 df ab ff ff       	call   80102f49 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010836a:	83 ec 08             	sub    $0x8,%esp
+8010836d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108370:	50                   	push   %eax
+80108371:	6a 00                	push   $0x0
+80108373:	e8 65 f6 ff ff       	call   801079dd <argstr>
+80108378:	83 c4 10             	add    $0x10,%esp
+8010837b:	85 c0                	test   %eax,%eax
+8010837d:	78 36                	js     801083b5 <sys_mkdir+0x56>
+8010837f:	83 ec 0c             	sub    $0xc,%esp
+80108382:	6a 00                	push   $0x0
+80108384:	b9 00 00 00 00       	mov    $0x0,%ecx
+80108389:	ba 01 00 00 00       	mov    $0x1,%edx
+8010838e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108391:	e8 67 f7 ff ff       	call   80107afd <create>
+80108396:	83 c4 10             	add    $0x10,%esp
+80108399:	85 c0                	test   %eax,%eax
+8010839b:	74 18                	je     801083b5 <sys_mkdir+0x56>
+  iunlockput(ip);
+8010839d:	83 ec 0c             	sub    $0xc,%esp
+801083a0:	50                   	push   %eax
+801083a1:	e8 d9 94 ff ff       	call   8010187f <iunlockput>
+  end_op();
+801083a6:	e8 19 ac ff ff       	call   80102fc4 <end_op>
+  return 0;
+801083ab:	83 c4 10             	add    $0x10,%esp
+801083ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801083b3:	c9                   	leave
+801083b4:	c3                   	ret
+    end_op();
+801083b5:	e8 0a ac ff ff       	call   80102fc4 <end_op>
+    return -1;
+801083ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083bf:	eb f2                	jmp    801083b3 <sys_mkdir+0x54>
+
+801083c1 <sys_mknod>:
+{
+801083c1:	55                   	push   %ebp
+801083c2:	89 e5                	mov    %esp,%ebp
+801083c4:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+801083c7:	e8 7d ab ff ff       	call   80102f49 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+801083cc:	83 ec 08             	sub    $0x8,%esp
+801083cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801083d2:	50                   	push   %eax
+801083d3:	6a 00                	push   $0x0
+801083d5:	e8 03 f6 ff ff       	call   801079dd <argstr>
+801083da:	83 c4 10             	add    $0x10,%esp
+801083dd:	85 c0                	test   %eax,%eax
+801083df:	78 62                	js     80108443 <sys_mknod+0x82>
+     argint(1, &major) < 0 ||
+801083e1:	83 ec 08             	sub    $0x8,%esp
+801083e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801083e7:	50                   	push   %eax
+801083e8:	6a 01                	push   $0x1
+801083ea:	e8 1d f5 ff ff       	call   8010790c <argint>
+  if((argstr(0, &path)) < 0 ||
+801083ef:	83 c4 10             	add    $0x10,%esp
+801083f2:	85 c0                	test   %eax,%eax
+801083f4:	78 4d                	js     80108443 <sys_mknod+0x82>
+     argint(2, &minor) < 0 ||
+801083f6:	83 ec 08             	sub    $0x8,%esp
+801083f9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801083fc:	50                   	push   %eax
+801083fd:	6a 02                	push   $0x2
+801083ff:	e8 08 f5 ff ff       	call   8010790c <argint>
+     argint(1, &major) < 0 ||
+80108404:	83 c4 10             	add    $0x10,%esp
+80108407:	85 c0                	test   %eax,%eax
+80108409:	78 38                	js     80108443 <sys_mknod+0x82>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+8010840b:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+8010840f:	83 ec 0c             	sub    $0xc,%esp
+80108412:	0f bf 45 ec          	movswl -0x14(%ebp),%eax
+80108416:	50                   	push   %eax
+80108417:	ba 03 00 00 00       	mov    $0x3,%edx
+8010841c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010841f:	e8 d9 f6 ff ff       	call   80107afd <create>
+     argint(2, &minor) < 0 ||
+80108424:	83 c4 10             	add    $0x10,%esp
+80108427:	85 c0                	test   %eax,%eax
+80108429:	74 18                	je     80108443 <sys_mknod+0x82>
+  iunlockput(ip);
+8010842b:	83 ec 0c             	sub    $0xc,%esp
+8010842e:	50                   	push   %eax
+8010842f:	e8 4b 94 ff ff       	call   8010187f <iunlockput>
+  end_op();
+80108434:	e8 8b ab ff ff       	call   80102fc4 <end_op>
+  return 0;
+80108439:	83 c4 10             	add    $0x10,%esp
+8010843c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108441:	c9                   	leave
+80108442:	c3                   	ret
+    end_op();
+80108443:	e8 7c ab ff ff       	call   80102fc4 <end_op>
+    return -1;
+80108448:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010844d:	eb f2                	jmp    80108441 <sys_mknod+0x80>
+
+8010844f <sys_chdir>:
+{
+8010844f:	55                   	push   %ebp
+80108450:	89 e5                	mov    %esp,%ebp
+80108452:	56                   	push   %esi
+80108453:	53                   	push   %ebx
+80108454:	83 ec 10             	sub    $0x10,%esp
+  struct proc *curproc = myproc();
+80108457:	e8 5c c3 ff ff       	call   801047b8 <myproc>
+8010845c:	89 c6                	mov    %eax,%esi
+  begin_op();
+8010845e:	e8 e6 aa ff ff       	call   80102f49 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108463:	83 ec 08             	sub    $0x8,%esp
+80108466:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108469:	50                   	push   %eax
+8010846a:	6a 00                	push   $0x0
+8010846c:	e8 6c f5 ff ff       	call   801079dd <argstr>
+80108471:	83 c4 10             	add    $0x10,%esp
+80108474:	85 c0                	test   %eax,%eax
+80108476:	78 52                	js     801084ca <sys_chdir+0x7b>
+80108478:	83 ec 0c             	sub    $0xc,%esp
+8010847b:	ff 75 f4             	push   -0xc(%ebp)
+8010847e:	e8 c1 99 ff ff       	call   80101e44 <namei>
+80108483:	89 c3                	mov    %eax,%ebx
+80108485:	83 c4 10             	add    $0x10,%esp
+80108488:	85 c0                	test   %eax,%eax
+8010848a:	74 3e                	je     801084ca <sys_chdir+0x7b>
+  ilock(ip);
+8010848c:	83 ec 0c             	sub    $0xc,%esp
+8010848f:	50                   	push   %eax
+80108490:	e8 93 91 ff ff       	call   80101628 <ilock>
+  if(ip->type != T_DIR){
+80108495:	83 c4 10             	add    $0x10,%esp
+80108498:	66 83 7b 58 01       	cmpw   $0x1,0x58(%ebx)
+8010849d:	75 37                	jne    801084d6 <sys_chdir+0x87>
+  iunlock(ip);
+8010849f:	83 ec 0c             	sub    $0xc,%esp
+801084a2:	53                   	push   %ebx
+801084a3:	e8 42 92 ff ff       	call   801016ea <iunlock>
+  iput(curproc->cwd);
+801084a8:	83 c4 04             	add    $0x4,%esp
+801084ab:	ff 76 68             	push   0x68(%esi)
+801084ae:	e8 7c 92 ff ff       	call   8010172f <iput>
+  end_op();
+801084b3:	e8 0c ab ff ff       	call   80102fc4 <end_op>
+  curproc->cwd = ip;
+801084b8:	89 5e 68             	mov    %ebx,0x68(%esi)
+  return 0;
+801084bb:	83 c4 10             	add    $0x10,%esp
+801084be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801084c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801084c6:	5b                   	pop    %ebx
+801084c7:	5e                   	pop    %esi
+801084c8:	5d                   	pop    %ebp
+801084c9:	c3                   	ret
+    end_op();
+801084ca:	e8 f5 aa ff ff       	call   80102fc4 <end_op>
+    return -1;
+801084cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801084d4:	eb ed                	jmp    801084c3 <sys_chdir+0x74>
+    iunlockput(ip);
+801084d6:	83 ec 0c             	sub    $0xc,%esp
+801084d9:	53                   	push   %ebx
+801084da:	e8 a0 93 ff ff       	call   8010187f <iunlockput>
+    end_op();
+801084df:	e8 e0 aa ff ff       	call   80102fc4 <end_op>
+    return -1;
+801084e4:	83 c4 10             	add    $0x10,%esp
+801084e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801084ec:	eb d5                	jmp    801084c3 <sys_chdir+0x74>
+
+801084ee <sys_exec>:
+
+int
+sys_exec(void)
+{
+801084ee:	55                   	push   %ebp
+801084ef:	89 e5                	mov    %esp,%ebp
+801084f1:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801084f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801084fa:	50                   	push   %eax
+801084fb:	6a 00                	push   $0x0
+801084fd:	e8 db f4 ff ff       	call   801079dd <argstr>
+80108502:	83 c4 10             	add    $0x10,%esp
+80108505:	85 c0                	test   %eax,%eax
+80108507:	78 44                	js     8010854d <sys_exec+0x5f>
+80108509:	83 ec 08             	sub    $0x8,%esp
+8010850c:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80108512:	50                   	push   %eax
+80108513:	6a 01                	push   $0x1
+80108515:	e8 f2 f3 ff ff       	call   8010790c <argint>
+8010851a:	83 c4 10             	add    $0x10,%esp
+8010851d:	85 c0                	test   %eax,%eax
+8010851f:	78 33                	js     80108554 <sys_exec+0x66>
+    return -1;
+  }
+  if(fetchargv(uargv, argv) < 0)
+80108521:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+80108527:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+8010852d:	e8 2a f7 ff ff       	call   80107c5c <fetchargv>
+80108532:	85 c0                	test   %eax,%eax
+80108534:	78 25                	js     8010855b <sys_exec+0x6d>
+    return -1;
+  return exec(path, argv);
+80108536:	83 ec 08             	sub    $0x8,%esp
+80108539:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+8010853f:	50                   	push   %eax
+80108540:	ff 75 f4             	push   -0xc(%ebp)
+80108543:	e8 c5 87 ff ff       	call   80100d0d <exec>
+80108548:	83 c4 10             	add    $0x10,%esp
+}
+8010854b:	c9                   	leave
+8010854c:	c3                   	ret
+    return -1;
+8010854d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108552:	eb f7                	jmp    8010854b <sys_exec+0x5d>
+80108554:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108559:	eb f0                	jmp    8010854b <sys_exec+0x5d>
+    return -1;
+8010855b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108560:	eb e9                	jmp    8010854b <sys_exec+0x5d>
+
+80108562 <sys_spawn>:
+
+#ifdef CS333_P4
+int
+sys_spawn(void)
+{
+80108562:	55                   	push   %ebp
+80108563:	89 e5                	mov    %esp,%ebp
+80108565:	57                   	push   %edi
+80108566:	56                   	push   %esi
+80108567:	53                   	push   %ebx
+80108568:	81 ec 74 01 00 00    	sub    $0x174,%esp
+  char *path, *argv[MAXARG];
+  struct spawnfd fa[SPAWN_MAXFD];
+  uint uargv, ufa;
+  int i;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+8010856e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108571:	50                   	push   %eax
+80108572:	6a 00                	push   $0x0
+80108574:	e8 64 f4 ff ff       	call   801079dd <argstr>
+80108579:	83 c4 10             	add    $0x10,%esp
+8010857c:	85 c0                	test   %eax,%eax
+8010857e:	0f 88 0b 01 00 00    	js     8010868f <sys_spawn+0x12d>
+80108584:	83 ec 08             	sub    $0x8,%esp
+80108587:	8d 85 a0 fe ff ff    	lea    -0x160(%ebp),%eax
+8010858d:	50                   	push   %eax
+8010858e:	6a 01                	push   $0x1
+80108590:	e8 77 f3 ff ff       	call   8010790c <argint>
+80108595:	83 c4 10             	add    $0x10,%esp
+80108598:	85 c0                	test   %eax,%eax
+8010859a:	0f 88 f6 00 00 00    	js     80108696 <sys_spawn+0x134>
+     argint(2, (int*)&ufa) < 0)
+801085a0:	83 ec 08             	sub    $0x8,%esp
+801085a3:	8d 85 9c fe ff ff    	lea    -0x164(%ebp),%eax
+801085a9:	50                   	push   %eax
+801085aa:	6a 02                	push   $0x2
+801085ac:	e8 5b f3 ff ff       	call   8010790c <argint>
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+801085b1:	83 c4 10             	add    $0x10,%esp
+801085b4:	85 c0                	test   %eax,%eax
+801085b6:	0f 88 e1 00 00 00    	js     8010869d <sys_spawn+0x13b>
+    return -1;
+  if(fetchargv(uargv, argv) < 0)
+801085bc:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+801085c2:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+801085c8:	e8 8f f6 ff ff       	call   80107c5c <fetchargv>
+801085cd:	85 c0                	test   %eax,%eax
+801085cf:	0f 88 cf 00 00 00    	js     801086a4 <sys_spawn+0x142>
+801085d5:	8d 9d ac fe ff ff    	lea    -0x154(%ebp),%ebx
+  // A null fa means no actions.
+  for(i = 0; i < SPAWN_MAXFD; i++){
+    fa[i].op = SPAWN_END;
+    if(ufa == 0)
+      break;
+    if(fetchint(ufa + i*sizeof(fa[i]), &fa[i].op) < 0 ||
+801085db:	b8 3c 01 00 00       	mov    $0x13c,%eax
+801085e0:	8d 4d e8             	lea    -0x18(%ebp),%ecx
+801085e3:	29 c8                	sub    %ecx,%eax
+801085e5:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%ebp)
+    fa[i].op = SPAWN_END;
+801085eb:	c7 43 f8 00 00 00 00 	movl   $0x0,-0x8(%ebx)
+    if(ufa == 0)
+801085f2:	8b 85 9c fe ff ff    	mov    -0x164(%ebp),%eax
+801085f8:	85 c0                	test   %eax,%eax
+801085fa:	74 6f                	je     8010866b <sys_spawn+0x109>
+    if(fetchint(ufa + i*sizeof(fa[i]), &fa[i].op) < 0 ||
+801085fc:	8b 8d 94 fe ff ff    	mov    -0x16c(%ebp),%ecx
+80108602:	8d 34 19             	lea    (%ecx,%ebx,1),%esi
+80108605:	83 ec 08             	sub    $0x8,%esp
+80108608:	8d 53 f8             	lea    -0x8(%ebx),%edx
+8010860b:	52                   	push   %edx
+8010860c:	01 f0                	add    %esi,%eax
+8010860e:	50                   	push   %eax
+8010860f:	e8 28 f2 ff ff       	call   8010783c <fetchint>
+80108614:	83 c4 10             	add    $0x10,%esp
+80108617:	85 c0                	test   %eax,%eax
+80108619:	0f 88 8c 00 00 00    	js     801086ab <sys_spawn+0x149>
+       fetchint(ufa + i*sizeof(fa[i]) + 4, &fa[i].fd) < 0 ||
+8010861f:	83 ec 08             	sub    $0x8,%esp
+80108622:	8d 43 fc             	lea    -0x4(%ebx),%eax
+80108625:	50                   	push   %eax
+80108626:	8b 85 9c fe ff ff    	mov    -0x164(%ebp),%eax
+8010862c:	8d 44 06 04          	lea    0x4(%esi,%eax,1),%eax
+80108630:	50                   	push   %eax
+80108631:	e8 06 f2 ff ff       	call   8010783c <fetchint>
+    if(fetchint(ufa + i*sizeof(fa[i]), &fa[i].op) < 0 ||
+80108636:	83 c4 10             	add    $0x10,%esp
+80108639:	85 c0                	test   %eax,%eax
+8010863b:	78 75                	js     801086b2 <sys_spawn+0x150>
+       fetchint(ufa + i*sizeof(fa[i]) + 8, &fa[i].newfd) < 0)
+8010863d:	83 ec 08             	sub    $0x8,%esp
+80108640:	53                   	push   %ebx
+80108641:	8b 85 9c fe ff ff    	mov    -0x164(%ebp),%eax
+80108647:	8d 44 06 08          	lea    0x8(%esi,%eax,1),%eax
+8010864b:	50                   	push   %eax
+8010864c:	e8 eb f1 ff ff       	call   8010783c <fetchint>
+       fetchint(ufa + i*sizeof(fa[i]) + 4, &fa[i].fd) < 0 ||
+80108651:	83 c4 10             	add    $0x10,%esp
+80108654:	85 c0                	test   %eax,%eax
+80108656:	78 61                	js     801086b9 <sys_spawn+0x157>
+      return -1;
+    if(fa[i].op == SPAWN_END)
+80108658:	83 7b f8 00          	cmpl   $0x0,-0x8(%ebx)
+8010865c:	74 0d                	je     8010866b <sys_spawn+0x109>
+  for(i = 0; i < SPAWN_MAXFD; i++){
+8010865e:	83 c3 0c             	add    $0xc,%ebx
+80108661:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+80108667:	39 c3                	cmp    %eax,%ebx
+80108669:	75 80                	jne    801085eb <sys_spawn+0x89>
+      break;
+  }
+  return spawn(path, argv, fa);
+8010866b:	83 ec 04             	sub    $0x4,%esp
+8010866e:	8d 85 a4 fe ff ff    	lea    -0x15c(%ebp),%eax
+80108674:	50                   	push   %eax
+80108675:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+8010867b:	50                   	push   %eax
+8010867c:	ff 75 e4             	push   -0x1c(%ebp)
+8010867f:	e8 f4 e8 ff ff       	call   80106f78 <spawn>
+80108684:	83 c4 10             	add    $0x10,%esp
+}
+80108687:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010868a:	5b                   	pop    %ebx
+8010868b:	5e                   	pop    %esi
+8010868c:	5f                   	pop    %edi
+8010868d:	5d                   	pop    %ebp
+8010868e:	c3                   	ret
+    return -1;
+8010868f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108694:	eb f1                	jmp    80108687 <sys_spawn+0x125>
+80108696:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010869b:	eb ea                	jmp    80108687 <sys_spawn+0x125>
+8010869d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086a2:	eb e3                	jmp    80108687 <sys_spawn+0x125>
+    return -1;
+801086a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086a9:	eb dc                	jmp    80108687 <sys_spawn+0x125>
+      return -1;
+801086ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086b0:	eb d5                	jmp    80108687 <sys_spawn+0x125>
+801086b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086b7:	eb ce                	jmp    80108687 <sys_spawn+0x125>
+801086b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086be:	eb c7                	jmp    80108687 <sys_spawn+0x125>
+
+801086c0 <sys_pipe>:
+#endif // CS333_P4
+
+int
+sys_pipe(void)
+{
+801086c0:	55                   	push   %ebp
+801086c1:	89 e5                	mov    %esp,%ebp
+801086c3:	53                   	push   %ebx
+801086c4:	83 ec 18             	sub    $0x18,%esp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801086c7:	6a 08                	push   $0x8
+801086c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801086cc:	50                   	push   %eax
+801086cd:	6a 00                	push   $0x0
+801086cf:	e8 f1 f2 ff ff       	call   801079c5 <argptrw>
+801086d4:	83 c4 10             	add    $0x10,%esp
+801086d7:	85 c0                	test   %eax,%eax
+801086d9:	78 73                	js     8010874e <sys_pipe+0x8e>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+801086db:	83 ec 08             	sub    $0x8,%esp
+801086de:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801086e1:	50                   	push   %eax
+801086e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801086e5:	50                   	push   %eax
+801086e6:	e8 31 b1 ff ff       	call   8010381c <pipealloc>
+801086eb:	83 c4 10             	add    $0x10,%esp
+801086ee:	85 c0                	test   %eax,%eax
+801086f0:	78 63                	js     80108755 <sys_pipe+0x95>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+801086f2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+801086f5:	e8 cf f3 ff ff       	call   80107ac9 <fdalloc>
+801086fa:	89 c3                	mov    %eax,%ebx
+801086fc:	85 c0                	test   %eax,%eax
+801086fe:	78 2e                	js     8010872e <sys_pipe+0x6e>
+80108700:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108703:	e8 c1 f3 ff ff       	call   80107ac9 <fdalloc>
+80108708:	85 c0                	test   %eax,%eax
+8010870a:	78 15                	js     80108721 <sys_pipe+0x61>
+      myproc()->ofile[fd0] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+8010870c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+8010870f:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+80108711:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108714:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+80108717:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010871c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010871f:	c9                   	leave
+80108720:	c3                   	ret
+      myproc()->ofile[fd0] = 0;
+80108721:	e8 92 c0 ff ff       	call   801047b8 <myproc>
+80108726:	c7 44 98 28 00 00 00 	movl   $0x0,0x28(%eax,%ebx,4)
+8010872d:	00 
+    fileclose(rf);
+8010872e:	83 ec 0c             	sub    $0xc,%esp
+80108731:	ff 75 f0             	push   -0x10(%ebp)
+80108734:	e8 63 87 ff ff       	call   80100e9c <fileclose>
+    fileclose(wf);
+80108739:	83 c4 04             	add    $0x4,%esp
+8010873c:	ff 75 ec             	push   -0x14(%ebp)
+8010873f:	e8 58 87 ff ff       	call   80100e9c <fileclose>
+    return -1;
+80108744:	83 c4 10             	add    $0x10,%esp
+80108747:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010874c:	eb ce                	jmp    8010871c <sys_pipe+0x5c>
+    return -1;
+8010874e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108753:	eb c7                	jmp    8010871c <sys_pipe+0x5c>
+    return -1;
+80108755:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010875a:	eb c0                	jmp    8010871c <sys_pipe+0x5c>
+
+8010875c <sys_fork>:
+//#include "proc.c"
+#endif // CS333_P2
+
+int
+sys_fork(void)
+{
+8010875c:	55                   	push   %ebp
+8010875d:	89 e5                	mov    %esp,%ebp
+8010875f:	83 ec 08             	sub    $0x8,%esp
+  return fork();
+80108762:	e8 02 e4 ff ff       	call   80106b69 <fork>
+}
+80108767:	c9                   	leave
+80108768:	c3                   	ret
+
+80108769 <sys_exit>:
+
+int
+sys_exit(void)
+{
+80108769:	55                   	push   %ebp
+8010876a:	89 e5                	mov    %esp,%ebp
+8010876c:	83 ec 08             	sub    $0x8,%esp
+  exit();
+8010876f:	e8 72 e2 ff ff       	call   801069e6 <exit>
+  return 0;  // not reached
+}
+80108774:	b8 00 00 00 00       	mov    $0x0,%eax
+80108779:	c9                   	leave
+8010877a:	c3                   	ret
+
+8010877b <sys_wait>:
+
+int
+sys_wait(void)
+{
+8010877b:	55                   	push   %ebp
+8010877c:	89 e5                	mov    %esp,%ebp
+8010877e:	83 ec 08             	sub    $0x8,%esp
+  return wait();
+80108781:	e8 05 e7 ff ff       	call   80106e8b <wait>
+}
+80108786:	c9                   	leave
+80108787:	c3                   	ret
+
+80108788 <sys_kill>:
+
+int
+sys_kill(void)
+{
+80108788:	55                   	push   %ebp
+80108789:	89 e5                	mov    %esp,%ebp
+8010878b:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+8010878e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108791:	50                   	push   %eax
+80108792:	6a 00                	push   $0x0
+80108794:	e8 73 f1 ff ff       	call   8010790c <argint>
+80108799:	83 c4 10             	add    $0x10,%esp
+8010879c:	85 c0                	test   %eax,%eax
+8010879e:	78 10                	js     801087b0 <sys_kill+0x28>
+    return -1;
+  return kill(pid);
+801087a0:	83 ec 0c             	sub    $0xc,%esp
+801087a3:	ff 75 f4             	push   -0xc(%ebp)
+801087a6:	e8 3c cb ff ff       	call   801052e7 <kill>
+801087ab:	83 c4 10             	add    $0x10,%esp
+}
+801087ae:	c9                   	leave
+801087af:	c3                   	ret
+    return -1;
+801087b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801087b5:	eb f7                	jmp    801087ae <sys_kill+0x26>
+
+801087b7 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+801087b7:	55                   	push   %ebp
+801087b8:	89 e5                	mov    %esp,%ebp
+801087ba:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+801087bd:	e8 f6 bf ff ff       	call   801047b8 <myproc>
+801087c2:	8b 40 10             	mov    0x10(%eax),%eax
+}
+801087c5:	c9                   	leave
+801087c6:	c3                   	ret
+
+801087c7 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+801087c7:	55                   	push   %ebp
+801087c8:	89 e5                	mov    %esp,%ebp
+801087ca:	53                   	push   %ebx
+801087cb:	83 ec 1c             	sub    $0x1c,%esp
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+801087ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801087d1:	50                   	push   %eax
+801087d2:	6a 00                	push   $0x0
+801087d4:	e8 33 f1 ff ff       	call   8010790c <argint>
+801087d9:	83 c4 10             	add    $0x10,%esp
+801087dc:	85 c0                	test   %eax,%eax
+801087de:	78 26                	js     80108806 <sys_sbrk+0x3f>
+    return -1;
+  addr = myproc()->sz;
+801087e0:	e8 d3 bf ff ff       	call   801047b8 <myproc>
+801087e5:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+801087e7:	83 ec 0c             	sub    $0xc,%esp
+801087ea:	ff 75 f4             	push   -0xc(%ebp)
+801087ed:	e8 e9 bf ff ff       	call   801047db <growproc>
+801087f2:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801087f5:	85 c0                	test   %eax,%eax
+801087f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801087fc:	0f 48 d8             	cmovs  %eax,%ebx
+  return addr;
+}
+801087ff:	89 d8                	mov    %ebx,%eax
+80108801:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108804:	c9                   	leave
+80108805:	c3                   	ret
+    return -1;
+80108806:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010880b:	eb f2                	jmp    801087ff <sys_sbrk+0x38>
+
+8010880d <sys_sleep>:
+
+#ifdef CS333_P4
+int
+sys_sleep(void)
+{
+8010880d:	55                   	push   %ebp
+8010880e:	89 e5                	mov    %esp,%ebp
+80108810:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80108813:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108816:	50                   	push   %eax
+80108817:	6a 00                	push   $0x0
+80108819:	e8 ee f0 ff ff       	call   8010790c <argint>
+8010881e:	83 c4 10             	add    $0x10,%esp
+80108821:	85 c0                	test   %eax,%eax
+80108823:	78 10                	js     80108835 <sys_sleep+0x28>
+    return -1;
+  return sleepticks(n);
+80108825:	83 ec 0c             	sub    $0xc,%esp
+80108828:	ff 75 f4             	push   -0xc(%ebp)
+8010882b:	e8 a1 c4 ff ff       	call   80104cd1 <sleepticks>
+80108830:	83 c4 10             	add    $0x10,%esp
+}
+80108833:	c9                   	leave
+80108834:	c3                   	ret
+    return -1;
+80108835:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010883a:	eb f7                	jmp    80108833 <sys_sleep+0x26>
+
+8010883c <sys_uptime>:
+{
+  uint xticks;
+
+  xticks = ticks;
+  return xticks;
+}
+8010883c:	a1 40 db 15 80       	mov    0x8015db40,%eax
+80108841:	c3                   	ret
+
+80108842 <sys_halt>:
+
+#ifdef PDX_XV6
+// Turn off the computer
+int
+sys_halt(void)
+{
+80108842:	55                   	push   %ebp
+80108843:	89 e5                	mov    %esp,%ebp
+80108845:	83 ec 14             	sub    $0x14,%esp
+  cprintf("Shutting down ...\n");
+80108848:	68 69 ba 10 80       	push   $0x8010ba69
+8010884d:	e8 b2 7d ff ff       	call   80100604 <cprintf>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80108852:	b8 00 20 00 00       	mov    $0x2000,%eax
+80108857:	ba 04 06 00 00       	mov    $0x604,%edx
+8010885c:	66 ef                	out    %ax,(%dx)
+  outw( 0x604, 0x0 | 0x2000);
+  return 0;
+}
+8010885e:	b8 00 00 00 00       	mov    $0x0,%eax
+80108863:	c9                   	leave
+80108864:	c3                   	ret
+
+80108865 <sys_date>:
+#endif // PDX_XV6
+
+#ifdef CS333_P1
+int
+sys_date(void)
+{
+80108865:	55                   	push   %ebp
+80108866:	89 e5                	mov    %esp,%ebp
+80108868:	83 ec 1c             	sub    $0x1c,%esp
+  struct rtcdate *d;
+
+  if(argptrw(0, (void*)&d, sizeof(struct rtcdate)) < 0)
+8010886b:	6a 18                	push   $0x18
+8010886d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108870:	50                   	push   %eax
+80108871:	6a 00                	push   $0x0
+80108873:	e8 4d f1 ff ff       	call   801079c5 <argptrw>
+80108878:	83 c4 10             	add    $0x10,%esp
+8010887b:	85 c0                	test   %eax,%eax
+8010887d:	78 15                	js     80108894 <sys_date+0x2f>
+    return -1;
+
+  cmostime(d);
+8010887f:	83 ec 0c             	sub    $0xc,%esp
+80108882:	ff 75 f4             	push   -0xc(%ebp)
+80108885:	e8 2f a4 ff ff       	call   80102cb9 <cmostime>
+  return 0;
+8010888a:	83 c4 10             	add    $0x10,%esp
+8010888d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108892:	c9                   	leave
+80108893:	c3                   	ret
+    return -1;
+80108894:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108899:	eb f7                	jmp    80108892 <sys_date+0x2d>
+
+8010889b <sys_getuid>:
+#endif // CS333_P1
+
+#ifdef CS333_P2
+int
+sys_getuid(void)
+{
+8010889b:	55                   	push   %ebp
+8010889c:	89 e5                	mov    %esp,%ebp
+8010889e:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->uid;
+801088a1:	e8 12 bf ff ff       	call   801047b8 <myproc>
+801088a6:	8b 80 d0 00 00 00    	mov    0xd0(%eax),%eax
+}
+801088ac:	c9                   	leave
+801088ad:	c3                   	ret
+
+801088ae <sys_getgid>:
+
+int
+sys_getgid(void)
+{
+801088ae:	55                   	push   %ebp
+801088af:	89 e5                	mov    %esp,%ebp
+801088b1:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->gid;
+801088b4:	e8 ff be ff ff       	call   801047b8 <myproc>
+801088b9:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+}
+801088bf:	c9                   	leave
+801088c0:	c3                   	ret
+
+801088c1 <sys_getppid>:
+
+int
+sys_getppid(void)
+{
+801088c1:	55                   	push   %ebp
+801088c2:	89 e5                	mov    %esp,%ebp
+801088c4:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->parent->pid;
+801088c7:	e8 ec be ff ff       	call   801047b8 <myproc>
+801088cc:	8b 40 14             	mov    0x14(%eax),%eax
+801088cf:	8b 40 10             	mov    0x10(%eax),%eax
+}
+801088d2:	c9                   	leave
+801088d3:	c3                   	ret
+
+801088d4 <sys_setuid>:
+
+int
+sys_setuid(void)
+{
+801088d4:	55                   	push   %ebp
+801088d5:	89 e5                	mov    %esp,%ebp
+801088d7:	83 ec 20             	sub    $0x20,%esp
+  uint uid;
+
+  if(argint(0, (int*)&uid) < 0)
+801088da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801088dd:	50                   	push   %eax
+801088de:	6a 00                	push   $0x0
+801088e0:	e8 27 f0 ff ff       	call   8010790c <argint>
+801088e5:	83 c4 10             	add    $0x10,%esp
+801088e8:	85 c0                	test   %eax,%eax
+801088ea:	78 1d                	js     80108909 <sys_setuid+0x35>
+    return -1;
+ 
+  if(uid > 32767 || uid < 0)
+801088ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801088ef:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+801088f4:	77 1a                	ja     80108910 <sys_setuid+0x3c>
+    return -1;
+ 
+  setuid(uid);
+801088f6:	83 ec 0c             	sub    $0xc,%esp
+801088f9:	50                   	push   %eax
+801088fa:	e8 a2 e9 ff ff       	call   801072a1 <setuid>
+
+  return 0;
+801088ff:	83 c4 10             	add    $0x10,%esp
+80108902:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108907:	c9                   	leave
+80108908:	c3                   	ret
+    return -1;
+80108909:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010890e:	eb f7                	jmp    80108907 <sys_setuid+0x33>
+    return -1;
+80108910:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108915:	eb f0                	jmp    80108907 <sys_setuid+0x33>
+
+80108917 <sys_setgid>:
+
+int
+sys_setgid(void)
+{
+80108917:	55                   	push   %ebp
+80108918:	89 e5                	mov    %esp,%ebp
+8010891a:	83 ec 20             	sub    $0x20,%esp
+  uint gid;
+
+  if(argint(0,(int*) &gid) < 0)
+8010891d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108920:	50                   	push   %eax
+80108921:	6a 00                	push   $0x0
+80108923:	e8 e4 ef ff ff       	call   8010790c <argint>
+80108928:	83 c4 10             	add    $0x10,%esp
+8010892b:	85 c0                	test   %eax,%eax
+8010892d:	78 1e                	js     8010894d <sys_setgid+0x36>
+    return -1;
+
+  if(gid > 32767 || gid < 0)
+8010892f:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+80108936:	77 1c                	ja     80108954 <sys_setgid+0x3d>
+    return -1;
+
+  myproc()->gid = gid;
+80108938:	e8 7b be ff ff       	call   801047b8 <myproc>
+8010893d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108940:	89 90 d4 00 00 00    	mov    %edx,0xd4(%eax)
+
+  return 0;
+80108946:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010894b:	c9                   	leave
+8010894c:	c3                   	ret
+    return -1;
+8010894d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108952:	eb f7                	jmp    8010894b <sys_setgid+0x34>
+    return -1;
+80108954:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108959:	eb f0                	jmp    8010894b <sys_setgid+0x34>
+
+8010895b <sys_getprocs>:
+
+int
+sys_getprocs(void)
+{
+8010895b:	55                   	push   %ebp
+8010895c:	89 e5                	mov    %esp,%ebp
+8010895e:	83 ec 20             	sub    $0x20,%esp
+  uint max;
+  struct uproc *table;
+
+  if(argint(0,(int*)&max) < 0)
+80108961:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108964:	50                   	push   %eax
+80108965:	6a 00                	push   $0x0
+80108967:	e8 a0 ef ff ff       	call   8010790c <argint>
+8010896c:	83 c4 10             	add    $0x10,%esp
+8010896f:	85 c0                	test   %eax,%eax
+80108971:	78 3a                	js     801089ad <sys_getprocs+0x52>
+    return -1;
+
+#ifdef CS333_P4
+  if(max < 1 || max > MAXPROC)
+80108973:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108976:	8d 50 ff             	lea    -0x1(%eax),%edx
+80108979:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+8010897f:	77 33                	ja     801089b4 <sys_getprocs+0x59>
+#else
+  if(max < 1 || max > NPROC)
+#endif // CS333_P4
+    return -1;
+
+  if(argptrw(1,(void*)&table, max*sizeof(struct uproc)) < 0)
+80108981:	83 ec 04             	sub    $0x4,%esp
+80108984:	6b c0 4c             	imul   $0x4c,%eax,%eax
+80108987:	50                   	push   %eax
+80108988:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010898b:	50                   	push   %eax
+8010898c:	6a 01                	push   $0x1
+8010898e:	e8 32 f0 ff ff       	call   801079c5 <argptrw>
+80108993:	83 c4 10             	add    $0x10,%esp
+80108996:	85 c0                	test   %eax,%eax
+80108998:	78 21                	js     801089bb <sys_getprocs+0x60>
+    return -1;
+
+  int proc_num = getprocs(max,table);
+8010899a:	83 ec 08             	sub    $0x8,%esp
+8010899d:	ff 75 f0             	push   -0x10(%ebp)
+801089a0:	ff 75 f4             	push   -0xc(%ebp)
+801089a3:	e8 2e d8 ff ff       	call   801061d6 <getprocs>
+  return proc_num;
+801089a8:	83 c4 10             	add    $0x10,%esp
+}
+801089ab:	c9                   	leave
+801089ac:	c3                   	ret
+    return -1;
+801089ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089b2:	eb f7                	jmp    801089ab <sys_getprocs+0x50>
+    return -1;
+801089b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089b9:	eb f0                	jmp    801089ab <sys_getprocs+0x50>
+    return -1;
+801089bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089c0:	eb e9                	jmp    801089ab <sys_getprocs+0x50>
+
+801089c2 <sys_setpriority>:
+#endif // CS333_P2
+
+#ifdef CS333_P4
+int
+sys_setpriority(void)
+{
+801089c2:	55                   	push   %ebp
+801089c3:	89 e5                	mov    %esp,%ebp
+801089c5:	83 ec 20             	sub    $0x20,%esp
+  int pid, priority;
+
+  if(argint(0,&pid) < 0 || argint(1,&priority) < 0)
+801089c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801089cb:	50                   	push   %eax
+801089cc:	6a 00                	push   $0x0
+801089ce:	e8 39 ef ff ff       	call   8010790c <argint>
+801089d3:	83 c4 10             	add    $0x10,%esp
+801089d6:	85 c0                	test   %eax,%eax
+801089d8:	78 33                	js     80108a0d <sys_setpriority+0x4b>
+801089da:	83 ec 08             	sub    $0x8,%esp
+801089dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801089e0:	50                   	push   %eax
+801089e1:	6a 01                	push   $0x1
+801089e3:	e8 24 ef ff ff       	call   8010790c <argint>
+801089e8:	83 c4 10             	add    $0x10,%esp
+801089eb:	85 c0                	test   %eax,%eax
+801089ed:	78 25                	js     80108a14 <sys_setpriority+0x52>
+    return -1;
+  if(pid < 0 || priority < 0 || priority > MAXPRIO)
+801089ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801089f2:	85 c0                	test   %eax,%eax
+801089f4:	78 25                	js     80108a1b <sys_setpriority+0x59>
+801089f6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+801089f9:	83 fa 06             	cmp    $0x6,%edx
+801089fc:	77 24                	ja     80108a22 <sys_setpriority+0x60>
+    return -1;
+
+  return setpriority(pid,priority);
+801089fe:	83 ec 08             	sub    $0x8,%esp
+80108a01:	52                   	push   %edx
+80108a02:	50                   	push   %eax
+80108a03:	e8 3b cb ff ff       	call   80105543 <setpriority>
+80108a08:	83 c4 10             	add    $0x10,%esp
+}
+80108a0b:	c9                   	leave
+80108a0c:	c3                   	ret
+    return -1;
+80108a0d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a12:	eb f7                	jmp    80108a0b <sys_setpriority+0x49>
+80108a14:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a19:	eb f0                	jmp    80108a0b <sys_setpriority+0x49>
+    return -1;
+80108a1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a20:	eb e9                	jmp    80108a0b <sys_setpriority+0x49>
+80108a22:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a27:	eb e2                	jmp    80108a0b <sys_setpriority+0x49>
+
+80108a29 <sys_getpriority>:
+
+int 
+sys_getpriority(void)
+{
+80108a29:	55                   	push   %ebp
+80108a2a:	89 e5                	mov    %esp,%ebp
+80108a2c:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0,&pid) < 0)
+80108a2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a32:	50                   	push   %eax
+80108a33:	6a 00                	push   $0x0
+80108a35:	e8 d2 ee ff ff       	call   8010790c <argint>
+80108a3a:	83 c4 10             	add    $0x10,%esp
+80108a3d:	85 c0                	test   %eax,%eax
+80108a3f:	78 15                	js     80108a56 <sys_getpriority+0x2d>
+    return -1;
+
+  if(pid < 0)
+80108a41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108a44:	85 c0                	test   %eax,%eax
+80108a46:	78 15                	js     80108a5d <sys_getpriority+0x34>
+    return -1;
+
+  return getpriority(pid);
+80108a48:	83 ec 0c             	sub    $0xc,%esp
+80108a4b:	50                   	push   %eax
+80108a4c:	e8 d7 cb ff ff       	call   80105628 <getpriority>
+80108a51:	83 c4 10             	add    $0x10,%esp
+}
+80108a54:	c9                   	leave
+80108a55:	c3                   	ret
+    return -1;
+80108a56:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a5b:	eb f7                	jmp    80108a54 <sys_getpriority+0x2b>
+    return -1;
+80108a5d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a62:	eb f0                	jmp    80108a54 <sys_getpriority+0x2b>
+
+80108a64 <sys_waitpid>:
+
+int
+sys_waitpid(void)
+{
+80108a64:	55                   	push   %ebp
+80108a65:	89 e5                	mov    %esp,%ebp
+80108a67:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0,&pid) < 0)
+80108a6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a6d:	50                   	push   %eax
+80108a6e:	6a 00                	push   $0x0
+80108a70:	e8 97 ee ff ff       	call   8010790c <argint>
+80108a75:	83 c4 10             	add    $0x10,%esp
+80108a78:	85 c0                	test   %eax,%eax
+80108a7a:	78 10                	js     80108a8c <sys_waitpid+0x28>
+    return -1;
+
+  return waitpid(pid);
+80108a7c:	83 ec 0c             	sub    $0xc,%esp
+80108a7f:	ff 75 f4             	push   -0xc(%ebp)
+80108a82:	e8 74 e4 ff ff       	call   80106efb <waitpid>
+80108a87:	83 c4 10             	add    $0x10,%esp
+}
+80108a8a:	c9                   	leave
+80108a8b:	c3                   	ret
+    return -1;
+80108a8c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a91:	eb f7                	jmp    80108a8a <sys_waitpid+0x26>
+
+80108a93 <sys_setaffinity>:
+
+int
+sys_setaffinity(void)
+{
+80108a93:	55                   	push   %ebp
+80108a94:	89 e5                	mov    %esp,%ebp
+80108a96:	83 ec 20             	sub    $0x20,%esp
+  int pid, mask;
+
+  if(argint(0,&pid) < 0 || argint(1,&mask) < 0)
+80108a99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a9c:	50                   	push   %eax
+80108a9d:	6a 00                	push   $0x0
+80108a9f:	e8 68 ee ff ff       	call   8010790c <argint>
+80108aa4:	83 c4 10             	add    $0x10,%esp
+80108aa7:	85 c0                	test   %eax,%eax
+80108aa9:	78 2d                	js     80108ad8 <sys_setaffinity+0x45>
+80108aab:	83 ec 08             	sub    $0x8,%esp
+80108aae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108ab1:	50                   	push   %eax
+80108ab2:	6a 01                	push   $0x1
+80108ab4:	e8 53 ee ff ff       	call   8010790c <argint>
+80108ab9:	83 c4 10             	add    $0x10,%esp
+80108abc:	85 c0                	test   %eax,%eax
+80108abe:	78 1f                	js     80108adf <sys_setaffinity+0x4c>
+    return -1;
+  if(pid < 0)
+80108ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108ac3:	85 c0                	test   %eax,%eax
+80108ac5:	78 1f                	js     80108ae6 <sys_setaffinity+0x53>
+    return -1;
+
+  return setaffinity(pid,mask);
+80108ac7:	83 ec 08             	sub    $0x8,%esp
+80108aca:	ff 75 f0             	push   -0x10(%ebp)
+80108acd:	50                   	push   %eax
+80108ace:	e8 e6 d0 ff ff       	call   80105bb9 <setaffinity>
+80108ad3:	83 c4 10             	add    $0x10,%esp
+}
+80108ad6:	c9                   	leave
+80108ad7:	c3                   	ret
+    return -1;
+80108ad8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108add:	eb f7                	jmp    80108ad6 <sys_setaffinity+0x43>
+80108adf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ae4:	eb f0                	jmp    80108ad6 <sys_setaffinity+0x43>
+    return -1;
+80108ae6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108aeb:	eb e9                	jmp    80108ad6 <sys_setaffinity+0x43>
+
+80108aed <sys_getaffinity>:
+
+int
+sys_getaffinity(void)
+{
+80108aed:	55                   	push   %ebp
+80108aee:	89 e5                	mov    %esp,%ebp
+80108af0:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0,&pid) < 0)
+80108af3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108af6:	50                   	push   %eax
+80108af7:	6a 00                	push   $0x0
+80108af9:	e8 0e ee ff ff       	call   8010790c <argint>
+80108afe:	83 c4 10             	add    $0x10,%esp
+80108b01:	85 c0                	test   %eax,%eax
+80108b03:	78 15                	js     80108b1a <sys_getaffinity+0x2d>
+    return -1;
+  if(pid < 0)
+80108b05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108b08:	85 c0                	test   %eax,%eax
+80108b0a:	78 15                	js     80108b21 <sys_getaffinity+0x34>
+    return -1;
+
+  return getaffinity(pid);
+80108b0c:	83 ec 0c             	sub    $0xc,%esp
+80108b0f:	50                   	push   %eax
+80108b10:	e8 e1 d1 ff ff       	call   80105cf6 <getaffinity>
+80108b15:	83 c4 10             	add    $0x10,%esp
+}
+80108b18:	c9                   	leave
+80108b19:	c3                   	ret
+    return -1;
+80108b1a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b1f:	eb f7                	jmp    80108b18 <sys_getaffinity+0x2b>
+    return -1;
+80108b21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b26:	eb f0                	jmp    80108b18 <sys_getaffinity+0x2b>
+
+80108b28 <sys_setdeadline>:
+// setdeadline(pid, runtime, period): reserve runtime ticks of every
+// period ticks, up to EDF_MAXPERIOD.  A period of 0 makes pid an MLFQ
+// process again.
+int
+sys_setdeadline(void)
+{
+80108b28:	55                   	push   %ebp
+80108b29:	89 e5                	mov    %esp,%ebp
+80108b2b:	83 ec 20             	sub    $0x20,%esp
+  int pid, runtime, period;
+
+  if(argint(0,&pid) < 0 || argint(1,&runtime) < 0 || argint(2,&period) < 0)
+80108b2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108b31:	50                   	push   %eax
+80108b32:	6a 00                	push   $0x0
+80108b34:	e8 d3 ed ff ff       	call   8010790c <argint>
+80108b39:	83 c4 10             	add    $0x10,%esp
+80108b3c:	85 c0                	test   %eax,%eax
+80108b3e:	78 5c                	js     80108b9c <sys_setdeadline+0x74>
+80108b40:	83 ec 08             	sub    $0x8,%esp
+80108b43:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108b46:	50                   	push   %eax
+80108b47:	6a 01                	push   $0x1
+80108b49:	e8 be ed ff ff       	call   8010790c <argint>
+80108b4e:	83 c4 10             	add    $0x10,%esp
+80108b51:	85 c0                	test   %eax,%eax
+80108b53:	78 4e                	js     80108ba3 <sys_setdeadline+0x7b>
+80108b55:	83 ec 08             	sub    $0x8,%esp
+80108b58:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108b5b:	50                   	push   %eax
+80108b5c:	6a 02                	push   $0x2
+80108b5e:	e8 a9 ed ff ff       	call   8010790c <argint>
+80108b63:	83 c4 10             	add    $0x10,%esp
+80108b66:	85 c0                	test   %eax,%eax
+80108b68:	78 40                	js     80108baa <sys_setdeadline+0x82>
+    return -1;
+  if(pid < 0 || period < 0 || period > EDF_MAXPERIOD)
+80108b6a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108b6d:	85 d2                	test   %edx,%edx
+80108b6f:	78 40                	js     80108bb1 <sys_setdeadline+0x89>
+80108b71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108b74:	3d 40 42 0f 00       	cmp    $0xf4240,%eax
+80108b79:	77 3d                	ja     80108bb8 <sys_setdeadline+0x90>
+    return -1;
+  if(period > 0 && (runtime <= 0 || runtime > period))
+80108b7b:	85 c0                	test   %eax,%eax
+80108b7d:	7e 0b                	jle    80108b8a <sys_setdeadline+0x62>
+80108b7f:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+80108b82:	39 c8                	cmp    %ecx,%eax
+80108b84:	7c 39                	jl     80108bbf <sys_setdeadline+0x97>
+80108b86:	85 c9                	test   %ecx,%ecx
+80108b88:	7e 35                	jle    80108bbf <sys_setdeadline+0x97>
+    return -1;
+
+  return setdeadline(pid,runtime,period);
+80108b8a:	83 ec 04             	sub    $0x4,%esp
+80108b8d:	50                   	push   %eax
+80108b8e:	ff 75 f0             	push   -0x10(%ebp)
+80108b91:	52                   	push   %edx
+80108b92:	e8 08 cb ff ff       	call   8010569f <setdeadline>
+80108b97:	83 c4 10             	add    $0x10,%esp
+}
+80108b9a:	c9                   	leave
+80108b9b:	c3                   	ret
+    return -1;
+80108b9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ba1:	eb f7                	jmp    80108b9a <sys_setdeadline+0x72>
+80108ba3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ba8:	eb f0                	jmp    80108b9a <sys_setdeadline+0x72>
+80108baa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108baf:	eb e9                	jmp    80108b9a <sys_setdeadline+0x72>
+    return -1;
+80108bb1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108bb6:	eb e2                	jmp    80108b9a <sys_setdeadline+0x72>
+80108bb8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108bbd:	eb db                	jmp    80108b9a <sys_setdeadline+0x72>
+    return -1;
+80108bbf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108bc4:	eb d4                	jmp    80108b9a <sys_setdeadline+0x72>
+
+80108bc6 <sys_schedctl>:
+
+int
+sys_schedctl(void)
+{
+80108bc6:	55                   	push   %ebp
+80108bc7:	89 e5                	mov    %esp,%ebp
+80108bc9:	83 ec 20             	sub    $0x20,%esp
+  int cmd;
+  struct schedparams *sp;
+
+  if(argint(0,&cmd) < 0 || argptrw(1,(void*)&sp,sizeof(*sp)) < 0)
+80108bcc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108bcf:	50                   	push   %eax
+80108bd0:	6a 00                	push   $0x0
+80108bd2:	e8 35 ed ff ff       	call   8010790c <argint>
+80108bd7:	83 c4 10             	add    $0x10,%esp
+80108bda:	85 c0                	test   %eax,%eax
+80108bdc:	78 2a                	js     80108c08 <sys_schedctl+0x42>
+80108bde:	83 ec 04             	sub    $0x4,%esp
+80108be1:	6a 28                	push   $0x28
+80108be3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108be6:	50                   	push   %eax
+80108be7:	6a 01                	push   $0x1
+80108be9:	e8 d7 ed ff ff       	call   801079c5 <argptrw>
+80108bee:	83 c4 10             	add    $0x10,%esp
+80108bf1:	85 c0                	test   %eax,%eax
+80108bf3:	78 1a                	js     80108c0f <sys_schedctl+0x49>
+    return -1;
+
+  return schedctl(cmd,sp);
+80108bf5:	83 ec 08             	sub    $0x8,%esp
+80108bf8:	ff 75 f0             	push   -0x10(%ebp)
+80108bfb:	ff 75 f4             	push   -0xc(%ebp)
+80108bfe:	e8 31 ce ff ff       	call   80105a34 <schedctl>
+80108c03:	83 c4 10             	add    $0x10,%esp
+}
+80108c06:	c9                   	leave
+80108c07:	c3                   	ret
+    return -1;
+80108c08:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c0d:	eb f7                	jmp    80108c06 <sys_schedctl+0x40>
+80108c0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c14:	eb f0                	jmp    80108c06 <sys_schedctl+0x40>
+
+80108c16 <sys_vmstats>:
+
+int
+sys_vmstats(void)
+{
+80108c16:	55                   	push   %ebp
+80108c17:	89 e5                	mov    %esp,%ebp
+80108c19:	57                   	push   %edi
+80108c1a:	56                   	push   %esi
+80108c1b:	83 ec 14             	sub    $0x14,%esp
+  struct vmstats *vs;
+
+  if(argptrw(0,(void*)&vs,sizeof(*vs)) < 0)
+80108c1e:	6a 4c                	push   $0x4c
+80108c20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c23:	50                   	push   %eax
+80108c24:	6a 00                	push   $0x0
+80108c26:	e8 9a ed ff ff       	call   801079c5 <argptrw>
+80108c2b:	83 c4 10             	add    $0x10,%esp
+80108c2e:	85 c0                	test   %eax,%eax
+80108c30:	78 29                	js     80108c5b <sys_vmstats+0x45>
+    return -1;
+
+  *vs = vmstat;
+80108c32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108c35:	be 80 e3 15 80       	mov    $0x8015e380,%esi
+80108c3a:	b9 13 00 00 00       	mov    $0x13,%ecx
+80108c3f:	89 c7                	mov    %eax,%edi
+80108c41:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  kmemstats(vs);
+80108c43:	83 ec 0c             	sub    $0xc,%esp
+80108c46:	50                   	push   %eax
+80108c47:	e8 b1 9b ff ff       	call   801027fd <kmemstats>
+  return 0;
+80108c4c:	83 c4 10             	add    $0x10,%esp
+80108c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108c54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108c57:	5e                   	pop    %esi
+80108c58:	5f                   	pop    %edi
+80108c59:	5d                   	pop    %ebp
+80108c5a:	c3                   	ret
+    return -1;
+80108c5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c60:	eb f2                	jmp    80108c54 <sys_vmstats+0x3e>
+
+80108c62 <sys_hugesbrk>:
+
+int
+sys_hugesbrk(void)
+{
+80108c62:	55                   	push   %ebp
+80108c63:	89 e5                	mov    %esp,%ebp
+80108c65:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80108c68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c6b:	50                   	push   %eax
+80108c6c:	6a 00                	push   $0x0
+80108c6e:	e8 99 ec ff ff       	call   8010790c <argint>
+80108c73:	83 c4 10             	add    $0x10,%esp
+80108c76:	85 c0                	test   %eax,%eax
+80108c78:	78 10                	js     80108c8a <sys_hugesbrk+0x28>
+    return -1;
+  return growhuge(n);
+80108c7a:	83 ec 0c             	sub    $0xc,%esp
+80108c7d:	ff 75 f4             	push   -0xc(%ebp)
+80108c80:	e8 be bb ff ff       	call   80104843 <growhuge>
+80108c85:	83 c4 10             	add    $0x10,%esp
+}
+80108c88:	c9                   	leave
+80108c89:	c3                   	ret
+    return -1;
+80108c8a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c8f:	eb f7                	jmp    80108c88 <sys_hugesbrk+0x26>
+
+80108c91 <sys_setshares>:
+#endif // CS333_P4
+
+#ifdef PDX_STRIDE
+int
+sys_setshares(void)
+{
+80108c91:	55                   	push   %ebp
+80108c92:	89 e5                	mov    %esp,%ebp
+80108c94:	83 ec 20             	sub    $0x20,%esp
+  int uid, n;
+
+  if(argint(0,&uid) < 0 || argint(1,&n) < 0)
+80108c97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c9a:	50                   	push   %eax
+80108c9b:	6a 00                	push   $0x0
+80108c9d:	e8 6a ec ff ff       	call   8010790c <argint>
+80108ca2:	83 c4 10             	add    $0x10,%esp
+80108ca5:	85 c0                	test   %eax,%eax
+80108ca7:	78 2d                	js     80108cd6 <sys_setshares+0x45>
+80108ca9:	83 ec 08             	sub    $0x8,%esp
+80108cac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108caf:	50                   	push   %eax
+80108cb0:	6a 01                	push   $0x1
+80108cb2:	e8 55 ec ff ff       	call   8010790c <argint>
+80108cb7:	83 c4 10             	add    $0x10,%esp
+80108cba:	85 c0                	test   %eax,%eax
+80108cbc:	78 1f                	js     80108cdd <sys_setshares+0x4c>
+    return -1;
+  if(uid < 0)
+80108cbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108cc1:	85 c0                	test   %eax,%eax
+80108cc3:	78 1f                	js     80108ce4 <sys_setshares+0x53>
+    return -1;
+
+  return setshares(uid,n);
+80108cc5:	83 ec 08             	sub    $0x8,%esp
+80108cc8:	ff 75 f0             	push   -0x10(%ebp)
+80108ccb:	50                   	push   %eax
+80108ccc:	e8 68 cc ff ff       	call   80105939 <setshares>
+80108cd1:	83 c4 10             	add    $0x10,%esp
+}
+80108cd4:	c9                   	leave
+80108cd5:	c3                   	ret
+    return -1;
+80108cd6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108cdb:	eb f7                	jmp    80108cd4 <sys_setshares+0x43>
+80108cdd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ce2:	eb f0                	jmp    80108cd4 <sys_setshares+0x43>
+    return -1;
+80108ce4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ce9:	eb e9                	jmp    80108cd4 <sys_setshares+0x43>
+
+80108ceb <sys_getshares>:
+
+int
+sys_getshares(void)
+{
+80108ceb:	55                   	push   %ebp
+80108cec:	89 e5                	mov    %esp,%ebp
+80108cee:	83 ec 20             	sub    $0x20,%esp
+  int uid;
+
+  if(argint(0,&uid) < 0 || uid < 0)
+80108cf1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108cf4:	50                   	push   %eax
+80108cf5:	6a 00                	push   $0x0
+80108cf7:	e8 10 ec ff ff       	call   8010790c <argint>
+80108cfc:	83 c4 10             	add    $0x10,%esp
+80108cff:	85 c0                	test   %eax,%eax
+80108d01:	78 15                	js     80108d18 <sys_getshares+0x2d>
+80108d03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108d06:	85 c0                	test   %eax,%eax
+80108d08:	78 15                	js     80108d1f <sys_getshares+0x34>
+    return -1;
+
+  return getshares(uid);
+80108d0a:	83 ec 0c             	sub    $0xc,%esp
+80108d0d:	50                   	push   %eax
+80108d0e:	e8 cf cc ff ff       	call   801059e2 <getshares>
+80108d13:	83 c4 10             	add    $0x10,%esp
+}
+80108d16:	c9                   	leave
+80108d17:	c3                   	ret
+    return -1;
+80108d18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d1d:	eb f7                	jmp    80108d16 <sys_getshares+0x2b>
+80108d1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d24:	eb f0                	jmp    80108d16 <sys_getshares+0x2b>
+
+80108d26 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80108d26:	1e                   	push   %ds
+  pushl %es
+80108d27:	06                   	push   %es
+  pushl %fs
+80108d28:	0f a0                	push   %fs
+  pushl %gs
+80108d2a:	0f a8                	push   %gs
+  pushal
+80108d2c:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80108d2d:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80108d31:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80108d33:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80108d35:	54                   	push   %esp
+  call trap
+80108d36:	e8 a1 00 00 00       	call   80108ddc <trap>
+  addl $4, %esp
+80108d3b:	83 c4 04             	add    $0x4,%esp
+
+80108d3e <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80108d3e:	61                   	popa
+  popl %gs
+80108d3f:	0f a9                	pop    %gs
+  popl %fs
+80108d41:	0f a1                	pop    %fs
+  popl %es
+80108d43:	07                   	pop    %es
+  popl %ds
+80108d44:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80108d45:	83 c4 08             	add    $0x8,%esp
+  iret
+80108d48:	cf                   	iret
+
+80108d49 <tvinit>:
+void
+tvinit(void)
+{
+  int i;
+
+  for(i = 0; i < 256; i++)
+80108d49:	b8 00 00 00 00       	mov    $0x0,%eax
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80108d4e:	8b 14 85 08 e0 10 80 	mov    -0x7fef1ff8(,%eax,4),%edx
+80108d55:	66 89 14 c5 60 db 15 	mov    %dx,-0x7fea24a0(,%eax,8)
+80108d5c:	80 
+80108d5d:	66 c7 04 c5 62 db 15 	movw   $0x8,-0x7fea249e(,%eax,8)
+80108d64:	80 08 00 
+80108d67:	c6 04 c5 64 db 15 80 	movb   $0x0,-0x7fea249c(,%eax,8)
+80108d6e:	00 
+80108d6f:	c6 04 c5 65 db 15 80 	movb   $0x8e,-0x7fea249b(,%eax,8)
+80108d76:	8e 
+80108d77:	c1 ea 10             	shr    $0x10,%edx
+80108d7a:	66 89 14 c5 66 db 15 	mov    %dx,-0x7fea249a(,%eax,8)
+80108d81:	80 
+  for(i = 0; i < 256; i++)
+80108d82:	83 c0 01             	add    $0x1,%eax
+80108d85:	3d 00 01 00 00       	cmp    $0x100,%eax
+80108d8a:	75 c2                	jne    80108d4e <tvinit+0x5>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80108d8c:	a1 08 e1 10 80       	mov    0x8010e108,%eax
+80108d91:	66 a3 60 dd 15 80    	mov    %ax,0x8015dd60
+80108d97:	66 c7 05 62 dd 15 80 	movw   $0x8,0x8015dd62
+80108d9e:	08 00 
+80108da0:	c6 05 64 dd 15 80 00 	movb   $0x0,0x8015dd64
+80108da7:	c6 05 65 dd 15 80 ef 	movb   $0xef,0x8015dd65
+80108dae:	c1 e8 10             	shr    $0x10,%eax
+80108db1:	66 a3 66 dd 15 80    	mov    %ax,0x8015dd66
+
+#ifndef PDX_XV6
+  initlock(&tickslock, "time");
+#endif // PDX_XV6
+}
+80108db7:	c3                   	ret
+
+80108db8 <idtinit>:
+
+void
+idtinit(void)
+{
+80108db8:	55                   	push   %ebp
+80108db9:	89 e5                	mov    %esp,%ebp
+80108dbb:	83 ec 10             	sub    $0x10,%esp
+  pd[0] = size-1;
+80108dbe:	66 c7 45 fa ff 07    	movw   $0x7ff,-0x6(%ebp)
+  pd[1] = (uint)p;
+80108dc4:	b8 60 db 15 80       	mov    $0x8015db60,%eax
+80108dc9:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80108dcd:	c1 e8 10             	shr    $0x10,%eax
+80108dd0:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+80108dd4:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80108dd7:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80108dda:	c9                   	leave
+80108ddb:	c3                   	ret
+
+80108ddc <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80108ddc:	55                   	push   %ebp
+80108ddd:	89 e5                	mov    %esp,%ebp
+80108ddf:	57                   	push   %edi
+80108de0:	56                   	push   %esi
+80108de1:	53                   	push   %ebx
+80108de2:	83 ec 1c             	sub    $0x1c,%esp
+80108de5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80108de8:	8b 43 30             	mov    0x30(%ebx),%eax
+80108deb:	83 f8 40             	cmp    $0x40,%eax
+80108dee:	74 13                	je     80108e03 <trap+0x27>
+      yield();
+#endif // CS333_P4
+    return;
+  }
+
+  switch(tf->trapno){
+80108df0:	83 e8 0e             	sub    $0xe,%eax
+80108df3:	83 f8 31             	cmp    $0x31,%eax
+80108df6:	0f 87 16 01 00 00    	ja     80108f12 <trap+0x136>
+80108dfc:	ff 24 85 1c bb 10 80 	jmp    *-0x7fef44e4(,%eax,4)
+    if(myproc()->killed)
+80108e03:	e8 b0 b9 ff ff       	call   801047b8 <myproc>
+80108e08:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80108e0c:	75 35                	jne    80108e43 <trap+0x67>
+    myproc()->tf = tf;
+80108e0e:	e8 a5 b9 ff ff       	call   801047b8 <myproc>
+80108e13:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+80108e16:	e8 f5 eb ff ff       	call   80107a10 <syscall>
+    if(myproc()->killed)
+80108e1b:	e8 98 b9 ff ff       	call   801047b8 <myproc>
+80108e20:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80108e24:	75 24                	jne    80108e4a <trap+0x6e>
+    if(myproc()->needresched)
+80108e26:	e8 8d b9 ff ff       	call   801047b8 <myproc>
+80108e2b:	8b 80 00 01 00 00    	mov    0x100(%eax),%eax
+80108e31:	85 c0                	test   %eax,%eax
+80108e33:	0f 84 bf 01 00 00    	je     80108ff8 <trap+0x21c>
+      yield();
+80108e39:	e8 30 bb ff ff       	call   8010496e <yield>
+80108e3e:	e9 b5 01 00 00       	jmp    80108ff8 <trap+0x21c>
+      exit();
+80108e43:	e8 9e db ff ff       	call   801069e6 <exit>
+80108e48:	eb c4                	jmp    80108e0e <trap+0x32>
+      exit();
+80108e4a:	e8 97 db ff ff       	call   801069e6 <exit>
+80108e4f:	eb d5                	jmp    80108e26 <trap+0x4a>
+  case T_IRQ0 + IRQ_TIMER:
+#ifdef PDX_TICKLESS
+    // An idle cpu 0 catches ticks up itself; see tickless().
+    if(cpuid() == 0 && !mycpu()->tickless){
+80108e51:	e8 e5 b5 ff ff       	call   8010443b <cpuid>
+80108e56:	85 c0                	test   %eax,%eax
+80108e58:	74 24                	je     80108e7e <trap+0xa2>
+      wakeup(&ticks);
+      release(&tickslock);
+#endif // PDX_XV6
+    }
+#ifdef CS333_P4
+    if(myproc())
+80108e5a:	e8 59 b9 ff ff       	call   801047b8 <myproc>
+80108e5f:	85 c0                	test   %eax,%eax
+80108e61:	74 11                	je     80108e74 <trap+0x98>
+      edftick(myproc());
+80108e63:	e8 50 b9 ff ff       	call   801047b8 <myproc>
+80108e68:	83 ec 0c             	sub    $0xc,%esp
+80108e6b:	50                   	push   %eax
+80108e6c:	e8 d9 ce ff ff       	call   80105d4a <edftick>
+80108e71:	83 c4 10             	add    $0x10,%esp
+#endif // CS333_P4
+    lapiceoi();
+80108e74:	e8 99 9c ff ff       	call   80102b12 <lapiceoi>
+    break;
+80108e79:	e9 00 01 00 00       	jmp    80108f7e <trap+0x1a2>
+    if(cpuid() == 0 && !mycpu()->tickless){
+80108e7e:	e8 59 b5 ff ff       	call   801043dc <mycpu>
+80108e83:	8b 80 b8 00 00 00    	mov    0xb8(%eax),%eax
+80108e89:	85 c0                	test   %eax,%eax
+80108e8b:	75 cd                	jne    80108e5a <trap+0x7e>
+  asm volatile ( "lock incl %0" : "=m" (*num));
+80108e8d:	f0 ff 05 40 db 15 80 	lock incl 0x8015db40
+      timertick();
+80108e94:	e8 f5 be ff ff       	call   80104d8e <timertick>
+80108e99:	eb bf                	jmp    80108e5a <trap+0x7e>
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80108e9b:	e8 06 91 ff ff       	call   80101fa6 <ideintr>
+    lapiceoi();
+80108ea0:	e8 6d 9c ff ff       	call   80102b12 <lapiceoi>
+    break;
+80108ea5:	e9 d4 00 00 00       	jmp    80108f7e <trap+0x1a2>
+  case T_IRQ0 + IRQ_IDE+1:
+    // Bochs generates spurious IDE1 interrupts.
+    break;
+  case T_IRQ0 + IRQ_KBD:
+    kbdintr();
+80108eaa:	e8 9d 9a ff ff       	call   8010294c <kbdintr>
+    lapiceoi();
+80108eaf:	e8 5e 9c ff ff       	call   80102b12 <lapiceoi>
+    break;
+80108eb4:	e9 c5 00 00 00       	jmp    80108f7e <trap+0x1a2>
+  case T_IRQ0 + IRQ_COM1:
+    uartintr();
+80108eb9:	e8 1e 03 00 00       	call   801091dc <uartintr>
+    lapiceoi();
+80108ebe:	e8 4f 9c ff ff       	call   80102b12 <lapiceoi>
+    break;
+80108ec3:	e9 b6 00 00 00       	jmp    80108f7e <trap+0x1a2>
+#ifdef CS333_P4
+  case T_IRQ0 + IRQ_RESCHED:
+    // Just getting here gets a halted cpu back to its scheduler;
+    // a preempted process yields below.
+    lapiceoi();
+80108ec8:	e8 45 9c ff ff       	call   80102b12 <lapiceoi>
+    break;
+80108ecd:	e9 ac 00 00 00       	jmp    80108f7e <trap+0x1a2>
+#endif // CS333_P4
+  case T_IRQ0 + 7:
+  case T_IRQ0 + IRQ_SPURIOUS:
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80108ed2:	8b 7b 38             	mov    0x38(%ebx),%edi
+80108ed5:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+80108ed9:	e8 5d b5 ff ff       	call   8010443b <cpuid>
+80108ede:	57                   	push   %edi
+80108edf:	56                   	push   %esi
+80108ee0:	50                   	push   %eax
+80108ee1:	68 7c ba 10 80       	push   $0x8010ba7c
+80108ee6:	e8 19 77 ff ff       	call   80100604 <cprintf>
+            cpuid(), tf->cs, tf->eip);
+    lapiceoi();
+80108eeb:	e8 22 9c ff ff       	call   80102b12 <lapiceoi>
+    break;
+80108ef0:	83 c4 10             	add    $0x10,%esp
+80108ef3:	e9 86 00 00 00       	jmp    80108f7e <trap+0x1a2>
+  case T_PGFLT:
+    // A user write to a page shared by fork() gets its own copy,
+    // and a first touch of sbrk() or program memory gets a page.
+    // The kernel fills in user buffers before using them (see
+    // uvmtouch()), so a kernel fault is a bug like any other.
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+80108ef8:	e8 bb b8 ff ff       	call   801047b8 <myproc>
+80108efd:	85 c0                	test   %eax,%eax
+80108eff:	74 11                	je     80108f12 <trap+0x136>
+80108f01:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80108f05:	83 e0 03             	and    $0x3,%eax
+80108f08:	66 83 f8 03          	cmp    $0x3,%ax
+80108f0c:	0f 84 ee 00 00 00    	je     80109000 <trap+0x224>
+      break;
+    // fall through
+
+  //PAGEBREAK: 13
+  default:
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80108f12:	e8 a1 b8 ff ff       	call   801047b8 <myproc>
+80108f17:	85 c0                	test   %eax,%eax
+80108f19:	0f 84 07 01 00 00    	je     80109026 <trap+0x24a>
+80108f1f:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80108f23:	0f 84 fd 00 00 00    	je     80109026 <trap+0x24a>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80108f29:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+              tf->trapno, cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80108f2c:	8b 43 38             	mov    0x38(%ebx),%eax
+80108f2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80108f32:	e8 04 b5 ff ff       	call   8010443b <cpuid>
+80108f37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80108f3a:	8b 53 34             	mov    0x34(%ebx),%edx
+80108f3d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80108f40:	8b 73 30             	mov    0x30(%ebx),%esi
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+80108f43:	e8 70 b8 ff ff       	call   801047b8 <myproc>
+80108f48:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80108f4b:	e8 68 b8 ff ff       	call   801047b8 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80108f50:	57                   	push   %edi
+80108f51:	ff 75 e4             	push   -0x1c(%ebp)
+80108f54:	ff 75 e0             	push   -0x20(%ebp)
+80108f57:	ff 75 dc             	push   -0x24(%ebp)
+80108f5a:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+80108f5b:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80108f5e:	83 c6 6c             	add    $0x6c,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80108f61:	56                   	push   %esi
+80108f62:	ff 70 10             	push   0x10(%eax)
+80108f65:	68 d4 ba 10 80       	push   $0x8010bad4
+80108f6a:	e8 95 76 ff ff       	call   80100604 <cprintf>
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+80108f6f:	83 c4 20             	add    $0x20,%esp
+80108f72:	e8 41 b8 ff ff       	call   801047b8 <myproc>
+80108f77:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80108f7e:	e8 35 b8 ff ff       	call   801047b8 <myproc>
+80108f83:	85 c0                	test   %eax,%eax
+80108f85:	74 1c                	je     80108fa3 <trap+0x1c7>
+80108f87:	e8 2c b8 ff ff       	call   801047b8 <myproc>
+80108f8c:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80108f90:	74 11                	je     80108fa3 <trap+0x1c7>
+80108f92:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80108f96:	83 e0 03             	and    $0x3,%eax
+80108f99:	66 83 f8 03          	cmp    $0x3,%ax
+80108f9d:	0f 84 ae 00 00 00    	je     80109051 <trap+0x275>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80108fa3:	e8 10 b8 ff ff       	call   801047b8 <myproc>
+80108fa8:	85 c0                	test   %eax,%eax
+80108faa:	74 0f                	je     80108fbb <trap+0x1df>
+80108fac:	e8 07 b8 ff ff       	call   801047b8 <myproc>
+80108fb1:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80108fb5:	0f 84 a0 00 00 00    	je     8010905b <trap+0x27f>
+    yield();
+
+#ifdef CS333_P4
+  // Something that outranks this process was queued here; see kick().
+  // Not on a page fault, which the kernel may take holding locks.
+  if(myproc() && myproc()->state == RUNNING && myproc()->needresched &&
+80108fbb:	e8 f8 b7 ff ff       	call   801047b8 <myproc>
+80108fc0:	85 c0                	test   %eax,%eax
+80108fc2:	74 0f                	je     80108fd3 <trap+0x1f7>
+80108fc4:	e8 ef b7 ff ff       	call   801047b8 <myproc>
+80108fc9:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80108fcd:	0f 84 be 00 00 00    	je     80109091 <trap+0x2b5>
+     tf->trapno != T_PGFLT)
+    yield();
+#endif // CS333_P4
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80108fd3:	e8 e0 b7 ff ff       	call   801047b8 <myproc>
+80108fd8:	85 c0                	test   %eax,%eax
+80108fda:	74 1c                	je     80108ff8 <trap+0x21c>
+80108fdc:	e8 d7 b7 ff ff       	call   801047b8 <myproc>
+80108fe1:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80108fe5:	74 11                	je     80108ff8 <trap+0x21c>
+80108fe7:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80108feb:	83 e0 03             	and    $0x3,%eax
+80108fee:	66 83 f8 03          	cmp    $0x3,%ax
+80108ff2:	0f 84 c0 00 00 00    	je     801090b8 <trap+0x2dc>
+    exit();
+}
+80108ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108ffb:	5b                   	pop    %ebx
+80108ffc:	5e                   	pop    %esi
+80108ffd:	5f                   	pop    %edi
+80108ffe:	5d                   	pop    %ebp
+80108fff:	c3                   	ret
+       pagefault(myproc(), rcr2(), tf->err) == 0)
+80109000:	8b 7b 34             	mov    0x34(%ebx),%edi
+80109003:	0f 20 d6             	mov    %cr2,%esi
+80109006:	e8 ad b7 ff ff       	call   801047b8 <myproc>
+8010900b:	83 ec 04             	sub    $0x4,%esp
+8010900e:	57                   	push   %edi
+8010900f:	56                   	push   %esi
+80109010:	50                   	push   %eax
+80109011:	e8 61 1b 00 00       	call   8010ab77 <pagefault>
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+80109016:	83 c4 10             	add    $0x10,%esp
+80109019:	85 c0                	test   %eax,%eax
+8010901b:	0f 84 5d ff ff ff    	je     80108f7e <trap+0x1a2>
+80109021:	e9 ec fe ff ff       	jmp    80108f12 <trap+0x136>
+80109026:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109029:	8b 73 38             	mov    0x38(%ebx),%esi
+8010902c:	e8 0a b4 ff ff       	call   8010443b <cpuid>
+80109031:	83 ec 0c             	sub    $0xc,%esp
+80109034:	57                   	push   %edi
+80109035:	56                   	push   %esi
+80109036:	50                   	push   %eax
+80109037:	ff 73 30             	push   0x30(%ebx)
+8010903a:	68 a0 ba 10 80       	push   $0x8010baa0
+8010903f:	e8 c0 75 ff ff       	call   80100604 <cprintf>
+      panic("trap");
+80109044:	83 c4 14             	add    $0x14,%esp
+80109047:	68 17 bb 10 80       	push   $0x8010bb17
+8010904c:	e8 f1 72 ff ff       	call   80100342 <panic>
+    exit();
+80109051:	e8 90 d9 ff ff       	call   801069e6 <exit>
+80109056:	e9 48 ff ff ff       	jmp    80108fa3 <trap+0x1c7>
+  if(myproc() && myproc()->state == RUNNING &&
+8010905b:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+8010905f:	0f 85 56 ff ff ff    	jne    80108fbb <trap+0x1df>
+    ticks - myproc()->cpu_ticks_in >= myproc()->slice)
+80109065:	8b 35 40 db 15 80    	mov    0x8015db40,%esi
+8010906b:	e8 48 b7 ff ff       	call   801047b8 <myproc>
+80109070:	2b b0 dc 00 00 00    	sub    0xdc(%eax),%esi
+80109076:	e8 3d b7 ff ff       	call   801047b8 <myproc>
+    tf->trapno == T_IRQ0+IRQ_TIMER &&
+8010907b:	3b b0 1c 01 00 00    	cmp    0x11c(%eax),%esi
+80109081:	0f 82 34 ff ff ff    	jb     80108fbb <trap+0x1df>
+    yield();
+80109087:	e8 e2 b8 ff ff       	call   8010496e <yield>
+8010908c:	e9 2a ff ff ff       	jmp    80108fbb <trap+0x1df>
+  if(myproc() && myproc()->state == RUNNING && myproc()->needresched &&
+80109091:	e8 22 b7 ff ff       	call   801047b8 <myproc>
+80109096:	8b 80 00 01 00 00    	mov    0x100(%eax),%eax
+8010909c:	85 c0                	test   %eax,%eax
+8010909e:	0f 84 2f ff ff ff    	je     80108fd3 <trap+0x1f7>
+801090a4:	83 7b 30 0e          	cmpl   $0xe,0x30(%ebx)
+801090a8:	0f 84 25 ff ff ff    	je     80108fd3 <trap+0x1f7>
+    yield();
+801090ae:	e8 bb b8 ff ff       	call   8010496e <yield>
+801090b3:	e9 1b ff ff ff       	jmp    80108fd3 <trap+0x1f7>
+    exit();
+801090b8:	e8 29 d9 ff ff       	call   801069e6 <exit>
+801090bd:	e9 36 ff ff ff       	jmp    80108ff8 <trap+0x21c>
+
+801090c2 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+801090c2:	83 3d 60 e3 15 80 00 	cmpl   $0x0,0x8015e360
+801090c9:	74 14                	je     801090df <uartgetc+0x1d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801090cb:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801090d0:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+801090d1:	a8 01                	test   $0x1,%al
+801090d3:	74 10                	je     801090e5 <uartgetc+0x23>
+801090d5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801090da:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+801090db:	0f b6 c0             	movzbl %al,%eax
+801090de:	c3                   	ret
+    return -1;
+801090df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801090e4:	c3                   	ret
+    return -1;
+801090e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801090ea:	c3                   	ret
+
+801090eb <uartputc>:
+  if(!uart)
+801090eb:	83 3d 60 e3 15 80 00 	cmpl   $0x0,0x8015e360
+801090f2:	74 42                	je     80109136 <uartputc+0x4b>
+{
+801090f4:	55                   	push   %ebp
+801090f5:	89 e5                	mov    %esp,%ebp
+801090f7:	56                   	push   %esi
+801090f8:	53                   	push   %ebx
+801090f9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801090fe:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801090ff:	a8 20                	test   $0x20,%al
+80109101:	75 23                	jne    80109126 <uartputc+0x3b>
+80109103:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109108:	be fd 03 00 00       	mov    $0x3fd,%esi
+    microdelay(10);
+8010910d:	83 ec 0c             	sub    $0xc,%esp
+80109110:	6a 0a                	push   $0xa
+80109112:	e8 05 9b ff ff       	call   80102c1c <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109117:	83 c4 10             	add    $0x10,%esp
+8010911a:	83 eb 01             	sub    $0x1,%ebx
+8010911d:	74 07                	je     80109126 <uartputc+0x3b>
+8010911f:	89 f2                	mov    %esi,%edx
+80109121:	ec                   	in     (%dx),%al
+80109122:	a8 20                	test   $0x20,%al
+80109124:	74 e7                	je     8010910d <uartputc+0x22>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109126:	8b 45 08             	mov    0x8(%ebp),%eax
+80109129:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010912e:	ee                   	out    %al,(%dx)
+}
+8010912f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109132:	5b                   	pop    %ebx
+80109133:	5e                   	pop    %esi
+80109134:	5d                   	pop    %ebp
+80109135:	c3                   	ret
+80109136:	c3                   	ret
+
+80109137 <uartinit>:
+{
+80109137:	55                   	push   %ebp
+80109138:	89 e5                	mov    %esp,%ebp
+8010913a:	56                   	push   %esi
+8010913b:	53                   	push   %ebx
+8010913c:	b9 00 00 00 00       	mov    $0x0,%ecx
+80109141:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109146:	89 c8                	mov    %ecx,%eax
+80109148:	ee                   	out    %al,(%dx)
+80109149:	be fb 03 00 00       	mov    $0x3fb,%esi
+8010914e:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109153:	89 f2                	mov    %esi,%edx
+80109155:	ee                   	out    %al,(%dx)
+80109156:	b8 0c 00 00 00       	mov    $0xc,%eax
+8010915b:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109160:	ee                   	out    %al,(%dx)
+80109161:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109166:	89 c8                	mov    %ecx,%eax
+80109168:	89 da                	mov    %ebx,%edx
+8010916a:	ee                   	out    %al,(%dx)
+8010916b:	b8 03 00 00 00       	mov    $0x3,%eax
+80109170:	89 f2                	mov    %esi,%edx
+80109172:	ee                   	out    %al,(%dx)
+80109173:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109178:	89 c8                	mov    %ecx,%eax
+8010917a:	ee                   	out    %al,(%dx)
+8010917b:	b8 01 00 00 00       	mov    $0x1,%eax
+80109180:	89 da                	mov    %ebx,%edx
+80109182:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109183:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109188:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109189:	3c ff                	cmp    $0xff,%al
+8010918b:	74 48                	je     801091d5 <uartinit+0x9e>
+  uart = 1;
+8010918d:	c7 05 60 e3 15 80 01 	movl   $0x1,0x8015e360
+80109194:	00 00 00 
+80109197:	ba fa 03 00 00       	mov    $0x3fa,%edx
+8010919c:	ec                   	in     (%dx),%al
+8010919d:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801091a2:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+801091a3:	83 ec 08             	sub    $0x8,%esp
+801091a6:	6a 00                	push   $0x0
+801091a8:	6a 04                	push   $0x4
+801091aa:	e8 18 90 ff ff       	call   801021c7 <ioapicenable>
+801091af:	83 c4 10             	add    $0x10,%esp
+  for(p="xv6...\n"; *p; p++)
+801091b2:	bb e4 bb 10 80       	mov    $0x8010bbe4,%ebx
+801091b7:	b8 78 00 00 00       	mov    $0x78,%eax
+    uartputc(*p);
+801091bc:	83 ec 0c             	sub    $0xc,%esp
+801091bf:	0f be c0             	movsbl %al,%eax
+801091c2:	50                   	push   %eax
+801091c3:	e8 23 ff ff ff       	call   801090eb <uartputc>
+  for(p="xv6...\n"; *p; p++)
+801091c8:	83 c3 01             	add    $0x1,%ebx
+801091cb:	0f b6 03             	movzbl (%ebx),%eax
+801091ce:	83 c4 10             	add    $0x10,%esp
+801091d1:	84 c0                	test   %al,%al
+801091d3:	75 e7                	jne    801091bc <uartinit+0x85>
+}
+801091d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801091d8:	5b                   	pop    %ebx
+801091d9:	5e                   	pop    %esi
+801091da:	5d                   	pop    %ebp
+801091db:	c3                   	ret
+
+801091dc <uartintr>:
+
+void
+uartintr(void)
+{
+801091dc:	55                   	push   %ebp
+801091dd:	89 e5                	mov    %esp,%ebp
+801091df:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+801091e2:	68 c2 90 10 80       	push   $0x801090c2
+801091e7:	e8 7f 75 ff ff       	call   8010076b <consoleintr>
+}
+801091ec:	83 c4 10             	add    $0x10,%esp
+801091ef:	c9                   	leave
+801091f0:	c3                   	ret
+
+801091f1 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+801091f1:	6a 00                	push   $0x0
+  pushl $0
+801091f3:	6a 00                	push   $0x0
+  jmp alltraps
+801091f5:	e9 2c fb ff ff       	jmp    80108d26 <alltraps>
+
+801091fa <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+801091fa:	6a 00                	push   $0x0
+  pushl $1
+801091fc:	6a 01                	push   $0x1
+  jmp alltraps
+801091fe:	e9 23 fb ff ff       	jmp    80108d26 <alltraps>
+
+80109203 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109203:	6a 00                	push   $0x0
+  pushl $2
+80109205:	6a 02                	push   $0x2
+  jmp alltraps
+80109207:	e9 1a fb ff ff       	jmp    80108d26 <alltraps>
+
+8010920c <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+8010920c:	6a 00                	push   $0x0
+  pushl $3
+8010920e:	6a 03                	push   $0x3
+  jmp alltraps
+80109210:	e9 11 fb ff ff       	jmp    80108d26 <alltraps>
+
+80109215 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109215:	6a 00                	push   $0x0
+  pushl $4
+80109217:	6a 04                	push   $0x4
+  jmp alltraps
+80109219:	e9 08 fb ff ff       	jmp    80108d26 <alltraps>
+
+8010921e <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+8010921e:	6a 00                	push   $0x0
+  pushl $5
+80109220:	6a 05                	push   $0x5
+  jmp alltraps
+80109222:	e9 ff fa ff ff       	jmp    80108d26 <alltraps>
+
+80109227 <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80109227:	6a 00                	push   $0x0
+  pushl $6
+80109229:	6a 06                	push   $0x6
+  jmp alltraps
+8010922b:	e9 f6 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109230 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109230:	6a 00                	push   $0x0
+  pushl $7
+80109232:	6a 07                	push   $0x7
+  jmp alltraps
+80109234:	e9 ed fa ff ff       	jmp    80108d26 <alltraps>
+
+80109239 <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80109239:	6a 08                	push   $0x8
+  jmp alltraps
+8010923b:	e9 e6 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109240 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109240:	6a 00                	push   $0x0
+  pushl $9
+80109242:	6a 09                	push   $0x9
+  jmp alltraps
+80109244:	e9 dd fa ff ff       	jmp    80108d26 <alltraps>
+
+80109249 <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80109249:	6a 0a                	push   $0xa
+  jmp alltraps
+8010924b:	e9 d6 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109250 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109250:	6a 0b                	push   $0xb
+  jmp alltraps
+80109252:	e9 cf fa ff ff       	jmp    80108d26 <alltraps>
+
+80109257 <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80109257:	6a 0c                	push   $0xc
+  jmp alltraps
+80109259:	e9 c8 fa ff ff       	jmp    80108d26 <alltraps>
+
+8010925e <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+8010925e:	6a 0d                	push   $0xd
+  jmp alltraps
+80109260:	e9 c1 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109265 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109265:	6a 0e                	push   $0xe
+  jmp alltraps
+80109267:	e9 ba fa ff ff       	jmp    80108d26 <alltraps>
+
+8010926c <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+8010926c:	6a 00                	push   $0x0
+  pushl $15
+8010926e:	6a 0f                	push   $0xf
+  jmp alltraps
+80109270:	e9 b1 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109275 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109275:	6a 00                	push   $0x0
+  pushl $16
+80109277:	6a 10                	push   $0x10
+  jmp alltraps
+80109279:	e9 a8 fa ff ff       	jmp    80108d26 <alltraps>
+
+8010927e <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+8010927e:	6a 11                	push   $0x11
+  jmp alltraps
+80109280:	e9 a1 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109285 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109285:	6a 00                	push   $0x0
+  pushl $18
+80109287:	6a 12                	push   $0x12
+  jmp alltraps
+80109289:	e9 98 fa ff ff       	jmp    80108d26 <alltraps>
+
+8010928e <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+8010928e:	6a 00                	push   $0x0
+  pushl $19
+80109290:	6a 13                	push   $0x13
+  jmp alltraps
+80109292:	e9 8f fa ff ff       	jmp    80108d26 <alltraps>
+
+80109297 <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80109297:	6a 00                	push   $0x0
+  pushl $20
+80109299:	6a 14                	push   $0x14
+  jmp alltraps
+8010929b:	e9 86 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092a0 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+801092a0:	6a 00                	push   $0x0
+  pushl $21
+801092a2:	6a 15                	push   $0x15
+  jmp alltraps
+801092a4:	e9 7d fa ff ff       	jmp    80108d26 <alltraps>
+
+801092a9 <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+801092a9:	6a 00                	push   $0x0
+  pushl $22
+801092ab:	6a 16                	push   $0x16
+  jmp alltraps
+801092ad:	e9 74 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092b2 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+801092b2:	6a 00                	push   $0x0
+  pushl $23
+801092b4:	6a 17                	push   $0x17
+  jmp alltraps
+801092b6:	e9 6b fa ff ff       	jmp    80108d26 <alltraps>
+
+801092bb <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+801092bb:	6a 00                	push   $0x0
+  pushl $24
+801092bd:	6a 18                	push   $0x18
+  jmp alltraps
+801092bf:	e9 62 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092c4 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+801092c4:	6a 00                	push   $0x0
+  pushl $25
+801092c6:	6a 19                	push   $0x19
+  jmp alltraps
+801092c8:	e9 59 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092cd <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+801092cd:	6a 00                	push   $0x0
+  pushl $26
+801092cf:	6a 1a                	push   $0x1a
+  jmp alltraps
+801092d1:	e9 50 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092d6 <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+801092d6:	6a 00                	push   $0x0
+  pushl $27
+801092d8:	6a 1b                	push   $0x1b
+  jmp alltraps
+801092da:	e9 47 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092df <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+801092df:	6a 00                	push   $0x0
+  pushl $28
+801092e1:	6a 1c                	push   $0x1c
+  jmp alltraps
+801092e3:	e9 3e fa ff ff       	jmp    80108d26 <alltraps>
+
+801092e8 <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+801092e8:	6a 00                	push   $0x0
+  pushl $29
+801092ea:	6a 1d                	push   $0x1d
+  jmp alltraps
+801092ec:	e9 35 fa ff ff       	jmp    80108d26 <alltraps>
+
+801092f1 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+801092f1:	6a 00                	push   $0x0
+  pushl $30
+801092f3:	6a 1e                	push   $0x1e
+  jmp alltraps
+801092f5:	e9 2c fa ff ff       	jmp    80108d26 <alltraps>
+
+801092fa <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+801092fa:	6a 00                	push   $0x0
+  pushl $31
+801092fc:	6a 1f                	push   $0x1f
+  jmp alltraps
+801092fe:	e9 23 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109303 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109303:	6a 00                	push   $0x0
+  pushl $32
+80109305:	6a 20                	push   $0x20
+  jmp alltraps
+80109307:	e9 1a fa ff ff       	jmp    80108d26 <alltraps>
+
+8010930c <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+8010930c:	6a 00                	push   $0x0
+  pushl $33
+8010930e:	6a 21                	push   $0x21
+  jmp alltraps
+80109310:	e9 11 fa ff ff       	jmp    80108d26 <alltraps>
+
+80109315 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80109315:	6a 00                	push   $0x0
+  pushl $34
+80109317:	6a 22                	push   $0x22
+  jmp alltraps
+80109319:	e9 08 fa ff ff       	jmp    80108d26 <alltraps>
+
+8010931e <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+8010931e:	6a 00                	push   $0x0
+  pushl $35
+80109320:	6a 23                	push   $0x23
+  jmp alltraps
+80109322:	e9 ff f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109327 <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80109327:	6a 00                	push   $0x0
+  pushl $36
+80109329:	6a 24                	push   $0x24
+  jmp alltraps
+8010932b:	e9 f6 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109330 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109330:	6a 00                	push   $0x0
+  pushl $37
+80109332:	6a 25                	push   $0x25
+  jmp alltraps
+80109334:	e9 ed f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109339 <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80109339:	6a 00                	push   $0x0
+  pushl $38
+8010933b:	6a 26                	push   $0x26
+  jmp alltraps
+8010933d:	e9 e4 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109342 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109342:	6a 00                	push   $0x0
+  pushl $39
+80109344:	6a 27                	push   $0x27
+  jmp alltraps
+80109346:	e9 db f9 ff ff       	jmp    80108d26 <alltraps>
+
+8010934b <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010934b:	6a 00                	push   $0x0
+  pushl $40
+8010934d:	6a 28                	push   $0x28
+  jmp alltraps
+8010934f:	e9 d2 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109354 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80109354:	6a 00                	push   $0x0
+  pushl $41
+80109356:	6a 29                	push   $0x29
+  jmp alltraps
+80109358:	e9 c9 f9 ff ff       	jmp    80108d26 <alltraps>
+
+8010935d <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+8010935d:	6a 00                	push   $0x0
+  pushl $42
+8010935f:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109361:	e9 c0 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109366 <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80109366:	6a 00                	push   $0x0
+  pushl $43
+80109368:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010936a:	e9 b7 f9 ff ff       	jmp    80108d26 <alltraps>
+
+8010936f <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+8010936f:	6a 00                	push   $0x0
+  pushl $44
+80109371:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109373:	e9 ae f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109378 <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80109378:	6a 00                	push   $0x0
+  pushl $45
+8010937a:	6a 2d                	push   $0x2d
+  jmp alltraps
+8010937c:	e9 a5 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109381 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109381:	6a 00                	push   $0x0
+  pushl $46
+80109383:	6a 2e                	push   $0x2e
+  jmp alltraps
+80109385:	e9 9c f9 ff ff       	jmp    80108d26 <alltraps>
+
+8010938a <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010938a:	6a 00                	push   $0x0
+  pushl $47
+8010938c:	6a 2f                	push   $0x2f
+  jmp alltraps
+8010938e:	e9 93 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109393 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109393:	6a 00                	push   $0x0
+  pushl $48
+80109395:	6a 30                	push   $0x30
+  jmp alltraps
+80109397:	e9 8a f9 ff ff       	jmp    80108d26 <alltraps>
+
+8010939c <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+8010939c:	6a 00                	push   $0x0
+  pushl $49
+8010939e:	6a 31                	push   $0x31
+  jmp alltraps
+801093a0:	e9 81 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093a5 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+801093a5:	6a 00                	push   $0x0
+  pushl $50
+801093a7:	6a 32                	push   $0x32
+  jmp alltraps
+801093a9:	e9 78 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093ae <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+801093ae:	6a 00                	push   $0x0
+  pushl $51
+801093b0:	6a 33                	push   $0x33
+  jmp alltraps
+801093b2:	e9 6f f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093b7 <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+801093b7:	6a 00                	push   $0x0
+  pushl $52
+801093b9:	6a 34                	push   $0x34
+  jmp alltraps
+801093bb:	e9 66 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093c0 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+801093c0:	6a 00                	push   $0x0
+  pushl $53
+801093c2:	6a 35                	push   $0x35
+  jmp alltraps
+801093c4:	e9 5d f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093c9 <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+801093c9:	6a 00                	push   $0x0
+  pushl $54
+801093cb:	6a 36                	push   $0x36
+  jmp alltraps
+801093cd:	e9 54 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093d2 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+801093d2:	6a 00                	push   $0x0
+  pushl $55
+801093d4:	6a 37                	push   $0x37
+  jmp alltraps
+801093d6:	e9 4b f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093db <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+801093db:	6a 00                	push   $0x0
+  pushl $56
+801093dd:	6a 38                	push   $0x38
+  jmp alltraps
+801093df:	e9 42 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093e4 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+801093e4:	6a 00                	push   $0x0
+  pushl $57
+801093e6:	6a 39                	push   $0x39
+  jmp alltraps
+801093e8:	e9 39 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093ed <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+801093ed:	6a 00                	push   $0x0
+  pushl $58
+801093ef:	6a 3a                	push   $0x3a
+  jmp alltraps
+801093f1:	e9 30 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093f6 <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+801093f6:	6a 00                	push   $0x0
+  pushl $59
+801093f8:	6a 3b                	push   $0x3b
+  jmp alltraps
+801093fa:	e9 27 f9 ff ff       	jmp    80108d26 <alltraps>
+
+801093ff <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+801093ff:	6a 00                	push   $0x0
+  pushl $60
+80109401:	6a 3c                	push   $0x3c
+  jmp alltraps
+80109403:	e9 1e f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109408 <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80109408:	6a 00                	push   $0x0
+  pushl $61
+8010940a:	6a 3d                	push   $0x3d
+  jmp alltraps
+8010940c:	e9 15 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109411 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80109411:	6a 00                	push   $0x0
+  pushl $62
+80109413:	6a 3e                	push   $0x3e
+  jmp alltraps
+80109415:	e9 0c f9 ff ff       	jmp    80108d26 <alltraps>
+
+8010941a <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010941a:	6a 00                	push   $0x0
+  pushl $63
+8010941c:	6a 3f                	push   $0x3f
+  jmp alltraps
+8010941e:	e9 03 f9 ff ff       	jmp    80108d26 <alltraps>
+
+80109423 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109423:	6a 00                	push   $0x0
+  pushl $64
+80109425:	6a 40                	push   $0x40
+  jmp alltraps
+80109427:	e9 fa f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010942c <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+8010942c:	6a 00                	push   $0x0
+  pushl $65
+8010942e:	6a 41                	push   $0x41
+  jmp alltraps
+80109430:	e9 f1 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109435 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80109435:	6a 00                	push   $0x0
+  pushl $66
+80109437:	6a 42                	push   $0x42
+  jmp alltraps
+80109439:	e9 e8 f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010943e <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+8010943e:	6a 00                	push   $0x0
+  pushl $67
+80109440:	6a 43                	push   $0x43
+  jmp alltraps
+80109442:	e9 df f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109447 <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80109447:	6a 00                	push   $0x0
+  pushl $68
+80109449:	6a 44                	push   $0x44
+  jmp alltraps
+8010944b:	e9 d6 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109450 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109450:	6a 00                	push   $0x0
+  pushl $69
+80109452:	6a 45                	push   $0x45
+  jmp alltraps
+80109454:	e9 cd f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109459 <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80109459:	6a 00                	push   $0x0
+  pushl $70
+8010945b:	6a 46                	push   $0x46
+  jmp alltraps
+8010945d:	e9 c4 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109462 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109462:	6a 00                	push   $0x0
+  pushl $71
+80109464:	6a 47                	push   $0x47
+  jmp alltraps
+80109466:	e9 bb f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010946b <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010946b:	6a 00                	push   $0x0
+  pushl $72
+8010946d:	6a 48                	push   $0x48
+  jmp alltraps
+8010946f:	e9 b2 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109474 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109474:	6a 00                	push   $0x0
+  pushl $73
+80109476:	6a 49                	push   $0x49
+  jmp alltraps
+80109478:	e9 a9 f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010947d <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+8010947d:	6a 00                	push   $0x0
+  pushl $74
+8010947f:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109481:	e9 a0 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109486 <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+80109486:	6a 00                	push   $0x0
+  pushl $75
+80109488:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010948a:	e9 97 f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010948f <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+8010948f:	6a 00                	push   $0x0
+  pushl $76
+80109491:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109493:	e9 8e f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109498 <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+80109498:	6a 00                	push   $0x0
+  pushl $77
+8010949a:	6a 4d                	push   $0x4d
+  jmp alltraps
+8010949c:	e9 85 f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094a1 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+801094a1:	6a 00                	push   $0x0
+  pushl $78
+801094a3:	6a 4e                	push   $0x4e
+  jmp alltraps
+801094a5:	e9 7c f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094aa <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+801094aa:	6a 00                	push   $0x0
+  pushl $79
+801094ac:	6a 4f                	push   $0x4f
+  jmp alltraps
+801094ae:	e9 73 f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094b3 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+801094b3:	6a 00                	push   $0x0
+  pushl $80
+801094b5:	6a 50                	push   $0x50
+  jmp alltraps
+801094b7:	e9 6a f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094bc <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+801094bc:	6a 00                	push   $0x0
+  pushl $81
+801094be:	6a 51                	push   $0x51
+  jmp alltraps
+801094c0:	e9 61 f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094c5 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+801094c5:	6a 00                	push   $0x0
+  pushl $82
+801094c7:	6a 52                	push   $0x52
+  jmp alltraps
+801094c9:	e9 58 f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094ce <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+801094ce:	6a 00                	push   $0x0
+  pushl $83
+801094d0:	6a 53                	push   $0x53
+  jmp alltraps
+801094d2:	e9 4f f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094d7 <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+801094d7:	6a 00                	push   $0x0
+  pushl $84
+801094d9:	6a 54                	push   $0x54
+  jmp alltraps
+801094db:	e9 46 f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094e0 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+801094e0:	6a 00                	push   $0x0
+  pushl $85
+801094e2:	6a 55                	push   $0x55
+  jmp alltraps
+801094e4:	e9 3d f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094e9 <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+801094e9:	6a 00                	push   $0x0
+  pushl $86
+801094eb:	6a 56                	push   $0x56
+  jmp alltraps
+801094ed:	e9 34 f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094f2 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+801094f2:	6a 00                	push   $0x0
+  pushl $87
+801094f4:	6a 57                	push   $0x57
+  jmp alltraps
+801094f6:	e9 2b f8 ff ff       	jmp    80108d26 <alltraps>
+
+801094fb <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+801094fb:	6a 00                	push   $0x0
+  pushl $88
+801094fd:	6a 58                	push   $0x58
+  jmp alltraps
+801094ff:	e9 22 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109504 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80109504:	6a 00                	push   $0x0
+  pushl $89
+80109506:	6a 59                	push   $0x59
+  jmp alltraps
+80109508:	e9 19 f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010950d <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010950d:	6a 00                	push   $0x0
+  pushl $90
+8010950f:	6a 5a                	push   $0x5a
+  jmp alltraps
+80109511:	e9 10 f8 ff ff       	jmp    80108d26 <alltraps>
+
+80109516 <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+80109516:	6a 00                	push   $0x0
+  pushl $91
+80109518:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010951a:	e9 07 f8 ff ff       	jmp    80108d26 <alltraps>
+
+8010951f <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+8010951f:	6a 00                	push   $0x0
+  pushl $92
+80109521:	6a 5c                	push   $0x5c
+  jmp alltraps
+80109523:	e9 fe f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109528 <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+80109528:	6a 00                	push   $0x0
+  pushl $93
+8010952a:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010952c:	e9 f5 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109531 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109531:	6a 00                	push   $0x0
+  pushl $94
+80109533:	6a 5e                	push   $0x5e
+  jmp alltraps
+80109535:	e9 ec f7 ff ff       	jmp    80108d26 <alltraps>
+
+8010953a <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010953a:	6a 00                	push   $0x0
+  pushl $95
+8010953c:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010953e:	e9 e3 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109543 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109543:	6a 00                	push   $0x0
+  pushl $96
+80109545:	6a 60                	push   $0x60
+  jmp alltraps
+80109547:	e9 da f7 ff ff       	jmp    80108d26 <alltraps>
+
+8010954c <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010954c:	6a 00                	push   $0x0
+  pushl $97
+8010954e:	6a 61                	push   $0x61
+  jmp alltraps
+80109550:	e9 d1 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109555 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80109555:	6a 00                	push   $0x0
+  pushl $98
+80109557:	6a 62                	push   $0x62
+  jmp alltraps
+80109559:	e9 c8 f7 ff ff       	jmp    80108d26 <alltraps>
+
+8010955e <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010955e:	6a 00                	push   $0x0
+  pushl $99
+80109560:	6a 63                	push   $0x63
+  jmp alltraps
+80109562:	e9 bf f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109567 <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+80109567:	6a 00                	push   $0x0
+  pushl $100
+80109569:	6a 64                	push   $0x64
+  jmp alltraps
+8010956b:	e9 b6 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109570 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109570:	6a 00                	push   $0x0
+  pushl $101
+80109572:	6a 65                	push   $0x65
+  jmp alltraps
+80109574:	e9 ad f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109579 <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+80109579:	6a 00                	push   $0x0
+  pushl $102
+8010957b:	6a 66                	push   $0x66
+  jmp alltraps
+8010957d:	e9 a4 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109582 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109582:	6a 00                	push   $0x0
+  pushl $103
+80109584:	6a 67                	push   $0x67
+  jmp alltraps
+80109586:	e9 9b f7 ff ff       	jmp    80108d26 <alltraps>
+
+8010958b <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010958b:	6a 00                	push   $0x0
+  pushl $104
+8010958d:	6a 68                	push   $0x68
+  jmp alltraps
+8010958f:	e9 92 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109594 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+80109594:	6a 00                	push   $0x0
+  pushl $105
+80109596:	6a 69                	push   $0x69
+  jmp alltraps
+80109598:	e9 89 f7 ff ff       	jmp    80108d26 <alltraps>
+
+8010959d <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010959d:	6a 00                	push   $0x0
+  pushl $106
+8010959f:	6a 6a                	push   $0x6a
+  jmp alltraps
+801095a1:	e9 80 f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095a6 <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+801095a6:	6a 00                	push   $0x0
+  pushl $107
+801095a8:	6a 6b                	push   $0x6b
+  jmp alltraps
+801095aa:	e9 77 f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095af <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+801095af:	6a 00                	push   $0x0
+  pushl $108
+801095b1:	6a 6c                	push   $0x6c
+  jmp alltraps
+801095b3:	e9 6e f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095b8 <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+801095b8:	6a 00                	push   $0x0
+  pushl $109
+801095ba:	6a 6d                	push   $0x6d
+  jmp alltraps
+801095bc:	e9 65 f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095c1 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+801095c1:	6a 00                	push   $0x0
+  pushl $110
+801095c3:	6a 6e                	push   $0x6e
+  jmp alltraps
+801095c5:	e9 5c f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095ca <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+801095ca:	6a 00                	push   $0x0
+  pushl $111
+801095cc:	6a 6f                	push   $0x6f
+  jmp alltraps
+801095ce:	e9 53 f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095d3 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+801095d3:	6a 00                	push   $0x0
+  pushl $112
+801095d5:	6a 70                	push   $0x70
+  jmp alltraps
+801095d7:	e9 4a f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095dc <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+801095dc:	6a 00                	push   $0x0
+  pushl $113
+801095de:	6a 71                	push   $0x71
+  jmp alltraps
+801095e0:	e9 41 f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095e5 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+801095e5:	6a 00                	push   $0x0
+  pushl $114
+801095e7:	6a 72                	push   $0x72
+  jmp alltraps
+801095e9:	e9 38 f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095ee <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+801095ee:	6a 00                	push   $0x0
+  pushl $115
+801095f0:	6a 73                	push   $0x73
+  jmp alltraps
+801095f2:	e9 2f f7 ff ff       	jmp    80108d26 <alltraps>
+
+801095f7 <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+801095f7:	6a 00                	push   $0x0
+  pushl $116
+801095f9:	6a 74                	push   $0x74
+  jmp alltraps
+801095fb:	e9 26 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109600 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80109600:	6a 00                	push   $0x0
+  pushl $117
+80109602:	6a 75                	push   $0x75
+  jmp alltraps
+80109604:	e9 1d f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109609 <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+80109609:	6a 00                	push   $0x0
+  pushl $118
+8010960b:	6a 76                	push   $0x76
+  jmp alltraps
+8010960d:	e9 14 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109612 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80109612:	6a 00                	push   $0x0
+  pushl $119
+80109614:	6a 77                	push   $0x77
+  jmp alltraps
+80109616:	e9 0b f7 ff ff       	jmp    80108d26 <alltraps>
+
+8010961b <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010961b:	6a 00                	push   $0x0
+  pushl $120
+8010961d:	6a 78                	push   $0x78
+  jmp alltraps
+8010961f:	e9 02 f7 ff ff       	jmp    80108d26 <alltraps>
+
+80109624 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80109624:	6a 00                	push   $0x0
+  pushl $121
+80109626:	6a 79                	push   $0x79
+  jmp alltraps
+80109628:	e9 f9 f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010962d <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010962d:	6a 00                	push   $0x0
+  pushl $122
+8010962f:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109631:	e9 f0 f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109636 <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80109636:	6a 00                	push   $0x0
+  pushl $123
+80109638:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010963a:	e9 e7 f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010963f <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010963f:	6a 00                	push   $0x0
+  pushl $124
+80109641:	6a 7c                	push   $0x7c
+  jmp alltraps
+80109643:	e9 de f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109648 <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80109648:	6a 00                	push   $0x0
+  pushl $125
+8010964a:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010964c:	e9 d5 f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109651 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109651:	6a 00                	push   $0x0
+  pushl $126
+80109653:	6a 7e                	push   $0x7e
+  jmp alltraps
+80109655:	e9 cc f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010965a <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010965a:	6a 00                	push   $0x0
+  pushl $127
+8010965c:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010965e:	e9 c3 f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109663 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80109663:	6a 00                	push   $0x0
+  pushl $128
+80109665:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010966a:	e9 b7 f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010966f <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010966f:	6a 00                	push   $0x0
+  pushl $129
+80109671:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80109676:	e9 ab f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010967b <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010967b:	6a 00                	push   $0x0
+  pushl $130
+8010967d:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109682:	e9 9f f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109687 <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+80109687:	6a 00                	push   $0x0
+  pushl $131
+80109689:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010968e:	e9 93 f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109693 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80109693:	6a 00                	push   $0x0
+  pushl $132
+80109695:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010969a:	e9 87 f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010969f <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010969f:	6a 00                	push   $0x0
+  pushl $133
+801096a1:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+801096a6:	e9 7b f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096ab <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+801096ab:	6a 00                	push   $0x0
+  pushl $134
+801096ad:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+801096b2:	e9 6f f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096b7 <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+801096b7:	6a 00                	push   $0x0
+  pushl $135
+801096b9:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+801096be:	e9 63 f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096c3 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+801096c3:	6a 00                	push   $0x0
+  pushl $136
+801096c5:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+801096ca:	e9 57 f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096cf <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+801096cf:	6a 00                	push   $0x0
+  pushl $137
+801096d1:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+801096d6:	e9 4b f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096db <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+801096db:	6a 00                	push   $0x0
+  pushl $138
+801096dd:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+801096e2:	e9 3f f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096e7 <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+801096e7:	6a 00                	push   $0x0
+  pushl $139
+801096e9:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+801096ee:	e9 33 f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096f3 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+801096f3:	6a 00                	push   $0x0
+  pushl $140
+801096f5:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+801096fa:	e9 27 f6 ff ff       	jmp    80108d26 <alltraps>
+
+801096ff <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+801096ff:	6a 00                	push   $0x0
+  pushl $141
+80109701:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80109706:	e9 1b f6 ff ff       	jmp    80108d26 <alltraps>
+
+8010970b <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010970b:	6a 00                	push   $0x0
+  pushl $142
+8010970d:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80109712:	e9 0f f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109717 <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80109717:	6a 00                	push   $0x0
+  pushl $143
+80109719:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010971e:	e9 03 f6 ff ff       	jmp    80108d26 <alltraps>
+
+80109723 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80109723:	6a 00                	push   $0x0
+  pushl $144
+80109725:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010972a:	e9 f7 f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010972f <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010972f:	6a 00                	push   $0x0
+  pushl $145
+80109731:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+80109736:	e9 eb f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010973b <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010973b:	6a 00                	push   $0x0
+  pushl $146
+8010973d:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109742:	e9 df f5 ff ff       	jmp    80108d26 <alltraps>
+
+80109747 <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80109747:	6a 00                	push   $0x0
+  pushl $147
+80109749:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010974e:	e9 d3 f5 ff ff       	jmp    80108d26 <alltraps>
+
+80109753 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80109753:	6a 00                	push   $0x0
+  pushl $148
+80109755:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010975a:	e9 c7 f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010975f <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010975f:	6a 00                	push   $0x0
+  pushl $149
+80109761:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80109766:	e9 bb f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010976b <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010976b:	6a 00                	push   $0x0
+  pushl $150
+8010976d:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109772:	e9 af f5 ff ff       	jmp    80108d26 <alltraps>
+
+80109777 <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80109777:	6a 00                	push   $0x0
+  pushl $151
+80109779:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010977e:	e9 a3 f5 ff ff       	jmp    80108d26 <alltraps>
+
+80109783 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80109783:	6a 00                	push   $0x0
+  pushl $152
+80109785:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010978a:	e9 97 f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010978f <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010978f:	6a 00                	push   $0x0
+  pushl $153
+80109791:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+80109796:	e9 8b f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010979b <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010979b:	6a 00                	push   $0x0
+  pushl $154
+8010979d:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+801097a2:	e9 7f f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097a7 <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+801097a7:	6a 00                	push   $0x0
+  pushl $155
+801097a9:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+801097ae:	e9 73 f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097b3 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+801097b3:	6a 00                	push   $0x0
+  pushl $156
+801097b5:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+801097ba:	e9 67 f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097bf <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+801097bf:	6a 00                	push   $0x0
+  pushl $157
+801097c1:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+801097c6:	e9 5b f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097cb <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+801097cb:	6a 00                	push   $0x0
+  pushl $158
+801097cd:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+801097d2:	e9 4f f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097d7 <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+801097d7:	6a 00                	push   $0x0
+  pushl $159
+801097d9:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+801097de:	e9 43 f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097e3 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+801097e3:	6a 00                	push   $0x0
+  pushl $160
+801097e5:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+801097ea:	e9 37 f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097ef <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+801097ef:	6a 00                	push   $0x0
+  pushl $161
+801097f1:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+801097f6:	e9 2b f5 ff ff       	jmp    80108d26 <alltraps>
+
+801097fb <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+801097fb:	6a 00                	push   $0x0
+  pushl $162
+801097fd:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109802:	e9 1f f5 ff ff       	jmp    80108d26 <alltraps>
+
+80109807 <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80109807:	6a 00                	push   $0x0
+  pushl $163
+80109809:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010980e:	e9 13 f5 ff ff       	jmp    80108d26 <alltraps>
+
+80109813 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109813:	6a 00                	push   $0x0
+  pushl $164
+80109815:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010981a:	e9 07 f5 ff ff       	jmp    80108d26 <alltraps>
+
+8010981f <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010981f:	6a 00                	push   $0x0
+  pushl $165
+80109821:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109826:	e9 fb f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010982b <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010982b:	6a 00                	push   $0x0
+  pushl $166
+8010982d:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109832:	e9 ef f4 ff ff       	jmp    80108d26 <alltraps>
+
+80109837 <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109837:	6a 00                	push   $0x0
+  pushl $167
+80109839:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010983e:	e9 e3 f4 ff ff       	jmp    80108d26 <alltraps>
+
+80109843 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109843:	6a 00                	push   $0x0
+  pushl $168
+80109845:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010984a:	e9 d7 f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010984f <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010984f:	6a 00                	push   $0x0
+  pushl $169
+80109851:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109856:	e9 cb f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010985b <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010985b:	6a 00                	push   $0x0
+  pushl $170
+8010985d:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109862:	e9 bf f4 ff ff       	jmp    80108d26 <alltraps>
+
+80109867 <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109867:	6a 00                	push   $0x0
+  pushl $171
+80109869:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010986e:	e9 b3 f4 ff ff       	jmp    80108d26 <alltraps>
+
+80109873 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109873:	6a 00                	push   $0x0
+  pushl $172
+80109875:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010987a:	e9 a7 f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010987f <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010987f:	6a 00                	push   $0x0
+  pushl $173
+80109881:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109886:	e9 9b f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010988b <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010988b:	6a 00                	push   $0x0
+  pushl $174
+8010988d:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80109892:	e9 8f f4 ff ff       	jmp    80108d26 <alltraps>
+
+80109897 <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+80109897:	6a 00                	push   $0x0
+  pushl $175
+80109899:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010989e:	e9 83 f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098a3 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+801098a3:	6a 00                	push   $0x0
+  pushl $176
+801098a5:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+801098aa:	e9 77 f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098af <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+801098af:	6a 00                	push   $0x0
+  pushl $177
+801098b1:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+801098b6:	e9 6b f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098bb <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+801098bb:	6a 00                	push   $0x0
+  pushl $178
+801098bd:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+801098c2:	e9 5f f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098c7 <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+801098c7:	6a 00                	push   $0x0
+  pushl $179
+801098c9:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+801098ce:	e9 53 f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098d3 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+801098d3:	6a 00                	push   $0x0
+  pushl $180
+801098d5:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+801098da:	e9 47 f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098df <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+801098df:	6a 00                	push   $0x0
+  pushl $181
+801098e1:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+801098e6:	e9 3b f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098eb <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+801098eb:	6a 00                	push   $0x0
+  pushl $182
+801098ed:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+801098f2:	e9 2f f4 ff ff       	jmp    80108d26 <alltraps>
+
+801098f7 <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+801098f7:	6a 00                	push   $0x0
+  pushl $183
+801098f9:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+801098fe:	e9 23 f4 ff ff       	jmp    80108d26 <alltraps>
+
+80109903 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109903:	6a 00                	push   $0x0
+  pushl $184
+80109905:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010990a:	e9 17 f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010990f <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010990f:	6a 00                	push   $0x0
+  pushl $185
+80109911:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80109916:	e9 0b f4 ff ff       	jmp    80108d26 <alltraps>
+
+8010991b <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010991b:	6a 00                	push   $0x0
+  pushl $186
+8010991d:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109922:	e9 ff f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109927 <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80109927:	6a 00                	push   $0x0
+  pushl $187
+80109929:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010992e:	e9 f3 f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109933 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109933:	6a 00                	push   $0x0
+  pushl $188
+80109935:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010993a:	e9 e7 f3 ff ff       	jmp    80108d26 <alltraps>
+
+8010993f <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010993f:	6a 00                	push   $0x0
+  pushl $189
+80109941:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80109946:	e9 db f3 ff ff       	jmp    80108d26 <alltraps>
+
+8010994b <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010994b:	6a 00                	push   $0x0
+  pushl $190
+8010994d:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80109952:	e9 cf f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109957 <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80109957:	6a 00                	push   $0x0
+  pushl $191
+80109959:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010995e:	e9 c3 f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109963 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80109963:	6a 00                	push   $0x0
+  pushl $192
+80109965:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010996a:	e9 b7 f3 ff ff       	jmp    80108d26 <alltraps>
+
+8010996f <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010996f:	6a 00                	push   $0x0
+  pushl $193
+80109971:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80109976:	e9 ab f3 ff ff       	jmp    80108d26 <alltraps>
+
+8010997b <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010997b:	6a 00                	push   $0x0
+  pushl $194
+8010997d:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80109982:	e9 9f f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109987 <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+80109987:	6a 00                	push   $0x0
+  pushl $195
+80109989:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010998e:	e9 93 f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109993 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+80109993:	6a 00                	push   $0x0
+  pushl $196
+80109995:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010999a:	e9 87 f3 ff ff       	jmp    80108d26 <alltraps>
+
+8010999f <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010999f:	6a 00                	push   $0x0
+  pushl $197
+801099a1:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+801099a6:	e9 7b f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099ab <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+801099ab:	6a 00                	push   $0x0
+  pushl $198
+801099ad:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+801099b2:	e9 6f f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099b7 <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+801099b7:	6a 00                	push   $0x0
+  pushl $199
+801099b9:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+801099be:	e9 63 f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099c3 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+801099c3:	6a 00                	push   $0x0
+  pushl $200
+801099c5:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+801099ca:	e9 57 f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099cf <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+801099cf:	6a 00                	push   $0x0
+  pushl $201
+801099d1:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+801099d6:	e9 4b f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099db <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+801099db:	6a 00                	push   $0x0
+  pushl $202
+801099dd:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+801099e2:	e9 3f f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099e7 <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+801099e7:	6a 00                	push   $0x0
+  pushl $203
+801099e9:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+801099ee:	e9 33 f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099f3 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+801099f3:	6a 00                	push   $0x0
+  pushl $204
+801099f5:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+801099fa:	e9 27 f3 ff ff       	jmp    80108d26 <alltraps>
+
+801099ff <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+801099ff:	6a 00                	push   $0x0
+  pushl $205
+80109a01:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80109a06:	e9 1b f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109a0b <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+80109a0b:	6a 00                	push   $0x0
+  pushl $206
+80109a0d:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80109a12:	e9 0f f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109a17 <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80109a17:	6a 00                	push   $0x0
+  pushl $207
+80109a19:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80109a1e:	e9 03 f3 ff ff       	jmp    80108d26 <alltraps>
+
+80109a23 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80109a23:	6a 00                	push   $0x0
+  pushl $208
+80109a25:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+80109a2a:	e9 f7 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a2f <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80109a2f:	6a 00                	push   $0x0
+  pushl $209
+80109a31:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80109a36:	e9 eb f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a3b <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+80109a3b:	6a 00                	push   $0x0
+  pushl $210
+80109a3d:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80109a42:	e9 df f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a47 <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80109a47:	6a 00                	push   $0x0
+  pushl $211
+80109a49:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80109a4e:	e9 d3 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a53 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80109a53:	6a 00                	push   $0x0
+  pushl $212
+80109a55:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+80109a5a:	e9 c7 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a5f <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80109a5f:	6a 00                	push   $0x0
+  pushl $213
+80109a61:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80109a66:	e9 bb f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a6b <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+80109a6b:	6a 00                	push   $0x0
+  pushl $214
+80109a6d:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80109a72:	e9 af f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a77 <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80109a77:	6a 00                	push   $0x0
+  pushl $215
+80109a79:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80109a7e:	e9 a3 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a83 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80109a83:	6a 00                	push   $0x0
+  pushl $216
+80109a85:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+80109a8a:	e9 97 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a8f <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80109a8f:	6a 00                	push   $0x0
+  pushl $217
+80109a91:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+80109a96:	e9 8b f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109a9b <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+80109a9b:	6a 00                	push   $0x0
+  pushl $218
+80109a9d:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80109aa2:	e9 7f f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109aa7 <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+80109aa7:	6a 00                	push   $0x0
+  pushl $219
+80109aa9:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80109aae:	e9 73 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109ab3 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80109ab3:	6a 00                	push   $0x0
+  pushl $220
+80109ab5:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+80109aba:	e9 67 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109abf <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80109abf:	6a 00                	push   $0x0
+  pushl $221
+80109ac1:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+80109ac6:	e9 5b f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109acb <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+80109acb:	6a 00                	push   $0x0
+  pushl $222
+80109acd:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80109ad2:	e9 4f f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109ad7 <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+80109ad7:	6a 00                	push   $0x0
+  pushl $223
+80109ad9:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80109ade:	e9 43 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109ae3 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80109ae3:	6a 00                	push   $0x0
+  pushl $224
+80109ae5:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+80109aea:	e9 37 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109aef <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80109aef:	6a 00                	push   $0x0
+  pushl $225
+80109af1:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80109af6:	e9 2b f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109afb <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+80109afb:	6a 00                	push   $0x0
+  pushl $226
+80109afd:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80109b02:	e9 1f f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109b07 <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80109b07:	6a 00                	push   $0x0
+  pushl $227
+80109b09:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80109b0e:	e9 13 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109b13 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80109b13:	6a 00                	push   $0x0
+  pushl $228
+80109b15:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+80109b1a:	e9 07 f2 ff ff       	jmp    80108d26 <alltraps>
+
+80109b1f <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80109b1f:	6a 00                	push   $0x0
+  pushl $229
+80109b21:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80109b26:	e9 fb f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b2b <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+80109b2b:	6a 00                	push   $0x0
+  pushl $230
+80109b2d:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80109b32:	e9 ef f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b37 <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80109b37:	6a 00                	push   $0x0
+  pushl $231
+80109b39:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80109b3e:	e9 e3 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b43 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80109b43:	6a 00                	push   $0x0
+  pushl $232
+80109b45:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+80109b4a:	e9 d7 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b4f <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80109b4f:	6a 00                	push   $0x0
+  pushl $233
+80109b51:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80109b56:	e9 cb f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b5b <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+80109b5b:	6a 00                	push   $0x0
+  pushl $234
+80109b5d:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80109b62:	e9 bf f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b67 <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80109b67:	6a 00                	push   $0x0
+  pushl $235
+80109b69:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80109b6e:	e9 b3 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b73 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80109b73:	6a 00                	push   $0x0
+  pushl $236
+80109b75:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+80109b7a:	e9 a7 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b7f <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80109b7f:	6a 00                	push   $0x0
+  pushl $237
+80109b81:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+80109b86:	e9 9b f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b8b <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+80109b8b:	6a 00                	push   $0x0
+  pushl $238
+80109b8d:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80109b92:	e9 8f f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109b97 <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+80109b97:	6a 00                	push   $0x0
+  pushl $239
+80109b99:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80109b9e:	e9 83 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109ba3 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80109ba3:	6a 00                	push   $0x0
+  pushl $240
+80109ba5:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+80109baa:	e9 77 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109baf <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80109baf:	6a 00                	push   $0x0
+  pushl $241
+80109bb1:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+80109bb6:	e9 6b f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109bbb <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+80109bbb:	6a 00                	push   $0x0
+  pushl $242
+80109bbd:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80109bc2:	e9 5f f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109bc7 <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+80109bc7:	6a 00                	push   $0x0
+  pushl $243
+80109bc9:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80109bce:	e9 53 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109bd3 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80109bd3:	6a 00                	push   $0x0
+  pushl $244
+80109bd5:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+80109bda:	e9 47 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109bdf <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80109bdf:	6a 00                	push   $0x0
+  pushl $245
+80109be1:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80109be6:	e9 3b f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109beb <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80109beb:	6a 00                	push   $0x0
+  pushl $246
+80109bed:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80109bf2:	e9 2f f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109bf7 <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80109bf7:	6a 00                	push   $0x0
+  pushl $247
+80109bf9:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80109bfe:	e9 23 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109c03 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80109c03:	6a 00                	push   $0x0
+  pushl $248
+80109c05:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80109c0a:	e9 17 f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109c0f <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80109c0f:	6a 00                	push   $0x0
+  pushl $249
+80109c11:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80109c16:	e9 0b f1 ff ff       	jmp    80108d26 <alltraps>
+
+80109c1b <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80109c1b:	6a 00                	push   $0x0
+  pushl $250
+80109c1d:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80109c22:	e9 ff f0 ff ff       	jmp    80108d26 <alltraps>
+
+80109c27 <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+80109c27:	6a 00                	push   $0x0
+  pushl $251
+80109c29:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80109c2e:	e9 f3 f0 ff ff       	jmp    80108d26 <alltraps>
+
+80109c33 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80109c33:	6a 00                	push   $0x0
+  pushl $252
+80109c35:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+80109c3a:	e9 e7 f0 ff ff       	jmp    80108d26 <alltraps>
+
+80109c3f <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80109c3f:	6a 00                	push   $0x0
+  pushl $253
+80109c41:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+80109c46:	e9 db f0 ff ff       	jmp    80108d26 <alltraps>
+
+80109c4b <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+80109c4b:	6a 00                	push   $0x0
+  pushl $254
+80109c4d:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+80109c52:	e9 cf f0 ff ff       	jmp    80108d26 <alltraps>
+
+80109c57 <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+80109c57:	6a 00                	push   $0x0
+  pushl $255
+80109c59:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+80109c5e:	e9 c3 f0 ff ff       	jmp    80108d26 <alltraps>
+
+80109c63 <walkpgdir>:
+// that corresponds to virtual address va.  If alloc!=0,
+// create any required page table pages.  For a 4MB page,
+// the PDE serves as the PTE.
+static pte_t *
+walkpgdir(pde_t *pgdir, const void *va, int alloc)
+{
+80109c63:	55                   	push   %ebp
+80109c64:	89 e5                	mov    %esp,%ebp
+80109c66:	57                   	push   %edi
+80109c67:	56                   	push   %esi
+80109c68:	53                   	push   %ebx
+80109c69:	83 ec 0c             	sub    $0xc,%esp
+80109c6c:	89 d3                	mov    %edx,%ebx
+  pde_t *pde;
+  pte_t *pgtab;
+
+  pde = &pgdir[PDX(va)];
+80109c6e:	c1 ea 16             	shr    $0x16,%edx
+80109c71:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  if(*pde & PTE_PS)
+80109c74:	8b 37                	mov    (%edi),%esi
+80109c76:	f7 c6 80 00 00 00    	test   $0x80,%esi
+80109c7c:	75 20                	jne    80109c9e <walkpgdir+0x3b>
+    return pde;
+  if(*pde & PTE_P){
+80109c7e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+80109c84:	74 22                	je     80109ca8 <walkpgdir+0x45>
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80109c86:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+80109c8c:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+    // The permissions here are overly generous, but they can
+    // be further restricted by the permissions in the page table
+    // entries, if necessary.
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  }
+  return &pgtab[PTX(va)];
+80109c92:	c1 eb 0a             	shr    $0xa,%ebx
+80109c95:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+80109c9b:	8d 3c 1e             	lea    (%esi,%ebx,1),%edi
+}
+80109c9e:	89 f8                	mov    %edi,%eax
+80109ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109ca3:	5b                   	pop    %ebx
+80109ca4:	5e                   	pop    %esi
+80109ca5:	5f                   	pop    %edi
+80109ca6:	5d                   	pop    %ebp
+80109ca7:	c3                   	ret
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+80109ca8:	85 c9                	test   %ecx,%ecx
+80109caa:	74 33                	je     80109cdf <walkpgdir+0x7c>
+80109cac:	e8 d7 8a ff ff       	call   80102788 <kalloc>
+80109cb1:	89 c6                	mov    %eax,%esi
+80109cb3:	85 c0                	test   %eax,%eax
+80109cb5:	74 2f                	je     80109ce6 <walkpgdir+0x83>
+    memset(pgtab, 0, PGSIZE);
+80109cb7:	83 ec 04             	sub    $0x4,%esp
+80109cba:	68 00 10 00 00       	push   $0x1000
+80109cbf:	6a 00                	push   $0x0
+80109cc1:	50                   	push   %eax
+80109cc2:	e8 96 d9 ff ff       	call   8010765d <memset>
+    __sync_fetch_and_add(&vmstat.pgtables, 1);
+80109cc7:	f0 83 05 94 e3 15 80 	lock addl $0x1,0x8015e394
+80109cce:	01 
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80109ccf:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80109cd5:	83 c8 07             	or     $0x7,%eax
+80109cd8:	89 07                	mov    %eax,(%edi)
+80109cda:	83 c4 10             	add    $0x10,%esp
+80109cdd:	eb b3                	jmp    80109c92 <walkpgdir+0x2f>
+      return 0;
+80109cdf:	bf 00 00 00 00       	mov    $0x0,%edi
+80109ce4:	eb b8                	jmp    80109c9e <walkpgdir+0x3b>
+80109ce6:	89 c7                	mov    %eax,%edi
+80109ce8:	eb b4                	jmp    80109c9e <walkpgdir+0x3b>
+
+80109cea <mappages>:
+// Create PTEs for virtual addresses starting at va that refer to
+// physical addresses starting at pa. va and size might not
+// be page-aligned.
+static int
+mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+80109cea:	55                   	push   %ebp
+80109ceb:	89 e5                	mov    %esp,%ebp
+80109ced:	57                   	push   %edi
+80109cee:	56                   	push   %esi
+80109cef:	53                   	push   %ebx
+80109cf0:	83 ec 1c             	sub    $0x1c,%esp
+80109cf3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109cf6:	89 d0                	mov    %edx,%eax
+  char *a, *last;
+  pte_t *pte;
+
+  a = (char*)PGROUNDDOWN((uint)va);
+80109cf8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+80109cfe:	89 d6                	mov    %edx,%esi
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+80109d00:	8d 44 08 ff          	lea    -0x1(%eax,%ecx,1),%eax
+80109d04:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80109d09:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109d0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+80109d0f:	29 d7                	sub    %edx,%edi
+80109d11:	8d 1c 3e             	lea    (%esi,%edi,1),%ebx
+  for(;;){
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80109d14:	b9 01 00 00 00       	mov    $0x1,%ecx
+80109d19:	89 f2                	mov    %esi,%edx
+80109d1b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109d1e:	e8 40 ff ff ff       	call   80109c63 <walkpgdir>
+80109d23:	85 c0                	test   %eax,%eax
+80109d25:	74 29                	je     80109d50 <mappages+0x66>
+      return -1;
+    if(*pte & PTE_P)
+80109d27:	f6 00 01             	testb  $0x1,(%eax)
+80109d2a:	75 17                	jne    80109d43 <mappages+0x59>
+      panic("remap");
+    *pte = pa | perm | PTE_P;
+80109d2c:	0b 5d 0c             	or     0xc(%ebp),%ebx
+80109d2f:	83 cb 01             	or     $0x1,%ebx
+80109d32:	89 18                	mov    %ebx,(%eax)
+    if(a == last)
+80109d34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80109d37:	39 c6                	cmp    %eax,%esi
+80109d39:	74 22                	je     80109d5d <mappages+0x73>
+      break;
+    a += PGSIZE;
+80109d3b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80109d41:	eb ce                	jmp    80109d11 <mappages+0x27>
+      panic("remap");
+80109d43:	83 ec 0c             	sub    $0xc,%esp
+80109d46:	68 ec bb 10 80       	push   $0x8010bbec
+80109d4b:	e8 f2 65 ff ff       	call   80100342 <panic>
+      return -1;
+80109d50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    pa += PGSIZE;
+  }
+  return 0;
+}
+80109d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109d58:	5b                   	pop    %ebx
+80109d59:	5e                   	pop    %esi
+80109d5a:	5f                   	pop    %edi
+80109d5b:	5d                   	pop    %ebp
+80109d5c:	c3                   	ret
+  return 0;
+80109d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+80109d62:	eb f1                	jmp    80109d55 <mappages+0x6b>
+
+80109d64 <seginit>:
+{
+80109d64:	55                   	push   %ebp
+80109d65:	89 e5                	mov    %esp,%ebp
+80109d67:	53                   	push   %ebx
+80109d68:	83 ec 14             	sub    $0x14,%esp
+  c = &cpus[cpuid()];
+80109d6b:	e8 cb a6 ff ff       	call   8010443b <cpuid>
+80109d70:	89 c1                	mov    %eax,%ecx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+80109d72:	8d 14 00             	lea    (%eax,%eax,1),%edx
+80109d75:	8d 04 02             	lea    (%edx,%eax,1),%eax
+80109d78:	c1 e0 06             	shl    $0x6,%eax
+80109d7b:	66 c7 80 f8 f9 13 80 	movw   $0xffff,-0x7fec0608(%eax)
+80109d82:	ff ff 
+80109d84:	66 c7 80 fa f9 13 80 	movw   $0x0,-0x7fec0606(%eax)
+80109d8b:	00 00 
+80109d8d:	c6 80 fc f9 13 80 00 	movb   $0x0,-0x7fec0604(%eax)
+80109d94:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+80109d97:	c1 e3 06             	shl    $0x6,%ebx
+80109d9a:	c6 83 fd f9 13 80 9a 	movb   $0x9a,-0x7fec0603(%ebx)
+80109da1:	c6 83 fe f9 13 80 cf 	movb   $0xcf,-0x7fec0602(%ebx)
+80109da8:	c6 80 ff f9 13 80 00 	movb   $0x0,-0x7fec0601(%eax)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+80109daf:	66 c7 80 00 fa 13 80 	movw   $0xffff,-0x7fec0600(%eax)
+80109db6:	ff ff 
+80109db8:	66 c7 80 02 fa 13 80 	movw   $0x0,-0x7fec05fe(%eax)
+80109dbf:	00 00 
+80109dc1:	c6 80 04 fa 13 80 00 	movb   $0x0,-0x7fec05fc(%eax)
+80109dc8:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+80109dcb:	c1 e3 06             	shl    $0x6,%ebx
+80109dce:	c6 83 05 fa 13 80 92 	movb   $0x92,-0x7fec05fb(%ebx)
+80109dd5:	c6 83 06 fa 13 80 cf 	movb   $0xcf,-0x7fec05fa(%ebx)
+80109ddc:	c6 80 07 fa 13 80 00 	movb   $0x0,-0x7fec05f9(%eax)
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80109de3:	66 c7 80 08 fa 13 80 	movw   $0xffff,-0x7fec05f8(%eax)
+80109dea:	ff ff 
+80109dec:	66 c7 80 0a fa 13 80 	movw   $0x0,-0x7fec05f6(%eax)
+80109df3:	00 00 
+80109df5:	c6 80 0c fa 13 80 00 	movb   $0x0,-0x7fec05f4(%eax)
+80109dfc:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+80109dff:	c1 e3 06             	shl    $0x6,%ebx
+80109e02:	c6 83 0d fa 13 80 fa 	movb   $0xfa,-0x7fec05f3(%ebx)
+80109e09:	c6 83 0e fa 13 80 cf 	movb   $0xcf,-0x7fec05f2(%ebx)
+80109e10:	c6 80 0f fa 13 80 00 	movb   $0x0,-0x7fec05f1(%eax)
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80109e17:	66 c7 80 10 fa 13 80 	movw   $0xffff,-0x7fec05f0(%eax)
+80109e1e:	ff ff 
+80109e20:	66 c7 80 12 fa 13 80 	movw   $0x0,-0x7fec05ee(%eax)
+80109e27:	00 00 
+80109e29:	c6 80 14 fa 13 80 00 	movb   $0x0,-0x7fec05ec(%eax)
+80109e30:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+80109e33:	c1 e3 06             	shl    $0x6,%ebx
+80109e36:	c6 83 15 fa 13 80 f2 	movb   $0xf2,-0x7fec05eb(%ebx)
+80109e3d:	c6 83 16 fa 13 80 cf 	movb   $0xcf,-0x7fec05ea(%ebx)
+80109e44:	c6 80 17 fa 13 80 00 	movb   $0x0,-0x7fec05e9(%eax)
+  lgdt(c->gdt, sizeof(c->gdt));
+80109e4b:	01 ca                	add    %ecx,%edx
+80109e4d:	c1 e2 06             	shl    $0x6,%edx
+80109e50:	81 c2 f0 f9 13 80    	add    $0x8013f9f0,%edx
+  pd[0] = size-1;
+80109e56:	66 c7 45 f2 2f 00    	movw   $0x2f,-0xe(%ebp)
+  pd[1] = (uint)p;
+80109e5c:	66 89 55 f4          	mov    %dx,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+80109e60:	c1 ea 10             	shr    $0x10,%edx
+80109e63:	66 89 55 f6          	mov    %dx,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+80109e67:	8d 45 f2             	lea    -0xe(%ebp),%eax
+80109e6a:	0f 01 10             	lgdtl  (%eax)
+}
+80109e6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109e70:	c9                   	leave
+80109e71:	c3                   	ret
+
+80109e72 <setupkvm>:
+}
+
+// Set up kernel part of a page table, sharing kpgdir's.
+pde_t*
+setupkvm(void)
+{
+80109e72:	55                   	push   %ebp
+80109e73:	89 e5                	mov    %esp,%ebp
+80109e75:	53                   	push   %ebx
+80109e76:	83 ec 04             	sub    $0x4,%esp
+  pde_t *pgdir;
+
+  if(kpgdir == 0)
+80109e79:	83 3d cc e3 15 80 00 	cmpl   $0x0,0x8015e3cc
+80109e80:	74 4c                	je     80109ece <setupkvm+0x5c>
+    panic("setupkvm");
+  if((pgdir = (pde_t*)kalloc()) == 0)
+80109e82:	e8 01 89 ff ff       	call   80102788 <kalloc>
+80109e87:	89 c3                	mov    %eax,%ebx
+80109e89:	85 c0                	test   %eax,%eax
+80109e8b:	74 3a                	je     80109ec7 <setupkvm+0x55>
+    return 0;
+  memset(pgdir, 0, PDX(KERNBASE)*sizeof(pde_t));
+80109e8d:	83 ec 04             	sub    $0x4,%esp
+80109e90:	68 00 08 00 00       	push   $0x800
+80109e95:	6a 00                	push   $0x0
+80109e97:	50                   	push   %eax
+80109e98:	e8 c0 d7 ff ff       	call   8010765d <memset>
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+80109e9d:	83 c4 0c             	add    $0xc,%esp
+80109ea0:	68 00 08 00 00       	push   $0x800
+80109ea5:	a1 cc e3 15 80       	mov    0x8015e3cc,%eax
+80109eaa:	05 00 08 00 00       	add    $0x800,%eax
+80109eaf:	50                   	push   %eax
+80109eb0:	8d 83 00 08 00 00    	lea    0x800(%ebx),%eax
+80109eb6:	50                   	push   %eax
+80109eb7:	e8 18 d8 ff ff       	call   801076d4 <memmove>
+          (NPDENTRIES - PDX(KERNBASE))*sizeof(pde_t));
+  __sync_fetch_and_add(&vmstat.pgtables, 1);
+80109ebc:	f0 83 05 94 e3 15 80 	lock addl $0x1,0x8015e394
+80109ec3:	01 
+  return pgdir;
+80109ec4:	83 c4 10             	add    $0x10,%esp
+}
+80109ec7:	89 d8                	mov    %ebx,%eax
+80109ec9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109ecc:	c9                   	leave
+80109ecd:	c3                   	ret
+    panic("setupkvm");
+80109ece:	83 ec 0c             	sub    $0xc,%esp
+80109ed1:	68 f2 bb 10 80       	push   $0x8010bbf2
+80109ed6:	e8 67 64 ff ff       	call   80100342 <panic>
+
+80109edb <switchkvm>:
+// Switch h/w page table register to the kernel-only page table,
+// for when no process is running.
+void
+switchkvm(void)
+{
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+80109edb:	a1 cc e3 15 80       	mov    0x8015e3cc,%eax
+80109ee0:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80109ee5:	0f 22 d8             	mov    %eax,%cr3
+}
+80109ee8:	c3                   	ret
+
+80109ee9 <kvmalloc>:
+{
+80109ee9:	55                   	push   %ebp
+80109eea:	89 e5                	mov    %esp,%ebp
+80109eec:	57                   	push   %edi
+80109eed:	56                   	push   %esi
+80109eee:	53                   	push   %ebx
+80109eef:	83 ec 1c             	sub    $0x1c,%esp
+  if((kpgdir = (pde_t*)kalloc()) == 0)
+80109ef2:	e8 91 88 ff ff       	call   80102788 <kalloc>
+80109ef7:	a3 cc e3 15 80       	mov    %eax,0x8015e3cc
+80109efc:	85 c0                	test   %eax,%eax
+80109efe:	74 1d                	je     80109f1d <kvmalloc+0x34>
+  memset(kpgdir, 0, PGSIZE);
+80109f00:	83 ec 04             	sub    $0x4,%esp
+80109f03:	68 00 10 00 00       	push   $0x1000
+80109f08:	6a 00                	push   $0x0
+80109f0a:	50                   	push   %eax
+80109f0b:	e8 4d d7 ff ff       	call   8010765d <memset>
+80109f10:	83 c4 10             	add    $0x10,%esp
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80109f13:	bb 20 e4 10 80       	mov    $0x8010e420,%ebx
+80109f18:	e9 9c 00 00 00       	jmp    80109fb9 <kvmalloc+0xd0>
+    panic("kvmalloc");
+80109f1d:	83 ec 0c             	sub    $0xc,%esp
+80109f20:	68 fb bb 10 80       	push   $0x8010bbfb
+80109f25:	e8 18 64 ff ff       	call   80100342 <panic>
+        panic("remap");
+80109f2a:	83 ec 0c             	sub    $0xc,%esp
+80109f2d:	68 ec bb 10 80       	push   $0x8010bbec
+80109f32:	e8 0b 64 ff ff       	call   80100342 <panic>
+      n = HUGEPGSIZE - (uint)va % HUGEPGSIZE;
+80109f37:	bb 00 00 40 00       	mov    $0x400000,%ebx
+80109f3c:	29 d3                	sub    %edx,%ebx
+80109f3e:	39 fb                	cmp    %edi,%ebx
+80109f40:	0f 47 df             	cmova  %edi,%ebx
+      if(mappages(pgdir, va, n, pa, perm) < 0)
+80109f43:	83 ec 08             	sub    $0x8,%esp
+80109f46:	ff 75 e0             	push   -0x20(%ebp)
+80109f49:	ff 75 e4             	push   -0x1c(%ebp)
+80109f4c:	89 d9                	mov    %ebx,%ecx
+80109f4e:	89 f2                	mov    %esi,%edx
+80109f50:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80109f53:	e8 92 fd ff ff       	call   80109cea <mappages>
+80109f58:	83 c4 10             	add    $0x10,%esp
+80109f5b:	85 c0                	test   %eax,%eax
+80109f5d:	0f 88 87 00 00 00    	js     80109fea <kvmalloc+0x101>
+    va += n;
+80109f63:	01 de                	add    %ebx,%esi
+    pa += n;
+80109f65:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  while(size > 0){
+80109f68:	29 df                	sub    %ebx,%edi
+80109f6a:	74 3f                	je     80109fab <kvmalloc+0xc2>
+    if((uint)va % HUGEPGSIZE == 0 && pa % HUGEPGSIZE == 0 &&
+80109f6c:	89 f1                	mov    %esi,%ecx
+80109f6e:	89 f2                	mov    %esi,%edx
+80109f70:	81 e2 ff ff 3f 00    	and    $0x3fffff,%edx
+80109f76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109f79:	09 f0                	or     %esi,%eax
+80109f7b:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+80109f80:	75 b5                	jne    80109f37 <kvmalloc+0x4e>
+80109f82:	81 ff ff ff 3f 00    	cmp    $0x3fffff,%edi
+80109f88:	76 ad                	jbe    80109f37 <kvmalloc+0x4e>
+      if(pgdir[PDX(va)] & PTE_P)
+80109f8a:	c1 e9 16             	shr    $0x16,%ecx
+80109f8d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80109f90:	8d 14 88             	lea    (%eax,%ecx,4),%edx
+80109f93:	f6 02 01             	testb  $0x1,(%edx)
+80109f96:	75 92                	jne    80109f2a <kvmalloc+0x41>
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+80109f98:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80109f9b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80109f9e:	09 c8                	or     %ecx,%eax
+80109fa0:	0c 81                	or     $0x81,%al
+80109fa2:	89 02                	mov    %eax,(%edx)
+      n = HUGEPGSIZE;
+80109fa4:	bb 00 00 40 00       	mov    $0x400000,%ebx
+80109fa9:	eb b8                	jmp    80109f63 <kvmalloc+0x7a>
+80109fab:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80109fae:	83 c3 10             	add    $0x10,%ebx
+80109fb1:	81 fb 60 e4 10 80    	cmp    $0x8010e460,%ebx
+80109fb7:	74 24                	je     80109fdd <kvmalloc+0xf4>
+    if(mapkvm(kpgdir, k->virt, k->phys_end - k->phys_start,
+80109fb9:	8b 43 0c             	mov    0xc(%ebx),%eax
+80109fbc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+              (uint)k->phys_start, k->perm) < 0)
+80109fbf:	8b 7b 04             	mov    0x4(%ebx),%edi
+    if(mapkvm(kpgdir, k->virt, k->phys_end - k->phys_start,
+80109fc2:	8b 33                	mov    (%ebx),%esi
+80109fc4:	a1 cc e3 15 80       	mov    0x8015e3cc,%eax
+80109fc9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while(size > 0){
+80109fcc:	8b 43 08             	mov    0x8(%ebx),%eax
+80109fcf:	29 f8                	sub    %edi,%eax
+80109fd1:	74 db                	je     80109fae <kvmalloc+0xc5>
+80109fd3:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+80109fd6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80109fd9:	89 c7                	mov    %eax,%edi
+80109fdb:	eb 8f                	jmp    80109f6c <kvmalloc+0x83>
+  switchkvm();
+80109fdd:	e8 f9 fe ff ff       	call   80109edb <switchkvm>
+}
+80109fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109fe5:	5b                   	pop    %ebx
+80109fe6:	5e                   	pop    %esi
+80109fe7:	5f                   	pop    %edi
+80109fe8:	5d                   	pop    %ebp
+80109fe9:	c3                   	ret
+      panic("kvmalloc");
+80109fea:	83 ec 0c             	sub    $0xc,%esp
+80109fed:	68 fb bb 10 80       	push   $0x8010bbfb
+80109ff2:	e8 4b 63 ff ff       	call   80100342 <panic>
+
+80109ff7 <switchuvm>:
+
+// Switch TSS and h/w page table to correspond to process p.
+void
+switchuvm(struct proc *p)
+{
+80109ff7:	55                   	push   %ebp
+80109ff8:	89 e5                	mov    %esp,%ebp
+80109ffa:	57                   	push   %edi
+80109ffb:	56                   	push   %esi
+80109ffc:	53                   	push   %ebx
+80109ffd:	83 ec 1c             	sub    $0x1c,%esp
+8010a000:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010a003:	85 f6                	test   %esi,%esi
+8010a005:	0f 84 c3 00 00 00    	je     8010a0ce <switchuvm+0xd7>
+    panic("switchuvm: no process");
+  if(p->kstack == 0)
+8010a00b:	83 7e 08 00          	cmpl   $0x0,0x8(%esi)
+8010a00f:	0f 84 c6 00 00 00    	je     8010a0db <switchuvm+0xe4>
+    panic("switchuvm: no kstack");
+  if(p->pgdir == 0)
+8010a015:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+8010a019:	0f 84 c9 00 00 00    	je     8010a0e8 <switchuvm+0xf1>
+    panic("switchuvm: no pgdir");
+
+  pushcli();
+8010a01f:	e8 bb d4 ff ff       	call   801074df <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a024:	e8 b3 a3 ff ff       	call   801043dc <mycpu>
+8010a029:	89 c3                	mov    %eax,%ebx
+8010a02b:	e8 ac a3 ff ff       	call   801043dc <mycpu>
+8010a030:	89 c7                	mov    %eax,%edi
+8010a032:	e8 a5 a3 ff ff       	call   801043dc <mycpu>
+8010a037:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a03a:	e8 9d a3 ff ff       	call   801043dc <mycpu>
+8010a03f:	66 c7 83 98 00 00 00 	movw   $0x67,0x98(%ebx)
+8010a046:	67 00 
+8010a048:	83 c7 08             	add    $0x8,%edi
+8010a04b:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010a052:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a055:	83 c2 08             	add    $0x8,%edx
+8010a058:	c1 ea 10             	shr    $0x10,%edx
+8010a05b:	88 93 9c 00 00 00    	mov    %dl,0x9c(%ebx)
+8010a061:	c6 83 9d 00 00 00 99 	movb   $0x99,0x9d(%ebx)
+8010a068:	c6 83 9e 00 00 00 40 	movb   $0x40,0x9e(%ebx)
+8010a06f:	83 c0 08             	add    $0x8,%eax
+8010a072:	c1 e8 18             	shr    $0x18,%eax
+8010a075:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+                                sizeof(mycpu()->ts)-1, 0);
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010a07b:	e8 5c a3 ff ff       	call   801043dc <mycpu>
+8010a080:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a087:	e8 50 a3 ff ff       	call   801043dc <mycpu>
+8010a08c:	66 c7 40 10 10 00    	movw   $0x10,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010a092:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010a095:	e8 42 a3 ff ff       	call   801043dc <mycpu>
+8010a09a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a0a0:	89 58 0c             	mov    %ebx,0xc(%eax)
+  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
+  // forbids I/O instructions (e.g., inb and outb) from user space
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a0a3:	e8 34 a3 ff ff       	call   801043dc <mycpu>
+8010a0a8:	66 c7 40 6e ff ff    	movw   $0xffff,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010a0ae:	b8 28 00 00 00       	mov    $0x28,%eax
+8010a0b3:	0f 00 d8             	ltr    %ax
+  ltr(SEG_TSS << 3);
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010a0b6:	8b 46 04             	mov    0x4(%esi),%eax
+8010a0b9:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a0be:	0f 22 d8             	mov    %eax,%cr3
+  popcli();
+8010a0c1:	e8 55 d4 ff ff       	call   8010751b <popcli>
+}
+8010a0c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a0c9:	5b                   	pop    %ebx
+8010a0ca:	5e                   	pop    %esi
+8010a0cb:	5f                   	pop    %edi
+8010a0cc:	5d                   	pop    %ebp
+8010a0cd:	c3                   	ret
+    panic("switchuvm: no process");
+8010a0ce:	83 ec 0c             	sub    $0xc,%esp
+8010a0d1:	68 04 bc 10 80       	push   $0x8010bc04
+8010a0d6:	e8 67 62 ff ff       	call   80100342 <panic>
+    panic("switchuvm: no kstack");
+8010a0db:	83 ec 0c             	sub    $0xc,%esp
+8010a0de:	68 1a bc 10 80       	push   $0x8010bc1a
+8010a0e3:	e8 5a 62 ff ff       	call   80100342 <panic>
+    panic("switchuvm: no pgdir");
+8010a0e8:	83 ec 0c             	sub    $0xc,%esp
+8010a0eb:	68 2f bc 10 80       	push   $0x8010bc2f
+8010a0f0:	e8 4d 62 ff ff       	call   80100342 <panic>
+
+8010a0f5 <inituvm>:
+
+// Load the initcode into address 0 of pgdir.
+// sz must be less than a page.
+void
+inituvm(pde_t *pgdir, char *init, uint sz)
+{
+8010a0f5:	55                   	push   %ebp
+8010a0f6:	89 e5                	mov    %esp,%ebp
+8010a0f8:	56                   	push   %esi
+8010a0f9:	53                   	push   %ebx
+8010a0fa:	8b 75 10             	mov    0x10(%ebp),%esi
+  char *mem;
+
+  if(sz >= PGSIZE)
+8010a0fd:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a103:	77 4c                	ja     8010a151 <inituvm+0x5c>
+    panic("inituvm: more than a page");
+  mem = kalloc();
+8010a105:	e8 7e 86 ff ff       	call   80102788 <kalloc>
+8010a10a:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010a10c:	83 ec 04             	sub    $0x4,%esp
+8010a10f:	68 00 10 00 00       	push   $0x1000
+8010a114:	6a 00                	push   $0x0
+8010a116:	50                   	push   %eax
+8010a117:	e8 41 d5 ff ff       	call   8010765d <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010a11c:	83 c4 08             	add    $0x8,%esp
+8010a11f:	6a 06                	push   $0x6
+8010a121:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010a127:	50                   	push   %eax
+8010a128:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a12d:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a132:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a135:	e8 b0 fb ff ff       	call   80109cea <mappages>
+  memmove(mem, init, sz);
+8010a13a:	83 c4 0c             	add    $0xc,%esp
+8010a13d:	56                   	push   %esi
+8010a13e:	ff 75 0c             	push   0xc(%ebp)
+8010a141:	53                   	push   %ebx
+8010a142:	e8 8d d5 ff ff       	call   801076d4 <memmove>
+}
+8010a147:	83 c4 10             	add    $0x10,%esp
+8010a14a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a14d:	5b                   	pop    %ebx
+8010a14e:	5e                   	pop    %esi
+8010a14f:	5d                   	pop    %ebp
+8010a150:	c3                   	ret
+    panic("inituvm: more than a page");
+8010a151:	83 ec 0c             	sub    $0xc,%esp
+8010a154:	68 43 bc 10 80       	push   $0x8010bc43
+8010a159:	e8 e4 61 ff ff       	call   80100342 <panic>
+
+8010a15e <loaduvm>:
+
+// Load a program segment into pgdir.  addr must be page-aligned
+// and the pages from addr to addr+sz must already be mapped.
+int
+loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
+{
+8010a15e:	55                   	push   %ebp
+8010a15f:	89 e5                	mov    %esp,%ebp
+8010a161:	57                   	push   %edi
+8010a162:	56                   	push   %esi
+8010a163:	53                   	push   %ebx
+8010a164:	83 ec 0c             	sub    $0xc,%esp
+8010a167:	8b 7d 18             	mov    0x18(%ebp),%edi
+  uint i, pa, n;
+  pte_t *pte;
+
+  if((uint) addr % PGSIZE != 0)
+8010a16a:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010a16d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010a173:	75 61                	jne    8010a1d6 <loaduvm+0x78>
+    else
+      n = PGSIZE;
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+      return -1;
+  }
+  return 0;
+8010a175:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(i = 0; i < sz; i += PGSIZE){
+8010a17a:	85 ff                	test   %edi,%edi
+8010a17c:	74 77                	je     8010a1f5 <loaduvm+0x97>
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010a17e:	89 f2                	mov    %esi,%edx
+8010a180:	03 55 0c             	add    0xc(%ebp),%edx
+8010a183:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a188:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a18b:	e8 d3 fa ff ff       	call   80109c63 <walkpgdir>
+8010a190:	85 c0                	test   %eax,%eax
+8010a192:	74 4f                	je     8010a1e3 <loaduvm+0x85>
+    if(sz - i < PGSIZE)
+8010a194:	89 fb                	mov    %edi,%ebx
+8010a196:	29 f3                	sub    %esi,%ebx
+8010a198:	ba 00 10 00 00       	mov    $0x1000,%edx
+8010a19d:	39 d3                	cmp    %edx,%ebx
+8010a19f:	0f 47 da             	cmova  %edx,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a1a2:	53                   	push   %ebx
+8010a1a3:	89 f2                	mov    %esi,%edx
+8010a1a5:	03 55 14             	add    0x14(%ebp),%edx
+8010a1a8:	52                   	push   %edx
+    pa = PTE_ADDR(*pte);
+8010a1a9:	8b 00                	mov    (%eax),%eax
+8010a1ab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a1b0:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a1b5:	50                   	push   %eax
+8010a1b6:	ff 75 10             	push   0x10(%ebp)
+8010a1b9:	e8 6f 77 ff ff       	call   8010192d <readi>
+8010a1be:	83 c4 10             	add    $0x10,%esp
+8010a1c1:	39 d8                	cmp    %ebx,%eax
+8010a1c3:	75 2b                	jne    8010a1f0 <loaduvm+0x92>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a1c5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010a1cb:	39 fe                	cmp    %edi,%esi
+8010a1cd:	72 af                	jb     8010a17e <loaduvm+0x20>
+  return 0;
+8010a1cf:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a1d4:	eb 1f                	jmp    8010a1f5 <loaduvm+0x97>
+    panic("loaduvm: addr must be page aligned");
+8010a1d6:	83 ec 0c             	sub    $0xc,%esp
+8010a1d9:	68 d4 bc 10 80       	push   $0x8010bcd4
+8010a1de:	e8 5f 61 ff ff       	call   80100342 <panic>
+      panic("loaduvm: address should exist");
+8010a1e3:	83 ec 0c             	sub    $0xc,%esp
+8010a1e6:	68 5d bc 10 80       	push   $0x8010bc5d
+8010a1eb:	e8 52 61 ff ff       	call   80100342 <panic>
+      return -1;
+8010a1f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a1f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a1f8:	5b                   	pop    %ebx
+8010a1f9:	5e                   	pop    %esi
+8010a1fa:	5f                   	pop    %edi
+8010a1fb:	5d                   	pop    %ebp
+8010a1fc:	c3                   	ret
+
+8010a1fd <deallocuvm>:
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+8010a1fd:	55                   	push   %ebp
+8010a1fe:	89 e5                	mov    %esp,%ebp
+8010a200:	57                   	push   %edi
+8010a201:	56                   	push   %esi
+8010a202:	53                   	push   %ebx
+8010a203:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+8010a209:	8b 75 10             	mov    0x10(%ebp),%esi
+  uint a, pa;
+  char *mem[KBATCH];
+  int n;
+
+  if(newsz >= oldsz)
+    return oldsz;
+8010a20c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(newsz >= oldsz)
+8010a20f:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a212:	0f 83 15 01 00 00    	jae    8010a32d <deallocuvm+0x130>
+
+  // Give the pages back KBATCH at a time.
+  n = 0;
+  a = PGROUNDUP(newsz);
+8010a218:	8d 9e ff 0f 00 00    	lea    0xfff(%esi),%ebx
+8010a21e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a224:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010a227:	0f 83 08 01 00 00    	jae    8010a335 <deallocuvm+0x138>
+  n = 0;
+8010a22d:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+8010a234:	00 00 00 
+8010a237:	89 75 10             	mov    %esi,0x10(%ebp)
+8010a23a:	eb 18                	jmp    8010a254 <deallocuvm+0x57>
+      // A 4MB page is freed only once all of it is gone.
+      if(a % HUGEPGSIZE == 0){
+        kfreeorder(P2V(PTE_ADDR(pgdir[PDX(a)])), HUGEORDER);
+        pgdir[PDX(a)] = 0;
+      }
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a23c:	c1 e6 16             	shl    $0x16,%esi
+8010a23f:	8d 9e 00 f0 3f 00    	lea    0x3ff000(%esi),%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a245:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a24b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010a24e:	0f 83 bc 00 00 00    	jae    8010a310 <deallocuvm+0x113>
+    if(pgdir[PDX(a)] & PTE_PS){
+8010a254:	89 de                	mov    %ebx,%esi
+8010a256:	c1 ee 16             	shr    $0x16,%esi
+8010a259:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a25c:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+8010a25f:	8b 07                	mov    (%edi),%eax
+8010a261:	a8 80                	test   $0x80,%al
+8010a263:	74 28                	je     8010a28d <deallocuvm+0x90>
+      if(a % HUGEPGSIZE == 0){
+8010a265:	f7 c3 ff ff 3f 00    	test   $0x3fffff,%ebx
+8010a26b:	75 cf                	jne    8010a23c <deallocuvm+0x3f>
+        kfreeorder(P2V(PTE_ADDR(pgdir[PDX(a)])), HUGEORDER);
+8010a26d:	83 ec 08             	sub    $0x8,%esp
+8010a270:	6a 0a                	push   $0xa
+8010a272:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a277:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a27c:	50                   	push   %eax
+8010a27d:	e8 51 81 ff ff       	call   801023d3 <kfreeorder>
+        pgdir[PDX(a)] = 0;
+8010a282:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+8010a288:	83 c4 10             	add    $0x10,%esp
+8010a28b:	eb af                	jmp    8010a23c <deallocuvm+0x3f>
+      continue;
+    }
+    pte = walkpgdir(pgdir, (char*)a, 0);
+8010a28d:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a292:	89 da                	mov    %ebx,%edx
+8010a294:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a297:	e8 c7 f9 ff ff       	call   80109c63 <walkpgdir>
+8010a29c:	89 c7                	mov    %eax,%edi
+    if(!pte)
+8010a29e:	85 c0                	test   %eax,%eax
+8010a2a0:	74 38                	je     8010a2da <deallocuvm+0xdd>
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) != 0){
+8010a2a2:	8b 00                	mov    (%eax),%eax
+8010a2a4:	a8 01                	test   $0x1,%al
+8010a2a6:	74 9d                	je     8010a245 <deallocuvm+0x48>
+      pa = PTE_ADDR(*pte);
+      if(pa == 0)
+8010a2a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a2ad:	74 39                	je     8010a2e8 <deallocuvm+0xeb>
+        panic("kfree");
+      mem[n++] = P2V(pa);
+8010a2af:	8b 8d 64 ff ff ff    	mov    -0x9c(%ebp),%ecx
+8010a2b5:	8d 51 01             	lea    0x1(%ecx),%edx
+8010a2b8:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a2bd:	89 84 8d 68 ff ff ff 	mov    %eax,-0x98(%ebp,%ecx,4)
+      if(n == KBATCH){
+8010a2c4:	83 f9 1f             	cmp    $0x1f,%ecx
+8010a2c7:	74 2c                	je     8010a2f5 <deallocuvm+0xf8>
+        kfreen(mem, n);
+        n = 0;
+      }
+      *pte = 0;
+8010a2c9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+8010a2cf:	89 95 64 ff ff ff    	mov    %edx,-0x9c(%ebp)
+8010a2d5:	e9 6b ff ff ff       	jmp    8010a245 <deallocuvm+0x48>
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a2da:	c1 e6 16             	shl    $0x16,%esi
+8010a2dd:	8d 9e 00 f0 3f 00    	lea    0x3ff000(%esi),%ebx
+8010a2e3:	e9 5d ff ff ff       	jmp    8010a245 <deallocuvm+0x48>
+        panic("kfree");
+8010a2e8:	83 ec 0c             	sub    $0xc,%esp
+8010a2eb:	68 29 b0 10 80       	push   $0x8010b029
+8010a2f0:	e8 4d 60 ff ff       	call   80100342 <panic>
+        kfreen(mem, n);
+8010a2f5:	83 ec 08             	sub    $0x8,%esp
+8010a2f8:	6a 20                	push   $0x20
+8010a2fa:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+8010a300:	50                   	push   %eax
+8010a301:	e8 84 81 ff ff       	call   8010248a <kfreen>
+8010a306:	83 c4 10             	add    $0x10,%esp
+        n = 0;
+8010a309:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a30e:	eb b9                	jmp    8010a2c9 <deallocuvm+0xcc>
+8010a310:	8b 75 10             	mov    0x10(%ebp),%esi
+    }
+  }
+  kfreen(mem, n);
+8010a313:	83 ec 08             	sub    $0x8,%esp
+8010a316:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+8010a31c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+8010a322:	50                   	push   %eax
+8010a323:	e8 62 81 ff ff       	call   8010248a <kfreen>
+  return newsz;
+8010a328:	89 f0                	mov    %esi,%eax
+8010a32a:	83 c4 10             	add    $0x10,%esp
+}
+8010a32d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a330:	5b                   	pop    %ebx
+8010a331:	5e                   	pop    %esi
+8010a332:	5f                   	pop    %edi
+8010a333:	5d                   	pop    %ebp
+8010a334:	c3                   	ret
+  n = 0;
+8010a335:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+8010a33c:	00 00 00 
+8010a33f:	eb d2                	jmp    8010a313 <deallocuvm+0x116>
+
+8010a341 <allocuvm>:
+{
+8010a341:	55                   	push   %ebp
+8010a342:	89 e5                	mov    %esp,%ebp
+8010a344:	57                   	push   %edi
+8010a345:	56                   	push   %esi
+8010a346:	53                   	push   %ebx
+8010a347:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+8010a34d:	8b 55 10             	mov    0x10(%ebp),%edx
+    return 0;
+8010a350:	b8 00 00 00 00       	mov    $0x0,%eax
+  if(newsz >= KERNBASE)
+8010a355:	85 d2                	test   %edx,%edx
+8010a357:	0f 88 55 01 00 00    	js     8010a4b2 <allocuvm+0x171>
+8010a35d:	89 d0                	mov    %edx,%eax
+  if(newsz < oldsz)
+8010a35f:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010a362:	0f 82 d0 00 00 00    	jb     8010a438 <allocuvm+0xf7>
+  a = PGROUNDUP(oldsz);
+8010a368:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010a36b:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+8010a371:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+8010a377:	89 cf                	mov    %ecx,%edi
+  while(a < newsz){
+8010a379:	39 d1                	cmp    %edx,%ecx
+8010a37b:	0f 83 31 01 00 00    	jae    8010a4b2 <allocuvm+0x171>
+    n = (newsz - a + PGSIZE - 1) / PGSIZE;
+8010a381:	8d b2 ff 0f 00 00    	lea    0xfff(%edx),%esi
+8010a387:	89 b5 5c ff ff ff    	mov    %esi,-0xa4(%ebp)
+    if((i = kallocn(mem, n)) < n){
+8010a38d:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+8010a393:	89 95 58 ff ff ff    	mov    %edx,-0xa8(%ebp)
+8010a399:	89 55 10             	mov    %edx,0x10(%ebp)
+    n = (newsz - a + PGSIZE - 1) / PGSIZE;
+8010a39c:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+8010a3a2:	29 f8                	sub    %edi,%eax
+8010a3a4:	c1 e8 0c             	shr    $0xc,%eax
+8010a3a7:	89 c1                	mov    %eax,%ecx
+    if(n > KBATCH)
+8010a3a9:	b8 20 00 00 00       	mov    $0x20,%eax
+8010a3ae:	39 c1                	cmp    %eax,%ecx
+8010a3b0:	89 8d 60 ff ff ff    	mov    %ecx,-0xa0(%ebp)
+8010a3b6:	0f 4e c1             	cmovle %ecx,%eax
+8010a3b9:	89 c3                	mov    %eax,%ebx
+8010a3bb:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+    if((i = kallocn(mem, n)) < n){
+8010a3c1:	83 ec 08             	sub    $0x8,%esp
+8010a3c4:	50                   	push   %eax
+8010a3c5:	56                   	push   %esi
+8010a3c6:	e8 c3 82 ff ff       	call   8010268e <kallocn>
+8010a3cb:	83 c4 10             	add    $0x10,%esp
+8010a3ce:	39 c3                	cmp    %eax,%ebx
+8010a3d0:	7f 6b                	jg     8010a43d <allocuvm+0xfc>
+    for(i = 0; i < n; i++, a += PGSIZE){
+8010a3d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010a3d7:	83 bd 60 ff ff ff 00 	cmpl   $0x0,-0xa0(%ebp)
+8010a3de:	7e 47                	jle    8010a427 <allocuvm+0xe6>
+      memset(mem[i], 0, PGSIZE);
+8010a3e0:	83 ec 04             	sub    $0x4,%esp
+8010a3e3:	68 00 10 00 00       	push   $0x1000
+8010a3e8:	6a 00                	push   $0x0
+8010a3ea:	ff 34 9e             	push   (%esi,%ebx,4)
+8010a3ed:	e8 6b d2 ff ff       	call   8010765d <memset>
+      if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem[i]), PTE_W|PTE_U) < 0){
+8010a3f2:	83 c4 08             	add    $0x8,%esp
+8010a3f5:	6a 06                	push   $0x6
+8010a3f7:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010a3fa:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a3ff:	50                   	push   %eax
+8010a400:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a405:	89 fa                	mov    %edi,%edx
+8010a407:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a40a:	e8 db f8 ff ff       	call   80109cea <mappages>
+8010a40f:	83 c4 10             	add    $0x10,%esp
+8010a412:	85 c0                	test   %eax,%eax
+8010a414:	78 5f                	js     8010a475 <allocuvm+0x134>
+    for(i = 0; i < n; i++, a += PGSIZE){
+8010a416:	83 c3 01             	add    $0x1,%ebx
+8010a419:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010a41f:	39 9d 64 ff ff ff    	cmp    %ebx,-0x9c(%ebp)
+8010a425:	7f b9                	jg     8010a3e0 <allocuvm+0x9f>
+  while(a < newsz){
+8010a427:	3b 7d 10             	cmp    0x10(%ebp),%edi
+8010a42a:	0f 82 6c ff ff ff    	jb     8010a39c <allocuvm+0x5b>
+8010a430:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+8010a436:	eb 7a                	jmp    8010a4b2 <allocuvm+0x171>
+    return oldsz;
+8010a438:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a43b:	eb 75                	jmp    8010a4b2 <allocuvm+0x171>
+      cprintf("allocuvm out of memory\n");
+8010a43d:	89 c3                	mov    %eax,%ebx
+8010a43f:	83 ec 0c             	sub    $0xc,%esp
+8010a442:	68 7b bc 10 80       	push   $0x8010bc7b
+8010a447:	e8 b8 61 ff ff       	call   80100604 <cprintf>
+      kfreen(mem, i);
+8010a44c:	83 c4 08             	add    $0x8,%esp
+8010a44f:	53                   	push   %ebx
+8010a450:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+8010a456:	50                   	push   %eax
+8010a457:	e8 2e 80 ff ff       	call   8010248a <kfreen>
+      deallocuvm(pgdir, a, oldsz);
+8010a45c:	83 c4 0c             	add    $0xc,%esp
+8010a45f:	ff 75 0c             	push   0xc(%ebp)
+8010a462:	57                   	push   %edi
+8010a463:	ff 75 08             	push   0x8(%ebp)
+8010a466:	e8 92 fd ff ff       	call   8010a1fd <deallocuvm>
+      return 0;
+8010a46b:	83 c4 10             	add    $0x10,%esp
+8010a46e:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a473:	eb 3d                	jmp    8010a4b2 <allocuvm+0x171>
+        cprintf("allocuvm out of memory (2)\n");
+8010a475:	83 ec 0c             	sub    $0xc,%esp
+8010a478:	68 93 bc 10 80       	push   $0x8010bc93
+8010a47d:	e8 82 61 ff ff       	call   80100604 <cprintf>
+        kfreen(mem + i, n - i);
+8010a482:	83 c4 08             	add    $0x8,%esp
+8010a485:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+8010a48b:	29 d8                	sub    %ebx,%eax
+8010a48d:	50                   	push   %eax
+8010a48e:	8d 84 9d 68 ff ff ff 	lea    -0x98(%ebp,%ebx,4),%eax
+8010a495:	50                   	push   %eax
+8010a496:	e8 ef 7f ff ff       	call   8010248a <kfreen>
+        deallocuvm(pgdir, a, oldsz);
+8010a49b:	83 c4 0c             	add    $0xc,%esp
+8010a49e:	ff 75 0c             	push   0xc(%ebp)
+8010a4a1:	57                   	push   %edi
+8010a4a2:	ff 75 08             	push   0x8(%ebp)
+8010a4a5:	e8 53 fd ff ff       	call   8010a1fd <deallocuvm>
+        return 0;
+8010a4aa:	83 c4 10             	add    $0x10,%esp
+8010a4ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a4b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a4b5:	5b                   	pop    %ebx
+8010a4b6:	5e                   	pop    %esi
+8010a4b7:	5f                   	pop    %edi
+8010a4b8:	5d                   	pop    %ebp
+8010a4b9:	c3                   	ret
+
+8010a4ba <allochuge>:
+{
+8010a4ba:	55                   	push   %ebp
+8010a4bb:	89 e5                	mov    %esp,%ebp
+8010a4bd:	57                   	push   %edi
+8010a4be:	56                   	push   %esi
+8010a4bf:	53                   	push   %ebx
+8010a4c0:	83 ec 1c             	sub    $0x1c,%esp
+8010a4c3:	8b 55 10             	mov    0x10(%ebp),%edx
+  if(newsz >= KERNBASE || newsz % HUGEPGSIZE)
+8010a4c6:	85 d2                	test   %edx,%edx
+8010a4c8:	0f 88 ca 00 00 00    	js     8010a598 <allochuge+0xde>
+8010a4ce:	89 d3                	mov    %edx,%ebx
+8010a4d0:	f7 c2 ff ff 3f 00    	test   $0x3fffff,%edx
+8010a4d6:	0f 85 cb 00 00 00    	jne    8010a5a7 <allochuge+0xed>
+  for(a = HUGEROUNDUP(oldsz); a < newsz; a += HUGEPGSIZE){
+8010a4dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a4df:	05 ff ff 3f 00       	add    $0x3fffff,%eax
+8010a4e4:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+8010a4e9:	89 c7                	mov    %eax,%edi
+8010a4eb:	39 d0                	cmp    %edx,%eax
+8010a4ed:	0f 83 aa 00 00 00    	jae    8010a59d <allochuge+0xe3>
+8010a4f3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010a4f6:	eb 49                	jmp    8010a541 <allochuge+0x87>
+      panic("allochuge");
+8010a4f8:	83 ec 0c             	sub    $0xc,%esp
+8010a4fb:	68 af bc 10 80       	push   $0x8010bcaf
+8010a500:	e8 3d 5e ff ff       	call   80100342 <panic>
+    if((mem = kallocorder(HUGEORDER)) == 0){
+8010a505:	83 ec 0c             	sub    $0xc,%esp
+8010a508:	6a 0a                	push   $0xa
+8010a50a:	e8 51 7e ff ff       	call   80102360 <kallocorder>
+8010a50f:	89 c3                	mov    %eax,%ebx
+8010a511:	83 c4 10             	add    $0x10,%esp
+8010a514:	85 c0                	test   %eax,%eax
+8010a516:	74 64                	je     8010a57c <allochuge+0xc2>
+    memset(mem, 0, HUGEPGSIZE);
+8010a518:	83 ec 04             	sub    $0x4,%esp
+8010a51b:	68 00 00 40 00       	push   $0x400000
+8010a520:	6a 00                	push   $0x0
+8010a522:	50                   	push   %eax
+8010a523:	e8 35 d1 ff ff       	call   8010765d <memset>
+    pgdir[PDX(a)] = V2P(mem) | PTE_PS | PTE_P | PTE_W | PTE_U;
+8010a528:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+8010a52e:	80 cb 87             	or     $0x87,%bl
+8010a531:	89 1e                	mov    %ebx,(%esi)
+  for(a = HUGEROUNDUP(oldsz); a < newsz; a += HUGEPGSIZE){
+8010a533:	81 c7 00 00 40 00    	add    $0x400000,%edi
+8010a539:	83 c4 10             	add    $0x10,%esp
+8010a53c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+8010a53f:	73 52                	jae    8010a593 <allochuge+0xd9>
+    if(pgdir[PDX(a)] & PTE_PS)
+8010a541:	89 f8                	mov    %edi,%eax
+8010a543:	c1 e8 16             	shr    $0x16,%eax
+8010a546:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010a549:	8d 34 81             	lea    (%ecx,%eax,4),%esi
+8010a54c:	8b 06                	mov    (%esi),%eax
+8010a54e:	a8 80                	test   $0x80,%al
+8010a550:	75 a6                	jne    8010a4f8 <allochuge+0x3e>
+    if(pgdir[PDX(a)] & PTE_P){
+8010a552:	a8 01                	test   $0x1,%al
+8010a554:	74 af                	je     8010a505 <allochuge+0x4b>
+      kfree(P2V(PTE_ADDR(pgdir[PDX(a)])));
+8010a556:	83 ec 0c             	sub    $0xc,%esp
+8010a559:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a55e:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a563:	50                   	push   %eax
+8010a564:	e8 66 80 ff ff       	call   801025cf <kfree>
+      pgdir[PDX(a)] = 0;
+8010a569:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+      __sync_fetch_and_sub(&vmstat.pgtables, 1);
+8010a56f:	f0 83 2d 94 e3 15 80 	lock subl $0x1,0x8015e394
+8010a576:	01 
+8010a577:	83 c4 10             	add    $0x10,%esp
+8010a57a:	eb 89                	jmp    8010a505 <allochuge+0x4b>
+      deallocuvm(pgdir, newsz, oldsz);
+8010a57c:	8b 55 10             	mov    0x10(%ebp),%edx
+8010a57f:	83 ec 04             	sub    $0x4,%esp
+8010a582:	ff 75 0c             	push   0xc(%ebp)
+8010a585:	52                   	push   %edx
+8010a586:	ff 75 08             	push   0x8(%ebp)
+8010a589:	e8 6f fc ff ff       	call   8010a1fd <deallocuvm>
+      return 0;
+8010a58e:	83 c4 10             	add    $0x10,%esp
+8010a591:	eb 0a                	jmp    8010a59d <allochuge+0xe3>
+8010a593:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010a596:	eb 05                	jmp    8010a59d <allochuge+0xe3>
+    return 0;
+8010a598:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+8010a59d:	89 d8                	mov    %ebx,%eax
+8010a59f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a5a2:	5b                   	pop    %ebx
+8010a5a3:	5e                   	pop    %esi
+8010a5a4:	5f                   	pop    %edi
+8010a5a5:	5d                   	pop    %ebp
+8010a5a6:	c3                   	ret
+    return 0;
+8010a5a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010a5ac:	eb ef                	jmp    8010a59d <allochuge+0xe3>
+
+8010a5ae <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.  The kernel part belongs to kpgdir.
+void
+freevm(pde_t *pgdir)
+{
+8010a5ae:	55                   	push   %ebp
+8010a5af:	89 e5                	mov    %esp,%ebp
+8010a5b1:	57                   	push   %edi
+8010a5b2:	56                   	push   %esi
+8010a5b3:	53                   	push   %ebx
+8010a5b4:	83 ec 0c             	sub    $0xc,%esp
+8010a5b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint i;
+
+  if(pgdir == 0)
+8010a5ba:	85 ff                	test   %edi,%edi
+8010a5bc:	74 1d                	je     8010a5db <freevm+0x2d>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+8010a5be:	83 ec 04             	sub    $0x4,%esp
+8010a5c1:	6a 00                	push   $0x0
+8010a5c3:	68 00 00 00 80       	push   $0x80000000
+8010a5c8:	57                   	push   %edi
+8010a5c9:	e8 2f fc ff ff       	call   8010a1fd <deallocuvm>
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010a5ce:	89 fb                	mov    %edi,%ebx
+8010a5d0:	8d b7 00 08 00 00    	lea    0x800(%edi),%esi
+8010a5d6:	83 c4 10             	add    $0x10,%esp
+8010a5d9:	eb 14                	jmp    8010a5ef <freevm+0x41>
+    panic("freevm: no pgdir");
+8010a5db:	83 ec 0c             	sub    $0xc,%esp
+8010a5de:	68 b9 bc 10 80       	push   $0x8010bcb9
+8010a5e3:	e8 5a 5d ff ff       	call   80100342 <panic>
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010a5e8:	83 c3 04             	add    $0x4,%ebx
+8010a5eb:	39 f3                	cmp    %esi,%ebx
+8010a5ed:	74 2f                	je     8010a61e <freevm+0x70>
+    if((pgdir[i] & (PTE_P|PTE_PS)) == PTE_P){
+8010a5ef:	8b 03                	mov    (%ebx),%eax
+8010a5f1:	89 c2                	mov    %eax,%edx
+8010a5f3:	81 e2 81 00 00 00    	and    $0x81,%edx
+8010a5f9:	83 fa 01             	cmp    $0x1,%edx
+8010a5fc:	75 ea                	jne    8010a5e8 <freevm+0x3a>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+      kfree(v);
+8010a5fe:	83 ec 0c             	sub    $0xc,%esp
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010a601:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a606:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010a60b:	50                   	push   %eax
+8010a60c:	e8 be 7f ff ff       	call   801025cf <kfree>
+      __sync_fetch_and_sub(&vmstat.pgtables, 1);
+8010a611:	f0 83 2d 94 e3 15 80 	lock subl $0x1,0x8015e394
+8010a618:	01 
+8010a619:	83 c4 10             	add    $0x10,%esp
+8010a61c:	eb ca                	jmp    8010a5e8 <freevm+0x3a>
+    }
+  }
+  kfree((char*)pgdir);
+8010a61e:	83 ec 0c             	sub    $0xc,%esp
+8010a621:	57                   	push   %edi
+8010a622:	e8 a8 7f ff ff       	call   801025cf <kfree>
+  __sync_fetch_and_sub(&vmstat.pgtables, 1);
+8010a627:	f0 83 2d 94 e3 15 80 	lock subl $0x1,0x8015e394
+8010a62e:	01 
+}
+8010a62f:	83 c4 10             	add    $0x10,%esp
+8010a632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a635:	5b                   	pop    %ebx
+8010a636:	5e                   	pop    %esi
+8010a637:	5f                   	pop    %edi
+8010a638:	5d                   	pop    %ebp
+8010a639:	c3                   	ret
+
+8010a63a <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010a63a:	55                   	push   %ebp
+8010a63b:	89 e5                	mov    %esp,%ebp
+8010a63d:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010a640:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a645:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a648:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a64b:	e8 13 f6 ff ff       	call   80109c63 <walkpgdir>
+  if(pte == 0)
+8010a650:	85 c0                	test   %eax,%eax
+8010a652:	74 05                	je     8010a659 <clearpteu+0x1f>
+    panic("clearpteu");
+  *pte &= ~PTE_U;
+8010a654:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010a657:	c9                   	leave
+8010a658:	c3                   	ret
+    panic("clearpteu");
+8010a659:	83 ec 0c             	sub    $0xc,%esp
+8010a65c:	68 ca bc 10 80       	push   $0x8010bcca
+8010a661:	e8 dc 5c ff ff       	call   80100342 <panic>
+
+8010a666 <copyuvm>:
+// pages become read-only and copy-on-write in both, to be
+// copied by cowcopy() when one of them writes.  4MB pages
+// are the exception, and are copied outright.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010a666:	55                   	push   %ebp
+8010a667:	89 e5                	mov    %esp,%ebp
+8010a669:	57                   	push   %edi
+8010a66a:	56                   	push   %esi
+8010a66b:	53                   	push   %ebx
+8010a66c:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+8010a66f:	e8 fe f7 ff ff       	call   80109e72 <setupkvm>
+8010a674:	89 c2                	mov    %eax,%edx
+8010a676:	85 c0                	test   %eax,%eax
+8010a678:	0f 84 1b 01 00 00    	je     8010a799 <copyuvm+0x133>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010a67e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010a682:	0f 84 11 01 00 00    	je     8010a799 <copyuvm+0x133>
+8010a688:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010a68d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a690:	eb 7e                	jmp    8010a710 <copyuvm+0xaa>
+      d[PDX(i)] = V2P(mem) | PTE_FLAGS(pgdir[PDX(i)]);
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    // Heap pages not touched yet stay that way in the child.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+8010a692:	89 df                	mov    %ebx,%edi
+8010a694:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a699:	89 da                	mov    %ebx,%edx
+8010a69b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a69e:	e8 c0 f5 ff ff       	call   80109c63 <walkpgdir>
+8010a6a3:	85 c0                	test   %eax,%eax
+8010a6a5:	0f 84 ca 00 00 00    	je     8010a775 <copyuvm+0x10f>
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(!(*pte & PTE_P))
+8010a6ab:	8b 10                	mov    (%eax),%edx
+8010a6ad:	f6 c2 01             	test   $0x1,%dl
+8010a6b0:	74 53                	je     8010a705 <copyuvm+0x9f>
+      continue;
+    if(*pte & PTE_W){
+8010a6b2:	f6 c2 02             	test   $0x2,%dl
+8010a6b5:	74 0e                	je     8010a6c5 <copyuvm+0x5f>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010a6b7:	81 e2 fd fd ff ff    	and    $0xfffffdfd,%edx
+8010a6bd:	80 ce 02             	or     $0x2,%dh
+8010a6c0:	89 10                	mov    %edx,(%eax)
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010a6c2:	0f 01 3b             	invlpg (%ebx)
+      invlpg((void*)i);
+    }
+    pa = PTE_ADDR(*pte);
+8010a6c5:	8b 00                	mov    (%eax),%eax
+8010a6c7:	89 c6                	mov    %eax,%esi
+8010a6c9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    flags = PTE_FLAGS(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a6cf:	83 ec 08             	sub    $0x8,%esp
+    flags = PTE_FLAGS(*pte);
+8010a6d2:	25 ff 0f 00 00       	and    $0xfff,%eax
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a6d7:	50                   	push   %eax
+8010a6d8:	56                   	push   %esi
+8010a6d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a6de:	89 fa                	mov    %edi,%edx
+8010a6e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a6e3:	e8 02 f6 ff ff       	call   80109cea <mappages>
+8010a6e8:	83 c4 10             	add    $0x10,%esp
+8010a6eb:	85 c0                	test   %eax,%eax
+8010a6ed:	0f 88 92 00 00 00    	js     8010a785 <copyuvm+0x11f>
+      goto bad;
+    kref(P2V(pa));
+8010a6f3:	83 ec 0c             	sub    $0xc,%esp
+8010a6f6:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010a6fc:	56                   	push   %esi
+8010a6fd:	e8 aa 80 ff ff       	call   801027ac <kref>
+8010a702:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sz; i += PGSIZE){
+8010a705:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a70b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010a70e:	73 70                	jae    8010a780 <copyuvm+0x11a>
+    if(pgdir[PDX(i)] & PTE_PS){
+8010a710:	89 de                	mov    %ebx,%esi
+8010a712:	c1 ee 16             	shr    $0x16,%esi
+8010a715:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a718:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+8010a71b:	f6 07 80             	testb  $0x80,(%edi)
+8010a71e:	0f 84 6e ff ff ff    	je     8010a692 <copyuvm+0x2c>
+      if((mem = kallocorder(HUGEORDER)) == 0)
+8010a724:	83 ec 0c             	sub    $0xc,%esp
+8010a727:	6a 0a                	push   $0xa
+8010a729:	e8 32 7c ff ff       	call   80102360 <kallocorder>
+8010a72e:	89 c3                	mov    %eax,%ebx
+8010a730:	83 c4 10             	add    $0x10,%esp
+8010a733:	85 c0                	test   %eax,%eax
+8010a735:	74 4e                	je     8010a785 <copyuvm+0x11f>
+      memmove(mem, P2V(PTE_ADDR(pgdir[PDX(i)])), HUGEPGSIZE);
+8010a737:	83 ec 04             	sub    $0x4,%esp
+8010a73a:	68 00 00 40 00       	push   $0x400000
+8010a73f:	8b 07                	mov    (%edi),%eax
+8010a741:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a746:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a74b:	50                   	push   %eax
+8010a74c:	53                   	push   %ebx
+8010a74d:	e8 82 cf ff ff       	call   801076d4 <memmove>
+      d[PDX(i)] = V2P(mem) | PTE_FLAGS(pgdir[PDX(i)]);
+8010a752:	8b 07                	mov    (%edi),%eax
+8010a754:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010a759:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+8010a75f:	09 d8                	or     %ebx,%eax
+8010a761:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a764:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010a767:	c1 e6 16             	shl    $0x16,%esi
+8010a76a:	8d 9e 00 f0 3f 00    	lea    0x3ff000(%esi),%ebx
+      continue;
+8010a770:	83 c4 10             	add    $0x10,%esp
+8010a773:	eb 90                	jmp    8010a705 <copyuvm+0x9f>
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010a775:	c1 e6 16             	shl    $0x16,%esi
+8010a778:	8d 9e 00 f0 3f 00    	lea    0x3ff000(%esi),%ebx
+      continue;
+8010a77e:	eb 85                	jmp    8010a705 <copyuvm+0x9f>
+8010a780:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a783:	eb 14                	jmp    8010a799 <copyuvm+0x133>
+  }
+  return d;
+
+bad:
+  freevm(d);
+8010a785:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a788:	83 ec 0c             	sub    $0xc,%esp
+8010a78b:	52                   	push   %edx
+8010a78c:	e8 1d fe ff ff       	call   8010a5ae <freevm>
+  return 0;
+8010a791:	83 c4 10             	add    $0x10,%esp
+8010a794:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+8010a799:	89 d0                	mov    %edx,%eax
+8010a79b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a79e:	5b                   	pop    %ebx
+8010a79f:	5e                   	pop    %esi
+8010a7a0:	5f                   	pop    %edi
+8010a7a1:	5d                   	pop    %ebp
+8010a7a2:	c3                   	ret
+
+8010a7a3 <cowcopy>:
+// Make the copy-on-write page at va writable in pgdir, copying it
+// unless pgdir holds the last reference.  Returns -1 if va is not
+// a copy-on-write page or there is no memory for the copy.
+int
+cowcopy(pde_t *pgdir, uint va)
+{
+8010a7a3:	55                   	push   %ebp
+8010a7a4:	89 e5                	mov    %esp,%ebp
+8010a7a6:	57                   	push   %edi
+8010a7a7:	56                   	push   %esi
+8010a7a8:	53                   	push   %ebx
+8010a7a9:	83 ec 0c             	sub    $0xc,%esp
+  pte_t *pte;
+  uint pa;
+  char *mem;
+
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+8010a7ac:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010a7b0:	0f 88 b5 00 00 00    	js     8010a86b <cowcopy+0xc8>
+8010a7b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a7bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a7be:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a7c1:	e8 9d f4 ff ff       	call   80109c63 <walkpgdir>
+8010a7c6:	89 c3                	mov    %eax,%ebx
+8010a7c8:	85 c0                	test   %eax,%eax
+8010a7ca:	0f 84 a2 00 00 00    	je     8010a872 <cowcopy+0xcf>
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010a7d0:	8b 30                	mov    (%eax),%esi
+8010a7d2:	89 f0                	mov    %esi,%eax
+8010a7d4:	25 05 02 00 00       	and    $0x205,%eax
+8010a7d9:	3d 05 02 00 00       	cmp    $0x205,%eax
+8010a7de:	0f 85 95 00 00 00    	jne    8010a879 <cowcopy+0xd6>
+    return -1;
+  pa = PTE_ADDR(*pte);
+8010a7e4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if(krefs(P2V(pa)) > 1){
+8010a7ea:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010a7f0:	83 ec 0c             	sub    $0xc,%esp
+8010a7f3:	56                   	push   %esi
+8010a7f4:	e8 ec 7f ff ff       	call   801027e5 <krefs>
+8010a7f9:	83 c4 10             	add    $0x10,%esp
+8010a7fc:	83 f8 01             	cmp    $0x1,%eax
+8010a7ff:	7e 3e                	jle    8010a83f <cowcopy+0x9c>
+    if((mem = kalloc()) == 0)
+8010a801:	e8 82 7f ff ff       	call   80102788 <kalloc>
+8010a806:	89 c7                	mov    %eax,%edi
+8010a808:	85 c0                	test   %eax,%eax
+8010a80a:	74 74                	je     8010a880 <cowcopy+0xdd>
+      return -1;
+    memmove(mem, P2V(pa), PGSIZE);
+8010a80c:	83 ec 04             	sub    $0x4,%esp
+8010a80f:	68 00 10 00 00       	push   $0x1000
+8010a814:	56                   	push   %esi
+8010a815:	50                   	push   %eax
+8010a816:	e8 b9 ce ff ff       	call   801076d4 <memmove>
+    *pte = V2P(mem) | PTE_FLAGS(*pte);
+8010a81b:	8b 03                	mov    (%ebx),%eax
+8010a81d:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010a822:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+8010a828:	09 f8                	or     %edi,%eax
+8010a82a:	89 03                	mov    %eax,(%ebx)
+    kfree(P2V(pa));
+8010a82c:	89 34 24             	mov    %esi,(%esp)
+8010a82f:	e8 9b 7d ff ff       	call   801025cf <kfree>
+    __sync_fetch_and_add(&vmstat.pagecopies, 1);
+8010a834:	f0 83 05 84 e3 15 80 	lock addl $0x1,0x8015e384
+8010a83b:	01 
+8010a83c:	83 c4 10             	add    $0x10,%esp
+  }
+  *pte = (*pte | PTE_W) & ~PTE_COW;
+8010a83f:	8b 03                	mov    (%ebx),%eax
+8010a841:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010a846:	83 c8 02             	or     $0x2,%eax
+8010a849:	89 03                	mov    %eax,(%ebx)
+  invlpg((void*)PGROUNDDOWN(va));
+8010a84b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a84e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a853:	0f 01 38             	invlpg (%eax)
+  __sync_fetch_and_add(&vmstat.cowfaults, 1);
+8010a856:	f0 83 05 80 e3 15 80 	lock addl $0x1,0x8015e380
+8010a85d:	01 
+  return 0;
+8010a85e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a863:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a866:	5b                   	pop    %ebx
+8010a867:	5e                   	pop    %esi
+8010a868:	5f                   	pop    %edi
+8010a869:	5d                   	pop    %ebp
+8010a86a:	c3                   	ret
+    return -1;
+8010a86b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a870:	eb f1                	jmp    8010a863 <cowcopy+0xc0>
+8010a872:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a877:	eb ea                	jmp    8010a863 <cowcopy+0xc0>
+    return -1;
+8010a879:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a87e:	eb e3                	jmp    8010a863 <cowcopy+0xc0>
+      return -1;
+8010a880:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a885:	eb dc                	jmp    8010a863 <cowcopy+0xc0>
+
+8010a887 <fillpage>:
+// pages of the file come from the page cache and are shared
+// copy-on-write.  May sleep reading the file.  Returns -1 if va is
+// out of range or there is no memory.
+int
+fillpage(struct proc *p, uint va)
+{
+8010a887:	55                   	push   %ebp
+8010a888:	89 e5                	mov    %esp,%ebp
+8010a88a:	57                   	push   %edi
+8010a88b:	56                   	push   %esi
+8010a88c:	53                   	push   %ebx
+8010a88d:	83 ec 1c             	sub    $0x1c,%esp
+8010a890:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010a893:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct vmregion *r;
+  pte_t *pte;
+  char *mem;
+  uint n, perm;
+
+  if(va >= p->sz || va >= KERNBASE)
+8010a896:	3b 1f                	cmp    (%edi),%ebx
+8010a898:	0f 83 06 02 00 00    	jae    8010aaa4 <fillpage+0x21d>
+8010a89e:	85 db                	test   %ebx,%ebx
+8010a8a0:	0f 88 08 02 00 00    	js     8010aaae <fillpage+0x227>
+    return -1;
+  va = PGROUNDDOWN(va);
+8010a8a6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if((pte = walkpgdir(p->pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+8010a8ac:	8b 47 04             	mov    0x4(%edi),%eax
+8010a8af:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a8b4:	89 da                	mov    %ebx,%edx
+8010a8b6:	e8 a8 f3 ff ff       	call   80109c63 <walkpgdir>
+8010a8bb:	85 c0                	test   %eax,%eax
+8010a8bd:	74 0e                	je     8010a8cd <fillpage+0x46>
+    return 0;
+8010a8bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  if((pte = walkpgdir(p->pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+8010a8c4:	f6 00 01             	testb  $0x1,(%eax)
+8010a8c7:	0f 85 c2 00 00 00    	jne    8010a98f <fillpage+0x108>
+  for(r = p->region; r < &p->region[NREGION]; r++)
+8010a8cd:	8d 47 7c             	lea    0x7c(%edi),%eax
+8010a8d0:	8d 8f cc 00 00 00    	lea    0xcc(%edi),%ecx
+8010a8d6:	89 ce                	mov    %ecx,%esi
+8010a8d8:	eb 07                	jmp    8010a8e1 <fillpage+0x5a>
+8010a8da:	83 c0 14             	add    $0x14,%eax
+8010a8dd:	39 c6                	cmp    %eax,%esi
+8010a8df:	74 15                	je     8010a8f6 <fillpage+0x6f>
+    if(r->ip && va >= r->va && va < r->va + r->memsz)
+8010a8e1:	83 38 00             	cmpl   $0x0,(%eax)
+8010a8e4:	74 f4                	je     8010a8da <fillpage+0x53>
+8010a8e6:	8b 50 04             	mov    0x4(%eax),%edx
+8010a8e9:	39 d3                	cmp    %edx,%ebx
+8010a8eb:	72 ed                	jb     8010a8da <fillpage+0x53>
+8010a8ed:	03 50 0c             	add    0xc(%eax),%edx
+8010a8f0:	39 d3                	cmp    %edx,%ebx
+8010a8f2:	73 e6                	jae    8010a8da <fillpage+0x53>
+8010a8f4:	89 c6                	mov    %eax,%esi
+      break;
+  if(r == &p->region[NREGION])
+    r = 0;
+
+  if(r && va + PGSIZE <= r->va + r->filesz){
+8010a8f6:	39 f1                	cmp    %esi,%ecx
+8010a8f8:	74 1c                	je     8010a916 <fillpage+0x8f>
+8010a8fa:	8b 46 08             	mov    0x8(%esi),%eax
+8010a8fd:	03 46 04             	add    0x4(%esi),%eax
+8010a900:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+8010a906:	39 d0                	cmp    %edx,%eax
+8010a908:	0f 83 8b 00 00 00    	jae    8010a999 <fillpage+0x112>
+    mem = pcget(r->ip, r->off + (va - r->va));
+    iunlock(r->ip);
+    if(mem == 0)
+      return -1;
+    perm = PTE_COW|PTE_U;
+  } else if(r && va < r->va + r->filesz){
+8010a90e:	39 c3                	cmp    %eax,%ebx
+8010a910:	0f 82 c4 00 00 00    	jb     8010a9da <fillpage+0x153>
+    }
+    iunlock(r->ip);
+    __sync_fetch_and_add(&vmstat.filefaults, 1);
+    perm = PTE_W|PTE_U;
+  } else {
+    if((mem = kalloc()) == 0)
+8010a916:	e8 6d 7e ff ff       	call   80102788 <kalloc>
+8010a91b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a91e:	85 c0                	test   %eax,%eax
+8010a920:	0f 84 a6 01 00 00    	je     8010aacc <fillpage+0x245>
+      return -1;
+    memset(mem, 0, PGSIZE);
+8010a926:	83 ec 04             	sub    $0x4,%esp
+8010a929:	68 00 10 00 00       	push   $0x1000
+8010a92e:	6a 00                	push   $0x0
+8010a930:	50                   	push   %eax
+8010a931:	e8 27 cd ff ff       	call   8010765d <memset>
+    __sync_fetch_and_add(&vmstat.lazyfaults, 1);
+8010a936:	f0 83 05 88 e3 15 80 	lock addl $0x1,0x8015e388
+8010a93d:	01 
+8010a93e:	83 c4 10             	add    $0x10,%esp
+    perm = PTE_W|PTE_U;
+8010a941:	be 06 00 00 00       	mov    $0x6,%esi
+  }
+  // Another thread of control may have filled it while we slept.
+  if((pte = walkpgdir(p->pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P)){
+8010a946:	8b 47 04             	mov    0x4(%edi),%eax
+8010a949:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a94e:	89 da                	mov    %ebx,%edx
+8010a950:	e8 0e f3 ff ff       	call   80109c63 <walkpgdir>
+8010a955:	85 c0                	test   %eax,%eax
+8010a957:	74 09                	je     8010a962 <fillpage+0xdb>
+8010a959:	f6 00 01             	testb  $0x1,(%eax)
+8010a95c:	0f 85 12 01 00 00    	jne    8010aa74 <fillpage+0x1ed>
+    kfree(mem);
+    return 0;
+  }
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+8010a962:	8b 47 04             	mov    0x4(%edi),%eax
+8010a965:	83 ec 08             	sub    $0x8,%esp
+8010a968:	56                   	push   %esi
+8010a969:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a96c:	8d 91 00 00 00 80    	lea    -0x80000000(%ecx),%edx
+8010a972:	52                   	push   %edx
+8010a973:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a978:	89 da                	mov    %ebx,%edx
+8010a97a:	e8 6b f3 ff ff       	call   80109cea <mappages>
+8010a97f:	83 c4 10             	add    $0x10,%esp
+8010a982:	85 c0                	test   %eax,%eax
+8010a984:	0f 88 02 01 00 00    	js     8010aa8c <fillpage+0x205>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010a98a:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+8010a98f:	89 d0                	mov    %edx,%eax
+8010a991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a994:	5b                   	pop    %ebx
+8010a995:	5e                   	pop    %esi
+8010a996:	5f                   	pop    %edi
+8010a997:	5d                   	pop    %ebp
+8010a998:	c3                   	ret
+    ilock(r->ip);
+8010a999:	83 ec 0c             	sub    $0xc,%esp
+8010a99c:	ff 36                	push   (%esi)
+8010a99e:	e8 85 6c ff ff       	call   80101628 <ilock>
+    mem = pcget(r->ip, r->off + (va - r->va));
+8010a9a3:	83 c4 08             	add    $0x8,%esp
+8010a9a6:	89 d8                	mov    %ebx,%eax
+8010a9a8:	03 46 10             	add    0x10(%esi),%eax
+8010a9ab:	2b 46 04             	sub    0x4(%esi),%eax
+8010a9ae:	50                   	push   %eax
+8010a9af:	ff 36                	push   (%esi)
+8010a9b1:	e8 c5 8b ff ff       	call   8010357b <pcget>
+8010a9b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    iunlock(r->ip);
+8010a9b9:	83 c4 04             	add    $0x4,%esp
+8010a9bc:	ff 36                	push   (%esi)
+8010a9be:	e8 27 6d ff ff       	call   801016ea <iunlock>
+    if(mem == 0)
+8010a9c3:	83 c4 10             	add    $0x10,%esp
+8010a9c6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+8010a9ca:	0f 84 e8 00 00 00    	je     8010aab8 <fillpage+0x231>
+    perm = PTE_COW|PTE_U;
+8010a9d0:	be 04 02 00 00       	mov    $0x204,%esi
+8010a9d5:	e9 6c ff ff ff       	jmp    8010a946 <fillpage+0xbf>
+    if((mem = kalloc()) == 0)
+8010a9da:	e8 a9 7d ff ff       	call   80102788 <kalloc>
+8010a9df:	85 c0                	test   %eax,%eax
+8010a9e1:	0f 84 db 00 00 00    	je     8010aac2 <fillpage+0x23b>
+    memset(mem, 0, PGSIZE);
+8010a9e7:	83 ec 04             	sub    $0x4,%esp
+8010a9ea:	68 00 10 00 00       	push   $0x1000
+8010a9ef:	6a 00                	push   $0x0
+8010a9f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a9f4:	50                   	push   %eax
+8010a9f5:	e8 63 cc ff ff       	call   8010765d <memset>
+    n = r->va + r->filesz - va;
+8010a9fa:	8b 46 08             	mov    0x8(%esi),%eax
+8010a9fd:	03 46 04             	add    0x4(%esi),%eax
+8010aa00:	89 c1                	mov    %eax,%ecx
+8010aa02:	29 d9                	sub    %ebx,%ecx
+8010aa04:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    ilock(r->ip);
+8010aa07:	83 c4 04             	add    $0x4,%esp
+8010aa0a:	ff 36                	push   (%esi)
+8010aa0c:	e8 17 6c ff ff       	call   80101628 <ilock>
+    if(readi(r->ip, mem, r->off + (va - r->va), n) != n){
+8010aa11:	ff 75 e0             	push   -0x20(%ebp)
+8010aa14:	89 da                	mov    %ebx,%edx
+8010aa16:	03 56 10             	add    0x10(%esi),%edx
+8010aa19:	89 d0                	mov    %edx,%eax
+8010aa1b:	2b 46 04             	sub    0x4(%esi),%eax
+8010aa1e:	50                   	push   %eax
+8010aa1f:	ff 75 e4             	push   -0x1c(%ebp)
+8010aa22:	ff 36                	push   (%esi)
+8010aa24:	e8 04 6f ff ff       	call   8010192d <readi>
+8010aa29:	83 c4 20             	add    $0x20,%esp
+8010aa2c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010aa2f:	39 c8                	cmp    %ecx,%eax
+8010aa31:	75 1f                	jne    8010aa52 <fillpage+0x1cb>
+    iunlock(r->ip);
+8010aa33:	83 ec 0c             	sub    $0xc,%esp
+8010aa36:	ff 36                	push   (%esi)
+8010aa38:	e8 ad 6c ff ff       	call   801016ea <iunlock>
+    __sync_fetch_and_add(&vmstat.filefaults, 1);
+8010aa3d:	f0 83 05 8c e3 15 80 	lock addl $0x1,0x8015e38c
+8010aa44:	01 
+    perm = PTE_W|PTE_U;
+8010aa45:	83 c4 10             	add    $0x10,%esp
+8010aa48:	be 06 00 00 00       	mov    $0x6,%esi
+8010aa4d:	e9 f4 fe ff ff       	jmp    8010a946 <fillpage+0xbf>
+      iunlock(r->ip);
+8010aa52:	83 ec 0c             	sub    $0xc,%esp
+8010aa55:	ff 36                	push   (%esi)
+8010aa57:	e8 8e 6c ff ff       	call   801016ea <iunlock>
+      kfree(mem);
+8010aa5c:	83 c4 04             	add    $0x4,%esp
+8010aa5f:	ff 75 e4             	push   -0x1c(%ebp)
+8010aa62:	e8 68 7b ff ff       	call   801025cf <kfree>
+      return -1;
+8010aa67:	83 c4 10             	add    $0x10,%esp
+8010aa6a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aa6f:	e9 1b ff ff ff       	jmp    8010a98f <fillpage+0x108>
+    kfree(mem);
+8010aa74:	83 ec 0c             	sub    $0xc,%esp
+8010aa77:	ff 75 e4             	push   -0x1c(%ebp)
+8010aa7a:	e8 50 7b ff ff       	call   801025cf <kfree>
+    return 0;
+8010aa7f:	83 c4 10             	add    $0x10,%esp
+8010aa82:	ba 00 00 00 00       	mov    $0x0,%edx
+8010aa87:	e9 03 ff ff ff       	jmp    8010a98f <fillpage+0x108>
+    kfree(mem);
+8010aa8c:	83 ec 0c             	sub    $0xc,%esp
+8010aa8f:	ff 75 e4             	push   -0x1c(%ebp)
+8010aa92:	e8 38 7b ff ff       	call   801025cf <kfree>
+    return -1;
+8010aa97:	83 c4 10             	add    $0x10,%esp
+8010aa9a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aa9f:	e9 eb fe ff ff       	jmp    8010a98f <fillpage+0x108>
+    return -1;
+8010aaa4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aaa9:	e9 e1 fe ff ff       	jmp    8010a98f <fillpage+0x108>
+8010aaae:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aab3:	e9 d7 fe ff ff       	jmp    8010a98f <fillpage+0x108>
+      return -1;
+8010aab8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aabd:	e9 cd fe ff ff       	jmp    8010a98f <fillpage+0x108>
+      return -1;
+8010aac2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aac7:	e9 c3 fe ff ff       	jmp    8010a98f <fillpage+0x108>
+      return -1;
+8010aacc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010aad1:	e9 b9 fe ff ff       	jmp    8010a98f <fillpage+0x108>
+
+8010aad6 <uvmtouch>:
+// pages nothing has touched yet.  If write is set, also break any
+// copy-on-write sharing, so that kernel writes there cannot fault:
+// a fault then, perhaps holding a spinlock, could not fail cleanly.
+int
+uvmtouch(struct proc *p, uint va, uint len, int write)
+{
+8010aad6:	55                   	push   %ebp
+8010aad7:	89 e5                	mov    %esp,%ebp
+8010aad9:	57                   	push   %edi
+8010aada:	56                   	push   %esi
+8010aadb:	53                   	push   %ebx
+8010aadc:	83 ec 1c             	sub    $0x1c,%esp
+8010aadf:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010aae2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010aae5:	89 d3                	mov    %edx,%ebx
+8010aae7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010aaed:	03 55 10             	add    0x10(%ebp),%edx
+8010aaf0:	39 d3                	cmp    %edx,%ebx
+8010aaf2:	73 68                	jae    8010ab5c <uvmtouch+0x86>
+8010aaf4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010aaf7:	eb 12                	jmp    8010ab0b <uvmtouch+0x35>
+    if(!write)
+      continue;
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+    if((*pte & PTE_COW) && cowcopy(p->pgdir, a) < 0)
+      return -1;
+    if(!(*pte & PTE_W))
+8010aaf9:	f6 06 02             	testb  $0x2,(%esi)
+8010aafc:	74 72                	je     8010ab70 <uvmtouch+0x9a>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010aafe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ab04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010ab07:	39 c3                	cmp    %eax,%ebx
+8010ab09:	73 4a                	jae    8010ab55 <uvmtouch+0x7f>
+    if(fillpage(p, a) < 0)
+8010ab0b:	83 ec 08             	sub    $0x8,%esp
+8010ab0e:	53                   	push   %ebx
+8010ab0f:	57                   	push   %edi
+8010ab10:	e8 72 fd ff ff       	call   8010a887 <fillpage>
+8010ab15:	83 c4 10             	add    $0x10,%esp
+8010ab18:	85 c0                	test   %eax,%eax
+8010ab1a:	78 47                	js     8010ab63 <uvmtouch+0x8d>
+    if(!write)
+8010ab1c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010ab20:	74 dc                	je     8010aafe <uvmtouch+0x28>
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+8010ab22:	8b 47 04             	mov    0x4(%edi),%eax
+8010ab25:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ab2a:	89 da                	mov    %ebx,%edx
+8010ab2c:	e8 32 f1 ff ff       	call   80109c63 <walkpgdir>
+8010ab31:	89 c6                	mov    %eax,%esi
+    if((*pte & PTE_COW) && cowcopy(p->pgdir, a) < 0)
+8010ab33:	f7 00 00 02 00 00    	testl  $0x200,(%eax)
+8010ab39:	74 be                	je     8010aaf9 <uvmtouch+0x23>
+8010ab3b:	83 ec 08             	sub    $0x8,%esp
+8010ab3e:	53                   	push   %ebx
+8010ab3f:	ff 77 04             	push   0x4(%edi)
+8010ab42:	e8 5c fc ff ff       	call   8010a7a3 <cowcopy>
+8010ab47:	83 c4 10             	add    $0x10,%esp
+8010ab4a:	85 c0                	test   %eax,%eax
+8010ab4c:	79 ab                	jns    8010aaf9 <uvmtouch+0x23>
+      return -1;
+8010ab4e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab53:	eb 13                	jmp    8010ab68 <uvmtouch+0x92>
+      return -1;
+  }
+  return 0;
+8010ab55:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ab5a:	eb 0c                	jmp    8010ab68 <uvmtouch+0x92>
+8010ab5c:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ab61:	eb 05                	jmp    8010ab68 <uvmtouch+0x92>
+      return -1;
+8010ab63:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ab68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ab6b:	5b                   	pop    %ebx
+8010ab6c:	5e                   	pop    %esi
+8010ab6d:	5f                   	pop    %edi
+8010ab6e:	5d                   	pop    %ebp
+8010ab6f:	c3                   	ret
+      return -1;
+8010ab70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab75:	eb f1                	jmp    8010ab68 <uvmtouch+0x92>
+
+8010ab77 <pagefault>:
+
+// Handle a page fault at va in process p; err is the fault's error
+// code.  Returns 0 if the access can be retried.
+int
+pagefault(struct proc *p, uint va, uint err)
+{
+8010ab77:	55                   	push   %ebp
+8010ab78:	89 e5                	mov    %esp,%ebp
+8010ab7a:	83 ec 08             	sub    $0x8,%esp
+8010ab7d:	8b 55 10             	mov    0x10(%ebp),%edx
+  if(err & FEC_PR)
+8010ab80:	f6 c2 01             	test   $0x1,%dl
+8010ab83:	74 20                	je     8010aba5 <pagefault+0x2e>
+    return (err & FEC_WR) ? cowcopy(p->pgdir, va) : -1;
+8010ab85:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ab8a:	f6 c2 02             	test   $0x2,%dl
+8010ab8d:	74 27                	je     8010abb6 <pagefault+0x3f>
+8010ab8f:	83 ec 08             	sub    $0x8,%esp
+8010ab92:	ff 75 0c             	push   0xc(%ebp)
+8010ab95:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ab98:	ff 70 04             	push   0x4(%eax)
+8010ab9b:	e8 03 fc ff ff       	call   8010a7a3 <cowcopy>
+8010aba0:	83 c4 10             	add    $0x10,%esp
+8010aba3:	eb 11                	jmp    8010abb6 <pagefault+0x3f>
+  return fillpage(p, va);
+8010aba5:	83 ec 08             	sub    $0x8,%esp
+8010aba8:	ff 75 0c             	push   0xc(%ebp)
+8010abab:	ff 75 08             	push   0x8(%ebp)
+8010abae:	e8 d4 fc ff ff       	call   8010a887 <fillpage>
+8010abb3:	83 c4 10             	add    $0x10,%esp
+}
+8010abb6:	c9                   	leave
+8010abb7:	c3                   	ret
+
+8010abb8 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010abb8:	55                   	push   %ebp
+8010abb9:	89 e5                	mov    %esp,%ebp
+8010abbb:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010abbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010abc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010abc6:	8b 45 08             	mov    0x8(%ebp),%eax
+8010abc9:	e8 95 f0 ff ff       	call   80109c63 <walkpgdir>
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010abce:	85 c0                	test   %eax,%eax
+8010abd0:	74 22                	je     8010abf4 <uva2ka+0x3c>
+8010abd2:	8b 10                	mov    (%eax),%edx
+    return 0;
+  if((*pte & PTE_U) == 0)
+8010abd4:	89 d1                	mov    %edx,%ecx
+8010abd6:	83 e1 05             	and    $0x5,%ecx
+    return 0;
+8010abd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  if((*pte & PTE_U) == 0)
+8010abde:	83 f9 05             	cmp    $0x5,%ecx
+8010abe1:	75 11                	jne    8010abf4 <uva2ka+0x3c>
+  if(*pte & PTE_PS)
+    return (char*)P2V(PTE_ADDR(*pte)) + PGROUNDDOWN((uint)uva) % HUGEPGSIZE;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010abe3:	89 d0                	mov    %edx,%eax
+8010abe5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010abea:	05 00 00 00 80       	add    $0x80000000,%eax
+  if(*pte & PTE_PS)
+8010abef:	f6 c2 80             	test   $0x80,%dl
+8010abf2:	75 02                	jne    8010abf6 <uva2ka+0x3e>
+}
+8010abf4:	c9                   	leave
+8010abf5:	c3                   	ret
+    return (char*)P2V(PTE_ADDR(*pte)) + PGROUNDDOWN((uint)uva) % HUGEPGSIZE;
+8010abf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010abf9:	25 00 f0 3f 00       	and    $0x3ff000,%eax
+8010abfe:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010ac04:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+8010ac0b:	eb e7                	jmp    8010abf4 <uva2ka+0x3c>
+
+8010ac0d <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010ac0d:	55                   	push   %ebp
+8010ac0e:	89 e5                	mov    %esp,%ebp
+8010ac10:	57                   	push   %edi
+8010ac11:	56                   	push   %esi
+8010ac12:	53                   	push   %ebx
+8010ac13:	83 ec 0c             	sub    $0xc,%esp
+8010ac16:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010ac19:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010ac1d:	75 63                	jne    8010ac82 <copyout+0x75>
+    memmove(pa0 + (va - va0), buf, n);
+    len -= n;
+    buf += n;
+    va = va0 + PGSIZE;
+  }
+  return 0;
+8010ac1f:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ac24:	e9 02 01 00 00       	jmp    8010ad2b <copyout+0x11e>
+    if(pte && (*pte & PTE_COW) && cowcopy(pgdir, va0) < 0)
+8010ac29:	8b 03                	mov    (%ebx),%eax
+8010ac2b:	f6 c4 02             	test   $0x2,%ah
+8010ac2e:	0f 85 c6 00 00 00    	jne    8010acfa <copyout+0xed>
+    pa0 = uva2ka(pgdir, (char*)va0);
+8010ac34:	83 ec 08             	sub    $0x8,%esp
+8010ac37:	56                   	push   %esi
+8010ac38:	ff 75 08             	push   0x8(%ebp)
+8010ac3b:	e8 78 ff ff ff       	call   8010abb8 <uva2ka>
+    if(pa0 == 0)
+8010ac40:	83 c4 10             	add    $0x10,%esp
+8010ac43:	85 c0                	test   %eax,%eax
+8010ac45:	0f 84 db 00 00 00    	je     8010ad26 <copyout+0x119>
+    n = PGSIZE - (va - va0);
+8010ac4b:	89 f3                	mov    %esi,%ebx
+8010ac4d:	29 fb                	sub    %edi,%ebx
+8010ac4f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ac55:	3b 5d 14             	cmp    0x14(%ebp),%ebx
+8010ac58:	0f 47 5d 14          	cmova  0x14(%ebp),%ebx
+    memmove(pa0 + (va - va0), buf, n);
+8010ac5c:	83 ec 04             	sub    $0x4,%esp
+8010ac5f:	53                   	push   %ebx
+8010ac60:	ff 75 10             	push   0x10(%ebp)
+8010ac63:	29 f7                	sub    %esi,%edi
+8010ac65:	01 f8                	add    %edi,%eax
+8010ac67:	50                   	push   %eax
+8010ac68:	e8 67 ca ff ff       	call   801076d4 <memmove>
+    buf += n;
+8010ac6d:	01 5d 10             	add    %ebx,0x10(%ebp)
+    va = va0 + PGSIZE;
+8010ac70:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+  while(len > 0){
+8010ac76:	83 c4 10             	add    $0x10,%esp
+8010ac79:	29 5d 14             	sub    %ebx,0x14(%ebp)
+8010ac7c:	0f 84 96 00 00 00    	je     8010ad18 <copyout+0x10b>
+    va0 = (uint)PGROUNDDOWN(va);
+8010ac82:	89 fe                	mov    %edi,%esi
+8010ac84:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+8010ac8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ac8f:	89 f2                	mov    %esi,%edx
+8010ac91:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac94:	e8 ca ef ff ff       	call   80109c63 <walkpgdir>
+8010ac99:	89 c3                	mov    %eax,%ebx
+    if((pte == 0 || !(*pte & PTE_P)) && myproc() && pgdir == myproc()->pgdir){
+8010ac9b:	85 c0                	test   %eax,%eax
+8010ac9d:	0f 84 90 00 00 00    	je     8010ad33 <copyout+0x126>
+8010aca3:	f6 00 01             	testb  $0x1,(%eax)
+8010aca6:	75 81                	jne    8010ac29 <copyout+0x1c>
+8010aca8:	e8 0b 9b ff ff       	call   801047b8 <myproc>
+8010acad:	85 c0                	test   %eax,%eax
+8010acaf:	0f 84 74 ff ff ff    	je     8010ac29 <copyout+0x1c>
+8010acb5:	e8 fe 9a ff ff       	call   801047b8 <myproc>
+8010acba:	8b 40 04             	mov    0x4(%eax),%eax
+8010acbd:	39 45 08             	cmp    %eax,0x8(%ebp)
+8010acc0:	0f 85 63 ff ff ff    	jne    8010ac29 <copyout+0x1c>
+      if(fillpage(myproc(), va0) < 0)
+8010acc6:	e8 ed 9a ff ff       	call   801047b8 <myproc>
+8010accb:	83 ec 08             	sub    $0x8,%esp
+8010acce:	56                   	push   %esi
+8010accf:	50                   	push   %eax
+8010acd0:	e8 b2 fb ff ff       	call   8010a887 <fillpage>
+8010acd5:	83 c4 10             	add    $0x10,%esp
+8010acd8:	85 c0                	test   %eax,%eax
+8010acda:	78 43                	js     8010ad1f <copyout+0x112>
+      pte = walkpgdir(pgdir, (char*)va0, 0);
+8010acdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ace1:	89 f2                	mov    %esi,%edx
+8010ace3:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ace6:	e8 78 ef ff ff       	call   80109c63 <walkpgdir>
+8010aceb:	89 c3                	mov    %eax,%ebx
+    if(pte && (*pte & PTE_COW) && cowcopy(pgdir, va0) < 0)
+8010aced:	85 c0                	test   %eax,%eax
+8010acef:	0f 85 34 ff ff ff    	jne    8010ac29 <copyout+0x1c>
+8010acf5:	e9 3a ff ff ff       	jmp    8010ac34 <copyout+0x27>
+8010acfa:	83 ec 08             	sub    $0x8,%esp
+8010acfd:	56                   	push   %esi
+8010acfe:	ff 75 08             	push   0x8(%ebp)
+8010ad01:	e8 9d fa ff ff       	call   8010a7a3 <cowcopy>
+8010ad06:	83 c4 10             	add    $0x10,%esp
+8010ad09:	85 c0                	test   %eax,%eax
+8010ad0b:	0f 89 23 ff ff ff    	jns    8010ac34 <copyout+0x27>
+      return -1;
+8010ad11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ad16:	eb 13                	jmp    8010ad2b <copyout+0x11e>
+  return 0;
+8010ad18:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ad1d:	eb 0c                	jmp    8010ad2b <copyout+0x11e>
+        return -1;
+8010ad1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ad24:	eb 05                	jmp    8010ad2b <copyout+0x11e>
+      return -1;
+8010ad26:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ad2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ad2e:	5b                   	pop    %ebx
+8010ad2f:	5e                   	pop    %esi
+8010ad30:	5f                   	pop    %edi
+8010ad31:	5d                   	pop    %ebp
+8010ad32:	c3                   	ret
+    if((pte == 0 || !(*pte & PTE_P)) && myproc() && pgdir == myproc()->pgdir){
+8010ad33:	e8 80 9a ff ff       	call   801047b8 <myproc>
+8010ad38:	85 c0                	test   %eax,%eax
+8010ad3a:	0f 84 f4 fe ff ff    	je     8010ac34 <copyout+0x27>
+8010ad40:	e8 73 9a ff ff       	call   801047b8 <myproc>
+8010ad45:	8b 40 04             	mov    0x4(%eax),%eax
+8010ad48:	39 45 08             	cmp    %eax,0x8(%ebp)
+8010ad4b:	0f 85 e3 fe ff ff    	jne    8010ac34 <copyout+0x27>
+8010ad51:	e9 70 ff ff ff       	jmp    8010acc6 <copyout+0xb9>
@@ -0,0 +1,1243 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "pdx.h"
+#endif // PDX_XV6
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+
+  if(argc < 2){
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+  19:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 22                	jle    45 <main+0x45>
+    kill(atoi(argv[i]));
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	ff 34 9f             	push   (%edi,%ebx,4)
+  29:	e8 81 01 00 00       	call   1af <atoi>
+  2e:	89 04 24             	mov    %eax,(%esp)
+  31:	e8 b6 02 00 00       	call   2ec <kill>
+  for(i=1; i<argc; i++)
+  36:	83 c3 01             	add    $0x1,%ebx
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	39 de                	cmp    %ebx,%esi
+  3e:	75 e3                	jne    23 <main+0x23>
+  exit();
+  40:	e8 77 02 00 00       	call   2bc <exit>
+    printf(2, "usage: kill pid...\n");
+  45:	83 ec 08             	sub    $0x8,%esp
+  48:	68 8c 07 00 00       	push   $0x78c
+  4d:	6a 02                	push   $0x2
+  4f:	e8 40 04 00 00       	call   494 <printf>
+    exit();
+  54:	e8 63 02 00 00       	call   2bc <exit>
+
+00000059 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  59:	55                   	push   %ebp
+  5a:	89 e5                	mov    %esp,%ebp
+  5c:	53                   	push   %ebx
+  5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  63:	b8 00 00 00 00       	mov    $0x0,%eax
+  68:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  6c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  6f:	83 c0 01             	add    $0x1,%eax
+  72:	84 d2                	test   %dl,%dl
+  74:	75 f2                	jne    68 <strcpy+0xf>
+    ;
+  return os;
+}
+  76:	89 c8                	mov    %ecx,%eax
+  78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  7b:	c9                   	leave
+  7c:	c3                   	ret
+
+0000007d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  7d:	55                   	push   %ebp
+  7e:	89 e5                	mov    %esp,%ebp
+  80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  86:	0f b6 01             	movzbl (%ecx),%eax
+  89:	84 c0                	test   %al,%al
+  8b:	74 11                	je     9e <strcmp+0x21>
+  8d:	38 02                	cmp    %al,(%edx)
+  8f:	75 0d                	jne    9e <strcmp+0x21>
+    p++, q++;
+  91:	83 c1 01             	add    $0x1,%ecx
+  94:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  97:	0f b6 01             	movzbl (%ecx),%eax
+  9a:	84 c0                	test   %al,%al
+  9c:	75 ef                	jne    8d <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  9e:	0f b6 c0             	movzbl %al,%eax
+  a1:	0f b6 12             	movzbl (%edx),%edx
+  a4:	29 d0                	sub    %edx,%eax
+}
+  a6:	5d                   	pop    %ebp
+  a7:	c3                   	ret
+
+000000a8 <strlen>:
+
+uint
+strlen(char *s)
+{
+  a8:	55                   	push   %ebp
+  a9:	89 e5                	mov    %esp,%ebp
+  ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ae:	80 3a 00             	cmpb   $0x0,(%edx)
+  b1:	74 14                	je     c7 <strlen+0x1f>
+  b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  b8:	83 c0 01             	add    $0x1,%eax
+  bb:	89 c1                	mov    %eax,%ecx
+  bd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  c1:	75 f5                	jne    b8 <strlen+0x10>
+    ;
+  return n;
+}
+  c3:	89 c8                	mov    %ecx,%eax
+  c5:	5d                   	pop    %ebp
+  c6:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  cc:	eb f5                	jmp    c3 <strlen+0x1b>
+
+000000ce <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	57                   	push   %edi
+  d2:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d5:	89 d7                	mov    %edx,%edi
+  d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  dd:	fc                   	cld
+  de:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e0:	89 d0                	mov    %edx,%eax
+  e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e5:	c9                   	leave
+  e6:	c3                   	ret
+
+000000e7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  e7:	55                   	push   %ebp
+  e8:	89 e5                	mov    %esp,%ebp
+  ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  ed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  f1:	0f b6 10             	movzbl (%eax),%edx
+  f4:	84 d2                	test   %dl,%dl
+  f6:	74 15                	je     10d <strchr+0x26>
+    if(*s == c)
+  f8:	38 d1                	cmp    %dl,%cl
+  fa:	74 0f                	je     10b <strchr+0x24>
+  for(; *s; s++)
+  fc:	83 c0 01             	add    $0x1,%eax
+  ff:	0f b6 10             	movzbl (%eax),%edx
+ 102:	84 d2                	test   %dl,%dl
+ 104:	75 f2                	jne    f8 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 106:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 10b:	5d                   	pop    %ebp
+ 10c:	c3                   	ret
+  return 0;
+ 10d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 112:	eb f7                	jmp    10b <strchr+0x24>
+
+00000114 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 114:	55                   	push   %ebp
+ 115:	89 e5                	mov    %esp,%ebp
+ 117:	57                   	push   %edi
+ 118:	56                   	push   %esi
+ 119:	53                   	push   %ebx
+ 11a:	83 ec 2c             	sub    $0x2c,%esp
+ 11d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 120:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 125:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 128:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 12b:	83 c3 01             	add    $0x1,%ebx
+ 12e:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 131:	7d 27                	jge    15a <gets+0x46>
+    cc = read(0, &c, 1);
+ 133:	83 ec 04             	sub    $0x4,%esp
+ 136:	6a 01                	push   $0x1
+ 138:	57                   	push   %edi
+ 139:	6a 00                	push   $0x0
+ 13b:	e8 94 01 00 00       	call   2d4 <read>
+    if(cc < 1)
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	85 c0                	test   %eax,%eax
+ 145:	7e 13                	jle    15a <gets+0x46>
+      break;
+    buf[i++] = c;
+ 147:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 14b:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 14f:	3c 0a                	cmp    $0xa,%al
+ 151:	74 04                	je     157 <gets+0x43>
+ 153:	3c 0d                	cmp    $0xd,%al
+ 155:	75 d1                	jne    128 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 157:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 15a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 15d:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 161:	89 f0                	mov    %esi,%eax
+ 163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 166:	5b                   	pop    %ebx
+ 167:	5e                   	pop    %esi
+ 168:	5f                   	pop    %edi
+ 169:	5d                   	pop    %ebp
+ 16a:	c3                   	ret
+
+0000016b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 16b:	55                   	push   %ebp
+ 16c:	89 e5                	mov    %esp,%ebp
+ 16e:	56                   	push   %esi
+ 16f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	6a 00                	push   $0x0
+ 175:	ff 75 08             	push   0x8(%ebp)
+ 178:	e8 7f 01 00 00       	call   2fc <open>
+  if(fd < 0)
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	78 24                	js     1a8 <stat+0x3d>
+ 184:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 186:	83 ec 08             	sub    $0x8,%esp
+ 189:	ff 75 0c             	push   0xc(%ebp)
+ 18c:	50                   	push   %eax
+ 18d:	e8 82 01 00 00       	call   314 <fstat>
+ 192:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 194:	89 1c 24             	mov    %ebx,(%esp)
+ 197:	e8 48 01 00 00       	call   2e4 <close>
+  return r;
+ 19c:	83 c4 10             	add    $0x10,%esp
+}
+ 19f:	89 f0                	mov    %esi,%eax
+ 1a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1a4:	5b                   	pop    %ebx
+ 1a5:	5e                   	pop    %esi
+ 1a6:	5d                   	pop    %ebp
+ 1a7:	c3                   	ret
+    return -1;
+ 1a8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1ad:	eb f0                	jmp    19f <stat+0x34>
+
+000001af <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1af:	55                   	push   %ebp
+ 1b0:	89 e5                	mov    %esp,%ebp
+ 1b2:	56                   	push   %esi
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1b7:	0f b6 0a             	movzbl (%edx),%ecx
+ 1ba:	80 f9 20             	cmp    $0x20,%cl
+ 1bd:	75 0b                	jne    1ca <atoi+0x1b>
+ 1bf:	83 c2 01             	add    $0x1,%edx
+ 1c2:	0f b6 0a             	movzbl (%edx),%ecx
+ 1c5:	80 f9 20             	cmp    $0x20,%cl
+ 1c8:	74 f5                	je     1bf <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1ca:	80 f9 2d             	cmp    $0x2d,%cl
+ 1cd:	74 3c                	je     20b <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 1cf:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1d2:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1d7:	f6 c1 fd             	test   $0xfd,%cl
+ 1da:	74 34                	je     210 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1dc:	0f b6 0a             	movzbl (%edx),%ecx
+ 1df:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1e2:	3c 09                	cmp    $0x9,%al
+ 1e4:	77 2f                	ja     215 <atoi+0x66>
+ 1e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 1eb:	83 c2 01             	add    $0x1,%edx
+ 1ee:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1f1:	0f be c9             	movsbl %cl,%ecx
+ 1f4:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 1f8:	0f b6 0a             	movzbl (%edx),%ecx
+ 1fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1fe:	3c 09                	cmp    $0x9,%al
+ 200:	76 e9                	jbe    1eb <atoi+0x3c>
+  return sign*n;
+ 202:	89 f0                	mov    %esi,%eax
+ 204:	0f af c3             	imul   %ebx,%eax
+}
+ 207:	5b                   	pop    %ebx
+ 208:	5e                   	pop    %esi
+ 209:	5d                   	pop    %ebp
+ 20a:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 20b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 210:	83 c2 01             	add    $0x1,%edx
+ 213:	eb c7                	jmp    1dc <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 215:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 21a:	eb e6                	jmp    202 <atoi+0x53>
+
+0000021c <atoo>:
+
+int
+atoo(const char *s)
+{
+ 21c:	55                   	push   %ebp
+ 21d:	89 e5                	mov    %esp,%ebp
+ 21f:	56                   	push   %esi
+ 220:	53                   	push   %ebx
+ 221:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 224:	0f b6 0a             	movzbl (%edx),%ecx
+ 227:	80 f9 20             	cmp    $0x20,%cl
+ 22a:	75 0b                	jne    237 <atoo+0x1b>
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	0f b6 0a             	movzbl (%edx),%ecx
+ 232:	80 f9 20             	cmp    $0x20,%cl
+ 235:	74 f5                	je     22c <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 237:	80 f9 2d             	cmp    $0x2d,%cl
+ 23a:	74 3a                	je     276 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 23c:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 23f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 244:	f6 c1 fd             	test   $0xfd,%cl
+ 247:	74 32                	je     27b <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 249:	0f b6 0a             	movzbl (%edx),%ecx
+ 24c:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 24f:	80 fb 07             	cmp    $0x7,%bl
+ 252:	77 2c                	ja     280 <atoo+0x64>
+ 254:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 259:	83 c2 01             	add    $0x1,%edx
+ 25c:	0f be c9             	movsbl %cl,%ecx
+ 25f:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 263:	0f b6 0a             	movzbl (%edx),%ecx
+ 266:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 269:	3c 07                	cmp    $0x7,%al
+ 26b:	76 ec                	jbe    259 <atoo+0x3d>
+  return sign*n;
+ 26d:	89 f0                	mov    %esi,%eax
+ 26f:	0f af c3             	imul   %ebx,%eax
+}
+ 272:	5b                   	pop    %ebx
+ 273:	5e                   	pop    %esi
+ 274:	5d                   	pop    %ebp
+ 275:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 276:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 27b:	83 c2 01             	add    $0x1,%edx
+ 27e:	eb c9                	jmp    249 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 280:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 285:	eb e6                	jmp    26d <atoo+0x51>
+
+00000287 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	56                   	push   %esi
+ 28b:	53                   	push   %ebx
+ 28c:	8b 75 08             	mov    0x8(%ebp),%esi
+ 28f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 295:	85 db                	test   %ebx,%ebx
+ 297:	7e 15                	jle    2ae <memmove+0x27>
+ 299:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 29b:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 29d:	83 c2 01             	add    $0x1,%edx
+ 2a0:	83 c0 01             	add    $0x1,%eax
+ 2a3:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2a7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2aa:	39 c3                	cmp    %eax,%ebx
+ 2ac:	75 ef                	jne    29d <memmove+0x16>
+  return vdst;
+}
+ 2ae:	89 f0                	mov    %esi,%eax
+ 2b0:	5b                   	pop    %ebx
+ 2b1:	5e                   	pop    %esi
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+
+000002b4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <exit>:
+SYSCALL(exit)
+ 2bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <wait>:
+SYSCALL(wait)
+ 2c4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <pipe>:
+SYSCALL(pipe)
+ 2cc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <read>:
+SYSCALL(read)
+ 2d4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <write>:
+SYSCALL(write)
+ 2dc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <close>:
+SYSCALL(close)
+ 2e4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <kill>:
+SYSCALL(kill)
+ 2ec:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <exec>:
+SYSCALL(exec)
+ 2f4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <open>:
+SYSCALL(open)
+ 2fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <mknod>:
+SYSCALL(mknod)
+ 304:	b8 11 00 00 00       	mov    $0x11,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <unlink>:
+SYSCALL(unlink)
+ 30c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <fstat>:
+SYSCALL(fstat)
+ 314:	b8 08 00 00 00       	mov    $0x8,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <link>:
+SYSCALL(link)
+ 31c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <mkdir>:
+SYSCALL(mkdir)
+ 324:	b8 14 00 00 00       	mov    $0x14,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <chdir>:
+SYSCALL(chdir)
+ 32c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <dup>:
+SYSCALL(dup)
+ 334:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <getpid>:
+SYSCALL(getpid)
+ 33c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <sbrk>:
+SYSCALL(sbrk)
+ 344:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <sleep>:
+SYSCALL(sleep)
+ 34c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <uptime>:
+SYSCALL(uptime)
+ 354:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <halt>:
+SYSCALL(halt)
+ 35c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <date>:
+SYSCALL(date)
+ 364:	b8 17 00 00 00       	mov    $0x17,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <getuid>:
+SYSCALL(getuid)
+ 36c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <getgid>:
+SYSCALL(getgid)
+ 374:	b8 19 00 00 00       	mov    $0x19,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <getppid>:
+SYSCALL(getppid)
+ 37c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <setuid>:
+SYSCALL(setuid)
+ 384:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <setgid>:
+SYSCALL(setgid)
+ 38c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <getprocs>:
+SYSCALL(getprocs)
+ 394:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <setpriority>:
+SYSCALL(setpriority)
+ 39c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <getpriority>:
+SYSCALL(getpriority)
+ 3a4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <waitpid>:
+SYSCALL(waitpid)
+ 3ac:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <setaffinity>:
+SYSCALL(setaffinity)
+ 3b4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <getaffinity>:
+SYSCALL(getaffinity)
+ 3bc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <setdeadline>:
+SYSCALL(setdeadline)
+ 3c4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <schedctl>:
+SYSCALL(schedctl)
+ 3cc:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <spawn>:
+SYSCALL(spawn)
+ 3d4:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <vmstats>:
+SYSCALL(vmstats)
+ 3dc:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 3e4:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <setshares>:
+SYSCALL(setshares)
+ 3ec:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <getshares>:
+SYSCALL(getshares)
+ 3f4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3fc:	55                   	push   %ebp
+ 3fd:	89 e5                	mov    %esp,%ebp
+ 3ff:	57                   	push   %edi
+ 400:	56                   	push   %esi
+ 401:	53                   	push   %ebx
+ 402:	83 ec 3c             	sub    $0x3c,%esp
+ 405:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 408:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 40a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 40e:	74 79                	je     489 <printint+0x8d>
+ 410:	85 d2                	test   %edx,%edx
+ 412:	79 75                	jns    489 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 414:	89 d1                	mov    %edx,%ecx
+ 416:	f7 d9                	neg    %ecx
+    neg = 1;
+ 418:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 41f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 424:	89 df                	mov    %ebx,%edi
+ 426:	83 c3 01             	add    $0x1,%ebx
+ 429:	89 c8                	mov    %ecx,%eax
+ 42b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 430:	f7 f6                	div    %esi
+ 432:	0f b6 92 00 08 00 00 	movzbl 0x800(%edx),%edx
+ 439:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 43d:	89 ca                	mov    %ecx,%edx
+ 43f:	89 c1                	mov    %eax,%ecx
+ 441:	39 f2                	cmp    %esi,%edx
+ 443:	73 df                	jae    424 <printint+0x28>
+  if(neg)
+ 445:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 449:	74 08                	je     453 <printint+0x57>
+    buf[i++] = '-';
+ 44b:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 450:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 453:	85 db                	test   %ebx,%ebx
+ 455:	7e 2a                	jle    481 <printint+0x85>
+ 457:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 45a:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 45e:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 461:	0f b6 03             	movzbl (%ebx),%eax
+ 464:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 467:	83 ec 04             	sub    $0x4,%esp
+ 46a:	6a 01                	push   $0x1
+ 46c:	57                   	push   %edi
+ 46d:	ff 75 c4             	push   -0x3c(%ebp)
+ 470:	e8 67 fe ff ff       	call   2dc <write>
+  while(--i >= 0)
+ 475:	89 d8                	mov    %ebx,%eax
+ 477:	83 eb 01             	sub    $0x1,%ebx
+ 47a:	83 c4 10             	add    $0x10,%esp
+ 47d:	39 f0                	cmp    %esi,%eax
+ 47f:	75 e0                	jne    461 <printint+0x65>
+}
+ 481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 484:	5b                   	pop    %ebx
+ 485:	5e                   	pop    %esi
+ 486:	5f                   	pop    %edi
+ 487:	5d                   	pop    %ebp
+ 488:	c3                   	ret
+    x = xx;
+ 489:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 48b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 492:	eb 8b                	jmp    41f <printint+0x23>
+
+00000494 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 494:	55                   	push   %ebp
+ 495:	89 e5                	mov    %esp,%ebp
+ 497:	57                   	push   %edi
+ 498:	56                   	push   %esi
+ 499:	53                   	push   %ebx
+ 49a:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 49d:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4a0:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a3:	84 db                	test   %bl,%bl
+ 4a5:	0f 84 9e 01 00 00    	je     649 <printf+0x1b5>
+ 4ab:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4ae:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4b4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4b9:	eb 2d                	jmp    4e8 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4be:	83 ec 04             	sub    $0x4,%esp
+ 4c1:	6a 01                	push   $0x1
+ 4c3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4c6:	50                   	push   %eax
+ 4c7:	ff 75 08             	push   0x8(%ebp)
+ 4ca:	e8 0d fe ff ff       	call   2dc <write>
+        putc(fd, c);
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	eb 05                	jmp    4d9 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4d4:	83 ff 25             	cmp    $0x25,%edi
+ 4d7:	74 1f                	je     4f8 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4d9:	83 c6 01             	add    $0x1,%esi
+ 4dc:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4e0:	84 db                	test   %bl,%bl
+ 4e2:	0f 84 61 01 00 00    	je     649 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4e8:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4eb:	85 ff                	test   %edi,%edi
+ 4ed:	75 e5                	jne    4d4 <printf+0x40>
+      if(c == '%'){
+ 4ef:	83 f8 25             	cmp    $0x25,%eax
+ 4f2:	75 c7                	jne    4bb <printf+0x27>
+        state = '%';
+ 4f4:	89 c7                	mov    %eax,%edi
+ 4f6:	eb e1                	jmp    4d9 <printf+0x45>
+      if(c == 'd'){
+ 4f8:	83 f8 25             	cmp    $0x25,%eax
+ 4fb:	0f 84 f4 00 00 00    	je     5f5 <printf+0x161>
+ 501:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 504:	83 fa 15             	cmp    $0x15,%edx
+ 507:	0f 87 09 01 00 00    	ja     616 <printf+0x182>
+ 50d:	0f 87 03 01 00 00    	ja     616 <printf+0x182>
+ 513:	ff 24 95 a8 07 00 00 	jmp    *0x7a8(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 51a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 51d:	8b 17                	mov    (%edi),%edx
+ 51f:	83 ec 0c             	sub    $0xc,%esp
+ 522:	6a 01                	push   $0x1
+ 524:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 529:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52c:	e8 cb fe ff ff       	call   3fc <printint>
+        ap++;
+ 531:	83 c7 04             	add    $0x4,%edi
+ 534:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 537:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 53a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53f:	eb 98                	jmp    4d9 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 541:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 544:	8b 17                	mov    (%edi),%edx
+ 546:	83 ec 0c             	sub    $0xc,%esp
+ 549:	6a 00                	push   $0x0
+ 54b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 550:	8b 45 08             	mov    0x8(%ebp),%eax
+ 553:	e8 a4 fe ff ff       	call   3fc <printint>
+        ap++;
+ 558:	83 c7 04             	add    $0x4,%edi
+ 55b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 55e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 561:	bf 00 00 00 00       	mov    $0x0,%edi
+ 566:	e9 6e ff ff ff       	jmp    4d9 <printf+0x45>
+        s = (char*)*ap;
+ 56b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 56e:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 570:	83 c1 04             	add    $0x4,%ecx
+ 573:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 576:	85 c0                	test   %eax,%eax
+ 578:	74 13                	je     58d <printf+0xf9>
+        s = (char*)*ap;
+ 57a:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 57c:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 57f:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 584:	84 c0                	test   %al,%al
+ 586:	75 0f                	jne    597 <printf+0x103>
+ 588:	e9 4c ff ff ff       	jmp    4d9 <printf+0x45>
+          s = "(null)";
+ 58d:	bb a0 07 00 00       	mov    $0x7a0,%ebx
+        while(*s != 0){
+ 592:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 597:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 59a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 59d:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5a0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a3:	83 ec 04             	sub    $0x4,%esp
+ 5a6:	6a 01                	push   $0x1
+ 5a8:	57                   	push   %edi
+ 5a9:	56                   	push   %esi
+ 5aa:	e8 2d fd ff ff       	call   2dc <write>
+          s++;
+ 5af:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5b2:	0f b6 03             	movzbl (%ebx),%eax
+ 5b5:	83 c4 10             	add    $0x10,%esp
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	75 e4                	jne    5a0 <printf+0x10c>
+      state = 0;
+ 5bc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5bf:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c4:	e9 10 ff ff ff       	jmp    4d9 <printf+0x45>
+        putc(fd, *ap);
+ 5c9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5cc:	8b 07                	mov    (%edi),%eax
+ 5ce:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d1:	83 ec 04             	sub    $0x4,%esp
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5d9:	50                   	push   %eax
+ 5da:	ff 75 08             	push   0x8(%ebp)
+ 5dd:	e8 fa fc ff ff       	call   2dc <write>
+        ap++;
+ 5e2:	83 c7 04             	add    $0x4,%edi
+ 5e5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5eb:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5f0:	e9 e4 fe ff ff       	jmp    4d9 <printf+0x45>
+        putc(fd, c);
+ 5f5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f8:	83 ec 04             	sub    $0x4,%esp
+ 5fb:	6a 01                	push   $0x1
+ 5fd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 600:	50                   	push   %eax
+ 601:	ff 75 08             	push   0x8(%ebp)
+ 604:	e8 d3 fc ff ff       	call   2dc <write>
+ 609:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 611:	e9 c3 fe ff ff       	jmp    4d9 <printf+0x45>
+        putc(fd, '%');
+ 616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 61a:	83 ec 04             	sub    $0x4,%esp
+ 61d:	6a 01                	push   $0x1
+ 61f:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 622:	57                   	push   %edi
+ 623:	ff 75 08             	push   0x8(%ebp)
+ 626:	e8 b1 fc ff ff       	call   2dc <write>
+        putc(fd, c);
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 62e:	83 c4 0c             	add    $0xc,%esp
+ 631:	6a 01                	push   $0x1
+ 633:	57                   	push   %edi
+ 634:	ff 75 08             	push   0x8(%ebp)
+ 637:	e8 a0 fc ff ff       	call   2dc <write>
+        putc(fd, c);
+ 63c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 644:	e9 90 fe ff ff       	jmp    4d9 <printf+0x45>
+    }
+  }
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+
+00000651 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 651:	55                   	push   %ebp
+ 652:	89 e5                	mov    %esp,%ebp
+ 654:	57                   	push   %edi
+ 655:	56                   	push   %esi
+ 656:	53                   	push   %ebx
+ 657:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 65a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65d:	a1 a4 0a 00 00       	mov    0xaa4,%eax
+ 662:	eb 0c                	jmp    670 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 664:	8b 10                	mov    (%eax),%edx
+ 666:	39 d0                	cmp    %edx,%eax
+ 668:	72 04                	jb     66e <free+0x1d>
+ 66a:	39 d1                	cmp    %edx,%ecx
+ 66c:	72 10                	jb     67e <free+0x2d>
+{
+ 66e:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 670:	39 c8                	cmp    %ecx,%eax
+ 672:	73 f0                	jae    664 <free+0x13>
+ 674:	8b 10                	mov    (%eax),%edx
+ 676:	39 d1                	cmp    %edx,%ecx
+ 678:	72 04                	jb     67e <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67a:	39 d0                	cmp    %edx,%eax
+ 67c:	72 f0                	jb     66e <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 67e:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 681:	8b 10                	mov    (%eax),%edx
+ 683:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 686:	39 fa                	cmp    %edi,%edx
+ 688:	74 19                	je     6a3 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 68a:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 68d:	8b 50 04             	mov    0x4(%eax),%edx
+ 690:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 693:	39 f1                	cmp    %esi,%ecx
+ 695:	74 18                	je     6af <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 697:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 699:	a3 a4 0a 00 00       	mov    %eax,0xaa4
+}
+ 69e:	5b                   	pop    %ebx
+ 69f:	5e                   	pop    %esi
+ 6a0:	5f                   	pop    %edi
+ 6a1:	5d                   	pop    %ebp
+ 6a2:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6a3:	03 72 04             	add    0x4(%edx),%esi
+ 6a6:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a9:	8b 10                	mov    (%eax),%edx
+ 6ab:	8b 12                	mov    (%edx),%edx
+ 6ad:	eb db                	jmp    68a <free+0x39>
+    p->s.size += bp->s.size;
+ 6af:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6b2:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6b5:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6b8:	eb dd                	jmp    697 <free+0x46>
+
+000006ba <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6ba:	55                   	push   %ebp
+ 6bb:	89 e5                	mov    %esp,%ebp
+ 6bd:	57                   	push   %edi
+ 6be:	56                   	push   %esi
+ 6bf:	53                   	push   %ebx
+ 6c0:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6c9:	c1 eb 03             	shr    $0x3,%ebx
+ 6cc:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6cf:	8b 15 a4 0a 00 00    	mov    0xaa4,%edx
+ 6d5:	85 d2                	test   %edx,%edx
+ 6d7:	74 1c                	je     6f5 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d9:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6db:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6de:	39 d9                	cmp    %ebx,%ecx
+ 6e0:	73 38                	jae    71a <malloc+0x60>
+  if(nu < 4096)
+ 6e2:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6e7:	39 f3                	cmp    %esi,%ebx
+ 6e9:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6ec:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6f3:	eb 72                	jmp    767 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6f5:	c7 05 a4 0a 00 00 a8 	movl   $0xaa8,0xaa4
+ 6fc:	0a 00 00 
+ 6ff:	c7 05 a8 0a 00 00 a8 	movl   $0xaa8,0xaa8
+ 706:	0a 00 00 
+    base.s.size = 0;
+ 709:	c7 05 ac 0a 00 00 00 	movl   $0x0,0xaac
+ 710:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 713:	b8 a8 0a 00 00       	mov    $0xaa8,%eax
+    if(p->s.size >= nunits){
+ 718:	eb c8                	jmp    6e2 <malloc+0x28>
+      if(p->s.size == nunits)
+ 71a:	39 cb                	cmp    %ecx,%ebx
+ 71c:	74 1e                	je     73c <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 71e:	29 d9                	sub    %ebx,%ecx
+ 720:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 723:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 726:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 729:	89 15 a4 0a 00 00    	mov    %edx,0xaa4
+      return (void*)(p + 1);
+ 72f:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 732:	89 d0                	mov    %edx,%eax
+ 734:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 737:	5b                   	pop    %ebx
+ 738:	5e                   	pop    %esi
+ 739:	5f                   	pop    %edi
+ 73a:	5d                   	pop    %ebp
+ 73b:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 73c:	8b 08                	mov    (%eax),%ecx
+ 73e:	89 0a                	mov    %ecx,(%edx)
+ 740:	eb e7                	jmp    729 <malloc+0x6f>
+  hp->s.size = nu;
+ 742:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 745:	83 ec 0c             	sub    $0xc,%esp
+ 748:	83 c0 08             	add    $0x8,%eax
+ 74b:	50                   	push   %eax
+ 74c:	e8 00 ff ff ff       	call   651 <free>
+  return freep;
+ 751:	8b 15 a4 0a 00 00    	mov    0xaa4,%edx
+      if((p = morecore(nunits)) == 0)
+ 757:	83 c4 10             	add    $0x10,%esp
+ 75a:	85 d2                	test   %edx,%edx
+ 75c:	74 d4                	je     732 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 75e:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 760:	8b 48 04             	mov    0x4(%eax),%ecx
+ 763:	39 d9                	cmp    %ebx,%ecx
+ 765:	73 b3                	jae    71a <malloc+0x60>
+    if(p == freep)
+ 767:	89 c2                	mov    %eax,%edx
+ 769:	39 05 a4 0a 00 00    	cmp    %eax,0xaa4
+ 76f:	75 ed                	jne    75e <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 771:	83 ec 0c             	sub    $0xc,%esp
+ 774:	57                   	push   %edi
+ 775:	e8 ca fb ff ff       	call   344 <sbrk>
+  if(p == (char*)-1)
+ 77a:	83 c4 10             	add    $0x10,%esp
+ 77d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 780:	75 c0                	jne    742 <malloc+0x88>
+        return 0;
+ 782:	ba 00 00 00 00       	mov    $0x0,%edx
+ 787:	eb a9                	jmp    732 <malloc+0x78>
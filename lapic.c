@@ -43,6 +43,12 @@
 
 volatile uint *lapic;  // Initialized in mp.c
 
+#ifdef PDX_XV6
+#define TICKCOUNT 1000000   // TICR for one tick
+#else
+#define TICKCOUNT 10000000
+#endif // PDX_XV6
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -66,11 +72,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-#ifdef PDX_XV6
-  lapicw(TICR, 1000000);
-#else
-  lapicw(TICR, 10000000);
-#endif // PDX_XV6
+  lapicw(TICR, TICKCOUNT);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -117,6 +119,51 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+#ifdef PDX_TICKLESS
+// Interrupt every n ticks, or only once, n ticks from now.
+void
+lapicsettimer(uint n, int periodic)
+{
+  if(!lapic)
+    return;
+  if(n > 0xFFFFFFFF / TICKCOUNT)
+    n = 0xFFFFFFFF / TICKCOUNT;
+  lapicw(TIMER, (periodic ? PERIODIC : 0) | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, n * TICKCOUNT);
+}
+
+// Whole ticks since a one-shot timer was set.  The part of a tick
+// left over is added to *frac and counted once it adds up.
+uint
+lapicelapsed(uint *frac)
+{
+  uint count, n;
+
+  if(!lapic)
+    return 0;
+  count = lapic[TICR] - lapic[TCCR];
+  n = count / TICKCOUNT;
+  *frac += count % TICKCOUNT;
+  if(*frac >= TICKCOUNT){
+    *frac -= TICKCOUNT;
+    n++;
+  }
+  return n;
+}
+#endif // PDX_TICKLESS
+
+// Send interrupt vector to the cpu with the given APIC id.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
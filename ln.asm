@@ -0,0 +1,1239 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  12:	83 39 03             	cmpl   $0x3,(%ecx)
+  15:	74 14                	je     2b <main+0x2b>
+    printf(2, "Usage: ln old new\n");
+  17:	83 ec 08             	sub    $0x8,%esp
+  1a:	68 8c 07 00 00       	push   $0x78c
+  1f:	6a 02                	push   $0x2
+  21:	e8 71 04 00 00       	call   497 <printf>
+    exit();
+  26:	e8 94 02 00 00       	call   2bf <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	ff 73 08             	push   0x8(%ebx)
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 e6 02 00 00       	call   31f <link>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	78 05                	js     45 <main+0x45>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  40:	e8 7a 02 00 00       	call   2bf <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  45:	ff 73 08             	push   0x8(%ebx)
+  48:	ff 73 04             	push   0x4(%ebx)
+  4b:	68 9f 07 00 00       	push   $0x79f
+  50:	6a 02                	push   $0x2
+  52:	e8 40 04 00 00       	call   497 <printf>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	eb e4                	jmp    40 <main+0x40>
+
+0000005c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  5c:	55                   	push   %ebp
+  5d:	89 e5                	mov    %esp,%ebp
+  5f:	53                   	push   %ebx
+  60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  63:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  66:	b8 00 00 00 00       	mov    $0x0,%eax
+  6b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  6f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  72:	83 c0 01             	add    $0x1,%eax
+  75:	84 d2                	test   %dl,%dl
+  77:	75 f2                	jne    6b <strcpy+0xf>
+    ;
+  return os;
+}
+  79:	89 c8                	mov    %ecx,%eax
+  7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  7e:	c9                   	leave
+  7f:	c3                   	ret
+
+00000080 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  89:	0f b6 01             	movzbl (%ecx),%eax
+  8c:	84 c0                	test   %al,%al
+  8e:	74 11                	je     a1 <strcmp+0x21>
+  90:	38 02                	cmp    %al,(%edx)
+  92:	75 0d                	jne    a1 <strcmp+0x21>
+    p++, q++;
+  94:	83 c1 01             	add    $0x1,%ecx
+  97:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  9a:	0f b6 01             	movzbl (%ecx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 ef                	jne    90 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  a1:	0f b6 c0             	movzbl %al,%eax
+  a4:	0f b6 12             	movzbl (%edx),%edx
+  a7:	29 d0                	sub    %edx,%eax
+}
+  a9:	5d                   	pop    %ebp
+  aa:	c3                   	ret
+
+000000ab <strlen>:
+
+uint
+strlen(char *s)
+{
+  ab:	55                   	push   %ebp
+  ac:	89 e5                	mov    %esp,%ebp
+  ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  b1:	80 3a 00             	cmpb   $0x0,(%edx)
+  b4:	74 14                	je     ca <strlen+0x1f>
+  b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  bb:	83 c0 01             	add    $0x1,%eax
+  be:	89 c1                	mov    %eax,%ecx
+  c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  c4:	75 f5                	jne    bb <strlen+0x10>
+    ;
+  return n;
+}
+  c6:	89 c8                	mov    %ecx,%eax
+  c8:	5d                   	pop    %ebp
+  c9:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  cf:	eb f5                	jmp    c6 <strlen+0x1b>
+
+000000d1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d1:	55                   	push   %ebp
+  d2:	89 e5                	mov    %esp,%ebp
+  d4:	57                   	push   %edi
+  d5:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d8:	89 d7                	mov    %edx,%edi
+  da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e0:	fc                   	cld
+  e1:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e3:	89 d0                	mov    %edx,%eax
+  e5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e8:	c9                   	leave
+  e9:	c3                   	ret
+
+000000ea <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  ea:	55                   	push   %ebp
+  eb:	89 e5                	mov    %esp,%ebp
+  ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  f0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  f4:	0f b6 10             	movzbl (%eax),%edx
+  f7:	84 d2                	test   %dl,%dl
+  f9:	74 15                	je     110 <strchr+0x26>
+    if(*s == c)
+  fb:	38 d1                	cmp    %dl,%cl
+  fd:	74 0f                	je     10e <strchr+0x24>
+  for(; *s; s++)
+  ff:	83 c0 01             	add    $0x1,%eax
+ 102:	0f b6 10             	movzbl (%eax),%edx
+ 105:	84 d2                	test   %dl,%dl
+ 107:	75 f2                	jne    fb <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 109:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 10e:	5d                   	pop    %ebp
+ 10f:	c3                   	ret
+  return 0;
+ 110:	b8 00 00 00 00       	mov    $0x0,%eax
+ 115:	eb f7                	jmp    10e <strchr+0x24>
+
+00000117 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 117:	55                   	push   %ebp
+ 118:	89 e5                	mov    %esp,%ebp
+ 11a:	57                   	push   %edi
+ 11b:	56                   	push   %esi
+ 11c:	53                   	push   %ebx
+ 11d:	83 ec 2c             	sub    $0x2c,%esp
+ 120:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 123:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 128:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 12b:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 12e:	83 c3 01             	add    $0x1,%ebx
+ 131:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 134:	7d 27                	jge    15d <gets+0x46>
+    cc = read(0, &c, 1);
+ 136:	83 ec 04             	sub    $0x4,%esp
+ 139:	6a 01                	push   $0x1
+ 13b:	57                   	push   %edi
+ 13c:	6a 00                	push   $0x0
+ 13e:	e8 94 01 00 00       	call   2d7 <read>
+    if(cc < 1)
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	85 c0                	test   %eax,%eax
+ 148:	7e 13                	jle    15d <gets+0x46>
+      break;
+    buf[i++] = c;
+ 14a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 14e:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 152:	3c 0a                	cmp    $0xa,%al
+ 154:	74 04                	je     15a <gets+0x43>
+ 156:	3c 0d                	cmp    $0xd,%al
+ 158:	75 d1                	jne    12b <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 15a:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 15d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 160:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 164:	89 f0                	mov    %esi,%eax
+ 166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+
+0000016e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	56                   	push   %esi
+ 172:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 173:	83 ec 08             	sub    $0x8,%esp
+ 176:	6a 00                	push   $0x0
+ 178:	ff 75 08             	push   0x8(%ebp)
+ 17b:	e8 7f 01 00 00       	call   2ff <open>
+  if(fd < 0)
+ 180:	83 c4 10             	add    $0x10,%esp
+ 183:	85 c0                	test   %eax,%eax
+ 185:	78 24                	js     1ab <stat+0x3d>
+ 187:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 189:	83 ec 08             	sub    $0x8,%esp
+ 18c:	ff 75 0c             	push   0xc(%ebp)
+ 18f:	50                   	push   %eax
+ 190:	e8 82 01 00 00       	call   317 <fstat>
+ 195:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 197:	89 1c 24             	mov    %ebx,(%esp)
+ 19a:	e8 48 01 00 00       	call   2e7 <close>
+  return r;
+ 19f:	83 c4 10             	add    $0x10,%esp
+}
+ 1a2:	89 f0                	mov    %esi,%eax
+ 1a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1a7:	5b                   	pop    %ebx
+ 1a8:	5e                   	pop    %esi
+ 1a9:	5d                   	pop    %ebp
+ 1aa:	c3                   	ret
+    return -1;
+ 1ab:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1b0:	eb f0                	jmp    1a2 <stat+0x34>
+
+000001b2 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1b2:	55                   	push   %ebp
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	56                   	push   %esi
+ 1b6:	53                   	push   %ebx
+ 1b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1ba:	0f b6 0a             	movzbl (%edx),%ecx
+ 1bd:	80 f9 20             	cmp    $0x20,%cl
+ 1c0:	75 0b                	jne    1cd <atoi+0x1b>
+ 1c2:	83 c2 01             	add    $0x1,%edx
+ 1c5:	0f b6 0a             	movzbl (%edx),%ecx
+ 1c8:	80 f9 20             	cmp    $0x20,%cl
+ 1cb:	74 f5                	je     1c2 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1cd:	80 f9 2d             	cmp    $0x2d,%cl
+ 1d0:	74 3c                	je     20e <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 1d2:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1d5:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1da:	f6 c1 fd             	test   $0xfd,%cl
+ 1dd:	74 34                	je     213 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1df:	0f b6 0a             	movzbl (%edx),%ecx
+ 1e2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1e5:	3c 09                	cmp    $0x9,%al
+ 1e7:	77 2f                	ja     218 <atoi+0x66>
+ 1e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 1ee:	83 c2 01             	add    $0x1,%edx
+ 1f1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1f4:	0f be c9             	movsbl %cl,%ecx
+ 1f7:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 1fb:	0f b6 0a             	movzbl (%edx),%ecx
+ 1fe:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 201:	3c 09                	cmp    $0x9,%al
+ 203:	76 e9                	jbe    1ee <atoi+0x3c>
+  return sign*n;
+ 205:	89 f0                	mov    %esi,%eax
+ 207:	0f af c3             	imul   %ebx,%eax
+}
+ 20a:	5b                   	pop    %ebx
+ 20b:	5e                   	pop    %esi
+ 20c:	5d                   	pop    %ebp
+ 20d:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 20e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 213:	83 c2 01             	add    $0x1,%edx
+ 216:	eb c7                	jmp    1df <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 218:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 21d:	eb e6                	jmp    205 <atoi+0x53>
+
+0000021f <atoo>:
+
+int
+atoo(const char *s)
+{
+ 21f:	55                   	push   %ebp
+ 220:	89 e5                	mov    %esp,%ebp
+ 222:	56                   	push   %esi
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 227:	0f b6 0a             	movzbl (%edx),%ecx
+ 22a:	80 f9 20             	cmp    $0x20,%cl
+ 22d:	75 0b                	jne    23a <atoo+0x1b>
+ 22f:	83 c2 01             	add    $0x1,%edx
+ 232:	0f b6 0a             	movzbl (%edx),%ecx
+ 235:	80 f9 20             	cmp    $0x20,%cl
+ 238:	74 f5                	je     22f <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 23a:	80 f9 2d             	cmp    $0x2d,%cl
+ 23d:	74 3a                	je     279 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 23f:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 242:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 247:	f6 c1 fd             	test   $0xfd,%cl
+ 24a:	74 32                	je     27e <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 24c:	0f b6 0a             	movzbl (%edx),%ecx
+ 24f:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 252:	80 fb 07             	cmp    $0x7,%bl
+ 255:	77 2c                	ja     283 <atoo+0x64>
+ 257:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 25c:	83 c2 01             	add    $0x1,%edx
+ 25f:	0f be c9             	movsbl %cl,%ecx
+ 262:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 266:	0f b6 0a             	movzbl (%edx),%ecx
+ 269:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 26c:	3c 07                	cmp    $0x7,%al
+ 26e:	76 ec                	jbe    25c <atoo+0x3d>
+  return sign*n;
+ 270:	89 f0                	mov    %esi,%eax
+ 272:	0f af c3             	imul   %ebx,%eax
+}
+ 275:	5b                   	pop    %ebx
+ 276:	5e                   	pop    %esi
+ 277:	5d                   	pop    %ebp
+ 278:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 279:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 27e:	83 c2 01             	add    $0x1,%edx
+ 281:	eb c9                	jmp    24c <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 283:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 288:	eb e6                	jmp    270 <atoo+0x51>
+
+0000028a <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 28a:	55                   	push   %ebp
+ 28b:	89 e5                	mov    %esp,%ebp
+ 28d:	56                   	push   %esi
+ 28e:	53                   	push   %ebx
+ 28f:	8b 75 08             	mov    0x8(%ebp),%esi
+ 292:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 295:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 298:	85 db                	test   %ebx,%ebx
+ 29a:	7e 15                	jle    2b1 <memmove+0x27>
+ 29c:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 29e:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2a0:	83 c2 01             	add    $0x1,%edx
+ 2a3:	83 c0 01             	add    $0x1,%eax
+ 2a6:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2aa:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2ad:	39 c3                	cmp    %eax,%ebx
+ 2af:	75 ef                	jne    2a0 <memmove+0x16>
+  return vdst;
+}
+ 2b1:	89 f0                	mov    %esi,%eax
+ 2b3:	5b                   	pop    %ebx
+ 2b4:	5e                   	pop    %esi
+ 2b5:	5d                   	pop    %ebp
+ 2b6:	c3                   	ret
+
+000002b7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2bc:	cd 40                	int    $0x40
+ 2be:	c3                   	ret
+
+000002bf <exit>:
+SYSCALL(exit)
+ 2bf:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c4:	cd 40                	int    $0x40
+ 2c6:	c3                   	ret
+
+000002c7 <wait>:
+SYSCALL(wait)
+ 2c7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2cc:	cd 40                	int    $0x40
+ 2ce:	c3                   	ret
+
+000002cf <pipe>:
+SYSCALL(pipe)
+ 2cf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d4:	cd 40                	int    $0x40
+ 2d6:	c3                   	ret
+
+000002d7 <read>:
+SYSCALL(read)
+ 2d7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2dc:	cd 40                	int    $0x40
+ 2de:	c3                   	ret
+
+000002df <write>:
+SYSCALL(write)
+ 2df:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <close>:
+SYSCALL(close)
+ 2e7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <kill>:
+SYSCALL(kill)
+ 2ef:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <exec>:
+SYSCALL(exec)
+ 2f7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <open>:
+SYSCALL(open)
+ 2ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <mknod>:
+SYSCALL(mknod)
+ 307:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <unlink>:
+SYSCALL(unlink)
+ 30f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <fstat>:
+SYSCALL(fstat)
+ 317:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <link>:
+SYSCALL(link)
+ 31f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <mkdir>:
+SYSCALL(mkdir)
+ 327:	b8 14 00 00 00       	mov    $0x14,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <chdir>:
+SYSCALL(chdir)
+ 32f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <dup>:
+SYSCALL(dup)
+ 337:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <getpid>:
+SYSCALL(getpid)
+ 33f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <sbrk>:
+SYSCALL(sbrk)
+ 347:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <sleep>:
+SYSCALL(sleep)
+ 34f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <uptime>:
+SYSCALL(uptime)
+ 357:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <halt>:
+SYSCALL(halt)
+ 35f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <date>:
+SYSCALL(date)
+ 367:	b8 17 00 00 00       	mov    $0x17,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <getuid>:
+SYSCALL(getuid)
+ 36f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <getgid>:
+SYSCALL(getgid)
+ 377:	b8 19 00 00 00       	mov    $0x19,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <getppid>:
+SYSCALL(getppid)
+ 37f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <setuid>:
+SYSCALL(setuid)
+ 387:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <setgid>:
+SYSCALL(setgid)
+ 38f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <getprocs>:
+SYSCALL(getprocs)
+ 397:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <setpriority>:
+SYSCALL(setpriority)
+ 39f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <getpriority>:
+SYSCALL(getpriority)
+ 3a7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <waitpid>:
+SYSCALL(waitpid)
+ 3af:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <setaffinity>:
+SYSCALL(setaffinity)
+ 3b7:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <getaffinity>:
+SYSCALL(getaffinity)
+ 3bf:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <setdeadline>:
+SYSCALL(setdeadline)
+ 3c7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <schedctl>:
+SYSCALL(schedctl)
+ 3cf:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <spawn>:
+SYSCALL(spawn)
+ 3d7:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3dc:	cd 40                	int    $0x40
+ 3de:	c3                   	ret
+
+000003df <vmstats>:
+SYSCALL(vmstats)
+ 3df:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 3e7:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <setshares>:
+SYSCALL(setshares)
+ 3ef:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3f4:	cd 40                	int    $0x40
+ 3f6:	c3                   	ret
+
+000003f7 <getshares>:
+SYSCALL(getshares)
+ 3f7:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3fc:	cd 40                	int    $0x40
+ 3fe:	c3                   	ret
+
+000003ff <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ff:	55                   	push   %ebp
+ 400:	89 e5                	mov    %esp,%ebp
+ 402:	57                   	push   %edi
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+ 405:	83 ec 3c             	sub    $0x3c,%esp
+ 408:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 40b:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 40d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 411:	74 79                	je     48c <printint+0x8d>
+ 413:	85 d2                	test   %edx,%edx
+ 415:	79 75                	jns    48c <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 417:	89 d1                	mov    %edx,%ecx
+ 419:	f7 d9                	neg    %ecx
+    neg = 1;
+ 41b:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 422:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 427:	89 df                	mov    %ebx,%edi
+ 429:	83 c3 01             	add    $0x1,%ebx
+ 42c:	89 c8                	mov    %ecx,%eax
+ 42e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 433:	f7 f6                	div    %esi
+ 435:	0f b6 92 14 08 00 00 	movzbl 0x814(%edx),%edx
+ 43c:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 440:	89 ca                	mov    %ecx,%edx
+ 442:	89 c1                	mov    %eax,%ecx
+ 444:	39 f2                	cmp    %esi,%edx
+ 446:	73 df                	jae    427 <printint+0x28>
+  if(neg)
+ 448:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 44c:	74 08                	je     456 <printint+0x57>
+    buf[i++] = '-';
+ 44e:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 453:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 456:	85 db                	test   %ebx,%ebx
+ 458:	7e 2a                	jle    484 <printint+0x85>
+ 45a:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 45d:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 461:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 464:	0f b6 03             	movzbl (%ebx),%eax
+ 467:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 46a:	83 ec 04             	sub    $0x4,%esp
+ 46d:	6a 01                	push   $0x1
+ 46f:	57                   	push   %edi
+ 470:	ff 75 c4             	push   -0x3c(%ebp)
+ 473:	e8 67 fe ff ff       	call   2df <write>
+  while(--i >= 0)
+ 478:	89 d8                	mov    %ebx,%eax
+ 47a:	83 eb 01             	sub    $0x1,%ebx
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	39 f0                	cmp    %esi,%eax
+ 482:	75 e0                	jne    464 <printint+0x65>
+}
+ 484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 487:	5b                   	pop    %ebx
+ 488:	5e                   	pop    %esi
+ 489:	5f                   	pop    %edi
+ 48a:	5d                   	pop    %ebp
+ 48b:	c3                   	ret
+    x = xx;
+ 48c:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 48e:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 495:	eb 8b                	jmp    422 <printint+0x23>
+
+00000497 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 497:	55                   	push   %ebp
+ 498:	89 e5                	mov    %esp,%ebp
+ 49a:	57                   	push   %edi
+ 49b:	56                   	push   %esi
+ 49c:	53                   	push   %ebx
+ 49d:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4a3:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a6:	84 db                	test   %bl,%bl
+ 4a8:	0f 84 9e 01 00 00    	je     64c <printf+0x1b5>
+ 4ae:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4b1:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4b4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4b7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4bc:	eb 2d                	jmp    4eb <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4be:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4c1:	83 ec 04             	sub    $0x4,%esp
+ 4c4:	6a 01                	push   $0x1
+ 4c6:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4c9:	50                   	push   %eax
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 0d fe ff ff       	call   2df <write>
+        putc(fd, c);
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	eb 05                	jmp    4dc <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4d7:	83 ff 25             	cmp    $0x25,%edi
+ 4da:	74 1f                	je     4fb <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4dc:	83 c6 01             	add    $0x1,%esi
+ 4df:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4e3:	84 db                	test   %bl,%bl
+ 4e5:	0f 84 61 01 00 00    	je     64c <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4eb:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ee:	85 ff                	test   %edi,%edi
+ 4f0:	75 e5                	jne    4d7 <printf+0x40>
+      if(c == '%'){
+ 4f2:	83 f8 25             	cmp    $0x25,%eax
+ 4f5:	75 c7                	jne    4be <printf+0x27>
+        state = '%';
+ 4f7:	89 c7                	mov    %eax,%edi
+ 4f9:	eb e1                	jmp    4dc <printf+0x45>
+      if(c == 'd'){
+ 4fb:	83 f8 25             	cmp    $0x25,%eax
+ 4fe:	0f 84 f4 00 00 00    	je     5f8 <printf+0x161>
+ 504:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 507:	83 fa 15             	cmp    $0x15,%edx
+ 50a:	0f 87 09 01 00 00    	ja     619 <printf+0x182>
+ 510:	0f 87 03 01 00 00    	ja     619 <printf+0x182>
+ 516:	ff 24 95 bc 07 00 00 	jmp    *0x7bc(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 51d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 520:	8b 17                	mov    (%edi),%edx
+ 522:	83 ec 0c             	sub    $0xc,%esp
+ 525:	6a 01                	push   $0x1
+ 527:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 52c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52f:	e8 cb fe ff ff       	call   3ff <printint>
+        ap++;
+ 534:	83 c7 04             	add    $0x4,%edi
+ 537:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 53a:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 53d:	bf 00 00 00 00       	mov    $0x0,%edi
+ 542:	eb 98                	jmp    4dc <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 544:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 547:	8b 17                	mov    (%edi),%edx
+ 549:	83 ec 0c             	sub    $0xc,%esp
+ 54c:	6a 00                	push   $0x0
+ 54e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	e8 a4 fe ff ff       	call   3ff <printint>
+        ap++;
+ 55b:	83 c7 04             	add    $0x4,%edi
+ 55e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 561:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 564:	bf 00 00 00 00       	mov    $0x0,%edi
+ 569:	e9 6e ff ff ff       	jmp    4dc <printf+0x45>
+        s = (char*)*ap;
+ 56e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 571:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 573:	83 c1 04             	add    $0x4,%ecx
+ 576:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 579:	85 c0                	test   %eax,%eax
+ 57b:	74 13                	je     590 <printf+0xf9>
+        s = (char*)*ap;
+ 57d:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 57f:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 582:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 587:	84 c0                	test   %al,%al
+ 589:	75 0f                	jne    59a <printf+0x103>
+ 58b:	e9 4c ff ff ff       	jmp    4dc <printf+0x45>
+          s = "(null)";
+ 590:	bb b3 07 00 00       	mov    $0x7b3,%ebx
+        while(*s != 0){
+ 595:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 59a:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 59d:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5a0:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a6:	83 ec 04             	sub    $0x4,%esp
+ 5a9:	6a 01                	push   $0x1
+ 5ab:	57                   	push   %edi
+ 5ac:	56                   	push   %esi
+ 5ad:	e8 2d fd ff ff       	call   2df <write>
+          s++;
+ 5b2:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5b5:	0f b6 03             	movzbl (%ebx),%eax
+ 5b8:	83 c4 10             	add    $0x10,%esp
+ 5bb:	84 c0                	test   %al,%al
+ 5bd:	75 e4                	jne    5a3 <printf+0x10c>
+      state = 0;
+ 5bf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5c2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c7:	e9 10 ff ff ff       	jmp    4dc <printf+0x45>
+        putc(fd, *ap);
+ 5cc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5cf:	8b 07                	mov    (%edi),%eax
+ 5d1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d4:	83 ec 04             	sub    $0x4,%esp
+ 5d7:	6a 01                	push   $0x1
+ 5d9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5dc:	50                   	push   %eax
+ 5dd:	ff 75 08             	push   0x8(%ebp)
+ 5e0:	e8 fa fc ff ff       	call   2df <write>
+        ap++;
+ 5e5:	83 c7 04             	add    $0x4,%edi
+ 5e8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5eb:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ee:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5f3:	e9 e4 fe ff ff       	jmp    4dc <printf+0x45>
+        putc(fd, c);
+ 5f8:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	6a 01                	push   $0x1
+ 600:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 603:	50                   	push   %eax
+ 604:	ff 75 08             	push   0x8(%ebp)
+ 607:	e8 d3 fc ff ff       	call   2df <write>
+ 60c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 614:	e9 c3 fe ff ff       	jmp    4dc <printf+0x45>
+        putc(fd, '%');
+ 619:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 61d:	83 ec 04             	sub    $0x4,%esp
+ 620:	6a 01                	push   $0x1
+ 622:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 625:	57                   	push   %edi
+ 626:	ff 75 08             	push   0x8(%ebp)
+ 629:	e8 b1 fc ff ff       	call   2df <write>
+        putc(fd, c);
+ 62e:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 631:	83 c4 0c             	add    $0xc,%esp
+ 634:	6a 01                	push   $0x1
+ 636:	57                   	push   %edi
+ 637:	ff 75 08             	push   0x8(%ebp)
+ 63a:	e8 a0 fc ff ff       	call   2df <write>
+        putc(fd, c);
+ 63f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 642:	bf 00 00 00 00       	mov    $0x0,%edi
+ 647:	e9 90 fe ff ff       	jmp    4dc <printf+0x45>
+    }
+  }
+}
+ 64c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64f:	5b                   	pop    %ebx
+ 650:	5e                   	pop    %esi
+ 651:	5f                   	pop    %edi
+ 652:	5d                   	pop    %ebp
+ 653:	c3                   	ret
+
+00000654 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 654:	55                   	push   %ebp
+ 655:	89 e5                	mov    %esp,%ebp
+ 657:	57                   	push   %edi
+ 658:	56                   	push   %esi
+ 659:	53                   	push   %ebx
+ 65a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 65d:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 660:	a1 b0 0a 00 00       	mov    0xab0,%eax
+ 665:	eb 0c                	jmp    673 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 667:	8b 10                	mov    (%eax),%edx
+ 669:	39 d0                	cmp    %edx,%eax
+ 66b:	72 04                	jb     671 <free+0x1d>
+ 66d:	39 d1                	cmp    %edx,%ecx
+ 66f:	72 10                	jb     681 <free+0x2d>
+{
+ 671:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 673:	39 c8                	cmp    %ecx,%eax
+ 675:	73 f0                	jae    667 <free+0x13>
+ 677:	8b 10                	mov    (%eax),%edx
+ 679:	39 d1                	cmp    %edx,%ecx
+ 67b:	72 04                	jb     681 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67d:	39 d0                	cmp    %edx,%eax
+ 67f:	72 f0                	jb     671 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 681:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 684:	8b 10                	mov    (%eax),%edx
+ 686:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 689:	39 fa                	cmp    %edi,%edx
+ 68b:	74 19                	je     6a6 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 68d:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 690:	8b 50 04             	mov    0x4(%eax),%edx
+ 693:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 696:	39 f1                	cmp    %esi,%ecx
+ 698:	74 18                	je     6b2 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 69a:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 69c:	a3 b0 0a 00 00       	mov    %eax,0xab0
+}
+ 6a1:	5b                   	pop    %ebx
+ 6a2:	5e                   	pop    %esi
+ 6a3:	5f                   	pop    %edi
+ 6a4:	5d                   	pop    %ebp
+ 6a5:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6a6:	03 72 04             	add    0x4(%edx),%esi
+ 6a9:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ac:	8b 10                	mov    (%eax),%edx
+ 6ae:	8b 12                	mov    (%edx),%edx
+ 6b0:	eb db                	jmp    68d <free+0x39>
+    p->s.size += bp->s.size;
+ 6b2:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6b5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6b8:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6bb:	eb dd                	jmp    69a <free+0x46>
+
+000006bd <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6bd:	55                   	push   %ebp
+ 6be:	89 e5                	mov    %esp,%ebp
+ 6c0:	57                   	push   %edi
+ 6c1:	56                   	push   %esi
+ 6c2:	53                   	push   %ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c9:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6cc:	c1 eb 03             	shr    $0x3,%ebx
+ 6cf:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6d2:	8b 15 b0 0a 00 00    	mov    0xab0,%edx
+ 6d8:	85 d2                	test   %edx,%edx
+ 6da:	74 1c                	je     6f8 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6dc:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6de:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6e1:	39 d9                	cmp    %ebx,%ecx
+ 6e3:	73 38                	jae    71d <malloc+0x60>
+  if(nu < 4096)
+ 6e5:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6ea:	39 f3                	cmp    %esi,%ebx
+ 6ec:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6ef:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6f6:	eb 72                	jmp    76a <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6f8:	c7 05 b0 0a 00 00 b4 	movl   $0xab4,0xab0
+ 6ff:	0a 00 00 
+ 702:	c7 05 b4 0a 00 00 b4 	movl   $0xab4,0xab4
+ 709:	0a 00 00 
+    base.s.size = 0;
+ 70c:	c7 05 b8 0a 00 00 00 	movl   $0x0,0xab8
+ 713:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 716:	b8 b4 0a 00 00       	mov    $0xab4,%eax
+    if(p->s.size >= nunits){
+ 71b:	eb c8                	jmp    6e5 <malloc+0x28>
+      if(p->s.size == nunits)
+ 71d:	39 cb                	cmp    %ecx,%ebx
+ 71f:	74 1e                	je     73f <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 721:	29 d9                	sub    %ebx,%ecx
+ 723:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 726:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 729:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 72c:	89 15 b0 0a 00 00    	mov    %edx,0xab0
+      return (void*)(p + 1);
+ 732:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 735:	89 d0                	mov    %edx,%eax
+ 737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 73a:	5b                   	pop    %ebx
+ 73b:	5e                   	pop    %esi
+ 73c:	5f                   	pop    %edi
+ 73d:	5d                   	pop    %ebp
+ 73e:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 73f:	8b 08                	mov    (%eax),%ecx
+ 741:	89 0a                	mov    %ecx,(%edx)
+ 743:	eb e7                	jmp    72c <malloc+0x6f>
+  hp->s.size = nu;
+ 745:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 748:	83 ec 0c             	sub    $0xc,%esp
+ 74b:	83 c0 08             	add    $0x8,%eax
+ 74e:	50                   	push   %eax
+ 74f:	e8 00 ff ff ff       	call   654 <free>
+  return freep;
+ 754:	8b 15 b0 0a 00 00    	mov    0xab0,%edx
+      if((p = morecore(nunits)) == 0)
+ 75a:	83 c4 10             	add    $0x10,%esp
+ 75d:	85 d2                	test   %edx,%edx
+ 75f:	74 d4                	je     735 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 761:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 763:	8b 48 04             	mov    0x4(%eax),%ecx
+ 766:	39 d9                	cmp    %ebx,%ecx
+ 768:	73 b3                	jae    71d <malloc+0x60>
+    if(p == freep)
+ 76a:	89 c2                	mov    %eax,%edx
+ 76c:	39 05 b0 0a 00 00    	cmp    %eax,0xab0
+ 772:	75 ed                	jne    761 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 774:	83 ec 0c             	sub    $0xc,%esp
+ 777:	57                   	push   %edi
+ 778:	e8 ca fb ff ff       	call   347 <sbrk>
+  if(p == (char*)-1)
+ 77d:	83 c4 10             	add    $0x10,%esp
+ 780:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 783:	75 c0                	jne    745 <malloc+0x88>
+        return 0;
+ 785:	ba 00 00 00 00       	mov    $0x0,%edx
+ 78a:	eb a9                	jmp    735 <malloc+0x78>
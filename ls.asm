@@ -0,0 +1,1525 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "fs.h"
+
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   8:	83 ec 0c             	sub    $0xc,%esp
+   b:	53                   	push   %ebx
+   c:	e8 29 03 00 00       	call   33a <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	01 d8                	add    %ebx,%eax
+  16:	72 0c                	jb     24 <fmtname+0x24>
+  18:	80 38 2f             	cmpb   $0x2f,(%eax)
+  1b:	74 07                	je     24 <fmtname+0x24>
+  1d:	83 e8 01             	sub    $0x1,%eax
+  20:	39 d8                	cmp    %ebx,%eax
+  22:	73 f4                	jae    18 <fmtname+0x18>
+    ;
+  p++;
+  24:	8d 58 01             	lea    0x1(%eax),%ebx
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  27:	83 ec 0c             	sub    $0xc,%esp
+  2a:	53                   	push   %ebx
+  2b:	e8 0a 03 00 00       	call   33a <strlen>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	83 f8 0d             	cmp    $0xd,%eax
+  36:	76 09                	jbe    41 <fmtname+0x41>
+    return p;
+  memmove(buf, p, strlen(p));
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  return buf;
+}
+  38:	89 d8                	mov    %ebx,%eax
+  3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  3d:	5b                   	pop    %ebx
+  3e:	5e                   	pop    %esi
+  3f:	5d                   	pop    %ebp
+  40:	c3                   	ret
+  memmove(buf, p, strlen(p));
+  41:	83 ec 0c             	sub    $0xc,%esp
+  44:	53                   	push   %ebx
+  45:	e8 f0 02 00 00       	call   33a <strlen>
+  4a:	83 c4 0c             	add    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	53                   	push   %ebx
+  4f:	68 c8 0d 00 00       	push   $0xdc8
+  54:	e8 c0 04 00 00       	call   519 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  59:	89 1c 24             	mov    %ebx,(%esp)
+  5c:	e8 d9 02 00 00       	call   33a <strlen>
+  61:	89 c6                	mov    %eax,%esi
+  63:	89 1c 24             	mov    %ebx,(%esp)
+  66:	e8 cf 02 00 00       	call   33a <strlen>
+  6b:	83 c4 0c             	add    $0xc,%esp
+  6e:	ba 0e 00 00 00       	mov    $0xe,%edx
+  73:	29 f2                	sub    %esi,%edx
+  75:	52                   	push   %edx
+  76:	6a 20                	push   $0x20
+  78:	05 c8 0d 00 00       	add    $0xdc8,%eax
+  7d:	50                   	push   %eax
+  7e:	e8 dd 02 00 00       	call   360 <memset>
+  return buf;
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	bb c8 0d 00 00       	mov    $0xdc8,%ebx
+  8b:	eb ab                	jmp    38 <fmtname+0x38>
+
+0000008d <ls>:
+
+void
+ls(char *path)
+{
+  8d:	55                   	push   %ebp
+  8e:	89 e5                	mov    %esp,%ebp
+  90:	57                   	push   %edi
+  91:	56                   	push   %esi
+  92:	53                   	push   %ebx
+  93:	81 ec 54 02 00 00    	sub    $0x254,%esp
+  99:	8b 75 08             	mov    0x8(%ebp),%esi
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+  9c:	6a 00                	push   $0x0
+  9e:	56                   	push   %esi
+  9f:	e8 ea 04 00 00       	call   58e <open>
+  a4:	83 c4 10             	add    $0x10,%esp
+  a7:	85 c0                	test   %eax,%eax
+  a9:	0f 88 8f 00 00 00    	js     13e <ls+0xb1>
+  af:	89 c7                	mov    %eax,%edi
+    printf(2, "ls: cannot open %s\n", path);
+    return;
+  }
+
+  if(fstat(fd, &st) < 0){
+  b1:	83 ec 08             	sub    $0x8,%esp
+  b4:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+  ba:	50                   	push   %eax
+  bb:	57                   	push   %edi
+  bc:	e8 e5 04 00 00       	call   5a6 <fstat>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	85 c0                	test   %eax,%eax
+  c6:	0f 88 87 00 00 00    	js     153 <ls+0xc6>
+    printf(2, "ls: cannot stat %s\n", path);
+    close(fd);
+    return;
+  }
+
+  switch(st.type){
+  cc:	0f b7 9d c4 fd ff ff 	movzwl -0x23c(%ebp),%ebx
+  d3:	66 83 fb 01          	cmp    $0x1,%bx
+  d7:	0f 84 93 00 00 00    	je     170 <ls+0xe3>
+  dd:	8d 43 fe             	lea    -0x2(%ebx),%eax
+  e0:	66 83 f8 01          	cmp    $0x1,%ax
+  e4:	77 44                	ja     12a <ls+0x9d>
+  case T_FILE:
+  case T_DEV:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+  e6:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  ec:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+  f2:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+  f8:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	56                   	push   %esi
+ 102:	e8 f9 fe ff ff       	call   0 <fmtname>
+ 107:	83 c4 08             	add    $0x8,%esp
+ 10a:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 110:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+  switch(st.type){
+ 116:	0f bf db             	movswl %bx,%ebx
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 119:	53                   	push   %ebx
+ 11a:	50                   	push   %eax
+ 11b:	68 44 0a 00 00       	push   $0xa44
+ 120:	6a 01                	push   $0x1
+ 122:	e8 ff 05 00 00       	call   726 <printf>
+    break;
+ 127:	83 c4 20             	add    $0x20,%esp
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+    }
+    break;
+  }
+  close(fd);
+ 12a:	83 ec 0c             	sub    $0xc,%esp
+ 12d:	57                   	push   %edi
+ 12e:	e8 43 04 00 00       	call   576 <close>
+ 133:	83 c4 10             	add    $0x10,%esp
+}
+ 136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 139:	5b                   	pop    %ebx
+ 13a:	5e                   	pop    %esi
+ 13b:	5f                   	pop    %edi
+ 13c:	5d                   	pop    %ebp
+ 13d:	c3                   	ret
+    printf(2, "ls: cannot open %s\n", path);
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	56                   	push   %esi
+ 142:	68 1c 0a 00 00       	push   $0xa1c
+ 147:	6a 02                	push   $0x2
+ 149:	e8 d8 05 00 00       	call   726 <printf>
+    return;
+ 14e:	83 c4 10             	add    $0x10,%esp
+ 151:	eb e3                	jmp    136 <ls+0xa9>
+    printf(2, "ls: cannot stat %s\n", path);
+ 153:	83 ec 04             	sub    $0x4,%esp
+ 156:	56                   	push   %esi
+ 157:	68 30 0a 00 00       	push   $0xa30
+ 15c:	6a 02                	push   $0x2
+ 15e:	e8 c3 05 00 00       	call   726 <printf>
+    close(fd);
+ 163:	89 3c 24             	mov    %edi,(%esp)
+ 166:	e8 0b 04 00 00       	call   576 <close>
+    return;
+ 16b:	83 c4 10             	add    $0x10,%esp
+ 16e:	eb c6                	jmp    136 <ls+0xa9>
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 170:	83 ec 0c             	sub    $0xc,%esp
+ 173:	56                   	push   %esi
+ 174:	e8 c1 01 00 00       	call   33a <strlen>
+ 179:	83 c0 10             	add    $0x10,%eax
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 184:	76 14                	jbe    19a <ls+0x10d>
+      printf(1, "ls: path too long\n");
+ 186:	83 ec 08             	sub    $0x8,%esp
+ 189:	68 51 0a 00 00       	push   $0xa51
+ 18e:	6a 01                	push   $0x1
+ 190:	e8 91 05 00 00       	call   726 <printf>
+      break;
+ 195:	83 c4 10             	add    $0x10,%esp
+ 198:	eb 90                	jmp    12a <ls+0x9d>
+    strcpy(buf, path);
+ 19a:	83 ec 08             	sub    $0x8,%esp
+ 19d:	56                   	push   %esi
+ 19e:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 1a4:	56                   	push   %esi
+ 1a5:	e8 41 01 00 00       	call   2eb <strcpy>
+    p = buf+strlen(buf);
+ 1aa:	89 34 24             	mov    %esi,(%esp)
+ 1ad:	e8 88 01 00 00       	call   33a <strlen>
+ 1b2:	01 c6                	add    %eax,%esi
+    *p++ = '/';
+ 1b4:	8d 46 01             	lea    0x1(%esi),%eax
+ 1b7:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+ 1bd:	c6 06 2f             	movb   $0x2f,(%esi)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1c0:	83 c4 10             	add    $0x10,%esp
+ 1c3:	8d 9d d8 fd ff ff    	lea    -0x228(%ebp),%ebx
+ 1c9:	eb 19                	jmp    1e4 <ls+0x157>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 1cb:	83 ec 04             	sub    $0x4,%esp
+ 1ce:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 1d4:	50                   	push   %eax
+ 1d5:	68 30 0a 00 00       	push   $0xa30
+ 1da:	6a 01                	push   $0x1
+ 1dc:	e8 45 05 00 00       	call   726 <printf>
+        continue;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e4:	83 ec 04             	sub    $0x4,%esp
+ 1e7:	6a 10                	push   $0x10
+ 1e9:	53                   	push   %ebx
+ 1ea:	57                   	push   %edi
+ 1eb:	e8 76 03 00 00       	call   566 <read>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	83 f8 10             	cmp    $0x10,%eax
+ 1f6:	0f 85 2e ff ff ff    	jne    12a <ls+0x9d>
+      if(de.inum == 0)
+ 1fc:	66 83 bd d8 fd ff ff 	cmpw   $0x0,-0x228(%ebp)
+ 203:	00 
+ 204:	74 de                	je     1e4 <ls+0x157>
+      memmove(p, de.name, DIRSIZ);
+ 206:	83 ec 04             	sub    $0x4,%esp
+ 209:	6a 0e                	push   $0xe
+ 20b:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+ 211:	50                   	push   %eax
+ 212:	ff b5 a8 fd ff ff    	push   -0x258(%ebp)
+ 218:	e8 fc 02 00 00       	call   519 <memmove>
+      p[DIRSIZ] = 0;
+ 21d:	c6 46 0f 00          	movb   $0x0,0xf(%esi)
+      if(stat(buf, &st) < 0){
+ 221:	83 c4 08             	add    $0x8,%esp
+ 224:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 22a:	50                   	push   %eax
+ 22b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 231:	50                   	push   %eax
+ 232:	e8 c6 01 00 00       	call   3fd <stat>
+ 237:	83 c4 10             	add    $0x10,%esp
+ 23a:	85 c0                	test   %eax,%eax
+ 23c:	78 8d                	js     1cb <ls+0x13e>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 23e:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 244:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 24a:	8b 8d cc fd ff ff    	mov    -0x234(%ebp),%ecx
+ 250:	89 8d b0 fd ff ff    	mov    %ecx,-0x250(%ebp)
+ 256:	0f bf 95 c4 fd ff ff 	movswl -0x23c(%ebp),%edx
+ 25d:	89 95 ac fd ff ff    	mov    %edx,-0x254(%ebp)
+ 263:	83 ec 0c             	sub    $0xc,%esp
+ 266:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 26c:	50                   	push   %eax
+ 26d:	e8 8e fd ff ff       	call   0 <fmtname>
+ 272:	83 c4 08             	add    $0x8,%esp
+ 275:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 27b:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+ 281:	ff b5 ac fd ff ff    	push   -0x254(%ebp)
+ 287:	50                   	push   %eax
+ 288:	68 44 0a 00 00       	push   $0xa44
+ 28d:	6a 01                	push   $0x1
+ 28f:	e8 92 04 00 00       	call   726 <printf>
+ 294:	83 c4 20             	add    $0x20,%esp
+ 297:	e9 48 ff ff ff       	jmp    1e4 <ls+0x157>
+
+0000029c <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 29c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2a0:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2a3:	ff 71 fc             	push   -0x4(%ecx)
+ 2a6:	55                   	push   %ebp
+ 2a7:	89 e5                	mov    %esp,%ebp
+ 2a9:	57                   	push   %edi
+ 2aa:	56                   	push   %esi
+ 2ab:	53                   	push   %ebx
+ 2ac:	51                   	push   %ecx
+ 2ad:	83 ec 08             	sub    $0x8,%esp
+ 2b0:	8b 31                	mov    (%ecx),%esi
+ 2b2:	8b 79 04             	mov    0x4(%ecx),%edi
+
+  if(argc < 2){
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+ 2b5:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if(argc < 2){
+ 2ba:	83 fe 01             	cmp    $0x1,%esi
+ 2bd:	7e 1a                	jle    2d9 <main+0x3d>
+    ls(argv[i]);
+ 2bf:	83 ec 0c             	sub    $0xc,%esp
+ 2c2:	ff 34 9f             	push   (%edi,%ebx,4)
+ 2c5:	e8 c3 fd ff ff       	call   8d <ls>
+  for(i=1; i<argc; i++)
+ 2ca:	83 c3 01             	add    $0x1,%ebx
+ 2cd:	83 c4 10             	add    $0x10,%esp
+ 2d0:	39 de                	cmp    %ebx,%esi
+ 2d2:	75 eb                	jne    2bf <main+0x23>
+  exit();
+ 2d4:	e8 75 02 00 00       	call   54e <exit>
+    ls(".");
+ 2d9:	83 ec 0c             	sub    $0xc,%esp
+ 2dc:	68 64 0a 00 00       	push   $0xa64
+ 2e1:	e8 a7 fd ff ff       	call   8d <ls>
+    exit();
+ 2e6:	e8 63 02 00 00       	call   54e <exit>
+
+000002eb <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2eb:	55                   	push   %ebp
+ 2ec:	89 e5                	mov    %esp,%ebp
+ 2ee:	53                   	push   %ebx
+ 2ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2f5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2fa:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2fe:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 301:	83 c0 01             	add    $0x1,%eax
+ 304:	84 d2                	test   %dl,%dl
+ 306:	75 f2                	jne    2fa <strcpy+0xf>
+    ;
+  return os;
+}
+ 308:	89 c8                	mov    %ecx,%eax
+ 30a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30d:	c9                   	leave
+ 30e:	c3                   	ret
+
+0000030f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 30f:	55                   	push   %ebp
+ 310:	89 e5                	mov    %esp,%ebp
+ 312:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 315:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 318:	0f b6 01             	movzbl (%ecx),%eax
+ 31b:	84 c0                	test   %al,%al
+ 31d:	74 11                	je     330 <strcmp+0x21>
+ 31f:	38 02                	cmp    %al,(%edx)
+ 321:	75 0d                	jne    330 <strcmp+0x21>
+    p++, q++;
+ 323:	83 c1 01             	add    $0x1,%ecx
+ 326:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 329:	0f b6 01             	movzbl (%ecx),%eax
+ 32c:	84 c0                	test   %al,%al
+ 32e:	75 ef                	jne    31f <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 c0             	movzbl %al,%eax
+ 333:	0f b6 12             	movzbl (%edx),%edx
+ 336:	29 d0                	sub    %edx,%eax
+}
+ 338:	5d                   	pop    %ebp
+ 339:	c3                   	ret
+
+0000033a <strlen>:
+
+uint
+strlen(char *s)
+{
+ 33a:	55                   	push   %ebp
+ 33b:	89 e5                	mov    %esp,%ebp
+ 33d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 340:	80 3a 00             	cmpb   $0x0,(%edx)
+ 343:	74 14                	je     359 <strlen+0x1f>
+ 345:	b8 00 00 00 00       	mov    $0x0,%eax
+ 34a:	83 c0 01             	add    $0x1,%eax
+ 34d:	89 c1                	mov    %eax,%ecx
+ 34f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 353:	75 f5                	jne    34a <strlen+0x10>
+    ;
+  return n;
+}
+ 355:	89 c8                	mov    %ecx,%eax
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 359:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 35e:	eb f5                	jmp    355 <strlen+0x1b>
+
+00000360 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 367:	89 d7                	mov    %edx,%edi
+ 369:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 36c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36f:	fc                   	cld
+ 370:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 372:	89 d0                	mov    %edx,%eax
+ 374:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 377:	c9                   	leave
+ 378:	c3                   	ret
+
+00000379 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 379:	55                   	push   %ebp
+ 37a:	89 e5                	mov    %esp,%ebp
+ 37c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 383:	0f b6 10             	movzbl (%eax),%edx
+ 386:	84 d2                	test   %dl,%dl
+ 388:	74 15                	je     39f <strchr+0x26>
+    if(*s == c)
+ 38a:	38 d1                	cmp    %dl,%cl
+ 38c:	74 0f                	je     39d <strchr+0x24>
+  for(; *s; s++)
+ 38e:	83 c0 01             	add    $0x1,%eax
+ 391:	0f b6 10             	movzbl (%eax),%edx
+ 394:	84 d2                	test   %dl,%dl
+ 396:	75 f2                	jne    38a <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 39d:	5d                   	pop    %ebp
+ 39e:	c3                   	ret
+  return 0;
+ 39f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3a4:	eb f7                	jmp    39d <strchr+0x24>
+
+000003a6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a6:	55                   	push   %ebp
+ 3a7:	89 e5                	mov    %esp,%ebp
+ 3a9:	57                   	push   %edi
+ 3aa:	56                   	push   %esi
+ 3ab:	53                   	push   %ebx
+ 3ac:	83 ec 2c             	sub    $0x2c,%esp
+ 3af:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 3b7:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 3ba:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 3bd:	83 c3 01             	add    $0x1,%ebx
+ 3c0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3c3:	7d 27                	jge    3ec <gets+0x46>
+    cc = read(0, &c, 1);
+ 3c5:	83 ec 04             	sub    $0x4,%esp
+ 3c8:	6a 01                	push   $0x1
+ 3ca:	57                   	push   %edi
+ 3cb:	6a 00                	push   $0x0
+ 3cd:	e8 94 01 00 00       	call   566 <read>
+    if(cc < 1)
+ 3d2:	83 c4 10             	add    $0x10,%esp
+ 3d5:	85 c0                	test   %eax,%eax
+ 3d7:	7e 13                	jle    3ec <gets+0x46>
+      break;
+    buf[i++] = c;
+ 3d9:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3dd:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3e1:	3c 0a                	cmp    $0xa,%al
+ 3e3:	74 04                	je     3e9 <gets+0x43>
+ 3e5:	3c 0d                	cmp    $0xd,%al
+ 3e7:	75 d1                	jne    3ba <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 3e9:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 3ec:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 3ef:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 3f3:	89 f0                	mov    %esi,%eax
+ 3f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3f8:	5b                   	pop    %ebx
+ 3f9:	5e                   	pop    %esi
+ 3fa:	5f                   	pop    %edi
+ 3fb:	5d                   	pop    %ebp
+ 3fc:	c3                   	ret
+
+000003fd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3fd:	55                   	push   %ebp
+ 3fe:	89 e5                	mov    %esp,%ebp
+ 400:	56                   	push   %esi
+ 401:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 402:	83 ec 08             	sub    $0x8,%esp
+ 405:	6a 00                	push   $0x0
+ 407:	ff 75 08             	push   0x8(%ebp)
+ 40a:	e8 7f 01 00 00       	call   58e <open>
+  if(fd < 0)
+ 40f:	83 c4 10             	add    $0x10,%esp
+ 412:	85 c0                	test   %eax,%eax
+ 414:	78 24                	js     43a <stat+0x3d>
+ 416:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 418:	83 ec 08             	sub    $0x8,%esp
+ 41b:	ff 75 0c             	push   0xc(%ebp)
+ 41e:	50                   	push   %eax
+ 41f:	e8 82 01 00 00       	call   5a6 <fstat>
+ 424:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 426:	89 1c 24             	mov    %ebx,(%esp)
+ 429:	e8 48 01 00 00       	call   576 <close>
+  return r;
+ 42e:	83 c4 10             	add    $0x10,%esp
+}
+ 431:	89 f0                	mov    %esi,%eax
+ 433:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 436:	5b                   	pop    %ebx
+ 437:	5e                   	pop    %esi
+ 438:	5d                   	pop    %ebp
+ 439:	c3                   	ret
+    return -1;
+ 43a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 43f:	eb f0                	jmp    431 <stat+0x34>
+
+00000441 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 441:	55                   	push   %ebp
+ 442:	89 e5                	mov    %esp,%ebp
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 449:	0f b6 0a             	movzbl (%edx),%ecx
+ 44c:	80 f9 20             	cmp    $0x20,%cl
+ 44f:	75 0b                	jne    45c <atoi+0x1b>
+ 451:	83 c2 01             	add    $0x1,%edx
+ 454:	0f b6 0a             	movzbl (%edx),%ecx
+ 457:	80 f9 20             	cmp    $0x20,%cl
+ 45a:	74 f5                	je     451 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 45c:	80 f9 2d             	cmp    $0x2d,%cl
+ 45f:	74 3c                	je     49d <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 461:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 464:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 469:	f6 c1 fd             	test   $0xfd,%cl
+ 46c:	74 34                	je     4a2 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 46e:	0f b6 0a             	movzbl (%edx),%ecx
+ 471:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 474:	3c 09                	cmp    $0x9,%al
+ 476:	77 2f                	ja     4a7 <atoi+0x66>
+ 478:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 47d:	83 c2 01             	add    $0x1,%edx
+ 480:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 483:	0f be c9             	movsbl %cl,%ecx
+ 486:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 48a:	0f b6 0a             	movzbl (%edx),%ecx
+ 48d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 490:	3c 09                	cmp    $0x9,%al
+ 492:	76 e9                	jbe    47d <atoi+0x3c>
+  return sign*n;
+ 494:	89 f0                	mov    %esi,%eax
+ 496:	0f af c3             	imul   %ebx,%eax
+}
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 49d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 4a2:	83 c2 01             	add    $0x1,%edx
+ 4a5:	eb c7                	jmp    46e <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 4a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4ac:	eb e6                	jmp    494 <atoi+0x53>
+
+000004ae <atoo>:
+
+int
+atoo(const char *s)
+{
+ 4ae:	55                   	push   %ebp
+ 4af:	89 e5                	mov    %esp,%ebp
+ 4b1:	56                   	push   %esi
+ 4b2:	53                   	push   %ebx
+ 4b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4b6:	0f b6 0a             	movzbl (%edx),%ecx
+ 4b9:	80 f9 20             	cmp    $0x20,%cl
+ 4bc:	75 0b                	jne    4c9 <atoo+0x1b>
+ 4be:	83 c2 01             	add    $0x1,%edx
+ 4c1:	0f b6 0a             	movzbl (%edx),%ecx
+ 4c4:	80 f9 20             	cmp    $0x20,%cl
+ 4c7:	74 f5                	je     4be <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4c9:	80 f9 2d             	cmp    $0x2d,%cl
+ 4cc:	74 3a                	je     508 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 4ce:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 4d1:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4d6:	f6 c1 fd             	test   $0xfd,%cl
+ 4d9:	74 32                	je     50d <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 4db:	0f b6 0a             	movzbl (%edx),%ecx
+ 4de:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4e1:	80 fb 07             	cmp    $0x7,%bl
+ 4e4:	77 2c                	ja     512 <atoo+0x64>
+ 4e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 4eb:	83 c2 01             	add    $0x1,%edx
+ 4ee:	0f be c9             	movsbl %cl,%ecx
+ 4f1:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 4f5:	0f b6 0a             	movzbl (%edx),%ecx
+ 4f8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4fb:	3c 07                	cmp    $0x7,%al
+ 4fd:	76 ec                	jbe    4eb <atoo+0x3d>
+  return sign*n;
+ 4ff:	89 f0                	mov    %esi,%eax
+ 501:	0f af c3             	imul   %ebx,%eax
+}
+ 504:	5b                   	pop    %ebx
+ 505:	5e                   	pop    %esi
+ 506:	5d                   	pop    %ebp
+ 507:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 508:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 50d:	83 c2 01             	add    $0x1,%edx
+ 510:	eb c9                	jmp    4db <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 512:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 517:	eb e6                	jmp    4ff <atoo+0x51>
+
+00000519 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 519:	55                   	push   %ebp
+ 51a:	89 e5                	mov    %esp,%ebp
+ 51c:	56                   	push   %esi
+ 51d:	53                   	push   %ebx
+ 51e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 521:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 524:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 527:	85 db                	test   %ebx,%ebx
+ 529:	7e 15                	jle    540 <memmove+0x27>
+ 52b:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 52d:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 52f:	83 c2 01             	add    $0x1,%edx
+ 532:	83 c0 01             	add    $0x1,%eax
+ 535:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 539:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 53c:	39 c3                	cmp    %eax,%ebx
+ 53e:	75 ef                	jne    52f <memmove+0x16>
+  return vdst;
+}
+ 540:	89 f0                	mov    %esi,%eax
+ 542:	5b                   	pop    %ebx
+ 543:	5e                   	pop    %esi
+ 544:	5d                   	pop    %ebp
+ 545:	c3                   	ret
+
+00000546 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 546:	b8 01 00 00 00       	mov    $0x1,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <exit>:
+SYSCALL(exit)
+ 54e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <wait>:
+SYSCALL(wait)
+ 556:	b8 03 00 00 00       	mov    $0x3,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <pipe>:
+SYSCALL(pipe)
+ 55e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <read>:
+SYSCALL(read)
+ 566:	b8 05 00 00 00       	mov    $0x5,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <write>:
+SYSCALL(write)
+ 56e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <close>:
+SYSCALL(close)
+ 576:	b8 15 00 00 00       	mov    $0x15,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <kill>:
+SYSCALL(kill)
+ 57e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <exec>:
+SYSCALL(exec)
+ 586:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <open>:
+SYSCALL(open)
+ 58e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <mknod>:
+SYSCALL(mknod)
+ 596:	b8 11 00 00 00       	mov    $0x11,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <unlink>:
+SYSCALL(unlink)
+ 59e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <fstat>:
+SYSCALL(fstat)
+ 5a6:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <link>:
+SYSCALL(link)
+ 5ae:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <mkdir>:
+SYSCALL(mkdir)
+ 5b6:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <chdir>:
+SYSCALL(chdir)
+ 5be:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <dup>:
+SYSCALL(dup)
+ 5c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <getpid>:
+SYSCALL(getpid)
+ 5ce:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <sbrk>:
+SYSCALL(sbrk)
+ 5d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <sleep>:
+SYSCALL(sleep)
+ 5de:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <uptime>:
+SYSCALL(uptime)
+ 5e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <halt>:
+SYSCALL(halt)
+ 5ee:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <date>:
+SYSCALL(date)
+ 5f6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <getuid>:
+SYSCALL(getuid)
+ 5fe:	b8 18 00 00 00       	mov    $0x18,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <getgid>:
+SYSCALL(getgid)
+ 606:	b8 19 00 00 00       	mov    $0x19,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <getppid>:
+SYSCALL(getppid)
+ 60e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <setuid>:
+SYSCALL(setuid)
+ 616:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <setgid>:
+SYSCALL(setgid)
+ 61e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <getprocs>:
+SYSCALL(getprocs)
+ 626:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <setpriority>:
+SYSCALL(setpriority)
+ 62e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 633:	cd 40                	int    $0x40
+ 635:	c3                   	ret
+
+00000636 <getpriority>:
+SYSCALL(getpriority)
+ 636:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <waitpid>:
+SYSCALL(waitpid)
+ 63e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 643:	cd 40                	int    $0x40
+ 645:	c3                   	ret
+
+00000646 <setaffinity>:
+SYSCALL(setaffinity)
+ 646:	b8 21 00 00 00       	mov    $0x21,%eax
+ 64b:	cd 40                	int    $0x40
+ 64d:	c3                   	ret
+
+0000064e <getaffinity>:
+SYSCALL(getaffinity)
+ 64e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 653:	cd 40                	int    $0x40
+ 655:	c3                   	ret
+
+00000656 <setdeadline>:
+SYSCALL(setdeadline)
+ 656:	b8 23 00 00 00       	mov    $0x23,%eax
+ 65b:	cd 40                	int    $0x40
+ 65d:	c3                   	ret
+
+0000065e <schedctl>:
+SYSCALL(schedctl)
+ 65e:	b8 24 00 00 00       	mov    $0x24,%eax
+ 663:	cd 40                	int    $0x40
+ 665:	c3                   	ret
+
+00000666 <spawn>:
+SYSCALL(spawn)
+ 666:	b8 25 00 00 00       	mov    $0x25,%eax
+ 66b:	cd 40                	int    $0x40
+ 66d:	c3                   	ret
+
+0000066e <vmstats>:
+SYSCALL(vmstats)
+ 66e:	b8 26 00 00 00       	mov    $0x26,%eax
+ 673:	cd 40                	int    $0x40
+ 675:	c3                   	ret
+
+00000676 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 676:	b8 27 00 00 00       	mov    $0x27,%eax
+ 67b:	cd 40                	int    $0x40
+ 67d:	c3                   	ret
+
+0000067e <setshares>:
+SYSCALL(setshares)
+ 67e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 683:	cd 40                	int    $0x40
+ 685:	c3                   	ret
+
+00000686 <getshares>:
+SYSCALL(getshares)
+ 686:	b8 29 00 00 00       	mov    $0x29,%eax
+ 68b:	cd 40                	int    $0x40
+ 68d:	c3                   	ret
+
+0000068e <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 68e:	55                   	push   %ebp
+ 68f:	89 e5                	mov    %esp,%ebp
+ 691:	57                   	push   %edi
+ 692:	56                   	push   %esi
+ 693:	53                   	push   %ebx
+ 694:	83 ec 3c             	sub    $0x3c,%esp
+ 697:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 69a:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 69c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 6a0:	74 79                	je     71b <printint+0x8d>
+ 6a2:	85 d2                	test   %edx,%edx
+ 6a4:	79 75                	jns    71b <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 6a6:	89 d1                	mov    %edx,%ecx
+ 6a8:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6aa:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 6b6:	89 df                	mov    %ebx,%edi
+ 6b8:	83 c3 01             	add    $0x1,%ebx
+ 6bb:	89 c8                	mov    %ecx,%eax
+ 6bd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c2:	f7 f6                	div    %esi
+ 6c4:	0f b6 92 c8 0a 00 00 	movzbl 0xac8(%edx),%edx
+ 6cb:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 6cf:	89 ca                	mov    %ecx,%edx
+ 6d1:	89 c1                	mov    %eax,%ecx
+ 6d3:	39 f2                	cmp    %esi,%edx
+ 6d5:	73 df                	jae    6b6 <printint+0x28>
+  if(neg)
+ 6d7:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 6db:	74 08                	je     6e5 <printint+0x57>
+    buf[i++] = '-';
+ 6dd:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 6e2:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 6e5:	85 db                	test   %ebx,%ebx
+ 6e7:	7e 2a                	jle    713 <printint+0x85>
+ 6e9:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 6ec:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 6f0:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+ 6f6:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 6f9:	83 ec 04             	sub    $0x4,%esp
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	57                   	push   %edi
+ 6ff:	ff 75 c4             	push   -0x3c(%ebp)
+ 702:	e8 67 fe ff ff       	call   56e <write>
+  while(--i >= 0)
+ 707:	89 d8                	mov    %ebx,%eax
+ 709:	83 eb 01             	sub    $0x1,%ebx
+ 70c:	83 c4 10             	add    $0x10,%esp
+ 70f:	39 f0                	cmp    %esi,%eax
+ 711:	75 e0                	jne    6f3 <printint+0x65>
+}
+ 713:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 716:	5b                   	pop    %ebx
+ 717:	5e                   	pop    %esi
+ 718:	5f                   	pop    %edi
+ 719:	5d                   	pop    %ebp
+ 71a:	c3                   	ret
+    x = xx;
+ 71b:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 71d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 724:	eb 8b                	jmp    6b1 <printint+0x23>
+
+00000726 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 726:	55                   	push   %ebp
+ 727:	89 e5                	mov    %esp,%ebp
+ 729:	57                   	push   %edi
+ 72a:	56                   	push   %esi
+ 72b:	53                   	push   %ebx
+ 72c:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 72f:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 732:	0f b6 1e             	movzbl (%esi),%ebx
+ 735:	84 db                	test   %bl,%bl
+ 737:	0f 84 9e 01 00 00    	je     8db <printf+0x1b5>
+ 73d:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 740:	8d 45 10             	lea    0x10(%ebp),%eax
+ 743:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 746:	bf 00 00 00 00       	mov    $0x0,%edi
+ 74b:	eb 2d                	jmp    77a <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 74d:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	6a 01                	push   $0x1
+ 755:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 758:	50                   	push   %eax
+ 759:	ff 75 08             	push   0x8(%ebp)
+ 75c:	e8 0d fe ff ff       	call   56e <write>
+        putc(fd, c);
+ 761:	83 c4 10             	add    $0x10,%esp
+ 764:	eb 05                	jmp    76b <printf+0x45>
+      }
+    } else if(state == '%'){
+ 766:	83 ff 25             	cmp    $0x25,%edi
+ 769:	74 1f                	je     78a <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 76b:	83 c6 01             	add    $0x1,%esi
+ 76e:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 772:	84 db                	test   %bl,%bl
+ 774:	0f 84 61 01 00 00    	je     8db <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 77a:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 77d:	85 ff                	test   %edi,%edi
+ 77f:	75 e5                	jne    766 <printf+0x40>
+      if(c == '%'){
+ 781:	83 f8 25             	cmp    $0x25,%eax
+ 784:	75 c7                	jne    74d <printf+0x27>
+        state = '%';
+ 786:	89 c7                	mov    %eax,%edi
+ 788:	eb e1                	jmp    76b <printf+0x45>
+      if(c == 'd'){
+ 78a:	83 f8 25             	cmp    $0x25,%eax
+ 78d:	0f 84 f4 00 00 00    	je     887 <printf+0x161>
+ 793:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 796:	83 fa 15             	cmp    $0x15,%edx
+ 799:	0f 87 09 01 00 00    	ja     8a8 <printf+0x182>
+ 79f:	0f 87 03 01 00 00    	ja     8a8 <printf+0x182>
+ 7a5:	ff 24 95 70 0a 00 00 	jmp    *0xa70(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 7ac:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7af:	8b 17                	mov    (%edi),%edx
+ 7b1:	83 ec 0c             	sub    $0xc,%esp
+ 7b4:	6a 01                	push   $0x1
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7be:	e8 cb fe ff ff       	call   68e <printint>
+        ap++;
+ 7c3:	83 c7 04             	add    $0x4,%edi
+ 7c6:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 7c9:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 7cc:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7d1:	eb 98                	jmp    76b <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 7d3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7d6:	8b 17                	mov    (%edi),%edx
+ 7d8:	83 ec 0c             	sub    $0xc,%esp
+ 7db:	6a 00                	push   $0x0
+ 7dd:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e5:	e8 a4 fe ff ff       	call   68e <printint>
+        ap++;
+ 7ea:	83 c7 04             	add    $0x4,%edi
+ 7ed:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 7f0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7f3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7f8:	e9 6e ff ff ff       	jmp    76b <printf+0x45>
+        s = (char*)*ap;
+ 7fd:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 800:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 802:	83 c1 04             	add    $0x4,%ecx
+ 805:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 808:	85 c0                	test   %eax,%eax
+ 80a:	74 13                	je     81f <printf+0xf9>
+        s = (char*)*ap;
+ 80c:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 80e:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 811:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 816:	84 c0                	test   %al,%al
+ 818:	75 0f                	jne    829 <printf+0x103>
+ 81a:	e9 4c ff ff ff       	jmp    76b <printf+0x45>
+          s = "(null)";
+ 81f:	bb 66 0a 00 00       	mov    $0xa66,%ebx
+        while(*s != 0){
+ 824:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 829:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 82c:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 82f:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 832:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 835:	83 ec 04             	sub    $0x4,%esp
+ 838:	6a 01                	push   $0x1
+ 83a:	57                   	push   %edi
+ 83b:	56                   	push   %esi
+ 83c:	e8 2d fd ff ff       	call   56e <write>
+          s++;
+ 841:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 844:	0f b6 03             	movzbl (%ebx),%eax
+ 847:	83 c4 10             	add    $0x10,%esp
+ 84a:	84 c0                	test   %al,%al
+ 84c:	75 e4                	jne    832 <printf+0x10c>
+      state = 0;
+ 84e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 851:	bf 00 00 00 00       	mov    $0x0,%edi
+ 856:	e9 10 ff ff ff       	jmp    76b <printf+0x45>
+        putc(fd, *ap);
+ 85b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 85e:	8b 07                	mov    (%edi),%eax
+ 860:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 863:	83 ec 04             	sub    $0x4,%esp
+ 866:	6a 01                	push   $0x1
+ 868:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 86b:	50                   	push   %eax
+ 86c:	ff 75 08             	push   0x8(%ebp)
+ 86f:	e8 fa fc ff ff       	call   56e <write>
+        ap++;
+ 874:	83 c7 04             	add    $0x4,%edi
+ 877:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 87a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87d:	bf 00 00 00 00       	mov    $0x0,%edi
+ 882:	e9 e4 fe ff ff       	jmp    76b <printf+0x45>
+        putc(fd, c);
+ 887:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 88a:	83 ec 04             	sub    $0x4,%esp
+ 88d:	6a 01                	push   $0x1
+ 88f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 892:	50                   	push   %eax
+ 893:	ff 75 08             	push   0x8(%ebp)
+ 896:	e8 d3 fc ff ff       	call   56e <write>
+ 89b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8a3:	e9 c3 fe ff ff       	jmp    76b <printf+0x45>
+        putc(fd, '%');
+ 8a8:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8ac:	83 ec 04             	sub    $0x4,%esp
+ 8af:	6a 01                	push   $0x1
+ 8b1:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 8b4:	57                   	push   %edi
+ 8b5:	ff 75 08             	push   0x8(%ebp)
+ 8b8:	e8 b1 fc ff ff       	call   56e <write>
+        putc(fd, c);
+ 8bd:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c0:	83 c4 0c             	add    $0xc,%esp
+ 8c3:	6a 01                	push   $0x1
+ 8c5:	57                   	push   %edi
+ 8c6:	ff 75 08             	push   0x8(%ebp)
+ 8c9:	e8 a0 fc ff ff       	call   56e <write>
+        putc(fd, c);
+ 8ce:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8d1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8d6:	e9 90 fe ff ff       	jmp    76b <printf+0x45>
+    }
+  }
+}
+ 8db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8de:	5b                   	pop    %ebx
+ 8df:	5e                   	pop    %esi
+ 8e0:	5f                   	pop    %edi
+ 8e1:	5d                   	pop    %ebp
+ 8e2:	c3                   	ret
+
+000008e3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8e3:	55                   	push   %ebp
+ 8e4:	89 e5                	mov    %esp,%ebp
+ 8e6:	57                   	push   %edi
+ 8e7:	56                   	push   %esi
+ 8e8:	53                   	push   %ebx
+ 8e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8ec:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ef:	a1 d8 0d 00 00       	mov    0xdd8,%eax
+ 8f4:	eb 0c                	jmp    902 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f6:	8b 10                	mov    (%eax),%edx
+ 8f8:	39 d0                	cmp    %edx,%eax
+ 8fa:	72 04                	jb     900 <free+0x1d>
+ 8fc:	39 d1                	cmp    %edx,%ecx
+ 8fe:	72 10                	jb     910 <free+0x2d>
+{
+ 900:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 902:	39 c8                	cmp    %ecx,%eax
+ 904:	73 f0                	jae    8f6 <free+0x13>
+ 906:	8b 10                	mov    (%eax),%edx
+ 908:	39 d1                	cmp    %edx,%ecx
+ 90a:	72 04                	jb     910 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 90c:	39 d0                	cmp    %edx,%eax
+ 90e:	72 f0                	jb     900 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 910:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 913:	8b 10                	mov    (%eax),%edx
+ 915:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 918:	39 fa                	cmp    %edi,%edx
+ 91a:	74 19                	je     935 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 91c:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 91f:	8b 50 04             	mov    0x4(%eax),%edx
+ 922:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 925:	39 f1                	cmp    %esi,%ecx
+ 927:	74 18                	je     941 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 929:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 92b:	a3 d8 0d 00 00       	mov    %eax,0xdd8
+}
+ 930:	5b                   	pop    %ebx
+ 931:	5e                   	pop    %esi
+ 932:	5f                   	pop    %edi
+ 933:	5d                   	pop    %ebp
+ 934:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 935:	03 72 04             	add    0x4(%edx),%esi
+ 938:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 93b:	8b 10                	mov    (%eax),%edx
+ 93d:	8b 12                	mov    (%edx),%edx
+ 93f:	eb db                	jmp    91c <free+0x39>
+    p->s.size += bp->s.size;
+ 941:	03 53 fc             	add    -0x4(%ebx),%edx
+ 944:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 947:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 94a:	eb dd                	jmp    929 <free+0x46>
+
+0000094c <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 94c:	55                   	push   %ebp
+ 94d:	89 e5                	mov    %esp,%ebp
+ 94f:	57                   	push   %edi
+ 950:	56                   	push   %esi
+ 951:	53                   	push   %ebx
+ 952:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 955:	8b 45 08             	mov    0x8(%ebp),%eax
+ 958:	8d 58 07             	lea    0x7(%eax),%ebx
+ 95b:	c1 eb 03             	shr    $0x3,%ebx
+ 95e:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 961:	8b 15 d8 0d 00 00    	mov    0xdd8,%edx
+ 967:	85 d2                	test   %edx,%edx
+ 969:	74 1c                	je     987 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 96b:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 96d:	8b 48 04             	mov    0x4(%eax),%ecx
+ 970:	39 d9                	cmp    %ebx,%ecx
+ 972:	73 38                	jae    9ac <malloc+0x60>
+  if(nu < 4096)
+ 974:	be 00 10 00 00       	mov    $0x1000,%esi
+ 979:	39 f3                	cmp    %esi,%ebx
+ 97b:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 97e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 985:	eb 72                	jmp    9f9 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 987:	c7 05 d8 0d 00 00 dc 	movl   $0xddc,0xdd8
+ 98e:	0d 00 00 
+ 991:	c7 05 dc 0d 00 00 dc 	movl   $0xddc,0xddc
+ 998:	0d 00 00 
+    base.s.size = 0;
+ 99b:	c7 05 e0 0d 00 00 00 	movl   $0x0,0xde0
+ 9a2:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a5:	b8 dc 0d 00 00       	mov    $0xddc,%eax
+    if(p->s.size >= nunits){
+ 9aa:	eb c8                	jmp    974 <malloc+0x28>
+      if(p->s.size == nunits)
+ 9ac:	39 cb                	cmp    %ecx,%ebx
+ 9ae:	74 1e                	je     9ce <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 9b0:	29 d9                	sub    %ebx,%ecx
+ 9b2:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9b5:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9b8:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 9bb:	89 15 d8 0d 00 00    	mov    %edx,0xdd8
+      return (void*)(p + 1);
+ 9c1:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 9c4:	89 d0                	mov    %edx,%eax
+ 9c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9c9:	5b                   	pop    %ebx
+ 9ca:	5e                   	pop    %esi
+ 9cb:	5f                   	pop    %edi
+ 9cc:	5d                   	pop    %ebp
+ 9cd:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 9ce:	8b 08                	mov    (%eax),%ecx
+ 9d0:	89 0a                	mov    %ecx,(%edx)
+ 9d2:	eb e7                	jmp    9bb <malloc+0x6f>
+  hp->s.size = nu;
+ 9d4:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 9d7:	83 ec 0c             	sub    $0xc,%esp
+ 9da:	83 c0 08             	add    $0x8,%eax
+ 9dd:	50                   	push   %eax
+ 9de:	e8 00 ff ff ff       	call   8e3 <free>
+  return freep;
+ 9e3:	8b 15 d8 0d 00 00    	mov    0xdd8,%edx
+      if((p = morecore(nunits)) == 0)
+ 9e9:	83 c4 10             	add    $0x10,%esp
+ 9ec:	85 d2                	test   %edx,%edx
+ 9ee:	74 d4                	je     9c4 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9f5:	39 d9                	cmp    %ebx,%ecx
+ 9f7:	73 b3                	jae    9ac <malloc+0x60>
+    if(p == freep)
+ 9f9:	89 c2                	mov    %eax,%edx
+ 9fb:	39 05 d8 0d 00 00    	cmp    %eax,0xdd8
+ a01:	75 ed                	jne    9f0 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	57                   	push   %edi
+ a07:	e8 ca fb ff ff       	call   5d6 <sbrk>
+  if(p == (char*)-1)
+ a0c:	83 c4 10             	add    $0x10,%esp
+ a0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a12:	75 c0                	jne    9d4 <malloc+0x88>
+        return 0;
+ a14:	ba 00 00 00 00       	mov    $0x0,%edx
+ a19:	eb a9                	jmp    9c4 <malloc+0x78>
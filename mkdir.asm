@@ -0,0 +1,1259 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int i;
+
+  if(argc < 2){
+  19:	83 c3 04             	add    $0x4,%ebx
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  1c:	be 01 00 00 00       	mov    $0x1,%esi
+  if(argc < 2){
+  21:	83 ff 01             	cmp    $0x1,%edi
+  24:	7e 1d                	jle    43 <main+0x43>
+    if(mkdir(argv[i]) < 0){
+  26:	83 ec 0c             	sub    $0xc,%esp
+  29:	ff 33                	push   (%ebx)
+  2b:	e8 0b 03 00 00       	call   33b <mkdir>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	85 c0                	test   %eax,%eax
+  35:	78 20                	js     57 <main+0x57>
+  for(i = 1; i < argc; i++){
+  37:	83 c6 01             	add    $0x1,%esi
+  3a:	83 c3 04             	add    $0x4,%ebx
+  3d:	39 f7                	cmp    %esi,%edi
+  3f:	75 e5                	jne    26 <main+0x26>
+  41:	eb 28                	jmp    6b <main+0x6b>
+    printf(2, "Usage: mkdir files...\n");
+  43:	83 ec 08             	sub    $0x8,%esp
+  46:	68 a0 07 00 00       	push   $0x7a0
+  4b:	6a 02                	push   $0x2
+  4d:	e8 59 04 00 00       	call   4ab <printf>
+    exit();
+  52:	e8 7c 02 00 00       	call   2d3 <exit>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  57:	83 ec 04             	sub    $0x4,%esp
+  5a:	ff 33                	push   (%ebx)
+  5c:	68 b7 07 00 00       	push   $0x7b7
+  61:	6a 02                	push   $0x2
+  63:	e8 43 04 00 00       	call   4ab <printf>
+      break;
+  68:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  6b:	e8 63 02 00 00       	call   2d3 <exit>
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	53                   	push   %ebx
+  74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  7f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  83:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  86:	83 c0 01             	add    $0x1,%eax
+  89:	84 d2                	test   %dl,%dl
+  8b:	75 f2                	jne    7f <strcpy+0xf>
+    ;
+  return os;
+}
+  8d:	89 c8                	mov    %ecx,%eax
+  8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  92:	c9                   	leave
+  93:	c3                   	ret
+
+00000094 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  94:	55                   	push   %ebp
+  95:	89 e5                	mov    %esp,%ebp
+  97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  9d:	0f b6 01             	movzbl (%ecx),%eax
+  a0:	84 c0                	test   %al,%al
+  a2:	74 11                	je     b5 <strcmp+0x21>
+  a4:	38 02                	cmp    %al,(%edx)
+  a6:	75 0d                	jne    b5 <strcmp+0x21>
+    p++, q++;
+  a8:	83 c1 01             	add    $0x1,%ecx
+  ab:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  ae:	0f b6 01             	movzbl (%ecx),%eax
+  b1:	84 c0                	test   %al,%al
+  b3:	75 ef                	jne    a4 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  b5:	0f b6 c0             	movzbl %al,%eax
+  b8:	0f b6 12             	movzbl (%edx),%edx
+  bb:	29 d0                	sub    %edx,%eax
+}
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+
+000000bf <strlen>:
+
+uint
+strlen(char *s)
+{
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c5:	80 3a 00             	cmpb   $0x0,(%edx)
+  c8:	74 14                	je     de <strlen+0x1f>
+  ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  cf:	83 c0 01             	add    $0x1,%eax
+  d2:	89 c1                	mov    %eax,%ecx
+  d4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d8:	75 f5                	jne    cf <strlen+0x10>
+    ;
+  return n;
+}
+  da:	89 c8                	mov    %ecx,%eax
+  dc:	5d                   	pop    %ebp
+  dd:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  e3:	eb f5                	jmp    da <strlen+0x1b>
+
+000000e5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e5:	55                   	push   %ebp
+  e6:	89 e5                	mov    %esp,%ebp
+  e8:	57                   	push   %edi
+  e9:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  ec:	89 d7                	mov    %edx,%edi
+  ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f4:	fc                   	cld
+  f5:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  f7:	89 d0                	mov    %edx,%eax
+  f9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  fc:	c9                   	leave
+  fd:	c3                   	ret
+
+000000fe <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  fe:	55                   	push   %ebp
+  ff:	89 e5                	mov    %esp,%ebp
+ 101:	8b 45 08             	mov    0x8(%ebp),%eax
+ 104:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 108:	0f b6 10             	movzbl (%eax),%edx
+ 10b:	84 d2                	test   %dl,%dl
+ 10d:	74 15                	je     124 <strchr+0x26>
+    if(*s == c)
+ 10f:	38 d1                	cmp    %dl,%cl
+ 111:	74 0f                	je     122 <strchr+0x24>
+  for(; *s; s++)
+ 113:	83 c0 01             	add    $0x1,%eax
+ 116:	0f b6 10             	movzbl (%eax),%edx
+ 119:	84 d2                	test   %dl,%dl
+ 11b:	75 f2                	jne    10f <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 11d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 122:	5d                   	pop    %ebp
+ 123:	c3                   	ret
+  return 0;
+ 124:	b8 00 00 00 00       	mov    $0x0,%eax
+ 129:	eb f7                	jmp    122 <strchr+0x24>
+
+0000012b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 12b:	55                   	push   %ebp
+ 12c:	89 e5                	mov    %esp,%ebp
+ 12e:	57                   	push   %edi
+ 12f:	56                   	push   %esi
+ 130:	53                   	push   %ebx
+ 131:	83 ec 2c             	sub    $0x2c,%esp
+ 134:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 137:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 13c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 13f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 142:	83 c3 01             	add    $0x1,%ebx
+ 145:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 148:	7d 27                	jge    171 <gets+0x46>
+    cc = read(0, &c, 1);
+ 14a:	83 ec 04             	sub    $0x4,%esp
+ 14d:	6a 01                	push   $0x1
+ 14f:	57                   	push   %edi
+ 150:	6a 00                	push   $0x0
+ 152:	e8 94 01 00 00       	call   2eb <read>
+    if(cc < 1)
+ 157:	83 c4 10             	add    $0x10,%esp
+ 15a:	85 c0                	test   %eax,%eax
+ 15c:	7e 13                	jle    171 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 15e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 162:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 166:	3c 0a                	cmp    $0xa,%al
+ 168:	74 04                	je     16e <gets+0x43>
+ 16a:	3c 0d                	cmp    $0xd,%al
+ 16c:	75 d1                	jne    13f <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 16e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 171:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 174:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 178:	89 f0                	mov    %esi,%eax
+ 17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 17d:	5b                   	pop    %ebx
+ 17e:	5e                   	pop    %esi
+ 17f:	5f                   	pop    %edi
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+
+00000182 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 182:	55                   	push   %ebp
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	56                   	push   %esi
+ 186:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 187:	83 ec 08             	sub    $0x8,%esp
+ 18a:	6a 00                	push   $0x0
+ 18c:	ff 75 08             	push   0x8(%ebp)
+ 18f:	e8 7f 01 00 00       	call   313 <open>
+  if(fd < 0)
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 c0                	test   %eax,%eax
+ 199:	78 24                	js     1bf <stat+0x3d>
+ 19b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 19d:	83 ec 08             	sub    $0x8,%esp
+ 1a0:	ff 75 0c             	push   0xc(%ebp)
+ 1a3:	50                   	push   %eax
+ 1a4:	e8 82 01 00 00       	call   32b <fstat>
+ 1a9:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ab:	89 1c 24             	mov    %ebx,(%esp)
+ 1ae:	e8 48 01 00 00       	call   2fb <close>
+  return r;
+ 1b3:	83 c4 10             	add    $0x10,%esp
+}
+ 1b6:	89 f0                	mov    %esi,%eax
+ 1b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1bb:	5b                   	pop    %ebx
+ 1bc:	5e                   	pop    %esi
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+    return -1;
+ 1bf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1c4:	eb f0                	jmp    1b6 <stat+0x34>
+
+000001c6 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1c6:	55                   	push   %ebp
+ 1c7:	89 e5                	mov    %esp,%ebp
+ 1c9:	56                   	push   %esi
+ 1ca:	53                   	push   %ebx
+ 1cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1ce:	0f b6 0a             	movzbl (%edx),%ecx
+ 1d1:	80 f9 20             	cmp    $0x20,%cl
+ 1d4:	75 0b                	jne    1e1 <atoi+0x1b>
+ 1d6:	83 c2 01             	add    $0x1,%edx
+ 1d9:	0f b6 0a             	movzbl (%edx),%ecx
+ 1dc:	80 f9 20             	cmp    $0x20,%cl
+ 1df:	74 f5                	je     1d6 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1e1:	80 f9 2d             	cmp    $0x2d,%cl
+ 1e4:	74 3c                	je     222 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 1e6:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1e9:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1ee:	f6 c1 fd             	test   $0xfd,%cl
+ 1f1:	74 34                	je     227 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1f3:	0f b6 0a             	movzbl (%edx),%ecx
+ 1f6:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1f9:	3c 09                	cmp    $0x9,%al
+ 1fb:	77 2f                	ja     22c <atoi+0x66>
+ 1fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 202:	83 c2 01             	add    $0x1,%edx
+ 205:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 208:	0f be c9             	movsbl %cl,%ecx
+ 20b:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 20f:	0f b6 0a             	movzbl (%edx),%ecx
+ 212:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 215:	3c 09                	cmp    $0x9,%al
+ 217:	76 e9                	jbe    202 <atoi+0x3c>
+  return sign*n;
+ 219:	89 f0                	mov    %esi,%eax
+ 21b:	0f af c3             	imul   %ebx,%eax
+}
+ 21e:	5b                   	pop    %ebx
+ 21f:	5e                   	pop    %esi
+ 220:	5d                   	pop    %ebp
+ 221:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 222:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 227:	83 c2 01             	add    $0x1,%edx
+ 22a:	eb c7                	jmp    1f3 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 22c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 231:	eb e6                	jmp    219 <atoi+0x53>
+
+00000233 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 233:	55                   	push   %ebp
+ 234:	89 e5                	mov    %esp,%ebp
+ 236:	56                   	push   %esi
+ 237:	53                   	push   %ebx
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 23b:	0f b6 0a             	movzbl (%edx),%ecx
+ 23e:	80 f9 20             	cmp    $0x20,%cl
+ 241:	75 0b                	jne    24e <atoo+0x1b>
+ 243:	83 c2 01             	add    $0x1,%edx
+ 246:	0f b6 0a             	movzbl (%edx),%ecx
+ 249:	80 f9 20             	cmp    $0x20,%cl
+ 24c:	74 f5                	je     243 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 24e:	80 f9 2d             	cmp    $0x2d,%cl
+ 251:	74 3a                	je     28d <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 253:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 256:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 25b:	f6 c1 fd             	test   $0xfd,%cl
+ 25e:	74 32                	je     292 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 260:	0f b6 0a             	movzbl (%edx),%ecx
+ 263:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 266:	80 fb 07             	cmp    $0x7,%bl
+ 269:	77 2c                	ja     297 <atoo+0x64>
+ 26b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	0f be c9             	movsbl %cl,%ecx
+ 276:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 27a:	0f b6 0a             	movzbl (%edx),%ecx
+ 27d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 280:	3c 07                	cmp    $0x7,%al
+ 282:	76 ec                	jbe    270 <atoo+0x3d>
+  return sign*n;
+ 284:	89 f0                	mov    %esi,%eax
+ 286:	0f af c3             	imul   %ebx,%eax
+}
+ 289:	5b                   	pop    %ebx
+ 28a:	5e                   	pop    %esi
+ 28b:	5d                   	pop    %ebp
+ 28c:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 28d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 292:	83 c2 01             	add    $0x1,%edx
+ 295:	eb c9                	jmp    260 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 297:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 29c:	eb e6                	jmp    284 <atoo+0x51>
+
+0000029e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 29e:	55                   	push   %ebp
+ 29f:	89 e5                	mov    %esp,%ebp
+ 2a1:	56                   	push   %esi
+ 2a2:	53                   	push   %ebx
+ 2a3:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ac:	85 db                	test   %ebx,%ebx
+ 2ae:	7e 15                	jle    2c5 <memmove+0x27>
+ 2b0:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2b2:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2b4:	83 c2 01             	add    $0x1,%edx
+ 2b7:	83 c0 01             	add    $0x1,%eax
+ 2ba:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2be:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2c1:	39 c3                	cmp    %eax,%ebx
+ 2c3:	75 ef                	jne    2b4 <memmove+0x16>
+  return vdst;
+}
+ 2c5:	89 f0                	mov    %esi,%eax
+ 2c7:	5b                   	pop    %ebx
+ 2c8:	5e                   	pop    %esi
+ 2c9:	5d                   	pop    %ebp
+ 2ca:	c3                   	ret
+
+000002cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <exit>:
+SYSCALL(exit)
+ 2d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <wait>:
+SYSCALL(wait)
+ 2db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <pipe>:
+SYSCALL(pipe)
+ 2e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <read>:
+SYSCALL(read)
+ 2eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <write>:
+SYSCALL(write)
+ 2f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <close>:
+SYSCALL(close)
+ 2fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <kill>:
+SYSCALL(kill)
+ 303:	b8 06 00 00 00       	mov    $0x6,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <exec>:
+SYSCALL(exec)
+ 30b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <open>:
+SYSCALL(open)
+ 313:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mknod>:
+SYSCALL(mknod)
+ 31b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <unlink>:
+SYSCALL(unlink)
+ 323:	b8 12 00 00 00       	mov    $0x12,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <fstat>:
+SYSCALL(fstat)
+ 32b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <link>:
+SYSCALL(link)
+ 333:	b8 13 00 00 00       	mov    $0x13,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <mkdir>:
+SYSCALL(mkdir)
+ 33b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <chdir>:
+SYSCALL(chdir)
+ 343:	b8 09 00 00 00       	mov    $0x9,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <dup>:
+SYSCALL(dup)
+ 34b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getpid>:
+SYSCALL(getpid)
+ 353:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <sbrk>:
+SYSCALL(sbrk)
+ 35b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <sleep>:
+SYSCALL(sleep)
+ 363:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <uptime>:
+SYSCALL(uptime)
+ 36b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <halt>:
+SYSCALL(halt)
+ 373:	b8 16 00 00 00       	mov    $0x16,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <date>:
+SYSCALL(date)
+ 37b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getuid>:
+SYSCALL(getuid)
+ 383:	b8 18 00 00 00       	mov    $0x18,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <getgid>:
+SYSCALL(getgid)
+ 38b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <getppid>:
+SYSCALL(getppid)
+ 393:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <setuid>:
+SYSCALL(setuid)
+ 39b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <setgid>:
+SYSCALL(setgid)
+ 3a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getprocs>:
+SYSCALL(getprocs)
+ 3ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <setpriority>:
+SYSCALL(setpriority)
+ 3b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getpriority>:
+SYSCALL(getpriority)
+ 3bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <waitpid>:
+SYSCALL(waitpid)
+ 3c3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <setaffinity>:
+SYSCALL(setaffinity)
+ 3cb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <getaffinity>:
+SYSCALL(getaffinity)
+ 3d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <setdeadline>:
+SYSCALL(setdeadline)
+ 3db:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <schedctl>:
+SYSCALL(schedctl)
+ 3e3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <spawn>:
+SYSCALL(spawn)
+ 3eb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <vmstats>:
+SYSCALL(vmstats)
+ 3f3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <hugesbrk>:
+SYSCALL(hugesbrk)
+ 3fb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <setshares>:
+SYSCALL(setshares)
+ 403:	b8 28 00 00 00       	mov    $0x28,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getshares>:
+SYSCALL(getshares)
+ 40b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 413:	55                   	push   %ebp
+ 414:	89 e5                	mov    %esp,%ebp
+ 416:	57                   	push   %edi
+ 417:	56                   	push   %esi
+ 418:	53                   	push   %ebx
+ 419:	83 ec 3c             	sub    $0x3c,%esp
+ 41c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 41f:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 421:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 425:	74 79                	je     4a0 <printint+0x8d>
+ 427:	85 d2                	test   %edx,%edx
+ 429:	79 75                	jns    4a0 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 42b:	89 d1                	mov    %edx,%ecx
+ 42d:	f7 d9                	neg    %ecx
+    neg = 1;
+ 42f:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 43b:	89 df                	mov    %ebx,%edi
+ 43d:	83 c3 01             	add    $0x1,%ebx
+ 440:	89 c8                	mov    %ecx,%eax
+ 442:	ba 00 00 00 00       	mov    $0x0,%edx
+ 447:	f7 f6                	div    %esi
+ 449:	0f b6 92 34 08 00 00 	movzbl 0x834(%edx),%edx
+ 450:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 454:	89 ca                	mov    %ecx,%edx
+ 456:	89 c1                	mov    %eax,%ecx
+ 458:	39 f2                	cmp    %esi,%edx
+ 45a:	73 df                	jae    43b <printint+0x28>
+  if(neg)
+ 45c:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 460:	74 08                	je     46a <printint+0x57>
+    buf[i++] = '-';
+ 462:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 467:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 46a:	85 db                	test   %ebx,%ebx
+ 46c:	7e 2a                	jle    498 <printint+0x85>
+ 46e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 471:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 475:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 478:	0f b6 03             	movzbl (%ebx),%eax
+ 47b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 47e:	83 ec 04             	sub    $0x4,%esp
+ 481:	6a 01                	push   $0x1
+ 483:	57                   	push   %edi
+ 484:	ff 75 c4             	push   -0x3c(%ebp)
+ 487:	e8 67 fe ff ff       	call   2f3 <write>
+  while(--i >= 0)
+ 48c:	89 d8                	mov    %ebx,%eax
+ 48e:	83 eb 01             	sub    $0x1,%ebx
+ 491:	83 c4 10             	add    $0x10,%esp
+ 494:	39 f0                	cmp    %esi,%eax
+ 496:	75 e0                	jne    478 <printint+0x65>
+}
+ 498:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49b:	5b                   	pop    %ebx
+ 49c:	5e                   	pop    %esi
+ 49d:	5f                   	pop    %edi
+ 49e:	5d                   	pop    %ebp
+ 49f:	c3                   	ret
+    x = xx;
+ 4a0:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 4a2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 4a9:	eb 8b                	jmp    436 <printint+0x23>
+
+000004ab <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4ab:	55                   	push   %ebp
+ 4ac:	89 e5                	mov    %esp,%ebp
+ 4ae:	57                   	push   %edi
+ 4af:	56                   	push   %esi
+ 4b0:	53                   	push   %ebx
+ 4b1:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4b7:	0f b6 1e             	movzbl (%esi),%ebx
+ 4ba:	84 db                	test   %bl,%bl
+ 4bc:	0f 84 9e 01 00 00    	je     660 <printf+0x1b5>
+ 4c2:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4c5:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4c8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4cb:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4d0:	eb 2d                	jmp    4ff <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4d2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4d5:	83 ec 04             	sub    $0x4,%esp
+ 4d8:	6a 01                	push   $0x1
+ 4da:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4dd:	50                   	push   %eax
+ 4de:	ff 75 08             	push   0x8(%ebp)
+ 4e1:	e8 0d fe ff ff       	call   2f3 <write>
+        putc(fd, c);
+ 4e6:	83 c4 10             	add    $0x10,%esp
+ 4e9:	eb 05                	jmp    4f0 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4eb:	83 ff 25             	cmp    $0x25,%edi
+ 4ee:	74 1f                	je     50f <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4f0:	83 c6 01             	add    $0x1,%esi
+ 4f3:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4f7:	84 db                	test   %bl,%bl
+ 4f9:	0f 84 61 01 00 00    	je     660 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4ff:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 502:	85 ff                	test   %edi,%edi
+ 504:	75 e5                	jne    4eb <printf+0x40>
+      if(c == '%'){
+ 506:	83 f8 25             	cmp    $0x25,%eax
+ 509:	75 c7                	jne    4d2 <printf+0x27>
+        state = '%';
+ 50b:	89 c7                	mov    %eax,%edi
+ 50d:	eb e1                	jmp    4f0 <printf+0x45>
+      if(c == 'd'){
+ 50f:	83 f8 25             	cmp    $0x25,%eax
+ 512:	0f 84 f4 00 00 00    	je     60c <printf+0x161>
+ 518:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 51b:	83 fa 15             	cmp    $0x15,%edx
+ 51e:	0f 87 09 01 00 00    	ja     62d <printf+0x182>
+ 524:	0f 87 03 01 00 00    	ja     62d <printf+0x182>
+ 52a:	ff 24 95 dc 07 00 00 	jmp    *0x7dc(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 531:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 534:	8b 17                	mov    (%edi),%edx
+ 536:	83 ec 0c             	sub    $0xc,%esp
+ 539:	6a 01                	push   $0x1
+ 53b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 540:	8b 45 08             	mov    0x8(%ebp),%eax
+ 543:	e8 cb fe ff ff       	call   413 <printint>
+        ap++;
+ 548:	83 c7 04             	add    $0x4,%edi
+ 54b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 54e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 551:	bf 00 00 00 00       	mov    $0x0,%edi
+ 556:	eb 98                	jmp    4f0 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 558:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 55b:	8b 17                	mov    (%edi),%edx
+ 55d:	83 ec 0c             	sub    $0xc,%esp
+ 560:	6a 00                	push   $0x0
+ 562:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 567:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56a:	e8 a4 fe ff ff       	call   413 <printint>
+        ap++;
+ 56f:	83 c7 04             	add    $0x4,%edi
+ 572:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 575:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 578:	bf 00 00 00 00       	mov    $0x0,%edi
+ 57d:	e9 6e ff ff ff       	jmp    4f0 <printf+0x45>
+        s = (char*)*ap;
+ 582:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 585:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 587:	83 c1 04             	add    $0x4,%ecx
+ 58a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 58d:	85 c0                	test   %eax,%eax
+ 58f:	74 13                	je     5a4 <printf+0xf9>
+        s = (char*)*ap;
+ 591:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 593:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 596:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 59b:	84 c0                	test   %al,%al
+ 59d:	75 0f                	jne    5ae <printf+0x103>
+ 59f:	e9 4c ff ff ff       	jmp    4f0 <printf+0x45>
+          s = "(null)";
+ 5a4:	bb d3 07 00 00       	mov    $0x7d3,%ebx
+        while(*s != 0){
+ 5a9:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 5ae:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5b1:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5b4:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5b7:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ba:	83 ec 04             	sub    $0x4,%esp
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	57                   	push   %edi
+ 5c0:	56                   	push   %esi
+ 5c1:	e8 2d fd ff ff       	call   2f3 <write>
+          s++;
+ 5c6:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5c9:	0f b6 03             	movzbl (%ebx),%eax
+ 5cc:	83 c4 10             	add    $0x10,%esp
+ 5cf:	84 c0                	test   %al,%al
+ 5d1:	75 e4                	jne    5b7 <printf+0x10c>
+      state = 0;
+ 5d3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5d6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5db:	e9 10 ff ff ff       	jmp    4f0 <printf+0x45>
+        putc(fd, *ap);
+ 5e0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5e3:	8b 07                	mov    (%edi),%eax
+ 5e5:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5f0:	50                   	push   %eax
+ 5f1:	ff 75 08             	push   0x8(%ebp)
+ 5f4:	e8 fa fc ff ff       	call   2f3 <write>
+        ap++;
+ 5f9:	83 c7 04             	add    $0x4,%edi
+ 5fc:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5ff:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 602:	bf 00 00 00 00       	mov    $0x0,%edi
+ 607:	e9 e4 fe ff ff       	jmp    4f0 <printf+0x45>
+        putc(fd, c);
+ 60c:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 60f:	83 ec 04             	sub    $0x4,%esp
+ 612:	6a 01                	push   $0x1
+ 614:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 617:	50                   	push   %eax
+ 618:	ff 75 08             	push   0x8(%ebp)
+ 61b:	e8 d3 fc ff ff       	call   2f3 <write>
+ 620:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 623:	bf 00 00 00 00       	mov    $0x0,%edi
+ 628:	e9 c3 fe ff ff       	jmp    4f0 <printf+0x45>
+        putc(fd, '%');
+ 62d:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 631:	83 ec 04             	sub    $0x4,%esp
+ 634:	6a 01                	push   $0x1
+ 636:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 639:	57                   	push   %edi
+ 63a:	ff 75 08             	push   0x8(%ebp)
+ 63d:	e8 b1 fc ff ff       	call   2f3 <write>
+        putc(fd, c);
+ 642:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 645:	83 c4 0c             	add    $0xc,%esp
+ 648:	6a 01                	push   $0x1
+ 64a:	57                   	push   %edi
+ 64b:	ff 75 08             	push   0x8(%ebp)
+ 64e:	e8 a0 fc ff ff       	call   2f3 <write>
+        putc(fd, c);
+ 653:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 656:	bf 00 00 00 00       	mov    $0x0,%edi
+ 65b:	e9 90 fe ff ff       	jmp    4f0 <printf+0x45>
+    }
+  }
+}
+ 660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 663:	5b                   	pop    %ebx
+ 664:	5e                   	pop    %esi
+ 665:	5f                   	pop    %edi
+ 666:	5d                   	pop    %ebp
+ 667:	c3                   	ret
+
+00000668 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 668:	55                   	push   %ebp
+ 669:	89 e5                	mov    %esp,%ebp
+ 66b:	57                   	push   %edi
+ 66c:	56                   	push   %esi
+ 66d:	53                   	push   %ebx
+ 66e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 671:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 674:	a1 d8 0a 00 00       	mov    0xad8,%eax
+ 679:	eb 0c                	jmp    687 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67b:	8b 10                	mov    (%eax),%edx
+ 67d:	39 d0                	cmp    %edx,%eax
+ 67f:	72 04                	jb     685 <free+0x1d>
+ 681:	39 d1                	cmp    %edx,%ecx
+ 683:	72 10                	jb     695 <free+0x2d>
+{
+ 685:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 687:	39 c8                	cmp    %ecx,%eax
+ 689:	73 f0                	jae    67b <free+0x13>
+ 68b:	8b 10                	mov    (%eax),%edx
+ 68d:	39 d1                	cmp    %edx,%ecx
+ 68f:	72 04                	jb     695 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 691:	39 d0                	cmp    %edx,%eax
+ 693:	72 f0                	jb     685 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 695:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 698:	8b 10                	mov    (%eax),%edx
+ 69a:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 69d:	39 fa                	cmp    %edi,%edx
+ 69f:	74 19                	je     6ba <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a1:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6a4:	8b 50 04             	mov    0x4(%eax),%edx
+ 6a7:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6aa:	39 f1                	cmp    %esi,%ecx
+ 6ac:	74 18                	je     6c6 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6ae:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6b0:	a3 d8 0a 00 00       	mov    %eax,0xad8
+}
+ 6b5:	5b                   	pop    %ebx
+ 6b6:	5e                   	pop    %esi
+ 6b7:	5f                   	pop    %edi
+ 6b8:	5d                   	pop    %ebp
+ 6b9:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6ba:	03 72 04             	add    0x4(%edx),%esi
+ 6bd:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c0:	8b 10                	mov    (%eax),%edx
+ 6c2:	8b 12                	mov    (%edx),%edx
+ 6c4:	eb db                	jmp    6a1 <free+0x39>
+    p->s.size += bp->s.size;
+ 6c6:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6c9:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6cc:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6cf:	eb dd                	jmp    6ae <free+0x46>
+
+000006d1 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6d1:	55                   	push   %ebp
+ 6d2:	89 e5                	mov    %esp,%ebp
+ 6d4:	57                   	push   %edi
+ 6d5:	56                   	push   %esi
+ 6d6:	53                   	push   %ebx
+ 6d7:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6dd:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6e0:	c1 eb 03             	shr    $0x3,%ebx
+ 6e3:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6e6:	8b 15 d8 0a 00 00    	mov    0xad8,%edx
+ 6ec:	85 d2                	test   %edx,%edx
+ 6ee:	74 1c                	je     70c <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6f5:	39 d9                	cmp    %ebx,%ecx
+ 6f7:	73 38                	jae    731 <malloc+0x60>
+  if(nu < 4096)
+ 6f9:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6fe:	39 f3                	cmp    %esi,%ebx
+ 700:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 703:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 70a:	eb 72                	jmp    77e <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 70c:	c7 05 d8 0a 00 00 dc 	movl   $0xadc,0xad8
+ 713:	0a 00 00 
+ 716:	c7 05 dc 0a 00 00 dc 	movl   $0xadc,0xadc
+ 71d:	0a 00 00 
+    base.s.size = 0;
+ 720:	c7 05 e0 0a 00 00 00 	movl   $0x0,0xae0
+ 727:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 72a:	b8 dc 0a 00 00       	mov    $0xadc,%eax
+    if(p->s.size >= nunits){
+ 72f:	eb c8                	jmp    6f9 <malloc+0x28>
+      if(p->s.size == nunits)
+ 731:	39 cb                	cmp    %ecx,%ebx
+ 733:	74 1e                	je     753 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 735:	29 d9                	sub    %ebx,%ecx
+ 737:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 73a:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 73d:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 740:	89 15 d8 0a 00 00    	mov    %edx,0xad8
+      return (void*)(p + 1);
+ 746:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 749:	89 d0                	mov    %edx,%eax
+ 74b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 74e:	5b                   	pop    %ebx
+ 74f:	5e                   	pop    %esi
+ 750:	5f                   	pop    %edi
+ 751:	5d                   	pop    %ebp
+ 752:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 753:	8b 08                	mov    (%eax),%ecx
+ 755:	89 0a                	mov    %ecx,(%edx)
+ 757:	eb e7                	jmp    740 <malloc+0x6f>
+  hp->s.size = nu;
+ 759:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 75c:	83 ec 0c             	sub    $0xc,%esp
+ 75f:	83 c0 08             	add    $0x8,%eax
+ 762:	50                   	push   %eax
+ 763:	e8 00 ff ff ff       	call   668 <free>
+  return freep;
+ 768:	8b 15 d8 0a 00 00    	mov    0xad8,%edx
+      if((p = morecore(nunits)) == 0)
+ 76e:	83 c4 10             	add    $0x10,%esp
+ 771:	85 d2                	test   %edx,%edx
+ 773:	74 d4                	je     749 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 775:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 777:	8b 48 04             	mov    0x4(%eax),%ecx
+ 77a:	39 d9                	cmp    %ebx,%ecx
+ 77c:	73 b3                	jae    731 <malloc+0x60>
+    if(p == freep)
+ 77e:	89 c2                	mov    %eax,%edx
+ 780:	39 05 d8 0a 00 00    	cmp    %eax,0xad8
+ 786:	75 ed                	jne    775 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 788:	83 ec 0c             	sub    $0xc,%esp
+ 78b:	57                   	push   %edi
+ 78c:	e8 ca fb ff ff       	call   35b <sbrk>
+  if(p == (char*)-1)
+ 791:	83 c4 10             	add    $0x10,%esp
+ 794:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 797:	75 c0                	jne    759 <malloc+0x88>
+        return 0;
+ 799:	ba 00 00 00 00       	mov    $0x0,%edx
+ 79e:	eb a9                	jmp    749 <malloc+0x78>
@@ -131,6 +131,11 @@ struct segdesc {
 #define PGROUNDUP(sz)  (((sz)+PGSIZE-1) & ~(PGSIZE-1))
 #define PGROUNDDOWN(a) (((a)) & ~(PGSIZE-1))
 
+#define HUGEPGSIZE      (PGSIZE*NPTENTRIES)  // bytes mapped by a PTE_PS page
+#define HUGEORDER       10      // log2(HUGEPGSIZE/PGSIZE)
+#define HUGEROUNDUP(sz)  (((sz)+HUGEPGSIZE-1) & ~(HUGEPGSIZE-1))
+#define HUGEROUNDDOWN(a) (((a)) & ~(HUGEPGSIZE-1))
+
 // Page table/directory entry flags.
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
@@ -141,6 +146,11 @@ struct segdesc {
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_COW         0x200   // Copy-on-write; see copyuvm() (free for OS use)
+
+// Page fault error code bits
+#define FEC_PR          0x001   // Page was present
+#define FEC_WR          0x002   // Fault was a write
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
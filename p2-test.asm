@@ -0,0 +1,2279 @@
+
+_p2-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <testprocarray>:
+
+#ifdef GETPROCS_TEST
+// Fork to 64 process and then make sure we get all when passing table array
+// of sizes 1, 16, 64, 72. NOTE: caller does all forks.
+static int
+testprocarray(int max, int expected_ret){
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 18             	sub    $0x18,%esp
+       9:	89 c6                	mov    %eax,%esi
+       b:	89 d7                	mov    %edx,%edi
+  struct uproc * table;
+  int ret, success = 0;
+
+  table = malloc(sizeof(struct uproc) * max);  // bad code, assumes success
+       d:	6b c0 4c             	imul   $0x4c,%eax,%eax
+      10:	50                   	push   %eax
+      11:	e8 fd 10 00 00       	call   1113 <malloc>
+  if (!table) {
+      16:	83 c4 10             	add    $0x10,%esp
+      19:	85 c0                	test   %eax,%eax
+      1b:	74 3c                	je     59 <testprocarray+0x59>
+      1d:	89 c3                	mov    %eax,%ebx
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+    exit();
+  }
+  ret = getprocs(max, table);
+      1f:	83 ec 08             	sub    $0x8,%esp
+      22:	50                   	push   %eax
+      23:	56                   	push   %esi
+      24:	e8 c4 0d 00 00       	call   ded <getprocs>
+  if (ret != expected_ret){
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	39 f8                	cmp    %edi,%eax
+      2e:	75 44                	jne    74 <testprocarray+0x74>
+    printf(2, "FAILED: getprocs(%d) returned %d, expected %d\n", max, ret, expected_ret);
+    success = -1;
+  }
+  else{
+    printf(2, "getprocs() was asked for %d processes and returned %d. SUCCESS\n", max, expected_ret);
+      30:	57                   	push   %edi
+      31:	56                   	push   %esi
+      32:	68 40 12 00 00       	push   $0x1240
+      37:	6a 02                	push   $0x2
+      39:	e8 af 0e 00 00       	call   eed <printf>
+      3e:	83 c4 10             	add    $0x10,%esp
+  int ret, success = 0;
+      41:	be 00 00 00 00       	mov    $0x0,%esi
+  }
+  free(table);
+      46:	83 ec 0c             	sub    $0xc,%esp
+      49:	53                   	push   %ebx
+      4a:	e8 5b 10 00 00       	call   10aa <free>
+  return success;
+}
+      4f:	89 f0                	mov    %esi,%eax
+      51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      54:	5b                   	pop    %ebx
+      55:	5e                   	pop    %esi
+      56:	5f                   	pop    %edi
+      57:	5d                   	pop    %ebp
+      58:	c3                   	ret
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+      59:	68 f0 00 00 00       	push   $0xf0
+      5e:	68 34 18 00 00       	push   $0x1834
+      63:	68 e4 11 00 00       	push   $0x11e4
+      68:	6a 02                	push   $0x2
+      6a:	e8 7e 0e 00 00       	call   eed <printf>
+    exit();
+      6f:	e8 a1 0c 00 00       	call   d15 <exit>
+    printf(2, "FAILED: getprocs(%d) returned %d, expected %d\n", max, ret, expected_ret);
+      74:	83 ec 0c             	sub    $0xc,%esp
+      77:	57                   	push   %edi
+      78:	50                   	push   %eax
+      79:	56                   	push   %esi
+      7a:	68 10 12 00 00       	push   $0x1210
+      7f:	6a 02                	push   $0x2
+      81:	e8 67 0e 00 00       	call   eed <printf>
+    success = -1;
+      86:	83 c4 20             	add    $0x20,%esp
+      89:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      8e:	eb b6                	jmp    46 <testprocarray+0x46>
+
+00000090 <getcputime>:
+getcputime(char * name, struct uproc * table){
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	57                   	push   %edi
+      94:	56                   	push   %esi
+      95:	53                   	push   %ebx
+      96:	83 ec 24             	sub    $0x24,%esp
+      99:	89 c7                	mov    %eax,%edi
+      9b:	89 d3                	mov    %edx,%ebx
+  size = getprocs(64, table);
+      9d:	52                   	push   %edx
+      9e:	6a 40                	push   $0x40
+      a0:	e8 48 0d 00 00       	call   ded <getprocs>
+      a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(int i = 0; i < size; ++i){
+      a8:	83 c4 10             	add    $0x10,%esp
+      ab:	85 c0                	test   %eax,%eax
+      ad:	7e 24                	jle    d3 <getcputime+0x43>
+      af:	be 00 00 00 00       	mov    $0x0,%esi
+    if(strcmp(table[i].name, name) == 0){
+      b4:	83 ec 08             	sub    $0x8,%esp
+      b7:	57                   	push   %edi
+      b8:	8d 43 2c             	lea    0x2c(%ebx),%eax
+      bb:	50                   	push   %eax
+      bc:	e8 15 0a 00 00       	call   ad6 <strcmp>
+      c1:	83 c4 10             	add    $0x10,%esp
+      c4:	85 c0                	test   %eax,%eax
+      c6:	74 25                	je     ed <getcputime+0x5d>
+  for(int i = 0; i < size; ++i){
+      c8:	83 c6 01             	add    $0x1,%esi
+      cb:	83 c3 4c             	add    $0x4c,%ebx
+      ce:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      d1:	75 e1                	jne    b4 <getcputime+0x24>
+    printf(2, "FAILED: Test program \"%s\" not found in table returned by getprocs\n", name);
+      d3:	83 ec 04             	sub    $0x4,%esp
+      d6:	57                   	push   %edi
+      d7:	68 80 12 00 00       	push   $0x1280
+      dc:	6a 02                	push   $0x2
+      de:	e8 0a 0e 00 00       	call   eed <printf>
+    return -1;
+      e3:	83 c4 10             	add    $0x10,%esp
+      e6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      eb:	eb 07                	jmp    f4 <getcputime+0x64>
+  if(p == 0){
+      ed:	85 db                	test   %ebx,%ebx
+      ef:	74 e2                	je     d3 <getcputime+0x43>
+    return p->CPU_total_ticks;
+      f1:	8b 43 20             	mov    0x20(%ebx),%eax
+}
+      f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      f7:	5b                   	pop    %ebx
+      f8:	5e                   	pop    %esi
+      f9:	5f                   	pop    %edi
+      fa:	5d                   	pop    %ebp
+      fb:	c3                   	ret
+
+000000fc <testuid>:
+testuid(uint new_val, uint expected_get_val, int expected_set_ret){
+      fc:	55                   	push   %ebp
+      fd:	89 e5                	mov    %esp,%ebp
+      ff:	57                   	push   %edi
+     100:	56                   	push   %esi
+     101:	53                   	push   %ebx
+     102:	83 ec 1c             	sub    $0x1c,%esp
+     105:	89 c3                	mov    %eax,%ebx
+     107:	89 d7                	mov    %edx,%edi
+     109:	89 ce                	mov    %ecx,%esi
+  pre_uid = getuid();
+     10b:	e8 b5 0c 00 00       	call   dc5 <getuid>
+     110:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  ret = setuid(new_val);
+     113:	83 ec 0c             	sub    $0xc,%esp
+     116:	53                   	push   %ebx
+     117:	e8 c1 0c 00 00       	call   ddd <setuid>
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     11c:	83 c4 10             	add    $0x10,%esp
+  int success = 0;
+     11f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     126:	89 c2                	mov    %eax,%edx
+     128:	31 f2                	xor    %esi,%edx
+     12a:	78 14                	js     140 <testuid+0x44>
+  post_uid = getuid();
+     12c:	e8 94 0c 00 00       	call   dc5 <getuid>
+  if(post_uid != expected_get_val){
+     131:	39 f8                	cmp    %edi,%eax
+     133:	75 29                	jne    15e <testuid+0x62>
+}
+     135:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     138:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     13b:	5b                   	pop    %ebx
+     13c:	5e                   	pop    %esi
+     13d:	5f                   	pop    %edi
+     13e:	5d                   	pop    %ebp
+     13f:	c3                   	ret
+    printf(2, "FAILED: setuid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	56                   	push   %esi
+     144:	50                   	push   %eax
+     145:	53                   	push   %ebx
+     146:	68 c4 12 00 00       	push   $0x12c4
+     14b:	6a 02                	push   $0x2
+     14d:	e8 9b 0d 00 00       	call   eed <printf>
+     152:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     155:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+     15c:	eb ce                	jmp    12c <testuid+0x30>
+    printf(2, "FAILED: UID was %d. After setuid(%d), getuid() returned %d, expected %d\n",
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	57                   	push   %edi
+     162:	50                   	push   %eax
+     163:	53                   	push   %ebx
+     164:	ff 75 e0             	push   -0x20(%ebp)
+     167:	68 f4 12 00 00       	push   $0x12f4
+     16c:	6a 02                	push   $0x2
+     16e:	e8 7a 0d 00 00       	call   eed <printf>
+     173:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     176:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  return success;
+     17d:	eb b6                	jmp    135 <testuid+0x39>
+
+0000017f <testgid>:
+testgid(uint new_val, uint expected_get_val, int expected_set_ret){
+     17f:	55                   	push   %ebp
+     180:	89 e5                	mov    %esp,%ebp
+     182:	57                   	push   %edi
+     183:	56                   	push   %esi
+     184:	53                   	push   %ebx
+     185:	83 ec 1c             	sub    $0x1c,%esp
+     188:	89 c3                	mov    %eax,%ebx
+     18a:	89 d7                	mov    %edx,%edi
+     18c:	89 ce                	mov    %ecx,%esi
+  pre_gid = getgid();
+     18e:	e8 3a 0c 00 00       	call   dcd <getgid>
+     193:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  ret = setgid(new_val);
+     196:	83 ec 0c             	sub    $0xc,%esp
+     199:	53                   	push   %ebx
+     19a:	e8 46 0c 00 00       	call   de5 <setgid>
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     19f:	83 c4 10             	add    $0x10,%esp
+  int success = 0;
+     1a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     1a9:	89 c2                	mov    %eax,%edx
+     1ab:	31 f2                	xor    %esi,%edx
+     1ad:	78 14                	js     1c3 <testgid+0x44>
+  post_gid = getgid();
+     1af:	e8 19 0c 00 00       	call   dcd <getgid>
+  if(post_gid != expected_get_val){
+     1b4:	39 f8                	cmp    %edi,%eax
+     1b6:	75 29                	jne    1e1 <testgid+0x62>
+}
+     1b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1be:	5b                   	pop    %ebx
+     1bf:	5e                   	pop    %esi
+     1c0:	5f                   	pop    %edi
+     1c1:	5d                   	pop    %ebp
+     1c2:	c3                   	ret
+    printf(2, "FAILED: setgid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     1c3:	83 ec 0c             	sub    $0xc,%esp
+     1c6:	56                   	push   %esi
+     1c7:	50                   	push   %eax
+     1c8:	53                   	push   %ebx
+     1c9:	68 40 13 00 00       	push   $0x1340
+     1ce:	6a 02                	push   $0x2
+     1d0:	e8 18 0d 00 00       	call   eed <printf>
+     1d5:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     1d8:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+     1df:	eb ce                	jmp    1af <testgid+0x30>
+    printf(2, "FAILED: UID was %d. After setgid(%d), getgid() returned %d, expected %d\n",
+     1e1:	83 ec 08             	sub    $0x8,%esp
+     1e4:	57                   	push   %edi
+     1e5:	50                   	push   %eax
+     1e6:	53                   	push   %ebx
+     1e7:	ff 75 e0             	push   -0x20(%ebp)
+     1ea:	68 70 13 00 00       	push   $0x1370
+     1ef:	6a 02                	push   $0x2
+     1f1:	e8 f7 0c 00 00       	call   eed <printf>
+     1f6:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     1f9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  return success;
+     200:	eb b6                	jmp    1b8 <testgid+0x39>
+
+00000202 <testtimewitharg>:
+#endif
+
+#ifdef TIME_TEST
+// Forks a process and execs with time + args to see how it handles no args, invalid args, mulitple args
+void
+testtimewitharg(char **arg){
+     202:	55                   	push   %ebp
+     203:	89 e5                	mov    %esp,%ebp
+     205:	83 ec 08             	sub    $0x8,%esp
+  int ret;
+
+  ret = fork();
+     208:	e8 00 0b 00 00       	call   d0d <fork>
+  if (ret == 0){
+     20d:	85 c0                	test   %eax,%eax
+     20f:	74 0c                	je     21d <testtimewitharg+0x1b>
+    exec(arg[0], arg);
+    printf(2, "FAILED: exec failed to execute %s\n", arg[0]);
+    exit();
+  }
+  else if(ret == -1){
+     211:	83 f8 ff             	cmp    $0xffffffff,%eax
+     214:	74 30                	je     246 <testtimewitharg+0x44>
+    printf(2, "FAILED: fork failed\n");
+  }
+  else
+    wait();
+     216:	e8 02 0b 00 00       	call   d1d <wait>
+}
+     21b:	c9                   	leave
+     21c:	c3                   	ret
+    exec(arg[0], arg);
+     21d:	83 ec 08             	sub    $0x8,%esp
+     220:	ff 75 08             	push   0x8(%ebp)
+     223:	8b 45 08             	mov    0x8(%ebp),%eax
+     226:	ff 30                	push   (%eax)
+     228:	e8 20 0b 00 00       	call   d4d <exec>
+    printf(2, "FAILED: exec failed to execute %s\n", arg[0]);
+     22d:	83 c4 0c             	add    $0xc,%esp
+     230:	8b 45 08             	mov    0x8(%ebp),%eax
+     233:	ff 30                	push   (%eax)
+     235:	68 bc 13 00 00       	push   $0x13bc
+     23a:	6a 02                	push   $0x2
+     23c:	e8 ac 0c 00 00       	call   eed <printf>
+    exit();
+     241:	e8 cf 0a 00 00       	call   d15 <exit>
+    printf(2, "FAILED: fork failed\n");
+     246:	83 ec 08             	sub    $0x8,%esp
+     249:	68 47 17 00 00       	push   $0x1747
+     24e:	6a 02                	push   $0x2
+     250:	e8 98 0c 00 00       	call   eed <printf>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	eb c1                	jmp    21b <testtimewitharg+0x19>
+
+0000025a <testtime>:
+void
+testtime(void){
+     25a:	55                   	push   %ebp
+     25b:	89 e5                	mov    %esp,%ebp
+     25d:	57                   	push   %edi
+     25e:	56                   	push   %esi
+     25f:	53                   	push   %ebx
+     260:	83 ec 28             	sub    $0x28,%esp
+  char **arg1 = malloc(sizeof(char *));
+     263:	6a 04                	push   $0x4
+     265:	e8 a9 0e 00 00       	call   1113 <malloc>
+     26a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  char **arg2 = malloc(sizeof(char *)*2);
+     26d:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     274:	e8 9a 0e 00 00       	call   1113 <malloc>
+     279:	89 c7                	mov    %eax,%edi
+  char **arg3 = malloc(sizeof(char *)*2);
+     27b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     282:	e8 8c 0e 00 00       	call   1113 <malloc>
+     287:	89 c6                	mov    %eax,%esi
+  char **arg4 = malloc(sizeof(char *)*4);
+     289:	c7 04 24 10 00 00 00 	movl   $0x10,(%esp)
+     290:	e8 7e 0e 00 00       	call   1113 <malloc>
+     295:	89 c3                	mov    %eax,%ebx
+
+  arg1[0] = malloc(sizeof(char) * 5);
+     297:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     29e:	e8 70 0e 00 00       	call   1113 <malloc>
+     2a3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     2a6:	89 02                	mov    %eax,(%edx)
+  strcpy(arg1[0], "time");
+     2a8:	83 c4 08             	add    $0x8,%esp
+     2ab:	68 5c 17 00 00       	push   $0x175c
+     2b0:	50                   	push   %eax
+     2b1:	e8 fc 07 00 00       	call   ab2 <strcpy>
+
+  arg2[0] = malloc(sizeof(char) * 5);
+     2b6:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     2bd:	e8 51 0e 00 00       	call   1113 <malloc>
+     2c2:	89 07                	mov    %eax,(%edi)
+  strcpy(arg2[0], "time");
+     2c4:	83 c4 08             	add    $0x8,%esp
+     2c7:	68 5c 17 00 00       	push   $0x175c
+     2cc:	50                   	push   %eax
+     2cd:	e8 e0 07 00 00       	call   ab2 <strcpy>
+  arg2[1] = malloc(sizeof(char) * 4);
+     2d2:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     2d9:	e8 35 0e 00 00       	call   1113 <malloc>
+     2de:	89 47 04             	mov    %eax,0x4(%edi)
+  strcpy(arg2[1], "abc");
+     2e1:	83 c4 08             	add    $0x8,%esp
+     2e4:	68 61 17 00 00       	push   $0x1761
+     2e9:	50                   	push   %eax
+     2ea:	e8 c3 07 00 00       	call   ab2 <strcpy>
+
+  arg3[0] = malloc(sizeof(char) * 5);
+     2ef:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     2f6:	e8 18 0e 00 00       	call   1113 <malloc>
+     2fb:	89 06                	mov    %eax,(%esi)
+  strcpy(arg3[0], "time");
+     2fd:	83 c4 08             	add    $0x8,%esp
+     300:	68 5c 17 00 00       	push   $0x175c
+     305:	50                   	push   %eax
+     306:	e8 a7 07 00 00       	call   ab2 <strcpy>
+  arg3[1] = malloc(sizeof(char) * 5);
+     30b:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     312:	e8 fc 0d 00 00       	call   1113 <malloc>
+     317:	89 46 04             	mov    %eax,0x4(%esi)
+  strcpy(arg3[1], "date");
+     31a:	83 c4 08             	add    $0x8,%esp
+     31d:	68 65 17 00 00       	push   $0x1765
+     322:	50                   	push   %eax
+     323:	e8 8a 07 00 00       	call   ab2 <strcpy>
+
+  arg4[0] = malloc(sizeof(char) * 5);
+     328:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     32f:	e8 df 0d 00 00       	call   1113 <malloc>
+     334:	89 03                	mov    %eax,(%ebx)
+  strcpy(arg4[0], "time");
+     336:	83 c4 08             	add    $0x8,%esp
+     339:	68 5c 17 00 00       	push   $0x175c
+     33e:	50                   	push   %eax
+     33f:	e8 6e 07 00 00       	call   ab2 <strcpy>
+  arg4[1] = malloc(sizeof(char) * 5);
+     344:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     34b:	e8 c3 0d 00 00       	call   1113 <malloc>
+     350:	89 43 04             	mov    %eax,0x4(%ebx)
+  strcpy(arg4[1], "time");
+     353:	83 c4 08             	add    $0x8,%esp
+     356:	68 5c 17 00 00       	push   $0x175c
+     35b:	50                   	push   %eax
+     35c:	e8 51 07 00 00       	call   ab2 <strcpy>
+  arg4[2] = malloc(sizeof(char) * 5);
+     361:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     368:	e8 a6 0d 00 00       	call   1113 <malloc>
+     36d:	89 43 08             	mov    %eax,0x8(%ebx)
+  strcpy(arg4[2], "echo");
+     370:	83 c4 08             	add    $0x8,%esp
+     373:	68 6a 17 00 00       	push   $0x176a
+     378:	50                   	push   %eax
+     379:	e8 34 07 00 00       	call   ab2 <strcpy>
+  arg4[3] = malloc(sizeof(char) * 6);
+     37e:	c7 04 24 06 00 00 00 	movl   $0x6,(%esp)
+     385:	e8 89 0d 00 00       	call   1113 <malloc>
+     38a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  strcpy(arg4[3], "\"abc\"");
+     38d:	83 c4 08             	add    $0x8,%esp
+     390:	68 6f 17 00 00       	push   $0x176f
+     395:	50                   	push   %eax
+     396:	e8 17 07 00 00       	call   ab2 <strcpy>
+
+  printf(1, "\n----------\nRunning Time Test\n----------\n");
+     39b:	83 c4 08             	add    $0x8,%esp
+     39e:	68 e0 13 00 00       	push   $0x13e0
+     3a3:	6a 01                	push   $0x1
+     3a5:	e8 43 0b 00 00       	call   eed <printf>
+  printf(1, "You will need to verify these tests passed\n");
+     3aa:	83 c4 08             	add    $0x8,%esp
+     3ad:	68 0c 14 00 00       	push   $0x140c
+     3b2:	6a 01                	push   $0x1
+     3b4:	e8 34 0b 00 00       	call   eed <printf>
+
+  printf(1,"\n%s\n", arg1[0]);
+     3b9:	83 c4 0c             	add    $0xc,%esp
+     3bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     3bf:	ff 32                	push   (%edx)
+     3c1:	68 75 17 00 00       	push   $0x1775
+     3c6:	6a 01                	push   $0x1
+     3c8:	e8 20 0b 00 00       	call   eed <printf>
+  testtimewitharg(arg1);
+     3cd:	83 c4 04             	add    $0x4,%esp
+     3d0:	ff 75 e4             	push   -0x1c(%ebp)
+     3d3:	e8 2a fe ff ff       	call   202 <testtimewitharg>
+  printf(1,"\n%s %s\n", arg2[0], arg2[1]);
+     3d8:	ff 77 04             	push   0x4(%edi)
+     3db:	ff 37                	push   (%edi)
+     3dd:	68 7a 17 00 00       	push   $0x177a
+     3e2:	6a 01                	push   $0x1
+     3e4:	e8 04 0b 00 00       	call   eed <printf>
+  testtimewitharg(arg2);
+     3e9:	83 c4 14             	add    $0x14,%esp
+     3ec:	57                   	push   %edi
+     3ed:	e8 10 fe ff ff       	call   202 <testtimewitharg>
+  printf(1,"\n%s %s\n", arg3[0], arg3[1]);
+     3f2:	ff 76 04             	push   0x4(%esi)
+     3f5:	ff 36                	push   (%esi)
+     3f7:	68 7a 17 00 00       	push   $0x177a
+     3fc:	6a 01                	push   $0x1
+     3fe:	e8 ea 0a 00 00       	call   eed <printf>
+  testtimewitharg(arg3);
+     403:	83 c4 14             	add    $0x14,%esp
+     406:	56                   	push   %esi
+     407:	e8 f6 fd ff ff       	call   202 <testtimewitharg>
+  printf(1,"\n%s %s %s %s\n", arg4[0], arg4[1], arg4[2], arg4[3]);
+     40c:	83 c4 08             	add    $0x8,%esp
+     40f:	ff 73 0c             	push   0xc(%ebx)
+     412:	ff 73 08             	push   0x8(%ebx)
+     415:	ff 73 04             	push   0x4(%ebx)
+     418:	ff 33                	push   (%ebx)
+     41a:	68 82 17 00 00       	push   $0x1782
+     41f:	6a 01                	push   $0x1
+     421:	e8 c7 0a 00 00       	call   eed <printf>
+  testtimewitharg(arg4);
+     426:	83 c4 14             	add    $0x14,%esp
+     429:	53                   	push   %ebx
+     42a:	e8 d3 fd ff ff       	call   202 <testtimewitharg>
+
+  free(arg1[0]);
+     42f:	83 c4 04             	add    $0x4,%esp
+     432:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     435:	ff 32                	push   (%edx)
+     437:	e8 6e 0c 00 00       	call   10aa <free>
+  free(arg1);
+     43c:	83 c4 04             	add    $0x4,%esp
+     43f:	ff 75 e4             	push   -0x1c(%ebp)
+     442:	e8 63 0c 00 00       	call   10aa <free>
+  free(arg2[0]); free(arg2[1]);
+     447:	83 c4 04             	add    $0x4,%esp
+     44a:	ff 37                	push   (%edi)
+     44c:	e8 59 0c 00 00       	call   10aa <free>
+     451:	83 c4 04             	add    $0x4,%esp
+     454:	ff 77 04             	push   0x4(%edi)
+     457:	e8 4e 0c 00 00       	call   10aa <free>
+  free(arg2);
+     45c:	89 3c 24             	mov    %edi,(%esp)
+     45f:	e8 46 0c 00 00       	call   10aa <free>
+  free(arg3[0]); free(arg3[1]);
+     464:	83 c4 04             	add    $0x4,%esp
+     467:	ff 36                	push   (%esi)
+     469:	e8 3c 0c 00 00       	call   10aa <free>
+     46e:	83 c4 04             	add    $0x4,%esp
+     471:	ff 76 04             	push   0x4(%esi)
+     474:	e8 31 0c 00 00       	call   10aa <free>
+  free(arg3);
+     479:	89 34 24             	mov    %esi,(%esp)
+     47c:	e8 29 0c 00 00       	call   10aa <free>
+  free(arg4[0]); free(arg4[1]); free(arg4[2]); free(arg4[3]);
+     481:	83 c4 04             	add    $0x4,%esp
+     484:	ff 33                	push   (%ebx)
+     486:	e8 1f 0c 00 00       	call   10aa <free>
+     48b:	83 c4 04             	add    $0x4,%esp
+     48e:	ff 73 04             	push   0x4(%ebx)
+     491:	e8 14 0c 00 00       	call   10aa <free>
+     496:	83 c4 04             	add    $0x4,%esp
+     499:	ff 73 08             	push   0x8(%ebx)
+     49c:	e8 09 0c 00 00       	call   10aa <free>
+     4a1:	83 c4 04             	add    $0x4,%esp
+     4a4:	ff 73 0c             	push   0xc(%ebx)
+     4a7:	e8 fe 0b 00 00       	call   10aa <free>
+  free(arg4);
+     4ac:	89 1c 24             	mov    %ebx,(%esp)
+     4af:	e8 f6 0b 00 00       	call   10aa <free>
+}
+     4b4:	83 c4 10             	add    $0x10,%esp
+     4b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ba:	5b                   	pop    %ebx
+     4bb:	5e                   	pop    %esi
+     4bc:	5f                   	pop    %edi
+     4bd:	5d                   	pop    %ebp
+     4be:	c3                   	ret
+
+000004bf <main>:
+#endif
+
+int
+main(int argc, char *argv[])
+{
+     4bf:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     4c3:	83 e4 f0             	and    $0xfffffff0,%esp
+     4c6:	ff 71 fc             	push   -0x4(%ecx)
+     4c9:	55                   	push   %ebp
+     4ca:	89 e5                	mov    %esp,%ebp
+     4cc:	57                   	push   %edi
+     4cd:	56                   	push   %esi
+     4ce:	53                   	push   %ebx
+     4cf:	51                   	push   %ecx
+     4d0:	83 ec 20             	sub    $0x20,%esp
+     4d3:	8b 41 04             	mov    0x4(%ecx),%eax
+  #ifdef CPUTIME_TEST
+  testcputime(argv[0]);
+     4d6:	8b 00                	mov    (%eax),%eax
+     4d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  printf(1, "\n----------\nRunning CPU Time Test\n----------\n");
+     4db:	68 38 14 00 00       	push   $0x1438
+     4e0:	6a 01                	push   $0x1
+     4e2:	e8 06 0a 00 00       	call   eed <printf>
+  table = malloc(sizeof(struct uproc) * 64);
+     4e7:	c7 04 24 00 13 00 00 	movl   $0x1300,(%esp)
+     4ee:	e8 20 0c 00 00       	call   1113 <malloc>
+  if (!table) {
+     4f3:	83 c4 10             	add    $0x10,%esp
+     4f6:	85 c0                	test   %eax,%eax
+     4f8:	74 34                	je     52e <main+0x6f>
+     4fa:	89 c6                	mov    %eax,%esi
+  printf(1, "This will take a couple seconds\n");
+     4fc:	83 ec 08             	sub    $0x8,%esp
+     4ff:	68 68 14 00 00       	push   $0x1468
+     504:	6a 01                	push   $0x1
+     506:	e8 e2 09 00 00       	call   eed <printf>
+  time1 = getcputime(name, table);
+     50b:	89 f2                	mov    %esi,%edx
+     50d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     510:	e8 7b fb ff ff       	call   90 <getcputime>
+     515:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     518:	83 c4 10             	add    $0x10,%esp
+  int success = 0;
+     51b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  for(i = 0, num = 0; i < 1000000; ++i){
+     522:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(num % 100000 == 0){
+     527:	bf 89 b5 f8 14       	mov    $0x14f8b589,%edi
+     52c:	eb 3c                	jmp    56a <main+0xab>
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+     52e:	68 c1 00 00 00       	push   $0xc1
+     533:	68 58 18 00 00       	push   $0x1858
+     538:	68 e4 11 00 00       	push   $0x11e4
+     53d:	6a 02                	push   $0x2
+     53f:	e8 a9 09 00 00       	call   eed <printf>
+    exit();
+     544:	e8 cc 07 00 00       	call   d15 <exit>
+        printf(2, "FAILED: CPU_total_ticks changed by 100+ milliseconds while process was asleep\n");
+     549:	83 ec 08             	sub    $0x8,%esp
+     54c:	68 8c 14 00 00       	push   $0x148c
+     551:	6a 02                	push   $0x2
+     553:	e8 95 09 00 00       	call   eed <printf>
+     558:	83 c4 10             	add    $0x10,%esp
+        success = -1;
+     55b:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+  for(i = 0, num = 0; i < 1000000; ++i){
+     562:	81 fb 40 42 0f 00    	cmp    $0xf4240,%ebx
+     568:	74 4e                	je     5b8 <main+0xf9>
+    ++num;
+     56a:	83 c3 01             	add    $0x1,%ebx
+    if(num % 100000 == 0){
+     56d:	89 d8                	mov    %ebx,%eax
+     56f:	f7 ef                	imul   %edi
+     571:	c1 fa 0d             	sar    $0xd,%edx
+     574:	89 d8                	mov    %ebx,%eax
+     576:	c1 f8 1f             	sar    $0x1f,%eax
+     579:	29 c2                	sub    %eax,%edx
+     57b:	69 d2 a0 86 01 00    	imul   $0x186a0,%edx,%edx
+     581:	39 d3                	cmp    %edx,%ebx
+     583:	75 dd                	jne    562 <main+0xa3>
+      pre_sleep = getcputime(name, table);
+     585:	89 f2                	mov    %esi,%edx
+     587:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     58a:	e8 01 fb ff ff       	call   90 <getcputime>
+     58f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      sleep(200);
+     592:	83 ec 0c             	sub    $0xc,%esp
+     595:	68 c8 00 00 00       	push   $0xc8
+     59a:	e8 06 08 00 00       	call   da5 <sleep>
+      post_sleep = getcputime(name, table);
+     59f:	89 f2                	mov    %esi,%edx
+     5a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5a4:	e8 e7 fa ff ff       	call   90 <getcputime>
+      if((post_sleep - pre_sleep) >= 100){
+     5a9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     5ac:	29 c8                	sub    %ecx,%eax
+     5ae:	83 c4 10             	add    $0x10,%esp
+     5b1:	83 f8 63             	cmp    $0x63,%eax
+     5b4:	76 ac                	jbe    562 <main+0xa3>
+     5b6:	eb 91                	jmp    549 <main+0x8a>
+  time2 = getcputime(name, table);
+     5b8:	89 f2                	mov    %esi,%edx
+     5ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5bd:	e8 ce fa ff ff       	call   90 <getcputime>
+  if((time2 - time1) > 400){
+     5c2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+     5c5:	29 c8                	sub    %ecx,%eax
+     5c7:	89 c3                	mov    %eax,%ebx
+     5c9:	3d 90 01 00 00       	cmp    $0x190,%eax
+     5ce:	0f 87 94 01 00 00    	ja     768 <main+0x2a9>
+  printf(1, "T2 - T1 = %d milliseconds\n", (time2 - time1));
+     5d4:	83 ec 04             	sub    $0x4,%esp
+     5d7:	50                   	push   %eax
+     5d8:	68 90 17 00 00       	push   $0x1790
+     5dd:	6a 01                	push   $0x1
+     5df:	e8 09 09 00 00       	call   eed <printf>
+  free(table);
+     5e4:	89 34 24             	mov    %esi,(%esp)
+     5e7:	e8 be 0a 00 00       	call   10aa <free>
+  if(success == 0)
+     5ec:	83 c4 10             	add    $0x10,%esp
+     5ef:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+     5f3:	0f 84 9f 01 00 00    	je     798 <main+0x2d9>
+  printf(1, "\n----------\nRunning UID / GID Tests\n----------\n");
+     5f9:	83 ec 08             	sub    $0x8,%esp
+     5fc:	68 1c 15 00 00       	push   $0x151c
+     601:	6a 01                	push   $0x1
+     603:	e8 e5 08 00 00       	call   eed <printf>
+  uid = getuid();
+     608:	e8 b8 07 00 00       	call   dc5 <getuid>
+  if(uid < 0 || uid > 32767){
+     60d:	83 c4 10             	add    $0x10,%esp
+  int success = 0;
+     610:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if(uid < 0 || uid > 32767){
+     615:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+     61a:	0f 87 8f 01 00 00    	ja     7af <main+0x2f0>
+  if (testuid(0, 0, 0))
+     620:	b9 00 00 00 00       	mov    $0x0,%ecx
+     625:	ba 00 00 00 00       	mov    $0x0,%edx
+     62a:	b8 00 00 00 00       	mov    $0x0,%eax
+     62f:	e8 c8 fa ff ff       	call   fc <testuid>
+    success = -1;
+     634:	85 c0                	test   %eax,%eax
+     636:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     63b:	0f 45 d8             	cmovne %eax,%ebx
+  if (testuid(5, 5, 0))
+     63e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     643:	ba 05 00 00 00       	mov    $0x5,%edx
+     648:	b8 05 00 00 00       	mov    $0x5,%eax
+     64d:	e8 aa fa ff ff       	call   fc <testuid>
+    success = -1;
+     652:	85 c0                	test   %eax,%eax
+     654:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     659:	0f 45 d8             	cmovne %eax,%ebx
+  if (testuid(32767, 32767, 0))
+     65c:	b9 00 00 00 00       	mov    $0x0,%ecx
+     661:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     666:	b8 ff 7f 00 00       	mov    $0x7fff,%eax
+     66b:	e8 8c fa ff ff       	call   fc <testuid>
+    success = -1;
+     670:	85 c0                	test   %eax,%eax
+     672:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     677:	0f 45 d8             	cmovne %eax,%ebx
+  if (testuid(32768, 32767, -1))
+     67a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     67f:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     684:	b8 00 80 00 00       	mov    $0x8000,%eax
+     689:	e8 6e fa ff ff       	call   fc <testuid>
+    success = -1;
+     68e:	85 c0                	test   %eax,%eax
+     690:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     695:	0f 45 d8             	cmovne %eax,%ebx
+  if (testuid(-1, 32767, -1))
+     698:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     69d:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     6a2:	e8 55 fa ff ff       	call   fc <testuid>
+    success = -1;
+     6a7:	85 c0                	test   %eax,%eax
+     6a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6ae:	0f 45 d8             	cmovne %eax,%ebx
+  gid = getgid();
+     6b1:	e8 17 07 00 00       	call   dcd <getgid>
+  if(gid < 0 || gid > 32767){
+     6b6:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+     6bb:	0f 87 0b 01 00 00    	ja     7cc <main+0x30d>
+  if (testgid(0, 0, 0))
+     6c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+     6c6:	ba 00 00 00 00       	mov    $0x0,%edx
+     6cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d0:	e8 aa fa ff ff       	call   17f <testgid>
+    success = -1;
+     6d5:	85 c0                	test   %eax,%eax
+     6d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6dc:	0f 45 d8             	cmovne %eax,%ebx
+  if (testgid(5, 5, 0))
+     6df:	b9 00 00 00 00       	mov    $0x0,%ecx
+     6e4:	ba 05 00 00 00       	mov    $0x5,%edx
+     6e9:	b8 05 00 00 00       	mov    $0x5,%eax
+     6ee:	e8 8c fa ff ff       	call   17f <testgid>
+    success = -1;
+     6f3:	85 c0                	test   %eax,%eax
+     6f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6fa:	0f 45 d8             	cmovne %eax,%ebx
+  if (testgid(32767, 32767, 0))
+     6fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+     702:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     707:	b8 ff 7f 00 00       	mov    $0x7fff,%eax
+     70c:	e8 6e fa ff ff       	call   17f <testgid>
+     711:	85 c0                	test   %eax,%eax
+     713:	0f 85 64 03 00 00    	jne    a7d <main+0x5be>
+  if (testgid(-1, 32767, -1))
+     719:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     71e:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     723:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     728:	e8 52 fa ff ff       	call   17f <testgid>
+     72d:	85 c0                	test   %eax,%eax
+     72f:	0f 85 78 02 00 00    	jne    9ad <main+0x4ee>
+  if (testgid(32768, 32767, -1))
+     735:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     73a:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     73f:	b8 00 80 00 00       	mov    $0x8000,%eax
+     744:	e8 36 fa ff ff       	call   17f <testgid>
+  if (success == 0)
+     749:	09 d8                	or     %ebx,%eax
+     74b:	0f 85 70 02 00 00    	jne    9c1 <main+0x502>
+    printf(1, "** All tests passed! **\n");
+     751:	83 ec 08             	sub    $0x8,%esp
+     754:	68 c4 17 00 00       	push   $0x17c4
+     759:	6a 01                	push   $0x1
+     75b:	e8 8d 07 00 00       	call   eed <printf>
+     760:	83 c4 10             	add    $0x10,%esp
+     763:	e9 59 02 00 00       	jmp    9c1 <main+0x502>
+    printf(2, "ABNORMALLY HIGH: T2 - T1 = %d milliseconds.  Run test again\n", (time2 - time1));
+     768:	83 ec 04             	sub    $0x4,%esp
+     76b:	50                   	push   %eax
+     76c:	68 dc 14 00 00       	push   $0x14dc
+     771:	6a 02                	push   $0x2
+     773:	e8 75 07 00 00       	call   eed <printf>
+  printf(1, "T2 - T1 = %d milliseconds\n", (time2 - time1));
+     778:	83 c4 0c             	add    $0xc,%esp
+     77b:	53                   	push   %ebx
+     77c:	68 90 17 00 00       	push   $0x1790
+     781:	6a 01                	push   $0x1
+     783:	e8 65 07 00 00       	call   eed <printf>
+  free(table);
+     788:	89 34 24             	mov    %esi,(%esp)
+     78b:	e8 1a 09 00 00       	call   10aa <free>
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	e9 61 fe ff ff       	jmp    5f9 <main+0x13a>
+    printf(1, "** All Tests Passed! **\n");
+     798:	83 ec 08             	sub    $0x8,%esp
+     79b:	68 ab 17 00 00       	push   $0x17ab
+     7a0:	6a 01                	push   $0x1
+     7a2:	e8 46 07 00 00       	call   eed <printf>
+     7a7:	83 c4 10             	add    $0x10,%esp
+     7aa:	e9 4a fe ff ff       	jmp    5f9 <main+0x13a>
+    printf(1, "FAILED: Default UID %d, out of range\n", uid);
+     7af:	83 ec 04             	sub    $0x4,%esp
+     7b2:	50                   	push   %eax
+     7b3:	68 4c 15 00 00       	push   $0x154c
+     7b8:	6a 01                	push   $0x1
+     7ba:	e8 2e 07 00 00       	call   eed <printf>
+     7bf:	83 c4 10             	add    $0x10,%esp
+    success = -1;
+     7c2:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     7c7:	e9 54 fe ff ff       	jmp    620 <main+0x161>
+    printf(1, "FAILED: Default GID %d, out of range\n", gid);
+     7cc:	83 ec 04             	sub    $0x4,%esp
+     7cf:	50                   	push   %eax
+     7d0:	68 74 15 00 00       	push   $0x1574
+     7d5:	6a 01                	push   $0x1
+     7d7:	e8 11 07 00 00       	call   eed <printf>
+     7dc:	83 c4 10             	add    $0x10,%esp
+    success = -1;
+     7df:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     7e4:	e9 d8 fe ff ff       	jmp    6c1 <main+0x202>
+  ret = fork();
+     7e9:	e8 1f 05 00 00       	call   d0d <fork>
+  if(ret == 0){
+     7ee:	85 c0                	test   %eax,%eax
+     7f0:	74 0a                	je     7fc <main+0x33d>
+    wait();
+     7f2:	e8 26 05 00 00       	call   d1d <wait>
+     7f7:	e9 0f 02 00 00       	jmp    a0b <main+0x54c>
+    uid = getuid();
+     7fc:	e8 c4 05 00 00       	call   dc5 <getuid>
+     801:	89 c3                	mov    %eax,%ebx
+    gid = getgid();
+     803:	e8 c5 05 00 00       	call   dcd <getgid>
+    if(uid != 12345){
+     808:	81 fb 39 30 00 00    	cmp    $0x3039,%ebx
+     80e:	75 1c                	jne    82c <main+0x36d>
+    else if(gid != 12345){
+     810:	3d 39 30 00 00       	cmp    $0x3039,%eax
+     815:	74 2d                	je     844 <main+0x385>
+      printf(2, "FAILED: Parent GID is 12345, child GID is %d\n", gid);
+     817:	83 ec 04             	sub    $0x4,%esp
+     81a:	50                   	push   %eax
+     81b:	68 08 16 00 00       	push   $0x1608
+     820:	6a 02                	push   $0x2
+     822:	e8 c6 06 00 00       	call   eed <printf>
+     827:	83 c4 10             	add    $0x10,%esp
+     82a:	eb 13                	jmp    83f <main+0x380>
+      printf(2, "FAILED: Parent UID is 12345, child UID is %d\n", uid);
+     82c:	83 ec 04             	sub    $0x4,%esp
+     82f:	53                   	push   %ebx
+     830:	68 d8 15 00 00       	push   $0x15d8
+     835:	6a 02                	push   $0x2
+     837:	e8 b1 06 00 00       	call   eed <printf>
+     83c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     83f:	e8 d1 04 00 00       	call   d15 <exit>
+      printf(1, "** Test Passed! **\n");
+     844:	83 ec 08             	sub    $0x8,%esp
+     847:	68 dd 17 00 00       	push   $0x17dd
+     84c:	6a 01                	push   $0x1
+     84e:	e8 9a 06 00 00       	call   eed <printf>
+     853:	83 c4 10             	add    $0x10,%esp
+     856:	eb e7                	jmp    83f <main+0x380>
+    ppid = getppid();
+     858:	e8 78 05 00 00       	call   dd5 <getppid>
+    if(ppid != pid)
+     85d:	39 c3                	cmp    %eax,%ebx
+     85f:	74 16                	je     877 <main+0x3b8>
+      printf(2, "FAILED: Parent PID is %d, Child's PPID is %d\n", pid, ppid);
+     861:	50                   	push   %eax
+     862:	53                   	push   %ebx
+     863:	68 64 16 00 00       	push   $0x1664
+     868:	6a 02                	push   $0x2
+     86a:	e8 7e 06 00 00       	call   eed <printf>
+     86f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     872:	e8 9e 04 00 00       	call   d15 <exit>
+      printf(1, "** Test passed! **\n");
+     877:	83 ec 08             	sub    $0x8,%esp
+     87a:	68 f1 17 00 00       	push   $0x17f1
+     87f:	6a 01                	push   $0x1
+     881:	e8 67 06 00 00       	call   eed <printf>
+     886:	83 c4 10             	add    $0x10,%esp
+     889:	eb e7                	jmp    872 <main+0x3b3>
+  table = malloc(sizeof(struct uproc));
+     88b:	83 ec 0c             	sub    $0xc,%esp
+     88e:	6a 4c                	push   $0x4c
+     890:	e8 7e 08 00 00       	call   1113 <malloc>
+     895:	89 c3                	mov    %eax,%ebx
+  if (!table) {
+     897:	83 c4 10             	add    $0x10,%esp
+     89a:	85 c0                	test   %eax,%eax
+     89c:	74 6e                	je     90c <main+0x44d>
+  ret = getprocs(1024, table);
+     89e:	83 ec 08             	sub    $0x8,%esp
+     8a1:	50                   	push   %eax
+     8a2:	68 00 04 00 00       	push   $0x400
+     8a7:	e8 41 05 00 00       	call   ded <getprocs>
+     8ac:	89 c6                	mov    %eax,%esi
+  free(table);
+     8ae:	89 1c 24             	mov    %ebx,(%esp)
+     8b1:	e8 f4 07 00 00       	call   10aa <free>
+  if(ret >= 0){
+     8b6:	83 c4 10             	add    $0x10,%esp
+     8b9:	85 f6                	test   %esi,%esi
+     8bb:	79 6a                	jns    927 <main+0x468>
+    success |= testprocarray( 1,  1);
+     8bd:	ba 01 00 00 00       	mov    $0x1,%edx
+     8c2:	b8 01 00 00 00       	mov    $0x1,%eax
+     8c7:	e8 34 f7 ff ff       	call   0 <testprocarray>
+     8cc:	89 c6                	mov    %eax,%esi
+    success |= testprocarray(16, 16);
+     8ce:	ba 10 00 00 00       	mov    $0x10,%edx
+     8d3:	b8 10 00 00 00       	mov    $0x10,%eax
+     8d8:	e8 23 f7 ff ff       	call   0 <testprocarray>
+     8dd:	89 c7                	mov    %eax,%edi
+    success |= testprocarray(64, 64);
+     8df:	ba 40 00 00 00       	mov    $0x40,%edx
+     8e4:	b8 40 00 00 00       	mov    $0x40,%eax
+     8e9:	e8 12 f7 ff ff       	call   0 <testprocarray>
+     8ee:	89 c3                	mov    %eax,%ebx
+     8f0:	09 fe                	or     %edi,%esi
+    success |= testprocarray(72, 64);
+     8f2:	ba 40 00 00 00       	mov    $0x40,%edx
+     8f7:	b8 48 00 00 00       	mov    $0x48,%eax
+     8fc:	e8 ff f6 ff ff       	call   0 <testprocarray>
+     901:	09 f3                	or     %esi,%ebx
+    if (success == 0)
+     903:	09 c3                	or     %eax,%ebx
+     905:	74 71                	je     978 <main+0x4b9>
+    exit();
+     907:	e8 09 04 00 00       	call   d15 <exit>
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+     90c:	68 06 01 00 00       	push   $0x106
+     911:	68 44 18 00 00       	push   $0x1844
+     916:	68 e4 11 00 00       	push   $0x11e4
+     91b:	6a 02                	push   $0x2
+     91d:	e8 cb 05 00 00       	call   eed <printf>
+    exit();
+     922:	e8 ee 03 00 00       	call   d15 <exit>
+    printf(2, "FAILED: called getprocs with max way larger than table and returned %d, not error\n", ret);
+     927:	83 ec 04             	sub    $0x4,%esp
+     92a:	56                   	push   %esi
+     92b:	68 f4 16 00 00       	push   $0x16f4
+     930:	6a 02                	push   $0x2
+     932:	e8 b6 05 00 00       	call   eed <printf>
+    success |= testprocarray( 1,  1);
+     937:	ba 01 00 00 00       	mov    $0x1,%edx
+     93c:	b8 01 00 00 00       	mov    $0x1,%eax
+     941:	e8 ba f6 ff ff       	call   0 <testprocarray>
+    success |= testprocarray(16, 16);
+     946:	ba 10 00 00 00       	mov    $0x10,%edx
+     94b:	b8 10 00 00 00       	mov    $0x10,%eax
+     950:	e8 ab f6 ff ff       	call   0 <testprocarray>
+    success |= testprocarray(64, 64);
+     955:	ba 40 00 00 00       	mov    $0x40,%edx
+     95a:	b8 40 00 00 00       	mov    $0x40,%eax
+     95f:	e8 9c f6 ff ff       	call   0 <testprocarray>
+    success |= testprocarray(72, 64);
+     964:	ba 40 00 00 00       	mov    $0x40,%edx
+     969:	b8 48 00 00 00       	mov    $0x48,%eax
+     96e:	e8 8d f6 ff ff       	call   0 <testprocarray>
+     973:	83 c4 10             	add    $0x10,%esp
+     976:	eb 8f                	jmp    907 <main+0x448>
+      printf(1, "** All Tests Passed **\n");
+     978:	83 ec 08             	sub    $0x8,%esp
+     97b:	68 05 18 00 00       	push   $0x1805
+     980:	6a 01                	push   $0x1
+     982:	e8 66 05 00 00       	call   eed <printf>
+     987:	83 c4 10             	add    $0x10,%esp
+     98a:	e9 78 ff ff ff       	jmp    907 <main+0x448>
+  wait();
+     98f:	e8 89 03 00 00       	call   d1d <wait>
+  #endif
+  #ifdef GETPROCS_TEST
+  testgetprocs();  // no need to pass argv[0]
+  #endif
+  #ifdef TIME_TEST
+  testtime();
+     994:	e8 c1 f8 ff ff       	call   25a <testtime>
+  #endif
+  printf(1, "\n** End of Tests **\n");
+     999:	83 ec 08             	sub    $0x8,%esp
+     99c:	68 1d 18 00 00       	push   $0x181d
+     9a1:	6a 01                	push   $0x1
+     9a3:	e8 45 05 00 00       	call   eed <printf>
+  exit();
+     9a8:	e8 68 03 00 00       	call   d15 <exit>
+  if (testgid(32768, 32767, -1))
+     9ad:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     9b2:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     9b7:	b8 00 80 00 00       	mov    $0x8000,%eax
+     9bc:	e8 be f7 ff ff       	call   17f <testgid>
+  printf(1, "\n----------\nRunning UID / GID Inheritance Test\n----------\n");
+     9c1:	83 ec 08             	sub    $0x8,%esp
+     9c4:	68 9c 15 00 00       	push   $0x159c
+     9c9:	6a 01                	push   $0x1
+     9cb:	e8 1d 05 00 00       	call   eed <printf>
+  if (testuid(12345, 12345, 0))
+     9d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     9d5:	ba 39 30 00 00       	mov    $0x3039,%edx
+     9da:	b8 39 30 00 00       	mov    $0x3039,%eax
+     9df:	e8 18 f7 ff ff       	call   fc <testuid>
+     9e4:	89 c3                	mov    %eax,%ebx
+  if (testgid(12345, 12345, 0))
+     9e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+     9eb:	ba 39 30 00 00       	mov    $0x3039,%edx
+     9f0:	b8 39 30 00 00       	mov    $0x3039,%eax
+     9f5:	e8 85 f7 ff ff       	call   17f <testgid>
+     9fa:	89 c2                	mov    %eax,%edx
+  if (testuid(12345, 12345, 0))
+     9fc:	83 c4 10             	add    $0x10,%esp
+     9ff:	f7 db                	neg    %ebx
+     a01:	19 c0                	sbb    %eax,%eax
+  if(success != 0)
+     a03:	09 d0                	or     %edx,%eax
+     a05:	0f 84 de fd ff ff    	je     7e9 <main+0x32a>
+  printf(1, "\n----------\nRunning PPID Test\n----------\n");
+     a0b:	83 ec 08             	sub    $0x8,%esp
+     a0e:	68 38 16 00 00       	push   $0x1638
+     a13:	6a 01                	push   $0x1
+     a15:	e8 d3 04 00 00       	call   eed <printf>
+  pid = getpid();
+     a1a:	e8 76 03 00 00       	call   d95 <getpid>
+     a1f:	89 c3                	mov    %eax,%ebx
+  ret = fork();
+     a21:	e8 e7 02 00 00       	call   d0d <fork>
+  if(ret == 0){
+     a26:	83 c4 10             	add    $0x10,%esp
+     a29:	85 c0                	test   %eax,%eax
+     a2b:	0f 84 27 fe ff ff    	je     858 <main+0x399>
+    wait();
+     a31:	e8 e7 02 00 00       	call   d1d <wait>
+  printf(1, "\n----------\nRunning GetProcs Test\n----------\n");
+     a36:	83 ec 08             	sub    $0x8,%esp
+     a39:	68 94 16 00 00       	push   $0x1694
+     a3e:	6a 01                	push   $0x1
+     a40:	e8 a8 04 00 00       	call   eed <printf>
+  printf(1, "Filling the proc[] array with dummy processes\n");
+     a45:	83 c4 08             	add    $0x8,%esp
+     a48:	68 c4 16 00 00       	push   $0x16c4
+     a4d:	6a 01                	push   $0x1
+     a4f:	e8 99 04 00 00       	call   eed <printf>
+  ret = fork();
+     a54:	e8 b4 02 00 00       	call   d0d <fork>
+  if (ret == 0){
+     a59:	83 c4 10             	add    $0x10,%esp
+     a5c:	85 c0                	test   %eax,%eax
+     a5e:	0f 85 2b ff ff ff    	jne    98f <main+0x4d0>
+    while((ret = fork()) == 0);
+     a64:	e8 a4 02 00 00       	call   d0d <fork>
+     a69:	85 c0                	test   %eax,%eax
+     a6b:	74 f7                	je     a64 <main+0x5a5>
+    if(ret > 0){
+     a6d:	0f 8e 18 fe ff ff    	jle    88b <main+0x3cc>
+      wait();
+     a73:	e8 a5 02 00 00       	call   d1d <wait>
+      exit();
+     a78:	e8 98 02 00 00       	call   d15 <exit>
+  if (testgid(-1, 32767, -1))
+     a7d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     a82:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     a87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a8c:	e8 ee f6 ff ff       	call   17f <testgid>
+     a91:	85 c0                	test   %eax,%eax
+     a93:	0f 85 14 ff ff ff    	jne    9ad <main+0x4ee>
+  if (testgid(32768, 32767, -1))
+     a99:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     a9e:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     aa3:	b8 00 80 00 00       	mov    $0x8000,%eax
+     aa8:	e8 d2 f6 ff ff       	call   17f <testgid>
+  if (success == 0)
+     aad:	e9 0f ff ff ff       	jmp    9c1 <main+0x502>
+
+00000ab2 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     ab2:	55                   	push   %ebp
+     ab3:	89 e5                	mov    %esp,%ebp
+     ab5:	53                   	push   %ebx
+     ab6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ab9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     abc:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     ac5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     ac8:	83 c0 01             	add    $0x1,%eax
+     acb:	84 d2                	test   %dl,%dl
+     acd:	75 f2                	jne    ac1 <strcpy+0xf>
+    ;
+  return os;
+}
+     acf:	89 c8                	mov    %ecx,%eax
+     ad1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ad4:	c9                   	leave
+     ad5:	c3                   	ret
+
+00000ad6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     ad6:	55                   	push   %ebp
+     ad7:	89 e5                	mov    %esp,%ebp
+     ad9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     adc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     adf:	0f b6 01             	movzbl (%ecx),%eax
+     ae2:	84 c0                	test   %al,%al
+     ae4:	74 11                	je     af7 <strcmp+0x21>
+     ae6:	38 02                	cmp    %al,(%edx)
+     ae8:	75 0d                	jne    af7 <strcmp+0x21>
+    p++, q++;
+     aea:	83 c1 01             	add    $0x1,%ecx
+     aed:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     af0:	0f b6 01             	movzbl (%ecx),%eax
+     af3:	84 c0                	test   %al,%al
+     af5:	75 ef                	jne    ae6 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+     af7:	0f b6 c0             	movzbl %al,%eax
+     afa:	0f b6 12             	movzbl (%edx),%edx
+     afd:	29 d0                	sub    %edx,%eax
+}
+     aff:	5d                   	pop    %ebp
+     b00:	c3                   	ret
+
+00000b01 <strlen>:
+
+uint
+strlen(char *s)
+{
+     b01:	55                   	push   %ebp
+     b02:	89 e5                	mov    %esp,%ebp
+     b04:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     b07:	80 3a 00             	cmpb   $0x0,(%edx)
+     b0a:	74 14                	je     b20 <strlen+0x1f>
+     b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b11:	83 c0 01             	add    $0x1,%eax
+     b14:	89 c1                	mov    %eax,%ecx
+     b16:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b1a:	75 f5                	jne    b11 <strlen+0x10>
+    ;
+  return n;
+}
+     b1c:	89 c8                	mov    %ecx,%eax
+     b1e:	5d                   	pop    %ebp
+     b1f:	c3                   	ret
+  for(n = 0; s[n]; n++)
+     b20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+     b25:	eb f5                	jmp    b1c <strlen+0x1b>
+
+00000b27 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     b27:	55                   	push   %ebp
+     b28:	89 e5                	mov    %esp,%ebp
+     b2a:	57                   	push   %edi
+     b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     b2e:	89 d7                	mov    %edx,%edi
+     b30:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b33:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b36:	fc                   	cld
+     b37:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     b39:	89 d0                	mov    %edx,%eax
+     b3b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     b3e:	c9                   	leave
+     b3f:	c3                   	ret
+
+00000b40 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	8b 45 08             	mov    0x8(%ebp),%eax
+     b46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     b4a:	0f b6 10             	movzbl (%eax),%edx
+     b4d:	84 d2                	test   %dl,%dl
+     b4f:	74 15                	je     b66 <strchr+0x26>
+    if(*s == c)
+     b51:	38 d1                	cmp    %dl,%cl
+     b53:	74 0f                	je     b64 <strchr+0x24>
+  for(; *s; s++)
+     b55:	83 c0 01             	add    $0x1,%eax
+     b58:	0f b6 10             	movzbl (%eax),%edx
+     b5b:	84 d2                	test   %dl,%dl
+     b5d:	75 f2                	jne    b51 <strchr+0x11>
+      return (char*)s;
+  return 0;
+     b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     b64:	5d                   	pop    %ebp
+     b65:	c3                   	ret
+  return 0;
+     b66:	b8 00 00 00 00       	mov    $0x0,%eax
+     b6b:	eb f7                	jmp    b64 <strchr+0x24>
+
+00000b6d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     b6d:	55                   	push   %ebp
+     b6e:	89 e5                	mov    %esp,%ebp
+     b70:	57                   	push   %edi
+     b71:	56                   	push   %esi
+     b72:	53                   	push   %ebx
+     b73:	83 ec 2c             	sub    $0x2c,%esp
+     b76:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     b79:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+     b7e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+     b81:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     b84:	83 c3 01             	add    $0x1,%ebx
+     b87:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     b8a:	7d 27                	jge    bb3 <gets+0x46>
+    cc = read(0, &c, 1);
+     b8c:	83 ec 04             	sub    $0x4,%esp
+     b8f:	6a 01                	push   $0x1
+     b91:	57                   	push   %edi
+     b92:	6a 00                	push   $0x0
+     b94:	e8 94 01 00 00       	call   d2d <read>
+    if(cc < 1)
+     b99:	83 c4 10             	add    $0x10,%esp
+     b9c:	85 c0                	test   %eax,%eax
+     b9e:	7e 13                	jle    bb3 <gets+0x46>
+      break;
+    buf[i++] = c;
+     ba0:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     ba4:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     ba8:	3c 0a                	cmp    $0xa,%al
+     baa:	74 04                	je     bb0 <gets+0x43>
+     bac:	3c 0d                	cmp    $0xd,%al
+     bae:	75 d1                	jne    b81 <gets+0x14>
+  for(i=0; i+1 < max; ){
+     bb0:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+     bb3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     bb6:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+     bba:	89 f0                	mov    %esi,%eax
+     bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bbf:	5b                   	pop    %ebx
+     bc0:	5e                   	pop    %esi
+     bc1:	5f                   	pop    %edi
+     bc2:	5d                   	pop    %ebp
+     bc3:	c3                   	ret
+
+00000bc4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     bc4:	55                   	push   %ebp
+     bc5:	89 e5                	mov    %esp,%ebp
+     bc7:	56                   	push   %esi
+     bc8:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     bc9:	83 ec 08             	sub    $0x8,%esp
+     bcc:	6a 00                	push   $0x0
+     bce:	ff 75 08             	push   0x8(%ebp)
+     bd1:	e8 7f 01 00 00       	call   d55 <open>
+  if(fd < 0)
+     bd6:	83 c4 10             	add    $0x10,%esp
+     bd9:	85 c0                	test   %eax,%eax
+     bdb:	78 24                	js     c01 <stat+0x3d>
+     bdd:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     bdf:	83 ec 08             	sub    $0x8,%esp
+     be2:	ff 75 0c             	push   0xc(%ebp)
+     be5:	50                   	push   %eax
+     be6:	e8 82 01 00 00       	call   d6d <fstat>
+     beb:	89 c6                	mov    %eax,%esi
+  close(fd);
+     bed:	89 1c 24             	mov    %ebx,(%esp)
+     bf0:	e8 48 01 00 00       	call   d3d <close>
+  return r;
+     bf5:	83 c4 10             	add    $0x10,%esp
+}
+     bf8:	89 f0                	mov    %esi,%eax
+     bfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bfd:	5b                   	pop    %ebx
+     bfe:	5e                   	pop    %esi
+     bff:	5d                   	pop    %ebp
+     c00:	c3                   	ret
+    return -1;
+     c01:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     c06:	eb f0                	jmp    bf8 <stat+0x34>
+
+00000c08 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     c08:	55                   	push   %ebp
+     c09:	89 e5                	mov    %esp,%ebp
+     c0b:	56                   	push   %esi
+     c0c:	53                   	push   %ebx
+     c0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     c10:	0f b6 0a             	movzbl (%edx),%ecx
+     c13:	80 f9 20             	cmp    $0x20,%cl
+     c16:	75 0b                	jne    c23 <atoi+0x1b>
+     c18:	83 c2 01             	add    $0x1,%edx
+     c1b:	0f b6 0a             	movzbl (%edx),%ecx
+     c1e:	80 f9 20             	cmp    $0x20,%cl
+     c21:	74 f5                	je     c18 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     c23:	80 f9 2d             	cmp    $0x2d,%cl
+     c26:	74 3c                	je     c64 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+     c28:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     c2b:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     c30:	f6 c1 fd             	test   $0xfd,%cl
+     c33:	74 34                	je     c69 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+     c35:	0f b6 0a             	movzbl (%edx),%ecx
+     c38:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     c3b:	3c 09                	cmp    $0x9,%al
+     c3d:	77 2f                	ja     c6e <atoi+0x66>
+     c3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+     c44:	83 c2 01             	add    $0x1,%edx
+     c47:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     c4a:	0f be c9             	movsbl %cl,%ecx
+     c4d:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+     c51:	0f b6 0a             	movzbl (%edx),%ecx
+     c54:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     c57:	3c 09                	cmp    $0x9,%al
+     c59:	76 e9                	jbe    c44 <atoi+0x3c>
+  return sign*n;
+     c5b:	89 f0                	mov    %esi,%eax
+     c5d:	0f af c3             	imul   %ebx,%eax
+}
+     c60:	5b                   	pop    %ebx
+     c61:	5e                   	pop    %esi
+     c62:	5d                   	pop    %ebp
+     c63:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+     c64:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     c69:	83 c2 01             	add    $0x1,%edx
+     c6c:	eb c7                	jmp    c35 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+     c6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c73:	eb e6                	jmp    c5b <atoi+0x53>
+
+00000c75 <atoo>:
+
+int
+atoo(const char *s)
+{
+     c75:	55                   	push   %ebp
+     c76:	89 e5                	mov    %esp,%ebp
+     c78:	56                   	push   %esi
+     c79:	53                   	push   %ebx
+     c7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     c7d:	0f b6 0a             	movzbl (%edx),%ecx
+     c80:	80 f9 20             	cmp    $0x20,%cl
+     c83:	75 0b                	jne    c90 <atoo+0x1b>
+     c85:	83 c2 01             	add    $0x1,%edx
+     c88:	0f b6 0a             	movzbl (%edx),%ecx
+     c8b:	80 f9 20             	cmp    $0x20,%cl
+     c8e:	74 f5                	je     c85 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     c90:	80 f9 2d             	cmp    $0x2d,%cl
+     c93:	74 3a                	je     ccf <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+     c95:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     c98:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     c9d:	f6 c1 fd             	test   $0xfd,%cl
+     ca0:	74 32                	je     cd4 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+     ca2:	0f b6 0a             	movzbl (%edx),%ecx
+     ca5:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     ca8:	80 fb 07             	cmp    $0x7,%bl
+     cab:	77 2c                	ja     cd9 <atoo+0x64>
+     cad:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+     cb2:	83 c2 01             	add    $0x1,%edx
+     cb5:	0f be c9             	movsbl %cl,%ecx
+     cb8:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+     cbc:	0f b6 0a             	movzbl (%edx),%ecx
+     cbf:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     cc2:	3c 07                	cmp    $0x7,%al
+     cc4:	76 ec                	jbe    cb2 <atoo+0x3d>
+  return sign*n;
+     cc6:	89 f0                	mov    %esi,%eax
+     cc8:	0f af c3             	imul   %ebx,%eax
+}
+     ccb:	5b                   	pop    %ebx
+     ccc:	5e                   	pop    %esi
+     ccd:	5d                   	pop    %ebp
+     cce:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+     ccf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     cd4:	83 c2 01             	add    $0x1,%edx
+     cd7:	eb c9                	jmp    ca2 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+     cd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cde:	eb e6                	jmp    cc6 <atoo+0x51>
+
+00000ce0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	56                   	push   %esi
+     ce4:	53                   	push   %ebx
+     ce5:	8b 75 08             	mov    0x8(%ebp),%esi
+     ce8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ceb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     cee:	85 db                	test   %ebx,%ebx
+     cf0:	7e 15                	jle    d07 <memmove+0x27>
+     cf2:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+     cf4:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+     cf6:	83 c2 01             	add    $0x1,%edx
+     cf9:	83 c0 01             	add    $0x1,%eax
+     cfc:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+     d00:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+     d03:	39 c3                	cmp    %eax,%ebx
+     d05:	75 ef                	jne    cf6 <memmove+0x16>
+  return vdst;
+}
+     d07:	89 f0                	mov    %esi,%eax
+     d09:	5b                   	pop    %ebx
+     d0a:	5e                   	pop    %esi
+     d0b:	5d                   	pop    %ebp
+     d0c:	c3                   	ret
+
+00000d0d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     d0d:	b8 01 00 00 00       	mov    $0x1,%eax
+     d12:	cd 40                	int    $0x40
+     d14:	c3                   	ret
+
+00000d15 <exit>:
+SYSCALL(exit)
+     d15:	b8 02 00 00 00       	mov    $0x2,%eax
+     d1a:	cd 40                	int    $0x40
+     d1c:	c3                   	ret
+
+00000d1d <wait>:
+SYSCALL(wait)
+     d1d:	b8 03 00 00 00       	mov    $0x3,%eax
+     d22:	cd 40                	int    $0x40
+     d24:	c3                   	ret
+
+00000d25 <pipe>:
+SYSCALL(pipe)
+     d25:	b8 04 00 00 00       	mov    $0x4,%eax
+     d2a:	cd 40                	int    $0x40
+     d2c:	c3                   	ret
+
+00000d2d <read>:
+SYSCALL(read)
+     d2d:	b8 05 00 00 00       	mov    $0x5,%eax
+     d32:	cd 40                	int    $0x40
+     d34:	c3                   	ret
+
+00000d35 <write>:
+SYSCALL(write)
+     d35:	b8 10 00 00 00       	mov    $0x10,%eax
+     d3a:	cd 40                	int    $0x40
+     d3c:	c3                   	ret
+
+00000d3d <close>:
+SYSCALL(close)
+     d3d:	b8 15 00 00 00       	mov    $0x15,%eax
+     d42:	cd 40                	int    $0x40
+     d44:	c3                   	ret
+
+00000d45 <kill>:
+SYSCALL(kill)
+     d45:	b8 06 00 00 00       	mov    $0x6,%eax
+     d4a:	cd 40                	int    $0x40
+     d4c:	c3                   	ret
+
+00000d4d <exec>:
+SYSCALL(exec)
+     d4d:	b8 07 00 00 00       	mov    $0x7,%eax
+     d52:	cd 40                	int    $0x40
+     d54:	c3                   	ret
+
+00000d55 <open>:
+SYSCALL(open)
+     d55:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d5a:	cd 40                	int    $0x40
+     d5c:	c3                   	ret
+
+00000d5d <mknod>:
+SYSCALL(mknod)
+     d5d:	b8 11 00 00 00       	mov    $0x11,%eax
+     d62:	cd 40                	int    $0x40
+     d64:	c3                   	ret
+
+00000d65 <unlink>:
+SYSCALL(unlink)
+     d65:	b8 12 00 00 00       	mov    $0x12,%eax
+     d6a:	cd 40                	int    $0x40
+     d6c:	c3                   	ret
+
+00000d6d <fstat>:
+SYSCALL(fstat)
+     d6d:	b8 08 00 00 00       	mov    $0x8,%eax
+     d72:	cd 40                	int    $0x40
+     d74:	c3                   	ret
+
+00000d75 <link>:
+SYSCALL(link)
+     d75:	b8 13 00 00 00       	mov    $0x13,%eax
+     d7a:	cd 40                	int    $0x40
+     d7c:	c3                   	ret
+
+00000d7d <mkdir>:
+SYSCALL(mkdir)
+     d7d:	b8 14 00 00 00       	mov    $0x14,%eax
+     d82:	cd 40                	int    $0x40
+     d84:	c3                   	ret
+
+00000d85 <chdir>:
+SYSCALL(chdir)
+     d85:	b8 09 00 00 00       	mov    $0x9,%eax
+     d8a:	cd 40                	int    $0x40
+     d8c:	c3                   	ret
+
+00000d8d <dup>:
+SYSCALL(dup)
+     d8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     d92:	cd 40                	int    $0x40
+     d94:	c3                   	ret
+
+00000d95 <getpid>:
+SYSCALL(getpid)
+     d95:	b8 0b 00 00 00       	mov    $0xb,%eax
+     d9a:	cd 40                	int    $0x40
+     d9c:	c3                   	ret
+
+00000d9d <sbrk>:
+SYSCALL(sbrk)
+     d9d:	b8 0c 00 00 00       	mov    $0xc,%eax
+     da2:	cd 40                	int    $0x40
+     da4:	c3                   	ret
+
+00000da5 <sleep>:
+SYSCALL(sleep)
+     da5:	b8 0d 00 00 00       	mov    $0xd,%eax
+     daa:	cd 40                	int    $0x40
+     dac:	c3                   	ret
+
+00000dad <uptime>:
+SYSCALL(uptime)
+     dad:	b8 0e 00 00 00       	mov    $0xe,%eax
+     db2:	cd 40                	int    $0x40
+     db4:	c3                   	ret
+
+00000db5 <halt>:
+SYSCALL(halt)
+     db5:	b8 16 00 00 00       	mov    $0x16,%eax
+     dba:	cd 40                	int    $0x40
+     dbc:	c3                   	ret
+
+00000dbd <date>:
+SYSCALL(date)
+     dbd:	b8 17 00 00 00       	mov    $0x17,%eax
+     dc2:	cd 40                	int    $0x40
+     dc4:	c3                   	ret
+
+00000dc5 <getuid>:
+SYSCALL(getuid)
+     dc5:	b8 18 00 00 00       	mov    $0x18,%eax
+     dca:	cd 40                	int    $0x40
+     dcc:	c3                   	ret
+
+00000dcd <getgid>:
+SYSCALL(getgid)
+     dcd:	b8 19 00 00 00       	mov    $0x19,%eax
+     dd2:	cd 40                	int    $0x40
+     dd4:	c3                   	ret
+
+00000dd5 <getppid>:
+SYSCALL(getppid)
+     dd5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     dda:	cd 40                	int    $0x40
+     ddc:	c3                   	ret
+
+00000ddd <setuid>:
+SYSCALL(setuid)
+     ddd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     de2:	cd 40                	int    $0x40
+     de4:	c3                   	ret
+
+00000de5 <setgid>:
+SYSCALL(setgid)
+     de5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     dea:	cd 40                	int    $0x40
+     dec:	c3                   	ret
+
+00000ded <getprocs>:
+SYSCALL(getprocs)
+     ded:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     df2:	cd 40                	int    $0x40
+     df4:	c3                   	ret
+
+00000df5 <setpriority>:
+SYSCALL(setpriority)
+     df5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     dfa:	cd 40                	int    $0x40
+     dfc:	c3                   	ret
+
+00000dfd <getpriority>:
+SYSCALL(getpriority)
+     dfd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     e02:	cd 40                	int    $0x40
+     e04:	c3                   	ret
+
+00000e05 <waitpid>:
+SYSCALL(waitpid)
+     e05:	b8 20 00 00 00       	mov    $0x20,%eax
+     e0a:	cd 40                	int    $0x40
+     e0c:	c3                   	ret
+
+00000e0d <setaffinity>:
+SYSCALL(setaffinity)
+     e0d:	b8 21 00 00 00       	mov    $0x21,%eax
+     e12:	cd 40                	int    $0x40
+     e14:	c3                   	ret
+
+00000e15 <getaffinity>:
+SYSCALL(getaffinity)
+     e15:	b8 22 00 00 00       	mov    $0x22,%eax
+     e1a:	cd 40                	int    $0x40
+     e1c:	c3                   	ret
+
+00000e1d <setdeadline>:
+SYSCALL(setdeadline)
+     e1d:	b8 23 00 00 00       	mov    $0x23,%eax
+     e22:	cd 40                	int    $0x40
+     e24:	c3                   	ret
+
+00000e25 <schedctl>:
+SYSCALL(schedctl)
+     e25:	b8 24 00 00 00       	mov    $0x24,%eax
+     e2a:	cd 40                	int    $0x40
+     e2c:	c3                   	ret
+
+00000e2d <spawn>:
+SYSCALL(spawn)
+     e2d:	b8 25 00 00 00       	mov    $0x25,%eax
+     e32:	cd 40                	int    $0x40
+     e34:	c3                   	ret
+
+00000e35 <vmstats>:
+SYSCALL(vmstats)
+     e35:	b8 26 00 00 00       	mov    $0x26,%eax
+     e3a:	cd 40                	int    $0x40
+     e3c:	c3                   	ret
+
+00000e3d <hugesbrk>:
+SYSCALL(hugesbrk)
+     e3d:	b8 27 00 00 00       	mov    $0x27,%eax
+     e42:	cd 40                	int    $0x40
+     e44:	c3                   	ret
+
+00000e45 <setshares>:
+SYSCALL(setshares)
+     e45:	b8 28 00 00 00       	mov    $0x28,%eax
+     e4a:	cd 40                	int    $0x40
+     e4c:	c3                   	ret
+
+00000e4d <getshares>:
+SYSCALL(getshares)
+     e4d:	b8 29 00 00 00       	mov    $0x29,%eax
+     e52:	cd 40                	int    $0x40
+     e54:	c3                   	ret
+
+00000e55 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     e55:	55                   	push   %ebp
+     e56:	89 e5                	mov    %esp,%ebp
+     e58:	57                   	push   %edi
+     e59:	56                   	push   %esi
+     e5a:	53                   	push   %ebx
+     e5b:	83 ec 3c             	sub    $0x3c,%esp
+     e5e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e61:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     e63:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     e67:	74 79                	je     ee2 <printint+0x8d>
+     e69:	85 d2                	test   %edx,%edx
+     e6b:	79 75                	jns    ee2 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+     e6d:	89 d1                	mov    %edx,%ecx
+     e6f:	f7 d9                	neg    %ecx
+    neg = 1;
+     e71:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     e7d:	89 df                	mov    %ebx,%edi
+     e7f:	83 c3 01             	add    $0x1,%ebx
+     e82:	89 c8                	mov    %ecx,%eax
+     e84:	ba 00 00 00 00       	mov    $0x0,%edx
+     e89:	f7 f6                	div    %esi
+     e8b:	0f b6 92 c4 18 00 00 	movzbl 0x18c4(%edx),%edx
+     e92:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+     e96:	89 ca                	mov    %ecx,%edx
+     e98:	89 c1                	mov    %eax,%ecx
+     e9a:	39 f2                	cmp    %esi,%edx
+     e9c:	73 df                	jae    e7d <printint+0x28>
+  if(neg)
+     e9e:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+     ea2:	74 08                	je     eac <printint+0x57>
+    buf[i++] = '-';
+     ea4:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     ea9:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+     eac:	85 db                	test   %ebx,%ebx
+     eae:	7e 2a                	jle    eda <printint+0x85>
+     eb0:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     eb3:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+     eb7:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+     eba:	0f b6 03             	movzbl (%ebx),%eax
+     ebd:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+     ec0:	83 ec 04             	sub    $0x4,%esp
+     ec3:	6a 01                	push   $0x1
+     ec5:	57                   	push   %edi
+     ec6:	ff 75 c4             	push   -0x3c(%ebp)
+     ec9:	e8 67 fe ff ff       	call   d35 <write>
+  while(--i >= 0)
+     ece:	89 d8                	mov    %ebx,%eax
+     ed0:	83 eb 01             	sub    $0x1,%ebx
+     ed3:	83 c4 10             	add    $0x10,%esp
+     ed6:	39 f0                	cmp    %esi,%eax
+     ed8:	75 e0                	jne    eba <printint+0x65>
+}
+     eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     edd:	5b                   	pop    %ebx
+     ede:	5e                   	pop    %esi
+     edf:	5f                   	pop    %edi
+     ee0:	5d                   	pop    %ebp
+     ee1:	c3                   	ret
+    x = xx;
+     ee2:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+     ee4:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+     eeb:	eb 8b                	jmp    e78 <printint+0x23>
+
+00000eed <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     eed:	55                   	push   %ebp
+     eee:	89 e5                	mov    %esp,%ebp
+     ef0:	57                   	push   %edi
+     ef1:	56                   	push   %esi
+     ef2:	53                   	push   %ebx
+     ef3:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     ef6:	8b 75 0c             	mov    0xc(%ebp),%esi
+     ef9:	0f b6 1e             	movzbl (%esi),%ebx
+     efc:	84 db                	test   %bl,%bl
+     efe:	0f 84 9e 01 00 00    	je     10a2 <printf+0x1b5>
+     f04:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     f07:	8d 45 10             	lea    0x10(%ebp),%eax
+     f0a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+     f0d:	bf 00 00 00 00       	mov    $0x0,%edi
+     f12:	eb 2d                	jmp    f41 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+     f14:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+     f17:	83 ec 04             	sub    $0x4,%esp
+     f1a:	6a 01                	push   $0x1
+     f1c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f1f:	50                   	push   %eax
+     f20:	ff 75 08             	push   0x8(%ebp)
+     f23:	e8 0d fe ff ff       	call   d35 <write>
+        putc(fd, c);
+     f28:	83 c4 10             	add    $0x10,%esp
+     f2b:	eb 05                	jmp    f32 <printf+0x45>
+      }
+    } else if(state == '%'){
+     f2d:	83 ff 25             	cmp    $0x25,%edi
+     f30:	74 1f                	je     f51 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+     f32:	83 c6 01             	add    $0x1,%esi
+     f35:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+     f39:	84 db                	test   %bl,%bl
+     f3b:	0f 84 61 01 00 00    	je     10a2 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+     f41:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     f44:	85 ff                	test   %edi,%edi
+     f46:	75 e5                	jne    f2d <printf+0x40>
+      if(c == '%'){
+     f48:	83 f8 25             	cmp    $0x25,%eax
+     f4b:	75 c7                	jne    f14 <printf+0x27>
+        state = '%';
+     f4d:	89 c7                	mov    %eax,%edi
+     f4f:	eb e1                	jmp    f32 <printf+0x45>
+      if(c == 'd'){
+     f51:	83 f8 25             	cmp    $0x25,%eax
+     f54:	0f 84 f4 00 00 00    	je     104e <printf+0x161>
+     f5a:	8d 50 9d             	lea    -0x63(%eax),%edx
+     f5d:	83 fa 15             	cmp    $0x15,%edx
+     f60:	0f 87 09 01 00 00    	ja     106f <printf+0x182>
+     f66:	0f 87 03 01 00 00    	ja     106f <printf+0x182>
+     f6c:	ff 24 95 6c 18 00 00 	jmp    *0x186c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+     f73:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     f76:	8b 17                	mov    (%edi),%edx
+     f78:	83 ec 0c             	sub    $0xc,%esp
+     f7b:	6a 01                	push   $0x1
+     f7d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     f82:	8b 45 08             	mov    0x8(%ebp),%eax
+     f85:	e8 cb fe ff ff       	call   e55 <printint>
+        ap++;
+     f8a:	83 c7 04             	add    $0x4,%edi
+     f8d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     f90:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+     f93:	bf 00 00 00 00       	mov    $0x0,%edi
+     f98:	eb 98                	jmp    f32 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+     f9a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     f9d:	8b 17                	mov    (%edi),%edx
+     f9f:	83 ec 0c             	sub    $0xc,%esp
+     fa2:	6a 00                	push   $0x0
+     fa4:	b9 10 00 00 00       	mov    $0x10,%ecx
+     fa9:	8b 45 08             	mov    0x8(%ebp),%eax
+     fac:	e8 a4 fe ff ff       	call   e55 <printint>
+        ap++;
+     fb1:	83 c7 04             	add    $0x4,%edi
+     fb4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     fb7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     fba:	bf 00 00 00 00       	mov    $0x0,%edi
+     fbf:	e9 6e ff ff ff       	jmp    f32 <printf+0x45>
+        s = (char*)*ap;
+     fc4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     fc7:	8b 01                	mov    (%ecx),%eax
+        ap++;
+     fc9:	83 c1 04             	add    $0x4,%ecx
+     fcc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+     fcf:	85 c0                	test   %eax,%eax
+     fd1:	74 13                	je     fe6 <printf+0xf9>
+        s = (char*)*ap;
+     fd3:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+     fd5:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+     fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+     fdd:	84 c0                	test   %al,%al
+     fdf:	75 0f                	jne    ff0 <printf+0x103>
+     fe1:	e9 4c ff ff ff       	jmp    f32 <printf+0x45>
+          s = "(null)";
+     fe6:	bb 64 18 00 00       	mov    $0x1864,%ebx
+        while(*s != 0){
+     feb:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+     ff0:	8d 7d e7             	lea    -0x19(%ebp),%edi
+     ff3:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     ff6:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+     ff9:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     ffc:	83 ec 04             	sub    $0x4,%esp
+     fff:	6a 01                	push   $0x1
+    1001:	57                   	push   %edi
+    1002:	56                   	push   %esi
+    1003:	e8 2d fd ff ff       	call   d35 <write>
+          s++;
+    1008:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    100b:	0f b6 03             	movzbl (%ebx),%eax
+    100e:	83 c4 10             	add    $0x10,%esp
+    1011:	84 c0                	test   %al,%al
+    1013:	75 e4                	jne    ff9 <printf+0x10c>
+      state = 0;
+    1015:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1018:	bf 00 00 00 00       	mov    $0x0,%edi
+    101d:	e9 10 ff ff ff       	jmp    f32 <printf+0x45>
+        putc(fd, *ap);
+    1022:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1025:	8b 07                	mov    (%edi),%eax
+    1027:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    102a:	83 ec 04             	sub    $0x4,%esp
+    102d:	6a 01                	push   $0x1
+    102f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1032:	50                   	push   %eax
+    1033:	ff 75 08             	push   0x8(%ebp)
+    1036:	e8 fa fc ff ff       	call   d35 <write>
+        ap++;
+    103b:	83 c7 04             	add    $0x4,%edi
+    103e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1041:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1044:	bf 00 00 00 00       	mov    $0x0,%edi
+    1049:	e9 e4 fe ff ff       	jmp    f32 <printf+0x45>
+        putc(fd, c);
+    104e:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    1051:	83 ec 04             	sub    $0x4,%esp
+    1054:	6a 01                	push   $0x1
+    1056:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1059:	50                   	push   %eax
+    105a:	ff 75 08             	push   0x8(%ebp)
+    105d:	e8 d3 fc ff ff       	call   d35 <write>
+    1062:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1065:	bf 00 00 00 00       	mov    $0x0,%edi
+    106a:	e9 c3 fe ff ff       	jmp    f32 <printf+0x45>
+        putc(fd, '%');
+    106f:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    1073:	83 ec 04             	sub    $0x4,%esp
+    1076:	6a 01                	push   $0x1
+    1078:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    107b:	57                   	push   %edi
+    107c:	ff 75 08             	push   0x8(%ebp)
+    107f:	e8 b1 fc ff ff       	call   d35 <write>
+        putc(fd, c);
+    1084:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    1087:	83 c4 0c             	add    $0xc,%esp
+    108a:	6a 01                	push   $0x1
+    108c:	57                   	push   %edi
+    108d:	ff 75 08             	push   0x8(%ebp)
+    1090:	e8 a0 fc ff ff       	call   d35 <write>
+        putc(fd, c);
+    1095:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1098:	bf 00 00 00 00       	mov    $0x0,%edi
+    109d:	e9 90 fe ff ff       	jmp    f32 <printf+0x45>
+    }
+  }
+}
+    10a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10a5:	5b                   	pop    %ebx
+    10a6:	5e                   	pop    %esi
+    10a7:	5f                   	pop    %edi
+    10a8:	5d                   	pop    %ebp
+    10a9:	c3                   	ret
+
+000010aa <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    10aa:	55                   	push   %ebp
+    10ab:	89 e5                	mov    %esp,%ebp
+    10ad:	57                   	push   %edi
+    10ae:	56                   	push   %esi
+    10af:	53                   	push   %ebx
+    10b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    10b3:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10b6:	a1 78 1c 00 00       	mov    0x1c78,%eax
+    10bb:	eb 0c                	jmp    10c9 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10bd:	8b 10                	mov    (%eax),%edx
+    10bf:	39 d0                	cmp    %edx,%eax
+    10c1:	72 04                	jb     10c7 <free+0x1d>
+    10c3:	39 d1                	cmp    %edx,%ecx
+    10c5:	72 10                	jb     10d7 <free+0x2d>
+{
+    10c7:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10c9:	39 c8                	cmp    %ecx,%eax
+    10cb:	73 f0                	jae    10bd <free+0x13>
+    10cd:	8b 10                	mov    (%eax),%edx
+    10cf:	39 d1                	cmp    %edx,%ecx
+    10d1:	72 04                	jb     10d7 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10d3:	39 d0                	cmp    %edx,%eax
+    10d5:	72 f0                	jb     10c7 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    10d7:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    10da:	8b 10                	mov    (%eax),%edx
+    10dc:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    10df:	39 fa                	cmp    %edi,%edx
+    10e1:	74 19                	je     10fc <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10e3:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    10e6:	8b 50 04             	mov    0x4(%eax),%edx
+    10e9:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    10ec:	39 f1                	cmp    %esi,%ecx
+    10ee:	74 18                	je     1108 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    10f0:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    10f2:	a3 78 1c 00 00       	mov    %eax,0x1c78
+}
+    10f7:	5b                   	pop    %ebx
+    10f8:	5e                   	pop    %esi
+    10f9:	5f                   	pop    %edi
+    10fa:	5d                   	pop    %ebp
+    10fb:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    10fc:	03 72 04             	add    0x4(%edx),%esi
+    10ff:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1102:	8b 10                	mov    (%eax),%edx
+    1104:	8b 12                	mov    (%edx),%edx
+    1106:	eb db                	jmp    10e3 <free+0x39>
+    p->s.size += bp->s.size;
+    1108:	03 53 fc             	add    -0x4(%ebx),%edx
+    110b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    110e:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1111:	eb dd                	jmp    10f0 <free+0x46>
+
+00001113 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1113:	55                   	push   %ebp
+    1114:	89 e5                	mov    %esp,%ebp
+    1116:	57                   	push   %edi
+    1117:	56                   	push   %esi
+    1118:	53                   	push   %ebx
+    1119:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    111c:	8b 45 08             	mov    0x8(%ebp),%eax
+    111f:	8d 58 07             	lea    0x7(%eax),%ebx
+    1122:	c1 eb 03             	shr    $0x3,%ebx
+    1125:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    1128:	8b 15 78 1c 00 00    	mov    0x1c78,%edx
+    112e:	85 d2                	test   %edx,%edx
+    1130:	74 1c                	je     114e <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1132:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1134:	8b 48 04             	mov    0x4(%eax),%ecx
+    1137:	39 d9                	cmp    %ebx,%ecx
+    1139:	73 38                	jae    1173 <malloc+0x60>
+  if(nu < 4096)
+    113b:	be 00 10 00 00       	mov    $0x1000,%esi
+    1140:	39 f3                	cmp    %esi,%ebx
+    1142:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    1145:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    114c:	eb 72                	jmp    11c0 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    114e:	c7 05 78 1c 00 00 7c 	movl   $0x1c7c,0x1c78
+    1155:	1c 00 00 
+    1158:	c7 05 7c 1c 00 00 7c 	movl   $0x1c7c,0x1c7c
+    115f:	1c 00 00 
+    base.s.size = 0;
+    1162:	c7 05 80 1c 00 00 00 	movl   $0x0,0x1c80
+    1169:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    116c:	b8 7c 1c 00 00       	mov    $0x1c7c,%eax
+    if(p->s.size >= nunits){
+    1171:	eb c8                	jmp    113b <malloc+0x28>
+      if(p->s.size == nunits)
+    1173:	39 cb                	cmp    %ecx,%ebx
+    1175:	74 1e                	je     1195 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    1177:	29 d9                	sub    %ebx,%ecx
+    1179:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    117c:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    117f:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    1182:	89 15 78 1c 00 00    	mov    %edx,0x1c78
+      return (void*)(p + 1);
+    1188:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    118b:	89 d0                	mov    %edx,%eax
+    118d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1190:	5b                   	pop    %ebx
+    1191:	5e                   	pop    %esi
+    1192:	5f                   	pop    %edi
+    1193:	5d                   	pop    %ebp
+    1194:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    1195:	8b 08                	mov    (%eax),%ecx
+    1197:	89 0a                	mov    %ecx,(%edx)
+    1199:	eb e7                	jmp    1182 <malloc+0x6f>
+  hp->s.size = nu;
+    119b:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    119e:	83 ec 0c             	sub    $0xc,%esp
+    11a1:	83 c0 08             	add    $0x8,%eax
+    11a4:	50                   	push   %eax
+    11a5:	e8 00 ff ff ff       	call   10aa <free>
+  return freep;
+    11aa:	8b 15 78 1c 00 00    	mov    0x1c78,%edx
+      if((p = morecore(nunits)) == 0)
+    11b0:	83 c4 10             	add    $0x10,%esp
+    11b3:	85 d2                	test   %edx,%edx
+    11b5:	74 d4                	je     118b <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11b7:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    11b9:	8b 48 04             	mov    0x4(%eax),%ecx
+    11bc:	39 d9                	cmp    %ebx,%ecx
+    11be:	73 b3                	jae    1173 <malloc+0x60>
+    if(p == freep)
+    11c0:	89 c2                	mov    %eax,%edx
+    11c2:	39 05 78 1c 00 00    	cmp    %eax,0x1c78
+    11c8:	75 ed                	jne    11b7 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    11ca:	83 ec 0c             	sub    $0xc,%esp
+    11cd:	57                   	push   %edi
+    11ce:	e8 ca fb ff ff       	call   d9d <sbrk>
+  if(p == (char*)-1)
+    11d3:	83 c4 10             	add    $0x10,%esp
+    11d6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11d9:	75 c0                	jne    119b <malloc+0x88>
+        return 0;
+    11db:	ba 00 00 00 00       	mov    $0x0,%edx
+    11e0:	eb a9                	jmp    118b <malloc+0x78>
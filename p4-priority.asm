@@ -0,0 +1,1581 @@
+
+_p4-priority:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <testPromotion>:
+// This tests the promotion facility.
+//
+// It is assumed that setpriority will return the appropriate success/failure codes
+void
+testPromotion(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+  int pid, prio, newPrio, rc;
+  // Test promotion
+  printf(1, "\n\nTesting promotion...\n");
+   5:	83 ec 08             	sub    $0x8,%esp
+   8:	68 80 0a 00 00       	push   $0xa80
+   d:	6a 01                	push   $0x1
+   f:	e8 74 07 00 00       	call   788 <printf>
+  pid = getpid();
+  14:	e8 17 06 00 00       	call   630 <getpid>
+  19:	89 c3                	mov    %eax,%ebx
+
+  rc = setpriority(pid, 0);
+  1b:	83 c4 08             	add    $0x8,%esp
+  1e:	6a 00                	push   $0x0
+  20:	50                   	push   %eax
+  21:	e8 6a 06 00 00       	call   690 <setpriority>
+
+  if (rc != 0) {
+  26:	83 c4 10             	add    $0x10,%esp
+  29:	85 c0                	test   %eax,%eax
+  2b:	75 49                	jne    76 <testPromotion+0x76>
+    printf(2, "setpriority returned failure code!\n");
+    printf(2, "**** TEST FAILED ****\n\n\n");
+    return;
+  }
+
+  prio = getpriority(pid);
+  2d:	83 ec 0c             	sub    $0xc,%esp
+  30:	53                   	push   %ebx
+  31:	e8 62 06 00 00       	call   698 <getpriority>
+  36:	89 c6                	mov    %eax,%esi
+
+  sleep(TICKS_TO_PROMOTE + 100);
+  38:	c7 04 24 4c 04 00 00 	movl   $0x44c,(%esp)
+  3f:	e8 fc 05 00 00       	call   640 <sleep>
+
+  newPrio = getpriority(pid);
+  44:	89 1c 24             	mov    %ebx,(%esp)
+  47:	e8 4c 06 00 00       	call   698 <getpriority>
+
+  if (newPrio != prio && newPrio > prio) {
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	39 c6                	cmp    %eax,%esi
+  51:	7d 4b                	jge    9e <testPromotion+0x9e>
+    printf(1, "Promotion has occurred.\n");
+  53:	83 ec 08             	sub    $0x8,%esp
+  56:	68 b1 0a 00 00       	push   $0xab1
+  5b:	6a 01                	push   $0x1
+  5d:	e8 26 07 00 00       	call   788 <printf>
+    printf(1, "**** TEST PASSES ****\n\n\n");
+  62:	83 c4 08             	add    $0x8,%esp
+  65:	68 ca 0a 00 00       	push   $0xaca
+  6a:	6a 01                	push   $0x1
+  6c:	e8 17 07 00 00       	call   788 <printf>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	eb 21                	jmp    97 <testPromotion+0x97>
+    printf(2, "setpriority returned failure code!\n");
+  76:	83 ec 08             	sub    $0x8,%esp
+  79:	68 84 0b 00 00       	push   $0xb84
+  7e:	6a 02                	push   $0x2
+  80:	e8 03 07 00 00       	call   788 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+  85:	83 c4 08             	add    $0x8,%esp
+  88:	68 98 0a 00 00       	push   $0xa98
+  8d:	6a 02                	push   $0x2
+  8f:	e8 f4 06 00 00       	call   788 <printf>
+    return;
+  94:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(2, "Either promotion did not occur or an unexpected change in priority happened.\n");
+    printf(2, "**** TEST FAILED ****\n\n\n");
+  }
+}
+  97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  9a:	5b                   	pop    %ebx
+  9b:	5e                   	pop    %esi
+  9c:	5d                   	pop    %ebp
+  9d:	c3                   	ret
+    printf(2, "Either promotion did not occur or an unexpected change in priority happened.\n");
+  9e:	83 ec 08             	sub    $0x8,%esp
+  a1:	68 a8 0b 00 00       	push   $0xba8
+  a6:	6a 02                	push   $0x2
+  a8:	e8 db 06 00 00       	call   788 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+  ad:	83 c4 08             	add    $0x8,%esp
+  b0:	68 98 0a 00 00       	push   $0xa98
+  b5:	6a 02                	push   $0x2
+  b7:	e8 cc 06 00 00       	call   788 <printf>
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	eb d6                	jmp    97 <testPromotion+0x97>
+
+000000c1 <checkPriority>:
+
+// Create a process and change the priority
+void
+checkPriority(void)
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	57                   	push   %edi
+  c5:	56                   	push   %esi
+  c6:	53                   	push   %ebx
+  c7:	83 ec 14             	sub    $0x14,%esp
+  int pid;
+  int originalPriority;
+  int newPriority;
+  int rc;
+
+  printf(1, "Testing that process starts at MAXPRIO\n");
+  ca:	68 f8 0b 00 00       	push   $0xbf8
+  cf:	6a 01                	push   $0x1
+  d1:	e8 b2 06 00 00       	call   788 <printf>
+
+  pid = getpid();
+  d6:	e8 55 05 00 00       	call   630 <getpid>
+  db:	89 c3                	mov    %eax,%ebx
+  originalPriority = getpriority(pid);
+  dd:	89 04 24             	mov    %eax,(%esp)
+  e0:	e8 b3 05 00 00       	call   698 <getpriority>
+  e5:	89 c6                	mov    %eax,%esi
+
+  printf(1, "Priority after program start is %d\n", originalPriority);
+  e7:	83 c4 0c             	add    $0xc,%esp
+  ea:	50                   	push   %eax
+  eb:	68 20 0c 00 00       	push   $0xc20
+  f0:	6a 01                	push   $0x1
+  f2:	e8 91 06 00 00       	call   788 <printf>
+  if (originalPriority != MAXPRIO) {
+  f7:	83 c4 10             	add    $0x10,%esp
+  fa:	83 fe 06             	cmp    $0x6,%esi
+  fd:	0f 84 32 01 00 00    	je     235 <checkPriority+0x174>
+    printf(2, "Process didn't start at MAXPRIO\n");
+ 103:	83 ec 08             	sub    $0x8,%esp
+ 106:	68 44 0c 00 00       	push   $0xc44
+ 10b:	6a 02                	push   $0x2
+ 10d:	e8 76 06 00 00       	call   788 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+ 112:	83 c4 08             	add    $0x8,%esp
+ 115:	68 98 0a 00 00       	push   $0xa98
+ 11a:	6a 02                	push   $0x2
+ 11c:	e8 67 06 00 00       	call   788 <printf>
+ 121:	83 c4 10             	add    $0x10,%esp
+  }
+
+  // Test that setting the priority
+  //  1. Returns an appropriate code on success
+  //  2. Actually changes the priority on success
+  rc = setpriority(pid, MAXPRIO);
+ 124:	83 ec 08             	sub    $0x8,%esp
+ 127:	6a 06                	push   $0x6
+ 129:	53                   	push   %ebx
+ 12a:	e8 61 05 00 00       	call   690 <setpriority>
+  if (rc != 0) {
+ 12f:	83 c4 10             	add    $0x10,%esp
+ 132:	85 c0                	test   %eax,%eax
+ 134:	0f 84 12 01 00 00    	je     24c <checkPriority+0x18b>
+    printf(2, "setpriority(%d, %d) failed!\n", pid, MAXPRIO);
+ 13a:	6a 06                	push   $0x6
+ 13c:	53                   	push   %ebx
+ 13d:	68 e3 0a 00 00       	push   $0xae3
+ 142:	6a 02                	push   $0x2
+ 144:	e8 3f 06 00 00       	call   788 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+ 149:	83 c4 08             	add    $0x8,%esp
+ 14c:	68 98 0a 00 00       	push   $0xa98
+ 151:	6a 02                	push   $0x2
+ 153:	e8 30 06 00 00       	call   788 <printf>
+ 158:	83 c4 10             	add    $0x10,%esp
+      printf(2, "**** TEST FAILED ****\n\n\n");
+    }
+  }
+
+  // Test that the priority cannot be set to a negative number:
+  printf(1, "Testing that a priority cannot be set to an out of range value.\n");
+ 15b:	83 ec 08             	sub    $0x8,%esp
+ 15e:	68 94 0c 00 00       	push   $0xc94
+ 163:	6a 01                	push   $0x1
+ 165:	e8 1e 06 00 00       	call   788 <printf>
+  printf(1, "  Testing setting priority to a negative number.\n");
+ 16a:	83 c4 08             	add    $0x8,%esp
+ 16d:	68 d8 0c 00 00       	push   $0xcd8
+ 172:	6a 01                	push   $0x1
+ 174:	e8 0f 06 00 00       	call   788 <printf>
+  originalPriority = getpriority(pid);
+ 179:	89 1c 24             	mov    %ebx,(%esp)
+ 17c:	e8 17 05 00 00       	call   698 <getpriority>
+ 181:	89 c7                	mov    %eax,%edi
+  rc = setpriority(pid, -1);
+ 183:	83 c4 08             	add    $0x8,%esp
+ 186:	6a ff                	push   $0xffffffff
+ 188:	53                   	push   %ebx
+ 189:	e8 02 05 00 00       	call   690 <setpriority>
+ 18e:	89 c6                	mov    %eax,%esi
+  printf(1, "  setPriority(%d, -1) returned %d.\n", pid, rc);
+ 190:	50                   	push   %eax
+ 191:	53                   	push   %ebx
+ 192:	68 0c 0d 00 00       	push   $0xd0c
+ 197:	6a 01                	push   $0x1
+ 199:	e8 ea 05 00 00       	call   788 <printf>
+  if (rc != 0) {
+ 19e:	83 c4 20             	add    $0x20,%esp
+ 1a1:	85 f6                	test   %esi,%esi
+ 1a3:	0f 84 ef 00 00 00    	je     298 <checkPriority+0x1d7>
+    printf(1, "  **** TEST PASSED ****\n\n\n");
+ 1a9:	83 ec 08             	sub    $0x8,%esp
+ 1ac:	68 1d 0b 00 00       	push   $0xb1d
+ 1b1:	6a 01                	push   $0x1
+ 1b3:	e8 d0 05 00 00       	call   788 <printf>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+      printf(2, "  **** TEST FAILED ****\n\n");
+    }
+  }
+
+  // Test that the priority on a bogus PID cannot be set
+  printf(1, "  Testing that a priority cannot be set on a non-existent PID.\n");
+ 1bb:	83 ec 08             	sub    $0x8,%esp
+ 1be:	68 c8 0d 00 00       	push   $0xdc8
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 be 05 00 00       	call   788 <printf>
+  rc = setpriority(32767, MAXPRIO);
+ 1ca:	83 c4 08             	add    $0x8,%esp
+ 1cd:	6a 06                	push   $0x6
+ 1cf:	68 ff 7f 00 00       	push   $0x7fff
+ 1d4:	e8 b7 04 00 00       	call   690 <setpriority>
+  if (rc != 0) {
+ 1d9:	83 c4 10             	add    $0x10,%esp
+ 1dc:	85 c0                	test   %eax,%eax
+ 1de:	0f 84 1b 01 00 00    	je     2ff <checkPriority+0x23e>
+    printf(1, "  **** TEST PASSED ****\n\n\n");
+ 1e4:	83 ec 08             	sub    $0x8,%esp
+ 1e7:	68 1d 0b 00 00       	push   $0xb1d
+ 1ec:	6a 01                	push   $0x1
+ 1ee:	e8 95 05 00 00       	call   788 <printf>
+ 1f3:	83 c4 10             	add    $0x10,%esp
+    printf(2, "  **** TEST FAILED ****\n\n");
+  }
+
+  // Test the priority of a known PID:
+  pid = 1; // init
+  int prio = getpriority(pid);
+ 1f6:	83 ec 0c             	sub    $0xc,%esp
+ 1f9:	6a 01                	push   $0x1
+ 1fb:	e8 98 04 00 00       	call   698 <getpriority>
+  printf(1, "Priority for pid %d is %d\n", pid, prio);
+ 200:	50                   	push   %eax
+ 201:	6a 01                	push   $0x1
+ 203:	68 52 0b 00 00       	push   $0xb52
+ 208:	6a 01                	push   $0x1
+ 20a:	e8 79 05 00 00       	call   788 <printf>
+  printf(1, "Press C-p to verify.\n");
+ 20f:	83 c4 18             	add    $0x18,%esp
+ 212:	68 6d 0b 00 00       	push   $0xb6d
+ 217:	6a 01                	push   $0x1
+ 219:	e8 6a 05 00 00       	call   788 <printf>
+  sleep(5 * TPS);
+ 21e:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+ 225:	e8 16 04 00 00       	call   640 <sleep>
+}
+ 22a:	83 c4 10             	add    $0x10,%esp
+ 22d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 230:	5b                   	pop    %ebx
+ 231:	5e                   	pop    %esi
+ 232:	5f                   	pop    %edi
+ 233:	5d                   	pop    %ebp
+ 234:	c3                   	ret
+    printf(1, "**** TEST PASSED ****\n\n\n");
+ 235:	83 ec 08             	sub    $0x8,%esp
+ 238:	68 1f 0b 00 00       	push   $0xb1f
+ 23d:	6a 01                	push   $0x1
+ 23f:	e8 44 05 00 00       	call   788 <printf>
+ 244:	83 c4 10             	add    $0x10,%esp
+ 247:	e9 d8 fe ff ff       	jmp    124 <checkPriority+0x63>
+    newPriority = getpriority(pid);
+ 24c:	83 ec 0c             	sub    $0xc,%esp
+ 24f:	53                   	push   %ebx
+ 250:	e8 43 04 00 00       	call   698 <getpriority>
+ 255:	89 c6                	mov    %eax,%esi
+    if (newPriority != MAXPRIO) {
+ 257:	83 c4 10             	add    $0x10,%esp
+ 25a:	83 f8 06             	cmp    $0x6,%eax
+ 25d:	0f 84 f8 fe ff ff    	je     15b <checkPriority+0x9a>
+      printf(2, "setpriority(%d, %d) failed.\n", pid, MAXPRIO);
+ 263:	6a 06                	push   $0x6
+ 265:	53                   	push   %ebx
+ 266:	68 00 0b 00 00       	push   $0xb00
+ 26b:	6a 02                	push   $0x2
+ 26d:	e8 16 05 00 00       	call   788 <printf>
+      printf(2, "New priority is %d, but it should be %d.\n", newPriority, MAXPRIO);
+ 272:	6a 06                	push   $0x6
+ 274:	56                   	push   %esi
+ 275:	68 68 0c 00 00       	push   $0xc68
+ 27a:	6a 02                	push   $0x2
+ 27c:	e8 07 05 00 00       	call   788 <printf>
+      printf(2, "**** TEST FAILED ****\n\n\n");
+ 281:	83 c4 18             	add    $0x18,%esp
+ 284:	68 98 0a 00 00       	push   $0xa98
+ 289:	6a 02                	push   $0x2
+ 28b:	e8 f8 04 00 00       	call   788 <printf>
+ 290:	83 c4 10             	add    $0x10,%esp
+ 293:	e9 c3 fe ff ff       	jmp    15b <checkPriority+0x9a>
+    printf(2, "  setPriority should have indicated failed.\n");
+ 298:	83 ec 08             	sub    $0x8,%esp
+ 29b:	68 30 0d 00 00       	push   $0xd30
+ 2a0:	6a 02                	push   $0x2
+ 2a2:	e8 e1 04 00 00       	call   788 <printf>
+    printf(2, "  **** TEST FAILED ****\n\n");
+ 2a7:	83 c4 08             	add    $0x8,%esp
+ 2aa:	68 38 0b 00 00       	push   $0xb38
+ 2af:	6a 02                	push   $0x2
+ 2b1:	e8 d2 04 00 00       	call   788 <printf>
+    newPriority = getpriority(pid);
+ 2b6:	89 1c 24             	mov    %ebx,(%esp)
+ 2b9:	e8 da 03 00 00       	call   698 <getpriority>
+ 2be:	89 c3                	mov    %eax,%ebx
+    if (newPriority != originalPriority) {
+ 2c0:	83 c4 10             	add    $0x10,%esp
+ 2c3:	39 c7                	cmp    %eax,%edi
+ 2c5:	0f 84 f0 fe ff ff    	je     1bb <checkPriority+0xfa>
+      printf(2, "  setPriority failed but the priority was changed.\n");
+ 2cb:	83 ec 08             	sub    $0x8,%esp
+ 2ce:	68 60 0d 00 00       	push   $0xd60
+ 2d3:	6a 02                	push   $0x2
+ 2d5:	e8 ae 04 00 00       	call   788 <printf>
+      printf(2, "  Original priority was %d; new priority is %d.\n", originalPriority, newPriority);
+ 2da:	53                   	push   %ebx
+ 2db:	57                   	push   %edi
+ 2dc:	68 94 0d 00 00       	push   $0xd94
+ 2e1:	6a 02                	push   $0x2
+ 2e3:	e8 a0 04 00 00       	call   788 <printf>
+      printf(2, "  **** TEST FAILED ****\n\n");
+ 2e8:	83 c4 18             	add    $0x18,%esp
+ 2eb:	68 38 0b 00 00       	push   $0xb38
+ 2f0:	6a 02                	push   $0x2
+ 2f2:	e8 91 04 00 00       	call   788 <printf>
+ 2f7:	83 c4 10             	add    $0x10,%esp
+ 2fa:	e9 bc fe ff ff       	jmp    1bb <checkPriority+0xfa>
+    printf(2, "  Attempted to set the priority of PID 32767 to %d.\n", MAXPRIO);
+ 2ff:	83 ec 04             	sub    $0x4,%esp
+ 302:	6a 06                	push   $0x6
+ 304:	68 08 0e 00 00       	push   $0xe08
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 78 04 00 00       	call   788 <printf>
+    printf(2, "  This should have returned a non-zero value but returned %d.\n", rc);
+ 310:	83 c4 0c             	add    $0xc,%esp
+ 313:	6a 00                	push   $0x0
+ 315:	68 40 0e 00 00       	push   $0xe40
+ 31a:	6a 02                	push   $0x2
+ 31c:	e8 67 04 00 00       	call   788 <printf>
+    printf(2, "  **** TEST FAILED ****\n\n");
+ 321:	83 c4 08             	add    $0x8,%esp
+ 324:	68 38 0b 00 00       	push   $0xb38
+ 329:	6a 02                	push   $0x2
+ 32b:	e8 58 04 00 00       	call   788 <printf>
+ 330:	83 c4 10             	add    $0x10,%esp
+ 333:	e9 be fe ff ff       	jmp    1f6 <checkPriority+0x135>
+
+00000338 <main>:
+
+int
+main(int argc, char* argv[])
+{
+ 338:	55                   	push   %ebp
+ 339:	89 e5                	mov    %esp,%ebp
+ 33b:	83 e4 f0             	and    $0xfffffff0,%esp
+  if (MAXPRIO == 0) {
+    printf(1, "MAXPRIO is 0. Change MAXPRIO and try again\n");
+    exit();
+  }
+
+  checkPriority();
+ 33e:	e8 7e fd ff ff       	call   c1 <checkPriority>
+
+  testPromotion();
+ 343:	e8 b8 fc ff ff       	call   0 <testPromotion>
+  exit();
+ 348:	e8 63 02 00 00       	call   5b0 <exit>
+
+0000034d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 34d:	55                   	push   %ebp
+ 34e:	89 e5                	mov    %esp,%ebp
+ 350:	53                   	push   %ebx
+ 351:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 354:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 357:	b8 00 00 00 00       	mov    $0x0,%eax
+ 35c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 360:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 363:	83 c0 01             	add    $0x1,%eax
+ 366:	84 d2                	test   %dl,%dl
+ 368:	75 f2                	jne    35c <strcpy+0xf>
+    ;
+  return os;
+}
+ 36a:	89 c8                	mov    %ecx,%eax
+ 36c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36f:	c9                   	leave
+ 370:	c3                   	ret
+
+00000371 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 371:	55                   	push   %ebp
+ 372:	89 e5                	mov    %esp,%ebp
+ 374:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 377:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 37a:	0f b6 01             	movzbl (%ecx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	74 11                	je     392 <strcmp+0x21>
+ 381:	38 02                	cmp    %al,(%edx)
+ 383:	75 0d                	jne    392 <strcmp+0x21>
+    p++, q++;
+ 385:	83 c1 01             	add    $0x1,%ecx
+ 388:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 38b:	0f b6 01             	movzbl (%ecx),%eax
+ 38e:	84 c0                	test   %al,%al
+ 390:	75 ef                	jne    381 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 392:	0f b6 c0             	movzbl %al,%eax
+ 395:	0f b6 12             	movzbl (%edx),%edx
+ 398:	29 d0                	sub    %edx,%eax
+}
+ 39a:	5d                   	pop    %ebp
+ 39b:	c3                   	ret
+
+0000039c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 39c:	55                   	push   %ebp
+ 39d:	89 e5                	mov    %esp,%ebp
+ 39f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3a2:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3a5:	74 14                	je     3bb <strlen+0x1f>
+ 3a7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3ac:	83 c0 01             	add    $0x1,%eax
+ 3af:	89 c1                	mov    %eax,%ecx
+ 3b1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3b5:	75 f5                	jne    3ac <strlen+0x10>
+    ;
+  return n;
+}
+ 3b7:	89 c8                	mov    %ecx,%eax
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 3bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 3c0:	eb f5                	jmp    3b7 <strlen+0x1b>
+
+000003c2 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3c2:	55                   	push   %ebp
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	57                   	push   %edi
+ 3c6:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3c9:	89 d7                	mov    %edx,%edi
+ 3cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d1:	fc                   	cld
+ 3d2:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3d4:	89 d0                	mov    %edx,%eax
+ 3d6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3d9:	c9                   	leave
+ 3da:	c3                   	ret
+
+000003db <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3db:	55                   	push   %ebp
+ 3dc:	89 e5                	mov    %esp,%ebp
+ 3de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3e5:	0f b6 10             	movzbl (%eax),%edx
+ 3e8:	84 d2                	test   %dl,%dl
+ 3ea:	74 15                	je     401 <strchr+0x26>
+    if(*s == c)
+ 3ec:	38 d1                	cmp    %dl,%cl
+ 3ee:	74 0f                	je     3ff <strchr+0x24>
+  for(; *s; s++)
+ 3f0:	83 c0 01             	add    $0x1,%eax
+ 3f3:	0f b6 10             	movzbl (%eax),%edx
+ 3f6:	84 d2                	test   %dl,%dl
+ 3f8:	75 f2                	jne    3ec <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 3fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3ff:	5d                   	pop    %ebp
+ 400:	c3                   	ret
+  return 0;
+ 401:	b8 00 00 00 00       	mov    $0x0,%eax
+ 406:	eb f7                	jmp    3ff <strchr+0x24>
+
+00000408 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 408:	55                   	push   %ebp
+ 409:	89 e5                	mov    %esp,%ebp
+ 40b:	57                   	push   %edi
+ 40c:	56                   	push   %esi
+ 40d:	53                   	push   %ebx
+ 40e:	83 ec 2c             	sub    $0x2c,%esp
+ 411:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 414:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 419:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 41c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 41f:	83 c3 01             	add    $0x1,%ebx
+ 422:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 425:	7d 27                	jge    44e <gets+0x46>
+    cc = read(0, &c, 1);
+ 427:	83 ec 04             	sub    $0x4,%esp
+ 42a:	6a 01                	push   $0x1
+ 42c:	57                   	push   %edi
+ 42d:	6a 00                	push   $0x0
+ 42f:	e8 94 01 00 00       	call   5c8 <read>
+    if(cc < 1)
+ 434:	83 c4 10             	add    $0x10,%esp
+ 437:	85 c0                	test   %eax,%eax
+ 439:	7e 13                	jle    44e <gets+0x46>
+      break;
+    buf[i++] = c;
+ 43b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 43f:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 443:	3c 0a                	cmp    $0xa,%al
+ 445:	74 04                	je     44b <gets+0x43>
+ 447:	3c 0d                	cmp    $0xd,%al
+ 449:	75 d1                	jne    41c <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 44b:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 44e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 451:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 455:	89 f0                	mov    %esi,%eax
+ 457:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45a:	5b                   	pop    %ebx
+ 45b:	5e                   	pop    %esi
+ 45c:	5f                   	pop    %edi
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+
+0000045f <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 45f:	55                   	push   %ebp
+ 460:	89 e5                	mov    %esp,%ebp
+ 462:	56                   	push   %esi
+ 463:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 464:	83 ec 08             	sub    $0x8,%esp
+ 467:	6a 00                	push   $0x0
+ 469:	ff 75 08             	push   0x8(%ebp)
+ 46c:	e8 7f 01 00 00       	call   5f0 <open>
+  if(fd < 0)
+ 471:	83 c4 10             	add    $0x10,%esp
+ 474:	85 c0                	test   %eax,%eax
+ 476:	78 24                	js     49c <stat+0x3d>
+ 478:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 47a:	83 ec 08             	sub    $0x8,%esp
+ 47d:	ff 75 0c             	push   0xc(%ebp)
+ 480:	50                   	push   %eax
+ 481:	e8 82 01 00 00       	call   608 <fstat>
+ 486:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 488:	89 1c 24             	mov    %ebx,(%esp)
+ 48b:	e8 48 01 00 00       	call   5d8 <close>
+  return r;
+ 490:	83 c4 10             	add    $0x10,%esp
+}
+ 493:	89 f0                	mov    %esi,%eax
+ 495:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 498:	5b                   	pop    %ebx
+ 499:	5e                   	pop    %esi
+ 49a:	5d                   	pop    %ebp
+ 49b:	c3                   	ret
+    return -1;
+ 49c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a1:	eb f0                	jmp    493 <stat+0x34>
+
+000004a3 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 4a3:	55                   	push   %ebp
+ 4a4:	89 e5                	mov    %esp,%ebp
+ 4a6:	56                   	push   %esi
+ 4a7:	53                   	push   %ebx
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4ab:	0f b6 0a             	movzbl (%edx),%ecx
+ 4ae:	80 f9 20             	cmp    $0x20,%cl
+ 4b1:	75 0b                	jne    4be <atoi+0x1b>
+ 4b3:	83 c2 01             	add    $0x1,%edx
+ 4b6:	0f b6 0a             	movzbl (%edx),%ecx
+ 4b9:	80 f9 20             	cmp    $0x20,%cl
+ 4bc:	74 f5                	je     4b3 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4be:	80 f9 2d             	cmp    $0x2d,%cl
+ 4c1:	74 3c                	je     4ff <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 4c3:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 4c6:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4cb:	f6 c1 fd             	test   $0xfd,%cl
+ 4ce:	74 34                	je     504 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 4d0:	0f b6 0a             	movzbl (%edx),%ecx
+ 4d3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4d6:	3c 09                	cmp    $0x9,%al
+ 4d8:	77 2f                	ja     509 <atoi+0x66>
+ 4da:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 4df:	83 c2 01             	add    $0x1,%edx
+ 4e2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 4e5:	0f be c9             	movsbl %cl,%ecx
+ 4e8:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 4ec:	0f b6 0a             	movzbl (%edx),%ecx
+ 4ef:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4f2:	3c 09                	cmp    $0x9,%al
+ 4f4:	76 e9                	jbe    4df <atoi+0x3c>
+  return sign*n;
+ 4f6:	89 f0                	mov    %esi,%eax
+ 4f8:	0f af c3             	imul   %ebx,%eax
+}
+ 4fb:	5b                   	pop    %ebx
+ 4fc:	5e                   	pop    %esi
+ 4fd:	5d                   	pop    %ebp
+ 4fe:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 4ff:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 504:	83 c2 01             	add    $0x1,%edx
+ 507:	eb c7                	jmp    4d0 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 509:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 50e:	eb e6                	jmp    4f6 <atoi+0x53>
+
+00000510 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	56                   	push   %esi
+ 514:	53                   	push   %ebx
+ 515:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 518:	0f b6 0a             	movzbl (%edx),%ecx
+ 51b:	80 f9 20             	cmp    $0x20,%cl
+ 51e:	75 0b                	jne    52b <atoo+0x1b>
+ 520:	83 c2 01             	add    $0x1,%edx
+ 523:	0f b6 0a             	movzbl (%edx),%ecx
+ 526:	80 f9 20             	cmp    $0x20,%cl
+ 529:	74 f5                	je     520 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 52b:	80 f9 2d             	cmp    $0x2d,%cl
+ 52e:	74 3a                	je     56a <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 530:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 533:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 538:	f6 c1 fd             	test   $0xfd,%cl
+ 53b:	74 32                	je     56f <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 53d:	0f b6 0a             	movzbl (%edx),%ecx
+ 540:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 543:	80 fb 07             	cmp    $0x7,%bl
+ 546:	77 2c                	ja     574 <atoo+0x64>
+ 548:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 54d:	83 c2 01             	add    $0x1,%edx
+ 550:	0f be c9             	movsbl %cl,%ecx
+ 553:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 557:	0f b6 0a             	movzbl (%edx),%ecx
+ 55a:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 55d:	3c 07                	cmp    $0x7,%al
+ 55f:	76 ec                	jbe    54d <atoo+0x3d>
+  return sign*n;
+ 561:	89 f0                	mov    %esi,%eax
+ 563:	0f af c3             	imul   %ebx,%eax
+}
+ 566:	5b                   	pop    %ebx
+ 567:	5e                   	pop    %esi
+ 568:	5d                   	pop    %ebp
+ 569:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 56a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 56f:	83 c2 01             	add    $0x1,%edx
+ 572:	eb c9                	jmp    53d <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 574:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 579:	eb e6                	jmp    561 <atoo+0x51>
+
+0000057b <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 57b:	55                   	push   %ebp
+ 57c:	89 e5                	mov    %esp,%ebp
+ 57e:	56                   	push   %esi
+ 57f:	53                   	push   %ebx
+ 580:	8b 75 08             	mov    0x8(%ebp),%esi
+ 583:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 586:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 589:	85 db                	test   %ebx,%ebx
+ 58b:	7e 15                	jle    5a2 <memmove+0x27>
+ 58d:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 58f:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 591:	83 c2 01             	add    $0x1,%edx
+ 594:	83 c0 01             	add    $0x1,%eax
+ 597:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 59b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 59e:	39 c3                	cmp    %eax,%ebx
+ 5a0:	75 ef                	jne    591 <memmove+0x16>
+  return vdst;
+}
+ 5a2:	89 f0                	mov    %esi,%eax
+ 5a4:	5b                   	pop    %ebx
+ 5a5:	5e                   	pop    %esi
+ 5a6:	5d                   	pop    %ebp
+ 5a7:	c3                   	ret
+
+000005a8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5a8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <exit>:
+SYSCALL(exit)
+ 5b0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <wait>:
+SYSCALL(wait)
+ 5b8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <pipe>:
+SYSCALL(pipe)
+ 5c0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <read>:
+SYSCALL(read)
+ 5c8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <write>:
+SYSCALL(write)
+ 5d0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <close>:
+SYSCALL(close)
+ 5d8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <kill>:
+SYSCALL(kill)
+ 5e0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <exec>:
+SYSCALL(exec)
+ 5e8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <open>:
+SYSCALL(open)
+ 5f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <mknod>:
+SYSCALL(mknod)
+ 5f8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <unlink>:
+SYSCALL(unlink)
+ 600:	b8 12 00 00 00       	mov    $0x12,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <fstat>:
+SYSCALL(fstat)
+ 608:	b8 08 00 00 00       	mov    $0x8,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <link>:
+SYSCALL(link)
+ 610:	b8 13 00 00 00       	mov    $0x13,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <mkdir>:
+SYSCALL(mkdir)
+ 618:	b8 14 00 00 00       	mov    $0x14,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <chdir>:
+SYSCALL(chdir)
+ 620:	b8 09 00 00 00       	mov    $0x9,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <dup>:
+SYSCALL(dup)
+ 628:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <getpid>:
+SYSCALL(getpid)
+ 630:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <sbrk>:
+SYSCALL(sbrk)
+ 638:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <sleep>:
+SYSCALL(sleep)
+ 640:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <uptime>:
+SYSCALL(uptime)
+ 648:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <halt>:
+SYSCALL(halt)
+ 650:	b8 16 00 00 00       	mov    $0x16,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <date>:
+SYSCALL(date)
+ 658:	b8 17 00 00 00       	mov    $0x17,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <getuid>:
+SYSCALL(getuid)
+ 660:	b8 18 00 00 00       	mov    $0x18,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <getgid>:
+SYSCALL(getgid)
+ 668:	b8 19 00 00 00       	mov    $0x19,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <getppid>:
+SYSCALL(getppid)
+ 670:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <setuid>:
+SYSCALL(setuid)
+ 678:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <setgid>:
+SYSCALL(setgid)
+ 680:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <getprocs>:
+SYSCALL(getprocs)
+ 688:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <setpriority>:
+SYSCALL(setpriority)
+ 690:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <getpriority>:
+SYSCALL(getpriority)
+ 698:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <waitpid>:
+SYSCALL(waitpid)
+ 6a0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <setaffinity>:
+SYSCALL(setaffinity)
+ 6a8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <getaffinity>:
+SYSCALL(getaffinity)
+ 6b0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <setdeadline>:
+SYSCALL(setdeadline)
+ 6b8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <schedctl>:
+SYSCALL(schedctl)
+ 6c0:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <spawn>:
+SYSCALL(spawn)
+ 6c8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <vmstats>:
+SYSCALL(vmstats)
+ 6d0:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 6d8:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <setshares>:
+SYSCALL(setshares)
+ 6e0:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <getshares>:
+SYSCALL(getshares)
+ 6e8:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	83 ec 3c             	sub    $0x3c,%esp
+ 6f9:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6fc:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 6fe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 702:	74 79                	je     77d <printint+0x8d>
+ 704:	85 d2                	test   %edx,%edx
+ 706:	79 75                	jns    77d <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 708:	89 d1                	mov    %edx,%ecx
+ 70a:	f7 d9                	neg    %ecx
+    neg = 1;
+ 70c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 713:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 718:	89 df                	mov    %ebx,%edi
+ 71a:	83 c3 01             	add    $0x1,%ebx
+ 71d:	89 c8                	mov    %ecx,%eax
+ 71f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 724:	f7 f6                	div    %esi
+ 726:	0f b6 92 e0 0e 00 00 	movzbl 0xee0(%edx),%edx
+ 72d:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 731:	89 ca                	mov    %ecx,%edx
+ 733:	89 c1                	mov    %eax,%ecx
+ 735:	39 f2                	cmp    %esi,%edx
+ 737:	73 df                	jae    718 <printint+0x28>
+  if(neg)
+ 739:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 73d:	74 08                	je     747 <printint+0x57>
+    buf[i++] = '-';
+ 73f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 744:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 747:	85 db                	test   %ebx,%ebx
+ 749:	7e 2a                	jle    775 <printint+0x85>
+ 74b:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 74e:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 752:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 755:	0f b6 03             	movzbl (%ebx),%eax
+ 758:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	6a 01                	push   $0x1
+ 760:	57                   	push   %edi
+ 761:	ff 75 c4             	push   -0x3c(%ebp)
+ 764:	e8 67 fe ff ff       	call   5d0 <write>
+  while(--i >= 0)
+ 769:	89 d8                	mov    %ebx,%eax
+ 76b:	83 eb 01             	sub    $0x1,%ebx
+ 76e:	83 c4 10             	add    $0x10,%esp
+ 771:	39 f0                	cmp    %esi,%eax
+ 773:	75 e0                	jne    755 <printint+0x65>
+}
+ 775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 778:	5b                   	pop    %ebx
+ 779:	5e                   	pop    %esi
+ 77a:	5f                   	pop    %edi
+ 77b:	5d                   	pop    %ebp
+ 77c:	c3                   	ret
+    x = xx;
+ 77d:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 77f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 786:	eb 8b                	jmp    713 <printint+0x23>
+
+00000788 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 788:	55                   	push   %ebp
+ 789:	89 e5                	mov    %esp,%ebp
+ 78b:	57                   	push   %edi
+ 78c:	56                   	push   %esi
+ 78d:	53                   	push   %ebx
+ 78e:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 791:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 794:	0f b6 1e             	movzbl (%esi),%ebx
+ 797:	84 db                	test   %bl,%bl
+ 799:	0f 84 9e 01 00 00    	je     93d <printf+0x1b5>
+ 79f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 7a2:	8d 45 10             	lea    0x10(%ebp),%eax
+ 7a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 7a8:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7ad:	eb 2d                	jmp    7dc <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 7af:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7b2:	83 ec 04             	sub    $0x4,%esp
+ 7b5:	6a 01                	push   $0x1
+ 7b7:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ba:	50                   	push   %eax
+ 7bb:	ff 75 08             	push   0x8(%ebp)
+ 7be:	e8 0d fe ff ff       	call   5d0 <write>
+        putc(fd, c);
+ 7c3:	83 c4 10             	add    $0x10,%esp
+ 7c6:	eb 05                	jmp    7cd <printf+0x45>
+      }
+    } else if(state == '%'){
+ 7c8:	83 ff 25             	cmp    $0x25,%edi
+ 7cb:	74 1f                	je     7ec <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 7cd:	83 c6 01             	add    $0x1,%esi
+ 7d0:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 7d4:	84 db                	test   %bl,%bl
+ 7d6:	0f 84 61 01 00 00    	je     93d <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 7dc:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7df:	85 ff                	test   %edi,%edi
+ 7e1:	75 e5                	jne    7c8 <printf+0x40>
+      if(c == '%'){
+ 7e3:	83 f8 25             	cmp    $0x25,%eax
+ 7e6:	75 c7                	jne    7af <printf+0x27>
+        state = '%';
+ 7e8:	89 c7                	mov    %eax,%edi
+ 7ea:	eb e1                	jmp    7cd <printf+0x45>
+      if(c == 'd'){
+ 7ec:	83 f8 25             	cmp    $0x25,%eax
+ 7ef:	0f 84 f4 00 00 00    	je     8e9 <printf+0x161>
+ 7f5:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 7f8:	83 fa 15             	cmp    $0x15,%edx
+ 7fb:	0f 87 09 01 00 00    	ja     90a <printf+0x182>
+ 801:	0f 87 03 01 00 00    	ja     90a <printf+0x182>
+ 807:	ff 24 95 88 0e 00 00 	jmp    *0xe88(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 80e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 811:	8b 17                	mov    (%edi),%edx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	6a 01                	push   $0x1
+ 818:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 81d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 820:	e8 cb fe ff ff       	call   6f0 <printint>
+        ap++;
+ 825:	83 c7 04             	add    $0x4,%edi
+ 828:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 82b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 82e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 833:	eb 98                	jmp    7cd <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 835:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 838:	8b 17                	mov    (%edi),%edx
+ 83a:	83 ec 0c             	sub    $0xc,%esp
+ 83d:	6a 00                	push   $0x0
+ 83f:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 844:	8b 45 08             	mov    0x8(%ebp),%eax
+ 847:	e8 a4 fe ff ff       	call   6f0 <printint>
+        ap++;
+ 84c:	83 c7 04             	add    $0x4,%edi
+ 84f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 852:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 855:	bf 00 00 00 00       	mov    $0x0,%edi
+ 85a:	e9 6e ff ff ff       	jmp    7cd <printf+0x45>
+        s = (char*)*ap;
+ 85f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 862:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 864:	83 c1 04             	add    $0x4,%ecx
+ 867:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 86a:	85 c0                	test   %eax,%eax
+ 86c:	74 13                	je     881 <printf+0xf9>
+        s = (char*)*ap;
+ 86e:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 870:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 873:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	75 0f                	jne    88b <printf+0x103>
+ 87c:	e9 4c ff ff ff       	jmp    7cd <printf+0x45>
+          s = "(null)";
+ 881:	bb 7f 0e 00 00       	mov    $0xe7f,%ebx
+        while(*s != 0){
+ 886:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 88b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 88e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 891:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 894:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 897:	83 ec 04             	sub    $0x4,%esp
+ 89a:	6a 01                	push   $0x1
+ 89c:	57                   	push   %edi
+ 89d:	56                   	push   %esi
+ 89e:	e8 2d fd ff ff       	call   5d0 <write>
+          s++;
+ 8a3:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 8a6:	0f b6 03             	movzbl (%ebx),%eax
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	84 c0                	test   %al,%al
+ 8ae:	75 e4                	jne    894 <printf+0x10c>
+      state = 0;
+ 8b0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 8b3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8b8:	e9 10 ff ff ff       	jmp    7cd <printf+0x45>
+        putc(fd, *ap);
+ 8bd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 8c0:	8b 07                	mov    (%edi),%eax
+ 8c2:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c5:	83 ec 04             	sub    $0x4,%esp
+ 8c8:	6a 01                	push   $0x1
+ 8ca:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8cd:	50                   	push   %eax
+ 8ce:	ff 75 08             	push   0x8(%ebp)
+ 8d1:	e8 fa fc ff ff       	call   5d0 <write>
+        ap++;
+ 8d6:	83 c7 04             	add    $0x4,%edi
+ 8d9:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8df:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8e4:	e9 e4 fe ff ff       	jmp    7cd <printf+0x45>
+        putc(fd, c);
+ 8e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8ec:	83 ec 04             	sub    $0x4,%esp
+ 8ef:	6a 01                	push   $0x1
+ 8f1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8f4:	50                   	push   %eax
+ 8f5:	ff 75 08             	push   0x8(%ebp)
+ 8f8:	e8 d3 fc ff ff       	call   5d0 <write>
+ 8fd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 900:	bf 00 00 00 00       	mov    $0x0,%edi
+ 905:	e9 c3 fe ff ff       	jmp    7cd <printf+0x45>
+        putc(fd, '%');
+ 90a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 90e:	83 ec 04             	sub    $0x4,%esp
+ 911:	6a 01                	push   $0x1
+ 913:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 916:	57                   	push   %edi
+ 917:	ff 75 08             	push   0x8(%ebp)
+ 91a:	e8 b1 fc ff ff       	call   5d0 <write>
+        putc(fd, c);
+ 91f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 922:	83 c4 0c             	add    $0xc,%esp
+ 925:	6a 01                	push   $0x1
+ 927:	57                   	push   %edi
+ 928:	ff 75 08             	push   0x8(%ebp)
+ 92b:	e8 a0 fc ff ff       	call   5d0 <write>
+        putc(fd, c);
+ 930:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 933:	bf 00 00 00 00       	mov    $0x0,%edi
+ 938:	e9 90 fe ff ff       	jmp    7cd <printf+0x45>
+    }
+  }
+}
+ 93d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 940:	5b                   	pop    %ebx
+ 941:	5e                   	pop    %esi
+ 942:	5f                   	pop    %edi
+ 943:	5d                   	pop    %ebp
+ 944:	c3                   	ret
+
+00000945 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 945:	55                   	push   %ebp
+ 946:	89 e5                	mov    %esp,%ebp
+ 948:	57                   	push   %edi
+ 949:	56                   	push   %esi
+ 94a:	53                   	push   %ebx
+ 94b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 94e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 951:	a1 cc 11 00 00       	mov    0x11cc,%eax
+ 956:	eb 0c                	jmp    964 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 958:	8b 10                	mov    (%eax),%edx
+ 95a:	39 d0                	cmp    %edx,%eax
+ 95c:	72 04                	jb     962 <free+0x1d>
+ 95e:	39 d1                	cmp    %edx,%ecx
+ 960:	72 10                	jb     972 <free+0x2d>
+{
+ 962:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 964:	39 c8                	cmp    %ecx,%eax
+ 966:	73 f0                	jae    958 <free+0x13>
+ 968:	8b 10                	mov    (%eax),%edx
+ 96a:	39 d1                	cmp    %edx,%ecx
+ 96c:	72 04                	jb     972 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 96e:	39 d0                	cmp    %edx,%eax
+ 970:	72 f0                	jb     962 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 972:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 975:	8b 10                	mov    (%eax),%edx
+ 977:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 97a:	39 fa                	cmp    %edi,%edx
+ 97c:	74 19                	je     997 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 97e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 981:	8b 50 04             	mov    0x4(%eax),%edx
+ 984:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 987:	39 f1                	cmp    %esi,%ecx
+ 989:	74 18                	je     9a3 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 98b:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 98d:	a3 cc 11 00 00       	mov    %eax,0x11cc
+}
+ 992:	5b                   	pop    %ebx
+ 993:	5e                   	pop    %esi
+ 994:	5f                   	pop    %edi
+ 995:	5d                   	pop    %ebp
+ 996:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 997:	03 72 04             	add    0x4(%edx),%esi
+ 99a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 99d:	8b 10                	mov    (%eax),%edx
+ 99f:	8b 12                	mov    (%edx),%edx
+ 9a1:	eb db                	jmp    97e <free+0x39>
+    p->s.size += bp->s.size;
+ 9a3:	03 53 fc             	add    -0x4(%ebx),%edx
+ 9a6:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9a9:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9ac:	eb dd                	jmp    98b <free+0x46>
+
+000009ae <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9ae:	55                   	push   %ebp
+ 9af:	89 e5                	mov    %esp,%ebp
+ 9b1:	57                   	push   %edi
+ 9b2:	56                   	push   %esi
+ 9b3:	53                   	push   %ebx
+ 9b4:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ba:	8d 58 07             	lea    0x7(%eax),%ebx
+ 9bd:	c1 eb 03             	shr    $0x3,%ebx
+ 9c0:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 9c3:	8b 15 cc 11 00 00    	mov    0x11cc,%edx
+ 9c9:	85 d2                	test   %edx,%edx
+ 9cb:	74 1c                	je     9e9 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9cd:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9cf:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d2:	39 d9                	cmp    %ebx,%ecx
+ 9d4:	73 38                	jae    a0e <malloc+0x60>
+  if(nu < 4096)
+ 9d6:	be 00 10 00 00       	mov    $0x1000,%esi
+ 9db:	39 f3                	cmp    %esi,%ebx
+ 9dd:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 9e0:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 9e7:	eb 72                	jmp    a5b <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 9e9:	c7 05 cc 11 00 00 d0 	movl   $0x11d0,0x11cc
+ 9f0:	11 00 00 
+ 9f3:	c7 05 d0 11 00 00 d0 	movl   $0x11d0,0x11d0
+ 9fa:	11 00 00 
+    base.s.size = 0;
+ 9fd:	c7 05 d4 11 00 00 00 	movl   $0x0,0x11d4
+ a04:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a07:	b8 d0 11 00 00       	mov    $0x11d0,%eax
+    if(p->s.size >= nunits){
+ a0c:	eb c8                	jmp    9d6 <malloc+0x28>
+      if(p->s.size == nunits)
+ a0e:	39 cb                	cmp    %ecx,%ebx
+ a10:	74 1e                	je     a30 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ a12:	29 d9                	sub    %ebx,%ecx
+ a14:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a17:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a1a:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ a1d:	89 15 cc 11 00 00    	mov    %edx,0x11cc
+      return (void*)(p + 1);
+ a23:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ a26:	89 d0                	mov    %edx,%eax
+ a28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a2b:	5b                   	pop    %ebx
+ a2c:	5e                   	pop    %esi
+ a2d:	5f                   	pop    %edi
+ a2e:	5d                   	pop    %ebp
+ a2f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ a30:	8b 08                	mov    (%eax),%ecx
+ a32:	89 0a                	mov    %ecx,(%edx)
+ a34:	eb e7                	jmp    a1d <malloc+0x6f>
+  hp->s.size = nu;
+ a36:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ a39:	83 ec 0c             	sub    $0xc,%esp
+ a3c:	83 c0 08             	add    $0x8,%eax
+ a3f:	50                   	push   %eax
+ a40:	e8 00 ff ff ff       	call   945 <free>
+  return freep;
+ a45:	8b 15 cc 11 00 00    	mov    0x11cc,%edx
+      if((p = morecore(nunits)) == 0)
+ a4b:	83 c4 10             	add    $0x10,%esp
+ a4e:	85 d2                	test   %edx,%edx
+ a50:	74 d4                	je     a26 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a52:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a54:	8b 48 04             	mov    0x4(%eax),%ecx
+ a57:	39 d9                	cmp    %ebx,%ecx
+ a59:	73 b3                	jae    a0e <malloc+0x60>
+    if(p == freep)
+ a5b:	89 c2                	mov    %eax,%edx
+ a5d:	39 05 cc 11 00 00    	cmp    %eax,0x11cc
+ a63:	75 ed                	jne    a52 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ a65:	83 ec 0c             	sub    $0xc,%esp
+ a68:	57                   	push   %edi
+ a69:	e8 ca fb ff ff       	call   638 <sbrk>
+  if(p == (char*)-1)
+ a6e:	83 c4 10             	add    $0x10,%esp
+ a71:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a74:	75 c0                	jne    a36 <malloc+0x88>
+        return 0;
+ a76:	ba 00 00 00 00       	mov    $0x0,%edx
+ a7b:	eb a9                	jmp    a26 <malloc+0x78>
@@ -0,0 +1,2797 @@
+
+_p4-test-u:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cleanupProcs>:
+int budget = DEFAULT_BUDGET;
+int promo = TICKS_TO_PROMOTE;
+
+void
+cleanupProcs(int pid[], int max)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 0c             	sub    $0xc,%esp
+       9:	8b 7d 08             	mov    0x8(%ebp),%edi
+       c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+  for(i = 0; i < max; i++)
+       f:	85 f6                	test   %esi,%esi
+      11:	7e 1a                	jle    2d <cleanupProcs+0x2d>
+      13:	bb 00 00 00 00       	mov    $0x0,%ebx
+    kill(pid[i]);
+      18:	83 ec 0c             	sub    $0xc,%esp
+      1b:	ff 34 9f             	push   (%edi,%ebx,4)
+      1e:	e8 75 10 00 00       	call   1098 <kill>
+  for(i = 0; i < max; i++)
+      23:	83 c3 01             	add    $0x1,%ebx
+      26:	83 c4 10             	add    $0x10,%esp
+      29:	39 de                	cmp    %ebx,%esi
+      2b:	75 eb                	jne    18 <cleanupProcs+0x18>
+  while(wait() > 0);
+      2d:	e8 3e 10 00 00       	call   1070 <wait>
+      32:	85 c0                	test   %eax,%eax
+      34:	7f f7                	jg     2d <cleanupProcs+0x2d>
+}
+      36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      39:	5b                   	pop    %ebx
+      3a:	5e                   	pop    %esi
+      3b:	5f                   	pop    %edi
+      3c:	5d                   	pop    %ebp
+      3d:	c3                   	ret
+
+0000003e <createInfiniteProc>:
+
+int
+createInfiniteProc()
+{
+      3e:	55                   	push   %ebp
+      3f:	89 e5                	mov    %esp,%ebp
+      41:	53                   	push   %ebx
+      42:	83 ec 04             	sub    $0x4,%esp
+  int pid = fork();
+      45:	e8 16 10 00 00       	call   1060 <fork>
+  if(pid == 0)
+      4a:	85 c0                	test   %eax,%eax
+      4c:	75 02                	jne    50 <createInfiniteProc+0x12>
+    while(1);
+      4e:	eb fe                	jmp    4e <createInfiniteProc+0x10>
+      50:	89 c3                	mov    %eax,%ebx
+  printf(1, "Process %d created...\n", pid);
+      52:	83 ec 04             	sub    $0x4,%esp
+      55:	50                   	push   %eax
+      56:	68 38 15 00 00       	push   $0x1538
+      5b:	6a 01                	push   $0x1
+      5d:	e8 de 11 00 00       	call   1240 <printf>
+
+  return pid;
+}
+      62:	89 d8                	mov    %ebx,%eax
+      64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      67:	c9                   	leave
+      68:	c3                   	ret
+
+00000069 <createSetPrioProc>:
+
+int
+createSetPrioProc(int prio)
+{
+      69:	55                   	push   %ebp
+      6a:	89 e5                	mov    %esp,%ebp
+      6c:	53                   	push   %ebx
+      6d:	83 ec 04             	sub    $0x4,%esp
+      70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int pid = fork();
+      73:	e8 e8 0f 00 00       	call   1060 <fork>
+  if(pid == 0)
+      78:	85 c0                	test   %eax,%eax
+      7a:	75 14                	jne    90 <createSetPrioProc+0x27>
+    while(1)
+      setpriority(getpid(), prio);
+      7c:	e8 67 10 00 00       	call   10e8 <getpid>
+      81:	83 ec 08             	sub    $0x8,%esp
+      84:	53                   	push   %ebx
+      85:	50                   	push   %eax
+      86:	e8 bd 10 00 00       	call   1148 <setpriority>
+      8b:	83 c4 10             	add    $0x10,%esp
+      8e:	eb ec                	jmp    7c <createSetPrioProc+0x13>
+
+  return pid;
+}
+      90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      93:	c9                   	leave
+      94:	c3                   	ret
+
+00000095 <sleepMessage>:
+  }
+}
+
+void
+sleepMessage(int time, char message[])
+{
+      95:	55                   	push   %ebp
+      96:	89 e5                	mov    %esp,%ebp
+      98:	83 ec 10             	sub    $0x10,%esp
+  printf(1, message);
+      9b:	ff 75 0c             	push   0xc(%ebp)
+      9e:	6a 01                	push   $0x1
+      a0:	e8 9b 11 00 00       	call   1240 <printf>
+  sleep(time);
+      a5:	83 c4 04             	add    $0x4,%esp
+      a8:	ff 75 08             	push   0x8(%ebp)
+      ab:	e8 48 10 00 00       	call   10f8 <sleep>
+}
+      b0:	83 c4 10             	add    $0x10,%esp
+      b3:	c9                   	leave
+      b4:	c3                   	ret
+
+000000b5 <test1>:
+
+void
+test1()
+{
+      b5:	55                   	push   %ebp
+      b6:	89 e5                	mov    %esp,%ebp
+      b8:	56                   	push   %esi
+      b9:	53                   	push   %ebx
+      ba:	83 ec 28             	sub    $0x28,%esp
+  int i;
+  int max = 8;
+  int pid[max];
+
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+      bd:	68 4f 15 00 00       	push   $0x154f
+      c2:	6a 01                	push   $0x1
+      c4:	e8 77 11 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 1 |\n");
+      c9:	83 c4 08             	add    $0x8,%esp
+      cc:	68 62 15 00 00       	push   $0x1562
+      d1:	6a 01                	push   $0x1
+      d3:	e8 68 11 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+      d8:	83 c4 08             	add    $0x8,%esp
+      db:	68 4f 15 00 00       	push   $0x154f
+      e0:	6a 01                	push   $0x1
+      e2:	e8 59 11 00 00       	call   1240 <printf>
+
+  for(i = 0; i < max; i++){
+      e7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      ea:	8d 75 f8             	lea    -0x8(%ebp),%esi
+      ed:	83 c4 10             	add    $0x10,%esp
+    pid[i] = createInfiniteProc();
+      f0:	e8 49 ff ff ff       	call   3e <createInfiniteProc>
+      f5:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < max; i++){
+      f7:	83 c3 04             	add    $0x4,%ebx
+      fa:	39 f3                	cmp    %esi,%ebx
+      fc:	75 f2                	jne    f0 <test1+0x3b>
+//  for(i = 0; i < max; i++){
+//    setpriority(pid[i], 0) ;
+//  }
+
+  for(i = 0; i < 3; i++)
+    sleepMessage(2000, "Sleeping... ctrl-p\n");
+      fe:	83 ec 08             	sub    $0x8,%esp
+     101:	68 75 15 00 00       	push   $0x1575
+     106:	68 d0 07 00 00       	push   $0x7d0
+     10b:	e8 85 ff ff ff       	call   95 <sleepMessage>
+     110:	83 c4 08             	add    $0x8,%esp
+     113:	68 75 15 00 00       	push   $0x1575
+     118:	68 d0 07 00 00       	push   $0x7d0
+     11d:	e8 73 ff ff ff       	call   95 <sleepMessage>
+     122:	83 c4 08             	add    $0x8,%esp
+     125:	68 75 15 00 00       	push   $0x1575
+     12a:	68 d0 07 00 00       	push   $0x7d0
+     12f:	e8 61 ff ff ff       	call   95 <sleepMessage>
+
+  cleanupProcs(pid, max);
+     134:	83 c4 08             	add    $0x8,%esp
+     137:	6a 08                	push   $0x8
+     139:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     13c:	50                   	push   %eax
+     13d:	e8 be fe ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+\n");
+     142:	83 c4 08             	add    $0x8,%esp
+     145:	68 51 15 00 00       	push   $0x1551
+     14a:	6a 01                	push   $0x1
+     14c:	e8 ef 10 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 1 |\n");
+     151:	83 c4 08             	add    $0x8,%esp
+     154:	68 89 15 00 00       	push   $0x1589
+     159:	6a 01                	push   $0x1
+     15b:	e8 e0 10 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+\n");
+     160:	83 c4 08             	add    $0x8,%esp
+     163:	68 51 15 00 00       	push   $0x1551
+     168:	6a 01                	push   $0x1
+     16a:	e8 d1 10 00 00       	call   1240 <printf>
+}
+     16f:	83 c4 10             	add    $0x10,%esp
+     172:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     175:	5b                   	pop    %ebx
+     176:	5e                   	pop    %esi
+     177:	5d                   	pop    %ebp
+     178:	c3                   	ret
+
+00000179 <test2>:
+
+void
+test2()
+{
+     179:	55                   	push   %ebp
+     17a:	89 e5                	mov    %esp,%ebp
+     17c:	56                   	push   %esi
+     17d:	53                   	push   %ebx
+     17e:	83 ec 10             	sub    $0x10,%esp
+  int i;
+  int pid[2];
+  pid[0]  = createInfiniteProc();
+     181:	e8 b8 fe ff ff       	call   3e <createInfiniteProc>
+     186:	89 c6                	mov    %eax,%esi
+     188:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     18b:	83 ec 08             	sub    $0x8,%esp
+     18e:	68 5c 17 00 00       	push   $0x175c
+     193:	6a 01                	push   $0x1
+     195:	e8 a6 10 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 2a |\n");
+     19a:	83 c4 08             	add    $0x8,%esp
+     19d:	68 9a 15 00 00       	push   $0x159a
+     1a2:	6a 01                	push   $0x1
+     1a4:	e8 97 10 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     1a9:	83 c4 08             	add    $0x8,%esp
+     1ac:	68 5c 17 00 00       	push   $0x175c
+     1b1:	6a 01                	push   $0x1
+     1b3:	e8 88 10 00 00       	call   1240 <printf>
+
+  setpriority(getpid(), plevels);
+     1b8:	e8 2b 0f 00 00       	call   10e8 <getpid>
+     1bd:	83 c4 08             	add    $0x8,%esp
+     1c0:	6a 06                	push   $0x6
+     1c2:	50                   	push   %eax
+     1c3:	e8 80 0f 00 00       	call   1148 <setpriority>
+     1c8:	83 c4 10             	add    $0x10,%esp
+     1cb:	bb 07 00 00 00       	mov    $0x7,%ebx
+
+  i = 0;
+  while(i <= plevels) {
+    sleepMessage(2000, "Sleeping... ctrl-p\n");
+     1d0:	83 ec 08             	sub    $0x8,%esp
+     1d3:	68 75 15 00 00       	push   $0x1575
+     1d8:	68 d0 07 00 00       	push   $0x7d0
+     1dd:	e8 b3 fe ff ff       	call   95 <sleepMessage>
+  while(i <= plevels) {
+     1e2:	83 c4 10             	add    $0x10,%esp
+     1e5:	83 eb 01             	sub    $0x1,%ebx
+     1e8:	75 e6                	jne    1d0 <test2+0x57>
+    i++;
+  }
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     1ea:	83 ec 08             	sub    $0x8,%esp
+     1ed:	68 2e 18 00 00       	push   $0x182e
+     1f2:	6a 01                	push   $0x1
+     1f4:	e8 47 10 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 2a |\n");
+     1f9:	83 c4 08             	add    $0x8,%esp
+     1fc:	68 ae 15 00 00       	push   $0x15ae
+     201:	6a 01                	push   $0x1
+     203:	e8 38 10 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     208:	83 c4 08             	add    $0x8,%esp
+     20b:	68 2e 18 00 00       	push   $0x182e
+     210:	6a 01                	push   $0x1
+     212:	e8 29 10 00 00       	call   1240 <printf>
+  printf(1, "\n");
+     217:	83 c4 08             	add    $0x8,%esp
+     21a:	68 ce 17 00 00       	push   $0x17ce
+     21f:	6a 01                	push   $0x1
+     221:	e8 1a 10 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     226:	83 c4 08             	add    $0x8,%esp
+     229:	68 5c 17 00 00       	push   $0x175c
+     22e:	6a 01                	push   $0x1
+     230:	e8 0b 10 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 2b |\n");
+     235:	83 c4 08             	add    $0x8,%esp
+     238:	68 c0 15 00 00       	push   $0x15c0
+     23d:	6a 01                	push   $0x1
+     23f:	e8 fc 0f 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     244:	83 c4 08             	add    $0x8,%esp
+     247:	68 5c 17 00 00       	push   $0x175c
+     24c:	6a 01                	push   $0x1
+     24e:	e8 ed 0f 00 00       	call   1240 <printf>
+
+  pid[1] = createSetPrioProc(0);
+     253:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     25a:	e8 0a fe ff ff       	call   69 <createSetPrioProc>
+     25f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  setpriority(pid[0], plevels);
+     262:	83 c4 08             	add    $0x8,%esp
+     265:	6a 06                	push   $0x6
+     267:	56                   	push   %esi
+     268:	e8 db 0e 00 00       	call   1148 <setpriority>
+     26d:	83 c4 10             	add    $0x10,%esp
+     270:	bb 07 00 00 00       	mov    $0x7,%ebx
+
+  i = 0;
+  while(i <= plevels) {
+    sleepMessage(2000, "Sleeping... ctrl-p\n");
+     275:	83 ec 08             	sub    $0x8,%esp
+     278:	68 75 15 00 00       	push   $0x1575
+     27d:	68 d0 07 00 00       	push   $0x7d0
+     282:	e8 0e fe ff ff       	call   95 <sleepMessage>
+  while(i <= plevels) {
+     287:	83 c4 10             	add    $0x10,%esp
+     28a:	83 eb 01             	sub    $0x1,%ebx
+     28d:	75 e6                	jne    275 <test2+0xfc>
+    i++;
+  }
+
+  cleanupProcs(pid, 2);
+     28f:	83 ec 08             	sub    $0x8,%esp
+     292:	6a 02                	push   $0x2
+     294:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     297:	50                   	push   %eax
+     298:	e8 63 fd ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     29d:	83 c4 08             	add    $0x8,%esp
+     2a0:	68 2e 18 00 00       	push   $0x182e
+     2a5:	6a 01                	push   $0x1
+     2a7:	e8 94 0f 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 2b |\n");
+     2ac:	83 c4 08             	add    $0x8,%esp
+     2af:	68 d4 15 00 00       	push   $0x15d4
+     2b4:	6a 01                	push   $0x1
+     2b6:	e8 85 0f 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     2bb:	83 c4 08             	add    $0x8,%esp
+     2be:	68 2e 18 00 00       	push   $0x182e
+     2c3:	6a 01                	push   $0x1
+     2c5:	e8 76 0f 00 00       	call   1240 <printf>
+  printf(1, "\n");
+     2ca:	83 c4 08             	add    $0x8,%esp
+     2cd:	68 ce 17 00 00       	push   $0x17ce
+     2d2:	6a 01                	push   $0x1
+     2d4:	e8 67 0f 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     2d9:	83 c4 08             	add    $0x8,%esp
+     2dc:	68 5c 17 00 00       	push   $0x175c
+     2e1:	6a 01                	push   $0x1
+     2e3:	e8 58 0f 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 2c |\n");
+     2e8:	83 c4 08             	add    $0x8,%esp
+     2eb:	68 e6 15 00 00       	push   $0x15e6
+     2f0:	6a 01                	push   $0x1
+     2f2:	e8 49 0f 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     2f7:	83 c4 08             	add    $0x8,%esp
+     2fa:	68 5c 17 00 00       	push   $0x175c
+     2ff:	6a 01                	push   $0x1
+     301:	e8 3a 0f 00 00       	call   1240 <printf>
+
+  int cPid = getpid();
+     306:	e8 dd 0d 00 00       	call   10e8 <getpid>
+     30b:	89 c3                	mov    %eax,%ebx
+  int rc = 0;
+
+  printf(1, "Setting priority of the current process to %d... ", plevels);
+     30d:	83 c4 0c             	add    $0xc,%esp
+     310:	6a 06                	push   $0x6
+     312:	68 ec 18 00 00       	push   $0x18ec
+     317:	6a 01                	push   $0x1
+     319:	e8 22 0f 00 00       	call   1240 <printf>
+
+  rc = setpriority(cPid, plevels);
+     31e:	83 c4 08             	add    $0x8,%esp
+     321:	6a 06                	push   $0x6
+     323:	53                   	push   %ebx
+     324:	e8 1f 0e 00 00       	call   1148 <setpriority>
+
+  if (rc == -1) {
+     329:	83 c4 10             	add    $0x10,%esp
+     32c:	83 f8 ff             	cmp    $0xffffffff,%eax
+     32f:	74 5a                	je     38b <test2+0x212>
+    printf(2, "setpriority to %s failed!\n\tThis test FAILED.\n", plevels);
+    goto end;
+  }
+
+  rc = getpriority(cPid);
+     331:	83 ec 0c             	sub    $0xc,%esp
+     334:	53                   	push   %ebx
+     335:	e8 16 0e 00 00       	call   1150 <getpriority>
+
+  if (rc != plevels) {
+     33a:	83 c4 10             	add    $0x10,%esp
+     33d:	83 f8 06             	cmp    $0x6,%eax
+     340:	74 5f                	je     3a1 <test2+0x228>
+    printf(2, "getpriority failed! %d != %d\n\tThis test FAILED.\n", plevels, rc);
+     342:	50                   	push   %eax
+     343:	6a 06                	push   $0x6
+     345:	68 50 19 00 00       	push   $0x1950
+     34a:	6a 02                	push   $0x2
+     34c:	e8 ef 0e 00 00       	call   1240 <printf>
+    goto end;
+     351:	83 c4 10             	add    $0x10,%esp
+  }
+
+  printf(1, "This test PASSES.\n");
+
+end:
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     354:	83 ec 08             	sub    $0x8,%esp
+     357:	68 2e 18 00 00       	push   $0x182e
+     35c:	6a 01                	push   $0x1
+     35e:	e8 dd 0e 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 2c |\n");
+     363:	83 c4 08             	add    $0x8,%esp
+     366:	68 0d 16 00 00       	push   $0x160d
+     36b:	6a 01                	push   $0x1
+     36d:	e8 ce 0e 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     372:	83 c4 08             	add    $0x8,%esp
+     375:	68 2e 18 00 00       	push   $0x182e
+     37a:	6a 01                	push   $0x1
+     37c:	e8 bf 0e 00 00       	call   1240 <printf>
+}
+     381:	83 c4 10             	add    $0x10,%esp
+     384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     387:	5b                   	pop    %ebx
+     388:	5e                   	pop    %esi
+     389:	5d                   	pop    %ebp
+     38a:	c3                   	ret
+    printf(2, "setpriority to %s failed!\n\tThis test FAILED.\n", plevels);
+     38b:	83 ec 04             	sub    $0x4,%esp
+     38e:	6a 06                	push   $0x6
+     390:	68 20 19 00 00       	push   $0x1920
+     395:	6a 02                	push   $0x2
+     397:	e8 a4 0e 00 00       	call   1240 <printf>
+    goto end;
+     39c:	83 c4 10             	add    $0x10,%esp
+     39f:	eb b3                	jmp    354 <test2+0x1db>
+  printf(1, "This test PASSES.\n");
+     3a1:	83 ec 08             	sub    $0x8,%esp
+     3a4:	68 fa 15 00 00       	push   $0x15fa
+     3a9:	6a 01                	push   $0x1
+     3ab:	e8 90 0e 00 00       	call   1240 <printf>
+     3b0:	83 c4 10             	add    $0x10,%esp
+     3b3:	eb 9f                	jmp    354 <test2+0x1db>
+
+000003b5 <test3>:
+
+void
+test3()
+{
+     3b5:	55                   	push   %ebp
+     3b6:	89 e5                	mov    %esp,%ebp
+     3b8:	56                   	push   %esi
+     3b9:	53                   	push   %ebx
+     3ba:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     3bd:	68 4f 15 00 00       	push   $0x154f
+     3c2:	6a 01                	push   $0x1
+     3c4:	e8 77 0e 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 3 |\n");
+     3c9:	83 c4 08             	add    $0x8,%esp
+     3cc:	68 1f 16 00 00       	push   $0x161f
+     3d1:	6a 01                	push   $0x1
+     3d3:	e8 68 0e 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     3d8:	83 c4 08             	add    $0x8,%esp
+     3db:	68 4f 15 00 00       	push   $0x154f
+     3e0:	6a 01                	push   $0x1
+     3e2:	e8 59 0e 00 00       	call   1240 <printf>
+
+  int i;
+  int max = 8;
+  int pid[max];
+
+  for(i = 0; i < max; i++)
+     3e7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     3ea:	8d 75 f8             	lea    -0x8(%ebp),%esi
+     3ed:	83 c4 10             	add    $0x10,%esp
+    pid[i] = createInfiniteProc();
+     3f0:	e8 49 fc ff ff       	call   3e <createInfiniteProc>
+     3f5:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < max; i++)
+     3f7:	83 c3 04             	add    $0x4,%ebx
+     3fa:	39 f3                	cmp    %esi,%ebx
+     3fc:	75 f2                	jne    3f0 <test3+0x3b>
+     3fe:	bb 07 00 00 00       	mov    $0x7,%ebx
+
+  for(i = 0; i <= plevels; i++)
+    sleepMessage(2000, "Sleeping... ctrl-p OR ctrl-r\n");
+     403:	83 ec 08             	sub    $0x8,%esp
+     406:	68 32 16 00 00       	push   $0x1632
+     40b:	68 d0 07 00 00       	push   $0x7d0
+     410:	e8 80 fc ff ff       	call   95 <sleepMessage>
+  for(i = 0; i <= plevels; i++)
+     415:	83 c4 10             	add    $0x10,%esp
+     418:	83 eb 01             	sub    $0x1,%ebx
+     41b:	75 e6                	jne    403 <test3+0x4e>
+
+  cleanupProcs(pid, max);
+     41d:	83 ec 08             	sub    $0x8,%esp
+     420:	6a 08                	push   $0x8
+     422:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     425:	50                   	push   %eax
+     426:	e8 d5 fb ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+\n");
+     42b:	83 c4 08             	add    $0x8,%esp
+     42e:	68 51 15 00 00       	push   $0x1551
+     433:	6a 01                	push   $0x1
+     435:	e8 06 0e 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 3 |\n");
+     43a:	83 c4 08             	add    $0x8,%esp
+     43d:	68 50 16 00 00       	push   $0x1650
+     442:	6a 01                	push   $0x1
+     444:	e8 f7 0d 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+\n");
+     449:	83 c4 08             	add    $0x8,%esp
+     44c:	68 51 15 00 00       	push   $0x1551
+     451:	6a 01                	push   $0x1
+     453:	e8 e8 0d 00 00       	call   1240 <printf>
+
+}
+     458:	83 c4 10             	add    $0x10,%esp
+     45b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     45e:	5b                   	pop    %ebx
+     45f:	5e                   	pop    %esi
+     460:	5d                   	pop    %ebp
+     461:	c3                   	ret
+
+00000462 <test4>:
+
+void
+test4()
+{
+     462:	55                   	push   %ebp
+     463:	89 e5                	mov    %esp,%ebp
+     465:	57                   	push   %edi
+     466:	56                   	push   %esi
+     467:	53                   	push   %ebx
+     468:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     46b:	68 4f 15 00 00       	push   $0x154f
+     470:	6a 01                	push   $0x1
+     472:	e8 c9 0d 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 4 |\n");
+     477:	83 c4 08             	add    $0x8,%esp
+     47a:	68 61 16 00 00       	push   $0x1661
+     47f:	6a 01                	push   $0x1
+     481:	e8 ba 0d 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     486:	83 c4 08             	add    $0x8,%esp
+     489:	68 4f 15 00 00       	push   $0x154f
+     48e:	6a 01                	push   $0x1
+     490:	e8 ab 0d 00 00       	call   1240 <printf>
+
+  int i;
+  int max = 10;
+  int pid[max];
+
+  for(i = 0; i < max/2; i++)
+     495:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+     498:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+     49b:	83 c4 10             	add    $0x10,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     49e:	89 de                	mov    %ebx,%esi
+    pid[i] = createSetPrioProc(plevels);
+     4a0:	83 ec 0c             	sub    $0xc,%esp
+     4a3:	6a 06                	push   $0x6
+     4a5:	e8 bf fb ff ff       	call   69 <createSetPrioProc>
+     4aa:	89 06                	mov    %eax,(%esi)
+  for(i = 0; i < max/2; i++)
+     4ac:	83 c6 04             	add    $0x4,%esi
+     4af:	83 c4 10             	add    $0x10,%esp
+     4b2:	39 fe                	cmp    %edi,%esi
+     4b4:	75 ea                	jne    4a0 <test4+0x3e>
+  for(i = max/2; i < max; i++)
+    pid[i] = createSetPrioProc(0);
+     4b6:	83 ec 0c             	sub    $0xc,%esp
+     4b9:	6a 00                	push   $0x0
+     4bb:	e8 a9 fb ff ff       	call   69 <createSetPrioProc>
+     4c0:	89 43 14             	mov    %eax,0x14(%ebx)
+  for(i = max/2; i < max; i++)
+     4c3:	83 c3 04             	add    $0x4,%ebx
+     4c6:	83 c4 10             	add    $0x10,%esp
+     4c9:	39 fb                	cmp    %edi,%ebx
+     4cb:	75 e9                	jne    4b6 <test4+0x54>
+
+  for(i = 0; i < 2; i++)
+    sleepMessage(2000, "Sleeping... ctrl-p\n");
+     4cd:	83 ec 08             	sub    $0x8,%esp
+     4d0:	68 75 15 00 00       	push   $0x1575
+     4d5:	68 d0 07 00 00       	push   $0x7d0
+     4da:	e8 b6 fb ff ff       	call   95 <sleepMessage>
+     4df:	83 c4 08             	add    $0x8,%esp
+     4e2:	68 75 15 00 00       	push   $0x1575
+     4e7:	68 d0 07 00 00       	push   $0x7d0
+     4ec:	e8 a4 fb ff ff       	call   95 <sleepMessage>
+
+  cleanupProcs(pid, max);
+     4f1:	83 c4 08             	add    $0x8,%esp
+     4f4:	6a 0a                	push   $0xa
+     4f6:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     4f9:	50                   	push   %eax
+     4fa:	e8 01 fb ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+\n");
+     4ff:	83 c4 08             	add    $0x8,%esp
+     502:	68 51 15 00 00       	push   $0x1551
+     507:	6a 01                	push   $0x1
+     509:	e8 32 0d 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 4 |\n");
+     50e:	83 c4 08             	add    $0x8,%esp
+     511:	68 74 16 00 00       	push   $0x1674
+     516:	6a 01                	push   $0x1
+     518:	e8 23 0d 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+\n");
+     51d:	83 c4 08             	add    $0x8,%esp
+     520:	68 51 15 00 00       	push   $0x1551
+     525:	6a 01                	push   $0x1
+     527:	e8 14 0d 00 00       	call   1240 <printf>
+}
+     52c:	83 c4 10             	add    $0x10,%esp
+     52f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     532:	5b                   	pop    %ebx
+     533:	5e                   	pop    %esi
+     534:	5f                   	pop    %edi
+     535:	5d                   	pop    %ebp
+     536:	c3                   	ret
+
+00000537 <test5>:
+
+void
+test5()
+{
+     537:	55                   	push   %ebp
+     538:	89 e5                	mov    %esp,%ebp
+     53a:	57                   	push   %edi
+     53b:	56                   	push   %esi
+     53c:	53                   	push   %ebx
+     53d:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     540:	68 4f 15 00 00       	push   $0x154f
+     545:	6a 01                	push   $0x1
+     547:	e8 f4 0c 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 5 |\n");
+     54c:	83 c4 08             	add    $0x8,%esp
+     54f:	68 85 16 00 00       	push   $0x1685
+     554:	6a 01                	push   $0x1
+     556:	e8 e5 0c 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+\n");
+     55b:	83 c4 08             	add    $0x8,%esp
+     55e:	68 4f 15 00 00       	push   $0x154f
+     563:	6a 01                	push   $0x1
+     565:	e8 d6 0c 00 00       	call   1240 <printf>
+     56a:	83 c4 10             	add    $0x10,%esp
+
+  int i, prio;
+  int max = 10;
+  int pid[max];
+
+  for(i = 0; i < max; i++) {
+     56d:	be 00 00 00 00       	mov    $0x0,%esi
+    prio = i%(plevels+1);
+     572:	bf 93 24 49 92       	mov    $0x92492493,%edi
+     577:	89 f0                	mov    %esi,%eax
+     579:	f7 ef                	imul   %edi
+     57b:	8d 1c 32             	lea    (%edx,%esi,1),%ebx
+     57e:	c1 fb 02             	sar    $0x2,%ebx
+     581:	89 f0                	mov    %esi,%eax
+     583:	c1 f8 1f             	sar    $0x1f,%eax
+     586:	29 c3                	sub    %eax,%ebx
+     588:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     58f:	29 d8                	sub    %ebx,%eax
+     591:	89 f3                	mov    %esi,%ebx
+     593:	29 c3                	sub    %eax,%ebx
+    pid[i] = createSetPrioProc(prio);
+     595:	83 ec 0c             	sub    $0xc,%esp
+     598:	53                   	push   %ebx
+     599:	e8 cb fa ff ff       	call   69 <createSetPrioProc>
+     59e:	89 44 b5 c0          	mov    %eax,-0x40(%ebp,%esi,4)
+    printf(1, "Process %d will be at priority level %d\n", pid[i], prio);
+     5a2:	53                   	push   %ebx
+     5a3:	50                   	push   %eax
+     5a4:	68 84 19 00 00       	push   $0x1984
+     5a9:	6a 01                	push   $0x1
+     5ab:	e8 90 0c 00 00       	call   1240 <printf>
+  for(i = 0; i < max; i++) {
+     5b0:	83 c6 01             	add    $0x1,%esi
+     5b3:	83 c4 20             	add    $0x20,%esp
+     5b6:	83 fe 0a             	cmp    $0xa,%esi
+     5b9:	75 bc                	jne    577 <test5+0x40>
+  }
+
+  sleepMessage(2000, "Sleeping... ctrl-p\n");
+     5bb:	83 ec 08             	sub    $0x8,%esp
+     5be:	68 75 15 00 00       	push   $0x1575
+     5c3:	68 d0 07 00 00       	push   $0x7d0
+     5c8:	e8 c8 fa ff ff       	call   95 <sleepMessage>
+  sleepMessage(2000, "Sleeping... ctrl-r\n");
+     5cd:	83 c4 08             	add    $0x8,%esp
+     5d0:	68 98 16 00 00       	push   $0x1698
+     5d5:	68 d0 07 00 00       	push   $0x7d0
+     5da:	e8 b6 fa ff ff       	call   95 <sleepMessage>
+
+  cleanupProcs(pid, max);
+     5df:	83 c4 08             	add    $0x8,%esp
+     5e2:	6a 0a                	push   $0xa
+     5e4:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     5e7:	50                   	push   %eax
+     5e8:	e8 13 fa ff ff       	call   0 <cleanupProcs>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     5ed:	83 c4 08             	add    $0x8,%esp
+     5f0:	68 2e 18 00 00       	push   $0x182e
+     5f5:	6a 01                	push   $0x1
+     5f7:	e8 44 0c 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 5 |\n");
+     5fc:	83 c4 08             	add    $0x8,%esp
+     5ff:	68 ac 16 00 00       	push   $0x16ac
+     604:	6a 01                	push   $0x1
+     606:	e8 35 0c 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     60b:	83 c4 08             	add    $0x8,%esp
+     60e:	68 2e 18 00 00       	push   $0x182e
+     613:	6a 01                	push   $0x1
+     615:	e8 26 0c 00 00       	call   1240 <printf>
+}
+     61a:	83 c4 10             	add    $0x10,%esp
+     61d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     620:	5b                   	pop    %ebx
+     621:	5e                   	pop    %esi
+     622:	5f                   	pop    %edi
+     623:	5d                   	pop    %ebp
+     624:	c3                   	ret
+
+00000625 <test6>:
+
+void
+test6()
+{
+     625:	55                   	push   %ebp
+     626:	89 e5                	mov    %esp,%ebp
+     628:	57                   	push   %edi
+     629:	56                   	push   %esi
+     62a:	53                   	push   %ebx
+     62b:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     62e:	68 5c 17 00 00       	push   $0x175c
+     633:	6a 01                	push   $0x1
+     635:	e8 06 0c 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 6a |\n");
+     63a:	83 c4 08             	add    $0x8,%esp
+     63d:	68 bd 16 00 00       	push   $0x16bd
+     642:	6a 01                	push   $0x1
+     644:	e8 f7 0b 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     649:	83 c4 08             	add    $0x8,%esp
+     64c:	68 5c 17 00 00       	push   $0x175c
+     651:	6a 01                	push   $0x1
+     653:	e8 e8 0b 00 00       	call   1240 <printf>
+
+  int i;
+  int max = 8;
+  int pid[max];
+
+  for(i = 0; i < max/2; i++)
+     658:	8d 75 c8             	lea    -0x38(%ebp),%esi
+     65b:	8d 7d d8             	lea    -0x28(%ebp),%edi
+     65e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     661:	89 f3                	mov    %esi,%ebx
+    pid[i] = createInfiniteProc();
+     663:	e8 d6 f9 ff ff       	call   3e <createInfiniteProc>
+     668:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < max/2; i++)
+     66a:	83 c3 04             	add    $0x4,%ebx
+     66d:	39 df                	cmp    %ebx,%edi
+     66f:	75 f2                	jne    663 <test6+0x3e>
+     671:	bb 07 00 00 00       	mov    $0x7,%ebx
+
+  for(i = 0; i <= plevels; i++)
+    sleepMessage(2000, "Sleeping... ctrl-p OR ctrl-r\n");
+     676:	83 ec 08             	sub    $0x8,%esp
+     679:	68 32 16 00 00       	push   $0x1632
+     67e:	68 d0 07 00 00       	push   $0x7d0
+     683:	e8 0d fa ff ff       	call   95 <sleepMessage>
+  for(i = 0; i <= plevels; i++)
+     688:	83 c4 10             	add    $0x10,%esp
+     68b:	83 eb 01             	sub    $0x1,%ebx
+     68e:	75 e6                	jne    676 <test6+0x51>
+  if(plevels == 0)
+    sleepMessage(2000, "Sleeping... ctrl-p OR ctrl-r\n");
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     690:	83 ec 08             	sub    $0x8,%esp
+     693:	68 2e 18 00 00       	push   $0x182e
+     698:	6a 01                	push   $0x1
+     69a:	e8 a1 0b 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 6a |\n");
+     69f:	83 c4 08             	add    $0x8,%esp
+     6a2:	68 d1 16 00 00       	push   $0x16d1
+     6a7:	6a 01                	push   $0x1
+     6a9:	e8 92 0b 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     6ae:	83 c4 08             	add    $0x8,%esp
+     6b1:	68 2e 18 00 00       	push   $0x182e
+     6b6:	6a 01                	push   $0x1
+     6b8:	e8 83 0b 00 00       	call   1240 <printf>
+
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     6bd:	83 c4 08             	add    $0x8,%esp
+     6c0:	68 5c 17 00 00       	push   $0x175c
+     6c5:	6a 01                	push   $0x1
+     6c7:	e8 74 0b 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 6b |\n");
+     6cc:	83 c4 08             	add    $0x8,%esp
+     6cf:	68 e3 16 00 00       	push   $0x16e3
+     6d4:	6a 01                	push   $0x1
+     6d6:	e8 65 0b 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     6db:	83 c4 08             	add    $0x8,%esp
+     6de:	68 5c 17 00 00       	push   $0x175c
+     6e3:	6a 01                	push   $0x1
+     6e5:	e8 56 0b 00 00       	call   1240 <printf>
+     6ea:	83 c4 10             	add    $0x10,%esp
+
+  for(i = max/2; i < max; i++)
+    pid[i] = createInfiniteProc();
+     6ed:	e8 4c f9 ff ff       	call   3e <createInfiniteProc>
+     6f2:	89 46 10             	mov    %eax,0x10(%esi)
+  for(i = max/2; i < max; i++)
+     6f5:	83 c6 04             	add    $0x4,%esi
+     6f8:	39 fe                	cmp    %edi,%esi
+     6fa:	75 f1                	jne    6ed <test6+0xc8>
+     6fc:	bb 08 00 00 00       	mov    $0x8,%ebx
+
+  for(i = 0; i <= plevels+1; i++)
+    sleepMessage(2000, "Sleeping... ctrl-p OR ctrl-r\n");
+     701:	83 ec 08             	sub    $0x8,%esp
+     704:	68 32 16 00 00       	push   $0x1632
+     709:	68 d0 07 00 00       	push   $0x7d0
+     70e:	e8 82 f9 ff ff       	call   95 <sleepMessage>
+  for(i = 0; i <= plevels+1; i++)
+     713:	83 c4 10             	add    $0x10,%esp
+     716:	83 eb 01             	sub    $0x1,%ebx
+     719:	75 e6                	jne    701 <test6+0xdc>
+
+  cleanupProcs(pid, max);
+     71b:	83 ec 08             	sub    $0x8,%esp
+     71e:	6a 08                	push   $0x8
+     720:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     723:	50                   	push   %eax
+     724:	e8 d7 f8 ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     729:	83 c4 08             	add    $0x8,%esp
+     72c:	68 2e 18 00 00       	push   $0x182e
+     731:	6a 01                	push   $0x1
+     733:	e8 08 0b 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 6b |\n");
+     738:	83 c4 08             	add    $0x8,%esp
+     73b:	68 f7 16 00 00       	push   $0x16f7
+     740:	6a 01                	push   $0x1
+     742:	e8 f9 0a 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     747:	83 c4 08             	add    $0x8,%esp
+     74a:	68 2e 18 00 00       	push   $0x182e
+     74f:	6a 01                	push   $0x1
+     751:	e8 ea 0a 00 00       	call   1240 <printf>
+}
+     756:	83 c4 10             	add    $0x10,%esp
+     759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     75c:	5b                   	pop    %ebx
+     75d:	5e                   	pop    %esi
+     75e:	5f                   	pop    %edi
+     75f:	5d                   	pop    %ebp
+     760:	c3                   	ret
+
+00000761 <test7>:
+
+void
+test7()
+{
+     761:	55                   	push   %ebp
+     762:	89 e5                	mov    %esp,%ebp
+     764:	57                   	push   %edi
+     765:	56                   	push   %esi
+     766:	53                   	push   %ebx
+     767:	83 ec 44             	sub    $0x44,%esp
+  int i = 0;
+  int max = 8;
+  int pid[max];
+  int rc = 0;
+
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     76a:	68 5c 17 00 00       	push   $0x175c
+     76f:	6a 01                	push   $0x1
+     771:	e8 ca 0a 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 7a |\n");
+     776:	83 c4 08             	add    $0x8,%esp
+     779:	68 09 17 00 00       	push   $0x1709
+     77e:	6a 01                	push   $0x1
+     780:	e8 bb 0a 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     785:	83 c4 08             	add    $0x8,%esp
+     788:	68 5c 17 00 00       	push   $0x175c
+     78d:	6a 01                	push   $0x1
+     78f:	e8 ac 0a 00 00       	call   1240 <printf>
+
+  for(i = 0; i < max; i++)
+     794:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     797:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     79a:	8d 75 e8             	lea    -0x18(%ebp),%esi
+     79d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     7a0:	89 c3                	mov    %eax,%ebx
+    pid[i] = createInfiniteProc();
+     7a2:	e8 97 f8 ff ff       	call   3e <createInfiniteProc>
+     7a7:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < max; i++)
+     7a9:	83 c3 04             	add    $0x4,%ebx
+     7ac:	39 f3                	cmp    %esi,%ebx
+     7ae:	75 f2                	jne    7a2 <test7+0x41>
+     7b0:	bb 08 00 00 00       	mov    $0x8,%ebx
+
+  for(i = 0; i <= plevels+1; i++)
+    sleepMessage(1000, "Sleeping... ctrl-p OR ctrl-r\n");
+     7b5:	83 ec 08             	sub    $0x8,%esp
+     7b8:	68 32 16 00 00       	push   $0x1632
+     7bd:	68 e8 03 00 00       	push   $0x3e8
+     7c2:	e8 ce f8 ff ff       	call   95 <sleepMessage>
+  for(i = 0; i <= plevels+1; i++)
+     7c7:	83 c4 10             	add    $0x10,%esp
+     7ca:	83 eb 01             	sub    $0x1,%ebx
+     7cd:	75 e6                	jne    7b5 <test7+0x54>
+
+  printf(1, "Using setpriority() to reset priority to MAXPRIO\nCalling: \n");
+     7cf:	83 ec 08             	sub    $0x8,%esp
+     7d2:	68 b0 19 00 00       	push   $0x19b0
+     7d7:	6a 01                	push   $0x1
+     7d9:	e8 62 0a 00 00       	call   1240 <printf>
+     7de:	83 c4 10             	add    $0x10,%esp
+     7e1:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  for(i = 0; i < max; i++) {
+    printf(1, "setpriority(%d, %d)\n", pid[i], MAXPRIO);
+     7e4:	8b 3b                	mov    (%ebx),%edi
+     7e6:	6a 06                	push   $0x6
+     7e8:	57                   	push   %edi
+     7e9:	68 1d 17 00 00       	push   $0x171d
+     7ee:	6a 01                	push   $0x1
+     7f0:	e8 4b 0a 00 00       	call   1240 <printf>
+    setpriority(pid[i], MAXPRIO);
+     7f5:	83 c4 08             	add    $0x8,%esp
+     7f8:	6a 06                	push   $0x6
+     7fa:	57                   	push   %edi
+     7fb:	e8 48 09 00 00       	call   1148 <setpriority>
+  for(i = 0; i < max; i++) {
+     800:	83 c3 04             	add    $0x4,%ebx
+     803:	83 c4 10             	add    $0x10,%esp
+     806:	39 f3                	cmp    %esi,%ebx
+     808:	75 da                	jne    7e4 <test7+0x83>
+  }
+
+  sleepMessage(2000, "Use ctrl-p and ctrl-r\n");
+     80a:	83 ec 08             	sub    $0x8,%esp
+     80d:	68 32 17 00 00       	push   $0x1732
+     812:	68 d0 07 00 00       	push   $0x7d0
+     817:	e8 79 f8 ff ff       	call   95 <sleepMessage>
+
+  cleanupProcs(pid, max);
+     81c:	83 c4 08             	add    $0x8,%esp
+     81f:	6a 08                	push   $0x8
+     821:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     824:	50                   	push   %eax
+     825:	e8 d6 f7 ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     82a:	83 c4 08             	add    $0x8,%esp
+     82d:	68 2e 18 00 00       	push   $0x182e
+     832:	6a 01                	push   $0x1
+     834:	e8 07 0a 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 7a |\n");
+     839:	83 c4 08             	add    $0x8,%esp
+     83c:	68 49 17 00 00       	push   $0x1749
+     841:	6a 01                	push   $0x1
+     843:	e8 f8 09 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     848:	83 c4 08             	add    $0x8,%esp
+     84b:	68 2e 18 00 00       	push   $0x182e
+     850:	6a 01                	push   $0x1
+     852:	e8 e9 09 00 00       	call   1240 <printf>
+
+  printf(1, "\n+=+=+=+=+=+=+=+=+=\n");
+     857:	83 c4 08             	add    $0x8,%esp
+     85a:	68 5b 17 00 00       	push   $0x175b
+     85f:	6a 01                	push   $0x1
+     861:	e8 da 09 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 7b |\n");
+     866:	83 c4 08             	add    $0x8,%esp
+     869:	68 70 17 00 00       	push   $0x1770
+     86e:	6a 01                	push   $0x1
+     870:	e8 cb 09 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     875:	83 c4 08             	add    $0x8,%esp
+     878:	68 5c 17 00 00       	push   $0x175c
+     87d:	6a 01                	push   $0x1
+     87f:	e8 bc 09 00 00       	call   1240 <printf>
+     884:	83 c4 10             	add    $0x10,%esp
+     887:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+
+  for(i = 0; i < max; i++)
+    pid[i] = createInfiniteProc();
+     88a:	e8 af f7 ff ff       	call   3e <createInfiniteProc>
+     88f:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < max; i++)
+     891:	83 c3 04             	add    $0x4,%ebx
+     894:	39 f3                	cmp    %esi,%ebx
+     896:	75 f2                	jne    88a <test7+0x129>
+
+  printf(1, "\nUsing setpriority() to set priority to same priority it had previously\n");
+     898:	83 ec 08             	sub    $0x8,%esp
+     89b:	68 ec 19 00 00       	push   $0x19ec
+     8a0:	6a 01                	push   $0x1
+     8a2:	e8 99 09 00 00       	call   1240 <printf>
+  sleepMessage(2000, "Sleeping first... ctrl-p and ctrl-r\n");
+     8a7:	83 c4 08             	add    $0x8,%esp
+     8aa:	68 38 1a 00 00       	push   $0x1a38
+     8af:	68 d0 07 00 00       	push   $0x7d0
+     8b4:	e8 dc f7 ff ff       	call   95 <sleepMessage>
+  printf(1, "Calling:\n");
+     8b9:	83 c4 08             	add    $0x8,%esp
+     8bc:	68 84 17 00 00       	push   $0x1784
+     8c1:	6a 01                	push   $0x1
+     8c3:	e8 78 09 00 00       	call   1240 <printf>
+     8c8:	83 c4 10             	add    $0x10,%esp
+     8cb:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+
+  for(i = 0; i < max; i++) {
+    int tpid = getpriority(pid[i]);
+     8ce:	8b 3b                	mov    (%ebx),%edi
+     8d0:	83 ec 0c             	sub    $0xc,%esp
+     8d3:	57                   	push   %edi
+     8d4:	e8 77 08 00 00       	call   1150 <getpriority>
+    printf(1, "setpriority(%d, %d)\n", pid[i], tpid);
+     8d9:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     8dc:	50                   	push   %eax
+     8dd:	57                   	push   %edi
+     8de:	68 1d 17 00 00       	push   $0x171d
+     8e3:	6a 01                	push   $0x1
+     8e5:	e8 56 09 00 00       	call   1240 <printf>
+    setpriority(pid[i], tpid);
+     8ea:	83 c4 18             	add    $0x18,%esp
+     8ed:	ff 75 c4             	push   -0x3c(%ebp)
+     8f0:	57                   	push   %edi
+     8f1:	e8 52 08 00 00       	call   1148 <setpriority>
+  for(i = 0; i < max; i++) {
+     8f6:	83 c3 04             	add    $0x4,%ebx
+     8f9:	83 c4 10             	add    $0x10,%esp
+     8fc:	39 f3                	cmp    %esi,%ebx
+     8fe:	75 ce                	jne    8ce <test7+0x16d>
+  }
+  sleepMessage(2000, "Use ctrl-p and ctrl-r\n");
+     900:	83 ec 08             	sub    $0x8,%esp
+     903:	68 32 17 00 00       	push   $0x1732
+     908:	68 d0 07 00 00       	push   $0x7d0
+     90d:	e8 83 f7 ff ff       	call   95 <sleepMessage>
+
+  cleanupProcs(pid, max);
+     912:	83 c4 08             	add    $0x8,%esp
+     915:	6a 08                	push   $0x8
+     917:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     91a:	50                   	push   %eax
+     91b:	e8 e0 f6 ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     920:	83 c4 08             	add    $0x8,%esp
+     923:	68 2e 18 00 00       	push   $0x182e
+     928:	6a 01                	push   $0x1
+     92a:	e8 11 09 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 7b |\n");
+     92f:	83 c4 08             	add    $0x8,%esp
+     932:	68 8e 17 00 00       	push   $0x178e
+     937:	6a 01                	push   $0x1
+     939:	e8 02 09 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     93e:	83 c4 08             	add    $0x8,%esp
+     941:	68 2e 18 00 00       	push   $0x182e
+     946:	6a 01                	push   $0x1
+     948:	e8 f3 08 00 00       	call   1240 <printf>
+
+  printf(1, "\n+=+=+=+=+=+=+=+=+=\n");
+     94d:	83 c4 08             	add    $0x8,%esp
+     950:	68 5b 17 00 00       	push   $0x175b
+     955:	6a 01                	push   $0x1
+     957:	e8 e4 08 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 7c |\n");
+     95c:	83 c4 08             	add    $0x8,%esp
+     95f:	68 a0 17 00 00       	push   $0x17a0
+     964:	6a 01                	push   $0x1
+     966:	e8 d5 08 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     96b:	83 c4 08             	add    $0x8,%esp
+     96e:	68 5c 17 00 00       	push   $0x175c
+     973:	6a 01                	push   $0x1
+     975:	e8 c6 08 00 00       	call   1240 <printf>
+
+  printf(1, "\nUsing setpriority() to set priority to invalid PID \n");
+     97a:	83 c4 08             	add    $0x8,%esp
+     97d:	68 60 1a 00 00       	push   $0x1a60
+     982:	6a 01                	push   $0x1
+     984:	e8 b7 08 00 00       	call   1240 <printf>
+  rc = setpriority(-1, MAXPRIO);
+     989:	83 c4 08             	add    $0x8,%esp
+     98c:	6a 06                	push   $0x6
+     98e:	6a ff                	push   $0xffffffff
+     990:	e8 b3 07 00 00       	call   1148 <setpriority>
+     995:	89 c3                	mov    %eax,%ebx
+  printf(1, "setpriority(-1, %d) returned %d\n", MAXPRIO, rc);
+     997:	50                   	push   %eax
+     998:	6a 06                	push   $0x6
+     99a:	68 98 1a 00 00       	push   $0x1a98
+     99f:	6a 01                	push   $0x1
+     9a1:	e8 9a 08 00 00       	call   1240 <printf>
+  if(rc != 0)
+     9a6:	83 c4 20             	add    $0x20,%esp
+     9a9:	85 db                	test   %ebx,%ebx
+     9ab:	0f 84 00 01 00 00    	je     ab1 <test7+0x350>
+    printf(1, "TEST PASSED\n\n");
+     9b1:	83 ec 08             	sub    $0x8,%esp
+     9b4:	68 b4 17 00 00       	push   $0x17b4
+     9b9:	6a 01                	push   $0x1
+     9bb:	e8 80 08 00 00       	call   1240 <printf>
+     9c0:	83 c4 10             	add    $0x10,%esp
+  else
+    printf(1, "TEST FAILED\n\n");
+
+  printf(1, "\nUsing setpriority() to set priority out of range \n");
+     9c3:	83 ec 08             	sub    $0x8,%esp
+     9c6:	68 bc 1a 00 00       	push   $0x1abc
+     9cb:	6a 01                	push   $0x1
+     9cd:	e8 6e 08 00 00       	call   1240 <printf>
+
+  for(i = 0; i < max/2; i++)
+     9d2:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+     9d5:	8d 43 10             	lea    0x10(%ebx),%eax
+     9d8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     9db:	83 c4 10             	add    $0x10,%esp
+    pid[i] = createInfiniteProc();
+     9de:	e8 5b f6 ff ff       	call   3e <createInfiniteProc>
+     9e3:	89 03                	mov    %eax,(%ebx)
+  for(i = 0; i < max/2; i++)
+     9e5:	83 c3 04             	add    $0x4,%ebx
+     9e8:	39 5d c4             	cmp    %ebx,-0x3c(%ebp)
+     9eb:	75 f1                	jne    9de <test7+0x27d>
+
+  sleepMessage(2000, "Use ctrl-p and ctrl-r to show priority and budget before calling setpriority()\n");
+     9ed:	83 ec 08             	sub    $0x8,%esp
+     9f0:	68 f0 1a 00 00       	push   $0x1af0
+     9f5:	68 d0 07 00 00       	push   $0x7d0
+     9fa:	e8 96 f6 ff ff       	call   95 <sleepMessage>
+     9ff:	83 c4 10             	add    $0x10,%esp
+
+  int err = 0;
+     a02:	bf 00 00 00 00       	mov    $0x0,%edi
+
+  for(i = 0; i < max/2; i++){
+    rc = setpriority(pid[i], MAXPRIO + 1);
+     a07:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     a0a:	8b 30                	mov    (%eax),%esi
+     a0c:	83 ec 08             	sub    $0x8,%esp
+     a0f:	6a 07                	push   $0x7
+     a11:	56                   	push   %esi
+     a12:	e8 31 07 00 00       	call   1148 <setpriority>
+     a17:	89 c3                	mov    %eax,%ebx
+    printf(1, "setpriority(%d, %d) returned %d\n", pid[i], MAXPRIO + 1, rc);
+     a19:	89 04 24             	mov    %eax,(%esp)
+     a1c:	6a 07                	push   $0x7
+     a1e:	56                   	push   %esi
+     a1f:	68 40 1b 00 00       	push   $0x1b40
+     a24:	6a 01                	push   $0x1
+     a26:	e8 15 08 00 00       	call   1240 <printf>
+    if (rc != 0)
+     a2b:	83 c4 20             	add    $0x20,%esp
+      err = rc;
+     a2e:	85 db                	test   %ebx,%ebx
+     a30:	0f 45 fb             	cmovne %ebx,%edi
+  for(i = 0; i < max/2; i++){
+     a33:	83 45 c0 04          	addl   $0x4,-0x40(%ebp)
+     a37:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     a3a:	39 45 c4             	cmp    %eax,-0x3c(%ebp)
+     a3d:	75 c8                	jne    a07 <test7+0x2a6>
+  }
+
+  if(err != 0)
+     a3f:	85 ff                	test   %edi,%edi
+     a41:	0f 84 81 00 00 00    	je     ac8 <test7+0x367>
+    printf(1, "TEST PASSED\n");
+     a47:	83 ec 08             	sub    $0x8,%esp
+     a4a:	68 d0 17 00 00       	push   $0x17d0
+     a4f:	6a 01                	push   $0x1
+     a51:	e8 ea 07 00 00       	call   1240 <printf>
+     a56:	83 c4 10             	add    $0x10,%esp
+  else
+    printf(1, "TEST FAILED\n");
+
+  sleepMessage(5000, "Use ctrl-p and ctrl-r a few times to show priority and budget after setpriority()\n");
+     a59:	83 ec 08             	sub    $0x8,%esp
+     a5c:	68 64 1b 00 00       	push   $0x1b64
+     a61:	68 88 13 00 00       	push   $0x1388
+     a66:	e8 2a f6 ff ff       	call   95 <sleepMessage>
+
+  cleanupProcs(pid, max);
+     a6b:	83 c4 08             	add    $0x8,%esp
+     a6e:	6a 08                	push   $0x8
+     a70:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     a73:	50                   	push   %eax
+     a74:	e8 87 f5 ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     a79:	83 c4 08             	add    $0x8,%esp
+     a7c:	68 2e 18 00 00       	push   $0x182e
+     a81:	6a 01                	push   $0x1
+     a83:	e8 b8 07 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 7c |\n");
+     a88:	83 c4 08             	add    $0x8,%esp
+     a8b:	68 ea 17 00 00       	push   $0x17ea
+     a90:	6a 01                	push   $0x1
+     a92:	e8 a9 07 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     a97:	83 c4 08             	add    $0x8,%esp
+     a9a:	68 2e 18 00 00       	push   $0x182e
+     a9f:	6a 01                	push   $0x1
+     aa1:	e8 9a 07 00 00       	call   1240 <printf>
+
+}
+     aa6:	83 c4 10             	add    $0x10,%esp
+     aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aac:	5b                   	pop    %ebx
+     aad:	5e                   	pop    %esi
+     aae:	5f                   	pop    %edi
+     aaf:	5d                   	pop    %ebp
+     ab0:	c3                   	ret
+    printf(1, "TEST FAILED\n\n");
+     ab1:	83 ec 08             	sub    $0x8,%esp
+     ab4:	68 c2 17 00 00       	push   $0x17c2
+     ab9:	6a 01                	push   $0x1
+     abb:	e8 80 07 00 00       	call   1240 <printf>
+     ac0:	83 c4 10             	add    $0x10,%esp
+     ac3:	e9 fb fe ff ff       	jmp    9c3 <test7+0x262>
+    printf(1, "TEST FAILED\n");
+     ac8:	83 ec 08             	sub    $0x8,%esp
+     acb:	68 dd 17 00 00       	push   $0x17dd
+     ad0:	6a 01                	push   $0x1
+     ad2:	e8 69 07 00 00       	call   1240 <printf>
+     ad7:	83 c4 10             	add    $0x10,%esp
+     ada:	e9 7a ff ff ff       	jmp    a59 <test7+0x2f8>
+
+00000adf <test8>:
+
+void
+test8()
+{
+     adf:	55                   	push   %ebp
+     ae0:	89 e5                	mov    %esp,%ebp
+     ae2:	53                   	push   %ebx
+     ae3:	83 ec 1c             	sub    $0x1c,%esp
+  int i = 0;
+  int max = 2;
+  int pid[max];
+  int rc = 0;
+
+  printf(1, "\n+=+=+=+=+=+=+=+=+=\n");
+     ae6:	68 5b 17 00 00       	push   $0x175b
+     aeb:	6a 01                	push   $0x1
+     aed:	e8 4e 07 00 00       	call   1240 <printf>
+  printf(1, "| Start: Test 8 |\n");
+     af2:	83 c4 08             	add    $0x8,%esp
+     af5:	68 fc 17 00 00       	push   $0x17fc
+     afa:	6a 01                	push   $0x1
+     afc:	e8 3f 07 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=+=\n");
+     b01:	83 c4 08             	add    $0x8,%esp
+     b04:	68 5c 17 00 00       	push   $0x175c
+     b09:	6a 01                	push   $0x1
+     b0b:	e8 30 07 00 00       	call   1240 <printf>
+
+  for(i = 0; i < max/2; i++)
+    pid[i] = createInfiniteProc();
+     b10:	e8 29 f5 ff ff       	call   3e <createInfiniteProc>
+     b15:	89 c3                	mov    %eax,%ebx
+     b17:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  printf(1, "\nThe current process' pid is %d\n", pid[0]);
+     b1a:	83 c4 0c             	add    $0xc,%esp
+     b1d:	50                   	push   %eax
+     b1e:	68 b8 1b 00 00       	push   $0x1bb8
+     b23:	6a 01                	push   $0x1
+     b25:	e8 16 07 00 00       	call   1240 <printf>
+
+  rc = getpriority(pid[0]);
+     b2a:	89 1c 24             	mov    %ebx,(%esp)
+     b2d:	e8 1e 06 00 00       	call   1150 <getpriority>
+  printf(1, "getpriority(%d) returned %d\n", pid[0], rc);
+     b32:	50                   	push   %eax
+     b33:	53                   	push   %ebx
+     b34:	68 10 18 00 00       	push   $0x1810
+     b39:	6a 01                	push   $0x1
+     b3b:	e8 00 07 00 00       	call   1240 <printf>
+
+  sleepMessage(2000, "Use ctrl-p to show priorities match \n");
+     b40:	83 c4 18             	add    $0x18,%esp
+     b43:	68 dc 1b 00 00       	push   $0x1bdc
+     b48:	68 d0 07 00 00       	push   $0x7d0
+     b4d:	e8 43 f5 ff ff       	call   95 <sleepMessage>
+
+  int ppid = getppid();
+     b52:	e8 d1 05 00 00       	call   1128 <getppid>
+     b57:	89 c3                	mov    %eax,%ebx
+
+  printf(1, "\nThe parent process' pid is %d\n", ppid);
+     b59:	83 c4 0c             	add    $0xc,%esp
+     b5c:	50                   	push   %eax
+     b5d:	68 04 1c 00 00       	push   $0x1c04
+     b62:	6a 01                	push   $0x1
+     b64:	e8 d7 06 00 00       	call   1240 <printf>
+  rc = getpriority(ppid);
+     b69:	89 1c 24             	mov    %ebx,(%esp)
+     b6c:	e8 df 05 00 00       	call   1150 <getpriority>
+  printf(1, "getpriority(%d) returned %d\n", ppid, rc);
+     b71:	50                   	push   %eax
+     b72:	53                   	push   %ebx
+     b73:	68 10 18 00 00       	push   $0x1810
+     b78:	6a 01                	push   $0x1
+     b7a:	e8 c1 06 00 00       	call   1240 <printf>
+
+  sleepMessage(2000, "Use ctrl-p to show priorities match \n");
+     b7f:	83 c4 18             	add    $0x18,%esp
+     b82:	68 dc 1b 00 00       	push   $0x1bdc
+     b87:	68 d0 07 00 00       	push   $0x7d0
+     b8c:	e8 04 f5 ff ff       	call   95 <sleepMessage>
+
+  printf(1, "\nTesting getpriority on invalid PID");
+     b91:	83 c4 08             	add    $0x8,%esp
+     b94:	68 24 1c 00 00       	push   $0x1c24
+     b99:	6a 01                	push   $0x1
+     b9b:	e8 a0 06 00 00       	call   1240 <printf>
+  rc = getpriority(-1);
+     ba0:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+     ba7:	e8 a4 05 00 00       	call   1150 <getpriority>
+     bac:	89 c3                	mov    %eax,%ebx
+  printf(1, "\ngetpriority(%d) returned %d\n", -1, rc);
+     bae:	50                   	push   %eax
+     baf:	6a ff                	push   $0xffffffff
+     bb1:	68 0f 18 00 00       	push   $0x180f
+     bb6:	6a 01                	push   $0x1
+     bb8:	e8 83 06 00 00       	call   1240 <printf>
+
+  if (rc != 0)
+     bbd:	83 c4 20             	add    $0x20,%esp
+     bc0:	85 db                	test   %ebx,%ebx
+     bc2:	74 55                	je     c19 <test8+0x13a>
+    printf(1, "TEST PASSED\n");
+     bc4:	83 ec 08             	sub    $0x8,%esp
+     bc7:	68 d0 17 00 00       	push   $0x17d0
+     bcc:	6a 01                	push   $0x1
+     bce:	e8 6d 06 00 00       	call   1240 <printf>
+     bd3:	83 c4 10             	add    $0x10,%esp
+  else
+    printf(1, "TEST FAILED\n");
+
+  cleanupProcs(pid, max);
+     bd6:	83 ec 08             	sub    $0x8,%esp
+     bd9:	6a 02                	push   $0x2
+     bdb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     bde:	50                   	push   %eax
+     bdf:	e8 1c f4 ff ff       	call   0 <cleanupProcs>
+
+  printf(1, "\n+=+=+=+=+=+=+=+=\n");
+     be4:	83 c4 08             	add    $0x8,%esp
+     be7:	68 2d 18 00 00       	push   $0x182d
+     bec:	6a 01                	push   $0x1
+     bee:	e8 4d 06 00 00       	call   1240 <printf>
+  printf(1, "| End: Test 8 |\n");
+     bf3:	83 c4 08             	add    $0x8,%esp
+     bf6:	68 40 18 00 00       	push   $0x1840
+     bfb:	6a 01                	push   $0x1
+     bfd:	e8 3e 06 00 00       	call   1240 <printf>
+  printf(1, "+=+=+=+=+=+=+=+=\n");
+     c02:	83 c4 08             	add    $0x8,%esp
+     c05:	68 2e 18 00 00       	push   $0x182e
+     c0a:	6a 01                	push   $0x1
+     c0c:	e8 2f 06 00 00       	call   1240 <printf>
+}
+     c11:	83 c4 10             	add    $0x10,%esp
+     c14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c17:	c9                   	leave
+     c18:	c3                   	ret
+    printf(1, "TEST FAILED\n");
+     c19:	83 ec 08             	sub    $0x8,%esp
+     c1c:	68 dd 17 00 00       	push   $0x17dd
+     c21:	6a 01                	push   $0x1
+     c23:	e8 18 06 00 00       	call   1240 <printf>
+     c28:	83 c4 10             	add    $0x10,%esp
+     c2b:	eb a9                	jmp    bd6 <test8+0xf7>
+
+00000c2d <menu>:
+{
+     c2d:	55                   	push   %ebp
+     c2e:	89 e5                	mov    %esp,%ebp
+     c30:	53                   	push   %ebx
+     c31:	83 ec 14             	sub    $0x14,%esp
+    gets(buf, 5);
+     c34:	8d 5d f3             	lea    -0xd(%ebp),%ebx
+     c37:	eb 05                	jmp    c3e <menu+0x11>
+        test1();
+     c39:	e8 77 f4 ff ff       	call   b5 <test1>
+    printf(1, "\n%d. Round robin scheduling for %d queues.\n", i++, plevels);
+     c3e:	6a 06                	push   $0x6
+     c40:	6a 01                	push   $0x1
+     c42:	68 48 1c 00 00       	push   $0x1c48
+     c47:	6a 01                	push   $0x1
+     c49:	e8 f2 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Promotion should change priority levels for sleeping and running processes.\n", i++);
+     c4e:	83 c4 0c             	add    $0xc,%esp
+     c51:	6a 02                	push   $0x2
+     c53:	68 74 1c 00 00       	push   $0x1c74
+     c58:	6a 01                	push   $0x1
+     c5a:	e8 e1 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Test demotion resetting budget.\n", i++);
+     c5f:	83 c4 0c             	add    $0xc,%esp
+     c62:	6a 03                	push   $0x3
+     c64:	68 c8 1c 00 00       	push   $0x1cc8
+     c69:	6a 01                	push   $0x1
+     c6b:	e8 d0 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Test scheduler operation.\n", i++);
+     c70:	83 c4 0c             	add    $0xc,%esp
+     c73:	6a 04                	push   $0x4
+     c75:	68 f0 1c 00 00       	push   $0x1cf0
+     c7a:	6a 01                	push   $0x1
+     c7c:	e8 bf 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Test demotion setting priority level.\n", i++);
+     c81:	83 c4 0c             	add    $0xc,%esp
+     c84:	6a 05                	push   $0x5
+     c86:	68 10 1d 00 00       	push   $0x1d10
+     c8b:	6a 01                	push   $0x1
+     c8d:	e8 ae 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Test scheduler selection, promotion, and demotion.\n", i++);
+     c92:	83 c4 0c             	add    $0xc,%esp
+     c95:	6a 06                	push   $0x6
+     c97:	68 3c 1d 00 00       	push   $0x1d3c
+     c9c:	6a 01                	push   $0x1
+     c9e:	e8 9d 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Test setpriority() \n", i++);
+     ca3:	83 c4 0c             	add    $0xc,%esp
+     ca6:	6a 07                	push   $0x7
+     ca8:	68 51 18 00 00       	push   $0x1851
+     cad:	6a 01                	push   $0x1
+     caf:	e8 8c 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Test getpririty() \n", i++);
+     cb4:	83 c4 0c             	add    $0xc,%esp
+     cb7:	6a 08                	push   $0x8
+     cb9:	68 6a 18 00 00       	push   $0x186a
+     cbe:	6a 01                	push   $0x1
+     cc0:	e8 7b 05 00 00       	call   1240 <printf>
+    printf(1, "%d. Exit program\n", 0);
+     cc5:	83 c4 0c             	add    $0xc,%esp
+     cc8:	6a 00                	push   $0x0
+     cca:	68 82 18 00 00       	push   $0x1882
+     ccf:	6a 01                	push   $0x1
+     cd1:	e8 6a 05 00 00       	call   1240 <printf>
+    printf(1, "Enter test number: ");
+     cd6:	83 c4 08             	add    $0x8,%esp
+     cd9:	68 94 18 00 00       	push   $0x1894
+     cde:	6a 01                	push   $0x1
+     ce0:	e8 5b 05 00 00       	call   1240 <printf>
+    gets(buf, 5);
+     ce5:	83 c4 08             	add    $0x8,%esp
+     ce8:	6a 05                	push   $0x5
+     cea:	53                   	push   %ebx
+     ceb:	e8 d0 01 00 00       	call   ec0 <gets>
+    if ((buf[0] == '\n') || buf[0] == '\0') {
+     cf0:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+     cf4:	83 c4 10             	add    $0x10,%esp
+     cf7:	3c 0a                	cmp    $0xa,%al
+     cf9:	0f 84 3f ff ff ff    	je     c3e <menu+0x11>
+     cff:	84 c0                	test   %al,%al
+     d01:	0f 84 37 ff ff ff    	je     c3e <menu+0x11>
+    select = atoi(buf);
+     d07:	83 ec 0c             	sub    $0xc,%esp
+     d0a:	53                   	push   %ebx
+     d0b:	e8 4b 02 00 00       	call   f5b <atoi>
+    switch(select) {
+     d10:	83 c4 10             	add    $0x10,%esp
+     d13:	83 f8 08             	cmp    $0x8,%eax
+     d16:	77 4d                	ja     d65 <menu+0x138>
+     d18:	ff 24 85 c4 1d 00 00 	jmp    *0x1dc4(,%eax,4)
+        test2();
+     d1f:	e8 55 f4 ff ff       	call   179 <test2>
+        break;
+     d24:	e9 15 ff ff ff       	jmp    c3e <menu+0x11>
+        test3();
+     d29:	e8 87 f6 ff ff       	call   3b5 <test3>
+        break;
+     d2e:	e9 0b ff ff ff       	jmp    c3e <menu+0x11>
+        test4();
+     d33:	e8 2a f7 ff ff       	call   462 <test4>
+        break;
+     d38:	e9 01 ff ff ff       	jmp    c3e <menu+0x11>
+        test5();
+     d3d:	e8 f5 f7 ff ff       	call   537 <test5>
+        break;
+     d42:	e9 f7 fe ff ff       	jmp    c3e <menu+0x11>
+        test6();
+     d47:	e8 d9 f8 ff ff       	call   625 <test6>
+        break;
+     d4c:	e9 ed fe ff ff       	jmp    c3e <menu+0x11>
+        test7();
+     d51:	e8 0b fa ff ff       	call   761 <test7>
+        break;
+     d56:	e9 e3 fe ff ff       	jmp    c3e <menu+0x11>
+        test8();
+     d5b:	e8 7f fd ff ff       	call   adf <test8>
+        break;
+     d60:	e9 d9 fe ff ff       	jmp    c3e <menu+0x11>
+        printf(1, "Error: invalid test number.\n");
+     d65:	83 ec 08             	sub    $0x8,%esp
+     d68:	68 a8 18 00 00       	push   $0x18a8
+     d6d:	6a 01                	push   $0x1
+     d6f:	e8 cc 04 00 00       	call   1240 <printf>
+        break;
+     d74:	83 c4 10             	add    $0x10,%esp
+     d77:	e9 c2 fe ff ff       	jmp    c3e <menu+0x11>
+}
+     d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+     d81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d84:	c9                   	leave
+     d85:	c3                   	ret
+
+00000d86 <main>:
+{
+     d86:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     d8a:	83 e4 f0             	and    $0xfffffff0,%esp
+     d8d:	ff 71 fc             	push   -0x4(%ecx)
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	51                   	push   %ecx
+     d94:	83 ec 3c             	sub    $0x3c,%esp
+  if(schedctl(SCHED_GET, &sp) == 0){
+     d97:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     d9a:	50                   	push   %eax
+     d9b:	6a 00                	push   $0x0
+     d9d:	e8 d6 03 00 00       	call   1178 <schedctl>
+     da2:	83 c4 10             	add    $0x10,%esp
+     da5:	85 c0                	test   %eax,%eax
+     da7:	75 10                	jne    db9 <main+0x33>
+    budget = sp.budget;
+     da9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dac:	a3 fc 22 00 00       	mov    %eax,0x22fc
+    promo = sp.promote;
+     db1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     db4:	a3 f8 22 00 00       	mov    %eax,0x22f8
+  printf(1, "\nWelcome to p4 Test Suite!\n");
+     db9:	83 ec 08             	sub    $0x8,%esp
+     dbc:	68 c5 18 00 00       	push   $0x18c5
+     dc1:	6a 01                	push   $0x1
+     dc3:	e8 78 04 00 00       	call   1240 <printf>
+  printf(1, "p4test starting with: MAXPRIO = %d, DEFAULT_BUDGET = %d, TICKS_TO_PROMOTE = %d\n",
+     dc8:	83 c4 04             	add    $0x4,%esp
+     dcb:	ff 35 f8 22 00 00    	push   0x22f8
+     dd1:	ff 35 fc 22 00 00    	push   0x22fc
+     dd7:	6a 06                	push   $0x6
+     dd9:	68 74 1d 00 00       	push   $0x1d74
+     dde:	6a 01                	push   $0x1
+     de0:	e8 5b 04 00 00       	call   1240 <printf>
+  while(menu() != 0);
+     de5:	83 c4 20             	add    $0x20,%esp
+     de8:	e8 40 fe ff ff       	call   c2d <menu>
+     ded:	85 c0                	test   %eax,%eax
+     def:	75 f7                	jne    de8 <main+0x62>
+  printf(1, "\nGoodbye!\n");
+     df1:	83 ec 08             	sub    $0x8,%esp
+     df4:	68 e1 18 00 00       	push   $0x18e1
+     df9:	6a 01                	push   $0x1
+     dfb:	e8 40 04 00 00       	call   1240 <printf>
+  exit();
+     e00:	e8 63 02 00 00       	call   1068 <exit>
+
+00000e05 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     e05:	55                   	push   %ebp
+     e06:	89 e5                	mov    %esp,%ebp
+     e08:	53                   	push   %ebx
+     e09:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e14:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     e18:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     e1b:	83 c0 01             	add    $0x1,%eax
+     e1e:	84 d2                	test   %dl,%dl
+     e20:	75 f2                	jne    e14 <strcpy+0xf>
+    ;
+  return os;
+}
+     e22:	89 c8                	mov    %ecx,%eax
+     e24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e27:	c9                   	leave
+     e28:	c3                   	ret
+
+00000e29 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     e29:	55                   	push   %ebp
+     e2a:	89 e5                	mov    %esp,%ebp
+     e2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     e32:	0f b6 01             	movzbl (%ecx),%eax
+     e35:	84 c0                	test   %al,%al
+     e37:	74 11                	je     e4a <strcmp+0x21>
+     e39:	38 02                	cmp    %al,(%edx)
+     e3b:	75 0d                	jne    e4a <strcmp+0x21>
+    p++, q++;
+     e3d:	83 c1 01             	add    $0x1,%ecx
+     e40:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     e43:	0f b6 01             	movzbl (%ecx),%eax
+     e46:	84 c0                	test   %al,%al
+     e48:	75 ef                	jne    e39 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+     e4a:	0f b6 c0             	movzbl %al,%eax
+     e4d:	0f b6 12             	movzbl (%edx),%edx
+     e50:	29 d0                	sub    %edx,%eax
+}
+     e52:	5d                   	pop    %ebp
+     e53:	c3                   	ret
+
+00000e54 <strlen>:
+
+uint
+strlen(char *s)
+{
+     e54:	55                   	push   %ebp
+     e55:	89 e5                	mov    %esp,%ebp
+     e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     e5a:	80 3a 00             	cmpb   $0x0,(%edx)
+     e5d:	74 14                	je     e73 <strlen+0x1f>
+     e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e64:	83 c0 01             	add    $0x1,%eax
+     e67:	89 c1                	mov    %eax,%ecx
+     e69:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     e6d:	75 f5                	jne    e64 <strlen+0x10>
+    ;
+  return n;
+}
+     e6f:	89 c8                	mov    %ecx,%eax
+     e71:	5d                   	pop    %ebp
+     e72:	c3                   	ret
+  for(n = 0; s[n]; n++)
+     e73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+     e78:	eb f5                	jmp    e6f <strlen+0x1b>
+
+00000e7a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     e7a:	55                   	push   %ebp
+     e7b:	89 e5                	mov    %esp,%ebp
+     e7d:	57                   	push   %edi
+     e7e:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     e81:	89 d7                	mov    %edx,%edi
+     e83:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     e86:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e89:	fc                   	cld
+     e8a:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     e8c:	89 d0                	mov    %edx,%eax
+     e8e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     e91:	c9                   	leave
+     e92:	c3                   	ret
+
+00000e93 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     e93:	55                   	push   %ebp
+     e94:	89 e5                	mov    %esp,%ebp
+     e96:	8b 45 08             	mov    0x8(%ebp),%eax
+     e99:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     e9d:	0f b6 10             	movzbl (%eax),%edx
+     ea0:	84 d2                	test   %dl,%dl
+     ea2:	74 15                	je     eb9 <strchr+0x26>
+    if(*s == c)
+     ea4:	38 d1                	cmp    %dl,%cl
+     ea6:	74 0f                	je     eb7 <strchr+0x24>
+  for(; *s; s++)
+     ea8:	83 c0 01             	add    $0x1,%eax
+     eab:	0f b6 10             	movzbl (%eax),%edx
+     eae:	84 d2                	test   %dl,%dl
+     eb0:	75 f2                	jne    ea4 <strchr+0x11>
+      return (char*)s;
+  return 0;
+     eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     eb7:	5d                   	pop    %ebp
+     eb8:	c3                   	ret
+  return 0;
+     eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+     ebe:	eb f7                	jmp    eb7 <strchr+0x24>
+
+00000ec0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	57                   	push   %edi
+     ec4:	56                   	push   %esi
+     ec5:	53                   	push   %ebx
+     ec6:	83 ec 2c             	sub    $0x2c,%esp
+     ec9:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     ecc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+     ed1:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+     ed4:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     ed7:	83 c3 01             	add    $0x1,%ebx
+     eda:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     edd:	7d 27                	jge    f06 <gets+0x46>
+    cc = read(0, &c, 1);
+     edf:	83 ec 04             	sub    $0x4,%esp
+     ee2:	6a 01                	push   $0x1
+     ee4:	57                   	push   %edi
+     ee5:	6a 00                	push   $0x0
+     ee7:	e8 94 01 00 00       	call   1080 <read>
+    if(cc < 1)
+     eec:	83 c4 10             	add    $0x10,%esp
+     eef:	85 c0                	test   %eax,%eax
+     ef1:	7e 13                	jle    f06 <gets+0x46>
+      break;
+    buf[i++] = c;
+     ef3:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     ef7:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     efb:	3c 0a                	cmp    $0xa,%al
+     efd:	74 04                	je     f03 <gets+0x43>
+     eff:	3c 0d                	cmp    $0xd,%al
+     f01:	75 d1                	jne    ed4 <gets+0x14>
+  for(i=0; i+1 < max; ){
+     f03:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+     f06:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     f09:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+     f0d:	89 f0                	mov    %esi,%eax
+     f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f12:	5b                   	pop    %ebx
+     f13:	5e                   	pop    %esi
+     f14:	5f                   	pop    %edi
+     f15:	5d                   	pop    %ebp
+     f16:	c3                   	ret
+
+00000f17 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     f17:	55                   	push   %ebp
+     f18:	89 e5                	mov    %esp,%ebp
+     f1a:	56                   	push   %esi
+     f1b:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     f1c:	83 ec 08             	sub    $0x8,%esp
+     f1f:	6a 00                	push   $0x0
+     f21:	ff 75 08             	push   0x8(%ebp)
+     f24:	e8 7f 01 00 00       	call   10a8 <open>
+  if(fd < 0)
+     f29:	83 c4 10             	add    $0x10,%esp
+     f2c:	85 c0                	test   %eax,%eax
+     f2e:	78 24                	js     f54 <stat+0x3d>
+     f30:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     f32:	83 ec 08             	sub    $0x8,%esp
+     f35:	ff 75 0c             	push   0xc(%ebp)
+     f38:	50                   	push   %eax
+     f39:	e8 82 01 00 00       	call   10c0 <fstat>
+     f3e:	89 c6                	mov    %eax,%esi
+  close(fd);
+     f40:	89 1c 24             	mov    %ebx,(%esp)
+     f43:	e8 48 01 00 00       	call   1090 <close>
+  return r;
+     f48:	83 c4 10             	add    $0x10,%esp
+}
+     f4b:	89 f0                	mov    %esi,%eax
+     f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f50:	5b                   	pop    %ebx
+     f51:	5e                   	pop    %esi
+     f52:	5d                   	pop    %ebp
+     f53:	c3                   	ret
+    return -1;
+     f54:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f59:	eb f0                	jmp    f4b <stat+0x34>
+
+00000f5b <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     f5b:	55                   	push   %ebp
+     f5c:	89 e5                	mov    %esp,%ebp
+     f5e:	56                   	push   %esi
+     f5f:	53                   	push   %ebx
+     f60:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     f63:	0f b6 0a             	movzbl (%edx),%ecx
+     f66:	80 f9 20             	cmp    $0x20,%cl
+     f69:	75 0b                	jne    f76 <atoi+0x1b>
+     f6b:	83 c2 01             	add    $0x1,%edx
+     f6e:	0f b6 0a             	movzbl (%edx),%ecx
+     f71:	80 f9 20             	cmp    $0x20,%cl
+     f74:	74 f5                	je     f6b <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     f76:	80 f9 2d             	cmp    $0x2d,%cl
+     f79:	74 3c                	je     fb7 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+     f7b:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     f7e:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     f83:	f6 c1 fd             	test   $0xfd,%cl
+     f86:	74 34                	je     fbc <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+     f88:	0f b6 0a             	movzbl (%edx),%ecx
+     f8b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     f8e:	3c 09                	cmp    $0x9,%al
+     f90:	77 2f                	ja     fc1 <atoi+0x66>
+     f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+     f97:	83 c2 01             	add    $0x1,%edx
+     f9a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     f9d:	0f be c9             	movsbl %cl,%ecx
+     fa0:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+     fa4:	0f b6 0a             	movzbl (%edx),%ecx
+     fa7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     faa:	3c 09                	cmp    $0x9,%al
+     fac:	76 e9                	jbe    f97 <atoi+0x3c>
+  return sign*n;
+     fae:	89 f0                	mov    %esi,%eax
+     fb0:	0f af c3             	imul   %ebx,%eax
+}
+     fb3:	5b                   	pop    %ebx
+     fb4:	5e                   	pop    %esi
+     fb5:	5d                   	pop    %ebp
+     fb6:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+     fb7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     fbc:	83 c2 01             	add    $0x1,%edx
+     fbf:	eb c7                	jmp    f88 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+     fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     fc6:	eb e6                	jmp    fae <atoi+0x53>
+
+00000fc8 <atoo>:
+
+int
+atoo(const char *s)
+{
+     fc8:	55                   	push   %ebp
+     fc9:	89 e5                	mov    %esp,%ebp
+     fcb:	56                   	push   %esi
+     fcc:	53                   	push   %ebx
+     fcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     fd0:	0f b6 0a             	movzbl (%edx),%ecx
+     fd3:	80 f9 20             	cmp    $0x20,%cl
+     fd6:	75 0b                	jne    fe3 <atoo+0x1b>
+     fd8:	83 c2 01             	add    $0x1,%edx
+     fdb:	0f b6 0a             	movzbl (%edx),%ecx
+     fde:	80 f9 20             	cmp    $0x20,%cl
+     fe1:	74 f5                	je     fd8 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     fe3:	80 f9 2d             	cmp    $0x2d,%cl
+     fe6:	74 3a                	je     1022 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+     fe8:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     feb:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     ff0:	f6 c1 fd             	test   $0xfd,%cl
+     ff3:	74 32                	je     1027 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+     ff5:	0f b6 0a             	movzbl (%edx),%ecx
+     ff8:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     ffb:	80 fb 07             	cmp    $0x7,%bl
+     ffe:	77 2c                	ja     102c <atoo+0x64>
+    1000:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+    1005:	83 c2 01             	add    $0x1,%edx
+    1008:	0f be c9             	movsbl %cl,%ecx
+    100b:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+    100f:	0f b6 0a             	movzbl (%edx),%ecx
+    1012:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    1015:	3c 07                	cmp    $0x7,%al
+    1017:	76 ec                	jbe    1005 <atoo+0x3d>
+  return sign*n;
+    1019:	89 f0                	mov    %esi,%eax
+    101b:	0f af c3             	imul   %ebx,%eax
+}
+    101e:	5b                   	pop    %ebx
+    101f:	5e                   	pop    %esi
+    1020:	5d                   	pop    %ebp
+    1021:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+    1022:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    1027:	83 c2 01             	add    $0x1,%edx
+    102a:	eb c9                	jmp    ff5 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+    102c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1031:	eb e6                	jmp    1019 <atoo+0x51>
+
+00001033 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1033:	55                   	push   %ebp
+    1034:	89 e5                	mov    %esp,%ebp
+    1036:	56                   	push   %esi
+    1037:	53                   	push   %ebx
+    1038:	8b 75 08             	mov    0x8(%ebp),%esi
+    103b:	8b 55 0c             	mov    0xc(%ebp),%edx
+    103e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1041:	85 db                	test   %ebx,%ebx
+    1043:	7e 15                	jle    105a <memmove+0x27>
+    1045:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+    1047:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+    1049:	83 c2 01             	add    $0x1,%edx
+    104c:	83 c0 01             	add    $0x1,%eax
+    104f:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+    1053:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+    1056:	39 c3                	cmp    %eax,%ebx
+    1058:	75 ef                	jne    1049 <memmove+0x16>
+  return vdst;
+}
+    105a:	89 f0                	mov    %esi,%eax
+    105c:	5b                   	pop    %ebx
+    105d:	5e                   	pop    %esi
+    105e:	5d                   	pop    %ebp
+    105f:	c3                   	ret
+
+00001060 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    1060:	b8 01 00 00 00       	mov    $0x1,%eax
+    1065:	cd 40                	int    $0x40
+    1067:	c3                   	ret
+
+00001068 <exit>:
+SYSCALL(exit)
+    1068:	b8 02 00 00 00       	mov    $0x2,%eax
+    106d:	cd 40                	int    $0x40
+    106f:	c3                   	ret
+
+00001070 <wait>:
+SYSCALL(wait)
+    1070:	b8 03 00 00 00       	mov    $0x3,%eax
+    1075:	cd 40                	int    $0x40
+    1077:	c3                   	ret
+
+00001078 <pipe>:
+SYSCALL(pipe)
+    1078:	b8 04 00 00 00       	mov    $0x4,%eax
+    107d:	cd 40                	int    $0x40
+    107f:	c3                   	ret
+
+00001080 <read>:
+SYSCALL(read)
+    1080:	b8 05 00 00 00       	mov    $0x5,%eax
+    1085:	cd 40                	int    $0x40
+    1087:	c3                   	ret
+
+00001088 <write>:
+SYSCALL(write)
+    1088:	b8 10 00 00 00       	mov    $0x10,%eax
+    108d:	cd 40                	int    $0x40
+    108f:	c3                   	ret
+
+00001090 <close>:
+SYSCALL(close)
+    1090:	b8 15 00 00 00       	mov    $0x15,%eax
+    1095:	cd 40                	int    $0x40
+    1097:	c3                   	ret
+
+00001098 <kill>:
+SYSCALL(kill)
+    1098:	b8 06 00 00 00       	mov    $0x6,%eax
+    109d:	cd 40                	int    $0x40
+    109f:	c3                   	ret
+
+000010a0 <exec>:
+SYSCALL(exec)
+    10a0:	b8 07 00 00 00       	mov    $0x7,%eax
+    10a5:	cd 40                	int    $0x40
+    10a7:	c3                   	ret
+
+000010a8 <open>:
+SYSCALL(open)
+    10a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    10ad:	cd 40                	int    $0x40
+    10af:	c3                   	ret
+
+000010b0 <mknod>:
+SYSCALL(mknod)
+    10b0:	b8 11 00 00 00       	mov    $0x11,%eax
+    10b5:	cd 40                	int    $0x40
+    10b7:	c3                   	ret
+
+000010b8 <unlink>:
+SYSCALL(unlink)
+    10b8:	b8 12 00 00 00       	mov    $0x12,%eax
+    10bd:	cd 40                	int    $0x40
+    10bf:	c3                   	ret
+
+000010c0 <fstat>:
+SYSCALL(fstat)
+    10c0:	b8 08 00 00 00       	mov    $0x8,%eax
+    10c5:	cd 40                	int    $0x40
+    10c7:	c3                   	ret
+
+000010c8 <link>:
+SYSCALL(link)
+    10c8:	b8 13 00 00 00       	mov    $0x13,%eax
+    10cd:	cd 40                	int    $0x40
+    10cf:	c3                   	ret
+
+000010d0 <mkdir>:
+SYSCALL(mkdir)
+    10d0:	b8 14 00 00 00       	mov    $0x14,%eax
+    10d5:	cd 40                	int    $0x40
+    10d7:	c3                   	ret
+
+000010d8 <chdir>:
+SYSCALL(chdir)
+    10d8:	b8 09 00 00 00       	mov    $0x9,%eax
+    10dd:	cd 40                	int    $0x40
+    10df:	c3                   	ret
+
+000010e0 <dup>:
+SYSCALL(dup)
+    10e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+    10e5:	cd 40                	int    $0x40
+    10e7:	c3                   	ret
+
+000010e8 <getpid>:
+SYSCALL(getpid)
+    10e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+    10ed:	cd 40                	int    $0x40
+    10ef:	c3                   	ret
+
+000010f0 <sbrk>:
+SYSCALL(sbrk)
+    10f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+    10f5:	cd 40                	int    $0x40
+    10f7:	c3                   	ret
+
+000010f8 <sleep>:
+SYSCALL(sleep)
+    10f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+    10fd:	cd 40                	int    $0x40
+    10ff:	c3                   	ret
+
+00001100 <uptime>:
+SYSCALL(uptime)
+    1100:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1105:	cd 40                	int    $0x40
+    1107:	c3                   	ret
+
+00001108 <halt>:
+SYSCALL(halt)
+    1108:	b8 16 00 00 00       	mov    $0x16,%eax
+    110d:	cd 40                	int    $0x40
+    110f:	c3                   	ret
+
+00001110 <date>:
+SYSCALL(date)
+    1110:	b8 17 00 00 00       	mov    $0x17,%eax
+    1115:	cd 40                	int    $0x40
+    1117:	c3                   	ret
+
+00001118 <getuid>:
+SYSCALL(getuid)
+    1118:	b8 18 00 00 00       	mov    $0x18,%eax
+    111d:	cd 40                	int    $0x40
+    111f:	c3                   	ret
+
+00001120 <getgid>:
+SYSCALL(getgid)
+    1120:	b8 19 00 00 00       	mov    $0x19,%eax
+    1125:	cd 40                	int    $0x40
+    1127:	c3                   	ret
+
+00001128 <getppid>:
+SYSCALL(getppid)
+    1128:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    112d:	cd 40                	int    $0x40
+    112f:	c3                   	ret
+
+00001130 <setuid>:
+SYSCALL(setuid)
+    1130:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1135:	cd 40                	int    $0x40
+    1137:	c3                   	ret
+
+00001138 <setgid>:
+SYSCALL(setgid)
+    1138:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    113d:	cd 40                	int    $0x40
+    113f:	c3                   	ret
+
+00001140 <getprocs>:
+SYSCALL(getprocs)
+    1140:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1145:	cd 40                	int    $0x40
+    1147:	c3                   	ret
+
+00001148 <setpriority>:
+SYSCALL(setpriority)
+    1148:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    114d:	cd 40                	int    $0x40
+    114f:	c3                   	ret
+
+00001150 <getpriority>:
+SYSCALL(getpriority)
+    1150:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1155:	cd 40                	int    $0x40
+    1157:	c3                   	ret
+
+00001158 <waitpid>:
+SYSCALL(waitpid)
+    1158:	b8 20 00 00 00       	mov    $0x20,%eax
+    115d:	cd 40                	int    $0x40
+    115f:	c3                   	ret
+
+00001160 <setaffinity>:
+SYSCALL(setaffinity)
+    1160:	b8 21 00 00 00       	mov    $0x21,%eax
+    1165:	cd 40                	int    $0x40
+    1167:	c3                   	ret
+
+00001168 <getaffinity>:
+SYSCALL(getaffinity)
+    1168:	b8 22 00 00 00       	mov    $0x22,%eax
+    116d:	cd 40                	int    $0x40
+    116f:	c3                   	ret
+
+00001170 <setdeadline>:
+SYSCALL(setdeadline)
+    1170:	b8 23 00 00 00       	mov    $0x23,%eax
+    1175:	cd 40                	int    $0x40
+    1177:	c3                   	ret
+
+00001178 <schedctl>:
+SYSCALL(schedctl)
+    1178:	b8 24 00 00 00       	mov    $0x24,%eax
+    117d:	cd 40                	int    $0x40
+    117f:	c3                   	ret
+
+00001180 <spawn>:
+SYSCALL(spawn)
+    1180:	b8 25 00 00 00       	mov    $0x25,%eax
+    1185:	cd 40                	int    $0x40
+    1187:	c3                   	ret
+
+00001188 <vmstats>:
+SYSCALL(vmstats)
+    1188:	b8 26 00 00 00       	mov    $0x26,%eax
+    118d:	cd 40                	int    $0x40
+    118f:	c3                   	ret
+
+00001190 <hugesbrk>:
+SYSCALL(hugesbrk)
+    1190:	b8 27 00 00 00       	mov    $0x27,%eax
+    1195:	cd 40                	int    $0x40
+    1197:	c3                   	ret
+
+00001198 <setshares>:
+SYSCALL(setshares)
+    1198:	b8 28 00 00 00       	mov    $0x28,%eax
+    119d:	cd 40                	int    $0x40
+    119f:	c3                   	ret
+
+000011a0 <getshares>:
+SYSCALL(getshares)
+    11a0:	b8 29 00 00 00       	mov    $0x29,%eax
+    11a5:	cd 40                	int    $0x40
+    11a7:	c3                   	ret
+
+000011a8 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    11a8:	55                   	push   %ebp
+    11a9:	89 e5                	mov    %esp,%ebp
+    11ab:	57                   	push   %edi
+    11ac:	56                   	push   %esi
+    11ad:	53                   	push   %ebx
+    11ae:	83 ec 3c             	sub    $0x3c,%esp
+    11b1:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    11b4:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    11b6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11ba:	74 79                	je     1235 <printint+0x8d>
+    11bc:	85 d2                	test   %edx,%edx
+    11be:	79 75                	jns    1235 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+    11c0:	89 d1                	mov    %edx,%ecx
+    11c2:	f7 d9                	neg    %ecx
+    neg = 1;
+    11c4:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    11cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    11d0:	89 df                	mov    %ebx,%edi
+    11d2:	83 c3 01             	add    $0x1,%ebx
+    11d5:	89 c8                	mov    %ecx,%eax
+    11d7:	ba 00 00 00 00       	mov    $0x0,%edx
+    11dc:	f7 f6                	div    %esi
+    11de:	0f b6 92 4c 1e 00 00 	movzbl 0x1e4c(%edx),%edx
+    11e5:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+    11e9:	89 ca                	mov    %ecx,%edx
+    11eb:	89 c1                	mov    %eax,%ecx
+    11ed:	39 f2                	cmp    %esi,%edx
+    11ef:	73 df                	jae    11d0 <printint+0x28>
+  if(neg)
+    11f1:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+    11f5:	74 08                	je     11ff <printint+0x57>
+    buf[i++] = '-';
+    11f7:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    11fc:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+    11ff:	85 db                	test   %ebx,%ebx
+    1201:	7e 2a                	jle    122d <printint+0x85>
+    1203:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    1206:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+    120a:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+    120d:	0f b6 03             	movzbl (%ebx),%eax
+    1210:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    1213:	83 ec 04             	sub    $0x4,%esp
+    1216:	6a 01                	push   $0x1
+    1218:	57                   	push   %edi
+    1219:	ff 75 c4             	push   -0x3c(%ebp)
+    121c:	e8 67 fe ff ff       	call   1088 <write>
+  while(--i >= 0)
+    1221:	89 d8                	mov    %ebx,%eax
+    1223:	83 eb 01             	sub    $0x1,%ebx
+    1226:	83 c4 10             	add    $0x10,%esp
+    1229:	39 f0                	cmp    %esi,%eax
+    122b:	75 e0                	jne    120d <printint+0x65>
+}
+    122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1230:	5b                   	pop    %ebx
+    1231:	5e                   	pop    %esi
+    1232:	5f                   	pop    %edi
+    1233:	5d                   	pop    %ebp
+    1234:	c3                   	ret
+    x = xx;
+    1235:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+    1237:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+    123e:	eb 8b                	jmp    11cb <printint+0x23>
+
+00001240 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	53                   	push   %ebx
+    1246:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1249:	8b 75 0c             	mov    0xc(%ebp),%esi
+    124c:	0f b6 1e             	movzbl (%esi),%ebx
+    124f:	84 db                	test   %bl,%bl
+    1251:	0f 84 9e 01 00 00    	je     13f5 <printf+0x1b5>
+    1257:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    125a:	8d 45 10             	lea    0x10(%ebp),%eax
+    125d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+    1260:	bf 00 00 00 00       	mov    $0x0,%edi
+    1265:	eb 2d                	jmp    1294 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    1267:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    126a:	83 ec 04             	sub    $0x4,%esp
+    126d:	6a 01                	push   $0x1
+    126f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1272:	50                   	push   %eax
+    1273:	ff 75 08             	push   0x8(%ebp)
+    1276:	e8 0d fe ff ff       	call   1088 <write>
+        putc(fd, c);
+    127b:	83 c4 10             	add    $0x10,%esp
+    127e:	eb 05                	jmp    1285 <printf+0x45>
+      }
+    } else if(state == '%'){
+    1280:	83 ff 25             	cmp    $0x25,%edi
+    1283:	74 1f                	je     12a4 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+    1285:	83 c6 01             	add    $0x1,%esi
+    1288:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+    128c:	84 db                	test   %bl,%bl
+    128e:	0f 84 61 01 00 00    	je     13f5 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+    1294:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1297:	85 ff                	test   %edi,%edi
+    1299:	75 e5                	jne    1280 <printf+0x40>
+      if(c == '%'){
+    129b:	83 f8 25             	cmp    $0x25,%eax
+    129e:	75 c7                	jne    1267 <printf+0x27>
+        state = '%';
+    12a0:	89 c7                	mov    %eax,%edi
+    12a2:	eb e1                	jmp    1285 <printf+0x45>
+      if(c == 'd'){
+    12a4:	83 f8 25             	cmp    $0x25,%eax
+    12a7:	0f 84 f4 00 00 00    	je     13a1 <printf+0x161>
+    12ad:	8d 50 9d             	lea    -0x63(%eax),%edx
+    12b0:	83 fa 15             	cmp    $0x15,%edx
+    12b3:	0f 87 09 01 00 00    	ja     13c2 <printf+0x182>
+    12b9:	0f 87 03 01 00 00    	ja     13c2 <printf+0x182>
+    12bf:	ff 24 95 f4 1d 00 00 	jmp    *0x1df4(,%edx,4)
+        printint(fd, *ap, 10, 1);
+    12c6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    12c9:	8b 17                	mov    (%edi),%edx
+    12cb:	83 ec 0c             	sub    $0xc,%esp
+    12ce:	6a 01                	push   $0x1
+    12d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    12d5:	8b 45 08             	mov    0x8(%ebp),%eax
+    12d8:	e8 cb fe ff ff       	call   11a8 <printint>
+        ap++;
+    12dd:	83 c7 04             	add    $0x4,%edi
+    12e0:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    12e3:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    12e6:	bf 00 00 00 00       	mov    $0x0,%edi
+    12eb:	eb 98                	jmp    1285 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+    12ed:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    12f0:	8b 17                	mov    (%edi),%edx
+    12f2:	83 ec 0c             	sub    $0xc,%esp
+    12f5:	6a 00                	push   $0x0
+    12f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+    12fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    12ff:	e8 a4 fe ff ff       	call   11a8 <printint>
+        ap++;
+    1304:	83 c7 04             	add    $0x4,%edi
+    1307:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    130a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    130d:	bf 00 00 00 00       	mov    $0x0,%edi
+    1312:	e9 6e ff ff ff       	jmp    1285 <printf+0x45>
+        s = (char*)*ap;
+    1317:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    131a:	8b 01                	mov    (%ecx),%eax
+        ap++;
+    131c:	83 c1 04             	add    $0x4,%ecx
+    131f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+    1322:	85 c0                	test   %eax,%eax
+    1324:	74 13                	je     1339 <printf+0xf9>
+        s = (char*)*ap;
+    1326:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+    1328:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+    132b:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+    1330:	84 c0                	test   %al,%al
+    1332:	75 0f                	jne    1343 <printf+0x103>
+    1334:	e9 4c ff ff ff       	jmp    1285 <printf+0x45>
+          s = "(null)";
+    1339:	bb ec 1d 00 00       	mov    $0x1dec,%ebx
+        while(*s != 0){
+    133e:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+    1343:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    1346:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    1349:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+    134c:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    134f:	83 ec 04             	sub    $0x4,%esp
+    1352:	6a 01                	push   $0x1
+    1354:	57                   	push   %edi
+    1355:	56                   	push   %esi
+    1356:	e8 2d fd ff ff       	call   1088 <write>
+          s++;
+    135b:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    135e:	0f b6 03             	movzbl (%ebx),%eax
+    1361:	83 c4 10             	add    $0x10,%esp
+    1364:	84 c0                	test   %al,%al
+    1366:	75 e4                	jne    134c <printf+0x10c>
+      state = 0;
+    1368:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    136b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1370:	e9 10 ff ff ff       	jmp    1285 <printf+0x45>
+        putc(fd, *ap);
+    1375:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1378:	8b 07                	mov    (%edi),%eax
+    137a:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    137d:	83 ec 04             	sub    $0x4,%esp
+    1380:	6a 01                	push   $0x1
+    1382:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1385:	50                   	push   %eax
+    1386:	ff 75 08             	push   0x8(%ebp)
+    1389:	e8 fa fc ff ff       	call   1088 <write>
+        ap++;
+    138e:	83 c7 04             	add    $0x4,%edi
+    1391:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1394:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1397:	bf 00 00 00 00       	mov    $0x0,%edi
+    139c:	e9 e4 fe ff ff       	jmp    1285 <printf+0x45>
+        putc(fd, c);
+    13a1:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    13a4:	83 ec 04             	sub    $0x4,%esp
+    13a7:	6a 01                	push   $0x1
+    13a9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    13ac:	50                   	push   %eax
+    13ad:	ff 75 08             	push   0x8(%ebp)
+    13b0:	e8 d3 fc ff ff       	call   1088 <write>
+    13b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13b8:	bf 00 00 00 00       	mov    $0x0,%edi
+    13bd:	e9 c3 fe ff ff       	jmp    1285 <printf+0x45>
+        putc(fd, '%');
+    13c2:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    13c6:	83 ec 04             	sub    $0x4,%esp
+    13c9:	6a 01                	push   $0x1
+    13cb:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    13ce:	57                   	push   %edi
+    13cf:	ff 75 08             	push   0x8(%ebp)
+    13d2:	e8 b1 fc ff ff       	call   1088 <write>
+        putc(fd, c);
+    13d7:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    13da:	83 c4 0c             	add    $0xc,%esp
+    13dd:	6a 01                	push   $0x1
+    13df:	57                   	push   %edi
+    13e0:	ff 75 08             	push   0x8(%ebp)
+    13e3:	e8 a0 fc ff ff       	call   1088 <write>
+        putc(fd, c);
+    13e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13eb:	bf 00 00 00 00       	mov    $0x0,%edi
+    13f0:	e9 90 fe ff ff       	jmp    1285 <printf+0x45>
+    }
+  }
+}
+    13f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f8:	5b                   	pop    %ebx
+    13f9:	5e                   	pop    %esi
+    13fa:	5f                   	pop    %edi
+    13fb:	5d                   	pop    %ebp
+    13fc:	c3                   	ret
+
+000013fd <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    13fd:	55                   	push   %ebp
+    13fe:	89 e5                	mov    %esp,%ebp
+    1400:	57                   	push   %edi
+    1401:	56                   	push   %esi
+    1402:	53                   	push   %ebx
+    1403:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1406:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1409:	a1 00 23 00 00       	mov    0x2300,%eax
+    140e:	eb 0c                	jmp    141c <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1410:	8b 10                	mov    (%eax),%edx
+    1412:	39 d0                	cmp    %edx,%eax
+    1414:	72 04                	jb     141a <free+0x1d>
+    1416:	39 d1                	cmp    %edx,%ecx
+    1418:	72 10                	jb     142a <free+0x2d>
+{
+    141a:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    141c:	39 c8                	cmp    %ecx,%eax
+    141e:	73 f0                	jae    1410 <free+0x13>
+    1420:	8b 10                	mov    (%eax),%edx
+    1422:	39 d1                	cmp    %edx,%ecx
+    1424:	72 04                	jb     142a <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1426:	39 d0                	cmp    %edx,%eax
+    1428:	72 f0                	jb     141a <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    142a:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    142d:	8b 10                	mov    (%eax),%edx
+    142f:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1432:	39 fa                	cmp    %edi,%edx
+    1434:	74 19                	je     144f <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1436:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1439:	8b 50 04             	mov    0x4(%eax),%edx
+    143c:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    143f:	39 f1                	cmp    %esi,%ecx
+    1441:	74 18                	je     145b <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1443:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    1445:	a3 00 23 00 00       	mov    %eax,0x2300
+}
+    144a:	5b                   	pop    %ebx
+    144b:	5e                   	pop    %esi
+    144c:	5f                   	pop    %edi
+    144d:	5d                   	pop    %ebp
+    144e:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    144f:	03 72 04             	add    0x4(%edx),%esi
+    1452:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1455:	8b 10                	mov    (%eax),%edx
+    1457:	8b 12                	mov    (%edx),%edx
+    1459:	eb db                	jmp    1436 <free+0x39>
+    p->s.size += bp->s.size;
+    145b:	03 53 fc             	add    -0x4(%ebx),%edx
+    145e:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1461:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1464:	eb dd                	jmp    1443 <free+0x46>
+
+00001466 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1466:	55                   	push   %ebp
+    1467:	89 e5                	mov    %esp,%ebp
+    1469:	57                   	push   %edi
+    146a:	56                   	push   %esi
+    146b:	53                   	push   %ebx
+    146c:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    146f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1472:	8d 58 07             	lea    0x7(%eax),%ebx
+    1475:	c1 eb 03             	shr    $0x3,%ebx
+    1478:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    147b:	8b 15 00 23 00 00    	mov    0x2300,%edx
+    1481:	85 d2                	test   %edx,%edx
+    1483:	74 1c                	je     14a1 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1485:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1487:	8b 48 04             	mov    0x4(%eax),%ecx
+    148a:	39 d9                	cmp    %ebx,%ecx
+    148c:	73 38                	jae    14c6 <malloc+0x60>
+  if(nu < 4096)
+    148e:	be 00 10 00 00       	mov    $0x1000,%esi
+    1493:	39 f3                	cmp    %esi,%ebx
+    1495:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    1498:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    149f:	eb 72                	jmp    1513 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    14a1:	c7 05 00 23 00 00 04 	movl   $0x2304,0x2300
+    14a8:	23 00 00 
+    14ab:	c7 05 04 23 00 00 04 	movl   $0x2304,0x2304
+    14b2:	23 00 00 
+    base.s.size = 0;
+    14b5:	c7 05 08 23 00 00 00 	movl   $0x0,0x2308
+    14bc:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    14bf:	b8 04 23 00 00       	mov    $0x2304,%eax
+    if(p->s.size >= nunits){
+    14c4:	eb c8                	jmp    148e <malloc+0x28>
+      if(p->s.size == nunits)
+    14c6:	39 cb                	cmp    %ecx,%ebx
+    14c8:	74 1e                	je     14e8 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    14ca:	29 d9                	sub    %ebx,%ecx
+    14cc:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    14cf:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    14d2:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    14d5:	89 15 00 23 00 00    	mov    %edx,0x2300
+      return (void*)(p + 1);
+    14db:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    14de:	89 d0                	mov    %edx,%eax
+    14e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14e3:	5b                   	pop    %ebx
+    14e4:	5e                   	pop    %esi
+    14e5:	5f                   	pop    %edi
+    14e6:	5d                   	pop    %ebp
+    14e7:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    14e8:	8b 08                	mov    (%eax),%ecx
+    14ea:	89 0a                	mov    %ecx,(%edx)
+    14ec:	eb e7                	jmp    14d5 <malloc+0x6f>
+  hp->s.size = nu;
+    14ee:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    14f1:	83 ec 0c             	sub    $0xc,%esp
+    14f4:	83 c0 08             	add    $0x8,%eax
+    14f7:	50                   	push   %eax
+    14f8:	e8 00 ff ff ff       	call   13fd <free>
+  return freep;
+    14fd:	8b 15 00 23 00 00    	mov    0x2300,%edx
+      if((p = morecore(nunits)) == 0)
+    1503:	83 c4 10             	add    $0x10,%esp
+    1506:	85 d2                	test   %edx,%edx
+    1508:	74 d4                	je     14de <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    150a:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    150c:	8b 48 04             	mov    0x4(%eax),%ecx
+    150f:	39 d9                	cmp    %ebx,%ecx
+    1511:	73 b3                	jae    14c6 <malloc+0x60>
+    if(p == freep)
+    1513:	89 c2                	mov    %eax,%edx
+    1515:	39 05 00 23 00 00    	cmp    %eax,0x2300
+    151b:	75 ed                	jne    150a <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    151d:	83 ec 0c             	sub    $0xc,%esp
+    1520:	57                   	push   %edi
+    1521:	e8 ca fb ff ff       	call   10f0 <sbrk>
+  if(p == (char*)-1)
+    1526:	83 c4 10             	add    $0x10,%esp
+    1529:	83 f8 ff             	cmp    $0xffffffff,%eax
+    152c:	75 c0                	jne    14ee <malloc+0x88>
+        return 0;
+    152e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1533:	eb a9                	jmp    14de <malloc+0x78>
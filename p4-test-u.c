@@ -13,6 +13,7 @@
 #include "types.h"
 #include "user.h"
 #include "param.h"
+#include "schedctl.h"
 
 #define DEFAULT_BUDGET BUDGET
 #ifndef TRUE
@@ -40,8 +41,8 @@ void test8();
      names you have defined in your code.
 */
 const int plevels = MAXPRIO;
-const int budget = DEFAULT_BUDGET;
-const int promo = TICKS_TO_PROMOTE;
+int budget = DEFAULT_BUDGET;
+int promo = TICKS_TO_PROMOTE;
 
 void
 cleanupProcs(int pid[], int max)
@@ -77,6 +78,14 @@ createSetPrioProc(int prio)
 int
 main(int argc, char* argv[])
 {
+  struct schedparams sp;
+
+  // The budget and promotion interval may have been tuned with schedctl.
+  if(schedctl(SCHED_GET, &sp) == 0){
+    budget = sp.budget;
+    promo = sp.promote;
+  }
+
   printf(1, "\nWelcome to p4 Test Suite!\n");
   printf(1, "p4test starting with: MAXPRIO = %d, DEFAULT_BUDGET = %d, TICKS_TO_PROMOTE = %d\n",
       plevels, budget, promo);
@@ -0,0 +1,1415 @@
+
+_p4-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <createProcess>:
+// Every seventh process will sleep for P4T_CHILD_SLEEP_SECONDS (whatever that
+// might be). This can be used to demonstrate that sleeping processes are not
+// being scheduled in the system.
+int
+createProcess(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+  // What time is it right now?
+  int start = uptime();
+   5:	e8 71 04 00 00       	call   47b <uptime>
+   a:	89 c3                	mov    %eax,%ebx
+  int end = start + (P4T_SECONDS * TPS);
+  // A counter to track the pointless CPU cycles we're using
+  int counter = COUNTER_START;
+  // Store the return value of fork() so we know if this is the child or the
+  // parent process.
+  int rc = fork();
+   c:	e8 ca 03 00 00       	call   3db <fork>
+
+  if (rc == 0) {
+  11:	85 c0                	test   %eax,%eax
+  13:	75 5a                	jne    6f <createProcess+0x6f>
+  int end = start + (P4T_SECONDS * TPS);
+  15:	81 c3 60 ea 00 00    	add    $0xea60,%ebx
+      pid = getpid();
+
+      // Every seventh process will take a nap and then exit.
+      // The remaining processes will do some work and attempt to fall down
+      // the priority queues.
+      if (pid % 7 == 0) {
+  1b:	be 93 24 49 92       	mov    $0x92492493,%esi
+      if (uptime() > end) {
+  20:	e8 56 04 00 00       	call   47b <uptime>
+  25:	39 d8                	cmp    %ebx,%eax
+  27:	7f 2f                	jg     58 <createProcess+0x58>
+      pid = getpid();
+  29:	e8 35 04 00 00       	call   463 <getpid>
+  2e:	89 c1                	mov    %eax,%ecx
+      if (pid % 7 == 0) {
+  30:	f7 ee                	imul   %esi
+  32:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  35:	c1 f8 02             	sar    $0x2,%eax
+  38:	89 ca                	mov    %ecx,%edx
+  3a:	c1 fa 1f             	sar    $0x1f,%edx
+  3d:	29 d0                	sub    %edx,%eax
+  3f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  46:	29 c2                	sub    %eax,%edx
+  48:	39 d1                	cmp    %edx,%ecx
+  4a:	74 11                	je     5d <createProcess+0x5d>
+  4c:	b8 00 2d 31 01       	mov    $0x1312d00,%eax
+        exit();
+      } else {
+        // These processes only perform a finite amount of work because
+        // they need to check (look at the top of the while loop) if it is
+        // time to exit.
+        while (counter < COUNTER_END) {
+  51:	83 e8 01             	sub    $0x1,%eax
+  54:	75 fb                	jne    51 <createProcess+0x51>
+  56:	eb c8                	jmp    20 <createProcess+0x20>
+        exit();
+  58:	e8 86 03 00 00       	call   3e3 <exit>
+        sleep(P4T_CHILD_SLEEP_SECONDS);
+  5d:	83 ec 0c             	sub    $0xc,%esp
+  60:	68 e0 93 04 00       	push   $0x493e0
+  65:	e8 09 04 00 00       	call   473 <sleep>
+        exit();
+  6a:	e8 74 03 00 00       	call   3e3 <exit>
+  6f:	89 c6                	mov    %eax,%esi
+        }
+      }
+
+      counter = COUNTER_START;
+    }
+  } else if (rc < 0) {
+  71:	78 09                	js     7c <createProcess+0x7c>
+    // by `p4-test&`
+    printf(2, "Fork failed! Done creating\n");
+  }
+
+  return rc;
+}
+  73:	89 f0                	mov    %esi,%eax
+  75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  78:	5b                   	pop    %ebx
+  79:	5e                   	pop    %esi
+  7a:	5d                   	pop    %ebp
+  7b:	c3                   	ret
+    printf(2, "Fork failed! Done creating\n");
+  7c:	83 ec 08             	sub    $0x8,%esp
+  7f:	68 b0 08 00 00       	push   $0x8b0
+  84:	6a 02                	push   $0x2
+  86:	e8 30 05 00 00       	call   5bb <printf>
+  8b:	83 c4 10             	add    $0x10,%esp
+  return rc;
+  8e:	eb e3                	jmp    73 <createProcess+0x73>
+
+00000090 <main>:
+
+int
+main(int argc, char* argv[])
+{
+  90:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  94:	83 e4 f0             	and    $0xfffffff0,%esp
+  97:	ff 71 fc             	push   -0x4(%ecx)
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	57                   	push   %edi
+  9e:	56                   	push   %esi
+  9f:	53                   	push   %ebx
+  a0:	51                   	push   %ecx
+  a1:	83 ec 08             	sub    $0x8,%esp
+  // Track the count of processes that we've created
+  int pc = 0;
+  a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+      }
+      ++pc;
+    }
+
+    printf(1, "Created %d processes. Sleeping for %d seconds.\n",
+           pc % P4T_TO_CREATE ? pc % P4T_TO_CREATE : P4T_TO_CREATE,
+  a9:	bf 67 66 66 66       	mov    $0x66666667,%edi
+  ae:	eb 3f                	jmp    ef <main+0x5f>
+  b0:	89 d8                	mov    %ebx,%eax
+  b2:	f7 ef                	imul   %edi
+  b4:	d1 fa                	sar    %edx
+  b6:	89 d8                	mov    %ebx,%eax
+  b8:	c1 f8 1f             	sar    $0x1f,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    printf(1, "Created %d processes. Sleeping for %d seconds.\n",
+  c0:	89 da                	mov    %ebx,%edx
+  c2:	29 c2                	sub    %eax,%edx
+  c4:	b8 05 00 00 00       	mov    $0x5,%eax
+  c9:	0f 44 d0             	cmove  %eax,%edx
+  cc:	6a 01                	push   $0x1
+  ce:	52                   	push   %edx
+  cf:	68 ec 08 00 00       	push   $0x8ec
+  d4:	6a 01                	push   $0x1
+  d6:	e8 e0 04 00 00       	call   5bb <printf>
+           P4T_PARENT_SLEEP_SECONDS);
+    sleep(P4T_PARENT_SLEEP_SECONDS * TPS);
+  db:	c7 04 24 e8 03 00 00 	movl   $0x3e8,(%esp)
+  e2:	e8 8c 03 00 00       	call   473 <sleep>
+  while (pc < P4T_MAX) {
+  e7:	83 c4 10             	add    $0x10,%esp
+  ea:	83 fb 3b             	cmp    $0x3b,%ebx
+  ed:	7f 18                	jg     107 <main+0x77>
+    for (i = 0; i < P4T_TO_CREATE; ++i) {
+  ef:	8d 73 05             	lea    0x5(%ebx),%esi
+      if (createProcess() == -1) {
+  f2:	e8 09 ff ff ff       	call   0 <createProcess>
+  f7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  fa:	74 b4                	je     b0 <main+0x20>
+      ++pc;
+  fc:	83 c3 01             	add    $0x1,%ebx
+    for (i = 0; i < P4T_TO_CREATE; ++i) {
+  ff:	39 de                	cmp    %ebx,%esi
+ 101:	75 ef                	jne    f2 <main+0x62>
+      ++pc;
+ 103:	89 f3                	mov    %esi,%ebx
+ 105:	eb a9                	jmp    b0 <main+0x20>
+  }
+
+  printf(1, "Created %d processes.\n", pc);
+ 107:	83 ec 04             	sub    $0x4,%esp
+ 10a:	53                   	push   %ebx
+ 10b:	68 cc 08 00 00       	push   $0x8cc
+ 110:	6a 01                	push   $0x1
+ 112:	e8 a4 04 00 00       	call   5bb <printf>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	bb 06 00 00 00       	mov    $0x6,%ebx
+
+  // Loop for approximately one minute while prompting for action.
+  for (i = 0; i < 6; ++i) {
+    // Prompt for action!
+    printf(1, "Now verify that your system is working by pressing C-p and then C-r.\n");
+ 11f:	83 ec 08             	sub    $0x8,%esp
+ 122:	68 1c 09 00 00       	push   $0x91c
+ 127:	6a 01                	push   $0x1
+ 129:	e8 8d 04 00 00       	call   5bb <printf>
+    // Now sleep for 10 seconds so the user can actually do something
+    sleep(10 * TPS);
+ 12e:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+ 135:	e8 39 03 00 00       	call   473 <sleep>
+  for (i = 0; i < 6; ++i) {
+ 13a:	83 c4 10             	add    $0x10,%esp
+ 13d:	83 eb 01             	sub    $0x1,%ebx
+ 140:	75 dd                	jne    11f <main+0x8f>
+ 142:	eb 1e                	jmp    162 <main+0xd2>
+
+  // Just make sure that all child processes have exited so we don't leave
+  // orphaned processes hanging around. If there are any child processes,
+  // print a helpful message and then sleep for 1 second.
+  while (wait() != -1) {
+    printf(1, "Waiting on all child processes to exit...\n");
+ 144:	83 ec 08             	sub    $0x8,%esp
+ 147:	68 64 09 00 00       	push   $0x964
+ 14c:	6a 01                	push   $0x1
+ 14e:	e8 68 04 00 00       	call   5bb <printf>
+    sleep(TPS);
+ 153:	c7 04 24 e8 03 00 00 	movl   $0x3e8,(%esp)
+ 15a:	e8 14 03 00 00       	call   473 <sleep>
+ 15f:	83 c4 10             	add    $0x10,%esp
+  while (wait() != -1) {
+ 162:	e8 84 02 00 00       	call   3eb <wait>
+ 167:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 16a:	75 d8                	jne    144 <main+0xb4>
+  }
+
+  printf(1, "Done!\n");
+ 16c:	83 ec 08             	sub    $0x8,%esp
+ 16f:	68 e3 08 00 00       	push   $0x8e3
+ 174:	6a 01                	push   $0x1
+ 176:	e8 40 04 00 00       	call   5bb <printf>
+
+  exit();
+ 17b:	e8 63 02 00 00       	call   3e3 <exit>
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 187:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 18a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 18f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 193:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 196:	83 c0 01             	add    $0x1,%eax
+ 199:	84 d2                	test   %dl,%dl
+ 19b:	75 f2                	jne    18f <strcpy+0xf>
+    ;
+  return os;
+}
+ 19d:	89 c8                	mov    %ecx,%eax
+ 19f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1ad:	0f b6 01             	movzbl (%ecx),%eax
+ 1b0:	84 c0                	test   %al,%al
+ 1b2:	74 11                	je     1c5 <strcmp+0x21>
+ 1b4:	38 02                	cmp    %al,(%edx)
+ 1b6:	75 0d                	jne    1c5 <strcmp+0x21>
+    p++, q++;
+ 1b8:	83 c1 01             	add    $0x1,%ecx
+ 1bb:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1be:	0f b6 01             	movzbl (%ecx),%eax
+ 1c1:	84 c0                	test   %al,%al
+ 1c3:	75 ef                	jne    1b4 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 1c5:	0f b6 c0             	movzbl %al,%eax
+ 1c8:	0f b6 12             	movzbl (%edx),%edx
+ 1cb:	29 d0                	sub    %edx,%eax
+}
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+
+000001cf <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d5:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1d8:	74 14                	je     1ee <strlen+0x1f>
+ 1da:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1df:	83 c0 01             	add    $0x1,%eax
+ 1e2:	89 c1                	mov    %eax,%ecx
+ 1e4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e8:	75 f5                	jne    1df <strlen+0x10>
+    ;
+  return n;
+}
+ 1ea:	89 c8                	mov    %ecx,%eax
+ 1ec:	5d                   	pop    %ebp
+ 1ed:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 1ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1f3:	eb f5                	jmp    1ea <strlen+0x1b>
+
+000001f5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	57                   	push   %edi
+ 1f9:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1fc:	89 d7                	mov    %edx,%edi
+ 1fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 201:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 204:	fc                   	cld
+ 205:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 207:	89 d0                	mov    %edx,%eax
+ 209:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+ 211:	8b 45 08             	mov    0x8(%ebp),%eax
+ 214:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 218:	0f b6 10             	movzbl (%eax),%edx
+ 21b:	84 d2                	test   %dl,%dl
+ 21d:	74 15                	je     234 <strchr+0x26>
+    if(*s == c)
+ 21f:	38 d1                	cmp    %dl,%cl
+ 221:	74 0f                	je     232 <strchr+0x24>
+  for(; *s; s++)
+ 223:	83 c0 01             	add    $0x1,%eax
+ 226:	0f b6 10             	movzbl (%eax),%edx
+ 229:	84 d2                	test   %dl,%dl
+ 22b:	75 f2                	jne    21f <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 22d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+  return 0;
+ 234:	b8 00 00 00 00       	mov    $0x0,%eax
+ 239:	eb f7                	jmp    232 <strchr+0x24>
+
+0000023b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 23b:	55                   	push   %ebp
+ 23c:	89 e5                	mov    %esp,%ebp
+ 23e:	57                   	push   %edi
+ 23f:	56                   	push   %esi
+ 240:	53                   	push   %ebx
+ 241:	83 ec 2c             	sub    $0x2c,%esp
+ 244:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 247:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 24c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 24f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 252:	83 c3 01             	add    $0x1,%ebx
+ 255:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 258:	7d 27                	jge    281 <gets+0x46>
+    cc = read(0, &c, 1);
+ 25a:	83 ec 04             	sub    $0x4,%esp
+ 25d:	6a 01                	push   $0x1
+ 25f:	57                   	push   %edi
+ 260:	6a 00                	push   $0x0
+ 262:	e8 94 01 00 00       	call   3fb <read>
+    if(cc < 1)
+ 267:	83 c4 10             	add    $0x10,%esp
+ 26a:	85 c0                	test   %eax,%eax
+ 26c:	7e 13                	jle    281 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 26e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 272:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 276:	3c 0a                	cmp    $0xa,%al
+ 278:	74 04                	je     27e <gets+0x43>
+ 27a:	3c 0d                	cmp    $0xd,%al
+ 27c:	75 d1                	jne    24f <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 27e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 281:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 284:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 288:	89 f0                	mov    %esi,%eax
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+
+00000292 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 292:	55                   	push   %ebp
+ 293:	89 e5                	mov    %esp,%ebp
+ 295:	56                   	push   %esi
+ 296:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 297:	83 ec 08             	sub    $0x8,%esp
+ 29a:	6a 00                	push   $0x0
+ 29c:	ff 75 08             	push   0x8(%ebp)
+ 29f:	e8 7f 01 00 00       	call   423 <open>
+  if(fd < 0)
+ 2a4:	83 c4 10             	add    $0x10,%esp
+ 2a7:	85 c0                	test   %eax,%eax
+ 2a9:	78 24                	js     2cf <stat+0x3d>
+ 2ab:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2ad:	83 ec 08             	sub    $0x8,%esp
+ 2b0:	ff 75 0c             	push   0xc(%ebp)
+ 2b3:	50                   	push   %eax
+ 2b4:	e8 82 01 00 00       	call   43b <fstat>
+ 2b9:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bb:	89 1c 24             	mov    %ebx,(%esp)
+ 2be:	e8 48 01 00 00       	call   40b <close>
+  return r;
+ 2c3:	83 c4 10             	add    $0x10,%esp
+}
+ 2c6:	89 f0                	mov    %esi,%eax
+ 2c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2cb:	5b                   	pop    %ebx
+ 2cc:	5e                   	pop    %esi
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+    return -1;
+ 2cf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d4:	eb f0                	jmp    2c6 <stat+0x34>
+
+000002d6 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2d6:	55                   	push   %ebp
+ 2d7:	89 e5                	mov    %esp,%ebp
+ 2d9:	56                   	push   %esi
+ 2da:	53                   	push   %ebx
+ 2db:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2de:	0f b6 0a             	movzbl (%edx),%ecx
+ 2e1:	80 f9 20             	cmp    $0x20,%cl
+ 2e4:	75 0b                	jne    2f1 <atoi+0x1b>
+ 2e6:	83 c2 01             	add    $0x1,%edx
+ 2e9:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ec:	80 f9 20             	cmp    $0x20,%cl
+ 2ef:	74 f5                	je     2e6 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2f1:	80 f9 2d             	cmp    $0x2d,%cl
+ 2f4:	74 3c                	je     332 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 2f6:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2f9:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2fe:	f6 c1 fd             	test   $0xfd,%cl
+ 301:	74 34                	je     337 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 303:	0f b6 0a             	movzbl (%edx),%ecx
+ 306:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 309:	3c 09                	cmp    $0x9,%al
+ 30b:	77 2f                	ja     33c <atoi+0x66>
+ 30d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 312:	83 c2 01             	add    $0x1,%edx
+ 315:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 318:	0f be c9             	movsbl %cl,%ecx
+ 31b:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 31f:	0f b6 0a             	movzbl (%edx),%ecx
+ 322:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 325:	3c 09                	cmp    $0x9,%al
+ 327:	76 e9                	jbe    312 <atoi+0x3c>
+  return sign*n;
+ 329:	89 f0                	mov    %esi,%eax
+ 32b:	0f af c3             	imul   %ebx,%eax
+}
+ 32e:	5b                   	pop    %ebx
+ 32f:	5e                   	pop    %esi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 332:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 337:	83 c2 01             	add    $0x1,%edx
+ 33a:	eb c7                	jmp    303 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 33c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 341:	eb e6                	jmp    329 <atoi+0x53>
+
+00000343 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 343:	55                   	push   %ebp
+ 344:	89 e5                	mov    %esp,%ebp
+ 346:	56                   	push   %esi
+ 347:	53                   	push   %ebx
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 34b:	0f b6 0a             	movzbl (%edx),%ecx
+ 34e:	80 f9 20             	cmp    $0x20,%cl
+ 351:	75 0b                	jne    35e <atoo+0x1b>
+ 353:	83 c2 01             	add    $0x1,%edx
+ 356:	0f b6 0a             	movzbl (%edx),%ecx
+ 359:	80 f9 20             	cmp    $0x20,%cl
+ 35c:	74 f5                	je     353 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 35e:	80 f9 2d             	cmp    $0x2d,%cl
+ 361:	74 3a                	je     39d <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 363:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 366:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 36b:	f6 c1 fd             	test   $0xfd,%cl
+ 36e:	74 32                	je     3a2 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 370:	0f b6 0a             	movzbl (%edx),%ecx
+ 373:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 376:	80 fb 07             	cmp    $0x7,%bl
+ 379:	77 2c                	ja     3a7 <atoo+0x64>
+ 37b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	0f be c9             	movsbl %cl,%ecx
+ 386:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 38a:	0f b6 0a             	movzbl (%edx),%ecx
+ 38d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 390:	3c 07                	cmp    $0x7,%al
+ 392:	76 ec                	jbe    380 <atoo+0x3d>
+  return sign*n;
+ 394:	89 f0                	mov    %esi,%eax
+ 396:	0f af c3             	imul   %ebx,%eax
+}
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 39d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3a2:	83 c2 01             	add    $0x1,%edx
+ 3a5:	eb c9                	jmp    370 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 3a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 3ac:	eb e6                	jmp    394 <atoo+0x51>
+
+000003ae <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3ae:	55                   	push   %ebp
+ 3af:	89 e5                	mov    %esp,%ebp
+ 3b1:	56                   	push   %esi
+ 3b2:	53                   	push   %ebx
+ 3b3:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3bc:	85 db                	test   %ebx,%ebx
+ 3be:	7e 15                	jle    3d5 <memmove+0x27>
+ 3c0:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 3c2:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 3c4:	83 c2 01             	add    $0x1,%edx
+ 3c7:	83 c0 01             	add    $0x1,%eax
+ 3ca:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 3ce:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 3d1:	39 c3                	cmp    %eax,%ebx
+ 3d3:	75 ef                	jne    3c4 <memmove+0x16>
+  return vdst;
+}
+ 3d5:	89 f0                	mov    %esi,%eax
+ 3d7:	5b                   	pop    %ebx
+ 3d8:	5e                   	pop    %esi
+ 3d9:	5d                   	pop    %ebp
+ 3da:	c3                   	ret
+
+000003db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <exit>:
+SYSCALL(exit)
+ 3e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <wait>:
+SYSCALL(wait)
+ 3eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <pipe>:
+SYSCALL(pipe)
+ 3f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <read>:
+SYSCALL(read)
+ 3fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <write>:
+SYSCALL(write)
+ 403:	b8 10 00 00 00       	mov    $0x10,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <close>:
+SYSCALL(close)
+ 40b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <kill>:
+SYSCALL(kill)
+ 413:	b8 06 00 00 00       	mov    $0x6,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <exec>:
+SYSCALL(exec)
+ 41b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <open>:
+SYSCALL(open)
+ 423:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mknod>:
+SYSCALL(mknod)
+ 42b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <unlink>:
+SYSCALL(unlink)
+ 433:	b8 12 00 00 00       	mov    $0x12,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <fstat>:
+SYSCALL(fstat)
+ 43b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <link>:
+SYSCALL(link)
+ 443:	b8 13 00 00 00       	mov    $0x13,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mkdir>:
+SYSCALL(mkdir)
+ 44b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <chdir>:
+SYSCALL(chdir)
+ 453:	b8 09 00 00 00       	mov    $0x9,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <dup>:
+SYSCALL(dup)
+ 45b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getpid>:
+SYSCALL(getpid)
+ 463:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <sbrk>:
+SYSCALL(sbrk)
+ 46b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <sleep>:
+SYSCALL(sleep)
+ 473:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <uptime>:
+SYSCALL(uptime)
+ 47b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <halt>:
+SYSCALL(halt)
+ 483:	b8 16 00 00 00       	mov    $0x16,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <date>:
+SYSCALL(date)
+ 48b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getuid>:
+SYSCALL(getuid)
+ 493:	b8 18 00 00 00       	mov    $0x18,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <getgid>:
+SYSCALL(getgid)
+ 49b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getppid>:
+SYSCALL(getppid)
+ 4a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <setuid>:
+SYSCALL(setuid)
+ 4ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <setgid>:
+SYSCALL(setgid)
+ 4b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getprocs>:
+SYSCALL(getprocs)
+ 4bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <setpriority>:
+SYSCALL(setpriority)
+ 4c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getpriority>:
+SYSCALL(getpriority)
+ 4cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <waitpid>:
+SYSCALL(waitpid)
+ 4d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <setaffinity>:
+SYSCALL(setaffinity)
+ 4db:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getaffinity>:
+SYSCALL(getaffinity)
+ 4e3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <setdeadline>:
+SYSCALL(setdeadline)
+ 4eb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <schedctl>:
+SYSCALL(schedctl)
+ 4f3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <spawn>:
+SYSCALL(spawn)
+ 4fb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <vmstats>:
+SYSCALL(vmstats)
+ 503:	b8 26 00 00 00       	mov    $0x26,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <hugesbrk>:
+SYSCALL(hugesbrk)
+ 50b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <setshares>:
+SYSCALL(setshares)
+ 513:	b8 28 00 00 00       	mov    $0x28,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <getshares>:
+SYSCALL(getshares)
+ 51b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 523:	55                   	push   %ebp
+ 524:	89 e5                	mov    %esp,%ebp
+ 526:	57                   	push   %edi
+ 527:	56                   	push   %esi
+ 528:	53                   	push   %ebx
+ 529:	83 ec 3c             	sub    $0x3c,%esp
+ 52c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 52f:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 531:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 535:	74 79                	je     5b0 <printint+0x8d>
+ 537:	85 d2                	test   %edx,%edx
+ 539:	79 75                	jns    5b0 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 53b:	89 d1                	mov    %edx,%ecx
+ 53d:	f7 d9                	neg    %ecx
+    neg = 1;
+ 53f:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 546:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 54b:	89 df                	mov    %ebx,%edi
+ 54d:	83 c3 01             	add    $0x1,%ebx
+ 550:	89 c8                	mov    %ecx,%eax
+ 552:	ba 00 00 00 00       	mov    $0x0,%edx
+ 557:	f7 f6                	div    %esi
+ 559:	0f b6 92 f0 09 00 00 	movzbl 0x9f0(%edx),%edx
+ 560:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 564:	89 ca                	mov    %ecx,%edx
+ 566:	89 c1                	mov    %eax,%ecx
+ 568:	39 f2                	cmp    %esi,%edx
+ 56a:	73 df                	jae    54b <printint+0x28>
+  if(neg)
+ 56c:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 570:	74 08                	je     57a <printint+0x57>
+    buf[i++] = '-';
+ 572:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 577:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 57a:	85 db                	test   %ebx,%ebx
+ 57c:	7e 2a                	jle    5a8 <printint+0x85>
+ 57e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 581:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 585:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 588:	0f b6 03             	movzbl (%ebx),%eax
+ 58b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 58e:	83 ec 04             	sub    $0x4,%esp
+ 591:	6a 01                	push   $0x1
+ 593:	57                   	push   %edi
+ 594:	ff 75 c4             	push   -0x3c(%ebp)
+ 597:	e8 67 fe ff ff       	call   403 <write>
+  while(--i >= 0)
+ 59c:	89 d8                	mov    %ebx,%eax
+ 59e:	83 eb 01             	sub    $0x1,%ebx
+ 5a1:	83 c4 10             	add    $0x10,%esp
+ 5a4:	39 f0                	cmp    %esi,%eax
+ 5a6:	75 e0                	jne    588 <printint+0x65>
+}
+ 5a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ab:	5b                   	pop    %ebx
+ 5ac:	5e                   	pop    %esi
+ 5ad:	5f                   	pop    %edi
+ 5ae:	5d                   	pop    %ebp
+ 5af:	c3                   	ret
+    x = xx;
+ 5b0:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 5b2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 5b9:	eb 8b                	jmp    546 <printint+0x23>
+
+000005bb <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5bb:	55                   	push   %ebp
+ 5bc:	89 e5                	mov    %esp,%ebp
+ 5be:	57                   	push   %edi
+ 5bf:	56                   	push   %esi
+ 5c0:	53                   	push   %ebx
+ 5c1:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 5c7:	0f b6 1e             	movzbl (%esi),%ebx
+ 5ca:	84 db                	test   %bl,%bl
+ 5cc:	0f 84 9e 01 00 00    	je     770 <printf+0x1b5>
+ 5d2:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 5d5:	8d 45 10             	lea    0x10(%ebp),%eax
+ 5d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 5db:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e0:	eb 2d                	jmp    60f <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5e2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e5:	83 ec 04             	sub    $0x4,%esp
+ 5e8:	6a 01                	push   $0x1
+ 5ea:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5ed:	50                   	push   %eax
+ 5ee:	ff 75 08             	push   0x8(%ebp)
+ 5f1:	e8 0d fe ff ff       	call   403 <write>
+        putc(fd, c);
+ 5f6:	83 c4 10             	add    $0x10,%esp
+ 5f9:	eb 05                	jmp    600 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 5fb:	83 ff 25             	cmp    $0x25,%edi
+ 5fe:	74 1f                	je     61f <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 600:	83 c6 01             	add    $0x1,%esi
+ 603:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 607:	84 db                	test   %bl,%bl
+ 609:	0f 84 61 01 00 00    	je     770 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 60f:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 612:	85 ff                	test   %edi,%edi
+ 614:	75 e5                	jne    5fb <printf+0x40>
+      if(c == '%'){
+ 616:	83 f8 25             	cmp    $0x25,%eax
+ 619:	75 c7                	jne    5e2 <printf+0x27>
+        state = '%';
+ 61b:	89 c7                	mov    %eax,%edi
+ 61d:	eb e1                	jmp    600 <printf+0x45>
+      if(c == 'd'){
+ 61f:	83 f8 25             	cmp    $0x25,%eax
+ 622:	0f 84 f4 00 00 00    	je     71c <printf+0x161>
+ 628:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 62b:	83 fa 15             	cmp    $0x15,%edx
+ 62e:	0f 87 09 01 00 00    	ja     73d <printf+0x182>
+ 634:	0f 87 03 01 00 00    	ja     73d <printf+0x182>
+ 63a:	ff 24 95 98 09 00 00 	jmp    *0x998(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 641:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 644:	8b 17                	mov    (%edi),%edx
+ 646:	83 ec 0c             	sub    $0xc,%esp
+ 649:	6a 01                	push   $0x1
+ 64b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 650:	8b 45 08             	mov    0x8(%ebp),%eax
+ 653:	e8 cb fe ff ff       	call   523 <printint>
+        ap++;
+ 658:	83 c7 04             	add    $0x4,%edi
+ 65b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 65e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 661:	bf 00 00 00 00       	mov    $0x0,%edi
+ 666:	eb 98                	jmp    600 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 668:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 66b:	8b 17                	mov    (%edi),%edx
+ 66d:	83 ec 0c             	sub    $0xc,%esp
+ 670:	6a 00                	push   $0x0
+ 672:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 677:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67a:	e8 a4 fe ff ff       	call   523 <printint>
+        ap++;
+ 67f:	83 c7 04             	add    $0x4,%edi
+ 682:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 685:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 688:	bf 00 00 00 00       	mov    $0x0,%edi
+ 68d:	e9 6e ff ff ff       	jmp    600 <printf+0x45>
+        s = (char*)*ap;
+ 692:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 695:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 697:	83 c1 04             	add    $0x4,%ecx
+ 69a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 69d:	85 c0                	test   %eax,%eax
+ 69f:	74 13                	je     6b4 <printf+0xf9>
+        s = (char*)*ap;
+ 6a1:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 6a3:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 6a6:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 6ab:	84 c0                	test   %al,%al
+ 6ad:	75 0f                	jne    6be <printf+0x103>
+ 6af:	e9 4c ff ff ff       	jmp    600 <printf+0x45>
+          s = "(null)";
+ 6b4:	bb 8f 09 00 00       	mov    $0x98f,%ebx
+        while(*s != 0){
+ 6b9:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 6be:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6c1:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 6c4:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 6c7:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6ca:	83 ec 04             	sub    $0x4,%esp
+ 6cd:	6a 01                	push   $0x1
+ 6cf:	57                   	push   %edi
+ 6d0:	56                   	push   %esi
+ 6d1:	e8 2d fd ff ff       	call   403 <write>
+          s++;
+ 6d6:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 6d9:	0f b6 03             	movzbl (%ebx),%eax
+ 6dc:	83 c4 10             	add    $0x10,%esp
+ 6df:	84 c0                	test   %al,%al
+ 6e1:	75 e4                	jne    6c7 <printf+0x10c>
+      state = 0;
+ 6e3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6e6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6eb:	e9 10 ff ff ff       	jmp    600 <printf+0x45>
+        putc(fd, *ap);
+ 6f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 6f3:	8b 07                	mov    (%edi),%eax
+ 6f5:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f8:	83 ec 04             	sub    $0x4,%esp
+ 6fb:	6a 01                	push   $0x1
+ 6fd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 700:	50                   	push   %eax
+ 701:	ff 75 08             	push   0x8(%ebp)
+ 704:	e8 fa fc ff ff       	call   403 <write>
+        ap++;
+ 709:	83 c7 04             	add    $0x4,%edi
+ 70c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 70f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 712:	bf 00 00 00 00       	mov    $0x0,%edi
+ 717:	e9 e4 fe ff ff       	jmp    600 <printf+0x45>
+        putc(fd, c);
+ 71c:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 71f:	83 ec 04             	sub    $0x4,%esp
+ 722:	6a 01                	push   $0x1
+ 724:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 727:	50                   	push   %eax
+ 728:	ff 75 08             	push   0x8(%ebp)
+ 72b:	e8 d3 fc ff ff       	call   403 <write>
+ 730:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 733:	bf 00 00 00 00       	mov    $0x0,%edi
+ 738:	e9 c3 fe ff ff       	jmp    600 <printf+0x45>
+        putc(fd, '%');
+ 73d:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 741:	83 ec 04             	sub    $0x4,%esp
+ 744:	6a 01                	push   $0x1
+ 746:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 749:	57                   	push   %edi
+ 74a:	ff 75 08             	push   0x8(%ebp)
+ 74d:	e8 b1 fc ff ff       	call   403 <write>
+        putc(fd, c);
+ 752:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 755:	83 c4 0c             	add    $0xc,%esp
+ 758:	6a 01                	push   $0x1
+ 75a:	57                   	push   %edi
+ 75b:	ff 75 08             	push   0x8(%ebp)
+ 75e:	e8 a0 fc ff ff       	call   403 <write>
+        putc(fd, c);
+ 763:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 766:	bf 00 00 00 00       	mov    $0x0,%edi
+ 76b:	e9 90 fe ff ff       	jmp    600 <printf+0x45>
+    }
+  }
+}
+ 770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 773:	5b                   	pop    %ebx
+ 774:	5e                   	pop    %esi
+ 775:	5f                   	pop    %edi
+ 776:	5d                   	pop    %ebp
+ 777:	c3                   	ret
+
+00000778 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 778:	55                   	push   %ebp
+ 779:	89 e5                	mov    %esp,%ebp
+ 77b:	57                   	push   %edi
+ 77c:	56                   	push   %esi
+ 77d:	53                   	push   %ebx
+ 77e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 781:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 784:	a1 c0 0c 00 00       	mov    0xcc0,%eax
+ 789:	eb 0c                	jmp    797 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 78b:	8b 10                	mov    (%eax),%edx
+ 78d:	39 d0                	cmp    %edx,%eax
+ 78f:	72 04                	jb     795 <free+0x1d>
+ 791:	39 d1                	cmp    %edx,%ecx
+ 793:	72 10                	jb     7a5 <free+0x2d>
+{
+ 795:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 797:	39 c8                	cmp    %ecx,%eax
+ 799:	73 f0                	jae    78b <free+0x13>
+ 79b:	8b 10                	mov    (%eax),%edx
+ 79d:	39 d1                	cmp    %edx,%ecx
+ 79f:	72 04                	jb     7a5 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a1:	39 d0                	cmp    %edx,%eax
+ 7a3:	72 f0                	jb     795 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a5:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7a8:	8b 10                	mov    (%eax),%edx
+ 7aa:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ad:	39 fa                	cmp    %edi,%edx
+ 7af:	74 19                	je     7ca <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b1:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7b4:	8b 50 04             	mov    0x4(%eax),%edx
+ 7b7:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 7ba:	39 f1                	cmp    %esi,%ecx
+ 7bc:	74 18                	je     7d6 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7be:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 7c0:	a3 c0 0c 00 00       	mov    %eax,0xcc0
+}
+ 7c5:	5b                   	pop    %ebx
+ 7c6:	5e                   	pop    %esi
+ 7c7:	5f                   	pop    %edi
+ 7c8:	5d                   	pop    %ebp
+ 7c9:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 7ca:	03 72 04             	add    0x4(%edx),%esi
+ 7cd:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d0:	8b 10                	mov    (%eax),%edx
+ 7d2:	8b 12                	mov    (%edx),%edx
+ 7d4:	eb db                	jmp    7b1 <free+0x39>
+    p->s.size += bp->s.size;
+ 7d6:	03 53 fc             	add    -0x4(%ebx),%edx
+ 7d9:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7dc:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7df:	eb dd                	jmp    7be <free+0x46>
+
+000007e1 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7e1:	55                   	push   %ebp
+ 7e2:	89 e5                	mov    %esp,%ebp
+ 7e4:	57                   	push   %edi
+ 7e5:	56                   	push   %esi
+ 7e6:	53                   	push   %ebx
+ 7e7:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ed:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7f0:	c1 eb 03             	shr    $0x3,%ebx
+ 7f3:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7f6:	8b 15 c0 0c 00 00    	mov    0xcc0,%edx
+ 7fc:	85 d2                	test   %edx,%edx
+ 7fe:	74 1c                	je     81c <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 800:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 802:	8b 48 04             	mov    0x4(%eax),%ecx
+ 805:	39 d9                	cmp    %ebx,%ecx
+ 807:	73 38                	jae    841 <malloc+0x60>
+  if(nu < 4096)
+ 809:	be 00 10 00 00       	mov    $0x1000,%esi
+ 80e:	39 f3                	cmp    %esi,%ebx
+ 810:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 813:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 81a:	eb 72                	jmp    88e <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 81c:	c7 05 c0 0c 00 00 c4 	movl   $0xcc4,0xcc0
+ 823:	0c 00 00 
+ 826:	c7 05 c4 0c 00 00 c4 	movl   $0xcc4,0xcc4
+ 82d:	0c 00 00 
+    base.s.size = 0;
+ 830:	c7 05 c8 0c 00 00 00 	movl   $0x0,0xcc8
+ 837:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 83a:	b8 c4 0c 00 00       	mov    $0xcc4,%eax
+    if(p->s.size >= nunits){
+ 83f:	eb c8                	jmp    809 <malloc+0x28>
+      if(p->s.size == nunits)
+ 841:	39 cb                	cmp    %ecx,%ebx
+ 843:	74 1e                	je     863 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 845:	29 d9                	sub    %ebx,%ecx
+ 847:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 84a:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 84d:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 850:	89 15 c0 0c 00 00    	mov    %edx,0xcc0
+      return (void*)(p + 1);
+ 856:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 859:	89 d0                	mov    %edx,%eax
+ 85b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 85e:	5b                   	pop    %ebx
+ 85f:	5e                   	pop    %esi
+ 860:	5f                   	pop    %edi
+ 861:	5d                   	pop    %ebp
+ 862:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 863:	8b 08                	mov    (%eax),%ecx
+ 865:	89 0a                	mov    %ecx,(%edx)
+ 867:	eb e7                	jmp    850 <malloc+0x6f>
+  hp->s.size = nu;
+ 869:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 86c:	83 ec 0c             	sub    $0xc,%esp
+ 86f:	83 c0 08             	add    $0x8,%eax
+ 872:	50                   	push   %eax
+ 873:	e8 00 ff ff ff       	call   778 <free>
+  return freep;
+ 878:	8b 15 c0 0c 00 00    	mov    0xcc0,%edx
+      if((p = morecore(nunits)) == 0)
+ 87e:	83 c4 10             	add    $0x10,%esp
+ 881:	85 d2                	test   %edx,%edx
+ 883:	74 d4                	je     859 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 885:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 887:	8b 48 04             	mov    0x4(%eax),%ecx
+ 88a:	39 d9                	cmp    %ebx,%ecx
+ 88c:	73 b3                	jae    841 <malloc+0x60>
+    if(p == freep)
+ 88e:	89 c2                	mov    %eax,%edx
+ 890:	39 05 c0 0c 00 00    	cmp    %eax,0xcc0
+ 896:	75 ed                	jne    885 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 898:	83 ec 0c             	sub    $0xc,%esp
+ 89b:	57                   	push   %edi
+ 89c:	e8 ca fb ff ff       	call   46b <sbrk>
+  if(p == (char*)-1)
+ 8a1:	83 c4 10             	add    $0x10,%esp
+ 8a4:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8a7:	75 c0                	jne    869 <malloc+0x88>
+        return 0;
+ 8a9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8ae:	eb a9                	jmp    859 <malloc+0x78>
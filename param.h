@@ -7,6 +7,9 @@
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NREGION       4  // max program segments per process
+#define NPCACHE     256  // size of program page cache
+#define KBATCH       32  // pages moved to or from a CPU's free-page cache
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
@@ -0,0 +1,126 @@
+// Program page cache.
+//
+// Holds pages of executable files, keyed by (dev, inum, offset), so
+// that processes running the same program share one copy of its
+// pages instead of each reading its own.  fillpage() maps them
+// copy-on-write; a process that writes to one gets a private copy.
+//
+// The cache keeps one reference to each page it holds, and each
+// mapping holds another (see kref() in kalloc.c), so a page lives on
+// after eviction until its last process lets go of it.  Entries are
+// direct-mapped: a new page evicts whatever held its slot.
+//
+// Interface:
+// * pcget(ip, off) returns the page at off in ip, reading it on a
+//     miss; the caller must hold ip->lock and kfree the page later.
+// * pcinval(ip) drops ip's pages; writei() and itrunc() call it
+//     whenever a file's contents change.  It only searches the
+//     cache if ip->pcached says there may be something to find.
+// * pcheld(dev, inum) says whether pages of an inode may be cached,
+//     for iget() to set pcached when it loads the inode again.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "vmstats.h"
+
+#define PCHASH(dev, inum, off) (((dev)*31 + (inum)*17 + (off)/PGSIZE) % NPCACHE)
+#define PCIHASH(dev, inum) (((dev)*31 + (inum)*17) % NPCACHE)
+
+struct pcent {
+  uint dev;
+  uint inum;
+  uint off;
+  char *page;   // 0 if the slot is empty
+};
+
+struct {
+  struct spinlock lock;
+  struct pcent ent[NPCACHE];
+  ushort nino[NPCACHE];   // Entries held for inodes, by PCIHASH
+} pcache;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Return a referenced page holding PGSIZE bytes of ip at off, or 0
+// if there is no memory or the file is too short.  Caller must hold
+// ip->lock, which also keeps two processes from reading the same
+// page at once.
+char*
+pcget(struct inode *ip, uint off)
+{
+  struct pcent *e;
+  char *mem;
+
+  e = &pcache.ent[PCHASH(ip->dev, ip->inum, off)];
+  acquire(&pcache.lock);
+  if(e->page && e->dev == ip->dev && e->inum == ip->inum && e->off == off){
+    mem = e->page;
+    kref(mem);
+    release(&pcache.lock);
+    __sync_fetch_and_add(&vmstat.textshared, 1);
+    return mem;
+  }
+  release(&pcache.lock);
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  if(readi(ip, mem, off, PGSIZE) != PGSIZE){
+    kfree(mem);
+    return 0;
+  }
+  __sync_fetch_and_add(&vmstat.filefaults, 1);
+
+  acquire(&pcache.lock);
+  if(e->page){
+    kfree(e->page);
+    pcache.nino[PCIHASH(e->dev, e->inum)]--;
+  }
+  pcache.nino[PCIHASH(ip->dev, ip->inum)]++;
+  e->dev = ip->dev;
+  e->inum = ip->inum;
+  e->off = off;
+  e->page = mem;
+  kref(mem);
+  ip->pcached = 1;
+  release(&pcache.lock);
+  return mem;
+}
+
+// Drop every cached page of ip.  Caller must hold ip->lock.
+void
+pcinval(struct inode *ip)
+{
+  struct pcent *e;
+
+  if(!ip->pcached)
+    return;
+  acquire(&pcache.lock);
+  for(e = pcache.ent; e < &pcache.ent[NPCACHE]; e++){
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum){
+      kfree(e->page);
+      e->page = 0;
+      pcache.nino[PCIHASH(e->dev, e->inum)]--;
+    }
+  }
+  ip->pcached = 0;
+  release(&pcache.lock);
+}
+
+// Might the cache hold pages of inode inum on dev?  Pages are only
+// added with the inode locked, so for an inode with no in-memory
+// copy the answer cannot change under the caller.
+int
+pcheld(uint dev, uint inum)
+{
+  return pcache.nino[PCIHASH(dev, inum)] != 0;
+}
@@ -23,6 +23,12 @@ atom_inc(volatile int *num)
   asm volatile ( "lock incl %0" : "=m" (*num));
 }
 
+static inline void
+atom_add(volatile int *num, int n)
+{
+  asm volatile("lock addl %1, %0" : "+m" (*num) : "ir" (n));
+}
+
 static inline void
 lock_inc(uint* mem)
 {
@@ -19,6 +19,22 @@
 #define TPS 1000   // ticks-per-second
 #define SCHED_INTERVAL (TPS/100)  // see trap.c
 
+#ifdef PDX_TICKLESS
+#ifndef CS333_P4
+#error "PDX_TICKLESS needs the CS333_P4 timer heap"
+#endif // CS333_P4
+#define TICKLESS_MAXIDLE TPS  // longest an idle cpu stays halted
+#endif // PDX_TICKLESS
+
+#ifdef PDX_STRIDE
+#ifndef CS333_P4
+#error "PDX_STRIDE replaces the CS333_P4 MLFQ"
+#endif // CS333_P4
+#define STRIDE_SHARES 100       // shares of a uid until setshares()
+#define STRIDE_MAXSHARES 10000
+#define STRIDE_NFIXED 16        // uids that may have setshares() shares
+#endif // PDX_STRIDE
+
 #ifdef CS333_P2
 #define GID 0 // Default GID for first process
 #define UID 0 // Default UID for first process
@@ -29,8 +45,21 @@
 #define TICKS_TO_PROMOTE (1*TPS)
 #define PRIORITY MAXPRIO
 //#define BUDGET 1000
+// Any number of levels works; each run queue keeps one bit per
+// level, so raising MAXPRIO does not slow down picking a process.
 #define MAXPRIO 6
 #define BUDGET 300
+#define TICKS_TO_BALANCE (TPS/10)  // see balanceLists() in proc.c
+#define EDF_MAXUTIL 90  // percent of each cpu deadline tasks may reserve
+#define EDF_MAXPERIOD (1000*TPS)  // keeps EDFUTIL()'s runtime*1000 in a uint
+#define TIMER_SLACK_SHIFT 6  // long sleeps may end up to 1/64th late; see timerDeadline()
+// Default slice for each level: SCHED_INTERVAL at MAXPRIO, doubling
+// per level below it up to 8*SCHED_INTERVAL.  Tunable with schedctl.
+#define QUANTUM(prio) (SCHED_INTERVAL << min(MAXPRIO - (prio), 3))
+#define QUANTUM_MAX (10*TPS)
+// Procs are allocated on demand up to schedctl's maxproc, NPROC at
+// boot; MAXPROC only bounds what maxproc may be raised to.
+#define MAXPROC 4096
 #endif // CS333_P4
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
@@ -6,8 +6,13 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
 #ifdef CS333_P2
 #include "uproc.h"
+#ifdef CS333_P4
+#include "schedctl.h"
+#include "spawn.h"
+#endif // CS333_P4
 #include "pdx.h"
 #endif // CS333_P2
 
@@ -31,17 +36,97 @@ struct ptrs {
 };
 #endif // CS333_P3
 
+#ifdef CS333_P4
+// Each cpu owns a set of MLFQ ready lists with its own lock, so the
+// scheduler can look for work without taking ptable.lock.  Lock
+// order is ptable.lock before rq->lock, and nobody ever holds two
+// rq locks at once.  nready may be read without the lock as a hint.
+// Bit i of readymask is set iff ready[i] is non-empty, so picking
+// the highest non-empty level costs one bsr per word, not a scan.
+#define NREADYMASK (MAXPRIO/32 + 1)
+
+// May p run on cpu (and so wait on run queue) number i?  A deadline
+// task is pinned to the cpu its reservation was admitted on.
+#define ALLOWED(p, i) \
+  ((p)->dl_period ? (p)->dl_cpu == (i) : ((p)->affinity & (1U << (i))) != 0)
+
+#ifdef PDX_STRIDE
+// Stride scheduling: cpu time is divided among uids in proportion to
+// their shares, then evenly among each uid's processes.  A group's
+// pass advances by its stride, STRIDE1/shares, for every tick its
+// processes run, and a process's own pass by STRIDE1; dispatch picks
+// the lowest group pass, then the lowest process pass in that group.
+// Every process waits on ready[0] of its run queue, and there is no
+// priority or promotion.
+#define STRIDE1 (1 << 16)
+#define NGROUP (MAXPROC + STRIDE_NFIXED)
+#define PASSBEFORE(a, b) ((int)((a) - (b)) < 0)
+#define LEVEL(p) 0
+
+struct group {
+  uint uid;
+  uint shares;                 // 0 if the slot is free
+  int fixed;                   // Shares came from setshares()
+  uint stride;
+  uint pass;
+  uint vt;                     // Pass of its last dispatched process
+};
+#else
+#define LEVEL(p) ((p)->priority)
+#endif // PDX_STRIDE
+
+// Share of a cpu, in thousandths, that a deadline task reserves.
+// sys_setdeadline() caps period at EDF_MAXPERIOD so this can't overflow.
+#define EDFUTIL(runtime, period) (((runtime)*1000 + (period)-1) / (period))
+
+// Live pids are indexed by a small hash so kill(), setpriority() and
+// getpriority() don't have to search the table.  Power of two.
+#define NPIDHASH 64
+#define PIDHASH(pid) ((uint)(pid) & (NPIDHASH-1))
+
+// Sleepers are also queued by channel, so a wakeup only looks at
+// procs sleeping on a channel that hashes to the same bucket.
+#define NWAITQ 64
+#define WAITQ(chan) (&ptable.waitq[((uint)(chan) * 2654435761U) >> 26])
 
+struct runq {
+  struct spinlock lock;
+  struct ptrs ready[MAXPRIO+1];
+  uint readymask[NREADYMASK];
+  int nready;
+  uint epoch;                  // Promotions applied to ready[]
+  struct ptrs edf;             // Deadline tasks, earliest deadline first
+  uint edfutil;                // Reserved by tasks pinned here, in 1/1000 cpu
+};
+#endif // CS333_P4
 
 static struct {
   struct spinlock lock;
+#ifdef CS333_P4
+  struct proc *all;                // Every proc carved so far, via p->allnext
+  struct proc *alltail;
+  int nproc;                       // Procs not UNUSED
+#else
   struct proc proc[NPROC];
+#endif // CS333_P4
 #ifdef CS333_P3
   struct ptrs list[statecount];
 #endif // CS333_P3
 #ifdef CS333_P4
-  struct ptrs ready[MAXPRIO+1];
+  struct runq rq[NCPU];
   uint PromoteAtTime;
+  uint BalanceAtTime;
+  uint epoch;                      // Promotions so far; see promoteLists()
+  struct schedparams params;       // See schedctl()
+#ifdef PDX_STRIDE
+  struct group groups[NGROUP];
+  uint stridevt;                   // Pass of the last dispatched group
+#endif // PDX_STRIDE
+  struct proc *pidhash[NPIDHASH];  // Chained through p->pidnext
+  struct ptrs waitq[NWAITQ];       // Linked through p->wqnext/wqprev
+  struct proc *timers[MAXPROC];    // Min-heap on p->wakeat
+  int ntimers;
+  uint nexttimer;                  // timers[0]->wakeat, if ntimers
 #endif // CS333_P4
 } ptable;
 
@@ -55,19 +140,66 @@ static void wakeup1(void* chan);
 #ifdef CS333_P3
 static void initProcessLists(void);
 static void initFreeList(void);
+#ifdef CS333_P4
+static int procgrow(void);
+#endif // CS333_P4
 static void stateListAdd(struct ptrs*, struct proc*);
 static int stateListRemove(struct ptrs*, struct proc* p);
 static void assertState(struct proc *p, enum procstate state);
 #endif // CS333_P3
 
 #ifdef CS333_P4
+#ifndef PDX_STRIDE
 static void promoteLists(void);
+static int nextReady(struct runq*, int);
+#endif // PDX_STRIDE
+static void promote(struct proc*, uint);
+static void catchup(struct proc*);
+static uint curpriority(struct proc*);
+static void balanceLists(void);
+static void readyListAdd(struct runq*, struct proc*);
+static int readyListRemove(struct runq*, struct proc*);
+static void enqueue(struct runq*, struct proc*);
+static struct runq* selectrq(struct proc*);
+static struct proc* dequeue(struct runq*, struct cpu*);
+static struct proc* steal(struct cpu*);
+static struct proc* findproc(int pid);
+static void pidhashAdd(struct proc*);
+static void pidhashRemove(struct proc*);
+static void childAdd(struct proc*, struct proc*);
+static void childRemove(struct proc*);
+static int reap(struct proc*);
+static void waitqAdd(struct proc*);
+static void waitqRemove(struct proc*);
+static void wakeproc(struct proc*);
+static uint timerDeadline(uint);
+static void timerAdd(struct proc*);
+static void timerRemove(struct proc*);
+static void idlecpu(struct cpu*);
+static int outranks(struct proc*, struct proc*);
+static void edfListAdd(struct runq*, struct proc*);
+static void throttle(struct proc*);
+static void edfcharge(struct proc*);
+#ifdef PDX_STRIDE
+static struct group* groupFind(uint);
+static void strideCharge(struct proc*);
+#endif // PDX_STRIDE
+static void kick(struct runq*, struct proc*);
+#ifdef PDX_TICKLESS
+static void tickless(struct cpu*);
+#endif // PDX_TICKLESS
 #endif // CS333_P4
 
 void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+#ifdef CS333_P4
+  for(int i = 0; i < ncpu; i++){
+    initlock(&ptable.rq[i].lock, "runq");
+    cpus[i].rq = &ptable.rq[i];
+  }
+#endif // CS333_P4
 }
 
 // Must be called with interrupts disabled
@@ -123,12 +255,20 @@ allocproc(void)
 
   acquire(&ptable.lock);
 
-#ifdef CS333_P3
+#ifdef CS333_P4
+  if(ptable.nproc >= ptable.params.maxproc ||
+     (ptable.list[UNUSED].head == NULL && procgrow() < 0)){
+    release(&ptable.lock);
+    return 0;
+  }
+  ptable.nproc++;
+#elif CS333_P3
   if(ptable.list[UNUSED].head == NULL){
     release(&ptable.lock);
     return 0;
   }
-
+#endif // CS333_P4
+#ifdef CS333_P3
   p = ptable.list[UNUSED].head;
 
   int rc = stateListRemove(&ptable.list[UNUSED], p);
@@ -152,7 +292,21 @@ allocproc(void)
   }
   p->state = EMBRYO;
 #endif
+#ifdef CS333_P4
+  metabegin(p);
+#endif // CS333_P4
   p->pid = nextpid++;
+#ifdef CS333_P4
+  metaend(p);
+  pidhashAdd(p);
+  p->children = 0;
+  p->nzombie = 0;
+  p->timeridx = -1;
+#ifdef PDX_STRIDE
+  p->group = 0;
+  p->pass = 0;
+#endif // PDX_STRIDE
+#endif // CS333_P4
   release(&ptable.lock);
 
   // Allocate kernel stack.
@@ -163,6 +317,10 @@ allocproc(void)
     int rc = stateListRemove(&ptable.list[EMBRYO],p);
     if(rc < 0)
       panic("Error removing from EMBRYO in allocproc().\n");
+#ifdef CS333_P4
+    pidhashRemove(p);
+    ptable.nproc--;
+#endif // CS333_P4
     
     assertState(p,EMBRYO);
     p->state = UNUSED;
@@ -204,7 +362,11 @@ allocproc(void)
 #ifdef CS333_P4
 //p->priority = MAXPRIO;
   p->priority = PRIORITY;
-  p->budget = BUDGET;
+  p->budget = ptable.params.budget;
+  p->epoch = ptable.epoch;
+  p->affinity = (1U << ncpu) - 1;
+  p->lastcpu = -1;
+  p->dl_runtime = p->dl_period = 0;
 #endif // CS333_P4
 
   return p;
@@ -225,7 +387,13 @@ userinit(void)
   initFreeList();
 
 #ifdef CS333_P4
+  for(int i = 0; i <= MAXPRIO; i++)
+    ptable.params.quantum[i] = QUANTUM(i);
+  ptable.params.budget = BUDGET;
+  ptable.params.promote = TICKS_TO_PROMOTE;
+  ptable.params.maxproc = NPROC;
   ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+  ptable.BalanceAtTime = ticks + TICKS_TO_BALANCE;
 #endif // CS333_P4
 
   release(&ptable.lock);
@@ -263,6 +431,9 @@ userinit(void)
   acquire(&ptable.lock);
 
 #ifdef CS333_P4
+#ifdef PDX_STRIDE
+  p->group = groupFind(p->uid);
+#endif // PDX_STRIDE
 int rc = stateListRemove(&ptable.list[EMBRYO],p);
   if(rc < 0)
     panic("Error removing from EMBRYO in userinit().\n");
@@ -270,7 +441,7 @@ int rc = stateListRemove(&ptable.list[EMBRYO],p);
   assertState(p,EMBRYO);
   p->state = RUNNABLE;
 
-  stateListAdd(&ptable.ready[MAXPRIO],p);
+  enqueue(selectrq(p),p);
 
 #elif CS333_P3
   int rc = stateListRemove(&ptable.list[EMBRYO],p);
@@ -298,8 +469,10 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only reserve the space; pagefault() fills it in when touched.
+    if(sz + n < sz || sz + n >= KERNBASE)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -309,6 +482,28 @@ growproc(int n)
   return 0;
 }
 
+#ifdef CS333_P4
+// Grow current process's memory by at least n bytes of 4MB pages,
+// starting at the next 4MB boundary; the space below that is
+// ordinary heap.  Returns the start of the new pages, or -1.
+int
+growhuge(int n)
+{
+  uint start, sz;
+  struct proc *curproc = myproc();
+
+  start = HUGEROUNDUP(curproc->sz);
+  sz = start + HUGEROUNDUP((uint)n);
+  if(n <= 0 || sz <= start)
+    return -1;
+  if(allochuge(curproc->pgdir, curproc->sz, sz) == 0)
+    return -1;
+  curproc->sz = sz;
+  switchuvm(curproc);
+  return start;
+}
+#endif // CS333_P4
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -336,6 +531,10 @@ fork(void)
     int rc = stateListRemove(&ptable.list[EMBRYO],np);
     if(rc < 0)
       panic("Error removing from EMBRYO in fork().\n");
+#ifdef CS333_P4
+    pidhashRemove(np);
+    ptable.nproc--;
+#endif // CS333_P4
     
     assertState(np,EMBRYO);
 //#ifdef CS333_P4
@@ -356,9 +555,21 @@ fork(void)
   np->uid = curproc->uid;
   np->gid = curproc->gid;
 #endif // CS333_P2
+#ifdef CS333_P4
+  np->affinity = curproc->affinity;
+#endif // CS333_P4
+#ifdef PDX_STRIDE
+  np->group = curproc->group;
+#endif // PDX_STRIDE
 
   np->sz = curproc->sz;
+#ifdef CS333_P4
+  metabegin(np);
+  np->parent = curproc;
+  metaend(np);
+#else
   np->parent = curproc;
+#endif // CS333_P4
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -368,8 +579,19 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  for(i = 0; i < NREGION; i++){
+    np->region[i] = curproc->region[i];
+    if(np->region[i].ip)
+      idupregion(np->region[i].ip);
+  }
 
+#ifdef CS333_P4
+  metabegin(np);
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  metaend(np);
+#else
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+#endif // CS333_P4
 
   pid = np->pid;
 
@@ -382,7 +604,8 @@ fork(void)
     assertState(np,EMBRYO);
     np->state = RUNNABLE;
 
-    stateListAdd(&ptable.ready[MAXPRIO],np);
+    childAdd(curproc, np);
+    enqueue(selectrq(np),np);
 #elif CS333_P3
     int rc = stateListRemove(&ptable.list[EMBRYO],np);
     if(rc < 0)
@@ -426,68 +649,33 @@ exit(void)
   iput(curproc->cwd);
   end_op();
   curproc->cwd = 0;
+  freeregions(curproc->region);
 
   acquire(&ptable.lock);
 
-  // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
-
-  for(int i = 0; i <= MAXPRIO; i++){
-    p = ptable.ready[i].head;
-    while(p != 0){
-      if(p->parent == curproc)
-        p->parent = initproc;
-        
-      p = p->next;
-    }
-  }
-
-  // Searching RUNNABLE list
-  p = ptable.list[RUNNABLE].head;
-  while(p != 0){
-    if(p->parent == curproc)
-      p->parent = initproc;
-
-    p = p->next;
-  }
-
-  // Searching RUNNING list 
-  p = ptable.list[RUNNING].head;
-  while(p != 0){
-    if(p->parent == curproc)
-      p->parent = initproc;
-
-    p = p->next;
-  }
-
-  // Searching ZOMBIE list 
+#ifdef PDX_STRIDE
+  strideCharge(curproc);
+#endif // PDX_STRIDE
 
-        
-  p = ptable.list[ZOMBIE].head;
-  while(p != 0){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      wakeup1(initproc);
-    }
-    p = p->next;
+  // Give back any cpu time reserved with setdeadline().
+  if(curproc->dl_period){
+    ptable.rq[curproc->dl_cpu].edfutil -=
+      EDFUTIL(curproc->dl_runtime, curproc->dl_period);
+    curproc->dl_period = 0;
   }
 
-  // Searching SLEEPING list 
-  p = ptable.list[SLEEPING].head;
-  while(p != 0){
-    if(p->parent == curproc)
-      p->parent = initproc;
+  // Parent might be sleeping in wait().
+  wakeup1(curproc->parent);
 
-    p = p->next;
+  // Pass abandoned children to init.
+  while((p = curproc->children) != 0){
+    childRemove(p);
+    childAdd(initproc, p);
   }
-
-  // Searching EMBRYO list
-  p = ptable.list[EMBRYO].head;
-  while(p != 0){
-    if(p->parent == curproc)
-      p->parent = initproc;
-
-    p = p->next;
+  if(curproc->nzombie){
+    initproc->nzombie += curproc->nzombie;
+    curproc->nzombie = 0;
+    wakeup1(initproc);
   }
 
   // Jump into the scheduler, never to return.
@@ -500,6 +688,11 @@ exit(void)
   
   stateListAdd(&ptable.list[ZOMBIE],curproc);
 
+  // Move to the front of the parent's children, where wait() looks.
+  childRemove(curproc);
+  childAdd(curproc->parent, curproc);
+  curproc->parent->nzombie++;
+
   sched();
   panic("zombie exit");
 }
@@ -526,6 +719,7 @@ exit(void)
   iput(curproc->cwd);
   end_op();
   curproc->cwd = 0;
+  freeregions(curproc->region);
 
   acquire(&ptable.lock);
 
@@ -614,6 +808,7 @@ exit(void)
   iput(curproc->cwd);
   end_op();
   curproc->cwd = 0;
+  freeregions(curproc->region);
 
   acquire(&ptable.lock);
 
@@ -643,99 +838,47 @@ int
 wait(void)
 {
   struct proc *p;
-  int havekids;
-  uint pid;
   struct proc *curproc = myproc();
 
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
-    havekids = 0;
-
-    // Searching RUNNABLE list 
-    p = ptable.list[RUNNABLE].head;
-    while(p != 0){// && !havekids){
-      if(p->parent == curproc)
-      havekids = 1;
-
-      p = p->next;
-    }
-
-    // Searching RUNNING list
-    p = ptable.list[RUNNING].head;
-    while(p != 0){// && !havekids){
-     if(p->parent == curproc)
-       havekids = 1;
-
-      p = p->next;
-    } 
-
-    // Searching SLEEPING list
-    p = ptable.list[SLEEPING].head;
-    while(p != 0){// && !havekids){
-      if(p->parent == curproc)
-        havekids = 1;
-
-     p = p->next;
-    }
-
-    // Searching EMBRYO list
-    p = ptable.list[EMBRYO].head;
-    while(p != 0){// && !havekids){
-     if(p->parent == curproc)
-       havekids = 1;
+    // Zombie children are kept at the front of the list.
+    p = curproc->children;
+    if(p != 0 && p->state == ZOMBIE)
+      return reap(p);
 
-     p = p->next;
+    // No point waiting if we don't have any children.
+    if(p == 0 || curproc->killed){
+      release(&ptable.lock);
+      return -1;
     }
-    for(int i = 0; i <= MAXPRIO; i++){
-    p = ptable.ready[i].head;
-
-    while(p != 0){
-      if(p->parent == curproc)
-        havekids = 1;
 
-      p = p->next;
-      }
-    }
-    // Searching ZOMBIE list
-    p = ptable.list[ZOMBIE].head;
-    while(p != 0){// && !havekids){
-      if(p->parent == curproc){
-        havekids = 1;
-        
-        // Found one.
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
+    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+  }
+}
 
-        int rc = stateListRemove(&ptable.list[ZOMBIE],p);
-        if(rc < 0)
-          panic("Error removing from ZOMBIE in wait().\n");
+// Wait for the child with the given pid to exit and return its pid,
+// or any child if pid is -1.  Return -1 if pid is not our child.
+int
+waitpid(int pid)
+{
+  struct proc *p;
+  struct proc *curproc = myproc();
 
-        assertState(p,ZOMBIE);
-        p->state = UNUSED;
-        stateListAdd(&ptable.list[UNUSED],p);
+  if(pid == -1)
+    return wait();
 
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        release(&ptable.lock);
-        return pid;
-      }
-      p = p->next;
+  acquire(&ptable.lock);
+  for(;;){
+    p = findproc(pid);
+    if(p == 0 || p->parent != curproc || curproc->killed){
+      release(&ptable.lock);
+      return -1;
     }
+    if(p->state == ZOMBIE)
+      return reap(p);
 
-
-
-    // No point waiting if we don't have any children.
-      if(!havekids || curproc->killed){
-        release(&ptable.lock);
-        return -1;
-      }  
-
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -891,6 +1034,12 @@ scheduler(void)
 #ifdef PDX_XV6
   int idle;  // for checking if processor is idle
 #endif // PDX_XV6
+#ifdef PDX_TICKLESS
+  // Every tick while there is a process to run: slices, deadline
+  // budgets and cpu time are all counted in ticks.  Only tickless()
+  // stops it, while idle.
+  lapicsettimer(1, 1);
+#endif // PDX_TICKLESS
 
   for(;;){
     // Enable interrupts on this processor.
@@ -899,62 +1048,66 @@ scheduler(void)
 #ifdef PDX_XV6
     idle = 1;  // assume idle unless we schedule a process
 #endif // PDX_XV6
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
- 
-    // Promote All
-    if(ticks >= ptable.PromoteAtTime){
-     promoteLists();
-     ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
-     //cprintf("Completed Promotion.\n");
-    } // End of Promoting
-
-    for(int i = 0; i <= MAXPRIO; i++){
-      p = ptable.ready[i].head;
-      
-      if(p != 0) {
-        // Switch to chosen process.  It is the process's job
-        // to release ptable.lock and then reacquire it
-        // before jumping back to us.      
-#ifdef PDX_XV6
-        idle = 0;  // not idle this timeslice
-#endif // PDX_XV6
-        c->proc = p;
-        switchuvm(p);
 
-        p = ptable.ready[i].head;
+    // Promotion and load balancing walk every run queue, so only
+    // take ptable.lock when one of them is actually due.
+    if(ticks >= ptable.PromoteAtTime || ticks >= ptable.BalanceAtTime){
+      acquire(&ptable.lock);
+      if(ticks >= ptable.PromoteAtTime){
+#ifndef PDX_STRIDE
+        promoteLists();
+#endif // PDX_STRIDE
+        ptable.PromoteAtTime = ticks + ptable.params.promote;
+      }
+      if(ticks >= ptable.BalanceAtTime){
+        balanceLists();
+        ptable.BalanceAtTime = ticks + TICKS_TO_BALANCE;
+      }
+      release(&ptable.lock);
+    }
+
+    // Look at our own queues first; steal only when they are empty.
+    p = dequeue(c->rq, c);
+    if(p == 0)
+      p = steal(c);
 
-        //cprintf("PID: %d\tPrio: %d",p->pid,p->priority);
-        int rc = stateListRemove(&ptable.ready[i],p);
-        if(rc < 0)
-          panic("Error removing from ready list in scheduler().\n");
+    if(p != 0) {
+      // Switch to chosen process.  It is the process's job
+      // to release ptable.lock and then reacquire it
+      // before jumping back to us.  Taking the lock here also
+      // waits out the cpu that queued p until it is off p's stack.
+      acquire(&ptable.lock);
+      assertState(p,RUNNABLE);
+#ifdef PDX_XV6
+      idle = 0;  // not idle this timeslice
+#endif // PDX_XV6
+      c->proc = p;
+      switchuvm(p);
 
-        assertState(p,RUNNABLE);
 #ifdef CS333_P2
-        p->cpu_ticks_in = ticks;
+      p->cpu_ticks_in = ticks;
 #endif // CS333_P2
-        p->state = RUNNING;
-        stateListAdd(&ptable.list[RUNNING],p);
+      p->state = RUNNING;
+      stateListAdd(&ptable.list[RUNNING],p);
+      p->lastcpu = c - cpus;
+      p->needresched = 0;
+      p->slice = ptable.params.quantum[p->priority];
+      p->dl_stamp = ticks;
 
-        swtch(&(c->scheduler), p->context);
-        switchkvm();
+      swtch(&(c->scheduler), p->context);
+      switchkvm();
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
-        c->proc = 0;
-      }
+      c->proc = 0;
+      release(&ptable.lock);
     }
-    release(&ptable.lock);
 #ifdef PDX_XV6
     // if idle, wait for next interrupt
-    if (idle) {
-      sti();
-      hlt();
-    }
+    if (idle)
+      idlecpu(c);
 #endif // PDX_XV6
-     //cprintf("Main scheduler for loop.\n");
   }
-  //cprintf("Success in Scheduler.\n");
 }
 
 #elif CS333_P3
@@ -1117,22 +1270,38 @@ yield(void)
 
   acquire(&ptable.lock);  //DOC: yieldlock
 
+  curproc->needresched = 0;
+  edfcharge(curproc);
+#ifdef PDX_STRIDE
+  strideCharge(curproc);
+#endif // PDX_STRIDE
+  catchup(curproc);
   curproc->budget = curproc->budget - (ticks - curproc->cpu_ticks_in);
 
   if(curproc->budget <= 0 && curproc->priority > 0 && curproc->priority <= MAXPRIO){
     curproc->priority--;
-    curproc->budget = BUDGET;
+    curproc->budget = ptable.params.budget;
   }
-  release(&ptable.lock);
 
-  acquire(&ptable.lock);
   int rc = stateListRemove(&ptable.list[RUNNING], curproc);
   if(rc < 0)
     panic("Error removing from RUNNING in yield().\n");
 
   assertState(curproc, RUNNING);
+  if(curproc->dl_period && curproc->dl_left <= 0 &&
+     (int)(curproc->dl_deadline - ticks) > 0){
+    // Out of budget: sit out the rest of the period.
+    throttle(curproc);
+    release(&ptable.lock);
+    return;
+  }
   curproc->state = RUNNABLE;
-  stateListAdd(&ptable.ready[curproc->priority],curproc);
+  // Stay on this cpu while its cache is warm; balanceLists() and
+  // idle cpus spread the load if we are not the only one here.
+  if(ALLOWED(curproc, cpuid()))
+    enqueue(mycpu()->rq,curproc);
+  else
+    enqueue(selectrq(curproc),curproc);
 
   sched();
   release(&ptable.lock);
@@ -1214,11 +1383,16 @@ sleep(void *chan, struct spinlock *lk)
   p->chan = chan;
 
 #ifdef CS333_P4
+  edfcharge(p);
+#ifdef PDX_STRIDE
+  strideCharge(p);
+#endif // PDX_STRIDE
+  catchup(p);
   p->budget = p->budget - (ticks - p->cpu_ticks_in);
 
   if(p->budget <= 0 && p->priority > 0 && p->priority <= MAXPRIO){
     p->priority--;
-    p->budget = BUDGET;
+    p->budget = ptable.params.budget;
   }
 #endif // CS333_P4
 
@@ -1229,6 +1403,9 @@ sleep(void *chan, struct spinlock *lk)
   assertState(p, RUNNING);
   p->state = SLEEPING;
   stateListAdd(&ptable.list[SLEEPING],p);
+#ifdef CS333_P4
+  waitqAdd(p);
+#endif // CS333_P4
 
   sched();
 
@@ -1284,31 +1461,58 @@ sleep(void *chan, struct spinlock *lk)
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
-  p = ptable.list[SLEEPING].head;
+  struct proc *p, *next;
+  p = WAITQ(chan)->head;
 
   while(p != 0){
+    next = p->wqnext;
+    if(p->chan == chan)
+      wakeproc(p);
+    p = next;
+  }
+
+}
+
+// Wake the longest sleeper on chan, if any.  For channels where
+// every sleeper wants the same thing, e.g. a sleeplock, waking them
+// all would just put all but one back to sleep.
+void
+wakeupone(void *chan)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = WAITQ(chan)->head; p != 0; p = p->wqnext)
     if(p->chan == chan){
-      int rc = stateListRemove(&ptable.list[SLEEPING], p);
-      if(rc < 0)
-         panic("Error removing from SLEEPING in wakeup1().\n");
+      wakeproc(p);
+      break;
+    }
+  release(&ptable.lock);
+}
 
-      assertState(p, SLEEPING);
-      p->state = RUNNABLE;
-      stateListAdd(&ptable.ready[p->priority],p);
-      }
-      p = p->next;
-  }
+// Move sleeping p to a run queue.  Caller holds ptable.lock.
+static void
+wakeproc(struct proc *p)
+{
+  int rc = stateListRemove(&ptable.list[SLEEPING], p);
+  if(rc < 0)
+     panic("Error removing from SLEEPING in wakeup1().\n");
+  waitqRemove(p);
 
+  assertState(p, SLEEPING);
+  p->state = RUNNABLE;
+  enqueue(selectrq(p),p);
 }
 #elif CS333_P3
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
   p = ptable.list[SLEEPING].head;
 
   while(p != 0){
+    // Moving p to the RUNNABLE list clobbers p->next.
+    next = p->next;
     if(p->chan == chan){
       int rc = stateListRemove(&ptable.list[SLEEPING], p);
       if(rc < 0)
@@ -1317,8 +1521,8 @@ wakeup1(void *chan)
       assertState(p, SLEEPING);
       p->state = RUNNABLE;
       stateListAdd(&ptable.list[RUNNABLE],p);
-      }
-      p = p->next;
+    }
+    p = next;
   }
 
 }
@@ -1343,95 +1547,83 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
-// Kill the process with the given pid.
-// Process won't exit until it returns
-// to user space (see trap in trap.c).
 #ifdef CS333_P4
+// Sleep for n ticks.  The proc sleeps on its own timer, so unlike
+// sleeping on &ticks it is not woken until the deadline passes.
+// Returns -1 if killed.
 int
-kill(int pid)
+sleepticks(int n)
 {
-  struct proc *p;
+  struct proc *p = myproc();
+  int rc;
+
+  if(n <= 0)
+    return p->killed ? -1 : 0;
 
   acquire(&ptable.lock);
-  // Searching RUNNABLE list
-  p = ptable.list[RUNNABLE].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->killed = 1;
-      release(&ptable.lock);
-      return 0;
-      }
-    p = p->next;
-    }
-    for(int i = 0; i <= MAXPRIO; i++){
-      p = ptable.ready[i].head;
+  p->wakeat = timerDeadline(n);
+  timerAdd(p);
+  while(p->timeridx >= 0 && !p->killed)
+    sleep(&p->wakeat, &ptable.lock);
+  if(p->timeridx >= 0)
+    timerRemove(p);
+  rc = p->killed ? -1 : 0;
+  release(&ptable.lock);
+  return rc;
+}
 
-      while(p != 0){
-        if(p->pid == pid){
-         p->killed = 1;
-         release(&ptable.lock);
-         return 0;
-        }
-        p = p->next;
-      }
-    }
+// Called by cpu 0 on every timer tick: wake the sleepers whose
+// deadline has come.  ntimers and nexttimer are read without the
+// lock; a timer added concurrently is at worst seen a tick later.
+void
+timertick(void)
+{
+  struct proc *p;
 
-  // Searching RUNNING list
-  p = ptable.list[RUNNING].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->killed = 1;
-      release(&ptable.lock);
-      return 0;
-    }
-    p = p->next;
-  }
+  if(ptable.ntimers == 0 || (int)(ticks - ptable.nexttimer) < 0)
+    return;
 
-  // Searching ZOMBIE list
-  p = ptable.list[ZOMBIE].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->killed = 1;
-      release(&ptable.lock);
-      return 0;
-    }
-    p = p->next;
+  acquire(&ptable.lock);
+  while(ptable.ntimers > 0 &&
+        (int)(ticks - (p = ptable.timers[0])->wakeat) >= 0){
+    timerRemove(p);
+    // kill() may have woken p already.
+    if(p->state == SLEEPING && p->chan == &p->wakeat)
+      wakeproc(p);
   }
+  release(&ptable.lock);
+}
+#else
+// Without wait queues there is no cheap way to pick one sleeper.
+void
+wakeupone(void *chan)
+{
+  wakeup(chan);
+}
+#endif // CS333_P4
 
-  // Searching SLEEPING list
-  p = ptable.list[SLEEPING].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->killed = 1;
-
-      int rc = stateListRemove(&ptable.list[SLEEPING], p);
-      if(rc < 0)
-         panic("Error removing from SLEEPING in kill().\n");
-
-      assertState(p, SLEEPING);
-      p->state = RUNNABLE;
-      stateListAdd(&ptable.ready[p->priority],p);
-      release(&ptable.lock);
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+#ifdef CS333_P4
+int
+kill(int pid)
+{
+  struct proc *p;
 
-      return 0;
-      }
-    
-    p = p->next;
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0){
+    release(&ptable.lock);
+    return -1;
   }
+  p->killed = 1;
 
-  // Searching EMBRYO list
-  p = ptable.list[EMBRYO].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->killed = 1;
-      release(&ptable.lock);
-      return 0;
-    }
-    p = p->next;
-  }
- 
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+    wakeproc(p);
   release(&ptable.lock);
-  return -1;
+  return 0;
 }
 #elif CS333_P3
 int
@@ -1570,7 +1762,11 @@ procdump(void)
 
   cprintf(HEADER);
 
+#ifdef CS333_P4
+  for(p = ptable.all; p != 0; p = p->allnext){
+#else
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+#endif // CS333_P4
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -1590,217 +1786,1186 @@ procdump(void)
     cprintf("%d\t%s\t%s\t", p->pid,p->name,state);
 #endif
 
-    if(p->state == SLEEPING){
-      getcallerpcs((uint*)p->context->ebp+2, pc);
-      for(i=0; i<10 && pc[i] != 0; i++)
-        cprintf(" %p", pc[i]);
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+  }
+}
+#ifdef CS333_P4
+void
+procdumpP4(struct proc *p,char *state){
+  uint s;
+  uint ms;
+  
+  // Print PID, Name, UID, GID, PPID, PRIO
+  cprintf("%d\t%s\t\t%d\t%d\t%d\t%d\t",p->pid,p->name,p->uid,p->gid,p->parent ? p->parent->pid : p->pid,curpriority(p));
+
+  // Calculate and print Elapsed Time
+  s  = (ticks - p->start_ticks) / 1000;
+  ms = (ticks - p->start_ticks) % 1000;
+
+  if(ms >= 100)
+     cprintf("%d.%d\t",s,ms);
+  else if(ms < 11)
+     cprintf("%d.00%d\t",s,ms);
+  else
+     cprintf("%d.0%d\t",s,ms);
+
+  // Calculate and print CPU Time
+  s  = p->cpu_ticks_total / 1000;
+  ms = p->cpu_ticks_total % 1000;
+
+  if(ms >= 100)
+     cprintf("%d.%d\t",s,ms);
+  else if(ms < 10)
+     cprintf("%d.00%d\t",s,ms);
+  else
+     cprintf("%d.0%d\t",s,ms);
+
+  // Print State, Size
+  cprintf("%s\t%d\t",state,p->sz);
+}
+
+int
+setpriority(int pid, int priority)
+{
+  struct proc *p;
+  struct runq *rq;
+
+  if(pid < 0 || priority < 0 || priority > MAXPRIO)
+    return -1;
+ 
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+
+  // A queued process has to move to its new level.  A RUNNABLE
+  // process with no rq is in flight to a cpu and only needs the
+  // field updated.
+  rq = p->rq;
+  if(rq){
+    acquire(&rq->lock);
+    if(readyListRemove(rq, p) < 0)
+      panic("Error removing from ready list in setpriority().\n");
+    p->priority = priority;
+    readyListAdd(rq, p);
+    release(&rq->lock);
+  } else {
+    p->priority = priority;
+    p->epoch = ptable.epoch;  // Forget any promotions owed
+  }
+  p->budget = ptable.params.budget;
+
+  release(&ptable.lock);
+  return 0;
+}
+
+int
+getpriority(int pid)
+{
+  struct proc *p;
+  int priority;
+
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  priority = curpriority(p);
+  release(&ptable.lock);
+  return priority;
+}
+
+// Make pid a deadline task that needs runtime ticks of cpu in every
+// period ticks, or an ordinary MLFQ process again if period is 0.
+// The reservation is admitted on the least reserved cpu in pid's
+// affinity mask, and pid is pinned there, so no cpu ever has to meet
+// more than EDF_MAXUTIL percent of deadline work.  Fails if that
+// cpu has no room for it.
+int
+setdeadline(int pid, uint runtime, uint period)
+{
+  struct proc *p;
+  struct runq *rq;
+  uint old, new;
+  int i, best = -1;
+
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+
+  old = p->dl_period ? EDFUTIL(p->dl_runtime, p->dl_period) : 0;
+  new = period ? EDFUTIL(runtime, period) : 0;
+  if(old)
+    ptable.rq[p->dl_cpu].edfutil -= old;
+  if(new){
+    for(i = 0; i < ncpu; i++)
+      if((p->affinity & (1U << i)) &&
+         (best < 0 || ptable.rq[i].edfutil < ptable.rq[best].edfutil))
+        best = i;
+    if(ptable.rq[best].edfutil + new > EDF_MAXUTIL * 10){
+      if(old)
+        ptable.rq[p->dl_cpu].edfutil += old;
+      release(&ptable.lock);
+      return -1;
+    }
+    ptable.rq[best].edfutil += new;
+  }
+
+  // A queued process has to move between the EDF and MLFQ lists.
+  rq = p->rq;
+  if(rq){
+    acquire(&rq->lock);
+    if(readyListRemove(rq, p) < 0)
+      panic("Error removing from ready list in setdeadline().\n");
+    release(&rq->lock);
+  }
+  p->dl_runtime = runtime;
+  p->dl_period = period;
+  p->dl_cpu = best;
+  p->dl_deadline = ticks + period;
+  p->dl_left = runtime;
+  p->dl_stamp = ticks;
+  if(rq)
+    enqueue(selectrq(p), p);
+
+  release(&ptable.lock);
+  return 0;
+}
+
+#ifdef PDX_STRIDE
+// The group for uid, set up with default shares if it has none.
+// A group nobody set shares for is recycled once no live process
+// has its uid.  Caller holds ptable.lock.
+static struct group*
+groupFind(uint uid)
+{
+  struct group *g, *slot = 0;
+  struct proc *p;
+
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++){
+    if(g->shares && g->uid == uid)
+      return g;
+    if(g->shares == 0 && slot == 0)
+      slot = g;
+  }
+  for(g = ptable.groups; slot == 0 && g < &ptable.groups[NGROUP]; g++){
+    if(g->fixed)
+      continue;
+    for(p = ptable.all; p != 0; p = p->allnext)
+      if(p->state != UNUSED && p->uid == g->uid)
+        break;
+    if(p == 0)
+      slot = g;
+  }
+  // At most STRIDE_NFIXED groups are fixed and at most MAXPROC uids
+  // are live, so there is always a slot.
+  if(slot == 0)
+    panic("groupFind");
+  slot->uid = uid;
+  slot->shares = STRIDE_SHARES;
+  slot->fixed = 0;
+  slot->stride = STRIDE1 / STRIDE_SHARES;
+  slot->pass = ptable.stridevt;
+  slot->vt = 0;
+  return slot;
+}
+
+// Advance the passes of p and its group for the ticks p has just
+// run, counting at least one.  Caller holds ptable.lock.
+static void
+strideCharge(struct proc *p)
+{
+  uint used = ticks - p->cpu_ticks_in;
+
+  if(p->group == 0)
+    return;
+  if(used == 0)
+    used = 1;
+  p->group->pass += used * p->group->stride;
+  p->pass += used * STRIDE1;
+}
+
+// Give uid n shares of the cpu, relative to the other uids.
+int
+setshares(uint uid, uint n)
+{
+  struct group *g;
+  int nfixed = 0;
+
+  if(n < 1 || n > STRIDE_MAXSHARES)
+    return -1;
+
+  acquire(&ptable.lock);
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++)
+    if(g->fixed)
+      nfixed++;
+  g = groupFind(uid);
+  if(!g->fixed && nfixed == STRIDE_NFIXED){
+    release(&ptable.lock);
+    return -1;
+  }
+  g->fixed = 1;
+  g->shares = n;
+  g->stride = STRIDE1 / n;
+  release(&ptable.lock);
+  return 0;
+}
+
+int
+getshares(uint uid)
+{
+  struct group *g;
+  int n = STRIDE_SHARES;
+
+  acquire(&ptable.lock);
+  for(g = ptable.groups; g < &ptable.groups[NGROUP]; g++)
+    if(g->shares && g->uid == uid)
+      n = g->shares;
+  release(&ptable.lock);
+  return n;
+}
+#endif // PDX_STRIDE
+
+// Start path as a new child of the current process without copying
+// the current process's memory: the child's image is built straight
+// from the ELF file, as exec() would.  The child gets the current
+// process's open files, rearranged by the actions in fa (see
+// spawn.h).  Returns the child's pid, or -1.
+int
+spawn(char *path, char **argv, struct spawnfd *fa)
+{
+  int i, n;
+  uint pid;
+  char open[NOFILE];
+  struct file *f;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  // Check the actions up front so nothing needs undoing later.
+  for(i = 0; i < NOFILE; i++)
+    open[i] = curproc->ofile[i] != 0;
+  for(n = 0; n < SPAWN_MAXFD && fa[n].op != SPAWN_END; n++){
+    if(fa[n].fd < 0 || fa[n].fd >= NOFILE)
+      return -1;
+    switch(fa[n].op){
+    case SPAWN_DUP2:
+      if(fa[n].newfd < 0 || fa[n].newfd >= NOFILE || !open[fa[n].fd])
+        return -1;
+      open[fa[n].newfd] = 1;
+      break;
+    case SPAWN_CLOSE:
+      open[fa[n].fd] = 0;
+      break;
+    default:
+      return -1;
+    }
+  }
+
+  if((np = allocproc()) == 0)
+    return -1;
+
+  *np->tf = *curproc->tf;  // Segment registers and eflags
+  if(execload(path, argv, &np->pgdir, &np->sz, np->region, np->tf) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    acquire(&ptable.lock);
+    if(stateListRemove(&ptable.list[EMBRYO],np) < 0)
+      panic("Error removing from EMBRYO in spawn().\n");
+    pidhashRemove(np);
+    ptable.nproc--;
+    assertState(np,EMBRYO);
+    np->state = UNUSED;
+    stateListAdd(&ptable.list[UNUSED],np);
+    release(&ptable.lock);
+    return -1;
+  }
+
+  np->uid = curproc->uid;
+  np->gid = curproc->gid;
+  np->affinity = curproc->affinity;
+#ifdef PDX_STRIDE
+  np->group = curproc->group;
+#endif // PDX_STRIDE
+  metabegin(np);
+  np->parent = curproc;
+  metaend(np);
+
+  for(i = 0; i < NOFILE; i++)
+    if(curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  for(i = 0; i < n; i++){
+    if(fa[i].op == SPAWN_CLOSE){
+      f = np->ofile[fa[i].fd];
+      np->ofile[fa[i].fd] = 0;
+    } else if(fa[i].newfd != fa[i].fd){
+      f = np->ofile[fa[i].newfd];
+      np->ofile[fa[i].newfd] = filedup(np->ofile[fa[i].fd]);
+    } else
+      continue;
+    if(f)
+      fileclose(f);
+  }
+  np->cwd = idup(curproc->cwd);
+
+  metabegin(np);
+  safestrcpy(np->name, execname(path), sizeof(np->name));
+  metaend(np);
+
+  pid = np->pid;
+  acquire(&ptable.lock);
+  if(stateListRemove(&ptable.list[EMBRYO],np) < 0)
+    panic("Error removing from EMBRYO in spawn().\n");
+  assertState(np,EMBRYO);
+  np->state = RUNNABLE;
+  childAdd(curproc, np);
+  enqueue(selectrq(np),np);
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Copy the scheduler tunables out to sp (SCHED_GET) or in from it
+// (SCHED_SET).  New quanta take effect at each process's next
+// dispatch, a new promotion interval at the next promotion.  A
+// lower maxproc only stops new processes.
+int
+schedctl(int cmd, struct schedparams *sp)
+{
+  int i;
+
+  switch(cmd){
+  case SCHED_GET:
+    acquire(&ptable.lock);
+    *sp = ptable.params;
+    release(&ptable.lock);
+    return 0;
+  case SCHED_SET:
+    for(i = 0; i <= MAXPRIO; i++)
+      if(sp->quantum[i] < 1 || sp->quantum[i] > QUANTUM_MAX)
+        return -1;
+    if(sp->budget < 1 || sp->promote < 1 ||
+       sp->maxproc < 1 || sp->maxproc > MAXPROC)
+      return -1;
+    acquire(&ptable.lock);
+    ptable.params = *sp;
+    if(ptable.PromoteAtTime - ticks > sp->promote)
+      ptable.PromoteAtTime = ticks + sp->promote;
+    release(&ptable.lock);
+    return 0;
+  }
+  return -1;
+}
+
+// Restrict pid to the cpus in mask, bit i standing for cpu i.  A
+// queued process moves to an allowed cpu now; a running one does
+// when it next yields or wakes up.  A deadline task stays pinned to
+// its reservation's cpu, which mask must include.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+  struct runq *rq;
+  int move;
+
+  mask &= (1U << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0 || (p->dl_period && !(mask & (1U << p->dl_cpu)))){
+    release(&ptable.lock);
+    return -1;
+  }
+
+  // Change the mask under the rq lock too, since steal() reads it.
+  rq = p->rq;
+  if(rq){
+    acquire(&rq->lock);
+    p->affinity = mask;
+    move = !ALLOWED(p, rq - ptable.rq);
+    if(move && readyListRemove(rq, p) < 0)
+      panic("Error removing from ready list in setaffinity().\n");
+    release(&rq->lock);
+    if(move)
+      enqueue(selectrq(p), p);
+  } else
+    p->affinity = mask;
+
+  release(&ptable.lock);
+  return 0;
+}
+
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  if(p == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  mask = p->affinity;
+  release(&ptable.lock);
+  return mask;
+}
+
+#ifndef PDX_STRIDE
+// Move every process up one priority level and refill its budget,
+// in time independent of the number of processes.  Each run queue's
+// lists move up one level wholesale, level MAXPRIO-1 joining the end
+// of MAXPRIO, and the epochs advance.  Everyone else owes the
+// promotion until catchup() next looks at it.  Caller holds
+// ptable.lock.
+static void
+promoteLists(void)
+{
+  struct runq *rq;
+  struct ptrs *top, *below;
+  int i;
+
+  for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+    acquire(&rq->lock);
+    top = &rq->ready[MAXPRIO];
+    below = &rq->ready[MAXPRIO-1];
+    if(MAXPRIO > 0 && below->head){
+      if(top->head){
+        top->tail->next = below->head;
+        below->head->prev = top->tail;
+        top->tail = below->tail;
+      } else
+        *top = *below;
+    }
+    for(i = MAXPRIO-1; i > 0; i--)
+      rq->ready[i] = rq->ready[i-1];
+    if(MAXPRIO > 0)
+      rq->ready[0].head = rq->ready[0].tail = NULL;
+    for(i = 0; i < NREADYMASK; i++)
+      rq->readymask[i] = 0;
+    for(i = 0; i <= MAXPRIO; i++)
+      if(rq->ready[i].head)
+        rq->readymask[i/32] |= 1U << (i%32);
+    rq->epoch++;
+    release(&rq->lock);
+  }
+  ptable.epoch++;
+}
+#endif // PDX_STRIDE
+
+// Apply the promotions p has missed between p->epoch and epoch.
+static void
+promote(struct proc *p, uint epoch)
+{
+  uint owed = epoch - p->epoch;
+
+  if(owed && p->priority < MAXPRIO){
+    if(owed >= MAXPRIO - p->priority)
+      p->priority = MAXPRIO;
+    else
+      p->priority += owed;
+    p->budget = ptable.params.budget;
+  }
+  p->epoch = epoch;
+}
+
+// Bring a process that is not on a run queue up to date.
+// Caller holds ptable.lock.
+static void
+catchup(struct proc *p)
+{
+  promote(p, ptable.epoch);
+}
+
+// A priority counting the promotions owed since pepoch, as of
+// promotion epoch epoch.
+static uint
+owedpriority(uint priority, uint pepoch, uint epoch)
+{
+  uint owed = epoch - pepoch;
+
+  if(owed >= MAXPRIO - priority)
+    return MAXPRIO;
+  return priority + owed;
+}
+
+// p's priority counting promotions it is still owed, without
+// changing p.  Caller holds ptable.lock, so no promotion is under
+// way and every rq->epoch equals ptable.epoch.
+static uint
+curpriority(struct proc *p)
+{
+  return owedpriority(p->priority, p->epoch, ptable.epoch);
+}
+
+// Even out run queue lengths by moving processes from the longest
+// queue to the shortest until they differ by at most one.  Moves
+// the lowest-priority, most recently queued process allowed on the
+// shortest queue's cpu, which is the one least likely to still have
+// a warm cache.  Caller holds
+// ptable.lock, which keeps the moved process safe while it is
+// between queues.
+static void
+balanceLists(void)
+{
+  struct runq *rq, *busiest, *idlest;
+  struct proc *p;
+  int i;
+
+  for(int moved = 0; moved < ptable.nproc; moved++){
+    busiest = idlest = ptable.rq;
+    for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+      if(rq->nready > busiest->nready)
+        busiest = rq;
+      if(rq->nready < idlest->nready)
+        idlest = rq;
+    }
+    if(busiest->nready - idlest->nready < 2)
+      return;
+
+    p = 0;
+    acquire(&busiest->lock);
+    for(i = 0; i <= MAXPRIO && p == 0; i++)
+      for(p = busiest->ready[i].tail; p != 0; p = p->prev)
+        if(ALLOWED(p, idlest - ptable.rq))
+          break;
+    if(p && readyListRemove(busiest, p) < 0)
+      panic("Error removing from ready list in balanceLists().\n");
+    release(&busiest->lock);
+    if(p == 0)
+      return;
+    enqueue(idlest, p);
+  }
+}
+
+// Add p to the ready list for its priority on rq.
+// Caller holds rq->lock.
+static void
+readyListAdd(struct runq *rq, struct proc *p)
+{
+  assertState(p, RUNNABLE);
+  catchup(p);
+  if(p->dl_period)
+    edfListAdd(rq, p);
+  else {
+#ifdef PDX_STRIDE
+    // Don't let a group or process bank credit while it waits.
+    // p->group is set with the uid, by userinit(), fork() and setuid().
+    if(PASSBEFORE(p->group->pass, ptable.stridevt))
+      p->group->pass = ptable.stridevt;
+    if(PASSBEFORE(p->pass, p->group->vt))
+      p->pass = p->group->vt;
+#endif // PDX_STRIDE
+    stateListAdd(&rq->ready[LEVEL(p)], p);
+    rq->readymask[LEVEL(p)/32] |= 1U << (LEVEL(p)%32);
+  }
+  p->rq = rq;
+  rq->nready++;
+}
+
+// Caller holds rq->lock.
+static int
+readyListRemove(struct runq *rq, struct proc *p)
+{
+  if(p->rq != rq)
+    return -1;
+  if(p->list == &rq->edf){
+    if(stateListRemove(&rq->edf, p) < 0)
+      return -1;
+    p->rq = 0;
+    rq->nready--;
+    return 0;
+  }
+#ifndef PDX_STRIDE
+  // The lists may have moved up since p was queued, leaving p->list
+  // stale; p's priority after the promotions it missed says where
+  // it is now.
+  promote(p, rq->epoch);
+  p->list = &rq->ready[p->priority];
+#endif // PDX_STRIDE
+  if(stateListRemove(&rq->ready[LEVEL(p)], p) < 0)
+    return -1;
+  if(rq->ready[LEVEL(p)].head == NULL)
+    rq->readymask[LEVEL(p)/32] &= ~(1U << (LEVEL(p)%32));
+  p->rq = 0;
+  rq->nready--;
+  return 0;
+}
+
+#ifndef PDX_STRIDE
+// Highest priority level below level with a process queued on rq,
+// or -1.  Caller holds rq->lock.
+static int
+nextReady(struct runq *rq, int level)
+{
+  uint m;
+  int i;
+
+  if(level <= 0)
+    return -1;
+  level--;
+  i = level/32;
+  m = rq->readymask[i] & ((2U << (level%32)) - 1);
+  for(;;){
+    if(m)
+      return i*32 + bsr(m);
+    if(--i < 0)
+      return -1;
+    m = rq->readymask[i];
+  }
+}
+#endif // PDX_STRIDE
+
+// Caller holds ptable.lock.
+static void
+enqueue(struct runq *rq, struct proc *p)
+{
+  acquire(&rq->lock);
+  readyListAdd(rq, p);
+  release(&rq->lock);
+  kick(rq, p);
+}
+
+// Should p preempt q?  Deadline tasks beat everything else, and the
+// earlier deadline wins between them.  Caller holds ptable.lock.
+static int
+outranks(struct proc *p, struct proc *q)
+{
+  if(p->dl_period && q->dl_period)
+    return (int)(p->dl_deadline - q->dl_deadline) < 0;
+  if(p->dl_period || q->dl_period)
+    return p->dl_period != 0;
+#ifdef PDX_STRIDE
+  return 0;  // Shares are evened out over time, not by preempting
+#else
+  return curpriority(p) > curpriority(q);
+#endif // PDX_STRIDE
+}
+
+// Queue deadline task p on rq in deadline order, starting a new
+// period with a full budget if the last one is over.
+// Caller holds rq->lock.
+static void
+edfListAdd(struct runq *rq, struct proc *p)
+{
+  struct proc *q;
+
+  if((int)(ticks - p->dl_deadline) >= 0){
+    p->dl_deadline = ticks + p->dl_period;
+    p->dl_left = p->dl_runtime;
+  }
+  for(q = rq->edf.head; q != 0; q = q->next)
+    if((int)(p->dl_deadline - q->dl_deadline) < 0)
+      break;
+  if(q == 0){
+    stateListAdd(&rq->edf, p);
+    return;
+  }
+  p->next = q;
+  p->prev = q->prev;
+  if(q->prev)
+    q->prev->next = p;
+  else
+    rq->edf.head = p;
+  q->prev = p;
+  p->list = &rq->edf;
+}
+
+// Park deadline task p, which has used up its budget, until its
+// next period starts.  p has been taken off the RUNNING list.
+// Caller holds ptable.lock.
+static void
+throttle(struct proc *p)
+{
+  p->chan = &p->wakeat;
+  p->wakeat = p->dl_deadline;
+  timerAdd(p);
+  p->state = SLEEPING;
+  stateListAdd(&ptable.list[SLEEPING],p);
+  waitqAdd(p);
+
+  sched();
+
+  p->chan = 0;
+  if(p->timeridx >= 0)
+    timerRemove(p);
+}
+
+// Charge running deadline task p for the cpu it has used since it
+// was last charged, and have it yield once the budget for this
+// period is gone.  Caller holds ptable.lock, which setdeadline()
+// also holds to change p's budget.
+static void
+edfcharge(struct proc *p)
+{
+  if(p->dl_period == 0)
+    return;
+  p->dl_left -= ticks - p->dl_stamp;
+  p->dl_stamp = ticks;
+  if(p->dl_left <= 0)
+    p->needresched = 1;
+}
+
+// Timer interrupt: charge the running process p if it is a deadline
+// task.  The unlocked look at dl_period keeps ordinary processes off
+// ptable.lock; one that setdeadline() just changed is charged from
+// its next tick.
+void
+edftick(struct proc *p)
+{
+  if(p->dl_period == 0)
+    return;
+  acquire(&ptable.lock);
+  edfcharge(p);
+  release(&ptable.lock);
+}
+
+// p was just queued on rq.  Make sure rq's cpu notices: wake it if
+// it is halted, or, if p outranks what it is running, have it
+// reschedule on its way out of the interrupt.  If it is busy, a
+// tickless cpu could steal p; wake one of those instead, since it
+// may not look again for TICKLESS_MAXIDLE.  Caller holds ptable.lock.
+static void
+kick(struct runq *rq, struct proc *p)
+{
+  struct cpu *c = &cpus[rq - ptable.rq];
+  struct proc *cur = c->proc;
+#ifdef PDX_TICKLESS
+  struct cpu *idle;
+#endif // PDX_TICKLESS
+
+  if(cur){
+    if(!outranks(p, cur)){
+#ifdef PDX_TICKLESS
+      for(idle = cpus; idle < &cpus[ncpu]; idle++)
+        if(idle != c && idle->tickless && ALLOWED(p, idle - cpus)){
+          if(idle != mycpu())
+            lapicipi(idle->apicid, T_IRQ0 + IRQ_RESCHED);
+          break;
+        }
+#endif // PDX_TICKLESS
+      return;
+    }
+    cur->needresched = 1;
+  } else if(!c->halted)
+    return;  // In the scheduler loop; it will look at rq
+  if(c != mycpu())
+    lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Pick a run queue for p, which just became runnable: the shortest
+// one on a cpu p may use, preferring the cpu p last ran on, then
+// this one, on a tie.  The lengths are read without locks; a stale
+// answer only costs some balance.  Caller holds ptable.lock.
+static struct runq*
+selectrq(struct proc *p)
+{
+  struct runq *best = 0;
+  int i;
+
+  if(p->lastcpu >= 0 && ALLOWED(p, p->lastcpu))
+    best = &ptable.rq[p->lastcpu];
+  else if(ALLOWED(p, cpuid()))
+    best = mycpu()->rq;
+  for(i = 0; i < ncpu; i++)
+    if(ALLOWED(p, i) && (best == 0 || ptable.rq[i].nready < best->nready))
+      best = &ptable.rq[i];
+  return best;
+}
+
+// Remove and return the deadline task with the earliest deadline,
+// else the highest-priority process, on rq that may run on c, or 0.  Everything on c's own queue may; only a steal
+// has to look past the head.
+static struct proc*
+dequeue(struct runq *rq, struct cpu *c)
+{
+  struct proc *p = 0;
+#ifdef PDX_STRIDE
+  struct proc *q;
+#else
+  int i;
+#endif // PDX_STRIDE
+
+  if(rq->nready == 0)
+    return 0;
+  acquire(&rq->lock);
+  // Deadline tasks come before every MLFQ level.
+  for(p = rq->edf.head; p != 0; p = p->next)
+    if(ALLOWED(p, c - cpus))
+      break;
+#ifdef PDX_STRIDE
+  // The virtual times are only a floor for newly runnable work, so
+  // updating them under rq->lock alone is good enough.
+  if(p == 0){
+    for(q = rq->ready[0].head; q != 0; q = q->next){
+      if(!ALLOWED(q, c - cpus))
+        continue;
+      if(p == 0 || PASSBEFORE(q->group->pass, p->group->pass) ||
+         (q->group == p->group && PASSBEFORE(q->pass, p->pass)))
+        p = q;
+    }
+    if(p){
+      ptable.stridevt = p->group->pass;
+      p->group->vt = p->pass;
+    }
+  }
+#else
+  // Only levels with something queued, highest first.
+  for(i = nextReady(rq, MAXPRIO+1); i >= 0 && p == 0; i = nextReady(rq, i))
+    for(p = rq->ready[i].head; p != 0; p = p->next)
+      if(ALLOWED(p, c - cpus))
+        break;
+#endif // PDX_STRIDE
+  if(p && readyListRemove(rq, p) < 0)
+    panic("Error removing from ready list in dequeue().\n");
+  release(&rq->lock);
+  return p;
+}
+
+// Take the next process from the longest other run queue.
+static struct proc*
+steal(struct cpu *c)
+{
+  struct runq *rq, *victim = 0;
+
+  for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++)
+    if(rq != c->rq && rq->nready > 0 &&
+       (victim == 0 || rq->nready > victim->nready))
+      victim = rq;
+  if(victim == 0)
+    return 0;
+  return dequeue(victim, c);
+}
+
+// Look up a live process by pid.  Caller holds ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Index p under its pid from allocproc() until it is freed.
+// Caller holds ptable.lock.
+static void
+pidhashAdd(struct proc *p)
+{
+  struct proc **pp = &ptable.pidhash[PIDHASH(p->pid)];
+
+  p->pidnext = *pp;
+  *pp = p;
+}
+
+// Caller holds ptable.lock.
+static void
+pidhashRemove(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext)
+    if(*pp == p){
+      *pp = p->pidnext;
+      p->pidnext = 0;
+      return;
     }
-    cprintf("\n");
-  }
+  panic("pidhashRemove");
 }
-#ifdef CS333_P4
-void
-procdumpP4(struct proc *p,char *state){
-  uint s;
-  uint ms;
-  
-  // Print PID, Name, UID, GID, PPID, PRIO
-  cprintf("%d\t%s\t\t%d\t%d\t%d\t%d\t",p->pid,p->name,p->uid,p->gid,p->parent ? p->parent->pid : p->pid,p->priority);
 
-  // Calculate and print Elapsed Time
-  s  = (ticks - p->start_ticks) / 1000;
-  ms = (ticks - p->start_ticks) % 1000;
+// Each proc's children are doubly linked through sibnext/sibprev,
+// with zombies ahead of live children so wait() finds one at the
+// head.  nzombie counts the zombies.  Caller holds ptable.lock.
+static void
+childAdd(struct proc *parent, struct proc *p)
+{
+  struct proc *prev = 0, *next = parent->children;
 
-  if(ms >= 100)
-     cprintf("%d.%d\t",s,ms);
-  else if(ms < 11)
-     cprintf("%d.00%d\t",s,ms);
+  if(p->state != ZOMBIE)
+    while(next && next->state == ZOMBIE){
+      prev = next;
+      next = next->sibnext;
+    }
+  metabegin(p);
+  p->parent = parent;
+  metaend(p);
+  p->sibprev = prev;
+  p->sibnext = next;
+  if(prev)
+    prev->sibnext = p;
   else
-     cprintf("%d.0%d\t",s,ms);
-
-  // Calculate and print CPU Time
-  s  = p->cpu_ticks_total / 1000;
-  ms = p->cpu_ticks_total % 1000;
+    parent->children = p;
+  if(next)
+    next->sibprev = p;
+}
 
-  if(ms >= 100)
-     cprintf("%d.%d\t",s,ms);
-  else if(ms < 10)
-     cprintf("%d.00%d\t",s,ms);
+// Caller holds ptable.lock.
+static void
+childRemove(struct proc *p)
+{
+  if(p->sibprev)
+    p->sibprev->sibnext = p->sibnext;
   else
-     cprintf("%d.0%d\t",s,ms);
+    p->parent->children = p->sibnext;
+  if(p->sibnext)
+    p->sibnext->sibprev = p->sibprev;
+  p->sibnext = 0;
+  p->sibprev = 0;
+}
 
-  // Print State, Size
-  cprintf("%s\t%d\t",state,p->sz);
+// Free zombie child p and return its pid.
+// Called with ptable.lock held; releases it.
+static int
+reap(struct proc *p)
+{
+  int pid;
+
+  pid = p->pid;
+  kfree(p->kstack);
+  p->kstack = 0;
+  freevm(p->pgdir);
+
+  int rc = stateListRemove(&ptable.list[ZOMBIE],p);
+  if(rc < 0)
+    panic("Error removing from ZOMBIE in wait().\n");
+
+  assertState(p,ZOMBIE);
+  p->state = UNUSED;
+  stateListAdd(&ptable.list[UNUSED],p);
+
+  childRemove(p);
+  p->parent->nzombie--;
+  pidhashRemove(p);
+  ptable.nproc--;
+  metabegin(p);
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  metaend(p);
+  p->killed = 0;
+  release(&ptable.lock);
+  return pid;
 }
 
-int
-setpriority(int pid, int priority)
+// Append sleeping p to the wait queue for p->chan.
+// Caller holds ptable.lock.
+static void
+waitqAdd(struct proc *p)
 {
-  struct proc *p;
+  struct ptrs *q = WAITQ(p->chan);
 
-  if(pid < 0 || priority < 0 || priority > MAXPRIO)
-    return -1;
- 
-  acquire(&ptable.lock);
-  for(int i = 0; i < MAXPRIO; i++){
-    p = ptable.ready[i].head;
-    
-    while(p != 0){
-      if(p->pid == pid){
-        p->priority = priority;
-        p->budget = BUDGET;
-
-        if(priority != i){
-          int rc = stateListRemove(&ptable.ready[i], p);
-          if(rc < 0)
-            panic("Error removing from ready list in setpriority().\n");
-
-          assertState(p, RUNNABLE);
-          p->state = RUNNABLE;
-          stateListAdd(&ptable.ready[priority+1],p);
-          //stateListAdd(&ptable.ready[priority],p);
-        }
-        release(&ptable.lock);
-        return 0;
-      }
-      p = p->next;
-    }
-  }
+  p->wqnext = 0;
+  p->wqprev = q->tail;
+  if(q->head == 0)
+    q->head = p;
+  else
+    q->tail->wqnext = p;
+  q->tail = p;
+}
 
-  p = ptable.list[RUNNING].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->priority = priority;
-      p->budget = BUDGET;
-      release(&ptable.lock);
-      
-      return 0;
-    }
-    p = p->next;
-  }
+// Caller holds ptable.lock.
+static void
+waitqRemove(struct proc *p)
+{
+  struct ptrs *q = WAITQ(p->chan);
 
-  p = ptable.list[SLEEPING].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->priority = priority;
-      p->budget = BUDGET;
-      release(&ptable.lock);
-      
-      return 0;
-    }
-    p = p->next;
+  if(p->wqprev)
+    p->wqprev->wqnext = p->wqnext;
+  else
+    q->head = p->wqnext;
+  if(p->wqnext)
+    p->wqnext->wqprev = p->wqprev;
+  else
+    q->tail = p->wqprev;
+  p->wqnext = 0;
+  p->wqprev = 0;
+}
+
+// Nothing to run: halt until an interrupt.  c->halted tells kick()
+// that work queued here needs an IPI to be noticed.  It is set before
+// the last look at the run queue, so either we see the new work or
+// kick() sees the flag.
+static void
+idlecpu(struct cpu *c)
+{
+  cli();
+  c->halted = 1;
+  __sync_synchronize();
+  if(c->rq->nready == 0){
+#ifdef PDX_TICKLESS
+    tickless(c);
+#else
+    sti();
+    hlt();  // sti takes effect after hlt, so no interrupt is lost
+    cli();
+#endif // PDX_TICKLESS
   }
+  c->halted = 0;
+  sti();
+}
 
-  p = ptable.list[ZOMBIE].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->priority = priority;
-      p->budget = BUDGET;
-      release(&ptable.lock);
-      
-      return 0;
+#ifdef PDX_TICKLESS
+// Called by idlecpu() with interrupts off.  Stop the periodic timer and
+// halt until an interrupt or the next sleepticks() deadline; kick()
+// sends an IPI when there is work.  c->tickless is set before looking
+// for work on other run queues, so either kick() sees the flag or we
+// see the work and keep ticking, to try stealing it.  Cpu 0 keeps
+// ticks, so it only stops ticking once every other cpu is halted too,
+// and then brings ticks up to date from the time it was halted.  A
+// cpu that leaves idle while cpu 0 is not ticking wakes cpu 0 up.
+static void
+tickless(struct cpu *c)
+{
+  uint n = TICKLESS_MAXIDLE;
+  uint elapsed;
+  struct cpu *other;
+  int left;
+
+  c->tickless = 1;
+  __sync_synchronize();
+  for(other = cpus; other < &cpus[ncpu]; other++)
+    if(other != c && other->rq->nready > 0)
+      break;
+  if(other < &cpus[ncpu]){
+    c->tickless = 0;
+    sti();
+    hlt();
+    cli();
+    return;
+  }
+  if(c == &cpus[0]){
+    for(other = cpus; other < &cpus[ncpu]; other++)
+      if(!other->halted)
+        break;
+    if(ptable.ntimers){
+      left = ptable.nexttimer - ticks;
+      if(left <= 0)
+        n = 0;
+      else if((uint)left < n)
+        n = left;
+    }
+    if(other < &cpus[ncpu] || n == 0){
+      c->tickless = 0;
+      sti();
+      hlt();
+      cli();
+      return;
     }
-    p = p->next;
   }
-
-  p = ptable.list[EMBRYO].head;
-  while(p != 0){
-    if(p->pid == pid){
-      p->priority = priority;
-      p->budget = BUDGET;
-      release(&ptable.lock);
-      
-      return 0;
+  lapicsettimer(n, 0);
+  sti();
+  hlt();
+  cli();
+  c->tickless = 0;
+  elapsed = lapicelapsed(&c->tickfrac);
+  lapicsettimer(1, 1);
+  if(c == &cpus[0]){
+    if(elapsed){
+      atom_add((int *)&ticks, elapsed);
+      timertick();
     }
-    p = p->next;
+  } else {
+    c->halted = 0;
+    __sync_synchronize();
+    if(cpus[0].tickless)
+      lapicipi(cpus[0].apicid, T_IRQ0 + IRQ_RESCHED);
   }
-  release(&ptable.lock);
-  return -1;
 }
+#endif // PDX_TICKLESS
 
-int
-getpriority(int pid)
+// Absolute tick a sleep of n ticks should end on.  Long sleeps are
+// rounded up to a coarser boundary so that timers which fall close
+// together expire, and are woken, on the same tick.
+static uint
+timerDeadline(uint n)
 {
-  struct proc *p;
-  int priority;
+  uint when = ticks + n;
+  uint slack;
 
-  acquire(&ptable.lock);
-  // Search through RUNNING 
-  p = ptable.list[RUNNING].head;
-  while(p != 0){
-    if(p->pid == pid){
-      priority = p->priority;
-      release(&ptable.lock);
-      return priority;
-    }
-    p = p->next;
-  }
-  // Search through SLEEPING
-  p = ptable.list[SLEEPING].head;
-  while(p != 0){
-    if(p->pid == pid){
-      priority = p->priority;
-      release(&ptable.lock);
-      return priority;
-    }
-    p = p->next;
-  }
+  if(n < (2 << TIMER_SLACK_SHIFT))
+    return when;
+  slack = 1 << (bsr(n) - TIMER_SLACK_SHIFT);
+  return (when + slack - 1) & ~(slack - 1);
+}
 
-  // Search through ready lists
-  for(int i = 0; i<= MAXPRIO; i++){
-    p = ptable.ready[i].head;
-    while(p != 0){
-      if(p->pid == pid){
-        priority = p->priority;
-        release(&ptable.lock);
-        return priority;
-      }
-      p = p->next;
-    }
-  }
-  release(&ptable.lock);
-  return -1;
+// Deadlines are compared as (int)(a - b) so they survive ticks
+// wrapping.  Caller holds ptable.lock for all the timer routines.
+#define TIMERBEFORE(a, b) ((int)((a)->wakeat - (b)->wakeat) < 0)
+
+static void
+timerSet(int i, struct proc *p)
+{
+  ptable.timers[i] = p;
+  p->timeridx = i;
 }
 
-void
-promoteLists(void)
+static void
+timerUp(int i)
 {
-  struct proc *p;
+  struct proc *p = ptable.timers[i];
 
-  p = ptable.list[RUNNING].head;
-    while(p != 0){
-      if(p->priority < MAXPRIO && p->priority >=0){
-        p->priority++;
-        p->budget = BUDGET;
-      }
-      p = p->next;
-    }
+  while(i > 0 && TIMERBEFORE(p, ptable.timers[(i-1)/2])){
+    timerSet(i, ptable.timers[(i-1)/2]);
+    i = (i-1)/2;
+  }
+  timerSet(i, p);
+}
 
-    p = ptable.list[SLEEPING].head;
-    while(p != 0){
-      if(p->priority < MAXPRIO && p->priority >= 0){
-        p->priority++;
-        p->budget = BUDGET;
-      }
-      p = p->next;
-    }
+static void
+timerDown(int i)
+{
+  struct proc *p = ptable.timers[i];
+  int c;
 
-    for(int i = 0; i < MAXPRIO; i++){
-      p = ptable.ready[i].head;
-      while(p != 0){
-        int rc = stateListRemove(&ptable.ready[i], p);
-        if(rc < 0)
-          panic("Error removing from ready list in Scheduler().\n");
+  while((c = 2*i + 1) < ptable.ntimers){
+    if(c+1 < ptable.ntimers && TIMERBEFORE(ptable.timers[c+1], ptable.timers[c]))
+      c++;
+    if(!TIMERBEFORE(ptable.timers[c], p))
+      break;
+    timerSet(i, ptable.timers[c]);
+    i = c;
+  }
+  timerSet(i, p);
+}
 
-        assertState(p, RUNNABLE);
-        p->state = RUNNABLE;
-        stateListAdd(&ptable.ready[i+1],p);
+static void
+timerAdd(struct proc *p)
+{
+  timerSet(ptable.ntimers++, p);
+  timerUp(p->timeridx);
+  ptable.nexttimer = ptable.timers[0]->wakeat;
+}
 
-        p->priority++;
-        p->budget = BUDGET;
-        p = p->next;
-      }
-    }
+static void
+timerRemove(struct proc *p)
+{
+  int i = p->timeridx;
+  struct proc *last;
+
+  p->timeridx = -1;
+  if(i != --ptable.ntimers){
+    last = ptable.timers[ptable.ntimers];
+    timerSet(i, last);
+    timerUp(i);
+    timerDown(last->timeridx);
+  }
+  if(ptable.ntimers > 0)
+    ptable.nexttimer = ptable.timers[0]->wakeat;
 }
 #endif // CS333_P4
 
@@ -1822,22 +2987,27 @@ infodump(char input)
     //if(p == 0)
     //    cprintf("Ready List Empty\n");
 
-      for(int i = MAXPRIO; i >= 0; i--){
-        p = ptable.ready[i].head;
-      
-        cprintf("%d: ",i);
+      for(int c = 0; c < ncpu; c++){
+        struct runq *rq = &ptable.rq[c];
 
-        while(p != 0){
-          cprintf("(%d, %d)",p->pid,p->budget);
+        acquire(&rq->lock);
+        cprintf("cpu%d:\n",c);
+        for(int i = MAXPRIO; i >= 0; i--){
+          p = rq->ready[i].head;
 
-          if(p->next)  
-            cprintf(" -> ");
-          else
-            cprintf("\n");
+          cprintf("%d: ",i);
 
-        p = p->next;
+          while(p != 0){
+            cprintf("(%d, %d)",p->pid,p->budget);
+
+            if(p->next)
+              cprintf(" -> ");
+
+            p = p->next;
+          }
+          cprintf("\n");
         }
-      cprintf("\n");
+        release(&rq->lock);
       }
       release(&ptable.lock);
       break;
@@ -2018,64 +3188,41 @@ infodump(char input)
 #endif // End of if/else for infodump
 
 #ifdef CS333_P3
+// The state lists are doubly linked through p->next and p->prev, and
+// p->list names the list p is on, so removal never has to walk.
 static void
 stateListAdd(struct ptrs* list, struct proc* p)
 {
-  if((*list).head == NULL){
+  p->next = NULL;
+  p->prev = (*list).tail;
+  if((*list).head == NULL)
     (*list).head = p;
-    (*list).tail = p;
-    p->next = NULL;
-  } else {
+  else
     ((*list).tail)->next = p;
-    (*list).tail = ((*list).tail)->next;
-    ((*list).tail)->next = NULL;
-  }
+  (*list).tail = p;
+  p->list = list;
 }
 
 static int 
 stateListRemove(struct ptrs* list, struct proc* p)
 {
-  if((*list).head == NULL || (*list).tail == NULL || p == NULL){
-    return -1;
-  }
-
-  struct proc* current = (*list).head;
-  struct proc* previous = 0;
-
-  if(current == p){
-    (*list).head = ((*list).head)->next;
-    // prevent tail remaining assigned when we've removed the only item
-    // on the list
-    if((*list).tail == p){
-      (*list).tail = NULL;
-    }
-    return 0;
-  }
-
-  while(current){
-    if(current == p){
-      break;
-    }
-
-    previous = current;
-    current = current->next;
-  }
-
-  // Process not found, hit eject.
-  if(current == NULL){
+  if(p == NULL || p->list != list){
     return -1;
   }
 
-  // Process found. Set the appropriate next pointer.
-  if(current == (*list).tail){
-    (*list).tail = previous;
-    ((*list).tail)->next = NULL;
-  } else {
-    previous->next = current->next;
-  }
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    (*list).head = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+  else
+    (*list).tail = p->prev;
 
-  // Make sure p->next doesn't point into the list.
+  // Make sure p doesn't point into the list.
   p->next = NULL;
+  p->prev = NULL;
+  p->list = NULL;
 
   return 0;
 }
@@ -2090,13 +3237,59 @@ initProcessLists()
     ptable.list[i].tail = NULL;
   }
 #ifdef CS333_P4
-  for(i = 0; i <= MAXPRIO; i++){
-    ptable.ready[i].head = NULL;
-    ptable.ready[i].tail = NULL;
+  for(int c = 0; c < NCPU; c++){
+    for(i = 0; i <= MAXPRIO; i++){
+      ptable.rq[c].ready[i].head = NULL;
+      ptable.rq[c].ready[i].tail = NULL;
+    }
+    for(i = 0; i < NREADYMASK; i++)
+      ptable.rq[c].readymask[i] = 0;
+    ptable.rq[c].nready = 0;
+    ptable.rq[c].epoch = ptable.epoch;
+    ptable.rq[c].edf.head = NULL;
+    ptable.rq[c].edf.tail = NULL;
+  }
+  for(i = 0; i < NWAITQ; i++){
+    ptable.waitq[i].head = NULL;
+    ptable.waitq[i].tail = NULL;
   }
 #endif // CS333_P4
 }
 
+#ifdef CS333_P4
+// struct procs come from whole pages, carved up as allocproc() runs
+// out, so the table costs nothing until it is used.  The procs in a
+// page go on the UNUSED list and are never freed again, which keeps
+// a proc pointer valid for lock-free readers such as getprocs().
+// Caller holds ptable.lock.
+static int
+procgrow(void)
+{
+  struct proc *p, *page;
+
+  if((page = (struct proc*)kalloc()) == 0)
+    return -1;
+  memset(page, 0, PGSIZE);
+  for(p = page; p < page + PGSIZE/sizeof(struct proc); p++){
+    p->state = UNUSED;
+    stateListAdd(&ptable.list[UNUSED], p);
+    __sync_synchronize();  // p is ready before readers can find it
+    if(ptable.alltail)
+      ptable.alltail->allnext = p;
+    else
+      ptable.all = p;
+    ptable.alltail = p;
+  }
+  return 0;
+}
+
+static void
+initFreeList(void)
+{
+  ptable.all = ptable.alltail = 0;
+  ptable.nproc = 0;
+}
+#else
 static void
 initFreeList(void)
 {
@@ -2107,6 +3300,7 @@ initFreeList(void)
     stateListAdd(&ptable.list[UNUSED], p);
   }
 }
+#endif // CS333_P4
 
 static void
 assertState(struct proc* p, enum procstate state)
@@ -2154,6 +3348,80 @@ procdumpP2(struct proc *p,char *state)
   cprintf("%s\t%d\t",state,p->sz);
 }
 
+#ifdef CS333_P4
+// Copy a snapshot of the process table into table without taking
+// ptable.lock, so a busy ps does not hold up the scheduler.  Each
+// slot is read like a seqlock: a copy that overlapped a change to
+// the slot's identity (see metabegin()) is thrown away and retried.
+// The other fields are single words and may each be a little stale.
+int
+getprocs(uint max, struct uproc* table)
+{
+  struct proc *p, *pp;
+  struct uproc u;
+  uint seq, prio, pepoch, epoch;
+  int proc_num = 0;
+
+  for(p = ptable.all; p != 0 && proc_num < max; p = p->allnext){
+    do {
+      while((seq = p->seq) & 1)
+        ;
+      __sync_synchronize();
+      u.state = p->state;
+      u.pid = p->pid;
+      u.uid = p->uid;
+      u.gid = p->gid;
+      pp = p->parent;
+      u.ppid = pp ? pp->pid : u.pid;
+      u.elapsed_ticks = ticks - p->start_ticks;
+      u.CPU_total_ticks = p->cpu_ticks_total;
+      u.size = p->sz;
+      // Not curpriority(), which needs ptable.lock; a promotion
+      // racing with this copy only makes the answer one step stale.
+      prio = p->priority;
+      pepoch = p->epoch;
+      epoch = ptable.epoch;
+      u.lastcpu = p->lastcpu;
+      u.affinity = p->affinity;
+      safestrcpy(u.name, p->name, sizeof(p->name));
+      __sync_synchronize();
+    } while(p->seq != seq);
+    u.priority = owedpriority(prio, pepoch, epoch);
+
+    if(u.state != UNUSED && u.state != EMBRYO)
+      table[proc_num++] = u;
+  }
+
+  if(proc_num == 0)
+    return -1;
+
+  return proc_num;
+}
+
+// Bracket a change to p's pid, parent or name, which getprocs()
+// reads without ptable.lock.  An odd seq also shuts out other
+// writers, such as a reparent racing exec() renaming the child, so
+// the bracket must not be held across a lock or a sleep.
+void
+metabegin(struct proc *p)
+{
+  uint seq;
+
+  pushcli();
+  do {
+    while((seq = p->seq) & 1)
+      ;
+  } while(!__sync_bool_compare_and_swap(&p->seq, seq, seq + 1));
+}
+
+void
+metaend(struct proc *p)
+{
+  __sync_synchronize();
+  p->seq++;
+  popcli();
+}
+#else
 int
 getprocs(uint max, struct uproc* table)
 {
@@ -2178,9 +3446,6 @@ getprocs(uint max, struct uproc* table)
       table[proc_num].size = p->sz;
       safestrcpy(table[proc_num].state,states[p->state],STRMAX);
       safestrcpy(table[proc_num].name,p->name,STRMAX);
-#ifdef CS333_P4
-      table[proc_num].priority = p->priority;
-#endif // CS333_P4
 
       proc_num++;
     }
@@ -2193,6 +3458,22 @@ getprocs(uint max, struct uproc* table)
 
   return proc_num;
 }
+#endif // CS333_P4
+
+// Give the current process a new uid, moving it to that uid's stride
+// group so the scheduler never has to look the group up.
+void
+setuid(uint uid)
+{
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  curproc->uid = uid;
+#ifdef PDX_STRIDE
+  curproc->group = groupFind(uid);
+#endif // PDX_STRIDE
+  release(&ptable.lock);
+}
 #endif //CS333_P2
 
 
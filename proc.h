@@ -8,6 +8,14 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+#ifdef CS333_P4
+  struct runq *rq;             // This cpu's MLFQ ready lists (see proc.c)
+  volatile int halted;         // Idle; needs an IPI to see new work
+#endif // CS333_P4
+#ifdef PDX_TICKLESS
+  volatile int tickless;       // Timer is in one-shot mode (see tickless())
+  uint tickfrac;               // Timer counts short of a whole tick
+#endif // PDX_TICKLESS
 };
 
 extern struct cpu cpus[NCPU];
@@ -34,6 +42,16 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// Part of a process's memory backed by its program file: pages
+// are read in when first touched; see fillpage() in vm.c.
+struct vmregion {
+  struct inode *ip;            // 0 if the slot is unused
+  uint va;                     // Page-aligned start
+  uint filesz;                 // Bytes from the file; zeroes after
+  uint memsz;
+  uint off;                    // File offset of va
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -49,6 +67,7 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  struct vmregion region[NREGION];  // Program segments
   
 #ifdef CS333_P1
   uint start_ticks;
@@ -64,11 +83,40 @@ struct proc {
 
 #ifdef CS333_P3
   struct proc *next;
+  struct proc *prev;
+  struct ptrs *list;           // State list p is on, or 0
 #endif // CS333_P3
 
 #ifdef CS333_P4
   uint priority;
   int budget;
+  uint epoch;                  // Promotions priority reflects; see promoteLists()
+  uint affinity;               // Cpus p may run on, bit i for cpu i
+  int lastcpu;                 // Cpu p last ran on, or -1
+  volatile int needresched;    // Yield at the end of the current trap
+  uint dl_runtime;             // Deadline task: cpu ticks needed ...
+  uint dl_period;              // ... every dl_period ticks, or 0
+  uint dl_deadline;            // End of the current period
+  int dl_left;                 // Runtime left in the current period
+  uint dl_stamp;               // Tick dl_left was last charged
+  int dl_cpu;                  // Cpu the reservation is pinned to
+  uint slice;                  // Ticks to run from cpu_ticks_in
+  struct proc *allnext;        // Next in ptable.all; see procgrow()
+  volatile uint seq;           // Odd while pid/parent/name change; see getprocs()
+#ifdef PDX_STRIDE
+  struct group *group;         // Stride group for uid (see proc.c)
+  uint pass;
+#endif // PDX_STRIDE
+  struct runq *rq;             // Run queue p is waiting on, or 0
+  struct proc *pidnext;        // Next in ptable.pidhash chain
+  struct proc *children;       // First child; zombies come first
+  struct proc *sibnext;        // Siblings in parent->children
+  struct proc *sibprev;
+  int nzombie;                 // Zombie children not yet reaped
+  struct proc *wqnext;         // Wait queue for chan while SLEEPING
+  struct proc *wqprev;
+  uint wakeat;                 // Tick sleepticks() ends, if timeridx >= 0
+  int timeridx;                // Index in ptable.timers, or -1
 #endif // CS333_P4
 };
 
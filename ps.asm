@@ -0,0 +1,1572 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+};
+#endif // CS333_P4
+
+int
+main(int argc, char * argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 60             	sub    $0x60,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int max = 16;
+#ifdef CS333_P4
+  struct schedparams sp;
+
+  // Room for every process the table may hold right now.
+  if(schedctl(SCHED_GET, &sp) == 0)
+  19:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  1c:	50                   	push   %eax
+  1d:	6a 00                	push   $0x0
+  1f:	e8 5f 06 00 00       	call   683 <schedctl>
+  24:	83 c4 10             	add    $0x10,%esp
+  int max = 16;
+  27:	bb 10 00 00 00       	mov    $0x10,%ebx
+  if(schedctl(SCHED_GET, &sp) == 0)
+  2c:	85 c0                	test   %eax,%eax
+  2e:	75 03                	jne    33 <main+0x33>
+    max = sp.maxproc;
+  30:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+#endif // CS333_P4
+
+  if(argc > 1)
+  33:	83 fe 01             	cmp    $0x1,%esi
+  36:	7f 56                	jg     8e <main+0x8e>
+    max = atoi(argv[1]);
+
+  struct uproc * table = malloc(sizeof(*table)*max);
+  38:	83 ec 0c             	sub    $0xc,%esp
+  3b:	6b c3 4c             	imul   $0x4c,%ebx,%eax
+  3e:	50                   	push   %eax
+  3f:	e8 2d 09 00 00       	call   971 <malloc>
+  44:	89 45 b0             	mov    %eax,-0x50(%ebp)
+
+  if(table == 0){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	74 52                	je     a0 <main+0xa0>
+    printf(1,"unable to make table \n");
+    exit();
+  }
+
+  int num_procs = getprocs(max, table);
+  4e:	83 ec 08             	sub    $0x8,%esp
+  51:	8b 7d b0             	mov    -0x50(%ebp),%edi
+  54:	57                   	push   %edi
+  55:	53                   	push   %ebx
+  56:	e8 f0 05 00 00       	call   64b <getprocs>
+  5b:	89 c6                	mov    %eax,%esi
+  5d:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  uint s;
+  uint ms;
+#ifdef CS333_P4
+  printf(1, "PID\tName\tUID\tGID\tPPID\tPrio\tElapsed\tCPU\tState\tSize\tCore\tMask\n");
+  60:	83 c4 08             	add    $0x8,%esp
+  63:	68 cc 0a 00 00       	push   $0xacc
+  68:	6a 01                	push   $0x1
+  6a:	e8 dc 06 00 00       	call   74b <printf>
+#elif CS333_P2
+  printf(1, "PID\tName\tUID\tGID\tPPID\tElapsed\tCPU\tState\tSize\n");
+#endif
+
+  for(int i =0; i < num_procs; i++){
+  6f:	83 c4 10             	add    $0x10,%esp
+  72:	85 f6                	test   %esi,%esi
+  74:	0f 8e 74 02 00 00    	jle    2ee <main+0x2ee>
+  7a:	8d 5f 2c             	lea    0x2c(%edi),%ebx
+  7d:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+    // Print PID, Name, UID, GID, PPID
+    printf(1, "%d\t%s\t%d\t%d\t%d\t", table[i].pid, table[i].name, table[i].uid, table[i].gid, table[i].ppid);
+#endif // End of if/else for output
+
+    // Calculate Elapsed time
+    s  = table[i].elapsed_ticks / 1000;
+  84:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+  89:	e9 da 00 00 00       	jmp    168 <main+0x168>
+    max = atoi(argv[1]);
+  8e:	83 ec 0c             	sub    $0xc,%esp
+  91:	ff 77 04             	push   0x4(%edi)
+  94:	e8 cd 03 00 00       	call   466 <atoi>
+  99:	89 c3                	mov    %eax,%ebx
+  9b:	83 c4 10             	add    $0x10,%esp
+  9e:	eb 98                	jmp    38 <main+0x38>
+    printf(1,"unable to make table \n");
+  a0:	83 ec 08             	sub    $0x8,%esp
+  a3:	68 40 0a 00 00       	push   $0xa40
+  a8:	6a 01                	push   $0x1
+  aa:	e8 9c 06 00 00       	call   74b <printf>
+    exit();
+  af:	e8 bf 04 00 00       	call   573 <exit>
+    ms = table[i].elapsed_ticks % 1000;
+
+    if(ms >= 100)
+      printf(1, "%d.%d\t",s,ms);
+  b4:	51                   	push   %ecx
+  b5:	52                   	push   %edx
+  b6:	68 6a 0a 00 00       	push   $0xa6a
+  bb:	6a 01                	push   $0x1
+  bd:	e8 89 06 00 00       	call   74b <printf>
+  c2:	83 c4 10             	add    $0x10,%esp
+  c5:	e9 f4 00 00 00       	jmp    1be <main+0x1be>
+    else if(ms < 10)
+      printf(1, "%d.00%d\t",s,ms);
+    else
+      printf(1, "%d.0%d\t",s,ms);
+  ca:	51                   	push   %ecx
+  cb:	52                   	push   %edx
+  cc:	68 7a 0a 00 00       	push   $0xa7a
+  d1:	6a 01                	push   $0x1
+  d3:	e8 73 06 00 00       	call   74b <printf>
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	e9 de 00 00 00       	jmp    1be <main+0x1be>
+    // Calculate CPU time
+    s  = table[i].CPU_total_ticks / 1000;
+    ms = table[i].CPU_total_ticks % 1000;
+    
+    if(ms >= 100)
+      printf(1, "%d.%d\t",s,ms);
+  e0:	51                   	push   %ecx
+  e1:	52                   	push   %edx
+  e2:	68 6a 0a 00 00       	push   $0xa6a
+  e7:	6a 01                	push   $0x1
+  e9:	e8 5d 06 00 00       	call   74b <printf>
+  ee:	83 c4 10             	add    $0x10,%esp
+  f1:	eb 11                	jmp    104 <main+0x104>
+    else if(ms < 10)
+      printf(1, "%d.00%d\t",s,ms);
+    else
+      printf(1, "%d.0%d\t",s,ms);
+  f3:	51                   	push   %ecx
+  f4:	52                   	push   %edx
+  f5:	68 7a 0a 00 00       	push   $0xa7a
+  fa:	6a 01                	push   $0x1
+  fc:	e8 4a 06 00 00       	call   74b <printf>
+ 101:	83 c4 10             	add    $0x10,%esp
+
+    // Print state, size
+#ifdef CS333_P4
+    printf(1, "%s\t%d\t", states[table[i].state],table[i].size);
+ 104:	ff 77 fc             	push   -0x4(%edi)
+ 107:	8b 47 f8             	mov    -0x8(%edi),%eax
+ 10a:	ff 34 85 0c 0b 00 00 	push   0xb0c(,%eax,4)
+ 111:	68 82 0a 00 00       	push   $0xa82
+ 116:	6a 01                	push   $0x1
+ 118:	e8 2e 06 00 00       	call   74b <printf>
+
+    // Print the cpu it last ran on and the cpus it may run on
+    if(table[i].lastcpu < 0)
+ 11d:	8b 47 e8             	mov    -0x18(%edi),%eax
+ 120:	83 c4 10             	add    $0x10,%esp
+ 123:	85 c0                	test   %eax,%eax
+ 125:	0f 88 cd 00 00 00    	js     1f8 <main+0x1f8>
+      printf(1, "-\t");
+    else
+      printf(1, "%d\t", table[i].lastcpu);
+ 12b:	83 ec 04             	sub    $0x4,%esp
+ 12e:	50                   	push   %eax
+ 12f:	68 66 0a 00 00       	push   $0xa66
+ 134:	6a 01                	push   $0x1
+ 136:	e8 10 06 00 00       	call   74b <printf>
+ 13b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "0x%x\n", table[i].affinity);
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	ff 77 ec             	push   -0x14(%edi)
+ 144:	68 8c 0a 00 00       	push   $0xa8c
+ 149:	6a 01                	push   $0x1
+ 14b:	e8 fb 05 00 00       	call   74b <printf>
+  for(int i =0; i < num_procs; i++){
+ 150:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 153:	83 c0 01             	add    $0x1,%eax
+ 156:	83 c3 4c             	add    $0x4c,%ebx
+ 159:	83 c4 10             	add    $0x10,%esp
+ 15c:	39 45 ac             	cmp    %eax,-0x54(%ebp)
+ 15f:	0f 84 aa 00 00 00    	je     20f <main+0x20f>
+ 165:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d\t", table[i].pid, table[i].name, table[i].uid, table[i].gid, table[i].ppid, table[i].priority);
+ 168:	89 df                	mov    %ebx,%edi
+ 16a:	ff 73 e4             	push   -0x1c(%ebx)
+ 16d:	ff 73 e0             	push   -0x20(%ebx)
+ 170:	ff 73 dc             	push   -0x24(%ebx)
+ 173:	ff 73 d8             	push   -0x28(%ebx)
+ 176:	53                   	push   %ebx
+ 177:	ff 73 d4             	push   -0x2c(%ebx)
+ 17a:	68 57 0a 00 00       	push   $0xa57
+ 17f:	6a 01                	push   $0x1
+ 181:	e8 c5 05 00 00       	call   74b <printf>
+    s  = table[i].elapsed_ticks / 1000;
+ 186:	8b 4b f0             	mov    -0x10(%ebx),%ecx
+ 189:	89 c8                	mov    %ecx,%eax
+ 18b:	f7 e6                	mul    %esi
+ 18d:	c1 ea 06             	shr    $0x6,%edx
+    ms = table[i].elapsed_ticks % 1000;
+ 190:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+ 196:	29 c1                	sub    %eax,%ecx
+    if(ms >= 100)
+ 198:	83 c4 20             	add    $0x20,%esp
+ 19b:	83 f9 63             	cmp    $0x63,%ecx
+ 19e:	0f 87 10 ff ff ff    	ja     b4 <main+0xb4>
+    else if(ms < 10)
+ 1a4:	83 f9 09             	cmp    $0x9,%ecx
+ 1a7:	0f 87 1d ff ff ff    	ja     ca <main+0xca>
+      printf(1, "%d.00%d\t",s,ms);
+ 1ad:	51                   	push   %ecx
+ 1ae:	52                   	push   %edx
+ 1af:	68 71 0a 00 00       	push   $0xa71
+ 1b4:	6a 01                	push   $0x1
+ 1b6:	e8 90 05 00 00       	call   74b <printf>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+    s  = table[i].CPU_total_ticks / 1000;
+ 1be:	8b 4f f4             	mov    -0xc(%edi),%ecx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	f7 e6                	mul    %esi
+ 1c5:	c1 ea 06             	shr    $0x6,%edx
+    ms = table[i].CPU_total_ticks % 1000;
+ 1c8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+ 1ce:	29 c1                	sub    %eax,%ecx
+    if(ms >= 100)
+ 1d0:	83 f9 63             	cmp    $0x63,%ecx
+ 1d3:	0f 87 07 ff ff ff    	ja     e0 <main+0xe0>
+    else if(ms < 10)
+ 1d9:	83 f9 09             	cmp    $0x9,%ecx
+ 1dc:	0f 87 11 ff ff ff    	ja     f3 <main+0xf3>
+      printf(1, "%d.00%d\t",s,ms);
+ 1e2:	51                   	push   %ecx
+ 1e3:	52                   	push   %edx
+ 1e4:	68 71 0a 00 00       	push   $0xa71
+ 1e9:	6a 01                	push   $0x1
+ 1eb:	e8 5b 05 00 00       	call   74b <printf>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	e9 0c ff ff ff       	jmp    104 <main+0x104>
+      printf(1, "-\t");
+ 1f8:	83 ec 08             	sub    $0x8,%esp
+ 1fb:	68 89 0a 00 00       	push   $0xa89
+ 200:	6a 01                	push   $0x1
+ 202:	e8 44 05 00 00       	call   74b <printf>
+ 207:	83 c4 10             	add    $0x10,%esp
+ 20a:	e9 2f ff ff ff       	jmp    13e <main+0x13e>
+ 20f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  // Each uid's shares and the fraction of the listed cpu time its
+  // processes got, to check against the shares.
+  uint total = 0, used;
+  int j;
+
+  for(int i = 0; i < num_procs; i++)
+ 212:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+ 215:	89 df                	mov    %ebx,%edi
+ 217:	6b f0 4c             	imul   $0x4c,%eax,%esi
+ 21a:	89 d8                	mov    %ebx,%eax
+ 21c:	01 de                	add    %ebx,%esi
+  uint total = 0, used;
+ 21e:	ba 00 00 00 00       	mov    $0x0,%edx
+    total += table[i].CPU_total_ticks;
+ 223:	03 50 20             	add    0x20(%eax),%edx
+  for(int i = 0; i < num_procs; i++)
+ 226:	83 c0 4c             	add    $0x4c,%eax
+ 229:	39 f0                	cmp    %esi,%eax
+ 22b:	75 f6                	jne    223 <main+0x223>
+  printf(1, "\nUID\tShares\tCPU%%\n");
+ 22d:	89 55 a8             	mov    %edx,-0x58(%ebp)
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	68 92 0a 00 00       	push   $0xa92
+ 238:	6a 01                	push   $0x1
+ 23a:	e8 0c 05 00 00       	call   74b <printf>
+ 23f:	83 c4 10             	add    $0x10,%esp
+  for(int i = 0; i < num_procs; i++){
+ 242:	bb 00 00 00 00       	mov    $0x0,%ebx
+      continue;
+    used = 0;
+    for(j = i; j < num_procs; j++)
+      if(table[j].uid == table[i].uid)
+        used += table[j].CPU_total_ticks;
+    printf(1, "%d\t%d\t%d\n", table[i].uid, getshares(table[i].uid),
+ 247:	8b 45 a8             	mov    -0x58(%ebp),%eax
+ 24a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+ 24d:	eb 15                	jmp    264 <main+0x264>
+    if(j < i)
+ 24f:	39 d8                	cmp    %ebx,%eax
+ 251:	7d 31                	jge    284 <main+0x284>
+  for(int i = 0; i < num_procs; i++){
+ 253:	8d 43 01             	lea    0x1(%ebx),%eax
+ 256:	83 c7 4c             	add    $0x4c,%edi
+ 259:	39 5d b4             	cmp    %ebx,-0x4c(%ebp)
+ 25c:	0f 84 9e 00 00 00    	je     300 <main+0x300>
+ 262:	89 c3                	mov    %eax,%ebx
+    for(j = 0; j < i; j++)
+ 264:	85 db                	test   %ebx,%ebx
+ 266:	7e 1c                	jle    284 <main+0x284>
+      if(table[j].uid == table[i].uid)
+ 268:	8b 4f 04             	mov    0x4(%edi),%ecx
+ 26b:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 26e:	8d 50 04             	lea    0x4(%eax),%edx
+    for(j = 0; j < i; j++)
+ 271:	b8 00 00 00 00       	mov    $0x0,%eax
+      if(table[j].uid == table[i].uid)
+ 276:	39 0a                	cmp    %ecx,(%edx)
+ 278:	74 d5                	je     24f <main+0x24f>
+    for(j = 0; j < i; j++)
+ 27a:	83 c0 01             	add    $0x1,%eax
+ 27d:	83 c2 4c             	add    $0x4c,%edx
+ 280:	39 d8                	cmp    %ebx,%eax
+ 282:	75 f2                	jne    276 <main+0x276>
+    for(j = i; j < num_procs; j++)
+ 284:	39 5d a4             	cmp    %ebx,-0x5c(%ebp)
+ 287:	7e 1d                	jle    2a6 <main+0x2a6>
+      if(table[j].uid == table[i].uid)
+ 289:	8b 4f 04             	mov    0x4(%edi),%ecx
+ 28c:	89 fa                	mov    %edi,%edx
+    used = 0;
+ 28e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 293:	eb 07                	jmp    29c <main+0x29c>
+    for(j = i; j < num_procs; j++)
+ 295:	83 c2 4c             	add    $0x4c,%edx
+ 298:	39 f2                	cmp    %esi,%edx
+ 29a:	74 0f                	je     2ab <main+0x2ab>
+      if(table[j].uid == table[i].uid)
+ 29c:	39 4a 04             	cmp    %ecx,0x4(%edx)
+ 29f:	75 f4                	jne    295 <main+0x295>
+        used += table[j].CPU_total_ticks;
+ 2a1:	03 42 20             	add    0x20(%edx),%eax
+ 2a4:	eb ef                	jmp    295 <main+0x295>
+    used = 0;
+ 2a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    printf(1, "%d\t%d\t%d\n", table[i].uid, getshares(table[i].uid),
+ 2ab:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+ 2ae:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+ 2b1:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+ 2b4:	85 c9                	test   %ecx,%ecx
+ 2b6:	74 0d                	je     2c5 <main+0x2c5>
+           total ? used*100/total : 0);
+ 2b8:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(1, "%d\t%d\t%d\n", table[i].uid, getshares(table[i].uid),
+ 2bb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2c0:	f7 f1                	div    %ecx
+ 2c2:	89 45 ac             	mov    %eax,-0x54(%ebp)
+ 2c5:	83 ec 0c             	sub    $0xc,%esp
+ 2c8:	ff 77 04             	push   0x4(%edi)
+ 2cb:	e8 db 03 00 00       	call   6ab <getshares>
+ 2d0:	83 c4 04             	add    $0x4,%esp
+ 2d3:	ff 75 ac             	push   -0x54(%ebp)
+ 2d6:	50                   	push   %eax
+ 2d7:	ff 77 04             	push   0x4(%edi)
+ 2da:	68 a5 0a 00 00       	push   $0xaa5
+ 2df:	6a 01                	push   $0x1
+ 2e1:	e8 65 04 00 00       	call   74b <printf>
+ 2e6:	83 c4 20             	add    $0x20,%esp
+ 2e9:	e9 65 ff ff ff       	jmp    253 <main+0x253>
+  printf(1, "\nUID\tShares\tCPU%%\n");
+ 2ee:	83 ec 08             	sub    $0x8,%esp
+ 2f1:	68 92 0a 00 00       	push   $0xa92
+ 2f6:	6a 01                	push   $0x1
+ 2f8:	e8 4e 04 00 00       	call   74b <printf>
+ 2fd:	83 c4 10             	add    $0x10,%esp
+  }
+#endif // PDX_STRIDE
+
+  free(table);
+ 300:	83 ec 0c             	sub    $0xc,%esp
+ 303:	ff 75 b0             	push   -0x50(%ebp)
+ 306:	e8 fd 05 00 00       	call   908 <free>
+  exit();
+ 30b:	e8 63 02 00 00       	call   573 <exit>
+
+00000310 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 317:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 31a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 31f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 323:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 326:	83 c0 01             	add    $0x1,%eax
+ 329:	84 d2                	test   %dl,%dl
+ 32b:	75 f2                	jne    31f <strcpy+0xf>
+    ;
+  return os;
+}
+ 32d:	89 c8                	mov    %ecx,%eax
+ 32f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 332:	c9                   	leave
+ 333:	c3                   	ret
+
+00000334 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 334:	55                   	push   %ebp
+ 335:	89 e5                	mov    %esp,%ebp
+ 337:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 33a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 33d:	0f b6 01             	movzbl (%ecx),%eax
+ 340:	84 c0                	test   %al,%al
+ 342:	74 11                	je     355 <strcmp+0x21>
+ 344:	38 02                	cmp    %al,(%edx)
+ 346:	75 0d                	jne    355 <strcmp+0x21>
+    p++, q++;
+ 348:	83 c1 01             	add    $0x1,%ecx
+ 34b:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 34e:	0f b6 01             	movzbl (%ecx),%eax
+ 351:	84 c0                	test   %al,%al
+ 353:	75 ef                	jne    344 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 355:	0f b6 c0             	movzbl %al,%eax
+ 358:	0f b6 12             	movzbl (%edx),%edx
+ 35b:	29 d0                	sub    %edx,%eax
+}
+ 35d:	5d                   	pop    %ebp
+ 35e:	c3                   	ret
+
+0000035f <strlen>:
+
+uint
+strlen(char *s)
+{
+ 35f:	55                   	push   %ebp
+ 360:	89 e5                	mov    %esp,%ebp
+ 362:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 365:	80 3a 00             	cmpb   $0x0,(%edx)
+ 368:	74 14                	je     37e <strlen+0x1f>
+ 36a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 36f:	83 c0 01             	add    $0x1,%eax
+ 372:	89 c1                	mov    %eax,%ecx
+ 374:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 378:	75 f5                	jne    36f <strlen+0x10>
+    ;
+  return n;
+}
+ 37a:	89 c8                	mov    %ecx,%eax
+ 37c:	5d                   	pop    %ebp
+ 37d:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 37e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 383:	eb f5                	jmp    37a <strlen+0x1b>
+
+00000385 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 385:	55                   	push   %ebp
+ 386:	89 e5                	mov    %esp,%ebp
+ 388:	57                   	push   %edi
+ 389:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 38c:	89 d7                	mov    %edx,%edi
+ 38e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 391:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 394:	fc                   	cld
+ 395:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 397:	89 d0                	mov    %edx,%eax
+ 399:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 39c:	c9                   	leave
+ 39d:	c3                   	ret
+
+0000039e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 39e:	55                   	push   %ebp
+ 39f:	89 e5                	mov    %esp,%ebp
+ 3a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3a8:	0f b6 10             	movzbl (%eax),%edx
+ 3ab:	84 d2                	test   %dl,%dl
+ 3ad:	74 15                	je     3c4 <strchr+0x26>
+    if(*s == c)
+ 3af:	38 d1                	cmp    %dl,%cl
+ 3b1:	74 0f                	je     3c2 <strchr+0x24>
+  for(; *s; s++)
+ 3b3:	83 c0 01             	add    $0x1,%eax
+ 3b6:	0f b6 10             	movzbl (%eax),%edx
+ 3b9:	84 d2                	test   %dl,%dl
+ 3bb:	75 f2                	jne    3af <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 3bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
+  return 0;
+ 3c4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3c9:	eb f7                	jmp    3c2 <strchr+0x24>
+
+000003cb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3cb:	55                   	push   %ebp
+ 3cc:	89 e5                	mov    %esp,%ebp
+ 3ce:	57                   	push   %edi
+ 3cf:	56                   	push   %esi
+ 3d0:	53                   	push   %ebx
+ 3d1:	83 ec 2c             	sub    $0x2c,%esp
+ 3d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 3dc:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 3df:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 3e2:	83 c3 01             	add    $0x1,%ebx
+ 3e5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3e8:	7d 27                	jge    411 <gets+0x46>
+    cc = read(0, &c, 1);
+ 3ea:	83 ec 04             	sub    $0x4,%esp
+ 3ed:	6a 01                	push   $0x1
+ 3ef:	57                   	push   %edi
+ 3f0:	6a 00                	push   $0x0
+ 3f2:	e8 94 01 00 00       	call   58b <read>
+    if(cc < 1)
+ 3f7:	83 c4 10             	add    $0x10,%esp
+ 3fa:	85 c0                	test   %eax,%eax
+ 3fc:	7e 13                	jle    411 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 3fe:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 402:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 406:	3c 0a                	cmp    $0xa,%al
+ 408:	74 04                	je     40e <gets+0x43>
+ 40a:	3c 0d                	cmp    $0xd,%al
+ 40c:	75 d1                	jne    3df <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 40e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 411:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 414:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 418:	89 f0                	mov    %esi,%eax
+ 41a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5f                   	pop    %edi
+ 420:	5d                   	pop    %ebp
+ 421:	c3                   	ret
+
+00000422 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 422:	55                   	push   %ebp
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	56                   	push   %esi
+ 426:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 427:	83 ec 08             	sub    $0x8,%esp
+ 42a:	6a 00                	push   $0x0
+ 42c:	ff 75 08             	push   0x8(%ebp)
+ 42f:	e8 7f 01 00 00       	call   5b3 <open>
+  if(fd < 0)
+ 434:	83 c4 10             	add    $0x10,%esp
+ 437:	85 c0                	test   %eax,%eax
+ 439:	78 24                	js     45f <stat+0x3d>
+ 43b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 43d:	83 ec 08             	sub    $0x8,%esp
+ 440:	ff 75 0c             	push   0xc(%ebp)
+ 443:	50                   	push   %eax
+ 444:	e8 82 01 00 00       	call   5cb <fstat>
+ 449:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 44b:	89 1c 24             	mov    %ebx,(%esp)
+ 44e:	e8 48 01 00 00       	call   59b <close>
+  return r;
+ 453:	83 c4 10             	add    $0x10,%esp
+}
+ 456:	89 f0                	mov    %esi,%eax
+ 458:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 45b:	5b                   	pop    %ebx
+ 45c:	5e                   	pop    %esi
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+    return -1;
+ 45f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 464:	eb f0                	jmp    456 <stat+0x34>
+
+00000466 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 466:	55                   	push   %ebp
+ 467:	89 e5                	mov    %esp,%ebp
+ 469:	56                   	push   %esi
+ 46a:	53                   	push   %ebx
+ 46b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 46e:	0f b6 0a             	movzbl (%edx),%ecx
+ 471:	80 f9 20             	cmp    $0x20,%cl
+ 474:	75 0b                	jne    481 <atoi+0x1b>
+ 476:	83 c2 01             	add    $0x1,%edx
+ 479:	0f b6 0a             	movzbl (%edx),%ecx
+ 47c:	80 f9 20             	cmp    $0x20,%cl
+ 47f:	74 f5                	je     476 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 481:	80 f9 2d             	cmp    $0x2d,%cl
+ 484:	74 3c                	je     4c2 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 486:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 489:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 48e:	f6 c1 fd             	test   $0xfd,%cl
+ 491:	74 34                	je     4c7 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 493:	0f b6 0a             	movzbl (%edx),%ecx
+ 496:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 499:	3c 09                	cmp    $0x9,%al
+ 49b:	77 2f                	ja     4cc <atoi+0x66>
+ 49d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 4a2:	83 c2 01             	add    $0x1,%edx
+ 4a5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 4a8:	0f be c9             	movsbl %cl,%ecx
+ 4ab:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 4af:	0f b6 0a             	movzbl (%edx),%ecx
+ 4b2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4b5:	3c 09                	cmp    $0x9,%al
+ 4b7:	76 e9                	jbe    4a2 <atoi+0x3c>
+  return sign*n;
+ 4b9:	89 f0                	mov    %esi,%eax
+ 4bb:	0f af c3             	imul   %ebx,%eax
+}
+ 4be:	5b                   	pop    %ebx
+ 4bf:	5e                   	pop    %esi
+ 4c0:	5d                   	pop    %ebp
+ 4c1:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 4c2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 4c7:	83 c2 01             	add    $0x1,%edx
+ 4ca:	eb c7                	jmp    493 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 4cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4d1:	eb e6                	jmp    4b9 <atoi+0x53>
+
+000004d3 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 4d3:	55                   	push   %ebp
+ 4d4:	89 e5                	mov    %esp,%ebp
+ 4d6:	56                   	push   %esi
+ 4d7:	53                   	push   %ebx
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4db:	0f b6 0a             	movzbl (%edx),%ecx
+ 4de:	80 f9 20             	cmp    $0x20,%cl
+ 4e1:	75 0b                	jne    4ee <atoo+0x1b>
+ 4e3:	83 c2 01             	add    $0x1,%edx
+ 4e6:	0f b6 0a             	movzbl (%edx),%ecx
+ 4e9:	80 f9 20             	cmp    $0x20,%cl
+ 4ec:	74 f5                	je     4e3 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4ee:	80 f9 2d             	cmp    $0x2d,%cl
+ 4f1:	74 3a                	je     52d <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 4f3:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 4f6:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4fb:	f6 c1 fd             	test   $0xfd,%cl
+ 4fe:	74 32                	je     532 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 500:	0f b6 0a             	movzbl (%edx),%ecx
+ 503:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 506:	80 fb 07             	cmp    $0x7,%bl
+ 509:	77 2c                	ja     537 <atoo+0x64>
+ 50b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 510:	83 c2 01             	add    $0x1,%edx
+ 513:	0f be c9             	movsbl %cl,%ecx
+ 516:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 51a:	0f b6 0a             	movzbl (%edx),%ecx
+ 51d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 520:	3c 07                	cmp    $0x7,%al
+ 522:	76 ec                	jbe    510 <atoo+0x3d>
+  return sign*n;
+ 524:	89 f0                	mov    %esi,%eax
+ 526:	0f af c3             	imul   %ebx,%eax
+}
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 52d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 532:	83 c2 01             	add    $0x1,%edx
+ 535:	eb c9                	jmp    500 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 537:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 53c:	eb e6                	jmp    524 <atoo+0x51>
+
+0000053e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 53e:	55                   	push   %ebp
+ 53f:	89 e5                	mov    %esp,%ebp
+ 541:	56                   	push   %esi
+ 542:	53                   	push   %ebx
+ 543:	8b 75 08             	mov    0x8(%ebp),%esi
+ 546:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 549:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 54c:	85 db                	test   %ebx,%ebx
+ 54e:	7e 15                	jle    565 <memmove+0x27>
+ 550:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 552:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 554:	83 c2 01             	add    $0x1,%edx
+ 557:	83 c0 01             	add    $0x1,%eax
+ 55a:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 55e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 561:	39 c3                	cmp    %eax,%ebx
+ 563:	75 ef                	jne    554 <memmove+0x16>
+  return vdst;
+}
+ 565:	89 f0                	mov    %esi,%eax
+ 567:	5b                   	pop    %ebx
+ 568:	5e                   	pop    %esi
+ 569:	5d                   	pop    %ebp
+ 56a:	c3                   	ret
+
+0000056b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 56b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <exit>:
+SYSCALL(exit)
+ 573:	b8 02 00 00 00       	mov    $0x2,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <wait>:
+SYSCALL(wait)
+ 57b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <pipe>:
+SYSCALL(pipe)
+ 583:	b8 04 00 00 00       	mov    $0x4,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <read>:
+SYSCALL(read)
+ 58b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <write>:
+SYSCALL(write)
+ 593:	b8 10 00 00 00       	mov    $0x10,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <close>:
+SYSCALL(close)
+ 59b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <kill>:
+SYSCALL(kill)
+ 5a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <exec>:
+SYSCALL(exec)
+ 5ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <open>:
+SYSCALL(open)
+ 5b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mknod>:
+SYSCALL(mknod)
+ 5bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <unlink>:
+SYSCALL(unlink)
+ 5c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <fstat>:
+SYSCALL(fstat)
+ 5cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <link>:
+SYSCALL(link)
+ 5d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mkdir>:
+SYSCALL(mkdir)
+ 5db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <chdir>:
+SYSCALL(chdir)
+ 5e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <dup>:
+SYSCALL(dup)
+ 5eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getpid>:
+SYSCALL(getpid)
+ 5f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sbrk>:
+SYSCALL(sbrk)
+ 5fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <sleep>:
+SYSCALL(sleep)
+ 603:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <uptime>:
+SYSCALL(uptime)
+ 60b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <halt>:
+SYSCALL(halt)
+ 613:	b8 16 00 00 00       	mov    $0x16,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <date>:
+SYSCALL(date)
+ 61b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <getuid>:
+SYSCALL(getuid)
+ 623:	b8 18 00 00 00       	mov    $0x18,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <getgid>:
+SYSCALL(getgid)
+ 62b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getppid>:
+SYSCALL(getppid)
+ 633:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <setuid>:
+SYSCALL(setuid)
+ 63b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <setgid>:
+SYSCALL(setgid)
+ 643:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <getprocs>:
+SYSCALL(getprocs)
+ 64b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <setpriority>:
+SYSCALL(setpriority)
+ 653:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <getpriority>:
+SYSCALL(getpriority)
+ 65b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <waitpid>:
+SYSCALL(waitpid)
+ 663:	b8 20 00 00 00       	mov    $0x20,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <setaffinity>:
+SYSCALL(setaffinity)
+ 66b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <getaffinity>:
+SYSCALL(getaffinity)
+ 673:	b8 22 00 00 00       	mov    $0x22,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <setdeadline>:
+SYSCALL(setdeadline)
+ 67b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <schedctl>:
+SYSCALL(schedctl)
+ 683:	b8 24 00 00 00       	mov    $0x24,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <spawn>:
+SYSCALL(spawn)
+ 68b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <vmstats>:
+SYSCALL(vmstats)
+ 693:	b8 26 00 00 00       	mov    $0x26,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <hugesbrk>:
+SYSCALL(hugesbrk)
+ 69b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <setshares>:
+SYSCALL(setshares)
+ 6a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <getshares>:
+SYSCALL(getshares)
+ 6ab:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6b3:	55                   	push   %ebp
+ 6b4:	89 e5                	mov    %esp,%ebp
+ 6b6:	57                   	push   %edi
+ 6b7:	56                   	push   %esi
+ 6b8:	53                   	push   %ebx
+ 6b9:	83 ec 3c             	sub    $0x3c,%esp
+ 6bc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6bf:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 6c1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 6c5:	74 79                	je     740 <printint+0x8d>
+ 6c7:	85 d2                	test   %edx,%edx
+ 6c9:	79 75                	jns    740 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 6cb:	89 d1                	mov    %edx,%ecx
+ 6cd:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6cf:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 6db:	89 df                	mov    %ebx,%edi
+ 6dd:	83 c3 01             	add    $0x1,%ebx
+ 6e0:	89 c8                	mov    %ecx,%eax
+ 6e2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6e7:	f7 f6                	div    %esi
+ 6e9:	0f b6 92 84 0b 00 00 	movzbl 0xb84(%edx),%edx
+ 6f0:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 6f4:	89 ca                	mov    %ecx,%edx
+ 6f6:	89 c1                	mov    %eax,%ecx
+ 6f8:	39 f2                	cmp    %esi,%edx
+ 6fa:	73 df                	jae    6db <printint+0x28>
+  if(neg)
+ 6fc:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 700:	74 08                	je     70a <printint+0x57>
+    buf[i++] = '-';
+ 702:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 707:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 70a:	85 db                	test   %ebx,%ebx
+ 70c:	7e 2a                	jle    738 <printint+0x85>
+ 70e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 711:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 715:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 718:	0f b6 03             	movzbl (%ebx),%eax
+ 71b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 71e:	83 ec 04             	sub    $0x4,%esp
+ 721:	6a 01                	push   $0x1
+ 723:	57                   	push   %edi
+ 724:	ff 75 c4             	push   -0x3c(%ebp)
+ 727:	e8 67 fe ff ff       	call   593 <write>
+  while(--i >= 0)
+ 72c:	89 d8                	mov    %ebx,%eax
+ 72e:	83 eb 01             	sub    $0x1,%ebx
+ 731:	83 c4 10             	add    $0x10,%esp
+ 734:	39 f0                	cmp    %esi,%eax
+ 736:	75 e0                	jne    718 <printint+0x65>
+}
+ 738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 73b:	5b                   	pop    %ebx
+ 73c:	5e                   	pop    %esi
+ 73d:	5f                   	pop    %edi
+ 73e:	5d                   	pop    %ebp
+ 73f:	c3                   	ret
+    x = xx;
+ 740:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 742:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 749:	eb 8b                	jmp    6d6 <printint+0x23>
+
+0000074b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 74b:	55                   	push   %ebp
+ 74c:	89 e5                	mov    %esp,%ebp
+ 74e:	57                   	push   %edi
+ 74f:	56                   	push   %esi
+ 750:	53                   	push   %ebx
+ 751:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 754:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 757:	0f b6 1e             	movzbl (%esi),%ebx
+ 75a:	84 db                	test   %bl,%bl
+ 75c:	0f 84 9e 01 00 00    	je     900 <printf+0x1b5>
+ 762:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 765:	8d 45 10             	lea    0x10(%ebp),%eax
+ 768:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 76b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 770:	eb 2d                	jmp    79f <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 772:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 775:	83 ec 04             	sub    $0x4,%esp
+ 778:	6a 01                	push   $0x1
+ 77a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 77d:	50                   	push   %eax
+ 77e:	ff 75 08             	push   0x8(%ebp)
+ 781:	e8 0d fe ff ff       	call   593 <write>
+        putc(fd, c);
+ 786:	83 c4 10             	add    $0x10,%esp
+ 789:	eb 05                	jmp    790 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 78b:	83 ff 25             	cmp    $0x25,%edi
+ 78e:	74 1f                	je     7af <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 790:	83 c6 01             	add    $0x1,%esi
+ 793:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 797:	84 db                	test   %bl,%bl
+ 799:	0f 84 61 01 00 00    	je     900 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 79f:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7a2:	85 ff                	test   %edi,%edi
+ 7a4:	75 e5                	jne    78b <printf+0x40>
+      if(c == '%'){
+ 7a6:	83 f8 25             	cmp    $0x25,%eax
+ 7a9:	75 c7                	jne    772 <printf+0x27>
+        state = '%';
+ 7ab:	89 c7                	mov    %eax,%edi
+ 7ad:	eb e1                	jmp    790 <printf+0x45>
+      if(c == 'd'){
+ 7af:	83 f8 25             	cmp    $0x25,%eax
+ 7b2:	0f 84 f4 00 00 00    	je     8ac <printf+0x161>
+ 7b8:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 7bb:	83 fa 15             	cmp    $0x15,%edx
+ 7be:	0f 87 09 01 00 00    	ja     8cd <printf+0x182>
+ 7c4:	0f 87 03 01 00 00    	ja     8cd <printf+0x182>
+ 7ca:	ff 24 95 2c 0b 00 00 	jmp    *0xb2c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 7d1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7d4:	8b 17                	mov    (%edi),%edx
+ 7d6:	83 ec 0c             	sub    $0xc,%esp
+ 7d9:	6a 01                	push   $0x1
+ 7db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e3:	e8 cb fe ff ff       	call   6b3 <printint>
+        ap++;
+ 7e8:	83 c7 04             	add    $0x4,%edi
+ 7eb:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 7ee:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 7f1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7f6:	eb 98                	jmp    790 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 7f8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7fb:	8b 17                	mov    (%edi),%edx
+ 7fd:	83 ec 0c             	sub    $0xc,%esp
+ 800:	6a 00                	push   $0x0
+ 802:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 807:	8b 45 08             	mov    0x8(%ebp),%eax
+ 80a:	e8 a4 fe ff ff       	call   6b3 <printint>
+        ap++;
+ 80f:	83 c7 04             	add    $0x4,%edi
+ 812:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 815:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 818:	bf 00 00 00 00       	mov    $0x0,%edi
+ 81d:	e9 6e ff ff ff       	jmp    790 <printf+0x45>
+        s = (char*)*ap;
+ 822:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 825:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 827:	83 c1 04             	add    $0x4,%ecx
+ 82a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 82d:	85 c0                	test   %eax,%eax
+ 82f:	74 13                	je     844 <printf+0xf9>
+        s = (char*)*ap;
+ 831:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 833:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 836:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 83b:	84 c0                	test   %al,%al
+ 83d:	75 0f                	jne    84e <printf+0x103>
+ 83f:	e9 4c ff ff ff       	jmp    790 <printf+0x45>
+          s = "(null)";
+ 844:	bb 24 0b 00 00       	mov    $0xb24,%ebx
+        while(*s != 0){
+ 849:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 84e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 851:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 854:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 857:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 85a:	83 ec 04             	sub    $0x4,%esp
+ 85d:	6a 01                	push   $0x1
+ 85f:	57                   	push   %edi
+ 860:	56                   	push   %esi
+ 861:	e8 2d fd ff ff       	call   593 <write>
+          s++;
+ 866:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 869:	0f b6 03             	movzbl (%ebx),%eax
+ 86c:	83 c4 10             	add    $0x10,%esp
+ 86f:	84 c0                	test   %al,%al
+ 871:	75 e4                	jne    857 <printf+0x10c>
+      state = 0;
+ 873:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 876:	bf 00 00 00 00       	mov    $0x0,%edi
+ 87b:	e9 10 ff ff ff       	jmp    790 <printf+0x45>
+        putc(fd, *ap);
+ 880:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 883:	8b 07                	mov    (%edi),%eax
+ 885:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 888:	83 ec 04             	sub    $0x4,%esp
+ 88b:	6a 01                	push   $0x1
+ 88d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 890:	50                   	push   %eax
+ 891:	ff 75 08             	push   0x8(%ebp)
+ 894:	e8 fa fc ff ff       	call   593 <write>
+        ap++;
+ 899:	83 c7 04             	add    $0x4,%edi
+ 89c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 89f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8a2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8a7:	e9 e4 fe ff ff       	jmp    790 <printf+0x45>
+        putc(fd, c);
+ 8ac:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8af:	83 ec 04             	sub    $0x4,%esp
+ 8b2:	6a 01                	push   $0x1
+ 8b4:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8b7:	50                   	push   %eax
+ 8b8:	ff 75 08             	push   0x8(%ebp)
+ 8bb:	e8 d3 fc ff ff       	call   593 <write>
+ 8c0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8c3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8c8:	e9 c3 fe ff ff       	jmp    790 <printf+0x45>
+        putc(fd, '%');
+ 8cd:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8d1:	83 ec 04             	sub    $0x4,%esp
+ 8d4:	6a 01                	push   $0x1
+ 8d6:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 8d9:	57                   	push   %edi
+ 8da:	ff 75 08             	push   0x8(%ebp)
+ 8dd:	e8 b1 fc ff ff       	call   593 <write>
+        putc(fd, c);
+ 8e2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e5:	83 c4 0c             	add    $0xc,%esp
+ 8e8:	6a 01                	push   $0x1
+ 8ea:	57                   	push   %edi
+ 8eb:	ff 75 08             	push   0x8(%ebp)
+ 8ee:	e8 a0 fc ff ff       	call   593 <write>
+        putc(fd, c);
+ 8f3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8fb:	e9 90 fe ff ff       	jmp    790 <printf+0x45>
+    }
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 903:	5b                   	pop    %ebx
+ 904:	5e                   	pop    %esi
+ 905:	5f                   	pop    %edi
+ 906:	5d                   	pop    %ebp
+ 907:	c3                   	ret
+
+00000908 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 908:	55                   	push   %ebp
+ 909:	89 e5                	mov    %esp,%ebp
+ 90b:	57                   	push   %edi
+ 90c:	56                   	push   %esi
+ 90d:	53                   	push   %ebx
+ 90e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 911:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 914:	a1 28 0e 00 00       	mov    0xe28,%eax
+ 919:	eb 0c                	jmp    927 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 91b:	8b 10                	mov    (%eax),%edx
+ 91d:	39 d0                	cmp    %edx,%eax
+ 91f:	72 04                	jb     925 <free+0x1d>
+ 921:	39 d1                	cmp    %edx,%ecx
+ 923:	72 10                	jb     935 <free+0x2d>
+{
+ 925:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 927:	39 c8                	cmp    %ecx,%eax
+ 929:	73 f0                	jae    91b <free+0x13>
+ 92b:	8b 10                	mov    (%eax),%edx
+ 92d:	39 d1                	cmp    %edx,%ecx
+ 92f:	72 04                	jb     935 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 931:	39 d0                	cmp    %edx,%eax
+ 933:	72 f0                	jb     925 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 935:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 938:	8b 10                	mov    (%eax),%edx
+ 93a:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 93d:	39 fa                	cmp    %edi,%edx
+ 93f:	74 19                	je     95a <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 941:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 944:	8b 50 04             	mov    0x4(%eax),%edx
+ 947:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 94a:	39 f1                	cmp    %esi,%ecx
+ 94c:	74 18                	je     966 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 94e:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 950:	a3 28 0e 00 00       	mov    %eax,0xe28
+}
+ 955:	5b                   	pop    %ebx
+ 956:	5e                   	pop    %esi
+ 957:	5f                   	pop    %edi
+ 958:	5d                   	pop    %ebp
+ 959:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 95a:	03 72 04             	add    0x4(%edx),%esi
+ 95d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 960:	8b 10                	mov    (%eax),%edx
+ 962:	8b 12                	mov    (%edx),%edx
+ 964:	eb db                	jmp    941 <free+0x39>
+    p->s.size += bp->s.size;
+ 966:	03 53 fc             	add    -0x4(%ebx),%edx
+ 969:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 96c:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 96f:	eb dd                	jmp    94e <free+0x46>
+
+00000971 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 971:	55                   	push   %ebp
+ 972:	89 e5                	mov    %esp,%ebp
+ 974:	57                   	push   %edi
+ 975:	56                   	push   %esi
+ 976:	53                   	push   %ebx
+ 977:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 97a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97d:	8d 58 07             	lea    0x7(%eax),%ebx
+ 980:	c1 eb 03             	shr    $0x3,%ebx
+ 983:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 986:	8b 15 28 0e 00 00    	mov    0xe28,%edx
+ 98c:	85 d2                	test   %edx,%edx
+ 98e:	74 1c                	je     9ac <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 990:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 992:	8b 48 04             	mov    0x4(%eax),%ecx
+ 995:	39 d9                	cmp    %ebx,%ecx
+ 997:	73 38                	jae    9d1 <malloc+0x60>
+  if(nu < 4096)
+ 999:	be 00 10 00 00       	mov    $0x1000,%esi
+ 99e:	39 f3                	cmp    %esi,%ebx
+ 9a0:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 9a3:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 9aa:	eb 72                	jmp    a1e <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 9ac:	c7 05 28 0e 00 00 2c 	movl   $0xe2c,0xe28
+ 9b3:	0e 00 00 
+ 9b6:	c7 05 2c 0e 00 00 2c 	movl   $0xe2c,0xe2c
+ 9bd:	0e 00 00 
+    base.s.size = 0;
+ 9c0:	c7 05 30 0e 00 00 00 	movl   $0x0,0xe30
+ 9c7:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9ca:	b8 2c 0e 00 00       	mov    $0xe2c,%eax
+    if(p->s.size >= nunits){
+ 9cf:	eb c8                	jmp    999 <malloc+0x28>
+      if(p->s.size == nunits)
+ 9d1:	39 cb                	cmp    %ecx,%ebx
+ 9d3:	74 1e                	je     9f3 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 9d5:	29 d9                	sub    %ebx,%ecx
+ 9d7:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9da:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9dd:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 9e0:	89 15 28 0e 00 00    	mov    %edx,0xe28
+      return (void*)(p + 1);
+ 9e6:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 9e9:	89 d0                	mov    %edx,%eax
+ 9eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ee:	5b                   	pop    %ebx
+ 9ef:	5e                   	pop    %esi
+ 9f0:	5f                   	pop    %edi
+ 9f1:	5d                   	pop    %ebp
+ 9f2:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 9f3:	8b 08                	mov    (%eax),%ecx
+ 9f5:	89 0a                	mov    %ecx,(%edx)
+ 9f7:	eb e7                	jmp    9e0 <malloc+0x6f>
+  hp->s.size = nu;
+ 9f9:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 9fc:	83 ec 0c             	sub    $0xc,%esp
+ 9ff:	83 c0 08             	add    $0x8,%eax
+ a02:	50                   	push   %eax
+ a03:	e8 00 ff ff ff       	call   908 <free>
+  return freep;
+ a08:	8b 15 28 0e 00 00    	mov    0xe28,%edx
+      if((p = morecore(nunits)) == 0)
+ a0e:	83 c4 10             	add    $0x10,%esp
+ a11:	85 d2                	test   %edx,%edx
+ a13:	74 d4                	je     9e9 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a15:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a17:	8b 48 04             	mov    0x4(%eax),%ecx
+ a1a:	39 d9                	cmp    %ebx,%ecx
+ a1c:	73 b3                	jae    9d1 <malloc+0x60>
+    if(p == freep)
+ a1e:	89 c2                	mov    %eax,%edx
+ a20:	39 05 28 0e 00 00    	cmp    %eax,0xe28
+ a26:	75 ed                	jne    a15 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ a28:	83 ec 0c             	sub    $0xc,%esp
+ a2b:	57                   	push   %edi
+ a2c:	e8 ca fb ff ff       	call   5fb <sbrk>
+  if(p == (char*)-1)
+ a31:	83 c4 10             	add    $0x10,%esp
+ a34:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a37:	75 c0                	jne    9f9 <malloc+0x88>
+        return 0;
+ a39:	ba 00 00 00 00       	mov    $0x0,%edx
+ a3e:	eb a9                	jmp    9e9 <malloc+0x78>
@@ -2,11 +2,30 @@
 #include "types.h"
 #include "user.h"
 #include "uproc.h"
+#ifdef CS333_P4
+#include "schedctl.h"
+#endif // CS333_P4
+
+#ifdef CS333_P4
+static char *states[] = {
+[UPROC_SLEEPING]  "sleep ",
+[UPROC_RUNNABLE]  "runble",
+[UPROC_RUNNING]   "run   ",
+[UPROC_ZOMBIE]    "zombie"
+};
+#endif // CS333_P4
 
 int
 main(int argc, char * argv[])
 {
   int max = 16;
+#ifdef CS333_P4
+  struct schedparams sp;
+
+  // Room for every process the table may hold right now.
+  if(schedctl(SCHED_GET, &sp) == 0)
+    max = sp.maxproc;
+#endif // CS333_P4
 
   if(argc > 1)
     max = atoi(argv[1]);
@@ -22,7 +41,7 @@ main(int argc, char * argv[])
   uint s;
   uint ms;
 #ifdef CS333_P4
-  printf(1, "PID\tName\tUID\tGID\tPPID\tPrio\tElapsed\tCPU\tState\tSize\n");
+  printf(1, "PID\tName\tUID\tGID\tPPID\tPrio\tElapsed\tCPU\tState\tSize\tCore\tMask\n");
 #elif CS333_P2
   printf(1, "PID\tName\tUID\tGID\tPPID\tElapsed\tCPU\tState\tSize\n");
 #endif
@@ -59,8 +78,43 @@ main(int argc, char * argv[])
       printf(1, "%d.0%d\t",s,ms);
 
     // Print state, size
+#ifdef CS333_P4
+    printf(1, "%s\t%d\t", states[table[i].state],table[i].size);
+
+    // Print the cpu it last ran on and the cpus it may run on
+    if(table[i].lastcpu < 0)
+      printf(1, "-\t");
+    else
+      printf(1, "%d\t", table[i].lastcpu);
+    printf(1, "0x%x\n", table[i].affinity);
+#else
     printf(1, "%s\t%d\n", table[i].state,table[i].size);
+#endif // CS333_P4
+  }
+
+#ifdef PDX_STRIDE
+  // Each uid's shares and the fraction of the listed cpu time its
+  // processes got, to check against the shares.
+  uint total = 0, used;
+  int j;
+
+  for(int i = 0; i < num_procs; i++)
+    total += table[i].CPU_total_ticks;
+  printf(1, "\nUID\tShares\tCPU%%\n");
+  for(int i = 0; i < num_procs; i++){
+    for(j = 0; j < i; j++)
+      if(table[j].uid == table[i].uid)
+        break;
+    if(j < i)
+      continue;
+    used = 0;
+    for(j = i; j < num_procs; j++)
+      if(table[j].uid == table[i].uid)
+        used += table[j].CPU_total_ticks;
+    printf(1, "%d\t%d\t%d\n", table[i].uid, getshares(table[i].uid),
+           total ? used*100/total : 0);
   }
+#endif // PDX_STRIDE
 
   free(table);
   exit();
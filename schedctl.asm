@@ -0,0 +1,1396 @@
+
+_schedctl:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 44             	sub    $0x44,%esp
+  13:	8b 31                	mov    (%ecx),%esi
+  15:	8b 59 04             	mov    0x4(%ecx),%ebx
+  struct schedparams sp;
+  int level;
+
+  if(schedctl(SCHED_GET, &sp) < 0){
+  18:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  1b:	50                   	push   %eax
+  1c:	6a 00                	push   $0x0
+  1e:	e8 2d 05 00 00       	call   550 <schedctl>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 a6 00 00 00    	js     d4 <main+0xd4>
+    printf(2, "schedctl: cannot read settings\n");
+    exit();
+  }
+
+  if(argc == 1){
+  2e:	83 fe 01             	cmp    $0x1,%esi
+  31:	0f 84 b1 00 00 00    	je     e8 <main+0xe8>
+    printf(1, "budget %d\npromote %d\nmaxproc %d\n",
+           sp.budget, sp.promote, sp.maxproc);
+    exit();
+  }
+
+  if(strcmp(argv[1], "quantum") == 0 && argc == 4){
+  37:	83 ec 08             	sub    $0x8,%esp
+  3a:	68 bc 09 00 00       	push   $0x9bc
+  3f:	ff 73 04             	push   0x4(%ebx)
+  42:	e8 ba 01 00 00       	call   201 <strcmp>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	75 09                	jne    57 <main+0x57>
+  4e:	83 fe 04             	cmp    $0x4,%esi
+  51:	0f 84 e4 00 00 00    	je     13b <main+0x13b>
+    level = atoi(argv[2]);
+    if(level < 0 || level > MAXPRIO)
+      usage();
+    sp.quantum[level] = atoi(argv[3]);
+  } else if(strcmp(argv[1], "budget") == 0 && argc == 3)
+  57:	83 ec 08             	sub    $0x8,%esp
+  5a:	68 c4 09 00 00       	push   $0x9c4
+  5f:	ff 73 04             	push   0x4(%ebx)
+  62:	e8 9a 01 00 00       	call   201 <strcmp>
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	83 fe 03             	cmp    $0x3,%esi
+  6d:	0f 94 c2             	sete   %dl
+  70:	89 d6                	mov    %edx,%esi
+  72:	85 c0                	test   %eax,%eax
+  74:	75 08                	jne    7e <main+0x7e>
+  76:	84 d2                	test   %dl,%dl
+  78:	0f 85 fa 00 00 00    	jne    178 <main+0x178>
+    sp.budget = atoi(argv[2]);
+  else if(strcmp(argv[1], "promote") == 0 && argc == 3)
+  7e:	83 ec 08             	sub    $0x8,%esp
+  81:	68 cb 09 00 00       	push   $0x9cb
+  86:	ff 73 04             	push   0x4(%ebx)
+  89:	e8 73 01 00 00       	call   201 <strcmp>
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	85 c0                	test   %eax,%eax
+  93:	75 0a                	jne    9f <main+0x9f>
+  95:	89 f0                	mov    %esi,%eax
+  97:	84 c0                	test   %al,%al
+  99:	0f 85 04 01 00 00    	jne    1a3 <main+0x1a3>
+    sp.promote = atoi(argv[2]);
+  else if(strcmp(argv[1], "maxproc") == 0 && argc == 3)
+  9f:	83 ec 08             	sub    $0x8,%esp
+  a2:	68 d3 09 00 00       	push   $0x9d3
+  a7:	ff 73 04             	push   0x4(%ebx)
+  aa:	e8 52 01 00 00       	call   201 <strcmp>
+  af:	83 c4 10             	add    $0x10,%esp
+  b2:	85 c0                	test   %eax,%eax
+  b4:	75 0a                	jne    c0 <main+0xc0>
+  b6:	89 f0                	mov    %esi,%eax
+  b8:	84 c0                	test   %al,%al
+  ba:	0f 85 f6 00 00 00    	jne    1b6 <main+0x1b6>
+  printf(2, "usage: schedctl [quantum level ticks | budget ticks | "
+  c0:	83 ec 08             	sub    $0x8,%esp
+  c3:	68 54 09 00 00       	push   $0x954
+  c8:	6a 02                	push   $0x2
+  ca:	e8 49 05 00 00       	call   618 <printf>
+  exit();
+  cf:	e8 6c 03 00 00       	call   440 <exit>
+    printf(2, "schedctl: cannot read settings\n");
+  d4:	83 ec 08             	sub    $0x8,%esp
+  d7:	68 10 09 00 00       	push   $0x910
+  dc:	6a 02                	push   $0x2
+  de:	e8 35 05 00 00       	call   618 <printf>
+    exit();
+  e3:	e8 58 03 00 00       	call   440 <exit>
+    printf(1, "Level\tQuantum\n");
+  e8:	83 ec 08             	sub    $0x8,%esp
+  eb:	68 a6 09 00 00       	push   $0x9a6
+  f0:	6a 01                	push   $0x1
+  f2:	e8 21 05 00 00       	call   618 <printf>
+  f7:	83 c4 10             	add    $0x10,%esp
+    for(level = MAXPRIO; level >= 0; level--)
+  fa:	bb 06 00 00 00       	mov    $0x6,%ebx
+      printf(1, "%d\t%d\n", level, sp.quantum[level]);
+  ff:	ff 74 9d c0          	push   -0x40(%ebp,%ebx,4)
+ 103:	53                   	push   %ebx
+ 104:	68 b5 09 00 00       	push   $0x9b5
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 08 05 00 00       	call   618 <printf>
+    for(level = MAXPRIO; level >= 0; level--)
+ 110:	83 eb 01             	sub    $0x1,%ebx
+ 113:	83 c4 10             	add    $0x10,%esp
+ 116:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 119:	75 e4                	jne    ff <main+0xff>
+    printf(1, "budget %d\npromote %d\nmaxproc %d\n",
+ 11b:	83 ec 0c             	sub    $0xc,%esp
+ 11e:	ff 75 e4             	push   -0x1c(%ebp)
+ 121:	ff 75 e0             	push   -0x20(%ebp)
+ 124:	ff 75 dc             	push   -0x24(%ebp)
+ 127:	68 30 09 00 00       	push   $0x930
+ 12c:	6a 01                	push   $0x1
+ 12e:	e8 e5 04 00 00       	call   618 <printf>
+    exit();
+ 133:	83 c4 20             	add    $0x20,%esp
+ 136:	e8 05 03 00 00       	call   440 <exit>
+    level = atoi(argv[2]);
+ 13b:	83 ec 0c             	sub    $0xc,%esp
+ 13e:	ff 73 08             	push   0x8(%ebx)
+ 141:	e8 ed 01 00 00       	call   333 <atoi>
+ 146:	89 c6                	mov    %eax,%esi
+    if(level < 0 || level > MAXPRIO)
+ 148:	83 c4 10             	add    $0x10,%esp
+ 14b:	83 f8 06             	cmp    $0x6,%eax
+ 14e:	76 14                	jbe    164 <main+0x164>
+  printf(2, "usage: schedctl [quantum level ticks | budget ticks | "
+ 150:	83 ec 08             	sub    $0x8,%esp
+ 153:	68 54 09 00 00       	push   $0x954
+ 158:	6a 02                	push   $0x2
+ 15a:	e8 b9 04 00 00       	call   618 <printf>
+  exit();
+ 15f:	e8 dc 02 00 00       	call   440 <exit>
+    sp.quantum[level] = atoi(argv[3]);
+ 164:	83 ec 0c             	sub    $0xc,%esp
+ 167:	ff 73 0c             	push   0xc(%ebx)
+ 16a:	e8 c4 01 00 00       	call   333 <atoi>
+ 16f:	89 44 b5 c0          	mov    %eax,-0x40(%ebp,%esi,4)
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	eb 11                	jmp    189 <main+0x189>
+    sp.budget = atoi(argv[2]);
+ 178:	83 ec 0c             	sub    $0xc,%esp
+ 17b:	ff 73 08             	push   0x8(%ebx)
+ 17e:	e8 b0 01 00 00       	call   333 <atoi>
+ 183:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 186:	83 c4 10             	add    $0x10,%esp
+    sp.maxproc = atoi(argv[2]);
+  else
+    usage();
+
+  if(schedctl(SCHED_SET, &sp) < 0)
+ 189:	83 ec 08             	sub    $0x8,%esp
+ 18c:	8d 45 c0             	lea    -0x40(%ebp),%eax
+ 18f:	50                   	push   %eax
+ 190:	6a 01                	push   $0x1
+ 192:	e8 b9 03 00 00       	call   550 <schedctl>
+ 197:	83 c4 10             	add    $0x10,%esp
+ 19a:	85 c0                	test   %eax,%eax
+ 19c:	78 2b                	js     1c9 <main+0x1c9>
+    printf(2, "schedctl: invalid setting\n");
+  exit();
+ 19e:	e8 9d 02 00 00       	call   440 <exit>
+    sp.promote = atoi(argv[2]);
+ 1a3:	83 ec 0c             	sub    $0xc,%esp
+ 1a6:	ff 73 08             	push   0x8(%ebx)
+ 1a9:	e8 85 01 00 00       	call   333 <atoi>
+ 1ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 1b1:	83 c4 10             	add    $0x10,%esp
+ 1b4:	eb d3                	jmp    189 <main+0x189>
+    sp.maxproc = atoi(argv[2]);
+ 1b6:	83 ec 0c             	sub    $0xc,%esp
+ 1b9:	ff 73 08             	push   0x8(%ebx)
+ 1bc:	e8 72 01 00 00       	call   333 <atoi>
+ 1c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 1c4:	83 c4 10             	add    $0x10,%esp
+ 1c7:	eb c0                	jmp    189 <main+0x189>
+    printf(2, "schedctl: invalid setting\n");
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	68 db 09 00 00       	push   $0x9db
+ 1d1:	6a 02                	push   $0x2
+ 1d3:	e8 40 04 00 00       	call   618 <printf>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	eb c1                	jmp    19e <main+0x19e>
+
+000001dd <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	53                   	push   %ebx
+ 1e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1e7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1ec:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1f0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1f3:	83 c0 01             	add    $0x1,%eax
+ 1f6:	84 d2                	test   %dl,%dl
+ 1f8:	75 f2                	jne    1ec <strcpy+0xf>
+    ;
+  return os;
+}
+ 1fa:	89 c8                	mov    %ecx,%eax
+ 1fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ff:	c9                   	leave
+ 200:	c3                   	ret
+
+00000201 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 201:	55                   	push   %ebp
+ 202:	89 e5                	mov    %esp,%ebp
+ 204:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 207:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 20a:	0f b6 01             	movzbl (%ecx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	74 11                	je     222 <strcmp+0x21>
+ 211:	38 02                	cmp    %al,(%edx)
+ 213:	75 0d                	jne    222 <strcmp+0x21>
+    p++, q++;
+ 215:	83 c1 01             	add    $0x1,%ecx
+ 218:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 21b:	0f b6 01             	movzbl (%ecx),%eax
+ 21e:	84 c0                	test   %al,%al
+ 220:	75 ef                	jne    211 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 222:	0f b6 c0             	movzbl %al,%eax
+ 225:	0f b6 12             	movzbl (%edx),%edx
+ 228:	29 d0                	sub    %edx,%eax
+}
+ 22a:	5d                   	pop    %ebp
+ 22b:	c3                   	ret
+
+0000022c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 22c:	55                   	push   %ebp
+ 22d:	89 e5                	mov    %esp,%ebp
+ 22f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 232:	80 3a 00             	cmpb   $0x0,(%edx)
+ 235:	74 14                	je     24b <strlen+0x1f>
+ 237:	b8 00 00 00 00       	mov    $0x0,%eax
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	89 c1                	mov    %eax,%ecx
+ 241:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 245:	75 f5                	jne    23c <strlen+0x10>
+    ;
+  return n;
+}
+ 247:	89 c8                	mov    %ecx,%eax
+ 249:	5d                   	pop    %ebp
+ 24a:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 24b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 250:	eb f5                	jmp    247 <strlen+0x1b>
+
+00000252 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	57                   	push   %edi
+ 256:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 259:	89 d7                	mov    %edx,%edi
+ 25b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 25e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 261:	fc                   	cld
+ 262:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 264:	89 d0                	mov    %edx,%eax
+ 266:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 269:	c9                   	leave
+ 26a:	c3                   	ret
+
+0000026b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 26b:	55                   	push   %ebp
+ 26c:	89 e5                	mov    %esp,%ebp
+ 26e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 271:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 275:	0f b6 10             	movzbl (%eax),%edx
+ 278:	84 d2                	test   %dl,%dl
+ 27a:	74 15                	je     291 <strchr+0x26>
+    if(*s == c)
+ 27c:	38 d1                	cmp    %dl,%cl
+ 27e:	74 0f                	je     28f <strchr+0x24>
+  for(; *s; s++)
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	0f b6 10             	movzbl (%eax),%edx
+ 286:	84 d2                	test   %dl,%dl
+ 288:	75 f2                	jne    27c <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 28a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 28f:	5d                   	pop    %ebp
+ 290:	c3                   	ret
+  return 0;
+ 291:	b8 00 00 00 00       	mov    $0x0,%eax
+ 296:	eb f7                	jmp    28f <strchr+0x24>
+
+00000298 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 298:	55                   	push   %ebp
+ 299:	89 e5                	mov    %esp,%ebp
+ 29b:	57                   	push   %edi
+ 29c:	56                   	push   %esi
+ 29d:	53                   	push   %ebx
+ 29e:	83 ec 2c             	sub    $0x2c,%esp
+ 2a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 2a9:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 2ac:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 2af:	83 c3 01             	add    $0x1,%ebx
+ 2b2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2b5:	7d 27                	jge    2de <gets+0x46>
+    cc = read(0, &c, 1);
+ 2b7:	83 ec 04             	sub    $0x4,%esp
+ 2ba:	6a 01                	push   $0x1
+ 2bc:	57                   	push   %edi
+ 2bd:	6a 00                	push   $0x0
+ 2bf:	e8 94 01 00 00       	call   458 <read>
+    if(cc < 1)
+ 2c4:	83 c4 10             	add    $0x10,%esp
+ 2c7:	85 c0                	test   %eax,%eax
+ 2c9:	7e 13                	jle    2de <gets+0x46>
+      break;
+    buf[i++] = c;
+ 2cb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2cf:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2d3:	3c 0a                	cmp    $0xa,%al
+ 2d5:	74 04                	je     2db <gets+0x43>
+ 2d7:	3c 0d                	cmp    $0xd,%al
+ 2d9:	75 d1                	jne    2ac <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 2db:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 2de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2e1:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 2e5:	89 f0                	mov    %esi,%eax
+ 2e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ea:	5b                   	pop    %ebx
+ 2eb:	5e                   	pop    %esi
+ 2ec:	5f                   	pop    %edi
+ 2ed:	5d                   	pop    %ebp
+ 2ee:	c3                   	ret
+
+000002ef <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ef:	55                   	push   %ebp
+ 2f0:	89 e5                	mov    %esp,%ebp
+ 2f2:	56                   	push   %esi
+ 2f3:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f4:	83 ec 08             	sub    $0x8,%esp
+ 2f7:	6a 00                	push   $0x0
+ 2f9:	ff 75 08             	push   0x8(%ebp)
+ 2fc:	e8 7f 01 00 00       	call   480 <open>
+  if(fd < 0)
+ 301:	83 c4 10             	add    $0x10,%esp
+ 304:	85 c0                	test   %eax,%eax
+ 306:	78 24                	js     32c <stat+0x3d>
+ 308:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 30a:	83 ec 08             	sub    $0x8,%esp
+ 30d:	ff 75 0c             	push   0xc(%ebp)
+ 310:	50                   	push   %eax
+ 311:	e8 82 01 00 00       	call   498 <fstat>
+ 316:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 318:	89 1c 24             	mov    %ebx,(%esp)
+ 31b:	e8 48 01 00 00       	call   468 <close>
+  return r;
+ 320:	83 c4 10             	add    $0x10,%esp
+}
+ 323:	89 f0                	mov    %esi,%eax
+ 325:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 328:	5b                   	pop    %ebx
+ 329:	5e                   	pop    %esi
+ 32a:	5d                   	pop    %ebp
+ 32b:	c3                   	ret
+    return -1;
+ 32c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 331:	eb f0                	jmp    323 <stat+0x34>
+
+00000333 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 333:	55                   	push   %ebp
+ 334:	89 e5                	mov    %esp,%ebp
+ 336:	56                   	push   %esi
+ 337:	53                   	push   %ebx
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 33b:	0f b6 0a             	movzbl (%edx),%ecx
+ 33e:	80 f9 20             	cmp    $0x20,%cl
+ 341:	75 0b                	jne    34e <atoi+0x1b>
+ 343:	83 c2 01             	add    $0x1,%edx
+ 346:	0f b6 0a             	movzbl (%edx),%ecx
+ 349:	80 f9 20             	cmp    $0x20,%cl
+ 34c:	74 f5                	je     343 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 34e:	80 f9 2d             	cmp    $0x2d,%cl
+ 351:	74 3c                	je     38f <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 353:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 356:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 35b:	f6 c1 fd             	test   $0xfd,%cl
+ 35e:	74 34                	je     394 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 360:	0f b6 0a             	movzbl (%edx),%ecx
+ 363:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 366:	3c 09                	cmp    $0x9,%al
+ 368:	77 2f                	ja     399 <atoi+0x66>
+ 36a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 36f:	83 c2 01             	add    $0x1,%edx
+ 372:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 375:	0f be c9             	movsbl %cl,%ecx
+ 378:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 37c:	0f b6 0a             	movzbl (%edx),%ecx
+ 37f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 382:	3c 09                	cmp    $0x9,%al
+ 384:	76 e9                	jbe    36f <atoi+0x3c>
+  return sign*n;
+ 386:	89 f0                	mov    %esi,%eax
+ 388:	0f af c3             	imul   %ebx,%eax
+}
+ 38b:	5b                   	pop    %ebx
+ 38c:	5e                   	pop    %esi
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 38f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 394:	83 c2 01             	add    $0x1,%edx
+ 397:	eb c7                	jmp    360 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 399:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 39e:	eb e6                	jmp    386 <atoi+0x53>
+
+000003a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+ 3a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3a8:	0f b6 0a             	movzbl (%edx),%ecx
+ 3ab:	80 f9 20             	cmp    $0x20,%cl
+ 3ae:	75 0b                	jne    3bb <atoo+0x1b>
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	0f b6 0a             	movzbl (%edx),%ecx
+ 3b6:	80 f9 20             	cmp    $0x20,%cl
+ 3b9:	74 f5                	je     3b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3bb:	80 f9 2d             	cmp    $0x2d,%cl
+ 3be:	74 3a                	je     3fa <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 3c0:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 3c3:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3c8:	f6 c1 fd             	test   $0xfd,%cl
+ 3cb:	74 32                	je     3ff <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 3cd:	0f b6 0a             	movzbl (%edx),%ecx
+ 3d0:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3d3:	80 fb 07             	cmp    $0x7,%bl
+ 3d6:	77 2c                	ja     404 <atoo+0x64>
+ 3d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 3dd:	83 c2 01             	add    $0x1,%edx
+ 3e0:	0f be c9             	movsbl %cl,%ecx
+ 3e3:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 3e7:	0f b6 0a             	movzbl (%edx),%ecx
+ 3ea:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 3ed:	3c 07                	cmp    $0x7,%al
+ 3ef:	76 ec                	jbe    3dd <atoo+0x3d>
+  return sign*n;
+ 3f1:	89 f0                	mov    %esi,%eax
+ 3f3:	0f af c3             	imul   %ebx,%eax
+}
+ 3f6:	5b                   	pop    %ebx
+ 3f7:	5e                   	pop    %esi
+ 3f8:	5d                   	pop    %ebp
+ 3f9:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 3fa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3ff:	83 c2 01             	add    $0x1,%edx
+ 402:	eb c9                	jmp    3cd <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 404:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 409:	eb e6                	jmp    3f1 <atoo+0x51>
+
+0000040b <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 40b:	55                   	push   %ebp
+ 40c:	89 e5                	mov    %esp,%ebp
+ 40e:	56                   	push   %esi
+ 40f:	53                   	push   %ebx
+ 410:	8b 75 08             	mov    0x8(%ebp),%esi
+ 413:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 416:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 419:	85 db                	test   %ebx,%ebx
+ 41b:	7e 15                	jle    432 <memmove+0x27>
+ 41d:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 41f:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 421:	83 c2 01             	add    $0x1,%edx
+ 424:	83 c0 01             	add    $0x1,%eax
+ 427:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 42b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 42e:	39 c3                	cmp    %eax,%ebx
+ 430:	75 ef                	jne    421 <memmove+0x16>
+  return vdst;
+}
+ 432:	89 f0                	mov    %esi,%eax
+ 434:	5b                   	pop    %ebx
+ 435:	5e                   	pop    %esi
+ 436:	5d                   	pop    %ebp
+ 437:	c3                   	ret
+
+00000438 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 438:	b8 01 00 00 00       	mov    $0x1,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <exit>:
+SYSCALL(exit)
+ 440:	b8 02 00 00 00       	mov    $0x2,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <wait>:
+SYSCALL(wait)
+ 448:	b8 03 00 00 00       	mov    $0x3,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <pipe>:
+SYSCALL(pipe)
+ 450:	b8 04 00 00 00       	mov    $0x4,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <read>:
+SYSCALL(read)
+ 458:	b8 05 00 00 00       	mov    $0x5,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <write>:
+SYSCALL(write)
+ 460:	b8 10 00 00 00       	mov    $0x10,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <close>:
+SYSCALL(close)
+ 468:	b8 15 00 00 00       	mov    $0x15,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <kill>:
+SYSCALL(kill)
+ 470:	b8 06 00 00 00       	mov    $0x6,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <exec>:
+SYSCALL(exec)
+ 478:	b8 07 00 00 00       	mov    $0x7,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <open>:
+SYSCALL(open)
+ 480:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <mknod>:
+SYSCALL(mknod)
+ 488:	b8 11 00 00 00       	mov    $0x11,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <unlink>:
+SYSCALL(unlink)
+ 490:	b8 12 00 00 00       	mov    $0x12,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <fstat>:
+SYSCALL(fstat)
+ 498:	b8 08 00 00 00       	mov    $0x8,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <link>:
+SYSCALL(link)
+ 4a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <mkdir>:
+SYSCALL(mkdir)
+ 4a8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <chdir>:
+SYSCALL(chdir)
+ 4b0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <dup>:
+SYSCALL(dup)
+ 4b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <getpid>:
+SYSCALL(getpid)
+ 4c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <sbrk>:
+SYSCALL(sbrk)
+ 4c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <sleep>:
+SYSCALL(sleep)
+ 4d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <uptime>:
+SYSCALL(uptime)
+ 4d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <halt>:
+SYSCALL(halt)
+ 4e0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <date>:
+SYSCALL(date)
+ 4e8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <getuid>:
+SYSCALL(getuid)
+ 4f0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <getgid>:
+SYSCALL(getgid)
+ 4f8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <getppid>:
+SYSCALL(getppid)
+ 500:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <setuid>:
+SYSCALL(setuid)
+ 508:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <setgid>:
+SYSCALL(setgid)
+ 510:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <getprocs>:
+SYSCALL(getprocs)
+ 518:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <setpriority>:
+SYSCALL(setpriority)
+ 520:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <getpriority>:
+SYSCALL(getpriority)
+ 528:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <waitpid>:
+SYSCALL(waitpid)
+ 530:	b8 20 00 00 00       	mov    $0x20,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <setaffinity>:
+SYSCALL(setaffinity)
+ 538:	b8 21 00 00 00       	mov    $0x21,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <getaffinity>:
+SYSCALL(getaffinity)
+ 540:	b8 22 00 00 00       	mov    $0x22,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <setdeadline>:
+SYSCALL(setdeadline)
+ 548:	b8 23 00 00 00       	mov    $0x23,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <schedctl>:
+SYSCALL(schedctl)
+ 550:	b8 24 00 00 00       	mov    $0x24,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <spawn>:
+SYSCALL(spawn)
+ 558:	b8 25 00 00 00       	mov    $0x25,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <vmstats>:
+SYSCALL(vmstats)
+ 560:	b8 26 00 00 00       	mov    $0x26,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 568:	b8 27 00 00 00       	mov    $0x27,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <setshares>:
+SYSCALL(setshares)
+ 570:	b8 28 00 00 00       	mov    $0x28,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <getshares>:
+SYSCALL(getshares)
+ 578:	b8 29 00 00 00       	mov    $0x29,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 3c             	sub    $0x3c,%esp
+ 589:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 58c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 58e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 592:	74 79                	je     60d <printint+0x8d>
+ 594:	85 d2                	test   %edx,%edx
+ 596:	79 75                	jns    60d <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 598:	89 d1                	mov    %edx,%ecx
+ 59a:	f7 d9                	neg    %ecx
+    neg = 1;
+ 59c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 5a8:	89 df                	mov    %ebx,%edi
+ 5aa:	83 c3 01             	add    $0x1,%ebx
+ 5ad:	89 c8                	mov    %ecx,%eax
+ 5af:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b4:	f7 f6                	div    %esi
+ 5b6:	0f b6 92 58 0a 00 00 	movzbl 0xa58(%edx),%edx
+ 5bd:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 5c1:	89 ca                	mov    %ecx,%edx
+ 5c3:	89 c1                	mov    %eax,%ecx
+ 5c5:	39 f2                	cmp    %esi,%edx
+ 5c7:	73 df                	jae    5a8 <printint+0x28>
+  if(neg)
+ 5c9:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 5cd:	74 08                	je     5d7 <printint+0x57>
+    buf[i++] = '-';
+ 5cf:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 5d4:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 5d7:	85 db                	test   %ebx,%ebx
+ 5d9:	7e 2a                	jle    605 <printint+0x85>
+ 5db:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 5de:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 5e2:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 5e5:	0f b6 03             	movzbl (%ebx),%eax
+ 5e8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	6a 01                	push   $0x1
+ 5f0:	57                   	push   %edi
+ 5f1:	ff 75 c4             	push   -0x3c(%ebp)
+ 5f4:	e8 67 fe ff ff       	call   460 <write>
+  while(--i >= 0)
+ 5f9:	89 d8                	mov    %ebx,%eax
+ 5fb:	83 eb 01             	sub    $0x1,%ebx
+ 5fe:	83 c4 10             	add    $0x10,%esp
+ 601:	39 f0                	cmp    %esi,%eax
+ 603:	75 e0                	jne    5e5 <printint+0x65>
+}
+ 605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 608:	5b                   	pop    %ebx
+ 609:	5e                   	pop    %esi
+ 60a:	5f                   	pop    %edi
+ 60b:	5d                   	pop    %ebp
+ 60c:	c3                   	ret
+    x = xx;
+ 60d:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 60f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 616:	eb 8b                	jmp    5a3 <printint+0x23>
+
+00000618 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 618:	55                   	push   %ebp
+ 619:	89 e5                	mov    %esp,%ebp
+ 61b:	57                   	push   %edi
+ 61c:	56                   	push   %esi
+ 61d:	53                   	push   %ebx
+ 61e:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 621:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 624:	0f b6 1e             	movzbl (%esi),%ebx
+ 627:	84 db                	test   %bl,%bl
+ 629:	0f 84 9e 01 00 00    	je     7cd <printf+0x1b5>
+ 62f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 632:	8d 45 10             	lea    0x10(%ebp),%eax
+ 635:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 638:	bf 00 00 00 00       	mov    $0x0,%edi
+ 63d:	eb 2d                	jmp    66c <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 63f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 642:	83 ec 04             	sub    $0x4,%esp
+ 645:	6a 01                	push   $0x1
+ 647:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 64a:	50                   	push   %eax
+ 64b:	ff 75 08             	push   0x8(%ebp)
+ 64e:	e8 0d fe ff ff       	call   460 <write>
+        putc(fd, c);
+ 653:	83 c4 10             	add    $0x10,%esp
+ 656:	eb 05                	jmp    65d <printf+0x45>
+      }
+    } else if(state == '%'){
+ 658:	83 ff 25             	cmp    $0x25,%edi
+ 65b:	74 1f                	je     67c <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 65d:	83 c6 01             	add    $0x1,%esi
+ 660:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 664:	84 db                	test   %bl,%bl
+ 666:	0f 84 61 01 00 00    	je     7cd <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 66c:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 66f:	85 ff                	test   %edi,%edi
+ 671:	75 e5                	jne    658 <printf+0x40>
+      if(c == '%'){
+ 673:	83 f8 25             	cmp    $0x25,%eax
+ 676:	75 c7                	jne    63f <printf+0x27>
+        state = '%';
+ 678:	89 c7                	mov    %eax,%edi
+ 67a:	eb e1                	jmp    65d <printf+0x45>
+      if(c == 'd'){
+ 67c:	83 f8 25             	cmp    $0x25,%eax
+ 67f:	0f 84 f4 00 00 00    	je     779 <printf+0x161>
+ 685:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 688:	83 fa 15             	cmp    $0x15,%edx
+ 68b:	0f 87 09 01 00 00    	ja     79a <printf+0x182>
+ 691:	0f 87 03 01 00 00    	ja     79a <printf+0x182>
+ 697:	ff 24 95 00 0a 00 00 	jmp    *0xa00(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 69e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 6a1:	8b 17                	mov    (%edi),%edx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	6a 01                	push   $0x1
+ 6a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b0:	e8 cb fe ff ff       	call   580 <printint>
+        ap++;
+ 6b5:	83 c7 04             	add    $0x4,%edi
+ 6b8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 6bb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 6be:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6c3:	eb 98                	jmp    65d <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 6c5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 6c8:	8b 17                	mov    (%edi),%edx
+ 6ca:	83 ec 0c             	sub    $0xc,%esp
+ 6cd:	6a 00                	push   $0x0
+ 6cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d7:	e8 a4 fe ff ff       	call   580 <printint>
+        ap++;
+ 6dc:	83 c7 04             	add    $0x4,%edi
+ 6df:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 6e2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6ea:	e9 6e ff ff ff       	jmp    65d <printf+0x45>
+        s = (char*)*ap;
+ 6ef:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 6f2:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 6f4:	83 c1 04             	add    $0x4,%ecx
+ 6f7:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 6fa:	85 c0                	test   %eax,%eax
+ 6fc:	74 13                	je     711 <printf+0xf9>
+        s = (char*)*ap;
+ 6fe:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 700:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 703:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 0f                	jne    71b <printf+0x103>
+ 70c:	e9 4c ff ff ff       	jmp    65d <printf+0x45>
+          s = "(null)";
+ 711:	bb f6 09 00 00       	mov    $0x9f6,%ebx
+        while(*s != 0){
+ 716:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 71b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 71e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 721:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 724:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 727:	83 ec 04             	sub    $0x4,%esp
+ 72a:	6a 01                	push   $0x1
+ 72c:	57                   	push   %edi
+ 72d:	56                   	push   %esi
+ 72e:	e8 2d fd ff ff       	call   460 <write>
+          s++;
+ 733:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 736:	0f b6 03             	movzbl (%ebx),%eax
+ 739:	83 c4 10             	add    $0x10,%esp
+ 73c:	84 c0                	test   %al,%al
+ 73e:	75 e4                	jne    724 <printf+0x10c>
+      state = 0;
+ 740:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 743:	bf 00 00 00 00       	mov    $0x0,%edi
+ 748:	e9 10 ff ff ff       	jmp    65d <printf+0x45>
+        putc(fd, *ap);
+ 74d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 750:	8b 07                	mov    (%edi),%eax
+ 752:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 755:	83 ec 04             	sub    $0x4,%esp
+ 758:	6a 01                	push   $0x1
+ 75a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 75d:	50                   	push   %eax
+ 75e:	ff 75 08             	push   0x8(%ebp)
+ 761:	e8 fa fc ff ff       	call   460 <write>
+        ap++;
+ 766:	83 c7 04             	add    $0x4,%edi
+ 769:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 76c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 774:	e9 e4 fe ff ff       	jmp    65d <printf+0x45>
+        putc(fd, c);
+ 779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 77c:	83 ec 04             	sub    $0x4,%esp
+ 77f:	6a 01                	push   $0x1
+ 781:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 784:	50                   	push   %eax
+ 785:	ff 75 08             	push   0x8(%ebp)
+ 788:	e8 d3 fc ff ff       	call   460 <write>
+ 78d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 790:	bf 00 00 00 00       	mov    $0x0,%edi
+ 795:	e9 c3 fe ff ff       	jmp    65d <printf+0x45>
+        putc(fd, '%');
+ 79a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 79e:	83 ec 04             	sub    $0x4,%esp
+ 7a1:	6a 01                	push   $0x1
+ 7a3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 7a6:	57                   	push   %edi
+ 7a7:	ff 75 08             	push   0x8(%ebp)
+ 7aa:	e8 b1 fc ff ff       	call   460 <write>
+        putc(fd, c);
+ 7af:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7b2:	83 c4 0c             	add    $0xc,%esp
+ 7b5:	6a 01                	push   $0x1
+ 7b7:	57                   	push   %edi
+ 7b8:	ff 75 08             	push   0x8(%ebp)
+ 7bb:	e8 a0 fc ff ff       	call   460 <write>
+        putc(fd, c);
+ 7c0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7c3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7c8:	e9 90 fe ff ff       	jmp    65d <printf+0x45>
+    }
+  }
+}
+ 7cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d0:	5b                   	pop    %ebx
+ 7d1:	5e                   	pop    %esi
+ 7d2:	5f                   	pop    %edi
+ 7d3:	5d                   	pop    %ebp
+ 7d4:	c3                   	ret
+
+000007d5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d5:	55                   	push   %ebp
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	a1 f8 0c 00 00       	mov    0xcf8,%eax
+ 7e6:	eb 0c                	jmp    7f4 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e8:	8b 10                	mov    (%eax),%edx
+ 7ea:	39 d0                	cmp    %edx,%eax
+ 7ec:	72 04                	jb     7f2 <free+0x1d>
+ 7ee:	39 d1                	cmp    %edx,%ecx
+ 7f0:	72 10                	jb     802 <free+0x2d>
+{
+ 7f2:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f4:	39 c8                	cmp    %ecx,%eax
+ 7f6:	73 f0                	jae    7e8 <free+0x13>
+ 7f8:	8b 10                	mov    (%eax),%edx
+ 7fa:	39 d1                	cmp    %edx,%ecx
+ 7fc:	72 04                	jb     802 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7fe:	39 d0                	cmp    %edx,%eax
+ 800:	72 f0                	jb     7f2 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 802:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 805:	8b 10                	mov    (%eax),%edx
+ 807:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 80a:	39 fa                	cmp    %edi,%edx
+ 80c:	74 19                	je     827 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 80e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 811:	8b 50 04             	mov    0x4(%eax),%edx
+ 814:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 817:	39 f1                	cmp    %esi,%ecx
+ 819:	74 18                	je     833 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 81b:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 81d:	a3 f8 0c 00 00       	mov    %eax,0xcf8
+}
+ 822:	5b                   	pop    %ebx
+ 823:	5e                   	pop    %esi
+ 824:	5f                   	pop    %edi
+ 825:	5d                   	pop    %ebp
+ 826:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 827:	03 72 04             	add    0x4(%edx),%esi
+ 82a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 82d:	8b 10                	mov    (%eax),%edx
+ 82f:	8b 12                	mov    (%edx),%edx
+ 831:	eb db                	jmp    80e <free+0x39>
+    p->s.size += bp->s.size;
+ 833:	03 53 fc             	add    -0x4(%ebx),%edx
+ 836:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 839:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 83c:	eb dd                	jmp    81b <free+0x46>
+
+0000083e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 83e:	55                   	push   %ebp
+ 83f:	89 e5                	mov    %esp,%ebp
+ 841:	57                   	push   %edi
+ 842:	56                   	push   %esi
+ 843:	53                   	push   %ebx
+ 844:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 847:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 84d:	c1 eb 03             	shr    $0x3,%ebx
+ 850:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 853:	8b 15 f8 0c 00 00    	mov    0xcf8,%edx
+ 859:	85 d2                	test   %edx,%edx
+ 85b:	74 1c                	je     879 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 85d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 85f:	8b 48 04             	mov    0x4(%eax),%ecx
+ 862:	39 d9                	cmp    %ebx,%ecx
+ 864:	73 38                	jae    89e <malloc+0x60>
+  if(nu < 4096)
+ 866:	be 00 10 00 00       	mov    $0x1000,%esi
+ 86b:	39 f3                	cmp    %esi,%ebx
+ 86d:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 870:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 877:	eb 72                	jmp    8eb <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 879:	c7 05 f8 0c 00 00 fc 	movl   $0xcfc,0xcf8
+ 880:	0c 00 00 
+ 883:	c7 05 fc 0c 00 00 fc 	movl   $0xcfc,0xcfc
+ 88a:	0c 00 00 
+    base.s.size = 0;
+ 88d:	c7 05 00 0d 00 00 00 	movl   $0x0,0xd00
+ 894:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 897:	b8 fc 0c 00 00       	mov    $0xcfc,%eax
+    if(p->s.size >= nunits){
+ 89c:	eb c8                	jmp    866 <malloc+0x28>
+      if(p->s.size == nunits)
+ 89e:	39 cb                	cmp    %ecx,%ebx
+ 8a0:	74 1e                	je     8c0 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 8a2:	29 d9                	sub    %ebx,%ecx
+ 8a4:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8a7:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8aa:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 8ad:	89 15 f8 0c 00 00    	mov    %edx,0xcf8
+      return (void*)(p + 1);
+ 8b3:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 8b6:	89 d0                	mov    %edx,%eax
+ 8b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8bb:	5b                   	pop    %ebx
+ 8bc:	5e                   	pop    %esi
+ 8bd:	5f                   	pop    %edi
+ 8be:	5d                   	pop    %ebp
+ 8bf:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 8c0:	8b 08                	mov    (%eax),%ecx
+ 8c2:	89 0a                	mov    %ecx,(%edx)
+ 8c4:	eb e7                	jmp    8ad <malloc+0x6f>
+  hp->s.size = nu;
+ 8c6:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 8c9:	83 ec 0c             	sub    $0xc,%esp
+ 8cc:	83 c0 08             	add    $0x8,%eax
+ 8cf:	50                   	push   %eax
+ 8d0:	e8 00 ff ff ff       	call   7d5 <free>
+  return freep;
+ 8d5:	8b 15 f8 0c 00 00    	mov    0xcf8,%edx
+      if((p = morecore(nunits)) == 0)
+ 8db:	83 c4 10             	add    $0x10,%esp
+ 8de:	85 d2                	test   %edx,%edx
+ 8e0:	74 d4                	je     8b6 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e2:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e4:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e7:	39 d9                	cmp    %ebx,%ecx
+ 8e9:	73 b3                	jae    89e <malloc+0x60>
+    if(p == freep)
+ 8eb:	89 c2                	mov    %eax,%edx
+ 8ed:	39 05 f8 0c 00 00    	cmp    %eax,0xcf8
+ 8f3:	75 ed                	jne    8e2 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 8f5:	83 ec 0c             	sub    $0xc,%esp
+ 8f8:	57                   	push   %edi
+ 8f9:	e8 ca fb ff ff       	call   4c8 <sbrk>
+  if(p == (char*)-1)
+ 8fe:	83 c4 10             	add    $0x10,%esp
+ 901:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 904:	75 c0                	jne    8c6 <malloc+0x88>
+        return 0;
+ 906:	ba 00 00 00 00       	mov    $0x0,%edx
+ 90b:	eb a9                	jmp    8b6 <malloc+0x78>
@@ -0,0 +1,59 @@
+#ifdef CS333_P4
+#include "types.h"
+#include "user.h"
+#include "schedctl.h"
+
+// Show or tune the scheduler without a rebuild:
+//   schedctl                        print the settings
+//   schedctl quantum <level> <ticks>
+//   schedctl budget <ticks>
+//   schedctl promote <ticks>
+//   schedctl maxproc <n>
+
+static void
+usage(void)
+{
+  printf(2, "usage: schedctl [quantum level ticks | budget ticks | "
+            "promote ticks | maxproc n]\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct schedparams sp;
+  int level;
+
+  if(schedctl(SCHED_GET, &sp) < 0){
+    printf(2, "schedctl: cannot read settings\n");
+    exit();
+  }
+
+  if(argc == 1){
+    printf(1, "Level\tQuantum\n");
+    for(level = MAXPRIO; level >= 0; level--)
+      printf(1, "%d\t%d\n", level, sp.quantum[level]);
+    printf(1, "budget %d\npromote %d\nmaxproc %d\n",
+           sp.budget, sp.promote, sp.maxproc);
+    exit();
+  }
+
+  if(strcmp(argv[1], "quantum") == 0 && argc == 4){
+    level = atoi(argv[2]);
+    if(level < 0 || level > MAXPRIO)
+      usage();
+    sp.quantum[level] = atoi(argv[3]);
+  } else if(strcmp(argv[1], "budget") == 0 && argc == 3)
+    sp.budget = atoi(argv[2]);
+  else if(strcmp(argv[1], "promote") == 0 && argc == 3)
+    sp.promote = atoi(argv[2]);
+  else if(strcmp(argv[1], "maxproc") == 0 && argc == 3)
+    sp.maxproc = atoi(argv[2]);
+  else
+    usage();
+
+  if(schedctl(SCHED_SET, &sp) < 0)
+    printf(2, "schedctl: invalid setting\n");
+  exit();
+}
+#endif // CS333_P4
@@ -0,0 +1,12 @@
+#ifdef CS333_P4
+// Scheduler and process table tunables, read and set with schedctl().
+#define SCHED_GET 0
+#define SCHED_SET 1
+
+struct schedparams {
+  uint quantum[MAXPRIO+1];  // Ticks a process at each level runs per dispatch
+  uint budget;              // Ticks at a level before demotion
+  uint promote;             // Ticks between promotions
+  uint maxproc;             // Most processes at once, up to MAXPROC
+};
+#endif // CS333_P4
@@ -0,0 +1,2949 @@
+
+_schedstress:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <waitall>:
+// it more complicated than it really needs to be.
+
+// wait for all children - just keep calling wait() until it fails due to not
+// having any children.
+void
+waitall(void) {
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  while(wait() != -1);
+       6:	e8 a5 10 00 00       	call   10b0 <wait>
+       b:	83 f8 ff             	cmp    $0xffffffff,%eax
+       e:	75 f6                	jne    6 <waitall+0x6>
+}
+      10:	c9                   	leave
+      11:	c3                   	ret
+
+00000012 <queuebound>:
+
+// high-priority locking process. starts a process that locks itself into queue
+// Q until it counts up to N.
+void
+queuebound(int q, unsigned int n) {
+      12:	55                   	push   %ebp
+      13:	89 e5                	mov    %esp,%ebp
+      15:	56                   	push   %esi
+      16:	53                   	push   %ebx
+  if(fork() == 0) {
+      17:	e8 84 10 00 00       	call   10a0 <fork>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	74 07                	je     27 <queuebound+0x15>
+    for(unsigned int i = 0;i < n;i++) {
+      setpriority(pid, q);
+    }
+    exit();
+  }
+}
+      20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      23:	5b                   	pop    %ebx
+      24:	5e                   	pop    %esi
+      25:	5d                   	pop    %ebp
+      26:	c3                   	ret
+    int pid = getpid();
+      27:	e8 fc 10 00 00       	call   1128 <getpid>
+      2c:	89 c6                	mov    %eax,%esi
+    for(unsigned int i = 0;i < n;i++) {
+      2e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+      32:	74 1c                	je     50 <queuebound+0x3e>
+      34:	bb 00 00 00 00       	mov    $0x0,%ebx
+      setpriority(pid, q);
+      39:	83 ec 08             	sub    $0x8,%esp
+      3c:	ff 75 08             	push   0x8(%ebp)
+      3f:	56                   	push   %esi
+      40:	e8 43 11 00 00       	call   1188 <setpriority>
+    for(unsigned int i = 0;i < n;i++) {
+      45:	83 c3 01             	add    $0x1,%ebx
+      48:	83 c4 10             	add    $0x10,%esp
+      4b:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+      4e:	75 e9                	jne    39 <queuebound+0x27>
+    exit();
+      50:	e8 53 10 00 00       	call   10a8 <exit>
+
+00000055 <test1>:
+// Test 1: queue priority. Start a few low-priority processes that print values
+// on a delay, then start four CPU-bound processes that lock themselves into
+// priority 0. Values should stop printing while the high-priority processes
+// run.
+void
+test1(void) {
+      55:	55                   	push   %ebp
+      56:	89 e5                	mov    %esp,%ebp
+      58:	56                   	push   %esi
+      59:	53                   	push   %ebx
+  printf(1, "\n> starting test 1\n");
+      5a:	83 ec 08             	sub    $0x8,%esp
+      5d:	68 78 15 00 00       	push   $0x1578
+      62:	6a 01                	push   $0x1
+      64:	e8 17 12 00 00       	call   1280 <printf>
+
+  // start low-priority printing processes
+  for(int i = 0;i < 2;i++) {
+    if(fork() == 0) {
+      69:	e8 32 10 00 00       	call   10a0 <fork>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	85 c0                	test   %eax,%eax
+      73:	74 47                	je     bc <test1+0x67>
+      75:	e8 26 10 00 00       	call   10a0 <fork>
+      7a:	85 c0                	test   %eax,%eax
+      7c:	74 3e                	je     bc <test1+0x67>
+        sleep(10);
+      }
+      exit();
+    }
+  }
+  sleep(20); // wait for a few low priority values to print
+      7e:	83 ec 0c             	sub    $0xc,%esp
+      81:	6a 14                	push   $0x14
+      83:	e8 b0 10 00 00       	call   1138 <sleep>
+      88:	83 c4 10             	add    $0x10,%esp
+      8b:	bb 04 00 00 00       	mov    $0x4,%ebx
+
+  // start high-priority processes
+  for(int i = 0;i < 4;i++) {
+    if(fork() == 0) {
+      90:	e8 0b 10 00 00       	call   10a0 <fork>
+      95:	85 c0                	test   %eax,%eax
+      97:	74 77                	je     110 <test1+0xbb>
+  for(int i = 0;i < 4;i++) {
+      99:	83 eb 01             	sub    $0x1,%ebx
+      9c:	75 f2                	jne    90 <test1+0x3b>
+      printf(1, "high-priority end\n");
+      exit();
+    }
+  }
+
+  waitall();
+      9e:	e8 5d ff ff ff       	call   0 <waitall>
+  printf(1, "\n> test 1 complete\n");
+      a3:	83 ec 08             	sub    $0x8,%esp
+      a6:	68 c6 15 00 00       	push   $0x15c6
+      ab:	6a 01                	push   $0x1
+      ad:	e8 ce 11 00 00       	call   1280 <printf>
+}
+      b2:	83 c4 10             	add    $0x10,%esp
+      b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      b8:	5b                   	pop    %ebx
+      b9:	5e                   	pop    %esi
+      ba:	5d                   	pop    %ebp
+      bb:	c3                   	ret
+      setpriority(getpid(), MAX_PRIORITY); // deprioritize ourselves
+      bc:	e8 67 10 00 00       	call   1128 <getpid>
+      c1:	83 ec 08             	sub    $0x8,%esp
+      c4:	6a 07                	push   $0x7
+      c6:	50                   	push   %eax
+      c7:	e8 bc 10 00 00       	call   1188 <setpriority>
+      cc:	83 c4 10             	add    $0x10,%esp
+      for(int n = 0;n < 5;n++) {
+      cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        printf(1, "low-priority #%d\n", n);
+      d4:	83 ec 04             	sub    $0x4,%esp
+      d7:	53                   	push   %ebx
+      d8:	68 8c 15 00 00       	push   $0x158c
+      dd:	6a 01                	push   $0x1
+      df:	e8 9c 11 00 00       	call   1280 <printf>
+        setpriority(getpid(), MAX_PRIORITY);
+      e4:	e8 3f 10 00 00       	call   1128 <getpid>
+      e9:	83 c4 08             	add    $0x8,%esp
+      ec:	6a 07                	push   $0x7
+      ee:	50                   	push   %eax
+      ef:	e8 94 10 00 00       	call   1188 <setpriority>
+        sleep(10);
+      f4:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+      fb:	e8 38 10 00 00       	call   1138 <sleep>
+      for(int n = 0;n < 5;n++) {
+     100:	83 c3 01             	add    $0x1,%ebx
+     103:	83 c4 10             	add    $0x10,%esp
+     106:	83 fb 05             	cmp    $0x5,%ebx
+     109:	75 c9                	jne    d4 <test1+0x7f>
+      exit();
+     10b:	e8 98 0f 00 00       	call   10a8 <exit>
+      int pid = getpid();
+     110:	e8 13 10 00 00       	call   1128 <getpid>
+     115:	89 c6                	mov    %eax,%esi
+      printf(1, "high-priority start\n");
+     117:	83 ec 08             	sub    $0x8,%esp
+     11a:	68 9e 15 00 00       	push   $0x159e
+     11f:	6a 01                	push   $0x1
+     121:	e8 5a 11 00 00       	call   1280 <printf>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	bb 00 00 10 00       	mov    $0x100000,%ebx
+        setpriority(pid, 0); // lock into queue 0
+     12e:	83 ec 08             	sub    $0x8,%esp
+     131:	6a 00                	push   $0x0
+     133:	56                   	push   %esi
+     134:	e8 4f 10 00 00       	call   1188 <setpriority>
+      for(unsigned int i = 0;i < 0x100000;i++) {
+     139:	83 c4 10             	add    $0x10,%esp
+     13c:	83 eb 01             	sub    $0x1,%ebx
+     13f:	75 ed                	jne    12e <test1+0xd9>
+      printf(1, "high-priority end\n");
+     141:	83 ec 08             	sub    $0x8,%esp
+     144:	68 b3 15 00 00       	push   $0x15b3
+     149:	6a 01                	push   $0x1
+     14b:	e8 30 11 00 00       	call   1280 <printf>
+      exit();
+     150:	e8 53 0f 00 00       	call   10a8 <exit>
+
+00000155 <test2>:
+// The highest-priority process should run quickly and print its value. Each
+// subsequent promotion delay, a new process will be moved into queue 0 and get
+// a chance to run. This will manifest as an ascending sequence of numbers (one
+// for each queue).
+void
+test2(void) {
+     155:	55                   	push   %ebp
+     156:	89 e5                	mov    %esp,%ebp
+     158:	53                   	push   %ebx
+     159:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "\n> starting test 2\n");
+     15c:	68 da 15 00 00       	push   $0x15da
+     161:	6a 01                	push   $0x1
+     163:	e8 18 11 00 00       	call   1280 <printf>
+     168:	83 c4 10             	add    $0x10,%esp
+
+  // start processes for each queue
+  for(int i = 0;i <= MAX_PRIORITY;i++) {
+     16b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int p = fork();
+     170:	e8 2b 0f 00 00       	call   10a0 <fork>
+    if(p == 0) {
+     175:	85 c0                	test   %eax,%eax
+     177:	74 48                	je     1c1 <test2+0x6c>
+      sleep(10);
+      printf(1, "queue %d!\n", i);
+      exit();
+    } else {
+      setpriority(p, i);
+     179:	83 ec 08             	sub    $0x8,%esp
+     17c:	53                   	push   %ebx
+     17d:	50                   	push   %eax
+     17e:	e8 05 10 00 00       	call   1188 <setpriority>
+  for(int i = 0;i <= MAX_PRIORITY;i++) {
+     183:	83 c3 01             	add    $0x1,%ebx
+     186:	83 c4 10             	add    $0x10,%esp
+     189:	83 fb 08             	cmp    $0x8,%ebx
+     18c:	75 e2                	jne    170 <test2+0x1b>
+    }
+  }
+
+  // high-priority processes
+  for(int i = 0;i < 8;i++)
+    queuebound(0, 0x80000);
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 00 00 08 00       	push   $0x80000
+     196:	6a 00                	push   $0x0
+     198:	e8 75 fe ff ff       	call   12 <queuebound>
+  for(int i = 0;i < 8;i++)
+     19d:	83 c4 10             	add    $0x10,%esp
+     1a0:	83 eb 01             	sub    $0x1,%ebx
+     1a3:	75 e9                	jne    18e <test2+0x39>
+
+  // wait for children
+  waitall();
+     1a5:	e8 56 fe ff ff       	call   0 <waitall>
+  printf(1, "\n> test 2 complete\n");
+     1aa:	83 ec 08             	sub    $0x8,%esp
+     1ad:	68 f9 15 00 00       	push   $0x15f9
+     1b2:	6a 01                	push   $0x1
+     1b4:	e8 c7 10 00 00       	call   1280 <printf>
+}
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1bf:	c9                   	leave
+     1c0:	c3                   	ret
+      sleep(10);
+     1c1:	83 ec 0c             	sub    $0xc,%esp
+     1c4:	6a 0a                	push   $0xa
+     1c6:	e8 6d 0f 00 00       	call   1138 <sleep>
+      printf(1, "queue %d!\n", i);
+     1cb:	83 c4 0c             	add    $0xc,%esp
+     1ce:	53                   	push   %ebx
+     1cf:	68 ee 15 00 00       	push   $0x15ee
+     1d4:	6a 01                	push   $0x1
+     1d6:	e8 a5 10 00 00       	call   1280 <printf>
+      exit();
+     1db:	e8 c8 0e 00 00       	call   10a8 <exit>
+
+000001e0 <test3>:
+// starts 4 busyloops in queue 0 and 4 in a lower-priority queue. Then, you can
+// use C-L to show the different queues. Once promotion occurs, the
+// lower-priority loops should be visible in queue 0 in the same order as they
+// were in the lower-priority queue.
+void
+test3(void) {
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	56                   	push   %esi
+     1e4:	53                   	push   %ebx
+  printf(1, "\n> starting test 3\n");
+     1e5:	83 ec 08             	sub    $0x8,%esp
+     1e8:	68 0d 16 00 00       	push   $0x160d
+     1ed:	6a 01                	push   $0x1
+     1ef:	e8 8c 10 00 00       	call   1280 <printf>
+     1f4:	83 c4 10             	add    $0x10,%esp
+     1f7:	bb 04 00 00 00       	mov    $0x4,%ebx
+    return;
+  }
+
+  // start low-priority loops
+  for(int i = 0;i < 4;i++) {
+    int p = fork();
+     1fc:	e8 9f 0e 00 00       	call   10a0 <fork>
+    if(p == 0) {
+     201:	85 c0                	test   %eax,%eax
+     203:	74 4d                	je     252 <test3+0x72>
+      // lock to priority 0
+      for(int j = 0;j < 0x100000;j++)
+        setpriority(p, 0);
+      exit();
+    } else {
+      setpriority(p, 2);
+     205:	83 ec 08             	sub    $0x8,%esp
+     208:	6a 02                	push   $0x2
+     20a:	50                   	push   %eax
+     20b:	e8 78 0f 00 00       	call   1188 <setpriority>
+  for(int i = 0;i < 4;i++) {
+     210:	83 c4 10             	add    $0x10,%esp
+     213:	83 eb 01             	sub    $0x1,%ebx
+     216:	75 e4                	jne    1fc <test3+0x1c>
+     218:	bb 04 00 00 00       	mov    $0x4,%ebx
+    }
+  }
+
+  // start high-priority loops
+  for(int i = 0;i < 4;i++)
+    queuebound(0, 0x800000);
+     21d:	83 ec 08             	sub    $0x8,%esp
+     220:	68 00 00 80 00       	push   $0x800000
+     225:	6a 00                	push   $0x0
+     227:	e8 e6 fd ff ff       	call   12 <queuebound>
+  for(int i = 0;i < 4;i++)
+     22c:	83 c4 10             	add    $0x10,%esp
+     22f:	83 eb 01             	sub    $0x1,%ebx
+     232:	75 e9                	jne    21d <test3+0x3d>
+
+  // wait for children
+  waitall();
+     234:	e8 c7 fd ff ff       	call   0 <waitall>
+  printf(1, "\n> test 3 complete\n");
+     239:	83 ec 08             	sub    $0x8,%esp
+     23c:	68 21 16 00 00       	push   $0x1621
+     241:	6a 01                	push   $0x1
+     243:	e8 38 10 00 00       	call   1280 <printf>
+     248:	83 c4 10             	add    $0x10,%esp
+}
+     24b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     24e:	5b                   	pop    %ebx
+     24f:	5e                   	pop    %esi
+     250:	5d                   	pop    %ebp
+     251:	c3                   	ret
+      p = getpid();
+     252:	e8 d1 0e 00 00       	call   1128 <getpid>
+     257:	89 c6                	mov    %eax,%esi
+      sleep(10);
+     259:	83 ec 0c             	sub    $0xc,%esp
+     25c:	6a 0a                	push   $0xa
+     25e:	e8 d5 0e 00 00       	call   1138 <sleep>
+     263:	83 c4 10             	add    $0x10,%esp
+     266:	bb 00 00 10 00       	mov    $0x100000,%ebx
+        setpriority(p, 0);
+     26b:	83 ec 08             	sub    $0x8,%esp
+     26e:	6a 00                	push   $0x0
+     270:	56                   	push   %esi
+     271:	e8 12 0f 00 00       	call   1188 <setpriority>
+      for(int j = 0;j < 0x100000;j++)
+     276:	83 c4 10             	add    $0x10,%esp
+     279:	83 eb 01             	sub    $0x1,%ebx
+     27c:	75 ed                	jne    26b <test3+0x8b>
+      exit();
+     27e:	e8 25 0e 00 00       	call   10a8 <exit>
+
+00000283 <test4>:
+// The highest-priority process should run quickly and print its value. Each
+// time the CPU-bound processes are demoted, a new process will be able to run
+// and will display its value. This will manifest as an ascending sequence of
+// numbers (one for each queue).
+void
+test4(void) {
+     283:	55                   	push   %ebp
+     284:	89 e5                	mov    %esp,%ebp
+     286:	56                   	push   %esi
+     287:	53                   	push   %ebx
+  printf(1, "\n> starting test 4\n");
+     288:	83 ec 08             	sub    $0x8,%esp
+     28b:	68 35 16 00 00       	push   $0x1635
+     290:	6a 01                	push   $0x1
+     292:	e8 e9 0f 00 00       	call   1280 <printf>
+     297:	83 c4 10             	add    $0x10,%esp
+
+  // start processes for each queue
+  for(int i = 0;i <= MAX_PRIORITY;i++) {
+     29a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int p = fork();
+     29f:	e8 fc 0d 00 00       	call   10a0 <fork>
+    if(p == 0) {
+     2a4:	85 c0                	test   %eax,%eax
+     2a6:	74 41                	je     2e9 <test4+0x66>
+      sleep(10);
+      printf(1, "queue %d!\n", i);
+      exit();
+    } else {
+      setpriority(p, i);
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	53                   	push   %ebx
+     2ac:	50                   	push   %eax
+     2ad:	e8 d6 0e 00 00       	call   1188 <setpriority>
+  for(int i = 0;i <= MAX_PRIORITY;i++) {
+     2b2:	83 c3 01             	add    $0x1,%ebx
+     2b5:	83 c4 10             	add    $0x10,%esp
+     2b8:	83 fb 08             	cmp    $0x8,%ebx
+     2bb:	75 e2                	jne    29f <test4+0x1c>
+    }
+  }
+
+  // high-priority processes
+  for(int i = 0;i < 8;i++) {
+    if(fork() == 0) {
+     2bd:	e8 de 0d 00 00       	call   10a0 <fork>
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 42                	je     308 <test4+0x85>
+  for(int i = 0;i < 8;i++) {
+     2c6:	83 eb 01             	sub    $0x1,%ebx
+     2c9:	75 f2                	jne    2bd <test4+0x3a>
+      exit();
+    }
+  }
+
+  // wait for children
+  waitall();
+     2cb:	e8 30 fd ff ff       	call   0 <waitall>
+  printf(1, "\n> test 4 complete\n");
+     2d0:	83 ec 08             	sub    $0x8,%esp
+     2d3:	68 49 16 00 00       	push   $0x1649
+     2d8:	6a 01                	push   $0x1
+     2da:	e8 a1 0f 00 00       	call   1280 <printf>
+}
+     2df:	83 c4 10             	add    $0x10,%esp
+     2e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2e5:	5b                   	pop    %ebx
+     2e6:	5e                   	pop    %esi
+     2e7:	5d                   	pop    %ebp
+     2e8:	c3                   	ret
+      sleep(10);
+     2e9:	83 ec 0c             	sub    $0xc,%esp
+     2ec:	6a 0a                	push   $0xa
+     2ee:	e8 45 0e 00 00       	call   1138 <sleep>
+      printf(1, "queue %d!\n", i);
+     2f3:	83 c4 0c             	add    $0xc,%esp
+     2f6:	53                   	push   %ebx
+     2f7:	68 ee 15 00 00       	push   $0x15ee
+     2fc:	6a 01                	push   $0x1
+     2fe:	e8 7d 0f 00 00       	call   1280 <printf>
+      exit();
+     303:	e8 a0 0d 00 00       	call   10a8 <exit>
+      int p = getpid();
+     308:	e8 1b 0e 00 00       	call   1128 <getpid>
+     30d:	89 c6                	mov    %eax,%esi
+     30f:	bb 00 00 10 00       	mov    $0x100000,%ebx
+        setpriority(p, 0);
+     314:	83 ec 08             	sub    $0x8,%esp
+     317:	6a 00                	push   $0x0
+     319:	56                   	push   %esi
+     31a:	e8 69 0e 00 00       	call   1188 <setpriority>
+      for(int j = 0;j < 0x100000;j++)
+     31f:	83 c4 10             	add    $0x10,%esp
+     322:	83 eb 01             	sub    $0x1,%ebx
+     325:	75 ed                	jne    314 <test4+0x91>
+     327:	b8 00 00 80 00       	mov    $0x800000,%eax
+      for(int j = 0;j < 0x800000;j++);
+     32c:	83 e8 01             	sub    $0x1,%eax
+     32f:	75 fb                	jne    32c <test4+0xa9>
+      exit();
+     331:	e8 72 0d 00 00       	call   10a8 <exit>
+
+00000336 <test5>:
+// run queues the elapsed time should drop roughly in proportion.
+#define T5_WORKERS 8
+#define T5_FORKS   200
+
+void
+test5(void) {
+     336:	55                   	push   %ebp
+     337:	89 e5                	mov    %esp,%ebp
+     339:	56                   	push   %esi
+     33a:	53                   	push   %ebx
+     33b:	83 ec 18             	sub    $0x18,%esp
+  int start, end;
+
+  printf(1, "\n> starting test 5\n");
+     33e:	68 5d 16 00 00       	push   $0x165d
+     343:	6a 01                	push   $0x1
+     345:	e8 36 0f 00 00       	call   1280 <printf>
+  start = uptime();
+     34a:	e8 f1 0d 00 00       	call   1140 <uptime>
+     34f:	89 c6                	mov    %eax,%esi
+     351:	83 c4 10             	add    $0x10,%esp
+     354:	bb 08 00 00 00       	mov    $0x8,%ebx
+  for(int i = 0;i < T5_WORKERS;i++) {
+    if(fork() == 0) {
+     359:	e8 42 0d 00 00       	call   10a0 <fork>
+     35e:	85 c0                	test   %eax,%eax
+     360:	74 41                	je     3a3 <test5+0x6d>
+  for(int i = 0;i < T5_WORKERS;i++) {
+     362:	83 eb 01             	sub    $0x1,%ebx
+     365:	75 f2                	jne    359 <test5+0x23>
+        for(volatile int k = 0;k < 0x4000;k++);
+      }
+      exit();
+    }
+  }
+  waitall();
+     367:	e8 94 fc ff ff       	call   0 <waitall>
+  end = uptime();
+     36c:	e8 cf 0d 00 00       	call   1140 <uptime>
+  printf(1, "%d workers, %d forks each: %d ticks\n",
+     371:	83 ec 0c             	sub    $0xc,%esp
+     374:	29 f0                	sub    %esi,%eax
+     376:	50                   	push   %eax
+     377:	68 c8 00 00 00       	push   $0xc8
+     37c:	6a 08                	push   $0x8
+     37e:	68 68 18 00 00       	push   $0x1868
+     383:	6a 01                	push   $0x1
+     385:	e8 f6 0e 00 00       	call   1280 <printf>
+         T5_WORKERS, T5_FORKS, end - start);
+  printf(1, "\n> test 5 complete\n");
+     38a:	83 c4 18             	add    $0x18,%esp
+     38d:	68 71 16 00 00       	push   $0x1671
+     392:	6a 01                	push   $0x1
+     394:	e8 e7 0e 00 00       	call   1280 <printf>
+}
+     399:	83 c4 10             	add    $0x10,%esp
+     39c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     39f:	5b                   	pop    %ebx
+     3a0:	5e                   	pop    %esi
+     3a1:	5d                   	pop    %ebp
+     3a2:	c3                   	ret
+     3a3:	bb c8 00 00 00       	mov    $0xc8,%ebx
+     3a8:	eb 52                	jmp    3fc <test5+0xc6>
+          for(volatile int k = 0;k < 0x1000;k++);
+     3aa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     3b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3b4:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+     3b9:	7f 13                	jg     3ce <test5+0x98>
+     3bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3be:	83 c0 01             	add    $0x1,%eax
+     3c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     3c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3c7:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+     3cc:	7e ed                	jle    3bb <test5+0x85>
+          exit();
+     3ce:	e8 d5 0c 00 00       	call   10a8 <exit>
+        for(volatile int k = 0;k < 0x4000;k++);
+     3d3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3dd:	3d ff 3f 00 00       	cmp    $0x3fff,%eax
+     3e2:	7f 13                	jg     3f7 <test5+0xc1>
+     3e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3e7:	83 c0 01             	add    $0x1,%eax
+     3ea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     3ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3f0:	3d ff 3f 00 00       	cmp    $0x3fff,%eax
+     3f5:	7e ed                	jle    3e4 <test5+0xae>
+      for(int j = 0;j < T5_FORKS;j++) {
+     3f7:	83 eb 01             	sub    $0x1,%ebx
+     3fa:	74 12                	je     40e <test5+0xd8>
+        int p = fork();
+     3fc:	e8 9f 0c 00 00       	call   10a0 <fork>
+        if(p == 0) {
+     401:	85 c0                	test   %eax,%eax
+     403:	74 a5                	je     3aa <test5+0x74>
+        if(p > 0)
+     405:	7e cc                	jle    3d3 <test5+0x9d>
+          wait();
+     407:	e8 a4 0c 00 00       	call   10b0 <wait>
+     40c:	eb c5                	jmp    3d3 <test5+0x9d>
+      exit();
+     40e:	e8 95 0c 00 00       	call   10a8 <exit>
+
+00000413 <test6>:
+
+// waitpid() reaps the requested child, in any order, and refuses
+// pids that are not our children.
+#define T6_CHILDREN 16
+void
+test6(void) {
+     413:	55                   	push   %ebp
+     414:	89 e5                	mov    %esp,%ebp
+     416:	57                   	push   %edi
+     417:	56                   	push   %esi
+     418:	53                   	push   %ebx
+     419:	83 ec 74             	sub    $0x74,%esp
+  int pids[T6_CHILDREN];
+  int fail = 0;
+
+  printf(1, "\n> starting test 6\n");
+     41c:	68 95 16 00 00       	push   $0x1695
+     421:	6a 01                	push   $0x1
+     423:	e8 58 0e 00 00       	call   1280 <printf>
+     428:	83 c4 10             	add    $0x10,%esp
+  for(int i = 0;i < T6_CHILDREN;i++) {
+     42b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    pids[i] = fork();
+     430:	e8 6b 0c 00 00       	call   10a0 <fork>
+     435:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+    if(pids[i] == 0) {
+     439:	85 c0                	test   %eax,%eax
+     43b:	74 17                	je     454 <test6+0x41>
+  for(int i = 0;i < T6_CHILDREN;i++) {
+     43d:	83 c3 01             	add    $0x1,%ebx
+     440:	83 fb 10             	cmp    $0x10,%ebx
+     443:	75 eb                	jne    430 <test6+0x1d>
+     445:	8d 7d a8             	lea    -0x58(%ebp),%edi
+     448:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+  int fail = 0;
+     44b:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+     452:	eb 2f                	jmp    483 <test6+0x70>
+      for(volatile int k = 0;k < 0x1000 * i;k++);
+     454:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+     45b:	c1 e3 0c             	shl    $0xc,%ebx
+     45e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     461:	39 c3                	cmp    %eax,%ebx
+     463:	7e 10                	jle    475 <test6+0x62>
+     465:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     468:	83 c0 01             	add    $0x1,%eax
+     46b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+     46e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     471:	39 d8                	cmp    %ebx,%eax
+     473:	7c f0                	jl     465 <test6+0x52>
+      exit();
+     475:	e8 2e 0c 00 00       	call   10a8 <exit>
+    }
+  }
+  for(int i = T6_CHILDREN - 1;i >= 0;i--) {
+     47a:	8d 43 fc             	lea    -0x4(%ebx),%eax
+     47d:	39 fb                	cmp    %edi,%ebx
+     47f:	74 34                	je     4b5 <test6+0xa2>
+     481:	89 c3                	mov    %eax,%ebx
+    if(pids[i] > 0 && waitpid(pids[i]) != pids[i]) {
+     483:	8b 33                	mov    (%ebx),%esi
+     485:	85 f6                	test   %esi,%esi
+     487:	7e f1                	jle    47a <test6+0x67>
+     489:	83 ec 0c             	sub    $0xc,%esp
+     48c:	56                   	push   %esi
+     48d:	e8 06 0d 00 00       	call   1198 <waitpid>
+     492:	83 c4 10             	add    $0x10,%esp
+     495:	39 c6                	cmp    %eax,%esi
+     497:	74 e1                	je     47a <test6+0x67>
+      printf(1, "waitpid(%d) failed\n", pids[i]);
+     499:	83 ec 04             	sub    $0x4,%esp
+     49c:	56                   	push   %esi
+     49d:	68 a9 16 00 00       	push   $0x16a9
+     4a2:	6a 01                	push   $0x1
+     4a4:	e8 d7 0d 00 00       	call   1280 <printf>
+     4a9:	83 c4 10             	add    $0x10,%esp
+      fail = 1;
+     4ac:	c7 45 94 01 00 00 00 	movl   $0x1,-0x6c(%ebp)
+     4b3:	eb c5                	jmp    47a <test6+0x67>
+    }
+  }
+  if(waitpid(getpid()) != -1 || waitpid(1) != -1 || wait() != -1) {
+     4b5:	e8 6e 0c 00 00       	call   1128 <getpid>
+     4ba:	83 ec 0c             	sub    $0xc,%esp
+     4bd:	50                   	push   %eax
+     4be:	e8 d5 0c 00 00       	call   1198 <waitpid>
+     4c3:	83 c4 10             	add    $0x10,%esp
+     4c6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4c9:	74 32                	je     4fd <test6+0xea>
+    printf(1, "waitpid accepted a non-child\n");
+     4cb:	83 ec 08             	sub    $0x8,%esp
+     4ce:	68 bd 16 00 00       	push   $0x16bd
+     4d3:	6a 01                	push   $0x1
+     4d5:	e8 a6 0d 00 00       	call   1280 <printf>
+     4da:	83 c4 10             	add    $0x10,%esp
+    fail = 1;
+  }
+  printf(1, "\n> test 6 %s\n", fail ? "FAILED" : "complete");
+     4dd:	b8 85 16 00 00       	mov    $0x1685,%eax
+     4e2:	83 ec 04             	sub    $0x4,%esp
+     4e5:	50                   	push   %eax
+     4e6:	68 db 16 00 00       	push   $0x16db
+     4eb:	6a 01                	push   $0x1
+     4ed:	e8 8e 0d 00 00       	call   1280 <printf>
+}
+     4f2:	83 c4 10             	add    $0x10,%esp
+     4f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4f8:	5b                   	pop    %ebx
+     4f9:	5e                   	pop    %esi
+     4fa:	5f                   	pop    %edi
+     4fb:	5d                   	pop    %ebp
+     4fc:	c3                   	ret
+  if(waitpid(getpid()) != -1 || waitpid(1) != -1 || wait() != -1) {
+     4fd:	83 ec 0c             	sub    $0xc,%esp
+     500:	6a 01                	push   $0x1
+     502:	e8 91 0c 00 00       	call   1198 <waitpid>
+     507:	83 c4 10             	add    $0x10,%esp
+     50a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     50d:	75 bc                	jne    4cb <test6+0xb8>
+     50f:	e8 9c 0b 00 00       	call   10b0 <wait>
+     514:	83 f8 ff             	cmp    $0xffffffff,%eax
+     517:	75 b2                	jne    4cb <test6+0xb8>
+  printf(1, "\n> test 6 %s\n", fail ? "FAILED" : "complete");
+     519:	83 7d 94 00          	cmpl   $0x0,-0x6c(%ebp)
+     51d:	b8 8c 16 00 00       	mov    $0x168c,%eax
+     522:	ba 85 16 00 00       	mov    $0x1685,%edx
+     527:	0f 45 c2             	cmovne %edx,%eax
+     52a:	eb b6                	jmp    4e2 <test6+0xcf>
+
+0000052c <t7run>:
+#define T7_WORKERS 4
+#define T7_SETSIZE (64*1024)
+#define T7_PASSES 200
+
+int
+t7run(int ncpu, int pin) {
+     52c:	55                   	push   %ebp
+     52d:	89 e5                	mov    %esp,%ebp
+     52f:	57                   	push   %edi
+     530:	56                   	push   %esi
+     531:	53                   	push   %ebx
+     532:	83 ec 2c             	sub    $0x2c,%esp
+  int start = uptime();
+     535:	e8 06 0c 00 00       	call   1140 <uptime>
+     53a:	89 c7                	mov    %eax,%edi
+
+  for(int i = 0;i < T7_WORKERS;i++) {
+     53c:	be 00 00 00 00       	mov    $0x0,%esi
+    if(fork() == 0) {
+     541:	e8 5a 0b 00 00       	call   10a0 <fork>
+     546:	89 c3                	mov    %eax,%ebx
+     548:	85 c0                	test   %eax,%eax
+     54a:	74 1c                	je     568 <t7run+0x3c>
+  for(int i = 0;i < T7_WORKERS;i++) {
+     54c:	83 c6 01             	add    $0x1,%esi
+     54f:	83 fe 04             	cmp    $0x4,%esi
+     552:	75 ed                	jne    541 <t7run+0x15>
+        for(int j = 0;j < n;j++)
+          sum += set[j];
+      exit();
+    }
+  }
+  waitall();
+     554:	e8 a7 fa ff ff       	call   0 <waitall>
+  return uptime() - start;
+     559:	e8 e2 0b 00 00       	call   1140 <uptime>
+     55e:	29 f8                	sub    %edi,%eax
+}
+     560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     563:	5b                   	pop    %ebx
+     564:	5e                   	pop    %esi
+     565:	5f                   	pop    %edi
+     566:	5d                   	pop    %ebp
+     567:	c3                   	ret
+      int *set = malloc(T7_SETSIZE);
+     568:	83 ec 0c             	sub    $0xc,%esp
+     56b:	68 00 00 01 00       	push   $0x10000
+     570:	e8 31 0f 00 00       	call   14a6 <malloc>
+     575:	89 c7                	mov    %eax,%edi
+      volatile int sum = 0;
+     577:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      if(pin)
+     57e:	83 c4 10             	add    $0x10,%esp
+     581:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     585:	75 34                	jne    5bb <t7run+0x8f>
+        set[j] = j;
+     587:	89 1c 9f             	mov    %ebx,(%edi,%ebx,4)
+      for(int j = 0;j < n;j++)
+     58a:	83 c3 01             	add    $0x1,%ebx
+     58d:	81 fb 00 40 00 00    	cmp    $0x4000,%ebx
+     593:	75 f2                	jne    587 <t7run+0x5b>
+     595:	bb c8 00 00 00       	mov    $0xc8,%ebx
+     59a:	8d 8f 00 00 01 00    	lea    0x10000(%edi),%ecx
+        for(int j = 0;j < n;j++)
+     5a0:	89 f8                	mov    %edi,%eax
+          sum += set[j];
+     5a2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     5a5:	03 10                	add    (%eax),%edx
+     5a7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+        for(int j = 0;j < n;j++)
+     5aa:	83 c0 04             	add    $0x4,%eax
+     5ad:	39 c8                	cmp    %ecx,%eax
+     5af:	75 f1                	jne    5a2 <t7run+0x76>
+      for(int k = 0;k < T7_PASSES;k++)
+     5b1:	83 eb 01             	sub    $0x1,%ebx
+     5b4:	75 ea                	jne    5a0 <t7run+0x74>
+      exit();
+     5b6:	e8 ed 0a 00 00       	call   10a8 <exit>
+        setaffinity(getpid(), 1 << (i % ncpu));
+     5bb:	e8 68 0b 00 00       	call   1128 <getpid>
+     5c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     5c3:	83 ec 08             	sub    $0x8,%esp
+     5c6:	89 f0                	mov    %esi,%eax
+     5c8:	99                   	cltd
+     5c9:	f7 7d 08             	idivl  0x8(%ebp)
+     5cc:	b8 01 00 00 00       	mov    $0x1,%eax
+     5d1:	89 d1                	mov    %edx,%ecx
+     5d3:	d3 e0                	shl    %cl,%eax
+     5d5:	50                   	push   %eax
+     5d6:	ff 75 d4             	push   -0x2c(%ebp)
+     5d9:	e8 c2 0b 00 00       	call   11a0 <setaffinity>
+     5de:	83 c4 10             	add    $0x10,%esp
+      for(int j = 0;j < n;j++)
+     5e1:	eb a4                	jmp    587 <t7run+0x5b>
+
+000005e3 <test7>:
+
+void
+test7(void) {
+     5e3:	55                   	push   %ebp
+     5e4:	89 e5                	mov    %esp,%ebp
+     5e6:	56                   	push   %esi
+     5e7:	53                   	push   %ebx
+  int mask = getaffinity(getpid());
+     5e8:	e8 3b 0b 00 00       	call   1128 <getpid>
+     5ed:	83 ec 0c             	sub    $0xc,%esp
+     5f0:	50                   	push   %eax
+     5f1:	e8 b2 0b 00 00       	call   11a8 <getaffinity>
+     5f6:	89 c6                	mov    %eax,%esi
+  int ncpu = 0;
+
+  printf(1, "\n> starting test 7\n");
+     5f8:	83 c4 08             	add    $0x8,%esp
+     5fb:	68 e9 16 00 00       	push   $0x16e9
+     600:	6a 01                	push   $0x1
+     602:	e8 79 0c 00 00       	call   1280 <printf>
+     607:	83 c4 10             	add    $0x10,%esp
+  for(int i = 0;i < 32;i++)
+     60a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  int ncpu = 0;
+     60f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(mask & (1 << i))
+     614:	89 f0                	mov    %esi,%eax
+     616:	d3 f8                	sar    %cl,%eax
+     618:	83 e0 01             	and    $0x1,%eax
+      ncpu++;
+     61b:	83 f8 01             	cmp    $0x1,%eax
+     61e:	83 db ff             	sbb    $0xffffffff,%ebx
+  for(int i = 0;i < 32;i++)
+     621:	83 c1 01             	add    $0x1,%ecx
+     624:	83 f9 20             	cmp    $0x20,%ecx
+     627:	75 eb                	jne    614 <test7+0x31>
+  printf(1, "%d workers on %d cpus, unpinned: %d ticks\n",
+     629:	83 ec 08             	sub    $0x8,%esp
+     62c:	6a 00                	push   $0x0
+     62e:	53                   	push   %ebx
+     62f:	e8 f8 fe ff ff       	call   52c <t7run>
+     634:	89 04 24             	mov    %eax,(%esp)
+     637:	53                   	push   %ebx
+     638:	6a 04                	push   $0x4
+     63a:	68 90 18 00 00       	push   $0x1890
+     63f:	6a 01                	push   $0x1
+     641:	e8 3a 0c 00 00       	call   1280 <printf>
+         T7_WORKERS, ncpu, t7run(ncpu, 0));
+  printf(1, "%d workers on %d cpus, pinned:   %d ticks\n",
+     646:	83 c4 18             	add    $0x18,%esp
+     649:	6a 01                	push   $0x1
+     64b:	53                   	push   %ebx
+     64c:	e8 db fe ff ff       	call   52c <t7run>
+     651:	89 04 24             	mov    %eax,(%esp)
+     654:	53                   	push   %ebx
+     655:	6a 04                	push   $0x4
+     657:	68 bc 18 00 00       	push   $0x18bc
+     65c:	6a 01                	push   $0x1
+     65e:	e8 1d 0c 00 00       	call   1280 <printf>
+         T7_WORKERS, ncpu, t7run(ncpu, 1));
+  printf(1, "\n> test 7 complete\n");
+     663:	83 c4 18             	add    $0x18,%esp
+     666:	68 fd 16 00 00       	push   $0x16fd
+     66b:	6a 01                	push   $0x1
+     66d:	e8 0e 0c 00 00       	call   1280 <printf>
+}
+     672:	83 c4 10             	add    $0x10,%esp
+     675:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     678:	5b                   	pop    %ebx
+     679:	5e                   	pop    %esi
+     67a:	5d                   	pop    %ebp
+     67b:	c3                   	ret
+
+0000067c <t8run>:
+#define T8_PERIOD 10
+#define T8_SAMPLES 100
+#define T8_BATCH 8
+
+int
+t8run(int reserve) {
+     67c:	55                   	push   %ebp
+     67d:	89 e5                	mov    %esp,%ebp
+     67f:	57                   	push   %edi
+     680:	56                   	push   %esi
+     681:	53                   	push   %ebx
+     682:	83 ec 4c             	sub    $0x4c,%esp
+  int batch[T8_BATCH];
+  int misses = 0;
+  int next, now;
+
+  for(int i = 0;i < T8_BATCH;i++) {
+     685:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     688:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+t8run(int reserve) {
+     68b:	89 c3                	mov    %eax,%ebx
+    if((batch[i] = fork()) == 0) {
+     68d:	e8 0e 0a 00 00       	call   10a0 <fork>
+     692:	89 03                	mov    %eax,(%ebx)
+     694:	85 c0                	test   %eax,%eax
+     696:	74 27                	je     6bf <t8run+0x43>
+  for(int i = 0;i < T8_BATCH;i++) {
+     698:	83 c3 04             	add    $0x4,%ebx
+     69b:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     69e:	39 d8                	cmp    %ebx,%eax
+     6a0:	75 eb                	jne    68d <t8run+0x11>
+      for(;;);
+    }
+  }
+  if(reserve && setdeadline(getpid(), 2, T8_PERIOD) < 0)
+     6a2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     6a6:	75 19                	jne    6c1 <t8run+0x45>
+    printf(1, "setdeadline failed\n");
+  next = uptime() + T8_PERIOD;
+     6a8:	e8 93 0a 00 00       	call   1140 <uptime>
+     6ad:	89 c7                	mov    %eax,%edi
+     6af:	8d 58 0a             	lea    0xa(%eax),%ebx
+  for(int i = 0;i < T8_SAMPLES;i++) {
+     6b2:	81 c7 f2 03 00 00    	add    $0x3f2,%edi
+  int misses = 0;
+     6b8:	be 00 00 00 00       	mov    $0x0,%esi
+     6bd:	eb 46                	jmp    705 <t8run+0x89>
+      for(;;);
+     6bf:	eb fe                	jmp    6bf <t8run+0x43>
+  if(reserve && setdeadline(getpid(), 2, T8_PERIOD) < 0)
+     6c1:	e8 62 0a 00 00       	call   1128 <getpid>
+     6c6:	83 ec 04             	sub    $0x4,%esp
+     6c9:	6a 0a                	push   $0xa
+     6cb:	6a 02                	push   $0x2
+     6cd:	50                   	push   %eax
+     6ce:	e8 dd 0a 00 00       	call   11b0 <setdeadline>
+     6d3:	83 c4 10             	add    $0x10,%esp
+     6d6:	85 c0                	test   %eax,%eax
+     6d8:	79 ce                	jns    6a8 <t8run+0x2c>
+    printf(1, "setdeadline failed\n");
+     6da:	83 ec 08             	sub    $0x8,%esp
+     6dd:	68 11 17 00 00       	push   $0x1711
+     6e2:	6a 01                	push   $0x1
+     6e4:	e8 97 0b 00 00       	call   1280 <printf>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	eb ba                	jmp    6a8 <t8run+0x2c>
+    for(volatile int k = 0;k < 0x1000;k++);
+    now = uptime();
+    if(now > next)
+      misses++;
+    else
+      sleep(next - now);
+     6ee:	83 ec 0c             	sub    $0xc,%esp
+     6f1:	89 da                	mov    %ebx,%edx
+     6f3:	29 c2                	sub    %eax,%edx
+     6f5:	52                   	push   %edx
+     6f6:	e8 3d 0a 00 00       	call   1138 <sleep>
+     6fb:	83 c4 10             	add    $0x10,%esp
+    next += T8_PERIOD;
+     6fe:	83 c3 0a             	add    $0xa,%ebx
+  for(int i = 0;i < T8_SAMPLES;i++) {
+     701:	39 df                	cmp    %ebx,%edi
+     703:	74 32                	je     737 <t8run+0xbb>
+    for(volatile int k = 0;k < 0x1000;k++);
+     705:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     70c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     70f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+     714:	7f 13                	jg     729 <t8run+0xad>
+     716:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     719:	83 c0 01             	add    $0x1,%eax
+     71c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     71f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     722:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+     727:	7e ed                	jle    716 <t8run+0x9a>
+    now = uptime();
+     729:	e8 12 0a 00 00       	call   1140 <uptime>
+    if(now > next)
+     72e:	39 d8                	cmp    %ebx,%eax
+     730:	7e bc                	jle    6ee <t8run+0x72>
+      misses++;
+     732:	83 c6 01             	add    $0x1,%esi
+     735:	eb c7                	jmp    6fe <t8run+0x82>
+  }
+  setdeadline(getpid(), 0, 0);
+     737:	e8 ec 09 00 00       	call   1128 <getpid>
+     73c:	83 ec 04             	sub    $0x4,%esp
+     73f:	6a 00                	push   $0x0
+     741:	6a 00                	push   $0x0
+     743:	50                   	push   %eax
+     744:	e8 67 0a 00 00       	call   11b0 <setdeadline>
+     749:	83 c4 10             	add    $0x10,%esp
+     74c:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  for(int i = 0;i < T8_BATCH;i++)
+    kill(batch[i]);
+     74f:	83 ec 0c             	sub    $0xc,%esp
+     752:	ff 33                	push   (%ebx)
+     754:	e8 7f 09 00 00       	call   10d8 <kill>
+  for(int i = 0;i < T8_BATCH;i++)
+     759:	83 c3 04             	add    $0x4,%ebx
+     75c:	83 c4 10             	add    $0x10,%esp
+     75f:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     762:	39 c3                	cmp    %eax,%ebx
+     764:	75 e9                	jne    74f <t8run+0xd3>
+  waitall();
+     766:	e8 95 f8 ff ff       	call   0 <waitall>
+  return misses;
+}
+     76b:	89 f0                	mov    %esi,%eax
+     76d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     770:	5b                   	pop    %ebx
+     771:	5e                   	pop    %esi
+     772:	5f                   	pop    %edi
+     773:	5d                   	pop    %ebp
+     774:	c3                   	ret
+
+00000775 <test8>:
+
+void
+test8(void) {
+     775:	55                   	push   %ebp
+     776:	89 e5                	mov    %esp,%ebp
+     778:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "\n> starting test 8\n");
+     77b:	68 25 17 00 00       	push   $0x1725
+     780:	6a 01                	push   $0x1
+     782:	e8 f9 0a 00 00       	call   1280 <printf>
+  printf(1, "%d of %d periods missed without a reservation\n",
+     787:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     78e:	e8 e9 fe ff ff       	call   67c <t8run>
+     793:	6a 64                	push   $0x64
+     795:	50                   	push   %eax
+     796:	68 e8 18 00 00       	push   $0x18e8
+     79b:	6a 01                	push   $0x1
+     79d:	e8 de 0a 00 00       	call   1280 <printf>
+         t8run(0), T8_SAMPLES);
+  printf(1, "%d of %d periods missed with setdeadline()\n",
+     7a2:	83 c4 14             	add    $0x14,%esp
+     7a5:	6a 01                	push   $0x1
+     7a7:	e8 d0 fe ff ff       	call   67c <t8run>
+     7ac:	6a 64                	push   $0x64
+     7ae:	50                   	push   %eax
+     7af:	68 18 19 00 00       	push   $0x1918
+     7b4:	6a 01                	push   $0x1
+     7b6:	e8 c5 0a 00 00       	call   1280 <printf>
+         t8run(1), T8_SAMPLES);
+  printf(1, "\n> test 8 complete\n");
+     7bb:	83 c4 18             	add    $0x18,%esp
+     7be:	68 39 17 00 00       	push   $0x1739
+     7c3:	6a 01                	push   $0x1
+     7c5:	e8 b6 0a 00 00       	call   1280 <printf>
+}
+     7ca:	83 c4 10             	add    $0x10,%esp
+     7cd:	c9                   	leave
+     7ce:	c3                   	ret
+
+000007cf <t9spawn>:
+#define T9_TICKS 3000
+#define T9_UIDA 1001
+#define T9_UIDB 1002
+
+void
+t9spawn(int uid, int *pids, int n) {
+     7cf:	55                   	push   %ebp
+     7d0:	89 e5                	mov    %esp,%ebp
+     7d2:	57                   	push   %edi
+     7d3:	56                   	push   %esi
+     7d4:	53                   	push   %ebx
+     7d5:	83 ec 0c             	sub    $0xc,%esp
+     7d8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     7db:	8b 75 10             	mov    0x10(%ebp),%esi
+  for(int i = 0;i < n;i++) {
+     7de:	85 f6                	test   %esi,%esi
+     7e0:	7e 18                	jle    7fa <t9spawn+0x2b>
+     7e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if((pids[i] = fork()) == 0) {
+     7e7:	e8 b4 08 00 00       	call   10a0 <fork>
+     7ec:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+     7ef:	85 c0                	test   %eax,%eax
+     7f1:	74 0f                	je     802 <t9spawn+0x33>
+  for(int i = 0;i < n;i++) {
+     7f3:	83 c3 01             	add    $0x1,%ebx
+     7f6:	39 de                	cmp    %ebx,%esi
+     7f8:	75 ed                	jne    7e7 <t9spawn+0x18>
+      setuid(uid);
+      for(;;);
+    }
+  }
+}
+     7fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7fd:	5b                   	pop    %ebx
+     7fe:	5e                   	pop    %esi
+     7ff:	5f                   	pop    %edi
+     800:	5d                   	pop    %ebp
+     801:	c3                   	ret
+      setuid(uid);
+     802:	83 ec 0c             	sub    $0xc,%esp
+     805:	ff 75 08             	push   0x8(%ebp)
+     808:	e8 63 09 00 00       	call   1170 <setuid>
+     80d:	83 c4 10             	add    $0x10,%esp
+      for(;;);
+     810:	eb fe                	jmp    810 <t9spawn+0x41>
+
+00000812 <test9>:
+
+void
+test9(void) {
+     812:	55                   	push   %ebp
+     813:	89 e5                	mov    %esp,%ebp
+     815:	57                   	push   %edi
+     816:	56                   	push   %esi
+     817:	53                   	push   %ebx
+     818:	83 ec 78             	sub    $0x78,%esp
+  int pids[T9_HOGS+1];
+  struct uproc *table = malloc(sizeof(*table)*NPROC);
+     81b:	68 00 13 00 00       	push   $0x1300
+     820:	e8 81 0c 00 00       	call   14a6 <malloc>
+     825:	89 c7                	mov    %eax,%edi
+     827:	89 45 90             	mov    %eax,-0x70(%ebp)
+  uint a = 0, b = 0;
+  int n;
+
+  printf(1, "\n> starting test 9\n");
+     82a:	83 c4 08             	add    $0x8,%esp
+     82d:	68 4d 17 00 00       	push   $0x174d
+     832:	6a 01                	push   $0x1
+     834:	e8 47 0a 00 00       	call   1280 <printf>
+  setshares(T9_UIDA, 100);
+     839:	83 c4 08             	add    $0x8,%esp
+     83c:	6a 64                	push   $0x64
+     83e:	68 e9 03 00 00       	push   $0x3e9
+     843:	e8 90 09 00 00       	call   11d8 <setshares>
+  setshares(T9_UIDB, 100);
+     848:	83 c4 08             	add    $0x8,%esp
+     84b:	6a 64                	push   $0x64
+     84d:	68 ea 03 00 00       	push   $0x3ea
+     852:	e8 81 09 00 00       	call   11d8 <setshares>
+  t9spawn(T9_UIDA, pids, T9_HOGS);
+     857:	83 c4 0c             	add    $0xc,%esp
+     85a:	6a 10                	push   $0x10
+     85c:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+     85f:	50                   	push   %eax
+     860:	68 e9 03 00 00       	push   $0x3e9
+     865:	e8 65 ff ff ff       	call   7cf <t9spawn>
+  t9spawn(T9_UIDB, pids + T9_HOGS, 1);
+     86a:	83 c4 0c             	add    $0xc,%esp
+     86d:	6a 01                	push   $0x1
+     86f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     872:	50                   	push   %eax
+     873:	68 ea 03 00 00       	push   $0x3ea
+     878:	e8 52 ff ff ff       	call   7cf <t9spawn>
+  sleep(T9_TICKS);
+     87d:	c7 04 24 b8 0b 00 00 	movl   $0xbb8,(%esp)
+     884:	e8 af 08 00 00       	call   1138 <sleep>
+  n = getprocs(NPROC, table);
+     889:	83 c4 08             	add    $0x8,%esp
+     88c:	57                   	push   %edi
+     88d:	6a 40                	push   $0x40
+     88f:	e8 ec 08 00 00       	call   1180 <getprocs>
+  for(int i = 0;i < n;i++) {
+     894:	83 c4 10             	add    $0x10,%esp
+     897:	85 c0                	test   %eax,%eax
+     899:	0f 8e c0 00 00 00    	jle    95f <test9+0x14d>
+     89f:	89 fa                	mov    %edi,%edx
+     8a1:	6b c0 4c             	imul   $0x4c,%eax,%eax
+     8a4:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+  uint a = 0, b = 0;
+     8a7:	be 00 00 00 00       	mov    $0x0,%esi
+     8ac:	bf 00 00 00 00       	mov    $0x0,%edi
+     8b1:	eb 0a                	jmp    8bd <test9+0xab>
+    if(table[i].uid == T9_UIDA)
+      a += table[i].CPU_total_ticks;
+     8b3:	03 7a 20             	add    0x20(%edx),%edi
+  for(int i = 0;i < n;i++) {
+     8b6:	83 c2 4c             	add    $0x4c,%edx
+     8b9:	39 ca                	cmp    %ecx,%edx
+     8bb:	74 16                	je     8d3 <test9+0xc1>
+    if(table[i].uid == T9_UIDA)
+     8bd:	8b 42 04             	mov    0x4(%edx),%eax
+     8c0:	3d e9 03 00 00       	cmp    $0x3e9,%eax
+     8c5:	74 ec                	je     8b3 <test9+0xa1>
+    else if(table[i].uid == T9_UIDB)
+     8c7:	3d ea 03 00 00       	cmp    $0x3ea,%eax
+     8cc:	75 e8                	jne    8b6 <test9+0xa4>
+      b += table[i].CPU_total_ticks;
+     8ce:	03 72 20             	add    0x20(%edx),%esi
+     8d1:	eb e3                	jmp    8b6 <test9+0xa4>
+     8d3:	89 75 94             	mov    %esi,-0x6c(%ebp)
+  }
+  for(int i = 0;i <= T9_HOGS;i++)
+     8d6:	8d 5d a4             	lea    -0x5c(%ebp),%ebx
+     8d9:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    kill(pids[i]);
+     8dc:	83 ec 0c             	sub    $0xc,%esp
+     8df:	ff 33                	push   (%ebx)
+     8e1:	e8 f2 07 00 00       	call   10d8 <kill>
+  for(int i = 0;i <= T9_HOGS;i++)
+     8e6:	83 c3 04             	add    $0x4,%ebx
+     8e9:	83 c4 10             	add    $0x10,%esp
+     8ec:	39 f3                	cmp    %esi,%ebx
+     8ee:	75 ec                	jne    8dc <test9+0xca>
+  waitall();
+     8f0:	e8 0b f7 ff ff       	call   0 <waitall>
+  free(table);
+     8f5:	83 ec 0c             	sub    $0xc,%esp
+     8f8:	ff 75 90             	push   -0x70(%ebp)
+     8fb:	e8 3d 0b 00 00       	call   143d <free>
+  if(a + b == 0)
+     900:	83 c4 0c             	add    $0xc,%esp
+    a = 1;
+     903:	8b 4d 94             	mov    -0x6c(%ebp),%ecx
+     906:	89 c8                	mov    %ecx,%eax
+     908:	01 f8                	add    %edi,%eax
+     90a:	b8 01 00 00 00       	mov    $0x1,%eax
+     90f:	0f 44 f8             	cmove  %eax,%edi
+  printf(1, "uid %d (%d procs): %d%%, uid %d (1 proc): %d%%\n",
+         T9_UIDA, T9_HOGS, a*100/(a+b), T9_UIDB, b*100/(a+b));
+     912:	89 c8                	mov    %ecx,%eax
+     914:	8d 0c 0f             	lea    (%edi,%ecx,1),%ecx
+     917:	6b c0 64             	imul   $0x64,%eax,%eax
+  printf(1, "uid %d (%d procs): %d%%, uid %d (1 proc): %d%%\n",
+     91a:	ba 00 00 00 00       	mov    $0x0,%edx
+     91f:	f7 f1                	div    %ecx
+     921:	50                   	push   %eax
+     922:	68 ea 03 00 00       	push   $0x3ea
+         T9_UIDA, T9_HOGS, a*100/(a+b), T9_UIDB, b*100/(a+b));
+     927:	6b c7 64             	imul   $0x64,%edi,%eax
+  printf(1, "uid %d (%d procs): %d%%, uid %d (1 proc): %d%%\n",
+     92a:	ba 00 00 00 00       	mov    $0x0,%edx
+     92f:	f7 f1                	div    %ecx
+     931:	50                   	push   %eax
+     932:	6a 10                	push   $0x10
+     934:	68 e9 03 00 00       	push   $0x3e9
+     939:	68 44 19 00 00       	push   $0x1944
+     93e:	6a 01                	push   $0x1
+     940:	e8 3b 09 00 00       	call   1280 <printf>
+  printf(1, "\n> test 9 complete\n");
+     945:	83 c4 18             	add    $0x18,%esp
+     948:	68 61 17 00 00       	push   $0x1761
+     94d:	6a 01                	push   $0x1
+     94f:	e8 2c 09 00 00       	call   1280 <printf>
+}
+     954:	83 c4 10             	add    $0x10,%esp
+     957:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     95a:	5b                   	pop    %ebx
+     95b:	5e                   	pop    %esi
+     95c:	5f                   	pop    %edi
+     95d:	5d                   	pop    %ebp
+     95e:	c3                   	ret
+  uint a = 0, b = 0;
+     95f:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+     966:	bf 00 00 00 00       	mov    $0x0,%edi
+     96b:	e9 66 ff ff ff       	jmp    8d6 <test9+0xc4>
+
+00000970 <test10>:
+// memory runs out.
+#define T10_MAXPROC 2048
+#define T10_BATCH 128
+
+void
+test10(void) {
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	56                   	push   %esi
+     975:	53                   	push   %ebx
+     976:	83 ec 74             	sub    $0x74,%esp
+  struct schedparams sp, old;
+  int fd[2], live = 0, start, t, n, full = 0;
+  char c;
+
+  printf(1, "\n> starting test 10\n");
+     979:	68 75 17 00 00       	push   $0x1775
+     97e:	6a 01                	push   $0x1
+     980:	e8 fb 08 00 00       	call   1280 <printf>
+  schedctl(SCHED_GET, &old);
+     985:	83 c4 08             	add    $0x8,%esp
+     988:	8d 45 98             	lea    -0x68(%ebp),%eax
+     98b:	50                   	push   %eax
+     98c:	6a 00                	push   $0x0
+     98e:	e8 25 08 00 00       	call   11b8 <schedctl>
+  sp = old;
+     993:	8b 45 98             	mov    -0x68(%ebp),%eax
+     996:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     999:	8b 45 9c             	mov    -0x64(%ebp),%eax
+     99c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     99f:	8b 45 a0             	mov    -0x60(%ebp),%eax
+     9a2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     9a5:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     9a8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+     9ab:	8b 45 a8             	mov    -0x58(%ebp),%eax
+     9ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     9b1:	8b 45 ac             	mov    -0x54(%ebp),%eax
+     9b4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     9b7:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     9ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     9bd:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     9c0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     9c3:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     9c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  sp.maxproc = T10_MAXPROC;
+     9c9:	c7 45 e4 00 08 00 00 	movl   $0x800,-0x1c(%ebp)
+  if(schedctl(SCHED_SET, &sp) < 0)
+     9d0:	83 c4 08             	add    $0x8,%esp
+     9d3:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     9d6:	50                   	push   %eax
+     9d7:	6a 01                	push   $0x1
+     9d9:	e8 da 07 00 00       	call   11b8 <schedctl>
+     9de:	83 c4 10             	add    $0x10,%esp
+     9e1:	85 c0                	test   %eax,%eax
+     9e3:	78 28                	js     a0d <test10+0x9d>
+    printf(1, "cannot raise maxproc to %d\n", T10_MAXPROC);
+  pipe(fd);
+     9e5:	83 ec 0c             	sub    $0xc,%esp
+     9e8:	8d 45 90             	lea    -0x70(%ebp),%eax
+     9eb:	50                   	push   %eax
+     9ec:	e8 c7 06 00 00       	call   10b8 <pipe>
+  printf(1, "procs\tforks/sec\n");
+     9f1:	83 c4 08             	add    $0x8,%esp
+     9f4:	68 a6 17 00 00       	push   $0x17a6
+     9f9:	6a 01                	push   $0x1
+     9fb:	e8 80 08 00 00       	call   1280 <printf>
+     a00:	83 c4 10             	add    $0x10,%esp
+  int fd[2], live = 0, start, t, n, full = 0;
+     a03:	be 00 00 00 00       	mov    $0x0,%esi
+     a08:	e9 d1 00 00 00       	jmp    ade <test10+0x16e>
+    printf(1, "cannot raise maxproc to %d\n", T10_MAXPROC);
+     a0d:	83 ec 04             	sub    $0x4,%esp
+     a10:	68 00 08 00 00       	push   $0x800
+     a15:	68 8a 17 00 00       	push   $0x178a
+     a1a:	6a 01                	push   $0x1
+     a1c:	e8 5f 08 00 00       	call   1280 <printf>
+     a21:	83 c4 10             	add    $0x10,%esp
+     a24:	eb bf                	jmp    9e5 <test10+0x75>
+  while(!full) {
+    start = uptime();
+    for(n = 0;n < T10_BATCH;n++) {
+      int pid = fork();
+      if(pid == 0) {
+        close(fd[1]);
+     a26:	83 ec 0c             	sub    $0xc,%esp
+     a29:	ff 75 94             	push   -0x6c(%ebp)
+     a2c:	e8 9f 06 00 00       	call   10d0 <close>
+        read(fd[0], &c, 1);
+     a31:	83 c4 0c             	add    $0xc,%esp
+     a34:	6a 01                	push   $0x1
+     a36:	8d 45 8f             	lea    -0x71(%ebp),%eax
+     a39:	50                   	push   %eax
+     a3a:	ff 75 90             	push   -0x70(%ebp)
+     a3d:	e8 7e 06 00 00       	call   10c0 <read>
+        exit();
+     a42:	e8 61 06 00 00       	call   10a8 <exit>
+     a47:	bf 00 00 00 00       	mov    $0x0,%edi
+     a4c:	eb 72                	jmp    ac0 <test10+0x150>
+        break;
+      }
+      live++;
+    }
+    t = uptime() - start;
+    printf(1, "%d\t%d\n", live, t ? n*1000/t : 0);
+     a4e:	6a 00                	push   $0x0
+     a50:	56                   	push   %esi
+     a51:	68 b7 17 00 00       	push   $0x17b7
+     a56:	6a 01                	push   $0x1
+     a58:	e8 23 08 00 00       	call   1280 <printf>
+     a5d:	83 c4 10             	add    $0x10,%esp
+  }
+  close(fd[1]);
+     a60:	83 ec 0c             	sub    $0xc,%esp
+     a63:	ff 75 94             	push   -0x6c(%ebp)
+     a66:	e8 65 06 00 00       	call   10d0 <close>
+  close(fd[0]);
+     a6b:	83 c4 04             	add    $0x4,%esp
+     a6e:	ff 75 90             	push   -0x70(%ebp)
+     a71:	e8 5a 06 00 00       	call   10d0 <close>
+  waitall();
+     a76:	e8 85 f5 ff ff       	call   0 <waitall>
+  schedctl(SCHED_SET, &old);
+     a7b:	83 c4 08             	add    $0x8,%esp
+     a7e:	8d 45 98             	lea    -0x68(%ebp),%eax
+     a81:	50                   	push   %eax
+     a82:	6a 01                	push   $0x1
+     a84:	e8 2f 07 00 00       	call   11b8 <schedctl>
+  printf(1, "fork failed with %d children\n", live);
+     a89:	83 c4 0c             	add    $0xc,%esp
+     a8c:	56                   	push   %esi
+     a8d:	68 be 17 00 00       	push   $0x17be
+     a92:	6a 01                	push   $0x1
+     a94:	e8 e7 07 00 00       	call   1280 <printf>
+  printf(1, "\n> test 10 complete\n");
+     a99:	83 c4 08             	add    $0x8,%esp
+     a9c:	68 dc 17 00 00       	push   $0x17dc
+     aa1:	6a 01                	push   $0x1
+     aa3:	e8 d8 07 00 00       	call   1280 <printf>
+}
+     aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aab:	5b                   	pop    %ebx
+     aac:	5e                   	pop    %esi
+     aad:	5f                   	pop    %edi
+     aae:	5d                   	pop    %ebp
+     aaf:	c3                   	ret
+    t = uptime() - start;
+     ab0:	e8 8b 06 00 00       	call   1140 <uptime>
+    printf(1, "%d\t%d\n", live, t ? n*1000/t : 0);
+     ab5:	29 f8                	sub    %edi,%eax
+     ab7:	89 c1                	mov    %eax,%ecx
+     ab9:	74 93                	je     a4e <test10+0xde>
+        full = 1;
+     abb:	bf 01 00 00 00       	mov    $0x1,%edi
+    printf(1, "%d\t%d\n", live, t ? n*1000/t : 0);
+     ac0:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+     ac6:	99                   	cltd
+     ac7:	f7 f9                	idiv   %ecx
+     ac9:	50                   	push   %eax
+     aca:	56                   	push   %esi
+     acb:	68 b7 17 00 00       	push   $0x17b7
+     ad0:	6a 01                	push   $0x1
+     ad2:	e8 a9 07 00 00       	call   1280 <printf>
+  while(!full) {
+     ad7:	83 c4 10             	add    $0x10,%esp
+     ada:	85 ff                	test   %edi,%edi
+     adc:	75 82                	jne    a60 <test10+0xf0>
+    start = uptime();
+     ade:	e8 5d 06 00 00       	call   1140 <uptime>
+     ae3:	89 c7                	mov    %eax,%edi
+    for(n = 0;n < T10_BATCH;n++) {
+     ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+      int pid = fork();
+     aea:	e8 b1 05 00 00       	call   10a0 <fork>
+      if(pid == 0) {
+     aef:	85 c0                	test   %eax,%eax
+     af1:	0f 84 2f ff ff ff    	je     a26 <test10+0xb6>
+      if(pid < 0) {
+     af7:	78 b7                	js     ab0 <test10+0x140>
+      live++;
+     af9:	83 c6 01             	add    $0x1,%esi
+    for(n = 0;n < T10_BATCH;n++) {
+     afc:	83 c3 01             	add    $0x1,%ebx
+     aff:	81 fb 80 00 00 00    	cmp    $0x80,%ebx
+     b05:	75 e3                	jne    aea <test10+0x17a>
+    t = uptime() - start;
+     b07:	e8 34 06 00 00       	call   1140 <uptime>
+    printf(1, "%d\t%d\n", live, t ? n*1000/t : 0);
+     b0c:	29 f8                	sub    %edi,%eax
+     b0e:	89 c1                	mov    %eax,%ecx
+     b10:	0f 85 31 ff ff ff    	jne    a47 <test10+0xd7>
+     b16:	6a 00                	push   $0x0
+     b18:	56                   	push   %esi
+     b19:	68 b7 17 00 00       	push   $0x17b7
+     b1e:	6a 01                	push   $0x1
+     b20:	e8 5b 07 00 00       	call   1280 <printf>
+     b25:	83 c4 10             	add    $0x10,%esp
+     b28:	eb b4                	jmp    ade <test10+0x16e>
+
+00000b2a <t11run>:
+#define T11_GROW (8*1024*1024)
+
+char *t11argv[] = { "schedstress", "99", 0 };
+
+int
+t11run(int usespawn) {
+     b2a:	55                   	push   %ebp
+     b2b:	89 e5                	mov    %esp,%ebp
+     b2d:	57                   	push   %edi
+     b2e:	56                   	push   %esi
+     b2f:	53                   	push   %ebx
+     b30:	83 ec 0c             	sub    $0xc,%esp
+     b33:	8b 75 08             	mov    0x8(%ebp),%esi
+  int pid, start = uptime();
+     b36:	e8 05 06 00 00       	call   1140 <uptime>
+     b3b:	89 c7                	mov    %eax,%edi
+     b3d:	bb 32 00 00 00       	mov    $0x32,%ebx
+     b42:	eb 12                	jmp    b56 <t11run+0x2c>
+
+  for(int i = 0;i < T11_RUNS;i++) {
+    if(usespawn)
+      pid = spawn(t11argv[0], t11argv, 0);
+    else if((pid = fork()) == 0) {
+     b44:	e8 57 05 00 00       	call   10a0 <fork>
+     b49:	85 c0                	test   %eax,%eax
+     b4b:	74 27                	je     b74 <t11run+0x4a>
+      exec(t11argv[0], t11argv);
+      exit();
+    }
+    if(pid > 0)
+     b4d:	85 c0                	test   %eax,%eax
+     b4f:	7f 3b                	jg     b8c <t11run+0x62>
+  for(int i = 0;i < T11_RUNS;i++) {
+     b51:	83 eb 01             	sub    $0x1,%ebx
+     b54:	74 44                	je     b9a <t11run+0x70>
+    if(usespawn)
+     b56:	85 f6                	test   %esi,%esi
+     b58:	74 ea                	je     b44 <t11run+0x1a>
+      pid = spawn(t11argv[0], t11argv, 0);
+     b5a:	83 ec 04             	sub    $0x4,%esp
+     b5d:	6a 00                	push   $0x0
+     b5f:	68 7c 1f 00 00       	push   $0x1f7c
+     b64:	ff 35 7c 1f 00 00    	push   0x1f7c
+     b6a:	e8 51 06 00 00       	call   11c0 <spawn>
+     b6f:	83 c4 10             	add    $0x10,%esp
+     b72:	eb d9                	jmp    b4d <t11run+0x23>
+      exec(t11argv[0], t11argv);
+     b74:	83 ec 08             	sub    $0x8,%esp
+     b77:	68 7c 1f 00 00       	push   $0x1f7c
+     b7c:	ff 35 7c 1f 00 00    	push   0x1f7c
+     b82:	e8 59 05 00 00       	call   10e0 <exec>
+      exit();
+     b87:	e8 1c 05 00 00       	call   10a8 <exit>
+      waitpid(pid);
+     b8c:	83 ec 0c             	sub    $0xc,%esp
+     b8f:	50                   	push   %eax
+     b90:	e8 03 06 00 00       	call   1198 <waitpid>
+     b95:	83 c4 10             	add    $0x10,%esp
+     b98:	eb b7                	jmp    b51 <t11run+0x27>
+  }
+  return uptime() - start;
+     b9a:	e8 a1 05 00 00       	call   1140 <uptime>
+     b9f:	29 f8                	sub    %edi,%eax
+}
+     ba1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba4:	5b                   	pop    %ebx
+     ba5:	5e                   	pop    %esi
+     ba6:	5f                   	pop    %edi
+     ba7:	5d                   	pop    %ebp
+     ba8:	c3                   	ret
+
+00000ba9 <test11>:
+
+void
+test11(void) {
+     ba9:	55                   	push   %ebp
+     baa:	89 e5                	mov    %esp,%ebp
+     bac:	56                   	push   %esi
+     bad:	53                   	push   %ebx
+  char *grow;
+
+  printf(1, "\n> starting test 11\n");
+     bae:	83 ec 08             	sub    $0x8,%esp
+     bb1:	68 f1 17 00 00       	push   $0x17f1
+     bb6:	6a 01                	push   $0x1
+     bb8:	e8 c3 06 00 00       	call   1280 <printf>
+  printf(1, "size\tfork+exec\tspawn (ticks for %d)\n", T11_RUNS);
+     bbd:	83 c4 0c             	add    $0xc,%esp
+     bc0:	6a 32                	push   $0x32
+     bc2:	68 74 19 00 00       	push   $0x1974
+     bc7:	6a 01                	push   $0x1
+     bc9:	e8 b2 06 00 00       	call   1280 <printf>
+  printf(1, "%d\t%d\t\t%d\n", (int)sbrk(0), t11run(0), t11run(1));
+     bce:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     bd5:	e8 50 ff ff ff       	call   b2a <t11run>
+     bda:	89 c6                	mov    %eax,%esi
+     bdc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     be3:	e8 42 ff ff ff       	call   b2a <t11run>
+     be8:	89 c3                	mov    %eax,%ebx
+     bea:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     bf1:	e8 3a 05 00 00       	call   1130 <sbrk>
+     bf6:	89 34 24             	mov    %esi,(%esp)
+     bf9:	53                   	push   %ebx
+     bfa:	50                   	push   %eax
+     bfb:	68 06 18 00 00       	push   $0x1806
+     c00:	6a 01                	push   $0x1
+     c02:	e8 79 06 00 00       	call   1280 <printf>
+  if((grow = sbrk(T11_GROW)) == (char*)-1) {
+     c07:	83 c4 14             	add    $0x14,%esp
+     c0a:	68 00 00 80 00       	push   $0x800000
+     c0f:	e8 1c 05 00 00       	call   1130 <sbrk>
+     c14:	83 c4 10             	add    $0x10,%esp
+     c17:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c1a:	74 6f                	je     c8b <test11+0xe2>
+    printf(1, "cannot grow by %d bytes\n", T11_GROW);
+    return;
+  }
+  memset(grow, 1, T11_GROW);
+     c1c:	83 ec 04             	sub    $0x4,%esp
+     c1f:	68 00 00 80 00       	push   $0x800000
+     c24:	6a 01                	push   $0x1
+     c26:	50                   	push   %eax
+     c27:	e8 8e 02 00 00       	call   eba <memset>
+  printf(1, "%d\t%d\t\t%d\n", (int)sbrk(0), t11run(0), t11run(1));
+     c2c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     c33:	e8 f2 fe ff ff       	call   b2a <t11run>
+     c38:	89 c6                	mov    %eax,%esi
+     c3a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     c41:	e8 e4 fe ff ff       	call   b2a <t11run>
+     c46:	89 c3                	mov    %eax,%ebx
+     c48:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     c4f:	e8 dc 04 00 00       	call   1130 <sbrk>
+     c54:	89 34 24             	mov    %esi,(%esp)
+     c57:	53                   	push   %ebx
+     c58:	50                   	push   %eax
+     c59:	68 06 18 00 00       	push   $0x1806
+     c5e:	6a 01                	push   $0x1
+     c60:	e8 1b 06 00 00       	call   1280 <printf>
+  sbrk(-T11_GROW);
+     c65:	83 c4 14             	add    $0x14,%esp
+     c68:	68 00 00 80 ff       	push   $0xff800000
+     c6d:	e8 be 04 00 00       	call   1130 <sbrk>
+  printf(1, "\n> test 11 complete\n");
+     c72:	83 c4 08             	add    $0x8,%esp
+     c75:	68 2a 18 00 00       	push   $0x182a
+     c7a:	6a 01                	push   $0x1
+     c7c:	e8 ff 05 00 00       	call   1280 <printf>
+     c81:	83 c4 10             	add    $0x10,%esp
+}
+     c84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c87:	5b                   	pop    %ebx
+     c88:	5e                   	pop    %esi
+     c89:	5d                   	pop    %ebp
+     c8a:	c3                   	ret
+    printf(1, "cannot grow by %d bytes\n", T11_GROW);
+     c8b:	83 ec 04             	sub    $0x4,%esp
+     c8e:	68 00 00 80 00       	push   $0x800000
+     c93:	68 11 18 00 00       	push   $0x1811
+     c98:	6a 01                	push   $0x1
+     c9a:	e8 e1 05 00 00       	call   1280 <printf>
+    return;
+     c9f:	83 c4 10             	add    $0x10,%esp
+     ca2:	eb e0                	jmp    c84 <test11+0xdb>
+
+00000ca4 <main>:
+
+int
+main(int argc, char **argv) {
+     ca4:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     ca8:	83 e4 f0             	and    $0xfffffff0,%esp
+     cab:	ff 71 fc             	push   -0x4(%ecx)
+     cae:	55                   	push   %ebp
+     caf:	89 e5                	mov    %esp,%ebp
+     cb1:	57                   	push   %edi
+     cb2:	56                   	push   %esi
+     cb3:	53                   	push   %ebx
+     cb4:	51                   	push   %ecx
+     cb5:	83 ec 08             	sub    $0x8,%esp
+     cb8:	8b 41 04             	mov    0x4(%ecx),%eax
+  int test = 0;
+  if(argc == 2) test = atoi(argv[1]);
+     cbb:	83 39 02             	cmpl   $0x2,(%ecx)
+     cbe:	74 2a                	je     cea <main+0x46>
+
+  if(test == 0) printf(1, "stressing scheduler...\n");
+     cc0:	83 ec 08             	sub    $0x8,%esp
+     cc3:	68 3f 18 00 00       	push   $0x183f
+     cc8:	6a 01                	push   $0x1
+     cca:	e8 b1 05 00 00       	call   1280 <printf>
+  if(test == 1 || test == 0) test1();
+     ccf:	e8 81 f3 ff ff       	call   55 <test1>
+     cd4:	83 c4 10             	add    $0x10,%esp
+     cd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if(test == 2 || test == 0) test2();
+     cdc:	be 01 00 00 00       	mov    $0x1,%esi
+     ce1:	e8 6f f4 ff ff       	call   155 <test2>
+     ce6:	89 f7                	mov    %esi,%edi
+     ce8:	eb 2d                	jmp    d17 <main+0x73>
+  if(argc == 2) test = atoi(argv[1]);
+     cea:	83 ec 0c             	sub    $0xc,%esp
+     ced:	ff 70 04             	push   0x4(%eax)
+     cf0:	e8 a6 02 00 00       	call   f9b <atoi>
+     cf5:	89 c3                	mov    %eax,%ebx
+  if(test == 0) printf(1, "stressing scheduler...\n");
+     cf7:	83 c4 10             	add    $0x10,%esp
+     cfa:	85 c0                	test   %eax,%eax
+     cfc:	74 c2                	je     cc0 <main+0x1c>
+  if(test == 1 || test == 0) test1();
+     cfe:	83 f8 01             	cmp    $0x1,%eax
+     d01:	0f 86 bb 00 00 00    	jbe    dc2 <main+0x11e>
+  if(test == 2 || test == 0) test2();
+     d07:	bf 00 00 00 00       	mov    $0x0,%edi
+     d0c:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+     d11:	0f 84 c8 00 00 00    	je     ddf <main+0x13b>
+  if(test == 3 || test == 0) test3();
+     d17:	83 fb 03             	cmp    $0x3,%ebx
+     d1a:	0f 94 c0             	sete   %al
+     d1d:	89 fa                	mov    %edi,%edx
+     d1f:	08 d0                	or     %dl,%al
+     d21:	89 c6                	mov    %eax,%esi
+     d23:	0f 85 c0 00 00 00    	jne    de9 <main+0x145>
+  if(test == 4 || test == 0) test4();
+     d29:	83 fb 04             	cmp    $0x4,%ebx
+     d2c:	0f 84 c3 00 00 00    	je     df5 <main+0x151>
+     d32:	89 f0                	mov    %esi,%eax
+     d34:	84 c0                	test   %al,%al
+     d36:	0f 85 b9 00 00 00    	jne    df5 <main+0x151>
+  if(test == 5 || test == 0) test5();
+     d3c:	83 fb 05             	cmp    $0x5,%ebx
+     d3f:	0f 84 ba 00 00 00    	je     dff <main+0x15b>
+     d45:	89 f0                	mov    %esi,%eax
+     d47:	84 c0                	test   %al,%al
+     d49:	0f 85 b0 00 00 00    	jne    dff <main+0x15b>
+  if(test == 6 || test == 0) test6();
+     d4f:	83 fb 06             	cmp    $0x6,%ebx
+     d52:	0f 84 b1 00 00 00    	je     e09 <main+0x165>
+     d58:	89 f0                	mov    %esi,%eax
+     d5a:	84 c0                	test   %al,%al
+     d5c:	0f 85 a7 00 00 00    	jne    e09 <main+0x165>
+  if(test == 7 || test == 0) test7();
+     d62:	83 fb 07             	cmp    $0x7,%ebx
+     d65:	0f 84 a8 00 00 00    	je     e13 <main+0x16f>
+     d6b:	89 f0                	mov    %esi,%eax
+     d6d:	84 c0                	test   %al,%al
+     d6f:	0f 85 9e 00 00 00    	jne    e13 <main+0x16f>
+  if(test == 8 || test == 0) test8();
+     d75:	83 fb 08             	cmp    $0x8,%ebx
+     d78:	0f 84 9f 00 00 00    	je     e1d <main+0x179>
+     d7e:	89 f0                	mov    %esi,%eax
+     d80:	84 c0                	test   %al,%al
+     d82:	0f 85 95 00 00 00    	jne    e1d <main+0x179>
+#ifdef PDX_STRIDE
+  if(test == 9 || test == 0) test9();
+     d88:	83 fb 09             	cmp    $0x9,%ebx
+     d8b:	0f 84 96 00 00 00    	je     e27 <main+0x183>
+     d91:	89 f0                	mov    %esi,%eax
+     d93:	84 c0                	test   %al,%al
+     d95:	0f 85 8c 00 00 00    	jne    e27 <main+0x183>
+#endif
+  if(test == 10 || test == 0) test10();
+     d9b:	83 fb 0a             	cmp    $0xa,%ebx
+     d9e:	0f 84 8d 00 00 00    	je     e31 <main+0x18d>
+     da4:	89 f0                	mov    %esi,%eax
+     da6:	84 c0                	test   %al,%al
+     da8:	0f 85 83 00 00 00    	jne    e31 <main+0x18d>
+  if(test == 11 || test == 0) test11();
+     dae:	83 fb 0b             	cmp    $0xb,%ebx
+     db1:	0f 84 84 00 00 00    	je     e3b <main+0x197>
+     db7:	89 f0                	mov    %esi,%eax
+     db9:	84 c0                	test   %al,%al
+     dbb:	75 7e                	jne    e3b <main+0x197>
+  exit();
+     dbd:	e8 e6 02 00 00       	call   10a8 <exit>
+  if(test == 1 || test == 0) test1();
+     dc2:	e8 8e f2 ff ff       	call   55 <test1>
+  if(test == 2 || test == 0) test2();
+     dc7:	85 db                	test   %ebx,%ebx
+     dc9:	0f 94 c0             	sete   %al
+     dcc:	89 c6                	mov    %eax,%esi
+     dce:	f7 c3 fd ff ff ff    	test   $0xfffffffd,%ebx
+     dd4:	0f 85 4f ff ff ff    	jne    d29 <main+0x85>
+     dda:	e9 02 ff ff ff       	jmp    ce1 <main+0x3d>
+     ddf:	be 00 00 00 00       	mov    $0x0,%esi
+     de4:	e9 f8 fe ff ff       	jmp    ce1 <main+0x3d>
+  if(test == 3 || test == 0) test3();
+     de9:	e8 f2 f3 ff ff       	call   1e0 <test3>
+     dee:	89 fe                	mov    %edi,%esi
+     df0:	e9 34 ff ff ff       	jmp    d29 <main+0x85>
+  if(test == 4 || test == 0) test4();
+     df5:	e8 89 f4 ff ff       	call   283 <test4>
+     dfa:	e9 3d ff ff ff       	jmp    d3c <main+0x98>
+  if(test == 5 || test == 0) test5();
+     dff:	e8 32 f5 ff ff       	call   336 <test5>
+     e04:	e9 46 ff ff ff       	jmp    d4f <main+0xab>
+  if(test == 6 || test == 0) test6();
+     e09:	e8 05 f6 ff ff       	call   413 <test6>
+     e0e:	e9 4f ff ff ff       	jmp    d62 <main+0xbe>
+  if(test == 7 || test == 0) test7();
+     e13:	e8 cb f7 ff ff       	call   5e3 <test7>
+     e18:	e9 58 ff ff ff       	jmp    d75 <main+0xd1>
+  if(test == 8 || test == 0) test8();
+     e1d:	e8 53 f9 ff ff       	call   775 <test8>
+     e22:	e9 61 ff ff ff       	jmp    d88 <main+0xe4>
+  if(test == 9 || test == 0) test9();
+     e27:	e8 e6 f9 ff ff       	call   812 <test9>
+     e2c:	e9 6a ff ff ff       	jmp    d9b <main+0xf7>
+  if(test == 10 || test == 0) test10();
+     e31:	e8 3a fb ff ff       	call   970 <test10>
+     e36:	e9 73 ff ff ff       	jmp    dae <main+0x10a>
+  if(test == 11 || test == 0) test11();
+     e3b:	e8 69 fd ff ff       	call   ba9 <test11>
+     e40:	e9 78 ff ff ff       	jmp    dbd <main+0x119>
+
+00000e45 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     e45:	55                   	push   %ebp
+     e46:	89 e5                	mov    %esp,%ebp
+     e48:	53                   	push   %ebx
+     e49:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e54:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     e58:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     e5b:	83 c0 01             	add    $0x1,%eax
+     e5e:	84 d2                	test   %dl,%dl
+     e60:	75 f2                	jne    e54 <strcpy+0xf>
+    ;
+  return os;
+}
+     e62:	89 c8                	mov    %ecx,%eax
+     e64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e67:	c9                   	leave
+     e68:	c3                   	ret
+
+00000e69 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     e69:	55                   	push   %ebp
+     e6a:	89 e5                	mov    %esp,%ebp
+     e6c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     e72:	0f b6 01             	movzbl (%ecx),%eax
+     e75:	84 c0                	test   %al,%al
+     e77:	74 11                	je     e8a <strcmp+0x21>
+     e79:	38 02                	cmp    %al,(%edx)
+     e7b:	75 0d                	jne    e8a <strcmp+0x21>
+    p++, q++;
+     e7d:	83 c1 01             	add    $0x1,%ecx
+     e80:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     e83:	0f b6 01             	movzbl (%ecx),%eax
+     e86:	84 c0                	test   %al,%al
+     e88:	75 ef                	jne    e79 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+     e8a:	0f b6 c0             	movzbl %al,%eax
+     e8d:	0f b6 12             	movzbl (%edx),%edx
+     e90:	29 d0                	sub    %edx,%eax
+}
+     e92:	5d                   	pop    %ebp
+     e93:	c3                   	ret
+
+00000e94 <strlen>:
+
+uint
+strlen(char *s)
+{
+     e94:	55                   	push   %ebp
+     e95:	89 e5                	mov    %esp,%ebp
+     e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     e9a:	80 3a 00             	cmpb   $0x0,(%edx)
+     e9d:	74 14                	je     eb3 <strlen+0x1f>
+     e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+     ea4:	83 c0 01             	add    $0x1,%eax
+     ea7:	89 c1                	mov    %eax,%ecx
+     ea9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     ead:	75 f5                	jne    ea4 <strlen+0x10>
+    ;
+  return n;
+}
+     eaf:	89 c8                	mov    %ecx,%eax
+     eb1:	5d                   	pop    %ebp
+     eb2:	c3                   	ret
+  for(n = 0; s[n]; n++)
+     eb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+     eb8:	eb f5                	jmp    eaf <strlen+0x1b>
+
+00000eba <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     eba:	55                   	push   %ebp
+     ebb:	89 e5                	mov    %esp,%ebp
+     ebd:	57                   	push   %edi
+     ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ec1:	89 d7                	mov    %edx,%edi
+     ec3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ec6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ec9:	fc                   	cld
+     eca:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ecc:	89 d0                	mov    %edx,%eax
+     ece:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ed1:	c9                   	leave
+     ed2:	c3                   	ret
+
+00000ed3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     ed3:	55                   	push   %ebp
+     ed4:	89 e5                	mov    %esp,%ebp
+     ed6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     edd:	0f b6 10             	movzbl (%eax),%edx
+     ee0:	84 d2                	test   %dl,%dl
+     ee2:	74 15                	je     ef9 <strchr+0x26>
+    if(*s == c)
+     ee4:	38 d1                	cmp    %dl,%cl
+     ee6:	74 0f                	je     ef7 <strchr+0x24>
+  for(; *s; s++)
+     ee8:	83 c0 01             	add    $0x1,%eax
+     eeb:	0f b6 10             	movzbl (%eax),%edx
+     eee:	84 d2                	test   %dl,%dl
+     ef0:	75 f2                	jne    ee4 <strchr+0x11>
+      return (char*)s;
+  return 0;
+     ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ef7:	5d                   	pop    %ebp
+     ef8:	c3                   	ret
+  return 0;
+     ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+     efe:	eb f7                	jmp    ef7 <strchr+0x24>
+
+00000f00 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	57                   	push   %edi
+     f04:	56                   	push   %esi
+     f05:	53                   	push   %ebx
+     f06:	83 ec 2c             	sub    $0x2c,%esp
+     f09:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     f0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+     f11:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+     f14:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     f17:	83 c3 01             	add    $0x1,%ebx
+     f1a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     f1d:	7d 27                	jge    f46 <gets+0x46>
+    cc = read(0, &c, 1);
+     f1f:	83 ec 04             	sub    $0x4,%esp
+     f22:	6a 01                	push   $0x1
+     f24:	57                   	push   %edi
+     f25:	6a 00                	push   $0x0
+     f27:	e8 94 01 00 00       	call   10c0 <read>
+    if(cc < 1)
+     f2c:	83 c4 10             	add    $0x10,%esp
+     f2f:	85 c0                	test   %eax,%eax
+     f31:	7e 13                	jle    f46 <gets+0x46>
+      break;
+    buf[i++] = c;
+     f33:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     f37:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     f3b:	3c 0a                	cmp    $0xa,%al
+     f3d:	74 04                	je     f43 <gets+0x43>
+     f3f:	3c 0d                	cmp    $0xd,%al
+     f41:	75 d1                	jne    f14 <gets+0x14>
+  for(i=0; i+1 < max; ){
+     f43:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+     f46:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     f49:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+     f4d:	89 f0                	mov    %esi,%eax
+     f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f52:	5b                   	pop    %ebx
+     f53:	5e                   	pop    %esi
+     f54:	5f                   	pop    %edi
+     f55:	5d                   	pop    %ebp
+     f56:	c3                   	ret
+
+00000f57 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     f57:	55                   	push   %ebp
+     f58:	89 e5                	mov    %esp,%ebp
+     f5a:	56                   	push   %esi
+     f5b:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     f5c:	83 ec 08             	sub    $0x8,%esp
+     f5f:	6a 00                	push   $0x0
+     f61:	ff 75 08             	push   0x8(%ebp)
+     f64:	e8 7f 01 00 00       	call   10e8 <open>
+  if(fd < 0)
+     f69:	83 c4 10             	add    $0x10,%esp
+     f6c:	85 c0                	test   %eax,%eax
+     f6e:	78 24                	js     f94 <stat+0x3d>
+     f70:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     f72:	83 ec 08             	sub    $0x8,%esp
+     f75:	ff 75 0c             	push   0xc(%ebp)
+     f78:	50                   	push   %eax
+     f79:	e8 82 01 00 00       	call   1100 <fstat>
+     f7e:	89 c6                	mov    %eax,%esi
+  close(fd);
+     f80:	89 1c 24             	mov    %ebx,(%esp)
+     f83:	e8 48 01 00 00       	call   10d0 <close>
+  return r;
+     f88:	83 c4 10             	add    $0x10,%esp
+}
+     f8b:	89 f0                	mov    %esi,%eax
+     f8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f90:	5b                   	pop    %ebx
+     f91:	5e                   	pop    %esi
+     f92:	5d                   	pop    %ebp
+     f93:	c3                   	ret
+    return -1;
+     f94:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f99:	eb f0                	jmp    f8b <stat+0x34>
+
+00000f9b <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     f9b:	55                   	push   %ebp
+     f9c:	89 e5                	mov    %esp,%ebp
+     f9e:	56                   	push   %esi
+     f9f:	53                   	push   %ebx
+     fa0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     fa3:	0f b6 0a             	movzbl (%edx),%ecx
+     fa6:	80 f9 20             	cmp    $0x20,%cl
+     fa9:	75 0b                	jne    fb6 <atoi+0x1b>
+     fab:	83 c2 01             	add    $0x1,%edx
+     fae:	0f b6 0a             	movzbl (%edx),%ecx
+     fb1:	80 f9 20             	cmp    $0x20,%cl
+     fb4:	74 f5                	je     fab <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     fb6:	80 f9 2d             	cmp    $0x2d,%cl
+     fb9:	74 3c                	je     ff7 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+     fbb:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     fbe:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     fc3:	f6 c1 fd             	test   $0xfd,%cl
+     fc6:	74 34                	je     ffc <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+     fc8:	0f b6 0a             	movzbl (%edx),%ecx
+     fcb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     fce:	3c 09                	cmp    $0x9,%al
+     fd0:	77 2f                	ja     1001 <atoi+0x66>
+     fd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+     fd7:	83 c2 01             	add    $0x1,%edx
+     fda:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     fdd:	0f be c9             	movsbl %cl,%ecx
+     fe0:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+     fe4:	0f b6 0a             	movzbl (%edx),%ecx
+     fe7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     fea:	3c 09                	cmp    $0x9,%al
+     fec:	76 e9                	jbe    fd7 <atoi+0x3c>
+  return sign*n;
+     fee:	89 f0                	mov    %esi,%eax
+     ff0:	0f af c3             	imul   %ebx,%eax
+}
+     ff3:	5b                   	pop    %ebx
+     ff4:	5e                   	pop    %esi
+     ff5:	5d                   	pop    %ebp
+     ff6:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+     ff7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     ffc:	83 c2 01             	add    $0x1,%edx
+     fff:	eb c7                	jmp    fc8 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+    1001:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1006:	eb e6                	jmp    fee <atoi+0x53>
+
+00001008 <atoo>:
+
+int
+atoo(const char *s)
+{
+    1008:	55                   	push   %ebp
+    1009:	89 e5                	mov    %esp,%ebp
+    100b:	56                   	push   %esi
+    100c:	53                   	push   %ebx
+    100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    1010:	0f b6 0a             	movzbl (%edx),%ecx
+    1013:	80 f9 20             	cmp    $0x20,%cl
+    1016:	75 0b                	jne    1023 <atoo+0x1b>
+    1018:	83 c2 01             	add    $0x1,%edx
+    101b:	0f b6 0a             	movzbl (%edx),%ecx
+    101e:	80 f9 20             	cmp    $0x20,%cl
+    1021:	74 f5                	je     1018 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    1023:	80 f9 2d             	cmp    $0x2d,%cl
+    1026:	74 3a                	je     1062 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+    1028:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+    102b:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    1030:	f6 c1 fd             	test   $0xfd,%cl
+    1033:	74 32                	je     1067 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+    1035:	0f b6 0a             	movzbl (%edx),%ecx
+    1038:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    103b:	80 fb 07             	cmp    $0x7,%bl
+    103e:	77 2c                	ja     106c <atoo+0x64>
+    1040:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+    1045:	83 c2 01             	add    $0x1,%edx
+    1048:	0f be c9             	movsbl %cl,%ecx
+    104b:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+    104f:	0f b6 0a             	movzbl (%edx),%ecx
+    1052:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    1055:	3c 07                	cmp    $0x7,%al
+    1057:	76 ec                	jbe    1045 <atoo+0x3d>
+  return sign*n;
+    1059:	89 f0                	mov    %esi,%eax
+    105b:	0f af c3             	imul   %ebx,%eax
+}
+    105e:	5b                   	pop    %ebx
+    105f:	5e                   	pop    %esi
+    1060:	5d                   	pop    %ebp
+    1061:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+    1062:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    1067:	83 c2 01             	add    $0x1,%edx
+    106a:	eb c9                	jmp    1035 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+    106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1071:	eb e6                	jmp    1059 <atoo+0x51>
+
+00001073 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1073:	55                   	push   %ebp
+    1074:	89 e5                	mov    %esp,%ebp
+    1076:	56                   	push   %esi
+    1077:	53                   	push   %ebx
+    1078:	8b 75 08             	mov    0x8(%ebp),%esi
+    107b:	8b 55 0c             	mov    0xc(%ebp),%edx
+    107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1081:	85 db                	test   %ebx,%ebx
+    1083:	7e 15                	jle    109a <memmove+0x27>
+    1085:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+    1087:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+    1089:	83 c2 01             	add    $0x1,%edx
+    108c:	83 c0 01             	add    $0x1,%eax
+    108f:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+    1093:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+    1096:	39 c3                	cmp    %eax,%ebx
+    1098:	75 ef                	jne    1089 <memmove+0x16>
+  return vdst;
+}
+    109a:	89 f0                	mov    %esi,%eax
+    109c:	5b                   	pop    %ebx
+    109d:	5e                   	pop    %esi
+    109e:	5d                   	pop    %ebp
+    109f:	c3                   	ret
+
+000010a0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    10a0:	b8 01 00 00 00       	mov    $0x1,%eax
+    10a5:	cd 40                	int    $0x40
+    10a7:	c3                   	ret
+
+000010a8 <exit>:
+SYSCALL(exit)
+    10a8:	b8 02 00 00 00       	mov    $0x2,%eax
+    10ad:	cd 40                	int    $0x40
+    10af:	c3                   	ret
+
+000010b0 <wait>:
+SYSCALL(wait)
+    10b0:	b8 03 00 00 00       	mov    $0x3,%eax
+    10b5:	cd 40                	int    $0x40
+    10b7:	c3                   	ret
+
+000010b8 <pipe>:
+SYSCALL(pipe)
+    10b8:	b8 04 00 00 00       	mov    $0x4,%eax
+    10bd:	cd 40                	int    $0x40
+    10bf:	c3                   	ret
+
+000010c0 <read>:
+SYSCALL(read)
+    10c0:	b8 05 00 00 00       	mov    $0x5,%eax
+    10c5:	cd 40                	int    $0x40
+    10c7:	c3                   	ret
+
+000010c8 <write>:
+SYSCALL(write)
+    10c8:	b8 10 00 00 00       	mov    $0x10,%eax
+    10cd:	cd 40                	int    $0x40
+    10cf:	c3                   	ret
+
+000010d0 <close>:
+SYSCALL(close)
+    10d0:	b8 15 00 00 00       	mov    $0x15,%eax
+    10d5:	cd 40                	int    $0x40
+    10d7:	c3                   	ret
+
+000010d8 <kill>:
+SYSCALL(kill)
+    10d8:	b8 06 00 00 00       	mov    $0x6,%eax
+    10dd:	cd 40                	int    $0x40
+    10df:	c3                   	ret
+
+000010e0 <exec>:
+SYSCALL(exec)
+    10e0:	b8 07 00 00 00       	mov    $0x7,%eax
+    10e5:	cd 40                	int    $0x40
+    10e7:	c3                   	ret
+
+000010e8 <open>:
+SYSCALL(open)
+    10e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    10ed:	cd 40                	int    $0x40
+    10ef:	c3                   	ret
+
+000010f0 <mknod>:
+SYSCALL(mknod)
+    10f0:	b8 11 00 00 00       	mov    $0x11,%eax
+    10f5:	cd 40                	int    $0x40
+    10f7:	c3                   	ret
+
+000010f8 <unlink>:
+SYSCALL(unlink)
+    10f8:	b8 12 00 00 00       	mov    $0x12,%eax
+    10fd:	cd 40                	int    $0x40
+    10ff:	c3                   	ret
+
+00001100 <fstat>:
+SYSCALL(fstat)
+    1100:	b8 08 00 00 00       	mov    $0x8,%eax
+    1105:	cd 40                	int    $0x40
+    1107:	c3                   	ret
+
+00001108 <link>:
+SYSCALL(link)
+    1108:	b8 13 00 00 00       	mov    $0x13,%eax
+    110d:	cd 40                	int    $0x40
+    110f:	c3                   	ret
+
+00001110 <mkdir>:
+SYSCALL(mkdir)
+    1110:	b8 14 00 00 00       	mov    $0x14,%eax
+    1115:	cd 40                	int    $0x40
+    1117:	c3                   	ret
+
+00001118 <chdir>:
+SYSCALL(chdir)
+    1118:	b8 09 00 00 00       	mov    $0x9,%eax
+    111d:	cd 40                	int    $0x40
+    111f:	c3                   	ret
+
+00001120 <dup>:
+SYSCALL(dup)
+    1120:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1125:	cd 40                	int    $0x40
+    1127:	c3                   	ret
+
+00001128 <getpid>:
+SYSCALL(getpid)
+    1128:	b8 0b 00 00 00       	mov    $0xb,%eax
+    112d:	cd 40                	int    $0x40
+    112f:	c3                   	ret
+
+00001130 <sbrk>:
+SYSCALL(sbrk)
+    1130:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1135:	cd 40                	int    $0x40
+    1137:	c3                   	ret
+
+00001138 <sleep>:
+SYSCALL(sleep)
+    1138:	b8 0d 00 00 00       	mov    $0xd,%eax
+    113d:	cd 40                	int    $0x40
+    113f:	c3                   	ret
+
+00001140 <uptime>:
+SYSCALL(uptime)
+    1140:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1145:	cd 40                	int    $0x40
+    1147:	c3                   	ret
+
+00001148 <halt>:
+SYSCALL(halt)
+    1148:	b8 16 00 00 00       	mov    $0x16,%eax
+    114d:	cd 40                	int    $0x40
+    114f:	c3                   	ret
+
+00001150 <date>:
+SYSCALL(date)
+    1150:	b8 17 00 00 00       	mov    $0x17,%eax
+    1155:	cd 40                	int    $0x40
+    1157:	c3                   	ret
+
+00001158 <getuid>:
+SYSCALL(getuid)
+    1158:	b8 18 00 00 00       	mov    $0x18,%eax
+    115d:	cd 40                	int    $0x40
+    115f:	c3                   	ret
+
+00001160 <getgid>:
+SYSCALL(getgid)
+    1160:	b8 19 00 00 00       	mov    $0x19,%eax
+    1165:	cd 40                	int    $0x40
+    1167:	c3                   	ret
+
+00001168 <getppid>:
+SYSCALL(getppid)
+    1168:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    116d:	cd 40                	int    $0x40
+    116f:	c3                   	ret
+
+00001170 <setuid>:
+SYSCALL(setuid)
+    1170:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1175:	cd 40                	int    $0x40
+    1177:	c3                   	ret
+
+00001178 <setgid>:
+SYSCALL(setgid)
+    1178:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    117d:	cd 40                	int    $0x40
+    117f:	c3                   	ret
+
+00001180 <getprocs>:
+SYSCALL(getprocs)
+    1180:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1185:	cd 40                	int    $0x40
+    1187:	c3                   	ret
+
+00001188 <setpriority>:
+SYSCALL(setpriority)
+    1188:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    118d:	cd 40                	int    $0x40
+    118f:	c3                   	ret
+
+00001190 <getpriority>:
+SYSCALL(getpriority)
+    1190:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1195:	cd 40                	int    $0x40
+    1197:	c3                   	ret
+
+00001198 <waitpid>:
+SYSCALL(waitpid)
+    1198:	b8 20 00 00 00       	mov    $0x20,%eax
+    119d:	cd 40                	int    $0x40
+    119f:	c3                   	ret
+
+000011a0 <setaffinity>:
+SYSCALL(setaffinity)
+    11a0:	b8 21 00 00 00       	mov    $0x21,%eax
+    11a5:	cd 40                	int    $0x40
+    11a7:	c3                   	ret
+
+000011a8 <getaffinity>:
+SYSCALL(getaffinity)
+    11a8:	b8 22 00 00 00       	mov    $0x22,%eax
+    11ad:	cd 40                	int    $0x40
+    11af:	c3                   	ret
+
+000011b0 <setdeadline>:
+SYSCALL(setdeadline)
+    11b0:	b8 23 00 00 00       	mov    $0x23,%eax
+    11b5:	cd 40                	int    $0x40
+    11b7:	c3                   	ret
+
+000011b8 <schedctl>:
+SYSCALL(schedctl)
+    11b8:	b8 24 00 00 00       	mov    $0x24,%eax
+    11bd:	cd 40                	int    $0x40
+    11bf:	c3                   	ret
+
+000011c0 <spawn>:
+SYSCALL(spawn)
+    11c0:	b8 25 00 00 00       	mov    $0x25,%eax
+    11c5:	cd 40                	int    $0x40
+    11c7:	c3                   	ret
+
+000011c8 <vmstats>:
+SYSCALL(vmstats)
+    11c8:	b8 26 00 00 00       	mov    $0x26,%eax
+    11cd:	cd 40                	int    $0x40
+    11cf:	c3                   	ret
+
+000011d0 <hugesbrk>:
+SYSCALL(hugesbrk)
+    11d0:	b8 27 00 00 00       	mov    $0x27,%eax
+    11d5:	cd 40                	int    $0x40
+    11d7:	c3                   	ret
+
+000011d8 <setshares>:
+SYSCALL(setshares)
+    11d8:	b8 28 00 00 00       	mov    $0x28,%eax
+    11dd:	cd 40                	int    $0x40
+    11df:	c3                   	ret
+
+000011e0 <getshares>:
+SYSCALL(getshares)
+    11e0:	b8 29 00 00 00       	mov    $0x29,%eax
+    11e5:	cd 40                	int    $0x40
+    11e7:	c3                   	ret
+
+000011e8 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    11e8:	55                   	push   %ebp
+    11e9:	89 e5                	mov    %esp,%ebp
+    11eb:	57                   	push   %edi
+    11ec:	56                   	push   %esi
+    11ed:	53                   	push   %ebx
+    11ee:	83 ec 3c             	sub    $0x3c,%esp
+    11f1:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    11f4:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    11f6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11fa:	74 79                	je     1275 <printint+0x8d>
+    11fc:	85 d2                	test   %edx,%edx
+    11fe:	79 75                	jns    1275 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+    1200:	89 d1                	mov    %edx,%ecx
+    1202:	f7 d9                	neg    %ecx
+    neg = 1;
+    1204:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    120b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    1210:	89 df                	mov    %ebx,%edi
+    1212:	83 c3 01             	add    $0x1,%ebx
+    1215:	89 c8                	mov    %ecx,%eax
+    1217:	ba 00 00 00 00       	mov    $0x0,%edx
+    121c:	f7 f6                	div    %esi
+    121e:	0f b6 92 f8 19 00 00 	movzbl 0x19f8(%edx),%edx
+    1225:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+    1229:	89 ca                	mov    %ecx,%edx
+    122b:	89 c1                	mov    %eax,%ecx
+    122d:	39 f2                	cmp    %esi,%edx
+    122f:	73 df                	jae    1210 <printint+0x28>
+  if(neg)
+    1231:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+    1235:	74 08                	je     123f <printint+0x57>
+    buf[i++] = '-';
+    1237:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    123c:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+    123f:	85 db                	test   %ebx,%ebx
+    1241:	7e 2a                	jle    126d <printint+0x85>
+    1243:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    1246:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+    124a:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+    124d:	0f b6 03             	movzbl (%ebx),%eax
+    1250:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    1253:	83 ec 04             	sub    $0x4,%esp
+    1256:	6a 01                	push   $0x1
+    1258:	57                   	push   %edi
+    1259:	ff 75 c4             	push   -0x3c(%ebp)
+    125c:	e8 67 fe ff ff       	call   10c8 <write>
+  while(--i >= 0)
+    1261:	89 d8                	mov    %ebx,%eax
+    1263:	83 eb 01             	sub    $0x1,%ebx
+    1266:	83 c4 10             	add    $0x10,%esp
+    1269:	39 f0                	cmp    %esi,%eax
+    126b:	75 e0                	jne    124d <printint+0x65>
+}
+    126d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1270:	5b                   	pop    %ebx
+    1271:	5e                   	pop    %esi
+    1272:	5f                   	pop    %edi
+    1273:	5d                   	pop    %ebp
+    1274:	c3                   	ret
+    x = xx;
+    1275:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+    1277:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+    127e:	eb 8b                	jmp    120b <printint+0x23>
+
+00001280 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	53                   	push   %ebx
+    1286:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1289:	8b 75 0c             	mov    0xc(%ebp),%esi
+    128c:	0f b6 1e             	movzbl (%esi),%ebx
+    128f:	84 db                	test   %bl,%bl
+    1291:	0f 84 9e 01 00 00    	je     1435 <printf+0x1b5>
+    1297:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    129a:	8d 45 10             	lea    0x10(%ebp),%eax
+    129d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+    12a0:	bf 00 00 00 00       	mov    $0x0,%edi
+    12a5:	eb 2d                	jmp    12d4 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    12a7:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    12aa:	83 ec 04             	sub    $0x4,%esp
+    12ad:	6a 01                	push   $0x1
+    12af:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    12b2:	50                   	push   %eax
+    12b3:	ff 75 08             	push   0x8(%ebp)
+    12b6:	e8 0d fe ff ff       	call   10c8 <write>
+        putc(fd, c);
+    12bb:	83 c4 10             	add    $0x10,%esp
+    12be:	eb 05                	jmp    12c5 <printf+0x45>
+      }
+    } else if(state == '%'){
+    12c0:	83 ff 25             	cmp    $0x25,%edi
+    12c3:	74 1f                	je     12e4 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+    12c5:	83 c6 01             	add    $0x1,%esi
+    12c8:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+    12cc:	84 db                	test   %bl,%bl
+    12ce:	0f 84 61 01 00 00    	je     1435 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+    12d4:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    12d7:	85 ff                	test   %edi,%edi
+    12d9:	75 e5                	jne    12c0 <printf+0x40>
+      if(c == '%'){
+    12db:	83 f8 25             	cmp    $0x25,%eax
+    12de:	75 c7                	jne    12a7 <printf+0x27>
+        state = '%';
+    12e0:	89 c7                	mov    %eax,%edi
+    12e2:	eb e1                	jmp    12c5 <printf+0x45>
+      if(c == 'd'){
+    12e4:	83 f8 25             	cmp    $0x25,%eax
+    12e7:	0f 84 f4 00 00 00    	je     13e1 <printf+0x161>
+    12ed:	8d 50 9d             	lea    -0x63(%eax),%edx
+    12f0:	83 fa 15             	cmp    $0x15,%edx
+    12f3:	0f 87 09 01 00 00    	ja     1402 <printf+0x182>
+    12f9:	0f 87 03 01 00 00    	ja     1402 <printf+0x182>
+    12ff:	ff 24 95 a0 19 00 00 	jmp    *0x19a0(,%edx,4)
+        printint(fd, *ap, 10, 1);
+    1306:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1309:	8b 17                	mov    (%edi),%edx
+    130b:	83 ec 0c             	sub    $0xc,%esp
+    130e:	6a 01                	push   $0x1
+    1310:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1315:	8b 45 08             	mov    0x8(%ebp),%eax
+    1318:	e8 cb fe ff ff       	call   11e8 <printint>
+        ap++;
+    131d:	83 c7 04             	add    $0x4,%edi
+    1320:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1323:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    1326:	bf 00 00 00 00       	mov    $0x0,%edi
+    132b:	eb 98                	jmp    12c5 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+    132d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1330:	8b 17                	mov    (%edi),%edx
+    1332:	83 ec 0c             	sub    $0xc,%esp
+    1335:	6a 00                	push   $0x0
+    1337:	b9 10 00 00 00       	mov    $0x10,%ecx
+    133c:	8b 45 08             	mov    0x8(%ebp),%eax
+    133f:	e8 a4 fe ff ff       	call   11e8 <printint>
+        ap++;
+    1344:	83 c7 04             	add    $0x4,%edi
+    1347:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    134a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    134d:	bf 00 00 00 00       	mov    $0x0,%edi
+    1352:	e9 6e ff ff ff       	jmp    12c5 <printf+0x45>
+        s = (char*)*ap;
+    1357:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    135a:	8b 01                	mov    (%ecx),%eax
+        ap++;
+    135c:	83 c1 04             	add    $0x4,%ecx
+    135f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+    1362:	85 c0                	test   %eax,%eax
+    1364:	74 13                	je     1379 <printf+0xf9>
+        s = (char*)*ap;
+    1366:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+    1368:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+    136b:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+    1370:	84 c0                	test   %al,%al
+    1372:	75 0f                	jne    1383 <printf+0x103>
+    1374:	e9 4c ff ff ff       	jmp    12c5 <printf+0x45>
+          s = "(null)";
+    1379:	bb 99 19 00 00       	mov    $0x1999,%ebx
+        while(*s != 0){
+    137e:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+    1383:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    1386:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    1389:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+    138c:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    138f:	83 ec 04             	sub    $0x4,%esp
+    1392:	6a 01                	push   $0x1
+    1394:	57                   	push   %edi
+    1395:	56                   	push   %esi
+    1396:	e8 2d fd ff ff       	call   10c8 <write>
+          s++;
+    139b:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    139e:	0f b6 03             	movzbl (%ebx),%eax
+    13a1:	83 c4 10             	add    $0x10,%esp
+    13a4:	84 c0                	test   %al,%al
+    13a6:	75 e4                	jne    138c <printf+0x10c>
+      state = 0;
+    13a8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    13ab:	bf 00 00 00 00       	mov    $0x0,%edi
+    13b0:	e9 10 ff ff ff       	jmp    12c5 <printf+0x45>
+        putc(fd, *ap);
+    13b5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    13b8:	8b 07                	mov    (%edi),%eax
+    13ba:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    13bd:	83 ec 04             	sub    $0x4,%esp
+    13c0:	6a 01                	push   $0x1
+    13c2:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    13c5:	50                   	push   %eax
+    13c6:	ff 75 08             	push   0x8(%ebp)
+    13c9:	e8 fa fc ff ff       	call   10c8 <write>
+        ap++;
+    13ce:	83 c7 04             	add    $0x4,%edi
+    13d1:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    13d4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13d7:	bf 00 00 00 00       	mov    $0x0,%edi
+    13dc:	e9 e4 fe ff ff       	jmp    12c5 <printf+0x45>
+        putc(fd, c);
+    13e1:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    13e4:	83 ec 04             	sub    $0x4,%esp
+    13e7:	6a 01                	push   $0x1
+    13e9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    13ec:	50                   	push   %eax
+    13ed:	ff 75 08             	push   0x8(%ebp)
+    13f0:	e8 d3 fc ff ff       	call   10c8 <write>
+    13f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13f8:	bf 00 00 00 00       	mov    $0x0,%edi
+    13fd:	e9 c3 fe ff ff       	jmp    12c5 <printf+0x45>
+        putc(fd, '%');
+    1402:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    1406:	83 ec 04             	sub    $0x4,%esp
+    1409:	6a 01                	push   $0x1
+    140b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    140e:	57                   	push   %edi
+    140f:	ff 75 08             	push   0x8(%ebp)
+    1412:	e8 b1 fc ff ff       	call   10c8 <write>
+        putc(fd, c);
+    1417:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    141a:	83 c4 0c             	add    $0xc,%esp
+    141d:	6a 01                	push   $0x1
+    141f:	57                   	push   %edi
+    1420:	ff 75 08             	push   0x8(%ebp)
+    1423:	e8 a0 fc ff ff       	call   10c8 <write>
+        putc(fd, c);
+    1428:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    142b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1430:	e9 90 fe ff ff       	jmp    12c5 <printf+0x45>
+    }
+  }
+}
+    1435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1438:	5b                   	pop    %ebx
+    1439:	5e                   	pop    %esi
+    143a:	5f                   	pop    %edi
+    143b:	5d                   	pop    %ebp
+    143c:	c3                   	ret
+
+0000143d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    143d:	55                   	push   %ebp
+    143e:	89 e5                	mov    %esp,%ebp
+    1440:	57                   	push   %edi
+    1441:	56                   	push   %esi
+    1442:	53                   	push   %ebx
+    1443:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1446:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1449:	a1 88 1f 00 00       	mov    0x1f88,%eax
+    144e:	eb 0c                	jmp    145c <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1450:	8b 10                	mov    (%eax),%edx
+    1452:	39 d0                	cmp    %edx,%eax
+    1454:	72 04                	jb     145a <free+0x1d>
+    1456:	39 d1                	cmp    %edx,%ecx
+    1458:	72 10                	jb     146a <free+0x2d>
+{
+    145a:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    145c:	39 c8                	cmp    %ecx,%eax
+    145e:	73 f0                	jae    1450 <free+0x13>
+    1460:	8b 10                	mov    (%eax),%edx
+    1462:	39 d1                	cmp    %edx,%ecx
+    1464:	72 04                	jb     146a <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1466:	39 d0                	cmp    %edx,%eax
+    1468:	72 f0                	jb     145a <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    146a:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    146d:	8b 10                	mov    (%eax),%edx
+    146f:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1472:	39 fa                	cmp    %edi,%edx
+    1474:	74 19                	je     148f <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1476:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1479:	8b 50 04             	mov    0x4(%eax),%edx
+    147c:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    147f:	39 f1                	cmp    %esi,%ecx
+    1481:	74 18                	je     149b <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1483:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    1485:	a3 88 1f 00 00       	mov    %eax,0x1f88
+}
+    148a:	5b                   	pop    %ebx
+    148b:	5e                   	pop    %esi
+    148c:	5f                   	pop    %edi
+    148d:	5d                   	pop    %ebp
+    148e:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    148f:	03 72 04             	add    0x4(%edx),%esi
+    1492:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1495:	8b 10                	mov    (%eax),%edx
+    1497:	8b 12                	mov    (%edx),%edx
+    1499:	eb db                	jmp    1476 <free+0x39>
+    p->s.size += bp->s.size;
+    149b:	03 53 fc             	add    -0x4(%ebx),%edx
+    149e:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    14a1:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    14a4:	eb dd                	jmp    1483 <free+0x46>
+
+000014a6 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    14a6:	55                   	push   %ebp
+    14a7:	89 e5                	mov    %esp,%ebp
+    14a9:	57                   	push   %edi
+    14aa:	56                   	push   %esi
+    14ab:	53                   	push   %ebx
+    14ac:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    14af:	8b 45 08             	mov    0x8(%ebp),%eax
+    14b2:	8d 58 07             	lea    0x7(%eax),%ebx
+    14b5:	c1 eb 03             	shr    $0x3,%ebx
+    14b8:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    14bb:	8b 15 88 1f 00 00    	mov    0x1f88,%edx
+    14c1:	85 d2                	test   %edx,%edx
+    14c3:	74 1c                	je     14e1 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    14c5:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    14c7:	8b 48 04             	mov    0x4(%eax),%ecx
+    14ca:	39 d9                	cmp    %ebx,%ecx
+    14cc:	73 38                	jae    1506 <malloc+0x60>
+  if(nu < 4096)
+    14ce:	be 00 10 00 00       	mov    $0x1000,%esi
+    14d3:	39 f3                	cmp    %esi,%ebx
+    14d5:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    14d8:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    14df:	eb 72                	jmp    1553 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    14e1:	c7 05 88 1f 00 00 8c 	movl   $0x1f8c,0x1f88
+    14e8:	1f 00 00 
+    14eb:	c7 05 8c 1f 00 00 8c 	movl   $0x1f8c,0x1f8c
+    14f2:	1f 00 00 
+    base.s.size = 0;
+    14f5:	c7 05 90 1f 00 00 00 	movl   $0x0,0x1f90
+    14fc:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    14ff:	b8 8c 1f 00 00       	mov    $0x1f8c,%eax
+    if(p->s.size >= nunits){
+    1504:	eb c8                	jmp    14ce <malloc+0x28>
+      if(p->s.size == nunits)
+    1506:	39 cb                	cmp    %ecx,%ebx
+    1508:	74 1e                	je     1528 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    150a:	29 d9                	sub    %ebx,%ecx
+    150c:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    150f:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    1512:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    1515:	89 15 88 1f 00 00    	mov    %edx,0x1f88
+      return (void*)(p + 1);
+    151b:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    151e:	89 d0                	mov    %edx,%eax
+    1520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1523:	5b                   	pop    %ebx
+    1524:	5e                   	pop    %esi
+    1525:	5f                   	pop    %edi
+    1526:	5d                   	pop    %ebp
+    1527:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    1528:	8b 08                	mov    (%eax),%ecx
+    152a:	89 0a                	mov    %ecx,(%edx)
+    152c:	eb e7                	jmp    1515 <malloc+0x6f>
+  hp->s.size = nu;
+    152e:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    1531:	83 ec 0c             	sub    $0xc,%esp
+    1534:	83 c0 08             	add    $0x8,%eax
+    1537:	50                   	push   %eax
+    1538:	e8 00 ff ff ff       	call   143d <free>
+  return freep;
+    153d:	8b 15 88 1f 00 00    	mov    0x1f88,%edx
+      if((p = morecore(nunits)) == 0)
+    1543:	83 c4 10             	add    $0x10,%esp
+    1546:	85 d2                	test   %edx,%edx
+    1548:	74 d4                	je     151e <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    154a:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    154c:	8b 48 04             	mov    0x4(%eax),%ecx
+    154f:	39 d9                	cmp    %ebx,%ecx
+    1551:	73 b3                	jae    1506 <malloc+0x60>
+    if(p == freep)
+    1553:	89 c2                	mov    %eax,%edx
+    1555:	39 05 88 1f 00 00    	cmp    %eax,0x1f88
+    155b:	75 ed                	jne    154a <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    155d:	83 ec 0c             	sub    $0xc,%esp
+    1560:	57                   	push   %edi
+    1561:	e8 ca fb ff ff       	call   1130 <sbrk>
+  if(p == (char*)-1)
+    1566:	83 c4 10             	add    $0x10,%esp
+    1569:	83 f8 ff             	cmp    $0xffffffff,%eax
+    156c:	75 c0                	jne    152e <malloc+0x88>
+        return 0;
+    156e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1573:	eb a9                	jmp    151e <malloc+0x78>
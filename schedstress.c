@@ -1,6 +1,12 @@
 #ifdef CS333_P4
 #include "types.h"
 #include "user.h"
+#include "schedctl.h"
+#include "spawn.h"
+#ifdef PDX_STRIDE
+#include "param.h"
+#include "uproc.h"
+#endif
 
 // Noah Zentzis, 2016
 
@@ -201,6 +207,307 @@ test4(void) {
   printf(1, "\n> test 4 complete\n");
 }
 
+// Test 5: scaling. Several workers each fork and reap a stream of short-lived
+// children while burning a little CPU in between, which keeps every run queue
+// busy and constantly refilled. Run it with CPUS=1, 2, 4 and 8; with per-cpu
+// run queues the elapsed time should drop roughly in proportion.
+#define T5_WORKERS 8
+#define T5_FORKS   200
+
+void
+test5(void) {
+  int start, end;
+
+  printf(1, "\n> starting test 5\n");
+  start = uptime();
+  for(int i = 0;i < T5_WORKERS;i++) {
+    if(fork() == 0) {
+      for(int j = 0;j < T5_FORKS;j++) {
+        int p = fork();
+        if(p == 0) {
+          for(volatile int k = 0;k < 0x1000;k++);
+          exit();
+        }
+        if(p > 0)
+          wait();
+        for(volatile int k = 0;k < 0x4000;k++);
+      }
+      exit();
+    }
+  }
+  waitall();
+  end = uptime();
+  printf(1, "%d workers, %d forks each: %d ticks\n",
+         T5_WORKERS, T5_FORKS, end - start);
+  printf(1, "\n> test 5 complete\n");
+}
+
+// waitpid() reaps the requested child, in any order, and refuses
+// pids that are not our children.
+#define T6_CHILDREN 16
+void
+test6(void) {
+  int pids[T6_CHILDREN];
+  int fail = 0;
+
+  printf(1, "\n> starting test 6\n");
+  for(int i = 0;i < T6_CHILDREN;i++) {
+    pids[i] = fork();
+    if(pids[i] == 0) {
+      for(volatile int k = 0;k < 0x1000 * i;k++);
+      exit();
+    }
+  }
+  for(int i = T6_CHILDREN - 1;i >= 0;i--) {
+    if(pids[i] > 0 && waitpid(pids[i]) != pids[i]) {
+      printf(1, "waitpid(%d) failed\n", pids[i]);
+      fail = 1;
+    }
+  }
+  if(waitpid(getpid()) != -1 || waitpid(1) != -1 || wait() != -1) {
+    printf(1, "waitpid accepted a non-child\n");
+    fail = 1;
+  }
+  printf(1, "\n> test 6 %s\n", fail ? "FAILED" : "complete");
+}
+
+// Test 7: cache-warm placement. Workers repeatedly sweep a working set
+// small enough to stay in cache, first free to run anywhere, then
+// pinned one per cpu with setaffinity(). Pinned workers never find
+// their data in another core's cache, so should finish sooner.
+#define T7_WORKERS 4
+#define T7_SETSIZE (64*1024)
+#define T7_PASSES 200
+
+int
+t7run(int ncpu, int pin) {
+  int start = uptime();
+
+  for(int i = 0;i < T7_WORKERS;i++) {
+    if(fork() == 0) {
+      int *set = malloc(T7_SETSIZE);
+      int n = T7_SETSIZE / sizeof(int);
+      volatile int sum = 0;
+
+      if(pin)
+        setaffinity(getpid(), 1 << (i % ncpu));
+      for(int j = 0;j < n;j++)
+        set[j] = j;
+      for(int k = 0;k < T7_PASSES;k++)
+        for(int j = 0;j < n;j++)
+          sum += set[j];
+      exit();
+    }
+  }
+  waitall();
+  return uptime() - start;
+}
+
+void
+test7(void) {
+  int mask = getaffinity(getpid());
+  int ncpu = 0;
+
+  printf(1, "\n> starting test 7\n");
+  for(int i = 0;i < 32;i++)
+    if(mask & (1 << i))
+      ncpu++;
+  printf(1, "%d workers on %d cpus, unpinned: %d ticks\n",
+         T7_WORKERS, ncpu, t7run(ncpu, 0));
+  printf(1, "%d workers on %d cpus, pinned:   %d ticks\n",
+         T7_WORKERS, ncpu, t7run(ncpu, 1));
+  printf(1, "\n> test 7 complete\n");
+}
+
+// Test 8: deadline class. A sampler wants to run every T8_PERIOD
+// ticks while CPU-bound batch jobs share its MLFQ level. Count the
+// periods it misses, first as an ordinary process and then with a
+// setdeadline() reservation.
+#define T8_PERIOD 10
+#define T8_SAMPLES 100
+#define T8_BATCH 8
+
+int
+t8run(int reserve) {
+  int batch[T8_BATCH];
+  int misses = 0;
+  int next, now;
+
+  for(int i = 0;i < T8_BATCH;i++) {
+    if((batch[i] = fork()) == 0) {
+      for(;;);
+    }
+  }
+  if(reserve && setdeadline(getpid(), 2, T8_PERIOD) < 0)
+    printf(1, "setdeadline failed\n");
+  next = uptime() + T8_PERIOD;
+  for(int i = 0;i < T8_SAMPLES;i++) {
+    for(volatile int k = 0;k < 0x1000;k++);
+    now = uptime();
+    if(now > next)
+      misses++;
+    else
+      sleep(next - now);
+    next += T8_PERIOD;
+  }
+  setdeadline(getpid(), 0, 0);
+  for(int i = 0;i < T8_BATCH;i++)
+    kill(batch[i]);
+  waitall();
+  return misses;
+}
+
+void
+test8(void) {
+  printf(1, "\n> starting test 8\n");
+  printf(1, "%d of %d periods missed without a reservation\n",
+         t8run(0), T8_SAMPLES);
+  printf(1, "%d of %d periods missed with setdeadline()\n",
+         t8run(1), T8_SAMPLES);
+  printf(1, "\n> test 8 complete\n");
+}
+
+#ifdef PDX_STRIDE
+// Test 9: group shares. One uid forks many CPU-bound processes and
+// another forks one; with equal shares each uid should get about half
+// of the cpu time despite the imbalance.
+#define T9_HOGS 16
+#define T9_TICKS 3000
+#define T9_UIDA 1001
+#define T9_UIDB 1002
+
+void
+t9spawn(int uid, int *pids, int n) {
+  for(int i = 0;i < n;i++) {
+    if((pids[i] = fork()) == 0) {
+      setuid(uid);
+      for(;;);
+    }
+  }
+}
+
+void
+test9(void) {
+  int pids[T9_HOGS+1];
+  struct uproc *table = malloc(sizeof(*table)*NPROC);
+  uint a = 0, b = 0;
+  int n;
+
+  printf(1, "\n> starting test 9\n");
+  setshares(T9_UIDA, 100);
+  setshares(T9_UIDB, 100);
+  t9spawn(T9_UIDA, pids, T9_HOGS);
+  t9spawn(T9_UIDB, pids + T9_HOGS, 1);
+  sleep(T9_TICKS);
+  n = getprocs(NPROC, table);
+  for(int i = 0;i < n;i++) {
+    if(table[i].uid == T9_UIDA)
+      a += table[i].CPU_total_ticks;
+    else if(table[i].uid == T9_UIDB)
+      b += table[i].CPU_total_ticks;
+  }
+  for(int i = 0;i <= T9_HOGS;i++)
+    kill(pids[i]);
+  waitall();
+  free(table);
+  if(a + b == 0)
+    a = 1;
+  printf(1, "uid %d (%d procs): %d%%, uid %d (1 proc): %d%%\n",
+         T9_UIDA, T9_HOGS, a*100/(a+b), T9_UIDB, b*100/(a+b));
+  printf(1, "\n> test 9 complete\n");
+}
+#endif // PDX_STRIDE
+
+// Test 10: fork rate as the process table grows. Raises maxproc, then
+// forks children that stay blocked on a pipe in batches, timing each
+// batch; with procs allocated on demand the rate should hold up until
+// memory runs out.
+#define T10_MAXPROC 2048
+#define T10_BATCH 128
+
+void
+test10(void) {
+  struct schedparams sp, old;
+  int fd[2], live = 0, start, t, n, full = 0;
+  char c;
+
+  printf(1, "\n> starting test 10\n");
+  schedctl(SCHED_GET, &old);
+  sp = old;
+  sp.maxproc = T10_MAXPROC;
+  if(schedctl(SCHED_SET, &sp) < 0)
+    printf(1, "cannot raise maxproc to %d\n", T10_MAXPROC);
+  pipe(fd);
+  printf(1, "procs\tforks/sec\n");
+  while(!full) {
+    start = uptime();
+    for(n = 0;n < T10_BATCH;n++) {
+      int pid = fork();
+      if(pid == 0) {
+        close(fd[1]);
+        read(fd[0], &c, 1);
+        exit();
+      }
+      if(pid < 0) {
+        full = 1;
+        break;
+      }
+      live++;
+    }
+    t = uptime() - start;
+    printf(1, "%d\t%d\n", live, t ? n*1000/t : 0);
+  }
+  close(fd[1]);
+  close(fd[0]);
+  waitall();
+  schedctl(SCHED_SET, &old);
+  printf(1, "fork failed with %d children\n", live);
+  printf(1, "\n> test 10 complete\n");
+}
+
+// Test 11: launch latency. Starts a program that exits at once
+// T11_RUNS times with fork()+exec() and with spawn(), from this process
+// as it is and again after growing it by T11_GROW bytes. fork() has to
+// copy the bigger image; spawn() should take the same time either way.
+#define T11_RUNS 50
+#define T11_GROW (8*1024*1024)
+
+char *t11argv[] = { "schedstress", "99", 0 };
+
+int
+t11run(int usespawn) {
+  int pid, start = uptime();
+
+  for(int i = 0;i < T11_RUNS;i++) {
+    if(usespawn)
+      pid = spawn(t11argv[0], t11argv, 0);
+    else if((pid = fork()) == 0) {
+      exec(t11argv[0], t11argv);
+      exit();
+    }
+    if(pid > 0)
+      waitpid(pid);
+  }
+  return uptime() - start;
+}
+
+void
+test11(void) {
+  char *grow;
+
+  printf(1, "\n> starting test 11\n");
+  printf(1, "size\tfork+exec\tspawn (ticks for %d)\n", T11_RUNS);
+  printf(1, "%d\t%d\t\t%d\n", (int)sbrk(0), t11run(0), t11run(1));
+  if((grow = sbrk(T11_GROW)) == (char*)-1) {
+    printf(1, "cannot grow by %d bytes\n", T11_GROW);
+    return;
+  }
+  memset(grow, 1, T11_GROW);
+  printf(1, "%d\t%d\t\t%d\n", (int)sbrk(0), t11run(0), t11run(1));
+  sbrk(-T11_GROW);
+  printf(1, "\n> test 11 complete\n");
+}
+
 int
 main(int argc, char **argv) {
   int test = 0;
@@ -211,6 +518,15 @@ main(int argc, char **argv) {
   if(test == 2 || test == 0) test2();
   if(test == 3 || test == 0) test3();
   if(test == 4 || test == 0) test4();
+  if(test == 5 || test == 0) test5();
+  if(test == 6 || test == 0) test6();
+  if(test == 7 || test == 0) test7();
+  if(test == 8 || test == 0) test8();
+#ifdef PDX_STRIDE
+  if(test == 9 || test == 0) test9();
+#endif
+  if(test == 10 || test == 0) test10();
+  if(test == 11 || test == 0) test11();
   exit();
 }
 #endif
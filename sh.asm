@@ -0,0 +1,3435 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <freecmd>:
+}
+
+// Free a command parsed by parsecmd().
+void
+freecmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 04             	sub    $0x4,%esp
+       7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+       a:	85 db                	test   %ebx,%ebx
+       c:	74 5d                	je     6b <freecmd+0x6b>
+    return;
+  switch(cmd->type){
+       e:	8b 03                	mov    (%ebx),%eax
+      10:	83 f8 04             	cmp    $0x4,%eax
+      13:	74 5b                	je     70 <freecmd+0x70>
+      15:	7f 25                	jg     3c <freecmd+0x3c>
+      17:	83 f8 02             	cmp    $0x2,%eax
+      1a:	74 35                	je     51 <freecmd+0x51>
+      1c:	83 f8 03             	cmp    $0x3,%eax
+      1f:	75 3e                	jne    5f <freecmd+0x5f>
+  case REDIR:
+    freecmd(((struct redircmd*)cmd)->cmd);
+    break;
+  case PIPE:
+    freecmd(((struct pipecmd*)cmd)->left);
+      21:	83 ec 0c             	sub    $0xc,%esp
+      24:	ff 73 04             	push   0x4(%ebx)
+      27:	e8 d4 ff ff ff       	call   0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+      2c:	83 c4 04             	add    $0x4,%esp
+      2f:	ff 73 08             	push   0x8(%ebx)
+      32:	e8 c9 ff ff ff       	call   0 <freecmd>
+    break;
+      37:	83 c4 10             	add    $0x10,%esp
+      3a:	eb 23                	jmp    5f <freecmd+0x5f>
+  switch(cmd->type){
+      3c:	83 f8 05             	cmp    $0x5,%eax
+      3f:	75 1e                	jne    5f <freecmd+0x5f>
+  case LIST:
+    freecmd(((struct listcmd*)cmd)->left);
+    freecmd(((struct listcmd*)cmd)->right);
+    break;
+  case BACK:
+    freecmd(((struct backcmd*)cmd)->cmd);
+      41:	83 ec 0c             	sub    $0xc,%esp
+      44:	ff 73 04             	push   0x4(%ebx)
+      47:	e8 b4 ff ff ff       	call   0 <freecmd>
+    break;
+      4c:	83 c4 10             	add    $0x10,%esp
+      4f:	eb 0e                	jmp    5f <freecmd+0x5f>
+    freecmd(((struct redircmd*)cmd)->cmd);
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	ff 73 04             	push   0x4(%ebx)
+      57:	e8 a4 ff ff ff       	call   0 <freecmd>
+    break;
+      5c:	83 c4 10             	add    $0x10,%esp
+  }
+  free(cmd);
+      5f:	83 ec 0c             	sub    $0xc,%esp
+      62:	53                   	push   %ebx
+      63:	e8 6d 17 00 00       	call   17d5 <free>
+      68:	83 c4 10             	add    $0x10,%esp
+}
+      6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      6e:	c9                   	leave
+      6f:	c3                   	ret
+    freecmd(((struct listcmd*)cmd)->left);
+      70:	83 ec 0c             	sub    $0xc,%esp
+      73:	ff 73 04             	push   0x4(%ebx)
+      76:	e8 85 ff ff ff       	call   0 <freecmd>
+    freecmd(((struct listcmd*)cmd)->right);
+      7b:	83 c4 04             	add    $0x4,%esp
+      7e:	ff 73 08             	push   0x8(%ebx)
+      81:	e8 7a ff ff ff       	call   0 <freecmd>
+    break;
+      86:	83 c4 10             	add    $0x10,%esp
+      89:	eb d4                	jmp    5f <freecmd+0x5f>
+
+0000008b <getcmd>:
+#endif // CS333_P4
+
+int
+getcmd(char *buf, int nbuf)
+{
+      8b:	55                   	push   %ebp
+      8c:	89 e5                	mov    %esp,%ebp
+      8e:	56                   	push   %esi
+      8f:	53                   	push   %ebx
+      90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      93:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+      96:	83 ec 08             	sub    $0x8,%esp
+      99:	68 10 19 00 00       	push   $0x1910
+      9e:	6a 02                	push   $0x2
+      a0:	e8 73 15 00 00       	call   1618 <printf>
+  memset(buf, 0, nbuf);
+      a5:	83 c4 0c             	add    $0xc,%esp
+      a8:	56                   	push   %esi
+      a9:	6a 00                	push   $0x0
+      ab:	53                   	push   %ebx
+      ac:	e8 a1 11 00 00       	call   1252 <memset>
+  gets(buf, nbuf);
+      b1:	83 c4 08             	add    $0x8,%esp
+      b4:	56                   	push   %esi
+      b5:	53                   	push   %ebx
+      b6:	e8 dd 11 00 00       	call   1298 <gets>
+  if(buf[0] == 0) // EOF
+      bb:	83 c4 10             	add    $0x10,%esp
+      be:	80 3b 01             	cmpb   $0x1,(%ebx)
+      c1:	19 c0                	sbb    %eax,%eax
+    return -1;
+  return 0;
+}
+      c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      c6:	5b                   	pop    %ebx
+      c7:	5e                   	pop    %esi
+      c8:	5d                   	pop    %ebp
+      c9:	c3                   	ret
+
+000000ca <strncmp>:
+#ifdef USE_BUILTINS
+// ***** processing for shell builtins begins here *****
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+      ca:	55                   	push   %ebp
+      cb:	89 e5                	mov    %esp,%ebp
+      cd:	53                   	push   %ebx
+      ce:	8b 55 08             	mov    0x8(%ebp),%edx
+      d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+      d4:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+      d7:	85 c0                	test   %eax,%eax
+      d9:	74 29                	je     104 <strncmp+0x3a>
+      db:	0f b6 1a             	movzbl (%edx),%ebx
+      de:	84 db                	test   %bl,%bl
+      e0:	74 16                	je     f8 <strncmp+0x2e>
+      e2:	3a 19                	cmp    (%ecx),%bl
+      e4:	75 12                	jne    f8 <strncmp+0x2e>
+      n--, p++, q++;
+      e6:	83 c2 01             	add    $0x1,%edx
+      e9:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+      ec:	83 e8 01             	sub    $0x1,%eax
+      ef:	75 ea                	jne    db <strncmp+0x11>
+    if(n == 0)
+      return 0;
+      f1:	b8 00 00 00 00       	mov    $0x0,%eax
+      f6:	eb 0c                	jmp    104 <strncmp+0x3a>
+    if(n == 0)
+      f8:	85 c0                	test   %eax,%eax
+      fa:	74 0d                	je     109 <strncmp+0x3f>
+    return (uchar)*p - (uchar)*q;
+      fc:	0f b6 02             	movzbl (%edx),%eax
+      ff:	0f b6 11             	movzbl (%ecx),%edx
+     102:	29 d0                	sub    %edx,%eax
+}
+     104:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     107:	c9                   	leave
+     108:	c3                   	ret
+      return 0;
+     109:	b8 00 00 00 00       	mov    $0x0,%eax
+     10e:	eb f4                	jmp    104 <strncmp+0x3a>
+
+00000110 <setbuiltin>:
+int
+setbuiltin(char *p)
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	53                   	push   %ebx
+     114:	83 ec 10             	sub    $0x10,%esp
+  int i;
+  int rc;
+
+  p += strlen("_set");
+     117:	68 13 19 00 00       	push   $0x1913
+     11c:	e8 0b 11 00 00       	call   122c <strlen>
+     121:	03 45 08             	add    0x8(%ebp),%eax
+     124:	89 c3                	mov    %eax,%ebx
+  while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	eb 03                	jmp    12e <setbuiltin+0x1e>
+     12b:	83 c3 01             	add    $0x1,%ebx
+     12e:	83 ec 04             	sub    $0x4,%esp
+     131:	6a 01                	push   $0x1
+     133:	68 11 19 00 00       	push   $0x1911
+     138:	53                   	push   %ebx
+     139:	e8 8c ff ff ff       	call   ca <strncmp>
+     13e:	83 c4 10             	add    $0x10,%esp
+     141:	85 c0                	test   %eax,%eax
+     143:	74 e6                	je     12b <setbuiltin+0x1b>
+  if (strncmp("uid", p, 3) == 0) {
+     145:	83 ec 04             	sub    $0x4,%esp
+     148:	6a 03                	push   $0x3
+     14a:	53                   	push   %ebx
+     14b:	68 18 19 00 00       	push   $0x1918
+     150:	e8 75 ff ff ff       	call   ca <strncmp>
+     155:	83 c4 10             	add    $0x10,%esp
+     158:	85 c0                	test   %eax,%eax
+     15a:	74 2b                	je     187 <setbuiltin+0x77>
+    i = atoi(p);
+    rc = (setuid(i));
+    if (rc == 0)
+      return 0;
+  } else
+  if (strncmp("gid", p, 3) == 0) {
+     15c:	83 ec 04             	sub    $0x4,%esp
+     15f:	6a 03                	push   $0x3
+     161:	53                   	push   %ebx
+     162:	68 1c 19 00 00       	push   $0x191c
+     167:	e8 5e ff ff ff       	call   ca <strncmp>
+     16c:	83 c4 10             	add    $0x10,%esp
+     16f:	85 c0                	test   %eax,%eax
+     171:	75 5a                	jne    1cd <setbuiltin+0xbd>
+    p += strlen("gid");
+     173:	83 ec 0c             	sub    $0xc,%esp
+     176:	68 1c 19 00 00       	push   $0x191c
+     17b:	e8 ac 10 00 00       	call   122c <strlen>
+     180:	01 c3                	add    %eax,%ebx
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	eb 62                	jmp    1e9 <setbuiltin+0xd9>
+    p += strlen("uid");
+     187:	83 ec 0c             	sub    $0xc,%esp
+     18a:	68 18 19 00 00       	push   $0x1918
+     18f:	e8 98 10 00 00       	call   122c <strlen>
+     194:	01 c3                	add    %eax,%ebx
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     196:	83 c4 10             	add    $0x10,%esp
+     199:	eb 03                	jmp    19e <setbuiltin+0x8e>
+     19b:	83 c3 01             	add    $0x1,%ebx
+     19e:	83 ec 04             	sub    $0x4,%esp
+     1a1:	6a 01                	push   $0x1
+     1a3:	68 11 19 00 00       	push   $0x1911
+     1a8:	53                   	push   %ebx
+     1a9:	e8 1c ff ff ff       	call   ca <strncmp>
+     1ae:	83 c4 10             	add    $0x10,%esp
+     1b1:	85 c0                	test   %eax,%eax
+     1b3:	74 e6                	je     19b <setbuiltin+0x8b>
+    i = atoi(p);
+     1b5:	83 ec 0c             	sub    $0xc,%esp
+     1b8:	53                   	push   %ebx
+     1b9:	e8 75 11 00 00       	call   1333 <atoi>
+    rc = (setuid(i));
+     1be:	89 04 24             	mov    %eax,(%esp)
+     1c1:	e8 42 13 00 00       	call   1508 <setuid>
+    if (rc == 0)
+     1c6:	83 c4 10             	add    $0x10,%esp
+     1c9:	85 c0                	test   %eax,%eax
+     1cb:	74 4b                	je     218 <setbuiltin+0x108>
+    i = atoi(p);
+    rc = (setgid(i));
+    if (rc == 0)
+      return 0;
+  }
+  printf(2, "Invalid _set parameter\n");
+     1cd:	83 ec 08             	sub    $0x8,%esp
+     1d0:	68 20 19 00 00       	push   $0x1920
+     1d5:	6a 02                	push   $0x2
+     1d7:	e8 3c 14 00 00       	call   1618 <printf>
+  return -1;
+     1dc:	83 c4 10             	add    $0x10,%esp
+     1df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     1e4:	eb 32                	jmp    218 <setbuiltin+0x108>
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     1e6:	83 c3 01             	add    $0x1,%ebx
+     1e9:	83 ec 04             	sub    $0x4,%esp
+     1ec:	6a 01                	push   $0x1
+     1ee:	68 11 19 00 00       	push   $0x1911
+     1f3:	53                   	push   %ebx
+     1f4:	e8 d1 fe ff ff       	call   ca <strncmp>
+     1f9:	83 c4 10             	add    $0x10,%esp
+     1fc:	85 c0                	test   %eax,%eax
+     1fe:	74 e6                	je     1e6 <setbuiltin+0xd6>
+    i = atoi(p);
+     200:	83 ec 0c             	sub    $0xc,%esp
+     203:	53                   	push   %ebx
+     204:	e8 2a 11 00 00       	call   1333 <atoi>
+    rc = (setgid(i));
+     209:	89 04 24             	mov    %eax,(%esp)
+     20c:	e8 ff 12 00 00       	call   1510 <setgid>
+    if (rc == 0)
+     211:	83 c4 10             	add    $0x10,%esp
+     214:	85 c0                	test   %eax,%eax
+     216:	75 b5                	jne    1cd <setbuiltin+0xbd>
+}
+     218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     21b:	c9                   	leave
+     21c:	c3                   	ret
+
+0000021d <getbuiltin>:
+
+int
+getbuiltin(char *p)
+{
+     21d:	55                   	push   %ebp
+     21e:	89 e5                	mov    %esp,%ebp
+     220:	56                   	push   %esi
+     221:	53                   	push   %ebx
+  p += strlen("_get");
+     222:	83 ec 0c             	sub    $0xc,%esp
+     225:	68 38 19 00 00       	push   $0x1938
+     22a:	e8 fd 0f 00 00       	call   122c <strlen>
+     22f:	03 45 08             	add    0x8(%ebp),%eax
+     232:	89 c3                	mov    %eax,%ebx
+  while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     234:	83 c4 10             	add    $0x10,%esp
+     237:	eb 03                	jmp    23c <getbuiltin+0x1f>
+     239:	83 c3 01             	add    $0x1,%ebx
+     23c:	83 ec 04             	sub    $0x4,%esp
+     23f:	6a 01                	push   $0x1
+     241:	68 11 19 00 00       	push   $0x1911
+     246:	53                   	push   %ebx
+     247:	e8 7e fe ff ff       	call   ca <strncmp>
+     24c:	83 c4 10             	add    $0x10,%esp
+     24f:	85 c0                	test   %eax,%eax
+     251:	74 e6                	je     239 <getbuiltin+0x1c>
+  if (strncmp("uid", p, 3) == 0) {
+     253:	83 ec 04             	sub    $0x4,%esp
+     256:	6a 03                	push   $0x3
+     258:	53                   	push   %ebx
+     259:	68 18 19 00 00       	push   $0x1918
+     25e:	e8 67 fe ff ff       	call   ca <strncmp>
+     263:	83 c4 10             	add    $0x10,%esp
+     266:	89 c6                	mov    %eax,%esi
+     268:	85 c0                	test   %eax,%eax
+     26a:	74 3a                	je     2a6 <getbuiltin+0x89>
+    printf(2, "%d\n", getuid());
+    return 0;
+  }
+  if (strncmp("gid", p, 3) == 0) {
+     26c:	83 ec 04             	sub    $0x4,%esp
+     26f:	6a 03                	push   $0x3
+     271:	53                   	push   %ebx
+     272:	68 1c 19 00 00       	push   $0x191c
+     277:	e8 4e fe ff ff       	call   ca <strncmp>
+     27c:	83 c4 10             	add    $0x10,%esp
+     27f:	89 c6                	mov    %eax,%esi
+     281:	85 c0                	test   %eax,%eax
+     283:	75 3b                	jne    2c0 <getbuiltin+0xa3>
+    printf(2, "%d\n", getgid());
+     285:	e8 6e 12 00 00       	call   14f8 <getgid>
+     28a:	83 ec 04             	sub    $0x4,%esp
+     28d:	50                   	push   %eax
+     28e:	68 3d 19 00 00       	push   $0x193d
+     293:	6a 02                	push   $0x2
+     295:	e8 7e 13 00 00       	call   1618 <printf>
+    return 0;
+     29a:	83 c4 10             	add    $0x10,%esp
+  }
+  printf(2, "Invalid _get parameter\n");
+  return -1;
+}
+     29d:	89 f0                	mov    %esi,%eax
+     29f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2a2:	5b                   	pop    %ebx
+     2a3:	5e                   	pop    %esi
+     2a4:	5d                   	pop    %ebp
+     2a5:	c3                   	ret
+    printf(2, "%d\n", getuid());
+     2a6:	e8 45 12 00 00       	call   14f0 <getuid>
+     2ab:	83 ec 04             	sub    $0x4,%esp
+     2ae:	50                   	push   %eax
+     2af:	68 3d 19 00 00       	push   $0x193d
+     2b4:	6a 02                	push   $0x2
+     2b6:	e8 5d 13 00 00       	call   1618 <printf>
+    return 0;
+     2bb:	83 c4 10             	add    $0x10,%esp
+     2be:	eb dd                	jmp    29d <getbuiltin+0x80>
+  printf(2, "Invalid _get parameter\n");
+     2c0:	83 ec 08             	sub    $0x8,%esp
+     2c3:	68 41 19 00 00       	push   $0x1941
+     2c8:	6a 02                	push   $0x2
+     2ca:	e8 49 13 00 00       	call   1618 <printf>
+  return -1;
+     2cf:	83 c4 10             	add    $0x10,%esp
+     2d2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     2d7:	eb c4                	jmp    29d <getbuiltin+0x80>
+
+000002d9 <dobuiltin>:
+  {"_get", getbuiltin}
+};
+int FDTcount = sizeof(fdt) / sizeof(fdt[0]); // # entris in FDT
+
+void
+dobuiltin(char *cmd) {
+     2d9:	55                   	push   %ebp
+     2da:	89 e5                	mov    %esp,%ebp
+     2dc:	56                   	push   %esi
+     2dd:	53                   	push   %ebx
+     2de:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i;
+
+  for (i=0; i<FDTcount; i++)
+     2e1:	83 3d f4 21 00 00 00 	cmpl   $0x0,0x21f4
+     2e8:	7e 49                	jle    333 <dobuiltin+0x5a>
+     2ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+     2ef:	eb 0b                	jmp    2fc <dobuiltin+0x23>
+     2f1:	83 c3 01             	add    $0x1,%ebx
+     2f4:	39 1d f4 21 00 00    	cmp    %ebx,0x21f4
+     2fa:	7e 37                	jle    333 <dobuiltin+0x5a>
+    if (strncmp(cmd, fdt[i].cmd, strlen(fdt[i].cmd)) == 0)
+     2fc:	83 ec 0c             	sub    $0xc,%esp
+     2ff:	ff 34 dd f8 21 00 00 	push   0x21f8(,%ebx,8)
+     306:	e8 21 0f 00 00       	call   122c <strlen>
+     30b:	83 c4 0c             	add    $0xc,%esp
+     30e:	50                   	push   %eax
+     30f:	ff 34 dd f8 21 00 00 	push   0x21f8(,%ebx,8)
+     316:	56                   	push   %esi
+     317:	e8 ae fd ff ff       	call   ca <strncmp>
+     31c:	83 c4 10             	add    $0x10,%esp
+     31f:	85 c0                	test   %eax,%eax
+     321:	75 ce                	jne    2f1 <dobuiltin+0x18>
+     (*fdt[i].name)(cmd);
+     323:	83 ec 0c             	sub    $0xc,%esp
+     326:	56                   	push   %esi
+     327:	ff 14 dd fc 21 00 00 	call   *0x21fc(,%ebx,8)
+     32e:	83 c4 10             	add    $0x10,%esp
+     331:	eb be                	jmp    2f1 <dobuiltin+0x18>
+}
+     333:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     336:	5b                   	pop    %ebx
+     337:	5e                   	pop    %esi
+     338:	5d                   	pop    %ebp
+     339:	c3                   	ret
+
+0000033a <panic>:
+  exit();
+}
+
+void
+panic(char *s)
+{
+     33a:	55                   	push   %ebp
+     33b:	89 e5                	mov    %esp,%ebp
+     33d:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     340:	ff 75 08             	push   0x8(%ebp)
+     343:	68 38 1a 00 00       	push   $0x1a38
+     348:	6a 02                	push   $0x2
+     34a:	e8 c9 12 00 00       	call   1618 <printf>
+  exit();
+     34f:	e8 ec 10 00 00       	call   1440 <exit>
+
+00000354 <applyfa>:
+{
+     354:	55                   	push   %ebp
+     355:	89 e5                	mov    %esp,%ebp
+     357:	57                   	push   %edi
+     358:	56                   	push   %esi
+     359:	53                   	push   %ebx
+     35a:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++){
+     35d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     361:	7e 60                	jle    3c3 <applyfa+0x6f>
+     363:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     366:	be 00 00 00 00       	mov    $0x0,%esi
+     36b:	eb 19                	jmp    386 <applyfa+0x32>
+      close(fa[i].fd);
+     36d:	83 ec 0c             	sub    $0xc,%esp
+     370:	ff 73 04             	push   0x4(%ebx)
+     373:	e8 f0 10 00 00       	call   1468 <close>
+     378:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+     37b:	83 c6 01             	add    $0x1,%esi
+     37e:	83 c3 0c             	add    $0xc,%ebx
+     381:	39 75 0c             	cmp    %esi,0xc(%ebp)
+     384:	74 3d                	je     3c3 <applyfa+0x6f>
+    if(fa[i].op == SPAWN_CLOSE)
+     386:	8b 03                	mov    (%ebx),%eax
+     388:	83 f8 02             	cmp    $0x2,%eax
+     38b:	74 e0                	je     36d <applyfa+0x19>
+    else if(fa[i].op == SPAWN_DUP2 && fa[i].fd != fa[i].newfd){
+     38d:	83 f8 01             	cmp    $0x1,%eax
+     390:	75 e9                	jne    37b <applyfa+0x27>
+     392:	8b 43 08             	mov    0x8(%ebx),%eax
+     395:	39 43 04             	cmp    %eax,0x4(%ebx)
+     398:	74 e1                	je     37b <applyfa+0x27>
+      close(fa[i].newfd);
+     39a:	83 ec 0c             	sub    $0xc,%esp
+     39d:	50                   	push   %eax
+     39e:	e8 c5 10 00 00       	call   1468 <close>
+      if(dup(fa[i].fd) != fa[i].newfd)
+     3a3:	83 c4 04             	add    $0x4,%esp
+     3a6:	ff 73 04             	push   0x4(%ebx)
+     3a9:	e8 0a 11 00 00       	call   14b8 <dup>
+     3ae:	83 c4 10             	add    $0x10,%esp
+     3b1:	3b 43 08             	cmp    0x8(%ebx),%eax
+     3b4:	74 c5                	je     37b <applyfa+0x27>
+        panic("dup");
+     3b6:	83 ec 0c             	sub    $0xc,%esp
+     3b9:	68 59 19 00 00       	push   $0x1959
+     3be:	e8 77 ff ff ff       	call   33a <panic>
+}
+     3c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3c6:	5b                   	pop    %ebx
+     3c7:	5e                   	pop    %esi
+     3c8:	5f                   	pop    %edi
+     3c9:	5d                   	pop    %ebp
+     3ca:	c3                   	ret
+
+000003cb <parsefail>:
+// it; parsecmd() returns 0 instead.
+int parseerr;
+
+void
+parsefail(char *s)
+{
+     3cb:	55                   	push   %ebp
+     3cc:	89 e5                	mov    %esp,%ebp
+     3ce:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     3d1:	ff 75 08             	push   0x8(%ebp)
+     3d4:	68 38 1a 00 00       	push   $0x1a38
+     3d9:	6a 02                	push   $0x2
+     3db:	e8 38 12 00 00       	call   1618 <printf>
+  parseerr = 1;
+     3e0:	c7 05 20 22 00 00 01 	movl   $0x1,0x2220
+     3e7:	00 00 00 
+}
+     3ea:	83 c4 10             	add    $0x10,%esp
+     3ed:	c9                   	leave
+     3ee:	c3                   	ret
+
+000003ef <fork1>:
+}
+#endif // CS333_P4
+
+int
+fork1(void)
+{
+     3ef:	55                   	push   %ebp
+     3f0:	89 e5                	mov    %esp,%ebp
+     3f2:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+     3f5:	e8 3e 10 00 00       	call   1438 <fork>
+  if(pid == -1)
+     3fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3fd:	74 02                	je     401 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+     3ff:	c9                   	leave
+     400:	c3                   	ret
+    panic("fork");
+     401:	83 ec 0c             	sub    $0xc,%esp
+     404:	68 5d 19 00 00       	push   $0x195d
+     409:	e8 2c ff ff ff       	call   33a <panic>
+
+0000040e <runcmd>:
+{
+     40e:	55                   	push   %ebp
+     40f:	89 e5                	mov    %esp,%ebp
+     411:	53                   	push   %ebx
+     412:	83 ec 14             	sub    $0x14,%esp
+     415:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     418:	85 db                	test   %ebx,%ebx
+     41a:	74 0e                	je     42a <runcmd+0x1c>
+  switch(cmd->type){
+     41c:	83 3b 05             	cmpl   $0x5,(%ebx)
+     41f:	77 0e                	ja     42f <runcmd+0x21>
+     421:	8b 03                	mov    (%ebx),%eax
+     423:	ff 24 85 54 1a 00 00 	jmp    *0x1a54(,%eax,4)
+    exit();
+     42a:	e8 11 10 00 00       	call   1440 <exit>
+    panic("runcmd");
+     42f:	83 ec 0c             	sub    $0xc,%esp
+     432:	68 62 19 00 00       	push   $0x1962
+     437:	e8 fe fe ff ff       	call   33a <panic>
+    if(ecmd->argv[0] == 0)
+     43c:	8b 43 04             	mov    0x4(%ebx),%eax
+     43f:	85 c0                	test   %eax,%eax
+     441:	74 27                	je     46a <runcmd+0x5c>
+    exec(ecmd->argv[0], ecmd->argv);
+     443:	83 ec 08             	sub    $0x8,%esp
+     446:	8d 53 04             	lea    0x4(%ebx),%edx
+     449:	52                   	push   %edx
+     44a:	50                   	push   %eax
+     44b:	e8 28 10 00 00       	call   1478 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     450:	83 c4 0c             	add    $0xc,%esp
+     453:	ff 73 04             	push   0x4(%ebx)
+     456:	68 69 19 00 00       	push   $0x1969
+     45b:	6a 02                	push   $0x2
+     45d:	e8 b6 11 00 00       	call   1618 <printf>
+    break;
+     462:	83 c4 10             	add    $0x10,%esp
+  exit();
+     465:	e8 d6 0f 00 00       	call   1440 <exit>
+      exit();
+     46a:	e8 d1 0f 00 00       	call   1440 <exit>
+    close(rcmd->fd);
+     46f:	83 ec 0c             	sub    $0xc,%esp
+     472:	ff 73 14             	push   0x14(%ebx)
+     475:	e8 ee 0f 00 00       	call   1468 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     47a:	83 c4 08             	add    $0x8,%esp
+     47d:	ff 73 10             	push   0x10(%ebx)
+     480:	ff 73 08             	push   0x8(%ebx)
+     483:	e8 f8 0f 00 00       	call   1480 <open>
+     488:	83 c4 10             	add    $0x10,%esp
+     48b:	85 c0                	test   %eax,%eax
+     48d:	78 0b                	js     49a <runcmd+0x8c>
+    runcmd(rcmd->cmd);
+     48f:	83 ec 0c             	sub    $0xc,%esp
+     492:	ff 73 04             	push   0x4(%ebx)
+     495:	e8 74 ff ff ff       	call   40e <runcmd>
+      printf(2, "open %s failed\n", rcmd->file);
+     49a:	83 ec 04             	sub    $0x4,%esp
+     49d:	ff 73 08             	push   0x8(%ebx)
+     4a0:	68 79 19 00 00       	push   $0x1979
+     4a5:	6a 02                	push   $0x2
+     4a7:	e8 6c 11 00 00       	call   1618 <printf>
+      exit();
+     4ac:	e8 8f 0f 00 00       	call   1440 <exit>
+    if(fork1() == 0)
+     4b1:	e8 39 ff ff ff       	call   3ef <fork1>
+     4b6:	85 c0                	test   %eax,%eax
+     4b8:	74 10                	je     4ca <runcmd+0xbc>
+    wait();
+     4ba:	e8 89 0f 00 00       	call   1448 <wait>
+    runcmd(lcmd->right);
+     4bf:	83 ec 0c             	sub    $0xc,%esp
+     4c2:	ff 73 08             	push   0x8(%ebx)
+     4c5:	e8 44 ff ff ff       	call   40e <runcmd>
+      runcmd(lcmd->left);
+     4ca:	83 ec 0c             	sub    $0xc,%esp
+     4cd:	ff 73 04             	push   0x4(%ebx)
+     4d0:	e8 39 ff ff ff       	call   40e <runcmd>
+    if(pipe(p) < 0)
+     4d5:	83 ec 0c             	sub    $0xc,%esp
+     4d8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     4db:	50                   	push   %eax
+     4dc:	e8 6f 0f 00 00       	call   1450 <pipe>
+     4e1:	83 c4 10             	add    $0x10,%esp
+     4e4:	85 c0                	test   %eax,%eax
+     4e6:	78 3a                	js     522 <runcmd+0x114>
+    if(fork1() == 0){
+     4e8:	e8 02 ff ff ff       	call   3ef <fork1>
+     4ed:	85 c0                	test   %eax,%eax
+     4ef:	74 3e                	je     52f <runcmd+0x121>
+    if(fork1() == 0){
+     4f1:	e8 f9 fe ff ff       	call   3ef <fork1>
+     4f6:	85 c0                	test   %eax,%eax
+     4f8:	74 6b                	je     565 <runcmd+0x157>
+    close(p[0]);
+     4fa:	83 ec 0c             	sub    $0xc,%esp
+     4fd:	ff 75 f0             	push   -0x10(%ebp)
+     500:	e8 63 0f 00 00       	call   1468 <close>
+    close(p[1]);
+     505:	83 c4 04             	add    $0x4,%esp
+     508:	ff 75 f4             	push   -0xc(%ebp)
+     50b:	e8 58 0f 00 00       	call   1468 <close>
+    wait();
+     510:	e8 33 0f 00 00       	call   1448 <wait>
+    wait();
+     515:	e8 2e 0f 00 00       	call   1448 <wait>
+    break;
+     51a:	83 c4 10             	add    $0x10,%esp
+     51d:	e9 43 ff ff ff       	jmp    465 <runcmd+0x57>
+      panic("pipe");
+     522:	83 ec 0c             	sub    $0xc,%esp
+     525:	68 89 19 00 00       	push   $0x1989
+     52a:	e8 0b fe ff ff       	call   33a <panic>
+      close(1);
+     52f:	83 ec 0c             	sub    $0xc,%esp
+     532:	6a 01                	push   $0x1
+     534:	e8 2f 0f 00 00       	call   1468 <close>
+      dup(p[1]);
+     539:	83 c4 04             	add    $0x4,%esp
+     53c:	ff 75 f4             	push   -0xc(%ebp)
+     53f:	e8 74 0f 00 00       	call   14b8 <dup>
+      close(p[0]);
+     544:	83 c4 04             	add    $0x4,%esp
+     547:	ff 75 f0             	push   -0x10(%ebp)
+     54a:	e8 19 0f 00 00       	call   1468 <close>
+      close(p[1]);
+     54f:	83 c4 04             	add    $0x4,%esp
+     552:	ff 75 f4             	push   -0xc(%ebp)
+     555:	e8 0e 0f 00 00       	call   1468 <close>
+      runcmd(pcmd->left);
+     55a:	83 c4 04             	add    $0x4,%esp
+     55d:	ff 73 04             	push   0x4(%ebx)
+     560:	e8 a9 fe ff ff       	call   40e <runcmd>
+      close(0);
+     565:	83 ec 0c             	sub    $0xc,%esp
+     568:	6a 00                	push   $0x0
+     56a:	e8 f9 0e 00 00       	call   1468 <close>
+      dup(p[0]);
+     56f:	83 c4 04             	add    $0x4,%esp
+     572:	ff 75 f0             	push   -0x10(%ebp)
+     575:	e8 3e 0f 00 00       	call   14b8 <dup>
+      close(p[0]);
+     57a:	83 c4 04             	add    $0x4,%esp
+     57d:	ff 75 f0             	push   -0x10(%ebp)
+     580:	e8 e3 0e 00 00       	call   1468 <close>
+      close(p[1]);
+     585:	83 c4 04             	add    $0x4,%esp
+     588:	ff 75 f4             	push   -0xc(%ebp)
+     58b:	e8 d8 0e 00 00       	call   1468 <close>
+      runcmd(pcmd->right);
+     590:	83 c4 04             	add    $0x4,%esp
+     593:	ff 73 08             	push   0x8(%ebx)
+     596:	e8 73 fe ff ff       	call   40e <runcmd>
+    if(fork1() == 0)
+     59b:	e8 4f fe ff ff       	call   3ef <fork1>
+     5a0:	85 c0                	test   %eax,%eax
+     5a2:	0f 85 bd fe ff ff    	jne    465 <runcmd+0x57>
+      runcmd(bcmd->cmd);
+     5a8:	83 ec 0c             	sub    $0xc,%esp
+     5ab:	ff 73 04             	push   0x4(%ebx)
+     5ae:	e8 5b fe ff ff       	call   40e <runcmd>
+
+000005b3 <spawncmd>:
+{
+     5b3:	55                   	push   %ebp
+     5b4:	89 e5                	mov    %esp,%ebp
+     5b6:	57                   	push   %edi
+     5b7:	56                   	push   %esi
+     5b8:	53                   	push   %ebx
+     5b9:	81 ec ec 00 00 00    	sub    $0xec,%esp
+     5bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5c2:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(cmd == 0)
+     5c5:	85 db                	test   %ebx,%ebx
+     5c7:	0f 84 7c 01 00 00    	je     749 <spawncmd+0x196>
+  switch(cmd->type){
+     5cd:	83 3b 05             	cmpl   $0x5,(%ebx)
+     5d0:	77 09                	ja     5db <spawncmd+0x28>
+     5d2:	8b 03                	mov    (%ebx),%eax
+     5d4:	ff 24 85 6c 1a 00 00 	jmp    *0x1a6c(,%eax,4)
+    panic("spawncmd");
+     5db:	83 ec 0c             	sub    $0xc,%esp
+     5de:	68 8e 19 00 00       	push   $0x198e
+     5e3:	e8 52 fd ff ff       	call   33a <panic>
+    if(ecmd->argv[0] == 0)
+     5e8:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+     5ec:	0f 84 57 01 00 00    	je     749 <spawncmd+0x196>
+    fa[n].op = SPAWN_END;
+     5f2:	8b 45 10             	mov    0x10(%ebp),%eax
+     5f5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+     5f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     5fb:	c7 04 81 00 00 00 00 	movl   $0x0,(%ecx,%eax,4)
+    if(*npids == MAXPIDS || (pid = spawn(ecmd->argv[0], ecmd->argv, fa)) < 0){
+     602:	83 3e 10             	cmpl   $0x10,(%esi)
+     605:	74 29                	je     630 <spawncmd+0x7d>
+     607:	83 ec 04             	sub    $0x4,%esp
+     60a:	51                   	push   %ecx
+     60b:	8d 43 04             	lea    0x4(%ebx),%eax
+     60e:	50                   	push   %eax
+     60f:	ff 73 04             	push   0x4(%ebx)
+     612:	e8 41 0f 00 00       	call   1558 <spawn>
+     617:	83 c4 10             	add    $0x10,%esp
+     61a:	85 c0                	test   %eax,%eax
+     61c:	78 12                	js     630 <spawncmd+0x7d>
+    pids[(*npids)++] = pid;
+     61e:	8b 16                	mov    (%esi),%edx
+     620:	8d 4a 01             	lea    0x1(%edx),%ecx
+     623:	89 0e                	mov    %ecx,(%esi)
+     625:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     628:	89 04 91             	mov    %eax,(%ecx,%edx,4)
+    break;
+     62b:	e9 19 01 00 00       	jmp    749 <spawncmd+0x196>
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+     630:	83 ec 04             	sub    $0x4,%esp
+     633:	ff 73 04             	push   0x4(%ebx)
+     636:	68 69 19 00 00       	push   $0x1969
+     63b:	6a 02                	push   $0x2
+     63d:	e8 d6 0f 00 00       	call   1618 <printf>
+      return;
+     642:	83 c4 10             	add    $0x10,%esp
+     645:	e9 ff 00 00 00       	jmp    749 <spawncmd+0x196>
+    if((fd = open(rcmd->file, rcmd->mode)) < 0){
+     64a:	83 ec 08             	sub    $0x8,%esp
+     64d:	ff 73 10             	push   0x10(%ebx)
+     650:	ff 73 08             	push   0x8(%ebx)
+     653:	e8 28 0e 00 00       	call   1480 <open>
+     658:	89 c7                	mov    %eax,%edi
+     65a:	83 c4 10             	add    $0x10,%esp
+     65d:	85 c0                	test   %eax,%eax
+     65f:	78 5b                	js     6bc <spawncmd+0x109>
+    if(n + 2 >= SPAWN_MAXFD){
+     661:	83 7d 10 0d          	cmpl   $0xd,0x10(%ebp)
+     665:	7f 6c                	jg     6d3 <spawncmd+0x120>
+    fa[n].op = SPAWN_DUP2;
+     667:	8b 45 10             	mov    0x10(%ebp),%eax
+     66a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+     66d:	c1 e0 02             	shl    $0x2,%eax
+     670:	89 c2                	mov    %eax,%edx
+     672:	03 55 0c             	add    0xc(%ebp),%edx
+     675:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+    fa[n].fd = fd;
+     67b:	89 7a 04             	mov    %edi,0x4(%edx)
+    fa[n].newfd = rcmd->fd;
+     67e:	8b 4b 14             	mov    0x14(%ebx),%ecx
+     681:	89 4a 08             	mov    %ecx,0x8(%edx)
+    fa[n+1].op = SPAWN_CLOSE;
+     684:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     687:	8d 44 01 0c          	lea    0xc(%ecx,%eax,1),%eax
+     68b:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+    fa[n+1].fd = fd;
+     691:	89 78 04             	mov    %edi,0x4(%eax)
+    spawncmd(rcmd->cmd, fa, n + 2, pids, npids);
+     694:	83 ec 0c             	sub    $0xc,%esp
+     697:	56                   	push   %esi
+     698:	ff 75 14             	push   0x14(%ebp)
+     69b:	8b 45 10             	mov    0x10(%ebp),%eax
+     69e:	83 c0 02             	add    $0x2,%eax
+     6a1:	50                   	push   %eax
+     6a2:	51                   	push   %ecx
+     6a3:	ff 73 04             	push   0x4(%ebx)
+     6a6:	e8 08 ff ff ff       	call   5b3 <spawncmd>
+    close(fd);
+     6ab:	83 c4 14             	add    $0x14,%esp
+     6ae:	57                   	push   %edi
+     6af:	e8 b4 0d 00 00       	call   1468 <close>
+    break;
+     6b4:	83 c4 10             	add    $0x10,%esp
+     6b7:	e9 8d 00 00 00       	jmp    749 <spawncmd+0x196>
+      printf(2, "open %s failed\n", rcmd->file);
+     6bc:	83 ec 04             	sub    $0x4,%esp
+     6bf:	ff 73 08             	push   0x8(%ebx)
+     6c2:	68 79 19 00 00       	push   $0x1979
+     6c7:	6a 02                	push   $0x2
+     6c9:	e8 4a 0f 00 00       	call   1618 <printf>
+      return;
+     6ce:	83 c4 10             	add    $0x10,%esp
+     6d1:	eb 76                	jmp    749 <spawncmd+0x196>
+      printf(2, "too many redirections\n");
+     6d3:	83 ec 08             	sub    $0x8,%esp
+     6d6:	68 97 19 00 00       	push   $0x1997
+     6db:	6a 02                	push   $0x2
+     6dd:	e8 36 0f 00 00       	call   1618 <printf>
+      close(fd);
+     6e2:	89 3c 24             	mov    %edi,(%esp)
+     6e5:	e8 7e 0d 00 00       	call   1468 <close>
+      return;
+     6ea:	83 c4 10             	add    $0x10,%esp
+     6ed:	eb 5a                	jmp    749 <spawncmd+0x196>
+    i = *npids;
+     6ef:	8b 3e                	mov    (%esi),%edi
+    spawncmd(lcmd->left, fa, n, pids, npids);
+     6f1:	83 ec 0c             	sub    $0xc,%esp
+     6f4:	56                   	push   %esi
+     6f5:	ff 75 14             	push   0x14(%ebp)
+     6f8:	ff 75 10             	push   0x10(%ebp)
+     6fb:	ff 75 0c             	push   0xc(%ebp)
+     6fe:	ff 73 04             	push   0x4(%ebx)
+     701:	e8 ad fe ff ff       	call   5b3 <spawncmd>
+    while(*npids > i)
+     706:	8b 06                	mov    (%esi),%eax
+     708:	83 c4 20             	add    $0x20,%esp
+     70b:	39 c7                	cmp    %eax,%edi
+     70d:	7d 22                	jge    731 <spawncmd+0x17e>
+     70f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     712:	8b 5d 14             	mov    0x14(%ebp),%ebx
+      waitpid(pids[--*npids]);
+     715:	83 e8 01             	sub    $0x1,%eax
+     718:	89 06                	mov    %eax,(%esi)
+     71a:	83 ec 0c             	sub    $0xc,%esp
+     71d:	ff 34 83             	push   (%ebx,%eax,4)
+     720:	e8 0b 0e 00 00       	call   1530 <waitpid>
+    while(*npids > i)
+     725:	8b 06                	mov    (%esi),%eax
+     727:	83 c4 10             	add    $0x10,%esp
+     72a:	39 f8                	cmp    %edi,%eax
+     72c:	7f e7                	jg     715 <spawncmd+0x162>
+     72e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    spawncmd(lcmd->right, fa, n, pids, npids);
+     731:	83 ec 0c             	sub    $0xc,%esp
+     734:	56                   	push   %esi
+     735:	ff 75 14             	push   0x14(%ebp)
+     738:	ff 75 10             	push   0x10(%ebp)
+     73b:	ff 75 0c             	push   0xc(%ebp)
+     73e:	ff 73 08             	push   0x8(%ebx)
+     741:	e8 6d fe ff ff       	call   5b3 <spawncmd>
+    break;
+     746:	83 c4 20             	add    $0x20,%esp
+}
+     749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     74c:	5b                   	pop    %ebx
+     74d:	5e                   	pop    %esi
+     74e:	5f                   	pop    %edi
+     74f:	5d                   	pop    %ebp
+     750:	c3                   	ret
+    if(n + 4 >= SPAWN_MAXFD || pipe(p) < 0){
+     751:	83 7d 10 0b          	cmpl   $0xb,0x10(%ebp)
+     755:	0f 8f 26 01 00 00    	jg     881 <spawncmd+0x2ce>
+     75b:	83 ec 0c             	sub    $0xc,%esp
+     75e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     761:	50                   	push   %eax
+     762:	e8 e9 0c 00 00       	call   1450 <pipe>
+     767:	83 c4 10             	add    $0x10,%esp
+     76a:	85 c0                	test   %eax,%eax
+     76c:	0f 88 0f 01 00 00    	js     881 <spawncmd+0x2ce>
+    memmove(pfa, fa, n*sizeof(fa[0]));
+     772:	83 ec 04             	sub    $0x4,%esp
+     775:	8b 45 10             	mov    0x10(%ebp),%eax
+     778:	8d 3c 00             	lea    (%eax,%eax,1),%edi
+     77b:	89 f8                	mov    %edi,%eax
+     77d:	03 45 10             	add    0x10(%ebp),%eax
+     780:	c1 e0 02             	shl    $0x2,%eax
+     783:	50                   	push   %eax
+     784:	ff 75 0c             	push   0xc(%ebp)
+     787:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+     78d:	50                   	push   %eax
+     78e:	e8 78 0c 00 00       	call   140b <memmove>
+    pfa[n].op = SPAWN_DUP2;
+     793:	89 bd 10 ff ff ff    	mov    %edi,-0xf0(%ebp)
+     799:	89 f8                	mov    %edi,%eax
+     79b:	03 45 10             	add    0x10(%ebp),%eax
+     79e:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+     7a5:	c7 84 3d 20 ff ff ff 	movl   $0x1,-0xe0(%ebp,%edi,1)
+     7ac:	01 00 00 00 
+    pfa[n].fd = p[1];
+     7b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     7b3:	89 8c 3d 24 ff ff ff 	mov    %ecx,-0xdc(%ebp,%edi,1)
+    pfa[n].newfd = 1;
+     7ba:	c7 84 3d 28 ff ff ff 	movl   $0x1,-0xd8(%ebp,%edi,1)
+     7c1:	01 00 00 00 
+    pfa[n+1].op = SPAWN_CLOSE;
+     7c5:	8b 55 10             	mov    0x10(%ebp),%edx
+     7c8:	83 c2 01             	add    $0x1,%edx
+     7cb:	8d 04 12             	lea    (%edx,%edx,1),%eax
+     7ce:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+     7d1:	c7 84 8d 20 ff ff ff 	movl   $0x2,-0xe0(%ebp,%ecx,4)
+     7d8:	02 00 00 00 
+    pfa[n+1].fd = p[0];
+     7dc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     7df:	89 94 8d 24 ff ff ff 	mov    %edx,-0xdc(%ebp,%ecx,4)
+    pfa[n+2].op = SPAWN_CLOSE;
+     7e6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7e9:	8d 51 02             	lea    0x2(%ecx),%edx
+     7ec:	8d 04 12             	lea    (%edx,%edx,1),%eax
+     7ef:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+     7f2:	c7 84 8d 20 ff ff ff 	movl   $0x2,-0xe0(%ebp,%ecx,4)
+     7f9:	02 00 00 00 
+    pfa[n+2].fd = p[1];
+     7fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     800:	89 94 8d 24 ff ff ff 	mov    %edx,-0xdc(%ebp,%ecx,4)
+    spawnside(pcmd->left, pfa, n + 3, pids, npids);
+     807:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     80a:	83 c1 03             	add    $0x3,%ecx
+     80d:	89 34 24             	mov    %esi,(%esp)
+     810:	ff 75 14             	push   0x14(%ebp)
+     813:	89 8d 14 ff ff ff    	mov    %ecx,-0xec(%ebp)
+     819:	51                   	push   %ecx
+     81a:	8d 95 20 ff ff ff    	lea    -0xe0(%ebp),%edx
+     820:	52                   	push   %edx
+     821:	ff 73 04             	push   0x4(%ebx)
+     824:	e8 92 00 00 00       	call   8bb <spawnside>
+    pfa[n].fd = p[0];
+     829:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     82c:	89 84 3d 24 ff ff ff 	mov    %eax,-0xdc(%ebp,%edi,1)
+    pfa[n].newfd = 0;
+     833:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+     839:	03 45 10             	add    0x10(%ebp),%eax
+     83c:	c7 84 85 28 ff ff ff 	movl   $0x0,-0xd8(%ebp,%eax,4)
+     843:	00 00 00 00 
+    spawnside(pcmd->right, pfa, n + 3, pids, npids);
+     847:	83 c4 14             	add    $0x14,%esp
+     84a:	56                   	push   %esi
+     84b:	ff 75 14             	push   0x14(%ebp)
+     84e:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+     854:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+     85a:	50                   	push   %eax
+     85b:	ff 73 08             	push   0x8(%ebx)
+     85e:	e8 58 00 00 00       	call   8bb <spawnside>
+    close(p[0]);
+     863:	83 c4 14             	add    $0x14,%esp
+     866:	ff 75 e0             	push   -0x20(%ebp)
+     869:	e8 fa 0b 00 00       	call   1468 <close>
+    close(p[1]);
+     86e:	83 c4 04             	add    $0x4,%esp
+     871:	ff 75 e4             	push   -0x1c(%ebp)
+     874:	e8 ef 0b 00 00       	call   1468 <close>
+    break;
+     879:	83 c4 10             	add    $0x10,%esp
+     87c:	e9 c8 fe ff ff       	jmp    749 <spawncmd+0x196>
+      printf(2, "pipe failed\n");
+     881:	83 ec 08             	sub    $0x8,%esp
+     884:	68 ae 19 00 00       	push   $0x19ae
+     889:	6a 02                	push   $0x2
+     88b:	e8 88 0d 00 00       	call   1618 <printf>
+      return;
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	e9 b1 fe ff ff       	jmp    749 <spawncmd+0x196>
+    if((pid = fork1()) == 0)
+     898:	e8 52 fb ff ff       	call   3ef <fork1>
+     89d:	85 c0                	test   %eax,%eax
+     89f:	74 11                	je     8b2 <spawncmd+0x2ff>
+    waitpid(pid);
+     8a1:	83 ec 0c             	sub    $0xc,%esp
+     8a4:	50                   	push   %eax
+     8a5:	e8 86 0c 00 00       	call   1530 <waitpid>
+    break;
+     8aa:	83 c4 10             	add    $0x10,%esp
+     8ad:	e9 97 fe ff ff       	jmp    749 <spawncmd+0x196>
+      runcmd(cmd);
+     8b2:	83 ec 0c             	sub    $0xc,%esp
+     8b5:	53                   	push   %ebx
+     8b6:	e8 53 fb ff ff       	call   40e <runcmd>
+
+000008bb <spawnside>:
+{
+     8bb:	55                   	push   %ebp
+     8bc:	89 e5                	mov    %esp,%ebp
+     8be:	56                   	push   %esi
+     8bf:	53                   	push   %ebx
+     8c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8c3:	8b 75 18             	mov    0x18(%ebp),%esi
+  for(c = cmd; c && c->type == REDIR; c = ((struct redircmd*)c)->cmd)
+     8c6:	89 d8                	mov    %ebx,%eax
+     8c8:	85 db                	test   %ebx,%ebx
+     8ca:	74 0c                	je     8d8 <spawnside+0x1d>
+     8cc:	83 38 02             	cmpl   $0x2,(%eax)
+     8cf:	75 4e                	jne    91f <spawnside+0x64>
+     8d1:	8b 40 04             	mov    0x4(%eax),%eax
+     8d4:	85 c0                	test   %eax,%eax
+     8d6:	75 f4                	jne    8cc <spawnside+0x11>
+    spawncmd(cmd, fa, n, pids, npids);
+     8d8:	83 ec 0c             	sub    $0xc,%esp
+     8db:	56                   	push   %esi
+     8dc:	ff 75 14             	push   0x14(%ebp)
+     8df:	ff 75 10             	push   0x10(%ebp)
+     8e2:	ff 75 0c             	push   0xc(%ebp)
+     8e5:	53                   	push   %ebx
+     8e6:	e8 c8 fc ff ff       	call   5b3 <spawncmd>
+    return;
+     8eb:	83 c4 20             	add    $0x20,%esp
+}
+     8ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8f1:	5b                   	pop    %ebx
+     8f2:	5e                   	pop    %esi
+     8f3:	5d                   	pop    %ebp
+     8f4:	c3                   	ret
+    printf(2, "too many processes\n");
+     8f5:	83 ec 08             	sub    $0x8,%esp
+     8f8:	68 bb 19 00 00       	push   $0x19bb
+     8fd:	6a 02                	push   $0x2
+     8ff:	e8 14 0d 00 00       	call   1618 <printf>
+    return;
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	eb e5                	jmp    8ee <spawnside+0x33>
+    applyfa(fa, n);
+     909:	83 ec 08             	sub    $0x8,%esp
+     90c:	ff 75 10             	push   0x10(%ebp)
+     90f:	ff 75 0c             	push   0xc(%ebp)
+     912:	e8 3d fa ff ff       	call   354 <applyfa>
+    runcmd(cmd);
+     917:	89 1c 24             	mov    %ebx,(%esp)
+     91a:	e8 ef fa ff ff       	call   40e <runcmd>
+  if(c == 0 || (c->type != LIST && c->type != BACK)){
+     91f:	8b 00                	mov    (%eax),%eax
+     921:	83 e8 04             	sub    $0x4,%eax
+     924:	83 f8 01             	cmp    $0x1,%eax
+     927:	77 af                	ja     8d8 <spawnside+0x1d>
+  if(*npids == MAXPIDS){
+     929:	83 3e 10             	cmpl   $0x10,(%esi)
+     92c:	74 c7                	je     8f5 <spawnside+0x3a>
+  if((pid = fork1()) == 0){
+     92e:	e8 bc fa ff ff       	call   3ef <fork1>
+     933:	85 c0                	test   %eax,%eax
+     935:	74 d2                	je     909 <spawnside+0x4e>
+  pids[(*npids)++] = pid;
+     937:	8b 16                	mov    (%esi),%edx
+     939:	8d 4a 01             	lea    0x1(%edx),%ecx
+     93c:	89 0e                	mov    %ecx,(%esi)
+     93e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     941:	89 04 91             	mov    %eax,(%ecx,%edx,4)
+     944:	eb a8                	jmp    8ee <spawnside+0x33>
+
+00000946 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     946:	55                   	push   %ebp
+     947:	89 e5                	mov    %esp,%ebp
+     949:	53                   	push   %ebx
+     94a:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     94d:	6a 54                	push   $0x54
+     94f:	e8 ea 0e 00 00       	call   183e <malloc>
+     954:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     956:	83 c4 0c             	add    $0xc,%esp
+     959:	6a 54                	push   $0x54
+     95b:	6a 00                	push   $0x0
+     95d:	50                   	push   %eax
+     95e:	e8 ef 08 00 00       	call   1252 <memset>
+  cmd->type = EXEC;
+     963:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     969:	89 d8                	mov    %ebx,%eax
+     96b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     96e:	c9                   	leave
+     96f:	c3                   	ret
+
+00000970 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	53                   	push   %ebx
+     974:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     977:	6a 18                	push   $0x18
+     979:	e8 c0 0e 00 00       	call   183e <malloc>
+     97e:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     980:	83 c4 0c             	add    $0xc,%esp
+     983:	6a 18                	push   $0x18
+     985:	6a 00                	push   $0x0
+     987:	50                   	push   %eax
+     988:	e8 c5 08 00 00       	call   1252 <memset>
+  cmd->type = REDIR;
+     98d:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     993:	8b 45 08             	mov    0x8(%ebp),%eax
+     996:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     999:	8b 45 0c             	mov    0xc(%ebp),%eax
+     99c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     99f:	8b 45 10             	mov    0x10(%ebp),%eax
+     9a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     9a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     9a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     9ab:	8b 45 18             	mov    0x18(%ebp),%eax
+     9ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     9b1:	89 d8                	mov    %ebx,%eax
+     9b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9b6:	c9                   	leave
+     9b7:	c3                   	ret
+
+000009b8 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     9b8:	55                   	push   %ebp
+     9b9:	89 e5                	mov    %esp,%ebp
+     9bb:	53                   	push   %ebx
+     9bc:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     9bf:	6a 0c                	push   $0xc
+     9c1:	e8 78 0e 00 00       	call   183e <malloc>
+     9c6:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     9c8:	83 c4 0c             	add    $0xc,%esp
+     9cb:	6a 0c                	push   $0xc
+     9cd:	6a 00                	push   $0x0
+     9cf:	50                   	push   %eax
+     9d0:	e8 7d 08 00 00       	call   1252 <memset>
+  cmd->type = PIPE;
+     9d5:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     9db:	8b 45 08             	mov    0x8(%ebp),%eax
+     9de:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     9e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9e4:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     9e7:	89 d8                	mov    %ebx,%eax
+     9e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9ec:	c9                   	leave
+     9ed:	c3                   	ret
+
+000009ee <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     9ee:	55                   	push   %ebp
+     9ef:	89 e5                	mov    %esp,%ebp
+     9f1:	53                   	push   %ebx
+     9f2:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     9f5:	6a 0c                	push   $0xc
+     9f7:	e8 42 0e 00 00       	call   183e <malloc>
+     9fc:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     9fe:	83 c4 0c             	add    $0xc,%esp
+     a01:	6a 0c                	push   $0xc
+     a03:	6a 00                	push   $0x0
+     a05:	50                   	push   %eax
+     a06:	e8 47 08 00 00       	call   1252 <memset>
+  cmd->type = LIST;
+     a0b:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     a11:	8b 45 08             	mov    0x8(%ebp),%eax
+     a14:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     a17:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a1a:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     a1d:	89 d8                	mov    %ebx,%eax
+     a1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a22:	c9                   	leave
+     a23:	c3                   	ret
+
+00000a24 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     a24:	55                   	push   %ebp
+     a25:	89 e5                	mov    %esp,%ebp
+     a27:	53                   	push   %ebx
+     a28:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     a2b:	6a 08                	push   $0x8
+     a2d:	e8 0c 0e 00 00       	call   183e <malloc>
+     a32:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     a34:	83 c4 0c             	add    $0xc,%esp
+     a37:	6a 08                	push   $0x8
+     a39:	6a 00                	push   $0x0
+     a3b:	50                   	push   %eax
+     a3c:	e8 11 08 00 00       	call   1252 <memset>
+  cmd->type = BACK;
+     a41:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     a47:	8b 45 08             	mov    0x8(%ebp),%eax
+     a4a:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     a4d:	89 d8                	mov    %ebx,%eax
+     a4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a52:	c9                   	leave
+     a53:	c3                   	ret
+
+00000a54 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     a54:	55                   	push   %ebp
+     a55:	89 e5                	mov    %esp,%ebp
+     a57:	57                   	push   %edi
+     a58:	56                   	push   %esi
+     a59:	53                   	push   %ebx
+     a5a:	83 ec 0c             	sub    $0xc,%esp
+     a5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+     a60:	8b 7d 10             	mov    0x10(%ebp),%edi
+  char *s;
+  int ret;
+
+  s = *ps;
+     a63:	8b 45 08             	mov    0x8(%ebp),%eax
+     a66:	8b 18                	mov    (%eax),%ebx
+  while(s < es && strchr(whitespace, *s))
+     a68:	39 f3                	cmp    %esi,%ebx
+     a6a:	73 21                	jae    a8d <gettoken+0x39>
+     a6c:	83 ec 08             	sub    $0x8,%esp
+     a6f:	0f be 03             	movsbl (%ebx),%eax
+     a72:	50                   	push   %eax
+     a73:	68 ec 21 00 00       	push   $0x21ec
+     a78:	e8 ee 07 00 00       	call   126b <strchr>
+     a7d:	83 c4 10             	add    $0x10,%esp
+     a80:	85 c0                	test   %eax,%eax
+     a82:	74 09                	je     a8d <gettoken+0x39>
+    s++;
+     a84:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     a87:	39 de                	cmp    %ebx,%esi
+     a89:	75 e1                	jne    a6c <gettoken+0x18>
+    s++;
+     a8b:	89 f3                	mov    %esi,%ebx
+  if(q)
+     a8d:	85 ff                	test   %edi,%edi
+     a8f:	74 02                	je     a93 <gettoken+0x3f>
+    *q = s;
+     a91:	89 1f                	mov    %ebx,(%edi)
+  ret = *s;
+     a93:	0f b6 03             	movzbl (%ebx),%eax
+     a96:	0f be f8             	movsbl %al,%edi
+  switch(*s){
+     a99:	3c 3c                	cmp    $0x3c,%al
+     a9b:	7f 57                	jg     af4 <gettoken+0xa0>
+     a9d:	3c 3a                	cmp    $0x3a,%al
+     a9f:	7f 11                	jg     ab2 <gettoken+0x5e>
+     aa1:	84 c0                	test   %al,%al
+     aa3:	74 10                	je     ab5 <gettoken+0x61>
+     aa5:	78 67                	js     b0e <gettoken+0xba>
+     aa7:	3c 26                	cmp    $0x26,%al
+     aa9:	74 07                	je     ab2 <gettoken+0x5e>
+     aab:	83 e8 28             	sub    $0x28,%eax
+     aae:	3c 01                	cmp    $0x1,%al
+     ab0:	77 5c                	ja     b0e <gettoken+0xba>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     ab2:	83 c3 01             	add    $0x1,%ebx
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     ab5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     ab9:	74 05                	je     ac0 <gettoken+0x6c>
+    *eq = s;
+     abb:	8b 45 14             	mov    0x14(%ebp),%eax
+     abe:	89 18                	mov    %ebx,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     ac0:	39 f3                	cmp    %esi,%ebx
+     ac2:	73 21                	jae    ae5 <gettoken+0x91>
+     ac4:	83 ec 08             	sub    $0x8,%esp
+     ac7:	0f be 03             	movsbl (%ebx),%eax
+     aca:	50                   	push   %eax
+     acb:	68 ec 21 00 00       	push   $0x21ec
+     ad0:	e8 96 07 00 00       	call   126b <strchr>
+     ad5:	83 c4 10             	add    $0x10,%esp
+     ad8:	85 c0                	test   %eax,%eax
+     ada:	74 09                	je     ae5 <gettoken+0x91>
+    s++;
+     adc:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     adf:	39 de                	cmp    %ebx,%esi
+     ae1:	75 e1                	jne    ac4 <gettoken+0x70>
+    s++;
+     ae3:	89 f3                	mov    %esi,%ebx
+  *ps = s;
+     ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae8:	89 18                	mov    %ebx,(%eax)
+  return ret;
+}
+     aea:	89 f8                	mov    %edi,%eax
+     aec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aef:	5b                   	pop    %ebx
+     af0:	5e                   	pop    %esi
+     af1:	5f                   	pop    %edi
+     af2:	5d                   	pop    %ebp
+     af3:	c3                   	ret
+  switch(*s){
+     af4:	3c 3e                	cmp    $0x3e,%al
+     af6:	75 12                	jne    b0a <gettoken+0xb6>
+    s++;
+     af8:	8d 43 01             	lea    0x1(%ebx),%eax
+    if(*s == '>'){
+     afb:	80 7b 01 3e          	cmpb   $0x3e,0x1(%ebx)
+     aff:	74 5b                	je     b5c <gettoken+0x108>
+    s++;
+     b01:	89 c3                	mov    %eax,%ebx
+  ret = *s;
+     b03:	bf 3e 00 00 00       	mov    $0x3e,%edi
+     b08:	eb ab                	jmp    ab5 <gettoken+0x61>
+  switch(*s){
+     b0a:	3c 7c                	cmp    $0x7c,%al
+     b0c:	74 a4                	je     ab2 <gettoken+0x5e>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     b0e:	39 f3                	cmp    %esi,%ebx
+     b10:	73 6b                	jae    b7d <gettoken+0x129>
+     b12:	83 ec 08             	sub    $0x8,%esp
+     b15:	0f be 03             	movsbl (%ebx),%eax
+     b18:	50                   	push   %eax
+     b19:	68 ec 21 00 00       	push   $0x21ec
+     b1e:	e8 48 07 00 00       	call   126b <strchr>
+     b23:	83 c4 10             	add    $0x10,%esp
+     b26:	85 c0                	test   %eax,%eax
+     b28:	75 49                	jne    b73 <gettoken+0x11f>
+     b2a:	83 ec 08             	sub    $0x8,%esp
+     b2d:	0f be 03             	movsbl (%ebx),%eax
+     b30:	50                   	push   %eax
+     b31:	68 e4 21 00 00       	push   $0x21e4
+     b36:	e8 30 07 00 00       	call   126b <strchr>
+     b3b:	83 c4 10             	add    $0x10,%esp
+     b3e:	85 c0                	test   %eax,%eax
+     b40:	75 27                	jne    b69 <gettoken+0x115>
+      s++;
+     b42:	83 c3 01             	add    $0x1,%ebx
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     b45:	39 de                	cmp    %ebx,%esi
+     b47:	75 c9                	jne    b12 <gettoken+0xbe>
+      s++;
+     b49:	89 f3                	mov    %esi,%ebx
+    ret = 'a';
+     b4b:	bf 61 00 00 00       	mov    $0x61,%edi
+  if(eq)
+     b50:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     b54:	0f 85 61 ff ff ff    	jne    abb <gettoken+0x67>
+     b5a:	eb 89                	jmp    ae5 <gettoken+0x91>
+      s++;
+     b5c:	83 c3 02             	add    $0x2,%ebx
+      ret = '+';
+     b5f:	bf 2b 00 00 00       	mov    $0x2b,%edi
+     b64:	e9 4c ff ff ff       	jmp    ab5 <gettoken+0x61>
+    ret = 'a';
+     b69:	bf 61 00 00 00       	mov    $0x61,%edi
+     b6e:	e9 42 ff ff ff       	jmp    ab5 <gettoken+0x61>
+     b73:	bf 61 00 00 00       	mov    $0x61,%edi
+     b78:	e9 38 ff ff ff       	jmp    ab5 <gettoken+0x61>
+     b7d:	bf 61 00 00 00       	mov    $0x61,%edi
+  if(eq)
+     b82:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     b86:	0f 85 2f ff ff ff    	jne    abb <gettoken+0x67>
+     b8c:	e9 54 ff ff ff       	jmp    ae5 <gettoken+0x91>
+
+00000b91 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     b91:	55                   	push   %ebp
+     b92:	89 e5                	mov    %esp,%ebp
+     b94:	57                   	push   %edi
+     b95:	56                   	push   %esi
+     b96:	53                   	push   %ebx
+     b97:	83 ec 0c             	sub    $0xc,%esp
+     b9a:	8b 7d 08             	mov    0x8(%ebp),%edi
+     b9d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     ba0:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     ba2:	39 f3                	cmp    %esi,%ebx
+     ba4:	73 21                	jae    bc7 <peek+0x36>
+     ba6:	83 ec 08             	sub    $0x8,%esp
+     ba9:	0f be 03             	movsbl (%ebx),%eax
+     bac:	50                   	push   %eax
+     bad:	68 ec 21 00 00       	push   $0x21ec
+     bb2:	e8 b4 06 00 00       	call   126b <strchr>
+     bb7:	83 c4 10             	add    $0x10,%esp
+     bba:	85 c0                	test   %eax,%eax
+     bbc:	74 09                	je     bc7 <peek+0x36>
+    s++;
+     bbe:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     bc1:	39 de                	cmp    %ebx,%esi
+     bc3:	75 e1                	jne    ba6 <peek+0x15>
+    s++;
+     bc5:	89 f3                	mov    %esi,%ebx
+  *ps = s;
+     bc7:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     bc9:	0f b6 03             	movzbl (%ebx),%eax
+     bcc:	ba 00 00 00 00       	mov    $0x0,%edx
+     bd1:	84 c0                	test   %al,%al
+     bd3:	75 0a                	jne    bdf <peek+0x4e>
+}
+     bd5:	89 d0                	mov    %edx,%eax
+     bd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bda:	5b                   	pop    %ebx
+     bdb:	5e                   	pop    %esi
+     bdc:	5f                   	pop    %edi
+     bdd:	5d                   	pop    %ebp
+     bde:	c3                   	ret
+  return *s && strchr(toks, *s);
+     bdf:	83 ec 08             	sub    $0x8,%esp
+     be2:	0f be c0             	movsbl %al,%eax
+     be5:	50                   	push   %eax
+     be6:	ff 75 10             	push   0x10(%ebp)
+     be9:	e8 7d 06 00 00       	call   126b <strchr>
+     bee:	83 c4 10             	add    $0x10,%esp
+     bf1:	85 c0                	test   %eax,%eax
+     bf3:	0f 95 c2             	setne  %dl
+     bf6:	0f b6 d2             	movzbl %dl,%edx
+     bf9:	eb da                	jmp    bd5 <peek+0x44>
+
+00000bfb <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     bfb:	55                   	push   %ebp
+     bfc:	89 e5                	mov    %esp,%ebp
+     bfe:	57                   	push   %edi
+     bff:	56                   	push   %esi
+     c00:	53                   	push   %ebx
+     c01:	83 ec 1c             	sub    $0x1c,%esp
+     c04:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     c0a:	eb 33                	jmp    c3f <parseredirs+0x44>
+    tok = gettoken(ps, es, 0, 0);
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+      parsefail("missing file for redirection");
+     c0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+     c0f:	83 ec 0c             	sub    $0xc,%esp
+     c12:	68 cf 19 00 00       	push   $0x19cf
+     c17:	e8 af f7 ff ff       	call   3cb <parsefail>
+      break;
+     c1c:	83 c4 10             	add    $0x10,%esp
+     c1f:	e9 aa 00 00 00       	jmp    cce <parseredirs+0xd3>
+    }
+    switch(tok){
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     c24:	83 ec 0c             	sub    $0xc,%esp
+     c27:	6a 00                	push   $0x0
+     c29:	6a 00                	push   $0x0
+     c2b:	ff 75 e0             	push   -0x20(%ebp)
+     c2e:	ff 75 e4             	push   -0x1c(%ebp)
+     c31:	ff 75 08             	push   0x8(%ebp)
+     c34:	e8 37 fd ff ff       	call   970 <redircmd>
+     c39:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     c3c:	83 c4 20             	add    $0x20,%esp
+  while(peek(ps, es, "<>")){
+     c3f:	83 ec 04             	sub    $0x4,%esp
+     c42:	68 ec 19 00 00       	push   $0x19ec
+     c47:	53                   	push   %ebx
+     c48:	56                   	push   %esi
+     c49:	e8 43 ff ff ff       	call   b91 <peek>
+     c4e:	83 c4 10             	add    $0x10,%esp
+     c51:	85 c0                	test   %eax,%eax
+     c53:	74 76                	je     ccb <parseredirs+0xd0>
+    tok = gettoken(ps, es, 0, 0);
+     c55:	6a 00                	push   $0x0
+     c57:	6a 00                	push   $0x0
+     c59:	53                   	push   %ebx
+     c5a:	56                   	push   %esi
+     c5b:	e8 f4 fd ff ff       	call   a54 <gettoken>
+     c60:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+     c62:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c65:	50                   	push   %eax
+     c66:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c69:	50                   	push   %eax
+     c6a:	53                   	push   %ebx
+     c6b:	56                   	push   %esi
+     c6c:	e8 e3 fd ff ff       	call   a54 <gettoken>
+     c71:	83 c4 20             	add    $0x20,%esp
+     c74:	83 f8 61             	cmp    $0x61,%eax
+     c77:	75 93                	jne    c0c <parseredirs+0x11>
+    switch(tok){
+     c79:	83 ff 3c             	cmp    $0x3c,%edi
+     c7c:	74 a6                	je     c24 <parseredirs+0x29>
+     c7e:	83 ff 3e             	cmp    $0x3e,%edi
+     c81:	74 25                	je     ca8 <parseredirs+0xad>
+     c83:	83 ff 2b             	cmp    $0x2b,%edi
+     c86:	75 b7                	jne    c3f <parseredirs+0x44>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     c88:	83 ec 0c             	sub    $0xc,%esp
+     c8b:	6a 01                	push   $0x1
+     c8d:	68 01 02 00 00       	push   $0x201
+     c92:	ff 75 e0             	push   -0x20(%ebp)
+     c95:	ff 75 e4             	push   -0x1c(%ebp)
+     c98:	ff 75 08             	push   0x8(%ebp)
+     c9b:	e8 d0 fc ff ff       	call   970 <redircmd>
+     ca0:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     ca3:	83 c4 20             	add    $0x20,%esp
+     ca6:	eb 97                	jmp    c3f <parseredirs+0x44>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     ca8:	83 ec 0c             	sub    $0xc,%esp
+     cab:	6a 01                	push   $0x1
+     cad:	68 01 02 00 00       	push   $0x201
+     cb2:	ff 75 e0             	push   -0x20(%ebp)
+     cb5:	ff 75 e4             	push   -0x1c(%ebp)
+     cb8:	ff 75 08             	push   0x8(%ebp)
+     cbb:	e8 b0 fc ff ff       	call   970 <redircmd>
+     cc0:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     cc3:	83 c4 20             	add    $0x20,%esp
+     cc6:	e9 74 ff ff ff       	jmp    c3f <parseredirs+0x44>
+     ccb:	8b 7d 08             	mov    0x8(%ebp),%edi
+    }
+  }
+  return cmd;
+}
+     cce:	89 f8                	mov    %edi,%eax
+     cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd3:	5b                   	pop    %ebx
+     cd4:	5e                   	pop    %esi
+     cd5:	5f                   	pop    %edi
+     cd6:	5d                   	pop    %ebp
+     cd7:	c3                   	ret
+
+00000cd8 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     cd8:	55                   	push   %ebp
+     cd9:	89 e5                	mov    %esp,%ebp
+     cdb:	57                   	push   %edi
+     cdc:	56                   	push   %esi
+     cdd:	53                   	push   %ebx
+     cde:	83 ec 30             	sub    $0x30,%esp
+     ce1:	8b 75 08             	mov    0x8(%ebp),%esi
+     ce4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     ce7:	68 ef 19 00 00       	push   $0x19ef
+     cec:	57                   	push   %edi
+     ced:	56                   	push   %esi
+     cee:	e8 9e fe ff ff       	call   b91 <peek>
+     cf3:	83 c4 10             	add    $0x10,%esp
+     cf6:	85 c0                	test   %eax,%eax
+     cf8:	75 7e                	jne    d78 <parseexec+0xa0>
+     cfa:	89 c3                	mov    %eax,%ebx
+    return parseblock(ps, es);
+
+  ret = execcmd();
+     cfc:	e8 45 fc ff ff       	call   946 <execcmd>
+     d01:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     d04:	83 ec 04             	sub    $0x4,%esp
+     d07:	57                   	push   %edi
+     d08:	56                   	push   %esi
+     d09:	50                   	push   %eax
+     d0a:	e8 ec fe ff ff       	call   bfb <parseredirs>
+     d0f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     d12:	83 c4 10             	add    $0x10,%esp
+     d15:	83 ec 04             	sub    $0x4,%esp
+     d18:	68 06 1a 00 00       	push   $0x1a06
+     d1d:	57                   	push   %edi
+     d1e:	56                   	push   %esi
+     d1f:	e8 6d fe ff ff       	call   b91 <peek>
+     d24:	83 c4 10             	add    $0x10,%esp
+     d27:	85 c0                	test   %eax,%eax
+     d29:	0f 85 82 00 00 00    	jne    db1 <parseexec+0xd9>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     d2f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d32:	50                   	push   %eax
+     d33:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     d36:	50                   	push   %eax
+     d37:	57                   	push   %edi
+     d38:	56                   	push   %esi
+     d39:	e8 16 fd ff ff       	call   a54 <gettoken>
+     d3e:	83 c4 10             	add    $0x10,%esp
+     d41:	85 c0                	test   %eax,%eax
+     d43:	74 6c                	je     db1 <parseexec+0xd9>
+      break;
+    if(tok != 'a'){
+     d45:	83 f8 61             	cmp    $0x61,%eax
+     d48:	75 40                	jne    d8a <parseexec+0xb2>
+      parsefail("syntax");
+      break;
+    }
+    cmd->argv[argc] = q;
+     d4a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d4d:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     d50:	89 44 9a 04          	mov    %eax,0x4(%edx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     d54:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d57:	89 44 9a 2c          	mov    %eax,0x2c(%edx,%ebx,4)
+    argc++;
+     d5b:	83 c3 01             	add    $0x1,%ebx
+    if(argc >= MAXARGS){
+     d5e:	83 fb 0a             	cmp    $0xa,%ebx
+     d61:	74 39                	je     d9c <parseexec+0xc4>
+      parsefail("too many args");
+      argc--;
+      break;
+    }
+    ret = parseredirs(ret, ps, es);
+     d63:	83 ec 04             	sub    $0x4,%esp
+     d66:	57                   	push   %edi
+     d67:	56                   	push   %esi
+     d68:	ff 75 d4             	push   -0x2c(%ebp)
+     d6b:	e8 8b fe ff ff       	call   bfb <parseredirs>
+     d70:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     d73:	83 c4 10             	add    $0x10,%esp
+     d76:	eb 9d                	jmp    d15 <parseexec+0x3d>
+    return parseblock(ps, es);
+     d78:	83 ec 08             	sub    $0x8,%esp
+     d7b:	57                   	push   %edi
+     d7c:	56                   	push   %esi
+     d7d:	e8 3c 01 00 00       	call   ebe <parseblock>
+     d82:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     d85:	83 c4 10             	add    $0x10,%esp
+     d88:	eb 3a                	jmp    dc4 <parseexec+0xec>
+      parsefail("syntax");
+     d8a:	83 ec 0c             	sub    $0xc,%esp
+     d8d:	68 f1 19 00 00       	push   $0x19f1
+     d92:	e8 34 f6 ff ff       	call   3cb <parsefail>
+      break;
+     d97:	83 c4 10             	add    $0x10,%esp
+     d9a:	eb 15                	jmp    db1 <parseexec+0xd9>
+      parsefail("too many args");
+     d9c:	83 ec 0c             	sub    $0xc,%esp
+     d9f:	68 f8 19 00 00       	push   $0x19f8
+     da4:	e8 22 f6 ff ff       	call   3cb <parsefail>
+      break;
+     da9:	83 c4 10             	add    $0x10,%esp
+     dac:	bb 09 00 00 00       	mov    $0x9,%ebx
+  }
+  cmd->argv[argc] = 0;
+     db1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     db4:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+     dbb:	00 
+  cmd->eargv[argc] = 0;
+     dbc:	c7 44 98 2c 00 00 00 	movl   $0x0,0x2c(%eax,%ebx,4)
+     dc3:	00 
+  return ret;
+}
+     dc4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dca:	5b                   	pop    %ebx
+     dcb:	5e                   	pop    %esi
+     dcc:	5f                   	pop    %edi
+     dcd:	5d                   	pop    %ebp
+     dce:	c3                   	ret
+
+00000dcf <parsepipe>:
+{
+     dcf:	55                   	push   %ebp
+     dd0:	89 e5                	mov    %esp,%ebp
+     dd2:	57                   	push   %edi
+     dd3:	56                   	push   %esi
+     dd4:	53                   	push   %ebx
+     dd5:	83 ec 14             	sub    $0x14,%esp
+     dd8:	8b 75 08             	mov    0x8(%ebp),%esi
+     ddb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     dde:	57                   	push   %edi
+     ddf:	56                   	push   %esi
+     de0:	e8 f3 fe ff ff       	call   cd8 <parseexec>
+     de5:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     de7:	83 c4 0c             	add    $0xc,%esp
+     dea:	68 0b 1a 00 00       	push   $0x1a0b
+     def:	57                   	push   %edi
+     df0:	56                   	push   %esi
+     df1:	e8 9b fd ff ff       	call   b91 <peek>
+     df6:	83 c4 10             	add    $0x10,%esp
+     df9:	85 c0                	test   %eax,%eax
+     dfb:	75 0a                	jne    e07 <parsepipe+0x38>
+}
+     dfd:	89 d8                	mov    %ebx,%eax
+     dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e02:	5b                   	pop    %ebx
+     e03:	5e                   	pop    %esi
+     e04:	5f                   	pop    %edi
+     e05:	5d                   	pop    %ebp
+     e06:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     e07:	6a 00                	push   $0x0
+     e09:	6a 00                	push   $0x0
+     e0b:	57                   	push   %edi
+     e0c:	56                   	push   %esi
+     e0d:	e8 42 fc ff ff       	call   a54 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     e12:	83 c4 08             	add    $0x8,%esp
+     e15:	57                   	push   %edi
+     e16:	56                   	push   %esi
+     e17:	e8 b3 ff ff ff       	call   dcf <parsepipe>
+     e1c:	83 c4 08             	add    $0x8,%esp
+     e1f:	50                   	push   %eax
+     e20:	53                   	push   %ebx
+     e21:	e8 92 fb ff ff       	call   9b8 <pipecmd>
+     e26:	89 c3                	mov    %eax,%ebx
+     e28:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     e2b:	eb d0                	jmp    dfd <parsepipe+0x2e>
+
+00000e2d <parseline>:
+{
+     e2d:	55                   	push   %ebp
+     e2e:	89 e5                	mov    %esp,%ebp
+     e30:	57                   	push   %edi
+     e31:	56                   	push   %esi
+     e32:	53                   	push   %ebx
+     e33:	83 ec 14             	sub    $0x14,%esp
+     e36:	8b 75 08             	mov    0x8(%ebp),%esi
+     e39:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     e3c:	57                   	push   %edi
+     e3d:	56                   	push   %esi
+     e3e:	e8 8c ff ff ff       	call   dcf <parsepipe>
+     e43:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     e45:	83 c4 10             	add    $0x10,%esp
+     e48:	eb 18                	jmp    e62 <parseline+0x35>
+    gettoken(ps, es, 0, 0);
+     e4a:	6a 00                	push   $0x0
+     e4c:	6a 00                	push   $0x0
+     e4e:	57                   	push   %edi
+     e4f:	56                   	push   %esi
+     e50:	e8 ff fb ff ff       	call   a54 <gettoken>
+    cmd = backcmd(cmd);
+     e55:	89 1c 24             	mov    %ebx,(%esp)
+     e58:	e8 c7 fb ff ff       	call   a24 <backcmd>
+     e5d:	89 c3                	mov    %eax,%ebx
+     e5f:	83 c4 10             	add    $0x10,%esp
+  while(peek(ps, es, "&")){
+     e62:	83 ec 04             	sub    $0x4,%esp
+     e65:	68 0d 1a 00 00       	push   $0x1a0d
+     e6a:	57                   	push   %edi
+     e6b:	56                   	push   %esi
+     e6c:	e8 20 fd ff ff       	call   b91 <peek>
+     e71:	83 c4 10             	add    $0x10,%esp
+     e74:	85 c0                	test   %eax,%eax
+     e76:	75 d2                	jne    e4a <parseline+0x1d>
+  if(peek(ps, es, ";")){
+     e78:	83 ec 04             	sub    $0x4,%esp
+     e7b:	68 09 1a 00 00       	push   $0x1a09
+     e80:	57                   	push   %edi
+     e81:	56                   	push   %esi
+     e82:	e8 0a fd ff ff       	call   b91 <peek>
+     e87:	83 c4 10             	add    $0x10,%esp
+     e8a:	85 c0                	test   %eax,%eax
+     e8c:	75 0a                	jne    e98 <parseline+0x6b>
+}
+     e8e:	89 d8                	mov    %ebx,%eax
+     e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e93:	5b                   	pop    %ebx
+     e94:	5e                   	pop    %esi
+     e95:	5f                   	pop    %edi
+     e96:	5d                   	pop    %ebp
+     e97:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     e98:	6a 00                	push   $0x0
+     e9a:	6a 00                	push   $0x0
+     e9c:	57                   	push   %edi
+     e9d:	56                   	push   %esi
+     e9e:	e8 b1 fb ff ff       	call   a54 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     ea3:	83 c4 08             	add    $0x8,%esp
+     ea6:	57                   	push   %edi
+     ea7:	56                   	push   %esi
+     ea8:	e8 80 ff ff ff       	call   e2d <parseline>
+     ead:	83 c4 08             	add    $0x8,%esp
+     eb0:	50                   	push   %eax
+     eb1:	53                   	push   %ebx
+     eb2:	e8 37 fb ff ff       	call   9ee <listcmd>
+     eb7:	89 c3                	mov    %eax,%ebx
+     eb9:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     ebc:	eb d0                	jmp    e8e <parseline+0x61>
+
+00000ebe <parseblock>:
+{
+     ebe:	55                   	push   %ebp
+     ebf:	89 e5                	mov    %esp,%ebp
+     ec1:	57                   	push   %edi
+     ec2:	56                   	push   %esi
+     ec3:	53                   	push   %ebx
+     ec4:	83 ec 10             	sub    $0x10,%esp
+     ec7:	8b 75 08             	mov    0x8(%ebp),%esi
+     eca:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(!peek(ps, es, "("))
+     ecd:	68 ef 19 00 00       	push   $0x19ef
+     ed2:	57                   	push   %edi
+     ed3:	56                   	push   %esi
+     ed4:	e8 b8 fc ff ff       	call   b91 <peek>
+     ed9:	83 c4 10             	add    $0x10,%esp
+     edc:	85 c0                	test   %eax,%eax
+     ede:	74 52                	je     f32 <parseblock+0x74>
+  gettoken(ps, es, 0, 0);
+     ee0:	6a 00                	push   $0x0
+     ee2:	6a 00                	push   $0x0
+     ee4:	57                   	push   %edi
+     ee5:	56                   	push   %esi
+     ee6:	e8 69 fb ff ff       	call   a54 <gettoken>
+  cmd = parseline(ps, es);
+     eeb:	83 c4 08             	add    $0x8,%esp
+     eee:	57                   	push   %edi
+     eef:	56                   	push   %esi
+     ef0:	e8 38 ff ff ff       	call   e2d <parseline>
+     ef5:	89 c3                	mov    %eax,%ebx
+  if(!peek(ps, es, ")")){
+     ef7:	83 c4 0c             	add    $0xc,%esp
+     efa:	68 2b 1a 00 00       	push   $0x1a2b
+     eff:	57                   	push   %edi
+     f00:	56                   	push   %esi
+     f01:	e8 8b fc ff ff       	call   b91 <peek>
+     f06:	83 c4 10             	add    $0x10,%esp
+     f09:	85 c0                	test   %eax,%eax
+     f0b:	74 32                	je     f3f <parseblock+0x81>
+  gettoken(ps, es, 0, 0);
+     f0d:	6a 00                	push   $0x0
+     f0f:	6a 00                	push   $0x0
+     f11:	57                   	push   %edi
+     f12:	56                   	push   %esi
+     f13:	e8 3c fb ff ff       	call   a54 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     f18:	83 c4 0c             	add    $0xc,%esp
+     f1b:	57                   	push   %edi
+     f1c:	56                   	push   %esi
+     f1d:	53                   	push   %ebx
+     f1e:	e8 d8 fc ff ff       	call   bfb <parseredirs>
+     f23:	89 c3                	mov    %eax,%ebx
+  return cmd;
+     f25:	83 c4 10             	add    $0x10,%esp
+}
+     f28:	89 d8                	mov    %ebx,%eax
+     f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f2d:	5b                   	pop    %ebx
+     f2e:	5e                   	pop    %esi
+     f2f:	5f                   	pop    %edi
+     f30:	5d                   	pop    %ebp
+     f31:	c3                   	ret
+    panic("parseblock");  // parseexec() checked
+     f32:	83 ec 0c             	sub    $0xc,%esp
+     f35:	68 0f 1a 00 00       	push   $0x1a0f
+     f3a:	e8 fb f3 ff ff       	call   33a <panic>
+    parsefail("syntax - missing )");
+     f3f:	83 ec 0c             	sub    $0xc,%esp
+     f42:	68 1a 1a 00 00       	push   $0x1a1a
+     f47:	e8 7f f4 ff ff       	call   3cb <parsefail>
+    return cmd;
+     f4c:	83 c4 10             	add    $0x10,%esp
+     f4f:	eb d7                	jmp    f28 <parseblock+0x6a>
+
+00000f51 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     f51:	55                   	push   %ebp
+     f52:	89 e5                	mov    %esp,%ebp
+     f54:	53                   	push   %ebx
+     f55:	83 ec 04             	sub    $0x4,%esp
+     f58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     f5b:	85 db                	test   %ebx,%ebx
+     f5d:	74 3c                	je     f9b <nulterminate+0x4a>
+    return 0;
+
+  switch(cmd->type){
+     f5f:	83 3b 05             	cmpl   $0x5,(%ebx)
+     f62:	77 37                	ja     f9b <nulterminate+0x4a>
+     f64:	8b 03                	mov    (%ebx),%eax
+     f66:	ff 24 85 84 1a 00 00 	jmp    *0x1a84(,%eax,4)
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    for(i=0; ecmd->argv[i]; i++)
+     f6d:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+     f71:	74 28                	je     f9b <nulterminate+0x4a>
+     f73:	8d 43 08             	lea    0x8(%ebx),%eax
+      *ecmd->eargv[i] = 0;
+     f76:	8b 50 24             	mov    0x24(%eax),%edx
+     f79:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     f7c:	83 c0 04             	add    $0x4,%eax
+     f7f:	83 78 fc 00          	cmpl   $0x0,-0x4(%eax)
+     f83:	75 f1                	jne    f76 <nulterminate+0x25>
+     f85:	eb 14                	jmp    f9b <nulterminate+0x4a>
+    break;
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    nulterminate(rcmd->cmd);
+     f87:	83 ec 0c             	sub    $0xc,%esp
+     f8a:	ff 73 04             	push   0x4(%ebx)
+     f8d:	e8 bf ff ff ff       	call   f51 <nulterminate>
+    *rcmd->efile = 0;
+     f92:	8b 43 0c             	mov    0xc(%ebx),%eax
+     f95:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     f98:	83 c4 10             	add    $0x10,%esp
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     f9b:	89 d8                	mov    %ebx,%eax
+     f9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fa0:	c9                   	leave
+     fa1:	c3                   	ret
+    nulterminate(pcmd->left);
+     fa2:	83 ec 0c             	sub    $0xc,%esp
+     fa5:	ff 73 04             	push   0x4(%ebx)
+     fa8:	e8 a4 ff ff ff       	call   f51 <nulterminate>
+    nulterminate(pcmd->right);
+     fad:	83 c4 04             	add    $0x4,%esp
+     fb0:	ff 73 08             	push   0x8(%ebx)
+     fb3:	e8 99 ff ff ff       	call   f51 <nulterminate>
+    break;
+     fb8:	83 c4 10             	add    $0x10,%esp
+     fbb:	eb de                	jmp    f9b <nulterminate+0x4a>
+    nulterminate(lcmd->left);
+     fbd:	83 ec 0c             	sub    $0xc,%esp
+     fc0:	ff 73 04             	push   0x4(%ebx)
+     fc3:	e8 89 ff ff ff       	call   f51 <nulterminate>
+    nulterminate(lcmd->right);
+     fc8:	83 c4 04             	add    $0x4,%esp
+     fcb:	ff 73 08             	push   0x8(%ebx)
+     fce:	e8 7e ff ff ff       	call   f51 <nulterminate>
+    break;
+     fd3:	83 c4 10             	add    $0x10,%esp
+     fd6:	eb c3                	jmp    f9b <nulterminate+0x4a>
+    nulterminate(bcmd->cmd);
+     fd8:	83 ec 0c             	sub    $0xc,%esp
+     fdb:	ff 73 04             	push   0x4(%ebx)
+     fde:	e8 6e ff ff ff       	call   f51 <nulterminate>
+    break;
+     fe3:	83 c4 10             	add    $0x10,%esp
+     fe6:	eb b3                	jmp    f9b <nulterminate+0x4a>
+
+00000fe8 <parsecmd>:
+{
+     fe8:	55                   	push   %ebp
+     fe9:	89 e5                	mov    %esp,%ebp
+     feb:	56                   	push   %esi
+     fec:	53                   	push   %ebx
+  es = s + strlen(s);
+     fed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	53                   	push   %ebx
+     ff4:	e8 33 02 00 00       	call   122c <strlen>
+     ff9:	01 c3                	add    %eax,%ebx
+  parseerr = 0;
+     ffb:	c7 05 20 22 00 00 00 	movl   $0x0,0x2220
+    1002:	00 00 00 
+  cmd = parseline(&s, es);
+    1005:	83 c4 08             	add    $0x8,%esp
+    1008:	53                   	push   %ebx
+    1009:	8d 45 08             	lea    0x8(%ebp),%eax
+    100c:	50                   	push   %eax
+    100d:	e8 1b fe ff ff       	call   e2d <parseline>
+    1012:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+    1014:	83 c4 0c             	add    $0xc,%esp
+    1017:	68 40 19 00 00       	push   $0x1940
+    101c:	53                   	push   %ebx
+    101d:	8d 45 08             	lea    0x8(%ebp),%eax
+    1020:	50                   	push   %eax
+    1021:	e8 6b fb ff ff       	call   b91 <peek>
+  if(s != es){
+    1026:	8b 45 08             	mov    0x8(%ebp),%eax
+    1029:	83 c4 10             	add    $0x10,%esp
+    102c:	39 d8                	cmp    %ebx,%eax
+    102e:	74 1f                	je     104f <parsecmd+0x67>
+    printf(2, "leftovers: %s\n", s);
+    1030:	83 ec 04             	sub    $0x4,%esp
+    1033:	50                   	push   %eax
+    1034:	68 2d 1a 00 00       	push   $0x1a2d
+    1039:	6a 02                	push   $0x2
+    103b:	e8 d8 05 00 00       	call   1618 <printf>
+    parsefail("syntax");
+    1040:	c7 04 24 f1 19 00 00 	movl   $0x19f1,(%esp)
+    1047:	e8 7f f3 ff ff       	call   3cb <parsefail>
+    104c:	83 c4 10             	add    $0x10,%esp
+  if(parseerr){
+    104f:	83 3d 20 22 00 00 00 	cmpl   $0x0,0x2220
+    1056:	75 15                	jne    106d <parsecmd+0x85>
+  nulterminate(cmd);
+    1058:	83 ec 0c             	sub    $0xc,%esp
+    105b:	56                   	push   %esi
+    105c:	e8 f0 fe ff ff       	call   f51 <nulterminate>
+  return cmd;
+    1061:	83 c4 10             	add    $0x10,%esp
+}
+    1064:	89 f0                	mov    %esi,%eax
+    1066:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1069:	5b                   	pop    %ebx
+    106a:	5e                   	pop    %esi
+    106b:	5d                   	pop    %ebp
+    106c:	c3                   	ret
+    freecmd(cmd);
+    106d:	83 ec 0c             	sub    $0xc,%esp
+    1070:	56                   	push   %esi
+    1071:	e8 8a ef ff ff       	call   0 <freecmd>
+    return 0;
+    1076:	83 c4 10             	add    $0x10,%esp
+    1079:	be 00 00 00 00       	mov    $0x0,%esi
+    107e:	eb e4                	jmp    1064 <parsecmd+0x7c>
+
+00001080 <main>:
+{
+    1080:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1084:	83 e4 f0             	and    $0xfffffff0,%esp
+    1087:	ff 71 fc             	push   -0x4(%ecx)
+    108a:	55                   	push   %ebp
+    108b:	89 e5                	mov    %esp,%ebp
+    108d:	57                   	push   %edi
+    108e:	56                   	push   %esi
+    108f:	53                   	push   %ebx
+    1090:	51                   	push   %ecx
+    1091:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  while((fd = open("console", O_RDWR)) >= 0){
+    1097:	83 ec 08             	sub    $0x8,%esp
+    109a:	6a 02                	push   $0x2
+    109c:	68 3c 1a 00 00       	push   $0x1a3c
+    10a1:	e8 da 03 00 00       	call   1480 <open>
+    10a6:	83 c4 10             	add    $0x10,%esp
+    10a9:	85 c0                	test   %eax,%eax
+    10ab:	78 11                	js     10be <main+0x3e>
+    if(fd >= 3){
+    10ad:	83 f8 02             	cmp    $0x2,%eax
+    10b0:	7e e5                	jle    1097 <main+0x17>
+      close(fd);
+    10b2:	83 ec 0c             	sub    $0xc,%esp
+    10b5:	50                   	push   %eax
+    10b6:	e8 ad 03 00 00       	call   1468 <close>
+      break;
+    10bb:	83 c4 10             	add    $0x10,%esp
+    spawncmd(cmd, fa, 0, pids, &npids);
+    10be:	8d bd e4 fe ff ff    	lea    -0x11c(%ebp),%edi
+    10c4:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+    10ca:	eb 78                	jmp    1144 <main+0xc4>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+    10cc:	80 3d 41 22 00 00 64 	cmpb   $0x64,0x2241
+    10d3:	0f 85 94 00 00 00    	jne    116d <main+0xed>
+    10d9:	80 3d 42 22 00 00 20 	cmpb   $0x20,0x2242
+    10e0:	0f 85 87 00 00 00    	jne    116d <main+0xed>
+      buf[strlen(buf)-1] = 0;  // chop \n
+    10e6:	83 ec 0c             	sub    $0xc,%esp
+    10e9:	68 40 22 00 00       	push   $0x2240
+    10ee:	e8 39 01 00 00       	call   122c <strlen>
+    10f3:	c6 80 3f 22 00 00 00 	movb   $0x0,0x223f(%eax)
+      if(chdir(buf+3) < 0)
+    10fa:	c7 04 24 43 22 00 00 	movl   $0x2243,(%esp)
+    1101:	e8 aa 03 00 00       	call   14b0 <chdir>
+    1106:	83 c4 10             	add    $0x10,%esp
+    1109:	85 c0                	test   %eax,%eax
+    110b:	79 37                	jns    1144 <main+0xc4>
+        printf(2, "cannot cd %s\n", buf+3);
+    110d:	83 ec 04             	sub    $0x4,%esp
+    1110:	68 43 22 00 00       	push   $0x2243
+    1115:	68 44 1a 00 00       	push   $0x1a44
+    111a:	6a 02                	push   $0x2
+    111c:	e8 f7 04 00 00       	call   1618 <printf>
+    1121:	83 c4 10             	add    $0x10,%esp
+    1124:	eb 1e                	jmp    1144 <main+0xc4>
+      dobuiltin(buf);
+    1126:	83 ec 0c             	sub    $0xc,%esp
+    1129:	68 40 22 00 00       	push   $0x2240
+    112e:	e8 a6 f1 ff ff       	call   2d9 <dobuiltin>
+      continue;
+    1133:	83 c4 10             	add    $0x10,%esp
+    1136:	eb 0c                	jmp    1144 <main+0xc4>
+    freecmd(cmd);
+    1138:	83 ec 0c             	sub    $0xc,%esp
+    113b:	53                   	push   %ebx
+    113c:	e8 bf ee ff ff       	call   0 <freecmd>
+    1141:	83 c4 10             	add    $0x10,%esp
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    1144:	83 ec 08             	sub    $0x8,%esp
+    1147:	6a 64                	push   $0x64
+    1149:	68 40 22 00 00       	push   $0x2240
+    114e:	e8 38 ef ff ff       	call   8b <getcmd>
+    1153:	83 c4 10             	add    $0x10,%esp
+    1156:	85 c0                	test   %eax,%eax
+    1158:	78 7e                	js     11d8 <main+0x158>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+    115a:	0f b6 05 40 22 00 00 	movzbl 0x2240,%eax
+    1161:	3c 63                	cmp    $0x63,%al
+    1163:	0f 84 63 ff ff ff    	je     10cc <main+0x4c>
+    if (buf[0]=='_') {     // assume it is a builtin command
+    1169:	3c 5f                	cmp    $0x5f,%al
+    116b:	74 b9                	je     1126 <main+0xa6>
+    if((cmd = parsecmd(buf)) == 0)
+    116d:	83 ec 0c             	sub    $0xc,%esp
+    1170:	68 40 22 00 00       	push   $0x2240
+    1175:	e8 6e fe ff ff       	call   fe8 <parsecmd>
+    117a:	89 c3                	mov    %eax,%ebx
+    117c:	83 c4 10             	add    $0x10,%esp
+    117f:	85 c0                	test   %eax,%eax
+    1181:	74 c1                	je     1144 <main+0xc4>
+    npids = 0;
+    1183:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%ebp)
+    118a:	00 00 00 
+    spawncmd(cmd, fa, 0, pids, &npids);
+    118d:	83 ec 0c             	sub    $0xc,%esp
+    1190:	57                   	push   %edi
+    1191:	56                   	push   %esi
+    1192:	6a 00                	push   $0x0
+    1194:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+    119a:	50                   	push   %eax
+    119b:	53                   	push   %ebx
+    119c:	e8 12 f4 ff ff       	call   5b3 <spawncmd>
+    while(npids > 0)
+    11a1:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+    11a7:	83 c4 20             	add    $0x20,%esp
+    11aa:	85 c0                	test   %eax,%eax
+    11ac:	7e 8a                	jle    1138 <main+0xb8>
+      waitpid(pids[--npids]);
+    11ae:	83 e8 01             	sub    $0x1,%eax
+    11b1:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+    11b7:	83 ec 0c             	sub    $0xc,%esp
+    11ba:	ff b4 85 e8 fe ff ff 	push   -0x118(%ebp,%eax,4)
+    11c1:	e8 6a 03 00 00       	call   1530 <waitpid>
+    while(npids > 0)
+    11c6:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+    11cc:	83 c4 10             	add    $0x10,%esp
+    11cf:	85 c0                	test   %eax,%eax
+    11d1:	7f db                	jg     11ae <main+0x12e>
+    11d3:	e9 60 ff ff ff       	jmp    1138 <main+0xb8>
+  exit();
+    11d8:	e8 63 02 00 00       	call   1440 <exit>
+
+000011dd <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    11dd:	55                   	push   %ebp
+    11de:	89 e5                	mov    %esp,%ebp
+    11e0:	53                   	push   %ebx
+    11e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ec:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11f0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11f3:	83 c0 01             	add    $0x1,%eax
+    11f6:	84 d2                	test   %dl,%dl
+    11f8:	75 f2                	jne    11ec <strcpy+0xf>
+    ;
+  return os;
+}
+    11fa:	89 c8                	mov    %ecx,%eax
+    11fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11ff:	c9                   	leave
+    1200:	c3                   	ret
+
+00001201 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1201:	55                   	push   %ebp
+    1202:	89 e5                	mov    %esp,%ebp
+    1204:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1207:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    120a:	0f b6 01             	movzbl (%ecx),%eax
+    120d:	84 c0                	test   %al,%al
+    120f:	74 11                	je     1222 <strcmp+0x21>
+    1211:	38 02                	cmp    %al,(%edx)
+    1213:	75 0d                	jne    1222 <strcmp+0x21>
+    p++, q++;
+    1215:	83 c1 01             	add    $0x1,%ecx
+    1218:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    121b:	0f b6 01             	movzbl (%ecx),%eax
+    121e:	84 c0                	test   %al,%al
+    1220:	75 ef                	jne    1211 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+    1222:	0f b6 c0             	movzbl %al,%eax
+    1225:	0f b6 12             	movzbl (%edx),%edx
+    1228:	29 d0                	sub    %edx,%eax
+}
+    122a:	5d                   	pop    %ebp
+    122b:	c3                   	ret
+
+0000122c <strlen>:
+
+uint
+strlen(char *s)
+{
+    122c:	55                   	push   %ebp
+    122d:	89 e5                	mov    %esp,%ebp
+    122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1232:	80 3a 00             	cmpb   $0x0,(%edx)
+    1235:	74 14                	je     124b <strlen+0x1f>
+    1237:	b8 00 00 00 00       	mov    $0x0,%eax
+    123c:	83 c0 01             	add    $0x1,%eax
+    123f:	89 c1                	mov    %eax,%ecx
+    1241:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1245:	75 f5                	jne    123c <strlen+0x10>
+    ;
+  return n;
+}
+    1247:	89 c8                	mov    %ecx,%eax
+    1249:	5d                   	pop    %ebp
+    124a:	c3                   	ret
+  for(n = 0; s[n]; n++)
+    124b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+    1250:	eb f5                	jmp    1247 <strlen+0x1b>
+
+00001252 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1252:	55                   	push   %ebp
+    1253:	89 e5                	mov    %esp,%ebp
+    1255:	57                   	push   %edi
+    1256:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1259:	89 d7                	mov    %edx,%edi
+    125b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    125e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1261:	fc                   	cld
+    1262:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1264:	89 d0                	mov    %edx,%eax
+    1266:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1269:	c9                   	leave
+    126a:	c3                   	ret
+
+0000126b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    126b:	55                   	push   %ebp
+    126c:	89 e5                	mov    %esp,%ebp
+    126e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1271:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    1275:	0f b6 10             	movzbl (%eax),%edx
+    1278:	84 d2                	test   %dl,%dl
+    127a:	74 15                	je     1291 <strchr+0x26>
+    if(*s == c)
+    127c:	38 d1                	cmp    %dl,%cl
+    127e:	74 0f                	je     128f <strchr+0x24>
+  for(; *s; s++)
+    1280:	83 c0 01             	add    $0x1,%eax
+    1283:	0f b6 10             	movzbl (%eax),%edx
+    1286:	84 d2                	test   %dl,%dl
+    1288:	75 f2                	jne    127c <strchr+0x11>
+      return (char*)s;
+  return 0;
+    128a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    128f:	5d                   	pop    %ebp
+    1290:	c3                   	ret
+  return 0;
+    1291:	b8 00 00 00 00       	mov    $0x0,%eax
+    1296:	eb f7                	jmp    128f <strchr+0x24>
+
+00001298 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1298:	55                   	push   %ebp
+    1299:	89 e5                	mov    %esp,%ebp
+    129b:	57                   	push   %edi
+    129c:	56                   	push   %esi
+    129d:	53                   	push   %ebx
+    129e:	83 ec 2c             	sub    $0x2c,%esp
+    12a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    12a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+    12a9:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+    12ac:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    12af:	83 c3 01             	add    $0x1,%ebx
+    12b2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    12b5:	7d 27                	jge    12de <gets+0x46>
+    cc = read(0, &c, 1);
+    12b7:	83 ec 04             	sub    $0x4,%esp
+    12ba:	6a 01                	push   $0x1
+    12bc:	57                   	push   %edi
+    12bd:	6a 00                	push   $0x0
+    12bf:	e8 94 01 00 00       	call   1458 <read>
+    if(cc < 1)
+    12c4:	83 c4 10             	add    $0x10,%esp
+    12c7:	85 c0                	test   %eax,%eax
+    12c9:	7e 13                	jle    12de <gets+0x46>
+      break;
+    buf[i++] = c;
+    12cb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    12cf:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+    12d3:	3c 0a                	cmp    $0xa,%al
+    12d5:	74 04                	je     12db <gets+0x43>
+    12d7:	3c 0d                	cmp    $0xd,%al
+    12d9:	75 d1                	jne    12ac <gets+0x14>
+  for(i=0; i+1 < max; ){
+    12db:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+    12de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    12e1:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+    12e5:	89 f0                	mov    %esi,%eax
+    12e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ea:	5b                   	pop    %ebx
+    12eb:	5e                   	pop    %esi
+    12ec:	5f                   	pop    %edi
+    12ed:	5d                   	pop    %ebp
+    12ee:	c3                   	ret
+
+000012ef <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    12ef:	55                   	push   %ebp
+    12f0:	89 e5                	mov    %esp,%ebp
+    12f2:	56                   	push   %esi
+    12f3:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    12f4:	83 ec 08             	sub    $0x8,%esp
+    12f7:	6a 00                	push   $0x0
+    12f9:	ff 75 08             	push   0x8(%ebp)
+    12fc:	e8 7f 01 00 00       	call   1480 <open>
+  if(fd < 0)
+    1301:	83 c4 10             	add    $0x10,%esp
+    1304:	85 c0                	test   %eax,%eax
+    1306:	78 24                	js     132c <stat+0x3d>
+    1308:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    130a:	83 ec 08             	sub    $0x8,%esp
+    130d:	ff 75 0c             	push   0xc(%ebp)
+    1310:	50                   	push   %eax
+    1311:	e8 82 01 00 00       	call   1498 <fstat>
+    1316:	89 c6                	mov    %eax,%esi
+  close(fd);
+    1318:	89 1c 24             	mov    %ebx,(%esp)
+    131b:	e8 48 01 00 00       	call   1468 <close>
+  return r;
+    1320:	83 c4 10             	add    $0x10,%esp
+}
+    1323:	89 f0                	mov    %esi,%eax
+    1325:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1328:	5b                   	pop    %ebx
+    1329:	5e                   	pop    %esi
+    132a:	5d                   	pop    %ebp
+    132b:	c3                   	ret
+    return -1;
+    132c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1331:	eb f0                	jmp    1323 <stat+0x34>
+
+00001333 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+    1333:	55                   	push   %ebp
+    1334:	89 e5                	mov    %esp,%ebp
+    1336:	56                   	push   %esi
+    1337:	53                   	push   %ebx
+    1338:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    133b:	0f b6 0a             	movzbl (%edx),%ecx
+    133e:	80 f9 20             	cmp    $0x20,%cl
+    1341:	75 0b                	jne    134e <atoi+0x1b>
+    1343:	83 c2 01             	add    $0x1,%edx
+    1346:	0f b6 0a             	movzbl (%edx),%ecx
+    1349:	80 f9 20             	cmp    $0x20,%cl
+    134c:	74 f5                	je     1343 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    134e:	80 f9 2d             	cmp    $0x2d,%cl
+    1351:	74 3c                	je     138f <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+    1353:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+    1356:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    135b:	f6 c1 fd             	test   $0xfd,%cl
+    135e:	74 34                	je     1394 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+    1360:	0f b6 0a             	movzbl (%edx),%ecx
+    1363:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    1366:	3c 09                	cmp    $0x9,%al
+    1368:	77 2f                	ja     1399 <atoi+0x66>
+    136a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+    136f:	83 c2 01             	add    $0x1,%edx
+    1372:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+    1375:	0f be c9             	movsbl %cl,%ecx
+    1378:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+    137c:	0f b6 0a             	movzbl (%edx),%ecx
+    137f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    1382:	3c 09                	cmp    $0x9,%al
+    1384:	76 e9                	jbe    136f <atoi+0x3c>
+  return sign*n;
+    1386:	89 f0                	mov    %esi,%eax
+    1388:	0f af c3             	imul   %ebx,%eax
+}
+    138b:	5b                   	pop    %ebx
+    138c:	5e                   	pop    %esi
+    138d:	5d                   	pop    %ebp
+    138e:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+    138f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    1394:	83 c2 01             	add    $0x1,%edx
+    1397:	eb c7                	jmp    1360 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+    1399:	bb 00 00 00 00       	mov    $0x0,%ebx
+    139e:	eb e6                	jmp    1386 <atoi+0x53>
+
+000013a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	56                   	push   %esi
+    13a4:	53                   	push   %ebx
+    13a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    13a8:	0f b6 0a             	movzbl (%edx),%ecx
+    13ab:	80 f9 20             	cmp    $0x20,%cl
+    13ae:	75 0b                	jne    13bb <atoo+0x1b>
+    13b0:	83 c2 01             	add    $0x1,%edx
+    13b3:	0f b6 0a             	movzbl (%edx),%ecx
+    13b6:	80 f9 20             	cmp    $0x20,%cl
+    13b9:	74 f5                	je     13b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    13bb:	80 f9 2d             	cmp    $0x2d,%cl
+    13be:	74 3a                	je     13fa <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+    13c0:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+    13c3:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    13c8:	f6 c1 fd             	test   $0xfd,%cl
+    13cb:	74 32                	je     13ff <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+    13cd:	0f b6 0a             	movzbl (%edx),%ecx
+    13d0:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    13d3:	80 fb 07             	cmp    $0x7,%bl
+    13d6:	77 2c                	ja     1404 <atoo+0x64>
+    13d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+    13dd:	83 c2 01             	add    $0x1,%edx
+    13e0:	0f be c9             	movsbl %cl,%ecx
+    13e3:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+    13e7:	0f b6 0a             	movzbl (%edx),%ecx
+    13ea:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    13ed:	3c 07                	cmp    $0x7,%al
+    13ef:	76 ec                	jbe    13dd <atoo+0x3d>
+  return sign*n;
+    13f1:	89 f0                	mov    %esi,%eax
+    13f3:	0f af c3             	imul   %ebx,%eax
+}
+    13f6:	5b                   	pop    %ebx
+    13f7:	5e                   	pop    %esi
+    13f8:	5d                   	pop    %ebp
+    13f9:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+    13fa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    13ff:	83 c2 01             	add    $0x1,%edx
+    1402:	eb c9                	jmp    13cd <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+    1404:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1409:	eb e6                	jmp    13f1 <atoo+0x51>
+
+0000140b <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    140b:	55                   	push   %ebp
+    140c:	89 e5                	mov    %esp,%ebp
+    140e:	56                   	push   %esi
+    140f:	53                   	push   %ebx
+    1410:	8b 75 08             	mov    0x8(%ebp),%esi
+    1413:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1416:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1419:	85 db                	test   %ebx,%ebx
+    141b:	7e 15                	jle    1432 <memmove+0x27>
+    141d:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+    141f:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+    1421:	83 c2 01             	add    $0x1,%edx
+    1424:	83 c0 01             	add    $0x1,%eax
+    1427:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+    142b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+    142e:	39 c3                	cmp    %eax,%ebx
+    1430:	75 ef                	jne    1421 <memmove+0x16>
+  return vdst;
+}
+    1432:	89 f0                	mov    %esi,%eax
+    1434:	5b                   	pop    %ebx
+    1435:	5e                   	pop    %esi
+    1436:	5d                   	pop    %ebp
+    1437:	c3                   	ret
+
+00001438 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    1438:	b8 01 00 00 00       	mov    $0x1,%eax
+    143d:	cd 40                	int    $0x40
+    143f:	c3                   	ret
+
+00001440 <exit>:
+SYSCALL(exit)
+    1440:	b8 02 00 00 00       	mov    $0x2,%eax
+    1445:	cd 40                	int    $0x40
+    1447:	c3                   	ret
+
+00001448 <wait>:
+SYSCALL(wait)
+    1448:	b8 03 00 00 00       	mov    $0x3,%eax
+    144d:	cd 40                	int    $0x40
+    144f:	c3                   	ret
+
+00001450 <pipe>:
+SYSCALL(pipe)
+    1450:	b8 04 00 00 00       	mov    $0x4,%eax
+    1455:	cd 40                	int    $0x40
+    1457:	c3                   	ret
+
+00001458 <read>:
+SYSCALL(read)
+    1458:	b8 05 00 00 00       	mov    $0x5,%eax
+    145d:	cd 40                	int    $0x40
+    145f:	c3                   	ret
+
+00001460 <write>:
+SYSCALL(write)
+    1460:	b8 10 00 00 00       	mov    $0x10,%eax
+    1465:	cd 40                	int    $0x40
+    1467:	c3                   	ret
+
+00001468 <close>:
+SYSCALL(close)
+    1468:	b8 15 00 00 00       	mov    $0x15,%eax
+    146d:	cd 40                	int    $0x40
+    146f:	c3                   	ret
+
+00001470 <kill>:
+SYSCALL(kill)
+    1470:	b8 06 00 00 00       	mov    $0x6,%eax
+    1475:	cd 40                	int    $0x40
+    1477:	c3                   	ret
+
+00001478 <exec>:
+SYSCALL(exec)
+    1478:	b8 07 00 00 00       	mov    $0x7,%eax
+    147d:	cd 40                	int    $0x40
+    147f:	c3                   	ret
+
+00001480 <open>:
+SYSCALL(open)
+    1480:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1485:	cd 40                	int    $0x40
+    1487:	c3                   	ret
+
+00001488 <mknod>:
+SYSCALL(mknod)
+    1488:	b8 11 00 00 00       	mov    $0x11,%eax
+    148d:	cd 40                	int    $0x40
+    148f:	c3                   	ret
+
+00001490 <unlink>:
+SYSCALL(unlink)
+    1490:	b8 12 00 00 00       	mov    $0x12,%eax
+    1495:	cd 40                	int    $0x40
+    1497:	c3                   	ret
+
+00001498 <fstat>:
+SYSCALL(fstat)
+    1498:	b8 08 00 00 00       	mov    $0x8,%eax
+    149d:	cd 40                	int    $0x40
+    149f:	c3                   	ret
+
+000014a0 <link>:
+SYSCALL(link)
+    14a0:	b8 13 00 00 00       	mov    $0x13,%eax
+    14a5:	cd 40                	int    $0x40
+    14a7:	c3                   	ret
+
+000014a8 <mkdir>:
+SYSCALL(mkdir)
+    14a8:	b8 14 00 00 00       	mov    $0x14,%eax
+    14ad:	cd 40                	int    $0x40
+    14af:	c3                   	ret
+
+000014b0 <chdir>:
+SYSCALL(chdir)
+    14b0:	b8 09 00 00 00       	mov    $0x9,%eax
+    14b5:	cd 40                	int    $0x40
+    14b7:	c3                   	ret
+
+000014b8 <dup>:
+SYSCALL(dup)
+    14b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14bd:	cd 40                	int    $0x40
+    14bf:	c3                   	ret
+
+000014c0 <getpid>:
+SYSCALL(getpid)
+    14c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14c5:	cd 40                	int    $0x40
+    14c7:	c3                   	ret
+
+000014c8 <sbrk>:
+SYSCALL(sbrk)
+    14c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14cd:	cd 40                	int    $0x40
+    14cf:	c3                   	ret
+
+000014d0 <sleep>:
+SYSCALL(sleep)
+    14d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14d5:	cd 40                	int    $0x40
+    14d7:	c3                   	ret
+
+000014d8 <uptime>:
+SYSCALL(uptime)
+    14d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14dd:	cd 40                	int    $0x40
+    14df:	c3                   	ret
+
+000014e0 <halt>:
+SYSCALL(halt)
+    14e0:	b8 16 00 00 00       	mov    $0x16,%eax
+    14e5:	cd 40                	int    $0x40
+    14e7:	c3                   	ret
+
+000014e8 <date>:
+SYSCALL(date)
+    14e8:	b8 17 00 00 00       	mov    $0x17,%eax
+    14ed:	cd 40                	int    $0x40
+    14ef:	c3                   	ret
+
+000014f0 <getuid>:
+SYSCALL(getuid)
+    14f0:	b8 18 00 00 00       	mov    $0x18,%eax
+    14f5:	cd 40                	int    $0x40
+    14f7:	c3                   	ret
+
+000014f8 <getgid>:
+SYSCALL(getgid)
+    14f8:	b8 19 00 00 00       	mov    $0x19,%eax
+    14fd:	cd 40                	int    $0x40
+    14ff:	c3                   	ret
+
+00001500 <getppid>:
+SYSCALL(getppid)
+    1500:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1505:	cd 40                	int    $0x40
+    1507:	c3                   	ret
+
+00001508 <setuid>:
+SYSCALL(setuid)
+    1508:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    150d:	cd 40                	int    $0x40
+    150f:	c3                   	ret
+
+00001510 <setgid>:
+SYSCALL(setgid)
+    1510:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1515:	cd 40                	int    $0x40
+    1517:	c3                   	ret
+
+00001518 <getprocs>:
+SYSCALL(getprocs)
+    1518:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    151d:	cd 40                	int    $0x40
+    151f:	c3                   	ret
+
+00001520 <setpriority>:
+SYSCALL(setpriority)
+    1520:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1525:	cd 40                	int    $0x40
+    1527:	c3                   	ret
+
+00001528 <getpriority>:
+SYSCALL(getpriority)
+    1528:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    152d:	cd 40                	int    $0x40
+    152f:	c3                   	ret
+
+00001530 <waitpid>:
+SYSCALL(waitpid)
+    1530:	b8 20 00 00 00       	mov    $0x20,%eax
+    1535:	cd 40                	int    $0x40
+    1537:	c3                   	ret
+
+00001538 <setaffinity>:
+SYSCALL(setaffinity)
+    1538:	b8 21 00 00 00       	mov    $0x21,%eax
+    153d:	cd 40                	int    $0x40
+    153f:	c3                   	ret
+
+00001540 <getaffinity>:
+SYSCALL(getaffinity)
+    1540:	b8 22 00 00 00       	mov    $0x22,%eax
+    1545:	cd 40                	int    $0x40
+    1547:	c3                   	ret
+
+00001548 <setdeadline>:
+SYSCALL(setdeadline)
+    1548:	b8 23 00 00 00       	mov    $0x23,%eax
+    154d:	cd 40                	int    $0x40
+    154f:	c3                   	ret
+
+00001550 <schedctl>:
+SYSCALL(schedctl)
+    1550:	b8 24 00 00 00       	mov    $0x24,%eax
+    1555:	cd 40                	int    $0x40
+    1557:	c3                   	ret
+
+00001558 <spawn>:
+SYSCALL(spawn)
+    1558:	b8 25 00 00 00       	mov    $0x25,%eax
+    155d:	cd 40                	int    $0x40
+    155f:	c3                   	ret
+
+00001560 <vmstats>:
+SYSCALL(vmstats)
+    1560:	b8 26 00 00 00       	mov    $0x26,%eax
+    1565:	cd 40                	int    $0x40
+    1567:	c3                   	ret
+
+00001568 <hugesbrk>:
+SYSCALL(hugesbrk)
+    1568:	b8 27 00 00 00       	mov    $0x27,%eax
+    156d:	cd 40                	int    $0x40
+    156f:	c3                   	ret
+
+00001570 <setshares>:
+SYSCALL(setshares)
+    1570:	b8 28 00 00 00       	mov    $0x28,%eax
+    1575:	cd 40                	int    $0x40
+    1577:	c3                   	ret
+
+00001578 <getshares>:
+SYSCALL(getshares)
+    1578:	b8 29 00 00 00       	mov    $0x29,%eax
+    157d:	cd 40                	int    $0x40
+    157f:	c3                   	ret
+
+00001580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1580:	55                   	push   %ebp
+    1581:	89 e5                	mov    %esp,%ebp
+    1583:	57                   	push   %edi
+    1584:	56                   	push   %esi
+    1585:	53                   	push   %ebx
+    1586:	83 ec 3c             	sub    $0x3c,%esp
+    1589:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    158c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    158e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1592:	74 79                	je     160d <printint+0x8d>
+    1594:	85 d2                	test   %edx,%edx
+    1596:	79 75                	jns    160d <printint+0x8d>
+    neg = 1;
+    x = -xx;
+    1598:	89 d1                	mov    %edx,%ecx
+    159a:	f7 d9                	neg    %ecx
+    neg = 1;
+    159c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    15a8:	89 df                	mov    %ebx,%edi
+    15aa:	83 c3 01             	add    $0x1,%ebx
+    15ad:	89 c8                	mov    %ecx,%eax
+    15af:	ba 00 00 00 00       	mov    $0x0,%edx
+    15b4:	f7 f6                	div    %esi
+    15b6:	0f b6 92 fc 1a 00 00 	movzbl 0x1afc(%edx),%edx
+    15bd:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+    15c1:	89 ca                	mov    %ecx,%edx
+    15c3:	89 c1                	mov    %eax,%ecx
+    15c5:	39 f2                	cmp    %esi,%edx
+    15c7:	73 df                	jae    15a8 <printint+0x28>
+  if(neg)
+    15c9:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+    15cd:	74 08                	je     15d7 <printint+0x57>
+    buf[i++] = '-';
+    15cf:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    15d4:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+    15d7:	85 db                	test   %ebx,%ebx
+    15d9:	7e 2a                	jle    1605 <printint+0x85>
+    15db:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    15de:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+    15e2:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+    15e5:	0f b6 03             	movzbl (%ebx),%eax
+    15e8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    15eb:	83 ec 04             	sub    $0x4,%esp
+    15ee:	6a 01                	push   $0x1
+    15f0:	57                   	push   %edi
+    15f1:	ff 75 c4             	push   -0x3c(%ebp)
+    15f4:	e8 67 fe ff ff       	call   1460 <write>
+  while(--i >= 0)
+    15f9:	89 d8                	mov    %ebx,%eax
+    15fb:	83 eb 01             	sub    $0x1,%ebx
+    15fe:	83 c4 10             	add    $0x10,%esp
+    1601:	39 f0                	cmp    %esi,%eax
+    1603:	75 e0                	jne    15e5 <printint+0x65>
+}
+    1605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1608:	5b                   	pop    %ebx
+    1609:	5e                   	pop    %esi
+    160a:	5f                   	pop    %edi
+    160b:	5d                   	pop    %ebp
+    160c:	c3                   	ret
+    x = xx;
+    160d:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+    160f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+    1616:	eb 8b                	jmp    15a3 <printint+0x23>
+
+00001618 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1618:	55                   	push   %ebp
+    1619:	89 e5                	mov    %esp,%ebp
+    161b:	57                   	push   %edi
+    161c:	56                   	push   %esi
+    161d:	53                   	push   %ebx
+    161e:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1621:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1624:	0f b6 1e             	movzbl (%esi),%ebx
+    1627:	84 db                	test   %bl,%bl
+    1629:	0f 84 9e 01 00 00    	je     17cd <printf+0x1b5>
+    162f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    1632:	8d 45 10             	lea    0x10(%ebp),%eax
+    1635:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+    1638:	bf 00 00 00 00       	mov    $0x0,%edi
+    163d:	eb 2d                	jmp    166c <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    163f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    1642:	83 ec 04             	sub    $0x4,%esp
+    1645:	6a 01                	push   $0x1
+    1647:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    164a:	50                   	push   %eax
+    164b:	ff 75 08             	push   0x8(%ebp)
+    164e:	e8 0d fe ff ff       	call   1460 <write>
+        putc(fd, c);
+    1653:	83 c4 10             	add    $0x10,%esp
+    1656:	eb 05                	jmp    165d <printf+0x45>
+      }
+    } else if(state == '%'){
+    1658:	83 ff 25             	cmp    $0x25,%edi
+    165b:	74 1f                	je     167c <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+    165d:	83 c6 01             	add    $0x1,%esi
+    1660:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+    1664:	84 db                	test   %bl,%bl
+    1666:	0f 84 61 01 00 00    	je     17cd <printf+0x1b5>
+    c = fmt[i] & 0xff;
+    166c:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    166f:	85 ff                	test   %edi,%edi
+    1671:	75 e5                	jne    1658 <printf+0x40>
+      if(c == '%'){
+    1673:	83 f8 25             	cmp    $0x25,%eax
+    1676:	75 c7                	jne    163f <printf+0x27>
+        state = '%';
+    1678:	89 c7                	mov    %eax,%edi
+    167a:	eb e1                	jmp    165d <printf+0x45>
+      if(c == 'd'){
+    167c:	83 f8 25             	cmp    $0x25,%eax
+    167f:	0f 84 f4 00 00 00    	je     1779 <printf+0x161>
+    1685:	8d 50 9d             	lea    -0x63(%eax),%edx
+    1688:	83 fa 15             	cmp    $0x15,%edx
+    168b:	0f 87 09 01 00 00    	ja     179a <printf+0x182>
+    1691:	0f 87 03 01 00 00    	ja     179a <printf+0x182>
+    1697:	ff 24 95 a4 1a 00 00 	jmp    *0x1aa4(,%edx,4)
+        printint(fd, *ap, 10, 1);
+    169e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    16a1:	8b 17                	mov    (%edi),%edx
+    16a3:	83 ec 0c             	sub    $0xc,%esp
+    16a6:	6a 01                	push   $0x1
+    16a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    16ad:	8b 45 08             	mov    0x8(%ebp),%eax
+    16b0:	e8 cb fe ff ff       	call   1580 <printint>
+        ap++;
+    16b5:	83 c7 04             	add    $0x4,%edi
+    16b8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    16bb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    16be:	bf 00 00 00 00       	mov    $0x0,%edi
+    16c3:	eb 98                	jmp    165d <printf+0x45>
+        printint(fd, *ap, 16, 0);
+    16c5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    16c8:	8b 17                	mov    (%edi),%edx
+    16ca:	83 ec 0c             	sub    $0xc,%esp
+    16cd:	6a 00                	push   $0x0
+    16cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    16d4:	8b 45 08             	mov    0x8(%ebp),%eax
+    16d7:	e8 a4 fe ff ff       	call   1580 <printint>
+        ap++;
+    16dc:	83 c7 04             	add    $0x4,%edi
+    16df:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    16e2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    16e5:	bf 00 00 00 00       	mov    $0x0,%edi
+    16ea:	e9 6e ff ff ff       	jmp    165d <printf+0x45>
+        s = (char*)*ap;
+    16ef:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    16f2:	8b 01                	mov    (%ecx),%eax
+        ap++;
+    16f4:	83 c1 04             	add    $0x4,%ecx
+    16f7:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+    16fa:	85 c0                	test   %eax,%eax
+    16fc:	74 13                	je     1711 <printf+0xf9>
+        s = (char*)*ap;
+    16fe:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+    1700:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+    1703:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+    1708:	84 c0                	test   %al,%al
+    170a:	75 0f                	jne    171b <printf+0x103>
+    170c:	e9 4c ff ff ff       	jmp    165d <printf+0x45>
+          s = "(null)";
+    1711:	bb 9c 1a 00 00       	mov    $0x1a9c,%ebx
+        while(*s != 0){
+    1716:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+    171b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    171e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    1721:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+    1724:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1727:	83 ec 04             	sub    $0x4,%esp
+    172a:	6a 01                	push   $0x1
+    172c:	57                   	push   %edi
+    172d:	56                   	push   %esi
+    172e:	e8 2d fd ff ff       	call   1460 <write>
+          s++;
+    1733:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    1736:	0f b6 03             	movzbl (%ebx),%eax
+    1739:	83 c4 10             	add    $0x10,%esp
+    173c:	84 c0                	test   %al,%al
+    173e:	75 e4                	jne    1724 <printf+0x10c>
+      state = 0;
+    1740:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1743:	bf 00 00 00 00       	mov    $0x0,%edi
+    1748:	e9 10 ff ff ff       	jmp    165d <printf+0x45>
+        putc(fd, *ap);
+    174d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1750:	8b 07                	mov    (%edi),%eax
+    1752:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1755:	83 ec 04             	sub    $0x4,%esp
+    1758:	6a 01                	push   $0x1
+    175a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    175d:	50                   	push   %eax
+    175e:	ff 75 08             	push   0x8(%ebp)
+    1761:	e8 fa fc ff ff       	call   1460 <write>
+        ap++;
+    1766:	83 c7 04             	add    $0x4,%edi
+    1769:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    176c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    176f:	bf 00 00 00 00       	mov    $0x0,%edi
+    1774:	e9 e4 fe ff ff       	jmp    165d <printf+0x45>
+        putc(fd, c);
+    1779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    177c:	83 ec 04             	sub    $0x4,%esp
+    177f:	6a 01                	push   $0x1
+    1781:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1784:	50                   	push   %eax
+    1785:	ff 75 08             	push   0x8(%ebp)
+    1788:	e8 d3 fc ff ff       	call   1460 <write>
+    178d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1790:	bf 00 00 00 00       	mov    $0x0,%edi
+    1795:	e9 c3 fe ff ff       	jmp    165d <printf+0x45>
+        putc(fd, '%');
+    179a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    179e:	83 ec 04             	sub    $0x4,%esp
+    17a1:	6a 01                	push   $0x1
+    17a3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    17a6:	57                   	push   %edi
+    17a7:	ff 75 08             	push   0x8(%ebp)
+    17aa:	e8 b1 fc ff ff       	call   1460 <write>
+        putc(fd, c);
+    17af:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    17b2:	83 c4 0c             	add    $0xc,%esp
+    17b5:	6a 01                	push   $0x1
+    17b7:	57                   	push   %edi
+    17b8:	ff 75 08             	push   0x8(%ebp)
+    17bb:	e8 a0 fc ff ff       	call   1460 <write>
+        putc(fd, c);
+    17c0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17c3:	bf 00 00 00 00       	mov    $0x0,%edi
+    17c8:	e9 90 fe ff ff       	jmp    165d <printf+0x45>
+    }
+  }
+}
+    17cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17d0:	5b                   	pop    %ebx
+    17d1:	5e                   	pop    %esi
+    17d2:	5f                   	pop    %edi
+    17d3:	5d                   	pop    %ebp
+    17d4:	c3                   	ret
+
+000017d5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    17d5:	55                   	push   %ebp
+    17d6:	89 e5                	mov    %esp,%ebp
+    17d8:	57                   	push   %edi
+    17d9:	56                   	push   %esi
+    17da:	53                   	push   %ebx
+    17db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    17de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17e1:	a1 a4 22 00 00       	mov    0x22a4,%eax
+    17e6:	eb 0c                	jmp    17f4 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17e8:	8b 10                	mov    (%eax),%edx
+    17ea:	39 d0                	cmp    %edx,%eax
+    17ec:	72 04                	jb     17f2 <free+0x1d>
+    17ee:	39 d1                	cmp    %edx,%ecx
+    17f0:	72 10                	jb     1802 <free+0x2d>
+{
+    17f2:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17f4:	39 c8                	cmp    %ecx,%eax
+    17f6:	73 f0                	jae    17e8 <free+0x13>
+    17f8:	8b 10                	mov    (%eax),%edx
+    17fa:	39 d1                	cmp    %edx,%ecx
+    17fc:	72 04                	jb     1802 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17fe:	39 d0                	cmp    %edx,%eax
+    1800:	72 f0                	jb     17f2 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1802:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    1805:	8b 10                	mov    (%eax),%edx
+    1807:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    180a:	39 fa                	cmp    %edi,%edx
+    180c:	74 19                	je     1827 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    180e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1811:	8b 50 04             	mov    0x4(%eax),%edx
+    1814:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    1817:	39 f1                	cmp    %esi,%ecx
+    1819:	74 18                	je     1833 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    181b:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    181d:	a3 a4 22 00 00       	mov    %eax,0x22a4
+}
+    1822:	5b                   	pop    %ebx
+    1823:	5e                   	pop    %esi
+    1824:	5f                   	pop    %edi
+    1825:	5d                   	pop    %ebp
+    1826:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    1827:	03 72 04             	add    0x4(%edx),%esi
+    182a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    182d:	8b 10                	mov    (%eax),%edx
+    182f:	8b 12                	mov    (%edx),%edx
+    1831:	eb db                	jmp    180e <free+0x39>
+    p->s.size += bp->s.size;
+    1833:	03 53 fc             	add    -0x4(%ebx),%edx
+    1836:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1839:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    183c:	eb dd                	jmp    181b <free+0x46>
+
+0000183e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    183e:	55                   	push   %ebp
+    183f:	89 e5                	mov    %esp,%ebp
+    1841:	57                   	push   %edi
+    1842:	56                   	push   %esi
+    1843:	53                   	push   %ebx
+    1844:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1847:	8b 45 08             	mov    0x8(%ebp),%eax
+    184a:	8d 58 07             	lea    0x7(%eax),%ebx
+    184d:	c1 eb 03             	shr    $0x3,%ebx
+    1850:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    1853:	8b 15 a4 22 00 00    	mov    0x22a4,%edx
+    1859:	85 d2                	test   %edx,%edx
+    185b:	74 1c                	je     1879 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    185d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    185f:	8b 48 04             	mov    0x4(%eax),%ecx
+    1862:	39 d9                	cmp    %ebx,%ecx
+    1864:	73 38                	jae    189e <malloc+0x60>
+  if(nu < 4096)
+    1866:	be 00 10 00 00       	mov    $0x1000,%esi
+    186b:	39 f3                	cmp    %esi,%ebx
+    186d:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    1870:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    1877:	eb 72                	jmp    18eb <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    1879:	c7 05 a4 22 00 00 a8 	movl   $0x22a8,0x22a4
+    1880:	22 00 00 
+    1883:	c7 05 a8 22 00 00 a8 	movl   $0x22a8,0x22a8
+    188a:	22 00 00 
+    base.s.size = 0;
+    188d:	c7 05 ac 22 00 00 00 	movl   $0x0,0x22ac
+    1894:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1897:	b8 a8 22 00 00       	mov    $0x22a8,%eax
+    if(p->s.size >= nunits){
+    189c:	eb c8                	jmp    1866 <malloc+0x28>
+      if(p->s.size == nunits)
+    189e:	39 cb                	cmp    %ecx,%ebx
+    18a0:	74 1e                	je     18c0 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    18a2:	29 d9                	sub    %ebx,%ecx
+    18a4:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18a7:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18aa:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    18ad:	89 15 a4 22 00 00    	mov    %edx,0x22a4
+      return (void*)(p + 1);
+    18b3:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    18b6:	89 d0                	mov    %edx,%eax
+    18b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18bb:	5b                   	pop    %ebx
+    18bc:	5e                   	pop    %esi
+    18bd:	5f                   	pop    %edi
+    18be:	5d                   	pop    %ebp
+    18bf:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    18c0:	8b 08                	mov    (%eax),%ecx
+    18c2:	89 0a                	mov    %ecx,(%edx)
+    18c4:	eb e7                	jmp    18ad <malloc+0x6f>
+  hp->s.size = nu;
+    18c6:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    18c9:	83 ec 0c             	sub    $0xc,%esp
+    18cc:	83 c0 08             	add    $0x8,%eax
+    18cf:	50                   	push   %eax
+    18d0:	e8 00 ff ff ff       	call   17d5 <free>
+  return freep;
+    18d5:	8b 15 a4 22 00 00    	mov    0x22a4,%edx
+      if((p = morecore(nunits)) == 0)
+    18db:	83 c4 10             	add    $0x10,%esp
+    18de:	85 d2                	test   %edx,%edx
+    18e0:	74 d4                	je     18b6 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18e2:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    18e4:	8b 48 04             	mov    0x4(%eax),%ecx
+    18e7:	39 d9                	cmp    %ebx,%ecx
+    18e9:	73 b3                	jae    189e <malloc+0x60>
+    if(p == freep)
+    18eb:	89 c2                	mov    %eax,%edx
+    18ed:	39 05 a4 22 00 00    	cmp    %eax,0x22a4
+    18f3:	75 ed                	jne    18e2 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    18f5:	83 ec 0c             	sub    $0xc,%esp
+    18f8:	57                   	push   %edi
+    18f9:	e8 ca fb ff ff       	call   14c8 <sbrk>
+  if(p == (char*)-1)
+    18fe:	83 c4 10             	add    $0x10,%esp
+    1901:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1904:	75 c0                	jne    18c6 <malloc+0x88>
+        return 0;
+    1906:	ba 00 00 00 00       	mov    $0x0,%edx
+    190b:	eb a9                	jmp    18b6 <malloc+0x78>
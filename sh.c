@@ -4,6 +4,9 @@
 #include "types.h"
 #include "user.h"
 #include "fcntl.h"
+#ifdef CS333_P4
+#include "spawn.h"
+#endif // CS333_P4
 
 // Parsed command representation
 #define EXEC  1
@@ -52,6 +55,7 @@ struct backcmd {
 
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
+void parsefail(char*);
 struct cmd *parsecmd(char*);
 
 // Execute cmd.  Never returns.
@@ -131,6 +135,176 @@ runcmd(struct cmd *cmd)
   exit();
 }
 
+#ifdef CS333_P4
+// Start cmd's programs with spawn(), so running a command does not
+// copy the shell.  fa holds the n fd actions of the enclosing
+// redirections and pipes.  The pids started are added to pids[],
+// for the caller to wait for.  Background commands still fork, so
+// that what they start is not the shell's to wait for.
+#define MAXPIDS 16
+
+void spawncmd(struct cmd*, struct spawnfd*, int, int*, int*);
+
+// Do the n fd actions in fa in this process.
+void
+applyfa(struct spawnfd *fa, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(fa[i].op == SPAWN_CLOSE)
+      close(fa[i].fd);
+    else if(fa[i].op == SPAWN_DUP2 && fa[i].fd != fa[i].newfd){
+      close(fa[i].newfd);
+      if(dup(fa[i].fd) != fa[i].newfd)
+        panic("dup");
+    }
+  }
+}
+
+// Start one side of a pipe.  Execs and pipes, perhaps redirected,
+// only start processes, so spawncmd() handles them.  A list or a
+// background command would make the shell wait before the other
+// side has started, so it gets a forked child that runs it with
+// runcmd() alongside.
+void
+spawnside(struct cmd *cmd, struct spawnfd *fa, int n, int *pids, int *npids)
+{
+  struct cmd *c;
+  int pid;
+
+  for(c = cmd; c && c->type == REDIR; c = ((struct redircmd*)c)->cmd)
+    ;
+  if(c == 0 || (c->type != LIST && c->type != BACK)){
+    spawncmd(cmd, fa, n, pids, npids);
+    return;
+  }
+  if(*npids == MAXPIDS){
+    printf(2, "too many processes\n");
+    return;
+  }
+  if((pid = fork1()) == 0){
+    applyfa(fa, n);
+    runcmd(cmd);
+  }
+  pids[(*npids)++] = pid;
+}
+
+void
+spawncmd(struct cmd *cmd, struct spawnfd *fa, int n, int *pids, int *npids)
+{
+  int p[2], fd, i, pid;
+  struct spawnfd pfa[SPAWN_MAXFD];
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    return;
+
+  switch(cmd->type){
+  default:
+    panic("spawncmd");
+
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    if(ecmd->argv[0] == 0)
+      return;
+    fa[n].op = SPAWN_END;
+    if(*npids == MAXPIDS || (pid = spawn(ecmd->argv[0], ecmd->argv, fa)) < 0){
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+      return;
+    }
+    pids[(*npids)++] = pid;
+    break;
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    if((fd = open(rcmd->file, rcmd->mode)) < 0){
+      printf(2, "open %s failed\n", rcmd->file);
+      return;
+    }
+    if(n + 2 >= SPAWN_MAXFD){
+      printf(2, "too many redirections\n");
+      close(fd);
+      return;
+    }
+    fa[n].op = SPAWN_DUP2;
+    fa[n].fd = fd;
+    fa[n].newfd = rcmd->fd;
+    fa[n+1].op = SPAWN_CLOSE;
+    fa[n+1].fd = fd;
+    spawncmd(rcmd->cmd, fa, n + 2, pids, npids);
+    close(fd);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    i = *npids;
+    spawncmd(lcmd->left, fa, n, pids, npids);
+    while(*npids > i)
+      waitpid(pids[--*npids]);
+    spawncmd(lcmd->right, fa, n, pids, npids);
+    break;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    if(n + 4 >= SPAWN_MAXFD || pipe(p) < 0){
+      printf(2, "pipe failed\n");
+      return;
+    }
+    memmove(pfa, fa, n*sizeof(fa[0]));
+    pfa[n].op = SPAWN_DUP2;
+    pfa[n].fd = p[1];
+    pfa[n].newfd = 1;
+    pfa[n+1].op = SPAWN_CLOSE;
+    pfa[n+1].fd = p[0];
+    pfa[n+2].op = SPAWN_CLOSE;
+    pfa[n+2].fd = p[1];
+    spawnside(pcmd->left, pfa, n + 3, pids, npids);
+    pfa[n].fd = p[0];
+    pfa[n].newfd = 0;
+    spawnside(pcmd->right, pfa, n + 3, pids, npids);
+    close(p[0]);
+    close(p[1]);
+    break;
+
+  case BACK:
+    // runcmd() starts the command in a grandchild and returns at once.
+    if((pid = fork1()) == 0)
+      runcmd(cmd);
+    waitpid(pid);
+    break;
+  }
+}
+
+// Free a command parsed by parsecmd().
+void
+freecmd(struct cmd *cmd)
+{
+  if(cmd == 0)
+    return;
+  switch(cmd->type){
+  case REDIR:
+    freecmd(((struct redircmd*)cmd)->cmd);
+    break;
+  case PIPE:
+    freecmd(((struct pipecmd*)cmd)->left);
+    freecmd(((struct pipecmd*)cmd)->right);
+    break;
+  case LIST:
+    freecmd(((struct listcmd*)cmd)->left);
+    freecmd(((struct listcmd*)cmd)->right);
+    break;
+  case BACK:
+    freecmd(((struct backcmd*)cmd)->cmd);
+    break;
+  }
+  free(cmd);
+}
+#endif // CS333_P4
+
 int
 getcmd(char *buf, int nbuf)
 {
@@ -229,6 +403,11 @@ main(void)
 {
   static char buf[100];
   int fd;
+#ifdef CS333_P4
+  struct cmd *cmd;
+  struct spawnfd fa[SPAWN_MAXFD];
+  int pids[MAXPIDS], npids;
+#endif // CS333_P4
 
   // Assumes three file descriptors open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -255,9 +434,21 @@ main(void)
       continue;
     }
 #endif
+#ifdef CS333_P4
+    // Parsing and running the command in the shell saves copying
+    // the shell for every command.
+    if((cmd = parsecmd(buf)) == 0)
+      continue;
+    npids = 0;
+    spawncmd(cmd, fa, 0, pids, &npids);
+    while(npids > 0)
+      waitpid(pids[--npids]);
+    freecmd(cmd);
+#else
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
+#endif // CS333_P4
   }
   exit();
 }
@@ -269,6 +460,25 @@ panic(char *s)
   exit();
 }
 
+#ifdef CS333_P4
+// The shell parses commands itself, so a syntax error must not end
+// it; parsecmd() returns 0 instead.
+int parseerr;
+
+void
+parsefail(char *s)
+{
+  printf(2, "%s\n", s);
+  parseerr = 1;
+}
+#else
+void
+parsefail(char *s)
+{
+  panic(s);
+}
+#endif // CS333_P4
+
 int
 fork1(void)
 {
@@ -422,12 +632,21 @@ parsecmd(char *s)
   struct cmd *cmd;
 
   es = s + strlen(s);
+#ifdef CS333_P4
+  parseerr = 0;
+#endif // CS333_P4
   cmd = parseline(&s, es);
   peek(&s, es, "");
   if(s != es){
     printf(2, "leftovers: %s\n", s);
-    panic("syntax");
+    parsefail("syntax");
   }
+#ifdef CS333_P4
+  if(parseerr){
+    freecmd(cmd);
+    return 0;
+  }
+#endif // CS333_P4
   nulterminate(cmd);
   return cmd;
 }
@@ -470,8 +689,10 @@ parseredirs(struct cmd *cmd, char **ps, char *es)
 
   while(peek(ps, es, "<>")){
     tok = gettoken(ps, es, 0, 0);
-    if(gettoken(ps, es, &q, &eq) != 'a')
-      panic("missing file for redirection");
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+      parsefail("missing file for redirection");
+      break;
+    }
     switch(tok){
     case '<':
       cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
@@ -493,11 +714,13 @@ parseblock(char **ps, char *es)
   struct cmd *cmd;
 
   if(!peek(ps, es, "("))
-    panic("parseblock");
+    panic("parseblock");  // parseexec() checked
   gettoken(ps, es, 0, 0);
   cmd = parseline(ps, es);
-  if(!peek(ps, es, ")"))
-    panic("syntax - missing )");
+  if(!peek(ps, es, ")")){
+    parsefail("syntax - missing )");
+    return cmd;
+  }
   gettoken(ps, es, 0, 0);
   cmd = parseredirs(cmd, ps, es);
   return cmd;
@@ -522,13 +745,18 @@ parseexec(char **ps, char *es)
   while(!peek(ps, es, "|)&;")){
     if((tok=gettoken(ps, es, &q, &eq)) == 0)
       break;
-    if(tok != 'a')
-      panic("syntax");
+    if(tok != 'a'){
+      parsefail("syntax");
+      break;
+    }
     cmd->argv[argc] = q;
     cmd->eargv[argc] = eq;
     argc++;
-    if(argc >= MAXARGS)
-      panic("too many args");
+    if(argc >= MAXARGS){
+      parsefail("too many args");
+      argc--;
+      break;
+    }
     ret = parseredirs(ret, ps, es);
   }
   cmd->argv[argc] = 0;
@@ -0,0 +1,15 @@
+#ifdef CS333_P4
+// File descriptor actions for spawn(), applied in order to the
+// child's copy of the parent's open files.  A SPAWN_END entry, or
+// SPAWN_MAXFD entries, end the list.
+#define SPAWN_END   0
+#define SPAWN_DUP2  1  // Child's newfd becomes a copy of its fd
+#define SPAWN_CLOSE 2  // Child's fd is closed
+#define SPAWN_MAXFD 16
+
+struct spawnfd {
+  int op;
+  int fd;
+  int newfd;
+};
+#endif // CS333_P4
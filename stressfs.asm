@@ -0,0 +1,1316 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  17:	c7 45 de 73 74 72 65 	movl   $0x65727473,-0x22(%ebp)
+  1e:	c7 45 e2 73 73 66 73 	movl   $0x73667373,-0x1e(%ebp)
+  25:	66 c7 45 e6 30 00    	movw   $0x30,-0x1a(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  2b:	68 44 08 00 00       	push   $0x844
+  30:	6a 01                	push   $0x1
+  32:	e8 15 05 00 00       	call   54c <printf>
+  memset(data, 'a', sizeof(data));
+  37:	83 c4 0c             	add    $0xc,%esp
+  3a:	68 00 02 00 00       	push   $0x200
+  3f:	6a 61                	push   $0x61
+  41:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  47:	50                   	push   %eax
+  48:	e8 39 01 00 00       	call   186 <memset>
+  4d:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  50:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(fork() > 0)
+  55:	e8 12 03 00 00       	call   36c <fork>
+  5a:	85 c0                	test   %eax,%eax
+  5c:	7f 08                	jg     66 <main+0x66>
+  for(i = 0; i < 4; i++)
+  5e:	83 c3 01             	add    $0x1,%ebx
+  61:	83 fb 04             	cmp    $0x4,%ebx
+  64:	75 ef                	jne    55 <main+0x55>
+      break;
+
+  printf(1, "write %d\n", i);
+  66:	83 ec 04             	sub    $0x4,%esp
+  69:	53                   	push   %ebx
+  6a:	68 57 08 00 00       	push   $0x857
+  6f:	6a 01                	push   $0x1
+  71:	e8 d6 04 00 00       	call   54c <printf>
+
+  path[8] += i;
+  76:	00 5d e6             	add    %bl,-0x1a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  79:	83 c4 08             	add    $0x8,%esp
+  7c:	68 02 02 00 00       	push   $0x202
+  81:	8d 45 de             	lea    -0x22(%ebp),%eax
+  84:	50                   	push   %eax
+  85:	e8 2a 03 00 00       	call   3b4 <open>
+  8a:	89 c6                	mov    %eax,%esi
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	bb 14 00 00 00       	mov    $0x14,%ebx
+  for(i = 0; i < 20; i++)
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  94:	8d bd de fd ff ff    	lea    -0x222(%ebp),%edi
+  9a:	83 ec 04             	sub    $0x4,%esp
+  9d:	68 00 02 00 00       	push   $0x200
+  a2:	57                   	push   %edi
+  a3:	56                   	push   %esi
+  a4:	e8 eb 02 00 00       	call   394 <write>
+  for(i = 0; i < 20; i++)
+  a9:	83 c4 10             	add    $0x10,%esp
+  ac:	83 eb 01             	sub    $0x1,%ebx
+  af:	75 e9                	jne    9a <main+0x9a>
+  close(fd);
+  b1:	83 ec 0c             	sub    $0xc,%esp
+  b4:	56                   	push   %esi
+  b5:	e8 e2 02 00 00       	call   39c <close>
+
+  printf(1, "read\n");
+  ba:	83 c4 08             	add    $0x8,%esp
+  bd:	68 61 08 00 00       	push   $0x861
+  c2:	6a 01                	push   $0x1
+  c4:	e8 83 04 00 00       	call   54c <printf>
+
+  fd = open(path, O_RDONLY);
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	6a 00                	push   $0x0
+  ce:	8d 45 de             	lea    -0x22(%ebp),%eax
+  d1:	50                   	push   %eax
+  d2:	e8 dd 02 00 00       	call   3b4 <open>
+  d7:	89 c6                	mov    %eax,%esi
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	bb 14 00 00 00       	mov    $0x14,%ebx
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  e1:	8d bd de fd ff ff    	lea    -0x222(%ebp),%edi
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	68 00 02 00 00       	push   $0x200
+  ef:	57                   	push   %edi
+  f0:	56                   	push   %esi
+  f1:	e8 96 02 00 00       	call   38c <read>
+  for (i = 0; i < 20; i++)
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	83 eb 01             	sub    $0x1,%ebx
+  fc:	75 e9                	jne    e7 <main+0xe7>
+  close(fd);
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	56                   	push   %esi
+ 102:	e8 95 02 00 00       	call   39c <close>
+
+  wait();
+ 107:	e8 70 02 00 00       	call   37c <wait>
+
+  exit();
+ 10c:	e8 63 02 00 00       	call   374 <exit>
+
+00000111 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 111:	55                   	push   %ebp
+ 112:	89 e5                	mov    %esp,%ebp
+ 114:	53                   	push   %ebx
+ 115:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 118:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 11b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0xf>
+    ;
+  return os;
+}
+ 12e:	89 c8                	mov    %ecx,%eax
+ 130:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 13e:	0f b6 01             	movzbl (%ecx),%eax
+ 141:	84 c0                	test   %al,%al
+ 143:	74 11                	je     156 <strcmp+0x21>
+ 145:	38 02                	cmp    %al,(%edx)
+ 147:	75 0d                	jne    156 <strcmp+0x21>
+    p++, q++;
+ 149:	83 c1 01             	add    $0x1,%ecx
+ 14c:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 14f:	0f b6 01             	movzbl (%ecx),%eax
+ 152:	84 c0                	test   %al,%al
+ 154:	75 ef                	jne    145 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 156:	0f b6 c0             	movzbl %al,%eax
+ 159:	0f b6 12             	movzbl (%edx),%edx
+ 15c:	29 d0                	sub    %edx,%eax
+}
+ 15e:	5d                   	pop    %ebp
+ 15f:	c3                   	ret
+
+00000160 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 166:	80 3a 00             	cmpb   $0x0,(%edx)
+ 169:	74 14                	je     17f <strlen+0x1f>
+ 16b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 170:	83 c0 01             	add    $0x1,%eax
+ 173:	89 c1                	mov    %eax,%ecx
+ 175:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 179:	75 f5                	jne    170 <strlen+0x10>
+    ;
+  return n;
+}
+ 17b:	89 c8                	mov    %ecx,%eax
+ 17d:	5d                   	pop    %ebp
+ 17e:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 17f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 184:	eb f5                	jmp    17b <strlen+0x1b>
+
+00000186 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 186:	55                   	push   %ebp
+ 187:	89 e5                	mov    %esp,%ebp
+ 189:	57                   	push   %edi
+ 18a:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 192:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 195:	fc                   	cld
+ 196:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 198:	89 d0                	mov    %edx,%eax
+ 19a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 19d:	c9                   	leave
+ 19e:	c3                   	ret
+
+0000019f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 19f:	55                   	push   %ebp
+ 1a0:	89 e5                	mov    %esp,%ebp
+ 1a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1a9:	0f b6 10             	movzbl (%eax),%edx
+ 1ac:	84 d2                	test   %dl,%dl
+ 1ae:	74 15                	je     1c5 <strchr+0x26>
+    if(*s == c)
+ 1b0:	38 d1                	cmp    %dl,%cl
+ 1b2:	74 0f                	je     1c3 <strchr+0x24>
+  for(; *s; s++)
+ 1b4:	83 c0 01             	add    $0x1,%eax
+ 1b7:	0f b6 10             	movzbl (%eax),%edx
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1c3:	5d                   	pop    %ebp
+ 1c4:	c3                   	ret
+  return 0;
+ 1c5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1ca:	eb f7                	jmp    1c3 <strchr+0x24>
+
+000001cc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1cc:	55                   	push   %ebp
+ 1cd:	89 e5                	mov    %esp,%ebp
+ 1cf:	57                   	push   %edi
+ 1d0:	56                   	push   %esi
+ 1d1:	53                   	push   %ebx
+ 1d2:	83 ec 2c             	sub    $0x2c,%esp
+ 1d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1dd:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1e0:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1e3:	83 c3 01             	add    $0x1,%ebx
+ 1e6:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1e9:	7d 27                	jge    212 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1eb:	83 ec 04             	sub    $0x4,%esp
+ 1ee:	6a 01                	push   $0x1
+ 1f0:	57                   	push   %edi
+ 1f1:	6a 00                	push   $0x0
+ 1f3:	e8 94 01 00 00       	call   38c <read>
+    if(cc < 1)
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	85 c0                	test   %eax,%eax
+ 1fd:	7e 13                	jle    212 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1ff:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 203:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 207:	3c 0a                	cmp    $0xa,%al
+ 209:	74 04                	je     20f <gets+0x43>
+ 20b:	3c 0d                	cmp    $0xd,%al
+ 20d:	75 d1                	jne    1e0 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 20f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 212:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 215:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 219:	89 f0                	mov    %esi,%eax
+ 21b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 21e:	5b                   	pop    %ebx
+ 21f:	5e                   	pop    %esi
+ 220:	5f                   	pop    %edi
+ 221:	5d                   	pop    %ebp
+ 222:	c3                   	ret
+
+00000223 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 223:	55                   	push   %ebp
+ 224:	89 e5                	mov    %esp,%ebp
+ 226:	56                   	push   %esi
+ 227:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 228:	83 ec 08             	sub    $0x8,%esp
+ 22b:	6a 00                	push   $0x0
+ 22d:	ff 75 08             	push   0x8(%ebp)
+ 230:	e8 7f 01 00 00       	call   3b4 <open>
+  if(fd < 0)
+ 235:	83 c4 10             	add    $0x10,%esp
+ 238:	85 c0                	test   %eax,%eax
+ 23a:	78 24                	js     260 <stat+0x3d>
+ 23c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 23e:	83 ec 08             	sub    $0x8,%esp
+ 241:	ff 75 0c             	push   0xc(%ebp)
+ 244:	50                   	push   %eax
+ 245:	e8 82 01 00 00       	call   3cc <fstat>
+ 24a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 24c:	89 1c 24             	mov    %ebx,(%esp)
+ 24f:	e8 48 01 00 00       	call   39c <close>
+  return r;
+ 254:	83 c4 10             	add    $0x10,%esp
+}
+ 257:	89 f0                	mov    %esi,%eax
+ 259:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 25c:	5b                   	pop    %ebx
+ 25d:	5e                   	pop    %esi
+ 25e:	5d                   	pop    %ebp
+ 25f:	c3                   	ret
+    return -1;
+ 260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 265:	eb f0                	jmp    257 <stat+0x34>
+
+00000267 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 267:	55                   	push   %ebp
+ 268:	89 e5                	mov    %esp,%ebp
+ 26a:	56                   	push   %esi
+ 26b:	53                   	push   %ebx
+ 26c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 26f:	0f b6 0a             	movzbl (%edx),%ecx
+ 272:	80 f9 20             	cmp    $0x20,%cl
+ 275:	75 0b                	jne    282 <atoi+0x1b>
+ 277:	83 c2 01             	add    $0x1,%edx
+ 27a:	0f b6 0a             	movzbl (%edx),%ecx
+ 27d:	80 f9 20             	cmp    $0x20,%cl
+ 280:	74 f5                	je     277 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 282:	80 f9 2d             	cmp    $0x2d,%cl
+ 285:	74 3c                	je     2c3 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 287:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 28a:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 28f:	f6 c1 fd             	test   $0xfd,%cl
+ 292:	74 34                	je     2c8 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 294:	0f b6 0a             	movzbl (%edx),%ecx
+ 297:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 29a:	3c 09                	cmp    $0x9,%al
+ 29c:	77 2f                	ja     2cd <atoi+0x66>
+ 29e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 2a3:	83 c2 01             	add    $0x1,%edx
+ 2a6:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 2a9:	0f be c9             	movsbl %cl,%ecx
+ 2ac:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 2b0:	0f b6 0a             	movzbl (%edx),%ecx
+ 2b3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2b6:	3c 09                	cmp    $0x9,%al
+ 2b8:	76 e9                	jbe    2a3 <atoi+0x3c>
+  return sign*n;
+ 2ba:	89 f0                	mov    %esi,%eax
+ 2bc:	0f af c3             	imul   %ebx,%eax
+}
+ 2bf:	5b                   	pop    %ebx
+ 2c0:	5e                   	pop    %esi
+ 2c1:	5d                   	pop    %ebp
+ 2c2:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 2c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2c8:	83 c2 01             	add    $0x1,%edx
+ 2cb:	eb c7                	jmp    294 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 2cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2d2:	eb e6                	jmp    2ba <atoi+0x53>
+
+000002d4 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2d4:	55                   	push   %ebp
+ 2d5:	89 e5                	mov    %esp,%ebp
+ 2d7:	56                   	push   %esi
+ 2d8:	53                   	push   %ebx
+ 2d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2dc:	0f b6 0a             	movzbl (%edx),%ecx
+ 2df:	80 f9 20             	cmp    $0x20,%cl
+ 2e2:	75 0b                	jne    2ef <atoo+0x1b>
+ 2e4:	83 c2 01             	add    $0x1,%edx
+ 2e7:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ea:	80 f9 20             	cmp    $0x20,%cl
+ 2ed:	74 f5                	je     2e4 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2ef:	80 f9 2d             	cmp    $0x2d,%cl
+ 2f2:	74 3a                	je     32e <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 2f4:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2f7:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2fc:	f6 c1 fd             	test   $0xfd,%cl
+ 2ff:	74 32                	je     333 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 301:	0f b6 0a             	movzbl (%edx),%ecx
+ 304:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 307:	80 fb 07             	cmp    $0x7,%bl
+ 30a:	77 2c                	ja     338 <atoo+0x64>
+ 30c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 311:	83 c2 01             	add    $0x1,%edx
+ 314:	0f be c9             	movsbl %cl,%ecx
+ 317:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 31b:	0f b6 0a             	movzbl (%edx),%ecx
+ 31e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 321:	3c 07                	cmp    $0x7,%al
+ 323:	76 ec                	jbe    311 <atoo+0x3d>
+  return sign*n;
+ 325:	89 f0                	mov    %esi,%eax
+ 327:	0f af c3             	imul   %ebx,%eax
+}
+ 32a:	5b                   	pop    %ebx
+ 32b:	5e                   	pop    %esi
+ 32c:	5d                   	pop    %ebp
+ 32d:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 32e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 333:	83 c2 01             	add    $0x1,%edx
+ 336:	eb c9                	jmp    301 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 338:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 33d:	eb e6                	jmp    325 <atoo+0x51>
+
+0000033f <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 33f:	55                   	push   %ebp
+ 340:	89 e5                	mov    %esp,%ebp
+ 342:	56                   	push   %esi
+ 343:	53                   	push   %ebx
+ 344:	8b 75 08             	mov    0x8(%ebp),%esi
+ 347:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 34a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 34d:	85 db                	test   %ebx,%ebx
+ 34f:	7e 15                	jle    366 <memmove+0x27>
+ 351:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 353:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 355:	83 c2 01             	add    $0x1,%edx
+ 358:	83 c0 01             	add    $0x1,%eax
+ 35b:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 35f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 362:	39 c3                	cmp    %eax,%ebx
+ 364:	75 ef                	jne    355 <memmove+0x16>
+  return vdst;
+}
+ 366:	89 f0                	mov    %esi,%eax
+ 368:	5b                   	pop    %ebx
+ 369:	5e                   	pop    %esi
+ 36a:	5d                   	pop    %ebp
+ 36b:	c3                   	ret
+
+0000036c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 36c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <exit>:
+SYSCALL(exit)
+ 374:	b8 02 00 00 00       	mov    $0x2,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <wait>:
+SYSCALL(wait)
+ 37c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <pipe>:
+SYSCALL(pipe)
+ 384:	b8 04 00 00 00       	mov    $0x4,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <read>:
+SYSCALL(read)
+ 38c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <write>:
+SYSCALL(write)
+ 394:	b8 10 00 00 00       	mov    $0x10,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <close>:
+SYSCALL(close)
+ 39c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <kill>:
+SYSCALL(kill)
+ 3a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <exec>:
+SYSCALL(exec)
+ 3ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <open>:
+SYSCALL(open)
+ 3b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <mknod>:
+SYSCALL(mknod)
+ 3bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <unlink>:
+SYSCALL(unlink)
+ 3c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <fstat>:
+SYSCALL(fstat)
+ 3cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <link>:
+SYSCALL(link)
+ 3d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <mkdir>:
+SYSCALL(mkdir)
+ 3dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <chdir>:
+SYSCALL(chdir)
+ 3e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <dup>:
+SYSCALL(dup)
+ 3ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <getpid>:
+SYSCALL(getpid)
+ 3f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <sbrk>:
+SYSCALL(sbrk)
+ 3fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <sleep>:
+SYSCALL(sleep)
+ 404:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <uptime>:
+SYSCALL(uptime)
+ 40c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <halt>:
+SYSCALL(halt)
+ 414:	b8 16 00 00 00       	mov    $0x16,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <date>:
+SYSCALL(date)
+ 41c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <getuid>:
+SYSCALL(getuid)
+ 424:	b8 18 00 00 00       	mov    $0x18,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <getgid>:
+SYSCALL(getgid)
+ 42c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <getppid>:
+SYSCALL(getppid)
+ 434:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <setuid>:
+SYSCALL(setuid)
+ 43c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <setgid>:
+SYSCALL(setgid)
+ 444:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <getprocs>:
+SYSCALL(getprocs)
+ 44c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <setpriority>:
+SYSCALL(setpriority)
+ 454:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <getpriority>:
+SYSCALL(getpriority)
+ 45c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <waitpid>:
+SYSCALL(waitpid)
+ 464:	b8 20 00 00 00       	mov    $0x20,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <setaffinity>:
+SYSCALL(setaffinity)
+ 46c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <getaffinity>:
+SYSCALL(getaffinity)
+ 474:	b8 22 00 00 00       	mov    $0x22,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <setdeadline>:
+SYSCALL(setdeadline)
+ 47c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <schedctl>:
+SYSCALL(schedctl)
+ 484:	b8 24 00 00 00       	mov    $0x24,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <spawn>:
+SYSCALL(spawn)
+ 48c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <vmstats>:
+SYSCALL(vmstats)
+ 494:	b8 26 00 00 00       	mov    $0x26,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <hugesbrk>:
+SYSCALL(hugesbrk)
+ 49c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <setshares>:
+SYSCALL(setshares)
+ 4a4:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <getshares>:
+SYSCALL(getshares)
+ 4ac:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4b4:	55                   	push   %ebp
+ 4b5:	89 e5                	mov    %esp,%ebp
+ 4b7:	57                   	push   %edi
+ 4b8:	56                   	push   %esi
+ 4b9:	53                   	push   %ebx
+ 4ba:	83 ec 3c             	sub    $0x3c,%esp
+ 4bd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4c0:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4c2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4c6:	74 79                	je     541 <printint+0x8d>
+ 4c8:	85 d2                	test   %edx,%edx
+ 4ca:	79 75                	jns    541 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 4cc:	89 d1                	mov    %edx,%ecx
+ 4ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4d0:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4dc:	89 df                	mov    %ebx,%edi
+ 4de:	83 c3 01             	add    $0x1,%ebx
+ 4e1:	89 c8                	mov    %ecx,%eax
+ 4e3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4e8:	f7 f6                	div    %esi
+ 4ea:	0f b6 92 c8 08 00 00 	movzbl 0x8c8(%edx),%edx
+ 4f1:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4f5:	89 ca                	mov    %ecx,%edx
+ 4f7:	89 c1                	mov    %eax,%ecx
+ 4f9:	39 f2                	cmp    %esi,%edx
+ 4fb:	73 df                	jae    4dc <printint+0x28>
+  if(neg)
+ 4fd:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 501:	74 08                	je     50b <printint+0x57>
+    buf[i++] = '-';
+ 503:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 508:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 50b:	85 db                	test   %ebx,%ebx
+ 50d:	7e 2a                	jle    539 <printint+0x85>
+ 50f:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 512:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 516:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 519:	0f b6 03             	movzbl (%ebx),%eax
+ 51c:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 51f:	83 ec 04             	sub    $0x4,%esp
+ 522:	6a 01                	push   $0x1
+ 524:	57                   	push   %edi
+ 525:	ff 75 c4             	push   -0x3c(%ebp)
+ 528:	e8 67 fe ff ff       	call   394 <write>
+  while(--i >= 0)
+ 52d:	89 d8                	mov    %ebx,%eax
+ 52f:	83 eb 01             	sub    $0x1,%ebx
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	39 f0                	cmp    %esi,%eax
+ 537:	75 e0                	jne    519 <printint+0x65>
+}
+ 539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 53c:	5b                   	pop    %ebx
+ 53d:	5e                   	pop    %esi
+ 53e:	5f                   	pop    %edi
+ 53f:	5d                   	pop    %ebp
+ 540:	c3                   	ret
+    x = xx;
+ 541:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 543:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 54a:	eb 8b                	jmp    4d7 <printint+0x23>
+
+0000054c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 54c:	55                   	push   %ebp
+ 54d:	89 e5                	mov    %esp,%ebp
+ 54f:	57                   	push   %edi
+ 550:	56                   	push   %esi
+ 551:	53                   	push   %ebx
+ 552:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 555:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 558:	0f b6 1e             	movzbl (%esi),%ebx
+ 55b:	84 db                	test   %bl,%bl
+ 55d:	0f 84 9e 01 00 00    	je     701 <printf+0x1b5>
+ 563:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 566:	8d 45 10             	lea    0x10(%ebp),%eax
+ 569:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 56c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 571:	eb 2d                	jmp    5a0 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 573:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 576:	83 ec 04             	sub    $0x4,%esp
+ 579:	6a 01                	push   $0x1
+ 57b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 57e:	50                   	push   %eax
+ 57f:	ff 75 08             	push   0x8(%ebp)
+ 582:	e8 0d fe ff ff       	call   394 <write>
+        putc(fd, c);
+ 587:	83 c4 10             	add    $0x10,%esp
+ 58a:	eb 05                	jmp    591 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 58c:	83 ff 25             	cmp    $0x25,%edi
+ 58f:	74 1f                	je     5b0 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 591:	83 c6 01             	add    $0x1,%esi
+ 594:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 598:	84 db                	test   %bl,%bl
+ 59a:	0f 84 61 01 00 00    	je     701 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 5a0:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5a3:	85 ff                	test   %edi,%edi
+ 5a5:	75 e5                	jne    58c <printf+0x40>
+      if(c == '%'){
+ 5a7:	83 f8 25             	cmp    $0x25,%eax
+ 5aa:	75 c7                	jne    573 <printf+0x27>
+        state = '%';
+ 5ac:	89 c7                	mov    %eax,%edi
+ 5ae:	eb e1                	jmp    591 <printf+0x45>
+      if(c == 'd'){
+ 5b0:	83 f8 25             	cmp    $0x25,%eax
+ 5b3:	0f 84 f4 00 00 00    	je     6ad <printf+0x161>
+ 5b9:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 5bc:	83 fa 15             	cmp    $0x15,%edx
+ 5bf:	0f 87 09 01 00 00    	ja     6ce <printf+0x182>
+ 5c5:	0f 87 03 01 00 00    	ja     6ce <printf+0x182>
+ 5cb:	ff 24 95 70 08 00 00 	jmp    *0x870(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 5d2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5d5:	8b 17                	mov    (%edi),%edx
+ 5d7:	83 ec 0c             	sub    $0xc,%esp
+ 5da:	6a 01                	push   $0x1
+ 5dc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e4:	e8 cb fe ff ff       	call   4b4 <printint>
+        ap++;
+ 5e9:	83 c7 04             	add    $0x4,%edi
+ 5ec:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5ef:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5f2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5f7:	eb 98                	jmp    591 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5f9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5fc:	8b 17                	mov    (%edi),%edx
+ 5fe:	83 ec 0c             	sub    $0xc,%esp
+ 601:	6a 00                	push   $0x0
+ 603:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 608:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60b:	e8 a4 fe ff ff       	call   4b4 <printint>
+        ap++;
+ 610:	83 c7 04             	add    $0x4,%edi
+ 613:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 616:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 619:	bf 00 00 00 00       	mov    $0x0,%edi
+ 61e:	e9 6e ff ff ff       	jmp    591 <printf+0x45>
+        s = (char*)*ap;
+ 623:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 626:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 628:	83 c1 04             	add    $0x4,%ecx
+ 62b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 62e:	85 c0                	test   %eax,%eax
+ 630:	74 13                	je     645 <printf+0xf9>
+        s = (char*)*ap;
+ 632:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 634:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 637:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 63c:	84 c0                	test   %al,%al
+ 63e:	75 0f                	jne    64f <printf+0x103>
+ 640:	e9 4c ff ff ff       	jmp    591 <printf+0x45>
+          s = "(null)";
+ 645:	bb 67 08 00 00       	mov    $0x867,%ebx
+        while(*s != 0){
+ 64a:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 64f:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 652:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 655:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 658:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	6a 01                	push   $0x1
+ 660:	57                   	push   %edi
+ 661:	56                   	push   %esi
+ 662:	e8 2d fd ff ff       	call   394 <write>
+          s++;
+ 667:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 66a:	0f b6 03             	movzbl (%ebx),%eax
+ 66d:	83 c4 10             	add    $0x10,%esp
+ 670:	84 c0                	test   %al,%al
+ 672:	75 e4                	jne    658 <printf+0x10c>
+      state = 0;
+ 674:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 677:	bf 00 00 00 00       	mov    $0x0,%edi
+ 67c:	e9 10 ff ff ff       	jmp    591 <printf+0x45>
+        putc(fd, *ap);
+ 681:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 684:	8b 07                	mov    (%edi),%eax
+ 686:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 689:	83 ec 04             	sub    $0x4,%esp
+ 68c:	6a 01                	push   $0x1
+ 68e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 691:	50                   	push   %eax
+ 692:	ff 75 08             	push   0x8(%ebp)
+ 695:	e8 fa fc ff ff       	call   394 <write>
+        ap++;
+ 69a:	83 c7 04             	add    $0x4,%edi
+ 69d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 6a0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6a3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6a8:	e9 e4 fe ff ff       	jmp    591 <printf+0x45>
+        putc(fd, c);
+ 6ad:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	6a 01                	push   $0x1
+ 6b5:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6b8:	50                   	push   %eax
+ 6b9:	ff 75 08             	push   0x8(%ebp)
+ 6bc:	e8 d3 fc ff ff       	call   394 <write>
+ 6c1:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6c9:	e9 c3 fe ff ff       	jmp    591 <printf+0x45>
+        putc(fd, '%');
+ 6ce:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d2:	83 ec 04             	sub    $0x4,%esp
+ 6d5:	6a 01                	push   $0x1
+ 6d7:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6da:	57                   	push   %edi
+ 6db:	ff 75 08             	push   0x8(%ebp)
+ 6de:	e8 b1 fc ff ff       	call   394 <write>
+        putc(fd, c);
+ 6e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6e6:	83 c4 0c             	add    $0xc,%esp
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	57                   	push   %edi
+ 6ec:	ff 75 08             	push   0x8(%ebp)
+ 6ef:	e8 a0 fc ff ff       	call   394 <write>
+        putc(fd, c);
+ 6f4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6f7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6fc:	e9 90 fe ff ff       	jmp    591 <printf+0x45>
+    }
+  }
+}
+ 701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 704:	5b                   	pop    %ebx
+ 705:	5e                   	pop    %esi
+ 706:	5f                   	pop    %edi
+ 707:	5d                   	pop    %ebp
+ 708:	c3                   	ret
+
+00000709 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 709:	55                   	push   %ebp
+ 70a:	89 e5                	mov    %esp,%ebp
+ 70c:	57                   	push   %edi
+ 70d:	56                   	push   %esi
+ 70e:	53                   	push   %ebx
+ 70f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 712:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 715:	a1 6c 0b 00 00       	mov    0xb6c,%eax
+ 71a:	eb 0c                	jmp    728 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 71c:	8b 10                	mov    (%eax),%edx
+ 71e:	39 d0                	cmp    %edx,%eax
+ 720:	72 04                	jb     726 <free+0x1d>
+ 722:	39 d1                	cmp    %edx,%ecx
+ 724:	72 10                	jb     736 <free+0x2d>
+{
+ 726:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 728:	39 c8                	cmp    %ecx,%eax
+ 72a:	73 f0                	jae    71c <free+0x13>
+ 72c:	8b 10                	mov    (%eax),%edx
+ 72e:	39 d1                	cmp    %edx,%ecx
+ 730:	72 04                	jb     736 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 732:	39 d0                	cmp    %edx,%eax
+ 734:	72 f0                	jb     726 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 736:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 739:	8b 10                	mov    (%eax),%edx
+ 73b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 73e:	39 fa                	cmp    %edi,%edx
+ 740:	74 19                	je     75b <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 742:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 745:	8b 50 04             	mov    0x4(%eax),%edx
+ 748:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 74b:	39 f1                	cmp    %esi,%ecx
+ 74d:	74 18                	je     767 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 74f:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 751:	a3 6c 0b 00 00       	mov    %eax,0xb6c
+}
+ 756:	5b                   	pop    %ebx
+ 757:	5e                   	pop    %esi
+ 758:	5f                   	pop    %edi
+ 759:	5d                   	pop    %ebp
+ 75a:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 75b:	03 72 04             	add    0x4(%edx),%esi
+ 75e:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 761:	8b 10                	mov    (%eax),%edx
+ 763:	8b 12                	mov    (%edx),%edx
+ 765:	eb db                	jmp    742 <free+0x39>
+    p->s.size += bp->s.size;
+ 767:	03 53 fc             	add    -0x4(%ebx),%edx
+ 76a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 76d:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 770:	eb dd                	jmp    74f <free+0x46>
+
+00000772 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 772:	55                   	push   %ebp
+ 773:	89 e5                	mov    %esp,%ebp
+ 775:	57                   	push   %edi
+ 776:	56                   	push   %esi
+ 777:	53                   	push   %ebx
+ 778:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 77b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77e:	8d 58 07             	lea    0x7(%eax),%ebx
+ 781:	c1 eb 03             	shr    $0x3,%ebx
+ 784:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 787:	8b 15 6c 0b 00 00    	mov    0xb6c,%edx
+ 78d:	85 d2                	test   %edx,%edx
+ 78f:	74 1c                	je     7ad <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 791:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 793:	8b 48 04             	mov    0x4(%eax),%ecx
+ 796:	39 d9                	cmp    %ebx,%ecx
+ 798:	73 38                	jae    7d2 <malloc+0x60>
+  if(nu < 4096)
+ 79a:	be 00 10 00 00       	mov    $0x1000,%esi
+ 79f:	39 f3                	cmp    %esi,%ebx
+ 7a1:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 7a4:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 7ab:	eb 72                	jmp    81f <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 7ad:	c7 05 6c 0b 00 00 70 	movl   $0xb70,0xb6c
+ 7b4:	0b 00 00 
+ 7b7:	c7 05 70 0b 00 00 70 	movl   $0xb70,0xb70
+ 7be:	0b 00 00 
+    base.s.size = 0;
+ 7c1:	c7 05 74 0b 00 00 00 	movl   $0x0,0xb74
+ 7c8:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7cb:	b8 70 0b 00 00       	mov    $0xb70,%eax
+    if(p->s.size >= nunits){
+ 7d0:	eb c8                	jmp    79a <malloc+0x28>
+      if(p->s.size == nunits)
+ 7d2:	39 cb                	cmp    %ecx,%ebx
+ 7d4:	74 1e                	je     7f4 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7d6:	29 d9                	sub    %ebx,%ecx
+ 7d8:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7db:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7de:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7e1:	89 15 6c 0b 00 00    	mov    %edx,0xb6c
+      return (void*)(p + 1);
+ 7e7:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7ea:	89 d0                	mov    %edx,%eax
+ 7ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ef:	5b                   	pop    %ebx
+ 7f0:	5e                   	pop    %esi
+ 7f1:	5f                   	pop    %edi
+ 7f2:	5d                   	pop    %ebp
+ 7f3:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7f4:	8b 08                	mov    (%eax),%ecx
+ 7f6:	89 0a                	mov    %ecx,(%edx)
+ 7f8:	eb e7                	jmp    7e1 <malloc+0x6f>
+  hp->s.size = nu;
+ 7fa:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7fd:	83 ec 0c             	sub    $0xc,%esp
+ 800:	83 c0 08             	add    $0x8,%eax
+ 803:	50                   	push   %eax
+ 804:	e8 00 ff ff ff       	call   709 <free>
+  return freep;
+ 809:	8b 15 6c 0b 00 00    	mov    0xb6c,%edx
+      if((p = morecore(nunits)) == 0)
+ 80f:	83 c4 10             	add    $0x10,%esp
+ 812:	85 d2                	test   %edx,%edx
+ 814:	74 d4                	je     7ea <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 816:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 818:	8b 48 04             	mov    0x4(%eax),%ecx
+ 81b:	39 d9                	cmp    %ebx,%ecx
+ 81d:	73 b3                	jae    7d2 <malloc+0x60>
+    if(p == freep)
+ 81f:	89 c2                	mov    %eax,%edx
+ 821:	39 05 6c 0b 00 00    	cmp    %eax,0xb6c
+ 827:	75 ed                	jne    816 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 829:	83 ec 0c             	sub    $0xc,%esp
+ 82c:	57                   	push   %edi
+ 82d:	e8 ca fb ff ff       	call   3fc <sbrk>
+  if(p == (char*)-1)
+ 832:	83 c4 10             	add    $0x10,%esp
+ 835:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 838:	75 c0                	jne    7fa <malloc+0x88>
+        return 0;
+ 83a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 83f:	eb a9                	jmp    7ea <malloc+0x78>
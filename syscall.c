@@ -21,6 +21,8 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
+  if(uvmtouch(curproc, addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -39,6 +41,9 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       uvmtouch(curproc, (uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -52,11 +57,8 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+fetchptr(int n, char **pp, int size, int write)
 {
   int i;
   struct proc *curproc = myproc();
@@ -65,10 +67,29 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  if(uvmtouch(curproc, i, size, write) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return fetchptr(n, pp, size, 0);
+}
+
+// Like argptr(), for a block the kernel will write: make it
+// writable now, so that writing it cannot fault.
+int
+argptrw(int n, char **pp, int size)
+{
+  return fetchptr(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -120,7 +141,19 @@ extern int sys_getprocs(void);
 #ifdef CS333_P4
 extern int sys_setpriority(void);
 extern int sys_getpriority(void);
+extern int sys_waitpid(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_setdeadline(void);
+extern int sys_schedctl(void);
+extern int sys_spawn(void);
+extern int sys_vmstats(void);
+extern int sys_hugesbrk(void);
 #endif // CS333_P4
+#ifdef PDX_STRIDE
+extern int sys_setshares(void);
+extern int sys_getshares(void);
+#endif // PDX_STRIDE
 
 #ifdef CS333_P1
 int date(struct rtcdate*);
@@ -168,7 +201,20 @@ static int (*syscalls[])(void) = {
 #ifdef CS333_P4
 [SYS_setpriority] sys_setpriority,
 [SYS_getpriority] sys_getpriority,
+[SYS_waitpid] sys_waitpid,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_setdeadline] sys_setdeadline,
+[SYS_schedctl]  sys_schedctl,
+[SYS_spawn]     sys_spawn,
+[SYS_vmstats]   sys_vmstats,
+[SYS_hugesbrk]  sys_hugesbrk,
 #endif  // CS333_P4
+
+#ifdef PDX_STRIDE
+[SYS_setshares] sys_setshares,
+[SYS_getshares] sys_getshares,
+#endif  // PDX_STRIDE
 };
 
 #ifdef PRINT_SYSCALLS
@@ -211,7 +257,19 @@ static char *syscallnames[] = {
 #ifdef CS333_P4
 [SYS_setpriority] "setpriority",
 [SYS_getpriority] "getpriority",
+[SYS_waitpid] "waitpid",
+[SYS_setaffinity] "setaffinity",
+[SYS_getaffinity] "getaffinity",
+[SYS_setdeadline] "setdeadline",
+[SYS_schedctl]  "schedctl",
+[SYS_spawn]     "spawn",
+[SYS_vmstats]   "vmstats",
+[SYS_hugesbrk]  "hugesbrk",
 #endif // CS333_P4
+#ifdef PDX_STRIDE
+[SYS_setshares] "setshares",
+[SYS_getshares] "getshares",
+#endif // PDX_STRIDE
 };
 #endif // PRINT_SYSCALLS
 
@@ -31,3 +31,13 @@
 #define SYS_getprocs  SYS_setgid+1
 #define SYS_setpriority  SYS_getprocs+1
 #define SYS_getpriority  SYS_setpriority+1
+#define SYS_waitpid  SYS_getpriority+1
+#define SYS_setaffinity  SYS_waitpid+1
+#define SYS_getaffinity  SYS_setaffinity+1
+#define SYS_setdeadline  SYS_getaffinity+1
+#define SYS_schedctl  SYS_setdeadline+1
+#define SYS_spawn  SYS_schedctl+1
+#define SYS_vmstats  SYS_spawn+1
+#define SYS_hugesbrk  SYS_vmstats+1
+#define SYS_setshares  SYS_hugesbrk+1
+#define SYS_getshares  SYS_setshares+1
@@ -15,6 +15,9 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#ifdef CS333_P4
+#include "spawn.h"
+#endif // CS333_P4
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +76,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -109,7 +112,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -226,6 +229,7 @@ sys_unlink(void)
 
   ip->nlink--;
   iupdate(ip);
+  pcinval(ip);
   iunlockput(ip);
 
   end_op();
@@ -394,19 +398,16 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the null-terminated argument vector at user address uargv.
+static int
+fetchargv(uint uargv, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
-  uint uargv, uarg;
+  uint uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
-    return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
@@ -417,9 +418,54 @@ sys_exec(void)
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+    return -1;
+  }
+  if(fetchargv(uargv, argv) < 0)
+    return -1;
   return exec(path, argv);
 }
 
+#ifdef CS333_P4
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  struct spawnfd fa[SPAWN_MAXFD];
+  uint uargv, ufa;
+  int i;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     argint(2, (int*)&ufa) < 0)
+    return -1;
+  if(fetchargv(uargv, argv) < 0)
+    return -1;
+
+  // A null fa means no actions.
+  for(i = 0; i < SPAWN_MAXFD; i++){
+    fa[i].op = SPAWN_END;
+    if(ufa == 0)
+      break;
+    if(fetchint(ufa + i*sizeof(fa[i]), &fa[i].op) < 0 ||
+       fetchint(ufa + i*sizeof(fa[i]) + 4, &fa[i].fd) < 0 ||
+       fetchint(ufa + i*sizeof(fa[i]) + 8, &fa[i].newfd) < 0)
+      return -1;
+    if(fa[i].op == SPAWN_END)
+      break;
+  }
+  return spawn(path, argv, fa);
+}
+#endif // CS333_P4
+
 int
 sys_pipe(void)
 {
@@ -427,7 +473,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
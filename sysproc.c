@@ -11,6 +11,10 @@
 #endif // PDX_XV6
 #ifdef CS333_P2
 #include "uproc.h"
+#ifdef CS333_P4
+#include "schedctl.h"
+#include "vmstats.h"
+#endif // CS333_P4
 //#include "proc.c"
 #endif // CS333_P2
 
@@ -63,6 +67,17 @@ sys_sbrk(void)
   return addr;
 }
 
+#ifdef CS333_P4
+int
+sys_sleep(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return sleepticks(n);
+}
+#else // Original sys_sleep()
 int
 sys_sleep(void)
 {
@@ -80,6 +95,7 @@ sys_sleep(void)
   }
   return 0;
 }
+#endif // CS333_P4
 
 // return how many clock tick interrupts have occurred
 // since start.
@@ -109,7 +125,7 @@ sys_date(void)
 {
   struct rtcdate *d;
 
-  if(argptr(0, (void*)&d, sizeof(struct rtcdate)) < 0)
+  if(argptrw(0, (void*)&d, sizeof(struct rtcdate)) < 0)
     return -1;
 
   cmostime(d);
@@ -147,7 +163,7 @@ sys_setuid(void)
   if(uid > 32767 || uid < 0)
     return -1;
  
-  myproc()->uid = uid;
+  setuid(uid);
 
   return 0;
 }
@@ -177,10 +193,14 @@ sys_getprocs(void)
   if(argint(0,(int*)&max) < 0)
     return -1;
 
-  if(max != 1 && max != 16 && max != 64 && max != 72)
+#ifdef CS333_P4
+  if(max < 1 || max > MAXPROC)
+#else
+  if(max < 1 || max > NPROC)
+#endif // CS333_P4
     return -1;
 
-  if(argptr(1,(void*)&table, sizeof(struct uproc)) < 0)
+  if(argptrw(1,(void*)&table, max*sizeof(struct uproc)) < 0)
     return -1;
 
   int proc_num = getprocs(max,table);
@@ -215,4 +235,120 @@ sys_getpriority(void)
 
   return getpriority(pid);
 }
+
+int
+sys_waitpid(void)
+{
+  int pid;
+
+  if(argint(0,&pid) < 0)
+    return -1;
+
+  return waitpid(pid);
+}
+
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0,&pid) < 0 || argint(1,&mask) < 0)
+    return -1;
+  if(pid < 0)
+    return -1;
+
+  return setaffinity(pid,mask);
+}
+
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0,&pid) < 0)
+    return -1;
+  if(pid < 0)
+    return -1;
+
+  return getaffinity(pid);
+}
+
+// setdeadline(pid, runtime, period): reserve runtime ticks of every
+// period ticks, up to EDF_MAXPERIOD.  A period of 0 makes pid an MLFQ
+// process again.
+int
+sys_setdeadline(void)
+{
+  int pid, runtime, period;
+
+  if(argint(0,&pid) < 0 || argint(1,&runtime) < 0 || argint(2,&period) < 0)
+    return -1;
+  if(pid < 0 || period < 0 || period > EDF_MAXPERIOD)
+    return -1;
+  if(period > 0 && (runtime <= 0 || runtime > period))
+    return -1;
+
+  return setdeadline(pid,runtime,period);
+}
+
+int
+sys_schedctl(void)
+{
+  int cmd;
+  struct schedparams *sp;
+
+  if(argint(0,&cmd) < 0 || argptrw(1,(void*)&sp,sizeof(*sp)) < 0)
+    return -1;
+
+  return schedctl(cmd,sp);
+}
+
+int
+sys_vmstats(void)
+{
+  struct vmstats *vs;
+
+  if(argptrw(0,(void*)&vs,sizeof(*vs)) < 0)
+    return -1;
+
+  *vs = vmstat;
+  kmemstats(vs);
+  return 0;
+}
+
+int
+sys_hugesbrk(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return growhuge(n);
+}
 #endif // CS333_P4
+
+#ifdef PDX_STRIDE
+int
+sys_setshares(void)
+{
+  int uid, n;
+
+  if(argint(0,&uid) < 0 || argint(1,&n) < 0)
+    return -1;
+  if(uid < 0)
+    return -1;
+
+  return setshares(uid,n);
+}
+
+int
+sys_getshares(void)
+{
+  int uid;
+
+  if(argint(0,&uid) < 0 || uid < 0)
+    return -1;
+
+  return getshares(uid);
+}
+#endif // PDX_STRIDE
@@ -0,0 +1,1218 @@
+
+_testsetuid:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  printf(1, "***** In %s: my uid is %d\n\n", argv[0], getuid());
+  12:	e8 27 03 00 00       	call   33e <getuid>
+  17:	50                   	push   %eax
+  18:	ff 33                	push   (%ebx)
+  1a:	68 5c 07 00 00       	push   $0x75c
+  1f:	6a 01                	push   $0x1
+  21:	e8 40 04 00 00       	call   466 <printf>
+  exit();
+  26:	e8 63 02 00 00       	call   28e <exit>
+
+0000002b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  2b:	55                   	push   %ebp
+  2c:	89 e5                	mov    %esp,%ebp
+  2e:	53                   	push   %ebx
+  2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  35:	b8 00 00 00 00       	mov    $0x0,%eax
+  3a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  3e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  41:	83 c0 01             	add    $0x1,%eax
+  44:	84 d2                	test   %dl,%dl
+  46:	75 f2                	jne    3a <strcpy+0xf>
+    ;
+  return os;
+}
+  48:	89 c8                	mov    %ecx,%eax
+  4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  4d:	c9                   	leave
+  4e:	c3                   	ret
+
+0000004f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  4f:	55                   	push   %ebp
+  50:	89 e5                	mov    %esp,%ebp
+  52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  55:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  58:	0f b6 01             	movzbl (%ecx),%eax
+  5b:	84 c0                	test   %al,%al
+  5d:	74 11                	je     70 <strcmp+0x21>
+  5f:	38 02                	cmp    %al,(%edx)
+  61:	75 0d                	jne    70 <strcmp+0x21>
+    p++, q++;
+  63:	83 c1 01             	add    $0x1,%ecx
+  66:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  69:	0f b6 01             	movzbl (%ecx),%eax
+  6c:	84 c0                	test   %al,%al
+  6e:	75 ef                	jne    5f <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  70:	0f b6 c0             	movzbl %al,%eax
+  73:	0f b6 12             	movzbl (%edx),%edx
+  76:	29 d0                	sub    %edx,%eax
+}
+  78:	5d                   	pop    %ebp
+  79:	c3                   	ret
+
+0000007a <strlen>:
+
+uint
+strlen(char *s)
+{
+  7a:	55                   	push   %ebp
+  7b:	89 e5                	mov    %esp,%ebp
+  7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  80:	80 3a 00             	cmpb   $0x0,(%edx)
+  83:	74 14                	je     99 <strlen+0x1f>
+  85:	b8 00 00 00 00       	mov    $0x0,%eax
+  8a:	83 c0 01             	add    $0x1,%eax
+  8d:	89 c1                	mov    %eax,%ecx
+  8f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  93:	75 f5                	jne    8a <strlen+0x10>
+    ;
+  return n;
+}
+  95:	89 c8                	mov    %ecx,%eax
+  97:	5d                   	pop    %ebp
+  98:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  9e:	eb f5                	jmp    95 <strlen+0x1b>
+
+000000a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	57                   	push   %edi
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  a7:	89 d7                	mov    %edx,%edi
+  a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  af:	fc                   	cld
+  b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  b2:	89 d0                	mov    %edx,%eax
+  b4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  b7:	c9                   	leave
+  b8:	c3                   	ret
+
+000000b9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  b9:	55                   	push   %ebp
+  ba:	89 e5                	mov    %esp,%ebp
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  c3:	0f b6 10             	movzbl (%eax),%edx
+  c6:	84 d2                	test   %dl,%dl
+  c8:	74 15                	je     df <strchr+0x26>
+    if(*s == c)
+  ca:	38 d1                	cmp    %dl,%cl
+  cc:	74 0f                	je     dd <strchr+0x24>
+  for(; *s; s++)
+  ce:	83 c0 01             	add    $0x1,%eax
+  d1:	0f b6 10             	movzbl (%eax),%edx
+  d4:	84 d2                	test   %dl,%dl
+  d6:	75 f2                	jne    ca <strchr+0x11>
+      return (char*)s;
+  return 0;
+  d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  return 0;
+  df:	b8 00 00 00 00       	mov    $0x0,%eax
+  e4:	eb f7                	jmp    dd <strchr+0x24>
+
+000000e6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  e9:	57                   	push   %edi
+  ea:	56                   	push   %esi
+  eb:	53                   	push   %ebx
+  ec:	83 ec 2c             	sub    $0x2c,%esp
+  ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+  f7:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+  fa:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  fd:	83 c3 01             	add    $0x1,%ebx
+ 100:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 103:	7d 27                	jge    12c <gets+0x46>
+    cc = read(0, &c, 1);
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	6a 01                	push   $0x1
+ 10a:	57                   	push   %edi
+ 10b:	6a 00                	push   $0x0
+ 10d:	e8 94 01 00 00       	call   2a6 <read>
+    if(cc < 1)
+ 112:	83 c4 10             	add    $0x10,%esp
+ 115:	85 c0                	test   %eax,%eax
+ 117:	7e 13                	jle    12c <gets+0x46>
+      break;
+    buf[i++] = c;
+ 119:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 11d:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 121:	3c 0a                	cmp    $0xa,%al
+ 123:	74 04                	je     129 <gets+0x43>
+ 125:	3c 0d                	cmp    $0xd,%al
+ 127:	75 d1                	jne    fa <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 129:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 12c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 12f:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 133:	89 f0                	mov    %esi,%eax
+ 135:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 138:	5b                   	pop    %ebx
+ 139:	5e                   	pop    %esi
+ 13a:	5f                   	pop    %edi
+ 13b:	5d                   	pop    %ebp
+ 13c:	c3                   	ret
+
+0000013d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 13d:	55                   	push   %ebp
+ 13e:	89 e5                	mov    %esp,%ebp
+ 140:	56                   	push   %esi
+ 141:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 142:	83 ec 08             	sub    $0x8,%esp
+ 145:	6a 00                	push   $0x0
+ 147:	ff 75 08             	push   0x8(%ebp)
+ 14a:	e8 7f 01 00 00       	call   2ce <open>
+  if(fd < 0)
+ 14f:	83 c4 10             	add    $0x10,%esp
+ 152:	85 c0                	test   %eax,%eax
+ 154:	78 24                	js     17a <stat+0x3d>
+ 156:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 158:	83 ec 08             	sub    $0x8,%esp
+ 15b:	ff 75 0c             	push   0xc(%ebp)
+ 15e:	50                   	push   %eax
+ 15f:	e8 82 01 00 00       	call   2e6 <fstat>
+ 164:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 166:	89 1c 24             	mov    %ebx,(%esp)
+ 169:	e8 48 01 00 00       	call   2b6 <close>
+  return r;
+ 16e:	83 c4 10             	add    $0x10,%esp
+}
+ 171:	89 f0                	mov    %esi,%eax
+ 173:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 176:	5b                   	pop    %ebx
+ 177:	5e                   	pop    %esi
+ 178:	5d                   	pop    %ebp
+ 179:	c3                   	ret
+    return -1;
+ 17a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 17f:	eb f0                	jmp    171 <stat+0x34>
+
+00000181 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 181:	55                   	push   %ebp
+ 182:	89 e5                	mov    %esp,%ebp
+ 184:	56                   	push   %esi
+ 185:	53                   	push   %ebx
+ 186:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 189:	0f b6 0a             	movzbl (%edx),%ecx
+ 18c:	80 f9 20             	cmp    $0x20,%cl
+ 18f:	75 0b                	jne    19c <atoi+0x1b>
+ 191:	83 c2 01             	add    $0x1,%edx
+ 194:	0f b6 0a             	movzbl (%edx),%ecx
+ 197:	80 f9 20             	cmp    $0x20,%cl
+ 19a:	74 f5                	je     191 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 19c:	80 f9 2d             	cmp    $0x2d,%cl
+ 19f:	74 3c                	je     1dd <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 1a1:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1a4:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1a9:	f6 c1 fd             	test   $0xfd,%cl
+ 1ac:	74 34                	je     1e2 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1ae:	0f b6 0a             	movzbl (%edx),%ecx
+ 1b1:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1b4:	3c 09                	cmp    $0x9,%al
+ 1b6:	77 2f                	ja     1e7 <atoi+0x66>
+ 1b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 1bd:	83 c2 01             	add    $0x1,%edx
+ 1c0:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1c3:	0f be c9             	movsbl %cl,%ecx
+ 1c6:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 1ca:	0f b6 0a             	movzbl (%edx),%ecx
+ 1cd:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1d0:	3c 09                	cmp    $0x9,%al
+ 1d2:	76 e9                	jbe    1bd <atoi+0x3c>
+  return sign*n;
+ 1d4:	89 f0                	mov    %esi,%eax
+ 1d6:	0f af c3             	imul   %ebx,%eax
+}
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+ 1dc:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 1dd:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 1e2:	83 c2 01             	add    $0x1,%edx
+ 1e5:	eb c7                	jmp    1ae <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 1e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ec:	eb e6                	jmp    1d4 <atoi+0x53>
+
+000001ee <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1ee:	55                   	push   %ebp
+ 1ef:	89 e5                	mov    %esp,%ebp
+ 1f1:	56                   	push   %esi
+ 1f2:	53                   	push   %ebx
+ 1f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1f6:	0f b6 0a             	movzbl (%edx),%ecx
+ 1f9:	80 f9 20             	cmp    $0x20,%cl
+ 1fc:	75 0b                	jne    209 <atoo+0x1b>
+ 1fe:	83 c2 01             	add    $0x1,%edx
+ 201:	0f b6 0a             	movzbl (%edx),%ecx
+ 204:	80 f9 20             	cmp    $0x20,%cl
+ 207:	74 f5                	je     1fe <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 209:	80 f9 2d             	cmp    $0x2d,%cl
+ 20c:	74 3a                	je     248 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 20e:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 211:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 216:	f6 c1 fd             	test   $0xfd,%cl
+ 219:	74 32                	je     24d <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 21b:	0f b6 0a             	movzbl (%edx),%ecx
+ 21e:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 221:	80 fb 07             	cmp    $0x7,%bl
+ 224:	77 2c                	ja     252 <atoo+0x64>
+ 226:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 22b:	83 c2 01             	add    $0x1,%edx
+ 22e:	0f be c9             	movsbl %cl,%ecx
+ 231:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 235:	0f b6 0a             	movzbl (%edx),%ecx
+ 238:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 23b:	3c 07                	cmp    $0x7,%al
+ 23d:	76 ec                	jbe    22b <atoo+0x3d>
+  return sign*n;
+ 23f:	89 f0                	mov    %esi,%eax
+ 241:	0f af c3             	imul   %ebx,%eax
+}
+ 244:	5b                   	pop    %ebx
+ 245:	5e                   	pop    %esi
+ 246:	5d                   	pop    %ebp
+ 247:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 248:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 24d:	83 c2 01             	add    $0x1,%edx
+ 250:	eb c9                	jmp    21b <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 252:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 257:	eb e6                	jmp    23f <atoo+0x51>
+
+00000259 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 259:	55                   	push   %ebp
+ 25a:	89 e5                	mov    %esp,%ebp
+ 25c:	56                   	push   %esi
+ 25d:	53                   	push   %ebx
+ 25e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 261:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 264:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 267:	85 db                	test   %ebx,%ebx
+ 269:	7e 15                	jle    280 <memmove+0x27>
+ 26b:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 26d:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 26f:	83 c2 01             	add    $0x1,%edx
+ 272:	83 c0 01             	add    $0x1,%eax
+ 275:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 279:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 27c:	39 c3                	cmp    %eax,%ebx
+ 27e:	75 ef                	jne    26f <memmove+0x16>
+  return vdst;
+}
+ 280:	89 f0                	mov    %esi,%eax
+ 282:	5b                   	pop    %ebx
+ 283:	5e                   	pop    %esi
+ 284:	5d                   	pop    %ebp
+ 285:	c3                   	ret
+
+00000286 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 286:	b8 01 00 00 00       	mov    $0x1,%eax
+ 28b:	cd 40                	int    $0x40
+ 28d:	c3                   	ret
+
+0000028e <exit>:
+SYSCALL(exit)
+ 28e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 293:	cd 40                	int    $0x40
+ 295:	c3                   	ret
+
+00000296 <wait>:
+SYSCALL(wait)
+ 296:	b8 03 00 00 00       	mov    $0x3,%eax
+ 29b:	cd 40                	int    $0x40
+ 29d:	c3                   	ret
+
+0000029e <pipe>:
+SYSCALL(pipe)
+ 29e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2a3:	cd 40                	int    $0x40
+ 2a5:	c3                   	ret
+
+000002a6 <read>:
+SYSCALL(read)
+ 2a6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2ab:	cd 40                	int    $0x40
+ 2ad:	c3                   	ret
+
+000002ae <write>:
+SYSCALL(write)
+ 2ae:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2b3:	cd 40                	int    $0x40
+ 2b5:	c3                   	ret
+
+000002b6 <close>:
+SYSCALL(close)
+ 2b6:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2bb:	cd 40                	int    $0x40
+ 2bd:	c3                   	ret
+
+000002be <kill>:
+SYSCALL(kill)
+ 2be:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2c3:	cd 40                	int    $0x40
+ 2c5:	c3                   	ret
+
+000002c6 <exec>:
+SYSCALL(exec)
+ 2c6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+000002ce <open>:
+SYSCALL(open)
+ 2ce:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+000002d6 <mknod>:
+SYSCALL(mknod)
+ 2d6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <unlink>:
+SYSCALL(unlink)
+ 2de:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <fstat>:
+SYSCALL(fstat)
+ 2e6:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <link>:
+SYSCALL(link)
+ 2ee:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <mkdir>:
+SYSCALL(mkdir)
+ 2f6:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <chdir>:
+SYSCALL(chdir)
+ 2fe:	b8 09 00 00 00       	mov    $0x9,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <dup>:
+SYSCALL(dup)
+ 306:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <getpid>:
+SYSCALL(getpid)
+ 30e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <sbrk>:
+SYSCALL(sbrk)
+ 316:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <sleep>:
+SYSCALL(sleep)
+ 31e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <uptime>:
+SYSCALL(uptime)
+ 326:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <halt>:
+SYSCALL(halt)
+ 32e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <date>:
+SYSCALL(date)
+ 336:	b8 17 00 00 00       	mov    $0x17,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <getuid>:
+SYSCALL(getuid)
+ 33e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <getgid>:
+SYSCALL(getgid)
+ 346:	b8 19 00 00 00       	mov    $0x19,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <getppid>:
+SYSCALL(getppid)
+ 34e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <setuid>:
+SYSCALL(setuid)
+ 356:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <setgid>:
+SYSCALL(setgid)
+ 35e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <getprocs>:
+SYSCALL(getprocs)
+ 366:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <setpriority>:
+SYSCALL(setpriority)
+ 36e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <getpriority>:
+SYSCALL(getpriority)
+ 376:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <waitpid>:
+SYSCALL(waitpid)
+ 37e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <setaffinity>:
+SYSCALL(setaffinity)
+ 386:	b8 21 00 00 00       	mov    $0x21,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <getaffinity>:
+SYSCALL(getaffinity)
+ 38e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <setdeadline>:
+SYSCALL(setdeadline)
+ 396:	b8 23 00 00 00       	mov    $0x23,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <schedctl>:
+SYSCALL(schedctl)
+ 39e:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <spawn>:
+SYSCALL(spawn)
+ 3a6:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <vmstats>:
+SYSCALL(vmstats)
+ 3ae:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 3b6:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <setshares>:
+SYSCALL(setshares)
+ 3be:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <getshares>:
+SYSCALL(getshares)
+ 3c6:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ce:	55                   	push   %ebp
+ 3cf:	89 e5                	mov    %esp,%ebp
+ 3d1:	57                   	push   %edi
+ 3d2:	56                   	push   %esi
+ 3d3:	53                   	push   %ebx
+ 3d4:	83 ec 3c             	sub    $0x3c,%esp
+ 3d7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3da:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3e0:	74 79                	je     45b <printint+0x8d>
+ 3e2:	85 d2                	test   %edx,%edx
+ 3e4:	79 75                	jns    45b <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 3e6:	89 d1                	mov    %edx,%ecx
+ 3e8:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3ea:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3f6:	89 df                	mov    %ebx,%edi
+ 3f8:	83 c3 01             	add    $0x1,%ebx
+ 3fb:	89 c8                	mov    %ecx,%eax
+ 3fd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 402:	f7 f6                	div    %esi
+ 404:	0f b6 92 d8 07 00 00 	movzbl 0x7d8(%edx),%edx
+ 40b:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 40f:	89 ca                	mov    %ecx,%edx
+ 411:	89 c1                	mov    %eax,%ecx
+ 413:	39 f2                	cmp    %esi,%edx
+ 415:	73 df                	jae    3f6 <printint+0x28>
+  if(neg)
+ 417:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 41b:	74 08                	je     425 <printint+0x57>
+    buf[i++] = '-';
+ 41d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 422:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 425:	85 db                	test   %ebx,%ebx
+ 427:	7e 2a                	jle    453 <printint+0x85>
+ 429:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 42c:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 430:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 433:	0f b6 03             	movzbl (%ebx),%eax
+ 436:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 439:	83 ec 04             	sub    $0x4,%esp
+ 43c:	6a 01                	push   $0x1
+ 43e:	57                   	push   %edi
+ 43f:	ff 75 c4             	push   -0x3c(%ebp)
+ 442:	e8 67 fe ff ff       	call   2ae <write>
+  while(--i >= 0)
+ 447:	89 d8                	mov    %ebx,%eax
+ 449:	83 eb 01             	sub    $0x1,%ebx
+ 44c:	83 c4 10             	add    $0x10,%esp
+ 44f:	39 f0                	cmp    %esi,%eax
+ 451:	75 e0                	jne    433 <printint+0x65>
+}
+ 453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 456:	5b                   	pop    %ebx
+ 457:	5e                   	pop    %esi
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+    x = xx;
+ 45b:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 45d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 464:	eb 8b                	jmp    3f1 <printint+0x23>
+
+00000466 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 466:	55                   	push   %ebp
+ 467:	89 e5                	mov    %esp,%ebp
+ 469:	57                   	push   %edi
+ 46a:	56                   	push   %esi
+ 46b:	53                   	push   %ebx
+ 46c:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 46f:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 472:	0f b6 1e             	movzbl (%esi),%ebx
+ 475:	84 db                	test   %bl,%bl
+ 477:	0f 84 9e 01 00 00    	je     61b <printf+0x1b5>
+ 47d:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 480:	8d 45 10             	lea    0x10(%ebp),%eax
+ 483:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 486:	bf 00 00 00 00       	mov    $0x0,%edi
+ 48b:	eb 2d                	jmp    4ba <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 48d:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 490:	83 ec 04             	sub    $0x4,%esp
+ 493:	6a 01                	push   $0x1
+ 495:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 498:	50                   	push   %eax
+ 499:	ff 75 08             	push   0x8(%ebp)
+ 49c:	e8 0d fe ff ff       	call   2ae <write>
+        putc(fd, c);
+ 4a1:	83 c4 10             	add    $0x10,%esp
+ 4a4:	eb 05                	jmp    4ab <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4a6:	83 ff 25             	cmp    $0x25,%edi
+ 4a9:	74 1f                	je     4ca <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4ab:	83 c6 01             	add    $0x1,%esi
+ 4ae:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4b2:	84 db                	test   %bl,%bl
+ 4b4:	0f 84 61 01 00 00    	je     61b <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4ba:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4bd:	85 ff                	test   %edi,%edi
+ 4bf:	75 e5                	jne    4a6 <printf+0x40>
+      if(c == '%'){
+ 4c1:	83 f8 25             	cmp    $0x25,%eax
+ 4c4:	75 c7                	jne    48d <printf+0x27>
+        state = '%';
+ 4c6:	89 c7                	mov    %eax,%edi
+ 4c8:	eb e1                	jmp    4ab <printf+0x45>
+      if(c == 'd'){
+ 4ca:	83 f8 25             	cmp    $0x25,%eax
+ 4cd:	0f 84 f4 00 00 00    	je     5c7 <printf+0x161>
+ 4d3:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4d6:	83 fa 15             	cmp    $0x15,%edx
+ 4d9:	0f 87 09 01 00 00    	ja     5e8 <printf+0x182>
+ 4df:	0f 87 03 01 00 00    	ja     5e8 <printf+0x182>
+ 4e5:	ff 24 95 80 07 00 00 	jmp    *0x780(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 4ec:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4ef:	8b 17                	mov    (%edi),%edx
+ 4f1:	83 ec 0c             	sub    $0xc,%esp
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fe:	e8 cb fe ff ff       	call   3ce <printint>
+        ap++;
+ 503:	83 c7 04             	add    $0x4,%edi
+ 506:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 509:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 50c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 511:	eb 98                	jmp    4ab <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 513:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 516:	8b 17                	mov    (%edi),%edx
+ 518:	83 ec 0c             	sub    $0xc,%esp
+ 51b:	6a 00                	push   $0x0
+ 51d:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 522:	8b 45 08             	mov    0x8(%ebp),%eax
+ 525:	e8 a4 fe ff ff       	call   3ce <printint>
+        ap++;
+ 52a:	83 c7 04             	add    $0x4,%edi
+ 52d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 530:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 533:	bf 00 00 00 00       	mov    $0x0,%edi
+ 538:	e9 6e ff ff ff       	jmp    4ab <printf+0x45>
+        s = (char*)*ap;
+ 53d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 540:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 542:	83 c1 04             	add    $0x4,%ecx
+ 545:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 548:	85 c0                	test   %eax,%eax
+ 54a:	74 13                	je     55f <printf+0xf9>
+        s = (char*)*ap;
+ 54c:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 54e:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 551:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 556:	84 c0                	test   %al,%al
+ 558:	75 0f                	jne    569 <printf+0x103>
+ 55a:	e9 4c ff ff ff       	jmp    4ab <printf+0x45>
+          s = "(null)";
+ 55f:	bb 78 07 00 00       	mov    $0x778,%ebx
+        while(*s != 0){
+ 564:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 569:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 56c:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 56f:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 572:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 575:	83 ec 04             	sub    $0x4,%esp
+ 578:	6a 01                	push   $0x1
+ 57a:	57                   	push   %edi
+ 57b:	56                   	push   %esi
+ 57c:	e8 2d fd ff ff       	call   2ae <write>
+          s++;
+ 581:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 584:	0f b6 03             	movzbl (%ebx),%eax
+ 587:	83 c4 10             	add    $0x10,%esp
+ 58a:	84 c0                	test   %al,%al
+ 58c:	75 e4                	jne    572 <printf+0x10c>
+      state = 0;
+ 58e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 591:	bf 00 00 00 00       	mov    $0x0,%edi
+ 596:	e9 10 ff ff ff       	jmp    4ab <printf+0x45>
+        putc(fd, *ap);
+ 59b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 59e:	8b 07                	mov    (%edi),%eax
+ 5a0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a3:	83 ec 04             	sub    $0x4,%esp
+ 5a6:	6a 01                	push   $0x1
+ 5a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5ab:	50                   	push   %eax
+ 5ac:	ff 75 08             	push   0x8(%ebp)
+ 5af:	e8 fa fc ff ff       	call   2ae <write>
+        ap++;
+ 5b4:	83 c7 04             	add    $0x4,%edi
+ 5b7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5ba:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bd:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c2:	e9 e4 fe ff ff       	jmp    4ab <printf+0x45>
+        putc(fd, c);
+ 5c7:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ca:	83 ec 04             	sub    $0x4,%esp
+ 5cd:	6a 01                	push   $0x1
+ 5cf:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5d2:	50                   	push   %eax
+ 5d3:	ff 75 08             	push   0x8(%ebp)
+ 5d6:	e8 d3 fc ff ff       	call   2ae <write>
+ 5db:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5de:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e3:	e9 c3 fe ff ff       	jmp    4ab <printf+0x45>
+        putc(fd, '%');
+ 5e8:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ec:	83 ec 04             	sub    $0x4,%esp
+ 5ef:	6a 01                	push   $0x1
+ 5f1:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5f4:	57                   	push   %edi
+ 5f5:	ff 75 08             	push   0x8(%ebp)
+ 5f8:	e8 b1 fc ff ff       	call   2ae <write>
+        putc(fd, c);
+ 5fd:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 600:	83 c4 0c             	add    $0xc,%esp
+ 603:	6a 01                	push   $0x1
+ 605:	57                   	push   %edi
+ 606:	ff 75 08             	push   0x8(%ebp)
+ 609:	e8 a0 fc ff ff       	call   2ae <write>
+        putc(fd, c);
+ 60e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 611:	bf 00 00 00 00       	mov    $0x0,%edi
+ 616:	e9 90 fe ff ff       	jmp    4ab <printf+0x45>
+    }
+  }
+}
+ 61b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 61e:	5b                   	pop    %ebx
+ 61f:	5e                   	pop    %esi
+ 620:	5f                   	pop    %edi
+ 621:	5d                   	pop    %ebp
+ 622:	c3                   	ret
+
+00000623 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 623:	55                   	push   %ebp
+ 624:	89 e5                	mov    %esp,%ebp
+ 626:	57                   	push   %edi
+ 627:	56                   	push   %esi
+ 628:	53                   	push   %ebx
+ 629:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 62c:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 62f:	a1 74 0a 00 00       	mov    0xa74,%eax
+ 634:	eb 0c                	jmp    642 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 636:	8b 10                	mov    (%eax),%edx
+ 638:	39 d0                	cmp    %edx,%eax
+ 63a:	72 04                	jb     640 <free+0x1d>
+ 63c:	39 d1                	cmp    %edx,%ecx
+ 63e:	72 10                	jb     650 <free+0x2d>
+{
+ 640:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 642:	39 c8                	cmp    %ecx,%eax
+ 644:	73 f0                	jae    636 <free+0x13>
+ 646:	8b 10                	mov    (%eax),%edx
+ 648:	39 d1                	cmp    %edx,%ecx
+ 64a:	72 04                	jb     650 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 64c:	39 d0                	cmp    %edx,%eax
+ 64e:	72 f0                	jb     640 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 650:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 653:	8b 10                	mov    (%eax),%edx
+ 655:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 658:	39 fa                	cmp    %edi,%edx
+ 65a:	74 19                	je     675 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 65c:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 65f:	8b 50 04             	mov    0x4(%eax),%edx
+ 662:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 665:	39 f1                	cmp    %esi,%ecx
+ 667:	74 18                	je     681 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 669:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 66b:	a3 74 0a 00 00       	mov    %eax,0xa74
+}
+ 670:	5b                   	pop    %ebx
+ 671:	5e                   	pop    %esi
+ 672:	5f                   	pop    %edi
+ 673:	5d                   	pop    %ebp
+ 674:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 675:	03 72 04             	add    0x4(%edx),%esi
+ 678:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 67b:	8b 10                	mov    (%eax),%edx
+ 67d:	8b 12                	mov    (%edx),%edx
+ 67f:	eb db                	jmp    65c <free+0x39>
+    p->s.size += bp->s.size;
+ 681:	03 53 fc             	add    -0x4(%ebx),%edx
+ 684:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 687:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 68a:	eb dd                	jmp    669 <free+0x46>
+
+0000068c <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 68c:	55                   	push   %ebp
+ 68d:	89 e5                	mov    %esp,%ebp
+ 68f:	57                   	push   %edi
+ 690:	56                   	push   %esi
+ 691:	53                   	push   %ebx
+ 692:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 695:	8b 45 08             	mov    0x8(%ebp),%eax
+ 698:	8d 58 07             	lea    0x7(%eax),%ebx
+ 69b:	c1 eb 03             	shr    $0x3,%ebx
+ 69e:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6a1:	8b 15 74 0a 00 00    	mov    0xa74,%edx
+ 6a7:	85 d2                	test   %edx,%edx
+ 6a9:	74 1c                	je     6c7 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6ab:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6ad:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6b0:	39 d9                	cmp    %ebx,%ecx
+ 6b2:	73 38                	jae    6ec <malloc+0x60>
+  if(nu < 4096)
+ 6b4:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6b9:	39 f3                	cmp    %esi,%ebx
+ 6bb:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6be:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6c5:	eb 72                	jmp    739 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6c7:	c7 05 74 0a 00 00 78 	movl   $0xa78,0xa74
+ 6ce:	0a 00 00 
+ 6d1:	c7 05 78 0a 00 00 78 	movl   $0xa78,0xa78
+ 6d8:	0a 00 00 
+    base.s.size = 0;
+ 6db:	c7 05 7c 0a 00 00 00 	movl   $0x0,0xa7c
+ 6e2:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e5:	b8 78 0a 00 00       	mov    $0xa78,%eax
+    if(p->s.size >= nunits){
+ 6ea:	eb c8                	jmp    6b4 <malloc+0x28>
+      if(p->s.size == nunits)
+ 6ec:	39 cb                	cmp    %ecx,%ebx
+ 6ee:	74 1e                	je     70e <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6f0:	29 d9                	sub    %ebx,%ecx
+ 6f2:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6f5:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 6f8:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6fb:	89 15 74 0a 00 00    	mov    %edx,0xa74
+      return (void*)(p + 1);
+ 701:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 704:	89 d0                	mov    %edx,%eax
+ 706:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 709:	5b                   	pop    %ebx
+ 70a:	5e                   	pop    %esi
+ 70b:	5f                   	pop    %edi
+ 70c:	5d                   	pop    %ebp
+ 70d:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 70e:	8b 08                	mov    (%eax),%ecx
+ 710:	89 0a                	mov    %ecx,(%edx)
+ 712:	eb e7                	jmp    6fb <malloc+0x6f>
+  hp->s.size = nu;
+ 714:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 717:	83 ec 0c             	sub    $0xc,%esp
+ 71a:	83 c0 08             	add    $0x8,%eax
+ 71d:	50                   	push   %eax
+ 71e:	e8 00 ff ff ff       	call   623 <free>
+  return freep;
+ 723:	8b 15 74 0a 00 00    	mov    0xa74,%edx
+      if((p = morecore(nunits)) == 0)
+ 729:	83 c4 10             	add    $0x10,%esp
+ 72c:	85 d2                	test   %edx,%edx
+ 72e:	74 d4                	je     704 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 730:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 732:	8b 48 04             	mov    0x4(%eax),%ecx
+ 735:	39 d9                	cmp    %ebx,%ecx
+ 737:	73 b3                	jae    6ec <malloc+0x60>
+    if(p == freep)
+ 739:	89 c2                	mov    %eax,%edx
+ 73b:	39 05 74 0a 00 00    	cmp    %eax,0xa74
+ 741:	75 ed                	jne    730 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	57                   	push   %edi
+ 747:	e8 ca fb ff ff       	call   316 <sbrk>
+  if(p == (char*)-1)
+ 74c:	83 c4 10             	add    $0x10,%esp
+ 74f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 752:	75 c0                	jne    714 <malloc+0x88>
+        return 0;
+ 754:	ba 00 00 00 00       	mov    $0x0,%edx
+ 759:	eb a9                	jmp    704 <malloc+0x78>
@@ -0,0 +1,1452 @@
+
+_testuidgid:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "Done!\n");
+  return 0;
+}
+
+int
+main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  uint uid = getuid();
+   f:	e8 ff 05 00 00       	call   613 <getuid>
+  printf(1, "Current UID is: %d\n", uid);
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	68 30 0a 00 00       	push   $0xa30
+  1d:	6a 01                	push   $0x1
+  1f:	e8 17 07 00 00       	call   73b <printf>
+  printf(1, "Setting UID to %d\n", nval);
+  24:	83 c4 0c             	add    $0xc,%esp
+  27:	6a 64                	push   $0x64
+  29:	68 44 0a 00 00       	push   $0xa44
+  2e:	6a 01                	push   $0x1
+  30:	e8 06 07 00 00       	call   73b <printf>
+  if (setuid(nval) < 0)
+  35:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+  3c:	e8 ea 05 00 00       	call   62b <setuid>
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	85 c0                	test   %eax,%eax
+  46:	0f 88 dd 01 00 00    	js     229 <main+0x229>
+  uid = getuid();
+  4c:	e8 c2 05 00 00       	call   613 <getuid>
+  printf(1, "Current UID is: %d\n", uid);
+  51:	83 ec 04             	sub    $0x4,%esp
+  54:	50                   	push   %eax
+  55:	68 30 0a 00 00       	push   $0xa30
+  5a:	6a 01                	push   $0x1
+  5c:	e8 da 06 00 00       	call   73b <printf>
+  sleep(5 * TPS);  // now type control-p
+  61:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+  68:	e8 86 05 00 00       	call   5f3 <sleep>
+  uint gid = getgid();
+  6d:	e8 a9 05 00 00       	call   61b <getgid>
+  printf(1, "Current GID is: %d\n", gid);
+  72:	83 c4 0c             	add    $0xc,%esp
+  75:	50                   	push   %eax
+  76:	68 6f 0a 00 00       	push   $0xa6f
+  7b:	6a 01                	push   $0x1
+  7d:	e8 b9 06 00 00       	call   73b <printf>
+  printf(1, "Setting GID to %d\n", nval);
+  82:	83 c4 0c             	add    $0xc,%esp
+  85:	68 c8 00 00 00       	push   $0xc8
+  8a:	68 83 0a 00 00       	push   $0xa83
+  8f:	6a 01                	push   $0x1
+  91:	e8 a5 06 00 00       	call   73b <printf>
+  if (setgid(nval) < 0)
+  96:	c7 04 24 c8 00 00 00 	movl   $0xc8,(%esp)
+  9d:	e8 91 05 00 00       	call   633 <setgid>
+  a2:	83 c4 10             	add    $0x10,%esp
+  a5:	85 c0                	test   %eax,%eax
+  a7:	0f 88 95 01 00 00    	js     242 <main+0x242>
+  setgid(nval);
+  ad:	83 ec 0c             	sub    $0xc,%esp
+  b0:	68 c8 00 00 00       	push   $0xc8
+  b5:	e8 79 05 00 00       	call   633 <setgid>
+  gid = getgid();
+  ba:	e8 5c 05 00 00       	call   61b <getgid>
+  printf(1, "Current GID is: %d\n", gid);
+  bf:	83 c4 0c             	add    $0xc,%esp
+  c2:	50                   	push   %eax
+  c3:	68 6f 0a 00 00       	push   $0xa6f
+  c8:	6a 01                	push   $0x1
+  ca:	e8 6c 06 00 00       	call   73b <printf>
+  sleep(5 * TPS);  // now type control-p
+  cf:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+  d6:	e8 18 05 00 00       	call   5f3 <sleep>
+  ppid = getppid();
+  db:	e8 43 05 00 00       	call   623 <getppid>
+  printf(1, "My parent process is: %d\n", ppid);
+  e0:	83 c4 0c             	add    $0xc,%esp
+  e3:	50                   	push   %eax
+  e4:	68 ae 0a 00 00       	push   $0xaae
+  e9:	6a 01                	push   $0x1
+  eb:	e8 4b 06 00 00       	call   73b <printf>
+  printf(1, "Setting UID to %d and GID to %d before fork(). Value"
+  f0:	6a 6f                	push   $0x6f
+  f2:	6a 6f                	push   $0x6f
+  f4:	68 d0 0a 00 00       	push   $0xad0
+  f9:	6a 01                	push   $0x1
+  fb:	e8 3b 06 00 00       	call   73b <printf>
+  if (setuid(nval) < 0)
+ 100:	83 c4 14             	add    $0x14,%esp
+ 103:	6a 6f                	push   $0x6f
+ 105:	e8 21 05 00 00       	call   62b <setuid>
+ 10a:	83 c4 10             	add    $0x10,%esp
+ 10d:	85 c0                	test   %eax,%eax
+ 10f:	0f 88 49 01 00 00    	js     25e <main+0x25e>
+  if (setgid(nval) < 0)
+ 115:	83 ec 0c             	sub    $0xc,%esp
+ 118:	6a 6f                	push   $0x6f
+ 11a:	e8 14 05 00 00       	call   633 <setgid>
+ 11f:	83 c4 10             	add    $0x10,%esp
+ 122:	85 c0                	test   %eax,%eax
+ 124:	0f 88 4d 01 00 00    	js     277 <main+0x277>
+  printf(1, "Before fork(), UID = %d, GID = %d\n", getuid(), getgid());
+ 12a:	e8 ec 04 00 00       	call   61b <getgid>
+ 12f:	89 c3                	mov    %eax,%ebx
+ 131:	e8 dd 04 00 00       	call   613 <getuid>
+ 136:	53                   	push   %ebx
+ 137:	50                   	push   %eax
+ 138:	68 1c 0b 00 00       	push   $0xb1c
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 f7 05 00 00       	call   73b <printf>
+  pid = fork();
+ 144:	e8 12 04 00 00       	call   55b <fork>
+  if (pid == 0) {  // child
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	85 c0                	test   %eax,%eax
+ 14e:	0f 84 3c 01 00 00    	je     290 <main+0x290>
+    sleep(10 * TPS); // wait for child to exit before proceeding
+ 154:	83 ec 0c             	sub    $0xc,%esp
+ 157:	68 10 27 00 00       	push   $0x2710
+ 15c:	e8 92 04 00 00       	call   5f3 <sleep>
+  printf(1, "Setting UID to %d. This test should FAIL\n", nval);
+ 161:	83 c4 0c             	add    $0xc,%esp
+ 164:	68 20 80 00 00       	push   $0x8020
+ 169:	68 60 0b 00 00       	push   $0xb60
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 c6 05 00 00       	call   73b <printf>
+  if (setuid(nval) < 0)
+ 175:	c7 04 24 20 80 00 00 	movl   $0x8020,(%esp)
+ 17c:	e8 aa 04 00 00       	call   62b <setuid>
+ 181:	83 c4 10             	add    $0x10,%esp
+ 184:	85 c0                	test   %eax,%eax
+ 186:	0f 88 2f 01 00 00    	js     2bb <main+0x2bb>
+    printf(2, "FAILURE! The setuid system call indicates success\n");
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	68 c0 0b 00 00       	push   $0xbc0
+ 194:	6a 02                	push   $0x2
+ 196:	e8 a0 05 00 00       	call   73b <printf>
+ 19b:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Setting GID to %d. This test should FAIL\n", nval);
+ 19e:	83 ec 04             	sub    $0x4,%esp
+ 1a1:	68 20 80 00 00       	push   $0x8020
+ 1a6:	68 f4 0b 00 00       	push   $0xbf4
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 89 05 00 00       	call   73b <printf>
+  if (setgid(nval) < 0)
+ 1b2:	c7 04 24 20 80 00 00 	movl   $0x8020,(%esp)
+ 1b9:	e8 75 04 00 00       	call   633 <setgid>
+ 1be:	83 c4 10             	add    $0x10,%esp
+ 1c1:	85 c0                	test   %eax,%eax
+ 1c3:	0f 88 09 01 00 00    	js     2d2 <main+0x2d2>
+    printf(2, "FAILURE! The setgid system call indicates success\n");
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	68 54 0c 00 00       	push   $0xc54
+ 1d1:	6a 02                	push   $0x2
+ 1d3:	e8 63 05 00 00       	call   73b <printf>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Setting UID to %d. This test should FAIL\n", -1);
+ 1db:	83 ec 04             	sub    $0x4,%esp
+ 1de:	6a ff                	push   $0xffffffff
+ 1e0:	68 60 0b 00 00       	push   $0xb60
+ 1e5:	6a 01                	push   $0x1
+ 1e7:	e8 4f 05 00 00       	call   73b <printf>
+  if (setuid(-1) < 0)
+ 1ec:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 1f3:	e8 33 04 00 00       	call   62b <setuid>
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	85 c0                	test   %eax,%eax
+ 1fd:	0f 88 e6 00 00 00    	js     2e9 <main+0x2e9>
+    printf(2, "FAILURE! The setgid system call indicates success\n");
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	68 54 0c 00 00       	push   $0xc54
+ 20b:	6a 02                	push   $0x2
+ 20d:	e8 29 05 00 00       	call   73b <printf>
+ 212:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Done!\n");
+ 215:	83 ec 08             	sub    $0x8,%esp
+ 218:	68 c8 0a 00 00       	push   $0xac8
+ 21d:	6a 01                	push   $0x1
+ 21f:	e8 17 05 00 00       	call   73b <printf>
+  testuidgid();
+  exit();
+ 224:	e8 3a 03 00 00       	call   563 <exit>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 229:	83 ec 04             	sub    $0x4,%esp
+ 22c:	6a 64                	push   $0x64
+ 22e:	68 57 0a 00 00       	push   $0xa57
+ 233:	6a 02                	push   $0x2
+ 235:	e8 01 05 00 00       	call   73b <printf>
+ 23a:	83 c4 10             	add    $0x10,%esp
+ 23d:	e9 0a fe ff ff       	jmp    4c <main+0x4c>
+    printf(2, "Error. Invalid GID: %d\n", nval);
+ 242:	83 ec 04             	sub    $0x4,%esp
+ 245:	68 c8 00 00 00       	push   $0xc8
+ 24a:	68 96 0a 00 00       	push   $0xa96
+ 24f:	6a 02                	push   $0x2
+ 251:	e8 e5 04 00 00       	call   73b <printf>
+ 256:	83 c4 10             	add    $0x10,%esp
+ 259:	e9 4f fe ff ff       	jmp    ad <main+0xad>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 25e:	83 ec 04             	sub    $0x4,%esp
+ 261:	6a 6f                	push   $0x6f
+ 263:	68 57 0a 00 00       	push   $0xa57
+ 268:	6a 02                	push   $0x2
+ 26a:	e8 cc 04 00 00       	call   73b <printf>
+ 26f:	83 c4 10             	add    $0x10,%esp
+ 272:	e9 9e fe ff ff       	jmp    115 <main+0x115>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 277:	83 ec 04             	sub    $0x4,%esp
+ 27a:	6a 6f                	push   $0x6f
+ 27c:	68 57 0a 00 00       	push   $0xa57
+ 281:	6a 02                	push   $0x2
+ 283:	e8 b3 04 00 00       	call   73b <printf>
+ 288:	83 c4 10             	add    $0x10,%esp
+ 28b:	e9 9a fe ff ff       	jmp    12a <main+0x12a>
+    uid = getuid();
+ 290:	e8 7e 03 00 00       	call   613 <getuid>
+ 295:	89 c3                	mov    %eax,%ebx
+    gid = getgid();
+ 297:	e8 7f 03 00 00       	call   61b <getgid>
+    printf(1, "Child: UID is: %d, GID is: %d\n", uid, gid);
+ 29c:	50                   	push   %eax
+ 29d:	53                   	push   %ebx
+ 29e:	68 40 0b 00 00       	push   $0xb40
+ 2a3:	6a 01                	push   $0x1
+ 2a5:	e8 91 04 00 00       	call   73b <printf>
+    sleep(5 * TPS);  // now type control-p
+ 2aa:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+ 2b1:	e8 3d 03 00 00       	call   5f3 <sleep>
+    exit();
+ 2b6:	e8 a8 02 00 00       	call   563 <exit>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+ 2bb:	83 ec 08             	sub    $0x8,%esp
+ 2be:	68 8c 0b 00 00       	push   $0xb8c
+ 2c3:	6a 01                	push   $0x1
+ 2c5:	e8 71 04 00 00       	call   73b <printf>
+ 2ca:	83 c4 10             	add    $0x10,%esp
+ 2cd:	e9 cc fe ff ff       	jmp    19e <main+0x19e>
+    printf(1, "SUCCESS! The setgid sytem call indicated failure\n");
+ 2d2:	83 ec 08             	sub    $0x8,%esp
+ 2d5:	68 20 0c 00 00       	push   $0xc20
+ 2da:	6a 01                	push   $0x1
+ 2dc:	e8 5a 04 00 00       	call   73b <printf>
+ 2e1:	83 c4 10             	add    $0x10,%esp
+ 2e4:	e9 f2 fe ff ff       	jmp    1db <main+0x1db>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	68 8c 0b 00 00       	push   $0xb8c
+ 2f1:	6a 01                	push   $0x1
+ 2f3:	e8 43 04 00 00       	call   73b <printf>
+ 2f8:	83 c4 10             	add    $0x10,%esp
+ 2fb:	e9 15 ff ff ff       	jmp    215 <main+0x215>
+
+00000300 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 307:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 30a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 30f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 313:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 316:	83 c0 01             	add    $0x1,%eax
+ 319:	84 d2                	test   %dl,%dl
+ 31b:	75 f2                	jne    30f <strcpy+0xf>
+    ;
+  return os;
+}
+ 31d:	89 c8                	mov    %ecx,%eax
+ 31f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 322:	c9                   	leave
+ 323:	c3                   	ret
+
+00000324 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 324:	55                   	push   %ebp
+ 325:	89 e5                	mov    %esp,%ebp
+ 327:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 32a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 32d:	0f b6 01             	movzbl (%ecx),%eax
+ 330:	84 c0                	test   %al,%al
+ 332:	74 11                	je     345 <strcmp+0x21>
+ 334:	38 02                	cmp    %al,(%edx)
+ 336:	75 0d                	jne    345 <strcmp+0x21>
+    p++, q++;
+ 338:	83 c1 01             	add    $0x1,%ecx
+ 33b:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 33e:	0f b6 01             	movzbl (%ecx),%eax
+ 341:	84 c0                	test   %al,%al
+ 343:	75 ef                	jne    334 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 345:	0f b6 c0             	movzbl %al,%eax
+ 348:	0f b6 12             	movzbl (%edx),%edx
+ 34b:	29 d0                	sub    %edx,%eax
+}
+ 34d:	5d                   	pop    %ebp
+ 34e:	c3                   	ret
+
+0000034f <strlen>:
+
+uint
+strlen(char *s)
+{
+ 34f:	55                   	push   %ebp
+ 350:	89 e5                	mov    %esp,%ebp
+ 352:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 355:	80 3a 00             	cmpb   $0x0,(%edx)
+ 358:	74 14                	je     36e <strlen+0x1f>
+ 35a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 35f:	83 c0 01             	add    $0x1,%eax
+ 362:	89 c1                	mov    %eax,%ecx
+ 364:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 368:	75 f5                	jne    35f <strlen+0x10>
+    ;
+  return n;
+}
+ 36a:	89 c8                	mov    %ecx,%eax
+ 36c:	5d                   	pop    %ebp
+ 36d:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 36e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 373:	eb f5                	jmp    36a <strlen+0x1b>
+
+00000375 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 375:	55                   	push   %ebp
+ 376:	89 e5                	mov    %esp,%ebp
+ 378:	57                   	push   %edi
+ 379:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 37c:	89 d7                	mov    %edx,%edi
+ 37e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 381:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 384:	fc                   	cld
+ 385:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 387:	89 d0                	mov    %edx,%eax
+ 389:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 38c:	c9                   	leave
+ 38d:	c3                   	ret
+
+0000038e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 38e:	55                   	push   %ebp
+ 38f:	89 e5                	mov    %esp,%ebp
+ 391:	8b 45 08             	mov    0x8(%ebp),%eax
+ 394:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 398:	0f b6 10             	movzbl (%eax),%edx
+ 39b:	84 d2                	test   %dl,%dl
+ 39d:	74 15                	je     3b4 <strchr+0x26>
+    if(*s == c)
+ 39f:	38 d1                	cmp    %dl,%cl
+ 3a1:	74 0f                	je     3b2 <strchr+0x24>
+  for(; *s; s++)
+ 3a3:	83 c0 01             	add    $0x1,%eax
+ 3a6:	0f b6 10             	movzbl (%eax),%edx
+ 3a9:	84 d2                	test   %dl,%dl
+ 3ab:	75 f2                	jne    39f <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 3ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	c3                   	ret
+  return 0;
+ 3b4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3b9:	eb f7                	jmp    3b2 <strchr+0x24>
+
+000003bb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3bb:	55                   	push   %ebp
+ 3bc:	89 e5                	mov    %esp,%ebp
+ 3be:	57                   	push   %edi
+ 3bf:	56                   	push   %esi
+ 3c0:	53                   	push   %ebx
+ 3c1:	83 ec 2c             	sub    $0x2c,%esp
+ 3c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 3cc:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 3cf:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 3d2:	83 c3 01             	add    $0x1,%ebx
+ 3d5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3d8:	7d 27                	jge    401 <gets+0x46>
+    cc = read(0, &c, 1);
+ 3da:	83 ec 04             	sub    $0x4,%esp
+ 3dd:	6a 01                	push   $0x1
+ 3df:	57                   	push   %edi
+ 3e0:	6a 00                	push   $0x0
+ 3e2:	e8 94 01 00 00       	call   57b <read>
+    if(cc < 1)
+ 3e7:	83 c4 10             	add    $0x10,%esp
+ 3ea:	85 c0                	test   %eax,%eax
+ 3ec:	7e 13                	jle    401 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 3ee:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3f2:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3f6:	3c 0a                	cmp    $0xa,%al
+ 3f8:	74 04                	je     3fe <gets+0x43>
+ 3fa:	3c 0d                	cmp    $0xd,%al
+ 3fc:	75 d1                	jne    3cf <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 3fe:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 401:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 404:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 408:	89 f0                	mov    %esi,%eax
+ 40a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 40d:	5b                   	pop    %ebx
+ 40e:	5e                   	pop    %esi
+ 40f:	5f                   	pop    %edi
+ 410:	5d                   	pop    %ebp
+ 411:	c3                   	ret
+
+00000412 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 412:	55                   	push   %ebp
+ 413:	89 e5                	mov    %esp,%ebp
+ 415:	56                   	push   %esi
+ 416:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 417:	83 ec 08             	sub    $0x8,%esp
+ 41a:	6a 00                	push   $0x0
+ 41c:	ff 75 08             	push   0x8(%ebp)
+ 41f:	e8 7f 01 00 00       	call   5a3 <open>
+  if(fd < 0)
+ 424:	83 c4 10             	add    $0x10,%esp
+ 427:	85 c0                	test   %eax,%eax
+ 429:	78 24                	js     44f <stat+0x3d>
+ 42b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 42d:	83 ec 08             	sub    $0x8,%esp
+ 430:	ff 75 0c             	push   0xc(%ebp)
+ 433:	50                   	push   %eax
+ 434:	e8 82 01 00 00       	call   5bb <fstat>
+ 439:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 43b:	89 1c 24             	mov    %ebx,(%esp)
+ 43e:	e8 48 01 00 00       	call   58b <close>
+  return r;
+ 443:	83 c4 10             	add    $0x10,%esp
+}
+ 446:	89 f0                	mov    %esi,%eax
+ 448:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 44b:	5b                   	pop    %ebx
+ 44c:	5e                   	pop    %esi
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+    return -1;
+ 44f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 454:	eb f0                	jmp    446 <stat+0x34>
+
+00000456 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 456:	55                   	push   %ebp
+ 457:	89 e5                	mov    %esp,%ebp
+ 459:	56                   	push   %esi
+ 45a:	53                   	push   %ebx
+ 45b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 45e:	0f b6 0a             	movzbl (%edx),%ecx
+ 461:	80 f9 20             	cmp    $0x20,%cl
+ 464:	75 0b                	jne    471 <atoi+0x1b>
+ 466:	83 c2 01             	add    $0x1,%edx
+ 469:	0f b6 0a             	movzbl (%edx),%ecx
+ 46c:	80 f9 20             	cmp    $0x20,%cl
+ 46f:	74 f5                	je     466 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 471:	80 f9 2d             	cmp    $0x2d,%cl
+ 474:	74 3c                	je     4b2 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 476:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 479:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 47e:	f6 c1 fd             	test   $0xfd,%cl
+ 481:	74 34                	je     4b7 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 483:	0f b6 0a             	movzbl (%edx),%ecx
+ 486:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 489:	3c 09                	cmp    $0x9,%al
+ 48b:	77 2f                	ja     4bc <atoi+0x66>
+ 48d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 492:	83 c2 01             	add    $0x1,%edx
+ 495:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 498:	0f be c9             	movsbl %cl,%ecx
+ 49b:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 49f:	0f b6 0a             	movzbl (%edx),%ecx
+ 4a2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4a5:	3c 09                	cmp    $0x9,%al
+ 4a7:	76 e9                	jbe    492 <atoi+0x3c>
+  return sign*n;
+ 4a9:	89 f0                	mov    %esi,%eax
+ 4ab:	0f af c3             	imul   %ebx,%eax
+}
+ 4ae:	5b                   	pop    %ebx
+ 4af:	5e                   	pop    %esi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 4b2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 4b7:	83 c2 01             	add    $0x1,%edx
+ 4ba:	eb c7                	jmp    483 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 4bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4c1:	eb e6                	jmp    4a9 <atoi+0x53>
+
+000004c3 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 4c3:	55                   	push   %ebp
+ 4c4:	89 e5                	mov    %esp,%ebp
+ 4c6:	56                   	push   %esi
+ 4c7:	53                   	push   %ebx
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4cb:	0f b6 0a             	movzbl (%edx),%ecx
+ 4ce:	80 f9 20             	cmp    $0x20,%cl
+ 4d1:	75 0b                	jne    4de <atoo+0x1b>
+ 4d3:	83 c2 01             	add    $0x1,%edx
+ 4d6:	0f b6 0a             	movzbl (%edx),%ecx
+ 4d9:	80 f9 20             	cmp    $0x20,%cl
+ 4dc:	74 f5                	je     4d3 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4de:	80 f9 2d             	cmp    $0x2d,%cl
+ 4e1:	74 3a                	je     51d <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 4e3:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 4e6:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4eb:	f6 c1 fd             	test   $0xfd,%cl
+ 4ee:	74 32                	je     522 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 4f0:	0f b6 0a             	movzbl (%edx),%ecx
+ 4f3:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4f6:	80 fb 07             	cmp    $0x7,%bl
+ 4f9:	77 2c                	ja     527 <atoo+0x64>
+ 4fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 500:	83 c2 01             	add    $0x1,%edx
+ 503:	0f be c9             	movsbl %cl,%ecx
+ 506:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 50a:	0f b6 0a             	movzbl (%edx),%ecx
+ 50d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 510:	3c 07                	cmp    $0x7,%al
+ 512:	76 ec                	jbe    500 <atoo+0x3d>
+  return sign*n;
+ 514:	89 f0                	mov    %esi,%eax
+ 516:	0f af c3             	imul   %ebx,%eax
+}
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5d                   	pop    %ebp
+ 51c:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 51d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 522:	83 c2 01             	add    $0x1,%edx
+ 525:	eb c9                	jmp    4f0 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 527:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 52c:	eb e6                	jmp    514 <atoo+0x51>
+
+0000052e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 52e:	55                   	push   %ebp
+ 52f:	89 e5                	mov    %esp,%ebp
+ 531:	56                   	push   %esi
+ 532:	53                   	push   %ebx
+ 533:	8b 75 08             	mov    0x8(%ebp),%esi
+ 536:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 539:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 53c:	85 db                	test   %ebx,%ebx
+ 53e:	7e 15                	jle    555 <memmove+0x27>
+ 540:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 542:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 544:	83 c2 01             	add    $0x1,%edx
+ 547:	83 c0 01             	add    $0x1,%eax
+ 54a:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 54e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 551:	39 c3                	cmp    %eax,%ebx
+ 553:	75 ef                	jne    544 <memmove+0x16>
+  return vdst;
+}
+ 555:	89 f0                	mov    %esi,%eax
+ 557:	5b                   	pop    %ebx
+ 558:	5e                   	pop    %esi
+ 559:	5d                   	pop    %ebp
+ 55a:	c3                   	ret
+
+0000055b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 55b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <exit>:
+SYSCALL(exit)
+ 563:	b8 02 00 00 00       	mov    $0x2,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <wait>:
+SYSCALL(wait)
+ 56b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <pipe>:
+SYSCALL(pipe)
+ 573:	b8 04 00 00 00       	mov    $0x4,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <read>:
+SYSCALL(read)
+ 57b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <write>:
+SYSCALL(write)
+ 583:	b8 10 00 00 00       	mov    $0x10,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <close>:
+SYSCALL(close)
+ 58b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <kill>:
+SYSCALL(kill)
+ 593:	b8 06 00 00 00       	mov    $0x6,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <exec>:
+SYSCALL(exec)
+ 59b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <open>:
+SYSCALL(open)
+ 5a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <mknod>:
+SYSCALL(mknod)
+ 5ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <unlink>:
+SYSCALL(unlink)
+ 5b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <fstat>:
+SYSCALL(fstat)
+ 5bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <link>:
+SYSCALL(link)
+ 5c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mkdir>:
+SYSCALL(mkdir)
+ 5cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <chdir>:
+SYSCALL(chdir)
+ 5d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <dup>:
+SYSCALL(dup)
+ 5db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <getpid>:
+SYSCALL(getpid)
+ 5e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <sbrk>:
+SYSCALL(sbrk)
+ 5eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <sleep>:
+SYSCALL(sleep)
+ 5f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <uptime>:
+SYSCALL(uptime)
+ 5fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <halt>:
+SYSCALL(halt)
+ 603:	b8 16 00 00 00       	mov    $0x16,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <date>:
+SYSCALL(date)
+ 60b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <getuid>:
+SYSCALL(getuid)
+ 613:	b8 18 00 00 00       	mov    $0x18,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <getgid>:
+SYSCALL(getgid)
+ 61b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <getppid>:
+SYSCALL(getppid)
+ 623:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <setuid>:
+SYSCALL(setuid)
+ 62b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <setgid>:
+SYSCALL(setgid)
+ 633:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getprocs>:
+SYSCALL(getprocs)
+ 63b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <setpriority>:
+SYSCALL(setpriority)
+ 643:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <getpriority>:
+SYSCALL(getpriority)
+ 64b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <waitpid>:
+SYSCALL(waitpid)
+ 653:	b8 20 00 00 00       	mov    $0x20,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <setaffinity>:
+SYSCALL(setaffinity)
+ 65b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getaffinity>:
+SYSCALL(getaffinity)
+ 663:	b8 22 00 00 00       	mov    $0x22,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <setdeadline>:
+SYSCALL(setdeadline)
+ 66b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <schedctl>:
+SYSCALL(schedctl)
+ 673:	b8 24 00 00 00       	mov    $0x24,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <spawn>:
+SYSCALL(spawn)
+ 67b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <vmstats>:
+SYSCALL(vmstats)
+ 683:	b8 26 00 00 00       	mov    $0x26,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <hugesbrk>:
+SYSCALL(hugesbrk)
+ 68b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <setshares>:
+SYSCALL(setshares)
+ 693:	b8 28 00 00 00       	mov    $0x28,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <getshares>:
+SYSCALL(getshares)
+ 69b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a3:	55                   	push   %ebp
+ 6a4:	89 e5                	mov    %esp,%ebp
+ 6a6:	57                   	push   %edi
+ 6a7:	56                   	push   %esi
+ 6a8:	53                   	push   %ebx
+ 6a9:	83 ec 3c             	sub    $0x3c,%esp
+ 6ac:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6af:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 6b1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 6b5:	74 79                	je     730 <printint+0x8d>
+ 6b7:	85 d2                	test   %edx,%edx
+ 6b9:	79 75                	jns    730 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 6bb:	89 d1                	mov    %edx,%ecx
+ 6bd:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6bf:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 6cb:	89 df                	mov    %ebx,%edi
+ 6cd:	83 c3 01             	add    $0x1,%ebx
+ 6d0:	89 c8                	mov    %ecx,%eax
+ 6d2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6d7:	f7 f6                	div    %esi
+ 6d9:	0f b6 92 e8 0c 00 00 	movzbl 0xce8(%edx),%edx
+ 6e0:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 6e4:	89 ca                	mov    %ecx,%edx
+ 6e6:	89 c1                	mov    %eax,%ecx
+ 6e8:	39 f2                	cmp    %esi,%edx
+ 6ea:	73 df                	jae    6cb <printint+0x28>
+  if(neg)
+ 6ec:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 6f0:	74 08                	je     6fa <printint+0x57>
+    buf[i++] = '-';
+ 6f2:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 6f7:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 6fa:	85 db                	test   %ebx,%ebx
+ 6fc:	7e 2a                	jle    728 <printint+0x85>
+ 6fe:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 701:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 705:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 708:	0f b6 03             	movzbl (%ebx),%eax
+ 70b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 70e:	83 ec 04             	sub    $0x4,%esp
+ 711:	6a 01                	push   $0x1
+ 713:	57                   	push   %edi
+ 714:	ff 75 c4             	push   -0x3c(%ebp)
+ 717:	e8 67 fe ff ff       	call   583 <write>
+  while(--i >= 0)
+ 71c:	89 d8                	mov    %ebx,%eax
+ 71e:	83 eb 01             	sub    $0x1,%ebx
+ 721:	83 c4 10             	add    $0x10,%esp
+ 724:	39 f0                	cmp    %esi,%eax
+ 726:	75 e0                	jne    708 <printint+0x65>
+}
+ 728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72b:	5b                   	pop    %ebx
+ 72c:	5e                   	pop    %esi
+ 72d:	5f                   	pop    %edi
+ 72e:	5d                   	pop    %ebp
+ 72f:	c3                   	ret
+    x = xx;
+ 730:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 732:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 739:	eb 8b                	jmp    6c6 <printint+0x23>
+
+0000073b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 73b:	55                   	push   %ebp
+ 73c:	89 e5                	mov    %esp,%ebp
+ 73e:	57                   	push   %edi
+ 73f:	56                   	push   %esi
+ 740:	53                   	push   %ebx
+ 741:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 744:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 747:	0f b6 1e             	movzbl (%esi),%ebx
+ 74a:	84 db                	test   %bl,%bl
+ 74c:	0f 84 9e 01 00 00    	je     8f0 <printf+0x1b5>
+ 752:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 755:	8d 45 10             	lea    0x10(%ebp),%eax
+ 758:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 75b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 760:	eb 2d                	jmp    78f <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 762:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 765:	83 ec 04             	sub    $0x4,%esp
+ 768:	6a 01                	push   $0x1
+ 76a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 76d:	50                   	push   %eax
+ 76e:	ff 75 08             	push   0x8(%ebp)
+ 771:	e8 0d fe ff ff       	call   583 <write>
+        putc(fd, c);
+ 776:	83 c4 10             	add    $0x10,%esp
+ 779:	eb 05                	jmp    780 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 77b:	83 ff 25             	cmp    $0x25,%edi
+ 77e:	74 1f                	je     79f <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 780:	83 c6 01             	add    $0x1,%esi
+ 783:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 787:	84 db                	test   %bl,%bl
+ 789:	0f 84 61 01 00 00    	je     8f0 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 78f:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 792:	85 ff                	test   %edi,%edi
+ 794:	75 e5                	jne    77b <printf+0x40>
+      if(c == '%'){
+ 796:	83 f8 25             	cmp    $0x25,%eax
+ 799:	75 c7                	jne    762 <printf+0x27>
+        state = '%';
+ 79b:	89 c7                	mov    %eax,%edi
+ 79d:	eb e1                	jmp    780 <printf+0x45>
+      if(c == 'd'){
+ 79f:	83 f8 25             	cmp    $0x25,%eax
+ 7a2:	0f 84 f4 00 00 00    	je     89c <printf+0x161>
+ 7a8:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 7ab:	83 fa 15             	cmp    $0x15,%edx
+ 7ae:	0f 87 09 01 00 00    	ja     8bd <printf+0x182>
+ 7b4:	0f 87 03 01 00 00    	ja     8bd <printf+0x182>
+ 7ba:	ff 24 95 90 0c 00 00 	jmp    *0xc90(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 7c1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7c4:	8b 17                	mov    (%edi),%edx
+ 7c6:	83 ec 0c             	sub    $0xc,%esp
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d3:	e8 cb fe ff ff       	call   6a3 <printint>
+        ap++;
+ 7d8:	83 c7 04             	add    $0x4,%edi
+ 7db:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 7de:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 7e1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7e6:	eb 98                	jmp    780 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 7e8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 7eb:	8b 17                	mov    (%edi),%edx
+ 7ed:	83 ec 0c             	sub    $0xc,%esp
+ 7f0:	6a 00                	push   $0x0
+ 7f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7fa:	e8 a4 fe ff ff       	call   6a3 <printint>
+        ap++;
+ 7ff:	83 c7 04             	add    $0x4,%edi
+ 802:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 805:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 808:	bf 00 00 00 00       	mov    $0x0,%edi
+ 80d:	e9 6e ff ff ff       	jmp    780 <printf+0x45>
+        s = (char*)*ap;
+ 812:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 815:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 817:	83 c1 04             	add    $0x4,%ecx
+ 81a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 81d:	85 c0                	test   %eax,%eax
+ 81f:	74 13                	je     834 <printf+0xf9>
+        s = (char*)*ap;
+ 821:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 823:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 826:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 82b:	84 c0                	test   %al,%al
+ 82d:	75 0f                	jne    83e <printf+0x103>
+ 82f:	e9 4c ff ff ff       	jmp    780 <printf+0x45>
+          s = "(null)";
+ 834:	bb 87 0c 00 00       	mov    $0xc87,%ebx
+        while(*s != 0){
+ 839:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 83e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 841:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 844:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 847:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 84a:	83 ec 04             	sub    $0x4,%esp
+ 84d:	6a 01                	push   $0x1
+ 84f:	57                   	push   %edi
+ 850:	56                   	push   %esi
+ 851:	e8 2d fd ff ff       	call   583 <write>
+          s++;
+ 856:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 859:	0f b6 03             	movzbl (%ebx),%eax
+ 85c:	83 c4 10             	add    $0x10,%esp
+ 85f:	84 c0                	test   %al,%al
+ 861:	75 e4                	jne    847 <printf+0x10c>
+      state = 0;
+ 863:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 866:	bf 00 00 00 00       	mov    $0x0,%edi
+ 86b:	e9 10 ff ff ff       	jmp    780 <printf+0x45>
+        putc(fd, *ap);
+ 870:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 873:	8b 07                	mov    (%edi),%eax
+ 875:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 878:	83 ec 04             	sub    $0x4,%esp
+ 87b:	6a 01                	push   $0x1
+ 87d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 880:	50                   	push   %eax
+ 881:	ff 75 08             	push   0x8(%ebp)
+ 884:	e8 fa fc ff ff       	call   583 <write>
+        ap++;
+ 889:	83 c7 04             	add    $0x4,%edi
+ 88c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 88f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 892:	bf 00 00 00 00       	mov    $0x0,%edi
+ 897:	e9 e4 fe ff ff       	jmp    780 <printf+0x45>
+        putc(fd, c);
+ 89c:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 89f:	83 ec 04             	sub    $0x4,%esp
+ 8a2:	6a 01                	push   $0x1
+ 8a4:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8a7:	50                   	push   %eax
+ 8a8:	ff 75 08             	push   0x8(%ebp)
+ 8ab:	e8 d3 fc ff ff       	call   583 <write>
+ 8b0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8b3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8b8:	e9 c3 fe ff ff       	jmp    780 <printf+0x45>
+        putc(fd, '%');
+ 8bd:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c1:	83 ec 04             	sub    $0x4,%esp
+ 8c4:	6a 01                	push   $0x1
+ 8c6:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 8c9:	57                   	push   %edi
+ 8ca:	ff 75 08             	push   0x8(%ebp)
+ 8cd:	e8 b1 fc ff ff       	call   583 <write>
+        putc(fd, c);
+ 8d2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8d5:	83 c4 0c             	add    $0xc,%esp
+ 8d8:	6a 01                	push   $0x1
+ 8da:	57                   	push   %edi
+ 8db:	ff 75 08             	push   0x8(%ebp)
+ 8de:	e8 a0 fc ff ff       	call   583 <write>
+        putc(fd, c);
+ 8e3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8e6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8eb:	e9 90 fe ff ff       	jmp    780 <printf+0x45>
+    }
+  }
+}
+ 8f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8f3:	5b                   	pop    %ebx
+ 8f4:	5e                   	pop    %esi
+ 8f5:	5f                   	pop    %edi
+ 8f6:	5d                   	pop    %ebp
+ 8f7:	c3                   	ret
+
+000008f8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8f8:	55                   	push   %ebp
+ 8f9:	89 e5                	mov    %esp,%ebp
+ 8fb:	57                   	push   %edi
+ 8fc:	56                   	push   %esi
+ 8fd:	53                   	push   %ebx
+ 8fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 901:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 904:	a1 84 0f 00 00       	mov    0xf84,%eax
+ 909:	eb 0c                	jmp    917 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 90b:	8b 10                	mov    (%eax),%edx
+ 90d:	39 d0                	cmp    %edx,%eax
+ 90f:	72 04                	jb     915 <free+0x1d>
+ 911:	39 d1                	cmp    %edx,%ecx
+ 913:	72 10                	jb     925 <free+0x2d>
+{
+ 915:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 917:	39 c8                	cmp    %ecx,%eax
+ 919:	73 f0                	jae    90b <free+0x13>
+ 91b:	8b 10                	mov    (%eax),%edx
+ 91d:	39 d1                	cmp    %edx,%ecx
+ 91f:	72 04                	jb     925 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 921:	39 d0                	cmp    %edx,%eax
+ 923:	72 f0                	jb     915 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 925:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 928:	8b 10                	mov    (%eax),%edx
+ 92a:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 92d:	39 fa                	cmp    %edi,%edx
+ 92f:	74 19                	je     94a <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 931:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 934:	8b 50 04             	mov    0x4(%eax),%edx
+ 937:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 93a:	39 f1                	cmp    %esi,%ecx
+ 93c:	74 18                	je     956 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 93e:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 940:	a3 84 0f 00 00       	mov    %eax,0xf84
+}
+ 945:	5b                   	pop    %ebx
+ 946:	5e                   	pop    %esi
+ 947:	5f                   	pop    %edi
+ 948:	5d                   	pop    %ebp
+ 949:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 94a:	03 72 04             	add    0x4(%edx),%esi
+ 94d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 950:	8b 10                	mov    (%eax),%edx
+ 952:	8b 12                	mov    (%edx),%edx
+ 954:	eb db                	jmp    931 <free+0x39>
+    p->s.size += bp->s.size;
+ 956:	03 53 fc             	add    -0x4(%ebx),%edx
+ 959:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 95c:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 95f:	eb dd                	jmp    93e <free+0x46>
+
+00000961 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 961:	55                   	push   %ebp
+ 962:	89 e5                	mov    %esp,%ebp
+ 964:	57                   	push   %edi
+ 965:	56                   	push   %esi
+ 966:	53                   	push   %ebx
+ 967:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 96a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96d:	8d 58 07             	lea    0x7(%eax),%ebx
+ 970:	c1 eb 03             	shr    $0x3,%ebx
+ 973:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 976:	8b 15 84 0f 00 00    	mov    0xf84,%edx
+ 97c:	85 d2                	test   %edx,%edx
+ 97e:	74 1c                	je     99c <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 980:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 982:	8b 48 04             	mov    0x4(%eax),%ecx
+ 985:	39 d9                	cmp    %ebx,%ecx
+ 987:	73 38                	jae    9c1 <malloc+0x60>
+  if(nu < 4096)
+ 989:	be 00 10 00 00       	mov    $0x1000,%esi
+ 98e:	39 f3                	cmp    %esi,%ebx
+ 990:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 993:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 99a:	eb 72                	jmp    a0e <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 99c:	c7 05 84 0f 00 00 88 	movl   $0xf88,0xf84
+ 9a3:	0f 00 00 
+ 9a6:	c7 05 88 0f 00 00 88 	movl   $0xf88,0xf88
+ 9ad:	0f 00 00 
+    base.s.size = 0;
+ 9b0:	c7 05 8c 0f 00 00 00 	movl   $0x0,0xf8c
+ 9b7:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9ba:	b8 88 0f 00 00       	mov    $0xf88,%eax
+    if(p->s.size >= nunits){
+ 9bf:	eb c8                	jmp    989 <malloc+0x28>
+      if(p->s.size == nunits)
+ 9c1:	39 cb                	cmp    %ecx,%ebx
+ 9c3:	74 1e                	je     9e3 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 9c5:	29 d9                	sub    %ebx,%ecx
+ 9c7:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9ca:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9cd:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 9d0:	89 15 84 0f 00 00    	mov    %edx,0xf84
+      return (void*)(p + 1);
+ 9d6:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 9d9:	89 d0                	mov    %edx,%eax
+ 9db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9de:	5b                   	pop    %ebx
+ 9df:	5e                   	pop    %esi
+ 9e0:	5f                   	pop    %edi
+ 9e1:	5d                   	pop    %ebp
+ 9e2:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 9e3:	8b 08                	mov    (%eax),%ecx
+ 9e5:	89 0a                	mov    %ecx,(%edx)
+ 9e7:	eb e7                	jmp    9d0 <malloc+0x6f>
+  hp->s.size = nu;
+ 9e9:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 9ec:	83 ec 0c             	sub    $0xc,%esp
+ 9ef:	83 c0 08             	add    $0x8,%eax
+ 9f2:	50                   	push   %eax
+ 9f3:	e8 00 ff ff ff       	call   8f8 <free>
+  return freep;
+ 9f8:	8b 15 84 0f 00 00    	mov    0xf84,%edx
+      if((p = morecore(nunits)) == 0)
+ 9fe:	83 c4 10             	add    $0x10,%esp
+ a01:	85 d2                	test   %edx,%edx
+ a03:	74 d4                	je     9d9 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a05:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a07:	8b 48 04             	mov    0x4(%eax),%ecx
+ a0a:	39 d9                	cmp    %ebx,%ecx
+ a0c:	73 b3                	jae    9c1 <malloc+0x60>
+    if(p == freep)
+ a0e:	89 c2                	mov    %eax,%edx
+ a10:	39 05 84 0f 00 00    	cmp    %eax,0xf84
+ a16:	75 ed                	jne    a05 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ a18:	83 ec 0c             	sub    $0xc,%esp
+ a1b:	57                   	push   %edi
+ a1c:	e8 ca fb ff ff       	call   5eb <sbrk>
+  if(p == (char*)-1)
+ a21:	83 c4 10             	add    $0x10,%esp
+ a24:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a27:	75 c0                	jne    9e9 <malloc+0x88>
+        return 0;
+ a29:	ba 00 00 00 00       	mov    $0x0,%edx
+ a2e:	eb a9                	jmp    9d9 <malloc+0x78>
@@ -0,0 +1,1303 @@
+
+_time:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char * argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	8b 59 04             	mov    0x4(%ecx),%ebx
+    printf(1,"Time took 1110.00 seconds.\n");
+    exit();
+  }
+  */
+
+  int start_time = uptime();
+  16:	e8 9d 03 00 00       	call   3b8 <uptime>
+  1b:	89 c6                	mov    %eax,%esi
+#ifdef CS333_P4
+  // spawn() keeps copying this process out of the timing.  A command
+  // that cannot run is timed anyway, as a failed exec in a child is.
+  int pid = spawn(argv[1], argv+1, 0);
+  1d:	83 ec 04             	sub    $0x4,%esp
+  20:	6a 00                	push   $0x0
+  22:	8d 43 04             	lea    0x4(%ebx),%eax
+  25:	50                   	push   %eax
+  26:	ff 73 04             	push   0x4(%ebx)
+  29:	e8 0a 04 00 00       	call   438 <spawn>
+
+  if(pid > 0)
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	85 c0                	test   %eax,%eax
+  33:	7f 48                	jg     7d <main+0x7d>
+  }
+
+  wait();
+#endif // CS333_P4
+
+  int end_time = uptime();
+  35:	e8 7e 03 00 00       	call   3b8 <uptime>
+  int total_time = end_time - start_time;
+  3a:	29 f0                	sub    %esi,%eax
+  3c:	89 c1                	mov    %eax,%ecx
+
+  int s  = total_time / 1000;
+  3e:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  43:	f7 ea                	imul   %edx
+  45:	c1 fa 06             	sar    $0x6,%edx
+  48:	89 c8                	mov    %ecx,%eax
+  4a:	c1 f8 1f             	sar    $0x1f,%eax
+  4d:	29 c2                	sub    %eax,%edx
+  int ms = total_time % 1000;
+  4f:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+  55:	29 c1                	sub    %eax,%ecx
+
+  if(ms >= 100)
+  57:	83 f9 63             	cmp    $0x63,%ecx
+  5a:	7f 2f                	jg     8b <main+0x8b>
+    printf(1, "%s ran in %d.%d seconds.\n", argv[1],s,ms);
+  else if(ms < 10)
+  5c:	83 f9 09             	cmp    $0x9,%ecx
+  5f:	7f 43                	jg     a4 <main+0xa4>
+    printf(1, "%s ran in %d.00%d seconds.\n", argv[1],s,ms);
+  61:	83 ec 0c             	sub    $0xc,%esp
+  64:	51                   	push   %ecx
+  65:	52                   	push   %edx
+  66:	ff 73 04             	push   0x4(%ebx)
+  69:	68 0a 08 00 00       	push   $0x80a
+  6e:	6a 01                	push   $0x1
+  70:	e8 83 04 00 00       	call   4f8 <printf>
+  75:	83 c4 20             	add    $0x20,%esp
+  else
+    printf(1, "%s ran in %d.0%d seconds.\n", argv[1],s,ms);
+
+  exit();
+  78:	e8 a3 02 00 00       	call   320 <exit>
+    waitpid(pid);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	50                   	push   %eax
+  81:	e8 8a 03 00 00       	call   410 <waitpid>
+  86:	83 c4 10             	add    $0x10,%esp
+  89:	eb aa                	jmp    35 <main+0x35>
+    printf(1, "%s ran in %d.%d seconds.\n", argv[1],s,ms);
+  8b:	83 ec 0c             	sub    $0xc,%esp
+  8e:	51                   	push   %ecx
+  8f:	52                   	push   %edx
+  90:	ff 73 04             	push   0x4(%ebx)
+  93:	68 f0 07 00 00       	push   $0x7f0
+  98:	6a 01                	push   $0x1
+  9a:	e8 59 04 00 00       	call   4f8 <printf>
+  9f:	83 c4 20             	add    $0x20,%esp
+  a2:	eb d4                	jmp    78 <main+0x78>
+    printf(1, "%s ran in %d.0%d seconds.\n", argv[1],s,ms);
+  a4:	83 ec 0c             	sub    $0xc,%esp
+  a7:	51                   	push   %ecx
+  a8:	52                   	push   %edx
+  a9:	ff 73 04             	push   0x4(%ebx)
+  ac:	68 26 08 00 00       	push   $0x826
+  b1:	6a 01                	push   $0x1
+  b3:	e8 40 04 00 00       	call   4f8 <printf>
+  b8:	83 c4 20             	add    $0x20,%esp
+  bb:	eb bb                	jmp    78 <main+0x78>
+
+000000bd <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  bd:	55                   	push   %ebp
+  be:	89 e5                	mov    %esp,%ebp
+  c0:	53                   	push   %ebx
+  c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  cc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  d0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  d3:	83 c0 01             	add    $0x1,%eax
+  d6:	84 d2                	test   %dl,%dl
+  d8:	75 f2                	jne    cc <strcpy+0xf>
+    ;
+  return os;
+}
+  da:	89 c8                	mov    %ecx,%eax
+  dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  df:	c9                   	leave
+  e0:	c3                   	ret
+
+000000e1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e1:	55                   	push   %ebp
+  e2:	89 e5                	mov    %esp,%ebp
+  e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  ea:	0f b6 01             	movzbl (%ecx),%eax
+  ed:	84 c0                	test   %al,%al
+  ef:	74 11                	je     102 <strcmp+0x21>
+  f1:	38 02                	cmp    %al,(%edx)
+  f3:	75 0d                	jne    102 <strcmp+0x21>
+    p++, q++;
+  f5:	83 c1 01             	add    $0x1,%ecx
+  f8:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  fb:	0f b6 01             	movzbl (%ecx),%eax
+  fe:	84 c0                	test   %al,%al
+ 100:	75 ef                	jne    f1 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 102:	0f b6 c0             	movzbl %al,%eax
+ 105:	0f b6 12             	movzbl (%edx),%edx
+ 108:	29 d0                	sub    %edx,%eax
+}
+ 10a:	5d                   	pop    %ebp
+ 10b:	c3                   	ret
+
+0000010c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 10c:	55                   	push   %ebp
+ 10d:	89 e5                	mov    %esp,%ebp
+ 10f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 112:	80 3a 00             	cmpb   $0x0,(%edx)
+ 115:	74 14                	je     12b <strlen+0x1f>
+ 117:	b8 00 00 00 00       	mov    $0x0,%eax
+ 11c:	83 c0 01             	add    $0x1,%eax
+ 11f:	89 c1                	mov    %eax,%ecx
+ 121:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 125:	75 f5                	jne    11c <strlen+0x10>
+    ;
+  return n;
+}
+ 127:	89 c8                	mov    %ecx,%eax
+ 129:	5d                   	pop    %ebp
+ 12a:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 12b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 130:	eb f5                	jmp    127 <strlen+0x1b>
+
+00000132 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 132:	55                   	push   %ebp
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	57                   	push   %edi
+ 136:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 139:	89 d7                	mov    %edx,%edi
+ 13b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 141:	fc                   	cld
+ 142:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 144:	89 d0                	mov    %edx,%eax
+ 146:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 149:	c9                   	leave
+ 14a:	c3                   	ret
+
+0000014b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 14b:	55                   	push   %ebp
+ 14c:	89 e5                	mov    %esp,%ebp
+ 14e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 151:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 155:	0f b6 10             	movzbl (%eax),%edx
+ 158:	84 d2                	test   %dl,%dl
+ 15a:	74 15                	je     171 <strchr+0x26>
+    if(*s == c)
+ 15c:	38 d1                	cmp    %dl,%cl
+ 15e:	74 0f                	je     16f <strchr+0x24>
+  for(; *s; s++)
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	0f b6 10             	movzbl (%eax),%edx
+ 166:	84 d2                	test   %dl,%dl
+ 168:	75 f2                	jne    15c <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 16a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16f:	5d                   	pop    %ebp
+ 170:	c3                   	ret
+  return 0;
+ 171:	b8 00 00 00 00       	mov    $0x0,%eax
+ 176:	eb f7                	jmp    16f <strchr+0x24>
+
+00000178 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	57                   	push   %edi
+ 17c:	56                   	push   %esi
+ 17d:	53                   	push   %ebx
+ 17e:	83 ec 2c             	sub    $0x2c,%esp
+ 181:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 184:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 189:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 18c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 18f:	83 c3 01             	add    $0x1,%ebx
+ 192:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 195:	7d 27                	jge    1be <gets+0x46>
+    cc = read(0, &c, 1);
+ 197:	83 ec 04             	sub    $0x4,%esp
+ 19a:	6a 01                	push   $0x1
+ 19c:	57                   	push   %edi
+ 19d:	6a 00                	push   $0x0
+ 19f:	e8 94 01 00 00       	call   338 <read>
+    if(cc < 1)
+ 1a4:	83 c4 10             	add    $0x10,%esp
+ 1a7:	85 c0                	test   %eax,%eax
+ 1a9:	7e 13                	jle    1be <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1af:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 04                	je     1bb <gets+0x43>
+ 1b7:	3c 0d                	cmp    $0xd,%al
+ 1b9:	75 d1                	jne    18c <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1bb:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1c1:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1c5:	89 f0                	mov    %esi,%eax
+ 1c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5f                   	pop    %edi
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+
+000001cf <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	56                   	push   %esi
+ 1d3:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1d4:	83 ec 08             	sub    $0x8,%esp
+ 1d7:	6a 00                	push   $0x0
+ 1d9:	ff 75 08             	push   0x8(%ebp)
+ 1dc:	e8 7f 01 00 00       	call   360 <open>
+  if(fd < 0)
+ 1e1:	83 c4 10             	add    $0x10,%esp
+ 1e4:	85 c0                	test   %eax,%eax
+ 1e6:	78 24                	js     20c <stat+0x3d>
+ 1e8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1ea:	83 ec 08             	sub    $0x8,%esp
+ 1ed:	ff 75 0c             	push   0xc(%ebp)
+ 1f0:	50                   	push   %eax
+ 1f1:	e8 82 01 00 00       	call   378 <fstat>
+ 1f6:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1f8:	89 1c 24             	mov    %ebx,(%esp)
+ 1fb:	e8 48 01 00 00       	call   348 <close>
+  return r;
+ 200:	83 c4 10             	add    $0x10,%esp
+}
+ 203:	89 f0                	mov    %esi,%eax
+ 205:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 208:	5b                   	pop    %ebx
+ 209:	5e                   	pop    %esi
+ 20a:	5d                   	pop    %ebp
+ 20b:	c3                   	ret
+    return -1;
+ 20c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 211:	eb f0                	jmp    203 <stat+0x34>
+
+00000213 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+ 216:	56                   	push   %esi
+ 217:	53                   	push   %ebx
+ 218:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 21b:	0f b6 0a             	movzbl (%edx),%ecx
+ 21e:	80 f9 20             	cmp    $0x20,%cl
+ 221:	75 0b                	jne    22e <atoi+0x1b>
+ 223:	83 c2 01             	add    $0x1,%edx
+ 226:	0f b6 0a             	movzbl (%edx),%ecx
+ 229:	80 f9 20             	cmp    $0x20,%cl
+ 22c:	74 f5                	je     223 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 22e:	80 f9 2d             	cmp    $0x2d,%cl
+ 231:	74 3c                	je     26f <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 233:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 236:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 23b:	f6 c1 fd             	test   $0xfd,%cl
+ 23e:	74 34                	je     274 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 240:	0f b6 0a             	movzbl (%edx),%ecx
+ 243:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 246:	3c 09                	cmp    $0x9,%al
+ 248:	77 2f                	ja     279 <atoi+0x66>
+ 24a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 24f:	83 c2 01             	add    $0x1,%edx
+ 252:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 255:	0f be c9             	movsbl %cl,%ecx
+ 258:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 25c:	0f b6 0a             	movzbl (%edx),%ecx
+ 25f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 262:	3c 09                	cmp    $0x9,%al
+ 264:	76 e9                	jbe    24f <atoi+0x3c>
+  return sign*n;
+ 266:	89 f0                	mov    %esi,%eax
+ 268:	0f af c3             	imul   %ebx,%eax
+}
+ 26b:	5b                   	pop    %ebx
+ 26c:	5e                   	pop    %esi
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 26f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 274:	83 c2 01             	add    $0x1,%edx
+ 277:	eb c7                	jmp    240 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 279:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 27e:	eb e6                	jmp    266 <atoi+0x53>
+
+00000280 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	56                   	push   %esi
+ 284:	53                   	push   %ebx
+ 285:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 288:	0f b6 0a             	movzbl (%edx),%ecx
+ 28b:	80 f9 20             	cmp    $0x20,%cl
+ 28e:	75 0b                	jne    29b <atoo+0x1b>
+ 290:	83 c2 01             	add    $0x1,%edx
+ 293:	0f b6 0a             	movzbl (%edx),%ecx
+ 296:	80 f9 20             	cmp    $0x20,%cl
+ 299:	74 f5                	je     290 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 29b:	80 f9 2d             	cmp    $0x2d,%cl
+ 29e:	74 3a                	je     2da <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 2a0:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2a3:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2a8:	f6 c1 fd             	test   $0xfd,%cl
+ 2ab:	74 32                	je     2df <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2ad:	0f b6 0a             	movzbl (%edx),%ecx
+ 2b0:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2b3:	80 fb 07             	cmp    $0x7,%bl
+ 2b6:	77 2c                	ja     2e4 <atoo+0x64>
+ 2b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 2bd:	83 c2 01             	add    $0x1,%edx
+ 2c0:	0f be c9             	movsbl %cl,%ecx
+ 2c3:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 2c7:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ca:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2cd:	3c 07                	cmp    $0x7,%al
+ 2cf:	76 ec                	jbe    2bd <atoo+0x3d>
+  return sign*n;
+ 2d1:	89 f0                	mov    %esi,%eax
+ 2d3:	0f af c3             	imul   %ebx,%eax
+}
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5d                   	pop    %ebp
+ 2d9:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 2da:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2df:	83 c2 01             	add    $0x1,%edx
+ 2e2:	eb c9                	jmp    2ad <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 2e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2e9:	eb e6                	jmp    2d1 <atoo+0x51>
+
+000002eb <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2eb:	55                   	push   %ebp
+ 2ec:	89 e5                	mov    %esp,%ebp
+ 2ee:	56                   	push   %esi
+ 2ef:	53                   	push   %ebx
+ 2f0:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2f9:	85 db                	test   %ebx,%ebx
+ 2fb:	7e 15                	jle    312 <memmove+0x27>
+ 2fd:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2ff:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 301:	83 c2 01             	add    $0x1,%edx
+ 304:	83 c0 01             	add    $0x1,%eax
+ 307:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 30b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 30e:	39 c3                	cmp    %eax,%ebx
+ 310:	75 ef                	jne    301 <memmove+0x16>
+  return vdst;
+}
+ 312:	89 f0                	mov    %esi,%eax
+ 314:	5b                   	pop    %ebx
+ 315:	5e                   	pop    %esi
+ 316:	5d                   	pop    %ebp
+ 317:	c3                   	ret
+
+00000318 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 318:	b8 01 00 00 00       	mov    $0x1,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <exit>:
+SYSCALL(exit)
+ 320:	b8 02 00 00 00       	mov    $0x2,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <wait>:
+SYSCALL(wait)
+ 328:	b8 03 00 00 00       	mov    $0x3,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <pipe>:
+SYSCALL(pipe)
+ 330:	b8 04 00 00 00       	mov    $0x4,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <read>:
+SYSCALL(read)
+ 338:	b8 05 00 00 00       	mov    $0x5,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <write>:
+SYSCALL(write)
+ 340:	b8 10 00 00 00       	mov    $0x10,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <close>:
+SYSCALL(close)
+ 348:	b8 15 00 00 00       	mov    $0x15,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <kill>:
+SYSCALL(kill)
+ 350:	b8 06 00 00 00       	mov    $0x6,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <exec>:
+SYSCALL(exec)
+ 358:	b8 07 00 00 00       	mov    $0x7,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <open>:
+SYSCALL(open)
+ 360:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <mknod>:
+SYSCALL(mknod)
+ 368:	b8 11 00 00 00       	mov    $0x11,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <unlink>:
+SYSCALL(unlink)
+ 370:	b8 12 00 00 00       	mov    $0x12,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <fstat>:
+SYSCALL(fstat)
+ 378:	b8 08 00 00 00       	mov    $0x8,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <link>:
+SYSCALL(link)
+ 380:	b8 13 00 00 00       	mov    $0x13,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <mkdir>:
+SYSCALL(mkdir)
+ 388:	b8 14 00 00 00       	mov    $0x14,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <chdir>:
+SYSCALL(chdir)
+ 390:	b8 09 00 00 00       	mov    $0x9,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <dup>:
+SYSCALL(dup)
+ 398:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <getpid>:
+SYSCALL(getpid)
+ 3a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <sbrk>:
+SYSCALL(sbrk)
+ 3a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <sleep>:
+SYSCALL(sleep)
+ 3b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <uptime>:
+SYSCALL(uptime)
+ 3b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <halt>:
+SYSCALL(halt)
+ 3c0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <date>:
+SYSCALL(date)
+ 3c8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <getuid>:
+SYSCALL(getuid)
+ 3d0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <getgid>:
+SYSCALL(getgid)
+ 3d8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <getppid>:
+SYSCALL(getppid)
+ 3e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <setuid>:
+SYSCALL(setuid)
+ 3e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <setgid>:
+SYSCALL(setgid)
+ 3f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <getprocs>:
+SYSCALL(getprocs)
+ 3f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <setpriority>:
+SYSCALL(setpriority)
+ 400:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <getpriority>:
+SYSCALL(getpriority)
+ 408:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <waitpid>:
+SYSCALL(waitpid)
+ 410:	b8 20 00 00 00       	mov    $0x20,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <setaffinity>:
+SYSCALL(setaffinity)
+ 418:	b8 21 00 00 00       	mov    $0x21,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <getaffinity>:
+SYSCALL(getaffinity)
+ 420:	b8 22 00 00 00       	mov    $0x22,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <setdeadline>:
+SYSCALL(setdeadline)
+ 428:	b8 23 00 00 00       	mov    $0x23,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <schedctl>:
+SYSCALL(schedctl)
+ 430:	b8 24 00 00 00       	mov    $0x24,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <spawn>:
+SYSCALL(spawn)
+ 438:	b8 25 00 00 00       	mov    $0x25,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <vmstats>:
+SYSCALL(vmstats)
+ 440:	b8 26 00 00 00       	mov    $0x26,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 448:	b8 27 00 00 00       	mov    $0x27,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <setshares>:
+SYSCALL(setshares)
+ 450:	b8 28 00 00 00       	mov    $0x28,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <getshares>:
+SYSCALL(getshares)
+ 458:	b8 29 00 00 00       	mov    $0x29,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 3c             	sub    $0x3c,%esp
+ 469:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 46c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 46e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 472:	74 79                	je     4ed <printint+0x8d>
+ 474:	85 d2                	test   %edx,%edx
+ 476:	79 75                	jns    4ed <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 478:	89 d1                	mov    %edx,%ecx
+ 47a:	f7 d9                	neg    %ecx
+    neg = 1;
+ 47c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 483:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 488:	89 df                	mov    %ebx,%edi
+ 48a:	83 c3 01             	add    $0x1,%ebx
+ 48d:	89 c8                	mov    %ecx,%eax
+ 48f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 494:	f7 f6                	div    %esi
+ 496:	0f b6 92 a0 08 00 00 	movzbl 0x8a0(%edx),%edx
+ 49d:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4a1:	89 ca                	mov    %ecx,%edx
+ 4a3:	89 c1                	mov    %eax,%ecx
+ 4a5:	39 f2                	cmp    %esi,%edx
+ 4a7:	73 df                	jae    488 <printint+0x28>
+  if(neg)
+ 4a9:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 4ad:	74 08                	je     4b7 <printint+0x57>
+    buf[i++] = '-';
+ 4af:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4b4:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 4b7:	85 db                	test   %ebx,%ebx
+ 4b9:	7e 2a                	jle    4e5 <printint+0x85>
+ 4bb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 4be:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 4c2:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 4c5:	0f b6 03             	movzbl (%ebx),%eax
+ 4c8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4cb:	83 ec 04             	sub    $0x4,%esp
+ 4ce:	6a 01                	push   $0x1
+ 4d0:	57                   	push   %edi
+ 4d1:	ff 75 c4             	push   -0x3c(%ebp)
+ 4d4:	e8 67 fe ff ff       	call   340 <write>
+  while(--i >= 0)
+ 4d9:	89 d8                	mov    %ebx,%eax
+ 4db:	83 eb 01             	sub    $0x1,%ebx
+ 4de:	83 c4 10             	add    $0x10,%esp
+ 4e1:	39 f0                	cmp    %esi,%eax
+ 4e3:	75 e0                	jne    4c5 <printint+0x65>
+}
+ 4e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e8:	5b                   	pop    %ebx
+ 4e9:	5e                   	pop    %esi
+ 4ea:	5f                   	pop    %edi
+ 4eb:	5d                   	pop    %ebp
+ 4ec:	c3                   	ret
+    x = xx;
+ 4ed:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 4ef:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 4f6:	eb 8b                	jmp    483 <printint+0x23>
+
+000004f8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4f8:	55                   	push   %ebp
+ 4f9:	89 e5                	mov    %esp,%ebp
+ 4fb:	57                   	push   %edi
+ 4fc:	56                   	push   %esi
+ 4fd:	53                   	push   %ebx
+ 4fe:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 501:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 504:	0f b6 1e             	movzbl (%esi),%ebx
+ 507:	84 db                	test   %bl,%bl
+ 509:	0f 84 9e 01 00 00    	je     6ad <printf+0x1b5>
+ 50f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 512:	8d 45 10             	lea    0x10(%ebp),%eax
+ 515:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 518:	bf 00 00 00 00       	mov    $0x0,%edi
+ 51d:	eb 2d                	jmp    54c <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 51f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 522:	83 ec 04             	sub    $0x4,%esp
+ 525:	6a 01                	push   $0x1
+ 527:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 52a:	50                   	push   %eax
+ 52b:	ff 75 08             	push   0x8(%ebp)
+ 52e:	e8 0d fe ff ff       	call   340 <write>
+        putc(fd, c);
+ 533:	83 c4 10             	add    $0x10,%esp
+ 536:	eb 05                	jmp    53d <printf+0x45>
+      }
+    } else if(state == '%'){
+ 538:	83 ff 25             	cmp    $0x25,%edi
+ 53b:	74 1f                	je     55c <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 53d:	83 c6 01             	add    $0x1,%esi
+ 540:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 544:	84 db                	test   %bl,%bl
+ 546:	0f 84 61 01 00 00    	je     6ad <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 54c:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 54f:	85 ff                	test   %edi,%edi
+ 551:	75 e5                	jne    538 <printf+0x40>
+      if(c == '%'){
+ 553:	83 f8 25             	cmp    $0x25,%eax
+ 556:	75 c7                	jne    51f <printf+0x27>
+        state = '%';
+ 558:	89 c7                	mov    %eax,%edi
+ 55a:	eb e1                	jmp    53d <printf+0x45>
+      if(c == 'd'){
+ 55c:	83 f8 25             	cmp    $0x25,%eax
+ 55f:	0f 84 f4 00 00 00    	je     659 <printf+0x161>
+ 565:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 568:	83 fa 15             	cmp    $0x15,%edx
+ 56b:	0f 87 09 01 00 00    	ja     67a <printf+0x182>
+ 571:	0f 87 03 01 00 00    	ja     67a <printf+0x182>
+ 577:	ff 24 95 48 08 00 00 	jmp    *0x848(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 57e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 581:	8b 17                	mov    (%edi),%edx
+ 583:	83 ec 0c             	sub    $0xc,%esp
+ 586:	6a 01                	push   $0x1
+ 588:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 58d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 590:	e8 cb fe ff ff       	call   460 <printint>
+        ap++;
+ 595:	83 c7 04             	add    $0x4,%edi
+ 598:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 59b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 59e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5a3:	eb 98                	jmp    53d <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5a5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5a8:	8b 17                	mov    (%edi),%edx
+ 5aa:	83 ec 0c             	sub    $0xc,%esp
+ 5ad:	6a 00                	push   $0x0
+ 5af:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b7:	e8 a4 fe ff ff       	call   460 <printint>
+        ap++;
+ 5bc:	83 c7 04             	add    $0x4,%edi
+ 5bf:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5c2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5c5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ca:	e9 6e ff ff ff       	jmp    53d <printf+0x45>
+        s = (char*)*ap;
+ 5cf:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 5d2:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 5d4:	83 c1 04             	add    $0x4,%ecx
+ 5d7:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 5da:	85 c0                	test   %eax,%eax
+ 5dc:	74 13                	je     5f1 <printf+0xf9>
+        s = (char*)*ap;
+ 5de:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 5e0:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 5e3:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	75 0f                	jne    5fb <printf+0x103>
+ 5ec:	e9 4c ff ff ff       	jmp    53d <printf+0x45>
+          s = "(null)";
+ 5f1:	bb 41 08 00 00       	mov    $0x841,%ebx
+        while(*s != 0){
+ 5f6:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 5fb:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5fe:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 601:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 604:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 607:	83 ec 04             	sub    $0x4,%esp
+ 60a:	6a 01                	push   $0x1
+ 60c:	57                   	push   %edi
+ 60d:	56                   	push   %esi
+ 60e:	e8 2d fd ff ff       	call   340 <write>
+          s++;
+ 613:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 616:	0f b6 03             	movzbl (%ebx),%eax
+ 619:	83 c4 10             	add    $0x10,%esp
+ 61c:	84 c0                	test   %al,%al
+ 61e:	75 e4                	jne    604 <printf+0x10c>
+      state = 0;
+ 620:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 623:	bf 00 00 00 00       	mov    $0x0,%edi
+ 628:	e9 10 ff ff ff       	jmp    53d <printf+0x45>
+        putc(fd, *ap);
+ 62d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 630:	8b 07                	mov    (%edi),%eax
+ 632:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 635:	83 ec 04             	sub    $0x4,%esp
+ 638:	6a 01                	push   $0x1
+ 63a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63d:	50                   	push   %eax
+ 63e:	ff 75 08             	push   0x8(%ebp)
+ 641:	e8 fa fc ff ff       	call   340 <write>
+        ap++;
+ 646:	83 c7 04             	add    $0x4,%edi
+ 649:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 64c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 654:	e9 e4 fe ff ff       	jmp    53d <printf+0x45>
+        putc(fd, c);
+ 659:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 65c:	83 ec 04             	sub    $0x4,%esp
+ 65f:	6a 01                	push   $0x1
+ 661:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 664:	50                   	push   %eax
+ 665:	ff 75 08             	push   0x8(%ebp)
+ 668:	e8 d3 fc ff ff       	call   340 <write>
+ 66d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 670:	bf 00 00 00 00       	mov    $0x0,%edi
+ 675:	e9 c3 fe ff ff       	jmp    53d <printf+0x45>
+        putc(fd, '%');
+ 67a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 67e:	83 ec 04             	sub    $0x4,%esp
+ 681:	6a 01                	push   $0x1
+ 683:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 686:	57                   	push   %edi
+ 687:	ff 75 08             	push   0x8(%ebp)
+ 68a:	e8 b1 fc ff ff       	call   340 <write>
+        putc(fd, c);
+ 68f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 692:	83 c4 0c             	add    $0xc,%esp
+ 695:	6a 01                	push   $0x1
+ 697:	57                   	push   %edi
+ 698:	ff 75 08             	push   0x8(%ebp)
+ 69b:	e8 a0 fc ff ff       	call   340 <write>
+        putc(fd, c);
+ 6a0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6a3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6a8:	e9 90 fe ff ff       	jmp    53d <printf+0x45>
+    }
+  }
+}
+ 6ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b0:	5b                   	pop    %ebx
+ 6b1:	5e                   	pop    %esi
+ 6b2:	5f                   	pop    %edi
+ 6b3:	5d                   	pop    %ebp
+ 6b4:	c3                   	ret
+
+000006b5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6b5:	55                   	push   %ebp
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	57                   	push   %edi
+ 6b9:	56                   	push   %esi
+ 6ba:	53                   	push   %ebx
+ 6bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c1:	a1 40 0b 00 00       	mov    0xb40,%eax
+ 6c6:	eb 0c                	jmp    6d4 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6c8:	8b 10                	mov    (%eax),%edx
+ 6ca:	39 d0                	cmp    %edx,%eax
+ 6cc:	72 04                	jb     6d2 <free+0x1d>
+ 6ce:	39 d1                	cmp    %edx,%ecx
+ 6d0:	72 10                	jb     6e2 <free+0x2d>
+{
+ 6d2:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d4:	39 c8                	cmp    %ecx,%eax
+ 6d6:	73 f0                	jae    6c8 <free+0x13>
+ 6d8:	8b 10                	mov    (%eax),%edx
+ 6da:	39 d1                	cmp    %edx,%ecx
+ 6dc:	72 04                	jb     6e2 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6de:	39 d0                	cmp    %edx,%eax
+ 6e0:	72 f0                	jb     6d2 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e2:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6e5:	8b 10                	mov    (%eax),%edx
+ 6e7:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ea:	39 fa                	cmp    %edi,%edx
+ 6ec:	74 19                	je     707 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ee:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6f1:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f4:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6f7:	39 f1                	cmp    %esi,%ecx
+ 6f9:	74 18                	je     713 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6fb:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6fd:	a3 40 0b 00 00       	mov    %eax,0xb40
+}
+ 702:	5b                   	pop    %ebx
+ 703:	5e                   	pop    %esi
+ 704:	5f                   	pop    %edi
+ 705:	5d                   	pop    %ebp
+ 706:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 707:	03 72 04             	add    0x4(%edx),%esi
+ 70a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 70d:	8b 10                	mov    (%eax),%edx
+ 70f:	8b 12                	mov    (%edx),%edx
+ 711:	eb db                	jmp    6ee <free+0x39>
+    p->s.size += bp->s.size;
+ 713:	03 53 fc             	add    -0x4(%ebx),%edx
+ 716:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 719:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 71c:	eb dd                	jmp    6fb <free+0x46>
+
+0000071e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 71e:	55                   	push   %ebp
+ 71f:	89 e5                	mov    %esp,%ebp
+ 721:	57                   	push   %edi
+ 722:	56                   	push   %esi
+ 723:	53                   	push   %ebx
+ 724:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 727:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 72d:	c1 eb 03             	shr    $0x3,%ebx
+ 730:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 733:	8b 15 40 0b 00 00    	mov    0xb40,%edx
+ 739:	85 d2                	test   %edx,%edx
+ 73b:	74 1c                	je     759 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 73d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 73f:	8b 48 04             	mov    0x4(%eax),%ecx
+ 742:	39 d9                	cmp    %ebx,%ecx
+ 744:	73 38                	jae    77e <malloc+0x60>
+  if(nu < 4096)
+ 746:	be 00 10 00 00       	mov    $0x1000,%esi
+ 74b:	39 f3                	cmp    %esi,%ebx
+ 74d:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 750:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 757:	eb 72                	jmp    7cb <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 759:	c7 05 40 0b 00 00 44 	movl   $0xb44,0xb40
+ 760:	0b 00 00 
+ 763:	c7 05 44 0b 00 00 44 	movl   $0xb44,0xb44
+ 76a:	0b 00 00 
+    base.s.size = 0;
+ 76d:	c7 05 48 0b 00 00 00 	movl   $0x0,0xb48
+ 774:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 777:	b8 44 0b 00 00       	mov    $0xb44,%eax
+    if(p->s.size >= nunits){
+ 77c:	eb c8                	jmp    746 <malloc+0x28>
+      if(p->s.size == nunits)
+ 77e:	39 cb                	cmp    %ecx,%ebx
+ 780:	74 1e                	je     7a0 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 782:	29 d9                	sub    %ebx,%ecx
+ 784:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 787:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 78a:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 78d:	89 15 40 0b 00 00    	mov    %edx,0xb40
+      return (void*)(p + 1);
+ 793:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 796:	89 d0                	mov    %edx,%eax
+ 798:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79b:	5b                   	pop    %ebx
+ 79c:	5e                   	pop    %esi
+ 79d:	5f                   	pop    %edi
+ 79e:	5d                   	pop    %ebp
+ 79f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7a0:	8b 08                	mov    (%eax),%ecx
+ 7a2:	89 0a                	mov    %ecx,(%edx)
+ 7a4:	eb e7                	jmp    78d <malloc+0x6f>
+  hp->s.size = nu;
+ 7a6:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7a9:	83 ec 0c             	sub    $0xc,%esp
+ 7ac:	83 c0 08             	add    $0x8,%eax
+ 7af:	50                   	push   %eax
+ 7b0:	e8 00 ff ff ff       	call   6b5 <free>
+  return freep;
+ 7b5:	8b 15 40 0b 00 00    	mov    0xb40,%edx
+      if((p = morecore(nunits)) == 0)
+ 7bb:	83 c4 10             	add    $0x10,%esp
+ 7be:	85 d2                	test   %edx,%edx
+ 7c0:	74 d4                	je     796 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c2:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7c4:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7c7:	39 d9                	cmp    %ebx,%ecx
+ 7c9:	73 b3                	jae    77e <malloc+0x60>
+    if(p == freep)
+ 7cb:	89 c2                	mov    %eax,%edx
+ 7cd:	39 05 40 0b 00 00    	cmp    %eax,0xb40
+ 7d3:	75 ed                	jne    7c2 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 7d5:	83 ec 0c             	sub    $0xc,%esp
+ 7d8:	57                   	push   %edi
+ 7d9:	e8 ca fb ff ff       	call   3a8 <sbrk>
+  if(p == (char*)-1)
+ 7de:	83 c4 10             	add    $0x10,%esp
+ 7e1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7e4:	75 c0                	jne    7a6 <malloc+0x88>
+        return 0;
+ 7e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7eb:	eb a9                	jmp    796 <malloc+0x78>
@@ -51,13 +51,26 @@ trap(struct trapframe *tf)
     syscall();
     if(myproc()->killed)
       exit();
+#ifdef CS333_P4
+    // The syscall may have woken a process that outranks us.
+    if(myproc()->needresched)
+      yield();
+#endif // CS333_P4
     return;
   }
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
+#ifdef PDX_TICKLESS
+    // An idle cpu 0 catches ticks up itself; see tickless().
+    if(cpuid() == 0 && !mycpu()->tickless){
+#else
     if(cpuid() == 0){
-#ifdef PDX_XV6
+#endif // PDX_TICKLESS
+#ifdef CS333_P4
+      atom_inc((int *)&ticks);
+      timertick();
+#elif PDX_XV6
       atom_inc((int *)&ticks);
       wakeup(&ticks);
 #else
@@ -67,6 +80,10 @@ trap(struct trapframe *tf)
       release(&tickslock);
 #endif // PDX_XV6
     }
+#ifdef CS333_P4
+    if(myproc())
+      edftick(myproc());
+#endif // CS333_P4
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -84,6 +101,13 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+#ifdef CS333_P4
+  case T_IRQ0 + IRQ_RESCHED:
+    // Just getting here gets a halted cpu back to its scheduler;
+    // a preempted process yields below.
+    lapiceoi();
+    break;
+#endif // CS333_P4
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -91,6 +115,16 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // A user write to a page shared by fork() gets its own copy,
+    // and a first touch of sbrk() or program memory gets a page.
+    // The kernel fills in user buffers before using them (see
+    // uvmtouch()), so a kernel fault is a bug like any other.
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       pagefault(myproc(), rcr2(), tf->err) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -116,13 +150,25 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-#ifdef PDX_XV6
+#ifdef CS333_P4
+    // Each level has its own slice, counted from dispatch.
+    tf->trapno == T_IRQ0+IRQ_TIMER &&
+    ticks - myproc()->cpu_ticks_in >= myproc()->slice)
+#elif PDX_XV6
     tf->trapno == T_IRQ0+IRQ_TIMER && ticks%SCHED_INTERVAL==0)
 #else
     tf->trapno == T_IRQ0+IRQ_TIMER)
 #endif // PDX_XV6
     yield();
 
+#ifdef CS333_P4
+  // Something that outranks this process was queued here; see kick().
+  // Not on a page fault, which the kernel may take holding locks.
+  if(myproc() && myproc()->state == RUNNING && myproc()->needresched &&
+     tf->trapno != T_PGFLT)
+    yield();
+#endif // CS333_P4
+
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
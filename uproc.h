@@ -7,10 +7,26 @@ struct uproc {
   uint gid;
   uint ppid;
   uint priority;
+#ifdef CS333_P4
+  int lastcpu;
+  uint affinity;
+#endif // CS333_P4
   uint elapsed_ticks;
   uint CPU_total_ticks;
+#ifdef CS333_P4
+  uint state;                // One of the UPROC_ codes below
+#else
   char state[STRMAX];
+#endif // CS333_P4
   uint size;
   char name[STRMAX];
 };
+
+#ifdef CS333_P4
+// uproc.state codes, the same values as enum procstate in proc.h.
+#define UPROC_SLEEPING 2
+#define UPROC_RUNNABLE 3
+#define UPROC_RUNNING  4
+#define UPROC_ZOMBIE   5
+#endif // CS333_P4
 #endif // CS333_P2
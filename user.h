@@ -3,6 +3,11 @@ struct rtcdate;
 #ifdef CS333_P2
 struct uproc;
 #endif // CS333_P2
+#ifdef CS333_P4
+struct schedparams;
+struct spawnfd;
+struct vmstats;
+#endif // CS333_P4
 
 // system calls
 int fork(void);
@@ -41,7 +46,19 @@ int getprocs(uint max, struct uproc *);
 #ifdef CS333_P4
 int setpriority(int, int);
 int getpriority(int);
+int waitpid(int);
+int setaffinity(int, uint);
+int getaffinity(int);
+int setdeadline(int, int, int);
+int schedctl(int, struct schedparams*);
+int spawn(char*, char**, struct spawnfd*);
+int vmstats(struct vmstats*);
+char* hugesbrk(int);
 #endif // CS333_P4
+#ifdef PDX_STRIDE
+int setshares(uint, uint);
+int getshares(uint);
+#endif // PDX_STRIDE
 // ulib.c
 int stat(char*, struct stat*);
 char* strcpy(char*, char*);
@@ -0,0 +1,7300 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+       6:	68 5c 3d 00 00       	push   $0x3d5c
+       b:	ff 35 64 5d 00 00    	push   0x5d64
+      11:	e8 bb 39 00 00       	call   39d1 <printf>
+
+  if(mkdir("iputdir") < 0){
+      16:	c7 04 24 ef 3c 00 00 	movl   $0x3cef,(%esp)
+      1d:	e8 3f 38 00 00       	call   3861 <mkdir>
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	78 54                	js     7d <iputtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+  if(chdir("iputdir") < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 ef 3c 00 00       	push   $0x3cef
+      31:	e8 33 38 00 00       	call   3869 <chdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	78 58                	js     95 <iputtest+0x95>
+    printf(stdout, "chdir iputdir failed\n");
+    exit();
+  }
+  if(unlink("../iputdir") < 0){
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	68 ec 3c 00 00       	push   $0x3cec
+      45:	e8 ff 37 00 00       	call   3849 <unlink>
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	85 c0                	test   %eax,%eax
+      4f:	78 5c                	js     ad <iputtest+0xad>
+    printf(stdout, "unlink ../iputdir failed\n");
+    exit();
+  }
+  if(chdir("/") < 0){
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	68 11 3d 00 00       	push   $0x3d11
+      59:	e8 0b 38 00 00       	call   3869 <chdir>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	78 60                	js     c5 <iputtest+0xc5>
+    printf(stdout, "chdir / failed\n");
+    exit();
+  }
+  printf(stdout, "iput test ok\n");
+      65:	83 ec 08             	sub    $0x8,%esp
+      68:	68 94 3d 00 00       	push   $0x3d94
+      6d:	ff 35 64 5d 00 00    	push   0x5d64
+      73:	e8 59 39 00 00       	call   39d1 <printf>
+}
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	c9                   	leave
+      7c:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 c8 3c 00 00       	push   $0x3cc8
+      85:	ff 35 64 5d 00 00    	push   0x5d64
+      8b:	e8 41 39 00 00       	call   39d1 <printf>
+    exit();
+      90:	e8 64 37 00 00       	call   37f9 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 d6 3c 00 00       	push   $0x3cd6
+      9d:	ff 35 64 5d 00 00    	push   0x5d64
+      a3:	e8 29 39 00 00       	call   39d1 <printf>
+    exit();
+      a8:	e8 4c 37 00 00       	call   37f9 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 f7 3c 00 00       	push   $0x3cf7
+      b5:	ff 35 64 5d 00 00    	push   0x5d64
+      bb:	e8 11 39 00 00       	call   39d1 <printf>
+    exit();
+      c0:	e8 34 37 00 00       	call   37f9 <exit>
+    printf(stdout, "chdir / failed\n");
+      c5:	83 ec 08             	sub    $0x8,%esp
+      c8:	68 13 3d 00 00       	push   $0x3d13
+      cd:	ff 35 64 5d 00 00    	push   0x5d64
+      d3:	e8 f9 38 00 00       	call   39d1 <printf>
+    exit();
+      d8:	e8 1c 37 00 00       	call   37f9 <exit>
+
+000000dd <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      dd:	55                   	push   %ebp
+      de:	89 e5                	mov    %esp,%ebp
+      e0:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      e3:	68 23 3d 00 00       	push   $0x3d23
+      e8:	ff 35 64 5d 00 00    	push   0x5d64
+      ee:	e8 de 38 00 00       	call   39d1 <printf>
+
+  pid = fork();
+      f3:	e8 f9 36 00 00       	call   37f1 <fork>
+  if(pid < 0){
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	78 47                	js     146 <exitiputtest+0x69>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      ff:	0f 85 a1 00 00 00    	jne    1a6 <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 ef 3c 00 00       	push   $0x3cef
+     10d:	e8 4f 37 00 00       	call   3861 <mkdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	78 45                	js     15e <exitiputtest+0x81>
+      printf(stdout, "mkdir failed\n");
+      exit();
+    }
+    if(chdir("iputdir") < 0){
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	68 ef 3c 00 00       	push   $0x3cef
+     121:	e8 43 37 00 00       	call   3869 <chdir>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	85 c0                	test   %eax,%eax
+     12b:	78 49                	js     176 <exitiputtest+0x99>
+      printf(stdout, "child chdir failed\n");
+      exit();
+    }
+    if(unlink("../iputdir") < 0){
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 ec 3c 00 00       	push   $0x3cec
+     135:	e8 0f 37 00 00       	call   3849 <unlink>
+     13a:	83 c4 10             	add    $0x10,%esp
+     13d:	85 c0                	test   %eax,%eax
+     13f:	78 4d                	js     18e <exitiputtest+0xb1>
+      printf(stdout, "unlink ../iputdir failed\n");
+      exit();
+    }
+    exit();
+     141:	e8 b3 36 00 00       	call   37f9 <exit>
+    printf(stdout, "fork failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 09 4c 00 00       	push   $0x4c09
+     14e:	ff 35 64 5d 00 00    	push   0x5d64
+     154:	e8 78 38 00 00       	call   39d1 <printf>
+    exit();
+     159:	e8 9b 36 00 00       	call   37f9 <exit>
+      printf(stdout, "mkdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 c8 3c 00 00       	push   $0x3cc8
+     166:	ff 35 64 5d 00 00    	push   0x5d64
+     16c:	e8 60 38 00 00       	call   39d1 <printf>
+      exit();
+     171:	e8 83 36 00 00       	call   37f9 <exit>
+      printf(stdout, "child chdir failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 32 3d 00 00       	push   $0x3d32
+     17e:	ff 35 64 5d 00 00    	push   0x5d64
+     184:	e8 48 38 00 00       	call   39d1 <printf>
+      exit();
+     189:	e8 6b 36 00 00       	call   37f9 <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 f7 3c 00 00       	push   $0x3cf7
+     196:	ff 35 64 5d 00 00    	push   0x5d64
+     19c:	e8 30 38 00 00       	call   39d1 <printf>
+      exit();
+     1a1:	e8 53 36 00 00       	call   37f9 <exit>
+  }
+  wait();
+     1a6:	e8 56 36 00 00       	call   3801 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1ab:	83 ec 08             	sub    $0x8,%esp
+     1ae:	68 46 3d 00 00       	push   $0x3d46
+     1b3:	ff 35 64 5d 00 00    	push   0x5d64
+     1b9:	e8 13 38 00 00       	call   39d1 <printf>
+}
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	c9                   	leave
+     1c2:	c3                   	ret
+
+000001c3 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1c3:	55                   	push   %ebp
+     1c4:	89 e5                	mov    %esp,%ebp
+     1c6:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1c9:	68 58 3d 00 00       	push   $0x3d58
+     1ce:	ff 35 64 5d 00 00    	push   0x5d64
+     1d4:	e8 f8 37 00 00       	call   39d1 <printf>
+  if(mkdir("oidir") < 0){
+     1d9:	c7 04 24 67 3d 00 00 	movl   $0x3d67,(%esp)
+     1e0:	e8 7c 36 00 00       	call   3861 <mkdir>
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	85 c0                	test   %eax,%eax
+     1ea:	78 39                	js     225 <openiputtest+0x62>
+    printf(stdout, "mkdir oidir failed\n");
+    exit();
+  }
+  pid = fork();
+     1ec:	e8 00 36 00 00       	call   37f1 <fork>
+  if(pid < 0){
+     1f1:	85 c0                	test   %eax,%eax
+     1f3:	78 48                	js     23d <openiputtest+0x7a>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     1f5:	75 63                	jne    25a <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     1f7:	83 ec 08             	sub    $0x8,%esp
+     1fa:	6a 02                	push   $0x2
+     1fc:	68 67 3d 00 00       	push   $0x3d67
+     201:	e8 33 36 00 00       	call   3839 <open>
+    if(fd >= 0){
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	85 c0                	test   %eax,%eax
+     20b:	78 48                	js     255 <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     20d:	83 ec 08             	sub    $0x8,%esp
+     210:	68 ec 4c 00 00       	push   $0x4cec
+     215:	ff 35 64 5d 00 00    	push   0x5d64
+     21b:	e8 b1 37 00 00       	call   39d1 <printf>
+      exit();
+     220:	e8 d4 35 00 00       	call   37f9 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 6d 3d 00 00       	push   $0x3d6d
+     22d:	ff 35 64 5d 00 00    	push   0x5d64
+     233:	e8 99 37 00 00       	call   39d1 <printf>
+    exit();
+     238:	e8 bc 35 00 00       	call   37f9 <exit>
+    printf(stdout, "fork failed\n");
+     23d:	83 ec 08             	sub    $0x8,%esp
+     240:	68 09 4c 00 00       	push   $0x4c09
+     245:	ff 35 64 5d 00 00    	push   0x5d64
+     24b:	e8 81 37 00 00       	call   39d1 <printf>
+    exit();
+     250:	e8 a4 35 00 00       	call   37f9 <exit>
+    }
+    exit();
+     255:	e8 9f 35 00 00       	call   37f9 <exit>
+  }
+  sleep(1);
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	6a 01                	push   $0x1
+     25f:	e8 25 36 00 00       	call   3889 <sleep>
+  if(unlink("oidir") != 0){
+     264:	c7 04 24 67 3d 00 00 	movl   $0x3d67,(%esp)
+     26b:	e8 d9 35 00 00       	call   3849 <unlink>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	85 c0                	test   %eax,%eax
+     275:	75 1d                	jne    294 <openiputtest+0xd1>
+    printf(stdout, "unlink failed\n");
+    exit();
+  }
+  wait();
+     277:	e8 85 35 00 00       	call   3801 <wait>
+  printf(stdout, "openiput test ok\n");
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	68 90 3d 00 00       	push   $0x3d90
+     284:	ff 35 64 5d 00 00    	push   0x5d64
+     28a:	e8 42 37 00 00       	call   39d1 <printf>
+}
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	c9                   	leave
+     293:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     294:	83 ec 08             	sub    $0x8,%esp
+     297:	68 81 3d 00 00       	push   $0x3d81
+     29c:	ff 35 64 5d 00 00    	push   0x5d64
+     2a2:	e8 2a 37 00 00       	call   39d1 <printf>
+    exit();
+     2a7:	e8 4d 35 00 00       	call   37f9 <exit>
+
+000002ac <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ac:	55                   	push   %ebp
+     2ad:	89 e5                	mov    %esp,%ebp
+     2af:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     2b2:	68 a2 3d 00 00       	push   $0x3da2
+     2b7:	ff 35 64 5d 00 00    	push   0x5d64
+     2bd:	e8 0f 37 00 00       	call   39d1 <printf>
+  fd = open("echo", 0);
+     2c2:	83 c4 08             	add    $0x8,%esp
+     2c5:	6a 00                	push   $0x0
+     2c7:	68 ad 3d 00 00       	push   $0x3dad
+     2cc:	e8 68 35 00 00       	call   3839 <open>
+  if(fd < 0){
+     2d1:	83 c4 10             	add    $0x10,%esp
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	78 37                	js     30f <opentest+0x63>
+    printf(stdout, "open echo failed!\n");
+    exit();
+  }
+  close(fd);
+     2d8:	83 ec 0c             	sub    $0xc,%esp
+     2db:	50                   	push   %eax
+     2dc:	e8 40 35 00 00       	call   3821 <close>
+  fd = open("doesnotexist", 0);
+     2e1:	83 c4 08             	add    $0x8,%esp
+     2e4:	6a 00                	push   $0x0
+     2e6:	68 c5 3d 00 00       	push   $0x3dc5
+     2eb:	e8 49 35 00 00       	call   3839 <open>
+  if(fd >= 0){
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	79 30                	jns    327 <opentest+0x7b>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    exit();
+  }
+  printf(stdout, "open test ok\n");
+     2f7:	83 ec 08             	sub    $0x8,%esp
+     2fa:	68 f0 3d 00 00       	push   $0x3df0
+     2ff:	ff 35 64 5d 00 00    	push   0x5d64
+     305:	e8 c7 36 00 00       	call   39d1 <printf>
+}
+     30a:	83 c4 10             	add    $0x10,%esp
+     30d:	c9                   	leave
+     30e:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     30f:	83 ec 08             	sub    $0x8,%esp
+     312:	68 b2 3d 00 00       	push   $0x3db2
+     317:	ff 35 64 5d 00 00    	push   0x5d64
+     31d:	e8 af 36 00 00       	call   39d1 <printf>
+    exit();
+     322:	e8 d2 34 00 00       	call   37f9 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     327:	83 ec 08             	sub    $0x8,%esp
+     32a:	68 d2 3d 00 00       	push   $0x3dd2
+     32f:	ff 35 64 5d 00 00    	push   0x5d64
+     335:	e8 97 36 00 00       	call   39d1 <printf>
+    exit();
+     33a:	e8 ba 34 00 00       	call   37f9 <exit>
+
+0000033f <writetest>:
+
+void
+writetest(void)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	56                   	push   %esi
+     343:	53                   	push   %ebx
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	68 fe 3d 00 00       	push   $0x3dfe
+     34c:	ff 35 64 5d 00 00    	push   0x5d64
+     352:	e8 7a 36 00 00       	call   39d1 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     357:	83 c4 08             	add    $0x8,%esp
+     35a:	68 02 02 00 00       	push   $0x202
+     35f:	68 0f 3e 00 00       	push   $0x3e0f
+     364:	e8 d0 34 00 00       	call   3839 <open>
+  if(fd >= 0){
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	85 c0                	test   %eax,%eax
+     36e:	0f 88 17 01 00 00    	js     48b <writetest+0x14c>
+     374:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     376:	83 ec 08             	sub    $0x8,%esp
+     379:	68 15 3e 00 00       	push   $0x3e15
+     37e:	ff 35 64 5d 00 00    	push   0x5d64
+     384:	e8 48 36 00 00       	call   39d1 <printf>
+     389:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     38c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     391:	83 ec 04             	sub    $0x4,%esp
+     394:	6a 0a                	push   $0xa
+     396:	68 4c 3e 00 00       	push   $0x3e4c
+     39b:	56                   	push   %esi
+     39c:	e8 78 34 00 00       	call   3819 <write>
+     3a1:	83 c4 10             	add    $0x10,%esp
+     3a4:	83 f8 0a             	cmp    $0xa,%eax
+     3a7:	0f 85 f6 00 00 00    	jne    4a3 <writetest+0x164>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+      exit();
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3ad:	83 ec 04             	sub    $0x4,%esp
+     3b0:	6a 0a                	push   $0xa
+     3b2:	68 57 3e 00 00       	push   $0x3e57
+     3b7:	56                   	push   %esi
+     3b8:	e8 5c 34 00 00       	call   3819 <write>
+     3bd:	83 c4 10             	add    $0x10,%esp
+     3c0:	83 f8 0a             	cmp    $0xa,%eax
+     3c3:	0f 85 f3 00 00 00    	jne    4bc <writetest+0x17d>
+  for(i = 0; i < 100; i++){
+     3c9:	83 c3 01             	add    $0x1,%ebx
+     3cc:	83 fb 64             	cmp    $0x64,%ebx
+     3cf:	75 c0                	jne    391 <writetest+0x52>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+      exit();
+    }
+  }
+  printf(stdout, "writes ok\n");
+     3d1:	83 ec 08             	sub    $0x8,%esp
+     3d4:	68 62 3e 00 00       	push   $0x3e62
+     3d9:	ff 35 64 5d 00 00    	push   0x5d64
+     3df:	e8 ed 35 00 00       	call   39d1 <printf>
+  close(fd);
+     3e4:	89 34 24             	mov    %esi,(%esp)
+     3e7:	e8 35 34 00 00       	call   3821 <close>
+  fd = open("small", O_RDONLY);
+     3ec:	83 c4 08             	add    $0x8,%esp
+     3ef:	6a 00                	push   $0x0
+     3f1:	68 0f 3e 00 00       	push   $0x3e0f
+     3f6:	e8 3e 34 00 00       	call   3839 <open>
+     3fb:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     3fd:	83 c4 10             	add    $0x10,%esp
+     400:	85 c0                	test   %eax,%eax
+     402:	0f 88 cd 00 00 00    	js     4d5 <writetest+0x196>
+    printf(stdout, "open small succeeded ok\n");
+     408:	83 ec 08             	sub    $0x8,%esp
+     40b:	68 6d 3e 00 00       	push   $0x3e6d
+     410:	ff 35 64 5d 00 00    	push   0x5d64
+     416:	e8 b6 35 00 00       	call   39d1 <printf>
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     41b:	83 c4 0c             	add    $0xc,%esp
+     41e:	68 d0 07 00 00       	push   $0x7d0
+     423:	68 a0 84 00 00       	push   $0x84a0
+     428:	53                   	push   %ebx
+     429:	e8 e3 33 00 00       	call   3811 <read>
+  if(i == 2000){
+     42e:	83 c4 10             	add    $0x10,%esp
+     431:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     436:	0f 85 b1 00 00 00    	jne    4ed <writetest+0x1ae>
+    printf(stdout, "read succeeded ok\n");
+     43c:	83 ec 08             	sub    $0x8,%esp
+     43f:	68 a1 3e 00 00       	push   $0x3ea1
+     444:	ff 35 64 5d 00 00    	push   0x5d64
+     44a:	e8 82 35 00 00       	call   39d1 <printf>
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     44f:	89 1c 24             	mov    %ebx,(%esp)
+     452:	e8 ca 33 00 00       	call   3821 <close>
+
+  if(unlink("small") < 0){
+     457:	c7 04 24 0f 3e 00 00 	movl   $0x3e0f,(%esp)
+     45e:	e8 e6 33 00 00       	call   3849 <unlink>
+     463:	83 c4 10             	add    $0x10,%esp
+     466:	85 c0                	test   %eax,%eax
+     468:	0f 88 97 00 00 00    	js     505 <writetest+0x1c6>
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file test ok\n");
+     46e:	83 ec 08             	sub    $0x8,%esp
+     471:	68 c9 3e 00 00       	push   $0x3ec9
+     476:	ff 35 64 5d 00 00    	push   0x5d64
+     47c:	e8 50 35 00 00       	call   39d1 <printf>
+}
+     481:	83 c4 10             	add    $0x10,%esp
+     484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     487:	5b                   	pop    %ebx
+     488:	5e                   	pop    %esi
+     489:	5d                   	pop    %ebp
+     48a:	c3                   	ret
+    printf(stdout, "error: creat small failed!\n");
+     48b:	83 ec 08             	sub    $0x8,%esp
+     48e:	68 30 3e 00 00       	push   $0x3e30
+     493:	ff 35 64 5d 00 00    	push   0x5d64
+     499:	e8 33 35 00 00       	call   39d1 <printf>
+    exit();
+     49e:	e8 56 33 00 00       	call   37f9 <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     4a3:	83 ec 04             	sub    $0x4,%esp
+     4a6:	53                   	push   %ebx
+     4a7:	68 10 4d 00 00       	push   $0x4d10
+     4ac:	ff 35 64 5d 00 00    	push   0x5d64
+     4b2:	e8 1a 35 00 00       	call   39d1 <printf>
+      exit();
+     4b7:	e8 3d 33 00 00       	call   37f9 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     4bc:	83 ec 04             	sub    $0x4,%esp
+     4bf:	53                   	push   %ebx
+     4c0:	68 34 4d 00 00       	push   $0x4d34
+     4c5:	ff 35 64 5d 00 00    	push   0x5d64
+     4cb:	e8 01 35 00 00       	call   39d1 <printf>
+      exit();
+     4d0:	e8 24 33 00 00       	call   37f9 <exit>
+    printf(stdout, "error: open small failed!\n");
+     4d5:	83 ec 08             	sub    $0x8,%esp
+     4d8:	68 86 3e 00 00       	push   $0x3e86
+     4dd:	ff 35 64 5d 00 00    	push   0x5d64
+     4e3:	e8 e9 34 00 00       	call   39d1 <printf>
+    exit();
+     4e8:	e8 0c 33 00 00       	call   37f9 <exit>
+    printf(stdout, "read failed\n");
+     4ed:	83 ec 08             	sub    $0x8,%esp
+     4f0:	68 cd 41 00 00       	push   $0x41cd
+     4f5:	ff 35 64 5d 00 00    	push   0x5d64
+     4fb:	e8 d1 34 00 00       	call   39d1 <printf>
+    exit();
+     500:	e8 f4 32 00 00       	call   37f9 <exit>
+    printf(stdout, "unlink small failed\n");
+     505:	83 ec 08             	sub    $0x8,%esp
+     508:	68 b4 3e 00 00       	push   $0x3eb4
+     50d:	ff 35 64 5d 00 00    	push   0x5d64
+     513:	e8 b9 34 00 00       	call   39d1 <printf>
+    exit();
+     518:	e8 dc 32 00 00       	call   37f9 <exit>
+
+0000051d <writetest1>:
+
+void
+writetest1(void)
+{
+     51d:	55                   	push   %ebp
+     51e:	89 e5                	mov    %esp,%ebp
+     520:	56                   	push   %esi
+     521:	53                   	push   %ebx
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     522:	83 ec 08             	sub    $0x8,%esp
+     525:	68 dd 3e 00 00       	push   $0x3edd
+     52a:	ff 35 64 5d 00 00    	push   0x5d64
+     530:	e8 9c 34 00 00       	call   39d1 <printf>
+
+  fd = open("big", O_CREATE|O_RDWR);
+     535:	83 c4 08             	add    $0x8,%esp
+     538:	68 02 02 00 00       	push   $0x202
+     53d:	68 57 3f 00 00       	push   $0x3f57
+     542:	e8 f2 32 00 00       	call   3839 <open>
+  if(fd < 0){
+     547:	83 c4 10             	add    $0x10,%esp
+     54a:	85 c0                	test   %eax,%eax
+     54c:	0f 88 96 00 00 00    	js     5e8 <writetest1+0xcb>
+     552:	89 c6                	mov    %eax,%esi
+    printf(stdout, "error: creat big failed!\n");
+    exit();
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     554:	bb 00 00 00 00       	mov    $0x0,%ebx
+    ((int*)buf)[0] = i;
+     559:	89 1d a0 84 00 00    	mov    %ebx,0x84a0
+    if(write(fd, buf, 512) != 512){
+     55f:	83 ec 04             	sub    $0x4,%esp
+     562:	68 00 02 00 00       	push   $0x200
+     567:	68 a0 84 00 00       	push   $0x84a0
+     56c:	56                   	push   %esi
+     56d:	e8 a7 32 00 00       	call   3819 <write>
+     572:	83 c4 10             	add    $0x10,%esp
+     575:	3d 00 02 00 00       	cmp    $0x200,%eax
+     57a:	0f 85 80 00 00 00    	jne    600 <writetest1+0xe3>
+  for(i = 0; i < MAXFILE; i++){
+     580:	83 c3 01             	add    $0x1,%ebx
+     583:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     589:	75 ce                	jne    559 <writetest1+0x3c>
+      printf(stdout, "error: write big file failed\n", i);
+      exit();
+    }
+  }
+
+  close(fd);
+     58b:	83 ec 0c             	sub    $0xc,%esp
+     58e:	56                   	push   %esi
+     58f:	e8 8d 32 00 00       	call   3821 <close>
+
+  fd = open("big", O_RDONLY);
+     594:	83 c4 08             	add    $0x8,%esp
+     597:	6a 00                	push   $0x0
+     599:	68 57 3f 00 00       	push   $0x3f57
+     59e:	e8 96 32 00 00       	call   3839 <open>
+     5a3:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     5a5:	83 c4 10             	add    $0x10,%esp
+     5a8:	85 c0                	test   %eax,%eax
+     5aa:	78 6d                	js     619 <writetest1+0xfc>
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+
+  n = 0;
+     5ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(;;){
+    i = read(fd, buf, 512);
+     5b1:	83 ec 04             	sub    $0x4,%esp
+     5b4:	68 00 02 00 00       	push   $0x200
+     5b9:	68 a0 84 00 00       	push   $0x84a0
+     5be:	56                   	push   %esi
+     5bf:	e8 4d 32 00 00       	call   3811 <read>
+    if(i == 0){
+     5c4:	83 c4 10             	add    $0x10,%esp
+     5c7:	85 c0                	test   %eax,%eax
+     5c9:	74 66                	je     631 <writetest1+0x114>
+      if(n == MAXFILE - 1){
+        printf(stdout, "read only %d blocks from big", n);
+        exit();
+      }
+      break;
+    } else if(i != 512){
+     5cb:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5d0:	0f 85 b9 00 00 00    	jne    68f <writetest1+0x172>
+      printf(stdout, "read failed %d\n", i);
+      exit();
+    }
+    if(((int*)buf)[0] != n){
+     5d6:	a1 a0 84 00 00       	mov    0x84a0,%eax
+     5db:	39 d8                	cmp    %ebx,%eax
+     5dd:	0f 85 c5 00 00 00    	jne    6a8 <writetest1+0x18b>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+    n++;
+     5e3:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     5e6:	eb c9                	jmp    5b1 <writetest1+0x94>
+    printf(stdout, "error: creat big failed!\n");
+     5e8:	83 ec 08             	sub    $0x8,%esp
+     5eb:	68 ed 3e 00 00       	push   $0x3eed
+     5f0:	ff 35 64 5d 00 00    	push   0x5d64
+     5f6:	e8 d6 33 00 00       	call   39d1 <printf>
+    exit();
+     5fb:	e8 f9 31 00 00       	call   37f9 <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     600:	83 ec 04             	sub    $0x4,%esp
+     603:	53                   	push   %ebx
+     604:	68 07 3f 00 00       	push   $0x3f07
+     609:	ff 35 64 5d 00 00    	push   0x5d64
+     60f:	e8 bd 33 00 00       	call   39d1 <printf>
+      exit();
+     614:	e8 e0 31 00 00       	call   37f9 <exit>
+    printf(stdout, "error: open big failed!\n");
+     619:	83 ec 08             	sub    $0x8,%esp
+     61c:	68 25 3f 00 00       	push   $0x3f25
+     621:	ff 35 64 5d 00 00    	push   0x5d64
+     627:	e8 a5 33 00 00       	call   39d1 <printf>
+    exit();
+     62c:	e8 c8 31 00 00       	call   37f9 <exit>
+      if(n == MAXFILE - 1){
+     631:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+     637:	74 39                	je     672 <writetest1+0x155>
+  }
+  close(fd);
+     639:	83 ec 0c             	sub    $0xc,%esp
+     63c:	56                   	push   %esi
+     63d:	e8 df 31 00 00       	call   3821 <close>
+  if(unlink("big") < 0){
+     642:	c7 04 24 57 3f 00 00 	movl   $0x3f57,(%esp)
+     649:	e8 fb 31 00 00       	call   3849 <unlink>
+     64e:	83 c4 10             	add    $0x10,%esp
+     651:	85 c0                	test   %eax,%eax
+     653:	78 6a                	js     6bf <writetest1+0x1a2>
+    printf(stdout, "unlink big failed\n");
+    exit();
+  }
+  printf(stdout, "big files ok\n");
+     655:	83 ec 08             	sub    $0x8,%esp
+     658:	68 7e 3f 00 00       	push   $0x3f7e
+     65d:	ff 35 64 5d 00 00    	push   0x5d64
+     663:	e8 69 33 00 00       	call   39d1 <printf>
+}
+     668:	83 c4 10             	add    $0x10,%esp
+     66b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     66e:	5b                   	pop    %ebx
+     66f:	5e                   	pop    %esi
+     670:	5d                   	pop    %ebp
+     671:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     672:	83 ec 04             	sub    $0x4,%esp
+     675:	68 8b 00 00 00       	push   $0x8b
+     67a:	68 3e 3f 00 00       	push   $0x3f3e
+     67f:	ff 35 64 5d 00 00    	push   0x5d64
+     685:	e8 47 33 00 00       	call   39d1 <printf>
+        exit();
+     68a:	e8 6a 31 00 00       	call   37f9 <exit>
+      printf(stdout, "read failed %d\n", i);
+     68f:	83 ec 04             	sub    $0x4,%esp
+     692:	50                   	push   %eax
+     693:	68 5b 3f 00 00       	push   $0x3f5b
+     698:	ff 35 64 5d 00 00    	push   0x5d64
+     69e:	e8 2e 33 00 00       	call   39d1 <printf>
+      exit();
+     6a3:	e8 51 31 00 00       	call   37f9 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     6a8:	50                   	push   %eax
+     6a9:	53                   	push   %ebx
+     6aa:	68 58 4d 00 00       	push   $0x4d58
+     6af:	ff 35 64 5d 00 00    	push   0x5d64
+     6b5:	e8 17 33 00 00       	call   39d1 <printf>
+      exit();
+     6ba:	e8 3a 31 00 00       	call   37f9 <exit>
+    printf(stdout, "unlink big failed\n");
+     6bf:	83 ec 08             	sub    $0x8,%esp
+     6c2:	68 6b 3f 00 00       	push   $0x3f6b
+     6c7:	ff 35 64 5d 00 00    	push   0x5d64
+     6cd:	e8 ff 32 00 00       	call   39d1 <printf>
+    exit();
+     6d2:	e8 22 31 00 00       	call   37f9 <exit>
+
+000006d7 <createtest>:
+
+void
+createtest(void)
+{
+     6d7:	55                   	push   %ebp
+     6d8:	89 e5                	mov    %esp,%ebp
+     6da:	53                   	push   %ebx
+     6db:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     6de:	68 78 4d 00 00       	push   $0x4d78
+     6e3:	ff 35 64 5d 00 00    	push   0x5d64
+     6e9:	e8 e3 32 00 00       	call   39d1 <printf>
+
+  name[0] = 'a';
+     6ee:	c6 05 90 84 00 00 61 	movb   $0x61,0x8490
+  name[2] = '\0';
+     6f5:	c6 05 92 84 00 00 00 	movb   $0x0,0x8492
+     6fc:	83 c4 10             	add    $0x10,%esp
+     6ff:	bb 30 00 00 00       	mov    $0x30,%ebx
+  for(i = 0; i < 52; i++){
+    name[1] = '0' + i;
+     704:	88 1d 91 84 00 00    	mov    %bl,0x8491
+    fd = open(name, O_CREATE|O_RDWR);
+     70a:	83 ec 08             	sub    $0x8,%esp
+     70d:	68 02 02 00 00       	push   $0x202
+     712:	68 90 84 00 00       	push   $0x8490
+     717:	e8 1d 31 00 00       	call   3839 <open>
+    close(fd);
+     71c:	89 04 24             	mov    %eax,(%esp)
+     71f:	e8 fd 30 00 00       	call   3821 <close>
+  for(i = 0; i < 52; i++){
+     724:	83 c3 01             	add    $0x1,%ebx
+     727:	83 c4 10             	add    $0x10,%esp
+     72a:	80 fb 64             	cmp    $0x64,%bl
+     72d:	75 d5                	jne    704 <createtest+0x2d>
+  }
+  name[0] = 'a';
+     72f:	c6 05 90 84 00 00 61 	movb   $0x61,0x8490
+  name[2] = '\0';
+     736:	c6 05 92 84 00 00 00 	movb   $0x0,0x8492
+     73d:	bb 30 00 00 00       	mov    $0x30,%ebx
+  for(i = 0; i < 52; i++){
+    name[1] = '0' + i;
+     742:	88 1d 91 84 00 00    	mov    %bl,0x8491
+    unlink(name);
+     748:	83 ec 0c             	sub    $0xc,%esp
+     74b:	68 90 84 00 00       	push   $0x8490
+     750:	e8 f4 30 00 00       	call   3849 <unlink>
+  for(i = 0; i < 52; i++){
+     755:	83 c3 01             	add    $0x1,%ebx
+     758:	83 c4 10             	add    $0x10,%esp
+     75b:	80 fb 64             	cmp    $0x64,%bl
+     75e:	75 e2                	jne    742 <createtest+0x6b>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     760:	83 ec 08             	sub    $0x8,%esp
+     763:	68 a0 4d 00 00       	push   $0x4da0
+     768:	ff 35 64 5d 00 00    	push   0x5d64
+     76e:	e8 5e 32 00 00       	call   39d1 <printf>
+}
+     773:	83 c4 10             	add    $0x10,%esp
+     776:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     779:	c9                   	leave
+     77a:	c3                   	ret
+
+0000077b <dirtest>:
+
+void dirtest(void)
+{
+     77b:	55                   	push   %ebp
+     77c:	89 e5                	mov    %esp,%ebp
+     77e:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     781:	68 8c 3f 00 00       	push   $0x3f8c
+     786:	ff 35 64 5d 00 00    	push   0x5d64
+     78c:	e8 40 32 00 00       	call   39d1 <printf>
+
+  if(mkdir("dir0") < 0){
+     791:	c7 04 24 98 3f 00 00 	movl   $0x3f98,(%esp)
+     798:	e8 c4 30 00 00       	call   3861 <mkdir>
+     79d:	83 c4 10             	add    $0x10,%esp
+     7a0:	85 c0                	test   %eax,%eax
+     7a2:	78 54                	js     7f8 <dirtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+
+  if(chdir("dir0") < 0){
+     7a4:	83 ec 0c             	sub    $0xc,%esp
+     7a7:	68 98 3f 00 00       	push   $0x3f98
+     7ac:	e8 b8 30 00 00       	call   3869 <chdir>
+     7b1:	83 c4 10             	add    $0x10,%esp
+     7b4:	85 c0                	test   %eax,%eax
+     7b6:	78 58                	js     810 <dirtest+0x95>
+    printf(stdout, "chdir dir0 failed\n");
+    exit();
+  }
+
+  if(chdir("..") < 0){
+     7b8:	83 ec 0c             	sub    $0xc,%esp
+     7bb:	68 3d 45 00 00       	push   $0x453d
+     7c0:	e8 a4 30 00 00       	call   3869 <chdir>
+     7c5:	83 c4 10             	add    $0x10,%esp
+     7c8:	85 c0                	test   %eax,%eax
+     7ca:	78 5c                	js     828 <dirtest+0xad>
+    printf(stdout, "chdir .. failed\n");
+    exit();
+  }
+
+  if(unlink("dir0") < 0){
+     7cc:	83 ec 0c             	sub    $0xc,%esp
+     7cf:	68 98 3f 00 00       	push   $0x3f98
+     7d4:	e8 70 30 00 00       	call   3849 <unlink>
+     7d9:	83 c4 10             	add    $0x10,%esp
+     7dc:	85 c0                	test   %eax,%eax
+     7de:	78 60                	js     840 <dirtest+0xc5>
+    printf(stdout, "unlink dir0 failed\n");
+    exit();
+  }
+  printf(stdout, "mkdir test ok\n");
+     7e0:	83 ec 08             	sub    $0x8,%esp
+     7e3:	68 d5 3f 00 00       	push   $0x3fd5
+     7e8:	ff 35 64 5d 00 00    	push   0x5d64
+     7ee:	e8 de 31 00 00       	call   39d1 <printf>
+}
+     7f3:	83 c4 10             	add    $0x10,%esp
+     7f6:	c9                   	leave
+     7f7:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 c8 3c 00 00       	push   $0x3cc8
+     800:	ff 35 64 5d 00 00    	push   0x5d64
+     806:	e8 c6 31 00 00       	call   39d1 <printf>
+    exit();
+     80b:	e8 e9 2f 00 00       	call   37f9 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     810:	83 ec 08             	sub    $0x8,%esp
+     813:	68 9d 3f 00 00       	push   $0x3f9d
+     818:	ff 35 64 5d 00 00    	push   0x5d64
+     81e:	e8 ae 31 00 00       	call   39d1 <printf>
+    exit();
+     823:	e8 d1 2f 00 00       	call   37f9 <exit>
+    printf(stdout, "chdir .. failed\n");
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	68 b0 3f 00 00       	push   $0x3fb0
+     830:	ff 35 64 5d 00 00    	push   0x5d64
+     836:	e8 96 31 00 00       	call   39d1 <printf>
+    exit();
+     83b:	e8 b9 2f 00 00       	call   37f9 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     840:	83 ec 08             	sub    $0x8,%esp
+     843:	68 c1 3f 00 00       	push   $0x3fc1
+     848:	ff 35 64 5d 00 00    	push   0x5d64
+     84e:	e8 7e 31 00 00       	call   39d1 <printf>
+    exit();
+     853:	e8 a1 2f 00 00       	call   37f9 <exit>
+
+00000858 <exectest>:
+
+void
+exectest(void)
+{
+     858:	55                   	push   %ebp
+     859:	89 e5                	mov    %esp,%ebp
+     85b:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     85e:	68 e4 3f 00 00       	push   $0x3fe4
+     863:	ff 35 64 5d 00 00    	push   0x5d64
+     869:	e8 63 31 00 00       	call   39d1 <printf>
+  if(exec("echo", echoargv) < 0){
+     86e:	83 c4 08             	add    $0x8,%esp
+     871:	68 68 5d 00 00       	push   $0x5d68
+     876:	68 ad 3d 00 00       	push   $0x3dad
+     87b:	e8 b1 2f 00 00       	call   3831 <exec>
+     880:	83 c4 10             	add    $0x10,%esp
+     883:	85 c0                	test   %eax,%eax
+     885:	78 02                	js     889 <exectest+0x31>
+    printf(stdout, "exec echo failed\n");
+    exit();
+  }
+}
+     887:	c9                   	leave
+     888:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     889:	83 ec 08             	sub    $0x8,%esp
+     88c:	68 ef 3f 00 00       	push   $0x3fef
+     891:	ff 35 64 5d 00 00    	push   0x5d64
+     897:	e8 35 31 00 00       	call   39d1 <printf>
+    exit();
+     89c:	e8 58 2f 00 00       	call   37f9 <exit>
+
+000008a1 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     8a1:	55                   	push   %ebp
+     8a2:	89 e5                	mov    %esp,%ebp
+     8a4:	57                   	push   %edi
+     8a5:	56                   	push   %esi
+     8a6:	53                   	push   %ebx
+     8a7:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     8aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     8ad:	50                   	push   %eax
+     8ae:	e8 56 2f 00 00       	call   3809 <pipe>
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	85 c0                	test   %eax,%eax
+     8b8:	0f 85 8c 00 00 00    	jne    94a <pipe1+0xa9>
+     8be:	89 c3                	mov    %eax,%ebx
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+     8c0:	e8 2c 2f 00 00       	call   37f1 <fork>
+     8c5:	89 c6                	mov    %eax,%esi
+  seq = 0;
+  if(pid == 0){
+     8c7:	85 c0                	test   %eax,%eax
+     8c9:	0f 84 8f 00 00 00    	je     95e <pipe1+0xbd>
+        printf(1, "pipe1 oops 1\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+     8cf:	0f 8e 4b 01 00 00    	jle    a20 <pipe1+0x17f>
+    close(fds[1]);
+     8d5:	83 ec 0c             	sub    $0xc,%esp
+     8d8:	ff 75 e4             	push   -0x1c(%ebp)
+     8db:	e8 41 2f 00 00       	call   3821 <close>
+    total = 0;
+    cc = 1;
+    while((n = read(fds[0], buf, cc)) > 0){
+     8e0:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     8e3:	89 df                	mov    %ebx,%edi
+    cc = 1;
+     8e5:	be 01 00 00 00       	mov    $0x1,%esi
+    while((n = read(fds[0], buf, cc)) > 0){
+     8ea:	83 ec 04             	sub    $0x4,%esp
+     8ed:	56                   	push   %esi
+     8ee:	68 a0 84 00 00       	push   $0x84a0
+     8f3:	ff 75 e0             	push   -0x20(%ebp)
+     8f6:	e8 16 2f 00 00       	call   3811 <read>
+     8fb:	89 c2                	mov    %eax,%edx
+     8fd:	83 c4 10             	add    $0x10,%esp
+     900:	85 c0                	test   %eax,%eax
+     902:	0f 8e d4 00 00 00    	jle    9dc <pipe1+0x13b>
+      for(i = 0; i < n; i++){
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     908:	89 d8                	mov    %ebx,%eax
+     90a:	32 05 a0 84 00 00    	xor    0x84a0,%al
+     910:	0f b6 c0             	movzbl %al,%eax
+     913:	85 c0                	test   %eax,%eax
+     915:	75 19                	jne    930 <pipe1+0x8f>
+     917:	8d 4b 01             	lea    0x1(%ebx),%ecx
+     91a:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+      for(i = 0; i < n; i++){
+     91d:	83 c0 01             	add    $0x1,%eax
+     920:	39 c2                	cmp    %eax,%edx
+     922:	0f 84 a1 00 00 00    	je     9c9 <pipe1+0x128>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     928:	38 98 a0 84 00 00    	cmp    %bl,0x84a0(%eax)
+     92e:	74 ea                	je     91a <pipe1+0x79>
+          printf(1, "pipe1 oops 2\n");
+     930:	83 ec 08             	sub    $0x8,%esp
+     933:	68 1e 40 00 00       	push   $0x401e
+     938:	6a 01                	push   $0x1
+     93a:	e8 92 30 00 00       	call   39d1 <printf>
+     93f:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+}
+     942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     945:	5b                   	pop    %ebx
+     946:	5e                   	pop    %esi
+     947:	5f                   	pop    %edi
+     948:	5d                   	pop    %ebp
+     949:	c3                   	ret
+    printf(1, "pipe() failed\n");
+     94a:	83 ec 08             	sub    $0x8,%esp
+     94d:	68 01 40 00 00       	push   $0x4001
+     952:	6a 01                	push   $0x1
+     954:	e8 78 30 00 00       	call   39d1 <printf>
+    exit();
+     959:	e8 9b 2e 00 00       	call   37f9 <exit>
+    close(fds[0]);
+     95e:	83 ec 0c             	sub    $0xc,%esp
+     961:	ff 75 e0             	push   -0x20(%ebp)
+     964:	e8 b8 2e 00 00       	call   3821 <close>
+     969:	83 c4 10             	add    $0x10,%esp
+  seq = 0;
+     96c:	89 f3                	mov    %esi,%ebx
+      for(i = 0; i < 1033; i++)
+     96e:	89 f0                	mov    %esi,%eax
+        buf[i] = seq++;
+     970:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     973:	88 90 a0 84 00 00    	mov    %dl,0x84a0(%eax)
+      for(i = 0; i < 1033; i++)
+     979:	83 c0 01             	add    $0x1,%eax
+     97c:	3d 09 04 00 00       	cmp    $0x409,%eax
+     981:	75 ed                	jne    970 <pipe1+0xcf>
+        buf[i] = seq++;
+     983:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     989:	83 ec 04             	sub    $0x4,%esp
+     98c:	68 09 04 00 00       	push   $0x409
+     991:	68 a0 84 00 00       	push   $0x84a0
+     996:	ff 75 e4             	push   -0x1c(%ebp)
+     999:	e8 7b 2e 00 00       	call   3819 <write>
+     99e:	83 c4 10             	add    $0x10,%esp
+     9a1:	3d 09 04 00 00       	cmp    $0x409,%eax
+     9a6:	75 0d                	jne    9b5 <pipe1+0x114>
+    for(n = 0; n < 5; n++){
+     9a8:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     9ae:	75 be                	jne    96e <pipe1+0xcd>
+    exit();
+     9b0:	e8 44 2e 00 00       	call   37f9 <exit>
+        printf(1, "pipe1 oops 1\n");
+     9b5:	83 ec 08             	sub    $0x8,%esp
+     9b8:	68 10 40 00 00       	push   $0x4010
+     9bd:	6a 01                	push   $0x1
+     9bf:	e8 0d 30 00 00       	call   39d1 <printf>
+        exit();
+     9c4:	e8 30 2e 00 00       	call   37f9 <exit>
+      total += n;
+     9c9:	01 c7                	add    %eax,%edi
+      cc = cc * 2;
+     9cb:	01 f6                	add    %esi,%esi
+        cc = sizeof(buf);
+     9cd:	b8 00 20 00 00       	mov    $0x2000,%eax
+     9d2:	39 c6                	cmp    %eax,%esi
+     9d4:	0f 47 f0             	cmova  %eax,%esi
+     9d7:	e9 0e ff ff ff       	jmp    8ea <pipe1+0x49>
+    if(total != 5 * 1033){
+     9dc:	81 ff 2d 14 00 00    	cmp    $0x142d,%edi
+     9e2:	75 27                	jne    a0b <pipe1+0x16a>
+    close(fds[0]);
+     9e4:	83 ec 0c             	sub    $0xc,%esp
+     9e7:	ff 75 e0             	push   -0x20(%ebp)
+     9ea:	e8 32 2e 00 00       	call   3821 <close>
+    wait();
+     9ef:	e8 0d 2e 00 00       	call   3801 <wait>
+  printf(1, "pipe1 ok\n");
+     9f4:	83 c4 08             	add    $0x8,%esp
+     9f7:	68 43 40 00 00       	push   $0x4043
+     9fc:	6a 01                	push   $0x1
+     9fe:	e8 ce 2f 00 00       	call   39d1 <printf>
+     a03:	83 c4 10             	add    $0x10,%esp
+     a06:	e9 37 ff ff ff       	jmp    942 <pipe1+0xa1>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     a0b:	83 ec 04             	sub    $0x4,%esp
+     a0e:	57                   	push   %edi
+     a0f:	68 2c 40 00 00       	push   $0x402c
+     a14:	6a 01                	push   $0x1
+     a16:	e8 b6 2f 00 00       	call   39d1 <printf>
+      exit();
+     a1b:	e8 d9 2d 00 00       	call   37f9 <exit>
+    printf(1, "fork() failed\n");
+     a20:	83 ec 08             	sub    $0x8,%esp
+     a23:	68 4d 40 00 00       	push   $0x404d
+     a28:	6a 01                	push   $0x1
+     a2a:	e8 a2 2f 00 00       	call   39d1 <printf>
+    exit();
+     a2f:	e8 c5 2d 00 00       	call   37f9 <exit>
+
+00000a34 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     a34:	55                   	push   %ebp
+     a35:	89 e5                	mov    %esp,%ebp
+     a37:	57                   	push   %edi
+     a38:	56                   	push   %esi
+     a39:	53                   	push   %ebx
+     a3a:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     a3d:	68 5c 40 00 00       	push   $0x405c
+     a42:	6a 01                	push   $0x1
+     a44:	e8 88 2f 00 00       	call   39d1 <printf>
+  pid1 = fork();
+     a49:	e8 a3 2d 00 00       	call   37f1 <fork>
+  if(pid1 == 0)
+     a4e:	83 c4 10             	add    $0x10,%esp
+     a51:	85 c0                	test   %eax,%eax
+     a53:	75 02                	jne    a57 <preempt+0x23>
+    for(;;)
+     a55:	eb fe                	jmp    a55 <preempt+0x21>
+     a57:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     a59:	e8 93 2d 00 00       	call   37f1 <fork>
+     a5e:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     a60:	85 c0                	test   %eax,%eax
+     a62:	75 02                	jne    a66 <preempt+0x32>
+    for(;;)
+     a64:	eb fe                	jmp    a64 <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     a66:	83 ec 0c             	sub    $0xc,%esp
+     a69:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a6c:	50                   	push   %eax
+     a6d:	e8 97 2d 00 00       	call   3809 <pipe>
+  pid3 = fork();
+     a72:	e8 7a 2d 00 00       	call   37f1 <fork>
+     a77:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     a79:	83 c4 10             	add    $0x10,%esp
+     a7c:	85 c0                	test   %eax,%eax
+     a7e:	75 49                	jne    ac9 <preempt+0x95>
+    close(pfds[0]);
+     a80:	83 ec 0c             	sub    $0xc,%esp
+     a83:	ff 75 e0             	push   -0x20(%ebp)
+     a86:	e8 96 2d 00 00       	call   3821 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     a8b:	83 c4 0c             	add    $0xc,%esp
+     a8e:	6a 01                	push   $0x1
+     a90:	68 21 46 00 00       	push   $0x4621
+     a95:	ff 75 e4             	push   -0x1c(%ebp)
+     a98:	e8 7c 2d 00 00       	call   3819 <write>
+     a9d:	83 c4 10             	add    $0x10,%esp
+     aa0:	83 f8 01             	cmp    $0x1,%eax
+     aa3:	75 10                	jne    ab5 <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+     aa5:	83 ec 0c             	sub    $0xc,%esp
+     aa8:	ff 75 e4             	push   -0x1c(%ebp)
+     aab:	e8 71 2d 00 00       	call   3821 <close>
+     ab0:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     ab3:	eb fe                	jmp    ab3 <preempt+0x7f>
+      printf(1, "preempt write error");
+     ab5:	83 ec 08             	sub    $0x8,%esp
+     ab8:	68 66 40 00 00       	push   $0x4066
+     abd:	6a 01                	push   $0x1
+     abf:	e8 0d 2f 00 00       	call   39d1 <printf>
+     ac4:	83 c4 10             	add    $0x10,%esp
+     ac7:	eb dc                	jmp    aa5 <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+     ac9:	83 ec 0c             	sub    $0xc,%esp
+     acc:	ff 75 e4             	push   -0x1c(%ebp)
+     acf:	e8 4d 2d 00 00       	call   3821 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     ad4:	83 c4 0c             	add    $0xc,%esp
+     ad7:	68 00 20 00 00       	push   $0x2000
+     adc:	68 a0 84 00 00       	push   $0x84a0
+     ae1:	ff 75 e0             	push   -0x20(%ebp)
+     ae4:	e8 28 2d 00 00       	call   3811 <read>
+     ae9:	83 c4 10             	add    $0x10,%esp
+     aec:	83 f8 01             	cmp    $0x1,%eax
+     aef:	74 1a                	je     b0b <preempt+0xd7>
+    printf(1, "preempt read error");
+     af1:	83 ec 08             	sub    $0x8,%esp
+     af4:	68 7a 40 00 00       	push   $0x407a
+     af9:	6a 01                	push   $0x1
+     afb:	e8 d1 2e 00 00       	call   39d1 <printf>
+     b00:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait();
+  wait();
+  wait();
+  printf(1, "preempt ok\n");
+}
+     b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b06:	5b                   	pop    %ebx
+     b07:	5e                   	pop    %esi
+     b08:	5f                   	pop    %edi
+     b09:	5d                   	pop    %ebp
+     b0a:	c3                   	ret
+  close(pfds[0]);
+     b0b:	83 ec 0c             	sub    $0xc,%esp
+     b0e:	ff 75 e0             	push   -0x20(%ebp)
+     b11:	e8 0b 2d 00 00       	call   3821 <close>
+  printf(1, "kill... ");
+     b16:	83 c4 08             	add    $0x8,%esp
+     b19:	68 8d 40 00 00       	push   $0x408d
+     b1e:	6a 01                	push   $0x1
+     b20:	e8 ac 2e 00 00       	call   39d1 <printf>
+  kill(pid1);
+     b25:	89 1c 24             	mov    %ebx,(%esp)
+     b28:	e8 fc 2c 00 00       	call   3829 <kill>
+  kill(pid2);
+     b2d:	89 34 24             	mov    %esi,(%esp)
+     b30:	e8 f4 2c 00 00       	call   3829 <kill>
+  kill(pid3);
+     b35:	89 3c 24             	mov    %edi,(%esp)
+     b38:	e8 ec 2c 00 00       	call   3829 <kill>
+  printf(1, "wait... ");
+     b3d:	83 c4 08             	add    $0x8,%esp
+     b40:	68 96 40 00 00       	push   $0x4096
+     b45:	6a 01                	push   $0x1
+     b47:	e8 85 2e 00 00       	call   39d1 <printf>
+  wait();
+     b4c:	e8 b0 2c 00 00       	call   3801 <wait>
+  wait();
+     b51:	e8 ab 2c 00 00       	call   3801 <wait>
+  wait();
+     b56:	e8 a6 2c 00 00       	call   3801 <wait>
+  printf(1, "preempt ok\n");
+     b5b:	83 c4 08             	add    $0x8,%esp
+     b5e:	68 9f 40 00 00       	push   $0x409f
+     b63:	6a 01                	push   $0x1
+     b65:	e8 67 2e 00 00       	call   39d1 <printf>
+     b6a:	83 c4 10             	add    $0x10,%esp
+     b6d:	eb 94                	jmp    b03 <preempt+0xcf>
+
+00000b6f <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     b6f:	55                   	push   %ebp
+     b70:	89 e5                	mov    %esp,%ebp
+     b72:	56                   	push   %esi
+     b73:	53                   	push   %ebx
+     b74:	be 64 00 00 00       	mov    $0x64,%esi
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    pid = fork();
+     b79:	e8 73 2c 00 00       	call   37f1 <fork>
+     b7e:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     b80:	85 c0                	test   %eax,%eax
+     b82:	78 24                	js     ba8 <exitwait+0x39>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+     b84:	74 4f                	je     bd5 <exitwait+0x66>
+      if(wait() != pid){
+     b86:	e8 76 2c 00 00       	call   3801 <wait>
+     b8b:	39 d8                	cmp    %ebx,%eax
+     b8d:	75 32                	jne    bc1 <exitwait+0x52>
+  for(i = 0; i < 100; i++){
+     b8f:	83 ee 01             	sub    $0x1,%esi
+     b92:	75 e5                	jne    b79 <exitwait+0xa>
+      }
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+     b94:	83 ec 08             	sub    $0x8,%esp
+     b97:	68 bb 40 00 00       	push   $0x40bb
+     b9c:	6a 01                	push   $0x1
+     b9e:	e8 2e 2e 00 00       	call   39d1 <printf>
+     ba3:	83 c4 10             	add    $0x10,%esp
+     ba6:	eb 12                	jmp    bba <exitwait+0x4b>
+      printf(1, "fork failed\n");
+     ba8:	83 ec 08             	sub    $0x8,%esp
+     bab:	68 09 4c 00 00       	push   $0x4c09
+     bb0:	6a 01                	push   $0x1
+     bb2:	e8 1a 2e 00 00       	call   39d1 <printf>
+      return;
+     bb7:	83 c4 10             	add    $0x10,%esp
+}
+     bba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bbd:	5b                   	pop    %ebx
+     bbe:	5e                   	pop    %esi
+     bbf:	5d                   	pop    %ebp
+     bc0:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     bc1:	83 ec 08             	sub    $0x8,%esp
+     bc4:	68 ab 40 00 00       	push   $0x40ab
+     bc9:	6a 01                	push   $0x1
+     bcb:	e8 01 2e 00 00       	call   39d1 <printf>
+        return;
+     bd0:	83 c4 10             	add    $0x10,%esp
+     bd3:	eb e5                	jmp    bba <exitwait+0x4b>
+      exit();
+     bd5:	e8 1f 2c 00 00       	call   37f9 <exit>
+
+00000bda <mem>:
+
+void
+mem(void)
+{
+     bda:	55                   	push   %ebp
+     bdb:	89 e5                	mov    %esp,%ebp
+     bdd:	56                   	push   %esi
+     bde:	53                   	push   %ebx
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     bdf:	83 ec 08             	sub    $0x8,%esp
+     be2:	68 c8 40 00 00       	push   $0x40c8
+     be7:	6a 01                	push   $0x1
+     be9:	e8 e3 2d 00 00       	call   39d1 <printf>
+  ppid = getpid();
+     bee:	e8 86 2c 00 00       	call   3879 <getpid>
+     bf3:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+     bf5:	e8 f7 2b 00 00       	call   37f1 <fork>
+     bfa:	83 c4 10             	add    $0x10,%esp
+    m1 = 0;
+     bfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if((pid = fork()) == 0){
+     c02:	85 c0                	test   %eax,%eax
+     c04:	74 10                	je     c16 <mem+0x3c>
+    }
+    free(m1);
+    printf(1, "mem ok\n");
+    exit();
+  } else {
+    wait();
+     c06:	e8 f6 2b 00 00       	call   3801 <wait>
+  }
+}
+     c0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c0e:	5b                   	pop    %ebx
+     c0f:	5e                   	pop    %esi
+     c10:	5d                   	pop    %ebp
+     c11:	c3                   	ret
+      *(char**)m2 = m1;
+     c12:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+     c14:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+     c16:	83 ec 0c             	sub    $0xc,%esp
+     c19:	68 11 27 00 00       	push   $0x2711
+     c1e:	e8 d4 2f 00 00       	call   3bf7 <malloc>
+     c23:	83 c4 10             	add    $0x10,%esp
+     c26:	85 c0                	test   %eax,%eax
+     c28:	75 e8                	jne    c12 <mem+0x38>
+    while(m1){
+     c2a:	85 db                	test   %ebx,%ebx
+     c2c:	74 14                	je     c42 <mem+0x68>
+      m2 = *(char**)m1;
+     c2e:	89 d8                	mov    %ebx,%eax
+     c30:	8b 1b                	mov    (%ebx),%ebx
+      free(m1);
+     c32:	83 ec 0c             	sub    $0xc,%esp
+     c35:	50                   	push   %eax
+     c36:	e8 53 2f 00 00       	call   3b8e <free>
+    while(m1){
+     c3b:	83 c4 10             	add    $0x10,%esp
+     c3e:	85 db                	test   %ebx,%ebx
+     c40:	75 ec                	jne    c2e <mem+0x54>
+    m1 = malloc(1024*20);
+     c42:	83 ec 0c             	sub    $0xc,%esp
+     c45:	68 00 50 00 00       	push   $0x5000
+     c4a:	e8 a8 2f 00 00       	call   3bf7 <malloc>
+    if(m1 == 0){
+     c4f:	83 c4 10             	add    $0x10,%esp
+     c52:	85 c0                	test   %eax,%eax
+     c54:	74 1d                	je     c73 <mem+0x99>
+    free(m1);
+     c56:	83 ec 0c             	sub    $0xc,%esp
+     c59:	50                   	push   %eax
+     c5a:	e8 2f 2f 00 00       	call   3b8e <free>
+    printf(1, "mem ok\n");
+     c5f:	83 c4 08             	add    $0x8,%esp
+     c62:	68 ec 40 00 00       	push   $0x40ec
+     c67:	6a 01                	push   $0x1
+     c69:	e8 63 2d 00 00       	call   39d1 <printf>
+    exit();
+     c6e:	e8 86 2b 00 00       	call   37f9 <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+     c73:	83 ec 08             	sub    $0x8,%esp
+     c76:	68 d2 40 00 00       	push   $0x40d2
+     c7b:	6a 01                	push   $0x1
+     c7d:	e8 4f 2d 00 00       	call   39d1 <printf>
+      kill(ppid);
+     c82:	89 34 24             	mov    %esi,(%esp)
+     c85:	e8 9f 2b 00 00       	call   3829 <kill>
+      exit();
+     c8a:	e8 6a 2b 00 00       	call   37f9 <exit>
+
+00000c8f <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     c8f:	55                   	push   %ebp
+     c90:	89 e5                	mov    %esp,%ebp
+     c92:	57                   	push   %edi
+     c93:	56                   	push   %esi
+     c94:	53                   	push   %ebx
+     c95:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     c98:	68 f4 40 00 00       	push   $0x40f4
+     c9d:	6a 01                	push   $0x1
+     c9f:	e8 2d 2d 00 00       	call   39d1 <printf>
+
+  unlink("sharedfd");
+     ca4:	c7 04 24 03 41 00 00 	movl   $0x4103,(%esp)
+     cab:	e8 99 2b 00 00       	call   3849 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     cb0:	83 c4 08             	add    $0x8,%esp
+     cb3:	68 02 02 00 00       	push   $0x202
+     cb8:	68 03 41 00 00       	push   $0x4103
+     cbd:	e8 77 2b 00 00       	call   3839 <open>
+  if(fd < 0){
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	78 4a                	js     d13 <sharedfd+0x84>
+     cc9:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+     ccb:	e8 21 2b 00 00       	call   37f1 <fork>
+     cd0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     cd3:	83 f8 01             	cmp    $0x1,%eax
+     cd6:	19 c0                	sbb    %eax,%eax
+     cd8:	83 e0 f3             	and    $0xfffffff3,%eax
+     cdb:	83 c0 70             	add    $0x70,%eax
+     cde:	83 ec 04             	sub    $0x4,%esp
+     ce1:	6a 0a                	push   $0xa
+     ce3:	50                   	push   %eax
+     ce4:	8d 45 de             	lea    -0x22(%ebp),%eax
+     ce7:	50                   	push   %eax
+     ce8:	e8 1e 29 00 00       	call   360b <memset>
+     ced:	83 c4 10             	add    $0x10,%esp
+     cf0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  for(i = 0; i < 1000; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     cf5:	8d 7d de             	lea    -0x22(%ebp),%edi
+     cf8:	83 ec 04             	sub    $0x4,%esp
+     cfb:	6a 0a                	push   $0xa
+     cfd:	57                   	push   %edi
+     cfe:	56                   	push   %esi
+     cff:	e8 15 2b 00 00       	call   3819 <write>
+     d04:	83 c4 10             	add    $0x10,%esp
+     d07:	83 f8 0a             	cmp    $0xa,%eax
+     d0a:	75 1e                	jne    d2a <sharedfd+0x9b>
+  for(i = 0; i < 1000; i++){
+     d0c:	83 eb 01             	sub    $0x1,%ebx
+     d0f:	75 e7                	jne    cf8 <sharedfd+0x69>
+     d11:	eb 29                	jmp    d3c <sharedfd+0xad>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     d13:	83 ec 08             	sub    $0x8,%esp
+     d16:	68 c8 4d 00 00       	push   $0x4dc8
+     d1b:	6a 01                	push   $0x1
+     d1d:	e8 af 2c 00 00       	call   39d1 <printf>
+    return;
+     d22:	83 c4 10             	add    $0x10,%esp
+     d25:	e9 de 00 00 00       	jmp    e08 <sharedfd+0x179>
+      printf(1, "fstests: write sharedfd failed\n");
+     d2a:	83 ec 08             	sub    $0x8,%esp
+     d2d:	68 f4 4d 00 00       	push   $0x4df4
+     d32:	6a 01                	push   $0x1
+     d34:	e8 98 2c 00 00       	call   39d1 <printf>
+      break;
+     d39:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+     d3c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     d40:	74 51                	je     d93 <sharedfd+0x104>
+    exit();
+  else
+    wait();
+     d42:	e8 ba 2a 00 00       	call   3801 <wait>
+  close(fd);
+     d47:	83 ec 0c             	sub    $0xc,%esp
+     d4a:	56                   	push   %esi
+     d4b:	e8 d1 2a 00 00       	call   3821 <close>
+  fd = open("sharedfd", 0);
+     d50:	83 c4 08             	add    $0x8,%esp
+     d53:	6a 00                	push   $0x0
+     d55:	68 03 41 00 00       	push   $0x4103
+     d5a:	e8 da 2a 00 00       	call   3839 <open>
+  if(fd < 0){
+     d5f:	83 c4 10             	add    $0x10,%esp
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+     d62:	bb 00 00 00 00       	mov    $0x0,%ebx
+     d67:	bf 00 00 00 00       	mov    $0x0,%edi
+     d6c:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  if(fd < 0){
+     d6f:	85 c0                	test   %eax,%eax
+     d71:	78 25                	js     d98 <sharedfd+0x109>
+     d73:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     d76:	83 ec 04             	sub    $0x4,%esp
+     d79:	6a 0a                	push   $0xa
+     d7b:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d7e:	50                   	push   %eax
+     d7f:	ff 75 d4             	push   -0x2c(%ebp)
+     d82:	e8 8a 2a 00 00       	call   3811 <read>
+     d87:	83 c4 10             	add    $0x10,%esp
+     d8a:	85 c0                	test   %eax,%eax
+     d8c:	7e 3d                	jle    dcb <sharedfd+0x13c>
+     d8e:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d91:	eb 2b                	jmp    dbe <sharedfd+0x12f>
+    exit();
+     d93:	e8 61 2a 00 00       	call   37f9 <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     d98:	83 ec 08             	sub    $0x8,%esp
+     d9b:	68 14 4e 00 00       	push   $0x4e14
+     da0:	6a 01                	push   $0x1
+     da2:	e8 2a 2c 00 00       	call   39d1 <printf>
+    return;
+     da7:	83 c4 10             	add    $0x10,%esp
+     daa:	eb 5c                	jmp    e08 <sharedfd+0x179>
+    for(i = 0; i < sizeof(buf); i++){
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+        np++;
+     dac:	80 fa 70             	cmp    $0x70,%dl
+     daf:	0f 94 c2             	sete   %dl
+     db2:	0f b6 d2             	movzbl %dl,%edx
+     db5:	01 d3                	add    %edx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     db7:	83 c0 01             	add    $0x1,%eax
+     dba:	39 f0                	cmp    %esi,%eax
+     dbc:	74 b8                	je     d76 <sharedfd+0xe7>
+      if(buf[i] == 'c')
+     dbe:	0f b6 10             	movzbl (%eax),%edx
+     dc1:	80 fa 63             	cmp    $0x63,%dl
+     dc4:	75 e6                	jne    dac <sharedfd+0x11d>
+        nc++;
+     dc6:	83 c7 01             	add    $0x1,%edi
+      if(buf[i] == 'p')
+     dc9:	eb ec                	jmp    db7 <sharedfd+0x128>
+    }
+  }
+  close(fd);
+     dcb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     dce:	83 ec 0c             	sub    $0xc,%esp
+     dd1:	51                   	push   %ecx
+     dd2:	e8 4a 2a 00 00       	call   3821 <close>
+  unlink("sharedfd");
+     dd7:	c7 04 24 03 41 00 00 	movl   $0x4103,(%esp)
+     dde:	e8 66 2a 00 00       	call   3849 <unlink>
+  if(nc == 10000 && np == 10000){
+     de3:	83 c4 10             	add    $0x10,%esp
+     de6:	81 ff 10 27 00 00    	cmp    $0x2710,%edi
+     dec:	75 22                	jne    e10 <sharedfd+0x181>
+     dee:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     df4:	75 1a                	jne    e10 <sharedfd+0x181>
+    printf(1, "sharedfd ok\n");
+     df6:	83 ec 08             	sub    $0x8,%esp
+     df9:	68 0c 41 00 00       	push   $0x410c
+     dfe:	6a 01                	push   $0x1
+     e00:	e8 cc 2b 00 00       	call   39d1 <printf>
+     e05:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+     e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e0b:	5b                   	pop    %ebx
+     e0c:	5e                   	pop    %esi
+     e0d:	5f                   	pop    %edi
+     e0e:	5d                   	pop    %ebp
+     e0f:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     e10:	53                   	push   %ebx
+     e11:	57                   	push   %edi
+     e12:	68 19 41 00 00       	push   $0x4119
+     e17:	6a 01                	push   $0x1
+     e19:	e8 b3 2b 00 00       	call   39d1 <printf>
+    exit();
+     e1e:	e8 d6 29 00 00       	call   37f9 <exit>
+
+00000e23 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+     e23:	55                   	push   %ebp
+     e24:	89 e5                	mov    %esp,%ebp
+     e26:	57                   	push   %edi
+     e27:	56                   	push   %esi
+     e28:	53                   	push   %ebx
+     e29:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     e2c:	c7 45 d8 2e 41 00 00 	movl   $0x412e,-0x28(%ebp)
+     e33:	c7 45 dc 77 42 00 00 	movl   $0x4277,-0x24(%ebp)
+     e3a:	c7 45 e0 7b 42 00 00 	movl   $0x427b,-0x20(%ebp)
+     e41:	c7 45 e4 31 41 00 00 	movl   $0x4131,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+     e48:	68 34 41 00 00       	push   $0x4134
+     e4d:	6a 01                	push   $0x1
+     e4f:	e8 7d 2b 00 00       	call   39d1 <printf>
+     e54:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+     e57:	bb 00 00 00 00       	mov    $0x0,%ebx
+    fname = names[pi];
+     e5c:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+     e60:	83 ec 0c             	sub    $0xc,%esp
+     e63:	56                   	push   %esi
+     e64:	e8 e0 29 00 00       	call   3849 <unlink>
+
+    pid = fork();
+     e69:	e8 83 29 00 00       	call   37f1 <fork>
+    if(pid < 0){
+     e6e:	83 c4 10             	add    $0x10,%esp
+     e71:	85 c0                	test   %eax,%eax
+     e73:	78 28                	js     e9d <fourfiles+0x7a>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+     e75:	74 3a                	je     eb1 <fourfiles+0x8e>
+  for(pi = 0; pi < 4; pi++){
+     e77:	83 c3 01             	add    $0x1,%ebx
+     e7a:	83 fb 04             	cmp    $0x4,%ebx
+     e7d:	75 dd                	jne    e5c <fourfiles+0x39>
+      exit();
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    wait();
+     e7f:	e8 7d 29 00 00       	call   3801 <wait>
+     e84:	e8 78 29 00 00       	call   3801 <wait>
+     e89:	e8 73 29 00 00       	call   3801 <wait>
+     e8e:	e8 6e 29 00 00       	call   3801 <wait>
+     e93:	bb 30 00 00 00       	mov    $0x30,%ebx
+     e98:	e9 0c 01 00 00       	jmp    fa9 <fourfiles+0x186>
+      printf(1, "fork failed\n");
+     e9d:	83 ec 08             	sub    $0x8,%esp
+     ea0:	68 09 4c 00 00       	push   $0x4c09
+     ea5:	6a 01                	push   $0x1
+     ea7:	e8 25 2b 00 00       	call   39d1 <printf>
+      exit();
+     eac:	e8 48 29 00 00       	call   37f9 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+     eb1:	83 ec 08             	sub    $0x8,%esp
+     eb4:	68 02 02 00 00       	push   $0x202
+     eb9:	56                   	push   %esi
+     eba:	e8 7a 29 00 00       	call   3839 <open>
+     ebf:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+     ec1:	83 c4 10             	add    $0x10,%esp
+     ec4:	85 c0                	test   %eax,%eax
+     ec6:	78 45                	js     f0d <fourfiles+0xea>
+      memset(buf, '0'+pi, 512);
+     ec8:	83 ec 04             	sub    $0x4,%esp
+     ecb:	68 00 02 00 00       	push   $0x200
+     ed0:	83 c3 30             	add    $0x30,%ebx
+     ed3:	53                   	push   %ebx
+     ed4:	68 a0 84 00 00       	push   $0x84a0
+     ed9:	e8 2d 27 00 00       	call   360b <memset>
+     ede:	83 c4 10             	add    $0x10,%esp
+     ee1:	bb 0c 00 00 00       	mov    $0xc,%ebx
+        if((n = write(fd, buf, 500)) != 500){
+     ee6:	83 ec 04             	sub    $0x4,%esp
+     ee9:	68 f4 01 00 00       	push   $0x1f4
+     eee:	68 a0 84 00 00       	push   $0x84a0
+     ef3:	56                   	push   %esi
+     ef4:	e8 20 29 00 00       	call   3819 <write>
+     ef9:	83 c4 10             	add    $0x10,%esp
+     efc:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     f01:	75 1e                	jne    f21 <fourfiles+0xfe>
+      for(i = 0; i < 12; i++){
+     f03:	83 eb 01             	sub    $0x1,%ebx
+     f06:	75 de                	jne    ee6 <fourfiles+0xc3>
+      exit();
+     f08:	e8 ec 28 00 00       	call   37f9 <exit>
+        printf(1, "create failed\n");
+     f0d:	83 ec 08             	sub    $0x8,%esp
+     f10:	68 cf 43 00 00       	push   $0x43cf
+     f15:	6a 01                	push   $0x1
+     f17:	e8 b5 2a 00 00       	call   39d1 <printf>
+        exit();
+     f1c:	e8 d8 28 00 00       	call   37f9 <exit>
+          printf(1, "write failed %d\n", n);
+     f21:	83 ec 04             	sub    $0x4,%esp
+     f24:	50                   	push   %eax
+     f25:	68 44 41 00 00       	push   $0x4144
+     f2a:	6a 01                	push   $0x1
+     f2c:	e8 a0 2a 00 00       	call   39d1 <printf>
+          exit();
+     f31:	e8 c3 28 00 00       	call   37f9 <exit>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+     f36:	83 ec 08             	sub    $0x8,%esp
+     f39:	68 55 41 00 00       	push   $0x4155
+     f3e:	6a 01                	push   $0x1
+     f40:	e8 8c 2a 00 00       	call   39d1 <printf>
+          exit();
+     f45:	e8 af 28 00 00       	call   37f9 <exit>
+        }
+      }
+      total += n;
+     f4a:	01 d6                	add    %edx,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     f4c:	83 ec 04             	sub    $0x4,%esp
+     f4f:	68 00 20 00 00       	push   $0x2000
+     f54:	68 a0 84 00 00       	push   $0x84a0
+     f59:	57                   	push   %edi
+     f5a:	e8 b2 28 00 00       	call   3811 <read>
+     f5f:	83 c4 10             	add    $0x10,%esp
+     f62:	85 c0                	test   %eax,%eax
+     f64:	7e 19                	jle    f7f <fourfiles+0x15c>
+      for(j = 0; j < n; j++){
+     f66:	ba 00 00 00 00       	mov    $0x0,%edx
+        if(buf[j] != '0'+i){
+     f6b:	0f be 8a a0 84 00 00 	movsbl 0x84a0(%edx),%ecx
+     f72:	39 d9                	cmp    %ebx,%ecx
+     f74:	75 c0                	jne    f36 <fourfiles+0x113>
+      for(j = 0; j < n; j++){
+     f76:	83 c2 01             	add    $0x1,%edx
+     f79:	39 d0                	cmp    %edx,%eax
+     f7b:	75 ee                	jne    f6b <fourfiles+0x148>
+     f7d:	eb cb                	jmp    f4a <fourfiles+0x127>
+    }
+    close(fd);
+     f7f:	83 ec 0c             	sub    $0xc,%esp
+     f82:	57                   	push   %edi
+     f83:	e8 99 28 00 00       	call   3821 <close>
+    if(total != 12*500){
+     f88:	83 c4 10             	add    $0x10,%esp
+     f8b:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+     f91:	75 37                	jne    fca <fourfiles+0x1a7>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+     f93:	83 ec 0c             	sub    $0xc,%esp
+     f96:	ff 75 d4             	push   -0x2c(%ebp)
+     f99:	e8 ab 28 00 00       	call   3849 <unlink>
+  for(i = 0; i < 2; i++){
+     f9e:	83 c3 01             	add    $0x1,%ebx
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	83 fb 32             	cmp    $0x32,%ebx
+     fa7:	74 36                	je     fdf <fourfiles+0x1bc>
+    fname = names[i];
+     fa9:	8b 84 9d 18 ff ff ff 	mov    -0xe8(%ebp,%ebx,4),%eax
+     fb0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    fd = open(fname, 0);
+     fb3:	83 ec 08             	sub    $0x8,%esp
+     fb6:	6a 00                	push   $0x0
+     fb8:	50                   	push   %eax
+     fb9:	e8 7b 28 00 00       	call   3839 <open>
+     fbe:	89 c7                	mov    %eax,%edi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fc0:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     fc3:	be 00 00 00 00       	mov    $0x0,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fc8:	eb 82                	jmp    f4c <fourfiles+0x129>
+      printf(1, "wrong length %d\n", total);
+     fca:	83 ec 04             	sub    $0x4,%esp
+     fcd:	56                   	push   %esi
+     fce:	68 61 41 00 00       	push   $0x4161
+     fd3:	6a 01                	push   $0x1
+     fd5:	e8 f7 29 00 00       	call   39d1 <printf>
+      exit();
+     fda:	e8 1a 28 00 00       	call   37f9 <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+     fdf:	83 ec 08             	sub    $0x8,%esp
+     fe2:	68 72 41 00 00       	push   $0x4172
+     fe7:	6a 01                	push   $0x1
+     fe9:	e8 e3 29 00 00       	call   39d1 <printf>
+}
+     fee:	83 c4 10             	add    $0x10,%esp
+     ff1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ff4:	5b                   	pop    %ebx
+     ff5:	5e                   	pop    %esi
+     ff6:	5f                   	pop    %edi
+     ff7:	5d                   	pop    %ebp
+     ff8:	c3                   	ret
+
+00000ff9 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+     ff9:	55                   	push   %ebp
+     ffa:	89 e5                	mov    %esp,%ebp
+     ffc:	57                   	push   %edi
+     ffd:	56                   	push   %esi
+     ffe:	53                   	push   %ebx
+     fff:	83 ec 44             	sub    $0x44,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    1002:	68 80 41 00 00       	push   $0x4180
+    1007:	6a 01                	push   $0x1
+    1009:	e8 c3 29 00 00       	call   39d1 <printf>
+    100e:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    1011:	be 00 00 00 00       	mov    $0x0,%esi
+    pid = fork();
+    1016:	e8 d6 27 00 00       	call   37f1 <fork>
+    if(pid < 0){
+    101b:	85 c0                	test   %eax,%eax
+    101d:	78 35                	js     1054 <createdelete+0x5b>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    101f:	74 47                	je     1068 <createdelete+0x6f>
+  for(pi = 0; pi < 4; pi++){
+    1021:	83 c6 01             	add    $0x1,%esi
+    1024:	83 fe 04             	cmp    $0x4,%esi
+    1027:	75 ed                	jne    1016 <createdelete+0x1d>
+      exit();
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    wait();
+    1029:	e8 d3 27 00 00       	call   3801 <wait>
+    102e:	e8 ce 27 00 00       	call   3801 <wait>
+    1033:	e8 c9 27 00 00       	call   3801 <wait>
+    1038:	e8 c4 27 00 00       	call   3801 <wait>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    103d:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1041:	c6 45 c7 30          	movb   $0x30,-0x39(%ebp)
+    1045:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  for(i = 0; i < N; i++){
+    104a:	bf 00 00 00 00       	mov    $0x0,%edi
+    104f:	e9 39 01 00 00       	jmp    118d <createdelete+0x194>
+      printf(1, "fork failed\n");
+    1054:	83 ec 08             	sub    $0x8,%esp
+    1057:	68 09 4c 00 00       	push   $0x4c09
+    105c:	6a 01                	push   $0x1
+    105e:	e8 6e 29 00 00       	call   39d1 <printf>
+      exit();
+    1063:	e8 91 27 00 00       	call   37f9 <exit>
+      name[0] = 'p' + pi;
+    1068:	89 c3                	mov    %eax,%ebx
+    106a:	8d 46 70             	lea    0x70(%esi),%eax
+    106d:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    1070:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1074:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    1077:	eb 1c                	jmp    1095 <createdelete+0x9c>
+          printf(1, "create failed\n");
+    1079:	83 ec 08             	sub    $0x8,%esp
+    107c:	68 cf 43 00 00       	push   $0x43cf
+    1081:	6a 01                	push   $0x1
+    1083:	e8 49 29 00 00       	call   39d1 <printf>
+          exit();
+    1088:	e8 6c 27 00 00       	call   37f9 <exit>
+      for(i = 0; i < N; i++){
+    108d:	83 c3 01             	add    $0x1,%ebx
+    1090:	83 fb 14             	cmp    $0x14,%ebx
+    1093:	74 63                	je     10f8 <createdelete+0xff>
+        name[1] = '0' + i;
+    1095:	8d 43 30             	lea    0x30(%ebx),%eax
+    1098:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    109b:	83 ec 08             	sub    $0x8,%esp
+    109e:	68 02 02 00 00       	push   $0x202
+    10a3:	56                   	push   %esi
+    10a4:	e8 90 27 00 00       	call   3839 <open>
+        if(fd < 0){
+    10a9:	83 c4 10             	add    $0x10,%esp
+    10ac:	85 c0                	test   %eax,%eax
+    10ae:	78 c9                	js     1079 <createdelete+0x80>
+        close(fd);
+    10b0:	83 ec 0c             	sub    $0xc,%esp
+    10b3:	50                   	push   %eax
+    10b4:	e8 68 27 00 00       	call   3821 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    10b9:	83 c4 10             	add    $0x10,%esp
+    10bc:	85 db                	test   %ebx,%ebx
+    10be:	7e cd                	jle    108d <createdelete+0x94>
+    10c0:	f6 c3 01             	test   $0x1,%bl
+    10c3:	75 c8                	jne    108d <createdelete+0x94>
+          name[1] = '0' + (i / 2);
+    10c5:	89 d8                	mov    %ebx,%eax
+    10c7:	c1 e8 1f             	shr    $0x1f,%eax
+    10ca:	01 d8                	add    %ebx,%eax
+    10cc:	d1 f8                	sar    %eax
+    10ce:	83 c0 30             	add    $0x30,%eax
+    10d1:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    10d4:	83 ec 0c             	sub    $0xc,%esp
+    10d7:	56                   	push   %esi
+    10d8:	e8 6c 27 00 00       	call   3849 <unlink>
+    10dd:	83 c4 10             	add    $0x10,%esp
+    10e0:	85 c0                	test   %eax,%eax
+    10e2:	79 a9                	jns    108d <createdelete+0x94>
+            printf(1, "unlink failed\n");
+    10e4:	83 ec 08             	sub    $0x8,%esp
+    10e7:	68 81 3d 00 00       	push   $0x3d81
+    10ec:	6a 01                	push   $0x1
+    10ee:	e8 de 28 00 00       	call   39d1 <printf>
+            exit();
+    10f3:	e8 01 27 00 00       	call   37f9 <exit>
+      exit();
+    10f8:	e8 fc 26 00 00       	call   37f9 <exit>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    10fd:	83 fe 08             	cmp    $0x8,%esi
+    1100:	76 52                	jbe    1154 <createdelete+0x15b>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    1102:	85 c0                	test   %eax,%eax
+    1104:	79 6a                	jns    1170 <createdelete+0x177>
+    for(pi = 0; pi < 4; pi++){
+    1106:	83 c3 01             	add    $0x1,%ebx
+    1109:	80 fb 74             	cmp    $0x74,%bl
+    110c:	74 70                	je     117e <createdelete+0x185>
+      name[0] = 'p' + pi;
+    110e:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    1111:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1115:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1118:	83 ec 08             	sub    $0x8,%esp
+    111b:	6a 00                	push   $0x0
+    111d:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1120:	50                   	push   %eax
+    1121:	e8 13 27 00 00       	call   3839 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1126:	83 c4 10             	add    $0x10,%esp
+    1129:	85 ff                	test   %edi,%edi
+    112b:	0f 94 c2             	sete   %dl
+    112e:	83 ff 09             	cmp    $0x9,%edi
+    1131:	0f 9f c1             	setg   %cl
+    1134:	08 ca                	or     %cl,%dl
+    1136:	74 c5                	je     10fd <createdelete+0x104>
+    1138:	85 c0                	test   %eax,%eax
+    113a:	79 c1                	jns    10fd <createdelete+0x104>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    113c:	83 ec 04             	sub    $0x4,%esp
+    113f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1142:	50                   	push   %eax
+    1143:	68 40 4e 00 00       	push   $0x4e40
+    1148:	6a 01                	push   $0x1
+    114a:	e8 82 28 00 00       	call   39d1 <printf>
+        exit();
+    114f:	e8 a5 26 00 00       	call   37f9 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1154:	85 c0                	test   %eax,%eax
+    1156:	78 ae                	js     1106 <createdelete+0x10d>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1158:	83 ec 04             	sub    $0x4,%esp
+    115b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    115e:	50                   	push   %eax
+    115f:	68 64 4e 00 00       	push   $0x4e64
+    1164:	6a 01                	push   $0x1
+    1166:	e8 66 28 00 00       	call   39d1 <printf>
+        exit();
+    116b:	e8 89 26 00 00       	call   37f9 <exit>
+        close(fd);
+    1170:	83 ec 0c             	sub    $0xc,%esp
+    1173:	50                   	push   %eax
+    1174:	e8 a8 26 00 00       	call   3821 <close>
+    1179:	83 c4 10             	add    $0x10,%esp
+    117c:	eb 88                	jmp    1106 <createdelete+0x10d>
+  for(i = 0; i < N; i++){
+    117e:	83 c7 01             	add    $0x1,%edi
+    1181:	83 c6 01             	add    $0x1,%esi
+    1184:	80 45 c7 01          	addb   $0x1,-0x39(%ebp)
+    1188:	83 ff 14             	cmp    $0x14,%edi
+    118b:	74 3b                	je     11c8 <createdelete+0x1cf>
+  for(pi = 0; pi < 4; pi++){
+    118d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1192:	e9 77 ff ff ff       	jmp    110e <createdelete+0x115>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    1197:	83 c6 01             	add    $0x1,%esi
+    119a:	83 c7 01             	add    $0x1,%edi
+    119d:	89 f0                	mov    %esi,%eax
+    119f:	3c 84                	cmp    $0x84,%al
+    11a1:	74 31                	je     11d4 <createdelete+0x1db>
+  for(i = 0; i < N; i++){
+    11a3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    11a8:	89 f0                	mov    %esi,%eax
+    11aa:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    11ad:	89 f8                	mov    %edi,%eax
+    11af:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    11b2:	83 ec 0c             	sub    $0xc,%esp
+    11b5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    11b8:	50                   	push   %eax
+    11b9:	e8 8b 26 00 00       	call   3849 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    11be:	83 c4 10             	add    $0x10,%esp
+    11c1:	83 eb 01             	sub    $0x1,%ebx
+    11c4:	75 e2                	jne    11a8 <createdelete+0x1af>
+    11c6:	eb cf                	jmp    1197 <createdelete+0x19e>
+    11c8:	bf 30 00 00 00       	mov    $0x30,%edi
+    11cd:	be 70 00 00 00       	mov    $0x70,%esi
+    11d2:	eb cf                	jmp    11a3 <createdelete+0x1aa>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    11d4:	83 ec 08             	sub    $0x8,%esp
+    11d7:	68 93 41 00 00       	push   $0x4193
+    11dc:	6a 01                	push   $0x1
+    11de:	e8 ee 27 00 00       	call   39d1 <printf>
+}
+    11e3:	83 c4 10             	add    $0x10,%esp
+    11e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11e9:	5b                   	pop    %ebx
+    11ea:	5e                   	pop    %esi
+    11eb:	5f                   	pop    %edi
+    11ec:	5d                   	pop    %ebp
+    11ed:	c3                   	ret
+
+000011ee <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    11ee:	55                   	push   %ebp
+    11ef:	89 e5                	mov    %esp,%ebp
+    11f1:	56                   	push   %esi
+    11f2:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    11f3:	83 ec 08             	sub    $0x8,%esp
+    11f6:	68 a4 41 00 00       	push   $0x41a4
+    11fb:	6a 01                	push   $0x1
+    11fd:	e8 cf 27 00 00       	call   39d1 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1202:	83 c4 08             	add    $0x8,%esp
+    1205:	68 02 02 00 00       	push   $0x202
+    120a:	68 b5 41 00 00       	push   $0x41b5
+    120f:	e8 25 26 00 00       	call   3839 <open>
+  if(fd < 0){
+    1214:	83 c4 10             	add    $0x10,%esp
+    1217:	85 c0                	test   %eax,%eax
+    1219:	0f 88 f0 00 00 00    	js     130f <unlinkread+0x121>
+    121f:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    1221:	83 ec 04             	sub    $0x4,%esp
+    1224:	6a 05                	push   $0x5
+    1226:	68 da 41 00 00       	push   $0x41da
+    122b:	50                   	push   %eax
+    122c:	e8 e8 25 00 00       	call   3819 <write>
+  close(fd);
+    1231:	89 1c 24             	mov    %ebx,(%esp)
+    1234:	e8 e8 25 00 00       	call   3821 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    1239:	83 c4 08             	add    $0x8,%esp
+    123c:	6a 02                	push   $0x2
+    123e:	68 b5 41 00 00       	push   $0x41b5
+    1243:	e8 f1 25 00 00       	call   3839 <open>
+    1248:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    124a:	83 c4 10             	add    $0x10,%esp
+    124d:	85 c0                	test   %eax,%eax
+    124f:	0f 88 ce 00 00 00    	js     1323 <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    1255:	83 ec 0c             	sub    $0xc,%esp
+    1258:	68 b5 41 00 00       	push   $0x41b5
+    125d:	e8 e7 25 00 00       	call   3849 <unlink>
+    1262:	83 c4 10             	add    $0x10,%esp
+    1265:	85 c0                	test   %eax,%eax
+    1267:	0f 85 ca 00 00 00    	jne    1337 <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    126d:	83 ec 08             	sub    $0x8,%esp
+    1270:	68 02 02 00 00       	push   $0x202
+    1275:	68 b5 41 00 00       	push   $0x41b5
+    127a:	e8 ba 25 00 00       	call   3839 <open>
+    127f:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1281:	83 c4 0c             	add    $0xc,%esp
+    1284:	6a 03                	push   $0x3
+    1286:	68 12 42 00 00       	push   $0x4212
+    128b:	50                   	push   %eax
+    128c:	e8 88 25 00 00       	call   3819 <write>
+  close(fd1);
+    1291:	89 34 24             	mov    %esi,(%esp)
+    1294:	e8 88 25 00 00       	call   3821 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1299:	83 c4 0c             	add    $0xc,%esp
+    129c:	68 00 20 00 00       	push   $0x2000
+    12a1:	68 a0 84 00 00       	push   $0x84a0
+    12a6:	53                   	push   %ebx
+    12a7:	e8 65 25 00 00       	call   3811 <read>
+    12ac:	83 c4 10             	add    $0x10,%esp
+    12af:	83 f8 05             	cmp    $0x5,%eax
+    12b2:	0f 85 93 00 00 00    	jne    134b <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    12b8:	80 3d a0 84 00 00 68 	cmpb   $0x68,0x84a0
+    12bf:	0f 85 9a 00 00 00    	jne    135f <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    12c5:	83 ec 04             	sub    $0x4,%esp
+    12c8:	6a 0a                	push   $0xa
+    12ca:	68 a0 84 00 00       	push   $0x84a0
+    12cf:	53                   	push   %ebx
+    12d0:	e8 44 25 00 00       	call   3819 <write>
+    12d5:	83 c4 10             	add    $0x10,%esp
+    12d8:	83 f8 0a             	cmp    $0xa,%eax
+    12db:	0f 85 92 00 00 00    	jne    1373 <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    12e1:	83 ec 0c             	sub    $0xc,%esp
+    12e4:	53                   	push   %ebx
+    12e5:	e8 37 25 00 00       	call   3821 <close>
+  unlink("unlinkread");
+    12ea:	c7 04 24 b5 41 00 00 	movl   $0x41b5,(%esp)
+    12f1:	e8 53 25 00 00       	call   3849 <unlink>
+  printf(1, "unlinkread ok\n");
+    12f6:	83 c4 08             	add    $0x8,%esp
+    12f9:	68 5d 42 00 00       	push   $0x425d
+    12fe:	6a 01                	push   $0x1
+    1300:	e8 cc 26 00 00       	call   39d1 <printf>
+}
+    1305:	83 c4 10             	add    $0x10,%esp
+    1308:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    130b:	5b                   	pop    %ebx
+    130c:	5e                   	pop    %esi
+    130d:	5d                   	pop    %ebp
+    130e:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    130f:	83 ec 08             	sub    $0x8,%esp
+    1312:	68 c0 41 00 00       	push   $0x41c0
+    1317:	6a 01                	push   $0x1
+    1319:	e8 b3 26 00 00       	call   39d1 <printf>
+    exit();
+    131e:	e8 d6 24 00 00       	call   37f9 <exit>
+    printf(1, "open unlinkread failed\n");
+    1323:	83 ec 08             	sub    $0x8,%esp
+    1326:	68 e0 41 00 00       	push   $0x41e0
+    132b:	6a 01                	push   $0x1
+    132d:	e8 9f 26 00 00       	call   39d1 <printf>
+    exit();
+    1332:	e8 c2 24 00 00       	call   37f9 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1337:	83 ec 08             	sub    $0x8,%esp
+    133a:	68 f8 41 00 00       	push   $0x41f8
+    133f:	6a 01                	push   $0x1
+    1341:	e8 8b 26 00 00       	call   39d1 <printf>
+    exit();
+    1346:	e8 ae 24 00 00       	call   37f9 <exit>
+    printf(1, "unlinkread read failed");
+    134b:	83 ec 08             	sub    $0x8,%esp
+    134e:	68 16 42 00 00       	push   $0x4216
+    1353:	6a 01                	push   $0x1
+    1355:	e8 77 26 00 00       	call   39d1 <printf>
+    exit();
+    135a:	e8 9a 24 00 00       	call   37f9 <exit>
+    printf(1, "unlinkread wrong data\n");
+    135f:	83 ec 08             	sub    $0x8,%esp
+    1362:	68 2d 42 00 00       	push   $0x422d
+    1367:	6a 01                	push   $0x1
+    1369:	e8 63 26 00 00       	call   39d1 <printf>
+    exit();
+    136e:	e8 86 24 00 00       	call   37f9 <exit>
+    printf(1, "unlinkread write failed\n");
+    1373:	83 ec 08             	sub    $0x8,%esp
+    1376:	68 44 42 00 00       	push   $0x4244
+    137b:	6a 01                	push   $0x1
+    137d:	e8 4f 26 00 00       	call   39d1 <printf>
+    exit();
+    1382:	e8 72 24 00 00       	call   37f9 <exit>
+
+00001387 <linktest>:
+
+void
+linktest(void)
+{
+    1387:	55                   	push   %ebp
+    1388:	89 e5                	mov    %esp,%ebp
+    138a:	53                   	push   %ebx
+    138b:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    138e:	68 6c 42 00 00       	push   $0x426c
+    1393:	6a 01                	push   $0x1
+    1395:	e8 37 26 00 00       	call   39d1 <printf>
+
+  unlink("lf1");
+    139a:	c7 04 24 76 42 00 00 	movl   $0x4276,(%esp)
+    13a1:	e8 a3 24 00 00       	call   3849 <unlink>
+  unlink("lf2");
+    13a6:	c7 04 24 7a 42 00 00 	movl   $0x427a,(%esp)
+    13ad:	e8 97 24 00 00       	call   3849 <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    13b2:	83 c4 08             	add    $0x8,%esp
+    13b5:	68 02 02 00 00       	push   $0x202
+    13ba:	68 76 42 00 00       	push   $0x4276
+    13bf:	e8 75 24 00 00       	call   3839 <open>
+  if(fd < 0){
+    13c4:	83 c4 10             	add    $0x10,%esp
+    13c7:	85 c0                	test   %eax,%eax
+    13c9:	0f 88 2a 01 00 00    	js     14f9 <linktest+0x172>
+    13cf:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    13d1:	83 ec 04             	sub    $0x4,%esp
+    13d4:	6a 05                	push   $0x5
+    13d6:	68 da 41 00 00       	push   $0x41da
+    13db:	50                   	push   %eax
+    13dc:	e8 38 24 00 00       	call   3819 <write>
+    13e1:	83 c4 10             	add    $0x10,%esp
+    13e4:	83 f8 05             	cmp    $0x5,%eax
+    13e7:	0f 85 20 01 00 00    	jne    150d <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    13ed:	83 ec 0c             	sub    $0xc,%esp
+    13f0:	53                   	push   %ebx
+    13f1:	e8 2b 24 00 00       	call   3821 <close>
+
+  if(link("lf1", "lf2") < 0){
+    13f6:	83 c4 08             	add    $0x8,%esp
+    13f9:	68 7a 42 00 00       	push   $0x427a
+    13fe:	68 76 42 00 00       	push   $0x4276
+    1403:	e8 51 24 00 00       	call   3859 <link>
+    1408:	83 c4 10             	add    $0x10,%esp
+    140b:	85 c0                	test   %eax,%eax
+    140d:	0f 88 0e 01 00 00    	js     1521 <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    1413:	83 ec 0c             	sub    $0xc,%esp
+    1416:	68 76 42 00 00       	push   $0x4276
+    141b:	e8 29 24 00 00       	call   3849 <unlink>
+
+  if(open("lf1", 0) >= 0){
+    1420:	83 c4 08             	add    $0x8,%esp
+    1423:	6a 00                	push   $0x0
+    1425:	68 76 42 00 00       	push   $0x4276
+    142a:	e8 0a 24 00 00       	call   3839 <open>
+    142f:	83 c4 10             	add    $0x10,%esp
+    1432:	85 c0                	test   %eax,%eax
+    1434:	0f 89 fb 00 00 00    	jns    1535 <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    143a:	83 ec 08             	sub    $0x8,%esp
+    143d:	6a 00                	push   $0x0
+    143f:	68 7a 42 00 00       	push   $0x427a
+    1444:	e8 f0 23 00 00       	call   3839 <open>
+    1449:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    144b:	83 c4 10             	add    $0x10,%esp
+    144e:	85 c0                	test   %eax,%eax
+    1450:	0f 88 f3 00 00 00    	js     1549 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1456:	83 ec 04             	sub    $0x4,%esp
+    1459:	68 00 20 00 00       	push   $0x2000
+    145e:	68 a0 84 00 00       	push   $0x84a0
+    1463:	50                   	push   %eax
+    1464:	e8 a8 23 00 00       	call   3811 <read>
+    1469:	83 c4 10             	add    $0x10,%esp
+    146c:	83 f8 05             	cmp    $0x5,%eax
+    146f:	0f 85 e8 00 00 00    	jne    155d <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    1475:	83 ec 0c             	sub    $0xc,%esp
+    1478:	53                   	push   %ebx
+    1479:	e8 a3 23 00 00       	call   3821 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    147e:	83 c4 08             	add    $0x8,%esp
+    1481:	68 7a 42 00 00       	push   $0x427a
+    1486:	68 7a 42 00 00       	push   $0x427a
+    148b:	e8 c9 23 00 00       	call   3859 <link>
+    1490:	83 c4 10             	add    $0x10,%esp
+    1493:	85 c0                	test   %eax,%eax
+    1495:	0f 89 d6 00 00 00    	jns    1571 <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    149b:	83 ec 0c             	sub    $0xc,%esp
+    149e:	68 7a 42 00 00       	push   $0x427a
+    14a3:	e8 a1 23 00 00       	call   3849 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    14a8:	83 c4 08             	add    $0x8,%esp
+    14ab:	68 76 42 00 00       	push   $0x4276
+    14b0:	68 7a 42 00 00       	push   $0x427a
+    14b5:	e8 9f 23 00 00       	call   3859 <link>
+    14ba:	83 c4 10             	add    $0x10,%esp
+    14bd:	85 c0                	test   %eax,%eax
+    14bf:	0f 89 c0 00 00 00    	jns    1585 <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    14c5:	83 ec 08             	sub    $0x8,%esp
+    14c8:	68 76 42 00 00       	push   $0x4276
+    14cd:	68 3e 45 00 00       	push   $0x453e
+    14d2:	e8 82 23 00 00       	call   3859 <link>
+    14d7:	83 c4 10             	add    $0x10,%esp
+    14da:	85 c0                	test   %eax,%eax
+    14dc:	0f 89 b7 00 00 00    	jns    1599 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    14e2:	83 ec 08             	sub    $0x8,%esp
+    14e5:	68 14 43 00 00       	push   $0x4314
+    14ea:	6a 01                	push   $0x1
+    14ec:	e8 e0 24 00 00       	call   39d1 <printf>
+}
+    14f1:	83 c4 10             	add    $0x10,%esp
+    14f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14f7:	c9                   	leave
+    14f8:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    14f9:	83 ec 08             	sub    $0x8,%esp
+    14fc:	68 7e 42 00 00       	push   $0x427e
+    1501:	6a 01                	push   $0x1
+    1503:	e8 c9 24 00 00       	call   39d1 <printf>
+    exit();
+    1508:	e8 ec 22 00 00       	call   37f9 <exit>
+    printf(1, "write lf1 failed\n");
+    150d:	83 ec 08             	sub    $0x8,%esp
+    1510:	68 91 42 00 00       	push   $0x4291
+    1515:	6a 01                	push   $0x1
+    1517:	e8 b5 24 00 00       	call   39d1 <printf>
+    exit();
+    151c:	e8 d8 22 00 00       	call   37f9 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1521:	83 ec 08             	sub    $0x8,%esp
+    1524:	68 a3 42 00 00       	push   $0x42a3
+    1529:	6a 01                	push   $0x1
+    152b:	e8 a1 24 00 00       	call   39d1 <printf>
+    exit();
+    1530:	e8 c4 22 00 00       	call   37f9 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1535:	83 ec 08             	sub    $0x8,%esp
+    1538:	68 84 4e 00 00       	push   $0x4e84
+    153d:	6a 01                	push   $0x1
+    153f:	e8 8d 24 00 00       	call   39d1 <printf>
+    exit();
+    1544:	e8 b0 22 00 00       	call   37f9 <exit>
+    printf(1, "open lf2 failed\n");
+    1549:	83 ec 08             	sub    $0x8,%esp
+    154c:	68 b8 42 00 00       	push   $0x42b8
+    1551:	6a 01                	push   $0x1
+    1553:	e8 79 24 00 00       	call   39d1 <printf>
+    exit();
+    1558:	e8 9c 22 00 00       	call   37f9 <exit>
+    printf(1, "read lf2 failed\n");
+    155d:	83 ec 08             	sub    $0x8,%esp
+    1560:	68 c9 42 00 00       	push   $0x42c9
+    1565:	6a 01                	push   $0x1
+    1567:	e8 65 24 00 00       	call   39d1 <printf>
+    exit();
+    156c:	e8 88 22 00 00       	call   37f9 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1571:	83 ec 08             	sub    $0x8,%esp
+    1574:	68 da 42 00 00       	push   $0x42da
+    1579:	6a 01                	push   $0x1
+    157b:	e8 51 24 00 00       	call   39d1 <printf>
+    exit();
+    1580:	e8 74 22 00 00       	call   37f9 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1585:	83 ec 08             	sub    $0x8,%esp
+    1588:	68 ac 4e 00 00       	push   $0x4eac
+    158d:	6a 01                	push   $0x1
+    158f:	e8 3d 24 00 00       	call   39d1 <printf>
+    exit();
+    1594:	e8 60 22 00 00       	call   37f9 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1599:	83 ec 08             	sub    $0x8,%esp
+    159c:	68 f8 42 00 00       	push   $0x42f8
+    15a1:	6a 01                	push   $0x1
+    15a3:	e8 29 24 00 00       	call   39d1 <printf>
+    exit();
+    15a8:	e8 4c 22 00 00       	call   37f9 <exit>
+
+000015ad <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    15ad:	55                   	push   %ebp
+    15ae:	89 e5                	mov    %esp,%ebp
+    15b0:	57                   	push   %edi
+    15b1:	56                   	push   %esi
+    15b2:	53                   	push   %ebx
+    15b3:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    15b6:	68 21 43 00 00       	push   $0x4321
+    15bb:	6a 01                	push   $0x1
+    15bd:	e8 0f 24 00 00       	call   39d1 <printf>
+  file[0] = 'C';
+    15c2:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    15c6:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    15ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 40; i++){
+    15cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    file[1] = '0' + i;
+    unlink(file);
+    15d2:	8d 75 e5             	lea    -0x1b(%ebp),%esi
+    pid = fork();
+    if(pid && (i % 3) == 1){
+    15d5:	bf 56 55 55 55       	mov    $0x55555556,%edi
+    15da:	e9 75 02 00 00       	jmp    1854 <concreate+0x2a7>
+      link("C0", file);
+    15df:	83 ec 08             	sub    $0x8,%esp
+    15e2:	56                   	push   %esi
+    15e3:	68 31 43 00 00       	push   $0x4331
+    15e8:	e8 6c 22 00 00       	call   3859 <link>
+    15ed:	83 c4 10             	add    $0x10,%esp
+    15f0:	e9 4e 02 00 00       	jmp    1843 <concreate+0x296>
+    } else if(pid == 0 && (i % 5) == 1){
+    15f5:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    15fa:	89 d8                	mov    %ebx,%eax
+    15fc:	f7 ea                	imul   %edx
+    15fe:	d1 fa                	sar    %edx
+    1600:	89 d8                	mov    %ebx,%eax
+    1602:	c1 f8 1f             	sar    $0x1f,%eax
+    1605:	29 c2                	sub    %eax,%edx
+    1607:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    160a:	29 c3                	sub    %eax,%ebx
+    160c:	83 fb 01             	cmp    $0x1,%ebx
+    160f:	74 34                	je     1645 <concreate+0x98>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1611:	83 ec 08             	sub    $0x8,%esp
+    1614:	68 02 02 00 00       	push   $0x202
+    1619:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    161c:	50                   	push   %eax
+    161d:	e8 17 22 00 00       	call   3839 <open>
+      if(fd < 0){
+    1622:	83 c4 10             	add    $0x10,%esp
+    1625:	85 c0                	test   %eax,%eax
+    1627:	0f 89 f9 01 00 00    	jns    1826 <concreate+0x279>
+        printf(1, "concreate create %s failed\n", file);
+    162d:	83 ec 04             	sub    $0x4,%esp
+    1630:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1633:	50                   	push   %eax
+    1634:	68 34 43 00 00       	push   $0x4334
+    1639:	6a 01                	push   $0x1
+    163b:	e8 91 23 00 00       	call   39d1 <printf>
+        exit();
+    1640:	e8 b4 21 00 00       	call   37f9 <exit>
+      link("C0", file);
+    1645:	83 ec 08             	sub    $0x8,%esp
+    1648:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    164b:	50                   	push   %eax
+    164c:	68 31 43 00 00       	push   $0x4331
+    1651:	e8 03 22 00 00       	call   3859 <link>
+    1656:	83 c4 10             	add    $0x10,%esp
+      }
+      close(fd);
+    }
+    if(pid == 0)
+      exit();
+    1659:	e8 9b 21 00 00       	call   37f9 <exit>
+    else
+      wait();
+  }
+
+  memset(fa, 0, sizeof(fa));
+    165e:	83 ec 04             	sub    $0x4,%esp
+    1661:	6a 28                	push   $0x28
+    1663:	6a 00                	push   $0x0
+    1665:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1668:	50                   	push   %eax
+    1669:	e8 9d 1f 00 00       	call   360b <memset>
+  fd = open(".", 0);
+    166e:	83 c4 08             	add    $0x8,%esp
+    1671:	6a 00                	push   $0x0
+    1673:	68 3e 45 00 00       	push   $0x453e
+    1678:	e8 bc 21 00 00       	call   3839 <open>
+    167d:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    167f:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1682:	bf 00 00 00 00       	mov    $0x0,%edi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1687:	8d 75 ac             	lea    -0x54(%ebp),%esi
+    168a:	83 ec 04             	sub    $0x4,%esp
+    168d:	6a 10                	push   $0x10
+    168f:	56                   	push   %esi
+    1690:	53                   	push   %ebx
+    1691:	e8 7b 21 00 00       	call   3811 <read>
+    1696:	83 c4 10             	add    $0x10,%esp
+    1699:	85 c0                	test   %eax,%eax
+    169b:	7e 60                	jle    16fd <concreate+0x150>
+    if(de.inum == 0)
+    169d:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    16a2:	74 e6                	je     168a <concreate+0xdd>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    16a4:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    16a8:	75 e0                	jne    168a <concreate+0xdd>
+    16aa:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    16ae:	75 da                	jne    168a <concreate+0xdd>
+      i = de.name[1] - '0';
+    16b0:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    16b4:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    16b7:	83 f8 27             	cmp    $0x27,%eax
+    16ba:	77 11                	ja     16cd <concreate+0x120>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    16bc:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    16c1:	75 22                	jne    16e5 <concreate+0x138>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    16c3:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    16c8:	83 c7 01             	add    $0x1,%edi
+    16cb:	eb bd                	jmp    168a <concreate+0xdd>
+        printf(1, "concreate weird file %s\n", de.name);
+    16cd:	83 ec 04             	sub    $0x4,%esp
+    16d0:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    16d3:	50                   	push   %eax
+    16d4:	68 50 43 00 00       	push   $0x4350
+    16d9:	6a 01                	push   $0x1
+    16db:	e8 f1 22 00 00       	call   39d1 <printf>
+        exit();
+    16e0:	e8 14 21 00 00       	call   37f9 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    16e5:	83 ec 04             	sub    $0x4,%esp
+    16e8:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    16eb:	50                   	push   %eax
+    16ec:	68 69 43 00 00       	push   $0x4369
+    16f1:	6a 01                	push   $0x1
+    16f3:	e8 d9 22 00 00       	call   39d1 <printf>
+        exit();
+    16f8:	e8 fc 20 00 00       	call   37f9 <exit>
+    }
+  }
+  close(fd);
+    16fd:	83 ec 0c             	sub    $0xc,%esp
+    1700:	53                   	push   %ebx
+    1701:	e8 1b 21 00 00       	call   3821 <close>
+
+  if(n != 40){
+    1706:	83 c4 10             	add    $0x10,%esp
+    1709:	83 ff 28             	cmp    $0x28,%edi
+    170c:	75 0d                	jne    171b <concreate+0x16e>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    170e:	bb 00 00 00 00       	mov    $0x0,%ebx
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    1713:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    1716:	e9 88 00 00 00       	jmp    17a3 <concreate+0x1f6>
+    printf(1, "concreate not enough files in directory listing\n");
+    171b:	83 ec 08             	sub    $0x8,%esp
+    171e:	68 d0 4e 00 00       	push   $0x4ed0
+    1723:	6a 01                	push   $0x1
+    1725:	e8 a7 22 00 00       	call   39d1 <printf>
+    exit();
+    172a:	e8 ca 20 00 00       	call   37f9 <exit>
+      printf(1, "fork failed\n");
+    172f:	83 ec 08             	sub    $0x8,%esp
+    1732:	68 09 4c 00 00       	push   $0x4c09
+    1737:	6a 01                	push   $0x1
+    1739:	e8 93 22 00 00       	call   39d1 <printf>
+      exit();
+    173e:	e8 b6 20 00 00       	call   37f9 <exit>
+      close(open(file, 0));
+    1743:	83 ec 08             	sub    $0x8,%esp
+    1746:	6a 00                	push   $0x0
+    1748:	57                   	push   %edi
+    1749:	e8 eb 20 00 00       	call   3839 <open>
+    174e:	89 04 24             	mov    %eax,(%esp)
+    1751:	e8 cb 20 00 00       	call   3821 <close>
+      close(open(file, 0));
+    1756:	83 c4 08             	add    $0x8,%esp
+    1759:	6a 00                	push   $0x0
+    175b:	57                   	push   %edi
+    175c:	e8 d8 20 00 00       	call   3839 <open>
+    1761:	89 04 24             	mov    %eax,(%esp)
+    1764:	e8 b8 20 00 00       	call   3821 <close>
+      close(open(file, 0));
+    1769:	83 c4 08             	add    $0x8,%esp
+    176c:	6a 00                	push   $0x0
+    176e:	57                   	push   %edi
+    176f:	e8 c5 20 00 00       	call   3839 <open>
+    1774:	89 04 24             	mov    %eax,(%esp)
+    1777:	e8 a5 20 00 00       	call   3821 <close>
+      close(open(file, 0));
+    177c:	83 c4 08             	add    $0x8,%esp
+    177f:	6a 00                	push   $0x0
+    1781:	57                   	push   %edi
+    1782:	e8 b2 20 00 00       	call   3839 <open>
+    1787:	89 04 24             	mov    %eax,(%esp)
+    178a:	e8 92 20 00 00       	call   3821 <close>
+    178f:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1792:	85 f6                	test   %esi,%esi
+    1794:	74 74                	je     180a <concreate+0x25d>
+      exit();
+    else
+      wait();
+    1796:	e8 66 20 00 00       	call   3801 <wait>
+  for(i = 0; i < 40; i++){
+    179b:	83 c3 01             	add    $0x1,%ebx
+    179e:	83 fb 28             	cmp    $0x28,%ebx
+    17a1:	74 6c                	je     180f <concreate+0x262>
+    file[1] = '0' + i;
+    17a3:	8d 43 30             	lea    0x30(%ebx),%eax
+    17a6:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    17a9:	e8 43 20 00 00       	call   37f1 <fork>
+    17ae:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    17b0:	85 c0                	test   %eax,%eax
+    17b2:	0f 88 77 ff ff ff    	js     172f <concreate+0x182>
+    if(((i % 3) == 0 && pid == 0) ||
+    17b8:	b8 56 55 55 55       	mov    $0x55555556,%eax
+    17bd:	f7 eb                	imul   %ebx
+    17bf:	89 d8                	mov    %ebx,%eax
+    17c1:	c1 f8 1f             	sar    $0x1f,%eax
+    17c4:	29 c2                	sub    %eax,%edx
+    17c6:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    17c9:	89 da                	mov    %ebx,%edx
+    17cb:	29 c2                	sub    %eax,%edx
+    17cd:	89 d0                	mov    %edx,%eax
+    17cf:	09 f0                	or     %esi,%eax
+    17d1:	0f 84 6c ff ff ff    	je     1743 <concreate+0x196>
+       ((i % 3) == 1 && pid != 0)){
+    17d7:	85 f6                	test   %esi,%esi
+    17d9:	74 09                	je     17e4 <concreate+0x237>
+    17db:	83 fa 01             	cmp    $0x1,%edx
+    17de:	0f 84 5f ff ff ff    	je     1743 <concreate+0x196>
+      unlink(file);
+    17e4:	83 ec 0c             	sub    $0xc,%esp
+    17e7:	57                   	push   %edi
+    17e8:	e8 5c 20 00 00       	call   3849 <unlink>
+      unlink(file);
+    17ed:	89 3c 24             	mov    %edi,(%esp)
+    17f0:	e8 54 20 00 00       	call   3849 <unlink>
+      unlink(file);
+    17f5:	89 3c 24             	mov    %edi,(%esp)
+    17f8:	e8 4c 20 00 00       	call   3849 <unlink>
+      unlink(file);
+    17fd:	89 3c 24             	mov    %edi,(%esp)
+    1800:	e8 44 20 00 00       	call   3849 <unlink>
+    1805:	83 c4 10             	add    $0x10,%esp
+    1808:	eb 88                	jmp    1792 <concreate+0x1e5>
+      exit();
+    180a:	e8 ea 1f 00 00       	call   37f9 <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    180f:	83 ec 08             	sub    $0x8,%esp
+    1812:	68 86 43 00 00       	push   $0x4386
+    1817:	6a 01                	push   $0x1
+    1819:	e8 b3 21 00 00       	call   39d1 <printf>
+}
+    181e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1821:	5b                   	pop    %ebx
+    1822:	5e                   	pop    %esi
+    1823:	5f                   	pop    %edi
+    1824:	5d                   	pop    %ebp
+    1825:	c3                   	ret
+      close(fd);
+    1826:	83 ec 0c             	sub    $0xc,%esp
+    1829:	50                   	push   %eax
+    182a:	e8 f2 1f 00 00       	call   3821 <close>
+    182f:	83 c4 10             	add    $0x10,%esp
+    1832:	e9 22 fe ff ff       	jmp    1659 <concreate+0xac>
+    1837:	83 ec 0c             	sub    $0xc,%esp
+    183a:	50                   	push   %eax
+    183b:	e8 e1 1f 00 00       	call   3821 <close>
+    1840:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1843:	e8 b9 1f 00 00       	call   3801 <wait>
+  for(i = 0; i < 40; i++){
+    1848:	83 c3 01             	add    $0x1,%ebx
+    184b:	83 fb 28             	cmp    $0x28,%ebx
+    184e:	0f 84 0a fe ff ff    	je     165e <concreate+0xb1>
+    file[1] = '0' + i;
+    1854:	8d 43 30             	lea    0x30(%ebx),%eax
+    1857:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    185a:	83 ec 0c             	sub    $0xc,%esp
+    185d:	56                   	push   %esi
+    185e:	e8 e6 1f 00 00       	call   3849 <unlink>
+    pid = fork();
+    1863:	e8 89 1f 00 00       	call   37f1 <fork>
+    if(pid && (i % 3) == 1){
+    1868:	83 c4 10             	add    $0x10,%esp
+    186b:	85 c0                	test   %eax,%eax
+    186d:	0f 84 82 fd ff ff    	je     15f5 <concreate+0x48>
+    1873:	89 d8                	mov    %ebx,%eax
+    1875:	f7 ef                	imul   %edi
+    1877:	89 d8                	mov    %ebx,%eax
+    1879:	c1 f8 1f             	sar    $0x1f,%eax
+    187c:	29 c2                	sub    %eax,%edx
+    187e:	8d 14 52             	lea    (%edx,%edx,2),%edx
+    1881:	89 d8                	mov    %ebx,%eax
+    1883:	29 d0                	sub    %edx,%eax
+    1885:	83 f8 01             	cmp    $0x1,%eax
+    1888:	0f 84 51 fd ff ff    	je     15df <concreate+0x32>
+      fd = open(file, O_CREATE | O_RDWR);
+    188e:	83 ec 08             	sub    $0x8,%esp
+    1891:	68 02 02 00 00       	push   $0x202
+    1896:	56                   	push   %esi
+    1897:	e8 9d 1f 00 00       	call   3839 <open>
+      if(fd < 0){
+    189c:	83 c4 10             	add    $0x10,%esp
+    189f:	85 c0                	test   %eax,%eax
+    18a1:	79 94                	jns    1837 <concreate+0x28a>
+    18a3:	e9 85 fd ff ff       	jmp    162d <concreate+0x80>
+
+000018a8 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    18a8:	55                   	push   %ebp
+    18a9:	89 e5                	mov    %esp,%ebp
+    18ab:	57                   	push   %edi
+    18ac:	56                   	push   %esi
+    18ad:	53                   	push   %ebx
+    18ae:	83 ec 24             	sub    $0x24,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    18b1:	68 94 43 00 00       	push   $0x4394
+    18b6:	6a 01                	push   $0x1
+    18b8:	e8 14 21 00 00       	call   39d1 <printf>
+
+  unlink("x");
+    18bd:	c7 04 24 21 46 00 00 	movl   $0x4621,(%esp)
+    18c4:	e8 80 1f 00 00       	call   3849 <unlink>
+  pid = fork();
+    18c9:	e8 23 1f 00 00       	call   37f1 <fork>
+    18ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    18d1:	83 c4 10             	add    $0x10,%esp
+    18d4:	85 c0                	test   %eax,%eax
+    18d6:	78 18                	js     18f0 <linkunlink+0x48>
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    18d8:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    18dc:	19 db                	sbb    %ebx,%ebx
+    18de:	83 e3 60             	and    $0x60,%ebx
+    18e1:	83 c3 01             	add    $0x1,%ebx
+    18e4:	be 64 00 00 00       	mov    $0x64,%esi
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+    18e9:	bf ab aa aa aa       	mov    $0xaaaaaaab,%edi
+    18ee:	eb 36                	jmp    1926 <linkunlink+0x7e>
+    printf(1, "fork failed\n");
+    18f0:	83 ec 08             	sub    $0x8,%esp
+    18f3:	68 09 4c 00 00       	push   $0x4c09
+    18f8:	6a 01                	push   $0x1
+    18fa:	e8 d2 20 00 00       	call   39d1 <printf>
+    exit();
+    18ff:	e8 f5 1e 00 00       	call   37f9 <exit>
+      close(open("x", O_RDWR | O_CREATE));
+    1904:	83 ec 08             	sub    $0x8,%esp
+    1907:	68 02 02 00 00       	push   $0x202
+    190c:	68 21 46 00 00       	push   $0x4621
+    1911:	e8 23 1f 00 00       	call   3839 <open>
+    1916:	89 04 24             	mov    %eax,(%esp)
+    1919:	e8 03 1f 00 00       	call   3821 <close>
+    191e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1921:	83 ee 01             	sub    $0x1,%esi
+    1924:	74 4d                	je     1973 <linkunlink+0xcb>
+    x = x * 1103515245 + 12345;
+    1926:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    192c:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    1932:	89 d8                	mov    %ebx,%eax
+    1934:	f7 e7                	mul    %edi
+    1936:	89 d0                	mov    %edx,%eax
+    1938:	d1 e8                	shr    %eax
+    193a:	83 e2 fe             	and    $0xfffffffe,%edx
+    193d:	01 c2                	add    %eax,%edx
+    193f:	89 d8                	mov    %ebx,%eax
+    1941:	29 d0                	sub    %edx,%eax
+    1943:	74 bf                	je     1904 <linkunlink+0x5c>
+    } else if((x % 3) == 1){
+    1945:	83 f8 01             	cmp    $0x1,%eax
+    1948:	74 12                	je     195c <linkunlink+0xb4>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    194a:	83 ec 0c             	sub    $0xc,%esp
+    194d:	68 21 46 00 00       	push   $0x4621
+    1952:	e8 f2 1e 00 00       	call   3849 <unlink>
+    1957:	83 c4 10             	add    $0x10,%esp
+    195a:	eb c5                	jmp    1921 <linkunlink+0x79>
+      link("cat", "x");
+    195c:	83 ec 08             	sub    $0x8,%esp
+    195f:	68 21 46 00 00       	push   $0x4621
+    1964:	68 a5 43 00 00       	push   $0x43a5
+    1969:	e8 eb 1e 00 00       	call   3859 <link>
+    196e:	83 c4 10             	add    $0x10,%esp
+    1971:	eb ae                	jmp    1921 <linkunlink+0x79>
+    }
+  }
+
+  if(pid)
+    1973:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1977:	74 1c                	je     1995 <linkunlink+0xed>
+    wait();
+    1979:	e8 83 1e 00 00       	call   3801 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    197e:	83 ec 08             	sub    $0x8,%esp
+    1981:	68 a9 43 00 00       	push   $0x43a9
+    1986:	6a 01                	push   $0x1
+    1988:	e8 44 20 00 00       	call   39d1 <printf>
+}
+    198d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1990:	5b                   	pop    %ebx
+    1991:	5e                   	pop    %esi
+    1992:	5f                   	pop    %edi
+    1993:	5d                   	pop    %ebp
+    1994:	c3                   	ret
+    exit();
+    1995:	e8 5f 1e 00 00       	call   37f9 <exit>
+
+0000199a <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    199a:	55                   	push   %ebp
+    199b:	89 e5                	mov    %esp,%ebp
+    199d:	57                   	push   %edi
+    199e:	56                   	push   %esi
+    199f:	53                   	push   %ebx
+    19a0:	83 ec 24             	sub    $0x24,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    19a3:	68 b8 43 00 00       	push   $0x43b8
+    19a8:	6a 01                	push   $0x1
+    19aa:	e8 22 20 00 00       	call   39d1 <printf>
+  unlink("bd");
+    19af:	c7 04 24 c5 43 00 00 	movl   $0x43c5,(%esp)
+    19b6:	e8 8e 1e 00 00       	call   3849 <unlink>
+
+  fd = open("bd", O_CREATE);
+    19bb:	83 c4 08             	add    $0x8,%esp
+    19be:	68 00 02 00 00       	push   $0x200
+    19c3:	68 c5 43 00 00       	push   $0x43c5
+    19c8:	e8 6c 1e 00 00       	call   3839 <open>
+  if(fd < 0){
+    19cd:	83 c4 10             	add    $0x10,%esp
+    19d0:	85 c0                	test   %eax,%eax
+    19d2:	0f 88 e0 00 00 00    	js     1ab8 <bigdir+0x11e>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    19d8:	83 ec 0c             	sub    $0xc,%esp
+    19db:	50                   	push   %eax
+    19dc:	e8 40 1e 00 00       	call   3821 <close>
+    19e1:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    19e4:	be 00 00 00 00       	mov    $0x0,%esi
+    name[0] = 'x';
+    name[1] = '0' + (i / 64);
+    name[2] = '0' + (i % 64);
+    name[3] = '\0';
+    if(link("bd", name) != 0){
+    19e9:	8d 7d de             	lea    -0x22(%ebp),%edi
+    name[0] = 'x';
+    19ec:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    19f0:	8d 46 3f             	lea    0x3f(%esi),%eax
+    19f3:	85 f6                	test   %esi,%esi
+    19f5:	0f 49 c6             	cmovns %esi,%eax
+    19f8:	c1 f8 06             	sar    $0x6,%eax
+    19fb:	83 c0 30             	add    $0x30,%eax
+    19fe:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1a01:	89 f2                	mov    %esi,%edx
+    1a03:	c1 fa 1f             	sar    $0x1f,%edx
+    1a06:	c1 ea 1a             	shr    $0x1a,%edx
+    1a09:	8d 04 16             	lea    (%esi,%edx,1),%eax
+    1a0c:	83 e0 3f             	and    $0x3f,%eax
+    1a0f:	29 d0                	sub    %edx,%eax
+    1a11:	83 c0 30             	add    $0x30,%eax
+    1a14:	88 45 e0             	mov    %al,-0x20(%ebp)
+    name[3] = '\0';
+    1a17:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    if(link("bd", name) != 0){
+    1a1b:	83 ec 08             	sub    $0x8,%esp
+    1a1e:	57                   	push   %edi
+    1a1f:	68 c5 43 00 00       	push   $0x43c5
+    1a24:	e8 30 1e 00 00       	call   3859 <link>
+    1a29:	89 c3                	mov    %eax,%ebx
+    1a2b:	83 c4 10             	add    $0x10,%esp
+    1a2e:	85 c0                	test   %eax,%eax
+    1a30:	0f 85 96 00 00 00    	jne    1acc <bigdir+0x132>
+  for(i = 0; i < 500; i++){
+    1a36:	83 c6 01             	add    $0x1,%esi
+    1a39:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1a3f:	75 ab                	jne    19ec <bigdir+0x52>
+      printf(1, "bigdir link failed\n");
+      exit();
+    }
+  }
+
+  unlink("bd");
+    1a41:	83 ec 0c             	sub    $0xc,%esp
+    1a44:	68 c5 43 00 00       	push   $0x43c5
+    1a49:	e8 fb 1d 00 00       	call   3849 <unlink>
+    1a4e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    name[0] = 'x';
+    name[1] = '0' + (i / 64);
+    name[2] = '0' + (i % 64);
+    name[3] = '\0';
+    if(unlink(name) != 0){
+    1a51:	8d 75 de             	lea    -0x22(%ebp),%esi
+    name[0] = 'x';
+    1a54:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1a58:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1a5b:	85 db                	test   %ebx,%ebx
+    1a5d:	0f 49 c3             	cmovns %ebx,%eax
+    1a60:	c1 f8 06             	sar    $0x6,%eax
+    1a63:	83 c0 30             	add    $0x30,%eax
+    1a66:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1a69:	89 da                	mov    %ebx,%edx
+    1a6b:	c1 fa 1f             	sar    $0x1f,%edx
+    1a6e:	c1 ea 1a             	shr    $0x1a,%edx
+    1a71:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1a74:	83 e0 3f             	and    $0x3f,%eax
+    1a77:	29 d0                	sub    %edx,%eax
+    1a79:	83 c0 30             	add    $0x30,%eax
+    1a7c:	88 45 e0             	mov    %al,-0x20(%ebp)
+    name[3] = '\0';
+    1a7f:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    if(unlink(name) != 0){
+    1a83:	83 ec 0c             	sub    $0xc,%esp
+    1a86:	56                   	push   %esi
+    1a87:	e8 bd 1d 00 00       	call   3849 <unlink>
+    1a8c:	83 c4 10             	add    $0x10,%esp
+    1a8f:	85 c0                	test   %eax,%eax
+    1a91:	75 4d                	jne    1ae0 <bigdir+0x146>
+  for(i = 0; i < 500; i++){
+    1a93:	83 c3 01             	add    $0x1,%ebx
+    1a96:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1a9c:	75 b6                	jne    1a54 <bigdir+0xba>
+      printf(1, "bigdir unlink failed");
+      exit();
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1a9e:	83 ec 08             	sub    $0x8,%esp
+    1aa1:	68 07 44 00 00       	push   $0x4407
+    1aa6:	6a 01                	push   $0x1
+    1aa8:	e8 24 1f 00 00       	call   39d1 <printf>
+}
+    1aad:	83 c4 10             	add    $0x10,%esp
+    1ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ab3:	5b                   	pop    %ebx
+    1ab4:	5e                   	pop    %esi
+    1ab5:	5f                   	pop    %edi
+    1ab6:	5d                   	pop    %ebp
+    1ab7:	c3                   	ret
+    printf(1, "bigdir create failed\n");
+    1ab8:	83 ec 08             	sub    $0x8,%esp
+    1abb:	68 c8 43 00 00       	push   $0x43c8
+    1ac0:	6a 01                	push   $0x1
+    1ac2:	e8 0a 1f 00 00       	call   39d1 <printf>
+    exit();
+    1ac7:	e8 2d 1d 00 00       	call   37f9 <exit>
+      printf(1, "bigdir link failed\n");
+    1acc:	83 ec 08             	sub    $0x8,%esp
+    1acf:	68 de 43 00 00       	push   $0x43de
+    1ad4:	6a 01                	push   $0x1
+    1ad6:	e8 f6 1e 00 00       	call   39d1 <printf>
+      exit();
+    1adb:	e8 19 1d 00 00       	call   37f9 <exit>
+      printf(1, "bigdir unlink failed");
+    1ae0:	83 ec 08             	sub    $0x8,%esp
+    1ae3:	68 f2 43 00 00       	push   $0x43f2
+    1ae8:	6a 01                	push   $0x1
+    1aea:	e8 e2 1e 00 00       	call   39d1 <printf>
+      exit();
+    1aef:	e8 05 1d 00 00       	call   37f9 <exit>
+
+00001af4 <subdir>:
+
+void
+subdir(void)
+{
+    1af4:	55                   	push   %ebp
+    1af5:	89 e5                	mov    %esp,%ebp
+    1af7:	53                   	push   %ebx
+    1af8:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1afb:	68 12 44 00 00       	push   $0x4412
+    1b00:	6a 01                	push   $0x1
+    1b02:	e8 ca 1e 00 00       	call   39d1 <printf>
+
+  unlink("ff");
+    1b07:	c7 04 24 9b 44 00 00 	movl   $0x449b,(%esp)
+    1b0e:	e8 36 1d 00 00       	call   3849 <unlink>
+  if(mkdir("dd") != 0){
+    1b13:	c7 04 24 38 45 00 00 	movl   $0x4538,(%esp)
+    1b1a:	e8 42 1d 00 00       	call   3861 <mkdir>
+    1b1f:	83 c4 10             	add    $0x10,%esp
+    1b22:	85 c0                	test   %eax,%eax
+    1b24:	0f 85 14 04 00 00    	jne    1f3e <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1b2a:	83 ec 08             	sub    $0x8,%esp
+    1b2d:	68 02 02 00 00       	push   $0x202
+    1b32:	68 71 44 00 00       	push   $0x4471
+    1b37:	e8 fd 1c 00 00       	call   3839 <open>
+    1b3c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1b3e:	83 c4 10             	add    $0x10,%esp
+    1b41:	85 c0                	test   %eax,%eax
+    1b43:	0f 88 09 04 00 00    	js     1f52 <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    1b49:	83 ec 04             	sub    $0x4,%esp
+    1b4c:	6a 02                	push   $0x2
+    1b4e:	68 9b 44 00 00       	push   $0x449b
+    1b53:	50                   	push   %eax
+    1b54:	e8 c0 1c 00 00       	call   3819 <write>
+  close(fd);
+    1b59:	89 1c 24             	mov    %ebx,(%esp)
+    1b5c:	e8 c0 1c 00 00       	call   3821 <close>
+
+  if(unlink("dd") >= 0){
+    1b61:	c7 04 24 38 45 00 00 	movl   $0x4538,(%esp)
+    1b68:	e8 dc 1c 00 00       	call   3849 <unlink>
+    1b6d:	83 c4 10             	add    $0x10,%esp
+    1b70:	85 c0                	test   %eax,%eax
+    1b72:	0f 89 ee 03 00 00    	jns    1f66 <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    1b78:	83 ec 0c             	sub    $0xc,%esp
+    1b7b:	68 4c 44 00 00       	push   $0x444c
+    1b80:	e8 dc 1c 00 00       	call   3861 <mkdir>
+    1b85:	83 c4 10             	add    $0x10,%esp
+    1b88:	85 c0                	test   %eax,%eax
+    1b8a:	0f 85 ea 03 00 00    	jne    1f7a <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1b90:	83 ec 08             	sub    $0x8,%esp
+    1b93:	68 02 02 00 00       	push   $0x202
+    1b98:	68 6e 44 00 00       	push   $0x446e
+    1b9d:	e8 97 1c 00 00       	call   3839 <open>
+    1ba2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ba4:	83 c4 10             	add    $0x10,%esp
+    1ba7:	85 c0                	test   %eax,%eax
+    1ba9:	0f 88 df 03 00 00    	js     1f8e <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    1baf:	83 ec 04             	sub    $0x4,%esp
+    1bb2:	6a 02                	push   $0x2
+    1bb4:	68 8f 44 00 00       	push   $0x448f
+    1bb9:	50                   	push   %eax
+    1bba:	e8 5a 1c 00 00       	call   3819 <write>
+  close(fd);
+    1bbf:	89 1c 24             	mov    %ebx,(%esp)
+    1bc2:	e8 5a 1c 00 00       	call   3821 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    1bc7:	83 c4 08             	add    $0x8,%esp
+    1bca:	6a 00                	push   $0x0
+    1bcc:	68 92 44 00 00       	push   $0x4492
+    1bd1:	e8 63 1c 00 00       	call   3839 <open>
+    1bd6:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1bd8:	83 c4 10             	add    $0x10,%esp
+    1bdb:	85 c0                	test   %eax,%eax
+    1bdd:	0f 88 bf 03 00 00    	js     1fa2 <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    1be3:	83 ec 04             	sub    $0x4,%esp
+    1be6:	68 00 20 00 00       	push   $0x2000
+    1beb:	68 a0 84 00 00       	push   $0x84a0
+    1bf0:	50                   	push   %eax
+    1bf1:	e8 1b 1c 00 00       	call   3811 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1bf6:	83 c4 10             	add    $0x10,%esp
+    1bf9:	83 f8 02             	cmp    $0x2,%eax
+    1bfc:	0f 85 b4 03 00 00    	jne    1fb6 <subdir+0x4c2>
+    1c02:	80 3d a0 84 00 00 66 	cmpb   $0x66,0x84a0
+    1c09:	0f 85 a7 03 00 00    	jne    1fb6 <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    1c0f:	83 ec 0c             	sub    $0xc,%esp
+    1c12:	53                   	push   %ebx
+    1c13:	e8 09 1c 00 00       	call   3821 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1c18:	83 c4 08             	add    $0x8,%esp
+    1c1b:	68 d2 44 00 00       	push   $0x44d2
+    1c20:	68 6e 44 00 00       	push   $0x446e
+    1c25:	e8 2f 1c 00 00       	call   3859 <link>
+    1c2a:	83 c4 10             	add    $0x10,%esp
+    1c2d:	85 c0                	test   %eax,%eax
+    1c2f:	0f 85 95 03 00 00    	jne    1fca <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    1c35:	83 ec 0c             	sub    $0xc,%esp
+    1c38:	68 6e 44 00 00       	push   $0x446e
+    1c3d:	e8 07 1c 00 00       	call   3849 <unlink>
+    1c42:	83 c4 10             	add    $0x10,%esp
+    1c45:	85 c0                	test   %eax,%eax
+    1c47:	0f 85 91 03 00 00    	jne    1fde <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1c4d:	83 ec 08             	sub    $0x8,%esp
+    1c50:	6a 00                	push   $0x0
+    1c52:	68 6e 44 00 00       	push   $0x446e
+    1c57:	e8 dd 1b 00 00       	call   3839 <open>
+    1c5c:	83 c4 10             	add    $0x10,%esp
+    1c5f:	85 c0                	test   %eax,%eax
+    1c61:	0f 89 8b 03 00 00    	jns    1ff2 <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    1c67:	83 ec 0c             	sub    $0xc,%esp
+    1c6a:	68 38 45 00 00       	push   $0x4538
+    1c6f:	e8 f5 1b 00 00       	call   3869 <chdir>
+    1c74:	83 c4 10             	add    $0x10,%esp
+    1c77:	85 c0                	test   %eax,%eax
+    1c79:	0f 85 87 03 00 00    	jne    2006 <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    1c7f:	83 ec 0c             	sub    $0xc,%esp
+    1c82:	68 06 45 00 00       	push   $0x4506
+    1c87:	e8 dd 1b 00 00       	call   3869 <chdir>
+    1c8c:	83 c4 10             	add    $0x10,%esp
+    1c8f:	85 c0                	test   %eax,%eax
+    1c91:	0f 85 83 03 00 00    	jne    201a <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    1c97:	83 ec 0c             	sub    $0xc,%esp
+    1c9a:	68 2c 45 00 00       	push   $0x452c
+    1c9f:	e8 c5 1b 00 00       	call   3869 <chdir>
+    1ca4:	83 c4 10             	add    $0x10,%esp
+    1ca7:	85 c0                	test   %eax,%eax
+    1ca9:	0f 85 7f 03 00 00    	jne    202e <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    1caf:	83 ec 0c             	sub    $0xc,%esp
+    1cb2:	68 3b 45 00 00       	push   $0x453b
+    1cb7:	e8 ad 1b 00 00       	call   3869 <chdir>
+    1cbc:	83 c4 10             	add    $0x10,%esp
+    1cbf:	85 c0                	test   %eax,%eax
+    1cc1:	0f 85 7b 03 00 00    	jne    2042 <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    1cc7:	83 ec 08             	sub    $0x8,%esp
+    1cca:	6a 00                	push   $0x0
+    1ccc:	68 d2 44 00 00       	push   $0x44d2
+    1cd1:	e8 63 1b 00 00       	call   3839 <open>
+    1cd6:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1cd8:	83 c4 10             	add    $0x10,%esp
+    1cdb:	85 c0                	test   %eax,%eax
+    1cdd:	0f 88 73 03 00 00    	js     2056 <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1ce3:	83 ec 04             	sub    $0x4,%esp
+    1ce6:	68 00 20 00 00       	push   $0x2000
+    1ceb:	68 a0 84 00 00       	push   $0x84a0
+    1cf0:	50                   	push   %eax
+    1cf1:	e8 1b 1b 00 00       	call   3811 <read>
+    1cf6:	83 c4 10             	add    $0x10,%esp
+    1cf9:	83 f8 02             	cmp    $0x2,%eax
+    1cfc:	0f 85 68 03 00 00    	jne    206a <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    1d02:	83 ec 0c             	sub    $0xc,%esp
+    1d05:	53                   	push   %ebx
+    1d06:	e8 16 1b 00 00       	call   3821 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1d0b:	83 c4 08             	add    $0x8,%esp
+    1d0e:	6a 00                	push   $0x0
+    1d10:	68 6e 44 00 00       	push   $0x446e
+    1d15:	e8 1f 1b 00 00       	call   3839 <open>
+    1d1a:	83 c4 10             	add    $0x10,%esp
+    1d1d:	85 c0                	test   %eax,%eax
+    1d1f:	0f 89 59 03 00 00    	jns    207e <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1d25:	83 ec 08             	sub    $0x8,%esp
+    1d28:	68 02 02 00 00       	push   $0x202
+    1d2d:	68 86 45 00 00       	push   $0x4586
+    1d32:	e8 02 1b 00 00       	call   3839 <open>
+    1d37:	83 c4 10             	add    $0x10,%esp
+    1d3a:	85 c0                	test   %eax,%eax
+    1d3c:	0f 89 50 03 00 00    	jns    2092 <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1d42:	83 ec 08             	sub    $0x8,%esp
+    1d45:	68 02 02 00 00       	push   $0x202
+    1d4a:	68 ab 45 00 00       	push   $0x45ab
+    1d4f:	e8 e5 1a 00 00       	call   3839 <open>
+    1d54:	83 c4 10             	add    $0x10,%esp
+    1d57:	85 c0                	test   %eax,%eax
+    1d59:	0f 89 47 03 00 00    	jns    20a6 <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    1d5f:	83 ec 08             	sub    $0x8,%esp
+    1d62:	68 00 02 00 00       	push   $0x200
+    1d67:	68 38 45 00 00       	push   $0x4538
+    1d6c:	e8 c8 1a 00 00       	call   3839 <open>
+    1d71:	83 c4 10             	add    $0x10,%esp
+    1d74:	85 c0                	test   %eax,%eax
+    1d76:	0f 89 3e 03 00 00    	jns    20ba <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    1d7c:	83 ec 08             	sub    $0x8,%esp
+    1d7f:	6a 02                	push   $0x2
+    1d81:	68 38 45 00 00       	push   $0x4538
+    1d86:	e8 ae 1a 00 00       	call   3839 <open>
+    1d8b:	83 c4 10             	add    $0x10,%esp
+    1d8e:	85 c0                	test   %eax,%eax
+    1d90:	0f 89 38 03 00 00    	jns    20ce <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    1d96:	83 ec 08             	sub    $0x8,%esp
+    1d99:	6a 01                	push   $0x1
+    1d9b:	68 38 45 00 00       	push   $0x4538
+    1da0:	e8 94 1a 00 00       	call   3839 <open>
+    1da5:	83 c4 10             	add    $0x10,%esp
+    1da8:	85 c0                	test   %eax,%eax
+    1daa:	0f 89 32 03 00 00    	jns    20e2 <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1db0:	83 ec 08             	sub    $0x8,%esp
+    1db3:	68 1a 46 00 00       	push   $0x461a
+    1db8:	68 86 45 00 00       	push   $0x4586
+    1dbd:	e8 97 1a 00 00       	call   3859 <link>
+    1dc2:	83 c4 10             	add    $0x10,%esp
+    1dc5:	85 c0                	test   %eax,%eax
+    1dc7:	0f 84 29 03 00 00    	je     20f6 <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1dcd:	83 ec 08             	sub    $0x8,%esp
+    1dd0:	68 1a 46 00 00       	push   $0x461a
+    1dd5:	68 ab 45 00 00       	push   $0x45ab
+    1dda:	e8 7a 1a 00 00       	call   3859 <link>
+    1ddf:	83 c4 10             	add    $0x10,%esp
+    1de2:	85 c0                	test   %eax,%eax
+    1de4:	0f 84 20 03 00 00    	je     210a <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1dea:	83 ec 08             	sub    $0x8,%esp
+    1ded:	68 d2 44 00 00       	push   $0x44d2
+    1df2:	68 71 44 00 00       	push   $0x4471
+    1df7:	e8 5d 1a 00 00       	call   3859 <link>
+    1dfc:	83 c4 10             	add    $0x10,%esp
+    1dff:	85 c0                	test   %eax,%eax
+    1e01:	0f 84 17 03 00 00    	je     211e <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    1e07:	83 ec 0c             	sub    $0xc,%esp
+    1e0a:	68 86 45 00 00       	push   $0x4586
+    1e0f:	e8 4d 1a 00 00       	call   3861 <mkdir>
+    1e14:	83 c4 10             	add    $0x10,%esp
+    1e17:	85 c0                	test   %eax,%eax
+    1e19:	0f 84 13 03 00 00    	je     2132 <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    1e1f:	83 ec 0c             	sub    $0xc,%esp
+    1e22:	68 ab 45 00 00       	push   $0x45ab
+    1e27:	e8 35 1a 00 00       	call   3861 <mkdir>
+    1e2c:	83 c4 10             	add    $0x10,%esp
+    1e2f:	85 c0                	test   %eax,%eax
+    1e31:	0f 84 0f 03 00 00    	je     2146 <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    1e37:	83 ec 0c             	sub    $0xc,%esp
+    1e3a:	68 d2 44 00 00       	push   $0x44d2
+    1e3f:	e8 1d 1a 00 00       	call   3861 <mkdir>
+    1e44:	83 c4 10             	add    $0x10,%esp
+    1e47:	85 c0                	test   %eax,%eax
+    1e49:	0f 84 0b 03 00 00    	je     215a <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    1e4f:	83 ec 0c             	sub    $0xc,%esp
+    1e52:	68 ab 45 00 00       	push   $0x45ab
+    1e57:	e8 ed 19 00 00       	call   3849 <unlink>
+    1e5c:	83 c4 10             	add    $0x10,%esp
+    1e5f:	85 c0                	test   %eax,%eax
+    1e61:	0f 84 07 03 00 00    	je     216e <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    1e67:	83 ec 0c             	sub    $0xc,%esp
+    1e6a:	68 86 45 00 00       	push   $0x4586
+    1e6f:	e8 d5 19 00 00       	call   3849 <unlink>
+    1e74:	83 c4 10             	add    $0x10,%esp
+    1e77:	85 c0                	test   %eax,%eax
+    1e79:	0f 84 03 03 00 00    	je     2182 <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    1e7f:	83 ec 0c             	sub    $0xc,%esp
+    1e82:	68 71 44 00 00       	push   $0x4471
+    1e87:	e8 dd 19 00 00       	call   3869 <chdir>
+    1e8c:	83 c4 10             	add    $0x10,%esp
+    1e8f:	85 c0                	test   %eax,%eax
+    1e91:	0f 84 ff 02 00 00    	je     2196 <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    1e97:	83 ec 0c             	sub    $0xc,%esp
+    1e9a:	68 1d 46 00 00       	push   $0x461d
+    1e9f:	e8 c5 19 00 00       	call   3869 <chdir>
+    1ea4:	83 c4 10             	add    $0x10,%esp
+    1ea7:	85 c0                	test   %eax,%eax
+    1ea9:	0f 84 fb 02 00 00    	je     21aa <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    1eaf:	83 ec 0c             	sub    $0xc,%esp
+    1eb2:	68 d2 44 00 00       	push   $0x44d2
+    1eb7:	e8 8d 19 00 00       	call   3849 <unlink>
+    1ebc:	83 c4 10             	add    $0x10,%esp
+    1ebf:	85 c0                	test   %eax,%eax
+    1ec1:	0f 85 f7 02 00 00    	jne    21be <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    1ec7:	83 ec 0c             	sub    $0xc,%esp
+    1eca:	68 71 44 00 00       	push   $0x4471
+    1ecf:	e8 75 19 00 00       	call   3849 <unlink>
+    1ed4:	83 c4 10             	add    $0x10,%esp
+    1ed7:	85 c0                	test   %eax,%eax
+    1ed9:	0f 85 f3 02 00 00    	jne    21d2 <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    1edf:	83 ec 0c             	sub    $0xc,%esp
+    1ee2:	68 38 45 00 00       	push   $0x4538
+    1ee7:	e8 5d 19 00 00       	call   3849 <unlink>
+    1eec:	83 c4 10             	add    $0x10,%esp
+    1eef:	85 c0                	test   %eax,%eax
+    1ef1:	0f 84 ef 02 00 00    	je     21e6 <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    1ef7:	83 ec 0c             	sub    $0xc,%esp
+    1efa:	68 4d 44 00 00       	push   $0x444d
+    1eff:	e8 45 19 00 00       	call   3849 <unlink>
+    1f04:	83 c4 10             	add    $0x10,%esp
+    1f07:	85 c0                	test   %eax,%eax
+    1f09:	0f 88 eb 02 00 00    	js     21fa <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    1f0f:	83 ec 0c             	sub    $0xc,%esp
+    1f12:	68 38 45 00 00       	push   $0x4538
+    1f17:	e8 2d 19 00 00       	call   3849 <unlink>
+    1f1c:	83 c4 10             	add    $0x10,%esp
+    1f1f:	85 c0                	test   %eax,%eax
+    1f21:	0f 88 e7 02 00 00    	js     220e <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    1f27:	83 ec 08             	sub    $0x8,%esp
+    1f2a:	68 1a 47 00 00       	push   $0x471a
+    1f2f:	6a 01                	push   $0x1
+    1f31:	e8 9b 1a 00 00       	call   39d1 <printf>
+}
+    1f36:	83 c4 10             	add    $0x10,%esp
+    1f39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f3c:	c9                   	leave
+    1f3d:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    1f3e:	83 ec 08             	sub    $0x8,%esp
+    1f41:	68 1f 44 00 00       	push   $0x441f
+    1f46:	6a 01                	push   $0x1
+    1f48:	e8 84 1a 00 00       	call   39d1 <printf>
+    exit();
+    1f4d:	e8 a7 18 00 00       	call   37f9 <exit>
+    printf(1, "create dd/ff failed\n");
+    1f52:	83 ec 08             	sub    $0x8,%esp
+    1f55:	68 37 44 00 00       	push   $0x4437
+    1f5a:	6a 01                	push   $0x1
+    1f5c:	e8 70 1a 00 00       	call   39d1 <printf>
+    exit();
+    1f61:	e8 93 18 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    1f66:	83 ec 08             	sub    $0x8,%esp
+    1f69:	68 04 4f 00 00       	push   $0x4f04
+    1f6e:	6a 01                	push   $0x1
+    1f70:	e8 5c 1a 00 00       	call   39d1 <printf>
+    exit();
+    1f75:	e8 7f 18 00 00       	call   37f9 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    1f7a:	83 ec 08             	sub    $0x8,%esp
+    1f7d:	68 53 44 00 00       	push   $0x4453
+    1f82:	6a 01                	push   $0x1
+    1f84:	e8 48 1a 00 00       	call   39d1 <printf>
+    exit();
+    1f89:	e8 6b 18 00 00       	call   37f9 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    1f8e:	83 ec 08             	sub    $0x8,%esp
+    1f91:	68 77 44 00 00       	push   $0x4477
+    1f96:	6a 01                	push   $0x1
+    1f98:	e8 34 1a 00 00       	call   39d1 <printf>
+    exit();
+    1f9d:	e8 57 18 00 00       	call   37f9 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    1fa2:	83 ec 08             	sub    $0x8,%esp
+    1fa5:	68 9e 44 00 00       	push   $0x449e
+    1faa:	6a 01                	push   $0x1
+    1fac:	e8 20 1a 00 00       	call   39d1 <printf>
+    exit();
+    1fb1:	e8 43 18 00 00       	call   37f9 <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    1fb6:	83 ec 08             	sub    $0x8,%esp
+    1fb9:	68 b7 44 00 00       	push   $0x44b7
+    1fbe:	6a 01                	push   $0x1
+    1fc0:	e8 0c 1a 00 00       	call   39d1 <printf>
+    exit();
+    1fc5:	e8 2f 18 00 00       	call   37f9 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    1fca:	83 ec 08             	sub    $0x8,%esp
+    1fcd:	68 2c 4f 00 00       	push   $0x4f2c
+    1fd2:	6a 01                	push   $0x1
+    1fd4:	e8 f8 19 00 00       	call   39d1 <printf>
+    exit();
+    1fd9:	e8 1b 18 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    1fde:	83 ec 08             	sub    $0x8,%esp
+    1fe1:	68 dd 44 00 00       	push   $0x44dd
+    1fe6:	6a 01                	push   $0x1
+    1fe8:	e8 e4 19 00 00       	call   39d1 <printf>
+    exit();
+    1fed:	e8 07 18 00 00       	call   37f9 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    1ff2:	83 ec 08             	sub    $0x8,%esp
+    1ff5:	68 50 4f 00 00       	push   $0x4f50
+    1ffa:	6a 01                	push   $0x1
+    1ffc:	e8 d0 19 00 00       	call   39d1 <printf>
+    exit();
+    2001:	e8 f3 17 00 00       	call   37f9 <exit>
+    printf(1, "chdir dd failed\n");
+    2006:	83 ec 08             	sub    $0x8,%esp
+    2009:	68 f5 44 00 00       	push   $0x44f5
+    200e:	6a 01                	push   $0x1
+    2010:	e8 bc 19 00 00       	call   39d1 <printf>
+    exit();
+    2015:	e8 df 17 00 00       	call   37f9 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    201a:	83 ec 08             	sub    $0x8,%esp
+    201d:	68 12 45 00 00       	push   $0x4512
+    2022:	6a 01                	push   $0x1
+    2024:	e8 a8 19 00 00       	call   39d1 <printf>
+    exit();
+    2029:	e8 cb 17 00 00       	call   37f9 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    202e:	83 ec 08             	sub    $0x8,%esp
+    2031:	68 12 45 00 00       	push   $0x4512
+    2036:	6a 01                	push   $0x1
+    2038:	e8 94 19 00 00       	call   39d1 <printf>
+    exit();
+    203d:	e8 b7 17 00 00       	call   37f9 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2042:	83 ec 08             	sub    $0x8,%esp
+    2045:	68 40 45 00 00       	push   $0x4540
+    204a:	6a 01                	push   $0x1
+    204c:	e8 80 19 00 00       	call   39d1 <printf>
+    exit();
+    2051:	e8 a3 17 00 00       	call   37f9 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    2056:	83 ec 08             	sub    $0x8,%esp
+    2059:	68 53 45 00 00       	push   $0x4553
+    205e:	6a 01                	push   $0x1
+    2060:	e8 6c 19 00 00       	call   39d1 <printf>
+    exit();
+    2065:	e8 8f 17 00 00       	call   37f9 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    206a:	83 ec 08             	sub    $0x8,%esp
+    206d:	68 6b 45 00 00       	push   $0x456b
+    2072:	6a 01                	push   $0x1
+    2074:	e8 58 19 00 00       	call   39d1 <printf>
+    exit();
+    2079:	e8 7b 17 00 00       	call   37f9 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    207e:	83 ec 08             	sub    $0x8,%esp
+    2081:	68 74 4f 00 00       	push   $0x4f74
+    2086:	6a 01                	push   $0x1
+    2088:	e8 44 19 00 00       	call   39d1 <printf>
+    exit();
+    208d:	e8 67 17 00 00       	call   37f9 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2092:	83 ec 08             	sub    $0x8,%esp
+    2095:	68 8f 45 00 00       	push   $0x458f
+    209a:	6a 01                	push   $0x1
+    209c:	e8 30 19 00 00       	call   39d1 <printf>
+    exit();
+    20a1:	e8 53 17 00 00       	call   37f9 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    20a6:	83 ec 08             	sub    $0x8,%esp
+    20a9:	68 b4 45 00 00       	push   $0x45b4
+    20ae:	6a 01                	push   $0x1
+    20b0:	e8 1c 19 00 00       	call   39d1 <printf>
+    exit();
+    20b5:	e8 3f 17 00 00       	call   37f9 <exit>
+    printf(1, "create dd succeeded!\n");
+    20ba:	83 ec 08             	sub    $0x8,%esp
+    20bd:	68 d0 45 00 00       	push   $0x45d0
+    20c2:	6a 01                	push   $0x1
+    20c4:	e8 08 19 00 00       	call   39d1 <printf>
+    exit();
+    20c9:	e8 2b 17 00 00       	call   37f9 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    20ce:	83 ec 08             	sub    $0x8,%esp
+    20d1:	68 e6 45 00 00       	push   $0x45e6
+    20d6:	6a 01                	push   $0x1
+    20d8:	e8 f4 18 00 00       	call   39d1 <printf>
+    exit();
+    20dd:	e8 17 17 00 00       	call   37f9 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    20e2:	83 ec 08             	sub    $0x8,%esp
+    20e5:	68 ff 45 00 00       	push   $0x45ff
+    20ea:	6a 01                	push   $0x1
+    20ec:	e8 e0 18 00 00       	call   39d1 <printf>
+    exit();
+    20f1:	e8 03 17 00 00       	call   37f9 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    20f6:	83 ec 08             	sub    $0x8,%esp
+    20f9:	68 9c 4f 00 00       	push   $0x4f9c
+    20fe:	6a 01                	push   $0x1
+    2100:	e8 cc 18 00 00       	call   39d1 <printf>
+    exit();
+    2105:	e8 ef 16 00 00       	call   37f9 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    210a:	83 ec 08             	sub    $0x8,%esp
+    210d:	68 c0 4f 00 00       	push   $0x4fc0
+    2112:	6a 01                	push   $0x1
+    2114:	e8 b8 18 00 00       	call   39d1 <printf>
+    exit();
+    2119:	e8 db 16 00 00       	call   37f9 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    211e:	83 ec 08             	sub    $0x8,%esp
+    2121:	68 e4 4f 00 00       	push   $0x4fe4
+    2126:	6a 01                	push   $0x1
+    2128:	e8 a4 18 00 00       	call   39d1 <printf>
+    exit();
+    212d:	e8 c7 16 00 00       	call   37f9 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2132:	83 ec 08             	sub    $0x8,%esp
+    2135:	68 23 46 00 00       	push   $0x4623
+    213a:	6a 01                	push   $0x1
+    213c:	e8 90 18 00 00       	call   39d1 <printf>
+    exit();
+    2141:	e8 b3 16 00 00       	call   37f9 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2146:	83 ec 08             	sub    $0x8,%esp
+    2149:	68 3e 46 00 00       	push   $0x463e
+    214e:	6a 01                	push   $0x1
+    2150:	e8 7c 18 00 00       	call   39d1 <printf>
+    exit();
+    2155:	e8 9f 16 00 00       	call   37f9 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    215a:	83 ec 08             	sub    $0x8,%esp
+    215d:	68 59 46 00 00       	push   $0x4659
+    2162:	6a 01                	push   $0x1
+    2164:	e8 68 18 00 00       	call   39d1 <printf>
+    exit();
+    2169:	e8 8b 16 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    216e:	83 ec 08             	sub    $0x8,%esp
+    2171:	68 76 46 00 00       	push   $0x4676
+    2176:	6a 01                	push   $0x1
+    2178:	e8 54 18 00 00       	call   39d1 <printf>
+    exit();
+    217d:	e8 77 16 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2182:	83 ec 08             	sub    $0x8,%esp
+    2185:	68 92 46 00 00       	push   $0x4692
+    218a:	6a 01                	push   $0x1
+    218c:	e8 40 18 00 00       	call   39d1 <printf>
+    exit();
+    2191:	e8 63 16 00 00       	call   37f9 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2196:	83 ec 08             	sub    $0x8,%esp
+    2199:	68 ae 46 00 00       	push   $0x46ae
+    219e:	6a 01                	push   $0x1
+    21a0:	e8 2c 18 00 00       	call   39d1 <printf>
+    exit();
+    21a5:	e8 4f 16 00 00       	call   37f9 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    21aa:	83 ec 08             	sub    $0x8,%esp
+    21ad:	68 c6 46 00 00       	push   $0x46c6
+    21b2:	6a 01                	push   $0x1
+    21b4:	e8 18 18 00 00       	call   39d1 <printf>
+    exit();
+    21b9:	e8 3b 16 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21be:	83 ec 08             	sub    $0x8,%esp
+    21c1:	68 dd 44 00 00       	push   $0x44dd
+    21c6:	6a 01                	push   $0x1
+    21c8:	e8 04 18 00 00       	call   39d1 <printf>
+    exit();
+    21cd:	e8 27 16 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    21d2:	83 ec 08             	sub    $0x8,%esp
+    21d5:	68 de 46 00 00       	push   $0x46de
+    21da:	6a 01                	push   $0x1
+    21dc:	e8 f0 17 00 00       	call   39d1 <printf>
+    exit();
+    21e1:	e8 13 16 00 00       	call   37f9 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    21e6:	83 ec 08             	sub    $0x8,%esp
+    21e9:	68 08 50 00 00       	push   $0x5008
+    21ee:	6a 01                	push   $0x1
+    21f0:	e8 dc 17 00 00       	call   39d1 <printf>
+    exit();
+    21f5:	e8 ff 15 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    21fa:	83 ec 08             	sub    $0x8,%esp
+    21fd:	68 f3 46 00 00       	push   $0x46f3
+    2202:	6a 01                	push   $0x1
+    2204:	e8 c8 17 00 00       	call   39d1 <printf>
+    exit();
+    2209:	e8 eb 15 00 00       	call   37f9 <exit>
+    printf(1, "unlink dd failed\n");
+    220e:	83 ec 08             	sub    $0x8,%esp
+    2211:	68 08 47 00 00       	push   $0x4708
+    2216:	6a 01                	push   $0x1
+    2218:	e8 b4 17 00 00       	call   39d1 <printf>
+    exit();
+    221d:	e8 d7 15 00 00       	call   37f9 <exit>
+
+00002222 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2222:	55                   	push   %ebp
+    2223:	89 e5                	mov    %esp,%ebp
+    2225:	57                   	push   %edi
+    2226:	56                   	push   %esi
+    2227:	53                   	push   %ebx
+    2228:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    222b:	68 25 47 00 00       	push   $0x4725
+    2230:	6a 01                	push   $0x1
+    2232:	e8 9a 17 00 00       	call   39d1 <printf>
+
+  unlink("bigwrite");
+    2237:	c7 04 24 34 47 00 00 	movl   $0x4734,(%esp)
+    223e:	e8 06 16 00 00       	call   3849 <unlink>
+    2243:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2246:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    224b:	83 ec 08             	sub    $0x8,%esp
+    224e:	68 02 02 00 00       	push   $0x202
+    2253:	68 34 47 00 00       	push   $0x4734
+    2258:	e8 dc 15 00 00       	call   3839 <open>
+    225d:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    225f:	83 c4 10             	add    $0x10,%esp
+    2262:	85 c0                	test   %eax,%eax
+    2264:	78 6e                	js     22d4 <bigwrite+0xb2>
+      printf(1, "cannot create bigwrite\n");
+      exit();
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+    2266:	83 ec 04             	sub    $0x4,%esp
+    2269:	53                   	push   %ebx
+    226a:	68 a0 84 00 00       	push   $0x84a0
+    226f:	50                   	push   %eax
+    2270:	e8 a4 15 00 00       	call   3819 <write>
+    2275:	89 c7                	mov    %eax,%edi
+      if(cc != sz){
+    2277:	83 c4 10             	add    $0x10,%esp
+    227a:	39 c3                	cmp    %eax,%ebx
+    227c:	75 6a                	jne    22e8 <bigwrite+0xc6>
+      int cc = write(fd, buf, sz);
+    227e:	83 ec 04             	sub    $0x4,%esp
+    2281:	53                   	push   %ebx
+    2282:	68 a0 84 00 00       	push   $0x84a0
+    2287:	56                   	push   %esi
+    2288:	e8 8c 15 00 00       	call   3819 <write>
+      if(cc != sz){
+    228d:	83 c4 10             	add    $0x10,%esp
+    2290:	39 d8                	cmp    %ebx,%eax
+    2292:	75 56                	jne    22ea <bigwrite+0xc8>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+        exit();
+      }
+    }
+    close(fd);
+    2294:	83 ec 0c             	sub    $0xc,%esp
+    2297:	56                   	push   %esi
+    2298:	e8 84 15 00 00       	call   3821 <close>
+    unlink("bigwrite");
+    229d:	c7 04 24 34 47 00 00 	movl   $0x4734,(%esp)
+    22a4:	e8 a0 15 00 00       	call   3849 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    22a9:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    22af:	83 c4 10             	add    $0x10,%esp
+    22b2:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    22b8:	75 91                	jne    224b <bigwrite+0x29>
+  }
+
+  printf(1, "bigwrite ok\n");
+    22ba:	83 ec 08             	sub    $0x8,%esp
+    22bd:	68 67 47 00 00       	push   $0x4767
+    22c2:	6a 01                	push   $0x1
+    22c4:	e8 08 17 00 00       	call   39d1 <printf>
+}
+    22c9:	83 c4 10             	add    $0x10,%esp
+    22cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22cf:	5b                   	pop    %ebx
+    22d0:	5e                   	pop    %esi
+    22d1:	5f                   	pop    %edi
+    22d2:	5d                   	pop    %ebp
+    22d3:	c3                   	ret
+      printf(1, "cannot create bigwrite\n");
+    22d4:	83 ec 08             	sub    $0x8,%esp
+    22d7:	68 3d 47 00 00       	push   $0x473d
+    22dc:	6a 01                	push   $0x1
+    22de:	e8 ee 16 00 00       	call   39d1 <printf>
+      exit();
+    22e3:	e8 11 15 00 00       	call   37f9 <exit>
+      if(cc != sz){
+    22e8:	89 df                	mov    %ebx,%edi
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    22ea:	50                   	push   %eax
+    22eb:	57                   	push   %edi
+    22ec:	68 55 47 00 00       	push   $0x4755
+    22f1:	6a 01                	push   $0x1
+    22f3:	e8 d9 16 00 00       	call   39d1 <printf>
+        exit();
+    22f8:	e8 fc 14 00 00       	call   37f9 <exit>
+
+000022fd <bigfile>:
+
+void
+bigfile(void)
+{
+    22fd:	55                   	push   %ebp
+    22fe:	89 e5                	mov    %esp,%ebp
+    2300:	57                   	push   %edi
+    2301:	56                   	push   %esi
+    2302:	53                   	push   %ebx
+    2303:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2306:	68 74 47 00 00       	push   $0x4774
+    230b:	6a 01                	push   $0x1
+    230d:	e8 bf 16 00 00       	call   39d1 <printf>
+
+  unlink("bigfile");
+    2312:	c7 04 24 90 47 00 00 	movl   $0x4790,(%esp)
+    2319:	e8 2b 15 00 00       	call   3849 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    231e:	83 c4 08             	add    $0x8,%esp
+    2321:	68 02 02 00 00       	push   $0x202
+    2326:	68 90 47 00 00       	push   $0x4790
+    232b:	e8 09 15 00 00       	call   3839 <open>
+  if(fd < 0){
+    2330:	83 c4 10             	add    $0x10,%esp
+    2333:	85 c0                	test   %eax,%eax
+    2335:	0f 88 c3 00 00 00    	js     23fe <bigfile+0x101>
+    233b:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    233d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    memset(buf, i, 600);
+    2342:	83 ec 04             	sub    $0x4,%esp
+    2345:	68 58 02 00 00       	push   $0x258
+    234a:	53                   	push   %ebx
+    234b:	68 a0 84 00 00       	push   $0x84a0
+    2350:	e8 b6 12 00 00       	call   360b <memset>
+    if(write(fd, buf, 600) != 600){
+    2355:	83 c4 0c             	add    $0xc,%esp
+    2358:	68 58 02 00 00       	push   $0x258
+    235d:	68 a0 84 00 00       	push   $0x84a0
+    2362:	56                   	push   %esi
+    2363:	e8 b1 14 00 00       	call   3819 <write>
+    2368:	83 c4 10             	add    $0x10,%esp
+    236b:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2370:	0f 85 9c 00 00 00    	jne    2412 <bigfile+0x115>
+  for(i = 0; i < 20; i++){
+    2376:	83 c3 01             	add    $0x1,%ebx
+    2379:	83 fb 14             	cmp    $0x14,%ebx
+    237c:	75 c4                	jne    2342 <bigfile+0x45>
+      printf(1, "write bigfile failed\n");
+      exit();
+    }
+  }
+  close(fd);
+    237e:	83 ec 0c             	sub    $0xc,%esp
+    2381:	56                   	push   %esi
+    2382:	e8 9a 14 00 00       	call   3821 <close>
+
+  fd = open("bigfile", 0);
+    2387:	83 c4 08             	add    $0x8,%esp
+    238a:	6a 00                	push   $0x0
+    238c:	68 90 47 00 00       	push   $0x4790
+    2391:	e8 a3 14 00 00       	call   3839 <open>
+    2396:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    2398:	83 c4 10             	add    $0x10,%esp
+    239b:	85 c0                	test   %eax,%eax
+    239d:	0f 88 83 00 00 00    	js     2426 <bigfile+0x129>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    23a3:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    23a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    23ad:	83 ec 04             	sub    $0x4,%esp
+    23b0:	68 2c 01 00 00       	push   $0x12c
+    23b5:	68 a0 84 00 00       	push   $0x84a0
+    23ba:	57                   	push   %edi
+    23bb:	e8 51 14 00 00       	call   3811 <read>
+    if(cc < 0){
+    23c0:	83 c4 10             	add    $0x10,%esp
+    23c3:	85 c0                	test   %eax,%eax
+    23c5:	78 73                	js     243a <bigfile+0x13d>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    23c7:	0f 84 a9 00 00 00    	je     2476 <bigfile+0x179>
+      break;
+    if(cc != 300){
+    23cd:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    23d2:	75 7a                	jne    244e <bigfile+0x151>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    23d4:	89 d8                	mov    %ebx,%eax
+    23d6:	c1 e8 1f             	shr    $0x1f,%eax
+    23d9:	01 d8                	add    %ebx,%eax
+    23db:	d1 f8                	sar    %eax
+    23dd:	0f be 15 a0 84 00 00 	movsbl 0x84a0,%edx
+    23e4:	39 c2                	cmp    %eax,%edx
+    23e6:	75 7a                	jne    2462 <bigfile+0x165>
+    23e8:	0f be 15 cb 85 00 00 	movsbl 0x85cb,%edx
+    23ef:	39 d0                	cmp    %edx,%eax
+    23f1:	75 6f                	jne    2462 <bigfile+0x165>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    23f3:	81 c6 2c 01 00 00    	add    $0x12c,%esi
+  for(i = 0; ; i++){
+    23f9:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    23fc:	eb af                	jmp    23ad <bigfile+0xb0>
+    printf(1, "cannot create bigfile");
+    23fe:	83 ec 08             	sub    $0x8,%esp
+    2401:	68 82 47 00 00       	push   $0x4782
+    2406:	6a 01                	push   $0x1
+    2408:	e8 c4 15 00 00       	call   39d1 <printf>
+    exit();
+    240d:	e8 e7 13 00 00       	call   37f9 <exit>
+      printf(1, "write bigfile failed\n");
+    2412:	83 ec 08             	sub    $0x8,%esp
+    2415:	68 98 47 00 00       	push   $0x4798
+    241a:	6a 01                	push   $0x1
+    241c:	e8 b0 15 00 00       	call   39d1 <printf>
+      exit();
+    2421:	e8 d3 13 00 00       	call   37f9 <exit>
+    printf(1, "cannot open bigfile\n");
+    2426:	83 ec 08             	sub    $0x8,%esp
+    2429:	68 ae 47 00 00       	push   $0x47ae
+    242e:	6a 01                	push   $0x1
+    2430:	e8 9c 15 00 00       	call   39d1 <printf>
+    exit();
+    2435:	e8 bf 13 00 00       	call   37f9 <exit>
+      printf(1, "read bigfile failed\n");
+    243a:	83 ec 08             	sub    $0x8,%esp
+    243d:	68 c3 47 00 00       	push   $0x47c3
+    2442:	6a 01                	push   $0x1
+    2444:	e8 88 15 00 00       	call   39d1 <printf>
+      exit();
+    2449:	e8 ab 13 00 00       	call   37f9 <exit>
+      printf(1, "short read bigfile\n");
+    244e:	83 ec 08             	sub    $0x8,%esp
+    2451:	68 d8 47 00 00       	push   $0x47d8
+    2456:	6a 01                	push   $0x1
+    2458:	e8 74 15 00 00       	call   39d1 <printf>
+      exit();
+    245d:	e8 97 13 00 00       	call   37f9 <exit>
+      printf(1, "read bigfile wrong data\n");
+    2462:	83 ec 08             	sub    $0x8,%esp
+    2465:	68 ec 47 00 00       	push   $0x47ec
+    246a:	6a 01                	push   $0x1
+    246c:	e8 60 15 00 00       	call   39d1 <printf>
+      exit();
+    2471:	e8 83 13 00 00       	call   37f9 <exit>
+  }
+  close(fd);
+    2476:	83 ec 0c             	sub    $0xc,%esp
+    2479:	57                   	push   %edi
+    247a:	e8 a2 13 00 00       	call   3821 <close>
+  if(total != 20*600){
+    247f:	83 c4 10             	add    $0x10,%esp
+    2482:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2488:	75 27                	jne    24b1 <bigfile+0x1b4>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    248a:	83 ec 0c             	sub    $0xc,%esp
+    248d:	68 90 47 00 00       	push   $0x4790
+    2492:	e8 b2 13 00 00       	call   3849 <unlink>
+
+  printf(1, "bigfile test ok\n");
+    2497:	83 c4 08             	add    $0x8,%esp
+    249a:	68 1f 48 00 00       	push   $0x481f
+    249f:	6a 01                	push   $0x1
+    24a1:	e8 2b 15 00 00       	call   39d1 <printf>
+}
+    24a6:	83 c4 10             	add    $0x10,%esp
+    24a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    24ac:	5b                   	pop    %ebx
+    24ad:	5e                   	pop    %esi
+    24ae:	5f                   	pop    %edi
+    24af:	5d                   	pop    %ebp
+    24b0:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    24b1:	83 ec 08             	sub    $0x8,%esp
+    24b4:	68 05 48 00 00       	push   $0x4805
+    24b9:	6a 01                	push   $0x1
+    24bb:	e8 11 15 00 00       	call   39d1 <printf>
+    exit();
+    24c0:	e8 34 13 00 00       	call   37f9 <exit>
+
+000024c5 <fourteen>:
+
+void
+fourteen(void)
+{
+    24c5:	55                   	push   %ebp
+    24c6:	89 e5                	mov    %esp,%ebp
+    24c8:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    24cb:	68 30 48 00 00       	push   $0x4830
+    24d0:	6a 01                	push   $0x1
+    24d2:	e8 fa 14 00 00       	call   39d1 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    24d7:	c7 04 24 6b 48 00 00 	movl   $0x486b,(%esp)
+    24de:	e8 7e 13 00 00       	call   3861 <mkdir>
+    24e3:	83 c4 10             	add    $0x10,%esp
+    24e6:	85 c0                	test   %eax,%eax
+    24e8:	0f 85 9c 00 00 00    	jne    258a <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    24ee:	83 ec 0c             	sub    $0xc,%esp
+    24f1:	68 28 50 00 00       	push   $0x5028
+    24f6:	e8 66 13 00 00       	call   3861 <mkdir>
+    24fb:	83 c4 10             	add    $0x10,%esp
+    24fe:	85 c0                	test   %eax,%eax
+    2500:	0f 85 98 00 00 00    	jne    259e <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2506:	83 ec 08             	sub    $0x8,%esp
+    2509:	68 00 02 00 00       	push   $0x200
+    250e:	68 78 50 00 00       	push   $0x5078
+    2513:	e8 21 13 00 00       	call   3839 <open>
+  if(fd < 0){
+    2518:	83 c4 10             	add    $0x10,%esp
+    251b:	85 c0                	test   %eax,%eax
+    251d:	0f 88 8f 00 00 00    	js     25b2 <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    2523:	83 ec 0c             	sub    $0xc,%esp
+    2526:	50                   	push   %eax
+    2527:	e8 f5 12 00 00       	call   3821 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    252c:	83 c4 08             	add    $0x8,%esp
+    252f:	6a 00                	push   $0x0
+    2531:	68 e8 50 00 00       	push   $0x50e8
+    2536:	e8 fe 12 00 00       	call   3839 <open>
+  if(fd < 0){
+    253b:	83 c4 10             	add    $0x10,%esp
+    253e:	85 c0                	test   %eax,%eax
+    2540:	0f 88 80 00 00 00    	js     25c6 <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    2546:	83 ec 0c             	sub    $0xc,%esp
+    2549:	50                   	push   %eax
+    254a:	e8 d2 12 00 00       	call   3821 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    254f:	c7 04 24 5c 48 00 00 	movl   $0x485c,(%esp)
+    2556:	e8 06 13 00 00       	call   3861 <mkdir>
+    255b:	83 c4 10             	add    $0x10,%esp
+    255e:	85 c0                	test   %eax,%eax
+    2560:	74 78                	je     25da <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2562:	83 ec 0c             	sub    $0xc,%esp
+    2565:	68 84 51 00 00       	push   $0x5184
+    256a:	e8 f2 12 00 00       	call   3861 <mkdir>
+    256f:	83 c4 10             	add    $0x10,%esp
+    2572:	85 c0                	test   %eax,%eax
+    2574:	74 78                	je     25ee <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    2576:	83 ec 08             	sub    $0x8,%esp
+    2579:	68 7a 48 00 00       	push   $0x487a
+    257e:	6a 01                	push   $0x1
+    2580:	e8 4c 14 00 00       	call   39d1 <printf>
+}
+    2585:	83 c4 10             	add    $0x10,%esp
+    2588:	c9                   	leave
+    2589:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    258a:	83 ec 08             	sub    $0x8,%esp
+    258d:	68 3f 48 00 00       	push   $0x483f
+    2592:	6a 01                	push   $0x1
+    2594:	e8 38 14 00 00       	call   39d1 <printf>
+    exit();
+    2599:	e8 5b 12 00 00       	call   37f9 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    259e:	83 ec 08             	sub    $0x8,%esp
+    25a1:	68 48 50 00 00       	push   $0x5048
+    25a6:	6a 01                	push   $0x1
+    25a8:	e8 24 14 00 00       	call   39d1 <printf>
+    exit();
+    25ad:	e8 47 12 00 00       	call   37f9 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    25b2:	83 ec 08             	sub    $0x8,%esp
+    25b5:	68 a8 50 00 00       	push   $0x50a8
+    25ba:	6a 01                	push   $0x1
+    25bc:	e8 10 14 00 00       	call   39d1 <printf>
+    exit();
+    25c1:	e8 33 12 00 00       	call   37f9 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    25c6:	83 ec 08             	sub    $0x8,%esp
+    25c9:	68 18 51 00 00       	push   $0x5118
+    25ce:	6a 01                	push   $0x1
+    25d0:	e8 fc 13 00 00       	call   39d1 <printf>
+    exit();
+    25d5:	e8 1f 12 00 00       	call   37f9 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    25da:	83 ec 08             	sub    $0x8,%esp
+    25dd:	68 54 51 00 00       	push   $0x5154
+    25e2:	6a 01                	push   $0x1
+    25e4:	e8 e8 13 00 00       	call   39d1 <printf>
+    exit();
+    25e9:	e8 0b 12 00 00       	call   37f9 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    25ee:	83 ec 08             	sub    $0x8,%esp
+    25f1:	68 a4 51 00 00       	push   $0x51a4
+    25f6:	6a 01                	push   $0x1
+    25f8:	e8 d4 13 00 00       	call   39d1 <printf>
+    exit();
+    25fd:	e8 f7 11 00 00       	call   37f9 <exit>
+
+00002602 <rmdot>:
+
+void
+rmdot(void)
+{
+    2602:	55                   	push   %ebp
+    2603:	89 e5                	mov    %esp,%ebp
+    2605:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2608:	68 87 48 00 00       	push   $0x4887
+    260d:	6a 01                	push   $0x1
+    260f:	e8 bd 13 00 00       	call   39d1 <printf>
+  if(mkdir("dots") != 0){
+    2614:	c7 04 24 93 48 00 00 	movl   $0x4893,(%esp)
+    261b:	e8 41 12 00 00       	call   3861 <mkdir>
+    2620:	83 c4 10             	add    $0x10,%esp
+    2623:	85 c0                	test   %eax,%eax
+    2625:	0f 85 bc 00 00 00    	jne    26e7 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    262b:	83 ec 0c             	sub    $0xc,%esp
+    262e:	68 93 48 00 00       	push   $0x4893
+    2633:	e8 31 12 00 00       	call   3869 <chdir>
+    2638:	83 c4 10             	add    $0x10,%esp
+    263b:	85 c0                	test   %eax,%eax
+    263d:	0f 85 b8 00 00 00    	jne    26fb <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    2643:	83 ec 0c             	sub    $0xc,%esp
+    2646:	68 3e 45 00 00       	push   $0x453e
+    264b:	e8 f9 11 00 00       	call   3849 <unlink>
+    2650:	83 c4 10             	add    $0x10,%esp
+    2653:	85 c0                	test   %eax,%eax
+    2655:	0f 84 b4 00 00 00    	je     270f <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    265b:	83 ec 0c             	sub    $0xc,%esp
+    265e:	68 3d 45 00 00       	push   $0x453d
+    2663:	e8 e1 11 00 00       	call   3849 <unlink>
+    2668:	83 c4 10             	add    $0x10,%esp
+    266b:	85 c0                	test   %eax,%eax
+    266d:	0f 84 b0 00 00 00    	je     2723 <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    2673:	83 ec 0c             	sub    $0xc,%esp
+    2676:	68 11 3d 00 00       	push   $0x3d11
+    267b:	e8 e9 11 00 00       	call   3869 <chdir>
+    2680:	83 c4 10             	add    $0x10,%esp
+    2683:	85 c0                	test   %eax,%eax
+    2685:	0f 85 ac 00 00 00    	jne    2737 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    268b:	83 ec 0c             	sub    $0xc,%esp
+    268e:	68 db 48 00 00       	push   $0x48db
+    2693:	e8 b1 11 00 00       	call   3849 <unlink>
+    2698:	83 c4 10             	add    $0x10,%esp
+    269b:	85 c0                	test   %eax,%eax
+    269d:	0f 84 a8 00 00 00    	je     274b <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    26a3:	83 ec 0c             	sub    $0xc,%esp
+    26a6:	68 f9 48 00 00       	push   $0x48f9
+    26ab:	e8 99 11 00 00       	call   3849 <unlink>
+    26b0:	83 c4 10             	add    $0x10,%esp
+    26b3:	85 c0                	test   %eax,%eax
+    26b5:	0f 84 a4 00 00 00    	je     275f <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    26bb:	83 ec 0c             	sub    $0xc,%esp
+    26be:	68 93 48 00 00       	push   $0x4893
+    26c3:	e8 81 11 00 00       	call   3849 <unlink>
+    26c8:	83 c4 10             	add    $0x10,%esp
+    26cb:	85 c0                	test   %eax,%eax
+    26cd:	0f 85 a0 00 00 00    	jne    2773 <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    26d3:	83 ec 08             	sub    $0x8,%esp
+    26d6:	68 2e 49 00 00       	push   $0x492e
+    26db:	6a 01                	push   $0x1
+    26dd:	e8 ef 12 00 00       	call   39d1 <printf>
+}
+    26e2:	83 c4 10             	add    $0x10,%esp
+    26e5:	c9                   	leave
+    26e6:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    26e7:	83 ec 08             	sub    $0x8,%esp
+    26ea:	68 98 48 00 00       	push   $0x4898
+    26ef:	6a 01                	push   $0x1
+    26f1:	e8 db 12 00 00       	call   39d1 <printf>
+    exit();
+    26f6:	e8 fe 10 00 00       	call   37f9 <exit>
+    printf(1, "chdir dots failed\n");
+    26fb:	83 ec 08             	sub    $0x8,%esp
+    26fe:	68 ab 48 00 00       	push   $0x48ab
+    2703:	6a 01                	push   $0x1
+    2705:	e8 c7 12 00 00       	call   39d1 <printf>
+    exit();
+    270a:	e8 ea 10 00 00       	call   37f9 <exit>
+    printf(1, "rm . worked!\n");
+    270f:	83 ec 08             	sub    $0x8,%esp
+    2712:	68 be 48 00 00       	push   $0x48be
+    2717:	6a 01                	push   $0x1
+    2719:	e8 b3 12 00 00       	call   39d1 <printf>
+    exit();
+    271e:	e8 d6 10 00 00       	call   37f9 <exit>
+    printf(1, "rm .. worked!\n");
+    2723:	83 ec 08             	sub    $0x8,%esp
+    2726:	68 cc 48 00 00       	push   $0x48cc
+    272b:	6a 01                	push   $0x1
+    272d:	e8 9f 12 00 00       	call   39d1 <printf>
+    exit();
+    2732:	e8 c2 10 00 00       	call   37f9 <exit>
+    printf(1, "chdir / failed\n");
+    2737:	83 ec 08             	sub    $0x8,%esp
+    273a:	68 13 3d 00 00       	push   $0x3d13
+    273f:	6a 01                	push   $0x1
+    2741:	e8 8b 12 00 00       	call   39d1 <printf>
+    exit();
+    2746:	e8 ae 10 00 00       	call   37f9 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    274b:	83 ec 08             	sub    $0x8,%esp
+    274e:	68 e2 48 00 00       	push   $0x48e2
+    2753:	6a 01                	push   $0x1
+    2755:	e8 77 12 00 00       	call   39d1 <printf>
+    exit();
+    275a:	e8 9a 10 00 00       	call   37f9 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    275f:	83 ec 08             	sub    $0x8,%esp
+    2762:	68 01 49 00 00       	push   $0x4901
+    2767:	6a 01                	push   $0x1
+    2769:	e8 63 12 00 00       	call   39d1 <printf>
+    exit();
+    276e:	e8 86 10 00 00       	call   37f9 <exit>
+    printf(1, "unlink dots failed!\n");
+    2773:	83 ec 08             	sub    $0x8,%esp
+    2776:	68 19 49 00 00       	push   $0x4919
+    277b:	6a 01                	push   $0x1
+    277d:	e8 4f 12 00 00       	call   39d1 <printf>
+    exit();
+    2782:	e8 72 10 00 00       	call   37f9 <exit>
+
+00002787 <dirfile>:
+
+void
+dirfile(void)
+{
+    2787:	55                   	push   %ebp
+    2788:	89 e5                	mov    %esp,%ebp
+    278a:	53                   	push   %ebx
+    278b:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    278e:	68 38 49 00 00       	push   $0x4938
+    2793:	6a 01                	push   $0x1
+    2795:	e8 37 12 00 00       	call   39d1 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    279a:	83 c4 08             	add    $0x8,%esp
+    279d:	68 00 02 00 00       	push   $0x200
+    27a2:	68 45 49 00 00       	push   $0x4945
+    27a7:	e8 8d 10 00 00       	call   3839 <open>
+  if(fd < 0){
+    27ac:	83 c4 10             	add    $0x10,%esp
+    27af:	85 c0                	test   %eax,%eax
+    27b1:	0f 88 22 01 00 00    	js     28d9 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    27b7:	83 ec 0c             	sub    $0xc,%esp
+    27ba:	50                   	push   %eax
+    27bb:	e8 61 10 00 00       	call   3821 <close>
+  if(chdir("dirfile") == 0){
+    27c0:	c7 04 24 45 49 00 00 	movl   $0x4945,(%esp)
+    27c7:	e8 9d 10 00 00       	call   3869 <chdir>
+    27cc:	83 c4 10             	add    $0x10,%esp
+    27cf:	85 c0                	test   %eax,%eax
+    27d1:	0f 84 16 01 00 00    	je     28ed <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    27d7:	83 ec 08             	sub    $0x8,%esp
+    27da:	6a 00                	push   $0x0
+    27dc:	68 7e 49 00 00       	push   $0x497e
+    27e1:	e8 53 10 00 00       	call   3839 <open>
+  if(fd >= 0){
+    27e6:	83 c4 10             	add    $0x10,%esp
+    27e9:	85 c0                	test   %eax,%eax
+    27eb:	0f 89 10 01 00 00    	jns    2901 <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    27f1:	83 ec 08             	sub    $0x8,%esp
+    27f4:	68 00 02 00 00       	push   $0x200
+    27f9:	68 7e 49 00 00       	push   $0x497e
+    27fe:	e8 36 10 00 00       	call   3839 <open>
+  if(fd >= 0){
+    2803:	83 c4 10             	add    $0x10,%esp
+    2806:	85 c0                	test   %eax,%eax
+    2808:	0f 89 07 01 00 00    	jns    2915 <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    280e:	83 ec 0c             	sub    $0xc,%esp
+    2811:	68 7e 49 00 00       	push   $0x497e
+    2816:	e8 46 10 00 00       	call   3861 <mkdir>
+    281b:	83 c4 10             	add    $0x10,%esp
+    281e:	85 c0                	test   %eax,%eax
+    2820:	0f 84 03 01 00 00    	je     2929 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    2826:	83 ec 0c             	sub    $0xc,%esp
+    2829:	68 7e 49 00 00       	push   $0x497e
+    282e:	e8 16 10 00 00       	call   3849 <unlink>
+    2833:	83 c4 10             	add    $0x10,%esp
+    2836:	85 c0                	test   %eax,%eax
+    2838:	0f 84 ff 00 00 00    	je     293d <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    283e:	83 ec 08             	sub    $0x8,%esp
+    2841:	68 7e 49 00 00       	push   $0x497e
+    2846:	68 e2 49 00 00       	push   $0x49e2
+    284b:	e8 09 10 00 00       	call   3859 <link>
+    2850:	83 c4 10             	add    $0x10,%esp
+    2853:	85 c0                	test   %eax,%eax
+    2855:	0f 84 f6 00 00 00    	je     2951 <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    285b:	83 ec 0c             	sub    $0xc,%esp
+    285e:	68 45 49 00 00       	push   $0x4945
+    2863:	e8 e1 0f 00 00       	call   3849 <unlink>
+    2868:	83 c4 10             	add    $0x10,%esp
+    286b:	85 c0                	test   %eax,%eax
+    286d:	0f 85 f2 00 00 00    	jne    2965 <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    2873:	83 ec 08             	sub    $0x8,%esp
+    2876:	6a 02                	push   $0x2
+    2878:	68 3e 45 00 00       	push   $0x453e
+    287d:	e8 b7 0f 00 00       	call   3839 <open>
+  if(fd >= 0){
+    2882:	83 c4 10             	add    $0x10,%esp
+    2885:	85 c0                	test   %eax,%eax
+    2887:	0f 89 ec 00 00 00    	jns    2979 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    288d:	83 ec 08             	sub    $0x8,%esp
+    2890:	6a 00                	push   $0x0
+    2892:	68 3e 45 00 00       	push   $0x453e
+    2897:	e8 9d 0f 00 00       	call   3839 <open>
+    289c:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    289e:	83 c4 0c             	add    $0xc,%esp
+    28a1:	6a 01                	push   $0x1
+    28a3:	68 21 46 00 00       	push   $0x4621
+    28a8:	50                   	push   %eax
+    28a9:	e8 6b 0f 00 00       	call   3819 <write>
+    28ae:	83 c4 10             	add    $0x10,%esp
+    28b1:	85 c0                	test   %eax,%eax
+    28b3:	0f 8f d4 00 00 00    	jg     298d <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    28b9:	83 ec 0c             	sub    $0xc,%esp
+    28bc:	53                   	push   %ebx
+    28bd:	e8 5f 0f 00 00       	call   3821 <close>
+
+  printf(1, "dir vs file OK\n");
+    28c2:	83 c4 08             	add    $0x8,%esp
+    28c5:	68 15 4a 00 00       	push   $0x4a15
+    28ca:	6a 01                	push   $0x1
+    28cc:	e8 00 11 00 00       	call   39d1 <printf>
+}
+    28d1:	83 c4 10             	add    $0x10,%esp
+    28d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    28d7:	c9                   	leave
+    28d8:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    28d9:	83 ec 08             	sub    $0x8,%esp
+    28dc:	68 4d 49 00 00       	push   $0x494d
+    28e1:	6a 01                	push   $0x1
+    28e3:	e8 e9 10 00 00       	call   39d1 <printf>
+    exit();
+    28e8:	e8 0c 0f 00 00       	call   37f9 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    28ed:	83 ec 08             	sub    $0x8,%esp
+    28f0:	68 64 49 00 00       	push   $0x4964
+    28f5:	6a 01                	push   $0x1
+    28f7:	e8 d5 10 00 00       	call   39d1 <printf>
+    exit();
+    28fc:	e8 f8 0e 00 00       	call   37f9 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    2901:	83 ec 08             	sub    $0x8,%esp
+    2904:	68 89 49 00 00       	push   $0x4989
+    2909:	6a 01                	push   $0x1
+    290b:	e8 c1 10 00 00       	call   39d1 <printf>
+    exit();
+    2910:	e8 e4 0e 00 00       	call   37f9 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    2915:	83 ec 08             	sub    $0x8,%esp
+    2918:	68 89 49 00 00       	push   $0x4989
+    291d:	6a 01                	push   $0x1
+    291f:	e8 ad 10 00 00       	call   39d1 <printf>
+    exit();
+    2924:	e8 d0 0e 00 00       	call   37f9 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2929:	83 ec 08             	sub    $0x8,%esp
+    292c:	68 a7 49 00 00       	push   $0x49a7
+    2931:	6a 01                	push   $0x1
+    2933:	e8 99 10 00 00       	call   39d1 <printf>
+    exit();
+    2938:	e8 bc 0e 00 00       	call   37f9 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    293d:	83 ec 08             	sub    $0x8,%esp
+    2940:	68 c4 49 00 00       	push   $0x49c4
+    2945:	6a 01                	push   $0x1
+    2947:	e8 85 10 00 00       	call   39d1 <printf>
+    exit();
+    294c:	e8 a8 0e 00 00       	call   37f9 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2951:	83 ec 08             	sub    $0x8,%esp
+    2954:	68 d8 51 00 00       	push   $0x51d8
+    2959:	6a 01                	push   $0x1
+    295b:	e8 71 10 00 00       	call   39d1 <printf>
+    exit();
+    2960:	e8 94 0e 00 00       	call   37f9 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2965:	83 ec 08             	sub    $0x8,%esp
+    2968:	68 e9 49 00 00       	push   $0x49e9
+    296d:	6a 01                	push   $0x1
+    296f:	e8 5d 10 00 00       	call   39d1 <printf>
+    exit();
+    2974:	e8 80 0e 00 00       	call   37f9 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2979:	83 ec 08             	sub    $0x8,%esp
+    297c:	68 f8 51 00 00       	push   $0x51f8
+    2981:	6a 01                	push   $0x1
+    2983:	e8 49 10 00 00       	call   39d1 <printf>
+    exit();
+    2988:	e8 6c 0e 00 00       	call   37f9 <exit>
+    printf(1, "write . succeeded!\n");
+    298d:	83 ec 08             	sub    $0x8,%esp
+    2990:	68 01 4a 00 00       	push   $0x4a01
+    2995:	6a 01                	push   $0x1
+    2997:	e8 35 10 00 00       	call   39d1 <printf>
+    exit();
+    299c:	e8 58 0e 00 00       	call   37f9 <exit>
+
+000029a1 <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    29a1:	55                   	push   %ebp
+    29a2:	89 e5                	mov    %esp,%ebp
+    29a4:	53                   	push   %ebx
+    29a5:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    29a8:	68 25 4a 00 00       	push   $0x4a25
+    29ad:	6a 01                	push   $0x1
+    29af:	e8 1d 10 00 00       	call   39d1 <printf>
+    29b4:	83 c4 10             	add    $0x10,%esp
+    29b7:	bb 33 00 00 00       	mov    $0x33,%ebx
+    29bc:	eb 4f                	jmp    2a0d <iref+0x6c>
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    29be:	83 ec 08             	sub    $0x8,%esp
+    29c1:	68 3c 4a 00 00       	push   $0x4a3c
+    29c6:	6a 01                	push   $0x1
+    29c8:	e8 04 10 00 00       	call   39d1 <printf>
+      exit();
+    29cd:	e8 27 0e 00 00       	call   37f9 <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    29d2:	83 ec 08             	sub    $0x8,%esp
+    29d5:	68 50 4a 00 00       	push   $0x4a50
+    29da:	6a 01                	push   $0x1
+    29dc:	e8 f0 0f 00 00       	call   39d1 <printf>
+      exit();
+    29e1:	e8 13 0e 00 00       	call   37f9 <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    29e6:	83 ec 0c             	sub    $0xc,%esp
+    29e9:	50                   	push   %eax
+    29ea:	e8 32 0e 00 00       	call   3821 <close>
+    29ef:	83 c4 10             	add    $0x10,%esp
+    29f2:	eb 7d                	jmp    2a71 <iref+0xd0>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    29f4:	83 ec 0c             	sub    $0xc,%esp
+    29f7:	68 20 46 00 00       	push   $0x4620
+    29fc:	e8 48 0e 00 00       	call   3849 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2a01:	83 c4 10             	add    $0x10,%esp
+    2a04:	83 eb 01             	sub    $0x1,%ebx
+    2a07:	0f 84 92 00 00 00    	je     2a9f <iref+0xfe>
+    if(mkdir("irefd") != 0){
+    2a0d:	83 ec 0c             	sub    $0xc,%esp
+    2a10:	68 36 4a 00 00       	push   $0x4a36
+    2a15:	e8 47 0e 00 00       	call   3861 <mkdir>
+    2a1a:	83 c4 10             	add    $0x10,%esp
+    2a1d:	85 c0                	test   %eax,%eax
+    2a1f:	75 9d                	jne    29be <iref+0x1d>
+    if(chdir("irefd") != 0){
+    2a21:	83 ec 0c             	sub    $0xc,%esp
+    2a24:	68 36 4a 00 00       	push   $0x4a36
+    2a29:	e8 3b 0e 00 00       	call   3869 <chdir>
+    2a2e:	83 c4 10             	add    $0x10,%esp
+    2a31:	85 c0                	test   %eax,%eax
+    2a33:	75 9d                	jne    29d2 <iref+0x31>
+    mkdir("");
+    2a35:	83 ec 0c             	sub    $0xc,%esp
+    2a38:	68 eb 40 00 00       	push   $0x40eb
+    2a3d:	e8 1f 0e 00 00       	call   3861 <mkdir>
+    link("README", "");
+    2a42:	83 c4 08             	add    $0x8,%esp
+    2a45:	68 eb 40 00 00       	push   $0x40eb
+    2a4a:	68 e2 49 00 00       	push   $0x49e2
+    2a4f:	e8 05 0e 00 00       	call   3859 <link>
+    fd = open("", O_CREATE);
+    2a54:	83 c4 08             	add    $0x8,%esp
+    2a57:	68 00 02 00 00       	push   $0x200
+    2a5c:	68 eb 40 00 00       	push   $0x40eb
+    2a61:	e8 d3 0d 00 00       	call   3839 <open>
+    if(fd >= 0)
+    2a66:	83 c4 10             	add    $0x10,%esp
+    2a69:	85 c0                	test   %eax,%eax
+    2a6b:	0f 89 75 ff ff ff    	jns    29e6 <iref+0x45>
+    fd = open("xx", O_CREATE);
+    2a71:	83 ec 08             	sub    $0x8,%esp
+    2a74:	68 00 02 00 00       	push   $0x200
+    2a79:	68 20 46 00 00       	push   $0x4620
+    2a7e:	e8 b6 0d 00 00       	call   3839 <open>
+    if(fd >= 0)
+    2a83:	83 c4 10             	add    $0x10,%esp
+    2a86:	85 c0                	test   %eax,%eax
+    2a88:	0f 88 66 ff ff ff    	js     29f4 <iref+0x53>
+      close(fd);
+    2a8e:	83 ec 0c             	sub    $0xc,%esp
+    2a91:	50                   	push   %eax
+    2a92:	e8 8a 0d 00 00       	call   3821 <close>
+    2a97:	83 c4 10             	add    $0x10,%esp
+    2a9a:	e9 55 ff ff ff       	jmp    29f4 <iref+0x53>
+  }
+
+  chdir("/");
+    2a9f:	83 ec 0c             	sub    $0xc,%esp
+    2aa2:	68 11 3d 00 00       	push   $0x3d11
+    2aa7:	e8 bd 0d 00 00       	call   3869 <chdir>
+  printf(1, "empty file name OK\n");
+    2aac:	83 c4 08             	add    $0x8,%esp
+    2aaf:	68 64 4a 00 00       	push   $0x4a64
+    2ab4:	6a 01                	push   $0x1
+    2ab6:	e8 16 0f 00 00       	call   39d1 <printf>
+}
+    2abb:	83 c4 10             	add    $0x10,%esp
+    2abe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ac1:	c9                   	leave
+    2ac2:	c3                   	ret
+
+00002ac3 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    2ac3:	55                   	push   %ebp
+    2ac4:	89 e5                	mov    %esp,%ebp
+    2ac6:	53                   	push   %ebx
+    2ac7:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    2aca:	68 78 4a 00 00       	push   $0x4a78
+    2acf:	6a 01                	push   $0x1
+    2ad1:	e8 fb 0e 00 00       	call   39d1 <printf>
+    2ad6:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    2ad9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    pid = fork();
+    2ade:	e8 0e 0d 00 00       	call   37f1 <fork>
+    if(pid < 0)
+    2ae3:	85 c0                	test   %eax,%eax
+    2ae5:	78 26                	js     2b0d <forktest+0x4a>
+      break;
+    if(pid == 0)
+    2ae7:	74 1f                	je     2b08 <forktest+0x45>
+  for(n=0; n<1000; n++){
+    2ae9:	83 c3 01             	add    $0x1,%ebx
+    2aec:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2af2:	75 ea                	jne    2ade <forktest+0x1b>
+      exit();
+  }
+
+  if(n == 1000){
+    printf(1, "fork claimed to work 1000 times!\n");
+    2af4:	83 ec 08             	sub    $0x8,%esp
+    2af7:	68 18 52 00 00       	push   $0x5218
+    2afc:	6a 01                	push   $0x1
+    2afe:	e8 ce 0e 00 00       	call   39d1 <printf>
+    exit();
+    2b03:	e8 f1 0c 00 00       	call   37f9 <exit>
+      exit();
+    2b08:	e8 ec 0c 00 00       	call   37f9 <exit>
+  if(n == 1000){
+    2b0d:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2b13:	74 df                	je     2af4 <forktest+0x31>
+  }
+
+  for(; n > 0; n--){
+    2b15:	85 db                	test   %ebx,%ebx
+    2b17:	7e 0e                	jle    2b27 <forktest+0x64>
+    if(wait() < 0){
+    2b19:	e8 e3 0c 00 00       	call   3801 <wait>
+    2b1e:	85 c0                	test   %eax,%eax
+    2b20:	78 26                	js     2b48 <forktest+0x85>
+  for(; n > 0; n--){
+    2b22:	83 eb 01             	sub    $0x1,%ebx
+    2b25:	75 f2                	jne    2b19 <forktest+0x56>
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait() != -1){
+    2b27:	e8 d5 0c 00 00       	call   3801 <wait>
+    2b2c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b2f:	75 2b                	jne    2b5c <forktest+0x99>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    2b31:	83 ec 08             	sub    $0x8,%esp
+    2b34:	68 aa 4a 00 00       	push   $0x4aaa
+    2b39:	6a 01                	push   $0x1
+    2b3b:	e8 91 0e 00 00       	call   39d1 <printf>
+}
+    2b40:	83 c4 10             	add    $0x10,%esp
+    2b43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b46:	c9                   	leave
+    2b47:	c3                   	ret
+      printf(1, "wait stopped early\n");
+    2b48:	83 ec 08             	sub    $0x8,%esp
+    2b4b:	68 83 4a 00 00       	push   $0x4a83
+    2b50:	6a 01                	push   $0x1
+    2b52:	e8 7a 0e 00 00       	call   39d1 <printf>
+      exit();
+    2b57:	e8 9d 0c 00 00       	call   37f9 <exit>
+    printf(1, "wait got too many\n");
+    2b5c:	83 ec 08             	sub    $0x8,%esp
+    2b5f:	68 97 4a 00 00       	push   $0x4a97
+    2b64:	6a 01                	push   $0x1
+    2b66:	e8 66 0e 00 00       	call   39d1 <printf>
+    exit();
+    2b6b:	e8 89 0c 00 00       	call   37f9 <exit>
+
+00002b70 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    2b70:	55                   	push   %ebp
+    2b71:	89 e5                	mov    %esp,%ebp
+    2b73:	57                   	push   %edi
+    2b74:	56                   	push   %esi
+    2b75:	53                   	push   %ebx
+    2b76:	83 ec 64             	sub    $0x64,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    2b79:	68 b8 4a 00 00       	push   $0x4ab8
+    2b7e:	ff 35 64 5d 00 00    	push   0x5d64
+    2b84:	e8 48 0e 00 00       	call   39d1 <printf>
+  oldbrk = sbrk(0);
+    2b89:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b90:	e8 ec 0c 00 00       	call   3881 <sbrk>
+    2b95:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    2b98:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b9f:	e8 dd 0c 00 00       	call   3881 <sbrk>
+    2ba4:	89 c3                	mov    %eax,%ebx
+    2ba6:	83 c4 10             	add    $0x10,%esp
+  int i;
+  for(i = 0; i < 5000; i++){
+    2ba9:	be 00 00 00 00       	mov    $0x0,%esi
+    2bae:	eb 02                	jmp    2bb2 <sbrktest+0x42>
+    if(b != a){
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    a = b + 1;
+    2bb0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2bb2:	83 ec 0c             	sub    $0xc,%esp
+    2bb5:	6a 01                	push   $0x1
+    2bb7:	e8 c5 0c 00 00       	call   3881 <sbrk>
+    if(b != a){
+    2bbc:	83 c4 10             	add    $0x10,%esp
+    2bbf:	39 d8                	cmp    %ebx,%eax
+    2bc1:	0f 85 92 01 00 00    	jne    2d59 <sbrktest+0x1e9>
+    *b = 1;
+    2bc7:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2bca:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2bcd:	83 c6 01             	add    $0x1,%esi
+    2bd0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2bd6:	75 d8                	jne    2bb0 <sbrktest+0x40>
+  }
+  pid = fork();
+    2bd8:	e8 14 0c 00 00       	call   37f1 <fork>
+    2bdd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2bdf:	85 c0                	test   %eax,%eax
+    2be1:	0f 88 90 01 00 00    	js     2d77 <sbrktest+0x207>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    2be7:	83 ec 0c             	sub    $0xc,%esp
+    2bea:	6a 01                	push   $0x1
+    2bec:	e8 90 0c 00 00       	call   3881 <sbrk>
+  c = sbrk(1);
+    2bf1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2bf8:	e8 84 0c 00 00       	call   3881 <sbrk>
+  if(c != a + 1){
+    2bfd:	83 c3 02             	add    $0x2,%ebx
+    2c00:	83 c4 10             	add    $0x10,%esp
+    2c03:	39 c3                	cmp    %eax,%ebx
+    2c05:	0f 85 84 01 00 00    	jne    2d8f <sbrktest+0x21f>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    2c0b:	85 f6                	test   %esi,%esi
+    2c0d:	0f 84 94 01 00 00    	je     2da7 <sbrktest+0x237>
+    exit();
+  wait();
+    2c13:	e8 e9 0b 00 00       	call   3801 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    2c18:	83 ec 0c             	sub    $0xc,%esp
+    2c1b:	6a 00                	push   $0x0
+    2c1d:	e8 5f 0c 00 00       	call   3881 <sbrk>
+    2c22:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2c24:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2c29:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2c2b:	89 04 24             	mov    %eax,(%esp)
+    2c2e:	e8 4e 0c 00 00       	call   3881 <sbrk>
+  if (p != a) {
+    2c33:	83 c4 10             	add    $0x10,%esp
+    2c36:	39 c3                	cmp    %eax,%ebx
+    2c38:	0f 85 6e 01 00 00    	jne    2dac <sbrktest+0x23c>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    2c3e:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+
+  // can one de-allocate?
+  a = sbrk(0);
+    2c45:	83 ec 0c             	sub    $0xc,%esp
+    2c48:	6a 00                	push   $0x0
+    2c4a:	e8 32 0c 00 00       	call   3881 <sbrk>
+    2c4f:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2c51:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    2c58:	e8 24 0c 00 00       	call   3881 <sbrk>
+  if(c == (char*)0xffffffff){
+    2c5d:	83 c4 10             	add    $0x10,%esp
+    2c60:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2c63:	0f 84 5b 01 00 00    	je     2dc4 <sbrktest+0x254>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    2c69:	83 ec 0c             	sub    $0xc,%esp
+    2c6c:	6a 00                	push   $0x0
+    2c6e:	e8 0e 0c 00 00       	call   3881 <sbrk>
+  if(c != a - 4096){
+    2c73:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2c79:	83 c4 10             	add    $0x10,%esp
+    2c7c:	39 d0                	cmp    %edx,%eax
+    2c7e:	0f 85 58 01 00 00    	jne    2ddc <sbrktest+0x26c>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    2c84:	83 ec 0c             	sub    $0xc,%esp
+    2c87:	6a 00                	push   $0x0
+    2c89:	e8 f3 0b 00 00       	call   3881 <sbrk>
+    2c8e:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2c90:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    2c97:	e8 e5 0b 00 00       	call   3881 <sbrk>
+    2c9c:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2c9e:	83 c4 10             	add    $0x10,%esp
+    2ca1:	39 c3                	cmp    %eax,%ebx
+    2ca3:	0f 85 4a 01 00 00    	jne    2df3 <sbrktest+0x283>
+    2ca9:	83 ec 0c             	sub    $0xc,%esp
+    2cac:	6a 00                	push   $0x0
+    2cae:	e8 ce 0b 00 00       	call   3881 <sbrk>
+    2cb3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2cb9:	83 c4 10             	add    $0x10,%esp
+    2cbc:	39 c2                	cmp    %eax,%edx
+    2cbe:	0f 85 2f 01 00 00    	jne    2df3 <sbrktest+0x283>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    2cc4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2ccb:	0f 84 39 01 00 00    	je     2e0a <sbrktest+0x29a>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    2cd1:	83 ec 0c             	sub    $0xc,%esp
+    2cd4:	6a 00                	push   $0x0
+    2cd6:	e8 a6 0b 00 00       	call   3881 <sbrk>
+    2cdb:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2cdd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2ce4:	e8 98 0b 00 00       	call   3881 <sbrk>
+    2ce9:	89 c2                	mov    %eax,%edx
+    2ceb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2cee:	29 d0                	sub    %edx,%eax
+    2cf0:	89 04 24             	mov    %eax,(%esp)
+    2cf3:	e8 89 0b 00 00       	call   3881 <sbrk>
+  if(c != a){
+    2cf8:	83 c4 10             	add    $0x10,%esp
+    2cfb:	39 c3                	cmp    %eax,%ebx
+    2cfd:	0f 85 1f 01 00 00    	jne    2e22 <sbrktest+0x2b2>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2d03:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    ppid = getpid();
+    2d08:	e8 6c 0b 00 00       	call   3879 <getpid>
+    2d0d:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2d0f:	e8 dd 0a 00 00       	call   37f1 <fork>
+    if(pid < 0){
+    2d14:	85 c0                	test   %eax,%eax
+    2d16:	0f 88 1d 01 00 00    	js     2e39 <sbrktest+0x2c9>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    2d1c:	0f 84 2f 01 00 00    	je     2e51 <sbrktest+0x2e1>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    2d22:	e8 da 0a 00 00       	call   3801 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2d27:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2d2d:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    2d33:	75 d3                	jne    2d08 <sbrktest+0x198>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    2d35:	83 ec 0c             	sub    $0xc,%esp
+    2d38:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2d3b:	50                   	push   %eax
+    2d3c:	e8 c8 0a 00 00       	call   3809 <pipe>
+    2d41:	83 c4 10             	add    $0x10,%esp
+    2d44:	85 c0                	test   %eax,%eax
+    2d46:	0f 85 27 01 00 00    	jne    2e73 <sbrktest+0x303>
+    2d4c:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+    2d4f:	8d 7d e0             	lea    -0x20(%ebp),%edi
+    2d52:	89 de                	mov    %ebx,%esi
+    2d54:	e9 77 01 00 00       	jmp    2ed0 <sbrktest+0x360>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    2d59:	83 ec 0c             	sub    $0xc,%esp
+    2d5c:	50                   	push   %eax
+    2d5d:	53                   	push   %ebx
+    2d5e:	56                   	push   %esi
+    2d5f:	68 c3 4a 00 00       	push   $0x4ac3
+    2d64:	ff 35 64 5d 00 00    	push   0x5d64
+    2d6a:	e8 62 0c 00 00       	call   39d1 <printf>
+      exit();
+    2d6f:	83 c4 20             	add    $0x20,%esp
+    2d72:	e8 82 0a 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    2d77:	83 ec 08             	sub    $0x8,%esp
+    2d7a:	68 de 4a 00 00       	push   $0x4ade
+    2d7f:	ff 35 64 5d 00 00    	push   0x5d64
+    2d85:	e8 47 0c 00 00       	call   39d1 <printf>
+    exit();
+    2d8a:	e8 6a 0a 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    2d8f:	83 ec 08             	sub    $0x8,%esp
+    2d92:	68 f5 4a 00 00       	push   $0x4af5
+    2d97:	ff 35 64 5d 00 00    	push   0x5d64
+    2d9d:	e8 2f 0c 00 00       	call   39d1 <printf>
+    exit();
+    2da2:	e8 52 0a 00 00       	call   37f9 <exit>
+    exit();
+    2da7:	e8 4d 0a 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    2dac:	83 ec 08             	sub    $0x8,%esp
+    2daf:	68 3c 52 00 00       	push   $0x523c
+    2db4:	ff 35 64 5d 00 00    	push   0x5d64
+    2dba:	e8 12 0c 00 00       	call   39d1 <printf>
+    exit();
+    2dbf:	e8 35 0a 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    2dc4:	83 ec 08             	sub    $0x8,%esp
+    2dc7:	68 11 4b 00 00       	push   $0x4b11
+    2dcc:	ff 35 64 5d 00 00    	push   0x5d64
+    2dd2:	e8 fa 0b 00 00       	call   39d1 <printf>
+    exit();
+    2dd7:	e8 1d 0a 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    2ddc:	50                   	push   %eax
+    2ddd:	53                   	push   %ebx
+    2dde:	68 7c 52 00 00       	push   $0x527c
+    2de3:	ff 35 64 5d 00 00    	push   0x5d64
+    2de9:	e8 e3 0b 00 00       	call   39d1 <printf>
+    exit();
+    2dee:	e8 06 0a 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    2df3:	56                   	push   %esi
+    2df4:	53                   	push   %ebx
+    2df5:	68 b4 52 00 00       	push   $0x52b4
+    2dfa:	ff 35 64 5d 00 00    	push   0x5d64
+    2e00:	e8 cc 0b 00 00       	call   39d1 <printf>
+    exit();
+    2e05:	e8 ef 09 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    2e0a:	83 ec 08             	sub    $0x8,%esp
+    2e0d:	68 dc 52 00 00       	push   $0x52dc
+    2e12:	ff 35 64 5d 00 00    	push   0x5d64
+    2e18:	e8 b4 0b 00 00       	call   39d1 <printf>
+    exit();
+    2e1d:	e8 d7 09 00 00       	call   37f9 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    2e22:	50                   	push   %eax
+    2e23:	53                   	push   %ebx
+    2e24:	68 0c 53 00 00       	push   $0x530c
+    2e29:	ff 35 64 5d 00 00    	push   0x5d64
+    2e2f:	e8 9d 0b 00 00       	call   39d1 <printf>
+    exit();
+    2e34:	e8 c0 09 00 00       	call   37f9 <exit>
+      printf(stdout, "fork failed\n");
+    2e39:	83 ec 08             	sub    $0x8,%esp
+    2e3c:	68 09 4c 00 00       	push   $0x4c09
+    2e41:	ff 35 64 5d 00 00    	push   0x5d64
+    2e47:	e8 85 0b 00 00       	call   39d1 <printf>
+      exit();
+    2e4c:	e8 a8 09 00 00       	call   37f9 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    2e51:	0f be 03             	movsbl (%ebx),%eax
+    2e54:	50                   	push   %eax
+    2e55:	53                   	push   %ebx
+    2e56:	68 2c 4b 00 00       	push   $0x4b2c
+    2e5b:	ff 35 64 5d 00 00    	push   0x5d64
+    2e61:	e8 6b 0b 00 00       	call   39d1 <printf>
+      kill(ppid);
+    2e66:	89 34 24             	mov    %esi,(%esp)
+    2e69:	e8 bb 09 00 00       	call   3829 <kill>
+      exit();
+    2e6e:	e8 86 09 00 00       	call   37f9 <exit>
+    printf(1, "pipe() failed\n");
+    2e73:	83 ec 08             	sub    $0x8,%esp
+    2e76:	68 01 40 00 00       	push   $0x4001
+    2e7b:	6a 01                	push   $0x1
+    2e7d:	e8 4f 0b 00 00       	call   39d1 <printf>
+    exit();
+    2e82:	e8 72 09 00 00       	call   37f9 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    2e87:	83 ec 0c             	sub    $0xc,%esp
+    2e8a:	6a 00                	push   $0x0
+    2e8c:	e8 f0 09 00 00       	call   3881 <sbrk>
+    2e91:	89 c2                	mov    %eax,%edx
+    2e93:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2e98:	29 d0                	sub    %edx,%eax
+    2e9a:	89 04 24             	mov    %eax,(%esp)
+    2e9d:	e8 df 09 00 00       	call   3881 <sbrk>
+      write(fds[1], "x", 1);
+    2ea2:	83 c4 0c             	add    $0xc,%esp
+    2ea5:	6a 01                	push   $0x1
+    2ea7:	68 21 46 00 00       	push   $0x4621
+    2eac:	ff 75 e4             	push   -0x1c(%ebp)
+    2eaf:	e8 65 09 00 00       	call   3819 <write>
+    2eb4:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    2eb7:	83 ec 0c             	sub    $0xc,%esp
+    2eba:	68 e8 03 00 00       	push   $0x3e8
+    2ebf:	e8 c5 09 00 00       	call   3889 <sleep>
+    2ec4:	83 c4 10             	add    $0x10,%esp
+    2ec7:	eb ee                	jmp    2eb7 <sbrktest+0x347>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2ec9:	83 c6 04             	add    $0x4,%esi
+    2ecc:	39 fe                	cmp    %edi,%esi
+    2ece:	74 26                	je     2ef6 <sbrktest+0x386>
+    if((pids[i] = fork()) == 0){
+    2ed0:	e8 1c 09 00 00       	call   37f1 <fork>
+    2ed5:	89 06                	mov    %eax,(%esi)
+    2ed7:	85 c0                	test   %eax,%eax
+    2ed9:	74 ac                	je     2e87 <sbrktest+0x317>
+    }
+    if(pids[i] != -1)
+    2edb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2ede:	74 e9                	je     2ec9 <sbrktest+0x359>
+      read(fds[0], &scratch, 1);
+    2ee0:	83 ec 04             	sub    $0x4,%esp
+    2ee3:	6a 01                	push   $0x1
+    2ee5:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    2ee8:	50                   	push   %eax
+    2ee9:	ff 75 e0             	push   -0x20(%ebp)
+    2eec:	e8 20 09 00 00       	call   3811 <read>
+    2ef1:	83 c4 10             	add    $0x10,%esp
+    2ef4:	eb d3                	jmp    2ec9 <sbrktest+0x359>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    2ef6:	83 ec 0c             	sub    $0xc,%esp
+    2ef9:	68 00 10 00 00       	push   $0x1000
+    2efe:	e8 7e 09 00 00       	call   3881 <sbrk>
+    2f03:	89 c6                	mov    %eax,%esi
+    2f05:	83 c4 10             	add    $0x10,%esp
+    2f08:	eb 07                	jmp    2f11 <sbrktest+0x3a1>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f0a:	83 c3 04             	add    $0x4,%ebx
+    2f0d:	39 fb                	cmp    %edi,%ebx
+    2f0f:	74 1a                	je     2f2b <sbrktest+0x3bb>
+    if(pids[i] == -1)
+    2f11:	8b 03                	mov    (%ebx),%eax
+    2f13:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f16:	74 f2                	je     2f0a <sbrktest+0x39a>
+      continue;
+    kill(pids[i]);
+    2f18:	83 ec 0c             	sub    $0xc,%esp
+    2f1b:	50                   	push   %eax
+    2f1c:	e8 08 09 00 00       	call   3829 <kill>
+    wait();
+    2f21:	e8 db 08 00 00       	call   3801 <wait>
+    2f26:	83 c4 10             	add    $0x10,%esp
+    2f29:	eb df                	jmp    2f0a <sbrktest+0x39a>
+  }
+  if(c == (char*)0xffffffff){
+    2f2b:	83 fe ff             	cmp    $0xffffffff,%esi
+    2f2e:	74 30                	je     2f60 <sbrktest+0x3f0>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    2f30:	83 ec 0c             	sub    $0xc,%esp
+    2f33:	6a 00                	push   $0x0
+    2f35:	e8 47 09 00 00       	call   3881 <sbrk>
+    2f3a:	83 c4 10             	add    $0x10,%esp
+    2f3d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    2f40:	72 36                	jb     2f78 <sbrktest+0x408>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    2f42:	83 ec 08             	sub    $0x8,%esp
+    2f45:	68 60 4b 00 00       	push   $0x4b60
+    2f4a:	ff 35 64 5d 00 00    	push   0x5d64
+    2f50:	e8 7c 0a 00 00       	call   39d1 <printf>
+}
+    2f55:	83 c4 10             	add    $0x10,%esp
+    2f58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2f5b:	5b                   	pop    %ebx
+    2f5c:	5e                   	pop    %esi
+    2f5d:	5f                   	pop    %edi
+    2f5e:	5d                   	pop    %ebp
+    2f5f:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    2f60:	83 ec 08             	sub    $0x8,%esp
+    2f63:	68 45 4b 00 00       	push   $0x4b45
+    2f68:	ff 35 64 5d 00 00    	push   0x5d64
+    2f6e:	e8 5e 0a 00 00       	call   39d1 <printf>
+    exit();
+    2f73:	e8 81 08 00 00       	call   37f9 <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    2f78:	83 ec 0c             	sub    $0xc,%esp
+    2f7b:	6a 00                	push   $0x0
+    2f7d:	e8 ff 08 00 00       	call   3881 <sbrk>
+    2f82:	89 c2                	mov    %eax,%edx
+    2f84:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2f87:	29 d0                	sub    %edx,%eax
+    2f89:	89 04 24             	mov    %eax,(%esp)
+    2f8c:	e8 f0 08 00 00       	call   3881 <sbrk>
+    2f91:	83 c4 10             	add    $0x10,%esp
+    2f94:	eb ac                	jmp    2f42 <sbrktest+0x3d2>
+
+00002f96 <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    2f96:	c3                   	ret
+
+00002f97 <validatetest>:
+
+void
+validatetest(void)
+{
+    2f97:	55                   	push   %ebp
+    2f98:	89 e5                	mov    %esp,%ebp
+    2f9a:	56                   	push   %esi
+    2f9b:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    2f9c:	83 ec 08             	sub    $0x8,%esp
+    2f9f:	68 6e 4b 00 00       	push   $0x4b6e
+    2fa4:	ff 35 64 5d 00 00    	push   0x5d64
+    2faa:	e8 22 0a 00 00       	call   39d1 <printf>
+    2faf:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2fb2:	be 00 00 00 00       	mov    $0x0,%esi
+    if((pid = fork()) == 0){
+    2fb7:	e8 35 08 00 00       	call   37f1 <fork>
+    2fbc:	89 c3                	mov    %eax,%ebx
+    2fbe:	85 c0                	test   %eax,%eax
+    2fc0:	74 64                	je     3026 <validatetest+0x8f>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    2fc2:	83 ec 0c             	sub    $0xc,%esp
+    2fc5:	6a 00                	push   $0x0
+    2fc7:	e8 bd 08 00 00       	call   3889 <sleep>
+    sleep(0);
+    2fcc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fd3:	e8 b1 08 00 00       	call   3889 <sleep>
+    kill(pid);
+    2fd8:	89 1c 24             	mov    %ebx,(%esp)
+    2fdb:	e8 49 08 00 00       	call   3829 <kill>
+    wait();
+    2fe0:	e8 1c 08 00 00       	call   3801 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    2fe5:	83 c4 08             	add    $0x8,%esp
+    2fe8:	56                   	push   %esi
+    2fe9:	68 7d 4b 00 00       	push   $0x4b7d
+    2fee:	e8 66 08 00 00       	call   3859 <link>
+    2ff3:	83 c4 10             	add    $0x10,%esp
+    2ff6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2ff9:	75 30                	jne    302b <validatetest+0x94>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2ffb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3001:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3007:	75 ae                	jne    2fb7 <validatetest+0x20>
+      printf(stdout, "link should not succeed\n");
+      exit();
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3009:	83 ec 08             	sub    $0x8,%esp
+    300c:	68 a1 4b 00 00       	push   $0x4ba1
+    3011:	ff 35 64 5d 00 00    	push   0x5d64
+    3017:	e8 b5 09 00 00       	call   39d1 <printf>
+}
+    301c:	83 c4 10             	add    $0x10,%esp
+    301f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3022:	5b                   	pop    %ebx
+    3023:	5e                   	pop    %esi
+    3024:	5d                   	pop    %ebp
+    3025:	c3                   	ret
+      exit();
+    3026:	e8 ce 07 00 00       	call   37f9 <exit>
+      printf(stdout, "link should not succeed\n");
+    302b:	83 ec 08             	sub    $0x8,%esp
+    302e:	68 88 4b 00 00       	push   $0x4b88
+    3033:	ff 35 64 5d 00 00    	push   0x5d64
+    3039:	e8 93 09 00 00       	call   39d1 <printf>
+      exit();
+    303e:	e8 b6 07 00 00       	call   37f9 <exit>
+
+00003043 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3043:	55                   	push   %ebp
+    3044:	89 e5                	mov    %esp,%ebp
+    3046:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3049:	68 ae 4b 00 00       	push   $0x4bae
+    304e:	ff 35 64 5d 00 00    	push   0x5d64
+    3054:	e8 78 09 00 00       	call   39d1 <printf>
+    3059:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    305c:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(uninit[i] != '\0'){
+    3061:	80 b8 80 5d 00 00 00 	cmpb   $0x0,0x5d80(%eax)
+    3068:	75 22                	jne    308c <bsstest+0x49>
+  for(i = 0; i < sizeof(uninit); i++){
+    306a:	83 c0 01             	add    $0x1,%eax
+    306d:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3072:	75 ed                	jne    3061 <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+      exit();
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3074:	83 ec 08             	sub    $0x8,%esp
+    3077:	68 c9 4b 00 00       	push   $0x4bc9
+    307c:	ff 35 64 5d 00 00    	push   0x5d64
+    3082:	e8 4a 09 00 00       	call   39d1 <printf>
+}
+    3087:	83 c4 10             	add    $0x10,%esp
+    308a:	c9                   	leave
+    308b:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    308c:	83 ec 08             	sub    $0x8,%esp
+    308f:	68 b8 4b 00 00       	push   $0x4bb8
+    3094:	ff 35 64 5d 00 00    	push   0x5d64
+    309a:	e8 32 09 00 00       	call   39d1 <printf>
+      exit();
+    309f:	e8 55 07 00 00       	call   37f9 <exit>
+
+000030a4 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    30a4:	55                   	push   %ebp
+    30a5:	89 e5                	mov    %esp,%ebp
+    30a7:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    30aa:	68 d6 4b 00 00       	push   $0x4bd6
+    30af:	e8 95 07 00 00       	call   3849 <unlink>
+  pid = fork();
+    30b4:	e8 38 07 00 00       	call   37f1 <fork>
+  if(pid == 0){
+    30b9:	83 c4 10             	add    $0x10,%esp
+    30bc:	85 c0                	test   %eax,%eax
+    30be:	74 3f                	je     30ff <bigargtest+0x5b>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    30c0:	0f 88 ad 00 00 00    	js     3173 <bigargtest+0xcf>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    30c6:	e8 36 07 00 00       	call   3801 <wait>
+  fd = open("bigarg-ok", 0);
+    30cb:	83 ec 08             	sub    $0x8,%esp
+    30ce:	6a 00                	push   $0x0
+    30d0:	68 d6 4b 00 00       	push   $0x4bd6
+    30d5:	e8 5f 07 00 00       	call   3839 <open>
+  if(fd < 0){
+    30da:	83 c4 10             	add    $0x10,%esp
+    30dd:	85 c0                	test   %eax,%eax
+    30df:	0f 88 a6 00 00 00    	js     318b <bigargtest+0xe7>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    30e5:	83 ec 0c             	sub    $0xc,%esp
+    30e8:	50                   	push   %eax
+    30e9:	e8 33 07 00 00       	call   3821 <close>
+  unlink("bigarg-ok");
+    30ee:	c7 04 24 d6 4b 00 00 	movl   $0x4bd6,(%esp)
+    30f5:	e8 4f 07 00 00       	call   3849 <unlink>
+}
+    30fa:	83 c4 10             	add    $0x10,%esp
+    30fd:	c9                   	leave
+    30fe:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    30ff:	c7 04 85 a0 a4 00 00 	movl   $0x5330,0xa4a0(,%eax,4)
+    3106:	30 53 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    310a:	83 c0 01             	add    $0x1,%eax
+    310d:	83 f8 1f             	cmp    $0x1f,%eax
+    3110:	75 ed                	jne    30ff <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    3112:	c7 05 1c a5 00 00 00 	movl   $0x0,0xa51c
+    3119:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    311c:	83 ec 08             	sub    $0x8,%esp
+    311f:	68 e0 4b 00 00       	push   $0x4be0
+    3124:	ff 35 64 5d 00 00    	push   0x5d64
+    312a:	e8 a2 08 00 00       	call   39d1 <printf>
+    exec("echo", args);
+    312f:	83 c4 08             	add    $0x8,%esp
+    3132:	68 a0 a4 00 00       	push   $0xa4a0
+    3137:	68 ad 3d 00 00       	push   $0x3dad
+    313c:	e8 f0 06 00 00       	call   3831 <exec>
+    printf(stdout, "bigarg test ok\n");
+    3141:	83 c4 08             	add    $0x8,%esp
+    3144:	68 ed 4b 00 00       	push   $0x4bed
+    3149:	ff 35 64 5d 00 00    	push   0x5d64
+    314f:	e8 7d 08 00 00       	call   39d1 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3154:	83 c4 08             	add    $0x8,%esp
+    3157:	68 00 02 00 00       	push   $0x200
+    315c:	68 d6 4b 00 00       	push   $0x4bd6
+    3161:	e8 d3 06 00 00       	call   3839 <open>
+    close(fd);
+    3166:	89 04 24             	mov    %eax,(%esp)
+    3169:	e8 b3 06 00 00       	call   3821 <close>
+    exit();
+    316e:	e8 86 06 00 00       	call   37f9 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3173:	83 ec 08             	sub    $0x8,%esp
+    3176:	68 fd 4b 00 00       	push   $0x4bfd
+    317b:	ff 35 64 5d 00 00    	push   0x5d64
+    3181:	e8 4b 08 00 00       	call   39d1 <printf>
+    exit();
+    3186:	e8 6e 06 00 00       	call   37f9 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    318b:	83 ec 08             	sub    $0x8,%esp
+    318e:	68 16 4c 00 00       	push   $0x4c16
+    3193:	ff 35 64 5d 00 00    	push   0x5d64
+    3199:	e8 33 08 00 00       	call   39d1 <printf>
+    exit();
+    319e:	e8 56 06 00 00       	call   37f9 <exit>
+
+000031a3 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    31a3:	55                   	push   %ebp
+    31a4:	89 e5                	mov    %esp,%ebp
+    31a6:	57                   	push   %edi
+    31a7:	56                   	push   %esi
+    31a8:	53                   	push   %ebx
+    31a9:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    31ac:	68 2b 4c 00 00       	push   $0x4c2b
+    31b1:	6a 01                	push   $0x1
+    31b3:	e8 19 08 00 00       	call   39d1 <printf>
+    31b8:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    31bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    31c0:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    31c4:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    31c9:	f7 eb                	imul   %ebx
+    31cb:	c1 fa 06             	sar    $0x6,%edx
+    31ce:	89 de                	mov    %ebx,%esi
+    31d0:	c1 fe 1f             	sar    $0x1f,%esi
+    31d3:	29 f2                	sub    %esi,%edx
+    31d5:	8d 42 30             	lea    0x30(%edx),%eax
+    31d8:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    31db:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    31e1:	89 d9                	mov    %ebx,%ecx
+    31e3:	29 d1                	sub    %edx,%ecx
+    31e5:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    31ea:	f7 e9                	imul   %ecx
+    31ec:	c1 fa 05             	sar    $0x5,%edx
+    31ef:	c1 f9 1f             	sar    $0x1f,%ecx
+    31f2:	29 ca                	sub    %ecx,%edx
+    31f4:	83 c2 30             	add    $0x30,%edx
+    31f7:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    31fa:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    31ff:	f7 eb                	imul   %ebx
+    3201:	c1 fa 05             	sar    $0x5,%edx
+    3204:	29 f2                	sub    %esi,%edx
+    3206:	6b d2 64             	imul   $0x64,%edx,%edx
+    3209:	89 df                	mov    %ebx,%edi
+    320b:	29 d7                	sub    %edx,%edi
+    320d:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3212:	89 f8                	mov    %edi,%eax
+    3214:	f7 e9                	imul   %ecx
+    3216:	c1 fa 02             	sar    $0x2,%edx
+    3219:	c1 ff 1f             	sar    $0x1f,%edi
+    321c:	29 fa                	sub    %edi,%edx
+    321e:	83 c2 30             	add    $0x30,%edx
+    3221:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3224:	89 d8                	mov    %ebx,%eax
+    3226:	f7 e9                	imul   %ecx
+    3228:	c1 fa 02             	sar    $0x2,%edx
+    322b:	29 f2                	sub    %esi,%edx
+    322d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3230:	01 d2                	add    %edx,%edx
+    3232:	89 d8                	mov    %ebx,%eax
+    3234:	29 d0                	sub    %edx,%eax
+    3236:	83 c0 30             	add    $0x30,%eax
+    3239:	88 45 ac             	mov    %al,-0x54(%ebp)
+    name[5] = '\0';
+    323c:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    3240:	83 ec 04             	sub    $0x4,%esp
+    3243:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    3246:	56                   	push   %esi
+    3247:	68 38 4c 00 00       	push   $0x4c38
+    324c:	6a 01                	push   $0x1
+    324e:	e8 7e 07 00 00       	call   39d1 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3253:	83 c4 08             	add    $0x8,%esp
+    3256:	68 02 02 00 00       	push   $0x202
+    325b:	56                   	push   %esi
+    325c:	e8 d8 05 00 00       	call   3839 <open>
+    3261:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3263:	83 c4 10             	add    $0x10,%esp
+    3266:	85 c0                	test   %eax,%eax
+    3268:	0f 89 d3 00 00 00    	jns    3341 <fsfull+0x19e>
+      printf(1, "open %s failed\n", name);
+    326e:	83 ec 04             	sub    $0x4,%esp
+    3271:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3274:	50                   	push   %eax
+    3275:	68 44 4c 00 00       	push   $0x4c44
+    327a:	6a 01                	push   $0x1
+    327c:	e8 50 07 00 00       	call   39d1 <printf>
+      break;
+    3281:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    if(total == 0)
+      break;
+  }
+
+  while(nfiles >= 0){
+    3284:	85 db                	test   %ebx,%ebx
+    3286:	0f 88 9b 00 00 00    	js     3327 <fsfull+0x184>
+    char name[64];
+    name[0] = 'f';
+    328c:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3290:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    3295:	f7 eb                	imul   %ebx
+    3297:	c1 fa 06             	sar    $0x6,%edx
+    329a:	89 de                	mov    %ebx,%esi
+    329c:	c1 fe 1f             	sar    $0x1f,%esi
+    329f:	29 f2                	sub    %esi,%edx
+    32a1:	8d 42 30             	lea    0x30(%edx),%eax
+    32a4:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    32a7:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    32ad:	89 d9                	mov    %ebx,%ecx
+    32af:	29 d1                	sub    %edx,%ecx
+    32b1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    32b6:	f7 e9                	imul   %ecx
+    32b8:	c1 fa 05             	sar    $0x5,%edx
+    32bb:	c1 f9 1f             	sar    $0x1f,%ecx
+    32be:	29 ca                	sub    %ecx,%edx
+    32c0:	83 c2 30             	add    $0x30,%edx
+    32c3:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    32c6:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    32cb:	f7 eb                	imul   %ebx
+    32cd:	c1 fa 05             	sar    $0x5,%edx
+    32d0:	29 f2                	sub    %esi,%edx
+    32d2:	6b d2 64             	imul   $0x64,%edx,%edx
+    32d5:	89 df                	mov    %ebx,%edi
+    32d7:	29 d7                	sub    %edx,%edi
+    32d9:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    32de:	89 f8                	mov    %edi,%eax
+    32e0:	f7 e9                	imul   %ecx
+    32e2:	c1 fa 02             	sar    $0x2,%edx
+    32e5:	c1 ff 1f             	sar    $0x1f,%edi
+    32e8:	29 fa                	sub    %edi,%edx
+    32ea:	83 c2 30             	add    $0x30,%edx
+    32ed:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    32f0:	89 d8                	mov    %ebx,%eax
+    32f2:	f7 e9                	imul   %ecx
+    32f4:	c1 fa 02             	sar    $0x2,%edx
+    32f7:	29 f2                	sub    %esi,%edx
+    32f9:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    32fc:	01 d2                	add    %edx,%edx
+    32fe:	89 d8                	mov    %ebx,%eax
+    3300:	29 d0                	sub    %edx,%eax
+    3302:	83 c0 30             	add    $0x30,%eax
+    3305:	88 45 ac             	mov    %al,-0x54(%ebp)
+    name[5] = '\0';
+    3308:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    330c:	83 ec 0c             	sub    $0xc,%esp
+    330f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3312:	50                   	push   %eax
+    3313:	e8 31 05 00 00       	call   3849 <unlink>
+    nfiles--;
+    3318:	83 eb 01             	sub    $0x1,%ebx
+  while(nfiles >= 0){
+    331b:	83 c4 10             	add    $0x10,%esp
+    331e:	83 fb ff             	cmp    $0xffffffff,%ebx
+    3321:	0f 85 65 ff ff ff    	jne    328c <fsfull+0xe9>
+  }
+
+  printf(1, "fsfull test finished\n");
+    3327:	83 ec 08             	sub    $0x8,%esp
+    332a:	68 64 4c 00 00       	push   $0x4c64
+    332f:	6a 01                	push   $0x1
+    3331:	e8 9b 06 00 00       	call   39d1 <printf>
+}
+    3336:	83 c4 10             	add    $0x10,%esp
+    3339:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    333c:	5b                   	pop    %ebx
+    333d:	5e                   	pop    %esi
+    333e:	5f                   	pop    %edi
+    333f:	5d                   	pop    %ebp
+    3340:	c3                   	ret
+    int total = 0;
+    3341:	bf 00 00 00 00       	mov    $0x0,%edi
+      int cc = write(fd, buf, 512);
+    3346:	83 ec 04             	sub    $0x4,%esp
+    3349:	68 00 02 00 00       	push   $0x200
+    334e:	68 a0 84 00 00       	push   $0x84a0
+    3353:	56                   	push   %esi
+    3354:	e8 c0 04 00 00       	call   3819 <write>
+      if(cc < 512)
+    3359:	83 c4 10             	add    $0x10,%esp
+    335c:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3361:	7e 04                	jle    3367 <fsfull+0x1c4>
+      total += cc;
+    3363:	01 c7                	add    %eax,%edi
+    while(1){
+    3365:	eb df                	jmp    3346 <fsfull+0x1a3>
+    printf(1, "wrote %d bytes\n", total);
+    3367:	83 ec 04             	sub    $0x4,%esp
+    336a:	57                   	push   %edi
+    336b:	68 54 4c 00 00       	push   $0x4c54
+    3370:	6a 01                	push   $0x1
+    3372:	e8 5a 06 00 00       	call   39d1 <printf>
+    close(fd);
+    3377:	89 34 24             	mov    %esi,(%esp)
+    337a:	e8 a2 04 00 00       	call   3821 <close>
+    if(total == 0)
+    337f:	83 c4 10             	add    $0x10,%esp
+    3382:	85 ff                	test   %edi,%edi
+    3384:	0f 84 fa fe ff ff    	je     3284 <fsfull+0xe1>
+  for(nfiles = 0; ; nfiles++){
+    338a:	83 c3 01             	add    $0x1,%ebx
+    338d:	e9 2e fe ff ff       	jmp    31c0 <fsfull+0x1d>
+
+00003392 <uio>:
+
+void
+uio()
+{
+    3392:	55                   	push   %ebp
+    3393:	89 e5                	mov    %esp,%ebp
+    3395:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    3398:	68 7a 4c 00 00       	push   $0x4c7a
+    339d:	6a 01                	push   $0x1
+    339f:	e8 2d 06 00 00       	call   39d1 <printf>
+  pid = fork();
+    33a4:	e8 48 04 00 00       	call   37f1 <fork>
+  if(pid == 0){
+    33a9:	83 c4 10             	add    $0x10,%esp
+    33ac:	85 c0                	test   %eax,%eax
+    33ae:	74 1b                	je     33cb <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    33b0:	78 3e                	js     33f0 <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    33b2:	e8 4a 04 00 00       	call   3801 <wait>
+  printf(1, "uio test done\n");
+    33b7:	83 ec 08             	sub    $0x8,%esp
+    33ba:	68 84 4c 00 00       	push   $0x4c84
+    33bf:	6a 01                	push   $0x1
+    33c1:	e8 0b 06 00 00       	call   39d1 <printf>
+}
+    33c6:	83 c4 10             	add    $0x10,%esp
+    33c9:	c9                   	leave
+    33ca:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    33cb:	b8 09 00 00 00       	mov    $0x9,%eax
+    33d0:	ba 70 00 00 00       	mov    $0x70,%edx
+    33d5:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    33d6:	ba 71 00 00 00       	mov    $0x71,%edx
+    33db:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    33dc:	83 ec 08             	sub    $0x8,%esp
+    33df:	68 10 54 00 00       	push   $0x5410
+    33e4:	6a 01                	push   $0x1
+    33e6:	e8 e6 05 00 00       	call   39d1 <printf>
+    exit();
+    33eb:	e8 09 04 00 00       	call   37f9 <exit>
+    printf (1, "fork failed\n");
+    33f0:	83 ec 08             	sub    $0x8,%esp
+    33f3:	68 09 4c 00 00       	push   $0x4c09
+    33f8:	6a 01                	push   $0x1
+    33fa:	e8 d2 05 00 00       	call   39d1 <printf>
+    exit();
+    33ff:	e8 f5 03 00 00       	call   37f9 <exit>
+
+00003404 <argptest>:
+
+void argptest()
+{
+    3404:	55                   	push   %ebp
+    3405:	89 e5                	mov    %esp,%ebp
+    3407:	53                   	push   %ebx
+    3408:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    340b:	6a 00                	push   $0x0
+    340d:	68 93 4c 00 00       	push   $0x4c93
+    3412:	e8 22 04 00 00       	call   3839 <open>
+  if (fd < 0) {
+    3417:	83 c4 10             	add    $0x10,%esp
+    341a:	85 c0                	test   %eax,%eax
+    341c:	78 3a                	js     3458 <argptest+0x54>
+    341e:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    3420:	83 ec 0c             	sub    $0xc,%esp
+    3423:	6a 00                	push   $0x0
+    3425:	e8 57 04 00 00       	call   3881 <sbrk>
+    342a:	83 c4 0c             	add    $0xc,%esp
+    342d:	6a ff                	push   $0xffffffff
+    342f:	83 e8 01             	sub    $0x1,%eax
+    3432:	50                   	push   %eax
+    3433:	53                   	push   %ebx
+    3434:	e8 d8 03 00 00       	call   3811 <read>
+  close(fd);
+    3439:	89 1c 24             	mov    %ebx,(%esp)
+    343c:	e8 e0 03 00 00       	call   3821 <close>
+  printf(1, "arg test passed\n");
+    3441:	83 c4 08             	add    $0x8,%esp
+    3444:	68 a5 4c 00 00       	push   $0x4ca5
+    3449:	6a 01                	push   $0x1
+    344b:	e8 81 05 00 00       	call   39d1 <printf>
+}
+    3450:	83 c4 10             	add    $0x10,%esp
+    3453:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3456:	c9                   	leave
+    3457:	c3                   	ret
+    printf(2, "open failed\n");
+    3458:	83 ec 08             	sub    $0x8,%esp
+    345b:	68 98 4c 00 00       	push   $0x4c98
+    3460:	6a 02                	push   $0x2
+    3462:	e8 6a 05 00 00       	call   39d1 <printf>
+    exit();
+    3467:	e8 8d 03 00 00       	call   37f9 <exit>
+
+0000346c <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    346c:	69 05 60 5d 00 00 0d 	imul   $0x19660d,0x5d60,%eax
+    3473:	66 19 00 
+    3476:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    347b:	a3 60 5d 00 00       	mov    %eax,0x5d60
+  return randstate;
+}
+    3480:	c3                   	ret
+
+00003481 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    3481:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    3485:	83 e4 f0             	and    $0xfffffff0,%esp
+    3488:	ff 71 fc             	push   -0x4(%ecx)
+    348b:	55                   	push   %ebp
+    348c:	89 e5                	mov    %esp,%ebp
+    348e:	51                   	push   %ecx
+    348f:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    3492:	68 b6 4c 00 00       	push   $0x4cb6
+    3497:	6a 01                	push   $0x1
+    3499:	e8 33 05 00 00       	call   39d1 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    349e:	83 c4 08             	add    $0x8,%esp
+    34a1:	6a 00                	push   $0x0
+    34a3:	68 ca 4c 00 00       	push   $0x4cca
+    34a8:	e8 8c 03 00 00       	call   3839 <open>
+    34ad:	83 c4 10             	add    $0x10,%esp
+    34b0:	85 c0                	test   %eax,%eax
+    34b2:	78 14                	js     34c8 <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    34b4:	83 ec 08             	sub    $0x8,%esp
+    34b7:	68 34 54 00 00       	push   $0x5434
+    34bc:	6a 01                	push   $0x1
+    34be:	e8 0e 05 00 00       	call   39d1 <printf>
+    exit();
+    34c3:	e8 31 03 00 00       	call   37f9 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    34c8:	83 ec 08             	sub    $0x8,%esp
+    34cb:	68 00 02 00 00       	push   $0x200
+    34d0:	68 ca 4c 00 00       	push   $0x4cca
+    34d5:	e8 5f 03 00 00       	call   3839 <open>
+    34da:	89 04 24             	mov    %eax,(%esp)
+    34dd:	e8 3f 03 00 00       	call   3821 <close>
+
+  argptest();
+    34e2:	e8 1d ff ff ff       	call   3404 <argptest>
+  createdelete();
+    34e7:	e8 0d db ff ff       	call   ff9 <createdelete>
+  linkunlink();
+    34ec:	e8 b7 e3 ff ff       	call   18a8 <linkunlink>
+  concreate();
+    34f1:	e8 b7 e0 ff ff       	call   15ad <concreate>
+  fourfiles();
+    34f6:	e8 28 d9 ff ff       	call   e23 <fourfiles>
+  sharedfd();
+    34fb:	e8 8f d7 ff ff       	call   c8f <sharedfd>
+
+  bigargtest();
+    3500:	e8 9f fb ff ff       	call   30a4 <bigargtest>
+  bigwrite();
+    3505:	e8 18 ed ff ff       	call   2222 <bigwrite>
+  bigargtest();
+    350a:	e8 95 fb ff ff       	call   30a4 <bigargtest>
+  bsstest();
+    350f:	e8 2f fb ff ff       	call   3043 <bsstest>
+  sbrktest();
+    3514:	e8 57 f6 ff ff       	call   2b70 <sbrktest>
+  validatetest();
+    3519:	e8 79 fa ff ff       	call   2f97 <validatetest>
+
+  opentest();
+    351e:	e8 89 cd ff ff       	call   2ac <opentest>
+  writetest();
+    3523:	e8 17 ce ff ff       	call   33f <writetest>
+  writetest1();
+    3528:	e8 f0 cf ff ff       	call   51d <writetest1>
+  createtest();
+    352d:	e8 a5 d1 ff ff       	call   6d7 <createtest>
+
+  openiputtest();
+    3532:	e8 8c cc ff ff       	call   1c3 <openiputtest>
+  exitiputtest();
+    3537:	e8 a1 cb ff ff       	call   dd <exitiputtest>
+  iputtest();
+    353c:	e8 bf ca ff ff       	call   0 <iputtest>
+
+  mem();
+    3541:	e8 94 d6 ff ff       	call   bda <mem>
+  pipe1();
+    3546:	e8 56 d3 ff ff       	call   8a1 <pipe1>
+  preempt();
+    354b:	e8 e4 d4 ff ff       	call   a34 <preempt>
+  exitwait();
+    3550:	e8 1a d6 ff ff       	call   b6f <exitwait>
+
+  rmdot();
+    3555:	e8 a8 f0 ff ff       	call   2602 <rmdot>
+  fourteen();
+    355a:	e8 66 ef ff ff       	call   24c5 <fourteen>
+  bigfile();
+    355f:	e8 99 ed ff ff       	call   22fd <bigfile>
+  subdir();
+    3564:	e8 8b e5 ff ff       	call   1af4 <subdir>
+  linktest();
+    3569:	e8 19 de ff ff       	call   1387 <linktest>
+  unlinkread();
+    356e:	e8 7b dc ff ff       	call   11ee <unlinkread>
+  dirfile();
+    3573:	e8 0f f2 ff ff       	call   2787 <dirfile>
+  iref();
+    3578:	e8 24 f4 ff ff       	call   29a1 <iref>
+  forktest();
+    357d:	e8 41 f5 ff ff       	call   2ac3 <forktest>
+  bigdir(); // slow
+    3582:	e8 13 e4 ff ff       	call   199a <bigdir>
+
+  uio();
+    3587:	e8 06 fe ff ff       	call   3392 <uio>
+
+  exectest();
+    358c:	e8 c7 d2 ff ff       	call   858 <exectest>
+
+  exit();
+    3591:	e8 63 02 00 00       	call   37f9 <exit>
+
+00003596 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    3596:	55                   	push   %ebp
+    3597:	89 e5                	mov    %esp,%ebp
+    3599:	53                   	push   %ebx
+    359a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    359d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    35a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    35a5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    35a9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    35ac:	83 c0 01             	add    $0x1,%eax
+    35af:	84 d2                	test   %dl,%dl
+    35b1:	75 f2                	jne    35a5 <strcpy+0xf>
+    ;
+  return os;
+}
+    35b3:	89 c8                	mov    %ecx,%eax
+    35b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    35b8:	c9                   	leave
+    35b9:	c3                   	ret
+
+000035ba <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    35ba:	55                   	push   %ebp
+    35bb:	89 e5                	mov    %esp,%ebp
+    35bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    35c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    35c3:	0f b6 01             	movzbl (%ecx),%eax
+    35c6:	84 c0                	test   %al,%al
+    35c8:	74 11                	je     35db <strcmp+0x21>
+    35ca:	38 02                	cmp    %al,(%edx)
+    35cc:	75 0d                	jne    35db <strcmp+0x21>
+    p++, q++;
+    35ce:	83 c1 01             	add    $0x1,%ecx
+    35d1:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    35d4:	0f b6 01             	movzbl (%ecx),%eax
+    35d7:	84 c0                	test   %al,%al
+    35d9:	75 ef                	jne    35ca <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+    35db:	0f b6 c0             	movzbl %al,%eax
+    35de:	0f b6 12             	movzbl (%edx),%edx
+    35e1:	29 d0                	sub    %edx,%eax
+}
+    35e3:	5d                   	pop    %ebp
+    35e4:	c3                   	ret
+
+000035e5 <strlen>:
+
+uint
+strlen(char *s)
+{
+    35e5:	55                   	push   %ebp
+    35e6:	89 e5                	mov    %esp,%ebp
+    35e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    35eb:	80 3a 00             	cmpb   $0x0,(%edx)
+    35ee:	74 14                	je     3604 <strlen+0x1f>
+    35f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    35f5:	83 c0 01             	add    $0x1,%eax
+    35f8:	89 c1                	mov    %eax,%ecx
+    35fa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    35fe:	75 f5                	jne    35f5 <strlen+0x10>
+    ;
+  return n;
+}
+    3600:	89 c8                	mov    %ecx,%eax
+    3602:	5d                   	pop    %ebp
+    3603:	c3                   	ret
+  for(n = 0; s[n]; n++)
+    3604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+    3609:	eb f5                	jmp    3600 <strlen+0x1b>
+
+0000360b <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    360b:	55                   	push   %ebp
+    360c:	89 e5                	mov    %esp,%ebp
+    360e:	57                   	push   %edi
+    360f:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3612:	89 d7                	mov    %edx,%edi
+    3614:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3617:	8b 45 0c             	mov    0xc(%ebp),%eax
+    361a:	fc                   	cld
+    361b:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    361d:	89 d0                	mov    %edx,%eax
+    361f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3622:	c9                   	leave
+    3623:	c3                   	ret
+
+00003624 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3624:	55                   	push   %ebp
+    3625:	89 e5                	mov    %esp,%ebp
+    3627:	8b 45 08             	mov    0x8(%ebp),%eax
+    362a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    362e:	0f b6 10             	movzbl (%eax),%edx
+    3631:	84 d2                	test   %dl,%dl
+    3633:	74 15                	je     364a <strchr+0x26>
+    if(*s == c)
+    3635:	38 d1                	cmp    %dl,%cl
+    3637:	74 0f                	je     3648 <strchr+0x24>
+  for(; *s; s++)
+    3639:	83 c0 01             	add    $0x1,%eax
+    363c:	0f b6 10             	movzbl (%eax),%edx
+    363f:	84 d2                	test   %dl,%dl
+    3641:	75 f2                	jne    3635 <strchr+0x11>
+      return (char*)s;
+  return 0;
+    3643:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    3648:	5d                   	pop    %ebp
+    3649:	c3                   	ret
+  return 0;
+    364a:	b8 00 00 00 00       	mov    $0x0,%eax
+    364f:	eb f7                	jmp    3648 <strchr+0x24>
+
+00003651 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3651:	55                   	push   %ebp
+    3652:	89 e5                	mov    %esp,%ebp
+    3654:	57                   	push   %edi
+    3655:	56                   	push   %esi
+    3656:	53                   	push   %ebx
+    3657:	83 ec 2c             	sub    $0x2c,%esp
+    365a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    365d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+    3662:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+    3665:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    3668:	83 c3 01             	add    $0x1,%ebx
+    366b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    366e:	7d 27                	jge    3697 <gets+0x46>
+    cc = read(0, &c, 1);
+    3670:	83 ec 04             	sub    $0x4,%esp
+    3673:	6a 01                	push   $0x1
+    3675:	57                   	push   %edi
+    3676:	6a 00                	push   $0x0
+    3678:	e8 94 01 00 00       	call   3811 <read>
+    if(cc < 1)
+    367d:	83 c4 10             	add    $0x10,%esp
+    3680:	85 c0                	test   %eax,%eax
+    3682:	7e 13                	jle    3697 <gets+0x46>
+      break;
+    buf[i++] = c;
+    3684:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3688:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+    368c:	3c 0a                	cmp    $0xa,%al
+    368e:	74 04                	je     3694 <gets+0x43>
+    3690:	3c 0d                	cmp    $0xd,%al
+    3692:	75 d1                	jne    3665 <gets+0x14>
+  for(i=0; i+1 < max; ){
+    3694:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+    3697:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    369a:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+    369e:	89 f0                	mov    %esi,%eax
+    36a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    36a3:	5b                   	pop    %ebx
+    36a4:	5e                   	pop    %esi
+    36a5:	5f                   	pop    %edi
+    36a6:	5d                   	pop    %ebp
+    36a7:	c3                   	ret
+
+000036a8 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    36a8:	55                   	push   %ebp
+    36a9:	89 e5                	mov    %esp,%ebp
+    36ab:	56                   	push   %esi
+    36ac:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    36ad:	83 ec 08             	sub    $0x8,%esp
+    36b0:	6a 00                	push   $0x0
+    36b2:	ff 75 08             	push   0x8(%ebp)
+    36b5:	e8 7f 01 00 00       	call   3839 <open>
+  if(fd < 0)
+    36ba:	83 c4 10             	add    $0x10,%esp
+    36bd:	85 c0                	test   %eax,%eax
+    36bf:	78 24                	js     36e5 <stat+0x3d>
+    36c1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    36c3:	83 ec 08             	sub    $0x8,%esp
+    36c6:	ff 75 0c             	push   0xc(%ebp)
+    36c9:	50                   	push   %eax
+    36ca:	e8 82 01 00 00       	call   3851 <fstat>
+    36cf:	89 c6                	mov    %eax,%esi
+  close(fd);
+    36d1:	89 1c 24             	mov    %ebx,(%esp)
+    36d4:	e8 48 01 00 00       	call   3821 <close>
+  return r;
+    36d9:	83 c4 10             	add    $0x10,%esp
+}
+    36dc:	89 f0                	mov    %esi,%eax
+    36de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    36e1:	5b                   	pop    %ebx
+    36e2:	5e                   	pop    %esi
+    36e3:	5d                   	pop    %ebp
+    36e4:	c3                   	ret
+    return -1;
+    36e5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    36ea:	eb f0                	jmp    36dc <stat+0x34>
+
+000036ec <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+    36ec:	55                   	push   %ebp
+    36ed:	89 e5                	mov    %esp,%ebp
+    36ef:	56                   	push   %esi
+    36f0:	53                   	push   %ebx
+    36f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    36f4:	0f b6 0a             	movzbl (%edx),%ecx
+    36f7:	80 f9 20             	cmp    $0x20,%cl
+    36fa:	75 0b                	jne    3707 <atoi+0x1b>
+    36fc:	83 c2 01             	add    $0x1,%edx
+    36ff:	0f b6 0a             	movzbl (%edx),%ecx
+    3702:	80 f9 20             	cmp    $0x20,%cl
+    3705:	74 f5                	je     36fc <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    3707:	80 f9 2d             	cmp    $0x2d,%cl
+    370a:	74 3c                	je     3748 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+    370c:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+    370f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    3714:	f6 c1 fd             	test   $0xfd,%cl
+    3717:	74 34                	je     374d <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+    3719:	0f b6 0a             	movzbl (%edx),%ecx
+    371c:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    371f:	3c 09                	cmp    $0x9,%al
+    3721:	77 2f                	ja     3752 <atoi+0x66>
+    3723:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+    3728:	83 c2 01             	add    $0x1,%edx
+    372b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+    372e:	0f be c9             	movsbl %cl,%ecx
+    3731:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+    3735:	0f b6 0a             	movzbl (%edx),%ecx
+    3738:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    373b:	3c 09                	cmp    $0x9,%al
+    373d:	76 e9                	jbe    3728 <atoi+0x3c>
+  return sign*n;
+    373f:	89 f0                	mov    %esi,%eax
+    3741:	0f af c3             	imul   %ebx,%eax
+}
+    3744:	5b                   	pop    %ebx
+    3745:	5e                   	pop    %esi
+    3746:	5d                   	pop    %ebp
+    3747:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+    3748:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    374d:	83 c2 01             	add    $0x1,%edx
+    3750:	eb c7                	jmp    3719 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+    3752:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3757:	eb e6                	jmp    373f <atoi+0x53>
+
+00003759 <atoo>:
+
+int
+atoo(const char *s)
+{
+    3759:	55                   	push   %ebp
+    375a:	89 e5                	mov    %esp,%ebp
+    375c:	56                   	push   %esi
+    375d:	53                   	push   %ebx
+    375e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    3761:	0f b6 0a             	movzbl (%edx),%ecx
+    3764:	80 f9 20             	cmp    $0x20,%cl
+    3767:	75 0b                	jne    3774 <atoo+0x1b>
+    3769:	83 c2 01             	add    $0x1,%edx
+    376c:	0f b6 0a             	movzbl (%edx),%ecx
+    376f:	80 f9 20             	cmp    $0x20,%cl
+    3772:	74 f5                	je     3769 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    3774:	80 f9 2d             	cmp    $0x2d,%cl
+    3777:	74 3a                	je     37b3 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+    3779:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+    377c:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    3781:	f6 c1 fd             	test   $0xfd,%cl
+    3784:	74 32                	je     37b8 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+    3786:	0f b6 0a             	movzbl (%edx),%ecx
+    3789:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    378c:	80 fb 07             	cmp    $0x7,%bl
+    378f:	77 2c                	ja     37bd <atoo+0x64>
+    3791:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+    3796:	83 c2 01             	add    $0x1,%edx
+    3799:	0f be c9             	movsbl %cl,%ecx
+    379c:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+    37a0:	0f b6 0a             	movzbl (%edx),%ecx
+    37a3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    37a6:	3c 07                	cmp    $0x7,%al
+    37a8:	76 ec                	jbe    3796 <atoo+0x3d>
+  return sign*n;
+    37aa:	89 f0                	mov    %esi,%eax
+    37ac:	0f af c3             	imul   %ebx,%eax
+}
+    37af:	5b                   	pop    %ebx
+    37b0:	5e                   	pop    %esi
+    37b1:	5d                   	pop    %ebp
+    37b2:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+    37b3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    37b8:	83 c2 01             	add    $0x1,%edx
+    37bb:	eb c9                	jmp    3786 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+    37bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    37c2:	eb e6                	jmp    37aa <atoo+0x51>
+
+000037c4 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    37c4:	55                   	push   %ebp
+    37c5:	89 e5                	mov    %esp,%ebp
+    37c7:	56                   	push   %esi
+    37c8:	53                   	push   %ebx
+    37c9:	8b 75 08             	mov    0x8(%ebp),%esi
+    37cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    37cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    37d2:	85 db                	test   %ebx,%ebx
+    37d4:	7e 15                	jle    37eb <memmove+0x27>
+    37d6:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+    37d8:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+    37da:	83 c2 01             	add    $0x1,%edx
+    37dd:	83 c0 01             	add    $0x1,%eax
+    37e0:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+    37e4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+    37e7:	39 c3                	cmp    %eax,%ebx
+    37e9:	75 ef                	jne    37da <memmove+0x16>
+  return vdst;
+}
+    37eb:	89 f0                	mov    %esi,%eax
+    37ed:	5b                   	pop    %ebx
+    37ee:	5e                   	pop    %esi
+    37ef:	5d                   	pop    %ebp
+    37f0:	c3                   	ret
+
+000037f1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    37f1:	b8 01 00 00 00       	mov    $0x1,%eax
+    37f6:	cd 40                	int    $0x40
+    37f8:	c3                   	ret
+
+000037f9 <exit>:
+SYSCALL(exit)
+    37f9:	b8 02 00 00 00       	mov    $0x2,%eax
+    37fe:	cd 40                	int    $0x40
+    3800:	c3                   	ret
+
+00003801 <wait>:
+SYSCALL(wait)
+    3801:	b8 03 00 00 00       	mov    $0x3,%eax
+    3806:	cd 40                	int    $0x40
+    3808:	c3                   	ret
+
+00003809 <pipe>:
+SYSCALL(pipe)
+    3809:	b8 04 00 00 00       	mov    $0x4,%eax
+    380e:	cd 40                	int    $0x40
+    3810:	c3                   	ret
+
+00003811 <read>:
+SYSCALL(read)
+    3811:	b8 05 00 00 00       	mov    $0x5,%eax
+    3816:	cd 40                	int    $0x40
+    3818:	c3                   	ret
+
+00003819 <write>:
+SYSCALL(write)
+    3819:	b8 10 00 00 00       	mov    $0x10,%eax
+    381e:	cd 40                	int    $0x40
+    3820:	c3                   	ret
+
+00003821 <close>:
+SYSCALL(close)
+    3821:	b8 15 00 00 00       	mov    $0x15,%eax
+    3826:	cd 40                	int    $0x40
+    3828:	c3                   	ret
+
+00003829 <kill>:
+SYSCALL(kill)
+    3829:	b8 06 00 00 00       	mov    $0x6,%eax
+    382e:	cd 40                	int    $0x40
+    3830:	c3                   	ret
+
+00003831 <exec>:
+SYSCALL(exec)
+    3831:	b8 07 00 00 00       	mov    $0x7,%eax
+    3836:	cd 40                	int    $0x40
+    3838:	c3                   	ret
+
+00003839 <open>:
+SYSCALL(open)
+    3839:	b8 0f 00 00 00       	mov    $0xf,%eax
+    383e:	cd 40                	int    $0x40
+    3840:	c3                   	ret
+
+00003841 <mknod>:
+SYSCALL(mknod)
+    3841:	b8 11 00 00 00       	mov    $0x11,%eax
+    3846:	cd 40                	int    $0x40
+    3848:	c3                   	ret
+
+00003849 <unlink>:
+SYSCALL(unlink)
+    3849:	b8 12 00 00 00       	mov    $0x12,%eax
+    384e:	cd 40                	int    $0x40
+    3850:	c3                   	ret
+
+00003851 <fstat>:
+SYSCALL(fstat)
+    3851:	b8 08 00 00 00       	mov    $0x8,%eax
+    3856:	cd 40                	int    $0x40
+    3858:	c3                   	ret
+
+00003859 <link>:
+SYSCALL(link)
+    3859:	b8 13 00 00 00       	mov    $0x13,%eax
+    385e:	cd 40                	int    $0x40
+    3860:	c3                   	ret
+
+00003861 <mkdir>:
+SYSCALL(mkdir)
+    3861:	b8 14 00 00 00       	mov    $0x14,%eax
+    3866:	cd 40                	int    $0x40
+    3868:	c3                   	ret
+
+00003869 <chdir>:
+SYSCALL(chdir)
+    3869:	b8 09 00 00 00       	mov    $0x9,%eax
+    386e:	cd 40                	int    $0x40
+    3870:	c3                   	ret
+
+00003871 <dup>:
+SYSCALL(dup)
+    3871:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3876:	cd 40                	int    $0x40
+    3878:	c3                   	ret
+
+00003879 <getpid>:
+SYSCALL(getpid)
+    3879:	b8 0b 00 00 00       	mov    $0xb,%eax
+    387e:	cd 40                	int    $0x40
+    3880:	c3                   	ret
+
+00003881 <sbrk>:
+SYSCALL(sbrk)
+    3881:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3886:	cd 40                	int    $0x40
+    3888:	c3                   	ret
+
+00003889 <sleep>:
+SYSCALL(sleep)
+    3889:	b8 0d 00 00 00       	mov    $0xd,%eax
+    388e:	cd 40                	int    $0x40
+    3890:	c3                   	ret
+
+00003891 <uptime>:
+SYSCALL(uptime)
+    3891:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3896:	cd 40                	int    $0x40
+    3898:	c3                   	ret
+
+00003899 <halt>:
+SYSCALL(halt)
+    3899:	b8 16 00 00 00       	mov    $0x16,%eax
+    389e:	cd 40                	int    $0x40
+    38a0:	c3                   	ret
+
+000038a1 <date>:
+SYSCALL(date)
+    38a1:	b8 17 00 00 00       	mov    $0x17,%eax
+    38a6:	cd 40                	int    $0x40
+    38a8:	c3                   	ret
+
+000038a9 <getuid>:
+SYSCALL(getuid)
+    38a9:	b8 18 00 00 00       	mov    $0x18,%eax
+    38ae:	cd 40                	int    $0x40
+    38b0:	c3                   	ret
+
+000038b1 <getgid>:
+SYSCALL(getgid)
+    38b1:	b8 19 00 00 00       	mov    $0x19,%eax
+    38b6:	cd 40                	int    $0x40
+    38b8:	c3                   	ret
+
+000038b9 <getppid>:
+SYSCALL(getppid)
+    38b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    38be:	cd 40                	int    $0x40
+    38c0:	c3                   	ret
+
+000038c1 <setuid>:
+SYSCALL(setuid)
+    38c1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    38c6:	cd 40                	int    $0x40
+    38c8:	c3                   	ret
+
+000038c9 <setgid>:
+SYSCALL(setgid)
+    38c9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    38ce:	cd 40                	int    $0x40
+    38d0:	c3                   	ret
+
+000038d1 <getprocs>:
+SYSCALL(getprocs)
+    38d1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    38d6:	cd 40                	int    $0x40
+    38d8:	c3                   	ret
+
+000038d9 <setpriority>:
+SYSCALL(setpriority)
+    38d9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    38de:	cd 40                	int    $0x40
+    38e0:	c3                   	ret
+
+000038e1 <getpriority>:
+SYSCALL(getpriority)
+    38e1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    38e6:	cd 40                	int    $0x40
+    38e8:	c3                   	ret
+
+000038e9 <waitpid>:
+SYSCALL(waitpid)
+    38e9:	b8 20 00 00 00       	mov    $0x20,%eax
+    38ee:	cd 40                	int    $0x40
+    38f0:	c3                   	ret
+
+000038f1 <setaffinity>:
+SYSCALL(setaffinity)
+    38f1:	b8 21 00 00 00       	mov    $0x21,%eax
+    38f6:	cd 40                	int    $0x40
+    38f8:	c3                   	ret
+
+000038f9 <getaffinity>:
+SYSCALL(getaffinity)
+    38f9:	b8 22 00 00 00       	mov    $0x22,%eax
+    38fe:	cd 40                	int    $0x40
+    3900:	c3                   	ret
+
+00003901 <setdeadline>:
+SYSCALL(setdeadline)
+    3901:	b8 23 00 00 00       	mov    $0x23,%eax
+    3906:	cd 40                	int    $0x40
+    3908:	c3                   	ret
+
+00003909 <schedctl>:
+SYSCALL(schedctl)
+    3909:	b8 24 00 00 00       	mov    $0x24,%eax
+    390e:	cd 40                	int    $0x40
+    3910:	c3                   	ret
+
+00003911 <spawn>:
+SYSCALL(spawn)
+    3911:	b8 25 00 00 00       	mov    $0x25,%eax
+    3916:	cd 40                	int    $0x40
+    3918:	c3                   	ret
+
+00003919 <vmstats>:
+SYSCALL(vmstats)
+    3919:	b8 26 00 00 00       	mov    $0x26,%eax
+    391e:	cd 40                	int    $0x40
+    3920:	c3                   	ret
+
+00003921 <hugesbrk>:
+SYSCALL(hugesbrk)
+    3921:	b8 27 00 00 00       	mov    $0x27,%eax
+    3926:	cd 40                	int    $0x40
+    3928:	c3                   	ret
+
+00003929 <setshares>:
+SYSCALL(setshares)
+    3929:	b8 28 00 00 00       	mov    $0x28,%eax
+    392e:	cd 40                	int    $0x40
+    3930:	c3                   	ret
+
+00003931 <getshares>:
+SYSCALL(getshares)
+    3931:	b8 29 00 00 00       	mov    $0x29,%eax
+    3936:	cd 40                	int    $0x40
+    3938:	c3                   	ret
+
+00003939 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3939:	55                   	push   %ebp
+    393a:	89 e5                	mov    %esp,%ebp
+    393c:	57                   	push   %edi
+    393d:	56                   	push   %esi
+    393e:	53                   	push   %ebx
+    393f:	83 ec 3c             	sub    $0x3c,%esp
+    3942:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3945:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    3947:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    394b:	74 79                	je     39c6 <printint+0x8d>
+    394d:	85 d2                	test   %edx,%edx
+    394f:	79 75                	jns    39c6 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+    3951:	89 d1                	mov    %edx,%ecx
+    3953:	f7 d9                	neg    %ecx
+    neg = 1;
+    3955:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    395c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    3961:	89 df                	mov    %ebx,%edi
+    3963:	83 c3 01             	add    $0x1,%ebx
+    3966:	89 c8                	mov    %ecx,%eax
+    3968:	ba 00 00 00 00       	mov    $0x0,%edx
+    396d:	f7 f6                	div    %esi
+    396f:	0f b6 92 c0 54 00 00 	movzbl 0x54c0(%edx),%edx
+    3976:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+    397a:	89 ca                	mov    %ecx,%edx
+    397c:	89 c1                	mov    %eax,%ecx
+    397e:	39 f2                	cmp    %esi,%edx
+    3980:	73 df                	jae    3961 <printint+0x28>
+  if(neg)
+    3982:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+    3986:	74 08                	je     3990 <printint+0x57>
+    buf[i++] = '-';
+    3988:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    398d:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+    3990:	85 db                	test   %ebx,%ebx
+    3992:	7e 2a                	jle    39be <printint+0x85>
+    3994:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    3997:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+    399b:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+    399e:	0f b6 03             	movzbl (%ebx),%eax
+    39a1:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    39a4:	83 ec 04             	sub    $0x4,%esp
+    39a7:	6a 01                	push   $0x1
+    39a9:	57                   	push   %edi
+    39aa:	ff 75 c4             	push   -0x3c(%ebp)
+    39ad:	e8 67 fe ff ff       	call   3819 <write>
+  while(--i >= 0)
+    39b2:	89 d8                	mov    %ebx,%eax
+    39b4:	83 eb 01             	sub    $0x1,%ebx
+    39b7:	83 c4 10             	add    $0x10,%esp
+    39ba:	39 f0                	cmp    %esi,%eax
+    39bc:	75 e0                	jne    399e <printint+0x65>
+}
+    39be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    39c1:	5b                   	pop    %ebx
+    39c2:	5e                   	pop    %esi
+    39c3:	5f                   	pop    %edi
+    39c4:	5d                   	pop    %ebp
+    39c5:	c3                   	ret
+    x = xx;
+    39c6:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+    39c8:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+    39cf:	eb 8b                	jmp    395c <printint+0x23>
+
+000039d1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    39d1:	55                   	push   %ebp
+    39d2:	89 e5                	mov    %esp,%ebp
+    39d4:	57                   	push   %edi
+    39d5:	56                   	push   %esi
+    39d6:	53                   	push   %ebx
+    39d7:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    39da:	8b 75 0c             	mov    0xc(%ebp),%esi
+    39dd:	0f b6 1e             	movzbl (%esi),%ebx
+    39e0:	84 db                	test   %bl,%bl
+    39e2:	0f 84 9e 01 00 00    	je     3b86 <printf+0x1b5>
+    39e8:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    39eb:	8d 45 10             	lea    0x10(%ebp),%eax
+    39ee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+    39f1:	bf 00 00 00 00       	mov    $0x0,%edi
+    39f6:	eb 2d                	jmp    3a25 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    39f8:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    39fb:	83 ec 04             	sub    $0x4,%esp
+    39fe:	6a 01                	push   $0x1
+    3a00:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3a03:	50                   	push   %eax
+    3a04:	ff 75 08             	push   0x8(%ebp)
+    3a07:	e8 0d fe ff ff       	call   3819 <write>
+        putc(fd, c);
+    3a0c:	83 c4 10             	add    $0x10,%esp
+    3a0f:	eb 05                	jmp    3a16 <printf+0x45>
+      }
+    } else if(state == '%'){
+    3a11:	83 ff 25             	cmp    $0x25,%edi
+    3a14:	74 1f                	je     3a35 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+    3a16:	83 c6 01             	add    $0x1,%esi
+    3a19:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+    3a1d:	84 db                	test   %bl,%bl
+    3a1f:	0f 84 61 01 00 00    	je     3b86 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+    3a25:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3a28:	85 ff                	test   %edi,%edi
+    3a2a:	75 e5                	jne    3a11 <printf+0x40>
+      if(c == '%'){
+    3a2c:	83 f8 25             	cmp    $0x25,%eax
+    3a2f:	75 c7                	jne    39f8 <printf+0x27>
+        state = '%';
+    3a31:	89 c7                	mov    %eax,%edi
+    3a33:	eb e1                	jmp    3a16 <printf+0x45>
+      if(c == 'd'){
+    3a35:	83 f8 25             	cmp    $0x25,%eax
+    3a38:	0f 84 f4 00 00 00    	je     3b32 <printf+0x161>
+    3a3e:	8d 50 9d             	lea    -0x63(%eax),%edx
+    3a41:	83 fa 15             	cmp    $0x15,%edx
+    3a44:	0f 87 09 01 00 00    	ja     3b53 <printf+0x182>
+    3a4a:	0f 87 03 01 00 00    	ja     3b53 <printf+0x182>
+    3a50:	ff 24 95 68 54 00 00 	jmp    *0x5468(,%edx,4)
+        printint(fd, *ap, 10, 1);
+    3a57:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    3a5a:	8b 17                	mov    (%edi),%edx
+    3a5c:	83 ec 0c             	sub    $0xc,%esp
+    3a5f:	6a 01                	push   $0x1
+    3a61:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3a66:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a69:	e8 cb fe ff ff       	call   3939 <printint>
+        ap++;
+    3a6e:	83 c7 04             	add    $0x4,%edi
+    3a71:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3a74:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    3a77:	bf 00 00 00 00       	mov    $0x0,%edi
+    3a7c:	eb 98                	jmp    3a16 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+    3a7e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    3a81:	8b 17                	mov    (%edi),%edx
+    3a83:	83 ec 0c             	sub    $0xc,%esp
+    3a86:	6a 00                	push   $0x0
+    3a88:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a90:	e8 a4 fe ff ff       	call   3939 <printint>
+        ap++;
+    3a95:	83 c7 04             	add    $0x4,%edi
+    3a98:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3a9b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3a9e:	bf 00 00 00 00       	mov    $0x0,%edi
+    3aa3:	e9 6e ff ff ff       	jmp    3a16 <printf+0x45>
+        s = (char*)*ap;
+    3aa8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    3aab:	8b 01                	mov    (%ecx),%eax
+        ap++;
+    3aad:	83 c1 04             	add    $0x4,%ecx
+    3ab0:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+    3ab3:	85 c0                	test   %eax,%eax
+    3ab5:	74 13                	je     3aca <printf+0xf9>
+        s = (char*)*ap;
+    3ab7:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+    3ab9:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+    3abc:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+    3ac1:	84 c0                	test   %al,%al
+    3ac3:	75 0f                	jne    3ad4 <printf+0x103>
+    3ac5:	e9 4c ff ff ff       	jmp    3a16 <printf+0x45>
+          s = "(null)";
+    3aca:	bb 5e 54 00 00       	mov    $0x545e,%ebx
+        while(*s != 0){
+    3acf:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+    3ad4:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    3ad7:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    3ada:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+    3add:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3ae0:	83 ec 04             	sub    $0x4,%esp
+    3ae3:	6a 01                	push   $0x1
+    3ae5:	57                   	push   %edi
+    3ae6:	56                   	push   %esi
+    3ae7:	e8 2d fd ff ff       	call   3819 <write>
+          s++;
+    3aec:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    3aef:	0f b6 03             	movzbl (%ebx),%eax
+    3af2:	83 c4 10             	add    $0x10,%esp
+    3af5:	84 c0                	test   %al,%al
+    3af7:	75 e4                	jne    3add <printf+0x10c>
+      state = 0;
+    3af9:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    3afc:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b01:	e9 10 ff ff ff       	jmp    3a16 <printf+0x45>
+        putc(fd, *ap);
+    3b06:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    3b09:	8b 07                	mov    (%edi),%eax
+    3b0b:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b0e:	83 ec 04             	sub    $0x4,%esp
+    3b11:	6a 01                	push   $0x1
+    3b13:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3b16:	50                   	push   %eax
+    3b17:	ff 75 08             	push   0x8(%ebp)
+    3b1a:	e8 fa fc ff ff       	call   3819 <write>
+        ap++;
+    3b1f:	83 c7 04             	add    $0x4,%edi
+    3b22:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3b25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3b28:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b2d:	e9 e4 fe ff ff       	jmp    3a16 <printf+0x45>
+        putc(fd, c);
+    3b32:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b35:	83 ec 04             	sub    $0x4,%esp
+    3b38:	6a 01                	push   $0x1
+    3b3a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3b3d:	50                   	push   %eax
+    3b3e:	ff 75 08             	push   0x8(%ebp)
+    3b41:	e8 d3 fc ff ff       	call   3819 <write>
+    3b46:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3b49:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b4e:	e9 c3 fe ff ff       	jmp    3a16 <printf+0x45>
+        putc(fd, '%');
+    3b53:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b57:	83 ec 04             	sub    $0x4,%esp
+    3b5a:	6a 01                	push   $0x1
+    3b5c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    3b5f:	57                   	push   %edi
+    3b60:	ff 75 08             	push   0x8(%ebp)
+    3b63:	e8 b1 fc ff ff       	call   3819 <write>
+        putc(fd, c);
+    3b68:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b6b:	83 c4 0c             	add    $0xc,%esp
+    3b6e:	6a 01                	push   $0x1
+    3b70:	57                   	push   %edi
+    3b71:	ff 75 08             	push   0x8(%ebp)
+    3b74:	e8 a0 fc ff ff       	call   3819 <write>
+        putc(fd, c);
+    3b79:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b81:	e9 90 fe ff ff       	jmp    3a16 <printf+0x45>
+    }
+  }
+}
+    3b86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3b89:	5b                   	pop    %ebx
+    3b8a:	5e                   	pop    %esi
+    3b8b:	5f                   	pop    %edi
+    3b8c:	5d                   	pop    %ebp
+    3b8d:	c3                   	ret
+
+00003b8e <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    3b8e:	55                   	push   %ebp
+    3b8f:	89 e5                	mov    %esp,%ebp
+    3b91:	57                   	push   %edi
+    3b92:	56                   	push   %esi
+    3b93:	53                   	push   %ebx
+    3b94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    3b97:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3b9a:	a1 20 a5 00 00       	mov    0xa520,%eax
+    3b9f:	eb 0c                	jmp    3bad <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3ba1:	8b 10                	mov    (%eax),%edx
+    3ba3:	39 d0                	cmp    %edx,%eax
+    3ba5:	72 04                	jb     3bab <free+0x1d>
+    3ba7:	39 d1                	cmp    %edx,%ecx
+    3ba9:	72 10                	jb     3bbb <free+0x2d>
+{
+    3bab:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3bad:	39 c8                	cmp    %ecx,%eax
+    3baf:	73 f0                	jae    3ba1 <free+0x13>
+    3bb1:	8b 10                	mov    (%eax),%edx
+    3bb3:	39 d1                	cmp    %edx,%ecx
+    3bb5:	72 04                	jb     3bbb <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3bb7:	39 d0                	cmp    %edx,%eax
+    3bb9:	72 f0                	jb     3bab <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3bbb:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3bbe:	8b 10                	mov    (%eax),%edx
+    3bc0:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3bc3:	39 fa                	cmp    %edi,%edx
+    3bc5:	74 19                	je     3be0 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3bc7:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    3bca:	8b 50 04             	mov    0x4(%eax),%edx
+    3bcd:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    3bd0:	39 f1                	cmp    %esi,%ecx
+    3bd2:	74 18                	je     3bec <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    3bd4:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    3bd6:	a3 20 a5 00 00       	mov    %eax,0xa520
+}
+    3bdb:	5b                   	pop    %ebx
+    3bdc:	5e                   	pop    %esi
+    3bdd:	5f                   	pop    %edi
+    3bde:	5d                   	pop    %ebp
+    3bdf:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    3be0:	03 72 04             	add    0x4(%edx),%esi
+    3be3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3be6:	8b 10                	mov    (%eax),%edx
+    3be8:	8b 12                	mov    (%edx),%edx
+    3bea:	eb db                	jmp    3bc7 <free+0x39>
+    p->s.size += bp->s.size;
+    3bec:	03 53 fc             	add    -0x4(%ebx),%edx
+    3bef:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    3bf2:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    3bf5:	eb dd                	jmp    3bd4 <free+0x46>
+
+00003bf7 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    3bf7:	55                   	push   %ebp
+    3bf8:	89 e5                	mov    %esp,%ebp
+    3bfa:	57                   	push   %edi
+    3bfb:	56                   	push   %esi
+    3bfc:	53                   	push   %ebx
+    3bfd:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3c00:	8b 45 08             	mov    0x8(%ebp),%eax
+    3c03:	8d 58 07             	lea    0x7(%eax),%ebx
+    3c06:	c1 eb 03             	shr    $0x3,%ebx
+    3c09:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    3c0c:	8b 15 20 a5 00 00    	mov    0xa520,%edx
+    3c12:	85 d2                	test   %edx,%edx
+    3c14:	74 1c                	je     3c32 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3c16:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    3c18:	8b 48 04             	mov    0x4(%eax),%ecx
+    3c1b:	39 d9                	cmp    %ebx,%ecx
+    3c1d:	73 38                	jae    3c57 <malloc+0x60>
+  if(nu < 4096)
+    3c1f:	be 00 10 00 00       	mov    $0x1000,%esi
+    3c24:	39 f3                	cmp    %esi,%ebx
+    3c26:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    3c29:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    3c30:	eb 72                	jmp    3ca4 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    3c32:	c7 05 20 a5 00 00 24 	movl   $0xa524,0xa520
+    3c39:	a5 00 00 
+    3c3c:	c7 05 24 a5 00 00 24 	movl   $0xa524,0xa524
+    3c43:	a5 00 00 
+    base.s.size = 0;
+    3c46:	c7 05 28 a5 00 00 00 	movl   $0x0,0xa528
+    3c4d:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3c50:	b8 24 a5 00 00       	mov    $0xa524,%eax
+    if(p->s.size >= nunits){
+    3c55:	eb c8                	jmp    3c1f <malloc+0x28>
+      if(p->s.size == nunits)
+    3c57:	39 cb                	cmp    %ecx,%ebx
+    3c59:	74 1e                	je     3c79 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    3c5b:	29 d9                	sub    %ebx,%ecx
+    3c5d:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    3c60:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    3c63:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    3c66:	89 15 20 a5 00 00    	mov    %edx,0xa520
+      return (void*)(p + 1);
+    3c6c:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    3c6f:	89 d0                	mov    %edx,%eax
+    3c71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c74:	5b                   	pop    %ebx
+    3c75:	5e                   	pop    %esi
+    3c76:	5f                   	pop    %edi
+    3c77:	5d                   	pop    %ebp
+    3c78:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    3c79:	8b 08                	mov    (%eax),%ecx
+    3c7b:	89 0a                	mov    %ecx,(%edx)
+    3c7d:	eb e7                	jmp    3c66 <malloc+0x6f>
+  hp->s.size = nu;
+    3c7f:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    3c82:	83 ec 0c             	sub    $0xc,%esp
+    3c85:	83 c0 08             	add    $0x8,%eax
+    3c88:	50                   	push   %eax
+    3c89:	e8 00 ff ff ff       	call   3b8e <free>
+  return freep;
+    3c8e:	8b 15 20 a5 00 00    	mov    0xa520,%edx
+      if((p = morecore(nunits)) == 0)
+    3c94:	83 c4 10             	add    $0x10,%esp
+    3c97:	85 d2                	test   %edx,%edx
+    3c99:	74 d4                	je     3c6f <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3c9b:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    3c9d:	8b 48 04             	mov    0x4(%eax),%ecx
+    3ca0:	39 d9                	cmp    %ebx,%ecx
+    3ca2:	73 b3                	jae    3c57 <malloc+0x60>
+    if(p == freep)
+    3ca4:	89 c2                	mov    %eax,%edx
+    3ca6:	39 05 20 a5 00 00    	cmp    %eax,0xa520
+    3cac:	75 ed                	jne    3c9b <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    3cae:	83 ec 0c             	sub    $0xc,%esp
+    3cb1:	57                   	push   %edi
+    3cb2:	e8 ca fb ff ff       	call   3881 <sbrk>
+  if(p == (char*)-1)
+    3cb7:	83 c4 10             	add    $0x10,%esp
+    3cba:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3cbd:	75 c0                	jne    3c7f <malloc+0x88>
+        return 0;
+    3cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+    3cc4:	eb a9                	jmp    3c6f <malloc+0x78>
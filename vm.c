@@ -6,9 +6,11 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "vmstats.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+struct vmstats vmstat;
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -31,7 +33,8 @@ seginit(void)
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
+// create any required page table pages.  For a 4MB page,
+// the PDE serves as the PTE.
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -39,6 +42,8 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
@@ -46,6 +51,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
       return 0;
     // Make sure all those PTE_P bits are zero.
     memset(pgtab, 0, PGSIZE);
+    __sync_fetch_and_add(&vmstat.pgtables, 1);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -99,6 +105,11 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // The kernel allocates physical memory for its heap and for user memory
 // between V2P(end) and the end of physical memory (PHYSTOP)
 // (directly addressable from end..P2V(PHYSTOP)).
+//
+// kvmalloc() builds the kernel half once, in kpgdir; every other
+// page directory points at kpgdir's kernel page tables rather than
+// having its own copies.  The kernel's mappings never change after
+// boot, so sharing them is safe.
 
 // This table defines the kernel's mappings, which are present in
 // every process's page table.
@@ -114,33 +125,69 @@ static struct kmap {
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
-// Set up kernel part of a page table.
+// Like mappages(), but uses a 4MB page wherever va and pa are
+// both 4MB-aligned and the rest of the range covers it, which
+// saves a page table and many TLB entries for each of them.
+static int
+mapkvm(pde_t *pgdir, char *va, uint size, uint pa, int perm)
+{
+  uint n;
+
+  while(size > 0){
+    if((uint)va % HUGEPGSIZE == 0 && pa % HUGEPGSIZE == 0 &&
+       size >= HUGEPGSIZE){
+      if(pgdir[PDX(va)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+      n = HUGEPGSIZE;
+    } else {
+      n = HUGEPGSIZE - (uint)va % HUGEPGSIZE;
+      if(n > size)
+        n = size;
+      if(mappages(pgdir, va, n, pa, perm) < 0)
+        return -1;
+    }
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
+// Set up kernel part of a page table, sharing kpgdir's.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
+  if(kpgdir == 0)
+    panic("setupkvm");
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  memset(pgdir, 0, PDX(KERNBASE)*sizeof(pde_t));
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE))*sizeof(pde_t));
+  __sync_fetch_and_add(&vmstat.pgtables, 1);
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes, holding the kernel page tables
+// that setupkvm() shares with every process.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  if((kpgdir = (pde_t*)kalloc()) == 0)
+    panic("kvmalloc");
+  memset(kpgdir, 0, PGSIZE);
+  if (P2V(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(mapkvm(kpgdir, k->virt, k->phys_end - k->phys_start,
+              (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc");
   switchkvm();
 }
 
@@ -221,8 +268,9 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
-  char *mem;
+  char *mem[KBATCH];
   uint a;
+  int i, n;
 
   if(newsz >= KERNBASE)
     return 0;
@@ -230,20 +278,57 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     return oldsz;
 
   a = PGROUNDUP(oldsz);
-  for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
-    if(mem == 0){
+  while(a < newsz){
+    // Take the pages KBATCH at a time.
+    n = (newsz - a + PGSIZE - 1) / PGSIZE;
+    if(n > KBATCH)
+      n = KBATCH;
+    if((i = kallocn(mem, n)) < n){
       cprintf("allocuvm out of memory\n");
-      deallocuvm(pgdir, newsz, oldsz);
+      kfreen(mem, i);
+      deallocuvm(pgdir, a, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
-    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
-      cprintf("allocuvm out of memory (2)\n");
+    for(i = 0; i < n; i++, a += PGSIZE){
+      memset(mem[i], 0, PGSIZE);
+      if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem[i]), PTE_W|PTE_U) < 0){
+        cprintf("allocuvm out of memory (2)\n");
+        kfreen(mem + i, n - i);
+        deallocuvm(pgdir, a, oldsz);
+        return 0;
+      }
+    }
+  }
+  return newsz;
+}
+
+// Like allocuvm(), but backs [HUGEROUNDUP(oldsz), newsz) with 4MB
+// pages from kallocorder(); the caller rounds newsz to match.
+// Returns new size or 0 on error.
+int
+allochuge(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  char *mem;
+  uint a;
+
+  if(newsz >= KERNBASE || newsz % HUGEPGSIZE)
+    return 0;
+  for(a = HUGEROUNDUP(oldsz); a < newsz; a += HUGEPGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS)
+      panic("allochuge");
+    // Nothing above oldsz is mapped, so any page table left here
+    // by a heap that has since shrunk is empty.
+    if(pgdir[PDX(a)] & PTE_P){
+      kfree(P2V(PTE_ADDR(pgdir[PDX(a)])));
+      pgdir[PDX(a)] = 0;
+      __sync_fetch_and_sub(&vmstat.pgtables, 1);
+    }
+    if((mem = kallocorder(HUGEORDER)) == 0){
       deallocuvm(pgdir, newsz, oldsz);
-      kfree(mem);
       return 0;
     }
+    memset(mem, 0, HUGEPGSIZE);
+    pgdir[PDX(a)] = V2P(mem) | PTE_PS | PTE_P | PTE_W | PTE_U;
   }
   return newsz;
 }
@@ -257,12 +342,25 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
   uint a, pa;
+  char *mem[KBATCH];
+  int n;
 
   if(newsz >= oldsz)
     return oldsz;
 
+  // Give the pages back KBATCH at a time.
+  n = 0;
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS){
+      // A 4MB page is freed only once all of it is gone.
+      if(a % HUGEPGSIZE == 0){
+        kfreeorder(P2V(PTE_ADDR(pgdir[PDX(a)])), HUGEORDER);
+        pgdir[PDX(a)] = 0;
+      }
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
@@ -270,16 +368,20 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
+      mem[n++] = P2V(pa);
+      if(n == KBATCH){
+        kfreen(mem, n);
+        n = 0;
+      }
       *pte = 0;
     }
   }
+  kfreen(mem, n);
   return newsz;
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part belongs to kpgdir.
 void
 freevm(pde_t *pgdir)
 {
@@ -288,13 +390,15 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
-    if(pgdir[i] & PTE_P){
+  for(i = 0; i < PDX(KERNBASE); i++){
+    if((pgdir[i] & (PTE_P|PTE_PS)) == PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
+      __sync_fetch_and_sub(&vmstat.pgtables, 1);
     }
   }
   kfree((char*)pgdir);
+  __sync_fetch_and_sub(&vmstat.pgtables, 1);
 }
 
 // Clear PTE_U on a page. Used to create an inaccessible
@@ -311,7 +415,10 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  Pages are shared, not copied: writable
+// pages become read-only and copy-on-write in both, to be
+// copied by cowcopy() when one of them writes.  4MB pages
+// are the exception, and are copied outright.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
@@ -323,17 +430,31 @@ copyuvm(pde_t *pgdir, uint sz)
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    // 4MB pages are copied outright.
+    if(pgdir[PDX(i)] & PTE_PS){
+      if((mem = kallocorder(HUGEORDER)) == 0)
+        goto bad;
+      memmove(mem, P2V(PTE_ADDR(pgdir[PDX(i)])), HUGEPGSIZE);
+      d[PDX(i)] = V2P(mem) | PTE_FLAGS(pgdir[PDX(i)]);
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    // Heap pages not touched yet stay that way in the child.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if(*pte & PTE_W){
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+      invlpg((void*)i);
+    }
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
+    kref(P2V(pa));
   }
   return d;
 
@@ -342,6 +463,135 @@ bad:
   return 0;
 }
 
+// Make the copy-on-write page at va writable in pgdir, copying it
+// unless pgdir holds the last reference.  Returns -1 if va is not
+// a copy-on-write page or there is no memory for the copy.
+int
+cowcopy(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa;
+  char *mem;
+
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  if(krefs(P2V(pa)) > 1){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, P2V(pa), PGSIZE);
+    *pte = V2P(mem) | PTE_FLAGS(*pte);
+    kfree(P2V(pa));
+    __sync_fetch_and_add(&vmstat.pagecopies, 1);
+  }
+  *pte = (*pte | PTE_W) & ~PTE_COW;
+  invlpg((void*)PGROUNDDOWN(va));
+  __sync_fetch_and_add(&vmstat.cowfaults, 1);
+  return 0;
+}
+
+// exec() and sbrk() only reserve address space.  Give the page at
+// va, below p->sz, memory if it has none yet: read from the program
+// file if va is in one of p's segments, zeroed otherwise.  Whole
+// pages of the file come from the page cache and are shared
+// copy-on-write.  May sleep reading the file.  Returns -1 if va is
+// out of range or there is no memory.
+int
+fillpage(struct proc *p, uint va)
+{
+  struct vmregion *r;
+  pte_t *pte;
+  char *mem;
+  uint n, perm;
+
+  if(va >= p->sz || va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(p->pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+    return 0;
+  for(r = p->region; r < &p->region[NREGION]; r++)
+    if(r->ip && va >= r->va && va < r->va + r->memsz)
+      break;
+  if(r == &p->region[NREGION])
+    r = 0;
+
+  if(r && va + PGSIZE <= r->va + r->filesz){
+    ilock(r->ip);
+    mem = pcget(r->ip, r->off + (va - r->va));
+    iunlock(r->ip);
+    if(mem == 0)
+      return -1;
+    perm = PTE_COW|PTE_U;
+  } else if(r && va < r->va + r->filesz){
+    // The segment's last page: the rest of it is zeroes, not file.
+    if((mem = kalloc()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+    n = r->va + r->filesz - va;
+    ilock(r->ip);
+    if(readi(r->ip, mem, r->off + (va - r->va), n) != n){
+      iunlock(r->ip);
+      kfree(mem);
+      return -1;
+    }
+    iunlock(r->ip);
+    __sync_fetch_and_add(&vmstat.filefaults, 1);
+    perm = PTE_W|PTE_U;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+    __sync_fetch_and_add(&vmstat.lazyfaults, 1);
+    perm = PTE_W|PTE_U;
+  }
+  // Another thread of control may have filled it while we slept.
+  if((pte = walkpgdir(p->pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P)){
+    kfree(mem);
+    return 0;
+  }
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Make [va, va+len) of p usable by the kernel, filling in any
+// pages nothing has touched yet.  If write is set, also break any
+// copy-on-write sharing, so that kernel writes there cannot fault:
+// a fault then, perhaps holding a spinlock, could not fail cleanly.
+int
+uvmtouch(struct proc *p, uint va, uint len, int write)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+    if(fillpage(p, a) < 0)
+      return -1;
+    if(!write)
+      continue;
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+    if((*pte & PTE_COW) && cowcopy(p->pgdir, a) < 0)
+      return -1;
+    if(!(*pte & PTE_W))
+      return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault at va in process p; err is the fault's error
+// code.  Returns 0 if the access can be retried.
+int
+pagefault(struct proc *p, uint va, uint err)
+{
+  if(err & FEC_PR)
+    return (err & FEC_WR) ? cowcopy(p->pgdir, va) : -1;
+  return fillpage(p, va);
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -350,10 +600,12 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
+  if(*pte & PTE_PS)
+    return (char*)P2V(PTE_ADDR(*pte)) + PGROUNDDOWN((uint)uva) % HUGEPGSIZE;
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
@@ -365,10 +617,21 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // Writing through the kernel's mapping skips the faults that
+    // would fill in a lazy page or break copy-on-write sharing.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && myproc() && pgdir == myproc()->pgdir){
+      if(fillpage(myproc(), va0) < 0)
+        return -1;
+      pte = walkpgdir(pgdir, (char*)va0, 0);
+    }
+    if(pte && (*pte & PTE_COW) && cowcopy(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,16 @@
+#define NKORDER 11   // kallocorder() block sizes: 2^0 .. 2^10 pages
+
+// Virtual memory counters, read with vmstats().
+struct vmstats {
+  uint cowfaults;    // Copy-on-write pages made writable again
+  uint pagecopies;   // Pages copied by copyuvm() or on a copy-on-write fault
+  uint lazyfaults;   // sbrk() pages filled in on first touch
+  uint filefaults;   // Program pages read in by exec() on first touch
+  uint textshared;   // Program pages found in the page cache instead
+  uint pgtables;     // Page directories and page tables in use
+
+  // Free memory right now, filled in by kmemstats().
+  uint freepages;            // Pages on the buddy lists
+  uint freeblocks[NKORDER];  // Free blocks of 2^order pages
+  uint cachedpages;          // Free pages held by per-CPU caches
+};
@@ -0,0 +1,2560 @@
+
+_vmstress:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <waitall>:
+
+// Virtual memory benchmarks. Run "vmstress N" for test N alone, or
+// "vmstress" for all of them.
+
+void
+waitall(void) {
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  while(wait() != -1);
+       6:	e8 63 0e 00 00       	call   e6e <wait>
+       b:	83 f8 ff             	cmp    $0xffffffff,%eax
+       e:	75 f6                	jne    6 <waitall+0x6>
+}
+      10:	c9                   	leave
+      11:	c3                   	ret
+
+00000012 <t1run>:
+// writes its whole image copies it all.
+#define T1_GROW (8*1024*1024)
+#define T1_FORKS 20
+
+void
+t1run(char *what, int touch) {
+      12:	55                   	push   %ebp
+      13:	89 e5                	mov    %esp,%ebp
+      15:	57                   	push   %edi
+      16:	56                   	push   %esi
+      17:	53                   	push   %ebx
+      18:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  struct vmstats before, after;
+  char *p = sbrk(0);
+      1e:	6a 00                	push   $0x0
+      20:	e8 c9 0e 00 00       	call   eee <sbrk>
+      25:	89 c7                	mov    %eax,%edi
+  int start, t, pid;
+
+  vmstats(&before);
+      27:	8d 45 9c             	lea    -0x64(%ebp),%eax
+      2a:	89 04 24             	mov    %eax,(%esp)
+      2d:	e8 54 0f 00 00       	call   f86 <vmstats>
+  start = uptime();
+      32:	e8 c7 0e 00 00       	call   efe <uptime>
+      37:	89 c6                	mov    %eax,%esi
+      39:	83 c4 10             	add    $0x10,%esp
+      3c:	bb 14 00 00 00       	mov    $0x14,%ebx
+      41:	eb 33                	jmp    76 <t1run+0x64>
+  for(int i = 0;i < T1_FORKS;i++) {
+    if((pid = fork()) == 0) {
+      for(int j = 0;j < touch;j += 4096)
+      43:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+      47:	7e 23                	jle    6c <t1run+0x5a>
+      49:	8d 57 ff             	lea    -0x1(%edi),%edx
+      4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+      4f:	83 e8 01             	sub    $0x1,%eax
+      52:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      57:	29 c7                	sub    %eax,%edi
+      59:	8d 87 ff ef ff ff    	lea    -0x1001(%edi),%eax
+        p[-1 - j] = 1;
+      5f:	c6 02 01             	movb   $0x1,(%edx)
+      for(int j = 0;j < touch;j += 4096)
+      62:	81 ea 00 10 00 00    	sub    $0x1000,%edx
+      68:	39 c2                	cmp    %eax,%edx
+      6a:	75 f3                	jne    5f <t1run+0x4d>
+      exit();
+      6c:	e8 f5 0d 00 00       	call   e66 <exit>
+  for(int i = 0;i < T1_FORKS;i++) {
+      71:	83 eb 01             	sub    $0x1,%ebx
+      74:	74 19                	je     8f <t1run+0x7d>
+    if((pid = fork()) == 0) {
+      76:	e8 e3 0d 00 00       	call   e5e <fork>
+      7b:	85 c0                	test   %eax,%eax
+      7d:	74 c4                	je     43 <t1run+0x31>
+    }
+    if(pid > 0)
+      7f:	7e f0                	jle    71 <t1run+0x5f>
+      waitpid(pid);
+      81:	83 ec 0c             	sub    $0xc,%esp
+      84:	50                   	push   %eax
+      85:	e8 cc 0e 00 00       	call   f56 <waitpid>
+      8a:	83 c4 10             	add    $0x10,%esp
+      8d:	eb e2                	jmp    71 <t1run+0x5f>
+  }
+  t = uptime() - start;
+      8f:	e8 6a 0e 00 00       	call   efe <uptime>
+      94:	29 f0                	sub    %esi,%eax
+      96:	89 c7                	mov    %eax,%edi
+  vmstats(&after);
+      98:	83 ec 0c             	sub    $0xc,%esp
+      9b:	8d 85 50 ff ff ff    	lea    -0xb0(%ebp),%eax
+      a1:	50                   	push   %eax
+      a2:	e8 df 0e 00 00       	call   f86 <vmstats>
+  printf(1, "%s\t%d\t%d\t%d\n", what, (int)sbrk(0), t,
+         (after.pagecopies - before.pagecopies) / T1_FORKS);
+      a7:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+      ad:	2b 55 a0             	sub    -0x60(%ebp),%edx
+  printf(1, "%s\t%d\t%d\t%d\n", what, (int)sbrk(0), t,
+      b0:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+      b5:	89 d0                	mov    %edx,%eax
+      b7:	f7 e1                	mul    %ecx
+      b9:	c1 ea 04             	shr    $0x4,%edx
+      bc:	89 d3                	mov    %edx,%ebx
+      be:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      c5:	e8 24 0e 00 00       	call   eee <sbrk>
+      ca:	83 c4 08             	add    $0x8,%esp
+      cd:	53                   	push   %ebx
+      ce:	57                   	push   %edi
+      cf:	50                   	push   %eax
+      d0:	ff 75 08             	push   0x8(%ebp)
+      d3:	68 34 13 00 00       	push   $0x1334
+      d8:	6a 01                	push   $0x1
+      da:	e8 5f 0f 00 00       	call   103e <printf>
+}
+      df:	83 c4 20             	add    $0x20,%esp
+      e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      e5:	5b                   	pop    %ebx
+      e6:	5e                   	pop    %esi
+      e7:	5f                   	pop    %edi
+      e8:	5d                   	pop    %ebp
+      e9:	c3                   	ret
+
+000000ea <test1>:
+
+void
+test1(void) {
+      ea:	55                   	push   %ebp
+      eb:	89 e5                	mov    %esp,%ebp
+      ed:	83 ec 10             	sub    $0x10,%esp
+  char *grow;
+
+  printf(1, "\n> starting test 1\n");
+      f0:	68 41 13 00 00       	push   $0x1341
+      f5:	6a 01                	push   $0x1
+      f7:	e8 42 0f 00 00       	call   103e <printf>
+  printf(1, "child\tsize\tticks/%d\tpages copied per fork\n", T1_FORKS);
+      fc:	83 c4 0c             	add    $0xc,%esp
+      ff:	6a 14                	push   $0x14
+     101:	68 74 15 00 00       	push   $0x1574
+     106:	6a 01                	push   $0x1
+     108:	e8 31 0f 00 00       	call   103e <printf>
+  t1run("exits", 0);
+     10d:	83 c4 08             	add    $0x8,%esp
+     110:	6a 00                	push   $0x0
+     112:	68 55 13 00 00       	push   $0x1355
+     117:	e8 f6 fe ff ff       	call   12 <t1run>
+  if((grow = sbrk(T1_GROW)) == (char*)-1) {
+     11c:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+     123:	e8 c6 0d 00 00       	call   eee <sbrk>
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     12e:	74 51                	je     181 <test1+0x97>
+    printf(1, "cannot grow by %d bytes\n", T1_GROW);
+    return;
+  }
+  memset(grow, 1, T1_GROW);
+     130:	83 ec 04             	sub    $0x4,%esp
+     133:	68 00 00 80 00       	push   $0x800000
+     138:	6a 01                	push   $0x1
+     13a:	50                   	push   %eax
+     13b:	e8 38 0b 00 00       	call   c78 <memset>
+  t1run("exits", 0);
+     140:	83 c4 08             	add    $0x8,%esp
+     143:	6a 00                	push   $0x0
+     145:	68 55 13 00 00       	push   $0x1355
+     14a:	e8 c3 fe ff ff       	call   12 <t1run>
+  t1run("writes", T1_GROW);
+     14f:	83 c4 08             	add    $0x8,%esp
+     152:	68 00 00 80 00       	push   $0x800000
+     157:	68 74 13 00 00       	push   $0x1374
+     15c:	e8 b1 fe ff ff       	call   12 <t1run>
+  sbrk(-T1_GROW);
+     161:	c7 04 24 00 00 80 ff 	movl   $0xff800000,(%esp)
+     168:	e8 81 0d 00 00       	call   eee <sbrk>
+  printf(1, "\n> test 1 complete\n");
+     16d:	83 c4 08             	add    $0x8,%esp
+     170:	68 7b 13 00 00       	push   $0x137b
+     175:	6a 01                	push   $0x1
+     177:	e8 c2 0e 00 00       	call   103e <printf>
+     17c:	83 c4 10             	add    $0x10,%esp
+}
+     17f:	c9                   	leave
+     180:	c3                   	ret
+    printf(1, "cannot grow by %d bytes\n", T1_GROW);
+     181:	83 ec 04             	sub    $0x4,%esp
+     184:	68 00 00 80 00       	push   $0x800000
+     189:	68 5b 13 00 00       	push   $0x135b
+     18e:	6a 01                	push   $0x1
+     190:	e8 a9 0e 00 00       	call   103e <printf>
+    return;
+     195:	83 c4 10             	add    $0x10,%esp
+     198:	eb e5                	jmp    17f <test1+0x95>
+
+0000019a <test2>:
+// anything.
+#define T2_ARENA (64*1024*1024)
+#define T2_STRIDE 64
+
+void
+test2(void) {
+     19a:	55                   	push   %ebp
+     19b:	89 e5                	mov    %esp,%ebp
+     19d:	57                   	push   %edi
+     19e:	56                   	push   %esi
+     19f:	53                   	push   %ebx
+     1a0:	81 ec b4 00 00 00    	sub    $0xb4,%esp
+  struct vmstats before, after;
+  char *arena;
+  int start, t, fd[2];
+
+  printf(1, "\n> starting test 2\n");
+     1a6:	68 8f 13 00 00       	push   $0x138f
+     1ab:	6a 01                	push   $0x1
+     1ad:	e8 8c 0e 00 00       	call   103e <printf>
+  vmstats(&before);
+     1b2:	8d 45 9c             	lea    -0x64(%ebp),%eax
+     1b5:	89 04 24             	mov    %eax,(%esp)
+     1b8:	e8 c9 0d 00 00       	call   f86 <vmstats>
+  start = uptime();
+     1bd:	e8 3c 0d 00 00       	call   efe <uptime>
+     1c2:	89 c7                	mov    %eax,%edi
+  if((arena = sbrk(T2_ARENA)) == (char*)-1) {
+     1c4:	c7 04 24 00 00 00 04 	movl   $0x4000000,(%esp)
+     1cb:	e8 1e 0d 00 00       	call   eee <sbrk>
+     1d0:	83 c4 10             	add    $0x10,%esp
+     1d3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1d6:	0f 84 f2 00 00 00    	je     2ce <test2+0x134>
+     1dc:	89 c3                	mov    %eax,%ebx
+    printf(1, "cannot reserve %d bytes\n", T2_ARENA);
+    return;
+  }
+  t = uptime() - start;
+     1de:	e8 1b 0d 00 00       	call   efe <uptime>
+     1e3:	29 f8                	sub    %edi,%eax
+     1e5:	89 c6                	mov    %eax,%esi
+  for(int i = 0;i < T2_ARENA;i += T2_STRIDE*4096)
+     1e7:	89 d8                	mov    %ebx,%eax
+     1e9:	8d 93 00 00 00 04    	lea    0x4000000(%ebx),%edx
+    arena[i] = 1;
+     1ef:	c6 00 01             	movb   $0x1,(%eax)
+  for(int i = 0;i < T2_ARENA;i += T2_STRIDE*4096)
+     1f2:	05 00 00 04 00       	add    $0x40000,%eax
+     1f7:	39 d0                	cmp    %edx,%eax
+     1f9:	75 f4                	jne    1ef <test2+0x55>
+  pipe(fd);
+     1fb:	83 ec 0c             	sub    $0xc,%esp
+     1fe:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+     204:	50                   	push   %eax
+     205:	e8 6c 0c 00 00       	call   e76 <pipe>
+  write(fd[1], "x", 1);
+     20a:	83 c4 0c             	add    $0xc,%esp
+     20d:	6a 01                	push   $0x1
+     20f:	68 bc 13 00 00       	push   $0x13bc
+     214:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+     21a:	e8 67 0c 00 00       	call   e86 <write>
+  if(read(fd[0], arena + T2_ARENA - 1, 1) != 1 || arena[T2_ARENA - 1] != 'x')
+     21f:	83 c4 0c             	add    $0xc,%esp
+     222:	6a 01                	push   $0x1
+     224:	8d 83 ff ff ff 03    	lea    0x3ffffff(%ebx),%eax
+     22a:	50                   	push   %eax
+     22b:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+     231:	e8 48 0c 00 00       	call   e7e <read>
+     236:	83 c4 10             	add    $0x10,%esp
+     239:	83 f8 01             	cmp    $0x1,%eax
+     23c:	75 09                	jne    247 <test2+0xad>
+     23e:	80 bb ff ff ff 03 78 	cmpb   $0x78,0x3ffffff(%ebx)
+     245:	74 12                	je     259 <test2+0xbf>
+    printf(1, "read into an untouched page failed\n");
+     247:	83 ec 08             	sub    $0x8,%esp
+     24a:	68 a0 15 00 00       	push   $0x15a0
+     24f:	6a 01                	push   $0x1
+     251:	e8 e8 0d 00 00       	call   103e <printf>
+     256:	83 c4 10             	add    $0x10,%esp
+  close(fd[0]);
+     259:	83 ec 0c             	sub    $0xc,%esp
+     25c:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+     262:	e8 27 0c 00 00       	call   e8e <close>
+  close(fd[1]);
+     267:	83 c4 04             	add    $0x4,%esp
+     26a:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+     270:	e8 19 0c 00 00       	call   e8e <close>
+  vmstats(&after);
+     275:	8d 85 50 ff ff ff    	lea    -0xb0(%ebp),%eax
+     27b:	89 04 24             	mov    %eax,(%esp)
+     27e:	e8 03 0d 00 00       	call   f86 <vmstats>
+  printf(1, "sbrk(%d) took %d ticks; %d of %d pages filled in\n",
+     283:	83 c4 08             	add    $0x8,%esp
+     286:	68 00 40 00 00       	push   $0x4000
+     28b:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+     291:	2b 45 a4             	sub    -0x5c(%ebp),%eax
+     294:	50                   	push   %eax
+     295:	56                   	push   %esi
+     296:	68 00 00 00 04       	push   $0x4000000
+     29b:	68 c4 15 00 00       	push   $0x15c4
+     2a0:	6a 01                	push   $0x1
+     2a2:	e8 97 0d 00 00       	call   103e <printf>
+         T2_ARENA, t, after.lazyfaults - before.lazyfaults, T2_ARENA/4096);
+  sbrk(-T2_ARENA);
+     2a7:	83 c4 14             	add    $0x14,%esp
+     2aa:	68 00 00 00 fc       	push   $0xfc000000
+     2af:	e8 3a 0c 00 00       	call   eee <sbrk>
+  printf(1, "\n> test 2 complete\n");
+     2b4:	83 c4 08             	add    $0x8,%esp
+     2b7:	68 be 13 00 00       	push   $0x13be
+     2bc:	6a 01                	push   $0x1
+     2be:	e8 7b 0d 00 00       	call   103e <printf>
+     2c3:	83 c4 10             	add    $0x10,%esp
+}
+     2c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2c9:	5b                   	pop    %ebx
+     2ca:	5e                   	pop    %esi
+     2cb:	5f                   	pop    %edi
+     2cc:	5d                   	pop    %ebp
+     2cd:	c3                   	ret
+    printf(1, "cannot reserve %d bytes\n", T2_ARENA);
+     2ce:	83 ec 04             	sub    $0x4,%esp
+     2d1:	68 00 00 00 04       	push   $0x4000000
+     2d6:	68 a3 13 00 00       	push   $0x13a3
+     2db:	6a 01                	push   $0x1
+     2dd:	e8 5c 0d 00 00       	call   103e <printf>
+     2e2:	83 c4 10             	add    $0x10,%esp
+     2e5:	eb df                	jmp    2c6 <test2+0x12c>
+
+000002e7 <test3>:
+// that exits at once should only read the few pages it runs, not its
+// whole file.
+#define T3_RUNS 20
+
+void
+test3(void) {
+     2e7:	55                   	push   %ebp
+     2e8:	89 e5                	mov    %esp,%ebp
+     2ea:	56                   	push   %esi
+     2eb:	53                   	push   %ebx
+     2ec:	81 ec c8 00 00 00    	sub    $0xc8,%esp
+  struct vmstats before, after;
+  struct stat st;
+  char *argv[] = {"vmstress", "99", 0};
+     2f2:	c7 85 40 ff ff ff d2 	movl   $0x13d2,-0xc0(%ebp)
+     2f9:	13 00 00 
+     2fc:	c7 85 44 ff ff ff db 	movl   $0x13db,-0xbc(%ebp)
+     303:	13 00 00 
+     306:	c7 85 48 ff ff ff 00 	movl   $0x0,-0xb8(%ebp)
+     30d:	00 00 00 
+  int start, t;
+
+  printf(1, "\n> starting test 3\n");
+     310:	68 de 13 00 00       	push   $0x13de
+     315:	6a 01                	push   $0x1
+     317:	e8 22 0d 00 00       	call   103e <printf>
+  if(stat(argv[0], &st) < 0) {
+     31c:	83 c4 08             	add    $0x8,%esp
+     31f:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+     325:	50                   	push   %eax
+     326:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+     32c:	e8 e4 09 00 00       	call   d15 <stat>
+     331:	83 c4 10             	add    $0x10,%esp
+     334:	85 c0                	test   %eax,%eax
+     336:	78 1d                	js     355 <test3+0x6e>
+    printf(1, "cannot stat %s\n", argv[0]);
+    return;
+  }
+  vmstats(&before);
+     338:	83 ec 0c             	sub    $0xc,%esp
+     33b:	8d 45 ac             	lea    -0x54(%ebp),%eax
+     33e:	50                   	push   %eax
+     33f:	e8 42 0c 00 00       	call   f86 <vmstats>
+  start = uptime();
+     344:	e8 b5 0b 00 00       	call   efe <uptime>
+     349:	89 c6                	mov    %eax,%esi
+     34b:	83 c4 10             	add    $0x10,%esp
+     34e:	bb 14 00 00 00       	mov    $0x14,%ebx
+     353:	eb 3c                	jmp    391 <test3+0xaa>
+    printf(1, "cannot stat %s\n", argv[0]);
+     355:	83 ec 04             	sub    $0x4,%esp
+     358:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+     35e:	68 f2 13 00 00       	push   $0x13f2
+     363:	6a 01                	push   $0x1
+     365:	e8 d4 0c 00 00       	call   103e <printf>
+     36a:	83 c4 10             	add    $0x10,%esp
+     36d:	e9 90 00 00 00       	jmp    402 <test3+0x11b>
+  for(int i = 0;i < T3_RUNS;i++) {
+    int pid = fork();
+    if(pid == 0) {
+      exec(argv[0], argv);
+     372:	83 ec 08             	sub    $0x8,%esp
+     375:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+     37b:	50                   	push   %eax
+     37c:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+     382:	e8 17 0b 00 00       	call   e9e <exec>
+      exit();
+     387:	e8 da 0a 00 00       	call   e66 <exit>
+  for(int i = 0;i < T3_RUNS;i++) {
+     38c:	83 eb 01             	sub    $0x1,%ebx
+     38f:	74 12                	je     3a3 <test3+0xbc>
+    int pid = fork();
+     391:	e8 c8 0a 00 00       	call   e5e <fork>
+    if(pid == 0) {
+     396:	85 c0                	test   %eax,%eax
+     398:	74 d8                	je     372 <test3+0x8b>
+    }
+    if(pid > 0) wait();
+     39a:	7e f0                	jle    38c <test3+0xa5>
+     39c:	e8 cd 0a 00 00       	call   e6e <wait>
+     3a1:	eb e9                	jmp    38c <test3+0xa5>
+  }
+  t = uptime() - start;
+     3a3:	e8 56 0b 00 00       	call   efe <uptime>
+     3a8:	29 f0                	sub    %esi,%eax
+     3aa:	89 c3                	mov    %eax,%ebx
+  vmstats(&after);
+     3ac:	83 ec 0c             	sub    $0xc,%esp
+     3af:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+     3b5:	50                   	push   %eax
+     3b6:	e8 cb 0b 00 00       	call   f86 <vmstats>
+  printf(1, "%d execs of a %d page program took %d ticks; "
+     3bb:	83 c4 0c             	add    $0xc,%esp
+     3be:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+     3c4:	2b 45 bc             	sub    -0x44(%ebp),%eax
+     3c7:	50                   	push   %eax
+     3c8:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+     3ce:	2b 45 b8             	sub    -0x48(%ebp),%eax
+     3d1:	50                   	push   %eax
+     3d2:	53                   	push   %ebx
+         "%d pages read in, %d shared\n",
+         T3_RUNS, (st.size + 4095)/4096, t,
+     3d3:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+     3d9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  printf(1, "%d execs of a %d page program took %d ticks; "
+     3de:	c1 e8 0c             	shr    $0xc,%eax
+     3e1:	50                   	push   %eax
+     3e2:	6a 14                	push   $0x14
+     3e4:	68 f8 15 00 00       	push   $0x15f8
+     3e9:	6a 01                	push   $0x1
+     3eb:	e8 4e 0c 00 00       	call   103e <printf>
+         after.filefaults - before.filefaults,
+         after.textshared - before.textshared);
+  printf(1, "\n> test 3 complete\n");
+     3f0:	83 c4 18             	add    $0x18,%esp
+     3f3:	68 02 14 00 00       	push   $0x1402
+     3f8:	6a 01                	push   $0x1
+     3fa:	e8 3f 0c 00 00       	call   103e <printf>
+     3ff:	83 c4 10             	add    $0x10,%esp
+}
+     402:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     405:	5b                   	pop    %ebx
+     406:	5e                   	pop    %esi
+     407:	5d                   	pop    %ebp
+     408:	c3                   	ret
+
+00000409 <test4>:
+// exec should only read the partial page at the end of its data.
+#define T4_PROCS 20
+#define T4_HOLD 200
+
+void
+test4(void) {
+     409:	55                   	push   %ebp
+     40a:	89 e5                	mov    %esp,%ebp
+     40c:	57                   	push   %edi
+     40d:	56                   	push   %esi
+     40e:	53                   	push   %ebx
+     40f:	81 ec c4 00 00 00    	sub    $0xc4,%esp
+  struct vmstats before, after;
+  char *argv[] = {"vmstress", "98", 0};
+     415:	c7 85 44 ff ff ff d2 	movl   $0x13d2,-0xbc(%ebp)
+     41c:	13 00 00 
+     41f:	c7 85 48 ff ff ff 16 	movl   $0x1416,-0xb8(%ebp)
+     426:	14 00 00 
+     429:	c7 85 4c ff ff ff 00 	movl   $0x0,-0xb4(%ebp)
+     430:	00 00 00 
+  char *argv99[] = {"vmstress", "99", 0};
+     433:	c7 85 38 ff ff ff d2 	movl   $0x13d2,-0xc8(%ebp)
+     43a:	13 00 00 
+     43d:	c7 85 3c ff ff ff db 	movl   $0x13db,-0xc4(%ebp)
+     444:	13 00 00 
+     447:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%ebp)
+     44e:	00 00 00 
+  int start, t, pid, n;
+
+  printf(1, "\n> starting test 4\n");
+     451:	68 19 14 00 00       	push   $0x1419
+     456:	6a 01                	push   $0x1
+     458:	e8 e1 0b 00 00       	call   103e <printf>
+  vmstats(&before);
+     45d:	8d 45 9c             	lea    -0x64(%ebp),%eax
+     460:	89 04 24             	mov    %eax,(%esp)
+     463:	e8 1e 0b 00 00       	call   f86 <vmstats>
+     468:	83 c4 10             	add    $0x10,%esp
+  for(n = 0;n < T4_PROCS;n++) {
+     46b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if((pid = fork()) < 0) break;
+     470:	e8 e9 09 00 00       	call   e5e <fork>
+     475:	85 c0                	test   %eax,%eax
+     477:	78 0e                	js     487 <test4+0x7e>
+    if(pid == 0) {
+     479:	0f 84 c3 00 00 00    	je     542 <test4+0x139>
+  for(n = 0;n < T4_PROCS;n++) {
+     47f:	83 c3 01             	add    $0x1,%ebx
+     482:	83 fb 14             	cmp    $0x14,%ebx
+     485:	75 e9                	jne    470 <test4+0x67>
+      exec(argv[0], argv);
+      exit();
+    }
+  }
+  sleep(T4_HOLD/4);
+     487:	83 ec 0c             	sub    $0xc,%esp
+     48a:	6a 32                	push   $0x32
+     48c:	e8 65 0a 00 00       	call   ef6 <sleep>
+  vmstats(&after);
+     491:	8d b5 50 ff ff ff    	lea    -0xb0(%ebp),%esi
+     497:	89 34 24             	mov    %esi,(%esp)
+     49a:	e8 e7 0a 00 00       	call   f86 <vmstats>
+  printf(1, "%d copies running: %d pages read in, %d shared\n", n,
+     49f:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+     4a5:	2b 45 ac             	sub    -0x54(%ebp),%eax
+     4a8:	89 04 24             	mov    %eax,(%esp)
+     4ab:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+     4b1:	2b 45 a8             	sub    -0x58(%ebp),%eax
+     4b4:	50                   	push   %eax
+     4b5:	53                   	push   %ebx
+     4b6:	68 44 16 00 00       	push   $0x1644
+     4bb:	6a 01                	push   $0x1
+     4bd:	e8 7c 0b 00 00       	call   103e <printf>
+         after.filefaults - before.filefaults,
+         after.textshared - before.textshared);
+  before = after;
+     4c2:	8d 7d 9c             	lea    -0x64(%ebp),%edi
+     4c5:	b9 13 00 00 00       	mov    $0x13,%ecx
+     4ca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  start = uptime();
+     4cc:	83 c4 20             	add    $0x20,%esp
+     4cf:	e8 2a 0a 00 00       	call   efe <uptime>
+     4d4:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0) {
+     4d6:	e8 83 09 00 00       	call   e5e <fork>
+     4db:	85 c0                	test   %eax,%eax
+     4dd:	74 7d                	je     55c <test4+0x153>
+    exec(argv99[0], argv99);
+    exit();
+  }
+  if(pid > 0) wait();
+     4df:	0f 8f 91 00 00 00    	jg     576 <test4+0x16d>
+  t = uptime() - start;
+     4e5:	e8 14 0a 00 00       	call   efe <uptime>
+     4ea:	29 d8                	sub    %ebx,%eax
+     4ec:	89 c6                	mov    %eax,%esi
+  vmstats(&after);
+     4ee:	83 ec 0c             	sub    $0xc,%esp
+     4f1:	8d 85 50 ff ff ff    	lea    -0xb0(%ebp),%eax
+     4f7:	50                   	push   %eax
+     4f8:	e8 89 0a 00 00       	call   f86 <vmstats>
+  printf(1, "hot exec took %d ticks: %d pages read in, %d shared\n", t,
+     4fd:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+     503:	2b 45 ac             	sub    -0x54(%ebp),%eax
+     506:	89 04 24             	mov    %eax,(%esp)
+     509:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+     50f:	2b 45 a8             	sub    -0x58(%ebp),%eax
+     512:	50                   	push   %eax
+     513:	56                   	push   %esi
+     514:	68 74 16 00 00       	push   $0x1674
+     519:	6a 01                	push   $0x1
+     51b:	e8 1e 0b 00 00       	call   103e <printf>
+         after.filefaults - before.filefaults,
+         after.textshared - before.textshared);
+  waitall();
+     520:	83 c4 20             	add    $0x20,%esp
+     523:	e8 d8 fa ff ff       	call   0 <waitall>
+  printf(1, "\n> test 4 complete\n");
+     528:	83 ec 08             	sub    $0x8,%esp
+     52b:	68 2d 14 00 00       	push   $0x142d
+     530:	6a 01                	push   $0x1
+     532:	e8 07 0b 00 00       	call   103e <printf>
+}
+     537:	83 c4 10             	add    $0x10,%esp
+     53a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     53d:	5b                   	pop    %ebx
+     53e:	5e                   	pop    %esi
+     53f:	5f                   	pop    %edi
+     540:	5d                   	pop    %ebp
+     541:	c3                   	ret
+      exec(argv[0], argv);
+     542:	83 ec 08             	sub    $0x8,%esp
+     545:	8d 85 44 ff ff ff    	lea    -0xbc(%ebp),%eax
+     54b:	50                   	push   %eax
+     54c:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+     552:	e8 47 09 00 00       	call   e9e <exec>
+      exit();
+     557:	e8 0a 09 00 00       	call   e66 <exit>
+    exec(argv99[0], argv99);
+     55c:	83 ec 08             	sub    $0x8,%esp
+     55f:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+     565:	50                   	push   %eax
+     566:	ff b5 38 ff ff ff    	push   -0xc8(%ebp)
+     56c:	e8 2d 09 00 00       	call   e9e <exec>
+    exit();
+     571:	e8 f0 08 00 00       	call   e66 <exit>
+  if(pid > 0) wait();
+     576:	e8 f3 08 00 00       	call   e6e <wait>
+     57b:	e9 65 ff ff ff       	jmp    4e5 <test4+0xdc>
+
+00000580 <t5scan>:
+#define T5_FORKS 1000
+#define T5_ARENA (8*1024*1024)
+#define T5_PASSES 200
+
+int
+t5scan(char *p) {
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+     585:	53                   	push   %ebx
+     586:	83 ec 1c             	sub    $0x1c,%esp
+     589:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int start = uptime();
+     58c:	e8 6d 09 00 00       	call   efe <uptime>
+     591:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int sum = 0;
+
+  for(int i = 0;i < T5_PASSES;i++)
+     594:	8d b3 00 00 80 00    	lea    0x800000(%ebx),%esi
+     59a:	bf 00 00 00 00       	mov    $0x0,%edi
+  int sum = 0;
+     59f:	ba 00 00 00 00       	mov    $0x0,%edx
+    for(int off = 0;off < T5_ARENA;off += 4096)
+     5a4:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+      sum += p[off + (i & 1023)];
+     5a7:	0f be 08             	movsbl (%eax),%ecx
+     5aa:	01 ca                	add    %ecx,%edx
+    for(int off = 0;off < T5_ARENA;off += 4096)
+     5ac:	05 00 10 00 00       	add    $0x1000,%eax
+     5b1:	39 f0                	cmp    %esi,%eax
+     5b3:	75 f2                	jne    5a7 <t5scan+0x27>
+  for(int i = 0;i < T5_PASSES;i++)
+     5b5:	83 c7 01             	add    $0x1,%edi
+     5b8:	83 c6 01             	add    $0x1,%esi
+     5bb:	81 ff c8 00 00 00    	cmp    $0xc8,%edi
+     5c1:	75 e1                	jne    5a4 <t5scan+0x24>
+  if(sum != 0) printf(1, "arena not zeroed\n");
+     5c3:	85 d2                	test   %edx,%edx
+     5c5:	75 12                	jne    5d9 <t5scan+0x59>
+  return uptime() - start;
+     5c7:	e8 32 09 00 00       	call   efe <uptime>
+     5cc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     5cf:	29 d8                	sub    %ebx,%eax
+}
+     5d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5d4:	5b                   	pop    %ebx
+     5d5:	5e                   	pop    %esi
+     5d6:	5f                   	pop    %edi
+     5d7:	5d                   	pop    %ebp
+     5d8:	c3                   	ret
+  if(sum != 0) printf(1, "arena not zeroed\n");
+     5d9:	83 ec 08             	sub    $0x8,%esp
+     5dc:	68 41 14 00 00       	push   $0x1441
+     5e1:	6a 01                	push   $0x1
+     5e3:	e8 56 0a 00 00       	call   103e <printf>
+     5e8:	83 c4 10             	add    $0x10,%esp
+     5eb:	eb da                	jmp    5c7 <t5scan+0x47>
+
+000005ed <test5>:
+
+void
+test5(void) {
+     5ed:	55                   	push   %ebp
+     5ee:	89 e5                	mov    %esp,%ebp
+     5f0:	57                   	push   %edi
+     5f1:	56                   	push   %esi
+     5f2:	53                   	push   %ebx
+     5f3:	83 ec 18             	sub    $0x18,%esp
+  char *brk = sbrk(0), *p;
+     5f6:	6a 00                	push   $0x0
+     5f8:	e8 f1 08 00 00       	call   eee <sbrk>
+     5fd:	89 c6                	mov    %eax,%esi
+  int start, t;
+
+  printf(1, "\n> starting test 5\n");
+     5ff:	83 c4 08             	add    $0x8,%esp
+     602:	68 53 14 00 00       	push   $0x1453
+     607:	6a 01                	push   $0x1
+     609:	e8 30 0a 00 00       	call   103e <printf>
+  start = uptime();
+     60e:	e8 eb 08 00 00       	call   efe <uptime>
+     613:	89 c7                	mov    %eax,%edi
+     615:	83 c4 10             	add    $0x10,%esp
+     618:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     61d:	eb 0f                	jmp    62e <test5+0x41>
+  for(int i = 0;i < T5_FORKS;i++) {
+    int pid = fork();
+    if(pid == 0) exit();
+     61f:	e8 42 08 00 00       	call   e66 <exit>
+    if(pid > 0) wait();
+     624:	e8 45 08 00 00       	call   e6e <wait>
+  for(int i = 0;i < T5_FORKS;i++) {
+     629:	83 eb 01             	sub    $0x1,%ebx
+     62c:	74 0d                	je     63b <test5+0x4e>
+    int pid = fork();
+     62e:	e8 2b 08 00 00       	call   e5e <fork>
+    if(pid == 0) exit();
+     633:	85 c0                	test   %eax,%eax
+     635:	74 e8                	je     61f <test5+0x32>
+    if(pid > 0) wait();
+     637:	7e f0                	jle    629 <test5+0x3c>
+     639:	eb e9                	jmp    624 <test5+0x37>
+  }
+  printf(1, "%d forks took %d ticks\n", T5_FORKS, uptime() - start);
+     63b:	e8 be 08 00 00       	call   efe <uptime>
+     640:	29 f8                	sub    %edi,%eax
+     642:	50                   	push   %eax
+     643:	68 e8 03 00 00       	push   $0x3e8
+     648:	68 67 14 00 00       	push   $0x1467
+     64d:	6a 01                	push   $0x1
+     64f:	e8 ea 09 00 00       	call   103e <printf>
+
+  if((p = sbrk(T5_ARENA)) == (char*)-1) {
+     654:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+     65b:	e8 8e 08 00 00       	call   eee <sbrk>
+     660:	89 c3                	mov    %eax,%ebx
+     662:	83 c4 10             	add    $0x10,%esp
+     665:	83 f8 ff             	cmp    $0xffffffff,%eax
+     668:	0f 84 aa 00 00 00    	je     718 <test5+0x12b>
+    printf(1, "cannot sbrk %d bytes\n", T5_ARENA);
+    return;
+  }
+  memset(p, 0, T5_ARENA);
+     66e:	83 ec 04             	sub    $0x4,%esp
+     671:	68 00 00 80 00       	push   $0x800000
+     676:	6a 00                	push   $0x0
+     678:	50                   	push   %eax
+     679:	e8 fa 05 00 00       	call   c78 <memset>
+  t = t5scan(p);
+     67e:	89 1c 24             	mov    %ebx,(%esp)
+     681:	e8 fa fe ff ff       	call   580 <t5scan>
+  printf(1, "%d passes over %d 4KB pages took %d ticks\n",
+     686:	89 04 24             	mov    %eax,(%esp)
+     689:	68 00 08 00 00       	push   $0x800
+     68e:	68 c8 00 00 00       	push   $0xc8
+     693:	68 ac 16 00 00       	push   $0x16ac
+     698:	6a 01                	push   $0x1
+     69a:	e8 9f 09 00 00       	call   103e <printf>
+         T5_PASSES, T5_ARENA/4096, t);
+  sbrk(brk - sbrk(0));
+     69f:	83 c4 14             	add    $0x14,%esp
+     6a2:	6a 00                	push   $0x0
+     6a4:	e8 45 08 00 00       	call   eee <sbrk>
+     6a9:	89 c2                	mov    %eax,%edx
+     6ab:	89 f0                	mov    %esi,%eax
+     6ad:	29 d0                	sub    %edx,%eax
+     6af:	89 04 24             	mov    %eax,(%esp)
+     6b2:	e8 37 08 00 00       	call   eee <sbrk>
+
+  if((p = hugesbrk(T5_ARENA)) == (char*)-1) {
+     6b7:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+     6be:	e8 cb 08 00 00       	call   f8e <hugesbrk>
+     6c3:	83 c4 10             	add    $0x10,%esp
+     6c6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6c9:	74 66                	je     731 <test5+0x144>
+    printf(1, "cannot hugesbrk %d bytes\n", T5_ARENA);
+    return;
+  }
+  t = t5scan(p);
+     6cb:	83 ec 0c             	sub    $0xc,%esp
+     6ce:	50                   	push   %eax
+     6cf:	e8 ac fe ff ff       	call   580 <t5scan>
+  printf(1, "%d passes over %d 4MB pages took %d ticks\n",
+     6d4:	89 04 24             	mov    %eax,(%esp)
+     6d7:	6a 02                	push   $0x2
+     6d9:	68 c8 00 00 00       	push   $0xc8
+     6de:	68 d8 16 00 00       	push   $0x16d8
+     6e3:	6a 01                	push   $0x1
+     6e5:	e8 54 09 00 00       	call   103e <printf>
+         T5_PASSES, T5_ARENA/(4*1024*1024), t);
+  sbrk(brk - sbrk(0));
+     6ea:	83 c4 14             	add    $0x14,%esp
+     6ed:	6a 00                	push   $0x0
+     6ef:	e8 fa 07 00 00       	call   eee <sbrk>
+     6f4:	29 c6                	sub    %eax,%esi
+     6f6:	89 34 24             	mov    %esi,(%esp)
+     6f9:	e8 f0 07 00 00       	call   eee <sbrk>
+  printf(1, "\n> test 5 complete\n");
+     6fe:	83 c4 08             	add    $0x8,%esp
+     701:	68 af 14 00 00       	push   $0x14af
+     706:	6a 01                	push   $0x1
+     708:	e8 31 09 00 00       	call   103e <printf>
+     70d:	83 c4 10             	add    $0x10,%esp
+}
+     710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     713:	5b                   	pop    %ebx
+     714:	5e                   	pop    %esi
+     715:	5f                   	pop    %edi
+     716:	5d                   	pop    %ebp
+     717:	c3                   	ret
+    printf(1, "cannot sbrk %d bytes\n", T5_ARENA);
+     718:	83 ec 04             	sub    $0x4,%esp
+     71b:	68 00 00 80 00       	push   $0x800000
+     720:	68 7f 14 00 00       	push   $0x147f
+     725:	6a 01                	push   $0x1
+     727:	e8 12 09 00 00       	call   103e <printf>
+    return;
+     72c:	83 c4 10             	add    $0x10,%esp
+     72f:	eb df                	jmp    710 <test5+0x123>
+    printf(1, "cannot hugesbrk %d bytes\n", T5_ARENA);
+     731:	83 ec 04             	sub    $0x4,%esp
+     734:	68 00 00 80 00       	push   $0x800000
+     739:	68 95 14 00 00       	push   $0x1495
+     73e:	6a 01                	push   $0x1
+     740:	e8 f9 08 00 00       	call   103e <printf>
+    return;
+     745:	83 c4 10             	add    $0x10,%esp
+     748:	eb c6                	jmp    710 <test5+0x123>
+
+0000074a <test6>:
+// page table or two for the user half.
+#define T6_RUNS 200
+#define T6_PROCS 20
+
+void
+test6(void) {
+     74a:	55                   	push   %ebp
+     74b:	89 e5                	mov    %esp,%ebp
+     74d:	57                   	push   %edi
+     74e:	56                   	push   %esi
+     74f:	53                   	push   %ebx
+     750:	81 ec c4 00 00 00    	sub    $0xc4,%esp
+  struct vmstats before, after;
+  char *argv[] = {"vmstress", "99", 0};
+     756:	c7 85 44 ff ff ff d2 	movl   $0x13d2,-0xbc(%ebp)
+     75d:	13 00 00 
+     760:	c7 85 48 ff ff ff db 	movl   $0x13db,-0xb8(%ebp)
+     767:	13 00 00 
+     76a:	c7 85 4c ff ff ff 00 	movl   $0x0,-0xb4(%ebp)
+     771:	00 00 00 
+  char *argv98[] = {"vmstress", "98", 0};
+     774:	c7 85 38 ff ff ff d2 	movl   $0x13d2,-0xc8(%ebp)
+     77b:	13 00 00 
+     77e:	c7 85 3c ff ff ff 16 	movl   $0x1416,-0xc4(%ebp)
+     785:	14 00 00 
+     788:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%ebp)
+     78f:	00 00 00 
+  int start, t, n, pid;
+
+  printf(1, "\n> starting test 6\n");
+     792:	68 c3 14 00 00       	push   $0x14c3
+     797:	6a 01                	push   $0x1
+     799:	e8 a0 08 00 00       	call   103e <printf>
+  vmstats(&before);
+     79e:	8d 45 9c             	lea    -0x64(%ebp),%eax
+     7a1:	89 04 24             	mov    %eax,(%esp)
+     7a4:	e8 dd 07 00 00       	call   f86 <vmstats>
+  start = uptime();
+     7a9:	e8 50 07 00 00       	call   efe <uptime>
+     7ae:	89 c6                	mov    %eax,%esi
+     7b0:	83 c4 10             	add    $0x10,%esp
+  for(n = 0;n < T6_RUNS;n++) {
+     7b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int pid = fork();
+     7b8:	e8 a1 06 00 00       	call   e5e <fork>
+    if(pid == 0) {
+     7bd:	85 c0                	test   %eax,%eax
+     7bf:	0f 84 d6 00 00 00    	je     89b <test6+0x151>
+      exec(argv[0], argv);
+      exit();
+    }
+    if(pid < 0) break;
+     7c5:	78 10                	js     7d7 <test6+0x8d>
+    wait();
+     7c7:	e8 a2 06 00 00       	call   e6e <wait>
+  for(n = 0;n < T6_RUNS;n++) {
+     7cc:	83 c3 01             	add    $0x1,%ebx
+     7cf:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+     7d5:	75 e1                	jne    7b8 <test6+0x6e>
+  }
+  t = uptime() - start;
+     7d7:	e8 22 07 00 00       	call   efe <uptime>
+     7dc:	29 f0                	sub    %esi,%eax
+     7de:	89 c7                	mov    %eax,%edi
+  vmstats(&after);
+     7e0:	83 ec 0c             	sub    $0xc,%esp
+     7e3:	8d b5 50 ff ff ff    	lea    -0xb0(%ebp),%esi
+     7e9:	56                   	push   %esi
+     7ea:	e8 97 07 00 00       	call   f86 <vmstats>
+  printf(1, "%d fork+exec+exit cycles took %d ticks; "
+     7ef:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+     7f5:	2b 45 b0             	sub    -0x50(%ebp),%eax
+     7f8:	89 04 24             	mov    %eax,(%esp)
+     7fb:	57                   	push   %edi
+     7fc:	53                   	push   %ebx
+     7fd:	68 04 17 00 00       	push   $0x1704
+     802:	6a 01                	push   $0x1
+     804:	e8 35 08 00 00       	call   103e <printf>
+         "%d page table pages left over\n", n, t,
+         after.pgtables - before.pgtables);
+  before = after;
+     809:	8d 7d 9c             	lea    -0x64(%ebp),%edi
+     80c:	b9 13 00 00 00       	mov    $0x13,%ecx
+     811:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     813:	83 c4 20             	add    $0x20,%esp
+  for(n = 0;n < T6_PROCS;n++) {
+     816:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if((pid = fork()) < 0) break;
+     81b:	e8 3e 06 00 00       	call   e5e <fork>
+     820:	85 c0                	test   %eax,%eax
+     822:	0f 88 a7 00 00 00    	js     8cf <test6+0x185>
+    if(pid == 0) {
+     828:	0f 84 87 00 00 00    	je     8b5 <test6+0x16b>
+  for(n = 0;n < T6_PROCS;n++) {
+     82e:	83 c3 01             	add    $0x1,%ebx
+     831:	83 fb 14             	cmp    $0x14,%ebx
+     834:	75 e5                	jne    81b <test6+0xd1>
+      exec(argv98[0], argv98);
+      exit();
+    }
+  }
+  sleep(T4_HOLD/4);
+     836:	83 ec 0c             	sub    $0xc,%esp
+     839:	6a 32                	push   $0x32
+     83b:	e8 b6 06 00 00       	call   ef6 <sleep>
+  vmstats(&after);
+     840:	8d 85 50 ff ff ff    	lea    -0xb0(%ebp),%eax
+     846:	89 04 24             	mov    %eax,(%esp)
+     849:	e8 38 07 00 00       	call   f86 <vmstats>
+     84e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d copies running: %d page table pages, %d per process\n", n,
+         after.pgtables - before.pgtables,
+         n ? (after.pgtables - before.pgtables)/n : 0);
+     851:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+     857:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  printf(1, "%d copies running: %d page table pages, %d per process\n", n,
+     85a:	ba 00 00 00 00       	mov    $0x0,%edx
+     85f:	f7 f3                	div    %ebx
+     861:	83 ec 0c             	sub    $0xc,%esp
+     864:	50                   	push   %eax
+     865:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+     86b:	2b 45 b0             	sub    -0x50(%ebp),%eax
+     86e:	50                   	push   %eax
+     86f:	53                   	push   %ebx
+     870:	68 4c 17 00 00       	push   $0x174c
+     875:	6a 01                	push   $0x1
+     877:	e8 c2 07 00 00       	call   103e <printf>
+  waitall();
+     87c:	83 c4 20             	add    $0x20,%esp
+     87f:	e8 7c f7 ff ff       	call   0 <waitall>
+  printf(1, "\n> test 6 complete\n");
+     884:	83 ec 08             	sub    $0x8,%esp
+     887:	68 d7 14 00 00       	push   $0x14d7
+     88c:	6a 01                	push   $0x1
+     88e:	e8 ab 07 00 00       	call   103e <printf>
+}
+     893:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     896:	5b                   	pop    %ebx
+     897:	5e                   	pop    %esi
+     898:	5f                   	pop    %edi
+     899:	5d                   	pop    %ebp
+     89a:	c3                   	ret
+      exec(argv[0], argv);
+     89b:	83 ec 08             	sub    $0x8,%esp
+     89e:	8d 85 44 ff ff ff    	lea    -0xbc(%ebp),%eax
+     8a4:	50                   	push   %eax
+     8a5:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+     8ab:	e8 ee 05 00 00       	call   e9e <exec>
+      exit();
+     8b0:	e8 b1 05 00 00       	call   e66 <exit>
+      exec(argv98[0], argv98);
+     8b5:	83 ec 08             	sub    $0x8,%esp
+     8b8:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+     8be:	50                   	push   %eax
+     8bf:	ff b5 38 ff ff ff    	push   -0xc8(%ebp)
+     8c5:	e8 d4 05 00 00       	call   e9e <exec>
+      exit();
+     8ca:	e8 97 05 00 00       	call   e66 <exit>
+  sleep(T4_HOLD/4);
+     8cf:	83 ec 0c             	sub    $0xc,%esp
+     8d2:	6a 32                	push   $0x32
+     8d4:	e8 1d 06 00 00       	call   ef6 <sleep>
+  vmstats(&after);
+     8d9:	8d 85 50 ff ff ff    	lea    -0xb0(%ebp),%eax
+     8df:	89 04 24             	mov    %eax,(%esp)
+     8e2:	e8 9f 06 00 00       	call   f86 <vmstats>
+  printf(1, "%d copies running: %d page table pages, %d per process\n", n,
+     8e7:	83 c4 10             	add    $0x10,%esp
+     8ea:	85 db                	test   %ebx,%ebx
+     8ec:	0f 85 5f ff ff ff    	jne    851 <test6+0x107>
+     8f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f7:	e9 65 ff ff ff       	jmp    861 <test6+0x117>
+
+000008fc <t7work>:
+#define T7_PAGES 256
+#define T7_ROUNDS 50
+#define T7_MAXWORKERS 8
+
+void
+t7work(void) {
+     8fc:	55                   	push   %ebp
+     8fd:	89 e5                	mov    %esp,%ebp
+     8ff:	53                   	push   %ebx
+     900:	83 ec 04             	sub    $0x4,%esp
+     903:	bb 32 00 00 00       	mov    $0x32,%ebx
+  for(int r = 0;r < T7_ROUNDS;r++) {
+    char *p = sbrk(T7_PAGES*4096);
+     908:	83 ec 0c             	sub    $0xc,%esp
+     90b:	68 00 00 10 00       	push   $0x100000
+     910:	e8 d9 05 00 00       	call   eee <sbrk>
+    if(p == (char*)-1) exit();
+     915:	83 c4 10             	add    $0x10,%esp
+     918:	83 f8 ff             	cmp    $0xffffffff,%eax
+     91b:	74 2e                	je     94b <t7work+0x4f>
+     91d:	89 c2                	mov    %eax,%edx
+     91f:	05 00 00 10 00       	add    $0x100000,%eax
+    for(int i = 0;i < T7_PAGES;i++)
+      p[i*4096] = 1;
+     924:	c6 02 01             	movb   $0x1,(%edx)
+    for(int i = 0;i < T7_PAGES;i++)
+     927:	81 c2 00 10 00 00    	add    $0x1000,%edx
+     92d:	39 c2                	cmp    %eax,%edx
+     92f:	75 f3                	jne    924 <t7work+0x28>
+    sbrk(-T7_PAGES*4096);
+     931:	83 ec 0c             	sub    $0xc,%esp
+     934:	68 00 00 f0 ff       	push   $0xfff00000
+     939:	e8 b0 05 00 00       	call   eee <sbrk>
+  for(int r = 0;r < T7_ROUNDS;r++) {
+     93e:	83 c4 10             	add    $0x10,%esp
+     941:	83 eb 01             	sub    $0x1,%ebx
+     944:	75 c2                	jne    908 <t7work+0xc>
+  }
+  exit();
+     946:	e8 1b 05 00 00       	call   e66 <exit>
+    if(p == (char*)-1) exit();
+     94b:	e8 16 05 00 00       	call   e66 <exit>
+
+00000950 <test7>:
+}
+
+void
+test7(void) {
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 14             	sub    $0x14,%esp
+  int start, t;
+
+  printf(1, "\n> starting test 7\n");
+     959:	68 eb 14 00 00       	push   $0x14eb
+     95e:	6a 01                	push   $0x1
+     960:	e8 d9 06 00 00       	call   103e <printf>
+     965:	83 c4 10             	add    $0x10,%esp
+  for(int n = 1;n <= T7_MAXWORKERS;n *= 2) {
+     968:	be 01 00 00 00       	mov    $0x1,%esi
+    start = uptime();
+     96d:	e8 8c 05 00 00       	call   efe <uptime>
+     972:	89 c7                	mov    %eax,%edi
+    for(int i = 0;i < n;i++)
+     974:	85 f6                	test   %esi,%esi
+     976:	7e 15                	jle    98d <test7+0x3d>
+     978:	bb 00 00 00 00       	mov    $0x0,%ebx
+      if(fork() == 0) t7work();
+     97d:	e8 dc 04 00 00       	call   e5e <fork>
+     982:	85 c0                	test   %eax,%eax
+     984:	74 4f                	je     9d5 <test7+0x85>
+    for(int i = 0;i < n;i++)
+     986:	83 c3 01             	add    $0x1,%ebx
+     989:	39 f3                	cmp    %esi,%ebx
+     98b:	75 f0                	jne    97d <test7+0x2d>
+    waitall();
+     98d:	e8 6e f6 ff ff       	call   0 <waitall>
+    t = uptime() - start;
+     992:	e8 67 05 00 00       	call   efe <uptime>
+    printf(1, "%d workers: %d pages in %d ticks\n",
+     997:	83 ec 0c             	sub    $0xc,%esp
+    t = uptime() - start;
+     99a:	29 f8                	sub    %edi,%eax
+    printf(1, "%d workers: %d pages in %d ticks\n",
+     99c:	50                   	push   %eax
+     99d:	69 c6 00 32 00 00    	imul   $0x3200,%esi,%eax
+     9a3:	50                   	push   %eax
+     9a4:	56                   	push   %esi
+     9a5:	68 84 17 00 00       	push   $0x1784
+     9aa:	6a 01                	push   $0x1
+     9ac:	e8 8d 06 00 00       	call   103e <printf>
+  for(int n = 1;n <= T7_MAXWORKERS;n *= 2) {
+     9b1:	01 f6                	add    %esi,%esi
+     9b3:	83 c4 20             	add    $0x20,%esp
+     9b6:	83 fe 08             	cmp    $0x8,%esi
+     9b9:	7e b2                	jle    96d <test7+0x1d>
+           n, n*T7_PAGES*T7_ROUNDS, t);
+  }
+  printf(1, "\n> test 7 complete\n");
+     9bb:	83 ec 08             	sub    $0x8,%esp
+     9be:	68 ff 14 00 00       	push   $0x14ff
+     9c3:	6a 01                	push   $0x1
+     9c5:	e8 74 06 00 00       	call   103e <printf>
+}
+     9ca:	83 c4 10             	add    $0x10,%esp
+     9cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d0:	5b                   	pop    %ebx
+     9d1:	5e                   	pop    %esi
+     9d2:	5f                   	pop    %edi
+     9d3:	5d                   	pop    %ebp
+     9d4:	c3                   	ret
+      if(fork() == 0) t7work();
+     9d5:	e8 22 ff ff ff       	call   8fc <t7work>
+
+000009da <t8print>:
+#define T8_WORKERS 8
+#define T8_PAGES 1024
+#define T8_HOLD 100
+
+void
+t8print(char *when) {
+     9da:	55                   	push   %ebp
+     9db:	89 e5                	mov    %esp,%ebp
+     9dd:	56                   	push   %esi
+     9de:	53                   	push   %ebx
+     9df:	83 ec 5c             	sub    $0x5c,%esp
+  struct vmstats vs;
+
+  vmstats(&vs);
+     9e2:	8d 45 ac             	lea    -0x54(%ebp),%eax
+     9e5:	50                   	push   %eax
+     9e6:	e8 9b 05 00 00       	call   f86 <vmstats>
+  printf(1, "%s: %d free pages, %d cached;", when, vs.freepages,
+     9eb:	83 c4 04             	add    $0x4,%esp
+     9ee:	ff 75 f4             	push   -0xc(%ebp)
+     9f1:	ff 75 c4             	push   -0x3c(%ebp)
+     9f4:	ff 75 08             	push   0x8(%ebp)
+     9f7:	68 13 15 00 00       	push   $0x1513
+     9fc:	6a 01                	push   $0x1
+     9fe:	e8 3b 06 00 00       	call   103e <printf>
+         vs.cachedpages);
+  for(int o = 0;o < NKORDER;o++)
+     a03:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+     a06:	8d 75 f4             	lea    -0xc(%ebp),%esi
+     a09:	83 c4 20             	add    $0x20,%esp
+    printf(1, " %d", vs.freeblocks[o]);
+     a0c:	83 ec 04             	sub    $0x4,%esp
+     a0f:	ff 33                	push   (%ebx)
+     a11:	68 31 15 00 00       	push   $0x1531
+     a16:	6a 01                	push   $0x1
+     a18:	e8 21 06 00 00       	call   103e <printf>
+  for(int o = 0;o < NKORDER;o++)
+     a1d:	83 c3 04             	add    $0x4,%ebx
+     a20:	83 c4 10             	add    $0x10,%esp
+     a23:	39 f3                	cmp    %esi,%ebx
+     a25:	75 e5                	jne    a0c <t8print+0x32>
+  printf(1, "\n");
+     a27:	83 ec 08             	sub    $0x8,%esp
+     a2a:	68 53 13 00 00       	push   $0x1353
+     a2f:	6a 01                	push   $0x1
+     a31:	e8 08 06 00 00       	call   103e <printf>
+}
+     a36:	83 c4 10             	add    $0x10,%esp
+     a39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a3c:	5b                   	pop    %ebx
+     a3d:	5e                   	pop    %esi
+     a3e:	5d                   	pop    %ebp
+     a3f:	c3                   	ret
+
+00000a40 <t8work>:
+
+void
+t8work(int hold) {
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	83 ec 14             	sub    $0x14,%esp
+  char *p = sbrk(T8_PAGES*4096);
+     a46:	68 00 00 40 00       	push   $0x400000
+     a4b:	e8 9e 04 00 00       	call   eee <sbrk>
+
+  if(p == (char*)-1) exit();
+     a50:	83 c4 10             	add    $0x10,%esp
+     a53:	89 c2                	mov    %eax,%edx
+     a55:	8d 88 00 00 40 00    	lea    0x400000(%eax),%ecx
+     a5b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a5e:	74 1d                	je     a7d <t8work+0x3d>
+  for(int i = 0;i < T8_PAGES;i++)
+    p[i*4096] = 1;
+     a60:	c6 02 01             	movb   $0x1,(%edx)
+  for(int i = 0;i < T8_PAGES;i++)
+     a63:	81 c2 00 10 00 00    	add    $0x1000,%edx
+     a69:	39 ca                	cmp    %ecx,%edx
+     a6b:	75 f3                	jne    a60 <t8work+0x20>
+  sleep(hold);
+     a6d:	83 ec 0c             	sub    $0xc,%esp
+     a70:	ff 75 08             	push   0x8(%ebp)
+     a73:	e8 7e 04 00 00       	call   ef6 <sleep>
+  exit();
+     a78:	e8 e9 03 00 00       	call   e66 <exit>
+  if(p == (char*)-1) exit();
+     a7d:	e8 e4 03 00 00       	call   e66 <exit>
+
+00000a82 <test8>:
+}
+
+void
+test8(void) {
+     a82:	55                   	push   %ebp
+     a83:	89 e5                	mov    %esp,%ebp
+     a85:	53                   	push   %ebx
+     a86:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "\n> starting test 8\n");
+     a89:	68 35 15 00 00       	push   $0x1535
+     a8e:	6a 01                	push   $0x1
+     a90:	e8 a9 05 00 00       	call   103e <printf>
+  printf(1, "free blocks of 1, 2, 4, ... 1024 pages\n");
+     a95:	83 c4 08             	add    $0x8,%esp
+     a98:	68 a8 17 00 00       	push   $0x17a8
+     a9d:	6a 01                	push   $0x1
+     a9f:	e8 9a 05 00 00       	call   103e <printf>
+  t8print("before");
+     aa4:	c7 04 24 49 15 00 00 	movl   $0x1549,(%esp)
+     aab:	e8 2a ff ff ff       	call   9da <t8print>
+     ab0:	83 c4 10             	add    $0x10,%esp
+  for(int i = 0;i < T8_WORKERS;i++)
+     ab3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(fork() == 0) t8work(i % 2 ? T8_HOLD/4 : T8_HOLD);
+     ab8:	e8 a1 03 00 00       	call   e5e <fork>
+     abd:	85 c0                	test   %eax,%eax
+     abf:	74 46                	je     b07 <test8+0x85>
+  for(int i = 0;i < T8_WORKERS;i++)
+     ac1:	83 c3 01             	add    $0x1,%ebx
+     ac4:	83 fb 08             	cmp    $0x8,%ebx
+     ac7:	75 ef                	jne    ab8 <test8+0x36>
+  sleep(T8_HOLD/2);
+     ac9:	83 ec 0c             	sub    $0xc,%esp
+     acc:	6a 32                	push   $0x32
+     ace:	e8 23 04 00 00       	call   ef6 <sleep>
+  t8print("loaded");
+     ad3:	c7 04 24 50 15 00 00 	movl   $0x1550,(%esp)
+     ada:	e8 fb fe ff ff       	call   9da <t8print>
+  waitall();
+     adf:	e8 1c f5 ff ff       	call   0 <waitall>
+  t8print("after");
+     ae4:	c7 04 24 57 15 00 00 	movl   $0x1557,(%esp)
+     aeb:	e8 ea fe ff ff       	call   9da <t8print>
+  printf(1, "\n> test 8 complete\n");
+     af0:	83 c4 08             	add    $0x8,%esp
+     af3:	68 5d 15 00 00       	push   $0x155d
+     af8:	6a 01                	push   $0x1
+     afa:	e8 3f 05 00 00       	call   103e <printf>
+}
+     aff:	83 c4 10             	add    $0x10,%esp
+     b02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b05:	c9                   	leave
+     b06:	c3                   	ret
+    if(fork() == 0) t8work(i % 2 ? T8_HOLD/4 : T8_HOLD);
+     b07:	83 e3 01             	and    $0x1,%ebx
+     b0a:	83 fb 01             	cmp    $0x1,%ebx
+     b0d:	19 c0                	sbb    %eax,%eax
+     b0f:	83 e0 4b             	and    $0x4b,%eax
+     b12:	83 c0 19             	add    $0x19,%eax
+     b15:	83 ec 0c             	sub    $0xc,%esp
+     b18:	50                   	push   %eax
+     b19:	e8 22 ff ff ff       	call   a40 <t8work>
+
+00000b1e <main>:
+
+int
+main(int argc, char **argv) {
+     b1e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     b22:	83 e4 f0             	and    $0xfffffff0,%esp
+     b25:	ff 71 fc             	push   -0x4(%ecx)
+     b28:	55                   	push   %ebp
+     b29:	89 e5                	mov    %esp,%ebp
+     b2b:	57                   	push   %edi
+     b2c:	56                   	push   %esi
+     b2d:	53                   	push   %ebx
+     b2e:	51                   	push   %ecx
+     b2f:	83 ec 18             	sub    $0x18,%esp
+     b32:	8b 41 04             	mov    0x4(%ecx),%eax
+  int test = 0;
+     b35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if(argc == 2) test = atoi(argv[1]);
+     b3a:	83 39 02             	cmpl   $0x2,(%ecx)
+     b3d:	74 61                	je     ba0 <main+0x82>
+
+  if(test == 1 || test == 0) test1();
+     b3f:	e8 a6 f5 ff ff       	call   ea <test1>
+  if(test == 2 || test == 0) test2();
+     b44:	89 d8                	mov    %ebx,%eax
+     b46:	83 e0 f7             	and    $0xfffffff7,%eax
+     b49:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b4c:	89 df                	mov    %ebx,%edi
+     b4e:	83 e7 fb             	and    $0xfffffffb,%edi
+     b51:	85 db                	test   %ebx,%ebx
+     b53:	0f 94 c0             	sete   %al
+     b56:	89 c6                	mov    %eax,%esi
+     b58:	f7 c3 fd ff ff ff    	test   $0xfffffffd,%ebx
+     b5e:	74 57                	je     bb7 <main+0x99>
+  if(test == 3 || test == 0) test3();
+     b60:	83 fb 03             	cmp    $0x3,%ebx
+     b63:	74 59                	je     bbe <main+0xa0>
+     b65:	89 f0                	mov    %esi,%eax
+     b67:	84 c0                	test   %al,%al
+     b69:	75 53                	jne    bbe <main+0xa0>
+  if(test == 4 || test == 0) test4();
+     b6b:	85 ff                	test   %edi,%edi
+     b6d:	74 56                	je     bc5 <main+0xa7>
+  if(test == 5 || test == 0) test5();
+     b6f:	83 fb 05             	cmp    $0x5,%ebx
+     b72:	74 61                	je     bd5 <main+0xb7>
+     b74:	89 f0                	mov    %esi,%eax
+     b76:	84 c0                	test   %al,%al
+     b78:	75 5b                	jne    bd5 <main+0xb7>
+  if(test == 6 || test == 0) test6();
+     b7a:	83 fb 06             	cmp    $0x6,%ebx
+     b7d:	74 5d                	je     bdc <main+0xbe>
+     b7f:	89 f0                	mov    %esi,%eax
+     b81:	84 c0                	test   %al,%al
+     b83:	75 57                	jne    bdc <main+0xbe>
+  if(test == 7 || test == 0) test7();
+     b85:	83 fb 07             	cmp    $0x7,%ebx
+     b88:	74 59                	je     be3 <main+0xc5>
+     b8a:	89 f0                	mov    %esi,%eax
+     b8c:	84 c0                	test   %al,%al
+     b8e:	75 53                	jne    be3 <main+0xc5>
+  if(test == 8 || test == 0) test8();
+     b90:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     b94:	74 54                	je     bea <main+0xcc>
+  if(test == 98) sleep(T4_HOLD);
+     b96:	83 fb 62             	cmp    $0x62,%ebx
+     b99:	74 56                	je     bf1 <main+0xd3>
+  exit();
+     b9b:	e8 c6 02 00 00       	call   e66 <exit>
+  if(argc == 2) test = atoi(argv[1]);
+     ba0:	83 ec 0c             	sub    $0xc,%esp
+     ba3:	ff 70 04             	push   0x4(%eax)
+     ba6:	e8 ae 01 00 00       	call   d59 <atoi>
+     bab:	89 c3                	mov    %eax,%ebx
+  if(test == 1 || test == 0) test1();
+     bad:	83 c4 10             	add    $0x10,%esp
+     bb0:	83 f8 01             	cmp    $0x1,%eax
+     bb3:	77 8f                	ja     b44 <main+0x26>
+     bb5:	eb 88                	jmp    b3f <main+0x21>
+  if(test == 2 || test == 0) test2();
+     bb7:	e8 de f5 ff ff       	call   19a <test2>
+     bbc:	eb a2                	jmp    b60 <main+0x42>
+  if(test == 3 || test == 0) test3();
+     bbe:	e8 24 f7 ff ff       	call   2e7 <test3>
+     bc3:	eb a6                	jmp    b6b <main+0x4d>
+  if(test == 4 || test == 0) test4();
+     bc5:	e8 3f f8 ff ff       	call   409 <test4>
+  if(test == 5 || test == 0) test5();
+     bca:	83 fb 05             	cmp    $0x5,%ebx
+     bcd:	74 06                	je     bd5 <main+0xb7>
+     bcf:	89 f0                	mov    %esi,%eax
+     bd1:	84 c0                	test   %al,%al
+     bd3:	74 b0                	je     b85 <main+0x67>
+     bd5:	e8 13 fa ff ff       	call   5ed <test5>
+     bda:	eb 9e                	jmp    b7a <main+0x5c>
+  if(test == 6 || test == 0) test6();
+     bdc:	e8 69 fb ff ff       	call   74a <test6>
+     be1:	eb a2                	jmp    b85 <main+0x67>
+  if(test == 7 || test == 0) test7();
+     be3:	e8 68 fd ff ff       	call   950 <test7>
+     be8:	eb a6                	jmp    b90 <main+0x72>
+  if(test == 8 || test == 0) test8();
+     bea:	e8 93 fe ff ff       	call   a82 <test8>
+  if(test == 98) sleep(T4_HOLD);
+     bef:	eb aa                	jmp    b9b <main+0x7d>
+     bf1:	83 ec 0c             	sub    $0xc,%esp
+     bf4:	68 c8 00 00 00       	push   $0xc8
+     bf9:	e8 f8 02 00 00       	call   ef6 <sleep>
+     bfe:	83 c4 10             	add    $0x10,%esp
+     c01:	eb 98                	jmp    b9b <main+0x7d>
+
+00000c03 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     c03:	55                   	push   %ebp
+     c04:	89 e5                	mov    %esp,%ebp
+     c06:	53                   	push   %ebx
+     c07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c12:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     c16:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     c19:	83 c0 01             	add    $0x1,%eax
+     c1c:	84 d2                	test   %dl,%dl
+     c1e:	75 f2                	jne    c12 <strcpy+0xf>
+    ;
+  return os;
+}
+     c20:	89 c8                	mov    %ecx,%eax
+     c22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c25:	c9                   	leave
+     c26:	c3                   	ret
+
+00000c27 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c27:	55                   	push   %ebp
+     c28:	89 e5                	mov    %esp,%ebp
+     c2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     c30:	0f b6 01             	movzbl (%ecx),%eax
+     c33:	84 c0                	test   %al,%al
+     c35:	74 11                	je     c48 <strcmp+0x21>
+     c37:	38 02                	cmp    %al,(%edx)
+     c39:	75 0d                	jne    c48 <strcmp+0x21>
+    p++, q++;
+     c3b:	83 c1 01             	add    $0x1,%ecx
+     c3e:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     c41:	0f b6 01             	movzbl (%ecx),%eax
+     c44:	84 c0                	test   %al,%al
+     c46:	75 ef                	jne    c37 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+     c48:	0f b6 c0             	movzbl %al,%eax
+     c4b:	0f b6 12             	movzbl (%edx),%edx
+     c4e:	29 d0                	sub    %edx,%eax
+}
+     c50:	5d                   	pop    %ebp
+     c51:	c3                   	ret
+
+00000c52 <strlen>:
+
+uint
+strlen(char *s)
+{
+     c52:	55                   	push   %ebp
+     c53:	89 e5                	mov    %esp,%ebp
+     c55:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c58:	80 3a 00             	cmpb   $0x0,(%edx)
+     c5b:	74 14                	je     c71 <strlen+0x1f>
+     c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c62:	83 c0 01             	add    $0x1,%eax
+     c65:	89 c1                	mov    %eax,%ecx
+     c67:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     c6b:	75 f5                	jne    c62 <strlen+0x10>
+    ;
+  return n;
+}
+     c6d:	89 c8                	mov    %ecx,%eax
+     c6f:	5d                   	pop    %ebp
+     c70:	c3                   	ret
+  for(n = 0; s[n]; n++)
+     c71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+     c76:	eb f5                	jmp    c6d <strlen+0x1b>
+
+00000c78 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c78:	55                   	push   %ebp
+     c79:	89 e5                	mov    %esp,%ebp
+     c7b:	57                   	push   %edi
+     c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c7f:	89 d7                	mov    %edx,%edi
+     c81:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c84:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c87:	fc                   	cld
+     c88:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     c8a:	89 d0                	mov    %edx,%eax
+     c8c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     c8f:	c9                   	leave
+     c90:	c3                   	ret
+
+00000c91 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     c91:	55                   	push   %ebp
+     c92:	89 e5                	mov    %esp,%ebp
+     c94:	8b 45 08             	mov    0x8(%ebp),%eax
+     c97:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     c9b:	0f b6 10             	movzbl (%eax),%edx
+     c9e:	84 d2                	test   %dl,%dl
+     ca0:	74 15                	je     cb7 <strchr+0x26>
+    if(*s == c)
+     ca2:	38 d1                	cmp    %dl,%cl
+     ca4:	74 0f                	je     cb5 <strchr+0x24>
+  for(; *s; s++)
+     ca6:	83 c0 01             	add    $0x1,%eax
+     ca9:	0f b6 10             	movzbl (%eax),%edx
+     cac:	84 d2                	test   %dl,%dl
+     cae:	75 f2                	jne    ca2 <strchr+0x11>
+      return (char*)s;
+  return 0;
+     cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     cb5:	5d                   	pop    %ebp
+     cb6:	c3                   	ret
+  return 0;
+     cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cbc:	eb f7                	jmp    cb5 <strchr+0x24>
+
+00000cbe <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     cbe:	55                   	push   %ebp
+     cbf:	89 e5                	mov    %esp,%ebp
+     cc1:	57                   	push   %edi
+     cc2:	56                   	push   %esi
+     cc3:	53                   	push   %ebx
+     cc4:	83 ec 2c             	sub    $0x2c,%esp
+     cc7:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     cca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+     ccf:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+     cd2:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     cd5:	83 c3 01             	add    $0x1,%ebx
+     cd8:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     cdb:	7d 27                	jge    d04 <gets+0x46>
+    cc = read(0, &c, 1);
+     cdd:	83 ec 04             	sub    $0x4,%esp
+     ce0:	6a 01                	push   $0x1
+     ce2:	57                   	push   %edi
+     ce3:	6a 00                	push   $0x0
+     ce5:	e8 94 01 00 00       	call   e7e <read>
+    if(cc < 1)
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	85 c0                	test   %eax,%eax
+     cef:	7e 13                	jle    d04 <gets+0x46>
+      break;
+    buf[i++] = c;
+     cf1:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     cf5:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     cf9:	3c 0a                	cmp    $0xa,%al
+     cfb:	74 04                	je     d01 <gets+0x43>
+     cfd:	3c 0d                	cmp    $0xd,%al
+     cff:	75 d1                	jne    cd2 <gets+0x14>
+  for(i=0; i+1 < max; ){
+     d01:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+     d04:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     d07:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+     d0b:	89 f0                	mov    %esi,%eax
+     d0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d10:	5b                   	pop    %ebx
+     d11:	5e                   	pop    %esi
+     d12:	5f                   	pop    %edi
+     d13:	5d                   	pop    %ebp
+     d14:	c3                   	ret
+
+00000d15 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     d15:	55                   	push   %ebp
+     d16:	89 e5                	mov    %esp,%ebp
+     d18:	56                   	push   %esi
+     d19:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d1a:	83 ec 08             	sub    $0x8,%esp
+     d1d:	6a 00                	push   $0x0
+     d1f:	ff 75 08             	push   0x8(%ebp)
+     d22:	e8 7f 01 00 00       	call   ea6 <open>
+  if(fd < 0)
+     d27:	83 c4 10             	add    $0x10,%esp
+     d2a:	85 c0                	test   %eax,%eax
+     d2c:	78 24                	js     d52 <stat+0x3d>
+     d2e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     d30:	83 ec 08             	sub    $0x8,%esp
+     d33:	ff 75 0c             	push   0xc(%ebp)
+     d36:	50                   	push   %eax
+     d37:	e8 82 01 00 00       	call   ebe <fstat>
+     d3c:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d3e:	89 1c 24             	mov    %ebx,(%esp)
+     d41:	e8 48 01 00 00       	call   e8e <close>
+  return r;
+     d46:	83 c4 10             	add    $0x10,%esp
+}
+     d49:	89 f0                	mov    %esi,%eax
+     d4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d4e:	5b                   	pop    %ebx
+     d4f:	5e                   	pop    %esi
+     d50:	5d                   	pop    %ebp
+     d51:	c3                   	ret
+    return -1;
+     d52:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d57:	eb f0                	jmp    d49 <stat+0x34>
+
+00000d59 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     d59:	55                   	push   %ebp
+     d5a:	89 e5                	mov    %esp,%ebp
+     d5c:	56                   	push   %esi
+     d5d:	53                   	push   %ebx
+     d5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     d61:	0f b6 0a             	movzbl (%edx),%ecx
+     d64:	80 f9 20             	cmp    $0x20,%cl
+     d67:	75 0b                	jne    d74 <atoi+0x1b>
+     d69:	83 c2 01             	add    $0x1,%edx
+     d6c:	0f b6 0a             	movzbl (%edx),%ecx
+     d6f:	80 f9 20             	cmp    $0x20,%cl
+     d72:	74 f5                	je     d69 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     d74:	80 f9 2d             	cmp    $0x2d,%cl
+     d77:	74 3c                	je     db5 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+     d79:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     d7c:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     d81:	f6 c1 fd             	test   $0xfd,%cl
+     d84:	74 34                	je     dba <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+     d86:	0f b6 0a             	movzbl (%edx),%ecx
+     d89:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     d8c:	3c 09                	cmp    $0x9,%al
+     d8e:	77 2f                	ja     dbf <atoi+0x66>
+     d90:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+     d95:	83 c2 01             	add    $0x1,%edx
+     d98:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     d9b:	0f be c9             	movsbl %cl,%ecx
+     d9e:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+     da2:	0f b6 0a             	movzbl (%edx),%ecx
+     da5:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     da8:	3c 09                	cmp    $0x9,%al
+     daa:	76 e9                	jbe    d95 <atoi+0x3c>
+  return sign*n;
+     dac:	89 f0                	mov    %esi,%eax
+     dae:	0f af c3             	imul   %ebx,%eax
+}
+     db1:	5b                   	pop    %ebx
+     db2:	5e                   	pop    %esi
+     db3:	5d                   	pop    %ebp
+     db4:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+     db5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     dba:	83 c2 01             	add    $0x1,%edx
+     dbd:	eb c7                	jmp    d86 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+     dbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+     dc4:	eb e6                	jmp    dac <atoi+0x53>
+
+00000dc6 <atoo>:
+
+int
+atoo(const char *s)
+{
+     dc6:	55                   	push   %ebp
+     dc7:	89 e5                	mov    %esp,%ebp
+     dc9:	56                   	push   %esi
+     dca:	53                   	push   %ebx
+     dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     dce:	0f b6 0a             	movzbl (%edx),%ecx
+     dd1:	80 f9 20             	cmp    $0x20,%cl
+     dd4:	75 0b                	jne    de1 <atoo+0x1b>
+     dd6:	83 c2 01             	add    $0x1,%edx
+     dd9:	0f b6 0a             	movzbl (%edx),%ecx
+     ddc:	80 f9 20             	cmp    $0x20,%cl
+     ddf:	74 f5                	je     dd6 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     de1:	80 f9 2d             	cmp    $0x2d,%cl
+     de4:	74 3a                	je     e20 <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+     de6:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+     de9:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     dee:	f6 c1 fd             	test   $0xfd,%cl
+     df1:	74 32                	je     e25 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+     df3:	0f b6 0a             	movzbl (%edx),%ecx
+     df6:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     df9:	80 fb 07             	cmp    $0x7,%bl
+     dfc:	77 2c                	ja     e2a <atoo+0x64>
+     dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+     e03:	83 c2 01             	add    $0x1,%edx
+     e06:	0f be c9             	movsbl %cl,%ecx
+     e09:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+     e0d:	0f b6 0a             	movzbl (%edx),%ecx
+     e10:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     e13:	3c 07                	cmp    $0x7,%al
+     e15:	76 ec                	jbe    e03 <atoo+0x3d>
+  return sign*n;
+     e17:	89 f0                	mov    %esi,%eax
+     e19:	0f af c3             	imul   %ebx,%eax
+}
+     e1c:	5b                   	pop    %ebx
+     e1d:	5e                   	pop    %esi
+     e1e:	5d                   	pop    %ebp
+     e1f:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+     e20:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     e25:	83 c2 01             	add    $0x1,%edx
+     e28:	eb c9                	jmp    df3 <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+     e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e2f:	eb e6                	jmp    e17 <atoo+0x51>
+
+00000e31 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e31:	55                   	push   %ebp
+     e32:	89 e5                	mov    %esp,%ebp
+     e34:	56                   	push   %esi
+     e35:	53                   	push   %ebx
+     e36:	8b 75 08             	mov    0x8(%ebp),%esi
+     e39:	8b 55 0c             	mov    0xc(%ebp),%edx
+     e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     e3f:	85 db                	test   %ebx,%ebx
+     e41:	7e 15                	jle    e58 <memmove+0x27>
+     e43:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+     e45:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+     e47:	83 c2 01             	add    $0x1,%edx
+     e4a:	83 c0 01             	add    $0x1,%eax
+     e4d:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+     e51:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+     e54:	39 c3                	cmp    %eax,%ebx
+     e56:	75 ef                	jne    e47 <memmove+0x16>
+  return vdst;
+}
+     e58:	89 f0                	mov    %esi,%eax
+     e5a:	5b                   	pop    %ebx
+     e5b:	5e                   	pop    %esi
+     e5c:	5d                   	pop    %ebp
+     e5d:	c3                   	ret
+
+00000e5e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     e5e:	b8 01 00 00 00       	mov    $0x1,%eax
+     e63:	cd 40                	int    $0x40
+     e65:	c3                   	ret
+
+00000e66 <exit>:
+SYSCALL(exit)
+     e66:	b8 02 00 00 00       	mov    $0x2,%eax
+     e6b:	cd 40                	int    $0x40
+     e6d:	c3                   	ret
+
+00000e6e <wait>:
+SYSCALL(wait)
+     e6e:	b8 03 00 00 00       	mov    $0x3,%eax
+     e73:	cd 40                	int    $0x40
+     e75:	c3                   	ret
+
+00000e76 <pipe>:
+SYSCALL(pipe)
+     e76:	b8 04 00 00 00       	mov    $0x4,%eax
+     e7b:	cd 40                	int    $0x40
+     e7d:	c3                   	ret
+
+00000e7e <read>:
+SYSCALL(read)
+     e7e:	b8 05 00 00 00       	mov    $0x5,%eax
+     e83:	cd 40                	int    $0x40
+     e85:	c3                   	ret
+
+00000e86 <write>:
+SYSCALL(write)
+     e86:	b8 10 00 00 00       	mov    $0x10,%eax
+     e8b:	cd 40                	int    $0x40
+     e8d:	c3                   	ret
+
+00000e8e <close>:
+SYSCALL(close)
+     e8e:	b8 15 00 00 00       	mov    $0x15,%eax
+     e93:	cd 40                	int    $0x40
+     e95:	c3                   	ret
+
+00000e96 <kill>:
+SYSCALL(kill)
+     e96:	b8 06 00 00 00       	mov    $0x6,%eax
+     e9b:	cd 40                	int    $0x40
+     e9d:	c3                   	ret
+
+00000e9e <exec>:
+SYSCALL(exec)
+     e9e:	b8 07 00 00 00       	mov    $0x7,%eax
+     ea3:	cd 40                	int    $0x40
+     ea5:	c3                   	ret
+
+00000ea6 <open>:
+SYSCALL(open)
+     ea6:	b8 0f 00 00 00       	mov    $0xf,%eax
+     eab:	cd 40                	int    $0x40
+     ead:	c3                   	ret
+
+00000eae <mknod>:
+SYSCALL(mknod)
+     eae:	b8 11 00 00 00       	mov    $0x11,%eax
+     eb3:	cd 40                	int    $0x40
+     eb5:	c3                   	ret
+
+00000eb6 <unlink>:
+SYSCALL(unlink)
+     eb6:	b8 12 00 00 00       	mov    $0x12,%eax
+     ebb:	cd 40                	int    $0x40
+     ebd:	c3                   	ret
+
+00000ebe <fstat>:
+SYSCALL(fstat)
+     ebe:	b8 08 00 00 00       	mov    $0x8,%eax
+     ec3:	cd 40                	int    $0x40
+     ec5:	c3                   	ret
+
+00000ec6 <link>:
+SYSCALL(link)
+     ec6:	b8 13 00 00 00       	mov    $0x13,%eax
+     ecb:	cd 40                	int    $0x40
+     ecd:	c3                   	ret
+
+00000ece <mkdir>:
+SYSCALL(mkdir)
+     ece:	b8 14 00 00 00       	mov    $0x14,%eax
+     ed3:	cd 40                	int    $0x40
+     ed5:	c3                   	ret
+
+00000ed6 <chdir>:
+SYSCALL(chdir)
+     ed6:	b8 09 00 00 00       	mov    $0x9,%eax
+     edb:	cd 40                	int    $0x40
+     edd:	c3                   	ret
+
+00000ede <dup>:
+SYSCALL(dup)
+     ede:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ee3:	cd 40                	int    $0x40
+     ee5:	c3                   	ret
+
+00000ee6 <getpid>:
+SYSCALL(getpid)
+     ee6:	b8 0b 00 00 00       	mov    $0xb,%eax
+     eeb:	cd 40                	int    $0x40
+     eed:	c3                   	ret
+
+00000eee <sbrk>:
+SYSCALL(sbrk)
+     eee:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ef3:	cd 40                	int    $0x40
+     ef5:	c3                   	ret
+
+00000ef6 <sleep>:
+SYSCALL(sleep)
+     ef6:	b8 0d 00 00 00       	mov    $0xd,%eax
+     efb:	cd 40                	int    $0x40
+     efd:	c3                   	ret
+
+00000efe <uptime>:
+SYSCALL(uptime)
+     efe:	b8 0e 00 00 00       	mov    $0xe,%eax
+     f03:	cd 40                	int    $0x40
+     f05:	c3                   	ret
+
+00000f06 <halt>:
+SYSCALL(halt)
+     f06:	b8 16 00 00 00       	mov    $0x16,%eax
+     f0b:	cd 40                	int    $0x40
+     f0d:	c3                   	ret
+
+00000f0e <date>:
+SYSCALL(date)
+     f0e:	b8 17 00 00 00       	mov    $0x17,%eax
+     f13:	cd 40                	int    $0x40
+     f15:	c3                   	ret
+
+00000f16 <getuid>:
+SYSCALL(getuid)
+     f16:	b8 18 00 00 00       	mov    $0x18,%eax
+     f1b:	cd 40                	int    $0x40
+     f1d:	c3                   	ret
+
+00000f1e <getgid>:
+SYSCALL(getgid)
+     f1e:	b8 19 00 00 00       	mov    $0x19,%eax
+     f23:	cd 40                	int    $0x40
+     f25:	c3                   	ret
+
+00000f26 <getppid>:
+SYSCALL(getppid)
+     f26:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     f2b:	cd 40                	int    $0x40
+     f2d:	c3                   	ret
+
+00000f2e <setuid>:
+SYSCALL(setuid)
+     f2e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     f33:	cd 40                	int    $0x40
+     f35:	c3                   	ret
+
+00000f36 <setgid>:
+SYSCALL(setgid)
+     f36:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f3b:	cd 40                	int    $0x40
+     f3d:	c3                   	ret
+
+00000f3e <getprocs>:
+SYSCALL(getprocs)
+     f3e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f43:	cd 40                	int    $0x40
+     f45:	c3                   	ret
+
+00000f46 <setpriority>:
+SYSCALL(setpriority)
+     f46:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f4b:	cd 40                	int    $0x40
+     f4d:	c3                   	ret
+
+00000f4e <getpriority>:
+SYSCALL(getpriority)
+     f4e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f53:	cd 40                	int    $0x40
+     f55:	c3                   	ret
+
+00000f56 <waitpid>:
+SYSCALL(waitpid)
+     f56:	b8 20 00 00 00       	mov    $0x20,%eax
+     f5b:	cd 40                	int    $0x40
+     f5d:	c3                   	ret
+
+00000f5e <setaffinity>:
+SYSCALL(setaffinity)
+     f5e:	b8 21 00 00 00       	mov    $0x21,%eax
+     f63:	cd 40                	int    $0x40
+     f65:	c3                   	ret
+
+00000f66 <getaffinity>:
+SYSCALL(getaffinity)
+     f66:	b8 22 00 00 00       	mov    $0x22,%eax
+     f6b:	cd 40                	int    $0x40
+     f6d:	c3                   	ret
+
+00000f6e <setdeadline>:
+SYSCALL(setdeadline)
+     f6e:	b8 23 00 00 00       	mov    $0x23,%eax
+     f73:	cd 40                	int    $0x40
+     f75:	c3                   	ret
+
+00000f76 <schedctl>:
+SYSCALL(schedctl)
+     f76:	b8 24 00 00 00       	mov    $0x24,%eax
+     f7b:	cd 40                	int    $0x40
+     f7d:	c3                   	ret
+
+00000f7e <spawn>:
+SYSCALL(spawn)
+     f7e:	b8 25 00 00 00       	mov    $0x25,%eax
+     f83:	cd 40                	int    $0x40
+     f85:	c3                   	ret
+
+00000f86 <vmstats>:
+SYSCALL(vmstats)
+     f86:	b8 26 00 00 00       	mov    $0x26,%eax
+     f8b:	cd 40                	int    $0x40
+     f8d:	c3                   	ret
+
+00000f8e <hugesbrk>:
+SYSCALL(hugesbrk)
+     f8e:	b8 27 00 00 00       	mov    $0x27,%eax
+     f93:	cd 40                	int    $0x40
+     f95:	c3                   	ret
+
+00000f96 <setshares>:
+SYSCALL(setshares)
+     f96:	b8 28 00 00 00       	mov    $0x28,%eax
+     f9b:	cd 40                	int    $0x40
+     f9d:	c3                   	ret
+
+00000f9e <getshares>:
+SYSCALL(getshares)
+     f9e:	b8 29 00 00 00       	mov    $0x29,%eax
+     fa3:	cd 40                	int    $0x40
+     fa5:	c3                   	ret
+
+00000fa6 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     fa6:	55                   	push   %ebp
+     fa7:	89 e5                	mov    %esp,%ebp
+     fa9:	57                   	push   %edi
+     faa:	56                   	push   %esi
+     fab:	53                   	push   %ebx
+     fac:	83 ec 3c             	sub    $0x3c,%esp
+     faf:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     fb2:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     fb4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     fb8:	74 79                	je     1033 <printint+0x8d>
+     fba:	85 d2                	test   %edx,%edx
+     fbc:	79 75                	jns    1033 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+     fbe:	89 d1                	mov    %edx,%ecx
+     fc0:	f7 d9                	neg    %ecx
+    neg = 1;
+     fc2:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     fc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     fce:	89 df                	mov    %ebx,%edi
+     fd0:	83 c3 01             	add    $0x1,%ebx
+     fd3:	89 c8                	mov    %ecx,%eax
+     fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+     fda:	f7 f6                	div    %esi
+     fdc:	0f b6 92 30 18 00 00 	movzbl 0x1830(%edx),%edx
+     fe3:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+     fe7:	89 ca                	mov    %ecx,%edx
+     fe9:	89 c1                	mov    %eax,%ecx
+     feb:	39 f2                	cmp    %esi,%edx
+     fed:	73 df                	jae    fce <printint+0x28>
+  if(neg)
+     fef:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+     ff3:	74 08                	je     ffd <printint+0x57>
+    buf[i++] = '-';
+     ff5:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     ffa:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+     ffd:	85 db                	test   %ebx,%ebx
+     fff:	7e 2a                	jle    102b <printint+0x85>
+    1001:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    1004:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+    1008:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+    100b:	0f b6 03             	movzbl (%ebx),%eax
+    100e:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    1011:	83 ec 04             	sub    $0x4,%esp
+    1014:	6a 01                	push   $0x1
+    1016:	57                   	push   %edi
+    1017:	ff 75 c4             	push   -0x3c(%ebp)
+    101a:	e8 67 fe ff ff       	call   e86 <write>
+  while(--i >= 0)
+    101f:	89 d8                	mov    %ebx,%eax
+    1021:	83 eb 01             	sub    $0x1,%ebx
+    1024:	83 c4 10             	add    $0x10,%esp
+    1027:	39 f0                	cmp    %esi,%eax
+    1029:	75 e0                	jne    100b <printint+0x65>
+}
+    102b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    102e:	5b                   	pop    %ebx
+    102f:	5e                   	pop    %esi
+    1030:	5f                   	pop    %edi
+    1031:	5d                   	pop    %ebp
+    1032:	c3                   	ret
+    x = xx;
+    1033:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+    1035:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+    103c:	eb 8b                	jmp    fc9 <printint+0x23>
+
+0000103e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    103e:	55                   	push   %ebp
+    103f:	89 e5                	mov    %esp,%ebp
+    1041:	57                   	push   %edi
+    1042:	56                   	push   %esi
+    1043:	53                   	push   %ebx
+    1044:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1047:	8b 75 0c             	mov    0xc(%ebp),%esi
+    104a:	0f b6 1e             	movzbl (%esi),%ebx
+    104d:	84 db                	test   %bl,%bl
+    104f:	0f 84 9e 01 00 00    	je     11f3 <printf+0x1b5>
+    1055:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    1058:	8d 45 10             	lea    0x10(%ebp),%eax
+    105b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+    105e:	bf 00 00 00 00       	mov    $0x0,%edi
+    1063:	eb 2d                	jmp    1092 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    1065:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    1068:	83 ec 04             	sub    $0x4,%esp
+    106b:	6a 01                	push   $0x1
+    106d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1070:	50                   	push   %eax
+    1071:	ff 75 08             	push   0x8(%ebp)
+    1074:	e8 0d fe ff ff       	call   e86 <write>
+        putc(fd, c);
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	eb 05                	jmp    1083 <printf+0x45>
+      }
+    } else if(state == '%'){
+    107e:	83 ff 25             	cmp    $0x25,%edi
+    1081:	74 1f                	je     10a2 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+    1083:	83 c6 01             	add    $0x1,%esi
+    1086:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+    108a:	84 db                	test   %bl,%bl
+    108c:	0f 84 61 01 00 00    	je     11f3 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+    1092:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1095:	85 ff                	test   %edi,%edi
+    1097:	75 e5                	jne    107e <printf+0x40>
+      if(c == '%'){
+    1099:	83 f8 25             	cmp    $0x25,%eax
+    109c:	75 c7                	jne    1065 <printf+0x27>
+        state = '%';
+    109e:	89 c7                	mov    %eax,%edi
+    10a0:	eb e1                	jmp    1083 <printf+0x45>
+      if(c == 'd'){
+    10a2:	83 f8 25             	cmp    $0x25,%eax
+    10a5:	0f 84 f4 00 00 00    	je     119f <printf+0x161>
+    10ab:	8d 50 9d             	lea    -0x63(%eax),%edx
+    10ae:	83 fa 15             	cmp    $0x15,%edx
+    10b1:	0f 87 09 01 00 00    	ja     11c0 <printf+0x182>
+    10b7:	0f 87 03 01 00 00    	ja     11c0 <printf+0x182>
+    10bd:	ff 24 95 d8 17 00 00 	jmp    *0x17d8(,%edx,4)
+        printint(fd, *ap, 10, 1);
+    10c4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    10c7:	8b 17                	mov    (%edi),%edx
+    10c9:	83 ec 0c             	sub    $0xc,%esp
+    10cc:	6a 01                	push   $0x1
+    10ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    10d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    10d6:	e8 cb fe ff ff       	call   fa6 <printint>
+        ap++;
+    10db:	83 c7 04             	add    $0x4,%edi
+    10de:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    10e1:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    10e4:	bf 00 00 00 00       	mov    $0x0,%edi
+    10e9:	eb 98                	jmp    1083 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+    10eb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    10ee:	8b 17                	mov    (%edi),%edx
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	6a 00                	push   $0x0
+    10f5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    10fa:	8b 45 08             	mov    0x8(%ebp),%eax
+    10fd:	e8 a4 fe ff ff       	call   fa6 <printint>
+        ap++;
+    1102:	83 c7 04             	add    $0x4,%edi
+    1105:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1108:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    110b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1110:	e9 6e ff ff ff       	jmp    1083 <printf+0x45>
+        s = (char*)*ap;
+    1115:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1118:	8b 01                	mov    (%ecx),%eax
+        ap++;
+    111a:	83 c1 04             	add    $0x4,%ecx
+    111d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+    1120:	85 c0                	test   %eax,%eax
+    1122:	74 13                	je     1137 <printf+0xf9>
+        s = (char*)*ap;
+    1124:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+    1126:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+    1129:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+    112e:	84 c0                	test   %al,%al
+    1130:	75 0f                	jne    1141 <printf+0x103>
+    1132:	e9 4c ff ff ff       	jmp    1083 <printf+0x45>
+          s = "(null)";
+    1137:	bb d0 17 00 00       	mov    $0x17d0,%ebx
+        while(*s != 0){
+    113c:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+    1141:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    1144:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    1147:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+    114a:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    114d:	83 ec 04             	sub    $0x4,%esp
+    1150:	6a 01                	push   $0x1
+    1152:	57                   	push   %edi
+    1153:	56                   	push   %esi
+    1154:	e8 2d fd ff ff       	call   e86 <write>
+          s++;
+    1159:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    115c:	0f b6 03             	movzbl (%ebx),%eax
+    115f:	83 c4 10             	add    $0x10,%esp
+    1162:	84 c0                	test   %al,%al
+    1164:	75 e4                	jne    114a <printf+0x10c>
+      state = 0;
+    1166:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1169:	bf 00 00 00 00       	mov    $0x0,%edi
+    116e:	e9 10 ff ff ff       	jmp    1083 <printf+0x45>
+        putc(fd, *ap);
+    1173:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1176:	8b 07                	mov    (%edi),%eax
+    1178:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    117b:	83 ec 04             	sub    $0x4,%esp
+    117e:	6a 01                	push   $0x1
+    1180:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1183:	50                   	push   %eax
+    1184:	ff 75 08             	push   0x8(%ebp)
+    1187:	e8 fa fc ff ff       	call   e86 <write>
+        ap++;
+    118c:	83 c7 04             	add    $0x4,%edi
+    118f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    1192:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1195:	bf 00 00 00 00       	mov    $0x0,%edi
+    119a:	e9 e4 fe ff ff       	jmp    1083 <printf+0x45>
+        putc(fd, c);
+    119f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    11a2:	83 ec 04             	sub    $0x4,%esp
+    11a5:	6a 01                	push   $0x1
+    11a7:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    11aa:	50                   	push   %eax
+    11ab:	ff 75 08             	push   0x8(%ebp)
+    11ae:	e8 d3 fc ff ff       	call   e86 <write>
+    11b3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11b6:	bf 00 00 00 00       	mov    $0x0,%edi
+    11bb:	e9 c3 fe ff ff       	jmp    1083 <printf+0x45>
+        putc(fd, '%');
+    11c0:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    11c4:	83 ec 04             	sub    $0x4,%esp
+    11c7:	6a 01                	push   $0x1
+    11c9:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    11cc:	57                   	push   %edi
+    11cd:	ff 75 08             	push   0x8(%ebp)
+    11d0:	e8 b1 fc ff ff       	call   e86 <write>
+        putc(fd, c);
+    11d5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    11d8:	83 c4 0c             	add    $0xc,%esp
+    11db:	6a 01                	push   $0x1
+    11dd:	57                   	push   %edi
+    11de:	ff 75 08             	push   0x8(%ebp)
+    11e1:	e8 a0 fc ff ff       	call   e86 <write>
+        putc(fd, c);
+    11e6:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11e9:	bf 00 00 00 00       	mov    $0x0,%edi
+    11ee:	e9 90 fe ff ff       	jmp    1083 <printf+0x45>
+    }
+  }
+}
+    11f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11f6:	5b                   	pop    %ebx
+    11f7:	5e                   	pop    %esi
+    11f8:	5f                   	pop    %edi
+    11f9:	5d                   	pop    %ebp
+    11fa:	c3                   	ret
+
+000011fb <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    11fb:	55                   	push   %ebp
+    11fc:	89 e5                	mov    %esp,%ebp
+    11fe:	57                   	push   %edi
+    11ff:	56                   	push   %esi
+    1200:	53                   	push   %ebx
+    1201:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1204:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1207:	a1 18 1d 00 00       	mov    0x1d18,%eax
+    120c:	eb 0c                	jmp    121a <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    120e:	8b 10                	mov    (%eax),%edx
+    1210:	39 d0                	cmp    %edx,%eax
+    1212:	72 04                	jb     1218 <free+0x1d>
+    1214:	39 d1                	cmp    %edx,%ecx
+    1216:	72 10                	jb     1228 <free+0x2d>
+{
+    1218:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    121a:	39 c8                	cmp    %ecx,%eax
+    121c:	73 f0                	jae    120e <free+0x13>
+    121e:	8b 10                	mov    (%eax),%edx
+    1220:	39 d1                	cmp    %edx,%ecx
+    1222:	72 04                	jb     1228 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1224:	39 d0                	cmp    %edx,%eax
+    1226:	72 f0                	jb     1218 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1228:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    122b:	8b 10                	mov    (%eax),%edx
+    122d:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1230:	39 fa                	cmp    %edi,%edx
+    1232:	74 19                	je     124d <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1234:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1237:	8b 50 04             	mov    0x4(%eax),%edx
+    123a:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    123d:	39 f1                	cmp    %esi,%ecx
+    123f:	74 18                	je     1259 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1241:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    1243:	a3 18 1d 00 00       	mov    %eax,0x1d18
+}
+    1248:	5b                   	pop    %ebx
+    1249:	5e                   	pop    %esi
+    124a:	5f                   	pop    %edi
+    124b:	5d                   	pop    %ebp
+    124c:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    124d:	03 72 04             	add    0x4(%edx),%esi
+    1250:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1253:	8b 10                	mov    (%eax),%edx
+    1255:	8b 12                	mov    (%edx),%edx
+    1257:	eb db                	jmp    1234 <free+0x39>
+    p->s.size += bp->s.size;
+    1259:	03 53 fc             	add    -0x4(%ebx),%edx
+    125c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    125f:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1262:	eb dd                	jmp    1241 <free+0x46>
+
+00001264 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1264:	55                   	push   %ebp
+    1265:	89 e5                	mov    %esp,%ebp
+    1267:	57                   	push   %edi
+    1268:	56                   	push   %esi
+    1269:	53                   	push   %ebx
+    126a:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    126d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1270:	8d 58 07             	lea    0x7(%eax),%ebx
+    1273:	c1 eb 03             	shr    $0x3,%ebx
+    1276:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    1279:	8b 15 18 1d 00 00    	mov    0x1d18,%edx
+    127f:	85 d2                	test   %edx,%edx
+    1281:	74 1c                	je     129f <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1283:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1285:	8b 48 04             	mov    0x4(%eax),%ecx
+    1288:	39 d9                	cmp    %ebx,%ecx
+    128a:	73 38                	jae    12c4 <malloc+0x60>
+  if(nu < 4096)
+    128c:	be 00 10 00 00       	mov    $0x1000,%esi
+    1291:	39 f3                	cmp    %esi,%ebx
+    1293:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    1296:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    129d:	eb 72                	jmp    1311 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    129f:	c7 05 18 1d 00 00 1c 	movl   $0x1d1c,0x1d18
+    12a6:	1d 00 00 
+    12a9:	c7 05 1c 1d 00 00 1c 	movl   $0x1d1c,0x1d1c
+    12b0:	1d 00 00 
+    base.s.size = 0;
+    12b3:	c7 05 20 1d 00 00 00 	movl   $0x0,0x1d20
+    12ba:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12bd:	b8 1c 1d 00 00       	mov    $0x1d1c,%eax
+    if(p->s.size >= nunits){
+    12c2:	eb c8                	jmp    128c <malloc+0x28>
+      if(p->s.size == nunits)
+    12c4:	39 cb                	cmp    %ecx,%ebx
+    12c6:	74 1e                	je     12e6 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    12c8:	29 d9                	sub    %ebx,%ecx
+    12ca:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    12cd:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    12d0:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    12d3:	89 15 18 1d 00 00    	mov    %edx,0x1d18
+      return (void*)(p + 1);
+    12d9:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    12dc:	89 d0                	mov    %edx,%eax
+    12de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12e1:	5b                   	pop    %ebx
+    12e2:	5e                   	pop    %esi
+    12e3:	5f                   	pop    %edi
+    12e4:	5d                   	pop    %ebp
+    12e5:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    12e6:	8b 08                	mov    (%eax),%ecx
+    12e8:	89 0a                	mov    %ecx,(%edx)
+    12ea:	eb e7                	jmp    12d3 <malloc+0x6f>
+  hp->s.size = nu;
+    12ec:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    12ef:	83 ec 0c             	sub    $0xc,%esp
+    12f2:	83 c0 08             	add    $0x8,%eax
+    12f5:	50                   	push   %eax
+    12f6:	e8 00 ff ff ff       	call   11fb <free>
+  return freep;
+    12fb:	8b 15 18 1d 00 00    	mov    0x1d18,%edx
+      if((p = morecore(nunits)) == 0)
+    1301:	83 c4 10             	add    $0x10,%esp
+    1304:	85 d2                	test   %edx,%edx
+    1306:	74 d4                	je     12dc <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1308:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    130a:	8b 48 04             	mov    0x4(%eax),%ecx
+    130d:	39 d9                	cmp    %ebx,%ecx
+    130f:	73 b3                	jae    12c4 <malloc+0x60>
+    if(p == freep)
+    1311:	89 c2                	mov    %eax,%edx
+    1313:	39 05 18 1d 00 00    	cmp    %eax,0x1d18
+    1319:	75 ed                	jne    1308 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    131b:	83 ec 0c             	sub    $0xc,%esp
+    131e:	57                   	push   %edi
+    131f:	e8 ca fb ff ff       	call   eee <sbrk>
+  if(p == (char*)-1)
+    1324:	83 c4 10             	add    $0x10,%esp
+    1327:	83 f8 ff             	cmp    $0xffffffff,%eax
+    132a:	75 c0                	jne    12ec <malloc+0x88>
+        return 0;
+    132c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1331:	eb a9                	jmp    12dc <malloc+0x78>
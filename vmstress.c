@@ -0,0 +1,390 @@
+#ifdef CS333_P4
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "vmstats.h"
+
+// Virtual memory benchmarks. Run "vmstress N" for test N alone, or
+// "vmstress" for all of them.
+
+void
+waitall(void) {
+  while(wait() != -1);
+}
+
+// Test 1: fork from a large parent. Grows this process by T1_GROW
+// bytes, then times T1_FORKS forks whose children exit at once, and
+// counts the pages copied. With copy-on-write, fork should cost little
+// more than for a small parent and copy next to nothing; a child that
+// writes its whole image copies it all.
+#define T1_GROW (8*1024*1024)
+#define T1_FORKS 20
+
+void
+t1run(char *what, int touch) {
+  struct vmstats before, after;
+  char *p = sbrk(0);
+  int start, t, pid;
+
+  vmstats(&before);
+  start = uptime();
+  for(int i = 0;i < T1_FORKS;i++) {
+    if((pid = fork()) == 0) {
+      for(int j = 0;j < touch;j += 4096)
+        p[-1 - j] = 1;
+      exit();
+    }
+    if(pid > 0)
+      waitpid(pid);
+  }
+  t = uptime() - start;
+  vmstats(&after);
+  printf(1, "%s\t%d\t%d\t%d\n", what, (int)sbrk(0), t,
+         (after.pagecopies - before.pagecopies) / T1_FORKS);
+}
+
+void
+test1(void) {
+  char *grow;
+
+  printf(1, "\n> starting test 1\n");
+  printf(1, "child\tsize\tticks/%d\tpages copied per fork\n", T1_FORKS);
+  t1run("exits", 0);
+  if((grow = sbrk(T1_GROW)) == (char*)-1) {
+    printf(1, "cannot grow by %d bytes\n", T1_GROW);
+    return;
+  }
+  memset(grow, 1, T1_GROW);
+  t1run("exits", 0);
+  t1run("writes", T1_GROW);
+  sbrk(-T1_GROW);
+  printf(1, "\n> test 1 complete\n");
+}
+
+// Test 2: lazy sbrk. Reserves T2_ARENA bytes, touches one page in
+// T2_STRIDE, and reads a never-touched page through read(), which has
+// to fill it in for the kernel. Only the touched pages should cost
+// anything.
+#define T2_ARENA (64*1024*1024)
+#define T2_STRIDE 64
+
+void
+test2(void) {
+  struct vmstats before, after;
+  char *arena;
+  int start, t, fd[2];
+
+  printf(1, "\n> starting test 2\n");
+  vmstats(&before);
+  start = uptime();
+  if((arena = sbrk(T2_ARENA)) == (char*)-1) {
+    printf(1, "cannot reserve %d bytes\n", T2_ARENA);
+    return;
+  }
+  t = uptime() - start;
+  for(int i = 0;i < T2_ARENA;i += T2_STRIDE*4096)
+    arena[i] = 1;
+  pipe(fd);
+  write(fd[1], "x", 1);
+  if(read(fd[0], arena + T2_ARENA - 1, 1) != 1 || arena[T2_ARENA - 1] != 'x')
+    printf(1, "read into an untouched page failed\n");
+  close(fd[0]);
+  close(fd[1]);
+  vmstats(&after);
+  printf(1, "sbrk(%d) took %d ticks; %d of %d pages filled in\n",
+         T2_ARENA, t, after.lazyfaults - before.lazyfaults, T2_ARENA/4096);
+  sbrk(-T2_ARENA);
+  printf(1, "\n> test 2 complete\n");
+}
+
+// Test 3: demand-paged exec. Runs T3_RUNS copies of this program
+// that exit at once, and counts the program pages read in. A program
+// that exits at once should only read the few pages it runs, not its
+// whole file.
+#define T3_RUNS 20
+
+void
+test3(void) {
+  struct vmstats before, after;
+  struct stat st;
+  char *argv[] = {"vmstress", "99", 0};
+  int start, t;
+
+  printf(1, "\n> starting test 3\n");
+  if(stat(argv[0], &st) < 0) {
+    printf(1, "cannot stat %s\n", argv[0]);
+    return;
+  }
+  vmstats(&before);
+  start = uptime();
+  for(int i = 0;i < T3_RUNS;i++) {
+    int pid = fork();
+    if(pid == 0) {
+      exec(argv[0], argv);
+      exit();
+    }
+    if(pid > 0) wait();
+  }
+  t = uptime() - start;
+  vmstats(&after);
+  printf(1, "%d execs of a %d page program took %d ticks; "
+         "%d pages read in, %d shared\n",
+         T3_RUNS, (st.size + 4095)/4096, t,
+         after.filefaults - before.filefaults,
+         after.textshared - before.textshared);
+  printf(1, "\n> test 3 complete\n");
+}
+
+// Test 4: shared program pages. Starts T4_PROCS copies of this
+// program that all stay up for T4_HOLD ticks, then times one more
+// exec while they are running. The copies should read the program
+// in once between them and share its pages after that, and a hot
+// exec should only read the partial page at the end of its data.
+#define T4_PROCS 20
+#define T4_HOLD 200
+
+void
+test4(void) {
+  struct vmstats before, after;
+  char *argv[] = {"vmstress", "98", 0};
+  char *argv99[] = {"vmstress", "99", 0};
+  int start, t, pid, n;
+
+  printf(1, "\n> starting test 4\n");
+  vmstats(&before);
+  for(n = 0;n < T4_PROCS;n++) {
+    if((pid = fork()) < 0) break;
+    if(pid == 0) {
+      exec(argv[0], argv);
+      exit();
+    }
+  }
+  sleep(T4_HOLD/4);
+  vmstats(&after);
+  printf(1, "%d copies running: %d pages read in, %d shared\n", n,
+         after.filefaults - before.filefaults,
+         after.textshared - before.textshared);
+  before = after;
+  start = uptime();
+  if((pid = fork()) == 0) {
+    exec(argv99[0], argv99);
+    exit();
+  }
+  if(pid > 0) wait();
+  t = uptime() - start;
+  vmstats(&after);
+  printf(1, "hot exec took %d ticks: %d pages read in, %d shared\n", t,
+         after.filefaults - before.filefaults,
+         after.textshared - before.textshared);
+  waitall();
+  printf(1, "\n> test 4 complete\n");
+}
+
+// Test 5: superpages. Times T5_FORKS forks of a tiny child, which
+// mostly measures building the kernel half of a page table, then
+// scans a T5_ARENA byte heap one word per page, T5_PASSES times,
+// first from sbrk() and then from hugesbrk(). The arena spans far
+// more 4KB pages than the TLB holds, but only a couple of 4MB pages.
+#define T5_FORKS 1000
+#define T5_ARENA (8*1024*1024)
+#define T5_PASSES 200
+
+int
+t5scan(char *p) {
+  int start = uptime();
+  int sum = 0;
+
+  for(int i = 0;i < T5_PASSES;i++)
+    for(int off = 0;off < T5_ARENA;off += 4096)
+      sum += p[off + (i & 1023)];
+  if(sum != 0) printf(1, "arena not zeroed\n");
+  return uptime() - start;
+}
+
+void
+test5(void) {
+  char *brk = sbrk(0), *p;
+  int start, t;
+
+  printf(1, "\n> starting test 5\n");
+  start = uptime();
+  for(int i = 0;i < T5_FORKS;i++) {
+    int pid = fork();
+    if(pid == 0) exit();
+    if(pid > 0) wait();
+  }
+  printf(1, "%d forks took %d ticks\n", T5_FORKS, uptime() - start);
+
+  if((p = sbrk(T5_ARENA)) == (char*)-1) {
+    printf(1, "cannot sbrk %d bytes\n", T5_ARENA);
+    return;
+  }
+  memset(p, 0, T5_ARENA);
+  t = t5scan(p);
+  printf(1, "%d passes over %d 4KB pages took %d ticks\n",
+         T5_PASSES, T5_ARENA/4096, t);
+  sbrk(brk - sbrk(0));
+
+  if((p = hugesbrk(T5_ARENA)) == (char*)-1) {
+    printf(1, "cannot hugesbrk %d bytes\n", T5_ARENA);
+    return;
+  }
+  t = t5scan(p);
+  printf(1, "%d passes over %d 4MB pages took %d ticks\n",
+         T5_PASSES, T5_ARENA/(4*1024*1024), t);
+  sbrk(brk - sbrk(0));
+  printf(1, "\n> test 5 complete\n");
+}
+
+// Test 6: page table cost per process. Runs T6_RUNS fork+exec+exit
+// cycles of a program that exits at once, which should leave no page
+// tables behind, then counts the page directories and page tables in
+// use while T6_PROCS copies of this program are up. With the kernel's
+// page tables shared, each should need only a page directory and a
+// page table or two for the user half.
+#define T6_RUNS 200
+#define T6_PROCS 20
+
+void
+test6(void) {
+  struct vmstats before, after;
+  char *argv[] = {"vmstress", "99", 0};
+  char *argv98[] = {"vmstress", "98", 0};
+  int start, t, n, pid;
+
+  printf(1, "\n> starting test 6\n");
+  vmstats(&before);
+  start = uptime();
+  for(n = 0;n < T6_RUNS;n++) {
+    int pid = fork();
+    if(pid == 0) {
+      exec(argv[0], argv);
+      exit();
+    }
+    if(pid < 0) break;
+    wait();
+  }
+  t = uptime() - start;
+  vmstats(&after);
+  printf(1, "%d fork+exec+exit cycles took %d ticks; "
+         "%d page table pages left over\n", n, t,
+         after.pgtables - before.pgtables);
+  before = after;
+  for(n = 0;n < T6_PROCS;n++) {
+    if((pid = fork()) < 0) break;
+    if(pid == 0) {
+      exec(argv98[0], argv98);
+      exit();
+    }
+  }
+  sleep(T4_HOLD/4);
+  vmstats(&after);
+  printf(1, "%d copies running: %d page table pages, %d per process\n", n,
+         after.pgtables - before.pgtables,
+         n ? (after.pgtables - before.pgtables)/n : 0);
+  waitall();
+  printf(1, "\n> test 6 complete\n");
+}
+
+// Test 7: page allocation throughput. For 1, 2, 4 and 8 workers at
+// once, each worker T7_ROUNDS times grows its heap by T7_PAGES
+// pages, touches them all and gives them back. With per-CPU page
+// caches the total should scale with the number of CPUs, rather
+// than queue on one allocator lock.
+#define T7_PAGES 256
+#define T7_ROUNDS 50
+#define T7_MAXWORKERS 8
+
+void
+t7work(void) {
+  for(int r = 0;r < T7_ROUNDS;r++) {
+    char *p = sbrk(T7_PAGES*4096);
+    if(p == (char*)-1) exit();
+    for(int i = 0;i < T7_PAGES;i++)
+      p[i*4096] = 1;
+    sbrk(-T7_PAGES*4096);
+  }
+  exit();
+}
+
+void
+test7(void) {
+  int start, t;
+
+  printf(1, "\n> starting test 7\n");
+  for(int n = 1;n <= T7_MAXWORKERS;n *= 2) {
+    start = uptime();
+    for(int i = 0;i < n;i++)
+      if(fork() == 0) t7work();
+    waitall();
+    t = uptime() - start;
+    printf(1, "%d workers: %d pages in %d ticks\n",
+           n, n*T7_PAGES*T7_ROUNDS, t);
+  }
+  printf(1, "\n> test 7 complete\n");
+}
+
+// Test 8: fragmentation. Prints the allocator's free blocks of each
+// size, then again after T8_WORKERS processes have filled in
+// T8_PAGES page heaps side by side and every other one has exited,
+// leaving holes between the pages the rest hold, and once more
+// after they all exit. Free memory should break up under the load
+// and merge back into large blocks afterwards.
+#define T8_WORKERS 8
+#define T8_PAGES 1024
+#define T8_HOLD 100
+
+void
+t8print(char *when) {
+  struct vmstats vs;
+
+  vmstats(&vs);
+  printf(1, "%s: %d free pages, %d cached;", when, vs.freepages,
+         vs.cachedpages);
+  for(int o = 0;o < NKORDER;o++)
+    printf(1, " %d", vs.freeblocks[o]);
+  printf(1, "\n");
+}
+
+void
+t8work(int hold) {
+  char *p = sbrk(T8_PAGES*4096);
+
+  if(p == (char*)-1) exit();
+  for(int i = 0;i < T8_PAGES;i++)
+    p[i*4096] = 1;
+  sleep(hold);
+  exit();
+}
+
+void
+test8(void) {
+  printf(1, "\n> starting test 8\n");
+  printf(1, "free blocks of 1, 2, 4, ... 1024 pages\n");
+  t8print("before");
+  for(int i = 0;i < T8_WORKERS;i++)
+    if(fork() == 0) t8work(i % 2 ? T8_HOLD/4 : T8_HOLD);
+  sleep(T8_HOLD/2);
+  t8print("loaded");
+  waitall();
+  t8print("after");
+  printf(1, "\n> test 8 complete\n");
+}
+
+int
+main(int argc, char **argv) {
+  int test = 0;
+  if(argc == 2) test = atoi(argv[1]);
+
+  if(test == 1 || test == 0) test1();
+  if(test == 2 || test == 0) test2();
+  if(test == 3 || test == 0) test3();
+  if(test == 4 || test == 0) test4();
+  if(test == 5 || test == 0) test5();
+  if(test == 6 || test == 0) test6();
+  if(test == 7 || test == 0) test7();
+  if(test == 8 || test == 0) test8();
+  if(test == 98) sleep(T4_HOLD);
+  exit();
+}
+#endif
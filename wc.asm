@@ -0,0 +1,1377 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+  inword = 0;
+   9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+  10:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  17:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  1e:	be 00 00 00 00       	mov    $0x0,%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  23:	eb 4d                	jmp    72 <wc+0x72>
+    for(i=0; i<n; i++){
+      c++;
+      if(buf[i] == '\n')
+        l++;
+      if(strchr(" \r\t\n\v", buf[i]))
+        inword = 0;
+  25:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  2c:	83 c3 01             	add    $0x1,%ebx
+  2f:	39 df                	cmp    %ebx,%edi
+  31:	74 3c                	je     6f <wc+0x6f>
+      if(buf[i] == '\n')
+  33:	0f b6 83 00 0c 00 00 	movzbl 0xc00(%ebx),%eax
+        l++;
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	0f 94 c2             	sete   %dl
+  3f:	0f b6 d2             	movzbl %dl,%edx
+  42:	01 d6                	add    %edx,%esi
+      if(strchr(" \r\t\n\v", buf[i]))
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	0f be c0             	movsbl %al,%eax
+  4a:	50                   	push   %eax
+  4b:	68 90 08 00 00       	push   $0x890
+  50:	e8 98 01 00 00       	call   1ed <strchr>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	85 c0                	test   %eax,%eax
+  5a:	75 c9                	jne    25 <wc+0x25>
+      else if(!inword){
+  5c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  60:	75 ca                	jne    2c <wc+0x2c>
+        w++;
+  62:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+  66:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  6d:	eb bd                	jmp    2c <wc+0x2c>
+      c++;
+  6f:	01 5d dc             	add    %ebx,-0x24(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	68 00 02 00 00       	push   $0x200
+  7a:	68 00 0c 00 00       	push   $0xc00
+  7f:	ff 75 08             	push   0x8(%ebp)
+  82:	e8 53 03 00 00       	call   3da <read>
+  87:	89 c7                	mov    %eax,%edi
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	85 c0                	test   %eax,%eax
+  8e:	7e 07                	jle    97 <wc+0x97>
+    for(i=0; i<n; i++){
+  90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  95:	eb 9c                	jmp    33 <wc+0x33>
+      }
+    }
+  }
+  if(n < 0){
+  97:	78 24                	js     bd <wc+0xbd>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  99:	83 ec 08             	sub    $0x8,%esp
+  9c:	ff 75 0c             	push   0xc(%ebp)
+  9f:	ff 75 dc             	push   -0x24(%ebp)
+  a2:	ff 75 e0             	push   -0x20(%ebp)
+  a5:	56                   	push   %esi
+  a6:	68 a6 08 00 00       	push   $0x8a6
+  ab:	6a 01                	push   $0x1
+  ad:	e8 e8 04 00 00       	call   59a <printf>
+}
+  b2:	83 c4 20             	add    $0x20,%esp
+  b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  b8:	5b                   	pop    %ebx
+  b9:	5e                   	pop    %esi
+  ba:	5f                   	pop    %edi
+  bb:	5d                   	pop    %ebp
+  bc:	c3                   	ret
+    printf(1, "wc: read error\n");
+  bd:	83 ec 08             	sub    $0x8,%esp
+  c0:	68 96 08 00 00       	push   $0x896
+  c5:	6a 01                	push   $0x1
+  c7:	e8 ce 04 00 00       	call   59a <printf>
+    exit();
+  cc:	e8 f1 02 00 00       	call   3c2 <exit>
+
+000000d1 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  d1:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  d5:	83 e4 f0             	and    $0xfffffff0,%esp
+  d8:	ff 71 fc             	push   -0x4(%ecx)
+  db:	55                   	push   %ebp
+  dc:	89 e5                	mov    %esp,%ebp
+  de:	57                   	push   %edi
+  df:	56                   	push   %esi
+  e0:	53                   	push   %ebx
+  e1:	51                   	push   %ecx
+  e2:	83 ec 18             	sub    $0x18,%esp
+  e5:	8b 01                	mov    (%ecx),%eax
+  e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  ea:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i;
+
+  if(argc <= 1){
+  ed:	83 c6 04             	add    $0x4,%esi
+    wc(0, "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  if(argc <= 1){
+  f5:	83 f8 01             	cmp    $0x1,%eax
+  f8:	7e 3b                	jle    135 <main+0x64>
+    if((fd = open(argv[i], 0)) < 0){
+  fa:	83 ec 08             	sub    $0x8,%esp
+  fd:	6a 00                	push   $0x0
+  ff:	ff 36                	push   (%esi)
+ 101:	e8 fc 02 00 00       	call   402 <open>
+ 106:	89 c3                	mov    %eax,%ebx
+ 108:	83 c4 10             	add    $0x10,%esp
+ 10b:	85 c0                	test   %eax,%eax
+ 10d:	78 3a                	js     149 <main+0x78>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+ 10f:	83 ec 08             	sub    $0x8,%esp
+ 112:	ff 36                	push   (%esi)
+ 114:	50                   	push   %eax
+ 115:	e8 e6 fe ff ff       	call   0 <wc>
+    close(fd);
+ 11a:	89 1c 24             	mov    %ebx,(%esp)
+ 11d:	e8 c8 02 00 00       	call   3ea <close>
+  for(i = 1; i < argc; i++){
+ 122:	83 c7 01             	add    $0x1,%edi
+ 125:	83 c6 04             	add    $0x4,%esi
+ 128:	83 c4 10             	add    $0x10,%esp
+ 12b:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12e:	75 ca                	jne    fa <main+0x29>
+  }
+  exit();
+ 130:	e8 8d 02 00 00       	call   3c2 <exit>
+    wc(0, "");
+ 135:	83 ec 08             	sub    $0x8,%esp
+ 138:	68 a5 08 00 00       	push   $0x8a5
+ 13d:	6a 00                	push   $0x0
+ 13f:	e8 bc fe ff ff       	call   0 <wc>
+    exit();
+ 144:	e8 79 02 00 00       	call   3c2 <exit>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 149:	83 ec 04             	sub    $0x4,%esp
+ 14c:	ff 36                	push   (%esi)
+ 14e:	68 b3 08 00 00       	push   $0x8b3
+ 153:	6a 01                	push   $0x1
+ 155:	e8 40 04 00 00       	call   59a <printf>
+      exit();
+ 15a:	e8 63 02 00 00       	call   3c2 <exit>
+
+0000015f <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 15f:	55                   	push   %ebp
+ 160:	89 e5                	mov    %esp,%ebp
+ 162:	53                   	push   %ebx
+ 163:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 166:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 169:	b8 00 00 00 00       	mov    $0x0,%eax
+ 16e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 172:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 175:	83 c0 01             	add    $0x1,%eax
+ 178:	84 d2                	test   %dl,%dl
+ 17a:	75 f2                	jne    16e <strcpy+0xf>
+    ;
+  return os;
+}
+ 17c:	89 c8                	mov    %ecx,%eax
+ 17e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 181:	c9                   	leave
+ 182:	c3                   	ret
+
+00000183 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 183:	55                   	push   %ebp
+ 184:	89 e5                	mov    %esp,%ebp
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 18c:	0f b6 01             	movzbl (%ecx),%eax
+ 18f:	84 c0                	test   %al,%al
+ 191:	74 11                	je     1a4 <strcmp+0x21>
+ 193:	38 02                	cmp    %al,(%edx)
+ 195:	75 0d                	jne    1a4 <strcmp+0x21>
+    p++, q++;
+ 197:	83 c1 01             	add    $0x1,%ecx
+ 19a:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 19d:	0f b6 01             	movzbl (%ecx),%eax
+ 1a0:	84 c0                	test   %al,%al
+ 1a2:	75 ef                	jne    193 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 1a4:	0f b6 c0             	movzbl %al,%eax
+ 1a7:	0f b6 12             	movzbl (%edx),%edx
+ 1aa:	29 d0                	sub    %edx,%eax
+}
+ 1ac:	5d                   	pop    %ebp
+ 1ad:	c3                   	ret
+
+000001ae <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b4:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b7:	74 14                	je     1cd <strlen+0x1f>
+ 1b9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1be:	83 c0 01             	add    $0x1,%eax
+ 1c1:	89 c1                	mov    %eax,%ecx
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	75 f5                	jne    1be <strlen+0x10>
+    ;
+  return n;
+}
+ 1c9:	89 c8                	mov    %ecx,%eax
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 1cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1d2:	eb f5                	jmp    1c9 <strlen+0x1b>
+
+000001d4 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d4:	55                   	push   %ebp
+ 1d5:	89 e5                	mov    %esp,%ebp
+ 1d7:	57                   	push   %edi
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1db:	89 d7                	mov    %edx,%edi
+ 1dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e3:	fc                   	cld
+ 1e4:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e6:	89 d0                	mov    %edx,%eax
+ 1e8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1eb:	c9                   	leave
+ 1ec:	c3                   	ret
+
+000001ed <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1ed:	55                   	push   %ebp
+ 1ee:	89 e5                	mov    %esp,%ebp
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1f7:	0f b6 10             	movzbl (%eax),%edx
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	74 15                	je     213 <strchr+0x26>
+    if(*s == c)
+ 1fe:	38 d1                	cmp    %dl,%cl
+ 200:	74 0f                	je     211 <strchr+0x24>
+  for(; *s; s++)
+ 202:	83 c0 01             	add    $0x1,%eax
+ 205:	0f b6 10             	movzbl (%eax),%edx
+ 208:	84 d2                	test   %dl,%dl
+ 20a:	75 f2                	jne    1fe <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 20c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 211:	5d                   	pop    %ebp
+ 212:	c3                   	ret
+  return 0;
+ 213:	b8 00 00 00 00       	mov    $0x0,%eax
+ 218:	eb f7                	jmp    211 <strchr+0x24>
+
+0000021a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 21a:	55                   	push   %ebp
+ 21b:	89 e5                	mov    %esp,%ebp
+ 21d:	57                   	push   %edi
+ 21e:	56                   	push   %esi
+ 21f:	53                   	push   %ebx
+ 220:	83 ec 2c             	sub    $0x2c,%esp
+ 223:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 226:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 22b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 22e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 231:	83 c3 01             	add    $0x1,%ebx
+ 234:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 237:	7d 27                	jge    260 <gets+0x46>
+    cc = read(0, &c, 1);
+ 239:	83 ec 04             	sub    $0x4,%esp
+ 23c:	6a 01                	push   $0x1
+ 23e:	57                   	push   %edi
+ 23f:	6a 00                	push   $0x0
+ 241:	e8 94 01 00 00       	call   3da <read>
+    if(cc < 1)
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	7e 13                	jle    260 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 24d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 251:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 255:	3c 0a                	cmp    $0xa,%al
+ 257:	74 04                	je     25d <gets+0x43>
+ 259:	3c 0d                	cmp    $0xd,%al
+ 25b:	75 d1                	jne    22e <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 25d:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 260:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 263:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 267:	89 f0                	mov    %esi,%eax
+ 269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26c:	5b                   	pop    %ebx
+ 26d:	5e                   	pop    %esi
+ 26e:	5f                   	pop    %edi
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+
+00000271 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 271:	55                   	push   %ebp
+ 272:	89 e5                	mov    %esp,%ebp
+ 274:	56                   	push   %esi
+ 275:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	6a 00                	push   $0x0
+ 27b:	ff 75 08             	push   0x8(%ebp)
+ 27e:	e8 7f 01 00 00       	call   402 <open>
+  if(fd < 0)
+ 283:	83 c4 10             	add    $0x10,%esp
+ 286:	85 c0                	test   %eax,%eax
+ 288:	78 24                	js     2ae <stat+0x3d>
+ 28a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 28c:	83 ec 08             	sub    $0x8,%esp
+ 28f:	ff 75 0c             	push   0xc(%ebp)
+ 292:	50                   	push   %eax
+ 293:	e8 82 01 00 00       	call   41a <fstat>
+ 298:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29a:	89 1c 24             	mov    %ebx,(%esp)
+ 29d:	e8 48 01 00 00       	call   3ea <close>
+  return r;
+ 2a2:	83 c4 10             	add    $0x10,%esp
+}
+ 2a5:	89 f0                	mov    %esi,%eax
+ 2a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2aa:	5b                   	pop    %ebx
+ 2ab:	5e                   	pop    %esi
+ 2ac:	5d                   	pop    %ebp
+ 2ad:	c3                   	ret
+    return -1;
+ 2ae:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b3:	eb f0                	jmp    2a5 <stat+0x34>
+
+000002b5 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2b5:	55                   	push   %ebp
+ 2b6:	89 e5                	mov    %esp,%ebp
+ 2b8:	56                   	push   %esi
+ 2b9:	53                   	push   %ebx
+ 2ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2bd:	0f b6 0a             	movzbl (%edx),%ecx
+ 2c0:	80 f9 20             	cmp    $0x20,%cl
+ 2c3:	75 0b                	jne    2d0 <atoi+0x1b>
+ 2c5:	83 c2 01             	add    $0x1,%edx
+ 2c8:	0f b6 0a             	movzbl (%edx),%ecx
+ 2cb:	80 f9 20             	cmp    $0x20,%cl
+ 2ce:	74 f5                	je     2c5 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2d0:	80 f9 2d             	cmp    $0x2d,%cl
+ 2d3:	74 3c                	je     311 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 2d5:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 2d8:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2dd:	f6 c1 fd             	test   $0xfd,%cl
+ 2e0:	74 34                	je     316 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 2e2:	0f b6 0a             	movzbl (%edx),%ecx
+ 2e5:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2e8:	3c 09                	cmp    $0x9,%al
+ 2ea:	77 2f                	ja     31b <atoi+0x66>
+ 2ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 2f1:	83 c2 01             	add    $0x1,%edx
+ 2f4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 2f7:	0f be c9             	movsbl %cl,%ecx
+ 2fa:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 2fe:	0f b6 0a             	movzbl (%edx),%ecx
+ 301:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 304:	3c 09                	cmp    $0x9,%al
+ 306:	76 e9                	jbe    2f1 <atoi+0x3c>
+  return sign*n;
+ 308:	89 f0                	mov    %esi,%eax
+ 30a:	0f af c3             	imul   %ebx,%eax
+}
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5d                   	pop    %ebp
+ 310:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 311:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 316:	83 c2 01             	add    $0x1,%edx
+ 319:	eb c7                	jmp    2e2 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 31b:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 320:	eb e6                	jmp    308 <atoi+0x53>
+
+00000322 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 322:	55                   	push   %ebp
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	56                   	push   %esi
+ 326:	53                   	push   %ebx
+ 327:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 32a:	0f b6 0a             	movzbl (%edx),%ecx
+ 32d:	80 f9 20             	cmp    $0x20,%cl
+ 330:	75 0b                	jne    33d <atoo+0x1b>
+ 332:	83 c2 01             	add    $0x1,%edx
+ 335:	0f b6 0a             	movzbl (%edx),%ecx
+ 338:	80 f9 20             	cmp    $0x20,%cl
+ 33b:	74 f5                	je     332 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 33d:	80 f9 2d             	cmp    $0x2d,%cl
+ 340:	74 3a                	je     37c <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 342:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 345:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 34a:	f6 c1 fd             	test   $0xfd,%cl
+ 34d:	74 32                	je     381 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 34f:	0f b6 0a             	movzbl (%edx),%ecx
+ 352:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 355:	80 fb 07             	cmp    $0x7,%bl
+ 358:	77 2c                	ja     386 <atoo+0x64>
+ 35a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 35f:	83 c2 01             	add    $0x1,%edx
+ 362:	0f be c9             	movsbl %cl,%ecx
+ 365:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 369:	0f b6 0a             	movzbl (%edx),%ecx
+ 36c:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 36f:	3c 07                	cmp    $0x7,%al
+ 371:	76 ec                	jbe    35f <atoo+0x3d>
+  return sign*n;
+ 373:	89 f0                	mov    %esi,%eax
+ 375:	0f af c3             	imul   %ebx,%eax
+}
+ 378:	5b                   	pop    %ebx
+ 379:	5e                   	pop    %esi
+ 37a:	5d                   	pop    %ebp
+ 37b:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 37c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 381:	83 c2 01             	add    $0x1,%edx
+ 384:	eb c9                	jmp    34f <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 386:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 38b:	eb e6                	jmp    373 <atoo+0x51>
+
+0000038d <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 38d:	55                   	push   %ebp
+ 38e:	89 e5                	mov    %esp,%ebp
+ 390:	56                   	push   %esi
+ 391:	53                   	push   %ebx
+ 392:	8b 75 08             	mov    0x8(%ebp),%esi
+ 395:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 398:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39b:	85 db                	test   %ebx,%ebx
+ 39d:	7e 15                	jle    3b4 <memmove+0x27>
+ 39f:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 3a1:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 3a3:	83 c2 01             	add    $0x1,%edx
+ 3a6:	83 c0 01             	add    $0x1,%eax
+ 3a9:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 3ad:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 3b0:	39 c3                	cmp    %eax,%ebx
+ 3b2:	75 ef                	jne    3a3 <memmove+0x16>
+  return vdst;
+}
+ 3b4:	89 f0                	mov    %esi,%eax
+ 3b6:	5b                   	pop    %ebx
+ 3b7:	5e                   	pop    %esi
+ 3b8:	5d                   	pop    %ebp
+ 3b9:	c3                   	ret
+
+000003ba <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3ba:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <exit>:
+SYSCALL(exit)
+ 3c2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <wait>:
+SYSCALL(wait)
+ 3ca:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <pipe>:
+SYSCALL(pipe)
+ 3d2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <read>:
+SYSCALL(read)
+ 3da:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <write>:
+SYSCALL(write)
+ 3e2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <close>:
+SYSCALL(close)
+ 3ea:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <kill>:
+SYSCALL(kill)
+ 3f2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <exec>:
+SYSCALL(exec)
+ 3fa:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <open>:
+SYSCALL(open)
+ 402:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <mknod>:
+SYSCALL(mknod)
+ 40a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <unlink>:
+SYSCALL(unlink)
+ 412:	b8 12 00 00 00       	mov    $0x12,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <fstat>:
+SYSCALL(fstat)
+ 41a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <link>:
+SYSCALL(link)
+ 422:	b8 13 00 00 00       	mov    $0x13,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <mkdir>:
+SYSCALL(mkdir)
+ 42a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <chdir>:
+SYSCALL(chdir)
+ 432:	b8 09 00 00 00       	mov    $0x9,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <dup>:
+SYSCALL(dup)
+ 43a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <getpid>:
+SYSCALL(getpid)
+ 442:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <sbrk>:
+SYSCALL(sbrk)
+ 44a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <sleep>:
+SYSCALL(sleep)
+ 452:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <uptime>:
+SYSCALL(uptime)
+ 45a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <halt>:
+SYSCALL(halt)
+ 462:	b8 16 00 00 00       	mov    $0x16,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <date>:
+SYSCALL(date)
+ 46a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <getuid>:
+SYSCALL(getuid)
+ 472:	b8 18 00 00 00       	mov    $0x18,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <getgid>:
+SYSCALL(getgid)
+ 47a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <getppid>:
+SYSCALL(getppid)
+ 482:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
+
+0000048a <setuid>:
+SYSCALL(setuid)
+ 48a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <setgid>:
+SYSCALL(setgid)
+ 492:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <getprocs>:
+SYSCALL(getprocs)
+ 49a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <setpriority>:
+SYSCALL(setpriority)
+ 4a2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <getpriority>:
+SYSCALL(getpriority)
+ 4aa:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4af:	cd 40                	int    $0x40
+ 4b1:	c3                   	ret
+
+000004b2 <waitpid>:
+SYSCALL(waitpid)
+ 4b2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b7:	cd 40                	int    $0x40
+ 4b9:	c3                   	ret
+
+000004ba <setaffinity>:
+SYSCALL(setaffinity)
+ 4ba:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4bf:	cd 40                	int    $0x40
+ 4c1:	c3                   	ret
+
+000004c2 <getaffinity>:
+SYSCALL(getaffinity)
+ 4c2:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4c7:	cd 40                	int    $0x40
+ 4c9:	c3                   	ret
+
+000004ca <setdeadline>:
+SYSCALL(setdeadline)
+ 4ca:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4cf:	cd 40                	int    $0x40
+ 4d1:	c3                   	ret
+
+000004d2 <schedctl>:
+SYSCALL(schedctl)
+ 4d2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4d7:	cd 40                	int    $0x40
+ 4d9:	c3                   	ret
+
+000004da <spawn>:
+SYSCALL(spawn)
+ 4da:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4df:	cd 40                	int    $0x40
+ 4e1:	c3                   	ret
+
+000004e2 <vmstats>:
+SYSCALL(vmstats)
+ 4e2:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4e7:	cd 40                	int    $0x40
+ 4e9:	c3                   	ret
+
+000004ea <hugesbrk>:
+SYSCALL(hugesbrk)
+ 4ea:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4ef:	cd 40                	int    $0x40
+ 4f1:	c3                   	ret
+
+000004f2 <setshares>:
+SYSCALL(setshares)
+ 4f2:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4f7:	cd 40                	int    $0x40
+ 4f9:	c3                   	ret
+
+000004fa <getshares>:
+SYSCALL(getshares)
+ 4fa:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4ff:	cd 40                	int    $0x40
+ 501:	c3                   	ret
+
+00000502 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 502:	55                   	push   %ebp
+ 503:	89 e5                	mov    %esp,%ebp
+ 505:	57                   	push   %edi
+ 506:	56                   	push   %esi
+ 507:	53                   	push   %ebx
+ 508:	83 ec 3c             	sub    $0x3c,%esp
+ 50b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 50e:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 510:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 514:	74 79                	je     58f <printint+0x8d>
+ 516:	85 d2                	test   %edx,%edx
+ 518:	79 75                	jns    58f <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 51a:	89 d1                	mov    %edx,%ecx
+ 51c:	f7 d9                	neg    %ecx
+    neg = 1;
+ 51e:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 525:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 52a:	89 df                	mov    %ebx,%edi
+ 52c:	83 c3 01             	add    $0x1,%ebx
+ 52f:	89 c8                	mov    %ecx,%eax
+ 531:	ba 00 00 00 00       	mov    $0x0,%edx
+ 536:	f7 f6                	div    %esi
+ 538:	0f b6 92 28 09 00 00 	movzbl 0x928(%edx),%edx
+ 53f:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 543:	89 ca                	mov    %ecx,%edx
+ 545:	89 c1                	mov    %eax,%ecx
+ 547:	39 f2                	cmp    %esi,%edx
+ 549:	73 df                	jae    52a <printint+0x28>
+  if(neg)
+ 54b:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 54f:	74 08                	je     559 <printint+0x57>
+    buf[i++] = '-';
+ 551:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 556:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 559:	85 db                	test   %ebx,%ebx
+ 55b:	7e 2a                	jle    587 <printint+0x85>
+ 55d:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 560:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 564:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 567:	0f b6 03             	movzbl (%ebx),%eax
+ 56a:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 56d:	83 ec 04             	sub    $0x4,%esp
+ 570:	6a 01                	push   $0x1
+ 572:	57                   	push   %edi
+ 573:	ff 75 c4             	push   -0x3c(%ebp)
+ 576:	e8 67 fe ff ff       	call   3e2 <write>
+  while(--i >= 0)
+ 57b:	89 d8                	mov    %ebx,%eax
+ 57d:	83 eb 01             	sub    $0x1,%ebx
+ 580:	83 c4 10             	add    $0x10,%esp
+ 583:	39 f0                	cmp    %esi,%eax
+ 585:	75 e0                	jne    567 <printint+0x65>
+}
+ 587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 58a:	5b                   	pop    %ebx
+ 58b:	5e                   	pop    %esi
+ 58c:	5f                   	pop    %edi
+ 58d:	5d                   	pop    %ebp
+ 58e:	c3                   	ret
+    x = xx;
+ 58f:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 591:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 598:	eb 8b                	jmp    525 <printint+0x23>
+
+0000059a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 59a:	55                   	push   %ebp
+ 59b:	89 e5                	mov    %esp,%ebp
+ 59d:	57                   	push   %edi
+ 59e:	56                   	push   %esi
+ 59f:	53                   	push   %ebx
+ 5a0:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 5a6:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a9:	84 db                	test   %bl,%bl
+ 5ab:	0f 84 9e 01 00 00    	je     74f <printf+0x1b5>
+ 5b1:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 5b4:	8d 45 10             	lea    0x10(%ebp),%eax
+ 5b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 5ba:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5bf:	eb 2d                	jmp    5ee <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5c1:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c4:	83 ec 04             	sub    $0x4,%esp
+ 5c7:	6a 01                	push   $0x1
+ 5c9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5cc:	50                   	push   %eax
+ 5cd:	ff 75 08             	push   0x8(%ebp)
+ 5d0:	e8 0d fe ff ff       	call   3e2 <write>
+        putc(fd, c);
+ 5d5:	83 c4 10             	add    $0x10,%esp
+ 5d8:	eb 05                	jmp    5df <printf+0x45>
+      }
+    } else if(state == '%'){
+ 5da:	83 ff 25             	cmp    $0x25,%edi
+ 5dd:	74 1f                	je     5fe <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 5df:	83 c6 01             	add    $0x1,%esi
+ 5e2:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 5e6:	84 db                	test   %bl,%bl
+ 5e8:	0f 84 61 01 00 00    	je     74f <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 5ee:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5f1:	85 ff                	test   %edi,%edi
+ 5f3:	75 e5                	jne    5da <printf+0x40>
+      if(c == '%'){
+ 5f5:	83 f8 25             	cmp    $0x25,%eax
+ 5f8:	75 c7                	jne    5c1 <printf+0x27>
+        state = '%';
+ 5fa:	89 c7                	mov    %eax,%edi
+ 5fc:	eb e1                	jmp    5df <printf+0x45>
+      if(c == 'd'){
+ 5fe:	83 f8 25             	cmp    $0x25,%eax
+ 601:	0f 84 f4 00 00 00    	je     6fb <printf+0x161>
+ 607:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 60a:	83 fa 15             	cmp    $0x15,%edx
+ 60d:	0f 87 09 01 00 00    	ja     71c <printf+0x182>
+ 613:	0f 87 03 01 00 00    	ja     71c <printf+0x182>
+ 619:	ff 24 95 d0 08 00 00 	jmp    *0x8d0(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 620:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 623:	8b 17                	mov    (%edi),%edx
+ 625:	83 ec 0c             	sub    $0xc,%esp
+ 628:	6a 01                	push   $0x1
+ 62a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 62f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 632:	e8 cb fe ff ff       	call   502 <printint>
+        ap++;
+ 637:	83 c7 04             	add    $0x4,%edi
+ 63a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 63d:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 640:	bf 00 00 00 00       	mov    $0x0,%edi
+ 645:	eb 98                	jmp    5df <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 647:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 64a:	8b 17                	mov    (%edi),%edx
+ 64c:	83 ec 0c             	sub    $0xc,%esp
+ 64f:	6a 00                	push   $0x0
+ 651:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 656:	8b 45 08             	mov    0x8(%ebp),%eax
+ 659:	e8 a4 fe ff ff       	call   502 <printint>
+        ap++;
+ 65e:	83 c7 04             	add    $0x4,%edi
+ 661:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 664:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 667:	bf 00 00 00 00       	mov    $0x0,%edi
+ 66c:	e9 6e ff ff ff       	jmp    5df <printf+0x45>
+        s = (char*)*ap;
+ 671:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 674:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 676:	83 c1 04             	add    $0x4,%ecx
+ 679:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 67c:	85 c0                	test   %eax,%eax
+ 67e:	74 13                	je     693 <printf+0xf9>
+        s = (char*)*ap;
+ 680:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 682:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 685:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 68a:	84 c0                	test   %al,%al
+ 68c:	75 0f                	jne    69d <printf+0x103>
+ 68e:	e9 4c ff ff ff       	jmp    5df <printf+0x45>
+          s = "(null)";
+ 693:	bb c7 08 00 00       	mov    $0x8c7,%ebx
+        while(*s != 0){
+ 698:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 69d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6a0:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 6a3:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 6a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6a9:	83 ec 04             	sub    $0x4,%esp
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	57                   	push   %edi
+ 6af:	56                   	push   %esi
+ 6b0:	e8 2d fd ff ff       	call   3e2 <write>
+          s++;
+ 6b5:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 6b8:	0f b6 03             	movzbl (%ebx),%eax
+ 6bb:	83 c4 10             	add    $0x10,%esp
+ 6be:	84 c0                	test   %al,%al
+ 6c0:	75 e4                	jne    6a6 <printf+0x10c>
+      state = 0;
+ 6c2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6c5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6ca:	e9 10 ff ff ff       	jmp    5df <printf+0x45>
+        putc(fd, *ap);
+ 6cf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 6d2:	8b 07                	mov    (%edi),%eax
+ 6d4:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d7:	83 ec 04             	sub    $0x4,%esp
+ 6da:	6a 01                	push   $0x1
+ 6dc:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6df:	50                   	push   %eax
+ 6e0:	ff 75 08             	push   0x8(%ebp)
+ 6e3:	e8 fa fc ff ff       	call   3e2 <write>
+        ap++;
+ 6e8:	83 c7 04             	add    $0x4,%edi
+ 6eb:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 6ee:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6f1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6f6:	e9 e4 fe ff ff       	jmp    5df <printf+0x45>
+        putc(fd, c);
+ 6fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6fe:	83 ec 04             	sub    $0x4,%esp
+ 701:	6a 01                	push   $0x1
+ 703:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 706:	50                   	push   %eax
+ 707:	ff 75 08             	push   0x8(%ebp)
+ 70a:	e8 d3 fc ff ff       	call   3e2 <write>
+ 70f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 712:	bf 00 00 00 00       	mov    $0x0,%edi
+ 717:	e9 c3 fe ff ff       	jmp    5df <printf+0x45>
+        putc(fd, '%');
+ 71c:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	6a 01                	push   $0x1
+ 725:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 728:	57                   	push   %edi
+ 729:	ff 75 08             	push   0x8(%ebp)
+ 72c:	e8 b1 fc ff ff       	call   3e2 <write>
+        putc(fd, c);
+ 731:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 734:	83 c4 0c             	add    $0xc,%esp
+ 737:	6a 01                	push   $0x1
+ 739:	57                   	push   %edi
+ 73a:	ff 75 08             	push   0x8(%ebp)
+ 73d:	e8 a0 fc ff ff       	call   3e2 <write>
+        putc(fd, c);
+ 742:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 745:	bf 00 00 00 00       	mov    $0x0,%edi
+ 74a:	e9 90 fe ff ff       	jmp    5df <printf+0x45>
+    }
+  }
+}
+ 74f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 752:	5b                   	pop    %ebx
+ 753:	5e                   	pop    %esi
+ 754:	5f                   	pop    %edi
+ 755:	5d                   	pop    %ebp
+ 756:	c3                   	ret
+
+00000757 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 757:	55                   	push   %ebp
+ 758:	89 e5                	mov    %esp,%ebp
+ 75a:	57                   	push   %edi
+ 75b:	56                   	push   %esi
+ 75c:	53                   	push   %ebx
+ 75d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 760:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 763:	a1 00 0e 00 00       	mov    0xe00,%eax
+ 768:	eb 0c                	jmp    776 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 76a:	8b 10                	mov    (%eax),%edx
+ 76c:	39 d0                	cmp    %edx,%eax
+ 76e:	72 04                	jb     774 <free+0x1d>
+ 770:	39 d1                	cmp    %edx,%ecx
+ 772:	72 10                	jb     784 <free+0x2d>
+{
+ 774:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 776:	39 c8                	cmp    %ecx,%eax
+ 778:	73 f0                	jae    76a <free+0x13>
+ 77a:	8b 10                	mov    (%eax),%edx
+ 77c:	39 d1                	cmp    %edx,%ecx
+ 77e:	72 04                	jb     784 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 780:	39 d0                	cmp    %edx,%eax
+ 782:	72 f0                	jb     774 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 784:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 787:	8b 10                	mov    (%eax),%edx
+ 789:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 78c:	39 fa                	cmp    %edi,%edx
+ 78e:	74 19                	je     7a9 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 790:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 793:	8b 50 04             	mov    0x4(%eax),%edx
+ 796:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 799:	39 f1                	cmp    %esi,%ecx
+ 79b:	74 18                	je     7b5 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 79d:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 79f:	a3 00 0e 00 00       	mov    %eax,0xe00
+}
+ 7a4:	5b                   	pop    %ebx
+ 7a5:	5e                   	pop    %esi
+ 7a6:	5f                   	pop    %edi
+ 7a7:	5d                   	pop    %ebp
+ 7a8:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 7a9:	03 72 04             	add    0x4(%edx),%esi
+ 7ac:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7af:	8b 10                	mov    (%eax),%edx
+ 7b1:	8b 12                	mov    (%edx),%edx
+ 7b3:	eb db                	jmp    790 <free+0x39>
+    p->s.size += bp->s.size;
+ 7b5:	03 53 fc             	add    -0x4(%ebx),%edx
+ 7b8:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7bb:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7be:	eb dd                	jmp    79d <free+0x46>
+
+000007c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cc:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7cf:	c1 eb 03             	shr    $0x3,%ebx
+ 7d2:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7d5:	8b 15 00 0e 00 00    	mov    0xe00,%edx
+ 7db:	85 d2                	test   %edx,%edx
+ 7dd:	74 1c                	je     7fb <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7df:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7e1:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e4:	39 d9                	cmp    %ebx,%ecx
+ 7e6:	73 38                	jae    820 <malloc+0x60>
+  if(nu < 4096)
+ 7e8:	be 00 10 00 00       	mov    $0x1000,%esi
+ 7ed:	39 f3                	cmp    %esi,%ebx
+ 7ef:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 7f2:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 7f9:	eb 72                	jmp    86d <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 7fb:	c7 05 00 0e 00 00 04 	movl   $0xe04,0xe00
+ 802:	0e 00 00 
+ 805:	c7 05 04 0e 00 00 04 	movl   $0xe04,0xe04
+ 80c:	0e 00 00 
+    base.s.size = 0;
+ 80f:	c7 05 08 0e 00 00 00 	movl   $0x0,0xe08
+ 816:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 819:	b8 04 0e 00 00       	mov    $0xe04,%eax
+    if(p->s.size >= nunits){
+ 81e:	eb c8                	jmp    7e8 <malloc+0x28>
+      if(p->s.size == nunits)
+ 820:	39 cb                	cmp    %ecx,%ebx
+ 822:	74 1e                	je     842 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 824:	29 d9                	sub    %ebx,%ecx
+ 826:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 829:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 82c:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 82f:	89 15 00 0e 00 00    	mov    %edx,0xe00
+      return (void*)(p + 1);
+ 835:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 838:	89 d0                	mov    %edx,%eax
+ 83a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83d:	5b                   	pop    %ebx
+ 83e:	5e                   	pop    %esi
+ 83f:	5f                   	pop    %edi
+ 840:	5d                   	pop    %ebp
+ 841:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 842:	8b 08                	mov    (%eax),%ecx
+ 844:	89 0a                	mov    %ecx,(%edx)
+ 846:	eb e7                	jmp    82f <malloc+0x6f>
+  hp->s.size = nu;
+ 848:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 84b:	83 ec 0c             	sub    $0xc,%esp
+ 84e:	83 c0 08             	add    $0x8,%eax
+ 851:	50                   	push   %eax
+ 852:	e8 00 ff ff ff       	call   757 <free>
+  return freep;
+ 857:	8b 15 00 0e 00 00    	mov    0xe00,%edx
+      if((p = morecore(nunits)) == 0)
+ 85d:	83 c4 10             	add    $0x10,%esp
+ 860:	85 d2                	test   %edx,%edx
+ 862:	74 d4                	je     838 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 864:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 866:	8b 48 04             	mov    0x4(%eax),%ecx
+ 869:	39 d9                	cmp    %ebx,%ecx
+ 86b:	73 b3                	jae    820 <malloc+0x60>
+    if(p == freep)
+ 86d:	89 c2                	mov    %eax,%edx
+ 86f:	39 05 00 0e 00 00    	cmp    %eax,0xe00
+ 875:	75 ed                	jne    864 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 877:	83 ec 0c             	sub    $0xc,%esp
+ 87a:	57                   	push   %edi
+ 87b:	e8 ca fb ff ff       	call   44a <sbrk>
+  if(p == (char*)-1)
+ 880:	83 c4 10             	add    $0x10,%esp
+ 883:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 886:	75 c0                	jne    848 <malloc+0x88>
+        return 0;
+ 888:	ba 00 00 00 00       	mov    $0x0,%edx
+ 88d:	eb a9                	jmp    838 <malloc+0x78>
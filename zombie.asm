@@ -0,0 +1,1221 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 73 02 00 00       	call   289 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7f 05                	jg     1f <main+0x1f>
+    sleep(5);  // Let child exit before parent.
+  exit();
+  1a:	e8 72 02 00 00       	call   291 <exit>
+    sleep(5);  // Let child exit before parent.
+  1f:	83 ec 0c             	sub    $0xc,%esp
+  22:	6a 05                	push   $0x5
+  24:	e8 f8 02 00 00       	call   321 <sleep>
+  29:	83 c4 10             	add    $0x10,%esp
+  2c:	eb ec                	jmp    1a <main+0x1a>
+
+0000002e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  2e:	55                   	push   %ebp
+  2f:	89 e5                	mov    %esp,%ebp
+  31:	53                   	push   %ebx
+  32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  38:	b8 00 00 00 00       	mov    $0x0,%eax
+  3d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  41:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  44:	83 c0 01             	add    $0x1,%eax
+  47:	84 d2                	test   %dl,%dl
+  49:	75 f2                	jne    3d <strcpy+0xf>
+    ;
+  return os;
+}
+  4b:	89 c8                	mov    %ecx,%eax
+  4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  50:	c9                   	leave
+  51:	c3                   	ret
+
+00000052 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  5b:	0f b6 01             	movzbl (%ecx),%eax
+  5e:	84 c0                	test   %al,%al
+  60:	74 11                	je     73 <strcmp+0x21>
+  62:	38 02                	cmp    %al,(%edx)
+  64:	75 0d                	jne    73 <strcmp+0x21>
+    p++, q++;
+  66:	83 c1 01             	add    $0x1,%ecx
+  69:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  6c:	0f b6 01             	movzbl (%ecx),%eax
+  6f:	84 c0                	test   %al,%al
+  71:	75 ef                	jne    62 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  73:	0f b6 c0             	movzbl %al,%eax
+  76:	0f b6 12             	movzbl (%edx),%edx
+  79:	29 d0                	sub    %edx,%eax
+}
+  7b:	5d                   	pop    %ebp
+  7c:	c3                   	ret
+
+0000007d <strlen>:
+
+uint
+strlen(char *s)
+{
+  7d:	55                   	push   %ebp
+  7e:	89 e5                	mov    %esp,%ebp
+  80:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  83:	80 3a 00             	cmpb   $0x0,(%edx)
+  86:	74 14                	je     9c <strlen+0x1f>
+  88:	b8 00 00 00 00       	mov    $0x0,%eax
+  8d:	83 c0 01             	add    $0x1,%eax
+  90:	89 c1                	mov    %eax,%ecx
+  92:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  96:	75 f5                	jne    8d <strlen+0x10>
+    ;
+  return n;
+}
+  98:	89 c8                	mov    %ecx,%eax
+  9a:	5d                   	pop    %ebp
+  9b:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  a1:	eb f5                	jmp    98 <strlen+0x1b>
+
+000000a3 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  a3:	55                   	push   %ebp
+  a4:	89 e5                	mov    %esp,%ebp
+  a6:	57                   	push   %edi
+  a7:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  aa:	89 d7                	mov    %edx,%edi
+  ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b2:	fc                   	cld
+  b3:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  b5:	89 d0                	mov    %edx,%eax
+  b7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  ba:	c9                   	leave
+  bb:	c3                   	ret
+
+000000bc <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  bc:	55                   	push   %ebp
+  bd:	89 e5                	mov    %esp,%ebp
+  bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  c6:	0f b6 10             	movzbl (%eax),%edx
+  c9:	84 d2                	test   %dl,%dl
+  cb:	74 15                	je     e2 <strchr+0x26>
+    if(*s == c)
+  cd:	38 d1                	cmp    %dl,%cl
+  cf:	74 0f                	je     e0 <strchr+0x24>
+  for(; *s; s++)
+  d1:	83 c0 01             	add    $0x1,%eax
+  d4:	0f b6 10             	movzbl (%eax),%edx
+  d7:	84 d2                	test   %dl,%dl
+  d9:	75 f2                	jne    cd <strchr+0x11>
+      return (char*)s;
+  return 0;
+  db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  e0:	5d                   	pop    %ebp
+  e1:	c3                   	ret
+  return 0;
+  e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  e7:	eb f7                	jmp    e0 <strchr+0x24>
+
+000000e9 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  e9:	55                   	push   %ebp
+  ea:	89 e5                	mov    %esp,%ebp
+  ec:	57                   	push   %edi
+  ed:	56                   	push   %esi
+  ee:	53                   	push   %ebx
+  ef:	83 ec 2c             	sub    $0x2c,%esp
+  f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+  fa:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+  fd:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 100:	83 c3 01             	add    $0x1,%ebx
+ 103:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 106:	7d 27                	jge    12f <gets+0x46>
+    cc = read(0, &c, 1);
+ 108:	83 ec 04             	sub    $0x4,%esp
+ 10b:	6a 01                	push   $0x1
+ 10d:	57                   	push   %edi
+ 10e:	6a 00                	push   $0x0
+ 110:	e8 94 01 00 00       	call   2a9 <read>
+    if(cc < 1)
+ 115:	83 c4 10             	add    $0x10,%esp
+ 118:	85 c0                	test   %eax,%eax
+ 11a:	7e 13                	jle    12f <gets+0x46>
+      break;
+    buf[i++] = c;
+ 11c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 120:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 124:	3c 0a                	cmp    $0xa,%al
+ 126:	74 04                	je     12c <gets+0x43>
+ 128:	3c 0d                	cmp    $0xd,%al
+ 12a:	75 d1                	jne    fd <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 12c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 12f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 132:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 136:	89 f0                	mov    %esi,%eax
+ 138:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 13b:	5b                   	pop    %ebx
+ 13c:	5e                   	pop    %esi
+ 13d:	5f                   	pop    %edi
+ 13e:	5d                   	pop    %ebp
+ 13f:	c3                   	ret
+
+00000140 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	56                   	push   %esi
+ 144:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	6a 00                	push   $0x0
+ 14a:	ff 75 08             	push   0x8(%ebp)
+ 14d:	e8 7f 01 00 00       	call   2d1 <open>
+  if(fd < 0)
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	85 c0                	test   %eax,%eax
+ 157:	78 24                	js     17d <stat+0x3d>
+ 159:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 15b:	83 ec 08             	sub    $0x8,%esp
+ 15e:	ff 75 0c             	push   0xc(%ebp)
+ 161:	50                   	push   %eax
+ 162:	e8 82 01 00 00       	call   2e9 <fstat>
+ 167:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 169:	89 1c 24             	mov    %ebx,(%esp)
+ 16c:	e8 48 01 00 00       	call   2b9 <close>
+  return r;
+ 171:	83 c4 10             	add    $0x10,%esp
+}
+ 174:	89 f0                	mov    %esi,%eax
+ 176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return -1;
+ 17d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 182:	eb f0                	jmp    174 <stat+0x34>
+
+00000184 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 184:	55                   	push   %ebp
+ 185:	89 e5                	mov    %esp,%ebp
+ 187:	56                   	push   %esi
+ 188:	53                   	push   %ebx
+ 189:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 18c:	0f b6 0a             	movzbl (%edx),%ecx
+ 18f:	80 f9 20             	cmp    $0x20,%cl
+ 192:	75 0b                	jne    19f <atoi+0x1b>
+ 194:	83 c2 01             	add    $0x1,%edx
+ 197:	0f b6 0a             	movzbl (%edx),%ecx
+ 19a:	80 f9 20             	cmp    $0x20,%cl
+ 19d:	74 f5                	je     194 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 19f:	80 f9 2d             	cmp    $0x2d,%cl
+ 1a2:	74 3c                	je     1e0 <atoi+0x5c>
+  if (*s == '+'  || *s == '-')
+ 1a4:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 1a7:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1ac:	f6 c1 fd             	test   $0xfd,%cl
+ 1af:	74 34                	je     1e5 <atoi+0x61>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1b1:	0f b6 0a             	movzbl (%edx),%ecx
+ 1b4:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1b7:	3c 09                	cmp    $0x9,%al
+ 1b9:	77 2f                	ja     1ea <atoi+0x66>
+ 1bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*10 + *s++ - '0';
+ 1c0:	83 c2 01             	add    $0x1,%edx
+ 1c3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1c6:	0f be c9             	movsbl %cl,%ecx
+ 1c9:	8d 5c 41 d0          	lea    -0x30(%ecx,%eax,2),%ebx
+  while('0' <= *s && *s <= '9')
+ 1cd:	0f b6 0a             	movzbl (%edx),%ecx
+ 1d0:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1d3:	3c 09                	cmp    $0x9,%al
+ 1d5:	76 e9                	jbe    1c0 <atoi+0x3c>
+  return sign*n;
+ 1d7:	89 f0                	mov    %esi,%eax
+ 1d9:	0f af c3             	imul   %ebx,%eax
+}
+ 1dc:	5b                   	pop    %ebx
+ 1dd:	5e                   	pop    %esi
+ 1de:	5d                   	pop    %ebp
+ 1df:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 1e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 1e5:	83 c2 01             	add    $0x1,%edx
+ 1e8:	eb c7                	jmp    1b1 <atoi+0x2d>
+  while('0' <= *s && *s <= '9')
+ 1ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ef:	eb e6                	jmp    1d7 <atoi+0x53>
+
+000001f1 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1f9:	0f b6 0a             	movzbl (%edx),%ecx
+ 1fc:	80 f9 20             	cmp    $0x20,%cl
+ 1ff:	75 0b                	jne    20c <atoo+0x1b>
+ 201:	83 c2 01             	add    $0x1,%edx
+ 204:	0f b6 0a             	movzbl (%edx),%ecx
+ 207:	80 f9 20             	cmp    $0x20,%cl
+ 20a:	74 f5                	je     201 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 20c:	80 f9 2d             	cmp    $0x2d,%cl
+ 20f:	74 3a                	je     24b <atoo+0x5a>
+  if (*s == '+'  || *s == '-')
+ 211:	83 e9 2b             	sub    $0x2b,%ecx
+  sign = (*s == '-') ? -1 : 1;
+ 214:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 219:	f6 c1 fd             	test   $0xfd,%cl
+ 21c:	74 32                	je     250 <atoo+0x5f>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 21e:	0f b6 0a             	movzbl (%edx),%ecx
+ 221:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 224:	80 fb 07             	cmp    $0x7,%bl
+ 227:	77 2c                	ja     255 <atoo+0x64>
+ 229:	bb 00 00 00 00       	mov    $0x0,%ebx
+    n = n*8 + *s++ - '0';
+ 22e:	83 c2 01             	add    $0x1,%edx
+ 231:	0f be c9             	movsbl %cl,%ecx
+ 234:	8d 5c d9 d0          	lea    -0x30(%ecx,%ebx,8),%ebx
+  while('0' <= *s && *s <= '7')
+ 238:	0f b6 0a             	movzbl (%edx),%ecx
+ 23b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 23e:	3c 07                	cmp    $0x7,%al
+ 240:	76 ec                	jbe    22e <atoo+0x3d>
+  return sign*n;
+ 242:	89 f0                	mov    %esi,%eax
+ 244:	0f af c3             	imul   %ebx,%eax
+}
+ 247:	5b                   	pop    %ebx
+ 248:	5e                   	pop    %esi
+ 249:	5d                   	pop    %ebp
+ 24a:	c3                   	ret
+  sign = (*s == '-') ? -1 : 1;
+ 24b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	eb c9                	jmp    21e <atoo+0x2d>
+  while('0' <= *s && *s <= '7')
+ 255:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 25a:	eb e6                	jmp    242 <atoo+0x51>
+
+0000025c <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 25c:	55                   	push   %ebp
+ 25d:	89 e5                	mov    %esp,%ebp
+ 25f:	56                   	push   %esi
+ 260:	53                   	push   %ebx
+ 261:	8b 75 08             	mov    0x8(%ebp),%esi
+ 264:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 267:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 26a:	85 db                	test   %ebx,%ebx
+ 26c:	7e 15                	jle    283 <memmove+0x27>
+ 26e:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 270:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 272:	83 c2 01             	add    $0x1,%edx
+ 275:	83 c0 01             	add    $0x1,%eax
+ 278:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 27c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 27f:	39 c3                	cmp    %eax,%ebx
+ 281:	75 ef                	jne    272 <memmove+0x16>
+  return vdst;
+}
+ 283:	89 f0                	mov    %esi,%eax
+ 285:	5b                   	pop    %ebx
+ 286:	5e                   	pop    %esi
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+
+00000289 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 289:	b8 01 00 00 00       	mov    $0x1,%eax
+ 28e:	cd 40                	int    $0x40
+ 290:	c3                   	ret
+
+00000291 <exit>:
+SYSCALL(exit)
+ 291:	b8 02 00 00 00       	mov    $0x2,%eax
+ 296:	cd 40                	int    $0x40
+ 298:	c3                   	ret
+
+00000299 <wait>:
+SYSCALL(wait)
+ 299:	b8 03 00 00 00       	mov    $0x3,%eax
+ 29e:	cd 40                	int    $0x40
+ 2a0:	c3                   	ret
+
+000002a1 <pipe>:
+SYSCALL(pipe)
+ 2a1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2a6:	cd 40                	int    $0x40
+ 2a8:	c3                   	ret
+
+000002a9 <read>:
+SYSCALL(read)
+ 2a9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2ae:	cd 40                	int    $0x40
+ 2b0:	c3                   	ret
+
+000002b1 <write>:
+SYSCALL(write)
+ 2b1:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2b6:	cd 40                	int    $0x40
+ 2b8:	c3                   	ret
+
+000002b9 <close>:
+SYSCALL(close)
+ 2b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2be:	cd 40                	int    $0x40
+ 2c0:	c3                   	ret
+
+000002c1 <kill>:
+SYSCALL(kill)
+ 2c1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <exec>:
+SYSCALL(exec)
+ 2c9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <open>:
+SYSCALL(open)
+ 2d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <mknod>:
+SYSCALL(mknod)
+ 2d9:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <unlink>:
+SYSCALL(unlink)
+ 2e1:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <fstat>:
+SYSCALL(fstat)
+ 2e9:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <link>:
+SYSCALL(link)
+ 2f1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <mkdir>:
+SYSCALL(mkdir)
+ 2f9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <chdir>:
+SYSCALL(chdir)
+ 301:	b8 09 00 00 00       	mov    $0x9,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <dup>:
+SYSCALL(dup)
+ 309:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <getpid>:
+SYSCALL(getpid)
+ 311:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <sbrk>:
+SYSCALL(sbrk)
+ 319:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <sleep>:
+SYSCALL(sleep)
+ 321:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <uptime>:
+SYSCALL(uptime)
+ 329:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <halt>:
+SYSCALL(halt)
+ 331:	b8 16 00 00 00       	mov    $0x16,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <date>:
+SYSCALL(date)
+ 339:	b8 17 00 00 00       	mov    $0x17,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <getuid>:
+SYSCALL(getuid)
+ 341:	b8 18 00 00 00       	mov    $0x18,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <getgid>:
+SYSCALL(getgid)
+ 349:	b8 19 00 00 00       	mov    $0x19,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <getppid>:
+SYSCALL(getppid)
+ 351:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <setuid>:
+SYSCALL(setuid)
+ 359:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <setgid>:
+SYSCALL(setgid)
+ 361:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <getprocs>:
+SYSCALL(getprocs)
+ 369:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <setpriority>:
+SYSCALL(setpriority)
+ 371:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <getpriority>:
+SYSCALL(getpriority)
+ 379:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <waitpid>:
+SYSCALL(waitpid)
+ 381:	b8 20 00 00 00       	mov    $0x20,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <setaffinity>:
+SYSCALL(setaffinity)
+ 389:	b8 21 00 00 00       	mov    $0x21,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <getaffinity>:
+SYSCALL(getaffinity)
+ 391:	b8 22 00 00 00       	mov    $0x22,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <setdeadline>:
+SYSCALL(setdeadline)
+ 399:	b8 23 00 00 00       	mov    $0x23,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <schedctl>:
+SYSCALL(schedctl)
+ 3a1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <spawn>:
+SYSCALL(spawn)
+ 3a9:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <vmstats>:
+SYSCALL(vmstats)
+ 3b1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <hugesbrk>:
+SYSCALL(hugesbrk)
+ 3b9:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <setshares>:
+SYSCALL(setshares)
+ 3c1:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <getshares>:
+SYSCALL(getshares)
+ 3c9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d1:	55                   	push   %ebp
+ 3d2:	89 e5                	mov    %esp,%ebp
+ 3d4:	57                   	push   %edi
+ 3d5:	56                   	push   %esi
+ 3d6:	53                   	push   %ebx
+ 3d7:	83 ec 3c             	sub    $0x3c,%esp
+ 3da:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3dd:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3df:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3e3:	74 79                	je     45e <printint+0x8d>
+ 3e5:	85 d2                	test   %edx,%edx
+ 3e7:	79 75                	jns    45e <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 3e9:	89 d1                	mov    %edx,%ecx
+ 3eb:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3ed:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3f9:	89 df                	mov    %ebx,%edi
+ 3fb:	83 c3 01             	add    $0x1,%ebx
+ 3fe:	89 c8                	mov    %ecx,%eax
+ 400:	ba 00 00 00 00       	mov    $0x0,%edx
+ 405:	f7 f6                	div    %esi
+ 407:	0f b6 92 c0 07 00 00 	movzbl 0x7c0(%edx),%edx
+ 40e:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 412:	89 ca                	mov    %ecx,%edx
+ 414:	89 c1                	mov    %eax,%ecx
+ 416:	39 f2                	cmp    %esi,%edx
+ 418:	73 df                	jae    3f9 <printint+0x28>
+  if(neg)
+ 41a:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 41e:	74 08                	je     428 <printint+0x57>
+    buf[i++] = '-';
+ 420:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 425:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 428:	85 db                	test   %ebx,%ebx
+ 42a:	7e 2a                	jle    456 <printint+0x85>
+ 42c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 42f:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 433:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 436:	0f b6 03             	movzbl (%ebx),%eax
+ 439:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 43c:	83 ec 04             	sub    $0x4,%esp
+ 43f:	6a 01                	push   $0x1
+ 441:	57                   	push   %edi
+ 442:	ff 75 c4             	push   -0x3c(%ebp)
+ 445:	e8 67 fe ff ff       	call   2b1 <write>
+  while(--i >= 0)
+ 44a:	89 d8                	mov    %ebx,%eax
+ 44c:	83 eb 01             	sub    $0x1,%ebx
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	39 f0                	cmp    %esi,%eax
+ 454:	75 e0                	jne    436 <printint+0x65>
+}
+ 456:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 459:	5b                   	pop    %ebx
+ 45a:	5e                   	pop    %esi
+ 45b:	5f                   	pop    %edi
+ 45c:	5d                   	pop    %ebp
+ 45d:	c3                   	ret
+    x = xx;
+ 45e:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 460:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 467:	eb 8b                	jmp    3f4 <printint+0x23>
+
+00000469 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 469:	55                   	push   %ebp
+ 46a:	89 e5                	mov    %esp,%ebp
+ 46c:	57                   	push   %edi
+ 46d:	56                   	push   %esi
+ 46e:	53                   	push   %ebx
+ 46f:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 472:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 475:	0f b6 1e             	movzbl (%esi),%ebx
+ 478:	84 db                	test   %bl,%bl
+ 47a:	0f 84 9e 01 00 00    	je     61e <printf+0x1b5>
+ 480:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 483:	8d 45 10             	lea    0x10(%ebp),%eax
+ 486:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 489:	bf 00 00 00 00       	mov    $0x0,%edi
+ 48e:	eb 2d                	jmp    4bd <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 490:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 493:	83 ec 04             	sub    $0x4,%esp
+ 496:	6a 01                	push   $0x1
+ 498:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 49b:	50                   	push   %eax
+ 49c:	ff 75 08             	push   0x8(%ebp)
+ 49f:	e8 0d fe ff ff       	call   2b1 <write>
+        putc(fd, c);
+ 4a4:	83 c4 10             	add    $0x10,%esp
+ 4a7:	eb 05                	jmp    4ae <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4a9:	83 ff 25             	cmp    $0x25,%edi
+ 4ac:	74 1f                	je     4cd <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4ae:	83 c6 01             	add    $0x1,%esi
+ 4b1:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4b5:	84 db                	test   %bl,%bl
+ 4b7:	0f 84 61 01 00 00    	je     61e <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4bd:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4c0:	85 ff                	test   %edi,%edi
+ 4c2:	75 e5                	jne    4a9 <printf+0x40>
+      if(c == '%'){
+ 4c4:	83 f8 25             	cmp    $0x25,%eax
+ 4c7:	75 c7                	jne    490 <printf+0x27>
+        state = '%';
+ 4c9:	89 c7                	mov    %eax,%edi
+ 4cb:	eb e1                	jmp    4ae <printf+0x45>
+      if(c == 'd'){
+ 4cd:	83 f8 25             	cmp    $0x25,%eax
+ 4d0:	0f 84 f4 00 00 00    	je     5ca <printf+0x161>
+ 4d6:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4d9:	83 fa 15             	cmp    $0x15,%edx
+ 4dc:	0f 87 09 01 00 00    	ja     5eb <printf+0x182>
+ 4e2:	0f 87 03 01 00 00    	ja     5eb <printf+0x182>
+ 4e8:	ff 24 95 68 07 00 00 	jmp    *0x768(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 4ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4f2:	8b 17                	mov    (%edi),%edx
+ 4f4:	83 ec 0c             	sub    $0xc,%esp
+ 4f7:	6a 01                	push   $0x1
+ 4f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 501:	e8 cb fe ff ff       	call   3d1 <printint>
+        ap++;
+ 506:	83 c7 04             	add    $0x4,%edi
+ 509:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 50c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 50f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 514:	eb 98                	jmp    4ae <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 516:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 519:	8b 17                	mov    (%edi),%edx
+ 51b:	83 ec 0c             	sub    $0xc,%esp
+ 51e:	6a 00                	push   $0x0
+ 520:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 525:	8b 45 08             	mov    0x8(%ebp),%eax
+ 528:	e8 a4 fe ff ff       	call   3d1 <printint>
+        ap++;
+ 52d:	83 c7 04             	add    $0x4,%edi
+ 530:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 533:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 536:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53b:	e9 6e ff ff ff       	jmp    4ae <printf+0x45>
+        s = (char*)*ap;
+ 540:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 543:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 545:	83 c1 04             	add    $0x4,%ecx
+ 548:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 54b:	85 c0                	test   %eax,%eax
+ 54d:	74 13                	je     562 <printf+0xf9>
+        s = (char*)*ap;
+ 54f:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 551:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 554:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 559:	84 c0                	test   %al,%al
+ 55b:	75 0f                	jne    56c <printf+0x103>
+ 55d:	e9 4c ff ff ff       	jmp    4ae <printf+0x45>
+          s = "(null)";
+ 562:	bb 60 07 00 00       	mov    $0x760,%ebx
+        while(*s != 0){
+ 567:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 56c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 56f:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 572:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 575:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 578:	83 ec 04             	sub    $0x4,%esp
+ 57b:	6a 01                	push   $0x1
+ 57d:	57                   	push   %edi
+ 57e:	56                   	push   %esi
+ 57f:	e8 2d fd ff ff       	call   2b1 <write>
+          s++;
+ 584:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 587:	0f b6 03             	movzbl (%ebx),%eax
+ 58a:	83 c4 10             	add    $0x10,%esp
+ 58d:	84 c0                	test   %al,%al
+ 58f:	75 e4                	jne    575 <printf+0x10c>
+      state = 0;
+ 591:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 594:	bf 00 00 00 00       	mov    $0x0,%edi
+ 599:	e9 10 ff ff ff       	jmp    4ae <printf+0x45>
+        putc(fd, *ap);
+ 59e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5a1:	8b 07                	mov    (%edi),%eax
+ 5a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a6:	83 ec 04             	sub    $0x4,%esp
+ 5a9:	6a 01                	push   $0x1
+ 5ab:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5ae:	50                   	push   %eax
+ 5af:	ff 75 08             	push   0x8(%ebp)
+ 5b2:	e8 fa fc ff ff       	call   2b1 <write>
+        ap++;
+ 5b7:	83 c7 04             	add    $0x4,%edi
+ 5ba:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5bd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5c0:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c5:	e9 e4 fe ff ff       	jmp    4ae <printf+0x45>
+        putc(fd, c);
+ 5ca:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5cd:	83 ec 04             	sub    $0x4,%esp
+ 5d0:	6a 01                	push   $0x1
+ 5d2:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5d5:	50                   	push   %eax
+ 5d6:	ff 75 08             	push   0x8(%ebp)
+ 5d9:	e8 d3 fc ff ff       	call   2b1 <write>
+ 5de:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e6:	e9 c3 fe ff ff       	jmp    4ae <printf+0x45>
+        putc(fd, '%');
+ 5eb:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ef:	83 ec 04             	sub    $0x4,%esp
+ 5f2:	6a 01                	push   $0x1
+ 5f4:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5f7:	57                   	push   %edi
+ 5f8:	ff 75 08             	push   0x8(%ebp)
+ 5fb:	e8 b1 fc ff ff       	call   2b1 <write>
+        putc(fd, c);
+ 600:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 603:	83 c4 0c             	add    $0xc,%esp
+ 606:	6a 01                	push   $0x1
+ 608:	57                   	push   %edi
+ 609:	ff 75 08             	push   0x8(%ebp)
+ 60c:	e8 a0 fc ff ff       	call   2b1 <write>
+        putc(fd, c);
+ 611:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 614:	bf 00 00 00 00       	mov    $0x0,%edi
+ 619:	e9 90 fe ff ff       	jmp    4ae <printf+0x45>
+    }
+  }
+}
+ 61e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 621:	5b                   	pop    %ebx
+ 622:	5e                   	pop    %esi
+ 623:	5f                   	pop    %edi
+ 624:	5d                   	pop    %ebp
+ 625:	c3                   	ret
+
+00000626 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 626:	55                   	push   %ebp
+ 627:	89 e5                	mov    %esp,%ebp
+ 629:	57                   	push   %edi
+ 62a:	56                   	push   %esi
+ 62b:	53                   	push   %ebx
+ 62c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 62f:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 632:	a1 58 0a 00 00       	mov    0xa58,%eax
+ 637:	eb 0c                	jmp    645 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 639:	8b 10                	mov    (%eax),%edx
+ 63b:	39 d0                	cmp    %edx,%eax
+ 63d:	72 04                	jb     643 <free+0x1d>
+ 63f:	39 d1                	cmp    %edx,%ecx
+ 641:	72 10                	jb     653 <free+0x2d>
+{
+ 643:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 645:	39 c8                	cmp    %ecx,%eax
+ 647:	73 f0                	jae    639 <free+0x13>
+ 649:	8b 10                	mov    (%eax),%edx
+ 64b:	39 d1                	cmp    %edx,%ecx
+ 64d:	72 04                	jb     653 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 64f:	39 d0                	cmp    %edx,%eax
+ 651:	72 f0                	jb     643 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 653:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 656:	8b 10                	mov    (%eax),%edx
+ 658:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 65b:	39 fa                	cmp    %edi,%edx
+ 65d:	74 19                	je     678 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 65f:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 662:	8b 50 04             	mov    0x4(%eax),%edx
+ 665:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 668:	39 f1                	cmp    %esi,%ecx
+ 66a:	74 18                	je     684 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 66c:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 66e:	a3 58 0a 00 00       	mov    %eax,0xa58
+}
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 678:	03 72 04             	add    0x4(%edx),%esi
+ 67b:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 67e:	8b 10                	mov    (%eax),%edx
+ 680:	8b 12                	mov    (%edx),%edx
+ 682:	eb db                	jmp    65f <free+0x39>
+    p->s.size += bp->s.size;
+ 684:	03 53 fc             	add    -0x4(%ebx),%edx
+ 687:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 68a:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 68d:	eb dd                	jmp    66c <free+0x46>
+
+0000068f <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 68f:	55                   	push   %ebp
+ 690:	89 e5                	mov    %esp,%ebp
+ 692:	57                   	push   %edi
+ 693:	56                   	push   %esi
+ 694:	53                   	push   %ebx
+ 695:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 698:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69b:	8d 58 07             	lea    0x7(%eax),%ebx
+ 69e:	c1 eb 03             	shr    $0x3,%ebx
+ 6a1:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6a4:	8b 15 58 0a 00 00    	mov    0xa58,%edx
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 1c                	je     6ca <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6ae:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6b0:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6b3:	39 d9                	cmp    %ebx,%ecx
+ 6b5:	73 38                	jae    6ef <malloc+0x60>
+  if(nu < 4096)
+ 6b7:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6bc:	39 f3                	cmp    %esi,%ebx
+ 6be:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6c1:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6c8:	eb 72                	jmp    73c <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6ca:	c7 05 58 0a 00 00 5c 	movl   $0xa5c,0xa58
+ 6d1:	0a 00 00 
+ 6d4:	c7 05 5c 0a 00 00 5c 	movl   $0xa5c,0xa5c
+ 6db:	0a 00 00 
+    base.s.size = 0;
+ 6de:	c7 05 60 0a 00 00 00 	movl   $0x0,0xa60
+ 6e5:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e8:	b8 5c 0a 00 00       	mov    $0xa5c,%eax
+    if(p->s.size >= nunits){
+ 6ed:	eb c8                	jmp    6b7 <malloc+0x28>
+      if(p->s.size == nunits)
+ 6ef:	39 cb                	cmp    %ecx,%ebx
+ 6f1:	74 1e                	je     711 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6f3:	29 d9                	sub    %ebx,%ecx
+ 6f5:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6f8:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 6fb:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6fe:	89 15 58 0a 00 00    	mov    %edx,0xa58
+      return (void*)(p + 1);
+ 704:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 707:	89 d0                	mov    %edx,%eax
+ 709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 70c:	5b                   	pop    %ebx
+ 70d:	5e                   	pop    %esi
+ 70e:	5f                   	pop    %edi
+ 70f:	5d                   	pop    %ebp
+ 710:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 711:	8b 08                	mov    (%eax),%ecx
+ 713:	89 0a                	mov    %ecx,(%edx)
+ 715:	eb e7                	jmp    6fe <malloc+0x6f>
+  hp->s.size = nu;
+ 717:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 71a:	83 ec 0c             	sub    $0xc,%esp
+ 71d:	83 c0 08             	add    $0x8,%eax
+ 720:	50                   	push   %eax
+ 721:	e8 00 ff ff ff       	call   626 <free>
+  return freep;
+ 726:	8b 15 58 0a 00 00    	mov    0xa58,%edx
+      if((p = morecore(nunits)) == 0)
+ 72c:	83 c4 10             	add    $0x10,%esp
+ 72f:	85 d2                	test   %edx,%edx
+ 731:	74 d4                	je     707 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 733:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 735:	8b 48 04             	mov    0x4(%eax),%ecx
+ 738:	39 d9                	cmp    %ebx,%ecx
+ 73a:	73 b3                	jae    6ef <malloc+0x60>
+    if(p == freep)
+ 73c:	89 c2                	mov    %eax,%edx
+ 73e:	39 05 58 0a 00 00    	cmp    %eax,0xa58
+ 744:	75 ed                	jne    733 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 746:	83 ec 0c             	sub    $0xc,%esp
+ 749:	57                   	push   %edi
+ 74a:	e8 ca fb ff ff       	call   319 <sbrk>
+  if(p == (char*)-1)
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 755:	75 c0                	jne    717 <malloc+0x88>
+        return 0;
+ 757:	ba 00 00 00 00       	mov    $0x0,%edx
+ 75c:	eb a9                	jmp    707 <malloc+0x78>